@@ -0,0 +1,441 @@
+/**
+ * @file audio.c
+ * @brief PWM Audio Output Implementation
+ * @note A DMA timer paces both channels at the sample rate, each writes its half of the buffer
+ *       to the PWM compare register and then starts the other one. 16-bit writes to the
+ *       register are replicated into both channel halves, the unused one isn't routed to a pin.
+ *       Voices are mixed in 32 bits, clamped to 16 and scaled to the PWM range.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "audio.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define AUDIO_DMA_IRQ           (DMA_IRQ_0 + AUDIO_DMA_IRQ_INDEX)
+#define AUDIO_PWM_TOP           ((1u << AUDIO_PWM_BITS) - 1)
+
+/* Voice handles: slot in the low bits, a generation above so a stale handle stops nothing */
+#define AUDIO_SLOT_BITS         4
+#define AUDIO_SLOT_MASK         ((1 << AUDIO_SLOT_BITS) - 1)
+
+#if AUDIO_VOICES > AUDIO_SLOT_MASK
+#error "AUDIO_VOICES too large for the voice handle"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    AUDIO_VOICE_OFF = 0,
+    AUDIO_VOICE_PCM,
+    AUDIO_VOICE_TONE,
+} audio_voice_type_t;
+
+/**
+ * @brief Voice state
+ */
+typedef struct {
+    audio_voice_type_t type;
+    int32_t gain;                       // volume * 257 / 2: 0..32767 for 0..255
+    uint32_t gen;                       // Generation of the handle
+    /* PCM */
+    const int8_t *pcm;
+    uint32_t len;
+    uint32_t pos;
+    uint32_t release;                   // Stopped: samples of the fade-out, 0 = playing
+    /* Tone and melody */
+    uint32_t phase;                     // Q32 of one period
+    uint32_t step;                      // Phase increment per sample, 0 = rest
+    uint32_t done;                      // Samples of the note played
+    uint32_t left;                      // Samples of the note left, UINT32_MAX = endless
+    const audio_note_t *notes;
+    uint32_t note_count;
+    uint32_t note;                      // Next note
+} audio_voice_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static int audio_start_voice(const audio_voice_t *v);
+static bool audio_next_note(audio_voice_t *v);
+static bool audio_mix(uint16_t *out);
+static void audio_run(void);
+static void audio_dma_irq_handler(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* Damped 3 kHz burst at 16 kHz, a soft tick */
+static const int8_t audio_click_pcm[] = {
+    0, 106, 74, -36, -85, -29, 49, 58, 0, -48, -33, 16, 38, 13, -22, -26,
+    0, 21, 15, -7, -17, -6, 10, 12, 0, -10, -7, 3, 8, 3, -4, -5,
+    0, 4, 3, -1, -3, -1, 2, 2, 0, -2, -1, 1, 2, 1, -1, -1,
+};
+
+static uint16_t audio_buf[2][AUDIO_BLOCK];
+static bool audio_silent[2];                    // Half holds nothing but silence
+static int audio_chan[2] = {-1, -1};
+static uint audio_slice = 0;
+
+/* Voices and the running flag, guarded by audio_lock (API on any core, mixing in the IRQ) */
+static spin_lock_t *audio_lock = NULL;
+static audio_voice_t audio_voices[AUDIO_VOICES];
+static uint32_t audio_gen = 0;
+static bool audio_running = false;
+static uint32_t audio_bias = 0;                 // Idle ramp: 0 = low .. AUDIO_IDLE_RAMP = mid-scale
+static audio_stats_t audio_stats;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Set up the PWM output and the DMA channels
+ */
+void audio_init(uint32_t pin)
+{
+    if (audio_lock != NULL) {
+        return;  // Already set up
+    }
+    audio_lock = spin_lock_init(spin_lock_claim_unused(true));
+
+    // 1. PWM at full clock, level 0 (idle) until something plays
+    gpio_set_function(pin, GPIO_FUNC_PWM);
+    audio_slice = pwm_gpio_to_slice_num(pin);
+    pwm_config pc = pwm_get_default_config();
+    pwm_config_set_clkdiv(&pc, 1.0f);
+    pwm_config_set_wrap(&pc, AUDIO_PWM_TOP);
+    pwm_init(audio_slice, &pc, true);
+    pwm_set_gpio_level(pin, 0);
+
+    // 2. DMA timer at the sample rate: clk_sys * num / den, reduced to fit 16 bits
+    uint32_t num = AUDIO_SAMPLE_HZ;
+    uint32_t den = clock_get_hz(clk_sys);
+    uint32_t a = num, b = den;
+    while (b != 0) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    num /= a;
+    den /= a;
+    while (den > 0xFFFF) {
+        num = (num + 1) / 2;
+        den /= 2;
+    }
+    int timer = dma_claim_unused_timer(true);
+    dma_timer_set_fraction(timer, (uint16_t)num, (uint16_t)den);
+
+    // 3. Two channels, each plays its half then starts the other one
+    for (int i = 0; i < 2; i++) {
+        audio_chan[i] = dma_claim_unused_channel(true);
+    }
+    for (int i = 0; i < 2; i++) {
+        dma_channel_config cfg = dma_channel_get_default_config(audio_chan[i]);
+        channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+        channel_config_set_read_increment(&cfg, true);
+        channel_config_set_write_increment(&cfg, false);
+        channel_config_set_dreq(&cfg, dma_get_timer_dreq(timer));
+        channel_config_set_chain_to(&cfg, audio_chan[i ^ 1]);
+        dma_channel_configure(audio_chan[i], &cfg, &pwm_hw->slice[audio_slice].cc, audio_buf[i], AUDIO_BLOCK, false);
+        dma_irqn_set_channel_enabled(AUDIO_DMA_IRQ_INDEX, audio_chan[i], true);
+    }
+    irq_add_shared_handler(AUDIO_DMA_IRQ, audio_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(AUDIO_DMA_IRQ, true);
+}
+
+/**
+ * @brief Play 8-bit signed PCM at AUDIO_SAMPLE_HZ
+ */
+int audio_play(const int8_t *pcm, uint32_t len, uint8_t volume)
+{
+    audio_voice_t v = {
+        .type = AUDIO_VOICE_PCM,
+        .gain = volume * 257 / 2,
+        .pcm = pcm,
+        .len = len,
+    };
+    return audio_start_voice(&v);
+}
+
+/**
+ * @brief Play a square wave tone
+ */
+int audio_tone(uint32_t freq_hz, uint32_t ms, uint8_t volume)
+{
+    audio_voice_t v = {
+        .type = AUDIO_VOICE_TONE,
+        .gain = volume * 257 / 2,
+        .step = (uint32_t)(((uint64_t)freq_hz << 32) / AUDIO_SAMPLE_HZ),
+        .left = ms ? ms * (AUDIO_SAMPLE_HZ / 1000) : UINT32_MAX,
+    };
+    return audio_start_voice(&v);
+}
+
+/**
+ * @brief Play a sequence of tones
+ */
+int audio_melody(const audio_note_t *notes, uint32_t count, uint8_t volume)
+{
+    audio_voice_t v = {
+        .type = AUDIO_VOICE_TONE,
+        .gain = volume * 257 / 2,
+        .notes = notes,
+        .note_count = count,
+    };
+    if (!audio_next_note(&v)) {
+        return -1;
+    }
+    return audio_start_voice(&v);
+}
+
+/**
+ * @brief Short click for UI feedback
+ */
+void audio_click(void)
+{
+    audio_play(audio_click_pcm, sizeof(audio_click_pcm), 255);
+}
+
+/**
+ * @brief Stop a voice
+ */
+void audio_stop(int voice)
+{
+    if (voice < 0 || (voice & AUDIO_SLOT_MASK) >= AUDIO_VOICES || audio_lock == NULL) {
+        return;
+    }
+
+    uint32_t irq = spin_lock_blocking(audio_lock);
+    audio_voice_t *v = &audio_voices[voice & AUDIO_SLOT_MASK];
+    if (v->type != AUDIO_VOICE_OFF && v->gen == ((uint32_t)voice >> AUDIO_SLOT_BITS)) {
+        // Release: at most AUDIO_RAMP samples left, the envelope takes them down to silence
+        v->notes = NULL;
+        if (v->type == AUDIO_VOICE_TONE && v->left > AUDIO_RAMP) {
+            v->left = AUDIO_RAMP;
+        } else if (v->type == AUDIO_VOICE_PCM && v->release == 0) {
+            if (v->len - v->pos > AUDIO_RAMP) {
+                v->len = v->pos + AUDIO_RAMP;
+            }
+            v->release = v->len - v->pos;
+        }
+    }
+    spin_unlock(audio_lock, irq);
+}
+
+/**
+ * @brief Get output statistics
+ */
+void audio_get_stats(audio_stats_t *stats)
+{
+    *stats = audio_stats;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Put a voice into a free slot and make sure the output runs
+ * @return Voice handle, -1 if all voices are busy
+ */
+static int audio_start_voice(const audio_voice_t *v)
+{
+    int handle = -1;
+
+    if (audio_lock == NULL) {
+        return -1;  // Not initialized
+    }
+
+    uint32_t irq = spin_lock_blocking(audio_lock);
+    for (int i = 0; i < AUDIO_VOICES; i++) {
+        if (audio_voices[i].type == AUDIO_VOICE_OFF) {
+            audio_gen = (audio_gen + 1) & ((1u << (31 - AUDIO_SLOT_BITS)) - 1);
+            audio_voices[i] = *v;
+            audio_voices[i].gen = audio_gen;
+            handle = (int)((audio_gen << AUDIO_SLOT_BITS) | (uint32_t)i);
+            break;
+        }
+    }
+    if (handle >= 0 && !audio_running) {
+        audio_run();
+    }
+    spin_unlock(audio_lock, irq);
+
+    return handle;
+}
+
+/**
+ * @brief Load the next note of a melody
+ * @return false when the melody has ended
+ */
+static bool audio_next_note(audio_voice_t *v)
+{
+    if (v->notes == NULL || v->note >= v->note_count) {
+        return false;
+    }
+
+    const audio_note_t *n = &v->notes[v->note++];
+    v->step = (uint32_t)(((uint64_t)n->freq_hz << 32) / AUDIO_SAMPLE_HZ);
+    v->left = n->ms * (AUDIO_SAMPLE_HZ / 1000);
+    v->done = 0;
+    v->phase = 0;
+    return true;
+}
+
+/**
+ * @brief Mix one block of all voices, audio_lock held
+ * @param out AUDIO_BLOCK PWM levels
+ * @return true if the block is idle (output low, no voice left playing)
+ */
+static bool audio_mix(uint16_t *out)
+{
+    static int32_t acc[AUDIO_BLOCK];
+    bool any = false;
+
+    for (int i = 0; i < AUDIO_VOICES; i++) {
+        any = any || audio_voices[i].type != AUDIO_VOICE_OFF;
+    }
+
+    // Not at mid-scale: ramp towards it while voices wait, or down to idle once they ended
+    if (audio_bias < AUDIO_IDLE_RAMP || !any) {
+        bool idle = audio_bias == 0 && !any;
+        for (uint32_t s = 0; s < AUDIO_BLOCK; s++) {
+            if (any && audio_bias < AUDIO_IDLE_RAMP) {
+                audio_bias++;
+            } else if (!any && audio_bias > 0) {
+                audio_bias--;
+            }
+            out[s] = (uint16_t)((32768u * audio_bias / AUDIO_IDLE_RAMP) >> (16 - AUDIO_PWM_BITS));
+        }
+        audio_stats.blocks++;
+        return idle;
+    }
+
+    memset(acc, 0, sizeof(acc));
+
+    for (int i = 0; i < AUDIO_VOICES; i++) {
+        audio_voice_t *v = &audio_voices[i];
+
+        if (v->type == AUDIO_VOICE_PCM) {
+            // 1. Samples from flash, 8-bit signed
+            uint32_t n = v->len - v->pos;
+            if (n > AUDIO_BLOCK) {
+                n = AUDIO_BLOCK;
+            }
+            for (uint32_t s = 0; s < n; s++) {
+                int32_t amp = v->gain;
+                if (v->release != 0) {
+                    amp = amp * (int32_t)(v->len - v->pos - s) / (int32_t)v->release;
+                }
+                acc[s] += (v->pcm[v->pos + s] * amp) >> 7;
+            }
+            v->pos += n;
+            if (v->pos >= v->len) {
+                v->type = AUDIO_VOICE_OFF;
+            }
+        } else if (v->type == AUDIO_VOICE_TONE) {
+            // 2. Square wave with linear attack/release, notes back to back
+            for (uint32_t s = 0; s < AUDIO_BLOCK; s++) {
+                if (v->left == 0 && !audio_next_note(v)) {
+                    v->type = AUDIO_VOICE_OFF;
+                    break;
+                }
+                if (v->step != 0) {
+                    int32_t amp = v->gain;
+                    uint32_t edge = v->done < v->left ? v->done : v->left;
+                    if (edge < AUDIO_RAMP) {
+                        amp = amp * (int32_t)edge / AUDIO_RAMP;
+                    }
+                    acc[s] += (v->phase & 0x80000000u) ? -amp : amp;
+                    v->phase += v->step;
+                }
+                v->done++;
+                if (v->left != UINT32_MAX) {
+                    v->left--;
+                }
+            }
+        }
+    }
+
+    // 3. Clamp and scale to the PWM range, silence is the mid level
+    for (uint32_t s = 0; s < AUDIO_BLOCK; s++) {
+        int32_t x = acc[s];
+        if (x > 32767) {
+            x = 32767;
+        } else if (x < -32768) {
+            x = -32768;
+        }
+        out[s] = (uint16_t)((x + 32768) >> (16 - AUDIO_PWM_BITS));
+    }
+
+    audio_stats.blocks++;
+    return false;
+}
+
+/**
+ * @brief Start the output from idle, audio_lock held
+ */
+static void audio_run(void)
+{
+    audio_silent[0] = audio_mix(audio_buf[0]);
+    audio_silent[1] = audio_mix(audio_buf[1]);
+    dma_channel_set_read_addr(audio_chan[1], audio_buf[1], false);
+    dma_channel_set_read_addr(audio_chan[0], audio_buf[0], true);
+    audio_running = true;
+    audio_stats.starts++;
+}
+
+/**
+ * @brief DMA interrupt: a half has played
+ * @note Shared DMA_IRQ_1 handler, only handles its own channels
+ */
+static void audio_dma_irq_handler(void)
+{
+    for (int i = 0; i < 2; i++) {
+        if (!dma_irqn_get_channel_status(AUDIO_DMA_IRQ_INDEX, audio_chan[i])) {
+            continue;
+        }
+        dma_irqn_acknowledge_channel(AUDIO_DMA_IRQ_INDEX, audio_chan[i]);
+
+        uint32_t t0 = time_us_32();
+        uint32_t irq = spin_lock_blocking(audio_lock);
+
+        // 1. Refill the half that played while the other one plays, rearm it for the chain
+        audio_silent[i] = audio_mix(audio_buf[i]);
+        dma_channel_set_read_addr(audio_chan[i], audio_buf[i], false);
+
+        // 2. Both halves idle: the ramp has taken the output back to low (no idle current), stop
+        if (audio_silent[0] && audio_silent[1] && audio_running) {
+            for (int c = 0; c < 2; c++) {
+                dma_irqn_set_channel_enabled(AUDIO_DMA_IRQ_INDEX, audio_chan[c], false);
+            }
+            dma_channel_abort(audio_chan[0]);
+            dma_channel_abort(audio_chan[1]);
+            for (int c = 0; c < 2; c++) {
+                dma_irqn_acknowledge_channel(AUDIO_DMA_IRQ_INDEX, audio_chan[c]);
+                dma_irqn_set_channel_enabled(AUDIO_DMA_IRQ_INDEX, audio_chan[c], true);
+            }
+            audio_running = false;
+        }
+        spin_unlock(audio_lock, irq);
+
+        uint32_t us = time_us_32() - t0;
+        if (us > audio_stats.mix_max_us) {
+            audio_stats.mix_max_us = us;
+        }
+    }
+}
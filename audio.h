@@ -0,0 +1,125 @@
+/**
+ * @file audio.h
+ * @brief PWM Audio Output Header
+ * @note Mono PCM on one PWM pin (the buzzer). Two DMA channels play the halves of a sample
+ *       buffer at the sample rate while the interrupt of the finished half mixes the next
+ *       block of a few voices: flash samples, tones and note sequences. The output stops by
+ *       itself when everything has played. Idle is low, silence while playing is mid-scale:
+ *       the output ramps between the two so starting and stopping don't pop.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ *      DEFINES
+ **********************/
+/* Output sample rate (Hz) */
+#ifndef AUDIO_SAMPLE_HZ
+#define AUDIO_SAMPLE_HZ         16000
+#endif
+
+/* Samples per DMA half, one mix per half: 128 at 16 kHz = 8 ms */
+#ifndef AUDIO_BLOCK
+#define AUDIO_BLOCK             128
+#endif
+
+/* Voices mixed at once */
+#ifndef AUDIO_VOICES
+#define AUDIO_VOICES            4
+#endif
+
+/* PWM resolution, the carrier is clk_sys / 2^bits (488 kHz at 8 bits) */
+#define AUDIO_PWM_BITS          8
+
+/* Attack/release of tones and release of stopped voices (samples), avoids clicks at note edges */
+#define AUDIO_RAMP              32
+
+/* Ramp between idle (low) and mid-scale silence (samples), 10 ms: below what the buzzer plays */
+#define AUDIO_IDLE_RAMP         (AUDIO_SAMPLE_HZ / 100)
+
+/* DMA interrupt line (DMA_IRQ_1, shared with the joystick) */
+#define AUDIO_DMA_IRQ_INDEX     1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief One note of a melody
+ */
+typedef struct {
+    uint16_t freq_hz;           // 0 = rest
+    uint16_t ms;
+} audio_note_t;
+
+/**
+ * @brief Output statistics
+ */
+typedef struct {
+    uint32_t blocks;            // Blocks mixed
+    uint32_t starts;            // Times the output was started from idle
+    uint32_t mix_max_us;        // Longest mix of one block
+} audio_stats_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Set up the PWM output and the DMA channels, the output stays idle (low)
+ * @param pin PWM capable GPIO
+ * @note The interrupt is handled on the calling core: call on the core that runs the other
+ *       DMA_IRQ_1 users (the joystick)
+ */
+void audio_init(uint32_t pin);
+
+/**
+ * @brief Play 8-bit signed PCM at AUDIO_SAMPLE_HZ
+ * @param pcm Samples, must stay valid while playing (e.g. const data in flash)
+ * @param len Number of samples
+ * @param volume 0..255
+ * @return Voice, -1 if all voices are busy
+ */
+int audio_play(const int8_t *pcm, uint32_t len, uint8_t volume);
+
+/**
+ * @brief Play a square wave tone
+ * @param freq_hz Frequency
+ * @param ms Duration, 0 = until audio_stop()
+ * @param volume 0..255
+ * @return Voice, -1 if all voices are busy
+ */
+int audio_tone(uint32_t freq_hz, uint32_t ms, uint8_t volume);
+
+/**
+ * @brief Play a sequence of tones
+ * @param notes Notes, must stay valid while playing
+ * @param count Number of notes
+ * @param volume 0..255
+ * @return Voice, -1 if all voices are busy
+ */
+int audio_melody(const audio_note_t *notes, uint32_t count, uint8_t volume);
+
+/**
+ * @brief Short click for UI feedback
+ */
+void audio_click(void);
+
+/**
+ * @brief Stop a voice
+ * @param voice Return value of audio_play(), audio_tone() or audio_melody(), -1 is ignored
+ * @note The voice fades out over AUDIO_RAMP samples instead of being cut
+ */
+void audio_stop(int voice);
+
+/**
+ * @brief Get output statistics
+ * @param stats Output: counters since audio_init()
+ */
+void audio_get_stats(audio_stats_t *stats);
+
+#endif /* AUDIO_H */
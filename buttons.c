@@ -0,0 +1,165 @@
+/**
+ * @file buttons.c
+ * @brief Debounced Push Button Input Implementation
+ * @note The PIO program pushes the button window whenever it settled on a new state. The
+ *       interrupt compares it with the previous one and queues a press/release event per
+ *       changed button into a single producer / single consumer ring, no locks.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "buttons.h"
+#include "hardware/clocks.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+
+#include "buttons.pio.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BUTTONS_PIO             pio0
+#define BUTTONS_PIO_IRQ         (PIO0_IRQ_0 + BUTTONS_PIO_IRQ_INDEX)
+#define BUTTONS_PIN_COUNT       button_debounce_PIN_COUNT
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void buttons_irq_handler(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint buttons_sm = 0;
+static uint32_t buttons_mask = 0;               // Button bits of the window
+static uint32_t buttons_state = 0;              // Last reported window (masked)
+static bool buttons_primed = false;             // First FIFO word is the baseline
+static buttons_cb_t buttons_cb = NULL;
+static buttons_stats_t buttons_stats;
+
+/* Event queue: the interrupt is the only producer, one task the only consumer */
+static button_event_t buttons_queue[BUTTONS_QUEUE];
+static volatile uint32_t buttons_head = 0;      // Events pushed, written by the interrupt only
+static volatile uint32_t buttons_tail = 0;      // Events popped, written by the consumer only
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Start debouncing the buttons
+ */
+void buttons_init(uint32_t gpio_mask, buttons_cb_t cb)
+{
+    buttons_cb = cb;
+    buttons_mask = (gpio_mask >> BUTTONS_PIN_BASE) & ((1u << BUTTONS_PIN_COUNT) - 1);
+
+    // 1. Buttons are plain inputs, the other pins of the window keep their function
+    for (uint i = 0; i < BUTTONS_PIN_COUNT; i++) {
+        if (buttons_mask & (1u << i)) {
+            gpio_init(BUTTONS_PIN_BASE + i);
+            gpio_set_dir(BUTTONS_PIN_BASE + i, GPIO_IN);
+        }
+    }
+
+    // 2. State machine: window read LSB first, hold loop scaled to the debounce time
+    buttons_sm = pio_claim_unused_sm(BUTTONS_PIO, true);
+    uint offset = pio_add_program(BUTTONS_PIO, &button_debounce_program);
+    pio_sm_config c = button_debounce_program_get_default_config(offset);
+    sm_config_set_in_pins(&c, BUTTONS_PIN_BASE);
+    sm_config_set_in_shift(&c, false, false, 32);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+    float div = (float)clock_get_hz(clk_sys) * BUTTONS_DEBOUNCE_US / (1000000.0f * button_debounce_DEBOUNCE_CYCLES);
+    sm_config_set_clkdiv(&c, div < 1.0f ? 1.0f : div);
+    pio_sm_init(BUTTONS_PIO, buttons_sm, offset, &c);
+
+    // 3. Interrupt while the RX FIFO holds a state
+    pio_set_irqn_source_enabled(BUTTONS_PIO, BUTTONS_PIO_IRQ_INDEX, pio_get_rx_fifo_not_empty_interrupt_source(buttons_sm), true);
+    irq_add_shared_handler(BUTTONS_PIO_IRQ, buttons_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(BUTTONS_PIO_IRQ, true);
+
+    pio_sm_set_enabled(BUTTONS_PIO, buttons_sm, true);
+}
+
+/**
+ * @brief Take the oldest queued event
+ */
+bool buttons_get(button_event_t *ev)
+{
+    uint32_t tail = buttons_tail;
+
+    if (tail == buttons_head) {
+        return false;
+    }
+    __dmb();
+    *ev = buttons_queue[tail % BUTTONS_QUEUE];
+    __dmb();
+    buttons_tail = tail + 1;
+
+    return true;
+}
+
+/**
+ * @brief Get button statistics
+ */
+void buttons_get_stats(buttons_stats_t *stats)
+{
+    *stats = buttons_stats;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief PIO interrupt: settled button states are in the RX FIFO
+ * @note Shared PIO0_IRQ_0 handler, drains only its own state machine
+ */
+static void buttons_irq_handler(void)
+{
+    bool queued = false;
+
+    while (!pio_sm_is_rx_fifo_empty(BUTTONS_PIO, buttons_sm)) {
+        // 1. Changed buttons, other pins of the window don't count
+        uint32_t state = pio_sm_get(BUTTONS_PIO, buttons_sm) & buttons_mask;
+        uint32_t changed = state ^ buttons_state;
+        buttons_state = state;
+        if (!buttons_primed) {
+            buttons_primed = true;
+            continue;
+        }
+
+        // 2. The state machine reports after the hold, the edge was that much earlier
+        uint32_t time_us = time_us_32() - BUTTONS_DEBOUNCE_US;
+
+        // 3. One event per changed button, lowest GPIO first
+        while (changed) {
+            uint bit = __builtin_ctz(changed);
+            changed &= changed - 1;
+
+            uint32_t head = buttons_head;
+            if (head - buttons_tail >= BUTTONS_QUEUE) {
+                buttons_stats.dropped++;
+                continue;
+            }
+            buttons_queue[head % BUTTONS_QUEUE] = (button_event_t){
+                .gpio = (uint8_t)(BUTTONS_PIN_BASE + bit),
+                .pressed = (state >> bit) & 1u,
+                .time_us = time_us,
+            };
+            __dmb();
+            buttons_head = head + 1;
+            buttons_stats.events++;
+            queued = true;
+        }
+    }
+
+    if (queued && buttons_cb != NULL) {
+        buttons_cb();
+    }
+}
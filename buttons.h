@@ -0,0 +1,93 @@
+/**
+ * @file buttons.h
+ * @brief Debounced Push Button Input Header
+ * @note One PIO state machine debounces all buttons in hardware and reports only settled
+ *       changes. The interrupt just queues press/release events, the application drains them
+ *       from a task, so nothing runs in interrupt context that touches LVGL.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ *      DEFINES
+ **********************/
+/* First GPIO of the watched window. Buttons must lie in BUTTONS_PIN_BASE .. +8
+ * (the window width is fixed by buttons.pio), the pins in between are ignored.
+ * Ignored means no events: the state machine still compares them, and an output toggling in
+ * the window (LEDs, WS2812 data) restarts the debounce hold of a button changing meanwhile. */
+#define BUTTONS_PIN_BASE        14
+
+/* A new level is reported when it still reads the same this long after its first edge (us).
+ * Contacts bouncing for less than this give one event, after they settled; shorter glitches
+ * give none. */
+#ifndef BUTTONS_DEBOUNCE_US
+#define BUTTONS_DEBOUNCE_US     5000
+#endif
+
+/* Event queue length */
+#ifndef BUTTONS_QUEUE
+#define BUTTONS_QUEUE           16
+#endif
+
+/* PIO interrupt line (PIO0_IRQ_0) */
+#define BUTTONS_PIO_IRQ_INDEX   0
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief One debounced button change
+ */
+typedef struct {
+    uint8_t gpio;               // Button GPIO
+    bool pressed;               // true = pressed (pin high), false = released
+    uint32_t time_us;           // Time of the edge (time_us_32()), before the debounce delay
+} button_event_t;
+
+/**
+ * @brief Events pending callback
+ * @note Called from the PIO interrupt, keep it short (e.g. wake the consuming task)
+ */
+typedef void (*buttons_cb_t)(void);
+
+/**
+ * @brief Button statistics
+ */
+typedef struct {
+    uint32_t events;            // Events queued
+    uint32_t dropped;           // Events lost to a full queue
+} buttons_stats_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Start debouncing the buttons
+ * @param gpio_mask Button GPIOs (bit n = GPIO n), pins outside the window are ignored
+ * @param cb Called when events were queued, may be NULL
+ * @note Claims a state machine on pio0, the interrupt is handled on the calling core.
+ *       A button held at this point reports its release only.
+ */
+void buttons_init(uint32_t gpio_mask, buttons_cb_t cb);
+
+/**
+ * @brief Take the oldest queued event
+ * @param ev Output
+ * @return false if the queue is empty
+ * @note Single consumer: call from one task only
+ */
+bool buttons_get(button_event_t *ev);
+
+/**
+ * @brief Get button statistics
+ * @param stats Output: counters since buttons_init()
+ */
+void buttons_get_stats(buttons_stats_t *stats);
+
+#endif /* BUTTONS_H */
@@ -0,0 +1,216 @@
+/**
+ * @file disp_perf.c
+ * @brief Display Flush Pipeline Profiling Implementation
+ * @note Samples go into half-octave bins after a per-histogram scale shift, so every histogram
+ *       keeps ~40% resolution over its whole range at a fixed size.
+ *       Timestamps are time_us_32() (1 us), the RP2040's M0+ cores have no cycle counter.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "disp_perf.h"
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "hardware/uart.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Per histogram: id, shift, reserved, count, min, max, sum, bins */
+#define DISP_PERF_REC_SIZE      (24 + DISP_PERF_BINS * 4)
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t disp_perf_bin(uint32_t value);
+static uint8_t *disp_perf_put32(uint8_t *p, uint32_t v);
+static uint16_t disp_perf_crc16(uint16_t crc, const uint8_t *data, size_t len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* Scale shift of each histogram: the value is binned as value >> shift.
+ * Chosen so the last bin starts above the worst case at 62.5 MHz SPI. */
+static const uint8_t perf_shift[DISP_PERF_HIST_NUM] = {
+    [DISP_PERF_RENDER_US]     = 3,      // Last bin >= 24.6 ms
+    [DISP_PERF_WINDOW_US]     = 0,      // Last bin >= 3.1 ms
+    [DISP_PERF_XFER_US]       = 4,      // Last bin >= 49 ms (full-screen fill is ~40 ms)
+    [DISP_PERF_FLUSH_US]      = 4,
+    [DISP_PERF_BLOCK_US]      = 4,
+    [DISP_PERF_XFER_KBPS]     = 3,      // Last bin >= 24.6 MB/s
+    [DISP_PERF_FRAME_BYTES]   = 7,      // Last bin >= 393 KB (full screen is 300 KB)
+    [DISP_PERF_FRAME_FLUSHES] = 0,
+};
+
+static disp_perf_hist_t perf_hist[DISP_PERF_HIST_NUM];
+static spin_lock_t *perf_lock = NULL;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Initialize profiling (claims a spin lock)
+ */
+void disp_perf_init(void)
+{
+    perf_lock = spin_lock_init(spin_lock_claim_unused(true));
+    disp_perf_reset();
+}
+
+/**
+ * @brief Add a sample
+ */
+void disp_perf_add(disp_perf_id_t id, uint32_t value)
+{
+    uint32_t bin = disp_perf_bin(value >> perf_shift[id]);
+    disp_perf_hist_t *h = &perf_hist[id];
+
+    uint32_t irq = spin_lock_blocking(perf_lock);
+    if (h->count == 0 || value < h->min) {
+        h->min = value;
+    }
+    if (value > h->max) {
+        h->max = value;
+    }
+    h->count++;
+    h->sum += value;
+    h->bins[bin]++;
+    spin_unlock(perf_lock, irq);
+}
+
+/**
+ * @brief Get a copy of one histogram
+ */
+void disp_perf_get(disp_perf_id_t id, disp_perf_hist_t *hist)
+{
+    uint32_t irq = spin_lock_blocking(perf_lock);
+    *hist = perf_hist[id];
+    spin_unlock(perf_lock, irq);
+}
+
+/**
+ * @brief Clear all histograms
+ */
+void disp_perf_reset(void)
+{
+    uint32_t irq = spin_lock_blocking(perf_lock);
+    memset(perf_hist, 0, sizeof(perf_hist));
+    spin_unlock(perf_lock, irq);
+}
+
+/**
+ * @brief Write the binary record of all histograms to the stdio UART
+ * @note Little endian: header, DISP_PERF_HIST_NUM histogram records, CRC-16/CCITT of all
+ *       preceding bytes. Written raw (no CRLF translation), one histogram at a time so the
+ *       lock is never held during UART output.
+ */
+void disp_perf_dump(void)
+{
+    uint8_t buf[DISP_PERF_REC_SIZE];
+    uint8_t *p = buf;
+    uint16_t crc = 0xFFFF;
+
+    // 1. Header
+    p = disp_perf_put32(p, DISP_PERF_MAGIC);
+    *p++ = DISP_PERF_VERSION;
+    *p++ = DISP_PERF_HIST_NUM;
+    *p++ = DISP_PERF_BINS;
+    *p++ = 0;
+    p = disp_perf_put32(p, time_us_32());
+    crc = disp_perf_crc16(crc, buf, p - buf);
+    uart_write_blocking(uart_default, buf, p - buf);
+
+    // 2. Histograms
+    for (uint32_t id = 0; id < DISP_PERF_HIST_NUM; id++) {
+        disp_perf_hist_t h;
+        disp_perf_get(id, &h);
+
+        p = buf;
+        *p++ = id;
+        *p++ = perf_shift[id];
+        *p++ = 0;
+        *p++ = 0;
+        p = disp_perf_put32(p, h.count);
+        p = disp_perf_put32(p, h.min);
+        p = disp_perf_put32(p, h.max);
+        p = disp_perf_put32(p, (uint32_t)h.sum);
+        p = disp_perf_put32(p, (uint32_t)(h.sum >> 32));
+        for (uint32_t i = 0; i < DISP_PERF_BINS; i++) {
+            p = disp_perf_put32(p, h.bins[i]);
+        }
+        crc = disp_perf_crc16(crc, buf, p - buf);
+        uart_write_blocking(uart_default, buf, p - buf);
+    }
+
+    // 3. Trailer
+    buf[0] = crc & 0xFF;
+    buf[1] = crc >> 8;
+    uart_write_blocking(uart_default, buf, 2);
+}
+
+/**
+ * @brief Dump when the host has sent DISP_PERF_DUMP_CMD
+ */
+void disp_perf_poll(void)
+{
+    // Not initialized (profiling disabled in lv_port_disp.c): nothing to dump
+    if (perf_lock == NULL) {
+        return;
+    }
+
+    int c = getchar_timeout_us(0);
+    if (c == DISP_PERF_DUMP_CMD) {
+        disp_perf_dump();
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Bin of a scaled value: 0, 1, then two bins per power of two
+ * @param value Scaled sample
+ * @return Bin index, values past the range go to the last bin
+ */
+static uint32_t disp_perf_bin(uint32_t value)
+{
+    if (value < 2) {
+        return value;
+    }
+
+    uint32_t e = 31 - __builtin_clz(value);
+    uint32_t bin = 2 * e + ((value >> (e - 1)) & 1);
+    return bin < DISP_PERF_BINS ? bin : DISP_PERF_BINS - 1;
+}
+
+/**
+ * @brief Store a 32-bit value little endian
+ */
+static uint8_t *disp_perf_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+    return p + 4;
+}
+
+/**
+ * @brief CRC-16/CCITT (polynomial 0x1021), continued from crc
+ */
+static uint16_t disp_perf_crc16(uint16_t crc, const uint8_t *data, size_t len)
+{
+    while (len--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file disp_perf.h
+ * @brief Display Flush Pipeline Profiling Header
+ * @note Fixed-size histograms of the flush pipeline timing, dumped as a binary record over UART
+ *       (decoded on the host by disp_perf_decode.py)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef DISP_PERF_H
+#define DISP_PERF_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************
+ *      DEFINES
+ **********************/
+/* Bins per histogram: 0, 1, then two bins per power of two (bin 23 holds everything >= 3 << 10) */
+#define DISP_PERF_BINS          24
+
+/* Byte the host sends to request a dump (see disp_perf_poll) */
+#ifndef DISP_PERF_DUMP_CMD
+#define DISP_PERF_DUMP_CMD      'P'
+#endif
+
+/* Record layout, must match disp_perf_decode.py */
+#define DISP_PERF_MAGIC         0x46525044u     // "DPRF"
+#define DISP_PERF_VERSION       1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Histograms (each has a fixed unit and scale, see disp_perf.c)
+ */
+typedef enum {
+    DISP_PERF_RENDER_US = 0,    // Render time of a stripe (previous flush to this flush)
+    DISP_PERF_WINDOW_US,        // Window setup on the bus
+    DISP_PERF_XFER_US,          // Pixel transfer
+    DISP_PERF_FLUSH_US,         // Flush latency: flush_cb entry to pixels on the panel
+    DISP_PERF_BLOCK_US,         // Time LVGL spent inside flush_cb
+    DISP_PERF_XFER_KBPS,        // Effective transfer rate in kB/s
+    DISP_PERF_FRAME_BYTES,      // Pixel bytes per refresh
+    DISP_PERF_FRAME_FLUSHES,    // Flushes per refresh
+    DISP_PERF_HIST_NUM
+} disp_perf_id_t;
+
+/**
+ * @brief One histogram
+ */
+typedef struct {
+    uint32_t count;             // Samples
+    uint32_t min;               // Smallest sample
+    uint32_t max;               // Largest sample
+    uint64_t sum;               // Sum of samples (mean = sum / count)
+    uint32_t bins[DISP_PERF_BINS];
+} disp_perf_hist_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Initialize profiling (claims a spin lock), call before the first sample
+ */
+void disp_perf_init(void);
+
+/**
+ * @brief Add a sample
+ * @param id Histogram
+ * @param value Sample in the histogram's unit
+ * @note Safe from tasks on both cores and from interrupts
+ */
+void disp_perf_add(disp_perf_id_t id, uint32_t value);
+
+/**
+ * @brief Get a copy of one histogram
+ * @param id Histogram
+ * @param hist Output
+ */
+void disp_perf_get(disp_perf_id_t id, disp_perf_hist_t *hist);
+
+/**
+ * @brief Clear all histograms
+ */
+void disp_perf_reset(void);
+
+/**
+ * @brief Write the binary record of all histograms to the stdio UART
+ * @note Blocking (about 1 KB), call from a low priority task
+ */
+void disp_perf_dump(void);
+
+/**
+ * @brief Dump when the host has sent DISP_PERF_DUMP_CMD
+ * @note Non-blocking check of the stdio input, call periodically from a task
+ */
+void disp_perf_poll(void);
+
+#endif /* DISP_PERF_H */
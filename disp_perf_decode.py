@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+#
+# Display flush profiling decoder
+#
+# Decodes the binary histogram record written by disp_perf_dump() (disp_perf.c)
+# and prints one table per histogram.
+#
+# Record (little endian):
+#
+#   u32 magic "DPRF", u8 version, u8 histogram count, u8 bins, u8 reserved,
+#   u32 uptime_us
+#   per histogram:
+#     u8 id, u8 shift, u16 reserved, u32 count, u32 min, u32 max, u64 sum,
+#     u32 bins[bins]
+#   u16 CRC-16/CCITT (init 0xffff) of all preceding bytes
+#
+# Bin i counts samples whose value >> shift is i for i < 2, otherwise lies in
+# [lower(i), lower(i + 1)) with lower(2e) = 1 << e, lower(2e + 1) = 3 << (e - 1).
+# The last bin is open ended.
+#
+# The record may be embedded in other console output, the decoder searches for
+# the magic and skips anything that doesn't pass the CRC.
+#
+# Usage: disp_perf_decode.py <capture.bin>
+#        disp_perf_decode.py <serial port> [baud]   (needs pyserial, sends 'P')
+#
+
+import os
+import struct
+import sys
+import time
+
+MAGIC = b"DPRF"
+VERSION = 1
+DUMP_CMD = b"P"
+
+NAMES = [
+    ("render", "us"),
+    ("window", "us"),
+    ("xfer", "us"),
+    ("flush latency", "us"),
+    ("flush_cb block", "us"),
+    ("xfer rate", "kB/s"),
+    ("frame bytes", "B"),
+    ("frame flushes", ""),
+]
+
+
+def crc16(data):
+    crc = 0xffff
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xffff
+    return crc
+
+
+def bin_lower(i):
+    if i < 2:
+        return i
+    e = i >> 1
+    return (1 << e) | ((i & 1) << (e - 1))
+
+
+def parse(data, pos):
+    hdr = data[pos:pos + 12]
+    if len(hdr) < 12:
+        return None
+    magic, version, count, bins, _, uptime = struct.unpack("<4sBBBBI", hdr)
+    if magic != MAGIC or version != VERSION:
+        return None
+
+    size = 12 + count * (24 + bins * 4)
+    if len(data) < pos + size + 2:
+        return None
+    (crc,) = struct.unpack_from("<H", data, pos + size)
+    if crc16(data[pos:pos + size]) != crc:
+        return None
+
+    hists = []
+    p = pos + 12
+    for _ in range(count):
+        hid, shift, _, n, lo, hi, total = struct.unpack_from("<BBHIIIQ", data, p)
+        counts = struct.unpack_from("<%dI" % bins, data, p + 24)
+        hists.append((hid, shift, n, lo, hi, total, counts))
+        p += 24 + bins * 4
+    return uptime, hists, pos + size + 2
+
+
+def show(uptime, hists):
+    print("uptime %.3f s" % (uptime / 1e6))
+    for hid, shift, n, lo, hi, total, counts in hists:
+        name, unit = NAMES[hid] if hid < len(NAMES) else ("hist %d" % hid, "")
+        if n == 0:
+            print("\n%s: no samples" % name)
+            continue
+        print("\n%s [%s]: n=%d min=%d mean=%.1f max=%d" % (name, unit, n, lo, total / n, hi))
+        peak = max(counts)
+        for i, c in enumerate(counts):
+            if c == 0:
+                continue
+            lower = bin_lower(i) << shift
+            if i + 1 < len(counts):
+                label = "%8d .. %-8d" % (lower, (bin_lower(i + 1) << shift) - 1)
+            else:
+                label = "%8d +         " % lower
+            print("  %s %8d %5.1f%% %s" % (label, c, 100.0 * c / n, "#" * (40 * c // peak)))
+
+
+def capture(port, baud):
+    import serial
+    with serial.Serial(port, baud, timeout=0.5) as s:
+        s.reset_input_buffer()
+        s.write(DUMP_CMD)
+        data = b""
+        deadline = time.time() + 3
+        while time.time() < deadline:
+            data += s.read(4096)
+            if data.find(MAGIC) >= 0 and parse(data, data.find(MAGIC)):
+                break
+        return data
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.exit("usage: %s <capture.bin | serial port> [baud]" % sys.argv[0])
+
+    path = sys.argv[1]
+    if os.path.isfile(path):
+        data = open(path, "rb").read()
+    else:
+        data = capture(path, int(sys.argv[2]) if len(sys.argv) == 3 else 115200)
+
+    found = 0
+    pos = data.find(MAGIC)
+    while pos >= 0:
+        rec = parse(data, pos)
+        if rec:
+            uptime, hists, end = rec
+            if found:
+                print("\n" + "-" * 60)
+            show(uptime, hists)
+            found += 1
+            pos = data.find(MAGIC, end)
+        else:
+            pos = data.find(MAGIC, pos + 1)
+
+    if not found:
+        sys.exit("%s: no valid record found" % path)
+
+
+if __name__ == "__main__":
+    main()
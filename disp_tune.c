@@ -0,0 +1,138 @@
+/**
+ * @file disp_tune.c
+ * @brief Draw Buffer Sizing Model Implementation
+ * @note Stripe cost model: render and transfer are each overhead + per-pixel cost,
+ *       fitted from measured stripes (least squares over pixels vs microseconds)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "disp_tune.h"
+#include <math.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Bytes per pixel of a draw buffer (RGB565) */
+#define DISP_TUNE_PX_BYTES      2
+
+/* Samples needed before a fit replaces the previous estimate */
+#define DISP_TUNE_MIN_SAMPLES   8
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Add a measured stripe to a fit
+ */
+void disp_tune_add(disp_tune_fit_t *fit, uint32_t px, uint32_t us)
+{
+    fit->n++;
+    fit->sum_x += px;
+    fit->sum_y += us;
+    fit->sum_xx += (uint64_t)px * px;
+    fit->sum_xy += (uint64_t)px * us;
+    fit->sum_yy += (uint64_t)us * us;
+}
+
+/**
+ * @brief Solve a fit for overhead and per-pixel cost
+ */
+bool disp_tune_solve(const disp_tune_fit_t *fit, disp_tune_cost_t *cost)
+{
+    if (fit->n < DISP_TUNE_MIN_SAMPLES) {
+        return false;
+    }
+
+    float n = (float)fit->n;
+    float mean_x = (float)fit->sum_x / n;
+    float mean_y = (float)fit->sum_y / n;
+    float var_x = (float)fit->sum_xx / n - mean_x * mean_x;
+    float var_y = (float)fit->sum_yy / n - mean_y * mean_y;
+    float cov = (float)fit->sum_xy / n - mean_x * mean_y;
+
+    if (mean_x <= 0.0f) {
+        return false;
+    }
+
+    // 1. Stripe sizes spread enough (>10% deviation): least squares line
+    float resid = var_y;
+    if (var_x > 0.01f * mean_x * mean_x && cov > 0.0f) {
+        float slope = cov / var_x;
+        float intercept = mean_y - slope * mean_x;
+        if (intercept < 0.0f) {
+            intercept = 0.0f;
+        }
+        cost->per_px_us = slope;
+        cost->overhead_us = intercept;
+        resid = var_y - slope * cov;
+    } else {
+        // 2. All stripes about the same size: keep the overhead, rest is per-pixel
+        float per_px = (mean_y - cost->overhead_us) / mean_x;
+        cost->per_px_us = per_px > 0.0f ? per_px : 0.0f;
+    }
+
+    cost->jitter_us = resid > 0.0f ? sqrtf(resid) : 0.0f;
+    return true;
+}
+
+/**
+ * @brief Estimate full-screen refresh time of a configuration
+ * @note With one buffer render and transfer alternate. With more buffers they overlap and the
+ *       slower of the two sets the pace, plus one stripe of the other to fill the pipeline.
+ *       Jitter stalls the pipeline when a slow stripe meets a full queue, roughly half a
+ *       standard deviation per stripe with two buffers, less with every extra buffer.
+ */
+uint32_t disp_tune_estimate(const disp_tune_cost_t *render, const disp_tune_cost_t *xfer,
+                            uint8_t bufs, uint16_t rows, uint16_t hor_res, uint16_t ver_res)
+{
+    uint32_t stripes = (ver_res + rows - 1) / rows;
+    float px = (float)hor_res * rows;
+    float r = render->overhead_us + render->per_px_us * px;
+    float t = xfer->overhead_us + xfer->per_px_us * px;
+    float frame;
+
+    if (bufs <= 1) {
+        frame = stripes * (r + t);
+    } else {
+        float jitter = render->jitter_us + xfer->jitter_us;
+        frame = stripes * (r > t ? r : t) + (r > t ? t : r);
+        frame += stripes * jitter / (2.0f * (bufs - 1));
+    }
+
+    return (uint32_t)frame;
+}
+
+/**
+ * @brief Pick the fastest configuration that fits a RAM budget
+ * @note Every buffer count gets the tallest stripe the budget allows
+ */
+bool disp_tune_pick(const disp_tune_cost_t *render, const disp_tune_cost_t *xfer, uint32_t budget,
+                    uint16_t hor_res, uint16_t ver_res, disp_tune_cfg_t *cfg)
+{
+    bool found = false;
+
+    for (uint8_t bufs = 1; bufs <= DISP_TUNE_MAX_BUFS; bufs++) {
+        uint32_t rows = budget / (bufs * hor_res * DISP_TUNE_PX_BYTES);
+        if (rows > ver_res) {
+            rows = ver_res;
+        }
+        if (rows < DISP_TUNE_MIN_ROWS) {
+            break;
+        }
+
+        uint32_t frame_us = disp_tune_estimate(render, xfer, bufs, rows, hor_res, ver_res);
+        if (!found || frame_us < cfg->frame_us) {
+            cfg->bufs = bufs;
+            cfg->rows = rows;
+            cfg->frame_us = frame_us;
+            found = true;
+        }
+    }
+
+    return found;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file disp_tune.h
+ * @brief Draw Buffer Sizing Model Header
+ * @note Picks stripe height and buffer count for a RAM budget from measured render/transfer costs
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef DISP_TUNE_H
+#define DISP_TUNE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ *      DEFINES
+ **********************/
+/* Most draw buffers considered (1 = single, 2 = double, 3 = triple buffering) */
+#ifndef DISP_TUNE_MAX_BUFS
+#define DISP_TUNE_MAX_BUFS      3
+#endif
+
+/* Fewest rows per stripe considered */
+#ifndef DISP_TUNE_MIN_ROWS
+#define DISP_TUNE_MIN_ROWS      4
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Running sums of (pixels, microseconds) samples for a linear cost fit
+ */
+typedef struct {
+    uint32_t n;                 // Number of samples
+    uint64_t sum_x;             // Sum of pixels
+    uint64_t sum_y;             // Sum of microseconds
+    uint64_t sum_xx;
+    uint64_t sum_xy;
+    uint64_t sum_yy;
+} disp_tune_fit_t;
+
+/**
+ * @brief Cost of one stripe: overhead + per_px * pixels (microseconds)
+ */
+typedef struct {
+    float overhead_us;          // Fixed cost per stripe
+    float per_px_us;            // Cost per pixel
+    float jitter_us;            // Standard deviation around the fit
+} disp_tune_cost_t;
+
+/**
+ * @brief Buffer configuration
+ */
+typedef struct {
+    uint8_t bufs;               // Number of draw buffers
+    uint16_t rows;              // Stripe height in rows
+    uint32_t frame_us;          // Estimated full-screen refresh time
+} disp_tune_cfg_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Add a measured stripe to a fit
+ * @param fit Fit to update
+ * @param px Pixels in the stripe
+ * @param us Measured time in microseconds
+ */
+void disp_tune_add(disp_tune_fit_t *fit, uint32_t px, uint32_t us);
+
+/**
+ * @brief Solve a fit for overhead and per-pixel cost
+ * @param fit Collected samples
+ * @param cost In: previous estimate (kept where the samples can't tell), Out: updated estimate
+ * @return true if the fit had enough samples to update cost
+ * @note When the stripe sizes barely vary the overhead can't be separated from the pixel
+ *       cost, the previous overhead is then kept and only the per-pixel cost is updated
+ */
+bool disp_tune_solve(const disp_tune_fit_t *fit, disp_tune_cost_t *cost);
+
+/**
+ * @brief Estimate full-screen refresh time of a configuration
+ * @param render Render cost model
+ * @param xfer Transfer cost model
+ * @param bufs Number of draw buffers
+ * @param rows Stripe height
+ * @param hor_res Display width
+ * @param ver_res Display height
+ * @return Estimated time in microseconds
+ */
+uint32_t disp_tune_estimate(const disp_tune_cost_t *render, const disp_tune_cost_t *xfer,
+                            uint8_t bufs, uint16_t rows, uint16_t hor_res, uint16_t ver_res);
+
+/**
+ * @brief Pick the fastest configuration that fits a RAM budget
+ * @param render Render cost model
+ * @param xfer Transfer cost model
+ * @param budget Bytes available for all draw buffers
+ * @param hor_res Display width
+ * @param ver_res Display height
+ * @param cfg Output configuration
+ * @return false if not even one buffer of DISP_TUNE_MIN_ROWS rows fits
+ */
+bool disp_tune_pick(const disp_tune_cost_t *render, const disp_tune_cost_t *xfer, uint32_t budget,
+                    uint16_t hor_res, uint16_t ver_res, disp_tune_cfg_t *cfg);
+
+#endif /* DISP_TUNE_H */
@@ -0,0 +1,63 @@
+// ---------------------------------------------------------------- //
+// This file is autogenerated by pioasm version 2.2.0; do not edit! //
+// ---------------------------------------------------------------- //
+
+#pragma once
+
+#if !PICO_NO_HARDWARE
+#include "hardware/pio.h"
+#endif
+
+// --------------- //
+// button_debounce //
+// --------------- //
+
+#define button_debounce_wrap_target 4
+#define button_debounce_wrap 8
+#define button_debounce_pio_version 0
+
+#define button_debounce_PIN_COUNT 9
+#define button_debounce_DEBOUNCE_CYCLES 1024
+
+static const uint16_t button_debounce_program_instructions[] = {
+    0xa0c3, //  0: mov    isr, null
+    0x4009, //  1: in     pins, 9
+    0xa0e6, //  2: mov    osr, isr
+    0x8020, //  3: push   block
+            //     .wrap_target
+    0xa0c3, //  4: mov    isr, null
+    0x4009, //  5: in     pins, 9
+    0xa026, //  6: mov    x, isr
+    0xa047, //  7: mov    y, osr
+    0x00a9, //  8: jmp    x != y, 9
+            //     .wrap
+    0xe05f, //  9: set    y, 31
+    0x1f8a, // 10: jmp    y--, 10                [31]
+    0xa0c3, // 11: mov    isr, null
+    0x4009, // 12: in     pins, 9
+    0xa046, // 13: mov    y, isr
+    0x00a4, // 14: jmp    x != y, 4
+    0xa0e1, // 15: mov    osr, x
+    0xa0c1, // 16: mov    isr, x
+    0x8020, // 17: push   block
+    0x0004, // 18: jmp    4
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program button_debounce_program = {
+    .instructions = button_debounce_program_instructions,
+    .length = 19,
+    .origin = -1,
+    .pio_version = button_debounce_pio_version,
+#if PICO_PIO_VERSION > 0
+    .used_gpio_ranges = 0x0
+#endif
+};
+
+static inline pio_sm_config button_debounce_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + button_debounce_wrap_target, offset + button_debounce_wrap);
+    return c;
+}
+
+#endif
@@ -0,0 +1,6927 @@
+/* Generated by splash_compress.py from sea.c, do not edit */
+/* 320 x 480 RGB565, 109569 bytes (raw 307200 bytes) */
+
+#include "splash.h"
+
+static const uint32_t sea_rle_rows[] = {
+       0,    333,    654,    978,   1306,   1630,   1949,   2276,
+    2592,   2915,   3235,   3559,   3876,   4189,   4498,   4819,
+    5137,   5460,   5765,   6086,   6417,   6733,   7055,   7374,
+    7691,   8008,   8321,   8632,   8946,   9268,   9585,   9900,
+   10217,  10535,  10851,  11179,  11503,  11828,  12157,  12482,
+   12813,  13143,  13467,  13792,  14118,  14447,  14784,  15103,
+   15434,  15778,  16137,  16490,  16840,  17199,  17566,  17918,
+   18269,  18626,  18983,  19342,  19685,  20036,  20373,  20709,
+   21039,  21368,  21676,  21987,  22313,  22633,  22959,  23291,
+   23621,  23952,  24281,  24597,  24905,  25219,  25544,  25873,
+   26183,  26504,  26818,  27120,  27406,  27692,  27988,  28303,
+   28615,  28945,  29266,  29580,  29924,  30252,  30562,  30867,
+   31189,  31503,  31812,  32140,  32468,  32791,  33098,  33412,
+   33730,  34044,  34352,  34667,  34986,  35299,  35606,  35909,
+   36208,  36541,  36879,  37217,  37555,  37911,  38249,  38594,
+   38947,  39329,  39694,  40088,  40476,  40868,  41247,  41630,
+   42017,  42417,  42800,  43196,  43595,  43993,  44378,  44783,
+   45180,  45579,  45982,  46378,  46791,  47178,  47574,  47983,
+   48382,  48776,  49142,  49515,  49908,  50316,  50736,  51153,
+   51575,  52006,  52443,  52864,  53294,  53730,  54161,  54596,
+   55023,  55439,  55855,  56266,  56663,  57073,  57472,  57866,
+   58268,  58678,  59082,  59474,  59861,  60259,  60663,  61082,
+   61492,  61899,  62297,  62689,  63063,  63441,  63811,  64155,
+   64483,  64799,  65135,  65454,  65758,  66048,  66342,  66643,
+   66947,  67225,  67504,  67768,  68031,  68272,  68533,  68794,
+   69041,  69279,  69506,  69728,  69961,  70198,  70434,  70660,
+   70908,  71153,  71354,  71586,  71793,  71996,  72195,  72392,
+   72595,  72779,  72977,  73165,  73364,  73567,  73771,  73944,
+   74116,  74314,  74496,  74632,  74781,  74937,  75100,  75253,
+   75411,  75574,  75718,  75859,  75987,  76119,  76239,  76360,
+   76486,  76630,  76753,  76894,  77003,  77124,  77248,  77368,
+   77503,  77670,  77834,  77988,  78143,  78307,  78474,  78642,
+   78810,  78975,  79113,  79255,  79419,  79583,  79759,  79916,
+   80070,  80237,  80388,  80537,  80686,  80838,  80988,  81119,
+   81291,  81468,  81603,  81741,  81877,  82024,  82141,  82273,
+   82424,  82572,  82713,  82852,  83017,  83191,  83350,  83516,
+   83682,  83825,  83970,  84098,  84248,  84407,  84557,  84712,
+   84879,  85044,  85187,  85345,  85491,  85629,  85768,  85909,
+   86071,  86243,  86390,  86526,  86656,  86802,  86947,  87111,
+   87266,  87432,  87580,  87713,  87847,  87987,  88133,  88269,
+   88418,  88550,  88683,  88802,  88922,  89053,  89164,  89274,
+   89395,  89517,  89626,  89736,  89851,  89978,  90093,  90244,
+   90403,  90555,  90697,  90867,  91018,  91149,  91302,  91444,
+   91589,  91708,  91815,  91939,  92054,  92180,  92313,  92437,
+   92585,  92717,  92830,  92956,  93081,  93210,  93331,  93452,
+   93589,  93739,  93859,  93990,  94124,  94271,  94425,  94568,
+   94724,  94851,  94977,  95091,  95223,  95332,  95441,  95572,
+   95712,  95858,  95981,  96111,  96255,  96371,  96516,  96675,
+   96825,  96982,  97150,  97311,  97433,  97528,  97618,  97706,
+   97802,  97925,  98028,  98124,  98206,  98298,  98386,  98494,
+   98591,  98707,  98853,  98971,  99086,  99193,  99319,  99443,
+   99621,  99783,  99952, 100135, 100322, 100519, 100706, 100892,
+  101080, 101292, 101467, 101643, 101792, 101957, 102113, 102226,
+  102339, 102452, 102569, 102671, 102772, 102857, 102944, 103014,
+  103095, 103165, 103220, 103272, 103330, 103385, 103448, 103500,
+  103705, 103920, 104146, 104344, 104523, 104739, 104971, 105212,
+  105428, 105531, 105619, 105699, 105787, 105878, 105996, 106161,
+  106329, 106509, 106649, 106792, 106901, 107009, 107152, 107291,
+  107445, 107585, 107719, 107848, 107977, 108116, 108252, 108378,
+  108501, 108630, 108752, 108871, 109015, 109150, 109288, 109414,
+  109569,
+};
+
+static const uint8_t sea_rle_data[] = {
+  0xfe, 0x13, 0xb4, 0xa2, 0x77, 0x66, 0xc1, 0x65, 0x28, 0xc1, 0x2d, 0x7b, 0x28, 0x2d, 0xc0, 0x7a,
+  0x7f, 0x2d, 0x28, 0x30, 0x2d, 0x6f, 0xa2, 0xa8, 0xa1, 0xb8, 0x69, 0x5a, 0x5a, 0x17, 0x66, 0xc0,
+  0x6f, 0x21, 0x12, 0x5a, 0x12, 0x9f, 0x69, 0x7e, 0x7b, 0x0c, 0x13, 0x65, 0xa2, 0x88, 0xa1, 0xa8,
+  0xa2, 0x97, 0x7f, 0x7e, 0xa2, 0x98, 0x66, 0x0d, 0x51, 0xa3, 0x99, 0xa2, 0xa7, 0xa3, 0x88, 0x57,
+  0x56, 0x60, 0x9d, 0x79, 0xc0, 0xa4, 0x97, 0x5a, 0x24, 0x2c, 0xa4, 0x97, 0xc0, 0x9c, 0x7a, 0x27,
+  0x24, 0x55, 0x0d, 0xc0, 0xa2, 0x88, 0x24, 0xc3, 0x21, 0xc0, 0x1c, 0x65, 0x15, 0x0d, 0x1c, 0x21,
+  0x24, 0xc0, 0x1f, 0x24, 0xc1, 0x65, 0x27, 0x2f, 0x7e, 0x4a, 0x29, 0x24, 0xc0, 0x29, 0xa2, 0x98,
+  0x56, 0x24, 0x29, 0x2c, 0x24, 0x21, 0x2c, 0x31, 0x00, 0xc2, 0x5a, 0x38, 0x3d, 0x52, 0x29, 0x33,
+  0x7e, 0x00, 0x7f, 0xc0, 0x38, 0x3b, 0xa2, 0x87, 0x5a, 0x00, 0xa2, 0x98, 0x69, 0x5b, 0x0f, 0x14,
+  0x17, 0x14, 0xc1, 0x17, 0x14, 0x0f, 0x17, 0x14, 0x0f, 0x17, 0xc0, 0x14, 0x56, 0x75, 0x0c, 0x07,
+  0x0f, 0xa3, 0x98, 0x55, 0x0f, 0xa2, 0x98, 0x5a, 0x2b, 0xc0, 0x1c, 0xc0, 0x14, 0x0f, 0x23, 0x1c,
+  0xc0, 0x2b, 0x1c, 0xc0, 0x17, 0x1c, 0x0f, 0x17, 0xa2, 0x77, 0x1c, 0x2b, 0x69, 0x1c, 0xc0, 0x17,
+  0x1c, 0x2b, 0xc0, 0x24, 0x2b, 0x7e, 0x2b, 0x24, 0xc0, 0x2b, 0x33, 0xc0, 0x7f, 0x66, 0x33, 0x6e,
+  0xc0, 0x7f, 0x69, 0x33, 0x2b, 0x33, 0xc0, 0x2b, 0x6e, 0x2b, 0xc0, 0x33, 0xa2, 0x98, 0x42, 0x33,
+  0xc0, 0x2b, 0x30, 0x76, 0x33, 0x02, 0x33, 0xc1, 0x7e, 0x07, 0x38, 0x30, 0x2b, 0x30, 0x33, 0x2e,
+  0x30, 0x2b, 0x3a, 0xc0, 0x33, 0x57, 0x23, 0xc0, 0x2b, 0xc0, 0x30, 0x1c, 0x2b, 0xc4, 0x23, 0x56,
+  0x26, 0x2b, 0x32, 0x59, 0x23, 0xc1, 0x14, 0x62, 0x2b, 0x21, 0x0f, 0x2b, 0xa2, 0x88, 0x2b, 0x14,
+  0x76, 0x33, 0x2b, 0xc0, 0xa2, 0x78, 0x0f, 0xc0, 0x1c, 0x23, 0x24, 0xc0, 0x2b, 0x24, 0x2b, 0xc0,
+  0x30, 0x3f, 0x3a, 0x23, 0x17, 0x12, 0x23, 0x26, 0x33, 0x17, 0xc0, 0xa2, 0x99, 0x3f, 0x1c, 0x0f,
+  0x1c, 0x3b, 0x30, 0x28, 0x2b, 0x9f, 0x69, 0x7a, 0x23, 0x28, 0x7f, 0x30, 0x3c, 0x3f, 0x37, 0xc0,
+  0x28, 0x6b, 0xc1, 0x2b, 0x20, 0x56, 0xc1, 0x2f, 0xc0, 0x56, 0x9d, 0x88, 0x5a, 0xfe, 0x13, 0xb4,
+  0xc1, 0x6e, 0xc2, 0x6e, 0x28, 0xc0, 0x2d, 0xc0, 0x7f, 0x7e, 0xc0, 0x2d, 0xc0, 0x28, 0xc0, 0x2d,
+  0x6f, 0xa2, 0xb8, 0xa2, 0xa7, 0x56, 0x65, 0x5a, 0x46, 0x7e, 0x6e, 0xc0, 0x0f, 0xa2, 0x98, 0xc0,
+  0x55, 0x0f, 0x07, 0x6f, 0x7e, 0x0f, 0x7f, 0x6e, 0xa2, 0xa8, 0x7d, 0x6b, 0x7e, 0xc0, 0x7e, 0x0d,
+  0x7a, 0xa4, 0x97, 0x6f, 0x41, 0x56, 0x7a, 0xa1, 0xa8, 0x0d, 0xc0, 0xa2, 0xa8, 0x6f, 0x51, 0x33,
+  0x00, 0x51, 0x24, 0xc0, 0x56, 0x0d, 0x10, 0x0d, 0xc1, 0x15, 0x24, 0xc2, 0x5e, 0x21, 0x15, 0x52,
+  0x0d, 0x10, 0x0d, 0xc0, 0x21, 0x24, 0xc0, 0x15, 0xc0, 0x24, 0xa2, 0xa8, 0x7e, 0x55, 0x24, 0x21,
+  0xc0, 0x69, 0x29, 0x00, 0xc1, 0x29, 0x24, 0x29, 0xc0, 0x2c, 0x00, 0xc1, 0x6e, 0x7f, 0x41, 0x2c,
+  0xc1, 0x6f, 0x00, 0x7a, 0xc0, 0x6e, 0x00, 0x38, 0x05, 0xa1, 0xa9, 0x03, 0xc0, 0x17, 0x08, 0x6b,
+  0xc3, 0x14, 0xc0, 0x0f, 0x08, 0x0f, 0xc2, 0x14, 0x0f, 0xc0, 0x51, 0x7f, 0x0f, 0xa2, 0x77, 0x17,
+  0x14, 0x69, 0xa1, 0x9a, 0x69, 0x17, 0xa2, 0x88, 0x66, 0x17, 0xc0, 0x0f, 0x1c, 0x23, 0x17, 0xa2,
+  0x87, 0x1c, 0xc1, 0x17, 0x0f, 0x14, 0x23, 0x14, 0x1c, 0x24, 0xc0, 0x1c, 0x17, 0x1c, 0xc1, 0x26,
+  0x2b, 0xc0, 0x6e, 0x2b, 0x19, 0x1c, 0x2b, 0xc0, 0x7e, 0x6e, 0x2b, 0x33, 0x38, 0x7b, 0xc0, 0x2b,
+  0xc0, 0x30, 0x2b, 0x7f, 0x33, 0x24, 0x33, 0xc1, 0xa2, 0x88, 0x33, 0x30, 0x02, 0x33, 0x66, 0x26,
+  0x33, 0xc0, 0x51, 0x30, 0x33, 0x02, 0x33, 0x24, 0x2b, 0xc0, 0x26, 0x33, 0x5b, 0x55, 0x2b, 0x6b,
+  0xa2, 0x87, 0x37, 0x23, 0x26, 0x32, 0xc0, 0x2b, 0x1c, 0x30, 0xc0, 0x2b, 0x30, 0x2b, 0xc0, 0x1c,
+  0x67, 0x5a, 0x28, 0x30, 0x2b, 0xc0, 0x1e, 0x0f, 0x14, 0xc0, 0x2b, 0x17, 0xc0, 0x32, 0x33, 0x30,
+  0x0f, 0xc0, 0x33, 0x07, 0x2b, 0x28, 0x17, 0x14, 0x23, 0xc0, 0x1c, 0x2b, 0x28, 0x2b, 0xc1, 0x33,
+  0xc0, 0x2b, 0x23, 0x17, 0x0f, 0xc0, 0x2e, 0x2b, 0x0f, 0x1e, 0x2b, 0x32, 0x33, 0x1f, 0x0f, 0x38,
+  0x07, 0x26, 0x23, 0x17, 0x1b, 0x6e, 0xc0, 0x23, 0x30, 0x6f, 0x37, 0xc0, 0x32, 0x5a, 0x28, 0xc1,
+  0x37, 0x20, 0x52, 0x6d, 0x6b, 0xa2, 0x88, 0x2f, 0xc0, 0x9c, 0x69, 0x65, 0xa2, 0x87, 0xfe, 0x13,
+  0xd4, 0x65, 0x6b, 0x28, 0x6b, 0x6d, 0x28, 0xc3, 0x2d, 0x7a, 0x7f, 0x5a, 0x2d, 0xc0, 0x28, 0xc0,
+  0x2d, 0x6f, 0xa1, 0xa8, 0xa2, 0xb8, 0x59, 0xc1, 0x46, 0x7a, 0x17, 0x66, 0x0f, 0xa2, 0x98, 0xa2,
+  0x98, 0x45, 0x61, 0x0c, 0x57, 0x0c, 0xc0, 0x7b, 0x26, 0xa2, 0x87, 0x7a, 0xa2, 0x88, 0x7e, 0x76,
+  0x55, 0x10, 0xa2, 0x98, 0xa3, 0x98, 0x45, 0x9d, 0x8a, 0x5a, 0x79, 0x7f, 0x41, 0xc0, 0xa3, 0x98,
+  0x27, 0x6e, 0xa2, 0x87, 0x31, 0x63, 0x24, 0x15, 0x1c, 0xc1, 0x15, 0x0d, 0x56, 0xc0, 0x15, 0xc0,
+  0x10, 0x1c, 0x15, 0x0d, 0xc1, 0x15, 0x1c, 0x40, 0xc0, 0x0d, 0x15, 0x24, 0x1c, 0x10, 0xa1, 0xa8,
+  0xa3, 0x98, 0xc0, 0x2c, 0x24, 0x1c, 0xc0, 0x6e, 0x24, 0x2c, 0xa2, 0x88, 0x5a, 0x24, 0xc0, 0x29,
+  0x7b, 0x7e, 0x00, 0x3b, 0xa2, 0x87, 0x00, 0x2c, 0x24, 0x29, 0xc0, 0x7f, 0x3b, 0x08, 0xc0, 0x03,
+  0x00, 0xc1, 0x08, 0xc0, 0x03, 0xc0, 0x6f, 0xc2, 0x66, 0x0f, 0xc0, 0x6e, 0x0f, 0x00, 0x0f, 0xc3,
+  0x03, 0x00, 0x6b, 0xc0, 0x0a, 0xc0, 0xa3, 0x88, 0x65, 0x0f, 0x14, 0x17, 0x59, 0x7f, 0x7f, 0x23,
+  0x79, 0x1c, 0x14, 0x17, 0x0f, 0x17, 0xa2, 0x87, 0x1c, 0xc0, 0x5a, 0x0f, 0xc0, 0x14, 0x0f, 0xc0,
+  0x1c, 0x2b, 0x66, 0x1c, 0xc5, 0x2b, 0xc0, 0x1c, 0x19, 0x1c, 0xa2, 0x88, 0x2b, 0x7a, 0x24, 0xc0,
+  0x7f, 0xc0, 0x7f, 0x1f, 0x2b, 0x7f, 0x23, 0x6e, 0x33, 0x2b, 0x30, 0x33, 0xc0, 0x7a, 0xa2, 0x78,
+  0x02, 0x3a, 0x33, 0x2b, 0x30, 0x2b, 0x26, 0xc0, 0x2b, 0x30, 0x3a, 0x02, 0x1f, 0x2b, 0x3a, 0x26,
+  0x1c, 0x30, 0x2b, 0xc0, 0x30, 0x2e, 0xa2, 0x78, 0x2b, 0xc0, 0x33, 0x30, 0x2b, 0x1c, 0x23, 0x28,
+  0x30, 0x2b, 0xc2, 0x28, 0x23, 0x66, 0x28, 0x2b, 0x17, 0x14, 0x0a, 0x5e, 0x7f, 0x26, 0xc0, 0x17,
+  0x33, 0x30, 0x2b, 0xc0, 0x0f, 0x2b, 0x33, 0x2b, 0x26, 0xc0, 0x23, 0x17, 0x1c, 0x2b, 0xc2, 0x28,
+  0x2b, 0x3f, 0x33, 0x24, 0x0f, 0xc0, 0x0a, 0x17, 0x1c, 0x26, 0x0f, 0x1e, 0x2e, 0x23, 0x28, 0x30,
+  0x2b, 0x6b, 0x2e, 0x23, 0x17, 0x2b, 0xc0, 0x1b, 0x6e, 0xc0, 0x7f, 0xa2, 0x87, 0x2b, 0x6f, 0xc0,
+  0x20, 0xc0, 0x23, 0x2b, 0x02, 0x2f, 0x9c, 0x68, 0x7e, 0x1b, 0x28, 0x32, 0x28, 0x42, 0x01, 0x7f,
+  0xa2, 0x87, 0xfe, 0x13, 0xb4, 0xc0, 0x69, 0x6f, 0x6b, 0x6e, 0xc0, 0x28, 0x23, 0x28, 0xc1, 0x6e,
+  0xc0, 0x28, 0xc0, 0x2d, 0xc0, 0x6f, 0x69, 0x39, 0x7e, 0xa1, 0xa8, 0xa1, 0xa8, 0x56, 0xc0, 0x6f,
+  0x0f, 0x7a, 0x6f, 0x0f, 0xc0, 0xa2, 0x98, 0x7a, 0x55, 0x12, 0x6b, 0x0f, 0xc0, 0x0c, 0x0f, 0x26,
+  0xa3, 0x97, 0x7b, 0xa2, 0x87, 0x7b, 0x65, 0xa2, 0x98, 0xc0, 0x6e, 0x6b, 0x5a, 0x9d, 0x88, 0x6f,
+  0x1c, 0x05, 0x10, 0x2c, 0x41, 0x7f, 0xa2, 0x88, 0x24, 0x1c, 0x15, 0x0d, 0x10, 0xc0, 0x0d, 0xc1,
+  0x05, 0xc0, 0x0d, 0x6b, 0x0d, 0xc0, 0x7b, 0x10, 0x56, 0xc0, 0x10, 0x15, 0x9d, 0x8a, 0x05, 0x08,
+  0x15, 0x24, 0x15, 0x10, 0xa1, 0xa8, 0x2c, 0xc0, 0x24, 0xc0, 0x5a, 0x24, 0x1c, 0x24, 0xc0, 0x27,
+  0x5e, 0xc0, 0x24, 0xc0, 0x2c, 0xa2, 0x88, 0x66, 0x2c, 0x3b, 0xc0, 0x2c, 0x29, 0xc0, 0x7e, 0x2c,
+  0x38, 0xa2, 0x98, 0x59, 0x38, 0x00, 0x7a, 0xc0, 0x55, 0x00, 0x05, 0x3b, 0x00, 0x05, 0x0f, 0xc2,
+  0x56, 0x00, 0x07, 0x0f, 0xc2, 0x6e, 0x0f, 0x03, 0x0f, 0x14, 0x0f, 0x07, 0x0f, 0x7e, 0x0f, 0x66,
+  0x0f, 0xc0, 0x14, 0x17, 0x7f, 0x6e, 0x55, 0x17, 0x14, 0xc0, 0x0f, 0x17, 0xc0, 0x55, 0x0f, 0x14,
+  0xc1, 0x0f, 0x14, 0x17, 0x1c, 0xc0, 0x2b, 0x17, 0x1c, 0xc1, 0x17, 0x1c, 0xc1, 0x6f, 0x1c, 0x17,
+  0xa2, 0x87, 0x2b, 0xc1, 0x26, 0xa2, 0x77, 0x7a, 0x7f, 0x59, 0x1c, 0x2b, 0x7a, 0x1c, 0x28, 0x2b,
+  0xc0, 0x28, 0x2b, 0x33, 0xc1, 0x02, 0x33, 0x2b, 0xc0, 0x1c, 0x2b, 0x26, 0x28, 0xa0, 0xa9, 0x30,
+  0x33, 0x6b, 0x1c, 0x6b, 0x2b, 0x52, 0x23, 0xc0, 0x2b, 0xc0, 0x59, 0x2b, 0xc0, 0x28, 0x2b, 0xc1,
+  0x24, 0x2b, 0x1c, 0x2b, 0x33, 0x21, 0x2b, 0xc2, 0x28, 0x23, 0x1c, 0x1e, 0x0f, 0x5a, 0x0f, 0xc0,
+  0x1e, 0x2b, 0x14, 0x30, 0xc0, 0x21, 0x33, 0x2b, 0xc0, 0x6f, 0x2b, 0x28, 0x2b, 0xa2, 0x88, 0x30,
+  0x17, 0x2b, 0x30, 0x3f, 0x33, 0x28, 0x2b, 0x38, 0x7f, 0x2b, 0x1c, 0x14, 0x52, 0x0f, 0x23, 0x59,
+  0x14, 0x28, 0x30, 0x23, 0x2b, 0xa3, 0x98, 0x02, 0x2b, 0xc0, 0x33, 0x23, 0xc0, 0x30, 0xc0, 0x43,
+  0x23, 0x28, 0x37, 0x2b, 0x37, 0xc0, 0x41, 0xc0, 0x5a, 0x20, 0x28, 0x23, 0x45, 0x52, 0xa2, 0x88,
+  0xa2, 0x98, 0x6e, 0x37, 0x20, 0x9d, 0x79, 0x7f, 0x18, 0x1d, 0xfe, 0x13, 0xb4, 0x6e, 0x23, 0xa2,
+  0x78, 0xc1, 0x6e, 0x34, 0xc0, 0x28, 0xc2, 0x6e, 0x34, 0x2d, 0x28, 0x2d, 0x34, 0x2d, 0xc0, 0x39,
+  0x7a, 0xa3, 0xa8, 0x79, 0x42, 0x6f, 0x1b, 0x69, 0x17, 0x7f, 0x9e, 0x68, 0x07, 0xa2, 0x98, 0xc0,
+  0x55, 0xc0, 0x0c, 0x07, 0x7f, 0x17, 0xa2, 0x98, 0xa2, 0x98, 0x7a, 0xa2, 0x88, 0x54, 0x7f, 0xa2,
+  0xa8, 0x5e, 0x6b, 0x51, 0x42, 0x69, 0xc0, 0x08, 0x0d, 0x24, 0xc0, 0x1c, 0x0d, 0x7b, 0x1c, 0xc0,
+  0x40, 0x08, 0x0d, 0xc1, 0x7a, 0x0d, 0x51, 0x0d, 0xc0, 0x10, 0xa2, 0x78, 0x1c, 0x21, 0x0d, 0x3e,
+  0x0d, 0xc0, 0x08, 0x39, 0x05, 0x08, 0x10, 0x24, 0x66, 0x1c, 0x79, 0x7e, 0x1f, 0x24, 0x6e, 0x21,
+  0x24, 0x15, 0x24, 0x38, 0x65, 0xc0, 0x31, 0x2c, 0x29, 0x2c, 0x31, 0xc0, 0x38, 0x2c, 0xc0, 0x29,
+  0xc0, 0x24, 0x29, 0x38, 0x6e, 0xa0, 0xa8, 0x31, 0xc0, 0xa2, 0x99, 0x69, 0x38, 0x2c, 0x03, 0x56,
+  0x38, 0x7e, 0x08, 0x03, 0x0f, 0xc0, 0x00, 0x6e, 0x00, 0x0f, 0xc0, 0x00, 0xc0, 0x0f, 0xc4, 0x08,
+  0xa2, 0x88, 0xc0, 0xa2, 0x88, 0x1c, 0x56, 0xc0, 0x62, 0x5a, 0xa2, 0x97, 0xa2, 0x88, 0x59, 0x1c,
+  0x14, 0x00, 0x0f, 0xc0, 0x08, 0x14, 0xc1, 0x0f, 0x14, 0xc1, 0x0f, 0x14, 0x1c, 0x6b, 0x1c, 0x17,
+  0x23, 0x2b, 0x1c, 0x17, 0x1c, 0xc3, 0x17, 0x21, 0x1c, 0x23, 0x1c, 0x30, 0x7b, 0x66, 0x6d, 0x2b,
+  0x23, 0xc0, 0x79, 0x2b, 0x30, 0x1c, 0xc1, 0x2b, 0x30, 0x2b, 0xc0, 0x33, 0x30, 0xc1, 0x17, 0x14,
+  0x1c, 0x2b, 0x3a, 0x30, 0xc0, 0x1f, 0x1c, 0x6f, 0x23, 0xc0, 0x1c, 0x7b, 0x1c, 0xc3, 0x7e, 0x51,
+  0x17, 0x24, 0xc0, 0x2b, 0xc0, 0x33, 0x2b, 0xc0, 0x30, 0x1c, 0x24, 0x2b, 0x1c, 0x0f, 0x26, 0x23,
+  0x14, 0x0f, 0x14, 0x26, 0xc0, 0x14, 0x23, 0xc0, 0x1c, 0x33, 0xc1, 0x3a, 0x2b, 0x23, 0x2b, 0xa2,
+  0x98, 0x59, 0x26, 0x23, 0x30, 0xa2, 0x98, 0x56, 0x2b, 0x28, 0xa0, 0xa8, 0x07, 0x2b, 0x28, 0x2b,
+  0x1c, 0x14, 0xc0, 0x7b, 0x14, 0xc0, 0x24, 0x23, 0x2b, 0x38, 0x07, 0x33, 0x2e, 0x02, 0x69, 0x2b,
+  0x28, 0x56, 0x6e, 0x20, 0x28, 0x7f, 0x2b, 0x37, 0x56, 0x51, 0x5d, 0x20, 0x55, 0x6b, 0x62, 0xa2,
+  0x66, 0x66, 0x18, 0x28, 0xc0, 0x6f, 0x41, 0x9d, 0x89, 0x7f, 0xa2, 0x88, 0x1d, 0x10, 0xfe, 0x13,
+  0xb4, 0x6e, 0xc0, 0x6f, 0xc1, 0x6e, 0x34, 0xc0, 0x28, 0xc1, 0x6e, 0xc1, 0x28, 0xc0, 0xa3, 0x78,
+  0x39, 0x2d, 0x28, 0xc1, 0xa2, 0x88, 0xa3, 0xc8, 0xc0, 0x9f, 0x68, 0x6b, 0x7d, 0x76, 0x6f, 0x6e,
+  0x51, 0xc0, 0x1e, 0x23, 0x0f, 0xc0, 0x6f, 0x1e, 0xa3, 0xa8, 0x6e, 0x65, 0xa2, 0x98, 0xa2, 0x98,
+  0x59, 0xa0, 0xa9, 0xc0, 0xa2, 0x88, 0xa2, 0x87, 0x9b, 0x6a, 0x3d, 0x0d, 0x6e, 0x62, 0x0d, 0x24,
+  0x55, 0x0d, 0x12, 0x15, 0x0d, 0xc1, 0x55, 0x08, 0x5a, 0xc0, 0x0d, 0xc3, 0x24, 0x7e, 0x24, 0x05,
+  0x66, 0x0d, 0xc1, 0x15, 0x08, 0xc0, 0x0d, 0x15, 0x7e, 0x24, 0x15, 0x66, 0x24, 0x66, 0x5a, 0x6e,
+  0x24, 0x21, 0x62, 0xa3, 0x87, 0xa3, 0x98, 0x51, 0x24, 0x2c, 0x6f, 0x2c, 0x24, 0xc0, 0x2c, 0x38,
+  0x31, 0x2c, 0x24, 0xc1, 0x2c, 0x31, 0x7f, 0xc0, 0x7f, 0x7e, 0x55, 0x31, 0x57, 0x7a, 0xa2, 0x97,
+  0x3b, 0x38, 0x0f, 0x6e, 0x00, 0x0f, 0x08, 0x03, 0x00, 0x0f, 0x08, 0x00, 0x05, 0xc0, 0x67, 0x0f,
+  0xc1, 0x66, 0x03, 0x0f, 0xa2, 0x87, 0x7a, 0x6f, 0xc0, 0x45, 0x14, 0x07, 0x00, 0x14, 0x17, 0xc1,
+  0x0f, 0xc2, 0x07, 0x6e, 0xa3, 0x98, 0xc0, 0x07, 0x14, 0x1c, 0x14, 0x08, 0xa2, 0x89, 0x1c, 0xc5,
+  0x17, 0xc1, 0x1c, 0xc3, 0x57, 0x05, 0x1c, 0xa2, 0x98, 0xc0, 0x2b, 0x23, 0x1c, 0x23, 0x2b, 0xc0,
+  0x69, 0x23, 0x1c, 0xc2, 0x2b, 0xc1, 0x33, 0x2b, 0x7a, 0x24, 0x14, 0x00, 0x17, 0x33, 0x5a, 0x2b,
+  0x23, 0x1c, 0xc0, 0x23, 0xc0, 0x1c, 0x1f, 0x5e, 0x14, 0xc0, 0x1c, 0x14, 0xc0, 0x1c, 0x17, 0x1c,
+  0xc1, 0x30, 0xa1, 0xa9, 0x33, 0x28, 0x2b, 0x1c, 0xc0, 0x28, 0x23, 0x14, 0xa1, 0xa9, 0x2e, 0x2b,
+  0x1c, 0x17, 0x1c, 0x28, 0x1c, 0xc1, 0x19, 0x30, 0x7b, 0x33, 0x2b, 0x26, 0x2b, 0x30, 0xa2, 0x98,
+  0x02, 0x1c, 0x28, 0x33, 0x07, 0x33, 0x28, 0x2b, 0x33, 0xa2, 0x98, 0x33, 0x28, 0x6e, 0x23, 0x14,
+  0x69, 0x17, 0x6b, 0x0f, 0x21, 0x2b, 0xc0, 0x02, 0x33, 0x23, 0x28, 0x07, 0x02, 0x46, 0xc0, 0x41,
+  0xc0, 0x6e, 0x28, 0x37, 0x2b, 0xc0, 0x37, 0x1b, 0x5a, 0x20, 0xc0, 0x18, 0x51, 0xa2, 0x78, 0x65,
+  0xc0, 0xa3, 0xa9, 0x7a, 0x46, 0x9d, 0x89, 0x59, 0x15, 0x7f, 0x69, 0x52, 0x01, 0xfe, 0x1b, 0xd4,
+  0x5a, 0xc2, 0x6f, 0xc0, 0x6e, 0xc0, 0x28, 0x66, 0x28, 0x6e, 0xc0, 0x28, 0xc1, 0x39, 0xc0, 0x2d,
+  0xc0, 0x28, 0xc0, 0x2d, 0xa2, 0xa8, 0xa3, 0xb8, 0x41, 0x5a, 0x6f, 0x76, 0x1b, 0x69, 0x0f, 0x14,
+  0x12, 0xa2, 0x88, 0xc0, 0x65, 0x26, 0x6e, 0xa2, 0x98, 0x66, 0x69, 0xa2, 0x98, 0x7a, 0xa2, 0x88,
+  0x7f, 0x69, 0xa3, 0x99, 0x7e, 0x9a, 0x69, 0x46, 0x0d, 0xc0, 0x52, 0xa2, 0x77, 0x24, 0x66, 0x41,
+  0x1c, 0x69, 0x0d, 0xc0, 0x08, 0x5a, 0xc0, 0x08, 0x0d, 0x08, 0x1f, 0xa2, 0x77, 0x0d, 0x1c, 0x6e,
+  0x24, 0xc0, 0x05, 0xc0, 0xa1, 0xa9, 0x08, 0x10, 0x24, 0x21, 0x08, 0x10, 0xa2, 0x77, 0x24, 0xc0,
+  0x15, 0x10, 0xc0, 0x1c, 0xc0, 0x10, 0x1c, 0x0d, 0x21, 0x33, 0x24, 0x2c, 0x66, 0xa2, 0x78, 0xc0,
+  0x33, 0x2c, 0x24, 0xc1, 0x33, 0x38, 0x29, 0x24, 0x29, 0x2c, 0x38, 0x7e, 0x6e, 0xa2, 0xa9, 0x9d,
+  0x88, 0x2c, 0x29, 0x24, 0x33, 0x7e, 0xc1, 0x03, 0x6e, 0x05, 0x08, 0x03, 0x3b, 0x2c, 0x03, 0xc0,
+  0x05, 0x08, 0x0f, 0xc3, 0x66, 0x0f, 0xc0, 0x6e, 0x26, 0x55, 0xc1, 0x0f, 0xc0, 0xa2, 0x88, 0x59,
+  0x08, 0x0f, 0x17, 0x0f, 0x00, 0x0f, 0x0a, 0x5e, 0xc0, 0xa2, 0x97, 0x17, 0x00, 0x14, 0x1c, 0x55,
+  0x1c, 0xc2, 0x23, 0x1c, 0xc0, 0x17, 0xc0, 0x1c, 0xc2, 0x17, 0x1c, 0xc1, 0x14, 0x0c, 0xa3, 0xa8,
+  0x7e, 0x26, 0x1c, 0x23, 0xc0, 0x1c, 0x7a, 0xc0, 0x1c, 0xc0, 0x6f, 0xc0, 0x1c, 0x2b, 0xc1, 0x7a,
+  0x33, 0x2b, 0xc0, 0x28, 0x14, 0x5a, 0x23, 0x2b, 0x1c, 0xc0, 0x28, 0x1c, 0xc1, 0x26, 0xc0, 0x17,
+  0x1c, 0x14, 0x17, 0x2b, 0x1c, 0xc1, 0x2b, 0x28, 0x23, 0x2b, 0xa2, 0x98, 0x40, 0x28, 0x2b, 0x14,
+  0xc0, 0x7b, 0x14, 0xc0, 0x1c, 0x33, 0x2b, 0x1c, 0xc1, 0x17, 0x14, 0x23, 0x2b, 0x28, 0x2b, 0x33,
+  0x2b, 0x1c, 0x2b, 0xc0, 0x6e, 0x7f, 0x66, 0x24, 0x5f, 0x30, 0x02, 0x33, 0x1c, 0x28, 0x30, 0x02,
+  0x33, 0x23, 0x2b, 0x23, 0x56, 0x0f, 0x33, 0x3f, 0x1b, 0x1c, 0x30, 0x2b, 0xc0, 0x2e, 0x2b, 0x1e,
+  0x23, 0xa3, 0x97, 0x3f, 0x56, 0x41, 0x28, 0xc0, 0x2b, 0x37, 0xc0, 0x28, 0xc0, 0x1b, 0x20, 0xc0,
+  0x56, 0x20, 0x52, 0x55, 0xa2, 0x78, 0xc0, 0xa2, 0xa8, 0xc0, 0x46, 0x9d, 0x79, 0x65, 0x15, 0x24,
+  0x69, 0x52, 0x56, 0x59, 0xfe, 0x13, 0xf4, 0x66, 0xc1, 0x6b, 0x2d, 0x28, 0x6f, 0xc1, 0x28, 0x65,
+  0x28, 0xc4, 0x34, 0x2d, 0xc2, 0x6f, 0x6e, 0xa1, 0xb8, 0xa1, 0xb8, 0x5a, 0x5a, 0x76, 0x17, 0x56,
+  0x6b, 0x65, 0x0c, 0x7f, 0x7a, 0xa2, 0x97, 0x7e, 0x52, 0x5e, 0xa1, 0xa9, 0xa1, 0xa8, 0xc1, 0xa2,
+  0x88, 0xa2, 0x97, 0x6e, 0x6f, 0x51, 0x56, 0xc0, 0x61, 0x5b, 0x55, 0x7e, 0x7e, 0x21, 0x1c, 0x5a,
+  0x0d, 0x6e, 0x05, 0x66, 0x69, 0xa2, 0x78, 0x0d, 0x15, 0xc0, 0x7f, 0x2c, 0x15, 0x24, 0x21, 0x69,
+  0x0d, 0x08, 0x15, 0xc1, 0x21, 0x2c, 0x29, 0x0d, 0x21, 0x1c, 0x1a, 0x1c, 0x0d, 0x39, 0x0d, 0x12,
+  0x0d, 0x15, 0x1a, 0x1c, 0xa3, 0x88, 0x24, 0xc0, 0x7f, 0x2c, 0x7f, 0x5a, 0x31, 0x62, 0x24, 0xc2,
+  0x2c, 0xc0, 0x29, 0x2c, 0xa2, 0x88, 0xc0, 0x38, 0xa2, 0x97, 0x6b, 0x3b, 0x2c, 0x29, 0x33, 0x38,
+  0x31, 0x00, 0x3b, 0x69, 0x0f, 0x59, 0x00, 0xc0, 0x2c, 0x31, 0x3b, 0x08, 0x6f, 0x61, 0x08, 0x0f,
+  0xc4, 0x00, 0x0f, 0x7f, 0x0f, 0x14, 0x0f, 0xa2, 0x87, 0xc0, 0x7f, 0x40, 0x57, 0x0f, 0x08, 0x0f,
+  0x05, 0x00, 0x0f, 0x1c, 0x6f, 0x0f, 0xc0, 0x08, 0x14, 0x1c, 0x28, 0x7e, 0x2b, 0x51, 0x1c, 0xc2,
+  0x17, 0xc0, 0x7f, 0x1c, 0x28, 0xc0, 0x1c, 0xc1, 0x17, 0x14, 0x2b, 0x28, 0x14, 0xc0, 0x1c, 0xc0,
+  0x7a, 0x17, 0x14, 0x28, 0x2b, 0x69, 0x2b, 0x17, 0x1c, 0x26, 0x1c, 0x24, 0x2b, 0x7e, 0x2b, 0x1c,
+  0x6e, 0x0f, 0xa2, 0x88, 0x21, 0x0f, 0xc0, 0x1c, 0xc1, 0x2b, 0xc1, 0x1c, 0x17, 0x26, 0x24, 0x2b,
+  0x24, 0xc0, 0x1c, 0x14, 0x2b, 0xc1, 0x7a, 0x2b, 0x21, 0x2b, 0x17, 0x0f, 0x0c, 0x1e, 0x17, 0x0f,
+  0x1e, 0x26, 0x14, 0xc0, 0x26, 0x23, 0x14, 0x0f, 0x1e, 0x30, 0x2b, 0x30, 0x2b, 0x1c, 0x24, 0x23,
+  0xc0, 0x30, 0x33, 0x1c, 0x28, 0x21, 0x33, 0x2b, 0x14, 0x1c, 0x2b, 0xa2, 0x87, 0x2b, 0x1c, 0xc0,
+  0x2b, 0x1e, 0x14, 0x2b, 0xa4, 0x97, 0x26, 0x41, 0x2b, 0xc2, 0x1c, 0x2b, 0x7f, 0x28, 0xa2, 0x88,
+  0x66, 0x28, 0x56, 0x28, 0xc0, 0x37, 0xc0, 0x28, 0x57, 0x55, 0x20, 0xc0, 0x18, 0x66, 0x59, 0x6b,
+  0xc0, 0x18, 0x37, 0x7b, 0x9e, 0x58, 0x41, 0x66, 0xa2, 0x98, 0x6d, 0x24, 0x0d, 0x51, 0x5b, 0x7a,
+  0xfe, 0x13, 0xd4, 0xc4, 0x66, 0x28, 0x6e, 0xc0, 0x28, 0xc4, 0x23, 0x2d, 0xc1, 0x28, 0x2d, 0xc1,
+  0x6f, 0x6e, 0xa0, 0xb8, 0x7e, 0x7a, 0x5b, 0x65, 0x4a, 0x7f, 0x69, 0xc0, 0xa2, 0x88, 0x72, 0xa3,
+  0x97, 0xa3, 0x98, 0x9d, 0x99, 0x56, 0x31, 0x6e, 0xa2, 0xa8, 0xa2, 0x88, 0x65, 0x24, 0x6e, 0x56,
+  0x10, 0x6e, 0x42, 0x7e, 0x7f, 0x05, 0x0d, 0x24, 0xc0, 0x45, 0x0d, 0x10, 0x0d, 0x05, 0xc0, 0x59,
+  0x0d, 0x10, 0x24, 0x7e, 0x52, 0x1c, 0x21, 0x15, 0x12, 0x0d, 0x51, 0x6e, 0x0d, 0xc0, 0x7b, 0xa2,
+  0x76, 0x21, 0x1c, 0x15, 0x1c, 0x0d, 0x15, 0x1c, 0x9d, 0x89, 0xc0, 0x0d, 0x66, 0x0d, 0x1c, 0x21,
+  0x29, 0xc0, 0x7e, 0xc0, 0x29, 0x15, 0x2c, 0xa3, 0x88, 0x66, 0x24, 0xc3, 0xa2, 0x88, 0x24, 0x29,
+  0x38, 0x00, 0x66, 0xc1, 0x00, 0x2c, 0x5b, 0x24, 0x31, 0x2c, 0x3b, 0xa3, 0x87, 0x9d, 0x99, 0x38,
+  0x7f, 0x38, 0x3b, 0xc0, 0x24, 0x7f, 0x00, 0x7e, 0xc0, 0x66, 0xa2, 0x88, 0x5a, 0x66, 0xc1, 0x66,
+  0x00, 0x0f, 0x14, 0x3b, 0x0f, 0xc1, 0xa2, 0x87, 0x17, 0x14, 0x0f, 0xc0, 0x05, 0xc0, 0x6b, 0x05,
+  0x03, 0x0f, 0x1c, 0x17, 0x0f, 0xc0, 0x08, 0x1c, 0xc0, 0x7a, 0xa2, 0x88, 0x55, 0x53, 0x1c, 0xc1,
+  0x7b, 0x1c, 0xc2, 0x6f, 0x26, 0xc0, 0x5a, 0x1c, 0x17, 0x23, 0x7e, 0x1c, 0x23, 0x1c, 0x6e, 0x1f,
+  0x1c, 0x23, 0x1c, 0xc0, 0x24, 0x2b, 0x1c, 0xc0, 0x28, 0x1c, 0xc0, 0x28, 0x2b, 0x6e, 0x26, 0x17,
+  0x14, 0xc0, 0x1c, 0x17, 0xa4, 0x77, 0x21, 0x1c, 0x1f, 0x1c, 0xc0, 0x23, 0x1c, 0xc1, 0x2b, 0x1c,
+  0x24, 0x30, 0x1c, 0x0f, 0xa2, 0x78, 0x2b, 0x24, 0x2b, 0x30, 0x24, 0x28, 0x23, 0x17, 0x14, 0x33,
+  0x30, 0x0f, 0x17, 0x23, 0x1c, 0x0f, 0x26, 0x7e, 0x1c, 0x0f, 0x17, 0x23, 0x2b, 0xc0, 0x30, 0xc0,
+  0x2b, 0x23, 0xc0, 0x2b, 0x30, 0x1c, 0x30, 0x2b, 0xc1, 0x1c, 0xc1, 0xa3, 0x99, 0x66, 0x2b, 0xc0,
+  0x21, 0x2b, 0x3a, 0x17, 0x2b, 0xc0, 0x0f, 0x23, 0x30, 0x67, 0x2b, 0x28, 0x2b, 0xa4, 0x87, 0x51,
+  0x2b, 0x28, 0x55, 0x20, 0x6b, 0x28, 0x5a, 0x20, 0x23, 0x6b, 0x25, 0xc1, 0x20, 0x4a, 0x52, 0xc0,
+  0x7f, 0x7e, 0x27, 0xa2, 0x87, 0x56, 0x9d, 0x89, 0x56, 0xa3, 0x97, 0x24, 0x66, 0x59, 0x9d, 0x79,
+  0x5a, 0x36, 0x33, 0xfe, 0x13, 0xd4, 0xc1, 0x6f, 0x28, 0xc4, 0x6e, 0xc0, 0x28, 0x66, 0x28, 0xc2,
+  0x2d, 0xc1, 0x6e, 0x2d, 0x28, 0xc0, 0x34, 0x6e, 0x7e, 0xa1, 0xa8, 0x7f, 0x65, 0x0c, 0x66, 0x1b,
+  0xc0, 0x66, 0x0f, 0xa2, 0x98, 0xa2, 0x97, 0xa2, 0x99, 0x59, 0x9d, 0x9a, 0xa2, 0x87, 0xa3, 0xa7,
+  0x6f, 0x56, 0xc0, 0x7a, 0x29, 0x52, 0x55, 0x36, 0x0d, 0x7e, 0x0d, 0xa3, 0xb8, 0x24, 0x0d, 0xc3,
+  0x05, 0x69, 0x14, 0x7a, 0x5e, 0x15, 0xa2, 0x99, 0x5a, 0x19, 0x17, 0x69, 0x15, 0x0d, 0x9d, 0x89,
+  0x0d, 0x1c, 0x05, 0x21, 0x24, 0x66, 0x69, 0x15, 0x0d, 0xc0, 0x21, 0x15, 0x36, 0x7b, 0x1c, 0x50,
+  0x19, 0x24, 0x1f, 0x24, 0xc0, 0x7e, 0x7f, 0x9e, 0x67, 0x15, 0x24, 0x2c, 0x6e, 0x24, 0x2c, 0x29,
+  0x24, 0x2c, 0x6f, 0x24, 0x29, 0x31, 0x38, 0x2c, 0xc0, 0x3b, 0x38, 0x31, 0x24, 0x29, 0x38, 0x31,
+  0xa1, 0xa9, 0x55, 0x38, 0xc0, 0x2c, 0xc0, 0x3b, 0x33, 0xc1, 0x3b, 0xc0, 0x6e, 0x7e, 0xa2, 0x88,
+  0x52, 0xc0, 0x66, 0x0f, 0xc0, 0x00, 0xa4, 0x97, 0x52, 0x31, 0xa3, 0x99, 0x08, 0x0f, 0xc5, 0x5a,
+  0x69, 0x00, 0x0f, 0xc0, 0x17, 0xc0, 0x0f, 0x05, 0x0f, 0xc0, 0x1c, 0xa2, 0x88, 0x24, 0x17, 0x24,
+  0x17, 0x1c, 0xc0, 0x7b, 0x17, 0xc1, 0x7e, 0x6f, 0xc0, 0x1c, 0xc0, 0x2b, 0x1c, 0xc0, 0x14, 0x1c,
+  0xa2, 0x98, 0x1f, 0x1c, 0xc2, 0x17, 0x1c, 0x17, 0xc0, 0x1c, 0x26, 0x17, 0xc0, 0x1c, 0xc0, 0x26,
+  0x2b, 0x56, 0x14, 0x0c, 0x0f, 0xc0, 0x1c, 0x30, 0x1c, 0xc2, 0x17, 0xc0, 0x1c, 0xc0, 0x6f, 0x1c,
+  0x17, 0x1c, 0xc0, 0x17, 0x1c, 0x28, 0x2b, 0x30, 0x2b, 0x33, 0x30, 0x2b, 0xc1, 0x33, 0xa3, 0x99,
+  0x23, 0x45, 0x23, 0x26, 0x23, 0x2b, 0x7a, 0x17, 0x14, 0x1c, 0x28, 0x2b, 0xc2, 0x33, 0x2b, 0x23,
+  0x30, 0x2b, 0x59, 0xc0, 0x24, 0x30, 0x2b, 0x1c, 0x21, 0x2b, 0x30, 0xc0, 0x1c, 0x2b, 0x7f, 0x28,
+  0x30, 0x2b, 0x28, 0x26, 0x17, 0x23, 0x2b, 0x30, 0x2b, 0x28, 0x30, 0xa1, 0xa9, 0x33, 0x1c, 0x28,
+  0x56, 0x23, 0xc1, 0xa2, 0x88, 0x23, 0x42, 0x6e, 0xa2, 0x87, 0x6b, 0x20, 0x5a, 0x18, 0x46, 0x18,
+  0xa3, 0x97, 0x53, 0x45, 0x7f, 0xa2, 0x88, 0x41, 0x9d, 0x99, 0x7e, 0x24, 0x18, 0x10, 0x9e, 0x69,
+  0xc1, 0x6e, 0x56, 0xfe, 0x13, 0xd4, 0xc0, 0x6f, 0xc0, 0x28, 0xc4, 0x6e, 0x34, 0x28, 0xc0, 0x66,
+  0x28, 0xc3, 0xa2, 0x78, 0xc0, 0x2d, 0xc0, 0x28, 0xc1, 0x39, 0x7f, 0xa1, 0xa8, 0xa2, 0x97, 0x76,
+  0x9f, 0x58, 0x66, 0xa1, 0xa8, 0x5a, 0x0f, 0x7e, 0xa2, 0x98, 0xa2, 0x98, 0x7e, 0x66, 0xa2, 0x77,
+  0x7e, 0x66, 0x12, 0x7f, 0xa1, 0xa9, 0x5a, 0x9d, 0x78, 0x51, 0xc0, 0x08, 0xc0, 0x59, 0xa2, 0xa8,
+  0x0d, 0x42, 0xc0, 0x3e, 0x0d, 0x05, 0xc0, 0xa2, 0x98, 0x21, 0x62, 0x1c, 0x0d, 0x1a, 0x21, 0xc0,
+  0x17, 0x15, 0x7f, 0x1c, 0x05, 0x1c, 0x17, 0x3e, 0x15, 0x24, 0xc0, 0x15, 0xc0, 0x0d, 0xc0, 0x12,
+  0x76, 0x0d, 0xc0, 0x1c, 0x08, 0x12, 0x24, 0xc1, 0x21, 0xa1, 0xa8, 0xc0, 0x5a, 0x24, 0x15, 0x29,
+  0x33, 0x24, 0x2c, 0x6e, 0x29, 0x2c, 0x6f, 0x2c, 0x29, 0x2c, 0x31, 0x29, 0x24, 0x2c, 0xc0, 0x24,
+  0xc0, 0x29, 0x38, 0x31, 0xa2, 0x98, 0x56, 0x24, 0x29, 0x2c, 0x38, 0xc0, 0x2c, 0xc1, 0x33, 0x7e,
+  0x00, 0xa2, 0x88, 0x7a, 0x56, 0xc1, 0x00, 0xc2, 0x65, 0xa4, 0x88, 0xc0, 0x08, 0x17, 0x14, 0x0f,
+  0xc3, 0x00, 0xc1, 0x0f, 0x14, 0x1c, 0x0f, 0x00, 0xc1, 0x6e, 0x17, 0xa2, 0x77, 0x14, 0x17, 0xa2,
+  0x87, 0x17, 0x7f, 0xa2, 0x77, 0x66, 0x17, 0x1c, 0x2b, 0x1c, 0x6f, 0x66, 0x17, 0x1c, 0x2b, 0x23,
+  0x14, 0xc0, 0x1c, 0xc0, 0x17, 0x1c, 0x23, 0xc0, 0x1c, 0x14, 0x1c, 0xc0, 0x0f, 0x23, 0x2b, 0x23,
+  0x0f, 0x17, 0xc1, 0x23, 0x0f, 0x14, 0x0f, 0xc0, 0x14, 0x17, 0x1c, 0x17, 0x14, 0x2b, 0x1c, 0x0f,
+  0x6d, 0x17, 0x08, 0x1c, 0x2b, 0x1c, 0xc2, 0x2b, 0x30, 0xc0, 0x2b, 0xc0, 0x7e, 0x2b, 0x26, 0x7e,
+  0xc0, 0x30, 0x1c, 0x9d, 0x9a, 0x1c, 0x26, 0x2b, 0xc0, 0x33, 0x23, 0x08, 0x23, 0x30, 0x2b, 0xc3,
+  0x33, 0x2b, 0x30, 0x2b, 0x1c, 0x2b, 0x1c, 0x30, 0x2b, 0x14, 0xc0, 0x28, 0x6e, 0x28, 0x14, 0x1c,
+  0x2b, 0x28, 0x23, 0x30, 0x2b, 0x30, 0x26, 0x23, 0x28, 0xc0, 0x23, 0xc0, 0x26, 0x2e, 0x30, 0x9d,
+  0x8a, 0x23, 0x5a, 0x28, 0xc0, 0x23, 0xa2, 0x88, 0x56, 0x9d, 0x89, 0x6e, 0x1b, 0x28, 0x46, 0x52,
+  0x69, 0x10, 0xc0, 0x28, 0x37, 0x18, 0xa2, 0x68, 0x7b, 0x65, 0x9d, 0x88, 0x10, 0xa2, 0x98, 0x1d,
+  0x10, 0x41, 0x5b, 0x6e, 0x56, 0x55, 0xc0, 0xfe, 0x13, 0xb4, 0xc0, 0x6e, 0xc3, 0x6b, 0x28, 0xc0,
+  0x6e, 0xc0, 0x28, 0xc0, 0x23, 0x28, 0xc3, 0x2d, 0x6f, 0x2d, 0x28, 0x2d, 0xc0, 0x28, 0xa2, 0x79,
+  0x6e, 0x79, 0xa1, 0xa8, 0xc0, 0x9f, 0x69, 0xa2, 0xa8, 0x76, 0x5a, 0x7d, 0xa1, 0xa9, 0xa2, 0x97,
+  0x6b, 0x7e, 0xa2, 0x97, 0x7e, 0x6b, 0x42, 0x6e, 0x7e, 0xc0, 0x51, 0x05, 0x59, 0x36, 0x7e, 0x66,
+  0x36, 0x3e, 0x05, 0x3d, 0xc3, 0x0d, 0xa4, 0xa8, 0x9d, 0x89, 0x36, 0x0d, 0x7a, 0x0d, 0xc0, 0x15,
+  0x0d, 0xc0, 0x24, 0xc0, 0x0d, 0x66, 0xc0, 0x0d, 0xc0, 0x15, 0xc0, 0x0d, 0x05, 0x66, 0x0d, 0x3e,
+  0x10, 0x6f, 0x05, 0x00, 0x08, 0xc0, 0x1c, 0x15, 0x21, 0x24, 0x6e, 0xc0, 0x6f, 0x24, 0x1f, 0xa2,
+  0x87, 0xc1, 0x6f, 0x69, 0x24, 0xc0, 0x31, 0x38, 0x61, 0x24, 0x29, 0x24, 0x29, 0x24, 0xc1, 0x6f,
+  0x24, 0xc0, 0x31, 0xc0, 0x38, 0x1c, 0x30, 0x2c, 0x5e, 0x2c, 0x24, 0x29, 0x7b, 0x3b, 0x31, 0xa2,
+  0x88, 0x7a, 0x66, 0x6b, 0x6e, 0x6e, 0x08, 0x05, 0x66, 0x33, 0x08, 0xa3, 0x98, 0x41, 0x57, 0xa2,
+  0x87, 0xc0, 0x14, 0x0f, 0xc1, 0x00, 0xc0, 0x05, 0x0f, 0xc2, 0x0a, 0x0f, 0x00, 0xc0, 0x0f, 0x7e,
+  0xc0, 0x14, 0xc0, 0x24, 0x6b, 0xc1, 0xa2, 0x87, 0x56, 0x61, 0x24, 0x17, 0xc0, 0x30, 0x7a, 0x52,
+  0x14, 0xc0, 0x7b, 0x14, 0xc0, 0x7f, 0x17, 0x19, 0x23, 0x61, 0xc0, 0x17, 0x6e, 0xc0, 0x14, 0x1e,
+  0x1c, 0x0f, 0x08, 0x1c, 0xc0, 0x14, 0x0f, 0x14, 0xc0, 0x00, 0x14, 0x0f, 0x0d, 0x1c, 0x17, 0x14,
+  0x17, 0xc0, 0x00, 0x1c, 0x23, 0x08, 0x17, 0xc0, 0xa2, 0x77, 0x2b, 0xc0, 0x30, 0xc0, 0x2b, 0xc2,
+  0x33, 0x2b, 0x24, 0xa2, 0x89, 0x2b, 0x23, 0x14, 0x6b, 0x24, 0x26, 0x2b, 0x30, 0x33, 0x14, 0x1c,
+  0xa2, 0x99, 0x2b, 0xc4, 0x1c, 0x33, 0x2b, 0x17, 0x30, 0x2b, 0xc1, 0x14, 0xc0, 0x1e, 0x23, 0x14,
+  0x0c, 0x14, 0x23, 0x19, 0x23, 0x6e, 0xc0, 0x2b, 0xc2, 0x28, 0x56, 0x28, 0x7b, 0x2b, 0xc0, 0x23,
+  0x28, 0x23, 0x6b, 0x28, 0x7f, 0xc0, 0x56, 0x41, 0x6e, 0x18, 0x28, 0x57, 0x9d, 0x78, 0x66, 0x7e,
+  0x1d, 0x20, 0x18, 0x5a, 0xc0, 0x7f, 0x18, 0x04, 0x6f, 0x24, 0x61, 0x4a, 0x66, 0x5a, 0x5a, 0x51,
+  0x5a, 0x56, 0xa2, 0x97, 0xfe, 0x13, 0xb4, 0xc1, 0x6e, 0xc1, 0x6b, 0xc0, 0x6e, 0x28, 0x6e, 0xc0,
+  0x28, 0x2d, 0x28, 0xc0, 0x2d, 0x28, 0xc2, 0x2d, 0x6e, 0x2d, 0x28, 0xc1, 0xa2, 0x78, 0x6e, 0xc0,
+  0x39, 0x6f, 0x7a, 0xc0, 0xa1, 0xa8, 0xa1, 0xa8, 0x7e, 0xa3, 0xa8, 0xc0, 0x56, 0xa2, 0x87, 0xa1,
+  0xa9, 0x7e, 0x6e, 0x9d, 0x89, 0x6b, 0x0d, 0x14, 0x05, 0xc0, 0x0a, 0x05, 0x65, 0x05, 0x5a, 0x3d,
+  0x6d, 0x02, 0x3d, 0x7a, 0x59, 0x0d, 0x29, 0x65, 0x1c, 0x3d, 0x05, 0xa2, 0x97, 0x5a, 0x14, 0x05,
+  0xc1, 0x0d, 0xa2, 0x88, 0x0d, 0x55, 0x05, 0x7a, 0x7e, 0x21, 0x15, 0x0d, 0x36, 0x05, 0x10, 0x08,
+  0x0d, 0x08, 0x39, 0x00, 0x05, 0x08, 0x15, 0xc0, 0x24, 0xc1, 0x29, 0xc0, 0x24, 0x66, 0x24, 0x7e,
+  0x7f, 0x59, 0xc0, 0x67, 0x2c, 0x6f, 0x31, 0x2c, 0x24, 0xc0, 0x21, 0x24, 0x29, 0xc1, 0x24, 0xc1,
+  0xa2, 0x77, 0x24, 0x1f, 0x24, 0x29, 0x24, 0xc2, 0x6f, 0x2c, 0xc0, 0x3b, 0x6e, 0x3b, 0x00, 0x7b,
+  0xa2, 0x77, 0x65, 0xc0, 0x00, 0xc0, 0x7a, 0xa2, 0x88, 0x08, 0x6b, 0xc0, 0x17, 0x7f, 0xc0, 0x14,
+  0x0f, 0xc0, 0x00, 0x0f, 0xc3, 0x0a, 0x0f, 0xc0, 0x00, 0x14, 0x03, 0x17, 0x0a, 0x0f, 0xa2, 0x87,
+  0xc0, 0xa2, 0x88, 0x61, 0x1c, 0xc0, 0x7f, 0x30, 0x1c, 0x14, 0xc0, 0x30, 0x7e, 0x2b, 0x1c, 0x0f,
+  0xc0, 0x14, 0x17, 0xc1, 0x14, 0x2b, 0x26, 0x51, 0x17, 0x1f, 0x1c, 0x17, 0x14, 0x08, 0x00, 0x17,
+  0x2b, 0x1c, 0x14, 0x1c, 0xc0, 0x3b, 0x08, 0x2b, 0x14, 0x08, 0x17, 0xc0, 0x0f, 0x17, 0x00, 0x08,
+  0x2b, 0x17, 0x14, 0xc1, 0xa2, 0x87, 0x2b, 0xc1, 0x30, 0x52, 0x26, 0x2b, 0x7e, 0xc0, 0x66, 0x33,
+  0xc0, 0x23, 0x1c, 0x23, 0x5a, 0x17, 0x23, 0xc0, 0x33, 0xc0, 0x2b, 0x30, 0x2b, 0xc6, 0x30, 0x2b,
+  0xc2, 0x23, 0x59, 0x14, 0x23, 0x6e, 0xc0, 0x41, 0x66, 0x19, 0x14, 0x19, 0x28, 0xc0, 0x23, 0x28,
+  0xc0, 0x30, 0x2b, 0x28, 0x2b, 0xa3, 0x98, 0x9d, 0x8a, 0x28, 0x23, 0x56, 0x28, 0x6b, 0xc0, 0x28,
+  0x6f, 0x2f, 0x20, 0x6b, 0x59, 0x20, 0xc0, 0x42, 0x55, 0x10, 0x27, 0x6d, 0x11, 0x47, 0xc0, 0x10,
+  0xc0, 0x65, 0xc1, 0x5b, 0x66, 0x08, 0x5a, 0xc0, 0x41, 0xc0, 0x56, 0x6e, 0x7f, 0xfe, 0x13, 0xd4,
+  0x66, 0x28, 0xc2, 0x6b, 0x6e, 0x6e, 0x34, 0x28, 0x34, 0xc2, 0x28, 0xc1, 0x23, 0x28, 0xc0, 0x6e,
+  0xc0, 0x39, 0x2d, 0xc0, 0x34, 0x39, 0xc0, 0x6f, 0xc0, 0x69, 0x7b, 0x5d, 0xa1, 0xb9, 0xa1, 0xa8,
+  0xa1, 0xa8, 0xa2, 0x98, 0x56, 0x5a, 0xa2, 0xa7, 0xa2, 0x97, 0x6b, 0x6e, 0x55, 0x57, 0x42, 0x61,
+  0x05, 0x6e, 0x05, 0x66, 0x7e, 0x0a, 0x3d, 0x05, 0x5a, 0x3d, 0xc1, 0x7d, 0x29, 0xc0, 0x08, 0x05,
+  0xc0, 0xa2, 0x97, 0x1a, 0x6b, 0xc0, 0x05, 0xc0, 0x08, 0x3e, 0x0d, 0xc1, 0x05, 0x08, 0xa2, 0x88,
+  0x24, 0xc0, 0x51, 0x9e, 0x68, 0x0d, 0x1c, 0x0d, 0xc2, 0x00, 0x05, 0x15, 0x7a, 0x24, 0xc2, 0x21,
+  0x24, 0xc2, 0xa2, 0x87, 0x7b, 0x31, 0x66, 0x29, 0x24, 0x3b, 0x6e, 0x5a, 0x2c, 0x29, 0x24, 0xc0,
+  0x2c, 0x24, 0x29, 0x2c, 0x24, 0xc0, 0x29, 0xc0, 0x24, 0x29, 0x24, 0x15, 0x24, 0x2c, 0x24, 0xc0,
+  0xa2, 0x88, 0x31, 0x2c, 0x3b, 0xc1, 0xa2, 0x88, 0xa2, 0x87, 0x51, 0x00, 0x3b, 0xc0, 0x08, 0x3b,
+  0x00, 0x0f, 0xc0, 0x1c, 0xc0, 0x66, 0xc0, 0x0f, 0x00, 0xc0, 0x0f, 0xc4, 0x59, 0x00, 0x3b, 0x05,
+  0x08, 0x0f, 0x00, 0x08, 0xa3, 0x98, 0x17, 0x24, 0x1c, 0xc1, 0x17, 0x24, 0x17, 0xc0, 0x6f, 0x7e,
+  0xc0, 0x1c, 0x17, 0x2b, 0x41, 0xc0, 0x17, 0xc0, 0x14, 0xc0, 0xa1, 0xa9, 0xc0, 0x69, 0x17, 0xc1,
+  0x0f, 0xc0, 0x17, 0x0f, 0x1c, 0x14, 0xc0, 0x1c, 0xc0, 0x14, 0x00, 0x17, 0x2b, 0x0f, 0x00, 0x0f,
+  0x65, 0x0f, 0x14, 0x0f, 0x1c, 0x14, 0x0f, 0x17, 0x5e, 0x23, 0x2b, 0xc5, 0x26, 0x2b, 0xc0, 0x7f,
+  0x7e, 0x1c, 0x17, 0x23, 0xc0, 0x6e, 0x23, 0x1c, 0x2b, 0xa2, 0x87, 0x66, 0xc0, 0x2b, 0x23, 0x2b,
+  0xc3, 0x6e, 0xc0, 0x1c, 0x2b, 0xc1, 0x26, 0x17, 0x14, 0x19, 0x23, 0x14, 0xc0, 0x5a, 0x14, 0x19,
+  0x28, 0xc0, 0x69, 0x23, 0x28, 0x1c, 0xc0, 0x28, 0x1c, 0x21, 0x2b, 0x6b, 0x51, 0x6f, 0x55, 0xc0,
+  0x6e, 0x28, 0x20, 0x28, 0xc0, 0x5b, 0xc0, 0x66, 0x59, 0xc0, 0x56, 0x51, 0x7f, 0x1d, 0xc0, 0x62,
+  0x55, 0x10, 0x56, 0x04, 0x7a, 0x6e, 0x01, 0x46, 0xc0, 0x7e, 0x10, 0x3e, 0x42, 0x5a, 0xc0, 0x36,
+  0x7f, 0x5a, 0xfe, 0x13, 0xd4, 0xc0, 0x66, 0x28, 0xc1, 0x6f, 0xc0, 0x6e, 0x34, 0xc5, 0x69, 0x28,
+  0xc1, 0x2d, 0xc0, 0x28, 0x2d, 0x34, 0x39, 0xc0, 0x6f, 0xc1, 0x69, 0xc1, 0xa2, 0x98, 0x7a, 0x7e,
+  0xa1, 0xb8, 0x7f, 0x6f, 0x69, 0xa2, 0xa7, 0xa4, 0x87, 0x9d, 0x8a, 0x66, 0xa3, 0x97, 0x46, 0x3d,
+  0x2e, 0x3d, 0xa2, 0x87, 0x66, 0x66, 0x3d, 0x69, 0x02, 0x05, 0x3d, 0xa2, 0x97, 0x05, 0xc0, 0x7f,
+  0x15, 0x1c, 0x0d, 0x1c, 0x0d, 0xc0, 0x7a, 0x7f, 0xa2, 0x77, 0x15, 0x0d, 0xc0, 0x05, 0xc0, 0x0d,
+  0x6e, 0x0d, 0x66, 0x0d, 0x10, 0xa2, 0x88, 0x29, 0x0d, 0xc1, 0x08, 0x05, 0xc0, 0x12, 0x08, 0xc0,
+  0x0d, 0xc0, 0x21, 0x24, 0xc0, 0x21, 0xc0, 0x24, 0x15, 0xa2, 0x98, 0x7a, 0x2c, 0x6f, 0x7a, 0x31,
+  0x15, 0xc0, 0x31, 0x7f, 0x31, 0x24, 0x29, 0xc2, 0x24, 0x38, 0x31, 0x24, 0xc0, 0x29, 0x24, 0xc1,
+  0x29, 0x21, 0x1f, 0x29, 0xc0, 0x31, 0x38, 0x31, 0x2c, 0xa2, 0x98, 0x3b, 0xc0, 0xa2, 0x87, 0x03,
+  0x00, 0x3b, 0xc0, 0x00, 0x6e, 0x00, 0xc0, 0x7f, 0x08, 0xa2, 0x88, 0x08, 0x0f, 0x7e, 0x0f, 0x00,
+  0xc0, 0x0f, 0xc3, 0x17, 0x08, 0x00, 0xc0, 0x3b, 0xa3, 0x87, 0x03, 0x00, 0xc0, 0x08, 0xa2, 0x89,
+  0x7d, 0x1c, 0x0f, 0x24, 0xc0, 0x17, 0x1c, 0x17, 0xa2, 0x78, 0x7a, 0x1c, 0x0f, 0x1c, 0x7b, 0x23,
+  0xc0, 0x17, 0xc0, 0x1c, 0x56, 0x17, 0xc2, 0x03, 0x08, 0x1c, 0x17, 0xc0, 0x1c, 0x0f, 0x14, 0x0f,
+  0x17, 0x14, 0x08, 0x14, 0x1c, 0x17, 0x14, 0x05, 0x00, 0x0f, 0x1c, 0x17, 0xc0, 0x08, 0x0d, 0x0f,
+  0x17, 0x1c, 0x2b, 0x6e, 0x2b, 0xc0, 0x30, 0x2b, 0x7e, 0x2b, 0x52, 0x23, 0x1c, 0x2b, 0xc0, 0x1c,
+  0x23, 0xc2, 0x1e, 0x23, 0x30, 0x7f, 0x30, 0x26, 0x2b, 0x30, 0xc0, 0x2b, 0xc0, 0x26, 0x1c, 0x2b,
+  0x65, 0x1c, 0x26, 0x1c, 0x2b, 0x1c, 0xc0, 0x14, 0xc1, 0x56, 0xc0, 0x0f, 0xa2, 0x77, 0x23, 0xc0,
+  0x17, 0x19, 0x28, 0x59, 0x1c, 0xa2, 0x78, 0x19, 0x17, 0x28, 0x5a, 0x7b, 0xc0, 0x51, 0x5e, 0x7a,
+  0x28, 0xc0, 0x20, 0x1b, 0x20, 0xc0, 0x25, 0xc0, 0x57, 0x55, 0x56, 0xa2, 0x87, 0x20, 0xc0, 0x41,
+  0x56, 0x6b, 0x0d, 0x76, 0x09, 0x66, 0x01, 0x46, 0x6b, 0x36, 0x6d, 0x36, 0x56, 0x5a, 0xc0, 0x36,
+  0x7e, 0x36, 0x2e, 0xfe, 0x13, 0xb3, 0x6b, 0xc0, 0x6e, 0xc2, 0x6f, 0x6e, 0x34, 0xc4, 0x39, 0x34,
+  0xc6, 0x39, 0xc0, 0x6b, 0x6e, 0x69, 0x6e, 0x3e, 0xc0, 0x05, 0xa3, 0x97, 0xa0, 0xb8, 0x7a, 0xa2,
+  0x87, 0x7b, 0x6e, 0xa3, 0xa8, 0xa2, 0x98, 0x55, 0x9d, 0x8a, 0x7e, 0x29, 0x43, 0x02, 0x41, 0x7b,
+  0x3d, 0x69, 0x33, 0x36, 0x7f, 0xc2, 0x14, 0x7a, 0x05, 0x6e, 0x7a, 0x05, 0xa2, 0x88, 0x0d, 0x7e,
+  0x0d, 0x05, 0x7a, 0xa3, 0x87, 0x15, 0x0d, 0x0a, 0x08, 0xc0, 0x05, 0xc0, 0x08, 0x0d, 0x55, 0x66,
+  0xa2, 0x87, 0x29, 0x1c, 0x3e, 0x39, 0x08, 0xc0, 0x56, 0x39, 0x08, 0xc0, 0x3e, 0xc0, 0x05, 0x15,
+  0x7f, 0x21, 0x1c, 0xc0, 0xa1, 0xa8, 0xa2, 0x97, 0xc0, 0x24, 0x29, 0x38, 0x66, 0x1c, 0x24, 0x69,
+  0x24, 0x29, 0xc0, 0x24, 0x29, 0xc1, 0x38, 0x24, 0xc0, 0x29, 0x7a, 0x24, 0x29, 0xc0, 0x24, 0xc1,
+  0x29, 0x24, 0x29, 0xc0, 0x2c, 0xc0, 0xa2, 0x88, 0x7f, 0x51, 0x00, 0x7a, 0x51, 0x38, 0xc0, 0x3b,
+  0xa2, 0x77, 0xa0, 0xa9, 0x05, 0x00, 0xa2, 0x88, 0x7a, 0xc0, 0x55, 0x0f, 0x14, 0x0f, 0x05, 0x0f,
+  0xc1, 0x05, 0x00, 0x0f, 0x08, 0x00, 0xc0, 0x38, 0x03, 0x08, 0x00, 0xc0, 0x3b, 0x6f, 0xa3, 0x87,
+  0x17, 0x14, 0x0f, 0xa2, 0x87, 0x7f, 0x66, 0x56, 0x1c, 0xc1, 0x26, 0xa2, 0x87, 0x55, 0x1c, 0x17,
+  0xc0, 0x24, 0x33, 0x24, 0x14, 0xc0, 0x69, 0x1c, 0x17, 0x00, 0x0f, 0xa2, 0x88, 0x17, 0xc0, 0x0f,
+  0x0d, 0x12, 0x0f, 0x14, 0x0f, 0xc0, 0x14, 0x0f, 0x14, 0x0f, 0x00, 0xc0, 0x1c, 0x24, 0x17, 0x0f,
+  0x08, 0x14, 0xc0, 0x1c, 0x2b, 0xc0, 0x6e, 0x2b, 0x30, 0x56, 0x30, 0x33, 0x23, 0xc0, 0x1c, 0xc0,
+  0x23, 0xc0, 0x17, 0x23, 0xc2, 0x2b, 0xc1, 0x6f, 0x2b, 0x23, 0x2b, 0x7a, 0x33, 0x2b, 0x1c, 0x28,
+  0x26, 0x1c, 0x2b, 0x28, 0x1c, 0x28, 0x23, 0x1c, 0x14, 0xc1, 0x56, 0xc2, 0x14, 0x19, 0x14, 0xc0,
+  0x23, 0xc0, 0x14, 0x1c, 0x28, 0x14, 0xa2, 0x78, 0x28, 0x23, 0x2b, 0x5b, 0x40, 0x6f, 0x2f, 0x7a,
+  0x28, 0x56, 0x52, 0x6e, 0x20, 0x6f, 0x1d, 0x56, 0x65, 0x18, 0x25, 0x62, 0x09, 0x56, 0xc0, 0x7b,
+  0x6e, 0x65, 0x0c, 0x04, 0x46, 0x5a, 0x5a, 0x76, 0xc0, 0x56, 0x5a, 0x7e, 0x31, 0x36, 0x2e, 0x5a,
+  0xc0, 0xfe, 0x13, 0xb4, 0xc0, 0x6e, 0x23, 0x28, 0xc0, 0x6b, 0x6e, 0xc8, 0x28, 0x2f, 0x34, 0xc0,
+  0x6e, 0xc0, 0x6e, 0x39, 0xc3, 0x6f, 0x39, 0x3e, 0x6f, 0xa1, 0xb7, 0xa2, 0xa9, 0x7e, 0x5a, 0xa2,
+  0xb8, 0x6e, 0x7e, 0xa2, 0x88, 0x9c, 0x78, 0x66, 0xa2, 0x98, 0x19, 0x9e, 0x68, 0x3a, 0x55, 0x3a,
+  0x76, 0x6e, 0x55, 0x7e, 0x7e, 0x0a, 0x05, 0xc1, 0x19, 0x41, 0x2e, 0x02, 0x05, 0xc0, 0x7e, 0x21,
+  0x1c, 0x9d, 0x89, 0x7e, 0xc0, 0x0d, 0x05, 0x3e, 0x0a, 0x3e, 0xc0, 0x0a, 0x0d, 0xc1, 0x0a, 0x3e,
+  0x0d, 0xc0, 0x05, 0x00, 0xc2, 0x0a, 0x14, 0x0d, 0x05, 0xc0, 0x65, 0x05, 0xa1, 0xa8, 0x6e, 0xc0,
+  0x1c, 0x7e, 0xa1, 0xa7, 0x6f, 0x24, 0xc0, 0x6e, 0x6b, 0x29, 0x24, 0x21, 0x24, 0xc0, 0xa2, 0x88,
+  0x65, 0x24, 0x29, 0x2c, 0xa2, 0x88, 0x2c, 0x24, 0xc0, 0x29, 0x24, 0xc0, 0x29, 0xc0, 0x15, 0x29,
+  0x00, 0x24, 0xc1, 0x38, 0x2c, 0xa2, 0x98, 0xc0, 0x45, 0xa2, 0x98, 0x03, 0x56, 0x38, 0x31, 0x3b,
+  0x03, 0x08, 0x00, 0xa2, 0x88, 0xa1, 0xa8, 0x56, 0x56, 0xc0, 0x56, 0x14, 0x0f, 0xc1, 0x66, 0x17,
+  0x03, 0x08, 0xa2, 0x88, 0x03, 0x4a, 0x3b, 0xc0, 0x0f, 0x3b, 0x38, 0x00, 0x03, 0x08, 0x0f, 0xc2,
+  0x17, 0xa2, 0x87, 0x6b, 0x56, 0x1c, 0xc0, 0x62, 0xa4, 0x87, 0xc0, 0x23, 0x6d, 0x24, 0x08, 0x12,
+  0x14, 0xc0, 0x1c, 0xc0, 0x17, 0x21, 0x14, 0x00, 0x17, 0x7f, 0x17, 0x6b, 0x08, 0x14, 0x1c, 0x17,
+  0x08, 0x00, 0x03, 0xc0, 0x0f, 0x14, 0x0f, 0xc1, 0x1c, 0x17, 0x1c, 0x0f, 0x00, 0x1c, 0x14, 0x23,
+  0x2b, 0xc0, 0x6e, 0x2b, 0xc0, 0x24, 0x2b, 0x23, 0x1c, 0x2b, 0x5a, 0x23, 0x28, 0x33, 0x26, 0x23,
+  0xc0, 0x59, 0x30, 0x7f, 0x28, 0x2b, 0x28, 0x1c, 0xc0, 0x23, 0x24, 0x2b, 0x1c, 0x2b, 0xc0, 0x28,
+  0x30, 0x2b, 0x1c, 0x23, 0xc0, 0x14, 0x0f, 0xc2, 0x5a, 0xc0, 0x00, 0xa2, 0x78, 0x19, 0x0f, 0xc0,
+  0xa2, 0x78, 0x14, 0xc1, 0x19, 0xc0, 0x20, 0xc1, 0x23, 0x28, 0x23, 0x46, 0x6e, 0x20, 0x28, 0xc0,
+  0x9d, 0x9a, 0x18, 0xc0, 0xa2, 0x98, 0x20, 0x42, 0x69, 0xa1, 0xa9, 0xa2, 0x78, 0x18, 0x51, 0x5a,
+  0x56, 0x7f, 0x04, 0xc0, 0x07, 0x09, 0x52, 0x45, 0x5a, 0x2a, 0xc0, 0x27, 0x66, 0x27, 0x39, 0x5a,
+  0x56, 0x55, 0xc0, 0x46, 0xfe, 0x13, 0xb3, 0x6b, 0x6e, 0x23, 0xc0, 0x28, 0x6f, 0xc0, 0x66, 0x34,
+  0xc5, 0x6e, 0xc0, 0x34, 0xc0, 0x39, 0xc3, 0x6b, 0x6e, 0x39, 0xc3, 0x6e, 0xa2, 0xa8, 0xa2, 0xb7,
+  0xa2, 0x88, 0x7e, 0xa1, 0xa9, 0xa2, 0x77, 0x56, 0x0a, 0x57, 0x7e, 0x7e, 0x9e, 0x69, 0x9d, 0x88,
+  0x7f, 0x69, 0x7e, 0xa1, 0xa9, 0x55, 0x33, 0x7b, 0x05, 0x7f, 0x69, 0x05, 0x0a, 0x02, 0x33, 0x2b,
+  0x2e, 0xc0, 0x3d, 0x05, 0xa2, 0x97, 0x6e, 0x0d, 0x6e, 0x0d, 0x12, 0x0d, 0x36, 0x0d, 0x51, 0x6e,
+  0x12, 0x15, 0x52, 0x05, 0x0d, 0x08, 0xc1, 0x05, 0x08, 0x0d, 0x39, 0xc0, 0x12, 0x15, 0x05, 0x0a,
+  0x0d, 0x52, 0x05, 0x0d, 0x1a, 0x15, 0xc1, 0xa1, 0xa8, 0x56, 0x6f, 0x6e, 0x24, 0xc0, 0x29, 0x24,
+  0xc1, 0xa2, 0x88, 0xc0, 0x65, 0x38, 0x24, 0xc0, 0xa3, 0x98, 0xc0, 0x29, 0x24, 0xc1, 0x29, 0x24,
+  0xc1, 0x2c, 0x29, 0xc0, 0x24, 0xc0, 0x7f, 0x2c, 0x00, 0x66, 0x2c, 0xc1, 0x38, 0xc0, 0x33, 0x38,
+  0x3b, 0x00, 0x7a, 0xa3, 0x88, 0xc0, 0x52, 0xc0, 0x03, 0x00, 0x6e, 0xc2, 0x0f, 0x7e, 0x55, 0xc0,
+  0x03, 0x00, 0x3b, 0x0f, 0x6e, 0x00, 0x5a, 0x38, 0x2c, 0x3b, 0x08, 0x03, 0x0f, 0x00, 0x14, 0x1c,
+  0x7e, 0x6b, 0x1c, 0xc1, 0x17, 0x24, 0x66, 0x17, 0xc2, 0x0f, 0x00, 0x0f, 0x1f, 0x1c, 0x17, 0x14,
+  0x69, 0x14, 0x6e, 0x17, 0x1f, 0x1c, 0x03, 0x0f, 0x24, 0x5a, 0x00, 0xc1, 0x0f, 0x1c, 0x17, 0x08,
+  0x14, 0x17, 0xc0, 0x1c, 0xc0, 0x0f, 0xc0, 0x17, 0x1c, 0x2b, 0xc2, 0x66, 0x1c, 0xa2, 0x88, 0x2b,
+  0x56, 0x6e, 0x2b, 0x7e, 0x23, 0x1c, 0x30, 0x2b, 0x28, 0x7b, 0xc0, 0x2b, 0xc2, 0x14, 0x1c, 0xc0,
+  0x14, 0x1c, 0xc0, 0x24, 0x2b, 0xc1, 0x23, 0x17, 0x1c, 0xc0, 0x14, 0xc0, 0x05, 0xc1, 0x6b, 0xc0,
+  0x3d, 0x0c, 0xc2, 0x56, 0x6e, 0x0c, 0xc1, 0x6e, 0xc0, 0x7b, 0x14, 0x6f, 0x23, 0xc0, 0x1b, 0x5e,
+  0xc0, 0x7e, 0x23, 0x1b, 0x1d, 0xc0, 0x20, 0x28, 0x42, 0x04, 0x20, 0x25, 0x09, 0x04, 0x5a, 0x5a,
+  0x66, 0x09, 0x3d, 0x56, 0x01, 0x39, 0x56, 0xc0, 0x69, 0xc0, 0x39, 0x31, 0x2a, 0xa1, 0xaa, 0x55,
+  0x2a, 0x57, 0x55, 0xc0, 0x6e, 0xfe, 0x13, 0xb4, 0xc4, 0x6e, 0xc1, 0x6b, 0x6e, 0xc0, 0x6e, 0x34,
+  0xc1, 0x39, 0xc3, 0x6b, 0x39, 0xc0, 0x6e, 0x6b, 0x39, 0xc1, 0x05, 0xc0, 0x7e, 0x05, 0xa1, 0xa8,
+  0xa4, 0xb7, 0x7e, 0xa2, 0x98, 0xc2, 0x9d, 0x7a, 0xa2, 0x97, 0xa2, 0xa7, 0x11, 0x9c, 0x59, 0x69,
+  0x3a, 0x7a, 0x3a, 0x02, 0x55, 0x7a, 0x3d, 0xa2, 0x98, 0x7e, 0x41, 0xc0, 0x02, 0x36, 0x3d, 0xc0,
+  0x55, 0xc0, 0x02, 0x05, 0x7a, 0x6e, 0xc2, 0x6e, 0x05, 0x36, 0x19, 0x0d, 0x55, 0xc0, 0x0d, 0x3e,
+  0x05, 0x0d, 0x05, 0xc0, 0xa2, 0x97, 0x08, 0xc0, 0x1c, 0x0d, 0x05, 0x65, 0x7e, 0x36, 0x05, 0x0d,
+  0xc0, 0x05, 0x3e, 0x12, 0x7f, 0x15, 0x66, 0xa2, 0x98, 0x1c, 0x21, 0x7e, 0x24, 0x15, 0x21, 0xc1,
+  0xa1, 0xa9, 0x7e, 0x55, 0x55, 0x24, 0x15, 0x24, 0xa3, 0x98, 0x55, 0x6b, 0x2c, 0x29, 0x1c, 0x24,
+  0x33, 0x24, 0xa2, 0x77, 0x7f, 0x24, 0x29, 0x24, 0xc0, 0x29, 0x2c, 0x00, 0x7a, 0x24, 0xc0, 0x29,
+  0x2c, 0xc0, 0x27, 0x33, 0x38, 0x3b, 0xa2, 0x88, 0x7e, 0x55, 0x0f, 0xc1, 0x59, 0xc0, 0x00, 0xc0,
+  0x05, 0x0f, 0xc0, 0x00, 0xc0, 0x2c, 0x38, 0xc0, 0x00, 0xc0, 0x38, 0xc0, 0x3b, 0x33, 0x3b, 0x00,
+  0x03, 0x08, 0xc0, 0x0f, 0x17, 0xa2, 0x87, 0x67, 0x59, 0x17, 0xc0, 0x1c, 0xc0, 0x17, 0x00, 0x05,
+  0x0f, 0x1c, 0xc0, 0x56, 0x0f, 0x17, 0x69, 0x0f, 0x14, 0x17, 0xc0, 0x14, 0x1c, 0x17, 0x14, 0x0f,
+  0xc0, 0x14, 0xc0, 0x0f, 0xc0, 0x5a, 0x14, 0xc0, 0x69, 0x17, 0xc0, 0x08, 0x1c, 0x14, 0x08, 0x14,
+  0x0f, 0x17, 0xa2, 0x88, 0x6e, 0xc0, 0x2b, 0xc0, 0x7e, 0x2b, 0x30, 0x2b, 0x1c, 0x0f, 0x1c, 0x33,
+  0x30, 0x2b, 0x30, 0x26, 0x2b, 0xa2, 0x88, 0x66, 0x45, 0xc1, 0x66, 0x0f, 0x1c, 0xc2, 0x2b, 0x24,
+  0x2b, 0xc0, 0x1c, 0x14, 0xc0, 0x1c, 0x2b, 0x0f, 0xc0, 0x56, 0x05, 0x0c, 0x07, 0x00, 0x07, 0x0c,
+  0x56, 0x6e, 0x04, 0xc0, 0x09, 0x0c, 0xc0, 0x6b, 0x09, 0x0c, 0x13, 0x6d, 0x7f, 0xc0, 0x66, 0x14,
+  0x5b, 0x20, 0x23, 0x1b, 0xa2, 0x77, 0x79, 0x1b, 0x20, 0x69, 0x14, 0xc0, 0x19, 0x09, 0x04, 0x0c,
+  0xc0, 0x04, 0x56, 0x04, 0x59, 0x56, 0xc0, 0x6b, 0xc1, 0x66, 0x32, 0x34, 0x69, 0x3c, 0x41, 0x5a,
+  0xc0, 0x56, 0x45, 0xa2, 0x98, 0x34, 0xfe, 0x13, 0xb4, 0xc1, 0x6e, 0x23, 0x28, 0x6b, 0xc0, 0x28,
+  0xc1, 0x6f, 0x6e, 0xc1, 0x34, 0x39, 0x6b, 0x39, 0x6f, 0x39, 0x00, 0xc0, 0x39, 0x05, 0x69, 0x39,
+  0xc1, 0x05, 0xc0, 0xa2, 0x97, 0xa2, 0xa7, 0x7b, 0x7e, 0xa2, 0x98, 0xa2, 0x98, 0x69, 0x9e, 0x68,
+  0x3a, 0x32, 0xa3, 0xa7, 0x21, 0x9d, 0x6a, 0x9e, 0x68, 0x75, 0xa1, 0xa9, 0xa2, 0x87, 0xc0, 0x3a,
+  0x59, 0xa0, 0xa9, 0x7a, 0xa3, 0x88, 0x21, 0x9d, 0x89, 0x3d, 0xc0, 0x55, 0x7b, 0xc0, 0x5d, 0x2e,
+  0x3d, 0x02, 0x05, 0x3d, 0xc1, 0x05, 0x59, 0x3d, 0x05, 0xa2, 0x87, 0x66, 0x55, 0x56, 0x05, 0x65,
+  0x05, 0x19, 0x3e, 0x36, 0x0d, 0xc3, 0x36, 0xc0, 0x39, 0x3d, 0x00, 0x05, 0x0d, 0xc0, 0x05, 0x7a,
+  0xa3, 0x98, 0x59, 0x66, 0x6b, 0x7a, 0xa2, 0x87, 0x6b, 0x50, 0x15, 0x21, 0xc0, 0x19, 0x21, 0x79,
+  0x24, 0x15, 0x0d, 0x24, 0x6e, 0x2c, 0x7f, 0x5a, 0x69, 0x24, 0xc0, 0x29, 0xc0, 0x24, 0x2c, 0x29,
+  0x24, 0xc1, 0x21, 0x24, 0x2c, 0xc1, 0x21, 0x24, 0x29, 0x24, 0xc0, 0x2c, 0xc0, 0x38, 0x7e, 0x7f,
+  0x69, 0xc0, 0x00, 0x0f, 0xc0, 0x56, 0x6d, 0xc0, 0x0f, 0x00, 0x08, 0x0f, 0x3b, 0x69, 0x38, 0xc0,
+  0x2c, 0x31, 0xc0, 0x38, 0x2c, 0xc0, 0x00, 0x31, 0x08, 0x05, 0x00, 0x08, 0x00, 0xa2, 0x98, 0x6e,
+  0x17, 0xc0, 0x5a, 0x17, 0x1c, 0xc0, 0x14, 0x00, 0x0f, 0x07, 0x14, 0xa2, 0x87, 0x0f, 0xc0, 0x1c,
+  0x14, 0x08, 0x0f, 0xc0, 0x08, 0x1c, 0xc0, 0x00, 0x17, 0xa2, 0x87, 0x1c, 0x0f, 0x05, 0x14, 0x0f,
+  0x00, 0x05, 0x0f, 0x14, 0x0f, 0x65, 0x17, 0xa2, 0x78, 0x00, 0x08, 0x24, 0x1c, 0x7f, 0x6e, 0xc1,
+  0x24, 0x7f, 0xc0, 0x24, 0x2b, 0x30, 0x14, 0xc0, 0x1c, 0xc0, 0x30, 0x7e, 0x2b, 0xc0, 0x7f, 0x30,
+  0x2b, 0xc0, 0x28, 0x17, 0x14, 0x17, 0x2b, 0x1c, 0xc0, 0x2b, 0x24, 0xc0, 0x28, 0x1c, 0xc0, 0x5a,
+  0x14, 0x28, 0x66, 0x00, 0x07, 0x00, 0x6f, 0xc0, 0x00, 0x5b, 0x0c, 0x04, 0xc2, 0x0c, 0x07, 0x0c,
+  0x6e, 0x56, 0x04, 0xa2, 0x88, 0x09, 0x11, 0x19, 0x43, 0x18, 0xa2, 0x87, 0x18, 0xc0, 0x7e, 0x19,
+  0x28, 0x1c, 0x14, 0x19, 0x14, 0xc1, 0x05, 0x56, 0x07, 0xc0, 0x3d, 0x5b, 0x65, 0x6b, 0x09, 0x42,
+  0xc0, 0x66, 0x69, 0xc0, 0x5a, 0x66, 0x7a, 0x2d, 0x2a, 0x46, 0x7a, 0x56, 0x5a, 0xc0, 0x1f, 0x9f,
+  0xb9, 0xfe, 0x13, 0xb4, 0xc3, 0x6e, 0x6b, 0xc0, 0x28, 0xc0, 0x6f, 0x6e, 0xc2, 0x34, 0x39, 0xc1,
+  0x6f, 0xc0, 0x39, 0xc1, 0x6e, 0x39, 0xc0, 0x3e, 0x39, 0x05, 0x6e, 0x7a, 0xa5, 0xc7, 0x7f, 0xc0,
+  0xa2, 0x86, 0x77, 0xa2, 0x98, 0x9c, 0x59, 0x9d, 0x79, 0xa3, 0xb7, 0xa2, 0xa8, 0x9f, 0x59, 0x9c,
+  0x78, 0x7a, 0x7f, 0x7e, 0xc1, 0x7a, 0x3a, 0x02, 0xa1, 0xb9, 0x59, 0x56, 0x3d, 0x56, 0x6d, 0xc0,
+  0x3a, 0x65, 0x5a, 0x2e, 0x33, 0x7a, 0xc0, 0x3d, 0xc1, 0x36, 0x66, 0x02, 0x0d, 0x6e, 0x62, 0x3d,
+  0x36, 0x7b, 0x69, 0x0d, 0x7e, 0x05, 0x36, 0xc0, 0x05, 0xc0, 0x0d, 0x55, 0x36, 0xc0, 0x00, 0x08,
+  0x05, 0xc0, 0x12, 0x0d, 0x39, 0x0d, 0xa1, 0xa9, 0x1c, 0x19, 0x7e, 0x7a, 0xc0, 0x21, 0x15, 0x21,
+  0xc0, 0x1c, 0x5e, 0x12, 0xc0, 0x15, 0x1c, 0xc0, 0x15, 0x24, 0x7e, 0xa2, 0x88, 0x55, 0x56, 0x24,
+  0xc0, 0x29, 0x24, 0xa2, 0x88, 0x2c, 0x24, 0x29, 0x2c, 0x24, 0x21, 0xc0, 0x29, 0x24, 0x1c, 0xc0,
+  0x24, 0xc1, 0x29, 0x2c, 0x31, 0x7b, 0x7e, 0xc0, 0x5e, 0x00, 0xc0, 0x03, 0x6e, 0x3b, 0xc0, 0x03,
+  0x6f, 0x9d, 0x98, 0x00, 0x08, 0x3b, 0x2c, 0x6b, 0x38, 0xc2, 0x2c, 0xc0, 0x38, 0x0f, 0xc1, 0x00,
+  0xc0, 0x05, 0x08, 0xc0, 0x0f, 0x6e, 0xc2, 0x7a, 0xa2, 0x88, 0x17, 0x14, 0x7e, 0x08, 0x00, 0x6f,
+  0x00, 0x14, 0x1c, 0x0f, 0x00, 0x08, 0x0f, 0x08, 0x14, 0x1c, 0x17, 0x7e, 0x6e, 0x2b, 0x0f, 0x03,
+  0x08, 0x0f, 0xc0, 0x05, 0x0f, 0x0c, 0x05, 0x0f, 0x14, 0x17, 0x1c, 0x1f, 0x5e, 0x1c, 0x7b, 0x24,
+  0x6f, 0x2b, 0x7e, 0x7e, 0x52, 0x2b, 0x21, 0x67, 0x1c, 0xc2, 0x24, 0xc0, 0x2b, 0xc4, 0x17, 0x08,
+  0x14, 0x2b, 0x24, 0x17, 0x1c, 0xc0, 0x24, 0x1c, 0x14, 0xc0, 0x0f, 0x6d, 0x1c, 0xc0, 0x0f, 0x00,
+  0xc0, 0x0c, 0xc0, 0x66, 0x00, 0x5b, 0xc0, 0x0c, 0x07, 0x04, 0xc1, 0x69, 0x0c, 0xa2, 0x77, 0x04,
+  0xc0, 0x5a, 0x7e, 0xa2, 0x88, 0x79, 0x53, 0x1d, 0x66, 0x45, 0x18, 0x14, 0xc0, 0x19, 0x6b, 0x19,
+  0x14, 0x0f, 0x0c, 0xc1, 0x07, 0x3d, 0x04, 0x01, 0x65, 0x04, 0x09, 0x01, 0x66, 0x56, 0x55, 0xc0,
+  0x7e, 0x5a, 0x76, 0x2d, 0x2a, 0x55, 0x2a, 0x52, 0x5a, 0x45, 0x7b, 0x7a, 0x1a, 0xfe, 0x13, 0xb3,
+  0x6b, 0xc1, 0x6e, 0xc3, 0x6f, 0xc0, 0x6e, 0xc0, 0x34, 0xc0, 0x39, 0xc8, 0x6b, 0x6d, 0x39, 0xc0,
+  0x6f, 0x3e, 0xa2, 0xa8, 0xa4, 0x97, 0x56, 0xa0, 0xa9, 0xa3, 0xa7, 0x42, 0xa2, 0x87, 0x7f, 0x01,
+  0xa2, 0xa6, 0xa3, 0x88, 0x9b, 0x6a, 0x9d, 0x7a, 0xa2, 0x97, 0x37, 0x75, 0x6b, 0x5a, 0x7e, 0x69,
+  0x7f, 0xa0, 0xa8, 0x19, 0xc0, 0x9d, 0x89, 0x33, 0x62, 0x2e, 0x3a, 0x51, 0x2e, 0xc0, 0x3a, 0x2e,
+  0x7e, 0x7f, 0x36, 0x05, 0x6e, 0x62, 0x05, 0x0d, 0x6e, 0x36, 0x67, 0x33, 0x36, 0x05, 0x0a, 0x0d,
+  0x05, 0x3d, 0x36, 0xc0, 0x7a, 0x12, 0x08, 0x36, 0x3d, 0x08, 0x0d, 0x55, 0x05, 0x7f, 0x0d, 0xc1,
+  0x7a, 0x6f, 0x19, 0x7e, 0x7a, 0x55, 0x0d, 0xa2, 0x78, 0x1c, 0xc0, 0x19, 0x12, 0xc0, 0x0a, 0x21,
+  0xc0, 0x76, 0x10, 0xa4, 0x87, 0x7b, 0x55, 0x31, 0x24, 0xc0, 0x6e, 0xc1, 0x2c, 0x24, 0x29, 0x7f,
+  0x2c, 0x29, 0x24, 0x21, 0x29, 0x24, 0x6f, 0x21, 0x24, 0x29, 0x24, 0x29, 0x2c, 0x31, 0xc0, 0x7f,
+  0xc0, 0x3b, 0xc0, 0x38, 0x00, 0xa2, 0x88, 0x3b, 0x24, 0x3b, 0x7a, 0x46, 0x3b, 0x00, 0x2c, 0x24,
+  0x2c, 0x38, 0xc1, 0x2c, 0xc0, 0x31, 0xa2, 0x88, 0x7a, 0x05, 0x3b, 0x38, 0x00, 0xc0, 0x14, 0x66,
+  0x05, 0x6b, 0xc0, 0xa2, 0x97, 0x0f, 0x6d, 0xa2, 0x98, 0x0d, 0x7b, 0xa2, 0x88, 0x17, 0x14, 0x0f,
+  0x17, 0x1c, 0x17, 0x51, 0x05, 0x08, 0x14, 0x1c, 0x0d, 0x1c, 0xa1, 0xa9, 0x24, 0x1c, 0x17, 0x03,
+  0x6b, 0x0c, 0x14, 0x0f, 0xc0, 0x00, 0x0f, 0xc0, 0x14, 0x0f, 0x17, 0x1c, 0x2b, 0xc0, 0x1c, 0xc1,
+  0x2b, 0xc0, 0x7e, 0xc1, 0x1c, 0x7b, 0xc0, 0x17, 0x1c, 0xc1, 0x24, 0x1c, 0x6f, 0x1c, 0xc0, 0x6e,
+  0x28, 0x26, 0x17, 0x5e, 0x2b, 0x24, 0x1c, 0x24, 0xc0, 0x2b, 0x28, 0x14, 0xc0, 0x05, 0x0c, 0x14,
+  0x0d, 0x08, 0x00, 0x5b, 0x7a, 0x14, 0x0c, 0x07, 0x0c, 0x55, 0x04, 0x0c, 0x04, 0xc0, 0x56, 0x6e,
+  0x04, 0x07, 0x3d, 0x04, 0xc0, 0x01, 0x7e, 0xa2, 0x98, 0xc0, 0x52, 0x5a, 0x66, 0x10, 0x0c, 0x0f,
+  0x13, 0x6d, 0xc0, 0x14, 0xc0, 0x0c, 0x04, 0xc2, 0x59, 0x66, 0x04, 0xc1, 0x01, 0x3c, 0x56, 0x69,
+  0x6f, 0x35, 0x30, 0x25, 0x2d, 0x5a, 0x25, 0x2d, 0x25, 0x46, 0x56, 0x59, 0x7a, 0x1a, 0xc0, 0xfe,
+  0x13, 0x93, 0x6e, 0x6b, 0x6e, 0x23, 0xc0, 0x28, 0x23, 0x6f, 0x6e, 0xc1, 0x6e, 0x34, 0xc0, 0x39,
+  0xc1, 0x6f, 0x39, 0xc4, 0x05, 0xc0, 0x39, 0xc0, 0x05, 0xa1, 0xa8, 0xa4, 0xa7, 0xa2, 0x88, 0x9d,
+  0x89, 0x7f, 0xa2, 0xa7, 0x6e, 0x41, 0xa4, 0x97, 0x77, 0x69, 0x5f, 0x99, 0x6a, 0x55, 0xa3, 0x98,
+  0x79, 0x56, 0x7b, 0x34, 0x37, 0x7a, 0xa2, 0x97, 0x56, 0xa2, 0x98, 0x0a, 0x9c, 0x89, 0x5e, 0x66,
+  0xc2, 0x7e, 0x3a, 0x66, 0xc0, 0xa2, 0x97, 0x69, 0x56, 0x02, 0x05, 0xc3, 0x2e, 0x35, 0x2e, 0xc0,
+  0x7f, 0x36, 0xc0, 0x02, 0x3d, 0x36, 0xc0, 0x05, 0xa2, 0x98, 0x55, 0x02, 0x61, 0xa2, 0x98, 0x6d,
+  0x3e, 0x05, 0x3d, 0x7a, 0x0d, 0x08, 0x7e, 0xa2, 0x88, 0x19, 0xc0, 0x1c, 0xc0, 0x0d, 0x21, 0xc0,
+  0x19, 0x0a, 0x19, 0x0d, 0x05, 0x19, 0x1c, 0x0d, 0x24, 0xa2, 0x88, 0x65, 0xc0, 0x5a, 0xc0, 0x21,
+  0x29, 0x7e, 0x38, 0x29, 0x24, 0x29, 0xc0, 0x24, 0xc0, 0x29, 0x6b, 0x24, 0xc2, 0x29, 0xc1, 0x31,
+  0x38, 0x31, 0x2c, 0xa2, 0x98, 0xc0, 0x51, 0xa2, 0x78, 0x38, 0x00, 0xc0, 0x9d, 0x99, 0x6f, 0x00,
+  0x66, 0x33, 0x38, 0x79, 0x2c, 0x24, 0x3b, 0x38, 0xc3, 0x2c, 0xc0, 0x38, 0xc1, 0x31, 0x3b, 0x00,
+  0xa3, 0x98, 0x66, 0x56, 0x6e, 0xc1, 0x00, 0x1c, 0x7e, 0x41, 0x1c, 0x14, 0x00, 0x17, 0x1c, 0xc0,
+  0x14, 0xc0, 0x17, 0x0f, 0x00, 0x7e, 0xc0, 0x1c, 0xc1, 0x6e, 0x14, 0x55, 0x00, 0xc0, 0x6f, 0xc0,
+  0x0f, 0x05, 0x0f, 0xc1, 0x08, 0x17, 0xc0, 0x1c, 0xc0, 0x7f, 0x5a, 0x66, 0x7a, 0x24, 0x2b, 0x7a,
+  0x6e, 0x2b, 0x17, 0xc0, 0xa3, 0x87, 0x6b, 0x17, 0x1c, 0x2b, 0x24, 0x2b, 0x14, 0x17, 0x1c, 0x14,
+  0x17, 0xc1, 0x1c, 0x24, 0xc1, 0x30, 0x2b, 0x28, 0x14, 0xc0, 0x0f, 0x14, 0x0c, 0x00, 0x0c, 0xc0,
+  0x55, 0xc0, 0x6b, 0x3d, 0xc0, 0x0c, 0xc0, 0x66, 0x04, 0xc1, 0x55, 0x6f, 0x66, 0xa2, 0x88, 0x04,
+  0x59, 0x04, 0xc0, 0x01, 0x04, 0xa3, 0x98, 0x10, 0x01, 0xc0, 0x04, 0xc0, 0x07, 0xa2, 0x78, 0x0c,
+  0xc3, 0x04, 0xc0, 0x3d, 0x04, 0xc0, 0x35, 0x01, 0x04, 0xc0, 0x01, 0x56, 0x66, 0xc0, 0x69, 0x6e,
+  0x35, 0x2d, 0x2a, 0x66, 0x2d, 0x3c, 0x25, 0x45, 0x66, 0x0b, 0x7f, 0x56, 0x6e, 0x13, 0xfe, 0x13,
+  0x93, 0xc0, 0x6e, 0x6f, 0xc0, 0x66, 0x28, 0x23, 0x6f, 0x28, 0xc0, 0x6f, 0xc1, 0x6e, 0xc4, 0x6e,
+  0x34, 0x39, 0xa2, 0x78, 0x66, 0xc0, 0x39, 0x05, 0x0a, 0xa0, 0xa8, 0xa4, 0xa7, 0x7e, 0x5a, 0xc1,
+  0x3f, 0xa3, 0xb8, 0x9d, 0x7a, 0x7d, 0x21, 0x6e, 0x9c, 0x5a, 0x9d, 0x79, 0x7d, 0x66, 0x7e, 0x20,
+  0x5a, 0xa1, 0xa9, 0x79, 0x6b, 0x09, 0xa2, 0x87, 0x66, 0x55, 0x52, 0x55, 0xc0, 0x2b, 0xc1, 0x7a,
+  0x02, 0x7a, 0x66, 0x05, 0xc0, 0x55, 0x02, 0x05, 0x65, 0x05, 0x02, 0x2e, 0xc1, 0x35, 0xc0, 0x2e,
+  0x36, 0xc0, 0x6b, 0x00, 0x36, 0xc0, 0x05, 0x69, 0xc0, 0x36, 0x05, 0x7a, 0x3e, 0xc0, 0x36, 0x6e,
+  0x05, 0x7e, 0xc0, 0x21, 0x7a, 0x55, 0x0d, 0x6f, 0x21, 0x24, 0x0a, 0x19, 0x66, 0x0a, 0x7e, 0x0a,
+  0xc0, 0xa1, 0xa9, 0x0d, 0x19, 0xa2, 0x98, 0x24, 0xc1, 0x6e, 0x30, 0x24, 0xc0, 0x7f, 0xa3, 0x87,
+  0x56, 0x24, 0x29, 0xc5, 0x24, 0xc0, 0x69, 0xa3, 0x99, 0x51, 0x24, 0xc0, 0x29, 0x2c, 0x6f, 0xa1,
+  0xa8, 0x00, 0x65, 0x33, 0x7e, 0x00, 0x34, 0x52, 0x24, 0x38, 0xc0, 0x33, 0x38, 0x69, 0x24, 0x2c,
+  0x05, 0x3d, 0x38, 0xc0, 0x00, 0x38, 0xc2, 0x33, 0x38, 0xc0, 0x00, 0x7f, 0x69, 0xa2, 0x88, 0x7a,
+  0xc0, 0x5e, 0x00, 0x38, 0x1c, 0x76, 0x5f, 0x7d, 0x9c, 0x8a, 0x3d, 0xa2, 0x98, 0xc2, 0x1c, 0x66,
+  0x14, 0xc0, 0x0f, 0xc0, 0xa2, 0x77, 0x1c, 0x14, 0x0f, 0x08, 0x14, 0xc1, 0x05, 0x0f, 0x0a, 0x0f,
+  0x56, 0x0f, 0x14, 0x17, 0x14, 0x17, 0x1c, 0xc1, 0x17, 0x1c, 0x23, 0x24, 0x6f, 0xc0, 0x76, 0x24,
+  0x1c, 0xc0, 0x30, 0x24, 0x14, 0x1c, 0xc0, 0x24, 0x1c, 0x14, 0x23, 0x7a, 0x17, 0x1c, 0x23, 0x1c,
+  0x7f, 0xc0, 0x1c, 0x6f, 0x1c, 0xc0, 0x55, 0x14, 0xc2, 0x3d, 0x38, 0x3d, 0x00, 0x3d, 0xc0, 0x56,
+  0xc0, 0x3d, 0xc0, 0x6b, 0xc1, 0x35, 0x04, 0x5a, 0x66, 0x35, 0x01, 0xc1, 0x3c, 0x01, 0x04, 0x6e,
+  0xc0, 0x01, 0x3c, 0x01, 0xa1, 0xa8, 0x04, 0x0c, 0xc0, 0x09, 0x0c, 0x09, 0x6b, 0x09, 0x04, 0x3c,
+  0xc0, 0x01, 0x3c, 0xc0, 0x04, 0xc0, 0x10, 0x56, 0x55, 0x65, 0x6b, 0x55, 0xc2, 0x5a, 0x25, 0xa1,
+  0xa8, 0x2d, 0x9e, 0x68, 0xc0, 0x56, 0x7a, 0x6b, 0x6e, 0x15, 0x16, 0xfe, 0x13, 0x93, 0xc0, 0x6f,
+  0xc3, 0x6f, 0x7e, 0x5a, 0x65, 0x34, 0x6e, 0x34, 0xc0, 0x39, 0xc7, 0x6e, 0x6b, 0xc0, 0x3e, 0xa1,
+  0xa9, 0xa2, 0x97, 0xa2, 0x87, 0x7b, 0x5a, 0xc0, 0x56, 0x34, 0xa1, 0xa8, 0x5b, 0xa1, 0xb8, 0x7e,
+  0x46, 0x2c, 0x66, 0x7e, 0x41, 0x6e, 0x27, 0x45, 0x27, 0xa1, 0xa7, 0x37, 0xc0, 0xa3, 0xa8, 0x65,
+  0x56, 0xc0, 0x2b, 0xc0, 0x66, 0xa2, 0x87, 0x66, 0x2b, 0xa1, 0xa9, 0xa2, 0x97, 0x56, 0x66, 0x3d,
+  0x05, 0x7a, 0x05, 0xc0, 0x55, 0x3d, 0x2e, 0x3d, 0x2e, 0x33, 0x6b, 0x26, 0x36, 0x2e, 0x36, 0x3d,
+  0x36, 0xc0, 0x66, 0x36, 0x7e, 0x36, 0xc0, 0x05, 0x36, 0xc1, 0x6e, 0x05, 0x0a, 0x19, 0x69, 0x7a,
+  0x19, 0x0a, 0xc0, 0xa2, 0x98, 0xc0, 0x0a, 0xa1, 0xa9, 0x0d, 0x21, 0x15, 0x0d, 0x21, 0x7a, 0x1c,
+  0x21, 0xa1, 0xa9, 0x69, 0x45, 0x1c, 0x21, 0xc0, 0x24, 0xc0, 0xa2, 0x88, 0x7e, 0x38, 0x24, 0x6e,
+  0x24, 0x29, 0xc0, 0x24, 0x29, 0x24, 0x29, 0xc0, 0x24, 0x2c, 0x24, 0xc0, 0x29, 0x33, 0x2c, 0x7f,
+  0x00, 0x2c, 0xc0, 0x6e, 0x2c, 0x3b, 0x2c, 0x29, 0x2c, 0x33, 0x5a, 0xc0, 0x24, 0x2c, 0xc0, 0x00,
+  0x31, 0xc0, 0x33, 0xc0, 0x38, 0x6e, 0x00, 0x38, 0x33, 0xc0, 0x00, 0x7f, 0xc0, 0x00, 0x3b, 0xa4,
+  0x87, 0x7e, 0x42, 0x1c, 0x0f, 0xc0, 0x14, 0x0f, 0x1c, 0xc0, 0x0f, 0x1c, 0xc0, 0x66, 0x14, 0x65,
+  0x0f, 0x08, 0x14, 0xc0, 0x0f, 0x14, 0x17, 0x08, 0x14, 0x0f, 0x14, 0x0f, 0x00, 0x08, 0xa2, 0x78,
+  0x17, 0x0f, 0xc0, 0x00, 0x0f, 0x14, 0x08, 0x17, 0x1c, 0x0f, 0x1c, 0x17, 0x14, 0xa2, 0x98, 0xc0,
+  0x24, 0x6f, 0x2b, 0xc2, 0x1c, 0x0f, 0x17, 0x1c, 0x7b, 0x1c, 0x6b, 0x24, 0x66, 0x2b, 0xc1, 0x30,
+  0x2b, 0x1f, 0x2b, 0x1c, 0xc3, 0x14, 0xc0, 0x56, 0x14, 0xa2, 0x88, 0x14, 0x3d, 0x67, 0x3d, 0xc1,
+  0x5a, 0x38, 0x3d, 0x0c, 0x56, 0x3a, 0x3d, 0x3f, 0x5a, 0x69, 0x5b, 0x66, 0x35, 0x6f, 0xc2, 0x7e,
+  0xc0, 0x3a, 0x01, 0xc0, 0x0c, 0x09, 0x0c, 0x7f, 0x09, 0x04, 0xc1, 0x09, 0x01, 0xc0, 0x35, 0x01,
+  0xc2, 0x3c, 0x01, 0xc0, 0x5a, 0x39, 0x34, 0x5a, 0x65, 0xc0, 0x56, 0xc0, 0x6e, 0x7e, 0x22, 0x1d,
+  0x11, 0x16, 0x25, 0x1d, 0x5e, 0x72, 0x1d, 0x25, 0xfe, 0x13, 0x93, 0xc1, 0x6f, 0xc1, 0x6e, 0x6b,
+  0x6e, 0xc3, 0x6e, 0x34, 0x39, 0xc8, 0x6f, 0x6e, 0x05, 0xa2, 0x87, 0xa2, 0xa8, 0x56, 0x69, 0xa2,
+  0x98, 0x24, 0x5a, 0x2c, 0x7a, 0x59, 0xa4, 0xa7, 0xa0, 0x9a, 0x2c, 0x55, 0x56, 0xa1, 0xa9, 0x24,
+  0x59, 0x76, 0x1a, 0x1d, 0xa2, 0xa8, 0xc0, 0x7a, 0x6e, 0x37, 0x65, 0x37, 0x75, 0x2b, 0x66, 0x2e,
+  0x2b, 0xc0, 0x2e, 0xa2, 0x97, 0x6b, 0x6e, 0x51, 0xa1, 0xa9, 0xa2, 0x78, 0x05, 0x0a, 0x36, 0x2e,
+  0xc0, 0x6b, 0x2e, 0x2b, 0x26, 0x2e, 0x6e, 0x26, 0x2e, 0xc0, 0x7f, 0x36, 0xc0, 0x05, 0x7e, 0x05,
+  0x36, 0x3d, 0x2e, 0x36, 0x6f, 0x36, 0x05, 0x19, 0x0d, 0x05, 0x0a, 0x7b, 0x19, 0x0a, 0x0d, 0xc0,
+  0x6e, 0x7b, 0x0d, 0x7e, 0xc0, 0x12, 0x7f, 0x7a, 0x6e, 0xc0, 0x7f, 0x66, 0x0d, 0x21, 0xc0, 0x19,
+  0x29, 0x7a, 0x38, 0xc0, 0x24, 0x66, 0x24, 0x29, 0x24, 0xc1, 0x29, 0xc0, 0x24, 0xa2, 0x87, 0x38,
+  0x24, 0xc0, 0x29, 0xc1, 0x31, 0xc0, 0xa1, 0xaa, 0x2c, 0x24, 0x2c, 0xc2, 0x38, 0xc0, 0x24, 0xc2,
+  0x33, 0x2c, 0x7f, 0x6e, 0x3b, 0x38, 0xc1, 0x00, 0x38, 0xc0, 0x31, 0x38, 0x00, 0x7f, 0x00, 0xc1,
+  0xa1, 0xa9, 0x6e, 0x55, 0x6f, 0x0f, 0x59, 0x00, 0xc0, 0xa2, 0x87, 0x7a, 0x08, 0xa2, 0x88, 0x6e,
+  0x14, 0x38, 0x0f, 0x0a, 0x0f, 0xa2, 0x97, 0x0f, 0x00, 0xc0, 0x05, 0x14, 0x08, 0x66, 0x05, 0x00,
+  0x05, 0xa2, 0x88, 0xc0, 0x17, 0x14, 0x05, 0xc0, 0x14, 0x00, 0x05, 0x1c, 0xc0, 0x14, 0xa1, 0xa9,
+  0x1c, 0x0f, 0x1c, 0xc4, 0x7f, 0x26, 0x17, 0xc0, 0xa2, 0x87, 0x2b, 0xc0, 0x24, 0xc0, 0x2b, 0x24,
+  0x6f, 0x24, 0x21, 0x1c, 0xc1, 0x14, 0x17, 0x1c, 0x0d, 0x1c, 0x46, 0x0f, 0x05, 0x6b, 0x14, 0x08,
+  0x0f, 0x00, 0x5a, 0x38, 0xa2, 0x78, 0x62, 0x59, 0x3d, 0x7b, 0x5a, 0x35, 0xc0, 0x04, 0x5a, 0x35,
+  0x6e, 0x56, 0x6b, 0x7a, 0x01, 0x3c, 0xc1, 0x01, 0x04, 0x35, 0x01, 0x04, 0xc0, 0x0c, 0x6f, 0x11,
+  0x04, 0xc2, 0x01, 0xc1, 0x3c, 0x04, 0x3c, 0x35, 0x01, 0xc0, 0x39, 0xc0, 0x66, 0x39, 0xc0, 0x51,
+  0x66, 0x7e, 0x5e, 0x56, 0x56, 0xc0, 0x7a, 0x25, 0x1d, 0x2a, 0xa0, 0xa9, 0x25, 0x1a, 0x1d, 0x22,
+  0x41, 0xfe, 0x13, 0xb4, 0x69, 0x23, 0xc2, 0x6e, 0x6b, 0x6e, 0xc3, 0x6e, 0x34, 0xc0, 0x39, 0xc4,
+  0x6b, 0x39, 0x6e, 0x39, 0xa2, 0x78, 0x6e, 0xa0, 0xa8, 0xa3, 0x98, 0x56, 0x66, 0x7e, 0x42, 0x6e,
+  0x7d, 0x29, 0x2c, 0xa2, 0xa7, 0x7f, 0x24, 0x65, 0xc0, 0x4a, 0x55, 0x21, 0x79, 0x2c, 0xa0, 0xa8,
+  0xc0, 0x7e, 0x7f, 0x32, 0x5a, 0x69, 0x7a, 0x7a, 0xc1, 0x2b, 0xc1, 0x2e, 0x7e, 0x7f, 0x59, 0x05,
+  0xc0, 0x7e, 0x5a, 0x41, 0x7b, 0x2b, 0x2e, 0x3a, 0x2b, 0x66, 0x7a, 0x3d, 0x3a, 0x3d, 0x3a, 0x2b,
+  0x2e, 0x3d, 0x79, 0x0d, 0x6e, 0x05, 0x3d, 0x3a, 0x3d, 0x36, 0x6f, 0x36, 0x02, 0x0d, 0x0a, 0xc0,
+  0x7b, 0x5a, 0x05, 0x0a, 0x05, 0xc2, 0xa2, 0x98, 0x66, 0x0d, 0x7e, 0x6f, 0xc0, 0x7a, 0xa3, 0x88,
+  0x21, 0x12, 0x1c, 0x21, 0x15, 0x21, 0x7e, 0x7e, 0x6b, 0x29, 0x21, 0x1c, 0x21, 0x29, 0x24, 0x29,
+  0xc0, 0x24, 0x29, 0xc0, 0x7a, 0x29, 0xc3, 0x24, 0x31, 0x2c, 0x24, 0xc1, 0x6f, 0x24, 0xc0, 0x31,
+  0x7b, 0x2c, 0x29, 0x24, 0xc0, 0x29, 0x7b, 0x31, 0xc0, 0xa2, 0x98, 0x6b, 0x38, 0x31, 0x3b, 0x0f,
+  0x59, 0x38, 0xc1, 0x7e, 0xc1, 0x3d, 0x05, 0x76, 0x05, 0xc0, 0x0f, 0x03, 0x3b, 0x00, 0xc1, 0x08,
+  0xc0, 0x0f, 0x6d, 0x7b, 0x00, 0x0f, 0x03, 0x0f, 0x17, 0x05, 0x3d, 0x00, 0x3d, 0x7f, 0x05, 0x00,
+  0xc0, 0x38, 0x08, 0xa2, 0x88, 0xc0, 0x5a, 0x66, 0x00, 0x14, 0x0f, 0x08, 0x14, 0x08, 0x17, 0xa2,
+  0x77, 0x77, 0x1c, 0x0f, 0x14, 0x0f, 0x14, 0x17, 0xa2, 0x78, 0x1c, 0x17, 0x1c, 0x17, 0x1c, 0x7e,
+  0xc0, 0x6b, 0x24, 0x21, 0x1c, 0x19, 0x1c, 0xc1, 0x17, 0x1c, 0x14, 0xc0, 0x0f, 0xc0, 0x08, 0x0c,
+  0x3d, 0x38, 0x00, 0x0f, 0x5e, 0x00, 0x0c, 0x00, 0x46, 0x38, 0x35, 0x38, 0x0c, 0x38, 0x6f, 0xc0,
+  0x35, 0x7b, 0x5a, 0x35, 0x6f, 0x04, 0x35, 0xc0, 0x01, 0x3c, 0xc0, 0x5a, 0xc0, 0x35, 0x3c, 0x01,
+  0x7e, 0x57, 0x01, 0x04, 0x09, 0x04, 0xc0, 0x01, 0xc1, 0x3c, 0xc0, 0x56, 0x39, 0x3c, 0x34, 0x39,
+  0x3c, 0xc0, 0x39, 0xc1, 0x34, 0xc0, 0x56, 0x65, 0x7e, 0xa2, 0x77, 0x42, 0x42, 0x7e, 0x7f, 0x79,
+  0x1a, 0x22, 0x25, 0x56, 0xc0, 0x1a, 0x5a, 0x51, 0xfe, 0x13, 0xd4, 0xc1, 0x66, 0xc0, 0x28, 0xc0,
+  0x6f, 0xc5, 0x6e, 0xc5, 0x34, 0x39, 0x6b, 0x6d, 0xc0, 0x6b, 0xa3, 0x97, 0xa0, 0xa8, 0xa2, 0xa8,
+  0x5e, 0x43, 0x45, 0xa0, 0xa8, 0x5a, 0x7e, 0xc0, 0xa1, 0xa8, 0x7f, 0x45, 0x20, 0x27, 0x24, 0x9f,
+  0x68, 0xc0, 0x7b, 0x24, 0x20, 0x7f, 0x3a, 0xc0, 0x3c, 0x62, 0x56, 0x34, 0x37, 0x65, 0xc0, 0x56,
+  0xa1, 0xa8, 0xc0, 0x2b, 0x2e, 0x7a, 0x6e, 0x6b, 0x7e, 0xc0, 0x7e, 0x3d, 0x2b, 0x3a, 0x2b, 0xc3,
+  0x76, 0xa2, 0x77, 0x3a, 0x7e, 0x3d, 0x33, 0x2e, 0xc0, 0x36, 0x05, 0xc0, 0x2e, 0x2b, 0x66, 0x2e,
+  0x36, 0xc0, 0x31, 0x36, 0x7b, 0xa3, 0x88, 0x55, 0xc0, 0x02, 0x36, 0x0d, 0x05, 0x65, 0x0a, 0xc0,
+  0x0d, 0xa2, 0x88, 0x19, 0x79, 0x21, 0x5a, 0x76, 0xc0, 0x40, 0xa2, 0x78, 0x21, 0x0d, 0x6e, 0xa1,
+  0xa9, 0x6e, 0xc0, 0x24, 0x21, 0xc0, 0x19, 0x21, 0xc0, 0x29, 0x6b, 0x29, 0x24, 0xc0, 0x29, 0x24,
+  0x69, 0x29, 0xc0, 0x24, 0x30, 0x24, 0xc0, 0x29, 0x21, 0x1c, 0xc1, 0x21, 0x24, 0xc4, 0x29, 0x24,
+  0x7e, 0x6f, 0xc1, 0x7a, 0xc0, 0x38, 0x69, 0x38, 0x7e, 0x31, 0xc0, 0x3b, 0x00, 0x6b, 0x00, 0xc0,
+  0x3b, 0xa2, 0x88, 0x07, 0xc1, 0x38, 0x29, 0x2c, 0x38, 0x6e, 0x00, 0xc0, 0x07, 0x00, 0xa3, 0x98,
+  0xa2, 0x88, 0x9d, 0x89, 0x0f, 0xc0, 0x3d, 0x38, 0x00, 0x3d, 0xc0, 0x38, 0x3d, 0xc0, 0x0f, 0x00,
+  0xc0, 0x1c, 0xc0, 0x5a, 0x61, 0x0f, 0x14, 0x0f, 0x14, 0xc0, 0x1c, 0xc0, 0x7f, 0x66, 0x0f, 0x14,
+  0x0f, 0x5a, 0x14, 0x2b, 0x56, 0x65, 0x1c, 0x6f, 0x1c, 0x7e, 0x2b, 0xc0, 0x26, 0x1c, 0xc0, 0x14,
+  0x0f, 0x1c, 0x26, 0x17, 0x1c, 0xc0, 0x14, 0xc0, 0x55, 0x0c, 0xc0, 0x3d, 0xc1, 0x00, 0x05, 0x3d,
+  0x07, 0x3d, 0x29, 0x38, 0xc0, 0x3d, 0x0f, 0x14, 0x9d, 0x79, 0xc0, 0x56, 0x7a, 0xa2, 0x88, 0x66,
+  0x35, 0x04, 0xc0, 0x38, 0x5f, 0x66, 0xc0, 0x2d, 0x5a, 0x7f, 0x3c, 0x04, 0x6e, 0x04, 0x39, 0xc0,
+  0x04, 0x3c, 0x01, 0xc0, 0x3c, 0xc1, 0x30, 0x56, 0x5a, 0x6f, 0x7a, 0xc0, 0x39, 0x34, 0xc1, 0x39,
+  0x3c, 0x39, 0x2a, 0x25, 0xc0, 0x2d, 0xc0, 0x25, 0x5a, 0x66, 0x6f, 0x64, 0x5b, 0xc3, 0x66, 0x9f,
+  0x68, 0x6f, 0xfe, 0x13, 0xb4, 0x6e, 0xc4, 0x6f, 0xc1, 0x6e, 0xc0, 0x34, 0xc0, 0x39, 0xc2, 0x6e,
+  0x39, 0xc0, 0x34, 0x39, 0xc0, 0x6f, 0x3e, 0x6f, 0xa2, 0x97, 0xa3, 0xc8, 0x66, 0x6f, 0x46, 0x59,
+  0x52, 0x4a, 0xa0, 0xb8, 0xa2, 0x97, 0x3f, 0x24, 0x6d, 0x7a, 0x9f, 0x69, 0x1e, 0x5a, 0x66, 0x79,
+  0xa2, 0x98, 0xc0, 0xa0, 0xa8, 0xa3, 0x88, 0x37, 0x55, 0x37, 0x2f, 0xa2, 0xa8, 0x28, 0x7b, 0x2f,
+  0x55, 0xa1, 0xb8, 0x6b, 0x59, 0xa1, 0xa9, 0x2e, 0xc0, 0x3d, 0x6e, 0x3d, 0xc0, 0x2e, 0x3a, 0x2b,
+  0x2e, 0x2b, 0x66, 0xc0, 0x2e, 0x26, 0x2b, 0x7e, 0xa1, 0xa9, 0x3d, 0x2e, 0xc1, 0x33, 0x7a, 0x2e,
+  0xc0, 0x2b, 0x2e, 0xc1, 0x7a, 0x3d, 0x2e, 0x05, 0xa3, 0x98, 0x51, 0x5a, 0x36, 0x7a, 0x05, 0x0d,
+  0x0a, 0x05, 0x0a, 0xc0, 0x7f, 0x21, 0x19, 0x0a, 0x21, 0x66, 0x36, 0x0a, 0x21, 0x1c, 0x59, 0x19,
+  0xa1, 0xa8, 0xc1, 0x1c, 0xc0, 0x21, 0x1c, 0xa2, 0x87, 0x21, 0x24, 0x29, 0x24, 0xc0, 0x29, 0x24,
+  0x69, 0x7f, 0x29, 0x24, 0x21, 0x1c, 0x24, 0xc0, 0x29, 0xc0, 0x24, 0xc0, 0x1c, 0x69, 0x29, 0xc0,
+  0x21, 0x2c, 0x6b, 0x24, 0xc1, 0x29, 0x7e, 0x6f, 0x2c, 0xc0, 0x3d, 0x66, 0x29, 0xc0, 0x38, 0xc1,
+  0x7e, 0x7f, 0x51, 0x00, 0xc0, 0x0f, 0x69, 0x5b, 0x3d, 0xc0, 0x31, 0x29, 0xc0, 0x38, 0x00, 0x3d,
+  0x00, 0xc0, 0x6e, 0xa1, 0xa9, 0x6e, 0x17, 0xc0, 0x5a, 0x3b, 0x00, 0x42, 0x29, 0x00, 0x6b, 0x38,
+  0x3d, 0x00, 0xc0, 0x0f, 0x14, 0xc0, 0x0f, 0x65, 0x14, 0x0f, 0x08, 0x05, 0x14, 0x7f, 0x14, 0x1c,
+  0x14, 0x00, 0x0f, 0xc0, 0x05, 0x17, 0xa2, 0x88, 0x17, 0x23, 0xa2, 0x87, 0x55, 0x1c, 0x7e, 0x1c,
+  0xc2, 0x5a, 0x14, 0x1c, 0x30, 0x2b, 0x14, 0xc0, 0x0c, 0x3d, 0x05, 0xc0, 0x0c, 0xc0, 0x38, 0xc0,
+  0x3d, 0xc1, 0x00, 0x0c, 0x9d, 0x89, 0xc0, 0x3d, 0x6b, 0x00, 0x0c, 0x07, 0x4a, 0x56, 0x65, 0x7f,
+  0x04, 0x6e, 0x01, 0x3c, 0x07, 0x56, 0xc0, 0x59, 0x5a, 0x52, 0x6e, 0x32, 0x01, 0x04, 0xc0, 0x09,
+  0x3c, 0x39, 0x04, 0xc2, 0x3c, 0xc1, 0x32, 0x2a, 0x6b, 0x39, 0x66, 0xc1, 0x46, 0x25, 0xc0, 0x2d,
+  0xc0, 0x2a, 0x56, 0x2a, 0x2d, 0xc1, 0x66, 0x2d, 0x25, 0x46, 0x59, 0xc0, 0xa0, 0xa9, 0x1a, 0xc0,
+  0x55, 0x7a, 0x5b, 0xc0, 0xfe, 0x13, 0xb4, 0x6e, 0xc0, 0x6e, 0x6b, 0xc0, 0x28, 0xc0, 0x34, 0xc0,
+  0x6e, 0x6b, 0x39, 0xc5, 0x6e, 0x39, 0xc1, 0x3e, 0xc0, 0x6e, 0x6f, 0xa1, 0xb8, 0xa1, 0xa9, 0x6e,
+  0xc0, 0x46, 0x7f, 0x9e, 0x68, 0x0f, 0xa1, 0xa9, 0xa2, 0xc7, 0x5f, 0x9d, 0x49, 0x71, 0x21, 0x46,
+  0x65, 0x1e, 0x65, 0xa2, 0xa7, 0x3a, 0x9f, 0x69, 0xc0, 0x34, 0x52, 0x1d, 0x34, 0x1d, 0x2f, 0x25,
+  0x1d, 0x7a, 0xa1, 0xa9, 0x3a, 0x55, 0x3a, 0x7a, 0x59, 0x3a, 0x65, 0x3a, 0x2e, 0x33, 0x3a, 0x76,
+  0x2e, 0xc0, 0x56, 0xc2, 0x2e, 0xc0, 0x33, 0xa0, 0xa8, 0x3d, 0x2b, 0xc0, 0x3a, 0x2e, 0x26, 0x33,
+  0x3d, 0x2e, 0xc1, 0x2b, 0x33, 0x2b, 0x2e, 0xa3, 0xa9, 0x6e, 0x65, 0x5a, 0x62, 0x7e, 0x59, 0x0a,
+  0x19, 0x0d, 0xc0, 0x19, 0x0a, 0x0d, 0xc0, 0x19, 0x7e, 0x76, 0x59, 0x19, 0x7a, 0x19, 0x0d, 0x14,
+  0x1c, 0x7e, 0xc0, 0x21, 0x1c, 0x59, 0x24, 0xa2, 0x88, 0x24, 0x21, 0x24, 0xc0, 0x6e, 0xc0, 0x24,
+  0x21, 0xa1, 0xa8, 0x29, 0x24, 0x29, 0x24, 0xc0, 0x29, 0xc0, 0x24, 0xc0, 0x29, 0x24, 0x15, 0x29,
+  0xc1, 0x24, 0xc4, 0x7f, 0x38, 0x24, 0x38, 0xc1, 0x29, 0x24, 0x38, 0x69, 0x5b, 0x38, 0x7e, 0x31,
+  0xc0, 0xa2, 0x99, 0xa2, 0x87, 0x00, 0x5a, 0xc0, 0x00, 0x38, 0x00, 0x38, 0xc0, 0xa2, 0x87, 0x33,
+  0x38, 0x05, 0x00, 0x05, 0x7f, 0x0f, 0x14, 0xc0, 0x0f, 0x38, 0x29, 0x00, 0x05, 0x67, 0x38, 0x3d,
+  0xc1, 0x00, 0x0f, 0x05, 0x6b, 0xc0, 0x05, 0x7a, 0x0f, 0xc1, 0x14, 0x7a, 0x0f, 0x00, 0x05, 0x0f,
+  0x17, 0x14, 0x1c, 0x7f, 0xc0, 0x1c, 0x6e, 0x7a, 0x66, 0x1c, 0xc1, 0x17, 0x14, 0x08, 0x6e, 0x2b,
+  0xc0, 0x1c, 0x0c, 0x00, 0x05, 0x3d, 0x00, 0x05, 0xc0, 0x3d, 0xc0, 0x38, 0x3d, 0x38, 0x3d, 0x0c,
+  0x35, 0x66, 0xa2, 0x88, 0x3d, 0x35, 0x30, 0x35, 0xc0, 0x6b, 0x55, 0xc0, 0x6b, 0x35, 0x04, 0x3d,
+  0x67, 0xa2, 0x77, 0x56, 0x3c, 0x35, 0xc0, 0x34, 0x6e, 0x01, 0xc3, 0x3c, 0x5e, 0x04, 0xc0, 0x01,
+  0x04, 0x3c, 0x59, 0x35, 0x01, 0x3c, 0x39, 0xc1, 0x34, 0xc0, 0x41, 0x7e, 0x6e, 0x25, 0xc1, 0x2a,
+  0x2d, 0x25, 0x2d, 0x01, 0x30, 0x56, 0x25, 0x41, 0x5a, 0x6f, 0x7a, 0xc0, 0x59, 0x7a, 0x7a, 0x1d,
+  0xc0, 0xfe, 0x13, 0xf5, 0xc1, 0x69, 0xc0, 0x34, 0xc4, 0x6e, 0xc0, 0x6b, 0x6e, 0xc0, 0x00, 0x34,
+  0x39, 0x00, 0x39, 0xc1, 0x7f, 0xa2, 0x97, 0x9f, 0x69, 0x7f, 0xa2, 0x97, 0x65, 0x7f, 0xa1, 0xa8,
+  0x9e, 0x49, 0x56, 0x6e, 0xc0, 0x19, 0xa2, 0xb7, 0x29, 0x16, 0x1e, 0x55, 0x16, 0x0f, 0x7a, 0xa1,
+  0xa9, 0xc0, 0x79, 0x2f, 0x37, 0x2c, 0x24, 0x5a, 0x1d, 0x0a, 0x18, 0x2f, 0x9e, 0x57, 0xa0, 0xa8,
+  0x2f, 0x7d, 0x76, 0x6b, 0x6e, 0x7e, 0x3a, 0x2e, 0x3a, 0x69, 0xc0, 0x6f, 0x76, 0x33, 0x56, 0xc0,
+  0x66, 0x2b, 0xc1, 0x33, 0x2e, 0x33, 0x3d, 0x33, 0x26, 0x2e, 0x3a, 0x26, 0x2e, 0x3a, 0x2e, 0xc0,
+  0x2b, 0x2e, 0x3a, 0x9d, 0x88, 0x3d, 0xa2, 0x98, 0x54, 0x7f, 0x6f, 0x0d, 0xc0, 0x3e, 0xc0, 0x6f,
+  0xc0, 0x19, 0x0a, 0xc0, 0x7e, 0xc0, 0x19, 0x0d, 0xa2, 0x88, 0x7e, 0x0d, 0x0a, 0x0d, 0x0a, 0x19,
+  0x7a, 0x7e, 0xc0, 0x55, 0x0d, 0x12, 0x21, 0x24, 0x21, 0x29, 0xc0, 0x24, 0x1c, 0x21, 0x24, 0x21,
+  0xa2, 0x97, 0x6b, 0x29, 0xc0, 0x24, 0x15, 0x24, 0x29, 0xc2, 0x24, 0xc6, 0x29, 0x24, 0xc2, 0x7f,
+  0x29, 0x24, 0x38, 0xc0, 0x65, 0x38, 0x7e, 0xc0, 0x38, 0xc2, 0x31, 0x00, 0x38, 0x7a, 0xc0, 0x38,
+  0x2c, 0x00, 0x38, 0xc0, 0xa3, 0x98, 0x41, 0x2c, 0x3d, 0x00, 0x3d, 0xa0, 0xa8, 0x6b, 0x5e, 0x00,
+  0x0c, 0x41, 0x69, 0x00, 0xc0, 0x38, 0x3d, 0x00, 0x3d, 0xc0, 0x7e, 0xc0, 0x0c, 0xc0, 0x00, 0x05,
+  0x7b, 0xc0, 0x14, 0x6e, 0x14, 0xc0, 0x0f, 0x14, 0x52, 0x03, 0x6e, 0x14, 0xa2, 0x87, 0x7b, 0x55,
+  0xc2, 0x2b, 0x69, 0x1c, 0xc0, 0x14, 0x0c, 0x00, 0x0f, 0x1c, 0x0f, 0xc0, 0x05, 0x3d, 0x38, 0xc0,
+  0x00, 0xc0, 0x3d, 0xc0, 0x05, 0x3d, 0x35, 0x66, 0x35, 0x38, 0x35, 0xc0, 0x30, 0x29, 0x56, 0x30,
+  0xc0, 0x5e, 0x67, 0x69, 0xc0, 0x34, 0x7e, 0x7e, 0xc1, 0x35, 0x32, 0x6b, 0x3c, 0x6e, 0x3c, 0x34,
+  0x3c, 0x01, 0x3c, 0x01, 0x39, 0xc0, 0x6e, 0x01, 0x3c, 0x04, 0xc0, 0x3c, 0x2d, 0x3c, 0x04, 0x3c,
+  0x30, 0x39, 0xc0, 0x2d, 0xc0, 0x57, 0x69, 0x2d, 0xc0, 0x25, 0xc0, 0x32, 0x30, 0x25, 0x7a, 0x32,
+  0x2d, 0x41, 0xc0, 0x25, 0x46, 0xc2, 0x65, 0x7f, 0x6e, 0x1a, 0x9e, 0x68, 0xfe, 0x13, 0xf5, 0x6e,
+  0x34, 0x69, 0xc0, 0x34, 0x39, 0xc0, 0x34, 0xc1, 0x39, 0x6b, 0xc0, 0x6e, 0xc0, 0x00, 0x05, 0x39,
+  0xc0, 0x00, 0x05, 0x39, 0xa2, 0x88, 0xa4, 0xb7, 0x4a, 0x42, 0xa1, 0xa8, 0x6b, 0x21, 0x2c, 0x9e,
+  0x69, 0x56, 0x6e, 0x21, 0x2c, 0xa2, 0x78, 0x16, 0x65, 0x7e, 0xc0, 0x05, 0xa3, 0x78, 0x79, 0x7a,
+  0x5b, 0x2c, 0xa2, 0x97, 0x56, 0xc0, 0x12, 0x7b, 0x12, 0xc0, 0x2c, 0x59, 0x52, 0xa1, 0xb9, 0x59,
+  0x6e, 0x37, 0x2a, 0x7d, 0xa1, 0xa9, 0xc0, 0x59, 0x3d, 0x33, 0x6b, 0xc1, 0x79, 0x2b, 0x7a, 0x56,
+  0xc0, 0x2b, 0xc1, 0x2e, 0x6b, 0x33, 0xc0, 0x2b, 0x26, 0x2b, 0xc2, 0x26, 0x2b, 0xc0, 0x2e, 0x35,
+  0x2e, 0xa2, 0x98, 0xc1, 0xa2, 0x88, 0xc0, 0x61, 0xc0, 0x59, 0x05, 0x6e, 0x7e, 0x6f, 0x0a, 0x19,
+  0x7e, 0x61, 0x5a, 0x05, 0xa2, 0x77, 0x21, 0x0d, 0x19, 0x7a, 0x69, 0x0d, 0x1e, 0xa1, 0xa8, 0x21,
+  0x08, 0x0d, 0x19, 0x66, 0x0d, 0x21, 0x29, 0xc0, 0x21, 0x15, 0x21, 0x19, 0x21, 0x29, 0x66, 0x59,
+  0x1c, 0x24, 0xc0, 0x21, 0x7f, 0x24, 0xc7, 0x29, 0xc0, 0x24, 0xc1, 0x29, 0x24, 0x7e, 0x24, 0x29,
+  0x7b, 0xc0, 0x6e, 0x7e, 0x7f, 0x00, 0x55, 0xc0, 0x33, 0xc0, 0x29, 0x2c, 0x38, 0xc0, 0x33, 0x38,
+  0x59, 0x29, 0x24, 0x29, 0xa2, 0x87, 0x7f, 0x00, 0x66, 0x00, 0xc0, 0x6b, 0x59, 0xc0, 0x00, 0x3d,
+  0x38, 0xc1, 0x00, 0x38, 0xc0, 0x3b, 0x38, 0x00, 0x6f, 0x0f, 0xc0, 0x07, 0x05, 0x0c, 0x0f, 0x05,
+  0x7f, 0xc1, 0x0f, 0xc0, 0x07, 0x0f, 0x69, 0xc0, 0x0f, 0x14, 0xc0, 0x7e, 0x7b, 0x1c, 0x7e, 0x6b,
+  0x1c, 0xc0, 0x66, 0x14, 0xc0, 0x0f, 0x08, 0x05, 0x00, 0x0f, 0x3d, 0x38, 0x29, 0x38, 0x05, 0x3d,
+  0xc0, 0x56, 0x3d, 0x35, 0x30, 0x3d, 0x35, 0x30, 0x38, 0x35, 0x30, 0xc0, 0x35, 0x56, 0x35, 0x2d,
+  0x35, 0x6b, 0x56, 0x6e, 0x35, 0xc0, 0x6e, 0x35, 0x30, 0x3c, 0x35, 0x3c, 0x3a, 0x2d, 0x34, 0x3c,
+  0x7e, 0x3c, 0x34, 0x39, 0xc1, 0x3c, 0xc0, 0x04, 0x3c, 0x2d, 0x56, 0x2d, 0x3c, 0x2d, 0x3c, 0xc1,
+  0x51, 0x2d, 0x28, 0x25, 0x2d, 0x3c, 0x2d, 0xc2, 0x28, 0xc0, 0x35, 0x46, 0x51, 0x25, 0xc0, 0x56,
+  0x5a, 0xc0, 0x7e, 0x1d, 0xc0, 0x1a, 0x9e, 0x68, 0x46, 0xfe, 0x13, 0xf5, 0xc1, 0x69, 0xc0, 0x34,
+  0xc0, 0x6e, 0xc2, 0x6b, 0xc1, 0x6e, 0xc3, 0x00, 0x39, 0x05, 0xc0, 0xa4, 0xa7, 0xa1, 0xa8, 0xa0,
+  0x59, 0x46, 0x79, 0xa1, 0xa8, 0x9e, 0x69, 0xa3, 0xb8, 0x9c, 0x79, 0x4a, 0x26, 0x37, 0x5e, 0x9f,
+  0x6a, 0x9c, 0x89, 0x05, 0xc0, 0x6e, 0x6e, 0x7a, 0x1c, 0x7e, 0x69, 0x37, 0x5a, 0x2c, 0x1e, 0x0a,
+  0xa3, 0xa7, 0x24, 0xa0, 0xa8, 0x6e, 0x9f, 0x68, 0x66, 0xa1, 0xa8, 0x2c, 0x69, 0x20, 0x2a, 0x6d,
+  0xa2, 0xa8, 0xc0, 0x56, 0x65, 0x5a, 0xc1, 0x28, 0x2e, 0xc0, 0x2b, 0xc2, 0x66, 0x7f, 0x6d, 0x35,
+  0x2e, 0xc0, 0x2b, 0xc0, 0x56, 0xc0, 0x2e, 0x2b, 0x26, 0x23, 0x2b, 0xa0, 0xa9, 0x6e, 0xc0, 0x7e,
+  0x3d, 0x05, 0x6e, 0x05, 0x7e, 0x55, 0xc0, 0x56, 0x05, 0x0a, 0xc1, 0x0d, 0x6b, 0x0a, 0x6e, 0x0a,
+  0xc0, 0x7f, 0x0d, 0x6e, 0xc0, 0x0d, 0x57, 0x0a, 0xa2, 0x98, 0x19, 0x0a, 0x0d, 0x21, 0xc0, 0x0d,
+  0x21, 0x7a, 0x21, 0x12, 0x7b, 0x7a, 0x1c, 0x5d, 0x0d, 0x12, 0xc0, 0x7a, 0xa3, 0x98, 0x66, 0x24,
+  0x6f, 0x24, 0xc0, 0x6e, 0xc1, 0x76, 0x24, 0xc2, 0x29, 0x21, 0x24, 0xc1, 0x29, 0x24, 0xc0, 0x29,
+  0x2c, 0xa2, 0x88, 0x31, 0xa2, 0x99, 0x59, 0x9d, 0x9a, 0x29, 0x2c, 0x29, 0x33, 0xc0, 0x2c, 0xc0,
+  0x29, 0x2c, 0xc1, 0x21, 0x24, 0x29, 0x21, 0xa2, 0x87, 0x00, 0xc0, 0x5a, 0x00, 0x05, 0x3d, 0xc0,
+  0x66, 0xc0, 0x3d, 0x7f, 0x00, 0xc1, 0x3d, 0x2e, 0x3d, 0x00, 0x0c, 0xc0, 0x05, 0xc1, 0x0c, 0x05,
+  0xc0, 0x7a, 0xc0, 0x6f, 0x0f, 0xc1, 0x14, 0x0f, 0xc0, 0x14, 0x0c, 0x0f, 0xa2, 0x87, 0xc0, 0x7f,
+  0x6e, 0x9d, 0x99, 0x14, 0xc4, 0x00, 0xc0, 0x0c, 0x05, 0x3d, 0xc0, 0x52, 0x3d, 0xc0, 0x38, 0x5a,
+  0x56, 0x35, 0x2d, 0x38, 0xa2, 0x78, 0x2d, 0xc1, 0x30, 0x66, 0x5d, 0x67, 0x30, 0x5e, 0xc0, 0x7b,
+  0x5a, 0x2d, 0x35, 0x3c, 0x39, 0x32, 0xc0, 0x3c, 0x2d, 0xc1, 0x35, 0x32, 0x39, 0xc4, 0x76, 0x5a,
+  0x59, 0x6b, 0x34, 0x28, 0xc0, 0x5a, 0xc0, 0x2d, 0x35, 0x2d, 0xc0, 0x3c, 0x35, 0x2a, 0x25, 0x28,
+  0x35, 0x6e, 0x2d, 0x25, 0xc0, 0x2a, 0x25, 0x2d, 0x25, 0x45, 0x7b, 0xc0, 0x13, 0x6b, 0xc0, 0x65,
+  0x25, 0x6b, 0x9e, 0x67, 0x46, 0x46, 0xc0, 0xfe, 0x13, 0xf5, 0xc1, 0x69, 0x34, 0xc1, 0x6e, 0xc1,
+  0x6b, 0x6e, 0x00, 0xc1, 0x05, 0xc4, 0x6e, 0xa2, 0x87, 0xa3, 0xa8, 0x46, 0x47, 0x7a, 0xa0, 0xa8,
+  0xc0, 0x9f, 0x68, 0xa3, 0xd8, 0x56, 0x9d, 0x58, 0xa2, 0xb7, 0xa3, 0xc8, 0x47, 0x9c, 0x39, 0x65,
+  0xc0, 0x05, 0x69, 0x7f, 0xa2, 0x78, 0x0f, 0xa1, 0xa8, 0xa1, 0xa9, 0xa2, 0x97, 0x46, 0x46, 0x66,
+  0x55, 0xa2, 0xb8, 0x45, 0x31, 0x25, 0x12, 0x21, 0xa1, 0xc8, 0xc0, 0x2c, 0x65, 0x25, 0x2f, 0xa0,
+  0xa7, 0xc0, 0x6b, 0x2e, 0xc1, 0x5a, 0x6e, 0x2e, 0xc2, 0x56, 0xc0, 0x2e, 0x6e, 0x7b, 0x5a, 0x2b,
+  0xc1, 0x26, 0x2b, 0xc0, 0x2e, 0xc0, 0x26, 0x20, 0x7e, 0x32, 0x30, 0xa1, 0xb9, 0xc0, 0x3d, 0x05,
+  0x5a, 0xc0, 0x05, 0x66, 0x55, 0x6e, 0x3d, 0x33, 0x02, 0x7e, 0x6e, 0x7b, 0x66, 0x0a, 0xc2, 0x7a,
+  0x05, 0x0a, 0x14, 0x5a, 0x05, 0x0d, 0x19, 0x0d, 0xc0, 0x7f, 0xc0, 0x0d, 0xa2, 0x88, 0x7a, 0x21,
+  0x19, 0xc0, 0x1c, 0xc0, 0x59, 0x05, 0x0a, 0x0d, 0x1c, 0x24, 0xc0, 0x6e, 0xc0, 0x24, 0x21, 0xc0,
+  0x24, 0xc0, 0x21, 0x24, 0xc0, 0x29, 0x24, 0x21, 0xc0, 0x24, 0xc0, 0x29, 0xc0, 0x24, 0xc0, 0x29,
+  0x7f, 0x6e, 0x38, 0x7e, 0x55, 0x21, 0xc0, 0x24, 0x29, 0xc2, 0x24, 0x29, 0xc0, 0x24, 0x7e, 0x6b,
+  0x2c, 0x38, 0x29, 0xc0, 0x38, 0xa2, 0x87, 0x3d, 0x00, 0x05, 0x3d, 0xc1, 0x00, 0xa2, 0x88, 0xc0,
+  0x00, 0x65, 0x00, 0x38, 0x29, 0x3d, 0x05, 0xc0, 0x6b, 0x05, 0x3d, 0xc0, 0x05, 0xc0, 0x38, 0x0c,
+  0x7a, 0x05, 0x0f, 0x14, 0x0f, 0xc0, 0x00, 0x0f, 0x05, 0x0c, 0x0f, 0x7e, 0x6e, 0x7f, 0x69, 0x14,
+  0xc0, 0x0f, 0xc0, 0x14, 0xc0, 0x0c, 0x3d, 0x38, 0x00, 0x3d, 0xc3, 0x38, 0xc1, 0x21, 0x5a, 0x7f,
+  0xc0, 0x69, 0x2d, 0x21, 0x26, 0x2d, 0xc0, 0x66, 0xc0, 0xa2, 0x87, 0x2d, 0x5a, 0x2d, 0x6e, 0xc1,
+  0x2d, 0x32, 0xc0, 0x35, 0x57, 0x55, 0x2a, 0x32, 0x2d, 0x34, 0xc1, 0x2d, 0x34, 0x6e, 0x34, 0x39,
+  0x52, 0xc0, 0x25, 0xc2, 0x66, 0x28, 0x2d, 0x25, 0x2a, 0x2d, 0x7f, 0x35, 0x2d, 0x25, 0x28, 0x2d,
+  0xc0, 0x2a, 0x41, 0x7f, 0x25, 0xc0, 0x2d, 0x25, 0x4a, 0x66, 0xc2, 0x22, 0x20, 0x1a, 0x55, 0x46,
+  0x4a, 0x57, 0x5a, 0xfe, 0x13, 0xf5, 0x66, 0xc0, 0x34, 0xc2, 0x6e, 0x6b, 0xc2, 0x6e, 0xc1, 0x6e,
+  0xc2, 0x6b, 0x66, 0x0a, 0xa4, 0x98, 0xa2, 0xa7, 0x9d, 0x4a, 0x66, 0xa2, 0xa8, 0xa1, 0xb8, 0x22,
+  0xc0, 0x69, 0xa1, 0xa8, 0x22, 0xa1, 0xc7, 0xa2, 0x97, 0x9f, 0x69, 0x11, 0x69, 0x6e, 0x0a, 0x05,
+  0xc0, 0xa2, 0x78, 0xa1, 0xb8, 0xa2, 0x97, 0x2c, 0x3c, 0x2c, 0x24, 0x5a, 0x0f, 0x24, 0xa2, 0x87,
+  0x55, 0x77, 0x49, 0xc0, 0x2c, 0x7a, 0xc1, 0x59, 0xa2, 0xa8, 0x7e, 0x9d, 0x89, 0x7a, 0x6e, 0x2e,
+  0x2b, 0xc3, 0x6b, 0x2b, 0x66, 0x2b, 0xc0, 0x33, 0x7f, 0x66, 0x2e, 0x2b, 0xc0, 0x26, 0xc0, 0x2e,
+  0x2b, 0xc0, 0x26, 0x5a, 0x2b, 0xc0, 0xa1, 0xa8, 0x3d, 0xc0, 0x02, 0x33, 0x3d, 0x02, 0x36, 0x33,
+  0xc0, 0x02, 0x36, 0x33, 0xa1, 0xa9, 0xc1, 0x6e, 0xc0, 0x36, 0x05, 0x7a, 0x05, 0x07, 0xa0, 0xa8,
+  0xc0, 0x02, 0xc0, 0x0a, 0x0d, 0xc0, 0x05, 0xa2, 0x88, 0x7a, 0x0d, 0x6e, 0x1c, 0x6e, 0x1c, 0x5e,
+  0x19, 0xc0, 0x1c, 0x0d, 0x0a, 0x05, 0x0d, 0x1c, 0x0d, 0x21, 0x6e, 0x76, 0xc0, 0x55, 0x1c, 0xc0,
+  0x19, 0xc0, 0x24, 0xc0, 0x6e, 0x1c, 0xc0, 0x21, 0x24, 0xc0, 0x29, 0xc0, 0x21, 0x24, 0x21, 0xa3,
+  0x98, 0xc0, 0x7f, 0x9d, 0x99, 0x21, 0x29, 0x6b, 0x24, 0xc0, 0x33, 0x69, 0xc0, 0x6f, 0x24, 0x29,
+  0xc0, 0x38, 0x21, 0x15, 0xa3, 0x98, 0x7a, 0x6b, 0x3d, 0x7e, 0xc0, 0x66, 0xc0, 0x38, 0xc0, 0x00,
+  0x05, 0x00, 0x0c, 0x38, 0x31, 0x38, 0xc1, 0x3b, 0x05, 0x0c, 0xc0, 0x66, 0x3d, 0x38, 0x05, 0x7f,
+  0x00, 0xc0, 0x7f, 0xc0, 0x69, 0x0f, 0xc3, 0x0c, 0x14, 0xc0, 0x7b, 0x7d, 0x5a, 0x6e, 0x56, 0x00,
+  0x08, 0x14, 0x0f, 0x00, 0x31, 0x5a, 0x3d, 0x00, 0xc0, 0x3d, 0x2e, 0x38, 0x3d, 0x38, 0x5a, 0x38,
+  0x30, 0x5a, 0x66, 0x26, 0x2d, 0x55, 0xc0, 0x2d, 0x26, 0x2d, 0x56, 0x6d, 0x7f, 0x67, 0x25, 0x2d,
+  0xc1, 0x32, 0x2d, 0x32, 0x2d, 0x30, 0x4a, 0x25, 0x34, 0x35, 0x6b, 0x34, 0x2a, 0xc1, 0x7f, 0xc0,
+  0x34, 0x39, 0x25, 0xc0, 0x2d, 0x2a, 0x25, 0x66, 0x35, 0x7f, 0x25, 0x55, 0x6f, 0x2d, 0x35, 0x32,
+  0x63, 0x25, 0xc0, 0x2d, 0x2a, 0x22, 0x66, 0x22, 0x1d, 0x25, 0x1e, 0x25, 0xc0, 0x1d, 0x5a, 0x66,
+  0x1d, 0xa2, 0x76, 0x1a, 0x41, 0xc0, 0x5b, 0x9f, 0x69, 0x56, 0x5a, 0xfe, 0x14, 0x16, 0x65, 0xc0,
+  0x00, 0x69, 0x34, 0x39, 0xc0, 0x00, 0xc1, 0x6e, 0xc3, 0x6f, 0xc0, 0x69, 0x11, 0x6e, 0x6e, 0xa2,
+  0xa8, 0x7e, 0x9f, 0x59, 0x67, 0xa1, 0xa8, 0x3d, 0x1b, 0x6b, 0x7e, 0x7e, 0x22, 0x2a, 0x65, 0x11,
+  0x05, 0x11, 0x6d, 0x0a, 0xc0, 0x11, 0x0a, 0xa2, 0x97, 0xa1, 0xb9, 0x6e, 0x7f, 0x9e, 0x58, 0x66,
+  0x65, 0x0a, 0x26, 0x34, 0x41, 0x7e, 0x66, 0x6f, 0x1d, 0x20, 0xa1, 0xa8, 0x6b, 0xc0, 0xa3, 0x98,
+  0x7d, 0x32, 0x2b, 0xc0, 0x66, 0x5a, 0xc0, 0x26, 0x23, 0x6e, 0x26, 0xc0, 0x2b, 0x7a, 0xc0, 0x6e,
+  0x7b, 0x69, 0x2e, 0x5e, 0x2b, 0x26, 0x2b, 0x2e, 0x2b, 0x26, 0xc1, 0x2e, 0xa3, 0x98, 0x56, 0x2e,
+  0x6f, 0x3d, 0x3a, 0x02, 0x3d, 0xc0, 0x33, 0x36, 0x02, 0xc0, 0x3d, 0x7a, 0xa2, 0x87, 0x56, 0x0a,
+  0x05, 0x33, 0x00, 0x7e, 0x05, 0x69, 0x0d, 0x05, 0x36, 0x00, 0x0a, 0x05, 0xc2, 0xa2, 0x88, 0x7e,
+  0x55, 0x19, 0xc2, 0x0d, 0x7f, 0x69, 0x0d, 0x0a, 0x0d, 0x21, 0x1c, 0x0d, 0x12, 0x21, 0xc0, 0x1c,
+  0x21, 0x7a, 0x19, 0x12, 0x21, 0xa1, 0xa9, 0x69, 0x5a, 0x21, 0x1c, 0x24, 0x29, 0x21, 0x7f, 0x21,
+  0x24, 0x1c, 0xa3, 0x88, 0x30, 0xc0, 0xa2, 0x97, 0x2c, 0x35, 0x29, 0xc0, 0x21, 0x29, 0xc0, 0x7f,
+  0xc0, 0x29, 0x21, 0x24, 0x38, 0x21, 0x0d, 0x21, 0xc0, 0xa2, 0x97, 0x7b, 0x31, 0x7a, 0x00, 0x38,
+  0x00, 0x38, 0xc0, 0x6e, 0x29, 0xc0, 0x38, 0x29, 0xc0, 0x31, 0x3d, 0x38, 0x3b, 0xa2, 0x88, 0x59,
+  0x00, 0x3d, 0x31, 0x3d, 0x05, 0x0f, 0xc0, 0x05, 0x6b, 0x00, 0xc0, 0xa2, 0x88, 0x7a, 0x0f, 0x14,
+  0xc0, 0x0f, 0x14, 0x17, 0x6e, 0x7f, 0x17, 0x05, 0xc3, 0x00, 0x38, 0x35, 0x38, 0x3d, 0xc0, 0x38,
+  0x3d, 0x33, 0x2c, 0x38, 0x30, 0x29, 0x30, 0x3d, 0x35, 0x56, 0x35, 0x30, 0x45, 0x56, 0x19, 0x30,
+  0x2d, 0x59, 0x2d, 0x6e, 0x2d, 0x56, 0x2d, 0xc0, 0x66, 0x2d, 0x28, 0x25, 0x2d, 0xc0, 0x5a, 0x28,
+  0x30, 0x32, 0x28, 0x25, 0xc0, 0x2a, 0x7f, 0x7a, 0xc0, 0x39, 0x56, 0x25, 0xc1, 0x2d, 0x6b, 0x2d,
+  0x32, 0x35, 0x25, 0x5a, 0xc0, 0x2d, 0x2a, 0x22, 0x25, 0xc2, 0x56, 0x56, 0x6e, 0x69, 0x6f, 0x16,
+  0x6e, 0x2a, 0x62, 0x22, 0xc0, 0x1a, 0xc0, 0x55, 0x5b, 0xc0, 0x5a, 0x45, 0x5b, 0xc0, 0x7e, 0xfe,
+  0x14, 0x36, 0x66, 0xc7, 0x05, 0xc1, 0x6b, 0x6e, 0x69, 0x11, 0x6e, 0x11, 0x16, 0x6f, 0x7e, 0x6e,
+  0x6b, 0x55, 0xc0, 0x2f, 0xa1, 0xa9, 0x36, 0x22, 0xa1, 0xa8, 0xa2, 0x97, 0x9e, 0x68, 0x27, 0xc0,
+  0x11, 0x0a, 0x7f, 0x16, 0x11, 0x0a, 0x6e, 0xc1, 0xa1, 0xa9, 0x7e, 0x7a, 0x9f, 0x68, 0x5a, 0xa0,
+  0xb9, 0x19, 0x6e, 0xa1, 0xa7, 0x29, 0x2c, 0x55, 0x56, 0x7b, 0x5d, 0x76, 0xa2, 0x97, 0x7b, 0x6e,
+  0x6e, 0x28, 0x5a, 0x32, 0x69, 0x56, 0xc0, 0x2b, 0x66, 0x28, 0x26, 0x7e, 0x2b, 0x32, 0xc0, 0x23,
+  0xa2, 0x87, 0xa1, 0xb9, 0x2e, 0xc0, 0x6b, 0x2e, 0x2b, 0x2e, 0x2b, 0x46, 0x2b, 0x52, 0xa1, 0xa8,
+  0xa3, 0x88, 0x56, 0x2e, 0x7f, 0x3a, 0xc1, 0x2b, 0x7e, 0x3a, 0x79, 0x05, 0x6e, 0x36, 0x7e, 0x7b,
+  0xc0, 0x6e, 0x05, 0xc1, 0x65, 0x0d, 0x6e, 0x05, 0x3d, 0x7a, 0x05, 0xc2, 0x0d, 0x0a, 0x6e, 0x7f,
+  0x76, 0x05, 0xa2, 0x88, 0xc0, 0x1c, 0x6e, 0x65, 0x0d, 0xc0, 0x12, 0x21, 0x7a, 0x15, 0x0d, 0x1c,
+  0x24, 0x21, 0x19, 0xc1, 0x1c, 0x12, 0xc0, 0x24, 0xc0, 0x21, 0x15, 0x24, 0x7e, 0x5a, 0x21, 0x24,
+  0x21, 0xc0, 0x29, 0x6f, 0xc0, 0x7f, 0x29, 0x7f, 0xc0, 0x24, 0x29, 0x21, 0xc1, 0x38, 0x29, 0x12,
+  0xc0, 0x21, 0xc0, 0x12, 0x1c, 0x24, 0x1c, 0x29, 0x38, 0x29, 0x2c, 0x24, 0x29, 0x38, 0x29, 0xc0,
+  0x38, 0xc0, 0x66, 0xc0, 0x29, 0x38, 0x6e, 0x7a, 0x33, 0x38, 0xa2, 0x87, 0x00, 0x3d, 0x35, 0x69,
+  0xa2, 0x88, 0x7f, 0x05, 0x00, 0x05, 0x3d, 0x7f, 0x61, 0xa2, 0x88, 0xa3, 0x88, 0x0f, 0x7e, 0x6e,
+  0x17, 0x1c, 0x17, 0x1c, 0x6e, 0x0f, 0xc0, 0x69, 0x00, 0xc0, 0x05, 0x3d, 0xc1, 0x38, 0x35, 0x79,
+  0x35, 0x2e, 0x35, 0x33, 0x35, 0x66, 0x5a, 0x69, 0x3d, 0xc0, 0x9d, 0x89, 0x26, 0x1e, 0xc0, 0x56,
+  0xc0, 0x2d, 0x30, 0x2d, 0x1e, 0xa1, 0xaa, 0x49, 0xc0, 0x7f, 0x2a, 0xc0, 0x76, 0x5a, 0xc0, 0x2d,
+  0xc0, 0x25, 0x5a, 0xc0, 0x25, 0x56, 0xc0, 0x25, 0x2a, 0x7b, 0x2d, 0x7f, 0x39, 0x25, 0x22, 0x25,
+  0xc0, 0x28, 0x30, 0x3c, 0x34, 0x51, 0x2a, 0x22, 0x1d, 0x25, 0x5e, 0x56, 0x22, 0x25, 0x22, 0x55,
+  0x67, 0xc0, 0x6e, 0x22, 0x51, 0x15, 0x22, 0x1d, 0x1a, 0x22, 0xc1, 0x1a, 0x9e, 0x69, 0x6e, 0xc1,
+  0x5a, 0x6b, 0x0c, 0xc0, 0xfe, 0x14, 0x36, 0xc4, 0x66, 0xc0, 0x05, 0xc3, 0x6f, 0xc3, 0x6e, 0x6f,
+  0xa2, 0x77, 0x7f, 0x7a, 0x46, 0x2c, 0x66, 0xc0, 0x3e, 0x7a, 0x27, 0x7a, 0x6e, 0xc0, 0x27, 0xc0,
+  0x65, 0x16, 0xc0, 0x7e, 0xc0, 0x16, 0x69, 0x16, 0x1b, 0x16, 0x0f, 0x1e, 0x69, 0x1e, 0xa1, 0xa7,
+  0x42, 0x56, 0xa2, 0xa8, 0xa2, 0x97, 0x66, 0x24, 0x59, 0x6b, 0x0a, 0xa1, 0xa8, 0xa2, 0xa7, 0xa3,
+  0x99, 0x56, 0x2f, 0xc1, 0x7a, 0x55, 0xc0, 0x28, 0x7a, 0xc0, 0x7a, 0x56, 0x2e, 0xc0, 0x26, 0x4e,
+  0xc0, 0x2b, 0xa2, 0xa8, 0x56, 0x2b, 0xc0, 0x2e, 0x26, 0x23, 0x26, 0x1a, 0xc0, 0xa0, 0xa8, 0x2b,
+  0xc0, 0x7e, 0x77, 0x69, 0x33, 0x6b, 0x26, 0xa2, 0x78, 0x2b, 0xc0, 0xa2, 0x98, 0xa1, 0xa8, 0x52,
+  0x59, 0xc0, 0x05, 0x7a, 0xc0, 0x5e, 0x08, 0x0d, 0x55, 0x66, 0x0a, 0x6f, 0x08, 0xc0, 0x0a, 0x05,
+  0xc0, 0x0d, 0xc0, 0x6f, 0x0a, 0x7b, 0x0d, 0x19, 0xc0, 0x7a, 0x69, 0x1c, 0xc0, 0x0d, 0x0a, 0x0d,
+  0x1c, 0xc0, 0x0d, 0xc0, 0x1c, 0x6e, 0xc0, 0x1c, 0x19, 0x69, 0x1c, 0x12, 0xc1, 0x0d, 0x12, 0x0d,
+  0xa3, 0x98, 0x7e, 0x52, 0xc0, 0x6b, 0x29, 0x1c, 0x21, 0x29, 0xa2, 0x88, 0x56, 0x24, 0xa2, 0x88,
+  0x29, 0x21, 0x7f, 0x29, 0x1c, 0x21, 0x1c, 0x12, 0xc0, 0x0d, 0xc0, 0x12, 0x21, 0x24, 0xc1, 0xa2,
+  0x98, 0xc0, 0x3d, 0x31, 0x24, 0x30, 0x29, 0x21, 0xa2, 0x87, 0xa1, 0xa9, 0xc1, 0x3d, 0xc0, 0x00,
+  0x3d, 0x38, 0xc0, 0x3d, 0x00, 0x38, 0x30, 0xc0, 0x38, 0x35, 0x00, 0x6f, 0x38, 0x66, 0xa3, 0x87,
+  0xa2, 0x88, 0x00, 0xa2, 0x88, 0xc0, 0x00, 0xa2, 0x98, 0x6e, 0xa2, 0x87, 0x56, 0x9d, 0x9a, 0x1c,
+  0x21, 0x14, 0x19, 0x14, 0x05, 0xc0, 0x0c, 0x3d, 0x38, 0xc1, 0x30, 0x35, 0x65, 0x56, 0x30, 0x79,
+  0x35, 0x30, 0xc0, 0x59, 0x35, 0x30, 0x41, 0xc1, 0x16, 0xc1, 0x7e, 0x21, 0x5b, 0x6e, 0x7b, 0x25,
+  0xa1, 0xa9, 0x35, 0x45, 0x7b, 0x25, 0xc0, 0x2d, 0xc1, 0x25, 0x4a, 0x56, 0x7a, 0x1f, 0x7a, 0x7b,
+  0x6e, 0x22, 0xc0, 0x6e, 0x25, 0x2a, 0xc0, 0x31, 0x25, 0x22, 0x31, 0x7d, 0x2d, 0xc0, 0x25, 0x1a,
+  0x7a, 0x25, 0x1d, 0xc1, 0x1a, 0xc1, 0x1f, 0x1a, 0x7f, 0x1a, 0x66, 0xc0, 0x17, 0x1a, 0x2c, 0x27,
+  0x22, 0xc0, 0x15, 0x4a, 0x01, 0x5a, 0xa2, 0x97, 0x7b, 0x7a, 0xc0, 0x9f, 0x68, 0xfe, 0x14, 0x36,
+  0x6e, 0xc1, 0x05, 0x0a, 0xc0, 0x05, 0xc3, 0x6f, 0xc0, 0x6e, 0xc0, 0x11, 0xc0, 0xa2, 0x77, 0xa2,
+  0x88, 0x5f, 0x69, 0xa0, 0xa9, 0x5a, 0x56, 0xc2, 0x69, 0x66, 0x2c, 0x7e, 0xa0, 0xa9, 0x41, 0x16,
+  0xc0, 0x1b, 0xc0, 0x7a, 0xc1, 0x7a, 0x1b, 0x27, 0x1b, 0x16, 0x7a, 0x16, 0x1e, 0xc0, 0x65, 0x5a,
+  0xa1, 0xa8, 0xa2, 0xa8, 0xc0, 0x56, 0x55, 0xc0, 0x1a, 0xa1, 0xb9, 0x7a, 0xa2, 0x88, 0x5a, 0x2f,
+  0xc2, 0x32, 0x59, 0x51, 0x7f, 0xa1, 0xa8, 0xc0, 0x5a, 0x2e, 0xc0, 0x56, 0x4a, 0x2f, 0xa0, 0xa8,
+  0x6d, 0x2b, 0x32, 0x28, 0x2b, 0x26, 0x56, 0x23, 0x4b, 0x0a, 0x20, 0x32, 0x2b, 0x55, 0x26, 0x2e,
+  0xc0, 0x26, 0x28, 0x23, 0xc0, 0x32, 0xa2, 0x97, 0x65, 0x7f, 0xc0, 0x33, 0xa0, 0xa8, 0x05, 0x7a,
+  0x5e, 0x08, 0x6e, 0x55, 0xc0, 0x0a, 0x0d, 0x05, 0xc0, 0x36, 0x6e, 0x0a, 0x05, 0x0a, 0x6f, 0x0d,
+  0x7f, 0x5a, 0x0d, 0x19, 0x69, 0x0d, 0x08, 0x0d, 0x05, 0x66, 0x05, 0x0d, 0xc0, 0xa2, 0x78, 0x12,
+  0x19, 0x1e, 0x19, 0x1e, 0x12, 0xc0, 0x7f, 0x0d, 0x6b, 0x05, 0xc0, 0x0d, 0x19, 0x21, 0x69, 0x7f,
+  0xc0, 0x66, 0xc1, 0x21, 0xc0, 0x6e, 0x21, 0xc0, 0xa2, 0x98, 0x1c, 0x21, 0x26, 0x21, 0x0d, 0xc1,
+  0x19, 0x1c, 0x0d, 0xc0, 0x21, 0xa1, 0xa9, 0x69, 0x29, 0x38, 0x7e, 0xc1, 0x55, 0x6f, 0x00, 0x38,
+  0x29, 0xa3, 0x98, 0x7b, 0x00, 0xc0, 0x05, 0x6b, 0x2c, 0x38, 0x2c, 0x38, 0x00, 0x0c, 0x38, 0x59,
+  0x38, 0x3d, 0x33, 0x31, 0x2c, 0x38, 0x7f, 0x0f, 0xc1, 0x6e, 0x0f, 0x14, 0x7e, 0x66, 0x1c, 0x14,
+  0xc0, 0x1c, 0x14, 0x65, 0x05, 0x08, 0x00, 0x3d, 0x38, 0xc1, 0x5a, 0x66, 0x29, 0xc1, 0x24, 0x29,
+  0xc1, 0x21, 0xc1, 0x6b, 0x5a, 0x16, 0x7b, 0x19, 0x16, 0xc1, 0x19, 0x25, 0x16, 0xa2, 0x88, 0x25,
+  0x2a, 0xa2, 0xa8, 0x41, 0x1e, 0x2d, 0x42, 0x20, 0x2a, 0x5a, 0x66, 0xc0, 0x56, 0x66, 0x4d, 0x7b,
+  0x1a, 0x25, 0x22, 0x1a, 0xc0, 0x1d, 0x22, 0x2a, 0x25, 0x22, 0x1a, 0xc1, 0x25, 0xa3, 0x97, 0x57,
+  0x25, 0x1a, 0xc0, 0x22, 0x1d, 0x22, 0x1a, 0xc1, 0x7f, 0x22, 0xc0, 0x29, 0x40, 0x1a, 0x6e, 0x1d,
+  0xa2, 0x78, 0x22, 0x1a, 0xc0, 0x56, 0x1a, 0x5e, 0x9e, 0x6a, 0x5a, 0x7e, 0xa1, 0xa8, 0x76, 0x6e,
+  0x9e, 0x68, 0xfe, 0x14, 0x36, 0x6f, 0x6e, 0x11, 0xc1, 0x16, 0x11, 0x05, 0xc0, 0x6e, 0xc0, 0x11,
+  0x16, 0x11, 0x16, 0xc0, 0xa2, 0x78, 0x7e, 0x7f, 0x5a, 0x5a, 0xc0, 0x66, 0x69, 0x33, 0xc2, 0x2c,
+  0xc0, 0x6e, 0xa1, 0xa9, 0x9d, 0x99, 0x56, 0x16, 0x6e, 0x16, 0x7e, 0x2a, 0xa0, 0xa8, 0x7a, 0x1b,
+  0x27, 0x1e, 0x16, 0xc1, 0x6d, 0x1e, 0x7a, 0x16, 0x69, 0x21, 0xa1, 0xa8, 0x55, 0x57, 0xa1, 0xa7,
+  0x7f, 0xc0, 0xa2, 0xa7, 0x5a, 0x56, 0xc0, 0x2f, 0x69, 0x5a, 0xa0, 0xa9, 0x20, 0x56, 0xa2, 0xa7,
+  0x7b, 0x2b, 0xc0, 0x66, 0xc0, 0x32, 0x28, 0x25, 0x2f, 0xa0, 0xa7, 0x32, 0x2f, 0xc0, 0x20, 0x7a,
+  0x2f, 0x1d, 0x55, 0x6f, 0xa0, 0xa9, 0x32, 0x2e, 0x26, 0x2b, 0xc1, 0x2e, 0x6f, 0x9d, 0x89, 0x5a,
+  0x7d, 0x2b, 0x7e, 0x7a, 0xc0, 0x2e, 0x36, 0xc0, 0xa2, 0x99, 0x69, 0x5a, 0x66, 0x59, 0x05, 0x0d,
+  0x0a, 0x65, 0x67, 0x02, 0x0a, 0x05, 0x0d, 0x6f, 0x0a, 0xc0, 0x19, 0x69, 0x0a, 0x0d, 0xc0, 0x05,
+  0x3b, 0xc0, 0x36, 0x0d, 0xc0, 0x05, 0x0d, 0x19, 0x7a, 0x0d, 0x0a, 0x19, 0x12, 0x7f, 0x65, 0x0d,
+  0xc0, 0x12, 0x0d, 0x3e, 0x0d, 0x1c, 0x51, 0x0d, 0x21, 0x7e, 0xc1, 0x66, 0x21, 0xc0, 0x7f, 0x21,
+  0x29, 0x5a, 0x0d, 0xa2, 0x99, 0x26, 0x12, 0x0d, 0x0a, 0xa2, 0x88, 0x21, 0x15, 0x0d, 0x12, 0x24,
+  0x7e, 0x6f, 0x69, 0x7b, 0x5e, 0x3b, 0x38, 0x3d, 0x7a, 0xc0, 0x38, 0xc0, 0xa2, 0x98, 0x00, 0xc0,
+  0x6e, 0x41, 0x00, 0x6b, 0x24, 0xc0, 0x29, 0x7b, 0xa3, 0x88, 0x38, 0x5a, 0x3d, 0xc0, 0x38, 0xc1,
+  0x00, 0x0c, 0x0f, 0x00, 0x7e, 0x0f, 0x7e, 0x6e, 0x56, 0xc0, 0x0f, 0x0c, 0x14, 0x08, 0x05, 0x00,
+  0x0c, 0x0f, 0x0c, 0x35, 0x30, 0x33, 0x2c, 0x35, 0x30, 0x21, 0x66, 0x29, 0x30, 0x29, 0x21, 0xc0,
+  0x1c, 0x26, 0xc0, 0x67, 0x56, 0x19, 0xc0, 0x5b, 0x69, 0xc1, 0x19, 0xc0, 0x46, 0x28, 0xa2, 0x78,
+  0x69, 0x66, 0x45, 0x1d, 0x6e, 0x45, 0x1b, 0x7b, 0x4a, 0xc2, 0x66, 0x4a, 0x76, 0x1a, 0x1d, 0x1f,
+  0x1a, 0x6f, 0x1a, 0xc0, 0x1d, 0x6f, 0x1a, 0xc0, 0x12, 0xc0, 0x1a, 0xa2, 0x97, 0x22, 0x1a, 0xc2,
+  0x22, 0xc1, 0x1a, 0xc0, 0x29, 0x1a, 0x1f, 0x56, 0x26, 0xa1, 0xa8, 0xc0, 0x66, 0x17, 0x45, 0x1f,
+  0xc0, 0x7e, 0xa2, 0x98, 0x9e, 0x69, 0x46, 0x46, 0x66, 0x7e, 0x14, 0x1a, 0x5b, 0xfe, 0x14, 0x77,
+  0xc2, 0x6f, 0x16, 0xc1, 0x66, 0xc0, 0x16, 0x11, 0x16, 0xc2, 0x22, 0xa2, 0x77, 0xc0, 0x6b, 0x6e,
+  0xc2, 0x33, 0x6f, 0x68, 0x38, 0x33, 0xc1, 0xa2, 0x77, 0x38, 0x33, 0x65, 0x22, 0x16, 0x6e, 0xc1,
+  0x27, 0xc1, 0x22, 0x1b, 0xc0, 0x16, 0x65, 0x16, 0x7e, 0x7a, 0x59, 0x1e, 0xc0, 0x75, 0x5a, 0x17,
+  0xa0, 0xb8, 0x7f, 0x7e, 0x7a, 0x7e, 0x9e, 0x59, 0x7e, 0x7e, 0x51, 0x5a, 0x20, 0x9e, 0x69, 0x2c,
+  0xa0, 0xb7, 0x5a, 0x66, 0x5a, 0x55, 0x23, 0x34, 0x2f, 0x20, 0xc0, 0xa0, 0xa9, 0x20, 0x34, 0x37,
+  0x25, 0x20, 0x5a, 0x0d, 0x0a, 0xa1, 0xb8, 0x20, 0xa1, 0xa9, 0x2e, 0x2b, 0x2e, 0x26, 0x2b, 0xa1,
+  0xa8, 0x6b, 0x9e, 0x67, 0x67, 0xc0, 0x26, 0x2e, 0x36, 0x2e, 0xc0, 0x7b, 0x36, 0xa4, 0x88, 0x9d,
+  0xa9, 0x5d, 0x3d, 0x7e, 0x7e, 0xc0, 0x65, 0x57, 0x3d, 0x6d, 0x05, 0xc0, 0x02, 0x7e, 0xc0, 0x02,
+  0x0a, 0x7e, 0x0a, 0xc0, 0x0d, 0x0a, 0x05, 0x0d, 0x05, 0x36, 0x0a, 0xc2, 0x12, 0x0d, 0x6f, 0xc0,
+  0x12, 0x7b, 0xc0, 0x0d, 0xc0, 0x19, 0x0d, 0x12, 0xa1, 0xa9, 0x55, 0x66, 0x12, 0xc0, 0x7f, 0x7e,
+  0xc0, 0x24, 0x29, 0x21, 0xc0, 0x24, 0xa2, 0x78, 0x21, 0xc0, 0x6e, 0x12, 0x19, 0xc0, 0x15, 0x21,
+  0xc0, 0x15, 0x19, 0x21, 0x1c, 0xa3, 0x97, 0x6b, 0x31, 0x6f, 0x7a, 0xc0, 0x38, 0x00, 0xc1, 0x31,
+  0x38, 0x7f, 0xc0, 0x00, 0x52, 0x21, 0xa4, 0x97, 0x38, 0x21, 0x24, 0x38, 0x3d, 0xc0, 0x29, 0x38,
+  0xc1, 0x3d, 0x35, 0x3d, 0x05, 0xc0, 0x6b, 0xc0, 0x05, 0xa2, 0x98, 0xc0, 0x55, 0x1c, 0x7e, 0x1c,
+  0x0c, 0x7e, 0x7a, 0x14, 0x3d, 0x0c, 0x05, 0xc0, 0x38, 0xc0, 0x56, 0x38, 0xc0, 0x21, 0xc0, 0x7a,
+  0xc0, 0x29, 0xc0, 0x21, 0x29, 0x21, 0x29, 0x5b, 0x56, 0x19, 0xc0, 0x1e, 0x56, 0x19, 0x1e, 0x5a,
+  0x16, 0xc0, 0x1e, 0xa2, 0x99, 0x59, 0x6b, 0x16, 0x4a, 0xa0, 0xa9, 0x46, 0xc0, 0xa3, 0xa7, 0x56,
+  0x56, 0xc2, 0x5a, 0x56, 0x17, 0x1a, 0xc0, 0x69, 0x17, 0xc1, 0x76, 0x1a, 0xc0, 0x12, 0xc0, 0x0f,
+  0x12, 0x1a, 0x17, 0x1a, 0x5e, 0x17, 0xc0, 0x7b, 0x1a, 0xc0, 0x6e, 0x1a, 0x5b, 0x7e, 0x45, 0x12,
+  0x22, 0xa4, 0x88, 0x79, 0x42, 0x17, 0x0f, 0x14, 0xa2, 0x98, 0xc0, 0x39, 0xa2, 0x88, 0x2b, 0x9e,
+  0x59, 0x55, 0x7b, 0x6d, 0x76, 0x1a, 0x0c, 0xfe, 0x14, 0x77, 0xc3, 0x6b, 0x6e, 0xc2, 0x1d, 0x16,
+  0xc0, 0x6e, 0x22, 0x6e, 0xc0, 0x6e, 0x6f, 0x7e, 0x38, 0xc1, 0x7b, 0x38, 0xc0, 0x76, 0x38, 0xc2,
+  0x66, 0x38, 0x33, 0x27, 0xc0, 0x22, 0xc0, 0x27, 0x22, 0xa2, 0x87, 0x7e, 0x27, 0x22, 0xc0, 0x1b,
+  0x16, 0xc0, 0x65, 0x7e, 0x7f, 0xc0, 0x1b, 0x21, 0x5a, 0x59, 0x1e, 0xa1, 0xb8, 0x7a, 0xa2, 0x98,
+  0x45, 0x2c, 0x6b, 0x2f, 0x34, 0xc0, 0x4a, 0x72, 0x59, 0x5a, 0xa1, 0xd9, 0x55, 0x5e, 0xc0, 0x62,
+  0x5a, 0x6e, 0x57, 0x1b, 0xa2, 0x98, 0x69, 0x4a, 0x2c, 0x34, 0x2c, 0x76, 0x45, 0x5a, 0x0a, 0x27,
+  0x2f, 0x2b, 0x7a, 0xc0, 0x26, 0x5a, 0xc0, 0x2e, 0x66, 0x26, 0x45, 0x20, 0x28, 0x2b, 0xa1, 0xa9,
+  0xc0, 0x35, 0x7d, 0xa3, 0x99, 0x65, 0x66, 0x0d, 0x56, 0x5a, 0x7e, 0x05, 0x36, 0x5a, 0x02, 0x36,
+  0x02, 0xc0, 0x3d, 0xc0, 0x02, 0x3d, 0x0a, 0x65, 0x0a, 0x05, 0x3e, 0x0a, 0x7e, 0x7f, 0x3e, 0x2e,
+  0x05, 0x0a, 0xc0, 0x19, 0x7a, 0x0d, 0x19, 0xc0, 0x12, 0x0a, 0x0d, 0x08, 0x0a, 0xc0, 0x0d, 0x1c,
+  0x21, 0xc2, 0x0d, 0xc0, 0x21, 0xc0, 0x7a, 0xc0, 0x6f, 0x21, 0xc1, 0x19, 0xa2, 0x97, 0x21, 0x0d,
+  0xc0, 0x12, 0x21, 0xc0, 0x12, 0x0d, 0x1c, 0x21, 0x1c, 0x29, 0xc0, 0x21, 0xa2, 0x97, 0x6b, 0xc0,
+  0x6e, 0xc0, 0x38, 0xc0, 0x3d, 0x7a, 0x7e, 0x00, 0x51, 0x29, 0x38, 0x59, 0x21, 0x24, 0x30, 0x31,
+  0x67, 0x21, 0xc0, 0x3d, 0xa1, 0xa9, 0x00, 0x46, 0x29, 0x3d, 0x00, 0x6e, 0x6b, 0x05, 0xc0, 0x7f,
+  0x7e, 0xc3, 0x14, 0xc0, 0x6e, 0x00, 0x38, 0x3d, 0x05, 0x55, 0x3d, 0x29, 0x5a, 0x3d, 0x38, 0x21,
+  0xc2, 0x7b, 0xc0, 0x5e, 0x21, 0x2d, 0xc1, 0x56, 0x65, 0x26, 0x25, 0x51, 0x2d, 0x38, 0x21, 0x47,
+  0x59, 0xa2, 0x98, 0xa2, 0x97, 0x2d, 0x25, 0x9e, 0x69, 0xa2, 0x97, 0xc0, 0x9e, 0x68, 0x7f, 0x22,
+  0xc0, 0x7b, 0x49, 0xc0, 0x17, 0x5a, 0x17, 0xc1, 0x12, 0xc0, 0x4a, 0x7a, 0xa1, 0xa8, 0xc0, 0x55,
+  0x08, 0x17, 0x1a, 0x17, 0xc1, 0x14, 0x1a, 0x17, 0xc0, 0x14, 0xc0, 0x6b, 0xa1, 0xa8, 0x17, 0x6f,
+  0x69, 0x17, 0x1c, 0x23, 0x1c, 0xa1, 0xa9, 0x26, 0x14, 0x62, 0xa2, 0x88, 0x23, 0x5a, 0xc0, 0xa2,
+  0xa7, 0x1f, 0x0c, 0x4a, 0xa1, 0xa9, 0x52, 0x06, 0x7a, 0x66, 0x59, 0xfe, 0x14, 0x77, 0xc3, 0x6b,
+  0x6e, 0xc0, 0x1d, 0x22, 0xc0, 0x16, 0xc0, 0x6e, 0x6f, 0xc1, 0x6e, 0x6f, 0x6e, 0xc0, 0x38, 0xc4,
+  0x66, 0x38, 0xc0, 0xa1, 0xa8, 0xa3, 0xb7, 0x52, 0x9d, 0x69, 0x33, 0x2c, 0xc0, 0x27, 0x2c, 0x7b,
+  0xa1, 0xa7, 0x7b, 0x27, 0xc0, 0x69, 0x1b, 0x16, 0xc5, 0xa2, 0x97, 0x56, 0x16, 0x1e, 0xa0, 0xa7,
+  0x7f, 0xa3, 0xb8, 0x45, 0x57, 0x59, 0x56, 0x66, 0x29, 0xa0, 0xa8, 0x9f, 0x69, 0xc0, 0x55, 0x2f,
+  0xc0, 0x55, 0xa1, 0xa9, 0x20, 0x1d, 0x20, 0x57, 0x12, 0x20, 0xa2, 0x87, 0x56, 0x2c, 0x21, 0x1d,
+  0x2c, 0x51, 0x1d, 0x56, 0xa1, 0xa9, 0x20, 0x7e, 0x7a, 0x7a, 0x41, 0x5e, 0x17, 0x7f, 0xc0, 0x17,
+  0x57, 0x6e, 0x26, 0x2b, 0x7e, 0x2e, 0xc0, 0xa2, 0x98, 0xa2, 0x88, 0x05, 0x7f, 0x7e, 0x45, 0x2e,
+  0x33, 0x7f, 0x2b, 0x02, 0x0a, 0x55, 0x0a, 0x02, 0x56, 0x2e, 0x7e, 0x02, 0x05, 0xc0, 0x02, 0x05,
+  0x0a, 0x76, 0x6e, 0x59, 0x36, 0x05, 0x66, 0x36, 0x0a, 0x0d, 0x7e, 0x0d, 0x05, 0x0d, 0xc0, 0x0a,
+  0x0d, 0xc0, 0x0a, 0xc0, 0x0d, 0xc0, 0x19, 0x0d, 0xa2, 0x88, 0x15, 0x0d, 0x6e, 0x21, 0x1c, 0x12,
+  0x21, 0x7a, 0x21, 0x19, 0x05, 0x19, 0xa2, 0x97, 0x15, 0x12, 0x0d, 0xc0, 0x24, 0xc0, 0x12, 0x77,
+  0x1c, 0x21, 0x1c, 0x15, 0x12, 0x21, 0x29, 0xc3, 0x7f, 0xc0, 0x6e, 0x7a, 0x6e, 0x00, 0x38, 0x66,
+  0x29, 0x21, 0x24, 0x21, 0xc0, 0xa2, 0x97, 0xc0, 0x1c, 0x29, 0x00, 0x7e, 0x38, 0x56, 0x3d, 0x38,
+  0x3d, 0x7f, 0xc1, 0x05, 0x7b, 0x6d, 0x6b, 0x0f, 0x56, 0xa3, 0x97, 0x0d, 0x00, 0xc0, 0x38, 0xc0,
+  0x00, 0xc0, 0x38, 0xc0, 0x29, 0x6f, 0x29, 0x24, 0x21, 0x19, 0x7a, 0x21, 0xc0, 0x5a, 0x19, 0xc0,
+  0x1e, 0x19, 0x6f, 0x55, 0xa2, 0x98, 0xc0, 0x16, 0x66, 0x16, 0x2d, 0xc0, 0x46, 0x11, 0xa3, 0x99,
+  0x6e, 0x62, 0x22, 0xc0, 0x5a, 0x22, 0x57, 0x59, 0x7a, 0x22, 0xc0, 0x1a, 0x17, 0x56, 0x6e, 0x17,
+  0x0f, 0xc2, 0x45, 0x7f, 0x17, 0x66, 0x0f, 0xc0, 0xa2, 0x87, 0x7b, 0x0f, 0xc0, 0x17, 0x1c, 0x6b,
+  0x14, 0xc0, 0x6b, 0x14, 0x23, 0x7e, 0x26, 0x23, 0xc0, 0x1f, 0xa2, 0x98, 0x6b, 0x2b, 0x52, 0x0c,
+  0x1b, 0xa3, 0xa8, 0x45, 0x42, 0x7e, 0x7f, 0x1c, 0x1b, 0xc1, 0x45, 0xc0, 0x5a, 0x66, 0xc0, 0x04,
+  0xfe, 0x14, 0x57, 0xc0, 0x6e, 0xc4, 0x6f, 0xc1, 0x69, 0x16, 0xc0, 0x1b, 0x22, 0xa2, 0x78, 0xc1,
+  0x6e, 0xc2, 0x33, 0xc1, 0x38, 0x33, 0x38, 0x7a, 0xa3, 0xc7, 0xa1, 0xd7, 0x9d, 0x7a, 0x9e, 0x29,
+  0x38, 0x33, 0xc0, 0x66, 0x2f, 0x7f, 0x45, 0x3b, 0x2c, 0x66, 0xc1, 0x1b, 0x7a, 0x16, 0xc0, 0x1b,
+  0xa1, 0xa8, 0xc0, 0x1b, 0x1e, 0x16, 0x1b, 0x76, 0xa2, 0xb7, 0xa2, 0x88, 0xc0, 0x79, 0x2f, 0x6e,
+  0x1e, 0x59, 0x2f, 0x46, 0x5a, 0x45, 0xc0, 0x7e, 0x24, 0x65, 0x14, 0xa1, 0xc9, 0x55, 0x1e, 0x0f,
+  0xc0, 0x7a, 0x24, 0x59, 0x42, 0x1e, 0x1d, 0x7b, 0x69, 0x1d, 0x56, 0xc0, 0x20, 0xa0, 0xa8, 0xc0,
+  0x56, 0x6e, 0x1e, 0x69, 0xc0, 0x6e, 0x23, 0x1e, 0xa2, 0x87, 0x7a, 0xc2, 0xa2, 0xa8, 0x5a, 0xc0,
+  0x6e, 0x08, 0x46, 0xc0, 0x0a, 0x2e, 0x20, 0xa2, 0x97, 0x7a, 0x3d, 0x0a, 0x3d, 0x6e, 0x0a, 0x51,
+  0x2b, 0x7f, 0x02, 0x05, 0x7f, 0x05, 0x0a, 0xc0, 0x55, 0x0a, 0x05, 0x02, 0x05, 0x0a, 0x65, 0x7f,
+  0x0a, 0x05, 0x0a, 0xc0, 0x05, 0x0a, 0x7f, 0x69, 0x0a, 0x05, 0x0d, 0xc0, 0x05, 0x0d, 0x19, 0xc0,
+  0x12, 0x7b, 0xc0, 0x19, 0xc0, 0x1c, 0x14, 0x0a, 0xc0, 0x12, 0x1c, 0x6e, 0x12, 0xc0, 0x21, 0x7a,
+  0x59, 0xc0, 0x1c, 0x21, 0x24, 0x6e, 0xc0, 0x51, 0x21, 0xa2, 0x88, 0x29, 0xc2, 0xa2, 0x88, 0xc0,
+  0x65, 0x7f, 0x65, 0x31, 0x57, 0x29, 0xc0, 0x67, 0x21, 0xc1, 0xa2, 0x87, 0x29, 0x24, 0x35, 0x24,
+  0xa2, 0x88, 0x2e, 0x3d, 0x38, 0x35, 0xa2, 0x98, 0x69, 0xc0, 0x3d, 0xc0, 0xa2, 0x98, 0xc0, 0x05,
+  0x0c, 0xc0, 0x05, 0x65, 0x00, 0x38, 0xc0, 0x00, 0x6b, 0x38, 0x00, 0x38, 0x24, 0x29, 0x5a, 0x29,
+  0x5b, 0x19, 0xc0, 0x6e, 0x19, 0x6f, 0x1e, 0x19, 0x1e, 0x25, 0x45, 0x0e, 0x25, 0x66, 0x59, 0x57,
+  0x6e, 0x25, 0xc0, 0x0e, 0x25, 0xa2, 0x98, 0x46, 0x51, 0x6e, 0x6e, 0x15, 0x22, 0x5a, 0x52, 0x1a,
+  0x1f, 0x46, 0x66, 0xc5, 0x5e, 0x0f, 0x5a, 0x5b, 0x0f, 0x1a, 0xc0, 0x14, 0x7e, 0x57, 0x56, 0x0c,
+  0x1b, 0x11, 0x6b, 0xc1, 0x1b, 0x4a, 0xa1, 0xa8, 0xa1, 0xa8, 0xc0, 0x20, 0x7a, 0xa2, 0xa8, 0x5a,
+  0x2b, 0x66, 0x56, 0xa2, 0x77, 0x2b, 0xc0, 0x9f, 0x68, 0x20, 0xc0, 0x28, 0x23, 0x28, 0x23, 0x65,
+  0x0c, 0x5a, 0xc0, 0x66, 0x5a, 0xc0, 0xfe, 0x14, 0x36, 0x6f, 0x6e, 0xc5, 0x6e, 0xc0, 0x6f, 0x1b,
+  0xc0, 0x6b, 0x27, 0x6f, 0xc1, 0x7e, 0x6f, 0x55, 0xc0, 0x7e, 0x33, 0x38, 0xc2, 0x00, 0xa2, 0xd7,
+  0x9c, 0x98, 0x9f, 0x5b, 0x38, 0x33, 0x69, 0x38, 0x33, 0x38, 0x33, 0x38, 0xa1, 0xb8, 0x65, 0x22,
+  0xc0, 0x27, 0x1b, 0xc0, 0x16, 0xc1, 0xa2, 0xb7, 0x5a, 0x1b, 0x16, 0xa2, 0x98, 0x65, 0x56, 0xa2,
+  0x98, 0xa2, 0xa7, 0x56, 0x59, 0x52, 0x49, 0xc0, 0x16, 0x29, 0x2c, 0x17, 0x56, 0x16, 0x79, 0xc0,
+  0x0f, 0x16, 0x21, 0x2c, 0x21, 0x0f, 0xc0, 0x19, 0x12, 0x56, 0x0f, 0x12, 0xa1, 0xa8, 0x7e, 0x24,
+  0x41, 0x0a, 0x24, 0xa1, 0xa8, 0x69, 0x66, 0xc0, 0x7b, 0x55, 0x41, 0x1e, 0x7e, 0x1e, 0x23, 0x26,
+  0xa2, 0x97, 0x6f, 0x66, 0xc0, 0x7e, 0x3d, 0x05, 0x6e, 0x05, 0x42, 0xa3, 0x87, 0x7e, 0x9d, 0x8a,
+  0x2f, 0x28, 0x3a, 0x6e, 0x02, 0x41, 0x3f, 0x0a, 0x36, 0x47, 0x37, 0x3a, 0x3d, 0x0a, 0x36, 0xa2,
+  0x77, 0x0a, 0x05, 0x0a, 0x02, 0xc0, 0x05, 0xc1, 0x0a, 0xc0, 0x05, 0x69, 0x0a, 0x02, 0x05, 0x0a,
+  0x05, 0xc1, 0x7e, 0xc0, 0x05, 0x0d, 0x6b, 0xa2, 0x87, 0x55, 0x0d, 0x21, 0xc0, 0x56, 0x0d, 0x19,
+  0x05, 0x02, 0x0a, 0x19, 0x0d, 0x05, 0xa3, 0x97, 0x6f, 0x12, 0x0d, 0x0a, 0x19, 0x21, 0x7e, 0x66,
+  0x29, 0xc0, 0x21, 0xc0, 0x29, 0xc2, 0x7f, 0x7e, 0x38, 0xc0, 0x65, 0x29, 0x24, 0x21, 0x24, 0x56,
+  0x19, 0x21, 0x29, 0x21, 0x24, 0x29, 0x1a, 0x1c, 0x38, 0x7f, 0x59, 0x62, 0x5d, 0x3d, 0x00, 0x46,
+  0xc0, 0x38, 0xa2, 0x87, 0x6b, 0x75, 0xa2, 0x78, 0x07, 0x3d, 0x00, 0xc0, 0x59, 0x66, 0x7b, 0xc0,
+  0x38, 0xc1, 0x21, 0xc1, 0x26, 0x21, 0x1c, 0x5e, 0x56, 0x1e, 0x6b, 0x45, 0x19, 0xa2, 0x88, 0x16,
+  0x56, 0xc1, 0x7f, 0xc0, 0x5a, 0x1d, 0x7a, 0x1a, 0x1d, 0xa3, 0x97, 0x57, 0x9e, 0x69, 0x54, 0x1a,
+  0x56, 0x5a, 0x5a, 0x7e, 0xc0, 0x55, 0x14, 0x46, 0x56, 0x09, 0x0c, 0xc4, 0xa2, 0x88, 0xc0, 0x66,
+  0x14, 0x7f, 0x69, 0x1b, 0x23, 0x20, 0x42, 0x6e, 0x6e, 0x57, 0x15, 0x7f, 0x7a, 0x55, 0x4e, 0x27,
+  0x20, 0xc0, 0xa1, 0xa8, 0xa2, 0x98, 0x56, 0x45, 0xc0, 0x23, 0xa2, 0x87, 0x2b, 0x28, 0x27, 0x6d,
+  0x7b, 0x20, 0x25, 0x28, 0x46, 0x0c, 0xa2, 0xb7, 0x23, 0x9d, 0x79, 0xc0, 0x01, 0x66, 0x01, 0xfe,
+  0x14, 0x56, 0xc0, 0x6b, 0xc0, 0x6e, 0xc6, 0x6e, 0x6b, 0x6e, 0xa2, 0x78, 0x66, 0x69, 0x7f, 0x38,
+  0xc1, 0x2c, 0x3b, 0xc1, 0x5e, 0x3b, 0x6e, 0x3d, 0xa0, 0xb7, 0x7b, 0x9e, 0x69, 0x6f, 0x38, 0x33,
+  0xc1, 0x38, 0x33, 0x7d, 0x7b, 0x34, 0x22, 0x27, 0xc0, 0x1b, 0x22, 0x16, 0x1b, 0xc0, 0x7a, 0xc0,
+  0x1b, 0x22, 0x7d, 0xa1, 0xb9, 0xa2, 0xa7, 0x9e, 0x58, 0x38, 0x7a, 0x1e, 0x66, 0x16, 0xc2, 0xa3,
+  0xb7, 0x1e, 0x0a, 0x7e, 0x1b, 0x65, 0xc0, 0x16, 0x0f, 0xa2, 0x98, 0x76, 0x0f, 0xc0, 0x1e, 0x12,
+  0x16, 0xc0, 0x0f, 0xa2, 0xb8, 0xa0, 0xa8, 0x46, 0x12, 0xc0, 0xa1, 0xa8, 0xa0, 0xa8, 0x6f, 0x23,
+  0xc1, 0x41, 0x5e, 0xa1, 0xa9, 0x66, 0x69, 0x20, 0x76, 0xa2, 0x97, 0x5f, 0x7a, 0x7e, 0x5a, 0x76,
+  0xc0, 0x02, 0x3d, 0x37, 0x3f, 0x75, 0x02, 0x3a, 0x55, 0x3a, 0x69, 0x3a, 0x5e, 0x3a, 0x36, 0x02,
+  0x2b, 0x3a, 0x3d, 0x2e, 0x33, 0x02, 0x69, 0xa1, 0xa9, 0x56, 0x02, 0x05, 0xc0, 0x6e, 0x05, 0xc1,
+  0x02, 0x05, 0xc0, 0x69, 0x36, 0xc0, 0x0a, 0x3e, 0x3d, 0x05, 0x0d, 0x0a, 0x05, 0x0a, 0x7f, 0xc0,
+  0x69, 0x0a, 0xa2, 0x98, 0x7e, 0x19, 0x66, 0x19, 0x0a, 0x36, 0xc0, 0x0a, 0x05, 0xc0, 0x0d, 0xc0,
+  0x05, 0x0a, 0x05, 0x0d, 0x7f, 0xc0, 0x29, 0x6f, 0x29, 0x51, 0x21, 0x29, 0x7e, 0x29, 0x7f, 0x31,
+  0xc0, 0x29, 0xc0, 0x6b, 0x21, 0x1c, 0x7e, 0xc0, 0x21, 0x1c, 0xc0, 0x24, 0x29, 0x7a, 0x29, 0x21,
+  0x38, 0x31, 0x6f, 0x38, 0xc1, 0x3d, 0x35, 0x29, 0xa3, 0x98, 0x7b, 0x55, 0xc0, 0xa2, 0x88, 0x00,
+  0x52, 0x38, 0x00, 0xc0, 0x3d, 0xc0, 0x00, 0xc0, 0x05, 0x3d, 0x38, 0x21, 0x5a, 0x7b, 0x1c, 0x19,
+  0x1e, 0x19, 0x1e, 0x19, 0x5a, 0xc0, 0x6b, 0x16, 0x56, 0x1d, 0x5a, 0x0b, 0x0e, 0x16, 0x1a, 0x66,
+  0x16, 0x1a, 0x7f, 0x79, 0x47, 0x45, 0x7f, 0x45, 0x7f, 0x59, 0x9f, 0x69, 0x66, 0x34, 0x0c, 0xc0,
+  0x09, 0x66, 0x1b, 0x0f, 0x4e, 0x09, 0x0e, 0x6b, 0x66, 0xa2, 0x87, 0x66, 0xa1, 0xa8, 0x5a, 0x9e,
+  0x69, 0x15, 0xa3, 0xa8, 0xa1, 0xa8, 0x7f, 0x69, 0xc0, 0x0e, 0x7e, 0x0e, 0x5a, 0x9d, 0x78, 0x7a,
+  0xa2, 0xa8, 0x56, 0x20, 0x6f, 0x02, 0xa1, 0xa8, 0x3a, 0x46, 0x34, 0x23, 0xa2, 0x87, 0x6b, 0xc0,
+  0x2f, 0x34, 0x2f, 0x20, 0x23, 0xc0, 0x0c, 0x6b, 0xa1, 0xa7, 0x04, 0x3e, 0x79, 0x0c, 0x7e, 0x11,
+  0xfe, 0x14, 0x16, 0x6e, 0xc1, 0x6f, 0xc3, 0x69, 0xc1, 0x6f, 0xc0, 0x6f, 0x6e, 0x6e, 0xc0, 0x6e,
+  0x6b, 0xc0, 0x31, 0xc0, 0x38, 0xc4, 0x31, 0x67, 0x31, 0x6e, 0x38, 0x7b, 0x38, 0xc1, 0x7e, 0x76,
+  0x59, 0x67, 0x38, 0x2c, 0xc0, 0x22, 0xc1, 0x69, 0x6e, 0x7a, 0x7f, 0x1b, 0xa1, 0xb8, 0x4b, 0x1b,
+  0x23, 0xa2, 0xc8, 0x5a, 0x32, 0x1b, 0xc0, 0x22, 0x1b, 0x16, 0x1b, 0x16, 0xa1, 0xa8, 0x1b, 0xc0,
+  0x16, 0x1b, 0xc1, 0x16, 0xc0, 0x7e, 0xc0, 0x16, 0xc2, 0x1b, 0x16, 0xc0, 0xa1, 0xa7, 0xa2, 0x98,
+  0x7a, 0x9d, 0x79, 0x7a, 0x6e, 0x7a, 0x6e, 0x20, 0xc0, 0x7e, 0x9d, 0x7a, 0x59, 0x18, 0xa1, 0xa9,
+  0x69, 0x55, 0xa2, 0x99, 0x69, 0x32, 0x7e, 0xc0, 0x2b, 0xa2, 0x98, 0x66, 0x3a, 0xc0, 0x7d, 0x3a,
+  0x6e, 0x02, 0x55, 0x2b, 0x3a, 0x79, 0x02, 0x3f, 0x56, 0x3a, 0x3f, 0x2b, 0x7a, 0x3d, 0xa2, 0x77,
+  0xc0, 0x2e, 0x3d, 0x7e, 0x02, 0x7e, 0x05, 0x0a, 0x05, 0x3d, 0x36, 0x02, 0xc0, 0xa1, 0xa8, 0x0a,
+  0xc1, 0x05, 0xc0, 0x3b, 0xc0, 0x0a, 0xc2, 0x7f, 0xc0, 0x0d, 0xc0, 0x0a, 0x0d, 0x6e, 0x19, 0x0d,
+  0xc0, 0x05, 0x02, 0xc1, 0x05, 0x0a, 0x65, 0x05, 0xc1, 0x0a, 0x0d, 0x12, 0x7b, 0xa2, 0x87, 0xc0,
+  0x56, 0x29, 0x66, 0x29, 0x6e, 0x29, 0x21, 0x24, 0x29, 0xc0, 0x21, 0xc0, 0x12, 0x1c, 0xa2, 0x88,
+  0x24, 0x21, 0x1c, 0x30, 0x29, 0xc2, 0x21, 0x24, 0x2e, 0xc0, 0x6b, 0x7e, 0x35, 0xc0, 0x56, 0x2e,
+  0xa1, 0xa9, 0xc2, 0x6e, 0x52, 0x30, 0x38, 0x69, 0xc1, 0x38, 0xc1, 0x2e, 0x3d, 0x6b, 0x2d, 0x19,
+  0x6e, 0x19, 0x21, 0x5b, 0x19, 0xc1, 0x5e, 0x66, 0x6b, 0x59, 0x7f, 0x41, 0x5e, 0x03, 0x0b, 0x13,
+  0x67, 0x0b, 0x13, 0x6b, 0x5f, 0xc0, 0x69, 0x67, 0x49, 0x5a, 0xa0, 0xa8, 0x57, 0x9f, 0x48, 0x2c,
+  0xa2, 0xb8, 0xa1, 0xa9, 0x41, 0xc1, 0xa2, 0x88, 0x5a, 0x55, 0xc0, 0x11, 0x15, 0x4a, 0x15, 0x7e,
+  0x6b, 0x1d, 0x24, 0xa2, 0x97, 0xa2, 0xa7, 0x5b, 0x07, 0xa2, 0x88, 0x9d, 0x89, 0x7f, 0xa2, 0x86,
+  0x07, 0x55, 0xa2, 0x98, 0x66, 0x52, 0x6e, 0x3f, 0x07, 0x65, 0x02, 0xc0, 0x45, 0x56, 0x7b, 0x5a,
+  0x7e, 0xc1, 0x28, 0x18, 0x11, 0x66, 0x04, 0xc1, 0x5a, 0xc0, 0x76, 0x0c, 0x7f, 0x1e, 0x69, 0xfe,
+  0x13, 0xf4, 0x6b, 0x6f, 0xc0, 0x6e, 0xc1, 0x6b, 0x05, 0xc0, 0x6e, 0xc0, 0x6f, 0x6f, 0x7e, 0x55,
+  0xc3, 0x6f, 0x6e, 0xc2, 0x7a, 0x5e, 0x6b, 0xa0, 0xa7, 0x5b, 0x38, 0x2c, 0xc0, 0x31, 0x77, 0x5a,
+  0x38, 0xc0, 0xa1, 0xa9, 0x6d, 0x2c, 0x33, 0x36, 0x2c, 0xc0, 0x27, 0xc1, 0x69, 0x27, 0x2a, 0x66,
+  0x27, 0xa2, 0xb7, 0xa0, 0xa8, 0xa0, 0x58, 0x3d, 0x7e, 0x3a, 0x2f, 0x27, 0x1b, 0x27, 0x1b, 0x16,
+  0x1b, 0xc0, 0x22, 0x20, 0xc0, 0x1b, 0x16, 0xc1, 0x1b, 0xc1, 0x20, 0xc0, 0x1b, 0x67, 0x16, 0xc2,
+  0x65, 0x7e, 0x6e, 0x12, 0x7a, 0x12, 0xc0, 0xa0, 0xa8, 0x6e, 0x7a, 0x57, 0x15, 0x6e, 0xa1, 0xa8,
+  0x76, 0x20, 0x18, 0xa1, 0xa9, 0x7d, 0x6e, 0x7f, 0xc0, 0x56, 0xa1, 0xa8, 0xc2, 0x66, 0x5a, 0xc1,
+  0x37, 0x30, 0x02, 0xc0, 0x69, 0x3f, 0x37, 0x03, 0x37, 0x76, 0x3a, 0x37, 0xa2, 0xa8, 0x65, 0x45,
+  0x2b, 0x3a, 0x02, 0x7e, 0x7e, 0x0a, 0x05, 0x3d, 0x33, 0x3a, 0x05, 0xc0, 0x3b, 0xc0, 0xa1, 0xa9,
+  0xc0, 0x05, 0x02, 0x05, 0x0d, 0x05, 0x0d, 0x12, 0x0a, 0xc0, 0x0d, 0x0a, 0xc0, 0x05, 0x7f, 0x0d,
+  0x0a, 0xc0, 0x51, 0x0a, 0x02, 0x36, 0x05, 0x0a, 0xc0, 0x05, 0x0a, 0x05, 0x02, 0xa2, 0x98, 0x0a,
+  0x12, 0xa1, 0xa9, 0xc0, 0x6e, 0xc0, 0x56, 0x29, 0x21, 0x12, 0x21, 0x29, 0x6b, 0x21, 0x12, 0x19,
+  0x21, 0x30, 0x7a, 0x24, 0x21, 0x29, 0xc1, 0x21, 0x24, 0x12, 0x19, 0x0d, 0xa4, 0x88, 0x79, 0x30,
+  0x7e, 0xc1, 0x24, 0x5e, 0x21, 0xa4, 0x97, 0x55, 0x7b, 0x05, 0x41, 0x21, 0x30, 0x29, 0x2e, 0x7f,
+  0x38, 0x30, 0x35, 0x26, 0x35, 0x30, 0xc0, 0x19, 0x6e, 0x19, 0x1e, 0x19, 0x6b, 0x49, 0xc0, 0x7a,
+  0xc1, 0x6f, 0x7a, 0x13, 0x46, 0x67, 0x08, 0x0a, 0x6e, 0xc0, 0x57, 0xa3, 0xa7, 0xa2, 0x97, 0x46,
+  0x42, 0x5a, 0x66, 0x18, 0x69, 0x46, 0x46, 0xa1, 0xb8, 0x18, 0x41, 0xc1, 0x13, 0x4a, 0x5a, 0x0d,
+  0x6e, 0x7a, 0x6b, 0xa2, 0x87, 0x7e, 0x7e, 0x53, 0xa2, 0x66, 0xa1, 0xb9, 0xa1, 0xb7, 0x56, 0x47,
+  0x7a, 0x6d, 0x03, 0x79, 0x07, 0x52, 0x7e, 0xa3, 0xa8, 0x41, 0x3f, 0x0a, 0xa2, 0xa8, 0x45, 0x52,
+  0x02, 0x45, 0x57, 0xc0, 0x7e, 0x30, 0x7e, 0x2f, 0x55, 0x65, 0x47, 0x59, 0x01, 0x5a, 0xc0, 0x01,
+  0xc0, 0x75, 0x5e, 0xa0, 0xa9, 0xa2, 0x97, 0x11, 0xa1, 0xc9, 0xfe, 0x13, 0xd4, 0x65, 0x28, 0x6e,
+  0x6f, 0xc1, 0x6e, 0xc2, 0x6f, 0xc0, 0x6e, 0xa3, 0x98, 0x42, 0xc0, 0x66, 0xc1, 0x1b, 0xc1, 0x6b,
+  0x7a, 0x5d, 0xc0, 0x7b, 0x7e, 0x5a, 0x5a, 0x2a, 0x5a, 0x2c, 0xc0, 0x2f, 0x5e, 0xc0, 0x7b, 0x5a,
+  0x31, 0xa0, 0xa9, 0x7a, 0x59, 0x2c, 0x27, 0xc0, 0x3b, 0xa0, 0xa7, 0x27, 0x1b, 0x27, 0xc0, 0x2f,
+  0xa2, 0xb7, 0xa1, 0xb9, 0x7e, 0x1a, 0x9d, 0x59, 0x20, 0x2a, 0x20, 0x27, 0x1b, 0xc0, 0x16, 0x1b,
+  0xc0, 0x2a, 0x2f, 0x27, 0x66, 0xc2, 0x1b, 0xc1, 0x2f, 0x27, 0x22, 0x1b, 0x16, 0xc0, 0x1b, 0x0a,
+  0xc0, 0x6b, 0x0f, 0x7a, 0x6b, 0x0a, 0xa2, 0xb7, 0x6f, 0x42, 0x0a, 0x76, 0xa3, 0x97, 0x66, 0x20,
+  0x4a, 0x1d, 0xa0, 0xa8, 0x6e, 0xa2, 0x98, 0x46, 0xc0, 0x3f, 0x7a, 0x56, 0xc0, 0x3f, 0x02, 0x3a,
+  0x5a, 0x3a, 0xa2, 0x78, 0x37, 0x3a, 0x3f, 0x3a, 0x7a, 0x4e, 0xa2, 0x78, 0x62, 0x3c, 0x37, 0x03,
+  0x3a, 0x3d, 0x59, 0x37, 0x3f, 0x3a, 0x3d, 0xc1, 0xa2, 0x87, 0x3d, 0xc0, 0x0a, 0x51, 0x33, 0x36,
+  0xc0, 0x7f, 0x7e, 0x66, 0x36, 0x33, 0x05, 0x0a, 0x7b, 0x0d, 0x05, 0x0a, 0xc0, 0x05, 0x02, 0x0a,
+  0x0d, 0x08, 0x0a, 0x3a, 0x65, 0x02, 0x62, 0x3d, 0x05, 0xc0, 0x69, 0x36, 0x0a, 0xc1, 0x6b, 0x0a,
+  0x7f, 0x7a, 0x7e, 0xa2, 0x87, 0x5a, 0x52, 0x19, 0x79, 0x21, 0xc3, 0x55, 0x1c, 0x21, 0xc0, 0x24,
+  0x1c, 0x5e, 0x21, 0x7e, 0x21, 0x1c, 0xc0, 0x19, 0xc0, 0x59, 0xa3, 0xa9, 0x66, 0x35, 0x29, 0xa2,
+  0x88, 0x66, 0x52, 0x21, 0x3d, 0xc0, 0x2e, 0x38, 0x7e, 0x30, 0x19, 0xa2, 0x87, 0x30, 0x3d, 0x7e,
+  0x30, 0x5a, 0x26, 0x30, 0x2d, 0x21, 0x5b, 0x19, 0xc0, 0x1e, 0x5a, 0x66, 0x25, 0x41, 0x6e, 0x7f,
+  0xc0, 0x6d, 0x56, 0x13, 0x5b, 0x55, 0x5b, 0x5a, 0x66, 0xa2, 0x98, 0x0c, 0x01, 0xa4, 0xa7, 0xa2,
+  0xa8, 0x9d, 0x7a, 0x5c, 0x53, 0x56, 0x1b, 0x10, 0x49, 0x10, 0x18, 0x9e, 0x68, 0x56, 0x03, 0x7b,
+  0x10, 0x7d, 0x4b, 0x6f, 0xa1, 0xb8, 0x5b, 0xa2, 0x96, 0xa1, 0xa9, 0x7a, 0x6e, 0x42, 0x39, 0xa1,
+  0xa8, 0xa2, 0x98, 0x9d, 0x9a, 0xa2, 0x87, 0x69, 0x56, 0xa2, 0x98, 0x45, 0x9d, 0x8a, 0x5a, 0x0e,
+  0x79, 0x46, 0x37, 0x07, 0x0a, 0x65, 0x02, 0x45, 0x28, 0x30, 0x42, 0x7f, 0x6d, 0x76, 0x20, 0x11,
+  0x7b, 0x9f, 0x68, 0x3b, 0xa1, 0xc8, 0x06, 0x36, 0xa1, 0xb8, 0x06, 0x52, 0x7a, 0x0c, 0x5a, 0x0c,
+  0xa2, 0xa8, 0xfe, 0x13, 0xf4, 0x66, 0x2d, 0x28, 0x66, 0xc0, 0x28, 0x2d, 0x6b, 0x6d, 0x6b, 0x6e,
+  0x6f, 0xc0, 0xa2, 0x77, 0x6b, 0x65, 0xc0, 0x0a, 0x0f, 0xc0, 0x0a, 0x7a, 0x0f, 0x6b, 0x1b, 0x6e,
+  0x1b, 0x16, 0xc0, 0x1b, 0x20, 0xa1, 0xa8, 0x5a, 0x1b, 0x6f, 0xc0, 0x6e, 0xc1, 0x7a, 0xa2, 0xa7,
+  0xa2, 0xa7, 0x67, 0x5a, 0x46, 0x9e, 0x59, 0x7e, 0xa0, 0xa8, 0x2c, 0xa1, 0xb8, 0xc0, 0x2f, 0x7a,
+  0x3a, 0xa1, 0xa8, 0x14, 0xa0, 0xa8, 0x01, 0x20, 0x27, 0x66, 0x27, 0x7a, 0x27, 0x22, 0xc0, 0x27,
+  0x1b, 0x2f, 0x2a, 0x27, 0x22, 0x27, 0xc0, 0x1b, 0xc0, 0x27, 0x22, 0x2c, 0xc0, 0x27, 0x1b, 0xc1,
+  0x16, 0x1b, 0x16, 0x1b, 0xa0, 0xa7, 0x7b, 0xc0, 0xa0, 0xa8, 0x49, 0x4a, 0x66, 0x6b, 0x79, 0x12,
+  0xa2, 0xb7, 0x6b, 0xa1, 0xa8, 0x4a, 0x7a, 0xa2, 0x88, 0xc0, 0x2f, 0x3a, 0x6e, 0x3a, 0x7f, 0x6d,
+  0x3f, 0x37, 0x7f, 0xa2, 0x97, 0x5a, 0x37, 0x6f, 0x69, 0x37, 0xc0, 0x3c, 0x03, 0xa3, 0xa8, 0x9e,
+  0x68, 0x56, 0x03, 0x74, 0x7b, 0x55, 0x28, 0x3d, 0x6e, 0x2e, 0x3a, 0x66, 0x33, 0x37, 0x3f, 0xa0,
+  0xa8, 0x55, 0x02, 0x36, 0x05, 0x7a, 0x05, 0xc0, 0x36, 0xc0, 0x05, 0x6e, 0x7f, 0x65, 0x05, 0x0d,
+  0x0a, 0x05, 0xc0, 0x0d, 0x7f, 0x05, 0x36, 0x35, 0x59, 0x02, 0x79, 0x05, 0xc0, 0x36, 0xc0, 0x7b,
+  0x36, 0x0d, 0xc0, 0x0a, 0x07, 0x0d, 0x6e, 0x7f, 0xa2, 0x98, 0x55, 0x19, 0x12, 0x1c, 0xc0, 0x0d,
+  0x19, 0x21, 0xc0, 0x5a, 0x19, 0x79, 0x0d, 0x21, 0xc0, 0x12, 0x21, 0x7a, 0x1c, 0x19, 0x0a, 0x19,
+  0x56, 0x29, 0xa2, 0x88, 0x56, 0xc0, 0x29, 0xc0, 0x35, 0xc0, 0x66, 0xa2, 0x98, 0x9e, 0x67, 0xc0,
+  0x38, 0x07, 0x9d, 0x89, 0x19, 0x35, 0x69, 0x3d, 0x30, 0x21, 0xc0, 0x26, 0x6f, 0x1e, 0x19, 0x16,
+  0x11, 0xa2, 0x77, 0x1e, 0x16, 0xc0, 0x56, 0x6f, 0x7a, 0x5e, 0x55, 0x1a, 0xc0, 0x45, 0x6b, 0xc0,
+  0x4a, 0x55, 0xa3, 0xa8, 0x7b, 0x9e, 0x69, 0x6d, 0xa2, 0xb8, 0x4b, 0x51, 0xa3, 0x97, 0x9d, 0x7a,
+  0x41, 0xa3, 0xa8, 0x10, 0x3e, 0x7e, 0x57, 0x5d, 0x6b, 0x15, 0x7f, 0x41, 0xa2, 0x87, 0x2c, 0xa2,
+  0x98, 0x5a, 0xc0, 0xa2, 0xb7, 0x41, 0x6e, 0x3f, 0x03, 0x69, 0x03, 0x55, 0xc0, 0xa2, 0xa7, 0x6b,
+  0xc0, 0x16, 0x42, 0x1a, 0xc0, 0x3f, 0x7a, 0x7e, 0x02, 0x49, 0x02, 0xc0, 0x9e, 0x69, 0x23, 0xa2,
+  0x87, 0x7b, 0x9f, 0x68, 0x66, 0x2f, 0x20, 0x18, 0x09, 0x3e, 0x46, 0x66, 0xa3, 0x97, 0x01, 0x3b,
+  0x3e, 0x33, 0xc0, 0x01, 0xa1, 0xa9, 0x01, 0x7a, 0x5e, 0xfe, 0x13, 0xb4, 0xa2, 0x77, 0xc0, 0x61,
+  0x6f, 0xc0, 0x61, 0xc0, 0x1c, 0x6e, 0xa3, 0x79, 0x6e, 0x6f, 0x6e, 0x0f, 0x7a, 0x61, 0x3e, 0xc0,
+  0x03, 0x3e, 0x66, 0x3e, 0x03, 0x6b, 0x7f, 0x6e, 0x14, 0x0f, 0x62, 0x3e, 0x0a, 0xa2, 0x87, 0x7b,
+  0x0f, 0x6f, 0xc0, 0x6e, 0xc0, 0x1b, 0xc0, 0xa3, 0x98, 0xa2, 0xc7, 0x7f, 0x7e, 0x7a, 0x9c, 0x49,
+  0xa0, 0x58, 0x37, 0x6b, 0x34, 0xa0, 0xa9, 0xa2, 0xa7, 0x46, 0x3e, 0x09, 0x66, 0x37, 0x7f, 0xa0,
+  0xa8, 0x9d, 0x69, 0x5a, 0x20, 0x2a, 0x27, 0xc0, 0x66, 0x27, 0xc1, 0x6e, 0xc4, 0x27, 0x22, 0x27,
+  0x2c, 0xc0, 0x27, 0x22, 0x27, 0x22, 0xc1, 0x27, 0x1e, 0x1b, 0x21, 0xc1, 0x1e, 0x21, 0xa1, 0xa8,
+  0x41, 0x12, 0xa1, 0xb9, 0xc0, 0x59, 0xa4, 0xb8, 0x4a, 0x41, 0xa1, 0xb9, 0xc0, 0x59, 0x52, 0x06,
+  0x69, 0x6e, 0xa1, 0xa9, 0x51, 0x3c, 0x0e, 0x6e, 0x06, 0x5a, 0x7e, 0x08, 0x03, 0xc0, 0x3c, 0xc0,
+  0xa2, 0xa9, 0x9f, 0x58, 0x66, 0x0b, 0x03, 0x65, 0x7b, 0x54, 0x7a, 0x02, 0x69, 0xc0, 0x2e, 0x2b,
+  0x3f, 0x66, 0x69, 0x3f, 0x02, 0x7a, 0x7e, 0x5a, 0x62, 0xc0, 0x59, 0x05, 0xc0, 0x0a, 0xc0, 0x02,
+  0x05, 0x0d, 0x0a, 0xc1, 0x7e, 0x0d, 0x3b, 0x0a, 0x52, 0x2e, 0x33, 0xa3, 0x98, 0x0a, 0xc0, 0x36,
+  0x3d, 0x05, 0xc2, 0x02, 0x7f, 0x7a, 0x12, 0x7f, 0x7e, 0x21, 0x56, 0xc1, 0x14, 0x19, 0x12, 0x21,
+  0x6e, 0x19, 0xc0, 0x05, 0x0d, 0x19, 0x21, 0xc0, 0x29, 0x21, 0x19, 0x0a, 0x12, 0x21, 0x9d, 0x9a,
+  0x29, 0x6e, 0x7b, 0xc0, 0x46, 0x7f, 0x7e, 0x26, 0x7f, 0x66, 0x26, 0x30, 0xa2, 0x87, 0x38, 0x30,
+  0x21, 0x7a, 0x35, 0x41, 0x67, 0x2d, 0x1e, 0x6e, 0x1e, 0xc0, 0x5b, 0x16, 0xc0, 0x1d, 0x13, 0x0b,
+  0x08, 0x03, 0xa2, 0x98, 0xa2, 0x77, 0x1f, 0x46, 0x0c, 0x7a, 0xc0, 0x14, 0x0c, 0x46, 0xa2, 0x97,
+  0xa3, 0xb8, 0x46, 0x9f, 0x69, 0xa1, 0xa8, 0xa0, 0xa8, 0x9e, 0x38, 0x77, 0x1a, 0x0d, 0x5a, 0x59,
+  0x0a, 0x0d, 0x46, 0x00, 0xa0, 0xb9, 0xa2, 0x68, 0x69, 0xa1, 0xa9, 0x7a, 0x7e, 0x7e, 0x7f, 0x34,
+  0x7f, 0x3c, 0x57, 0x6e, 0x55, 0xa3, 0xb8, 0x66, 0x34, 0x7a, 0x13, 0x7a, 0x55, 0x9f, 0x69, 0x34,
+  0xa1, 0xa8, 0x9f, 0x68, 0x37, 0xa1, 0xa8, 0x07, 0x5a, 0x62, 0xa4, 0x96, 0x67, 0x9c, 0x59, 0xa3,
+  0xb8, 0x2f, 0x25, 0x3c, 0x9d, 0x89, 0x28, 0x55, 0x09, 0x01, 0x14, 0x5b, 0x9e, 0x48, 0x66, 0xc0,
+  0x38, 0x33, 0x7a, 0x6e, 0xc0, 0x7e, 0x0c, 0xc0, 0x3e, 0x42, 0xfe, 0x13, 0x93, 0x6e, 0xc0, 0x17,
+  0xa2, 0x78, 0xa2, 0x77, 0x28, 0x1c, 0x6e, 0x7f, 0xa2, 0x78, 0xc0, 0x5e, 0x6f, 0x66, 0x65, 0x66,
+  0xc0, 0x3e, 0xc0, 0x39, 0xc1, 0x03, 0x3e, 0xa2, 0x99, 0x59, 0x03, 0x3e, 0x39, 0xc1, 0x03, 0x3e,
+  0xa3, 0x78, 0x6b, 0x66, 0x1b, 0xc3, 0xa2, 0x78, 0x7a, 0x7a, 0xa2, 0xa7, 0x7a, 0x4a, 0xa0, 0xa9,
+  0x4a, 0x2c, 0x7f, 0xa2, 0xb7, 0x3b, 0xc0, 0x7a, 0xa1, 0xb8, 0x2c, 0x3b, 0xa2, 0xc7, 0x2f, 0x56,
+  0x69, 0x27, 0xc0, 0x2c, 0x27, 0x2c, 0x27, 0xc0, 0x6f, 0x7a, 0x3e, 0x2c, 0xc1, 0x6f, 0xc0, 0x2c,
+  0xc1, 0x27, 0xc4, 0x2f, 0xa0, 0xa9, 0x45, 0xc0, 0x1b, 0x16, 0xc1, 0x7e, 0x7a, 0x7a, 0x1e, 0xc0,
+  0xa2, 0x98, 0xa3, 0xb7, 0xc0, 0x9d, 0x69, 0x7a, 0xa1, 0xa9, 0x7e, 0x41, 0x31, 0x08, 0x03, 0x7a,
+  0x34, 0x6f, 0x79, 0x66, 0x5b, 0x2e, 0xa1, 0xa8, 0x00, 0x03, 0xc0, 0x3c, 0xc0, 0x0b, 0x05, 0x00,
+  0x31, 0x00, 0x03, 0x34, 0x37, 0x7a, 0xc1, 0x7a, 0x49, 0x66, 0xa2, 0x98, 0x3d, 0x2b, 0x37, 0x3d,
+  0x02, 0x7a, 0xc0, 0x55, 0x66, 0x02, 0x05, 0xc0, 0x6e, 0x05, 0x0a, 0xc0, 0x05, 0x36, 0x02, 0x0a,
+  0xc0, 0x41, 0x3a, 0x3d, 0x33, 0x3d, 0x36, 0x6e, 0xc1, 0x36, 0x02, 0x05, 0x0a, 0xc1, 0x02, 0xa1,
+  0xa9, 0x6e, 0x65, 0x7f, 0x6e, 0x19, 0x0d, 0x6e, 0x14, 0x1c, 0x19, 0xc2, 0x12, 0x0a, 0xc0, 0x14,
+  0x0d, 0x1c, 0xc0, 0x19, 0x0d, 0x19, 0x0a, 0xa3, 0xa9, 0x21, 0xc0, 0x6f, 0x79, 0x7f, 0x2d, 0xc0,
+  0xa2, 0x97, 0x7a, 0x46, 0xc0, 0x30, 0xc0, 0x21, 0x6e, 0x21, 0xc0, 0x35, 0x30, 0x2d, 0x56, 0x7a,
+  0x26, 0x56, 0x56, 0x19, 0x25, 0x56, 0x16, 0x5f, 0x66, 0x10, 0x08, 0x46, 0x7a, 0xa2, 0x98, 0x6e,
+  0x1f, 0x1a, 0x1c, 0x0c, 0x4a, 0xa1, 0xb8, 0x0c, 0x5b, 0xa3, 0xa7, 0xa1, 0xb8, 0x9e, 0x6a, 0x7e,
+  0x6e, 0x59, 0x9d, 0x6a, 0x56, 0x12, 0x5a, 0x12, 0x9e, 0x68, 0xa1, 0xb9, 0x0f, 0x45, 0x0f, 0xa2,
+  0xb8, 0xc0, 0x4a, 0x37, 0xa3, 0x98, 0x56, 0x9e, 0x68, 0x7a, 0x7e, 0xc0, 0x57, 0x37, 0x5e, 0x31,
+  0xa2, 0xa7, 0xc0, 0x7b, 0x69, 0x7b, 0x3c, 0x2c, 0x5a, 0x9f, 0x68, 0xa1, 0xc8, 0xa1, 0xb8, 0x28,
+  0x37, 0xa2, 0x96, 0xa1, 0xa9, 0x56, 0xa1, 0xa8, 0x9e, 0x69, 0xa2, 0x96, 0x00, 0x9a, 0x2a, 0xa1,
+  0xc9, 0x7a, 0x7e, 0xc0, 0x0c, 0x3e, 0x7a, 0xa4, 0xc7, 0x5a, 0x38, 0x65, 0x38, 0x66, 0x7e, 0x00,
+  0x09, 0x23, 0x9f, 0x68, 0x0f, 0x3e, 0x66, 0x06, 0xfe, 0x13, 0xb3, 0xc4, 0x6e, 0xc1, 0xa3, 0x99,
+  0xc0, 0x4a, 0x61, 0x6b, 0x3e, 0xc0, 0x66, 0xc3, 0x3e, 0x65, 0xc0, 0x7f, 0x6e, 0x3e, 0x39, 0xc1,
+  0x3e, 0x01, 0x04, 0x01, 0x06, 0x5a, 0xc0, 0x6b, 0x6e, 0x6f, 0x7a, 0x0f, 0xa1, 0x8a, 0x1b, 0xc0,
+  0x66, 0xa3, 0x88, 0xa2, 0xa7, 0xa3, 0xb8, 0xa1, 0xa8, 0x24, 0x9b, 0x4a, 0x5b, 0xc0, 0xa1, 0xb8,
+  0x6e, 0xa2, 0x98, 0x9d, 0x69, 0x33, 0x6d, 0x62, 0x6e, 0x27, 0xc0, 0x2c, 0x33, 0xc0, 0x31, 0x6b,
+  0x31, 0x2c, 0x3b, 0x7a, 0x38, 0x33, 0xc0, 0xa2, 0x87, 0xc0, 0x2c, 0xc1, 0x27, 0x33, 0x27, 0x2c,
+  0xc1, 0xa0, 0xa9, 0xa1, 0xa7, 0x4e, 0x62, 0xc0, 0x27, 0x1b, 0xc0, 0x7f, 0xc0, 0x22, 0xa2, 0xa6,
+  0x7b, 0x46, 0xa2, 0x96, 0xa2, 0xa8, 0x9c, 0x59, 0x1e, 0x6e, 0xa2, 0xc7, 0xa1, 0xb9, 0x9d, 0x49,
+  0x6f, 0xa1, 0xc8, 0x6e, 0x45, 0x26, 0x36, 0xa1, 0xc9, 0x46, 0x35, 0x3d, 0x7a, 0x26, 0x38, 0x0b,
+  0x06, 0x6d, 0x39, 0x7f, 0x26, 0x3d, 0xa2, 0xa8, 0x38, 0x3c, 0x76, 0x5a, 0xc0, 0x3a, 0x37, 0x65,
+  0xa1, 0xa8, 0x6f, 0x3a, 0x59, 0x3a, 0xc0, 0x7a, 0x7a, 0x2b, 0xa2, 0x87, 0xa1, 0xa9, 0x36, 0x7f,
+  0xc0, 0x0a, 0x05, 0xc1, 0x36, 0x56, 0x6e, 0x3d, 0x33, 0x2e, 0x2b, 0x30, 0x3d, 0x33, 0x30, 0x2e,
+  0x6b, 0x33, 0x02, 0x05, 0xc0, 0x59, 0x05, 0xa2, 0x88, 0x0a, 0x05, 0x0a, 0x19, 0x65, 0xc0, 0x19,
+  0x0d, 0x6b, 0x0d, 0xa2, 0x88, 0xc0, 0x0d, 0x05, 0x0d, 0x19, 0x14, 0x5d, 0x7a, 0x19, 0x12, 0x0d,
+  0x19, 0x6e, 0x19, 0xa2, 0x87, 0x19, 0x21, 0x26, 0x6b, 0x21, 0x19, 0x26, 0x7a, 0x7f, 0xc0, 0x5a,
+  0x5a, 0x9d, 0xa9, 0x19, 0x26, 0x2d, 0x21, 0x26, 0x32, 0x2d, 0xc1, 0x7a, 0x4a, 0x55, 0x2d, 0x41,
+  0x0e, 0x1b, 0x6f, 0x56, 0x10, 0x08, 0x6b, 0x5a, 0x7e, 0x17, 0xa2, 0x88, 0x1f, 0x5a, 0x14, 0x7f,
+  0xc0, 0x9f, 0x69, 0x1d, 0xa2, 0xa7, 0x57, 0x5a, 0x79, 0x2f, 0x2c, 0x9e, 0x68, 0x5a, 0x7e, 0x7e,
+  0x9d, 0x7a, 0x5a, 0x7e, 0x52, 0x12, 0x2c, 0xc0, 0x5a, 0xa3, 0xb8, 0x55, 0xa1, 0xa8, 0x0b, 0x46,
+  0x65, 0xa2, 0x97, 0x57, 0x3c, 0xa2, 0xa8, 0x5a, 0x9d, 0x89, 0x00, 0x03, 0x79, 0x3c, 0xc0, 0x9d,
+  0x7a, 0x5e, 0xa1, 0xa8, 0x15, 0x2b, 0x37, 0x24, 0x28, 0xa2, 0x97, 0x7b, 0x55, 0x28, 0x1d, 0x7e,
+  0x9d, 0x69, 0xc0, 0x52, 0x3e, 0xa2, 0xa7, 0x56, 0x3e, 0x36, 0x09, 0xa0, 0xa8, 0x9e, 0x39, 0xc0,
+  0x36, 0x6e, 0x6b, 0xa1, 0xa7, 0x3e, 0x11, 0xa3, 0xc9, 0x1d, 0x02, 0x7e, 0xa0, 0xb8, 0x06, 0xfe,
+  0x13, 0x92, 0x6f, 0xc1, 0x66, 0xc0, 0x1c, 0x6e, 0x6f, 0xa2, 0x97, 0x5a, 0x5b, 0x66, 0x66, 0x6d,
+  0x39, 0xc4, 0x3e, 0x7a, 0x7e, 0xc0, 0x3a, 0x32, 0x39, 0xc1, 0x6d, 0x09, 0x76, 0x09, 0x66, 0x09,
+  0x01, 0x2d, 0x3e, 0x6e, 0x6b, 0x3e, 0xa2, 0x79, 0x7e, 0x66, 0x16, 0xa2, 0x77, 0x6b, 0xa1, 0xb9,
+  0xa3, 0xa7, 0x6d, 0x9d, 0x5b, 0x56, 0xa1, 0xa7, 0xa1, 0xa9, 0x46, 0x5e, 0xc0, 0x56, 0xc0, 0x33,
+  0x27, 0x33, 0xc3, 0x3b, 0x55, 0x38, 0xa1, 0xb9, 0x3e, 0x2c, 0x38, 0xc1, 0x69, 0xa1, 0xa9, 0x3e,
+  0x2c, 0x38, 0xc3, 0x2c, 0xc0, 0x3b, 0xa0, 0xb7, 0x5b, 0x49, 0xa0, 0xa8, 0x46, 0x66, 0x3a, 0x01,
+  0x2f, 0x27, 0xa1, 0xc8, 0x3d, 0x9d, 0x69, 0xa1, 0xb8, 0xa2, 0x97, 0x38, 0x5a, 0x55, 0xa1, 0xa8,
+  0xa4, 0xb7, 0x3d, 0x9d, 0x69, 0xa2, 0xa7, 0xa1, 0xb9, 0xa2, 0x87, 0x35, 0x3d, 0xa3, 0xb8, 0x52,
+  0x49, 0xc0, 0x7a, 0x3a, 0xa0, 0xa8, 0xa2, 0xa8, 0x55, 0x00, 0x26, 0x00, 0xc0, 0x08, 0x1a, 0x7a,
+  0x0b, 0x31, 0xa2, 0x78, 0x0b, 0x51, 0x45, 0x66, 0xa1, 0xa8, 0xa2, 0x97, 0x56, 0x2b, 0x7f, 0x6e,
+  0x7a, 0x61, 0x9f, 0x68, 0x37, 0xa0, 0xa8, 0x69, 0xc0, 0x02, 0xc0, 0x3d, 0x02, 0x3d, 0x3a, 0x59,
+  0x2b, 0x7a, 0x3a, 0x33, 0x2e, 0x2b, 0x33, 0xc0, 0x2b, 0xc0, 0x3a, 0xc0, 0x36, 0x02, 0xc0, 0x36,
+  0xa2, 0x88, 0xa2, 0x88, 0x0a, 0x66, 0xa2, 0x88, 0x66, 0x19, 0xc0, 0x69, 0x66, 0x19, 0xc0, 0x7e,
+  0x66, 0x21, 0x0d, 0x19, 0x59, 0x0a, 0x5a, 0x7f, 0x19, 0xc0, 0x21, 0xc0, 0x0d, 0x19, 0xc0, 0x14,
+  0x19, 0x21, 0x6f, 0x19, 0xc0, 0xa3, 0x98, 0x2d, 0x56, 0x19, 0x2d, 0x45, 0x19, 0x1e, 0xa3, 0x98,
+  0x7a, 0x2d, 0x21, 0xa2, 0x78, 0x35, 0xc0, 0x32, 0x25, 0x6e, 0x32, 0x2a, 0x41, 0x57, 0x1a, 0x5a,
+  0xc1, 0x5a, 0x7b, 0xc0, 0x5a, 0x17, 0x6f, 0x1b, 0x5a, 0xa1, 0xa7, 0xa2, 0x98, 0x9f, 0x69, 0x6b,
+  0x7d, 0x7b, 0x9e, 0x68, 0x9e, 0x69, 0xa3, 0xa7, 0xa0, 0xa8, 0x56, 0x9f, 0x59, 0x0a, 0x5d, 0xa0,
+  0xa9, 0x0f, 0xa1, 0xb9, 0x6e, 0xc0, 0x7e, 0x7a, 0x29, 0xa2, 0x98, 0xa0, 0xa8, 0x49, 0x37, 0xc0,
+  0x39, 0xa2, 0x98, 0x52, 0x34, 0xa3, 0xa8, 0xa2, 0x86, 0x42, 0x52, 0x03, 0x3c, 0x39, 0x67, 0xa0,
+  0x57, 0x0f, 0x22, 0x51, 0xa2, 0xc8, 0xa4, 0x97, 0x1d, 0x20, 0x33, 0x5a, 0x1b, 0x1c, 0x9e, 0x5a,
+  0x41, 0x3e, 0x23, 0x42, 0x9e, 0x47, 0xc0, 0xa2, 0xb8, 0x7e, 0x46, 0x09, 0x7a, 0x09, 0x9f, 0x59,
+  0x01, 0x13, 0x09, 0x11, 0x20, 0x42, 0x20, 0x46, 0x9f, 0x58, 0x67, 0x38, 0x06, 0x38, 0xfe, 0x13,
+  0x92, 0x6f, 0xc4, 0x6e, 0xa2, 0x89, 0x6d, 0x5a, 0x67, 0x6e, 0xc0, 0x61, 0x6e, 0x39, 0x3e, 0x32,
+  0x3e, 0xc0, 0x39, 0xa2, 0x97, 0x7a, 0x4a, 0x66, 0x2d, 0xc1, 0x39, 0x32, 0x01, 0x09, 0x59, 0x76,
+  0x01, 0xc0, 0x2d, 0xc0, 0x01, 0x06, 0x37, 0x6f, 0x6f, 0x6b, 0x6d, 0x0f, 0x6f, 0x6e, 0x6b, 0x6e,
+  0x6e, 0xa0, 0xa9, 0xa2, 0xb8, 0x46, 0x9f, 0x58, 0x2c, 0x6b, 0x2c, 0xc0, 0x38, 0xc0, 0x33, 0x38,
+  0xc1, 0x33, 0xa2, 0x87, 0x66, 0x31, 0xa1, 0xa9, 0x00, 0x31, 0x2c, 0x33, 0x2c, 0x31, 0x00, 0x2c,
+  0x3b, 0x38, 0xc3, 0x76, 0x69, 0x2c, 0xa2, 0xa8, 0x75, 0xa0, 0x58, 0x7a, 0x52, 0x2f, 0x37, 0x2f,
+  0x27, 0x20, 0x14, 0xa1, 0xa9, 0xa1, 0xa9, 0x5a, 0x69, 0xa1, 0xa9, 0x7e, 0x2e, 0x26, 0xa4, 0xb7,
+  0x00, 0x9d, 0x5a, 0x20, 0x35, 0x08, 0x66, 0x08, 0x10, 0x5a, 0x5b, 0x65, 0xc0, 0x00, 0xa1, 0xa8,
+  0x7f, 0x69, 0x0b, 0x3d, 0x00, 0x3d, 0xa1, 0xa9, 0x6e, 0x7e, 0x05, 0xc0, 0x03, 0x0b, 0x03, 0x65,
+  0x46, 0x7a, 0xa1, 0xb8, 0x6d, 0x57, 0x76, 0xa2, 0x87, 0xa2, 0x87, 0x9c, 0x79, 0x46, 0x6e, 0x3a,
+  0x3d, 0x3a, 0x55, 0x6e, 0x77, 0x3a, 0x30, 0x2b, 0x30, 0xc0, 0x2b, 0x2e, 0x3a, 0xc1, 0x2e, 0x3a,
+  0x37, 0x2b, 0xc0, 0x30, 0x2e, 0xa2, 0x88, 0xc0, 0x3d, 0xc0, 0xa2, 0x87, 0x5a, 0x02, 0xa2, 0x98,
+  0x59, 0x76, 0xc0, 0x0a, 0x19, 0x7a, 0x6e, 0x0a, 0xc0, 0x0f, 0x19, 0x0a, 0xc0, 0x6f, 0x07, 0x7b,
+  0x19, 0x1c, 0xc0, 0x19, 0xc1, 0x16, 0x11, 0x19, 0xa2, 0x88, 0x56, 0xc0, 0x21, 0x2d, 0x25, 0x59,
+  0xa2, 0x88, 0x66, 0x25, 0xc0, 0x7d, 0x7f, 0x66, 0x25, 0xc0, 0xa2, 0x87, 0x35, 0xa2, 0x88, 0x35,
+  0x25, 0x2d, 0xc0, 0x46, 0x1a, 0x5a, 0x6b, 0x45, 0xc0, 0xa2, 0x88, 0x66, 0x14, 0xa2, 0x88, 0x20,
+  0xc0, 0x14, 0x47, 0x6d, 0x28, 0x6f, 0x55, 0xa1, 0xa9, 0x28, 0x7e, 0x9e, 0x59, 0x9e, 0x69, 0x25,
+  0x37, 0x56, 0x20, 0x9f, 0x69, 0x4a, 0x12, 0x1a, 0x34, 0x7f, 0xc0, 0x7e, 0x65, 0x4a, 0x34, 0x5a,
+  0x7b, 0x7a, 0x37, 0x6e, 0x39, 0x42, 0x59, 0x34, 0xa3, 0x97, 0x66, 0x9d, 0x7a, 0xc0, 0x31, 0x46,
+  0x56, 0xa0, 0xa7, 0xc0, 0x42, 0x45, 0xa4, 0xc6, 0x30, 0x3b, 0x0e, 0xa3, 0xd8, 0x30, 0x14, 0xa1,
+  0xa9, 0x0e, 0x42, 0x7a, 0xa2, 0xb8, 0x3e, 0x56, 0x3b, 0x06, 0x1b, 0x14, 0x46, 0x3e, 0xc0, 0x0e,
+  0x20, 0x06, 0x3e, 0xa3, 0xc8, 0x3f, 0x2c, 0x1d, 0x07, 0x5a, 0x07, 0xc0, 0x7a, 0x3b, 0xfe, 0x13,
+  0x93, 0x65, 0x6e, 0x6f, 0xc0, 0x6e, 0xc0, 0xa2, 0x98, 0x6e, 0x46, 0x6f, 0x66, 0x7e, 0xc0, 0x39,
+  0x32, 0x66, 0xc0, 0x32, 0x39, 0xc1, 0x01, 0x7a, 0x01, 0x32, 0x62, 0x2d, 0x32, 0x2d, 0x28, 0x39,
+  0xa2, 0x87, 0x01, 0x65, 0x2d, 0x32, 0xc0, 0x2d, 0x04, 0x59, 0x01, 0x7e, 0x01, 0xc0, 0x3e, 0xc0,
+  0x6e, 0xc1, 0x6f, 0xa2, 0x89, 0xa2, 0xa7, 0xa2, 0x87, 0x4b, 0x46, 0x52, 0x64, 0x6b, 0x66, 0xa2,
+  0x77, 0xc1, 0x6f, 0xc2, 0x76, 0x38, 0x33, 0x38, 0xc0, 0x2c, 0x27, 0x2c, 0xc0, 0x7a, 0x5e, 0x2c,
+  0x2f, 0x6e, 0x31, 0x2f, 0x6f, 0x2c, 0x2f, 0x2c, 0x27, 0xa2, 0x97, 0xc0, 0x27, 0x20, 0xc0, 0x2a,
+  0x65, 0x5a, 0xc1, 0x1e, 0xc0, 0xa1, 0xb8, 0x5f, 0x55, 0x1e, 0xa2, 0x97, 0x35, 0x45, 0xa2, 0xc8,
+  0x7e, 0x9d, 0x6a, 0x23, 0xc0, 0x7b, 0xa3, 0xb7, 0x56, 0x08, 0x7f, 0x9e, 0x58, 0x35, 0x7a, 0x69,
+  0x08, 0x5b, 0x17, 0xa0, 0xa7, 0x5a, 0x00, 0x5e, 0x7a, 0x0c, 0x3a, 0x56, 0x2e, 0x7e, 0x7a, 0x08,
+  0x75, 0x5a, 0x66, 0x7a, 0x7e, 0x66, 0x02, 0x3f, 0x3a, 0xc0, 0x37, 0x69, 0x3a, 0x65, 0x5a, 0x37,
+  0x30, 0xc1, 0x2b, 0x6b, 0x37, 0x3a, 0x37, 0x2b, 0x32, 0x30, 0xc0, 0x2b, 0xc0, 0x37, 0x2b, 0xc0,
+  0x32, 0xc0, 0xa1, 0xa7, 0x6e, 0x36, 0x7f, 0x6e, 0xc0, 0x7a, 0x0a, 0xc0, 0x7f, 0xc0, 0x0d, 0x7f,
+  0x6e, 0x19, 0x02, 0x37, 0x02, 0x16, 0x66, 0x5a, 0x66, 0x6d, 0x02, 0x16, 0xc0, 0x0a, 0x19, 0x6e,
+  0x1c, 0x16, 0x0e, 0x16, 0xc0, 0x19, 0x1e, 0x7e, 0x57, 0x59, 0xa1, 0xa9, 0x7f, 0x9f, 0x68, 0x25,
+  0x66, 0xa2, 0x77, 0x2d, 0x5b, 0x13, 0x7f, 0xa2, 0xa7, 0x7e, 0x66, 0x2d, 0x7a, 0x25, 0x13, 0x67,
+  0xa2, 0x77, 0xc0, 0x17, 0x5b, 0x6e, 0xc0, 0x5a, 0xa2, 0xa7, 0xc0, 0x20, 0x7a, 0x20, 0x4a, 0x7e,
+  0xa1, 0xb9, 0x46, 0x30, 0xc0, 0x57, 0xc0, 0x1d, 0xc0, 0x30, 0x22, 0x5b, 0xa0, 0xa7, 0x9f, 0x6a,
+  0x9e, 0x68, 0xa3, 0xa7, 0x37, 0x9f, 0x69, 0xa2, 0x97, 0xa1, 0xa8, 0xa2, 0xa8, 0x55, 0x39, 0x37,
+  0x6e, 0x6b, 0x7a, 0x3c, 0x26, 0xc0, 0x2c, 0x1a, 0x56, 0x29, 0x22, 0x1a, 0x12, 0xc0, 0xa1, 0xa7,
+  0x53, 0xa1, 0xa7, 0x5a, 0x56, 0xc0, 0x0c, 0x09, 0x56, 0x6e, 0x0c, 0xc1, 0x55, 0x5a, 0x5a, 0x34,
+  0x06, 0x42, 0x34, 0x06, 0x34, 0x23, 0x9d, 0x79, 0x9e, 0x58, 0x36, 0xa2, 0x87, 0xa1, 0xb9, 0x5a,
+  0x33, 0x09, 0xa4, 0xc8, 0x30, 0x1a, 0x12, 0x5a, 0x15, 0x1d, 0x18, 0x06, 0x46, 0xfe, 0x13, 0x92,
+  0x66, 0xc0, 0x10, 0x6f, 0x6e, 0xa2, 0x88, 0xa2, 0xa7, 0x47, 0x45, 0x6b, 0xc0, 0x65, 0x39, 0xc1,
+  0x2d, 0xc0, 0x39, 0x2d, 0xc0, 0xa2, 0x77, 0x7b, 0xc0, 0x39, 0x2d, 0x21, 0x2d, 0x39, 0x2d, 0x21,
+  0x2d, 0x32, 0x65, 0x21, 0xc1, 0x2d, 0x32, 0x2d, 0xa2, 0x87, 0xc0, 0x7a, 0x6f, 0x04, 0xc0, 0x01,
+  0x5a, 0xa2, 0x98, 0xc0, 0x5a, 0xa1, 0xb9, 0xa2, 0x77, 0x6e, 0x5b, 0x9e, 0x69, 0x6e, 0xc0, 0x27,
+  0xc0, 0x2c, 0x65, 0x2c, 0xc2, 0x6b, 0x6d, 0x2c, 0xc3, 0x6f, 0x2c, 0xc0, 0x27, 0xc0, 0x2c, 0x61,
+  0x27, 0xc0, 0x7e, 0xc0, 0x27, 0xc0, 0x1b, 0x27, 0xc0, 0x2f, 0xc0, 0x65, 0xa0, 0xa8, 0x9f, 0x6a,
+  0x1b, 0x27, 0x1b, 0x65, 0xa1, 0xa9, 0xa2, 0xa8, 0x20, 0x23, 0xa1, 0xa8, 0x5b, 0x9d, 0x89, 0xa3,
+  0xa8, 0x3b, 0x2e, 0x36, 0xa2, 0xa8, 0x41, 0x35, 0x1b, 0xa2, 0x97, 0xa0, 0xa8, 0x7f, 0x7e, 0x46,
+  0x42, 0x1b, 0xa1, 0xb9, 0x2e, 0x5f, 0xa1, 0xa9, 0xa2, 0xb6, 0x66, 0x9f, 0x69, 0x6e, 0x08, 0x00,
+  0x08, 0x32, 0x23, 0xa1, 0xb9, 0x3d, 0x00, 0x7a, 0xc0, 0x55, 0x03, 0x69, 0x76, 0xc0, 0x34, 0x31,
+  0x34, 0x7a, 0xc2, 0x69, 0xc0, 0x37, 0x30, 0x66, 0x37, 0x66, 0xc0, 0x37, 0xc0, 0x2b, 0x30, 0x32,
+  0x37, 0x76, 0x32, 0x30, 0x2b, 0xc1, 0x69, 0xa3, 0xa9, 0x52, 0x7e, 0x7e, 0x45, 0xa2, 0x98, 0x0a,
+  0x05, 0x0a, 0x12, 0x6b, 0x56, 0x59, 0x7f, 0x56, 0x3a, 0x6e, 0x16, 0xc0, 0x0e, 0xc0, 0x11, 0x0e,
+  0x3c, 0x3f, 0x7a, 0xc0, 0x0e, 0x19, 0xc0, 0x0e, 0x3f, 0x13, 0xc0, 0x7b, 0x6d, 0x7b, 0x1b, 0xa1,
+  0xa9, 0x25, 0x46, 0x6e, 0x1d, 0x25, 0x6e, 0x2d, 0x25, 0x1a, 0xa3, 0x97, 0xa1, 0xb9, 0x2d, 0x25,
+  0x7a, 0x25, 0x10, 0x46, 0x08, 0xa2, 0x88, 0x1f, 0xc0, 0x5b, 0x6e, 0x5a, 0x7e, 0xc0, 0x25, 0x66,
+  0x25, 0x2d, 0x9e, 0x69, 0x6e, 0x52, 0x6e, 0x20, 0x6f, 0x28, 0xc1, 0x7f, 0x56, 0x9f, 0x48, 0x17,
+  0xa1, 0xa8, 0x9d, 0x5a, 0x7e, 0x37, 0x5a, 0x17, 0xa3, 0xc8, 0x5a, 0xa2, 0xb7, 0x5a, 0x37, 0x4a,
+  0x39, 0xc0, 0x2c, 0xc0, 0x17, 0x1a, 0x7a, 0x09, 0x5a, 0xc0, 0x09, 0x06, 0x46, 0x66, 0xa1, 0xa7,
+  0x7a, 0x6b, 0x9f, 0x58, 0x76, 0xa2, 0x98, 0x04, 0x66, 0x59, 0xa3, 0xa8, 0x1c, 0x42, 0x7a, 0x04,
+  0x01, 0x2c, 0x7a, 0x04, 0x9e, 0x69, 0x27, 0x01, 0xa2, 0x97, 0x9e, 0x58, 0x33, 0x36, 0x09, 0x1a,
+  0x46, 0x9d, 0x9a, 0x5e, 0x23, 0x7e, 0x9d, 0x49, 0x3f, 0xc0, 0xa2, 0xc7, 0x23, 0x56, 0xc0, 0x18,
+  0x9e, 0x69, 0xfe, 0x13, 0x93, 0x65, 0xc0, 0xa2, 0x78, 0xc0, 0x6f, 0xa2, 0x87, 0xa2, 0x88, 0x46,
+  0x66, 0xc0, 0x65, 0xc0, 0x39, 0xc0, 0x28, 0x6d, 0x2d, 0x39, 0xc0, 0x2d, 0x35, 0xa2, 0x98, 0x56,
+  0x39, 0x2d, 0xc1, 0x6e, 0x2d, 0x65, 0x2d, 0x32, 0x2d, 0x21, 0xc0, 0x2d, 0xc0, 0x26, 0x2d, 0x35,
+  0x39, 0x3e, 0xc0, 0x7a, 0x04, 0x56, 0x35, 0x0c, 0xa2, 0x88, 0x5a, 0xa2, 0x98, 0xc0, 0x6f, 0x41,
+  0x9d, 0x79, 0x6e, 0x6f, 0x6e, 0x6f, 0x1b, 0xc1, 0x20, 0x2c, 0x1b, 0xc1, 0x20, 0x2c, 0x20, 0x6b,
+  0x7a, 0x20, 0xc1, 0x1b, 0xc0, 0x66, 0x20, 0x1b, 0xc3, 0x69, 0x7f, 0x1b, 0xc0, 0x23, 0xa2, 0xa9,
+  0x9e, 0x86, 0xa0, 0xa9, 0x23, 0x20, 0x14, 0x20, 0x1b, 0x0a, 0xa3, 0xb9, 0xa2, 0x96, 0x6b, 0x9f,
+  0x58, 0x1b, 0xc0, 0x7a, 0xa2, 0xa7, 0x5a, 0x16, 0xa2, 0x97, 0xa4, 0xb7, 0x66, 0x2e, 0x1b, 0xa1,
+  0xa9, 0x26, 0x2a, 0xa1, 0xb8, 0xa2, 0x97, 0x9f, 0x68, 0x26, 0x2d, 0x6e, 0xa2, 0x98, 0xa1, 0xa8,
+  0xc1, 0x56, 0x69, 0x08, 0x55, 0x00, 0x08, 0x00, 0xc1, 0x03, 0xc0, 0x0b, 0x51, 0x34, 0x03, 0x3c,
+  0xc0, 0x62, 0x34, 0x37, 0x7a, 0x37, 0xc1, 0x69, 0x37, 0x30, 0x37, 0xc4, 0x32, 0x69, 0x37, 0x2b,
+  0xc0, 0x32, 0x3a, 0x65, 0x4a, 0xc1, 0xa1, 0xb8, 0x66, 0xa2, 0x78, 0xa1, 0xa8, 0x5a, 0x66, 0x0a,
+  0x5a, 0x7b, 0x7e, 0xc0, 0x4a, 0x0b, 0x66, 0x11, 0x13, 0xc0, 0x66, 0xc0, 0x07, 0x19, 0xc0, 0x5a,
+  0x06, 0x02, 0x07, 0x11, 0x0b, 0xc0, 0x0e, 0xc0, 0x13, 0xc1, 0x5b, 0x11, 0xa2, 0x78, 0xc0, 0x6f,
+  0x51, 0x17, 0x22, 0xc0, 0x5a, 0xa2, 0x98, 0x7a, 0x22, 0xc0, 0xa3, 0x88, 0x51, 0x1a, 0x1f, 0xc0,
+  0x52, 0x03, 0x5b, 0xa2, 0x88, 0x17, 0xa2, 0x88, 0xc0, 0x5a, 0x56, 0x28, 0x7e, 0x5a, 0x20, 0x5e,
+  0x7a, 0x22, 0x43, 0x59, 0x4a, 0xc0, 0xa1, 0xc8, 0xa1, 0xb9, 0x28, 0x7f, 0x42, 0x1a, 0x22, 0x1a,
+  0x19, 0x0f, 0x46, 0x1a, 0x2d, 0x9c, 0x4a, 0x0f, 0xa2, 0x97, 0x25, 0x7f, 0x6e, 0x22, 0x52, 0x7f,
+  0xc0, 0x19, 0xa1, 0xa7, 0x65, 0x15, 0x55, 0x55, 0x6b, 0x76, 0x4e, 0x59, 0x2c, 0x66, 0xc0, 0xa3,
+  0xb7, 0x52, 0x9e, 0x69, 0x27, 0xa1, 0xa8, 0x00, 0x03, 0xa2, 0x98, 0x2e, 0x17, 0x45, 0xa2, 0xa9,
+  0x0c, 0x9e, 0x58, 0x2c, 0xa1, 0xc9, 0x5a, 0x9e, 0x69, 0x27, 0xa2, 0xb9, 0x5e, 0x9e, 0x68, 0xa2,
+  0x97, 0x7f, 0x7e, 0x03, 0x0d, 0x03, 0x5a, 0xa2, 0xc7, 0x12, 0x9e, 0x69, 0x03, 0xa0, 0xa9, 0xc0,
+  0x06, 0xa2, 0xb8, 0x46, 0x15, 0xa2, 0x98, 0xfe, 0x13, 0x93, 0x69, 0xc0, 0x6f, 0x6e, 0x6b, 0x6e,
+  0x6e, 0x6f, 0xc0, 0x66, 0x2d, 0x28, 0x32, 0xc0, 0x28, 0x2d, 0x3e, 0x39, 0xc0, 0x32, 0xa2, 0xa8,
+  0x76, 0xa0, 0x57, 0x39, 0x2d, 0x69, 0x21, 0x2d, 0xc0, 0x26, 0x21, 0x7f, 0xc0, 0x26, 0x32, 0xc0,
+  0x2d, 0x21, 0xc0, 0xa2, 0x77, 0x39, 0x7a, 0x32, 0x3e, 0x7e, 0x2d, 0x7e, 0x7e, 0xa2, 0x98, 0x6e,
+  0xa2, 0xa9, 0x7f, 0x9d, 0x68, 0x9f, 0x69, 0x55, 0xc0, 0x6b, 0xc0, 0xa2, 0x78, 0x65, 0x0a, 0x0f,
+  0xc0, 0x1b, 0x66, 0x0a, 0x16, 0x0f, 0xc0, 0xa2, 0x78, 0x1b, 0xc3, 0x16, 0x0f, 0xc3, 0x76, 0x0f,
+  0xc0, 0xa1, 0xa9, 0x5e, 0x16, 0x7e, 0x59, 0xa0, 0xb8, 0xa2, 0x98, 0x7e, 0x9e, 0x69, 0x51, 0xc0,
+  0x6e, 0x57, 0x03, 0xa3, 0xb9, 0xa2, 0x88, 0x56, 0x5a, 0x9e, 0x69, 0x1b, 0x1e, 0x12, 0x29, 0x34,
+  0x45, 0xa1, 0xaa, 0xa2, 0x96, 0x6b, 0x00, 0x9f, 0x68, 0x66, 0x29, 0xc0, 0x34, 0xa3, 0xa8, 0x3c,
+  0x34, 0x5a, 0x38, 0x5e, 0x7e, 0x67, 0x45, 0x3a, 0x7a, 0x35, 0x00, 0x7e, 0x9e, 0x49, 0x1e, 0xa2,
+  0x97, 0x08, 0x66, 0x35, 0x29, 0xa2, 0x97, 0x7e, 0xa0, 0xa9, 0x7a, 0x41, 0x5a, 0x76, 0x37, 0xc0,
+  0x3a, 0xc0, 0x55, 0x3a, 0x37, 0x69, 0xc0, 0x37, 0x30, 0x37, 0xc0, 0x66, 0x79, 0x32, 0xc0, 0x30,
+  0x2b, 0xa2, 0x98, 0x30, 0x56, 0x6b, 0x65, 0x2b, 0x3a, 0x02, 0x65, 0x11, 0x69, 0x6e, 0x0a, 0xc0,
+  0x0b, 0x03, 0x08, 0x0e, 0x02, 0xa2, 0x88, 0x6e, 0x9d, 0x89, 0xc0, 0x0e, 0xc2, 0x0b, 0x3a, 0x0e,
+  0x13, 0x52, 0x0b, 0x52, 0x0e, 0x13, 0x5a, 0xa1, 0xb9, 0x16, 0x5b, 0xa1, 0xa9, 0x59, 0x5a, 0x56,
+  0xc0, 0x6e, 0xa2, 0xa7, 0x7f, 0x42, 0x1f, 0x6f, 0x41, 0x2e, 0xc0, 0x9d, 0x79, 0x17, 0x1f, 0x17,
+  0xc0, 0x1c, 0x17, 0xc0, 0x1c, 0x1f, 0x2b, 0x56, 0x4a, 0x7a, 0x7e, 0x4a, 0x7a, 0xc2, 0x9f, 0x59,
+  0x42, 0xc0, 0xa0, 0xa8, 0xa3, 0xb8, 0xa1, 0xa7, 0x22, 0x67, 0x49, 0xc0, 0x66, 0x4a, 0xc0, 0x04,
+  0xa2, 0xb7, 0x28, 0x9c, 0x39, 0x66, 0x17, 0x1a, 0xc0, 0x0a, 0xa1, 0xa8, 0xc1, 0x69, 0x52, 0x6e,
+  0xc0, 0x7a, 0xc0, 0x01, 0x06, 0xc0, 0x56, 0x33, 0x61, 0x6e, 0xc0, 0x22, 0xa2, 0x87, 0x66, 0x66,
+  0x2f, 0xa1, 0xb9, 0x3d, 0x08, 0x2e, 0x08, 0x00, 0xc0, 0xa4, 0xa7, 0x04, 0x9e, 0x58, 0xc0, 0x01,
+  0x2f, 0xc0, 0xa3, 0xc8, 0x47, 0x9f, 0x68, 0x6b, 0x6e, 0x79, 0x5a, 0x33, 0xa3, 0xc7, 0x30, 0x20,
+  0x0a, 0x03, 0x00, 0xa1, 0xc9, 0x15, 0x33, 0x06, 0xa4, 0xc8, 0x1a, 0xc0, 0xa3, 0xd8, 0xfe, 0x13,
+  0x93, 0x69, 0xc1, 0xa2, 0x78, 0x6f, 0x6e, 0x6f, 0x66, 0xc0, 0x32, 0xc0, 0x2d, 0xc0, 0x32, 0x2d,
+  0x39, 0xc0, 0x32, 0x3e, 0xa1, 0xa8, 0x7e, 0x41, 0x9d, 0x9a, 0x2d, 0xc0, 0x69, 0x21, 0xc4, 0x26,
+  0x32, 0x7a, 0x7a, 0x55, 0x26, 0x7b, 0x28, 0x32, 0x6e, 0x2d, 0x30, 0xa2, 0x88, 0x5a, 0x39, 0xa3,
+  0xb8, 0xa0, 0xa8, 0xa2, 0x77, 0xa2, 0x98, 0x51, 0x1b, 0xa0, 0x58, 0x55, 0xc0, 0x3e, 0x6b, 0x3e,
+  0x03, 0x12, 0xc0, 0x56, 0x6e, 0x12, 0x0f, 0x0a, 0x3e, 0xc1, 0x0f, 0xc1, 0x0a, 0xc0, 0x12, 0x0f,
+  0x0a, 0xc0, 0x7d, 0x67, 0x3e, 0x05, 0xa2, 0xa7, 0xa3, 0xa8, 0x0a, 0xc0, 0xa1, 0xa8, 0x6d, 0x03,
+  0x18, 0x02, 0x9d, 0x69, 0x3e, 0x1b, 0xc0, 0x5e, 0x55, 0x12, 0x5f, 0x69, 0xa1, 0xb9, 0x66, 0x15,
+  0xa2, 0x77, 0x66, 0x0f, 0xa3, 0xb7, 0xa1, 0xba, 0x9e, 0x68, 0x79, 0x7e, 0xa2, 0x88, 0x6b, 0x46,
+  0x79, 0x56, 0x1d, 0x3c, 0xc0, 0x04, 0x3c, 0x2c, 0x5e, 0x7a, 0x29, 0x6f, 0x6e, 0x55, 0x46, 0x2e,
+  0x00, 0x5a, 0x41, 0x56, 0x26, 0x00, 0x35, 0x1e, 0x29, 0x00, 0x0b, 0x79, 0x30, 0x67, 0x7e, 0xc0,
+  0x30, 0x37, 0xc8, 0x30, 0xc0, 0x76, 0x5a, 0x37, 0x32, 0x3a, 0x02, 0x2b, 0x28, 0x6b, 0xc0, 0x37,
+  0x3a, 0xc0, 0x69, 0x3a, 0x7d, 0x7b, 0x3b, 0x3c, 0x00, 0x29, 0x0b, 0x7a, 0x07, 0x0b, 0x56, 0x3c,
+  0x06, 0x69, 0x0b, 0x42, 0x34, 0xc0, 0x06, 0x0b, 0x06, 0x00, 0xa2, 0xa7, 0x06, 0x0b, 0x03, 0x0b,
+  0xa2, 0x98, 0x13, 0x6f, 0x6e, 0x67, 0x1f, 0x5a, 0xc0, 0x7f, 0x7d, 0x6b, 0x2b, 0x5a, 0xc0, 0x5a,
+  0x2b, 0x26, 0x56, 0x2b, 0x56, 0x65, 0x23, 0x59, 0x1c, 0xc0, 0x19, 0x28, 0x56, 0xc0, 0x25, 0x20,
+  0xc0, 0x25, 0xc1, 0x56, 0x5a, 0x9e, 0x69, 0x5a, 0x7e, 0x20, 0xa2, 0x97, 0xc0, 0x9e, 0x6a, 0x9f,
+  0x48, 0xa1, 0xb8, 0x1a, 0x04, 0x69, 0xa1, 0xb9, 0x41, 0x1a, 0x76, 0x9d, 0x59, 0x6d, 0x77, 0xc0,
+  0x5e, 0xc0, 0xa2, 0xb7, 0x76, 0x5a, 0xc0, 0x46, 0x7e, 0x66, 0x6f, 0x01, 0x3b, 0x3e, 0x06, 0x01,
+  0x42, 0x55, 0x6e, 0x69, 0x7b, 0x27, 0x1b, 0xa1, 0xa9, 0x35, 0x03, 0x2d, 0x35, 0xa2, 0xa8, 0x45,
+  0x0f, 0xa4, 0xa7, 0x2b, 0x01, 0x56, 0x59, 0x01, 0x9e, 0x69, 0x01, 0xa2, 0xa7, 0x3e, 0x2f, 0x38,
+  0x76, 0x06, 0xc0, 0x3b, 0x06, 0xa4, 0xd7, 0x1d, 0x3b, 0x66, 0xa3, 0xa8, 0x1c, 0x12, 0x38, 0x3e,
+  0xa2, 0x78, 0x5e, 0x1d, 0x28, 0xfe, 0x13, 0x92, 0xc1, 0x6f, 0x6e, 0x6f, 0x6e, 0x6b, 0x75, 0x2d,
+  0xc2, 0x69, 0x21, 0x32, 0x67, 0x2d, 0xc1, 0xa2, 0x98, 0x6e, 0x46, 0x2d, 0x21, 0xc0, 0x26, 0x21,
+  0xc5, 0x2d, 0x26, 0x7a, 0x66, 0x2d, 0x7e, 0x52, 0x2d, 0x26, 0x2d, 0x26, 0xa2, 0x98, 0xa2, 0x88,
+  0x09, 0x7a, 0xa2, 0xa7, 0xa2, 0x98, 0xc0, 0x9d, 0x69, 0x57, 0xc0, 0x5a, 0x55, 0x39, 0xa2, 0x87,
+  0x01, 0x3e, 0xa2, 0x88, 0xa0, 0xa8, 0x9e, 0x69, 0x6d, 0x3e, 0x03, 0xc0, 0x3e, 0x39, 0xc1, 0x3e,
+  0x12, 0x06, 0x3e, 0xc0, 0x6f, 0xc0, 0x3e, 0xa2, 0x87, 0x7b, 0x03, 0x01, 0x06, 0xa2, 0x98, 0x18,
+  0xc0, 0x7e, 0x13, 0x4a, 0x06, 0x14, 0x09, 0x12, 0x01, 0x13, 0xa2, 0x97, 0x18, 0x3e, 0x03, 0x15,
+  0x6b, 0xa2, 0x96, 0x1d, 0x12, 0x7e, 0x15, 0x69, 0xa0, 0xa9, 0x20, 0x23, 0xc0, 0x7f, 0xa2, 0x87,
+  0x56, 0x20, 0xc0, 0x23, 0x7e, 0x5a, 0xa2, 0x89, 0x20, 0x28, 0xc0, 0x20, 0xa3, 0x78, 0x67, 0x59,
+  0xa1, 0xa9, 0x36, 0x9e, 0x69, 0x7b, 0xa2, 0xb6, 0xa2, 0x87, 0x00, 0x51, 0x6e, 0x00, 0x31, 0x2c,
+  0xa2, 0x87, 0x6e, 0x9e, 0xb9, 0x37, 0x28, 0x37, 0x3a, 0x59, 0xc0, 0x37, 0xc1, 0x30, 0x37, 0xc1,
+  0x30, 0xc3, 0x32, 0x28, 0x37, 0x3a, 0x37, 0x30, 0x25, 0x28, 0x32, 0x37, 0x75, 0x30, 0x3a, 0x2b,
+  0x37, 0xa0, 0xa8, 0x37, 0x36, 0x03, 0x7e, 0xa2, 0x87, 0x0b, 0xc0, 0x42, 0x69, 0x0b, 0x5a, 0x38,
+  0x59, 0x00, 0x3b, 0xc0, 0xa1, 0xa8, 0x0b, 0x03, 0x00, 0xa2, 0xa8, 0x08, 0x5a, 0x00, 0xa2, 0x97,
+  0x7f, 0xc0, 0x6f, 0x55, 0x6b, 0xa1, 0xa8, 0x23, 0x1c, 0x2b, 0x23, 0x6e, 0xc3, 0x7e, 0x28, 0x23,
+  0x6d, 0x28, 0x56, 0xc0, 0x28, 0xa1, 0xa9, 0x2b, 0x45, 0x23, 0x20, 0xc0, 0x23, 0x49, 0x6b, 0x7e,
+  0x20, 0xc0, 0x56, 0x9f, 0x68, 0x7b, 0x6d, 0x25, 0x7b, 0x25, 0xc0, 0x5a, 0x9e, 0x69, 0x28, 0x03,
+  0x56, 0xa1, 0xa8, 0x7f, 0xc1, 0x06, 0x3b, 0x5a, 0x66, 0xc1, 0x03, 0xa1, 0xc8, 0x9e, 0x48, 0x66,
+  0x7b, 0x3b, 0x7a, 0x7a, 0x03, 0x01, 0x46, 0x55, 0x6e, 0x27, 0x65, 0xc0, 0x6b, 0x7a, 0x6e, 0x1b,
+  0xc0, 0x2a, 0x2d, 0xa2, 0x97, 0x46, 0xa0, 0xa8, 0x00, 0x46, 0xa2, 0x87, 0xa5, 0xc7, 0x9e, 0x59,
+  0x9d, 0x9a, 0xa2, 0xa8, 0x0c, 0x01, 0x7a, 0x36, 0xa1, 0xa7, 0x7f, 0x2c, 0x36, 0x09, 0x6b, 0x3b,
+  0xc0, 0x19, 0x9f, 0x6a, 0x9e, 0x68, 0x7f, 0x3b, 0xa2, 0xd7, 0xa3, 0x98, 0x0f, 0x9d, 0x89, 0xc0,
+  0x6f, 0x12, 0x1d, 0xc0, 0xfe, 0x13, 0x92, 0xc0, 0x6f, 0xa2, 0x77, 0xc0, 0x67, 0x6e, 0xc4, 0x26,
+  0x66, 0xc0, 0xa2, 0x78, 0x6f, 0x2d, 0x26, 0x7f, 0x6e, 0x35, 0x6f, 0x32, 0x21, 0xcb, 0x26, 0x21,
+  0x7a, 0x26, 0x2d, 0x26, 0x2d, 0xc1, 0x6f, 0x01, 0xa3, 0xb7, 0xa0, 0xb8, 0xa3, 0x98, 0x9f, 0x59,
+  0x9c, 0x79, 0x46, 0x7e, 0x76, 0x01, 0x3e, 0x01, 0x3e, 0xc0, 0xa2, 0x98, 0x0c, 0x09, 0x52, 0xa2,
+  0x77, 0x3e, 0x6e, 0x06, 0x3c, 0x3e, 0xc0, 0x01, 0x0c, 0x56, 0x3e, 0x01, 0xc0, 0x03, 0x3e, 0x06,
+  0xa0, 0xa9, 0x0c, 0xa2, 0x88, 0x9e, 0x69, 0x03, 0xa1, 0xb9, 0x20, 0x66, 0x15, 0x03, 0x09, 0x01,
+  0x3a, 0xa3, 0x98, 0x53, 0x6d, 0x1b, 0x18, 0x09, 0x04, 0x39, 0x18, 0x1c, 0x56, 0x04, 0x3c, 0x04,
+  0x14, 0x66, 0x1b, 0x7e, 0xa1, 0xa8, 0x23, 0x45, 0x20, 0x1b, 0xc0, 0x23, 0xc0, 0x7e, 0x23, 0x18,
+  0x1c, 0x23, 0x20, 0x6e, 0x7f, 0x5e, 0x34, 0x6b, 0x6d, 0x52, 0x55, 0xa4, 0xa8, 0x34, 0x20, 0xa2,
+  0x87, 0x66, 0x7f, 0x66, 0x20, 0x32, 0xc1, 0x28, 0xc0, 0x2e, 0x6e, 0x30, 0x37, 0x7a, 0x37, 0x2b,
+  0x37, 0x3a, 0x37, 0x30, 0xc0, 0x2b, 0x3a, 0x2b, 0x5b, 0x34, 0xa1, 0xa8, 0x30, 0x9e, 0x6a, 0x1d,
+  0x2f, 0x37, 0xc0, 0x30, 0x2b, 0xc1, 0x30, 0x37, 0xc0, 0x34, 0x5f, 0x0b, 0xa3, 0xa8, 0x9e, 0x68,
+  0x51, 0x0b, 0x56, 0x10, 0x6b, 0x9d, 0x69, 0x56, 0xa2, 0xa7, 0xa2, 0x87, 0x9f, 0xba, 0x6e, 0x10,
+  0x56, 0x00, 0x17, 0x66, 0x00, 0x7f, 0x5e, 0x65, 0x17, 0xa2, 0x88, 0x7a, 0x46, 0xc0, 0xa2, 0x87,
+  0x56, 0xc1, 0x56, 0x28, 0xc0, 0x23, 0x28, 0x2b, 0x30, 0x23, 0xc0, 0x69, 0x28, 0x23, 0x5e, 0x2b,
+  0xc0, 0x28, 0x23, 0x59, 0x6e, 0x28, 0x23, 0x11, 0x7b, 0x5d, 0xc0, 0x19, 0x23, 0x11, 0x5a, 0x16,
+  0x25, 0x20, 0x46, 0x45, 0x15, 0x03, 0x66, 0x7a, 0x6e, 0x11, 0x6f, 0x16, 0x15, 0x59, 0x67, 0x03,
+  0x56, 0xc0, 0x56, 0x69, 0x66, 0x2c, 0xc0, 0x67, 0x33, 0x3b, 0xa1, 0xb8, 0x55, 0x01, 0x45, 0x52,
+  0xc0, 0x27, 0x65, 0xc1, 0x7b, 0x1b, 0xc0, 0x76, 0xa2, 0x78, 0x65, 0x6e, 0x7f, 0x3d, 0x2a, 0x27,
+  0x2a, 0x32, 0x3d, 0xa3, 0xb8, 0x1a, 0x2a, 0x7f, 0x0e, 0x33, 0xa3, 0xd7, 0x11, 0x33, 0x3b, 0x03,
+  0x01, 0x2c, 0x06, 0x20, 0x33, 0x7a, 0xa2, 0xa8, 0x09, 0x14, 0xa2, 0x78, 0x9d, 0x49, 0xa0, 0xa9,
+  0x5a, 0x52, 0x3b, 0x28, 0x6b, 0xfe, 0x13, 0x92, 0xc0, 0x6f, 0x6e, 0x6f, 0xc2, 0x69, 0xc1, 0x21,
+  0xc1, 0x26, 0x2d, 0x6e, 0x2d, 0x26, 0xa1, 0xa9, 0xa3, 0x98, 0x9d, 0x79, 0x52, 0x2d, 0x26, 0x21,
+  0xcb, 0x1c, 0x21, 0x26, 0x2d, 0xc0, 0x32, 0xc0, 0x26, 0x32, 0xa2, 0x98, 0xa2, 0xc8, 0xa4, 0x97,
+  0x9e, 0x68, 0x9d, 0x8a, 0x5a, 0x35, 0x7f, 0x09, 0x55, 0x6b, 0x5a, 0x32, 0xa2, 0x88, 0xa0, 0xa9,
+  0x54, 0x7f, 0x06, 0x3e, 0xc1, 0x01, 0x04, 0x01, 0x5e, 0x01, 0x3d, 0x0c, 0x01, 0xc0, 0x06, 0x03,
+  0x3e, 0x09, 0xa3, 0xa9, 0x0c, 0x09, 0x04, 0x3e, 0x06, 0xa2, 0xa8, 0x06, 0xa2, 0x98, 0x56, 0x3e,
+  0x01, 0x3e, 0x01, 0x04, 0x06, 0x3e, 0xa2, 0x97, 0xc0, 0x9f, 0xb9, 0x04, 0x7a, 0x0f, 0x0c, 0xc0,
+  0x04, 0x07, 0x0c, 0x3d, 0xa2, 0x88, 0xa1, 0xb9, 0x55, 0x14, 0x0c, 0x1b, 0x14, 0xc0, 0x17, 0x20,
+  0x7e, 0x14, 0x1b, 0xc0, 0x7e, 0xc1, 0x28, 0xa2, 0x88, 0x66, 0x23, 0x5f, 0x6d, 0x23, 0x7f, 0x11,
+  0x20, 0xa1, 0xa7, 0x26, 0x6e, 0x23, 0x20, 0x2b, 0x26, 0x23, 0x2b, 0x23, 0x2b, 0xa2, 0x88, 0x37,
+  0xc0, 0x7a, 0xc2, 0x37, 0xc3, 0x2b, 0x3c, 0x67, 0x59, 0x3f, 0x34, 0x9e, 0x49, 0x7a, 0x3a, 0x37,
+  0x2b, 0xc0, 0x32, 0x37, 0xc0, 0x76, 0x5d, 0x46, 0x5b, 0x7f, 0xa1, 0xa8, 0x5e, 0x41, 0x03, 0x45,
+  0x7f, 0xa2, 0x97, 0x56, 0x7f, 0xc0, 0x66, 0x7d, 0xa3, 0x98, 0x67, 0x08, 0x00, 0xa2, 0xa8, 0x7e,
+  0x9e, 0x69, 0x6e, 0x0f, 0x4a, 0xc0, 0x14, 0xa3, 0x98, 0xc0, 0x56, 0x56, 0xc0, 0x28, 0x7a, 0x28,
+  0x6e, 0x28, 0x66, 0xc0, 0x2b, 0x30, 0x2d, 0x30, 0x23, 0xc0, 0x28, 0x55, 0x20, 0x23, 0x6d, 0x30,
+  0x51, 0xc0, 0x2b, 0x7a, 0x14, 0x5a, 0x09, 0xc0, 0x20, 0x2b, 0x2e, 0x19, 0x11, 0x5a, 0x6b, 0x7a,
+  0x9e, 0x58, 0x56, 0xa1, 0xa9, 0xa2, 0x86, 0x66, 0x0e, 0x18, 0xc0, 0x0e, 0x63, 0x3b, 0x7e, 0x09,
+  0x06, 0x66, 0x5a, 0x51, 0x5a, 0xc2, 0x33, 0x66, 0x3b, 0x75, 0x2a, 0x27, 0xc0, 0x66, 0x7d, 0x2a,
+  0x22, 0x1b, 0x1e, 0x1b, 0xc0, 0x66, 0xa3, 0x97, 0x1e, 0x1b, 0x6e, 0x9f, 0xba, 0xa2, 0x67, 0x27,
+  0xc0, 0x22, 0xc0, 0x38, 0x17, 0x9c, 0x5a, 0x5a, 0xa2, 0xa7, 0x32, 0x27, 0x14, 0x19, 0x27, 0xa2,
+  0x97, 0x5a, 0x04, 0x46, 0x09, 0x06, 0x42, 0x3e, 0xc1, 0x6f, 0x03, 0x06, 0xa2, 0x98, 0x9e, 0x59,
+  0x33, 0x3b, 0xa3, 0xc8, 0x1d, 0xfe, 0x13, 0xb2, 0x6b, 0xc0, 0x15, 0x6f, 0x6f, 0xc1, 0x21, 0xc0,
+  0x6e, 0x67, 0x21, 0xc0, 0x26, 0x2d, 0x26, 0x6f, 0xc0, 0x75, 0x7f, 0x5a, 0x21, 0xc0, 0x26, 0x21,
+  0x1c, 0x21, 0xc6, 0x26, 0x21, 0xc6, 0x26, 0x32, 0xc0, 0xa2, 0xa9, 0xa2, 0xb7, 0xa3, 0x87, 0x9d,
+  0x8a, 0x42, 0x59, 0x5a, 0x56, 0xc0, 0xa1, 0xa7, 0x09, 0x46, 0x7f, 0xa2, 0xb7, 0x0c, 0x32, 0x09,
+  0x66, 0x3e, 0xc0, 0x7b, 0x3e, 0x79, 0x6f, 0x5a, 0x3e, 0x3a, 0x09, 0x06, 0x52, 0x35, 0xa3, 0x78,
+  0x01, 0x0c, 0x7e, 0x01, 0x3e, 0x01, 0xc0, 0x3e, 0x09, 0x6e, 0xc0, 0x23, 0x04, 0x3a, 0x09, 0x65,
+  0x04, 0x39, 0x3e, 0x06, 0xa1, 0xa9, 0x0c, 0xc4, 0x14, 0x66, 0xa2, 0x87, 0x9d, 0x8a, 0x0c, 0x23,
+  0x9d, 0x98, 0x0f, 0xc0, 0x05, 0x0c, 0x05, 0x6f, 0xa0, 0xa9, 0x14, 0x0c, 0xc2, 0x23, 0x1e, 0x5d,
+  0x6b, 0x6e, 0x23, 0x25, 0x20, 0xa2, 0xa8, 0x55, 0x5a, 0x6b, 0x2b, 0xc1, 0x5f, 0x76, 0x68, 0x28,
+  0x7e, 0x2b, 0xc0, 0x6f, 0x3a, 0x37, 0xc0, 0x30, 0x37, 0xc2, 0x3a, 0xc0, 0x37, 0x30, 0x4b, 0x34,
+  0x7e, 0x37, 0x9f, 0x69, 0x9f, 0x69, 0xc0, 0x7a, 0x34, 0x2b, 0x30, 0x32, 0x37, 0x2b, 0x30, 0x3a,
+  0x30, 0x47, 0x55, 0x6b, 0x29, 0x31, 0x6b, 0x5a, 0x59, 0xa1, 0xb9, 0xa2, 0x97, 0x7f, 0xc0, 0x52,
+  0x6e, 0x79, 0x10, 0x56, 0x10, 0x1f, 0xa1, 0xa8, 0x52, 0x9f, 0x59, 0x7e, 0x46, 0x56, 0x0c, 0xa3,
+  0x98, 0x7f, 0x28, 0x66, 0x5a, 0xc0, 0x23, 0x28, 0x20, 0xa1, 0xa8, 0x6e, 0x9e, 0x69, 0xc0, 0xa2,
+  0x97, 0x28, 0x2b, 0xc0, 0x23, 0x5e, 0x65, 0xc0, 0x62, 0xa2, 0x98, 0xa2, 0x86, 0x7b, 0x1f, 0x5a,
+  0x1f, 0x1c, 0x14, 0x5a, 0x0c, 0x11, 0x14, 0x1c, 0xc0, 0x11, 0x46, 0x7b, 0x1d, 0x66, 0x06, 0x6f,
+  0x7a, 0xa0, 0xa8, 0xc1, 0x11, 0x15, 0x45, 0x66, 0x5a, 0x5a, 0x3b, 0x3e, 0x51, 0xc0, 0x59, 0x6f,
+  0x2a, 0x5a, 0xc0, 0x2c, 0x6b, 0x66, 0x27, 0x66, 0xc2, 0x69, 0xc1, 0x2a, 0x1b, 0x67, 0x69, 0xa2,
+  0x97, 0xa1, 0xa9, 0x9d, 0x79, 0x1b, 0x22, 0xc0, 0x27, 0xa1, 0xa8, 0x3e, 0x52, 0x20, 0x27, 0xa2,
+  0xb7, 0x17, 0x14, 0x9e, 0x58, 0x27, 0x22, 0x2a, 0x35, 0x27, 0x2a, 0x6e, 0x6e, 0x2c, 0x34, 0x09,
+  0x57, 0xa0, 0x57, 0x33, 0xc0, 0x38, 0x10, 0xa1, 0xa8, 0x06, 0x38, 0xc0, 0x76, 0x06, 0x11, 0xfe,
+  0x13, 0xd3, 0xc1, 0x66, 0xc1, 0x21, 0x6e, 0x67, 0x21, 0xc1, 0x26, 0xc1, 0x21, 0x26, 0x6e, 0x6b,
+  0x66, 0x21, 0x28, 0x2d, 0x21, 0xc2, 0x7e, 0x26, 0x21, 0x29, 0x21, 0xc2, 0x29, 0x21, 0xc0, 0x29,
+  0x21, 0xc5, 0x26, 0xa2, 0xb8, 0xa4, 0x87, 0x57, 0x42, 0x5d, 0x9d, 0x99, 0x6f, 0x66, 0xa1, 0xa8,
+  0x6d, 0x46, 0x5b, 0xa2, 0xb7, 0xc0, 0x9f, 0x69, 0x76, 0x3a, 0x01, 0x04, 0x6e, 0x01, 0x56, 0x01,
+  0x3a, 0x39, 0x32, 0x6e, 0x01, 0xc0, 0x37, 0x35, 0xa2, 0xa8, 0x04, 0x01, 0xc0, 0x09, 0x3a, 0x3e,
+  0x39, 0x3e, 0x06, 0xa2, 0xa7, 0x09, 0x14, 0xc0, 0x9d, 0x99, 0x6e, 0x14, 0x07, 0x35, 0x39, 0x01,
+  0xa1, 0xa8, 0x0f, 0x0c, 0xc0, 0x09, 0x0c, 0x79, 0x0f, 0xc0, 0x14, 0x6b, 0x0c, 0xa3, 0x98, 0x0f,
+  0x0c, 0xc1, 0x05, 0x0c, 0xc2, 0xa1, 0xa8, 0x0c, 0x04, 0x0c, 0x1b, 0x14, 0x5a, 0x0c, 0x14, 0x23,
+  0x7a, 0x28, 0xc1, 0x7f, 0xc0, 0x69, 0x37, 0xc0, 0x59, 0x30, 0x66, 0x30, 0x37, 0xc0, 0x5a, 0x28,
+  0x2d, 0x37, 0x41, 0x28, 0xc0, 0x34, 0x66, 0x28, 0xc0, 0x2b, 0x2f, 0x59, 0x6f, 0x5a, 0x31, 0x6f,
+  0x62, 0x25, 0x47, 0x5a, 0xa1, 0xa8, 0xa1, 0xc8, 0x2b, 0xc0, 0x6b, 0x37, 0x2b, 0x32, 0x2b, 0x2f,
+  0x20, 0x5e, 0x21, 0x2e, 0x3d, 0x46, 0x2e, 0xa2, 0x98, 0xa1, 0xb8, 0x66, 0x9f, 0x69, 0x05, 0xa2,
+  0xa8, 0x66, 0x41, 0x05, 0x1a, 0xa2, 0x98, 0x1f, 0x56, 0x55, 0x4f, 0x62, 0xa1, 0xa9, 0xa2, 0x87,
+  0x7e, 0x5a, 0x56, 0x6e, 0xc0, 0x20, 0xc0, 0xa2, 0x77, 0x20, 0x56, 0x6e, 0xc0, 0x79, 0x7a, 0x28,
+  0x23, 0x20, 0x1d, 0x69, 0x76, 0x5a, 0x14, 0x1f, 0x7e, 0x5a, 0x17, 0x14, 0x69, 0x08, 0x17, 0x1f,
+  0x17, 0x05, 0x14, 0xc0, 0x11, 0x14, 0x0e, 0x20, 0x2b, 0x6e, 0x20, 0x14, 0x11, 0x14, 0xc0, 0x66,
+  0x11, 0x56, 0x46, 0x7a, 0x5b, 0x51, 0x59, 0x66, 0x69, 0x27, 0xc2, 0x22, 0x27, 0x6e, 0xc1, 0x27,
+  0x61, 0xc0, 0x1b, 0xc1, 0x16, 0xc0, 0xa2, 0x88, 0x61, 0x16, 0x1e, 0x3d, 0x21, 0x16, 0x1b, 0x22,
+  0x1b, 0xa1, 0xa9, 0xa3, 0xa8, 0x9e, 0x69, 0x27, 0x22, 0xc0, 0x6d, 0x1f, 0x0f, 0x2c, 0x27, 0x22,
+  0xc0, 0x2c, 0x31, 0x27, 0xc0, 0x2c, 0x67, 0x27, 0xa3, 0xa8, 0xc0, 0x42, 0x5e, 0xc0, 0x01, 0x09,
+  0x11, 0x09, 0x9f, 0x68, 0x6b, 0x56, 0x79, 0x17, 0xfe, 0x13, 0xb2, 0x7f, 0x5a, 0xc0, 0x66, 0xc0,
+  0x21, 0xc0, 0x6e, 0xc1, 0x21, 0xc1, 0x26, 0xc1, 0x6b, 0x6e, 0xc0, 0x21, 0xd7, 0x1c, 0xa2, 0xa7,
+  0xa5, 0xb7, 0xa3, 0x79, 0x9c, 0x5a, 0x51, 0xa2, 0x77, 0x9d, 0x8a, 0xc0, 0x6e, 0x7e, 0x65, 0x32,
+  0x7a, 0x3a, 0x6b, 0x3e, 0x01, 0x3a, 0x04, 0x79, 0xa2, 0x98, 0x9f, 0x69, 0x3e, 0x32, 0x35, 0xc1,
+  0x5e, 0x39, 0x32, 0xc1, 0x35, 0x01, 0x37, 0x01, 0xa1, 0xa8, 0x01, 0x3e, 0xc1, 0x01, 0x18, 0x69,
+  0x51, 0xa2, 0x98, 0x0c, 0x7a, 0xc0, 0x3d, 0x09, 0x9f, 0xb9, 0x0c, 0xc1, 0x0f, 0x14, 0x11, 0x04,
+  0x09, 0x0f, 0x0c, 0x69, 0x0c, 0x11, 0xa2, 0xa8, 0x65, 0x0f, 0xc0, 0x0c, 0xc0, 0x0f, 0x0c, 0xc0,
+  0x0f, 0x2b, 0x14, 0x0f, 0xc0, 0x04, 0x0c, 0xc0, 0x0f, 0x14, 0xa2, 0x88, 0x65, 0x7b, 0xc0, 0x28,
+  0x57, 0x69, 0xa2, 0x97, 0x46, 0xc0, 0x2b, 0x7f, 0x69, 0x2b, 0x28, 0x25, 0x7b, 0x25, 0x11, 0x25,
+  0x55, 0x20, 0x25, 0x20, 0x28, 0x16, 0x20, 0x18, 0x7a, 0x20, 0x28, 0x7f, 0x5a, 0x25, 0xc0, 0x34,
+  0x9e, 0x59, 0x5a, 0xa2, 0xb8, 0x3a, 0x30, 0x37, 0x30, 0xc1, 0x2b, 0x37, 0x2b, 0x28, 0x47, 0xa2,
+  0x77, 0x7a, 0x38, 0x5a, 0x65, 0xa3, 0xb8, 0x6e, 0x56, 0x66, 0x0b, 0x7f, 0x08, 0x5a, 0x08, 0x6b,
+  0x7e, 0x5a, 0xc1, 0x46, 0x7e, 0xa1, 0xa8, 0x6b, 0x7e, 0x5a, 0x46, 0x7e, 0x6b, 0x1d, 0x7a, 0xc0,
+  0x1c, 0x4a, 0x56, 0x23, 0x2b, 0x6e, 0x55, 0x14, 0x11, 0xc0, 0x7e, 0x1c, 0x05, 0x1c, 0x17, 0xc0,
+  0x59, 0x17, 0x7e, 0x17, 0x46, 0x10, 0xa1, 0xa9, 0x0b, 0x08, 0x17, 0x52, 0x08, 0x03, 0x0f, 0x14,
+  0xa2, 0x97, 0x1f, 0x0c, 0x0e, 0x62, 0x0c, 0xc0, 0x46, 0x5a, 0x01, 0xc0, 0x45, 0xc0, 0x62, 0x5e,
+  0xc2, 0x7a, 0x27, 0x1b, 0x27, 0xc0, 0x2a, 0x7f, 0x2a, 0x1b, 0xc1, 0x66, 0xc0, 0x66, 0x16, 0x1b,
+  0x16, 0xc0, 0x79, 0xa2, 0x89, 0x65, 0x11, 0x16, 0x1b, 0xc0, 0x2d, 0x17, 0x9e, 0x68, 0x27, 0xc0,
+  0x66, 0xc0, 0x38, 0x08, 0x3e, 0x9d, 0x8a, 0x6c, 0x27, 0xc3, 0x6e, 0xc2, 0x7f, 0x3e, 0xc0, 0x39,
+  0x3e, 0x3d, 0x0c, 0x6e, 0xc0, 0x09, 0x39, 0x27, 0xa2, 0x97, 0xa4, 0xd7, 0xfe, 0x13, 0xb2, 0x6f,
+  0xc7, 0x6e, 0xc0, 0x21, 0xc0, 0x26, 0x6f, 0x21, 0x6f, 0x32, 0xc0, 0x26, 0x21, 0xd6, 0x66, 0xa5,
+  0x97, 0xa7, 0xc7, 0x9d, 0x6a, 0x9b, 0x6a, 0xc3, 0x32, 0xc1, 0x26, 0x32, 0xc0, 0x7a, 0x7f, 0x49,
+  0x01, 0x79, 0x7f, 0xc0, 0x35, 0xc0, 0x6e, 0x7f, 0x3a, 0x35, 0x32, 0xc0, 0x2d, 0xc0, 0x32, 0x2d,
+  0x35, 0x04, 0x01, 0xc2, 0x5a, 0xc1, 0x09, 0xa1, 0xa9, 0x3d, 0xc0, 0xa2, 0x98, 0x66, 0x3d, 0x32,
+  0x35, 0xa1, 0xa9, 0x0c, 0xc3, 0x0f, 0x1b, 0x0c, 0x04, 0x07, 0x05, 0x0c, 0x07, 0x0f, 0xa3, 0xa8,
+  0x9c, 0x78, 0x0c, 0xc0, 0x09, 0xc0, 0x05, 0x0c, 0x04, 0xa3, 0x97, 0xa1, 0xa9, 0x9c, 0x78, 0x07,
+  0x0c, 0xc0, 0x05, 0x6f, 0xc0, 0x0c, 0x19, 0x1b, 0x6e, 0x79, 0xa0, 0x8a, 0x1b, 0x7a, 0xa2, 0x67,
+  0x7a, 0xa0, 0xb8, 0x2e, 0xc0, 0x56, 0x1b, 0x11, 0x14, 0xc0, 0x1b, 0x1e, 0x6e, 0x1e, 0x1b, 0xc0,
+  0x14, 0x19, 0x14, 0x0c, 0x0f, 0x23, 0x19, 0x25, 0xc0, 0x20, 0x23, 0x4a, 0x4f, 0x56, 0xa1, 0xa8,
+  0xa1, 0xc8, 0x30, 0x37, 0x30, 0xc0, 0x7b, 0x30, 0x67, 0x37, 0x56, 0x56, 0xa2, 0x77, 0xc0, 0x6e,
+  0x76, 0x61, 0xa4, 0xa8, 0x5e, 0x56, 0x13, 0xc0, 0x0b, 0x46, 0xc0, 0xa3, 0xa8, 0xc0, 0x56, 0x56,
+  0x6e, 0x56, 0x5a, 0xa1, 0xa9, 0xa1, 0xa8, 0x5a, 0x6e, 0x23, 0x46, 0x7e, 0x23, 0x1b, 0xa2, 0x77,
+  0x72, 0x49, 0x09, 0x55, 0xa3, 0xb8, 0x7e, 0x7b, 0x17, 0x0c, 0xc0, 0x14, 0x1c, 0x7f, 0x17, 0x69,
+  0x56, 0x0f, 0x59, 0x08, 0xa2, 0xa7, 0x08, 0x57, 0x10, 0x0b, 0x66, 0x0b, 0xa1, 0xa9, 0x34, 0x6b,
+  0x6d, 0x08, 0x0f, 0xc0, 0x49, 0xc0, 0x57, 0x49, 0x66, 0x6b, 0x55, 0x6e, 0xc0, 0x27, 0x66, 0xc1,
+  0x69, 0xc0, 0x27, 0x22, 0x1b, 0x22, 0x7e, 0x22, 0x27, 0x2a, 0x66, 0x55, 0x1b, 0xc1, 0x16, 0xc0,
+  0x7a, 0x6e, 0x16, 0x66, 0x16, 0xa2, 0x97, 0x1b, 0x16, 0x1b, 0x22, 0x27, 0xc0, 0xa1, 0xa8, 0x05,
+  0x57, 0x2f, 0x22, 0x1b, 0x27, 0xa1, 0xb8, 0x00, 0x4e, 0x2c, 0x27, 0xc0, 0x6b, 0x27, 0x2c, 0x63,
+  0x27, 0x6f, 0x2c, 0xc0, 0x32, 0x36, 0x7e, 0x01, 0x33, 0x2c, 0xa1, 0xa8, 0x09, 0x0c, 0x3e, 0x34,
+  0x27, 0x2a, 0x17, 0xfe, 0x13, 0xb3, 0xc1, 0x6e, 0x6e, 0x21, 0x1c, 0xc1, 0x21, 0xc4, 0x26, 0xc0,
+  0x6b, 0x6e, 0xc1, 0x26, 0xc0, 0x21, 0xd1, 0x1c, 0x21, 0xc0, 0x65, 0xa5, 0xa7, 0xa6, 0xa8, 0x9b,
+  0x4a, 0x32, 0x7e, 0x32, 0x7f, 0x3a, 0x67, 0x2d, 0xc0, 0x26, 0x32, 0x01, 0x26, 0x3a, 0x6f, 0x52,
+  0x01, 0x3a, 0x66, 0xc2, 0x3a, 0x7a, 0x35, 0x2d, 0x32, 0x2d, 0x21, 0x35, 0x3a, 0x26, 0x35, 0x06,
+  0x39, 0x32, 0x01, 0xc0, 0x5a, 0xc0, 0x3a, 0x3d, 0x7b, 0x3a, 0xa1, 0xa8, 0x7f, 0x56, 0x32, 0x2d,
+  0x35, 0x3d, 0x7a, 0x05, 0x0c, 0x56, 0xa2, 0x87, 0x14, 0x0c, 0x3d, 0xc0, 0x00, 0xc0, 0x07, 0x35,
+  0x14, 0x6b, 0x00, 0x11, 0x0c, 0xc0, 0x7a, 0x07, 0x04, 0x3a, 0xa3, 0xb8, 0x0c, 0x04, 0x3d, 0x07,
+  0x0c, 0xc0, 0x35, 0x3e, 0x01, 0xc0, 0x11, 0xa0, 0xa8, 0x14, 0x46, 0xc0, 0x04, 0x09, 0xa2, 0xa8,
+  0x7a, 0x6e, 0xc0, 0x0f, 0x3d, 0xa2, 0xa9, 0x23, 0x1b, 0x14, 0x1c, 0x17, 0x0f, 0x14, 0xc0, 0x1e,
+  0x0c, 0x01, 0x0c, 0x1e, 0x11, 0x0c, 0xc0, 0xa2, 0x88, 0x23, 0x6e, 0x4a, 0x57, 0x6e, 0xa1, 0xb8,
+  0x76, 0x7a, 0x5e, 0x69, 0xc0, 0x6f, 0x41, 0x6b, 0x55, 0x4b, 0xc0, 0xa1, 0xc8, 0xa1, 0xa8, 0x30,
+  0x2b, 0xa2, 0x98, 0x5f, 0x5a, 0xc0, 0x0b, 0xc0, 0x66, 0x08, 0xa1, 0xa9, 0x5a, 0x56, 0xc1, 0x5a,
+  0x6e, 0xa1, 0xa8, 0x7f, 0x52, 0x11, 0x1c, 0x6b, 0x55, 0xc0, 0x6e, 0xc0, 0x0c, 0x4a, 0x55, 0x0c,
+  0xa3, 0xa7, 0x1c, 0x17, 0x59, 0x1c, 0x14, 0x0f, 0x14, 0x1c, 0x17, 0xc0, 0x45, 0x62, 0xc0, 0xa3,
+  0xa7, 0xa0, 0xa8, 0x34, 0xc0, 0xa1, 0xa8, 0xc0, 0x32, 0xa3, 0x98, 0xa2, 0x87, 0x2f, 0x5f, 0x08,
+  0x0b, 0x46, 0x4b, 0x4a, 0xa0, 0xa7, 0x47, 0xc1, 0x51, 0xa2, 0x87, 0x7b, 0x40, 0xc0, 0x66, 0xc0,
+  0x1b, 0xc1, 0x22, 0x1b, 0xc0, 0x6f, 0xc0, 0x22, 0x1b, 0xc1, 0x16, 0xc0, 0x1b, 0xc0, 0x16, 0x1b,
+  0x2f, 0x9d, 0xa9, 0x55, 0x16, 0x1b, 0xa1, 0xb9, 0x22, 0x16, 0xa2, 0x77, 0x27, 0x67, 0x22, 0xa1,
+  0xa8, 0x3a, 0x2f, 0xc0, 0xa1, 0xb9, 0x9e, 0x68, 0x22, 0xa2, 0xa7, 0x7e, 0x2f, 0x27, 0xc0, 0x22,
+  0x27, 0x14, 0x2a, 0x22, 0x27, 0xc1, 0x6f, 0x69, 0xa1, 0xa9, 0x36, 0x2f, 0x5f, 0x33, 0x3b, 0xa1,
+  0xb8, 0xa0, 0xa9, 0x3b, 0x27, 0x37, 0xa4, 0xa8, 0x43, 0xfe, 0x13, 0xd3, 0x66, 0xc1, 0x21, 0xc0,
+  0x1c, 0x21, 0x1c, 0x21, 0xc4, 0x6e, 0xc0, 0x6b, 0x26, 0x21, 0x2d, 0x26, 0xc0, 0x21, 0xd0, 0x26,
+  0x21, 0x1c, 0x21, 0xa2, 0x97, 0xa6, 0xa8, 0x5f, 0x99, 0x7a, 0x5e, 0x75, 0x5b, 0x69, 0x35, 0xc0,
+  0x2d, 0xc1, 0x26, 0x35, 0x2d, 0xc0, 0x32, 0x3e, 0x35, 0x65, 0x7f, 0x6f, 0x32, 0x76, 0x2d, 0x35,
+  0xc0, 0x26, 0xc0, 0x2d, 0xc0, 0x26, 0x35, 0x26, 0x2d, 0x32, 0xc0, 0x3e, 0xc0, 0x39, 0x3e, 0xc1,
+  0xa1, 0xa8, 0x04, 0xc0, 0x69, 0x7f, 0xc0, 0x45, 0xc0, 0x35, 0x3d, 0x7b, 0x69, 0xc0, 0x6e, 0x7f,
+  0x66, 0x3d, 0x04, 0x3d, 0x38, 0x35, 0x0c, 0x3d, 0x35, 0xa3, 0x98, 0x0c, 0xc1, 0x05, 0x0c, 0x07,
+  0xc0, 0x38, 0x3a, 0x0c, 0x0f, 0x76, 0x3d, 0x09, 0x5a, 0x32, 0x3e, 0x3a, 0x35, 0x06, 0x09, 0x39,
+  0x2d, 0xa3, 0x77, 0x06, 0x39, 0x7e, 0x14, 0x7e, 0xc0, 0x04, 0x30, 0x0c, 0x14, 0x6e, 0x14, 0xc0,
+  0x6b, 0x0c, 0x09, 0xc0, 0x01, 0x3e, 0x39, 0x3e, 0x7d, 0x04, 0x0f, 0x14, 0x1c, 0x66, 0x7f, 0x4a,
+  0x5a, 0x7f, 0x7e, 0x7e, 0x76, 0xc0, 0x5a, 0x65, 0x6b, 0x5a, 0x9f, 0x69, 0x4a, 0x67, 0x7d, 0x3c,
+  0x3a, 0x33, 0x32, 0x37, 0x6f, 0x5a, 0x55, 0xa2, 0xa8, 0xc0, 0x7a, 0x0b, 0x5a, 0x6b, 0x08, 0x6f,
+  0x0f, 0xa2, 0x87, 0x14, 0x1c, 0x5a, 0x52, 0xc1, 0x6e, 0x56, 0xc0, 0x11, 0x0c, 0x09, 0x9e, 0x59,
+  0x7e, 0x1c, 0x55, 0x56, 0xa0, 0xa9, 0x6d, 0x7f, 0x56, 0x05, 0x17, 0x0d, 0x03, 0xa2, 0x98, 0x0b,
+  0x2c, 0x03, 0xa1, 0xb8, 0x6e, 0x41, 0x3c, 0x6e, 0x0b, 0x0e, 0xa1, 0xa8, 0x3c, 0x31, 0x05, 0x17,
+  0x03, 0x9e, 0x69, 0xa1, 0x58, 0x67, 0x79, 0x5a, 0x66, 0x27, 0xc0, 0x2a, 0x1b, 0xc0, 0x66, 0x1b,
+  0xc0, 0x6e, 0x27, 0xc0, 0x22, 0x1b, 0xc0, 0x27, 0xc0, 0x1b, 0x16, 0xc3, 0x1b, 0x16, 0xc0, 0x1b,
+  0x1e, 0x16, 0xc1, 0x21, 0x30, 0x22, 0xc0, 0x27, 0xc0, 0x22, 0x2a, 0x7e, 0x2c, 0x22, 0x32, 0xa3,
+  0xd7, 0x9d, 0x5a, 0x27, 0x32, 0x5a, 0x27, 0x22, 0x27, 0x79, 0x1a, 0x1c, 0x9b, 0x5b, 0x22, 0x27,
+  0xc0, 0x33, 0xc0, 0xa1, 0xa8, 0x09, 0x66, 0x5a, 0xa0, 0x58, 0x2c, 0x3b, 0x09, 0xa2, 0xb8, 0x9e,
+  0x59, 0x9f, 0x69, 0xa7, 0xe6, 0xa5, 0xc8, 0x9c, 0x59, 0xfe, 0x13, 0xd3, 0xc0, 0x66, 0x21, 0x1c,
+  0x21, 0xc1, 0x1c, 0xc0, 0x21, 0xc0, 0x6e, 0x21, 0x26, 0xc0, 0x21, 0xc0, 0x26, 0x21, 0xc1, 0x26,
+  0x21, 0xc7, 0x26, 0x21, 0xc5, 0x7a, 0x21, 0xc0, 0x1c, 0x24, 0xa5, 0xa7, 0xa2, 0x89, 0x9d, 0x5a,
+  0x55, 0xc0, 0x75, 0x56, 0xc0, 0x35, 0xc1, 0x66, 0x2d, 0xc1, 0x35, 0x6e, 0x6b, 0x3a, 0x35, 0x7a,
+  0x3a, 0xa0, 0xa9, 0x59, 0x30, 0x2d, 0xc0, 0x6e, 0x2d, 0x26, 0x30, 0x2d, 0x21, 0x26, 0x35, 0x26,
+  0x2d, 0x32, 0x6b, 0x3e, 0xc0, 0x32, 0x3e, 0x39, 0x7a, 0x32, 0xa1, 0xa9, 0x07, 0x3a, 0xc0, 0x32,
+  0xa2, 0xa8, 0x35, 0x38, 0xa1, 0xa8, 0x07, 0xc0, 0x69, 0xc0, 0x07, 0x38, 0x00, 0x38, 0x35, 0x01,
+  0x3d, 0x00, 0x38, 0x7a, 0x07, 0x0c, 0x07, 0x0c, 0xc0, 0x07, 0x3d, 0x04, 0x38, 0x00, 0x0c, 0x7a,
+  0x01, 0x3a, 0x01, 0xc1, 0x3b, 0x7f, 0x38, 0x3a, 0x3e, 0x32, 0x35, 0x0c, 0x35, 0x2d, 0x01, 0xc0,
+  0x3e, 0xc0, 0x01, 0x0c, 0x0f, 0x6e, 0x5a, 0x04, 0x5e, 0x55, 0x32, 0x3c, 0x3a, 0xc0, 0x3d, 0x35,
+  0xc0, 0x3a, 0xc0, 0x7f, 0x0c, 0x14, 0x6b, 0x7e, 0x69, 0x23, 0x7f, 0x7e, 0x69, 0x3a, 0xc0, 0x2b,
+  0x4b, 0xc0, 0x9f, 0x69, 0x5a, 0xc0, 0x1e, 0x2c, 0x7a, 0x69, 0x2f, 0x7f, 0x5d, 0x7f, 0x7a, 0xa2,
+  0x97, 0x0b, 0x6e, 0x08, 0xc0, 0x0b, 0x08, 0x7b, 0x7e, 0x6e, 0x9e, 0x69, 0x9e, 0x68, 0x0c, 0xc0,
+  0x5a, 0x5a, 0x69, 0x7a, 0x06, 0xc0, 0x09, 0x46, 0x45, 0xa1, 0xc9, 0x1f, 0x45, 0x0c, 0x65, 0x39,
+  0xa2, 0xb8, 0x0d, 0x9d, 0x89, 0xa0, 0xa9, 0x7d, 0x52, 0x16, 0x56, 0x2f, 0x7e, 0x2f, 0xa2, 0x87,
+  0x7b, 0x3c, 0xc0, 0x3e, 0x06, 0x3c, 0x42, 0xa3, 0x88, 0x08, 0x57, 0x55, 0x4f, 0x55, 0x52, 0x69,
+  0x22, 0x65, 0x1b, 0x22, 0x1b, 0xc0, 0x16, 0xc0, 0x22, 0xc0, 0x1b, 0x2f, 0x56, 0x22, 0xc0, 0x16,
+  0x1b, 0x27, 0x1b, 0x16, 0x66, 0x16, 0xc2, 0x1b, 0x16, 0xc3, 0x1e, 0xa1, 0xa9, 0x69, 0x1e, 0x5e,
+  0x7b, 0x27, 0x6e, 0x2a, 0x6f, 0x56, 0x22, 0xa2, 0x97, 0xa1, 0xa8, 0x2a, 0xc0, 0x32, 0x27, 0x20,
+  0x27, 0xc0, 0x09, 0xa2, 0x97, 0x2c, 0x63, 0x22, 0x7f, 0x5e, 0x2c, 0x3e, 0xa1, 0xc8, 0x3d, 0x04,
+  0x5b, 0x36, 0x6e, 0x09, 0xa2, 0x98, 0x7f, 0xa3, 0x97, 0xa1, 0xa9, 0x56, 0x46, 0xa4, 0xb7, 0xfe,
+  0x13, 0xb3, 0x6e, 0xc1, 0x1c, 0xc0, 0x21, 0x1c, 0xc0, 0x21, 0x6e, 0xc1, 0x21, 0xc0, 0x26, 0xc0,
+  0x67, 0x21, 0xc0, 0x28, 0x21, 0xc8, 0x26, 0xc0, 0x21, 0xc7, 0x1c, 0x69, 0xa3, 0xb8, 0xa4, 0x98,
+  0x9e, 0x49, 0x46, 0x65, 0x76, 0x26, 0xc0, 0x6b, 0x30, 0x7e, 0x66, 0x30, 0xc0, 0x26, 0x2d, 0x7e,
+  0xc0, 0x6e, 0x35, 0x38, 0x6f, 0x3a, 0x35, 0xc1, 0x32, 0xc0, 0x35, 0x38, 0x35, 0x30, 0x2d, 0xc1,
+  0x35, 0x2d, 0x21, 0x32, 0x6b, 0x3e, 0x32, 0x39, 0x32, 0x3e, 0xc0, 0x2d, 0x35, 0x04, 0x3a, 0x32,
+  0xc2, 0x38, 0xa1, 0xa8, 0x4a, 0x04, 0x66, 0x38, 0xc0, 0x3d, 0x7a, 0x09, 0x2d, 0x35, 0x04, 0x38,
+  0x3d, 0xc1, 0x7b, 0x6e, 0xc1, 0x04, 0x38, 0x3d, 0xc0, 0x07, 0x3f, 0x32, 0x7b, 0x39, 0xc0, 0x3e,
+  0x3c, 0x35, 0xa2, 0xc8, 0x46, 0x04, 0x49, 0x3e, 0x39, 0x32, 0x3e, 0xc0, 0x32, 0x3e, 0xc0, 0x39,
+  0xa2, 0x87, 0xa1, 0xb8, 0x0c, 0x46, 0x3e, 0xc0, 0x32, 0x3a, 0x04, 0x75, 0x38, 0xc2, 0x35, 0x3a,
+  0x01, 0x39, 0x3e, 0x01, 0x3d, 0xa2, 0x88, 0x6b, 0x59, 0x6b, 0xa2, 0x87, 0xa1, 0xb9, 0x7a, 0x37,
+  0x55, 0x4b, 0x4b, 0x56, 0xa1, 0xa7, 0x29, 0x26, 0x66, 0xa0, 0xa8, 0x21, 0x7d, 0xa1, 0xaa, 0x6e,
+  0xa2, 0x97, 0xa2, 0xa8, 0x9d, 0x79, 0x56, 0xc0, 0x4a, 0x00, 0xa1, 0xa9, 0x5a, 0x7e, 0xc0, 0x0f,
+  0x9e, 0x58, 0xc0, 0xa2, 0xa8, 0x5a, 0x59, 0x09, 0xc0, 0x3f, 0x32, 0x09, 0xc0, 0x9e, 0x68, 0xa3,
+  0xc8, 0xa1, 0xa8, 0x10, 0x0b, 0x9d, 0x7a, 0x28, 0xa3, 0xa8, 0xa2, 0xa9, 0x9d, 0x78, 0x9e, 0x69,
+  0x03, 0x79, 0x3a, 0xa3, 0x98, 0x37, 0x46, 0xa2, 0x97, 0x03, 0x66, 0x37, 0x5a, 0x2c, 0xc0, 0x6e,
+  0x6b, 0x5a, 0xa3, 0x97, 0x0f, 0x9e, 0x48, 0x6b, 0x2f, 0x56, 0x61, 0x6e, 0x6b, 0x1b, 0xc0, 0x16,
+  0xc3, 0x27, 0x1b, 0xc0, 0x2f, 0x22, 0xc1, 0x1b, 0xc2, 0x16, 0x66, 0x16, 0x65, 0x16, 0x1b, 0xc0,
+  0xa1, 0xb9, 0x46, 0x16, 0xc1, 0x7e, 0x6e, 0x30, 0x03, 0xa1, 0xa8, 0x32, 0x27, 0x22, 0xa3, 0xb8,
+  0x5a, 0x22, 0xa1, 0xa8, 0x3d, 0x32, 0x56, 0x17, 0xc0, 0x9b, 0x4b, 0x22, 0x27, 0x2f, 0x7f, 0x27,
+  0xc1, 0x6f, 0xc1, 0x69, 0x36, 0xa0, 0xa8, 0x17, 0xa2, 0x78, 0x42, 0x4a, 0x67, 0xa6, 0xc4, 0xa6,
+  0xb7, 0x9c, 0x5b, 0x65, 0xa6, 0xc6, 0x47, 0xa4, 0xa7, 0xa3, 0xb7, 0xfe, 0x13, 0xb3, 0x6e, 0xc0,
+  0x1c, 0xc3, 0x21, 0xc0, 0x6e, 0xc1, 0x21, 0xc1, 0x26, 0x67, 0x21, 0xc0, 0x6f, 0x21, 0xc8, 0x26,
+  0xc0, 0x21, 0xc8, 0x65, 0xa6, 0xb7, 0xa2, 0x78, 0x9c, 0x59, 0x2d, 0x26, 0x21, 0xc1, 0x26, 0x2d,
+  0xc3, 0x26, 0x28, 0xa2, 0x77, 0xa1, 0xa8, 0x5b, 0x59, 0x9f, 0xb9, 0x5a, 0x38, 0x55, 0x2d, 0x32,
+  0xc0, 0x35, 0x3d, 0x38, 0x35, 0x26, 0x7b, 0x28, 0xc0, 0x32, 0x2d, 0xc2, 0x01, 0x5a, 0x66, 0x32,
+  0x39, 0xa2, 0xa7, 0x32, 0x2d, 0x35, 0x30, 0x7f, 0x38, 0x2d, 0x3a, 0xa0, 0xa8, 0x7b, 0x30, 0x6f,
+  0x7e, 0x3d, 0xc2, 0x00, 0x38, 0x26, 0x04, 0xc0, 0x7a, 0x38, 0x3d, 0x00, 0x04, 0x00, 0x0c, 0x7a,
+  0x38, 0xc0, 0x01, 0x3d, 0x01, 0x3a, 0x04, 0xc0, 0x39, 0x01, 0x39, 0xa2, 0x87, 0xa1, 0xb8, 0x76,
+  0x07, 0x06, 0x0c, 0x5a, 0x3e, 0x3c, 0xa3, 0x87, 0x7a, 0x0c, 0x01, 0xc0, 0x3e, 0x3c, 0x3e, 0x39,
+  0x3e, 0x01, 0x3a, 0x3d, 0x3f, 0x35, 0xc1, 0x32, 0xc0, 0x2d, 0x39, 0x30, 0x39, 0x32, 0x2d, 0x32,
+  0x3e, 0x6f, 0xc1, 0x6e, 0xa2, 0xc8, 0xa1, 0xa8, 0x4a, 0x56, 0x4a, 0x46, 0x66, 0xa2, 0xd7, 0xa2,
+  0x87, 0x2f, 0x56, 0x5e, 0x65, 0x26, 0x7e, 0xa0, 0xa9, 0xa2, 0x87, 0x56, 0x26, 0xa2, 0x97, 0xa0,
+  0xa9, 0x4a, 0x00, 0x03, 0x7f, 0x08, 0xc0, 0x9e, 0x49, 0x56, 0xa2, 0xa7, 0x7b, 0x4a, 0x56, 0xa2,
+  0xa7, 0xc0, 0x2f, 0xa3, 0xb7, 0xa1, 0xb9, 0x9d, 0x5a, 0x65, 0xa3, 0xc7, 0x56, 0x59, 0xa1, 0xb9,
+  0x34, 0xa1, 0xa9, 0x3f, 0x7a, 0x6f, 0x3f, 0x03, 0x3f, 0x13, 0x3f, 0x2c, 0x7a, 0xa4, 0x87, 0x7b,
+  0x00, 0x62, 0x7e, 0x29, 0x26, 0x00, 0x7f, 0x49, 0x7a, 0x35, 0x4b, 0x27, 0x1b, 0x6b, 0x1b, 0xc0,
+  0x66, 0x1b, 0x22, 0x1b, 0x16, 0xc1, 0x1b, 0x22, 0x1b, 0x22, 0x27, 0x1b, 0x22, 0x1b, 0xc1, 0x16,
+  0x1b, 0x62, 0xc1, 0x16, 0xc1, 0x1b, 0xa1, 0xa9, 0x7a, 0x45, 0x1b, 0xa0, 0xa9, 0x05, 0x9d, 0x6a,
+  0x66, 0x13, 0x08, 0x2a, 0xc0, 0x35, 0xa4, 0xd7, 0x1f, 0x2a, 0x02, 0x3a, 0x30, 0x7e, 0x1f, 0x5a,
+  0x9d, 0x5a, 0x36, 0x5a, 0xc0, 0x69, 0x67, 0x22, 0x33, 0x6e, 0x63, 0x2e, 0x36, 0x33, 0xc0, 0xa7,
+  0xf5, 0xa3, 0xa9, 0x9a, 0x2b, 0xa6, 0xd5, 0x6b, 0x9e, 0x69, 0xa3, 0xb7, 0x6e, 0xa4, 0xb8, 0xa3,
+  0xc7, 0x56, 0xa2, 0x97, 0x6e, 0xfe, 0x13, 0xd3, 0x66, 0x21, 0xc1, 0x1c, 0xc2, 0x21, 0xc3, 0x6e,
+  0x21, 0xcd, 0x26, 0xc0, 0x1c, 0x21, 0xc7, 0x1c, 0xa4, 0x96, 0xa3, 0xa8, 0x9f, 0x69, 0x9d, 0x7a,
+  0x21, 0xc2, 0x1c, 0x21, 0x26, 0xc0, 0x6b, 0xc2, 0x21, 0xc0, 0xa3, 0x98, 0x6b, 0x55, 0x39, 0x43,
+  0x26, 0x7a, 0x2d, 0x30, 0x32, 0xa0, 0xa8, 0x65, 0x30, 0x35, 0x21, 0xc0, 0x2d, 0x26, 0x21, 0x2d,
+  0xc2, 0x32, 0x35, 0x32, 0x6b, 0x32, 0x7f, 0x5a, 0x2d, 0x35, 0x32, 0x38, 0xa2, 0x88, 0x01, 0x66,
+  0x3d, 0x7a, 0x6b, 0x3d, 0xc0, 0x07, 0x00, 0x38, 0x04, 0x3d, 0x00, 0x3d, 0x04, 0x38, 0xa1, 0xa9,
+  0x3d, 0x38, 0x07, 0x3d, 0x38, 0x00, 0x7a, 0x6f, 0x3d, 0x5a, 0x7f, 0x5a, 0x7e, 0x7a, 0x09, 0x01,
+  0x0e, 0x06, 0xa1, 0xb9, 0x7e, 0x1b, 0x7a, 0xa2, 0x97, 0x5a, 0x07, 0xa2, 0x97, 0x23, 0xc0, 0xa1,
+  0xb8, 0x9e, 0x58, 0x09, 0x59, 0x32, 0x39, 0x01, 0x3e, 0x01, 0x04, 0x35, 0x32, 0xc0, 0x2d, 0x32,
+  0xc0, 0x2d, 0x6b, 0x65, 0x2d, 0xc1, 0x28, 0xc0, 0x39, 0x3e, 0xa2, 0x78, 0x62, 0x6e, 0xc0, 0xa2,
+  0xa8, 0xa2, 0xb7, 0x2b, 0xa0, 0x59, 0x9f, 0x69, 0xc1, 0xa2, 0xc7, 0xa1, 0xa8, 0x56, 0x56, 0xc0,
+  0x59, 0x24, 0xa2, 0x77, 0xa0, 0xa9, 0x55, 0x6e, 0x6f, 0x2c, 0x3d, 0x66, 0x46, 0x6e, 0x3d, 0x7a,
+  0x47, 0x9f, 0x68, 0x6e, 0x6b, 0x75, 0xa2, 0x78, 0x7a, 0x7a, 0x3e, 0x55, 0xa2, 0xd8, 0x59, 0x9d,
+  0x89, 0x34, 0x37, 0x59, 0xa3, 0xa9, 0xc0, 0x37, 0xc0, 0x56, 0x34, 0x7e, 0xc0, 0x37, 0x2f, 0x37,
+  0x2f, 0x34, 0x7f, 0xa2, 0x87, 0x03, 0x9f, 0x69, 0x3d, 0x52, 0x35, 0x38, 0x03, 0x6f, 0x4a, 0x01,
+  0x3b, 0x55, 0x62, 0x65, 0xc1, 0x1b, 0xc0, 0x22, 0x1b, 0x16, 0x66, 0x0a, 0x11, 0x7e, 0x16, 0x27,
+  0x22, 0x16, 0x22, 0x1b, 0x16, 0xc0, 0x1b, 0xc0, 0x16, 0xc0, 0x11, 0x16, 0x22, 0xc0, 0x1b, 0x16,
+  0xc0, 0x1b, 0x19, 0x1b, 0x7e, 0x3d, 0x22, 0x00, 0xa3, 0xc7, 0x9a, 0x2b, 0xa3, 0x97, 0x3b, 0x76,
+  0xa1, 0xa8, 0x49, 0x57, 0x01, 0x32, 0x04, 0xc0, 0x39, 0x27, 0x3a, 0x6f, 0x9f, 0x69, 0xa0, 0xa9,
+  0x3b, 0x27, 0x3e, 0x6f, 0x33, 0x36, 0xa3, 0x97, 0x0a, 0x46, 0x7a, 0xa6, 0xe5, 0xa2, 0x79, 0x66,
+  0xa5, 0xc7, 0x56, 0x6e, 0x56, 0xa4, 0xb7, 0xa3, 0xa7, 0x9b, 0x6a, 0xa1, 0xb8, 0x4a, 0xa2, 0x97,
+  0xfe, 0x13, 0xd3, 0x66, 0x21, 0x1c, 0xc4, 0x21, 0x6e, 0xc0, 0x21, 0xc5, 0x26, 0x21, 0x26, 0x21,
+  0x26, 0x21, 0xc4, 0x26, 0xc0, 0x21, 0xc8, 0xa2, 0x97, 0xa4, 0xb7, 0x4b, 0x9c, 0x59, 0x9d, 0xa9,
+  0x21, 0x1c, 0x21, 0xc5, 0x26, 0xc2, 0x7b, 0x26, 0x32, 0x30, 0x6d, 0x57, 0x7e, 0x65, 0x57, 0x30,
+  0x2d, 0x30, 0x5d, 0x26, 0xc0, 0xa2, 0x98, 0x30, 0x21, 0xc1, 0x26, 0xc1, 0x2d, 0xc1, 0x32, 0x7f,
+  0x5a, 0xa0, 0xa8, 0x59, 0x35, 0x30, 0x35, 0xc0, 0x3d, 0x01, 0x32, 0x3d, 0x66, 0xa1, 0xa9, 0x5a,
+  0x3d, 0x0a, 0x35, 0xc0, 0xa2, 0x88, 0x38, 0x07, 0xc0, 0x3d, 0x38, 0x07, 0x30, 0x3d, 0x07, 0x3d,
+  0x09, 0x38, 0xc0, 0x07, 0xc0, 0x32, 0x6e, 0x01, 0x35, 0x3e, 0x01, 0xa2, 0x87, 0x01, 0x32, 0x01,
+  0x09, 0xa1, 0xa8, 0x6f, 0x14, 0x09, 0x35, 0xa2, 0x98, 0xa2, 0x98, 0x65, 0x7f, 0x9f, 0x69, 0x9d,
+  0x79, 0x01, 0x3d, 0x38, 0x3d, 0xc0, 0x7a, 0x3d, 0x35, 0x2d, 0x39, 0xc0, 0x2d, 0xc3, 0x28, 0x2d,
+  0xc0, 0x21, 0x28, 0x39, 0x3e, 0x6e, 0x6b, 0x6e, 0xc0, 0x7a, 0xa3, 0xb8, 0xc0, 0x9f, 0x69, 0x56,
+  0xc0, 0x5a, 0xa1, 0xb8, 0xa1, 0xb8, 0x7e, 0x37, 0x66, 0x49, 0x5a, 0x7b, 0xa2, 0x88, 0x69, 0x34,
+  0x7f, 0x39, 0x46, 0x7b, 0xa0, 0x58, 0x52, 0x65, 0xa2, 0x88, 0x5a, 0xc0, 0x6e, 0xc0, 0xa1, 0xa9,
+  0x7f, 0x59, 0x52, 0x2c, 0xa0, 0xa8, 0xa0, 0xa7, 0xc0, 0x37, 0x7a, 0x5e, 0xa1, 0xa8, 0x6b, 0x37,
+  0x69, 0x66, 0x6b, 0x37, 0x56, 0x34, 0x20, 0x6f, 0x34, 0x38, 0xa1, 0xa8, 0x0e, 0x6b, 0x9f, 0x47,
+  0x38, 0x4a, 0x27, 0x2a, 0x00, 0xa1, 0xa8, 0x9f, 0x59, 0x9f, 0x69, 0x2a, 0x32, 0x27, 0x1b, 0x16,
+  0xc1, 0x1b, 0xc0, 0x22, 0x16, 0xc2, 0x66, 0x1b, 0x16, 0xc2, 0x1b, 0x16, 0x1b, 0x22, 0x16, 0x1b,
+  0x67, 0x11, 0x0a, 0x22, 0x1b, 0x16, 0xc1, 0x22, 0x1d, 0x16, 0x1e, 0x00, 0x9e, 0x69, 0x16, 0x00,
+  0x7e, 0x22, 0xa3, 0x88, 0xc0, 0x5a, 0x66, 0xc0, 0x3e, 0x32, 0xa2, 0xa8, 0x4a, 0x66, 0x2c, 0x27,
+  0x01, 0xa2, 0x97, 0x9d, 0x6b, 0x3e, 0xc0, 0xa4, 0xb7, 0xa5, 0xc8, 0x99, 0x2b, 0x41, 0xa3, 0xc7,
+  0xa6, 0xa6, 0x6b, 0x9d, 0x7a, 0x7e, 0x1b, 0xa4, 0xc8, 0xa6, 0xc6, 0x99, 0x5b, 0x0f, 0xa8, 0xc4,
+  0x7f, 0x9c, 0x7a, 0x44, 0x6b, 0x41, 0x9d, 0x79, 0x56, 0xfe, 0x13, 0xb3, 0xc2, 0x6e, 0xc1, 0x6b,
+  0x1c, 0x21, 0x6e, 0xc1, 0x21, 0x26, 0x21, 0x26, 0x21, 0xc2, 0x26, 0x21, 0xc7, 0x26, 0x21, 0xc6,
+  0x1c, 0x69, 0xa6, 0xb7, 0xa4, 0x98, 0x9c, 0x49, 0x9c, 0x79, 0x1c, 0x21, 0xc0, 0x1c, 0x21, 0x7e,
+  0x21, 0xc5, 0x29, 0x6f, 0x1c, 0x21, 0x2d, 0x26, 0x2d, 0x35, 0x29, 0x21, 0xc0, 0x26, 0x2d, 0xc1,
+  0x7a, 0xa2, 0x77, 0x29, 0x21, 0xc1, 0x26, 0xc0, 0x2d, 0x26, 0xc0, 0x2d, 0x30, 0x35, 0x6f, 0xc0,
+  0x55, 0xa0, 0xa8, 0x35, 0x01, 0x7a, 0x2d, 0x35, 0xc0, 0x32, 0x35, 0x38, 0x6e, 0xc0, 0x7a, 0x6e,
+  0x67, 0x3d, 0xc0, 0x38, 0x04, 0x6d, 0x07, 0x3d, 0x38, 0x04, 0xc0, 0x3d, 0x38, 0x7a, 0x00, 0x04,
+  0xc0, 0x38, 0x32, 0x07, 0x3a, 0x01, 0xa3, 0xb8, 0x5a, 0x9c, 0x69, 0xc0, 0x32, 0x6f, 0x7e, 0x3a,
+  0xc0, 0x39, 0x01, 0xa1, 0xa8, 0x7e, 0xc1, 0x04, 0x01, 0x7e, 0x07, 0x38, 0xc0, 0x35, 0xc2, 0x2d,
+  0xc4, 0x28, 0x26, 0xc3, 0x2d, 0x39, 0xa2, 0x77, 0x6b, 0xc2, 0x7e, 0xa2, 0xa7, 0x6f, 0xa0, 0x59,
+  0x66, 0x79, 0xc1, 0xa1, 0xc8, 0x7a, 0xc0, 0x37, 0x25, 0x7b, 0x4f, 0x26, 0xa2, 0xb8, 0x49, 0x26,
+  0xc1, 0x7e, 0x42, 0x5a, 0x6f, 0x2a, 0x59, 0x6f, 0xc0, 0x7f, 0xa2, 0x98, 0x3b, 0x27, 0xa3, 0xa8,
+  0x75, 0x9d, 0x99, 0x6e, 0xa1, 0xa8, 0x3a, 0x56, 0xa2, 0x87, 0x7f, 0x45, 0x37, 0xc2, 0x55, 0x32,
+  0x37, 0x46, 0xc0, 0x24, 0xa2, 0x98, 0x03, 0xa2, 0x98, 0x9e, 0x68, 0x56, 0x35, 0x2a, 0x56, 0x27,
+  0xa1, 0xa8, 0xa2, 0x98, 0x3d, 0x2a, 0x22, 0x2a, 0xc0, 0x22, 0x1b, 0xc0, 0x27, 0x1b, 0xc3, 0x66,
+  0xc1, 0x1b, 0x16, 0xc0, 0x1b, 0xc0, 0x16, 0xc1, 0x22, 0x1b, 0xc1, 0x16, 0xc0, 0x1b, 0x16, 0x66,
+  0x16, 0xc0, 0x7f, 0x22, 0xc0, 0x7d, 0x3d, 0x2a, 0x1b, 0x22, 0xc0, 0x6f, 0x6e, 0xa1, 0xa8, 0x5a,
+  0x33, 0x7f, 0x06, 0x67, 0x33, 0xc2, 0x7b, 0xa3, 0xa7, 0x7e, 0x9c, 0x5a, 0x33, 0xa2, 0xa8, 0xa6,
+  0xd6, 0xa0, 0x57, 0x9a, 0x5b, 0xa6, 0xc7, 0x4a, 0xa0, 0xa7, 0xa4, 0xb7, 0x6b, 0xc0, 0xa6, 0xb5,
+  0xa4, 0xb8, 0x9d, 0x89, 0x56, 0xa3, 0x97, 0x9b, 0x7a, 0xa4, 0x76, 0x56, 0x9c, 0x99, 0x9e, 0x69,
+  0x9d, 0x89, 0x46, 0x9d, 0x69, 0xfe, 0x13, 0xb3, 0xc3, 0x6e, 0xc0, 0x6f, 0x66, 0xc0, 0x21, 0xc0,
+  0x6e, 0x21, 0xc1, 0x26, 0x21, 0xd5, 0x1c, 0xa2, 0x97, 0xa4, 0xb7, 0xa4, 0x68, 0x9b, 0x4a, 0x2d,
+  0x21, 0xc3, 0x7a, 0x21, 0xc0, 0x1c, 0x21, 0xc5, 0x28, 0x2d, 0xc0, 0x6e, 0x21, 0xc2, 0x26, 0x21,
+  0x26, 0xc0, 0x7f, 0x21, 0xc0, 0x26, 0x21, 0xc2, 0x2d, 0x26, 0xc0, 0x2d, 0x35, 0xa1, 0xa8, 0x4a,
+  0x32, 0xc3, 0x76, 0x32, 0xa0, 0xa8, 0xc0, 0x32, 0x35, 0x38, 0x32, 0xa1, 0xa8, 0x38, 0xa2, 0x97,
+  0x6b, 0x35, 0x3d, 0x7f, 0x66, 0x3d, 0xc2, 0x38, 0x3d, 0x07, 0x35, 0x38, 0x07, 0x0f, 0xc1, 0x00,
+  0x07, 0x5a, 0xc0, 0x0c, 0x46, 0x5a, 0x76, 0x04, 0x0c, 0x01, 0x56, 0x3c, 0x3e, 0xc0, 0x0c, 0xc0,
+  0x3a, 0x5a, 0x3e, 0x3a, 0x3d, 0x04, 0x35, 0x3c, 0x39, 0xc0, 0x2d, 0xc6, 0x21, 0xc0, 0x28, 0x2d,
+  0x28, 0x32, 0xc0, 0x39, 0xa2, 0x78, 0x6e, 0x0a, 0xc0, 0x0f, 0xa1, 0xa9, 0x7e, 0x46, 0x5b, 0x69,
+  0x1e, 0xc0, 0x6e, 0xa1, 0xc8, 0x76, 0x6e, 0xc0, 0x56, 0x1e, 0x1b, 0x23, 0x9f, 0xb9, 0x1e, 0x1b,
+  0xc2, 0x66, 0x1b, 0xa2, 0x88, 0x56, 0xc0, 0x6f, 0xa2, 0x87, 0xa0, 0xa8, 0x9e, 0x68, 0xc0, 0x22,
+  0x75, 0xa3, 0xa7, 0x6b, 0x1e, 0xa1, 0xb8, 0x37, 0xc0, 0x34, 0xa1, 0xa9, 0x54, 0x56, 0xc0, 0x6b,
+  0x37, 0x2f, 0x37, 0x6b, 0x2c, 0x5e, 0x38, 0xa1, 0xa8, 0xa2, 0x87, 0x42, 0x38, 0x6e, 0x23, 0x27,
+  0xc0, 0x7e, 0x7a, 0x3d, 0x32, 0x22, 0xc0, 0x1b, 0x22, 0xc1, 0x27, 0xc0, 0x1b, 0xc0, 0x16, 0x1b,
+  0xc0, 0x16, 0xc0, 0x1b, 0x16, 0xc0, 0x1e, 0xc0, 0x16, 0xc1, 0xa2, 0x88, 0x66, 0x51, 0x16, 0xc1,
+  0x6b, 0x1b, 0x16, 0x1b, 0x16, 0x25, 0x27, 0x69, 0x22, 0x27, 0xc0, 0x22, 0x27, 0xc0, 0x67, 0x27,
+  0x33, 0xa2, 0xa8, 0xa2, 0x87, 0x42, 0x45, 0x0a, 0x7e, 0x0a, 0x55, 0x57, 0x0d, 0x4a, 0xa4, 0xb6,
+  0xa1, 0xb9, 0x9e, 0x48, 0xa2, 0xb8, 0x9c, 0x4a, 0x69, 0xa5, 0xc7, 0xa5, 0xc8, 0x9b, 0x5b, 0x6d,
+  0xa3, 0xd8, 0xa2, 0xa7, 0xa5, 0xb7, 0x66, 0x9d, 0x8a, 0x49, 0x9d, 0x79, 0xa2, 0x97, 0x6e, 0x9a,
+  0x7a, 0x69, 0x5e, 0x9a, 0x8a, 0x46, 0x65, 0x57, 0x5e, 0xfe, 0x13, 0xd3, 0x66, 0xc2, 0x21, 0x6e,
+  0x67, 0x26, 0xc0, 0x21, 0xc3, 0x6f, 0x21, 0xc0, 0x26, 0xc0, 0x21, 0xc3, 0x26, 0x21, 0xc2, 0x1c,
+  0x21, 0xc7, 0x69, 0xa3, 0xc8, 0xa6, 0x98, 0x9c, 0x4a, 0x2d, 0x21, 0xc7, 0x1c, 0xc0, 0x21, 0xc3,
+  0x26, 0xc0, 0x28, 0x26, 0x2d, 0x28, 0x21, 0xc2, 0x26, 0xc2, 0x1c, 0xc0, 0x21, 0xc4, 0x2d, 0xc1,
+  0x7e, 0x7e, 0x35, 0xa2, 0x98, 0xa1, 0xa8, 0x9d, 0x79, 0x26, 0x2d, 0xc1, 0x38, 0x5e, 0x77, 0x38,
+  0x35, 0x5a, 0x79, 0x67, 0x35, 0x3d, 0x3a, 0x35, 0xa1, 0xb9, 0x55, 0xa0, 0x57, 0x3d, 0x6b, 0xc0,
+  0x3d, 0xc0, 0x7b, 0x38, 0x3b, 0x07, 0xc0, 0x7e, 0x17, 0x45, 0x3d, 0x0a, 0xc0, 0xa0, 0x58, 0xc0,
+  0x59, 0x0c, 0xc0, 0x79, 0x3d, 0x57, 0x01, 0x04, 0x3a, 0x7f, 0x04, 0x32, 0xc0, 0x6f, 0x3c, 0xc0,
+  0x5a, 0xc0, 0x2d, 0x32, 0x39, 0x30, 0x28, 0x2d, 0xc3, 0x26, 0xc0, 0x2d, 0xc1, 0x28, 0x2d, 0x39,
+  0x3e, 0x6f, 0xc0, 0x6e, 0xc0, 0x6e, 0x7b, 0x66, 0x0f, 0x6b, 0x6e, 0x6f, 0x1b, 0x1e, 0xa0, 0xa8,
+  0xc0, 0x5a, 0xa1, 0xa8, 0x5a, 0x1b, 0xc0, 0x7e, 0x1b, 0x16, 0x1b, 0xc1, 0x16, 0x27, 0xc0, 0x7a,
+  0x5f, 0x6e, 0x7a, 0xa1, 0xc8, 0x46, 0x27, 0xc0, 0x1b, 0x16, 0x1e, 0x7e, 0x1b, 0x24, 0xa2, 0x97,
+  0x65, 0x56, 0xa3, 0x98, 0x66, 0xc0, 0xa1, 0xb8, 0x46, 0x28, 0x3c, 0x6b, 0x45, 0x5b, 0x7d, 0x7b,
+  0x7e, 0x5a, 0x56, 0xc0, 0x2a, 0x27, 0x69, 0xa2, 0x98, 0x9f, 0xb9, 0x5e, 0xc0, 0x20, 0x67, 0x7a,
+  0x27, 0x22, 0x27, 0xc0, 0x22, 0x27, 0x1b, 0xc0, 0x16, 0xc0, 0x1b, 0xc0, 0x16, 0xc1, 0x1b, 0x2a,
+  0x52, 0x65, 0x16, 0x1b, 0x2a, 0x1e, 0x11, 0x16, 0xc0, 0x1b, 0x16, 0x11, 0x1d, 0x1b, 0x27, 0xc2,
+  0x22, 0xa2, 0x77, 0x27, 0x22, 0x2a, 0x3b, 0x33, 0xc0, 0x6e, 0xa4, 0xd7, 0xc0, 0x9d, 0x3a, 0xa1,
+  0xb8, 0x6f, 0x04, 0x7a, 0x04, 0xa0, 0xa9, 0x04, 0x38, 0xa3, 0xa8, 0xa3, 0xc8, 0x7a, 0xa4, 0x97,
+  0x9b, 0x3a, 0xa0, 0xa8, 0xa7, 0xe7, 0xa4, 0xa7, 0x9a, 0x7a, 0xa2, 0x96, 0x5a, 0x3c, 0xa7, 0xb6,
+  0x57, 0x98, 0x6a, 0x5d, 0x7a, 0x46, 0x96, 0x3c, 0x9f, 0x67, 0x00, 0x6b, 0x5a, 0xa4, 0xc7, 0xa3,
+  0x97, 0x7f, 0x4a, 0xfe, 0x13, 0xd3, 0x66, 0x21, 0xc0, 0x1c, 0x21, 0x6e, 0x21, 0xc0, 0x26, 0x21,
+  0xc0, 0x26, 0x6b, 0xc1, 0x26, 0x21, 0xc0, 0x26, 0x21, 0xc7, 0x1c, 0x21, 0xc8, 0x1c, 0xa5, 0xa7,
+  0xa6, 0x97, 0x9a, 0x4a, 0x50, 0x61, 0x21, 0x2d, 0x75, 0x21, 0x26, 0x21, 0xc1, 0x1c, 0xc0, 0x21,
+  0xc5, 0x26, 0x6f, 0x26, 0x67, 0x26, 0xc0, 0x2d, 0xc0, 0x26, 0x21, 0x26, 0xc0, 0x21, 0xc3, 0x7b,
+  0x21, 0x1c, 0x26, 0x2d, 0xc1, 0x26, 0x7b, 0xa2, 0x87, 0x7f, 0x3d, 0x32, 0xc1, 0x2d, 0x26, 0x2d,
+  0xa1, 0xa8, 0x5a, 0x2d, 0x38, 0xc0, 0x2d, 0xc0, 0x35, 0xc0, 0x5e, 0x35, 0xa1, 0xb9, 0x0c, 0x56,
+  0x66, 0x7d, 0x0a, 0x00, 0x3d, 0x04, 0x0a, 0x55, 0x2d, 0xa2, 0x88, 0xc0, 0x69, 0x01, 0xa1, 0xc8,
+  0xa1, 0xa8, 0x9d, 0x6a, 0x04, 0xc0, 0xa1, 0xa8, 0x0c, 0x7e, 0x55, 0x3d, 0xc0, 0x00, 0x3d, 0x3a,
+  0x01, 0x3a, 0x01, 0x56, 0x2d, 0x6b, 0x2d, 0xc3, 0x28, 0x2d, 0x28, 0x2d, 0xc2, 0x26, 0x2d, 0xc0,
+  0x32, 0xc0, 0x28, 0x2d, 0x39, 0xa2, 0x78, 0x6e, 0x0a, 0xc1, 0x0f, 0x6f, 0x6e, 0x1b, 0x66, 0x1b,
+  0x20, 0x6b, 0x66, 0x27, 0xc0, 0x1b, 0x20, 0x27, 0x75, 0xa1, 0xa8, 0x5a, 0x1b, 0x1e, 0x1b, 0xc1,
+  0x27, 0x6e, 0xa1, 0xa9, 0x56, 0x5e, 0xc0, 0x2c, 0xa1, 0xa8, 0x52, 0xc1, 0x1b, 0xc3, 0x7e, 0x9e,
+  0xb9, 0x7d, 0x7e, 0xa2, 0x98, 0x57, 0x69, 0x3f, 0x37, 0x7f, 0x5e, 0x37, 0x26, 0x57, 0xa2, 0xa6,
+  0x08, 0x7a, 0x9e, 0x49, 0x7b, 0x55, 0x27, 0x2d, 0xa3, 0x97, 0x66, 0x2c, 0x7a, 0x32, 0x2d, 0x22,
+  0x27, 0xc3, 0x22, 0x27, 0x22, 0x1b, 0x16, 0xc0, 0x1b, 0xc0, 0x16, 0xc0, 0x1e, 0xc0, 0x1b, 0x16,
+  0xc0, 0x1e, 0x2d, 0x26, 0x1b, 0xc2, 0x16, 0xc1, 0x23, 0x1e, 0x27, 0xc0, 0x22, 0x27, 0xc0, 0x36,
+  0x2c, 0x22, 0x27, 0xc0, 0x6f, 0xc0, 0xa2, 0x97, 0xa3, 0xc8, 0x9d, 0x5a, 0xa1, 0xa8, 0xa5, 0xc7,
+  0x46, 0x9c, 0x49, 0x9d, 0x8a, 0xa4, 0x86, 0xa5, 0xd8, 0x9c, 0x5a, 0x9d, 0x69, 0xa3, 0xc8, 0xa3,
+  0xb7, 0xa2, 0x87, 0x9e, 0x69, 0xa1, 0xb8, 0xa4, 0xc7, 0xa1, 0xa7, 0x42, 0x41, 0x6f, 0x7e, 0xa4,
+  0x97, 0x63, 0x98, 0x38, 0x9d, 0x89, 0x08, 0xa4, 0x97, 0x9c, 0x5b, 0x55, 0xa5, 0xb8, 0x5a, 0xa1,
+  0xb8, 0xa2, 0x98, 0xa2, 0xa7, 0x31, 0x29, 0x55, 0xfe, 0x13, 0xd3, 0x66, 0xc2, 0x21, 0x6e, 0xc0,
+  0x21, 0x26, 0x21, 0xc0, 0x26, 0x6b, 0x6e, 0xc0, 0x2d, 0x21, 0xc9, 0x1c, 0x21, 0xc7, 0x1c, 0x21,
+  0xa4, 0xb7, 0xa4, 0x97, 0xa0, 0x59, 0x9b, 0x6a, 0x79, 0x26, 0x21, 0xc2, 0x26, 0xc0, 0x21, 0xc0,
+  0x1c, 0x21, 0x26, 0x21, 0xc3, 0x26, 0x21, 0x6f, 0x26, 0x21, 0xc0, 0x26, 0x32, 0x3a, 0x26, 0x21,
+  0xc0, 0x26, 0x21, 0xc3, 0x6b, 0x21, 0xc2, 0x26, 0x2d, 0xc0, 0x26, 0x2d, 0x7a, 0x6e, 0xc0, 0x32,
+  0xc0, 0xa1, 0xa9, 0x30, 0x28, 0x26, 0x2d, 0xc0, 0x30, 0xa2, 0x97, 0x35, 0x2d, 0xa2, 0x77, 0x2d,
+  0x32, 0x30, 0x00, 0x7f, 0x04, 0x69, 0x00, 0x6b, 0x55, 0x32, 0x7f, 0x0f, 0xc0, 0x00, 0x04, 0x01,
+  0x04, 0x46, 0xa2, 0xa7, 0xa2, 0xb7, 0x42, 0x07, 0x0c, 0x12, 0x07, 0x04, 0x3d, 0xc0, 0x35, 0x00,
+  0x3d, 0x32, 0x7b, 0x01, 0xc0, 0x2d, 0xc1, 0x28, 0xc0, 0x2d, 0xc5, 0x26, 0x28, 0x26, 0xc0, 0x21,
+  0x28, 0x32, 0xc0, 0x2d, 0xc0, 0x39, 0xa2, 0x78, 0xc4, 0xa2, 0x88, 0xa2, 0x77, 0x9d, 0x9a, 0xc0,
+  0x6e, 0xc0, 0x6f, 0xc1, 0x66, 0x1b, 0x7e, 0x1b, 0x6e, 0xa1, 0xd8, 0x46, 0x27, 0x7a, 0x20, 0x1b,
+  0x22, 0x27, 0xa2, 0x77, 0xa2, 0xc9, 0x9f, 0x59, 0x55, 0x66, 0x27, 0xc0, 0xa2, 0x87, 0x2a, 0x27,
+  0x1b, 0xc2, 0x1e, 0x20, 0x1b, 0x9f, 0xb9, 0xa3, 0xb7, 0xa1, 0xa8, 0x9e, 0x69, 0x5a, 0xa0, 0xa7,
+  0x2c, 0x6f, 0x5a, 0xa1, 0xa8, 0x9f, 0x69, 0x9d, 0x8a, 0xa4, 0xa6, 0xa2, 0xb8, 0x9e, 0x48, 0x27,
+  0x7e, 0xc0, 0x3d, 0x7e, 0x7f, 0x3d, 0x2f, 0xc0, 0x7e, 0x77, 0x27, 0xc0, 0x6e, 0x27, 0xc2, 0x1b,
+  0x16, 0xc2, 0x1b, 0x16, 0xc0, 0x1b, 0x32, 0x76, 0x1e, 0x16, 0x7a, 0x23, 0xc0, 0x7b, 0x56, 0x16,
+  0x1e, 0x1b, 0x16, 0xc0, 0x1b, 0xa2, 0x97, 0x9f, 0xca, 0x35, 0x2a, 0x32, 0x27, 0xc0, 0x3d, 0x32,
+  0x22, 0x27, 0xc0, 0x2c, 0x7f, 0xa2, 0xc8, 0x18, 0x5e, 0xa2, 0xb8, 0xa2, 0x97, 0x4b, 0x9c, 0x59,
+  0x46, 0xa2, 0xa7, 0xa5, 0xe7, 0x7e, 0x9e, 0x59, 0xa0, 0xa7, 0xa3, 0xc9, 0x7e, 0x9e, 0x57, 0xa3,
+  0xa9, 0xa2, 0xa7, 0x9b, 0x7a, 0xa3, 0xa8, 0x9e, 0x68, 0x9e, 0x68, 0xa7, 0xc6, 0x43, 0x92, 0x1b,
+  0x7d, 0x7b, 0xa3, 0xb7, 0x6f, 0x56, 0xa7, 0xb6, 0xa1, 0xa9, 0x53, 0x45, 0xc0, 0x69, 0xc0, 0x2c,
+  0x42, 0xfe, 0x13, 0xb3, 0xc3, 0x6e, 0x6f, 0x66, 0x6d, 0x21, 0xc2, 0x26, 0x6f, 0xc0, 0x2d, 0x21,
+  0xc7, 0x1c, 0xc0, 0x69, 0x1c, 0xc0, 0x21, 0xc5, 0x1c, 0x7e, 0xa6, 0xb6, 0xa4, 0x78, 0x9a, 0x4a,
+  0x32, 0x69, 0x21, 0xc9, 0x26, 0x21, 0xc6, 0x26, 0x21, 0x26, 0x21, 0x26, 0x7e, 0x26, 0x21, 0xc5,
+  0x28, 0x2d, 0x21, 0xc4, 0x2d, 0x32, 0x21, 0xc0, 0x7f, 0x32, 0x7a, 0xa0, 0xa9, 0x58, 0x56, 0x26,
+  0xc0, 0x2d, 0xc0, 0x29, 0xa2, 0x88, 0x66, 0x2b, 0x35, 0x6f, 0x32, 0x2d, 0x35, 0x3d, 0x38, 0xc0,
+  0x3d, 0x38, 0x7f, 0x5a, 0x38, 0xa2, 0x87, 0x77, 0x7a, 0x6e, 0x7e, 0xa0, 0x58, 0x9d, 0x7a, 0x01,
+  0xa1, 0xa8, 0xa1, 0xa8, 0x5b, 0x65, 0xc0, 0x04, 0x32, 0x01, 0xa0, 0xa7, 0x04, 0x07, 0x38, 0x4f,
+  0x76, 0x01, 0x32, 0x30, 0x2d, 0xc3, 0x26, 0x2d, 0xc3, 0x26, 0x21, 0x26, 0xc0, 0x21, 0x2d, 0x26,
+  0x32, 0xc1, 0x39, 0xa2, 0x78, 0xc2, 0x6e, 0x6f, 0xc1, 0x66, 0x1b, 0x6e, 0x6b, 0x66, 0x27, 0x1b,
+  0xc1, 0x7e, 0x16, 0xc0, 0xa2, 0xa7, 0x6f, 0x22, 0xa2, 0x77, 0x6e, 0x77, 0x65, 0x2c, 0xa2, 0x88,
+  0xa2, 0xc8, 0x00, 0x52, 0x27, 0xc0, 0x7e, 0xa1, 0xa8, 0x2a, 0x1b, 0xc0, 0x7a, 0x1b, 0x7b, 0x16,
+  0xc0, 0x66, 0x0f, 0xa3, 0xc8, 0xc0, 0x9e, 0x69, 0x7a, 0x34, 0xa0, 0x48, 0x2a, 0x2f, 0xc1, 0x2a,
+  0xa4, 0xc7, 0x56, 0x2f, 0x7e, 0x5a, 0xa1, 0xc9, 0xa1, 0xb8, 0x9f, 0x68, 0x56, 0xa1, 0xa8, 0x56,
+  0x2f, 0x33, 0xc2, 0x2c, 0x33, 0x2c, 0x27, 0x22, 0x16, 0xc2, 0x1b, 0xc1, 0x16, 0x1b, 0xc0, 0x1e,
+  0x7b, 0x1b, 0xc2, 0x25, 0x16, 0xc0, 0x29, 0xc0, 0x1b, 0x35, 0x3a, 0x1b, 0xa2, 0xc9, 0x00, 0x05,
+  0x67, 0x9f, 0x68, 0xa0, 0xa8, 0xa5, 0xd7, 0x0f, 0x27, 0x22, 0x33, 0xc0, 0xa1, 0xa8, 0xa1, 0xa8,
+  0xa2, 0xa8, 0xa3, 0x98, 0x56, 0x4a, 0xc0, 0x7f, 0xa3, 0xb7, 0xa1, 0xa8, 0x42, 0x7e, 0x65, 0x1e,
+  0xa1, 0xb8, 0xa4, 0x96, 0xa2, 0xb8, 0x4a, 0x9c, 0x69, 0x7e, 0x9e, 0x69, 0x99, 0x6a, 0xa7, 0xc6,
+  0xa1, 0x8a, 0x94, 0x1b, 0x65, 0xa7, 0xe6, 0xa1, 0xa9, 0x2c, 0x46, 0x16, 0x21, 0xa2, 0x98, 0x55,
+  0x38, 0x21, 0x29, 0x6d, 0x2a, 0x9d, 0x8a, 0xfe, 0x13, 0xd3, 0x66, 0xc1, 0x21, 0x6e, 0x21, 0xc0,
+  0x26, 0x67, 0x21, 0x26, 0x21, 0xc0, 0x26, 0x6b, 0x26, 0xc1, 0x21, 0xc3, 0x1c, 0x21, 0xc1, 0x1c,
+  0x69, 0x21, 0xc1, 0x26, 0x1c, 0x21, 0xc2, 0xa2, 0xb7, 0xa6, 0x97, 0x9f, 0x5a, 0x9b, 0x79, 0x7e,
+  0x65, 0x21, 0x7a, 0x21, 0x1c, 0x26, 0xc0, 0x21, 0xc2, 0x26, 0x1c, 0x21, 0xc6, 0x26, 0x2d, 0xc0,
+  0x21, 0x2d, 0x26, 0x21, 0xc2, 0x26, 0xc1, 0x21, 0x26, 0xc1, 0x21, 0x26, 0x21, 0xc0, 0x1c, 0x21,
+  0xc2, 0x26, 0xa2, 0x98, 0x76, 0x5a, 0x5a, 0x2d, 0xc0, 0x26, 0x21, 0xc0, 0x28, 0x7e, 0x3d, 0x32,
+  0xc0, 0xa1, 0xa9, 0x2d, 0x32, 0x35, 0xc1, 0xa1, 0xa8, 0x7b, 0x38, 0x04, 0x7a, 0x04, 0x38, 0xc0,
+  0x04, 0x00, 0x6f, 0x04, 0x5a, 0xc0, 0x3a, 0x07, 0x0c, 0xc0, 0x7a, 0x01, 0x66, 0x07, 0x38, 0x3d,
+  0xc0, 0x3a, 0x32, 0x6b, 0x76, 0x32, 0x2d, 0xc4, 0x21, 0x28, 0x2d, 0xc3, 0x21, 0x26, 0xc1, 0x32,
+  0x2d, 0xc1, 0x39, 0x6e, 0x6f, 0x6e, 0x0a, 0xc0, 0x6f, 0x6e, 0xc0, 0x6b, 0xc0, 0x6e, 0x22, 0xc0,
+  0x27, 0x69, 0x1b, 0xc2, 0x7e, 0x20, 0xc0, 0x7b, 0xc0, 0x5e, 0x6b, 0x7a, 0x5e, 0xc0, 0xa2, 0xa8,
+  0x7a, 0x41, 0x33, 0xc0, 0x36, 0x69, 0x22, 0xc0, 0x1b, 0x20, 0x77, 0x69, 0x69, 0x16, 0x66, 0x0a,
+  0xa2, 0x98, 0xa3, 0x98, 0x41, 0x1b, 0x22, 0xa2, 0x97, 0xc0, 0x2f, 0x2c, 0xc0, 0x2f, 0xa3, 0xb8,
+  0x66, 0x45, 0x6b, 0x6d, 0x01, 0xa2, 0xc7, 0xc0, 0x2f, 0x32, 0x3a, 0x36, 0x33, 0x38, 0x6b, 0x38,
+  0xc1, 0x62, 0x27, 0xc0, 0x2f, 0x22, 0x66, 0x22, 0x1b, 0x22, 0xc2, 0x1b, 0x16, 0x1b, 0x16, 0xc5,
+  0x1e, 0xa1, 0xa9, 0x1e, 0x16, 0xa3, 0xa8, 0xa2, 0x97, 0x1d, 0x35, 0xa3, 0xb7, 0x9e, 0x6a, 0x32,
+  0x3d, 0x7b, 0xa2, 0x98, 0x04, 0x3a, 0x33, 0xc0, 0x38, 0x2e, 0x33, 0xa4, 0xc7, 0xa2, 0xa8, 0xa2,
+  0x67, 0xa1, 0xb9, 0xa2, 0x97, 0x59, 0x9d, 0x9b, 0x6d, 0xa1, 0xa9, 0xa2, 0x87, 0xa1, 0xa9, 0xa3,
+  0xb7, 0xa2, 0x87, 0x1b, 0x9b, 0x69, 0x9e, 0x68, 0x42, 0x52, 0x9d, 0x7a, 0x0f, 0x1b, 0x11, 0x69,
+  0xa4, 0xb7, 0x9d, 0x79, 0xa3, 0x88, 0x9b, 0x7b, 0xa3, 0x97, 0x00, 0xa2, 0x97, 0x9d, 0x6a, 0x21,
+  0xa4, 0x96, 0x9d, 0x8a, 0x41, 0x3b, 0x56, 0x61, 0xfe, 0x13, 0xb3, 0x6e, 0xc5, 0x6e, 0x6b, 0x21,
+  0xc3, 0x6b, 0x26, 0x6f, 0x26, 0x21, 0xc4, 0x1c, 0x21, 0x1c, 0x69, 0xc0, 0x1c, 0xc1, 0x21, 0xc4,
+  0xa4, 0xc7, 0xa5, 0x88, 0x9a, 0x4a, 0x26, 0x7a, 0x21, 0xc0, 0x28, 0x26, 0x21, 0xc2, 0x1c, 0x21,
+  0xc0, 0x26, 0x21, 0xc6, 0x28, 0xc0, 0x26, 0xc0, 0x21, 0x26, 0x2d, 0xc0, 0x26, 0x21, 0x26, 0xc0,
+  0x21, 0x26, 0xc0, 0x21, 0xc0, 0x26, 0xc0, 0x21, 0xc2, 0x15, 0x1c, 0x21, 0x26, 0x76, 0xa3, 0x88,
+  0xc0, 0x2d, 0x32, 0x76, 0x21, 0xc1, 0x28, 0xc0, 0x26, 0x7f, 0x7a, 0x32, 0x30, 0x35, 0xc0, 0x32,
+  0x35, 0x3d, 0xa1, 0xa9, 0x51, 0x35, 0x3d, 0xc0, 0x7f, 0x38, 0x32, 0xa1, 0xb8, 0x6b, 0x32, 0x6f,
+  0x66, 0x7a, 0x32, 0xa2, 0x98, 0xc0, 0x01, 0x0f, 0x09, 0x39, 0x07, 0x35, 0xc0, 0x7f, 0xc0, 0x2d,
+  0xc8, 0x28, 0x21, 0x2d, 0xc3, 0x26, 0xc0, 0x21, 0x28, 0x2d, 0x39, 0x2d, 0xc0, 0x39, 0x6f, 0x6e,
+  0x6e, 0x0a, 0x0f, 0xc0, 0x6f, 0xc0, 0x6f, 0xc1, 0x1b, 0x6b, 0x1b, 0xc4, 0x7f, 0x6e, 0x27, 0xc0,
+  0xa2, 0x88, 0x55, 0x6b, 0xc0, 0x6e, 0xc2, 0x33, 0xc1, 0x2c, 0x27, 0xc0, 0x1b, 0x7b, 0x5d, 0x1b,
+  0xa0, 0xa8, 0xa1, 0xa8, 0xa0, 0x58, 0x52, 0x1b, 0xa1, 0xa9, 0x23, 0x27, 0x2f, 0x6e, 0xa1, 0xa8,
+  0x7b, 0x2f, 0x5a, 0x2f, 0xa3, 0xb8, 0x46, 0x55, 0xa1, 0xa8, 0x57, 0x69, 0x02, 0x6f, 0x37, 0x2c,
+  0xa1, 0xa9, 0xc0, 0x33, 0xa2, 0x98, 0x5a, 0x33, 0xc0, 0x38, 0xc0, 0x62, 0x27, 0x7f, 0x2f, 0x22,
+  0xc0, 0x27, 0xc1, 0x1b, 0xc3, 0x2a, 0x61, 0x56, 0x16, 0xc1, 0x11, 0xa2, 0x87, 0xa2, 0x87, 0x25,
+  0x1b, 0x2d, 0xa2, 0xa7, 0x9f, 0x69, 0x22, 0xa2, 0xb7, 0xa4, 0xc7, 0x22, 0xa2, 0x98, 0xa1, 0xb8,
+  0x5a, 0x2e, 0x27, 0x01, 0x09, 0x3e, 0x6e, 0x3e, 0x76, 0xa6, 0x87, 0xa2, 0xa7, 0xa1, 0xb9, 0x45,
+  0xa3, 0xb8, 0xa2, 0x97, 0xc0, 0x6f, 0xa2, 0xa7, 0xa3, 0xb8, 0x56, 0x9a, 0x59, 0x9c, 0x59, 0x9c,
+  0x79, 0x9d, 0x68, 0x7f, 0xa5, 0xa7, 0x7b, 0xa3, 0xa7, 0xa3, 0xa9, 0x55, 0x42, 0xc0, 0x5a, 0x6d,
+  0x7b, 0x6b, 0xa0, 0xa8, 0xa2, 0x76, 0x7e, 0x1a, 0x52, 0x42, 0x9d, 0x88, 0xa6, 0xa6, 0x3d, 0x3c,
+  0xa1, 0xb7, 0xfe, 0x1b, 0xb3, 0x5e, 0x6f, 0x21, 0xc3, 0x6e, 0xc0, 0x21, 0x26, 0xc2, 0x2d, 0x26,
+  0xc0, 0x2d, 0x21, 0xc3, 0x66, 0xc9, 0x69, 0x1c, 0x21, 0xa2, 0x97, 0xa6, 0xb7, 0xa1, 0x7a, 0x99,
+  0x5a, 0x26, 0x1c, 0x21, 0xc1, 0x1c, 0x21, 0xcf, 0x26, 0x21, 0xc2, 0x2d, 0x7a, 0x26, 0xc1, 0x21,
+  0xc0, 0x2d, 0x7e, 0x21, 0x1c, 0x26, 0xc0, 0x21, 0xc0, 0x26, 0x21, 0x7a, 0xc0, 0x1c, 0x26, 0xc0,
+  0x2d, 0xc2, 0x21, 0x26, 0xc2, 0x21, 0x26, 0x35, 0x7a, 0x35, 0xc0, 0x6b, 0x59, 0xc0, 0x7e, 0x7b,
+  0x79, 0x6b, 0x59, 0x04, 0x3a, 0x07, 0xc0, 0x35, 0x04, 0x00, 0x07, 0x04, 0x32, 0x3c, 0xc0, 0x3d,
+  0x07, 0x04, 0x6e, 0x04, 0x3a, 0xc0, 0x3d, 0x04, 0x3d, 0x3c, 0x2d, 0x32, 0x2d, 0xc5, 0x32, 0x2d,
+  0xc6, 0x26, 0xc0, 0x2d, 0x32, 0x39, 0x2d, 0x39, 0x6e, 0x6f, 0xc0, 0x6e, 0xc0, 0x0a, 0x0f, 0x6f,
+  0xc0, 0x6f, 0xc0, 0x1b, 0xc0, 0x6b, 0x65, 0xc0, 0x1b, 0x27, 0xc2, 0xa2, 0x88, 0x5a, 0x66, 0x38,
+  0xc4, 0x33, 0xc2, 0x27, 0x22, 0xc0, 0x1b, 0xc0, 0x7f, 0x65, 0x16, 0x1e, 0xa2, 0xa7, 0x46, 0x16,
+  0x7f, 0x27, 0x69, 0x7f, 0xa2, 0xa8, 0x7e, 0x5a, 0x42, 0x38, 0x33, 0x3e, 0x7e, 0x38, 0x76, 0xa2,
+  0x87, 0x55, 0xa0, 0xa9, 0x7a, 0x49, 0x09, 0x06, 0x7f, 0x7e, 0xa0, 0xa7, 0x6b, 0x3b, 0x33, 0x66,
+  0x33, 0x38, 0x27, 0xc0, 0x6e, 0x27, 0xc2, 0x22, 0xc0, 0x1b, 0xc0, 0x22, 0x1b, 0xc1, 0x16, 0xc0,
+  0x1b, 0xc0, 0x16, 0xc0, 0xa1, 0xa8, 0x31, 0x1b, 0x16, 0xa3, 0x98, 0xa2, 0xa7, 0x25, 0x1b, 0x2a,
+  0xa1, 0xa8, 0x27, 0x36, 0xa1, 0xa9, 0x3e, 0x2e, 0x27, 0x33, 0xa4, 0xc6, 0x06, 0x3b, 0x0e, 0xa8,
+  0xe6, 0x9d, 0x5b, 0x9f, 0x68, 0xa5, 0xe7, 0x76, 0xa3, 0xa7, 0xa3, 0xa8, 0xa2, 0x97, 0xc0, 0x9b,
+  0x6b, 0x9c, 0x58, 0x9c, 0x49, 0x9b, 0x8b, 0xa2, 0x97, 0xa2, 0x97, 0xa3, 0xb9, 0xa2, 0x87, 0xa3,
+  0x97, 0x57, 0xa2, 0x96, 0x7b, 0x41, 0x43, 0x6e, 0x21, 0x5e, 0x36, 0x23, 0x9c, 0x89, 0xa1, 0xa7,
+  0xa2, 0x97, 0x9e, 0x69, 0x9d, 0x8a, 0x5d, 0xa7, 0xc7, 0xa1, 0xba, 0x96, 0x3b, 0x68, 0xa3, 0x98,
+  0xfe, 0x13, 0x92, 0x6b, 0xa2, 0x77, 0xc3, 0x6e, 0x21, 0x26, 0xc1, 0x21, 0x6f, 0xc0, 0x26, 0xc0,
+  0x21, 0xc0, 0x26, 0x21, 0xc2, 0x66, 0x21, 0x1c, 0xc1, 0x69, 0xc2, 0x1c, 0xc1, 0x10, 0xa2, 0x88,
+  0xa6, 0xa6, 0xa5, 0x89, 0x9d, 0x69, 0x9b, 0x79, 0x21, 0x69, 0x21, 0xc1, 0x24, 0x21, 0xd1, 0x6b,
+  0xc0, 0x21, 0xc0, 0x26, 0x21, 0xc3, 0x26, 0xc0, 0x2d, 0x21, 0xc3, 0x26, 0x21, 0x24, 0x6f, 0x15,
+  0x21, 0x26, 0xc1, 0x28, 0xc0, 0x21, 0x26, 0xc4, 0x2d, 0xc0, 0x7e, 0xc1, 0x5a, 0xc0, 0xa1, 0xa8,
+  0x7b, 0x49, 0x07, 0x7e, 0x35, 0x32, 0x3d, 0x7a, 0x3d, 0x5b, 0x7a, 0x3d, 0x04, 0x75, 0x32, 0x3d,
+  0x7e, 0x00, 0x07, 0x46, 0x01, 0x04, 0x3a, 0x01, 0x3c, 0x35, 0xc0, 0x2d, 0xc7, 0x26, 0x21, 0x2d,
+  0xc3, 0x28, 0x2d, 0xc2, 0x6f, 0xc2, 0x6e, 0x6f, 0xc0, 0x6e, 0x0a, 0xc0, 0x0f, 0xc0, 0x6f, 0xc2,
+  0x7a, 0x1b, 0x66, 0xc0, 0xa2, 0x78, 0xc3, 0x6f, 0xc0, 0x6f, 0x69, 0x6e, 0x38, 0x33, 0x38, 0xc2,
+  0x33, 0xc0, 0x27, 0x66, 0x27, 0x1b, 0xc2, 0x22, 0x6d, 0x7a, 0x20, 0x7b, 0x5e, 0xc1, 0x7e, 0xa2,
+  0xb8, 0xc0, 0xa0, 0x59, 0x51, 0xc0, 0x6e, 0x38, 0x75, 0x3b, 0x7a, 0x6e, 0x75, 0xc0, 0x6b, 0x6e,
+  0x11, 0xc0, 0x56, 0x66, 0x6d, 0x5a, 0x33, 0x38, 0x33, 0xc0, 0x2c, 0x33, 0x2c, 0x27, 0xc2, 0x1b,
+  0xc8, 0x16, 0x1b, 0xc0, 0x27, 0x1b, 0x22, 0xa1, 0xa8, 0x1e, 0x1b, 0x22, 0x20, 0x27, 0xc0, 0x2f,
+  0x27, 0x6b, 0x33, 0x3b, 0x33, 0x7b, 0x3b, 0xa1, 0xa9, 0xa3, 0xc8, 0x0d, 0x38, 0xa3, 0xb8, 0xa4,
+  0xb7, 0x45, 0xa4, 0xd9, 0xa6, 0xb5, 0xa3, 0xa7, 0x77, 0x49, 0x9a, 0x5a, 0x42, 0x9b, 0x5a, 0x9d,
+  0x89, 0xa4, 0x87, 0xa4, 0xc8, 0xa5, 0xb6, 0x7f, 0x9d, 0x89, 0x39, 0x9d, 0x6a, 0x45, 0xa2, 0xa8,
+  0x29, 0x1e, 0xa2, 0x97, 0x1e, 0x9d, 0x68, 0xa6, 0xe7, 0x9c, 0x6a, 0x9a, 0x4a, 0xa3, 0xa5, 0x7b,
+  0xc0, 0x66, 0x55, 0xa3, 0x88, 0xa3, 0xa7, 0x53, 0x9d, 0x69, 0xa4, 0x96, 0xa1, 0xba, 0xfe, 0x13,
+  0x92, 0xc0, 0x6f, 0x6e, 0xc0, 0x6b, 0x6d, 0x21, 0xc1, 0x26, 0xc1, 0x21, 0xc2, 0x6f, 0x7a, 0x21,
+  0xc2, 0x1c, 0xc3, 0x69, 0x1c, 0x21, 0x1c, 0xc1, 0x21, 0xc0, 0x69, 0xa0, 0xb8, 0xa7, 0xa8, 0xa1,
+  0x6a, 0x9b, 0x58, 0x26, 0x21, 0xc2, 0x26, 0x21, 0xde, 0x2d, 0x21, 0xc2, 0x26, 0x28, 0x21, 0x1c,
+  0x21, 0xc3, 0x26, 0x2d, 0x28, 0x2d, 0x26, 0x2d, 0xc0, 0x26, 0xc0, 0x2d, 0xc0, 0x21, 0xa2, 0x88,
+  0xc0, 0xa2, 0x98, 0xc0, 0x9e, 0x68, 0xa1, 0xa8, 0x66, 0x30, 0x38, 0x3d, 0x5a, 0x6b, 0x32, 0xa1,
+  0xb9, 0x7a, 0x3d, 0x07, 0x3d, 0x7a, 0x07, 0x32, 0x3d, 0x0c, 0x00, 0xc0, 0x38, 0x5b, 0xc0, 0x7e,
+  0x3c, 0x5e, 0x62, 0x2d, 0xc8, 0x26, 0xc0, 0x2d, 0xc1, 0x21, 0x2d, 0xc4, 0x6f, 0x3e, 0xc2, 0x6f,
+  0xc0, 0x6e, 0x0a, 0x0f, 0xc1, 0x7f, 0x5a, 0x66, 0x1b, 0xa2, 0x98, 0x1b, 0x16, 0x1b, 0x6f, 0x6e,
+  0x27, 0xc1, 0x6f, 0x6e, 0x6b, 0x6e, 0x38, 0x7f, 0x66, 0x33, 0xc1, 0x38, 0x2c, 0x62, 0x1b, 0xc4,
+  0x7f, 0xc0, 0x1b, 0x27, 0xc0, 0x33, 0x7a, 0xc0, 0x38, 0x7a, 0x6e, 0xa0, 0xb8, 0x69, 0x09, 0x7a,
+  0x4a, 0x3b, 0x7e, 0x9f, 0xb8, 0x5e, 0x06, 0x09, 0x56, 0xc0, 0x02, 0x46, 0x3d, 0x01, 0x56, 0x36,
+  0x22, 0x1b, 0x38, 0xc0, 0x33, 0x27, 0x2c, 0x27, 0xc1, 0x1b, 0xc6, 0x22, 0x1b, 0xc0, 0x22, 0x7a,
+  0xc0, 0x5d, 0x16, 0x1b, 0x22, 0x7d, 0xa0, 0xa8, 0x6e, 0x9f, 0x7b, 0x2a, 0x32, 0x5a, 0x36, 0x38,
+  0xc0, 0x69, 0xa0, 0xa9, 0x7b, 0xa2, 0x77, 0x56, 0x6d, 0xa5, 0xd8, 0x56, 0x04, 0x9d, 0x5a, 0x66,
+  0xa8, 0xe5, 0xa7, 0xd7, 0x65, 0x9e, 0x68, 0x9c, 0x4a, 0x9d, 0x89, 0x66, 0x9e, 0x69, 0xa3, 0x97,
+  0xa4, 0xc8, 0xa3, 0x97, 0xa2, 0x97, 0x15, 0x9b, 0x7a, 0x41, 0x0a, 0x37, 0x0a, 0xa3, 0xa7, 0xa3,
+  0x99, 0x9c, 0x6a, 0xa2, 0xa6, 0x37, 0xa1, 0xa8, 0xa6, 0xc6, 0x0a, 0x41, 0xa5, 0xc7, 0x4a, 0x33,
+  0x7a, 0x6b, 0x12, 0x7a, 0x9f, 0x69, 0xa1, 0xb9, 0xa4, 0x86, 0xa4, 0x97, 0xfe, 0x13, 0xb3, 0x66,
+  0x6d, 0x1c, 0x6e, 0x6f, 0x69, 0xc1, 0x21, 0xc0, 0x26, 0xc0, 0x21, 0xc3, 0x26, 0xc0, 0x21, 0xc0,
+  0x1c, 0x21, 0x1c, 0xc4, 0x21, 0xc4, 0x7e, 0xa4, 0xc7, 0x4f, 0x9d, 0x6a, 0x21, 0x66, 0x21, 0xc0,
+  0x1c, 0x21, 0xc6, 0x26, 0x21, 0xca, 0x26, 0x21, 0xc5, 0x26, 0x21, 0xce, 0x7f, 0x21, 0xc0, 0xa2,
+  0x78, 0x26, 0xc1, 0x30, 0xc0, 0x26, 0xc1, 0x2d, 0xc0, 0x26, 0x2d, 0xa2, 0x97, 0x6b, 0x65, 0x3d,
+  0x45, 0x30, 0x3d, 0xc0, 0x32, 0x6b, 0x32, 0xa1, 0xb9, 0xa2, 0x97, 0x38, 0xc0, 0x07, 0x69, 0x07,
+  0x38, 0xa1, 0xa8, 0x38, 0x5b, 0x04, 0xc0, 0x32, 0x67, 0x39, 0x2d, 0xc1, 0x66, 0xc0, 0x2d, 0xc1,
+  0x21, 0x2d, 0xc3, 0x30, 0x32, 0xc0, 0x2d, 0x28, 0x2d, 0xc2, 0x32, 0x39, 0xc1, 0x6e, 0xc1, 0x6f,
+  0xc0, 0x6e, 0x0a, 0xc0, 0x0f, 0xc0, 0x6f, 0xc0, 0x66, 0xc0, 0x1b, 0xc2, 0xa2, 0x88, 0xc1, 0x6f,
+  0x56, 0xc0, 0x6e, 0xc0, 0x6f, 0x38, 0xc3, 0x65, 0x66, 0x66, 0x1b, 0xc1, 0x16, 0x22, 0x1b, 0xc1,
+  0x2f, 0x38, 0x69, 0x33, 0x38, 0xa1, 0xb8, 0x7a, 0x33, 0xc0, 0x27, 0x2f, 0xa1, 0xb8, 0x09, 0x69,
+  0x56, 0x3b, 0x3a, 0x09, 0x3a, 0x09, 0x06, 0x42, 0x3a, 0x09, 0x56, 0xc0, 0x2c, 0x76, 0x7a, 0x1b,
+  0x2a, 0x33, 0x2c, 0xc0, 0x27, 0xc0, 0x22, 0x1b, 0x16, 0xc0, 0x1b, 0xc6, 0x22, 0xc0, 0x27, 0x22,
+  0xc0, 0x1b, 0x16, 0xa1, 0xa8, 0x7e, 0x5a, 0xa2, 0xb8, 0xa2, 0x97, 0x9d, 0x5a, 0x27, 0x2d, 0x6e,
+  0x01, 0x33, 0x31, 0x33, 0xa1, 0xa8, 0xa1, 0xa9, 0xa2, 0x77, 0x7a, 0x7f, 0xa1, 0xa7, 0xa1, 0xb8,
+  0xa4, 0x98, 0xa2, 0x87, 0xa1, 0xa9, 0xa2, 0xa7, 0x5a, 0x9c, 0x49, 0x9c, 0x7a, 0x9d, 0x79, 0xa2,
+  0x97, 0xa8, 0xd6, 0x9d, 0x69, 0xc0, 0xa5, 0xb7, 0x99, 0x6b, 0x9c, 0x67, 0x6f, 0x52, 0x46, 0xa4,
+  0xa6, 0x29, 0x21, 0xa3, 0x87, 0x21, 0x9b, 0x59, 0xa6, 0xc6, 0x7a, 0x6e, 0x9a, 0x5a, 0xa5, 0xc8,
+  0x9e, 0x68, 0x9d, 0x89, 0xa2, 0x88, 0x12, 0xa3, 0xa8, 0x9d, 0x69, 0x29, 0x31, 0x46, 0xa1, 0xa9,
+  0xa3, 0x97, 0xa3, 0xa7, 0xfe, 0x13, 0xd3, 0x66, 0xc1, 0x21, 0x6f, 0xc0, 0x69, 0x21, 0x6b, 0x21,
+  0x1c, 0x21, 0xc5, 0x26, 0x21, 0xc2, 0x1c, 0x69, 0x1c, 0xc1, 0x21, 0xc5, 0xa2, 0xa7, 0xa6, 0x97,
+  0x9d, 0x6a, 0x21, 0x61, 0x15, 0x21, 0x15, 0x1c, 0x21, 0xc0, 0x1c, 0x21, 0xc5, 0x1c, 0xc2, 0x21,
+  0xc4, 0x26, 0xc0, 0x21, 0xc1, 0x1c, 0xc0, 0x21, 0xc3, 0x26, 0x21, 0xc7, 0x26, 0x1c, 0xc0, 0xa2,
+  0x88, 0x6e, 0x2d, 0x21, 0x26, 0x28, 0x26, 0xc0, 0x21, 0x2d, 0xc0, 0x21, 0xc1, 0x26, 0x2d, 0x6e,
+  0x2d, 0x26, 0xa1, 0xa9, 0xc0, 0x5e, 0x9f, 0xb9, 0x38, 0x35, 0x2d, 0x32, 0xc0, 0x38, 0x7f, 0x4a,
+  0x35, 0xa2, 0xa8, 0x38, 0x35, 0xa2, 0x88, 0x07, 0x35, 0x3a, 0x7e, 0x38, 0x2d, 0xc2, 0x67, 0x2d,
+  0xc2, 0x32, 0x2d, 0x28, 0xc0, 0x2d, 0xc1, 0x28, 0xc0, 0x32, 0x6f, 0x2d, 0xc0, 0x6f, 0xc1, 0x32,
+  0x3e, 0xc0, 0x39, 0xc0, 0x3e, 0xc0, 0x6b, 0x6e, 0xc0, 0x6e, 0xc3, 0x6f, 0x7e, 0x1b, 0xc1, 0x6f,
+  0xc1, 0xa2, 0x88, 0xc1, 0x5a, 0x6b, 0x38, 0x66, 0x38, 0x6e, 0x38, 0x33, 0x38, 0xc0, 0x27, 0xc0,
+  0x66, 0x65, 0xc0, 0x1b, 0x16, 0xc0, 0x1b, 0x6e, 0x22, 0x27, 0x6e, 0x38, 0xc0, 0x33, 0xc0, 0xa3,
+  0xb7, 0x6f, 0x38, 0x33, 0x27, 0x2c, 0xa0, 0xa9, 0xc0, 0x59, 0x2c, 0x3b, 0xa1, 0xb8, 0x5a, 0x76,
+  0x7e, 0x46, 0x69, 0xa3, 0xb8, 0x41, 0x3a, 0x56, 0x56, 0x1b, 0x27, 0x20, 0x2a, 0x27, 0x1b, 0xc0,
+  0x22, 0x16, 0xc1, 0x23, 0x2a, 0x22, 0x16, 0xc0, 0xa2, 0x97, 0x56, 0x16, 0xc0, 0x1b, 0xc1, 0x16,
+  0x1b, 0x16, 0x1e, 0x67, 0xa4, 0xa6, 0x5e, 0x26, 0xa4, 0xd8, 0x55, 0x9e, 0x49, 0x6b, 0x55, 0x35,
+  0x3a, 0x27, 0x33, 0x01, 0x0c, 0xa2, 0x78, 0xa1, 0xa9, 0xa1, 0xa7, 0x7a, 0xa2, 0x97, 0xa5, 0xa8,
+  0xa2, 0x98, 0xa3, 0xa7, 0x10, 0x39, 0x9b, 0x4a, 0x67, 0xa6, 0xd6, 0x4a, 0x9d, 0x79, 0x79, 0x9d,
+  0x79, 0x9e, 0x68, 0x7f, 0x9c, 0x89, 0xa2, 0x88, 0xa3, 0xb8, 0x6f, 0xa3, 0x97, 0x66, 0x9e, 0x69,
+  0x49, 0x9d, 0x8a, 0x61, 0x33, 0xa7, 0xc6, 0x11, 0x9c, 0x78, 0x6e, 0xa6, 0xc6, 0x9d, 0x6a, 0x45,
+  0xa7, 0xc7, 0x9d, 0x8b, 0x9c, 0x68, 0x3b, 0x1e, 0xc0, 0x1a, 0xa4, 0x98, 0xa2, 0xb8, 0x55, 0xfe,
+  0x13, 0xb3, 0x6e, 0x1c, 0xc0, 0x21, 0x6f, 0xc2, 0x66, 0xc0, 0x21, 0xc1, 0x1c, 0xc1, 0x21, 0xc4,
+  0x1c, 0x65, 0x6e, 0xc0, 0x1c, 0xc0, 0x15, 0x21, 0x15, 0x1c, 0xc0, 0x21, 0x7e, 0xa4, 0xb7, 0x6f,
+  0x9e, 0x58, 0x1c, 0x15, 0x21, 0x15, 0xc3, 0x1c, 0x21, 0xc1, 0x6e, 0xc0, 0x21, 0x1c, 0xc0, 0x66,
+  0x15, 0xc0, 0x21, 0xc2, 0x1c, 0x26, 0xc0, 0x21, 0xc0, 0x1c, 0x15, 0x1c, 0xc2, 0x21, 0xc0, 0x29,
+  0xc0, 0x21, 0xc2, 0x2d, 0x21, 0xc2, 0x26, 0x21, 0x1c, 0x21, 0x2d, 0x21, 0xc1, 0x26, 0xc1, 0x21,
+  0xc5, 0x28, 0x26, 0x1c, 0x26, 0x2d, 0x7a, 0x6e, 0x7e, 0x46, 0x35, 0x6e, 0x2d, 0xc0, 0x30, 0x35,
+  0x3a, 0x32, 0x3d, 0x7b, 0x3d, 0x6b, 0x3d, 0xa1, 0xa9, 0x07, 0x65, 0x35, 0x2d, 0xc4, 0x32, 0x2d,
+  0xc0, 0x32, 0x2d, 0xc4, 0x28, 0x21, 0x32, 0x6f, 0x32, 0x6b, 0x3e, 0xc2, 0x6b, 0xc0, 0x3e, 0x05,
+  0xc0, 0x3e, 0x05, 0x6e, 0xc0, 0x6e, 0xc2, 0x6b, 0x7e, 0xc0, 0x5a, 0x16, 0x1b, 0xa2, 0x88, 0x5a,
+  0xc0, 0x6b, 0x6e, 0xc1, 0x6f, 0x66, 0x38, 0xc2, 0x33, 0xc0, 0x2c, 0x62, 0x1b, 0x16, 0x1b, 0xc4,
+  0x6f, 0x2c, 0x38, 0x33, 0x3f, 0x38, 0xc0, 0x7e, 0xa2, 0xa8, 0x51, 0x46, 0x2c, 0x33, 0x2c, 0xc1,
+  0x7b, 0x06, 0xc0, 0x56, 0x3b, 0x06, 0x7a, 0x2f, 0xa1, 0xc8, 0xa3, 0xa8, 0x00, 0x61, 0xa0, 0x49,
+  0x22, 0x1b, 0xc0, 0x1e, 0x66, 0x16, 0x1b, 0x16, 0xc1, 0x1b, 0xc0, 0xa3, 0x88, 0x66, 0x22, 0x16,
+  0xc0, 0xa2, 0x98, 0x1e, 0x16, 0x1b, 0x16, 0xc4, 0x1e, 0x7a, 0xa2, 0x88, 0x2a, 0xa2, 0xd7, 0xa5,
+  0xb7, 0x9a, 0x1a, 0xa1, 0xa9, 0xc0, 0x55, 0xa2, 0xb8, 0x5a, 0x27, 0x33, 0xa3, 0xc7, 0xa3, 0xc7,
+  0x5b, 0x56, 0x55, 0xa2, 0xa8, 0xa6, 0x96, 0xa4, 0xc8, 0x6f, 0x9d, 0x79, 0x9c, 0x59, 0x41, 0xa7,
+  0xe6, 0x9a, 0x5b, 0x9d, 0x67, 0x36, 0x45, 0x57, 0xc0, 0xa5, 0xb7, 0x1e, 0xc0, 0xa5, 0xb7, 0xa4,
+  0xa7, 0x27, 0x99, 0x6a, 0x42, 0x9d, 0x48, 0x7d, 0x53, 0xa2, 0x97, 0x2b, 0xa4, 0xa6, 0x67, 0x2b,
+  0x66, 0x36, 0x7e, 0xa7, 0xa7, 0x42, 0x9a, 0x5a, 0xa3, 0x98, 0xa1, 0xb9, 0xa2, 0xa7, 0x08, 0xa4,
+  0xa7, 0xa4, 0xb6, 0x9d, 0x7b, 0x9b, 0x6a, 0xfe, 0x13, 0xb3, 0xc2, 0x6e, 0x6e, 0xc1, 0x6b, 0xc0,
+  0x1c, 0xc0, 0x21, 0x1c, 0xc2, 0x21, 0x1c, 0x69, 0xc0, 0x1c, 0xc0, 0x15, 0x66, 0xc0, 0x15, 0xc0,
+  0x1c, 0xc0, 0x21, 0x1c, 0x21, 0x1c, 0xc0, 0xa4, 0xa7, 0xa4, 0x97, 0x9d, 0x5a, 0x21, 0x62, 0x21,
+  0x1c, 0xc2, 0x15, 0x1c, 0x21, 0x1c, 0xc0, 0x21, 0xc2, 0x1c, 0x15, 0xc0, 0x1c, 0x10, 0x15, 0x21,
+  0x1c, 0xc0, 0x21, 0xc2, 0x1c, 0x10, 0xc1, 0x15, 0x1c, 0x21, 0x1c, 0xc0, 0x21, 0xc1, 0x6b, 0x21,
+  0xc0, 0x26, 0x21, 0xc0, 0x28, 0x21, 0x28, 0x21, 0x1c, 0x21, 0xc3, 0xa2, 0x78, 0xa1, 0xa9, 0x51,
+  0x26, 0x21, 0xc0, 0x26, 0x21, 0x1c, 0x21, 0xc3, 0x2d, 0x26, 0xc0, 0x2d, 0xc0, 0x30, 0xa2, 0x97,
+  0x46, 0x32, 0x2d, 0x35, 0x32, 0x6f, 0x30, 0xa3, 0xa8, 0xc0, 0x45, 0x66, 0xa2, 0x88, 0x0f, 0x30,
+  0x5f, 0x2d, 0xc1, 0x28, 0x2d, 0xc5, 0x21, 0x2d, 0x28, 0x2d, 0xc0, 0x21, 0x2d, 0xc1, 0x32, 0x39,
+  0x3e, 0x6b, 0x6d, 0xc0, 0x6b, 0xc0, 0x3e, 0x05, 0xc0, 0x66, 0x39, 0x0a, 0xc3, 0x6e, 0xc0, 0xa2,
+  0x88, 0x5a, 0x0f, 0x6b, 0xa2, 0x78, 0x6e, 0xc1, 0x6b, 0x2c, 0x6f, 0xc2, 0x33, 0xc0, 0x38, 0x33,
+  0xc0, 0x27, 0x65, 0xc0, 0x7a, 0xc0, 0x16, 0x1b, 0xc1, 0x6b, 0x27, 0x2c, 0x38, 0xc1, 0x33, 0xc0,
+  0xa2, 0x78, 0x79, 0x66, 0x33, 0x38, 0x2c, 0x33, 0x27, 0x2c, 0x3b, 0xa2, 0x88, 0x61, 0x51, 0xa1,
+  0xa8, 0xa2, 0x98, 0x3e, 0x3b, 0x65, 0xa0, 0xb8, 0x7d, 0x66, 0x23, 0x1b, 0x16, 0x1b, 0xc0, 0x16,
+  0x1b, 0x16, 0x23, 0x1b, 0xc0, 0x1e, 0x23, 0x53, 0x1b, 0xc1, 0x16, 0x22, 0x1b, 0x16, 0x1e, 0x7e,
+  0x16, 0xc0, 0x1b, 0xc0, 0x16, 0x1b, 0x76, 0xa4, 0xa7, 0x0c, 0x1d, 0xa3, 0xa6, 0xa2, 0xa8, 0x27,
+  0xa2, 0x87, 0xa0, 0xa8, 0x7a, 0xa4, 0xb8, 0x56, 0x9e, 0x38, 0x3e, 0x0c, 0xa2, 0xa7, 0x5f, 0xa0,
+  0xa9, 0x7d, 0xa3, 0x88, 0x7a, 0x6e, 0x7f, 0x9d, 0x78, 0x36, 0x6d, 0xa1, 0xb9, 0x9d, 0x5a, 0x36,
+  0xa2, 0x88, 0xa4, 0x97, 0xa3, 0xa8, 0x7a, 0x9e, 0x58, 0x9d, 0x8a, 0x0f, 0xa3, 0x97, 0xa9, 0xd6,
+  0x97, 0x6d, 0x98, 0x49, 0x1f, 0x23, 0xa3, 0xa8, 0x45, 0x7a, 0x66, 0x9e, 0x58, 0x56, 0x28, 0x02,
+  0xa3, 0xa8, 0xa1, 0xa8, 0x1e, 0x5b, 0xa6, 0xc5, 0xa6, 0xb6, 0x63, 0x55, 0x6e, 0x7f, 0x3f, 0x52,
+  0x10, 0xfe, 0x13, 0xb3, 0xc2, 0x6e, 0x6e, 0xc0, 0x6b, 0xc0, 0x66, 0x1c, 0xc0, 0x69, 0x1c, 0xc0,
+  0x21, 0x1c, 0xc4, 0x21, 0x15, 0x66, 0xc2, 0x15, 0x1c, 0x15, 0x1c, 0x7e, 0x1c, 0xa2, 0x97, 0xa5,
+  0xb8, 0x5e, 0x9c, 0x59, 0x9b, 0xaa, 0x65, 0x10, 0xc1, 0x15, 0x1c, 0x21, 0x1c, 0x21, 0x1c, 0xc0,
+  0x21, 0xc1, 0x1c, 0xc0, 0x15, 0x1c, 0xc0, 0x15, 0xc0, 0x1c, 0xc0, 0x21, 0xc2, 0x1c, 0xc0, 0x15,
+  0x10, 0x15, 0xc3, 0x21, 0xc2, 0x1c, 0x21, 0xcb, 0x26, 0x21, 0x2d, 0xa1, 0xa8, 0x56, 0x21, 0xc5,
+  0x15, 0xc0, 0x21, 0xc1, 0x26, 0xc1, 0x2d, 0xc0, 0xa0, 0xa8, 0xa2, 0x88, 0x45, 0x5a, 0x3a, 0xc0,
+  0x32, 0x2d, 0x38, 0x6e, 0x35, 0x65, 0x38, 0x6f, 0x32, 0x2d, 0xc3, 0x28, 0x2d, 0xc0, 0x26, 0xc0,
+  0x32, 0x2d, 0x21, 0x26, 0x2d, 0x26, 0xc0, 0x2d, 0xc0, 0x6f, 0x2d, 0xc0, 0x39, 0x6e, 0x6b, 0x6e,
+  0xc2, 0x3e, 0x0a, 0x3e, 0xc1, 0x0a, 0xc3, 0x6e, 0x6b, 0xa2, 0x87, 0x5a, 0x16, 0xc0, 0xa2, 0x78,
+  0x6e, 0x6e, 0x2c, 0x6f, 0xc0, 0xa1, 0xa8, 0x56, 0x56, 0x2c, 0x27, 0x2c, 0x33, 0xc0, 0x61, 0x69,
+  0xc0, 0x16, 0xa3, 0x98, 0x66, 0x16, 0xc0, 0x22, 0xc0, 0x2c, 0x31, 0x38, 0xc0, 0x6b, 0x6d, 0x38,
+  0xc0, 0x3d, 0x38, 0x33, 0x38, 0xc0, 0x2c, 0x7a, 0xc0, 0x3b, 0x7f, 0x3b, 0x22, 0x2c, 0xa1, 0xc8,
+  0x7b, 0x45, 0x3d, 0x35, 0x65, 0xa1, 0xa8, 0x35, 0x1b, 0x16, 0xc0, 0x1b, 0xc1, 0x22, 0x1b, 0x2d,
+  0x56, 0x1b, 0x16, 0x7e, 0x16, 0x1b, 0x16, 0xc1, 0x1b, 0x16, 0xc0, 0xa2, 0xc7, 0x5e, 0x1e, 0x16,
+  0xc1, 0x27, 0x22, 0xc0, 0x7e, 0x6e, 0x22, 0x27, 0x33, 0x7a, 0x7e, 0x7a, 0x49, 0x01, 0xa2, 0x88,
+  0xa0, 0xa8, 0x68, 0x7b, 0xa3, 0x98, 0xa3, 0x98, 0xa7, 0xc7, 0x9d, 0x7a, 0x9d, 0x78, 0x9d, 0x79,
+  0x42, 0x61, 0x7a, 0xa4, 0x87, 0x7a, 0x6f, 0xa2, 0x97, 0xa2, 0x87, 0xa4, 0xb7, 0xa3, 0xa7, 0x9b,
+  0x6a, 0x9c, 0x4a, 0x9c, 0x6a, 0x51, 0xa3, 0x97, 0xa5, 0xd7, 0x9d, 0x8a, 0x20, 0xa6, 0xd6, 0x9d,
+  0x6a, 0x45, 0xc0, 0x28, 0x7a, 0x6f, 0x56, 0xa3, 0x98, 0xa4, 0xb7, 0xa4, 0xb6, 0x57, 0x6d, 0xa4,
+  0xb7, 0x6b, 0x97, 0x7b, 0xa3, 0x85, 0xa5, 0x87, 0xa1, 0xb9, 0xa4, 0xa8, 0x99, 0x9c, 0x39, 0xa4,
+  0x65, 0x76, 0xfe, 0x13, 0xb3, 0x6e, 0xc0, 0x1c, 0xc0, 0x21, 0x6b, 0x6e, 0x7a, 0x1c, 0x66, 0x1c,
+  0xc2, 0x21, 0xc1, 0x1c, 0xc2, 0x69, 0xc0, 0x17, 0x69, 0xc2, 0x15, 0x1c, 0x7a, 0x21, 0x15, 0xa5,
+  0xc8, 0xa3, 0x98, 0x9e, 0x69, 0x9d, 0x69, 0x15, 0x10, 0xc3, 0x1c, 0x21, 0xc0, 0x1c, 0xc1, 0x15,
+  0x1c, 0xc3, 0x15, 0xc1, 0x1c, 0x21, 0xc0, 0x1c, 0xc8, 0x10, 0xc0, 0x15, 0x1c, 0xc0, 0x21, 0xc1,
+  0x1c, 0xc3, 0x21, 0xc3, 0x2d, 0x69, 0x21, 0x26, 0x21, 0xc5, 0x1c, 0x21, 0x26, 0x21, 0x7e, 0x66,
+  0x15, 0x26, 0xc0, 0x21, 0xc1, 0x28, 0xc0, 0x29, 0x7f, 0xc0, 0x4a, 0x7e, 0x7b, 0x2d, 0x32, 0x3a,
+  0xa0, 0xa8, 0x5a, 0x35, 0xc0, 0x2d, 0xc9, 0x26, 0xc0, 0x32, 0x26, 0x2d, 0xc0, 0x26, 0xc0, 0x2d,
+  0xc0, 0xa2, 0x78, 0x32, 0x2d, 0x6f, 0x3e, 0xc0, 0x6f, 0x3e, 0x0a, 0x66, 0xc0, 0x3e, 0x39, 0x3e,
+  0xc0, 0x0a, 0xc3, 0x6e, 0x6f, 0xc2, 0x6e, 0x7f, 0x5a, 0xc1, 0x6f, 0x2c, 0x7b, 0x38, 0x61, 0x1b,
+  0xc0, 0x2c, 0x27, 0xc0, 0x61, 0xc0, 0x1b, 0x16, 0xc0, 0x1b, 0x20, 0x1b, 0x6b, 0x2c, 0xc0, 0x6b,
+  0x38, 0x6e, 0x67, 0x7a, 0x6e, 0x38, 0x33, 0xc0, 0x7e, 0xa0, 0xb7, 0x7f, 0x51, 0x6f, 0xc0, 0x0c,
+  0x9f, 0x69, 0x27, 0xa1, 0xa8, 0xa1, 0xb8, 0x04, 0x2f, 0x1b, 0xa0, 0xb8, 0xa3, 0xa8, 0x38, 0x42,
+  0x22, 0xc0, 0x1b, 0xc0, 0x22, 0x1b, 0xc0, 0x16, 0x1b, 0x7a, 0x1b, 0x16, 0xc0, 0x1b, 0x16, 0xc0,
+  0x22, 0x1b, 0xc0, 0x16, 0xc0, 0x1e, 0xa2, 0x87, 0x66, 0x66, 0xc0, 0x49, 0x1b, 0x22, 0x27, 0xc0,
+  0x22, 0xc0, 0x27, 0x2c, 0x36, 0x2c, 0xc1, 0x3b, 0xa1, 0xa9, 0x03, 0x9f, 0xe7, 0xa3, 0x78, 0xa4,
+  0x48, 0xa1, 0xb9, 0x4b, 0xa2, 0x97, 0x07, 0x51, 0x52, 0x6e, 0x7a, 0xa5, 0xa7, 0x7f, 0x9e, 0x68,
+  0xc0, 0x9d, 0x9a, 0x68, 0xa3, 0x97, 0x9b, 0x6c, 0x9d, 0x69, 0xc0, 0xa5, 0xa7, 0xa3, 0xc9, 0x9c,
+  0x59, 0x59, 0x52, 0x33, 0xa6, 0x97, 0x9d, 0x7a, 0x62, 0x1a, 0xa2, 0x98, 0x6b, 0xc0, 0xa4, 0xa6,
+  0xa3, 0xa8, 0x52, 0x9c, 0x68, 0x41, 0xa4, 0xa6, 0xaa, 0xd6, 0x96, 0x4d, 0x91, 0x2c, 0xa4, 0x94,
+  0xaa, 0xc6, 0xaa, 0xd6, 0x5b, 0x99, 0x6b, 0x9a, 0x59, 0x29, 0xa4, 0xa6, 0xfe, 0x13, 0xf4, 0xc2,
+  0x65, 0x6b, 0xc1, 0x7e, 0x51, 0xc3, 0x21, 0xc0, 0x1c, 0x21, 0xc0, 0x1c, 0x69, 0x66, 0xc2, 0x15,
+  0xc0, 0x10, 0xc0, 0x15, 0x1c, 0x10, 0x1c, 0xa1, 0xa8, 0xa7, 0xb7, 0xa3, 0x88, 0x98, 0x4a, 0x21,
+  0x15, 0x7a, 0x15, 0x1c, 0x15, 0xc1, 0x1c, 0x21, 0x1c, 0xc1, 0x15, 0xc0, 0x1c, 0x15, 0x10, 0x15,
+  0x10, 0xc1, 0x1c, 0xc2, 0x15, 0xc1, 0x10, 0xc0, 0x1c, 0x21, 0x1c, 0x15, 0x10, 0x15, 0x10, 0xc1,
+  0x15, 0x1c, 0xc1, 0x21, 0x15, 0xc0, 0x1c, 0x21, 0xc1, 0x6e, 0x2d, 0x6e, 0x30, 0x2d, 0x26, 0xc0,
+  0x21, 0xc2, 0x26, 0x21, 0xc2, 0x1c, 0x7e, 0x6e, 0x21, 0xc4, 0x28, 0xc0, 0x26, 0x35, 0xa1, 0xa8,
+  0x56, 0x30, 0x35, 0xc1, 0x38, 0xa3, 0x98, 0x66, 0x38, 0x26, 0x2d, 0xc3, 0x32, 0x2d, 0xc0, 0x26,
+  0x2d, 0x32, 0x2d, 0x26, 0x2d, 0xc1, 0x32, 0x26, 0x2d, 0xc0, 0x6f, 0xc0, 0x2d, 0x39, 0x6e, 0xc0,
+  0x6b, 0xc1, 0x3e, 0xc1, 0x39, 0xc1, 0xa2, 0x78, 0x6e, 0x0a, 0xc1, 0x0f, 0x6f, 0x6e, 0x1b, 0x66,
+  0x20, 0x6b, 0x7a, 0x5e, 0x7a, 0xa2, 0x98, 0x2f, 0x27, 0x2c, 0x27, 0x1b, 0xc0, 0x27, 0xc0, 0x1b,
+  0xc0, 0x16, 0xc0, 0x1b, 0x16, 0x1b, 0x27, 0xc0, 0x2c, 0xc1, 0x6b, 0xc0, 0x6e, 0xc0, 0x6e, 0x67,
+  0x38, 0x2c, 0xa0, 0xa8, 0xa0, 0xb8, 0x7e, 0xa2, 0x88, 0x55, 0x03, 0x4a, 0x5a, 0xc0, 0x5a, 0x3d,
+  0xa1, 0xa9, 0x08, 0x9f, 0x49, 0x27, 0x16, 0xc0, 0xa2, 0xa7, 0x46, 0x1b, 0x6b, 0x1b, 0x22, 0xc0,
+  0x1b, 0xc1, 0x1e, 0xa1, 0xa9, 0x16, 0xc3, 0x1b, 0xc0, 0xa1, 0xc9, 0xa1, 0xa7, 0x29, 0x22, 0x1b,
+  0x22, 0x2a, 0x1e, 0xa0, 0xa8, 0x29, 0x1b, 0xa1, 0xa8, 0xa1, 0xa8, 0x5b, 0x2a, 0x27, 0xc0, 0x2f,
+  0x27, 0xc1, 0x2c, 0xa2, 0x88, 0xa2, 0xa8, 0x42, 0x9d, 0xa9, 0xa3, 0xd6, 0xa3, 0x89, 0x9f, 0x69,
+  0x7e, 0xa1, 0xa8, 0x7a, 0x9d, 0x59, 0x20, 0xa5, 0xc7, 0xa4, 0xb7, 0xa3, 0xa8, 0x9a, 0x49, 0x9e,
+  0x68, 0x53, 0x41, 0x9e, 0x68, 0x11, 0xa4, 0xb7, 0xa1, 0x8a, 0x9d, 0x79, 0x0e, 0xa3, 0xa7, 0xa5,
+  0xc7, 0x9b, 0x4a, 0x9c, 0x79, 0x7e, 0xa4, 0xa7, 0x52, 0xa2, 0x86, 0xa1, 0xa9, 0x66, 0xa2, 0x87,
+  0xa2, 0x99, 0xa4, 0xb6, 0x56, 0x9c, 0x69, 0x9c, 0x6a, 0x99, 0x6a, 0xa3, 0xa6, 0xa6, 0xa6, 0x9b,
+  0x5a, 0x9b, 0x7b, 0xa3, 0xb7, 0xa3, 0x97, 0x13, 0x9e, 0x68, 0x9c, 0x79, 0xa4, 0x98, 0xa0, 0xa9,
+  0xa2, 0x76, 0xa7, 0xd7, 0xfe, 0x13, 0xf4, 0x66, 0x2d, 0xc2, 0x7a, 0x28, 0x69, 0x66, 0x21, 0xc1,
+  0x1c, 0xc7, 0x66, 0x69, 0x1c, 0x69, 0x21, 0x15, 0xc4, 0xa6, 0xa8, 0xa1, 0xa8, 0xa2, 0x78, 0x9a,
+  0x59, 0x10, 0x1c, 0xc0, 0x15, 0x1c, 0xc2, 0x10, 0x1c, 0xc0, 0x21, 0x1c, 0xc0, 0x15, 0xc0, 0x10,
+  0xc1, 0x15, 0xc0, 0x10, 0xc0, 0x15, 0xc0, 0x1c, 0xc0, 0x10, 0xc2, 0x15, 0x1c, 0xc0, 0x15, 0xc1,
+  0x10, 0xc2, 0x15, 0x67, 0x1c, 0x15, 0xc0, 0x1c, 0x15, 0x21, 0xc2, 0x2d, 0x35, 0x2d, 0xc0, 0x21,
+  0xc5, 0x28, 0x7a, 0x21, 0x2d, 0x21, 0x1c, 0x21, 0xc6, 0x28, 0x21, 0x6e, 0x35, 0xa1, 0xa9, 0x30,
+  0xc0, 0x35, 0x2d, 0x26, 0x7a, 0x35, 0x6e, 0x56, 0x2d, 0xc0, 0x32, 0x2d, 0xc1, 0x28, 0x26, 0xc0,
+  0x2d, 0xc2, 0x21, 0x2d, 0xc2, 0x30, 0x2d, 0x6f, 0x7e, 0x39, 0x6e, 0xc0, 0x6b, 0xc1, 0x3e, 0x39,
+  0xc1, 0x3e, 0xc0, 0x6f, 0xc0, 0x6e, 0x0a, 0xc1, 0x6f, 0x6e, 0x6e, 0x1b, 0xc0, 0x20, 0x6b, 0x66,
+  0xa2, 0x77, 0x76, 0xa2, 0x98, 0x2c, 0x27, 0xc1, 0x1b, 0xc4, 0x16, 0xc0, 0x1b, 0x16, 0x1b, 0x27,
+  0x2c, 0xc1, 0x6b, 0x6e, 0x33, 0x38, 0x7e, 0x38, 0xc0, 0x75, 0x76, 0xa1, 0xb8, 0xa2, 0x87, 0xa0,
+  0xa8, 0x46, 0x4a, 0x6e, 0x9e, 0x68, 0x7f, 0x2f, 0xc0, 0xa1, 0xa8, 0x41, 0x7f, 0x2f, 0x1b, 0xc0,
+  0x7a, 0xc0, 0x16, 0x1b, 0x20, 0x1b, 0x1e, 0x2a, 0x22, 0x16, 0x1b, 0xc0, 0x23, 0x16, 0x7d, 0x7f,
+  0x52, 0x16, 0x1e, 0xa1, 0xa8, 0xa2, 0xb7, 0xa0, 0xa9, 0x9f, 0x48, 0x27, 0x2a, 0x1b, 0xa0, 0xa8,
+  0x29, 0x23, 0x2a, 0x29, 0x31, 0xa1, 0xb9, 0xc0, 0x6e, 0x01, 0x27, 0xc0, 0x22, 0xc0, 0x27, 0xa2,
+  0x87, 0xa4, 0xc8, 0xa5, 0xb7, 0x9d, 0x7a, 0x9d, 0x59, 0xa2, 0xa7, 0x46, 0xa0, 0xb8, 0x55, 0xa0,
+  0xb7, 0xa4, 0x87, 0xa3, 0x99, 0xa1, 0xa9, 0x65, 0x22, 0x1c, 0x26, 0xaa, 0xc5, 0x77, 0x51, 0x6f,
+  0x7f, 0x5a, 0xa3, 0x97, 0xa2, 0x97, 0xa0, 0xa9, 0x9d, 0x79, 0x9c, 0x69, 0xa5, 0xb6, 0x6b, 0x9a,
+  0x6b, 0xa2, 0x76, 0x3e, 0x3b, 0xa3, 0xa8, 0xa3, 0xa8, 0xa8, 0xc6, 0x9d, 0xab, 0x9b, 0x5a, 0xa2,
+  0x85, 0xa5, 0xa8, 0x93, 0x6e, 0x4c, 0xa5, 0xa8, 0x9d, 0x79, 0x39, 0x7b, 0x9d, 0x79, 0xa4, 0x97,
+  0x7a, 0x6e, 0xa6, 0xc7, 0x9d, 0x79, 0x9d, 0x89, 0xa8, 0xa5, 0xa2, 0xa8, 0xfe, 0x13, 0xf4, 0xc1,
+  0x6e, 0x2d, 0xc1, 0x66, 0xc0, 0x69, 0x66, 0xc5, 0x21, 0x1c, 0xc3, 0x69, 0x1c, 0xc1, 0x21, 0x1c,
+  0xc1, 0x21, 0xa2, 0xa7, 0xa3, 0x89, 0x5a, 0x52, 0x28, 0x75, 0x1c, 0x15, 0xc2, 0x1c, 0xc0, 0x65,
+  0xc0, 0x15, 0x1c, 0xc4, 0x15, 0xc1, 0x1c, 0x15, 0x1c, 0xc0, 0x15, 0x1c, 0xc3, 0x15, 0x1c, 0x15,
+  0xc0, 0x1c, 0x15, 0x1c, 0xc2, 0x15, 0x10, 0xc1, 0x15, 0xc0, 0x1c, 0xc0, 0x21, 0xc2, 0x6e, 0xc2,
+  0x21, 0xc0, 0x26, 0x21, 0xc5, 0x28, 0x21, 0xc8, 0x26, 0xc0, 0x2d, 0x26, 0x7b, 0xc0, 0x26, 0x21,
+  0xc0, 0x7b, 0x26, 0x32, 0x2d, 0xc0, 0x32, 0x2d, 0x32, 0x2d, 0xc2, 0x26, 0xc0, 0x2d, 0xc8, 0x6f,
+  0x6e, 0x39, 0x3e, 0x6e, 0x67, 0xc2, 0x3e, 0x2d, 0x39, 0xc0, 0x05, 0xc0, 0x6e, 0x6e, 0x6b, 0x0a,
+  0xc0, 0x0f, 0x16, 0x6e, 0xc1, 0x6e, 0x6b, 0xc2, 0x7a, 0x6e, 0x27, 0xc0, 0x1b, 0x6b, 0x16, 0xc1,
+  0x1b, 0xc0, 0x16, 0x1b, 0xc1, 0x16, 0x20, 0x6f, 0xc0, 0x6b, 0xc2, 0x6e, 0xc0, 0x33, 0x7a, 0xa1,
+  0xc7, 0x76, 0x9f, 0x48, 0x7b, 0xa3, 0xd7, 0x5f, 0x9e, 0x58, 0x5a, 0x3a, 0x7a, 0x2d, 0x1b, 0x2d,
+  0x27, 0x22, 0x2f, 0x2a, 0x16, 0x1b, 0xc0, 0x76, 0x6e, 0xc0, 0x16, 0x7f, 0xc0, 0x1b, 0xc0, 0x23,
+  0xa1, 0xc8, 0x56, 0x1e, 0x7a, 0xa2, 0xb7, 0x4a, 0x21, 0x0f, 0x2c, 0xa2, 0x97, 0x9f, 0x5a, 0x79,
+  0x2d, 0x2a, 0x7d, 0x66, 0x9f, 0xb9, 0x23, 0x2d, 0x79, 0xa0, 0xa8, 0x46, 0x3d, 0xa2, 0x97, 0x17,
+  0x3d, 0x2a, 0x5a, 0xc2, 0xa6, 0xb6, 0xa4, 0xe7, 0x47, 0x9e, 0x68, 0x9c, 0x78, 0xc0, 0xa7, 0xb6,
+  0x9d, 0x6c, 0x75, 0xa3, 0xc7, 0xa2, 0x67, 0xa0, 0xa8, 0x9d, 0x79, 0x99, 0x3a, 0x0f, 0x6e, 0xa2,
+  0x89, 0xa1, 0xa7, 0xa3, 0xd8, 0xa6, 0xc7, 0x9d, 0x5a, 0x9f, 0x68, 0x56, 0xa0, 0xa9, 0x5e, 0xa1,
+  0xc9, 0xa3, 0x97, 0x7f, 0x0d, 0xa3, 0x98, 0x66, 0x55, 0xa3, 0x98, 0xc0, 0x5a, 0xa3, 0xb7, 0xa7,
+  0xd7, 0x6b, 0x93, 0x5d, 0xac, 0xa3, 0xa4, 0xb7, 0x94, 0x3d, 0xa3, 0x76, 0xa0, 0xa8, 0x9c, 0x6a,
+  0xa5, 0xa6, 0x9c, 0x7a, 0xa5, 0xa7, 0xa2, 0xa7, 0x2c, 0x09, 0xa5, 0xb8, 0x9b, 0x7b, 0x59, 0xa2,
+  0xa7, 0x52, 0xfe, 0x13, 0xf4, 0xc3, 0x66, 0x2d, 0xc0, 0x65, 0x66, 0xc3, 0x21, 0xc0, 0x1c, 0x21,
+  0x1c, 0xc0, 0x21, 0x1c, 0xc1, 0x21, 0x1c, 0x69, 0x1c, 0x21, 0xc1, 0x1c, 0xa4, 0x97, 0x6e, 0xa0,
+  0x6a, 0x66, 0x1c, 0x15, 0xc2, 0x1c, 0x15, 0x66, 0xc1, 0x15, 0xc0, 0x1c, 0x21, 0x1c, 0xc2, 0x15,
+  0xc0, 0x1c, 0x21, 0x1c, 0xc8, 0x7e, 0x1c, 0x15, 0xc0, 0x1c, 0xc3, 0x15, 0x10, 0xc3, 0x1c, 0xc0,
+  0x21, 0xc8, 0x6e, 0x21, 0xc7, 0x7f, 0x1c, 0x21, 0x30, 0x26, 0x21, 0xc2, 0x30, 0xc0, 0x26, 0x30,
+  0x26, 0xc0, 0x21, 0xc1, 0x26, 0xc0, 0x2d, 0xc1, 0x6e, 0x2d, 0xc4, 0x32, 0x2d, 0xc2, 0x28, 0x2d,
+  0x6f, 0x32, 0xc1, 0x2d, 0x39, 0x6e, 0xc0, 0x6e, 0x6b, 0x66, 0xc2, 0x39, 0x2d, 0x39, 0x3e, 0x39,
+  0x3e, 0x0a, 0x6f, 0xc1, 0x69, 0xc0, 0x6f, 0xc1, 0x6f, 0xc0, 0x1b, 0x27, 0xc2, 0x7e, 0x27, 0x1b,
+  0xc0, 0x6b, 0x61, 0x0f, 0x16, 0x1b, 0xc4, 0x27, 0x6e, 0xc0, 0x6f, 0xc1, 0x69, 0x2c, 0x27, 0x2c,
+  0x76, 0xa1, 0xb8, 0x6d, 0x6b, 0x2a, 0xa2, 0x97, 0xa2, 0xb8, 0x3d, 0x2c, 0x2a, 0x1b, 0xa2, 0xc7,
+  0x6b, 0x9f, 0x58, 0x2a, 0x59, 0x1b, 0xc2, 0x7b, 0x69, 0xc0, 0xa1, 0xa8, 0x34, 0x9f, 0x69, 0x22,
+  0x1b, 0x76, 0xa2, 0xa7, 0xa1, 0xa9, 0x6e, 0x65, 0x1e, 0x7a, 0x2c, 0x1e, 0x29, 0x6b, 0x5a, 0x38,
+  0x2f, 0x23, 0xa2, 0x88, 0x3a, 0x2f, 0x2c, 0x1e, 0x25, 0xa0, 0xa7, 0x26, 0x30, 0xc0, 0xa3, 0xa7,
+  0xa2, 0xc8, 0x38, 0x7e, 0x08, 0x38, 0x2a, 0xa3, 0x97, 0xa1, 0xb8, 0xa0, 0xc8, 0x6e, 0x36, 0x3d,
+  0xa4, 0xc6, 0xa5, 0xa8, 0xa6, 0xa7, 0x52, 0x9c, 0x6a, 0x9d, 0x78, 0x38, 0x9e, 0x68, 0x21, 0xa2,
+  0x97, 0x00, 0xc0, 0x30, 0xa3, 0x88, 0xa4, 0xb5, 0x17, 0xa2, 0x88, 0xa4, 0xa7, 0x7e, 0xa2, 0x88,
+  0xa3, 0xc8, 0xa2, 0x88, 0x9d, 0x79, 0xc0, 0x9c, 0x69, 0x45, 0x51, 0xc0, 0x7b, 0xa4, 0xa7, 0x51,
+  0xa1, 0x8a, 0xa9, 0xd5, 0xa4, 0xb7, 0x98, 0x4c, 0x6c, 0x45, 0x9d, 0x8a, 0xa4, 0x97, 0x67, 0x9b,
+  0x8a, 0xa7, 0xb6, 0xa5, 0xa7, 0xc0, 0x9a, 0x7b, 0x9b, 0x58, 0xa4, 0x96, 0xa3, 0x98, 0x1a, 0x7e,
+  0x9d, 0x78, 0x46, 0xfe, 0x14, 0x15, 0x69, 0x39, 0x65, 0x66, 0x2d, 0x28, 0xc0, 0x66, 0x69, 0xc5,
+  0x6e, 0x1c, 0x23, 0x1c, 0x66, 0x1c, 0xc0, 0x21, 0xc1, 0x1c, 0xc1, 0xa2, 0x77, 0x21, 0xa2, 0x99,
+  0xa3, 0x97, 0x9f, 0x69, 0x66, 0x28, 0x60, 0x17, 0x1c, 0x7a, 0x21, 0x1c, 0xc0, 0x10, 0x6e, 0x10,
+  0xc0, 0x1c, 0xc1, 0x21, 0x1c, 0xc4, 0x15, 0x1c, 0x15, 0x1c, 0x21, 0x1c, 0xc2, 0x21, 0x1c, 0xc3,
+  0x21, 0x1c, 0xc3, 0x15, 0xc0, 0x10, 0xc0, 0x15, 0x1c, 0xc0, 0x21, 0xcd, 0x28, 0x21, 0xc1, 0x2d,
+  0x21, 0xc0, 0x1c, 0x21, 0x26, 0x21, 0xc3, 0x26, 0x21, 0xc0, 0x2d, 0x21, 0x26, 0x1c, 0x21, 0xc0,
+  0x28, 0xc0, 0x2d, 0xc2, 0x32, 0x2d, 0xc1, 0x28, 0x2d, 0x7e, 0x2d, 0x32, 0xc0, 0x76, 0x2d, 0x32,
+  0x6f, 0x32, 0x3e, 0x39, 0x7f, 0x3e, 0x6f, 0x6e, 0x62, 0x3e, 0xc2, 0x39, 0x2d, 0x39, 0xc1, 0x3e,
+  0x0a, 0x6f, 0xc1, 0x0f, 0x16, 0x6e, 0xc1, 0x6b, 0x7a, 0x22, 0xa2, 0x77, 0x65, 0x6b, 0x22, 0x20,
+  0x22, 0xc0, 0x16, 0x22, 0x1b, 0x0f, 0x16, 0x1b, 0xc3, 0x22, 0x2c, 0xc0, 0x6f, 0x6b, 0x38, 0x7f,
+  0x38, 0x66, 0x27, 0x7e, 0xa1, 0xb8, 0x46, 0x5e, 0xa2, 0xa8, 0x66, 0xa0, 0xa8, 0x59, 0x34, 0x62,
+  0x1b, 0x16, 0xa1, 0xa8, 0xa1, 0xa9, 0x16, 0x1b, 0xc0, 0x16, 0xc0, 0x2a, 0x1b, 0x7e, 0x7a, 0x7a,
+  0xa2, 0xc8, 0x7e, 0x45, 0x9d, 0x6a, 0x5f, 0x21, 0xa2, 0x88, 0x3d, 0x2d, 0x5d, 0x22, 0x1b, 0x35,
+  0x32, 0x7e, 0x3d, 0xc0, 0x67, 0x2f, 0x32, 0xc0, 0x4b, 0x38, 0x2f, 0x23, 0x26, 0xa2, 0xa8, 0xa2,
+  0x67, 0x66, 0x05, 0x00, 0x7e, 0x00, 0xa2, 0x97, 0xa0, 0xa8, 0x5a, 0x61, 0xa0, 0xb7, 0xa5, 0x98,
+  0x9d, 0x6a, 0x9e, 0x59, 0x16, 0xa4, 0x88, 0xa6, 0xc6, 0xa4, 0x87, 0x9c, 0x8b, 0x9c, 0x68, 0x9b,
+  0x69, 0x3d, 0xc0, 0x32, 0x2d, 0x55, 0x35, 0x05, 0x0f, 0xa5, 0xa7, 0xa5, 0xb8, 0x9b, 0x7b, 0xa2,
+  0x86, 0xa4, 0xa7, 0xa2, 0x97, 0x39, 0x66, 0x9c, 0x79, 0x9e, 0x67, 0x47, 0x7e, 0xc0, 0xa1, 0xa9,
+  0x31, 0xa3, 0xa8, 0xa6, 0xd6, 0x7f, 0x7e, 0x6e, 0x9b, 0x6a, 0x09, 0x9c, 0x7a, 0xa1, 0xa9, 0xa8,
+  0xc6, 0x24, 0xa2, 0x87, 0x66, 0x9c, 0x5a, 0x65, 0x6b, 0x96, 0x3b, 0x34, 0xaa, 0xc5, 0x1c, 0x95,
+  0x6d, 0x5d, 0x9f, 0x68, 0x45, 0xfe, 0x14, 0x14, 0x6f, 0xc0, 0x32, 0x66, 0x66, 0xc3, 0x65, 0xc8,
+  0x66, 0x1c, 0xc4, 0x6e, 0x1c, 0xc0, 0x2d, 0xa2, 0xa8, 0xa3, 0x87, 0x9e, 0x59, 0x62, 0x1c, 0x69,
+  0x66, 0x17, 0x15, 0x21, 0x1c, 0xc1, 0x15, 0xc2, 0x21, 0xc0, 0x1c, 0xc0, 0x21, 0x1c, 0x21, 0x1c,
+  0x15, 0x1c, 0x15, 0x1c, 0xc1, 0x21, 0x1c, 0xc2, 0x21, 0x1c, 0xc5, 0x21, 0x17, 0x1c, 0xc0, 0x17,
+  0x15, 0xc1, 0x1c, 0xc0, 0x21, 0xc4, 0x6e, 0xc0, 0x21, 0xc2, 0x26, 0x21, 0xc1, 0x1c, 0xc0, 0x28,
+  0x21, 0xc5, 0x1c, 0xc0, 0x21, 0xc6, 0x7a, 0xc0, 0x1c, 0x2d, 0xc3, 0x26, 0x32, 0xc0, 0x2d, 0xc0,
+  0x21, 0x2d, 0x6d, 0x7f, 0x32, 0x2d, 0x7f, 0x32, 0x3e, 0xc1, 0x6f, 0x3e, 0x0a, 0x03, 0x3e, 0xc0,
+  0x39, 0x3e, 0x39, 0xc1, 0x32, 0x2d, 0x39, 0x3e, 0x0a, 0x66, 0x0a, 0x6f, 0x6e, 0x16, 0xc0, 0x1b,
+  0xc0, 0x16, 0x1b, 0x6b, 0x6e, 0xc1, 0x1b, 0x22, 0xc0, 0x27, 0x1b, 0x16, 0xc3, 0x1b, 0x27, 0x1b,
+  0x16, 0x1b, 0x27, 0x6e, 0xc0, 0x6f, 0x6f, 0x38, 0xc0, 0x7f, 0x38, 0x66, 0x6d, 0x77, 0xa1, 0xa7,
+  0x4a, 0xa1, 0xa8, 0xa1, 0xb9, 0x9e, 0x59, 0x69, 0x56, 0x66, 0xc0, 0x1b, 0x16, 0x7e, 0x69, 0x1e,
+  0xc0, 0x22, 0x64, 0xa2, 0xb7, 0xa2, 0xb9, 0x9f, 0x68, 0x56, 0xa0, 0xa8, 0x34, 0x6f, 0x34, 0x2c,
+  0x5e, 0x6b, 0xc0, 0x2f, 0x6e, 0x6b, 0x38, 0x9f, 0xb8, 0xa1, 0xa8, 0xa3, 0xb8, 0x7a, 0x9e, 0x68,
+  0x5a, 0x57, 0x3b, 0x38, 0x3b, 0xa0, 0xa8, 0x3e, 0x3b, 0x34, 0x72, 0xa1, 0xb8, 0x22, 0xc0, 0x9e,
+  0x69, 0x65, 0x04, 0x08, 0xa3, 0xb8, 0x22, 0x7d, 0x7f, 0x76, 0x9e, 0x69, 0xa3, 0x78, 0x7e, 0xa1,
+  0xa9, 0xa2, 0xa7, 0x5e, 0x52, 0x6e, 0x3b, 0x9c, 0x88, 0x56, 0x9d, 0x4a, 0xa2, 0xa6, 0x3a, 0x2a,
+  0x7e, 0xa2, 0xa8, 0xa4, 0xb7, 0xab, 0xe6, 0xa3, 0xa9, 0x9b, 0x6a, 0x9c, 0x68, 0x0d, 0x36, 0x33,
+  0xa1, 0xa7, 0xa6, 0xb8, 0x0d, 0x2c, 0x3c, 0x7b, 0x47, 0xa4, 0xa5, 0x5a, 0x9c, 0x88, 0xab, 0xc6,
+  0x7f, 0x9b, 0x7a, 0x3c, 0x98, 0x4a, 0xa8, 0xb5, 0xac, 0xf6, 0xc2, 0x42, 0x3a, 0x9d, 0x8a, 0x7e,
+  0x9d, 0x7a, 0x9b, 0x48, 0xa4, 0xb6, 0xac, 0xd6, 0x9d, 0x8a, 0x99, 0x5a, 0x1b, 0x15, 0x25, 0xfe,
+  0x14, 0x35, 0x66, 0x65, 0xc1, 0x66, 0xc0, 0xa2, 0x77, 0x2d, 0x28, 0xc0, 0x61, 0x6e, 0x6e, 0x2d,
+  0x28, 0x1c, 0xc7, 0x28, 0x1c, 0xc1, 0x28, 0x32, 0xa2, 0x78, 0x7a, 0x39, 0x2d, 0x1c, 0xc0, 0x69,
+  0x66, 0x15, 0x1c, 0x21, 0x1c, 0xc4, 0x21, 0xc0, 0x1c, 0xc2, 0x21, 0x1c, 0xc2, 0x21, 0xc0, 0x1c,
+  0xc2, 0x21, 0x1c, 0x21, 0x1c, 0xc3, 0x21, 0xc1, 0x1c, 0xc7, 0x2d, 0x21, 0xc4, 0x6e, 0x21, 0xc7,
+  0x28, 0x21, 0xc5, 0x1c, 0x21, 0xc4, 0x7a, 0x21, 0xc1, 0x26, 0x21, 0xc0, 0x2d, 0xc3, 0x32, 0x2d,
+  0xc1, 0x28, 0x2d, 0x32, 0x26, 0x32, 0x39, 0xc0, 0x32, 0x3e, 0x39, 0xc0, 0xa2, 0x78, 0xc4, 0x3e,
+  0xc1, 0x39, 0xc2, 0x66, 0x39, 0x0a, 0x6e, 0x0a, 0x6f, 0x6f, 0x6e, 0x65, 0xc0, 0x27, 0x1b, 0xc0,
+  0x27, 0xc2, 0x22, 0x1b, 0x22, 0xc0, 0x27, 0x1b, 0x16, 0xc0, 0x1b, 0x16, 0xc0, 0x22, 0xc1, 0x27,
+  0xc0, 0x6e, 0x6f, 0x66, 0x38, 0xc0, 0x6f, 0x38, 0x2c, 0x38, 0xc0, 0x33, 0x38, 0x69, 0x2c, 0x7f,
+  0x65, 0x27, 0x2c, 0xa0, 0xa8, 0x7e, 0x1b, 0x16, 0x1b, 0x7a, 0x7a, 0x1e, 0x16, 0x0f, 0x76, 0xa4,
+  0xb7, 0x7e, 0x9e, 0x69, 0x7a, 0x7f, 0x4a, 0x9f, 0x69, 0x66, 0x32, 0xa2, 0xb8, 0xa2, 0x67, 0x66,
+  0x52, 0x49, 0x4b, 0x6b, 0xa0, 0xa7, 0x0f, 0x7a, 0x7a, 0x45, 0x5b, 0x5e, 0x04, 0x09, 0x69, 0xa0,
+  0xa8, 0x12, 0x44, 0x6b, 0x9e, 0x69, 0x2a, 0xa3, 0xb8, 0x08, 0x0f, 0x0c, 0x69, 0x0f, 0xa2, 0x96,
+  0xa0, 0xa8, 0xa5, 0x98, 0xa2, 0x87, 0x9d, 0x8a, 0x6e, 0x9c, 0x8a, 0x59, 0xa2, 0x98, 0xc0, 0xa1,
+  0xa8, 0x56, 0x9d, 0x59, 0x9b, 0x79, 0x5e, 0x2a, 0x5a, 0x32, 0x02, 0xa6, 0xc6, 0xa6, 0xb8, 0x9c,
+  0x79, 0xa9, 0xd6, 0x9d, 0x9a, 0x9d, 0x68, 0x47, 0x9b, 0x6a, 0x9c, 0x59, 0xa5, 0xb6, 0xa2, 0xa9,
+  0x34, 0xa2, 0x97, 0x6b, 0x04, 0x51, 0x33, 0x9a, 0x5b, 0xa4, 0xa6, 0x97, 0x5b, 0x05, 0xa9, 0xc5,
+  0x9d, 0x7a, 0x9c, 0x68, 0x1d, 0x7b, 0xa5, 0xb7, 0xa7, 0xb6, 0x6f, 0x23, 0xa4, 0x97, 0x9a, 0x7b,
+  0x23, 0xa8, 0xc6, 0x98, 0x5c, 0x97, 0x4a, 0x40, 0xa8, 0xa5, 0xa5, 0xb8, 0x99, 0x6c, 0xa4, 0x96,
+  0xa9, 0xd6, 0x31, 0xc0, 0xfe, 0x14, 0x15, 0xc0, 0x65, 0xc0, 0x39, 0x61, 0xc0, 0x2d, 0x39, 0x28,
+  0x2d, 0x28, 0x71, 0x5f, 0x2d, 0xc0, 0x65, 0x66, 0xc3, 0x28, 0x23, 0x28, 0xc1, 0x1c, 0x28, 0x39,
+  0x6e, 0xa2, 0x77, 0x6b, 0x72, 0x28, 0x1c, 0xc1, 0x69, 0x1c, 0xc2, 0x21, 0x1c, 0xc1, 0x21, 0xc0,
+  0x2d, 0xc0, 0x28, 0xc0, 0x21, 0x1c, 0xc0, 0x28, 0x21, 0x1c, 0x28, 0xc0, 0x2d, 0xc0, 0x28, 0xc1,
+  0x1c, 0xc1, 0x21, 0xc1, 0x2d, 0x28, 0xc0, 0x21, 0xc0, 0x28, 0xc0, 0x21, 0xc0, 0x1c, 0xc1, 0x21,
+  0x28, 0x1c, 0x21, 0xc0, 0x1c, 0x21, 0xc0, 0x6e, 0x21, 0xc0, 0x1c, 0x21, 0xc2, 0x1c, 0x21, 0x2d,
+  0x28, 0x1c, 0xc0, 0x21, 0xc2, 0x1c, 0xc0, 0x28, 0xc0, 0x21, 0x28, 0xc0, 0x21, 0xc1, 0x26, 0x2d,
+  0x6e, 0x2d, 0xc7, 0x7a, 0x2d, 0xc0, 0x1c, 0x30, 0x2d, 0x3e, 0xc1, 0x39, 0xc0, 0xa2, 0x78, 0xc4,
+  0x3e, 0x39, 0xc0, 0x3e, 0x39, 0x3e, 0x6b, 0x3e, 0x39, 0x05, 0x0a, 0xc0, 0x6f, 0x7e, 0x5f, 0x66,
+  0xc1, 0x27, 0xc5, 0x22, 0xc0, 0x27, 0xc0, 0x16, 0x6e, 0x27, 0x1b, 0x16, 0x1b, 0x22, 0x27, 0xc0,
+  0x22, 0xa2, 0x77, 0xc0, 0x6b, 0x6e, 0xc4, 0x2c, 0x38, 0x33, 0x38, 0x33, 0x38, 0x33, 0x38, 0x2c,
+  0x27, 0x7e, 0xa1, 0xc9, 0x9f, 0x68, 0x22, 0x1b, 0xa1, 0xa8, 0x7a, 0x7a, 0x45, 0x0f, 0x0a, 0xa2,
+  0x98, 0xa3, 0xb8, 0x45, 0x26, 0x32, 0x7a, 0x6e, 0x5a, 0xc0, 0x7e, 0xa1, 0xd9, 0x4e, 0x56, 0x66,
+  0xc0, 0x76, 0x3a, 0x35, 0x7e, 0xc0, 0xa1, 0xa8, 0xc0, 0x0c, 0x7a, 0x08, 0x1a, 0x56, 0x45, 0x3d,
+  0x00, 0x03, 0x00, 0x9e, 0x5a, 0x27, 0x00, 0x6e, 0x08, 0x7a, 0xa2, 0x88, 0x65, 0x7a, 0xa4, 0x88,
+  0xa3, 0xa8, 0x9d, 0x89, 0x48, 0x47, 0x52, 0xa2, 0xb7, 0x1f, 0x0b, 0x66, 0x9c, 0x39, 0xc0, 0xa4,
+  0xa6, 0x1f, 0x9f, 0x4a, 0x51, 0x29, 0xa4, 0xc7, 0x1d, 0xa2, 0x98, 0x59, 0x9d, 0x6b, 0x65, 0xa5,
+  0xc7, 0xa2, 0x78, 0x9d, 0xa9, 0xaa, 0xc6, 0x99, 0x6a, 0x9c, 0x78, 0x99, 0x4b, 0x01, 0x42, 0xa2,
+  0x77, 0xc0, 0x9d, 0x99, 0xa2, 0x87, 0xa4, 0x88, 0xc0, 0x76, 0xc0, 0xa6, 0xb6, 0xaa, 0xd6, 0xc0,
+  0x94, 0x4c, 0x9a, 0x49, 0x6d, 0xc0, 0xad, 0xe5, 0x16, 0x9c, 0x69, 0xa4, 0xa6, 0x9e, 0x59, 0x9a,
+  0x6a, 0xa1, 0xa7, 0x39, 0xa1, 0xa8, 0xa5, 0xc8, 0x31, 0xc1, 0x9b, 0x7b, 0xfe, 0x14, 0x15, 0xc0,
+  0x65, 0xc0, 0x66, 0xc5, 0x2d, 0x61, 0xc0, 0x28, 0xc0, 0x66, 0x28, 0xc0, 0x61, 0x1c, 0x2d, 0x28,
+  0xc1, 0x23, 0xc0, 0x2d, 0x39, 0x6e, 0x6f, 0x69, 0xa2, 0x89, 0x9d, 0x99, 0x28, 0x1c, 0xc0, 0x7a,
+  0x1c, 0xc8, 0x28, 0x2d, 0xc3, 0x28, 0xc1, 0x2d, 0x28, 0x2d, 0xc1, 0x6e, 0x2d, 0xc2, 0x28, 0xc1,
+  0x2d, 0x28, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0x28, 0x69, 0x23, 0x1c, 0x28, 0x1c, 0xc0, 0x21, 0xc1,
+  0x1c, 0xc0, 0x21, 0xc0, 0x1c, 0xc0, 0x21, 0xc5, 0x23, 0x28, 0x2d, 0x28, 0xc0, 0x1c, 0xc0, 0x21,
+  0xc0, 0x28, 0x1c, 0x28, 0xc1, 0x1c, 0x21, 0x2d, 0x32, 0x2d, 0x69, 0x2d, 0xc5, 0x32, 0x2d, 0x21,
+  0x2d, 0xc2, 0x21, 0xc0, 0x32, 0x39, 0x3e, 0xc0, 0x39, 0x7e, 0x0a, 0xc1, 0x05, 0xc1, 0x0a, 0x3e,
+  0xc0, 0x39, 0x3e, 0xc0, 0x05, 0x0a, 0x05, 0xc0, 0x0a, 0x6f, 0x6e, 0xc0, 0x6b, 0x6e, 0xc5, 0x6e,
+  0xc0, 0x27, 0x22, 0xc1, 0x27, 0xc0, 0x1b, 0xc0, 0x22, 0xc1, 0x27, 0xc2, 0x1b, 0x2c, 0xc2, 0x6f,
+  0xc2, 0x66, 0xc0, 0x38, 0x33, 0x38, 0x33, 0x2c, 0x33, 0x38, 0x75, 0x6f, 0xa0, 0xa7, 0x51, 0x1e,
+  0x1b, 0x7e, 0xa0, 0xa9, 0x79, 0xa1, 0xa8, 0x5a, 0x1e, 0xc0, 0xa2, 0xa7, 0x7f, 0x9f, 0x69, 0x27,
+  0x7f, 0x6d, 0xa1, 0xc9, 0xc0, 0x9f, 0x69, 0xa1, 0xa8, 0x0c, 0x7e, 0xc0, 0xa1, 0xa8, 0x56, 0x9e,
+  0x67, 0x6b, 0x66, 0x09, 0xc0, 0x14, 0x65, 0x6b, 0x08, 0x0f, 0x7a, 0x46, 0x3d, 0x0c, 0xc0, 0x1f,
+  0xa2, 0xa7, 0x0f, 0x9d, 0x59, 0x08, 0xc0, 0x7a, 0x7e, 0x7a, 0xa1, 0x8a, 0x69, 0xa3, 0x97, 0x61,
+  0x61, 0xa1, 0x8a, 0xa3, 0x88, 0x22, 0x9c, 0x48, 0xa3, 0xb8, 0x9d, 0x5a, 0x9d, 0x89, 0xa2, 0x98,
+  0x2a, 0xa9, 0xe6, 0xa2, 0xa8, 0x9c, 0x29, 0x72, 0xa2, 0xa7, 0xa7, 0xb7, 0x9c, 0x79, 0x9d, 0x68,
+  0xa2, 0x99, 0xa3, 0x87, 0x9d, 0x8a, 0x65, 0xac, 0xf5, 0xa1, 0xa9, 0x97, 0x4b, 0x9b, 0x79, 0xa2,
+  0xa8, 0x5b, 0xa7, 0xc6, 0x9d, 0x7b, 0x96, 0x3a, 0x3d, 0x10, 0xa9, 0xc7, 0x9d, 0x7b, 0x65, 0x2a,
+  0x9b, 0x5b, 0xa7, 0xf5, 0xa2, 0x88, 0x9b, 0x69, 0x9d, 0x9b, 0x9d, 0x69, 0x5a, 0xa4, 0xa6, 0xa1,
+  0xa9, 0x4b, 0x9b, 0x8a, 0x2a, 0xa3, 0xa8, 0x9b, 0x9b, 0x2f, 0xa4, 0x96, 0xa9, 0xd7, 0x7e, 0xc1,
+  0x9c, 0x6a, 0x94, 0x3c, 0xfe, 0x13, 0xf4, 0xc0, 0x6f, 0x66, 0x65, 0x2d, 0xc0, 0x28, 0x65, 0x2d,
+  0xc1, 0x28, 0xc2, 0x1c, 0xc0, 0x28, 0x66, 0xc0, 0x2d, 0xc0, 0x23, 0x28, 0xc1, 0xa3, 0x78, 0x6f,
+  0xc0, 0x66, 0x3e, 0x0a, 0x69, 0x2d, 0x28, 0x1c, 0xc6, 0x23, 0x28, 0xc1, 0x2d, 0xc1, 0x28, 0x2d,
+  0xc1, 0x28, 0xc1, 0x2d, 0xc8, 0x28, 0xc2, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0xc0, 0x28, 0x1c, 0xc0,
+  0x28, 0x69, 0x1c, 0xc1, 0x21, 0xc2, 0x28, 0x1c, 0xc1, 0x28, 0x21, 0xc2, 0x28, 0xc6, 0x1c, 0x23,
+  0x1c, 0x28, 0xc1, 0x23, 0xc0, 0x28, 0x2d, 0x6e, 0x2d, 0xc3, 0x32, 0x2d, 0xc1, 0x32, 0x21, 0x7f,
+  0x6e, 0x32, 0x2d, 0x23, 0x1c, 0x2d, 0x32, 0xc1, 0x39, 0xc0, 0x3e, 0xa2, 0x78, 0xc0, 0x0a, 0x05,
+  0x0a, 0x05, 0x3e, 0xc0, 0x39, 0x3e, 0x05, 0xc0, 0x0a, 0xc1, 0x6b, 0x6e, 0x6f, 0x69, 0x22, 0x6e,
+  0x6e, 0xc0, 0x27, 0xc4, 0x6f, 0x27, 0x22, 0xc0, 0x1b, 0x27, 0xc1, 0x22, 0x27, 0xc0, 0x22, 0xc0,
+  0x1b, 0x27, 0xc4, 0x2c, 0x27, 0x33, 0x6e, 0x2c, 0x38, 0xc0, 0x2c, 0xa2, 0x88, 0x7a, 0x33, 0x2c,
+  0x33, 0x38, 0x2c, 0x7b, 0x69, 0x66, 0x65, 0x7e, 0x7f, 0x26, 0xa0, 0xa8, 0x7e, 0x26, 0x1b, 0xc0,
+  0xa2, 0x98, 0x35, 0x03, 0x56, 0x36, 0x3b, 0xa3, 0xd8, 0x9f, 0x68, 0x33, 0xa0, 0xa8, 0xc0, 0xa2,
+  0xa7, 0x65, 0x59, 0xa0, 0xa9, 0x46, 0xa2, 0x67, 0x0c, 0xa0, 0xa8, 0x5e, 0x66, 0x0c, 0x69, 0x7a,
+  0x0f, 0xc0, 0x7e, 0x5e, 0x7a, 0xc0, 0xa0, 0xa8, 0x5a, 0x17, 0x65, 0xa1, 0xa8, 0x03, 0x59, 0x9d,
+  0x9a, 0xa5, 0xc6, 0xaa, 0xc7, 0x99, 0x6c, 0xa2, 0x85, 0xc0, 0x46, 0xc0, 0x51, 0x03, 0x9d, 0x69,
+  0xa9, 0xd6, 0x1f, 0x9d, 0x7a, 0xa4, 0xc7, 0x5e, 0xa3, 0x87, 0xa0, 0xa8, 0x56, 0xa1, 0xa9, 0x9e,
+  0x69, 0x45, 0xa1, 0xa8, 0x33, 0x62, 0x37, 0x36, 0xa4, 0xa7, 0xa6, 0xb7, 0x9a, 0x5a, 0x9c, 0x67,
+  0xae, 0xe5, 0xa3, 0xc9, 0xc0, 0xa2, 0x87, 0x9b, 0x8b, 0x91, 0x3e, 0xa1, 0x56, 0xa5, 0xb6, 0xa4,
+  0xa8, 0x99, 0x6a, 0x6e, 0x06, 0x1f, 0x65, 0xa2, 0x98, 0xad, 0xe5, 0x9d, 0x9c, 0x93, 0x2c, 0xa4,
+  0x96, 0xa2, 0x87, 0xa6, 0xa5, 0xa3, 0x99, 0x9b, 0x7b, 0x51, 0xa4, 0xa7, 0xa9, 0xe6, 0x31, 0xc2,
+  0x42, 0x97, 0x6c, 0x9e, 0x57, 0xa2, 0x87, 0xfe, 0x13, 0xf4, 0x6b, 0xa2, 0x77, 0x66, 0x61, 0xc3,
+  0x2d, 0xc0, 0x28, 0x2d, 0xc0, 0x28, 0xc0, 0x65, 0x6e, 0x1c, 0x6b, 0xc2, 0x28, 0xc1, 0x2d, 0x39,
+  0xa2, 0x78, 0x6e, 0x62, 0xc0, 0x3e, 0x39, 0x34, 0x2d, 0x23, 0x1c, 0xc4, 0x28, 0xc3, 0x2d, 0x39,
+  0x2d, 0x28, 0xc0, 0x2d, 0xc0, 0x28, 0x2d, 0xc7, 0x28, 0x2d, 0xc2, 0x28, 0xc0, 0x2d, 0xc5, 0x28,
+  0x21, 0x1c, 0x28, 0xc0, 0x21, 0x1c, 0x21, 0x2d, 0xc0, 0x28, 0x21, 0x1c, 0x23, 0x28, 0xc0, 0x21,
+  0xc0, 0x1c, 0x28, 0xc2, 0x23, 0x28, 0xc2, 0x1c, 0x23, 0x28, 0xc1, 0x23, 0xc0, 0x28, 0x2d, 0xc1,
+  0x6e, 0x2d, 0xc3, 0x32, 0x2d, 0xc1, 0x75, 0xa2, 0x78, 0x32, 0xc0, 0x2d, 0xc0, 0x28, 0xc0, 0x2d,
+  0x39, 0x3e, 0x39, 0xa2, 0x98, 0x5e, 0x0f, 0x0a, 0xc2, 0x05, 0x3e, 0x05, 0xc2, 0x0a, 0xc1, 0x6f,
+  0xc0, 0x6e, 0x6b, 0xc0, 0x6e, 0x6e, 0x27, 0x2c, 0xc0, 0x7b, 0xc0, 0x27, 0xc6, 0x7a, 0x27, 0x2c,
+  0x27, 0xc1, 0x22, 0xc1, 0x27, 0xc2, 0x1b, 0x22, 0x27, 0x22, 0x27, 0xc1, 0x2c, 0xc0, 0x6e, 0x7f,
+  0x76, 0x2c, 0x6b, 0xc2, 0x22, 0x27, 0x79, 0x76, 0xa2, 0x87, 0x66, 0x55, 0xa0, 0xa9, 0xa0, 0x58,
+  0x1b, 0x22, 0x2c, 0x36, 0x3e, 0xa1, 0xa8, 0x5a, 0x31, 0xa1, 0xa9, 0xa3, 0xd8, 0x9f, 0x69, 0x9d,
+  0x69, 0x2c, 0x22, 0x29, 0x27, 0x29, 0x7f, 0x7e, 0x6b, 0xa2, 0x97, 0x59, 0x67, 0x69, 0xc0, 0x7b,
+  0x08, 0x0f, 0x7d, 0x6e, 0x7b, 0x51, 0x08, 0xc0, 0x00, 0xa1, 0xb8, 0x7d, 0x42, 0x5a, 0x46, 0x7a,
+  0xa6, 0xd7, 0xa6, 0x97, 0x66, 0x9c, 0x69, 0x1f, 0x29, 0x45, 0xa4, 0xb7, 0x3c, 0x5a, 0xa6, 0xb8,
+  0xa2, 0x97, 0x77, 0x9e, 0x58, 0xa3, 0x97, 0x3e, 0x7e, 0x36, 0xa1, 0xa8, 0x55, 0x10, 0xa6, 0xa6,
+  0xa1, 0xaa, 0x01, 0x67, 0x59, 0xa8, 0xb5, 0x30, 0x3e, 0x39, 0xaa, 0xa5, 0xa6, 0xb7, 0xa2, 0xb8,
+  0x5e, 0x9d, 0x99, 0x9c, 0x6b, 0x1d, 0x55, 0x3e, 0x41, 0xc0, 0x52, 0xa5, 0xb7, 0xa4, 0xa9, 0x7e,
+  0x12, 0x41, 0x3e, 0x9d, 0x68, 0x36, 0xa8, 0xb5, 0xa7, 0xc8, 0x52, 0x6e, 0xa5, 0xb7, 0x7a, 0xc1,
+  0x9a, 0x6b, 0x9d, 0x68, 0x42, 0x9b, 0x6a, 0x6d, 0xa2, 0x98, 0xfe, 0x14, 0x15, 0x6e, 0x39, 0x65,
+  0x66, 0xc3, 0x2d, 0xc1, 0x28, 0xc5, 0x66, 0x69, 0x23, 0xc0, 0x28, 0x23, 0x28, 0xc0, 0x39, 0xa2,
+  0x78, 0x6e, 0xc0, 0x0a, 0xc0, 0x66, 0x39, 0xc0, 0x66, 0x28, 0x69, 0x23, 0x28, 0x1c, 0x28, 0xc0,
+  0x23, 0x28, 0x2d, 0xc1, 0x39, 0x2d, 0xc5, 0x28, 0x2d, 0xcb, 0x28, 0x2d, 0x7f, 0xc0, 0x2d, 0x28,
+  0xc0, 0x2d, 0xc1, 0x21, 0x28, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0x21, 0xc0, 0x28, 0xc8, 0x23, 0x28,
+  0xc0, 0x23, 0x28, 0xc0, 0x2d, 0x28, 0xc0, 0x1c, 0x23, 0x28, 0x23, 0xc0, 0x28, 0x2d, 0xc2, 0x39,
+  0x2d, 0x39, 0x2d, 0x39, 0x2d, 0xc0, 0x21, 0xc0, 0x7f, 0xa2, 0x77, 0x56, 0xc1, 0x2d, 0xc0, 0x28,
+  0x39, 0xc2, 0x3e, 0x0a, 0xc6, 0x05, 0x0a, 0xc0, 0x05, 0x0f, 0x6b, 0xc0, 0x6e, 0xc0, 0x6b, 0x6e,
+  0xc0, 0x6e, 0x6b, 0x2c, 0xc2, 0x7b, 0x33, 0x27, 0xc3, 0x2c, 0xc4, 0x27, 0xc1, 0x22, 0x1b, 0x27,
+  0x1b, 0xc1, 0x16, 0x1b, 0xc1, 0x6e, 0xc0, 0x1b, 0x27, 0x2c, 0xc0, 0x27, 0x1b, 0x7f, 0x27, 0xc0,
+  0x33, 0xc0, 0x1b, 0x22, 0x7a, 0x6d, 0xa0, 0xb8, 0x56, 0x6e, 0x2c, 0x47, 0x23, 0x27, 0xa2, 0x78,
+  0x7e, 0xc0, 0x36, 0x38, 0xc0, 0xa2, 0xa7, 0xa1, 0xb8, 0x9e, 0x69, 0x27, 0x22, 0x29, 0xa2, 0x98,
+  0xc0, 0x5a, 0x6b, 0xa2, 0x97, 0x7a, 0x55, 0xc0, 0x6b, 0x7d, 0x66, 0x6b, 0x49, 0x0b, 0x17, 0x08,
+  0x66, 0x00, 0x66, 0x79, 0x2c, 0x9f, 0x69, 0x08, 0xa1, 0xa8, 0x08, 0xa1, 0xb9, 0xa6, 0xa6, 0xa4,
+  0x98, 0x98, 0x49, 0x9c, 0x89, 0x08, 0x9b, 0x6a, 0x61, 0xa2, 0x77, 0x7f, 0x7d, 0xa6, 0xd7, 0x9d,
+  0x6b, 0x9f, 0x39, 0xa5, 0xd6, 0xa0, 0xa8, 0xc0, 0x27, 0x7a, 0x56, 0x9c, 0x69, 0x6d, 0xaa, 0xd7,
+  0x9c, 0x7a, 0x58, 0xfe, 0xe7, 0x9d, 0x9c, 0x7b, 0x08, 0x9b, 0x79, 0x7d, 0xa2, 0x89, 0x7e, 0xa4,
+  0x87, 0xa9, 0xc6, 0x7a, 0x7b, 0x9a, 0x5b, 0x99, 0x58, 0xa3, 0xa7, 0x57, 0x36, 0x37, 0xa5, 0xb8,
+  0xa3, 0xb9, 0xa7, 0xb7, 0x9b, 0x9b, 0x91, 0x1c, 0x31, 0xa9, 0xc6, 0x45, 0x9a, 0x6b, 0x69, 0x2f,
+  0xc0, 0xa2, 0xb7, 0xa6, 0x87, 0x25, 0xa4, 0x97, 0xa1, 0xaa, 0x16, 0x4a, 0x9c, 0x7a, 0x69, 0xa4,
+  0xa6, 0x6b, 0x9b, 0x7b, 0xfe, 0x13, 0xf4, 0x6f, 0x66, 0x2d, 0x34, 0xc0, 0x2d, 0x66, 0x34, 0xc0,
+  0x39, 0xc0, 0x28, 0xc1, 0x66, 0x28, 0xc0, 0x2d, 0x28, 0x65, 0x23, 0x28, 0xc0, 0x2d, 0x28, 0xa3,
+  0x88, 0xa2, 0x78, 0x5a, 0xc0, 0x6b, 0x65, 0xc0, 0x66, 0x34, 0xc0, 0x2d, 0x34, 0xc0, 0x23, 0xc1,
+  0x28, 0xc1, 0x2d, 0xc1, 0x28, 0x2d, 0xc5, 0x28, 0x2d, 0xc5, 0x28, 0xc0, 0x2d, 0xc1, 0x28, 0xc0,
+  0x2d, 0xc1, 0x6e, 0xc0, 0x2d, 0xc4, 0x28, 0xc2, 0x2d, 0xc0, 0x65, 0x1c, 0x23, 0x28, 0xc4, 0x2d,
+  0x28, 0x23, 0xc0, 0x28, 0x2d, 0x28, 0x23, 0x28, 0x21, 0x2d, 0x28, 0x1c, 0x23, 0x6f, 0x28, 0x23,
+  0x2d, 0xc1, 0x39, 0xc0, 0x2d, 0x32, 0x39, 0x32, 0xc0, 0x2d, 0x28, 0x1c, 0xc0, 0xa2, 0x88, 0xa2,
+  0x77, 0x32, 0xc2, 0x28, 0x32, 0x39, 0xc2, 0x6e, 0xc1, 0x0a, 0xc3, 0x16, 0x0a, 0xc0, 0x16, 0xc0,
+  0x66, 0x16, 0x6e, 0x6f, 0xc6, 0x6e, 0xc5, 0x27, 0x2c, 0xc3, 0x27, 0xc5, 0x69, 0x1b, 0x16, 0x1b,
+  0xc0, 0x16, 0x0a, 0x1b, 0xc1, 0x20, 0x1b, 0xc0, 0x27, 0xc0, 0x1b, 0x6b, 0x27, 0x20, 0xc0, 0x27,
+  0xc0, 0x1b, 0x22, 0xa1, 0xa8, 0x65, 0x7e, 0x7a, 0x69, 0x77, 0x29, 0x6f, 0x7e, 0x7f, 0xc0, 0x56,
+  0x46, 0x59, 0x04, 0x39, 0x49, 0x27, 0x22, 0xa2, 0xb8, 0xa2, 0x96, 0x3d, 0xc0, 0x0c, 0x7e, 0xc0,
+  0x35, 0xa1, 0xa8, 0xa2, 0xa8, 0x08, 0x7b, 0x1a, 0x41, 0xa2, 0x87, 0xa2, 0xa8, 0x41, 0x52, 0x59,
+  0x52, 0x46, 0x4a, 0xa2, 0xb7, 0xa2, 0x98, 0x08, 0xa4, 0xa8, 0xa1, 0xa8, 0xa4, 0xb7, 0x01, 0x9d,
+  0x78, 0x3c, 0x66, 0x52, 0x49, 0x25, 0xa1, 0x8a, 0x6d, 0xa4, 0xb8, 0xa0, 0x9a, 0x14, 0xa3, 0x98,
+  0xa0, 0xb8, 0x55, 0x08, 0xc0, 0x0b, 0x67, 0x7d, 0xa8, 0xa6, 0xa2, 0xb9, 0x98, 0x4a, 0x1b, 0xa7,
+  0xb7, 0xa3, 0xa8, 0x56, 0xa1, 0xa9, 0x57, 0x9b, 0x6a, 0xa3, 0x86, 0x9c, 0x7a, 0xa9, 0xd5, 0xa7,
+  0xb7, 0x9d, 0x8a, 0x05, 0x55, 0xa2, 0xa7, 0x1e, 0xa1, 0xaa, 0xa0, 0xa9, 0xa9, 0x96, 0xa4, 0xb6,
+  0xc0, 0x99, 0x7c, 0x42, 0x97, 0x3b, 0x7c, 0xa6, 0x96, 0x9c, 0x6a, 0x99, 0x6a, 0xa5, 0xa6, 0x05,
+  0xa7, 0xc7, 0x06, 0x69, 0x02, 0x99, 0x5b, 0x9e, 0x69, 0x69, 0xc0, 0xa2, 0x97, 0xa6, 0xb6, 0x9b,
+  0x5b, 0x29, 0xfe, 0x13, 0xf4, 0xc0, 0x6b, 0x65, 0x2d, 0x6f, 0x2d, 0xc0, 0x34, 0xc0, 0x39, 0xc0,
+  0x2d, 0x28, 0xc5, 0xa2, 0x88, 0x28, 0xc2, 0x39, 0x6f, 0x7e, 0xa2, 0x77, 0x5b, 0x62, 0x69, 0x05,
+  0xc0, 0x66, 0x39, 0xc2, 0x2d, 0x62, 0xc0, 0x28, 0x2d, 0x39, 0xc0, 0x34, 0xc0, 0x2d, 0xc1, 0x28,
+  0xc3, 0x2d, 0xc1, 0x28, 0x2d, 0x28, 0xc2, 0x2d, 0xc1, 0x6e, 0x28, 0xc0, 0x2d, 0x39, 0x2d, 0x28,
+  0x2d, 0xc1, 0x32, 0x2d, 0xc4, 0x32, 0x2d, 0x28, 0x69, 0x28, 0xc2, 0x2d, 0x28, 0xc0, 0x23, 0xc0,
+  0x28, 0xc2, 0x34, 0x66, 0x28, 0xc5, 0x23, 0x2d, 0xc2, 0xa2, 0x78, 0x05, 0x39, 0xc3, 0x2d, 0xc1,
+  0x61, 0x28, 0x32, 0xc1, 0x2d, 0x32, 0x2d, 0x34, 0x0a, 0x3e, 0x39, 0xc1, 0x3e, 0x05, 0xa2, 0x77,
+  0xc0, 0x0a, 0xc2, 0x0f, 0x6b, 0xc3, 0x1b, 0x6f, 0xc0, 0x6e, 0xc0, 0x27, 0xc4, 0x2c, 0xc1, 0x6b,
+  0x2c, 0x27, 0xcd, 0x1b, 0xc0, 0x16, 0x0f, 0x16, 0x1b, 0xc8, 0x6e, 0x1b, 0xc0, 0x27, 0x1b, 0x27,
+  0x20, 0x1b, 0x7a, 0xc0, 0xa1, 0xa8, 0xa0, 0xa8, 0xc0, 0x7a, 0x4a, 0xa2, 0x88, 0xa1, 0xb8, 0x6e,
+  0x42, 0xc0, 0x0e, 0x41, 0x03, 0x46, 0x41, 0x6e, 0xa1, 0xb8, 0x03, 0x00, 0x7b, 0x03, 0xa2, 0x88,
+  0x5a, 0x38, 0x69, 0xa2, 0xa8, 0x17, 0x0b, 0x17, 0x66, 0x03, 0xa2, 0xa7, 0x7a, 0x9e, 0x68, 0x34,
+  0x42, 0x9f, 0x69, 0x0f, 0x37, 0xa5, 0xd7, 0xa3, 0x88, 0xa1, 0x7a, 0x9d, 0x99, 0x9d, 0x58, 0x55,
+  0xa0, 0xa8, 0x3f, 0x5a, 0x37, 0x7a, 0x3c, 0x0b, 0xa2, 0x97, 0x7f, 0xa4, 0x88, 0x9d, 0x88, 0x56,
+  0xa2, 0xa7, 0x9d, 0x8a, 0x55, 0x10, 0xa1, 0xb8, 0x3a, 0x9c, 0x6a, 0xa2, 0xa6, 0xaf, 0xd6, 0x9b,
+  0x9b, 0x98, 0x6a, 0xa4, 0xa7, 0x99, 0x5b, 0x9d, 0x68, 0xa4, 0x85, 0xae, 0xd5, 0xa0, 0x9a, 0x9a,
+  0x6b, 0x9c, 0x58, 0x45, 0x15, 0xa5, 0xa7, 0x9c, 0x79, 0x69, 0x9d, 0x8a, 0x55, 0xb0, 0xe4, 0xa2,
+  0xb9, 0x9f, 0x69, 0x98, 0x6b, 0x69, 0xa2, 0x98, 0x9b, 0x5a, 0xa6, 0xa5, 0x9d, 0x7a, 0xa2, 0x98,
+  0x9b, 0x8a, 0x9a, 0x58, 0xa4, 0x97, 0xaa, 0xd7, 0xa5, 0xa6, 0x9b, 0x8b, 0x9b, 0x5a, 0x3a, 0x9d,
+  0x79, 0xc0, 0x10, 0x9c, 0x69, 0x7e, 0x6e, 0xa2, 0xb8, 0x56, 0x9b, 0x6b, 0xfe, 0x13, 0xd4, 0xc1,
+  0xa2, 0x78, 0x28, 0x7f, 0x59, 0x39, 0xc0, 0x66, 0xc1, 0x2d, 0xc2, 0x28, 0xc2, 0x2d, 0x28, 0xc2,
+  0xa2, 0x79, 0x6e, 0x69, 0xa2, 0x88, 0x5b, 0x65, 0xc1, 0x05, 0xc0, 0x00, 0x39, 0x05, 0x3e, 0x39,
+  0x2d, 0xc5, 0x34, 0xc0, 0x2d, 0xc2, 0x28, 0xc1, 0x2d, 0x34, 0x2d, 0xc0, 0x28, 0xc2, 0x2d, 0x34,
+  0x2d, 0xc0, 0x39, 0x2d, 0xc5, 0x28, 0x2d, 0x39, 0x2d, 0x28, 0x2d, 0xc0, 0x34, 0x39, 0xc0, 0x2d,
+  0xc0, 0x28, 0xcc, 0x34, 0x28, 0xc3, 0x2d, 0x28, 0x66, 0x28, 0x2d, 0x39, 0xc1, 0x3e, 0xc0, 0x39,
+  0xc4, 0x69, 0x28, 0xc0, 0x2d, 0xc1, 0x39, 0x32, 0x39, 0xc3, 0x3e, 0x39, 0xc1, 0x05, 0x12, 0x0a,
+  0xc1, 0x05, 0x0a, 0x16, 0xc2, 0x6f, 0xc1, 0x6e, 0xc0, 0x6e, 0xc0, 0x27, 0x22, 0x27, 0xc5, 0x2c,
+  0x27, 0xc1, 0x22, 0x27, 0x22, 0x27, 0x22, 0xc0, 0x27, 0x22, 0x27, 0xc1, 0x69, 0x27, 0xc0, 0x22,
+  0x69, 0x16, 0x7e, 0xc0, 0x55, 0xc0, 0x0a, 0x16, 0x1b, 0x16, 0x7d, 0x1e, 0xc0, 0x16, 0x1b, 0xc1,
+  0x27, 0xc0, 0x1b, 0x16, 0x20, 0xa1, 0xb9, 0x7a, 0xa0, 0xa7, 0xa0, 0xa8, 0x6f, 0x6e, 0x6e, 0x5a,
+  0x42, 0x42, 0x54, 0xa3, 0xc8, 0x7a, 0x9e, 0x59, 0xc0, 0x66, 0x7b, 0x2c, 0xc0, 0xa2, 0x98, 0x13,
+  0xc0, 0x56, 0x03, 0xc0, 0x0b, 0x0e, 0x56, 0x5e, 0x13, 0x0b, 0x06, 0x3f, 0x42, 0x46, 0x5e, 0xa1,
+  0xa8, 0x59, 0x9f, 0xda, 0xa8, 0xc6, 0xa4, 0x78, 0x56, 0x9c, 0x78, 0x9b, 0x59, 0x1a, 0x2f, 0x0b,
+  0x9d, 0x99, 0x69, 0xa3, 0x98, 0xc0, 0x7f, 0xa2, 0x88, 0x79, 0x52, 0x4f, 0x0e, 0x07, 0x0e, 0x9e,
+  0x68, 0x9d, 0x89, 0x35, 0x56, 0x0e, 0x79, 0x7e, 0xb1, 0xf6, 0xa5, 0xa8, 0xc1, 0x9b, 0x8b, 0x92,
+  0x3c, 0x49, 0xa4, 0xa6, 0xaa, 0xc6, 0x9c, 0x6a, 0x96, 0x3b, 0xa3, 0x86, 0xa1, 0xa9, 0x9d, 0x69,
+  0x75, 0x49, 0xa1, 0xa8, 0xa5, 0xa8, 0xa9, 0xd7, 0x98, 0x5a, 0xa3, 0xa7, 0xa6, 0xb8, 0x9c, 0x9a,
+  0x4a, 0x9b, 0x69, 0xc0, 0xab, 0xc5, 0x97, 0x8c, 0x9d, 0x59, 0xa4, 0xb7, 0x05, 0x9e, 0x69, 0x07,
+  0x9c, 0x79, 0x56, 0x6e, 0x9d, 0x8a, 0x6d, 0x1b, 0xc0, 0x4a, 0x9c, 0x79, 0x66, 0x5e, 0x9d, 0x79,
+  0xfe, 0x13, 0xb4, 0xc0, 0x6e, 0x6e, 0x28, 0xc0, 0x6f, 0x6e, 0x34, 0xc1, 0x39, 0x34, 0x28, 0x2d,
+  0x39, 0x2d, 0x28, 0xc3, 0x23, 0x28, 0x39, 0xa2, 0x78, 0x66, 0x0a, 0x6e, 0x0a, 0x05, 0x0a, 0x05,
+  0xc0, 0x0a, 0x05, 0xc3, 0x39, 0xc2, 0x34, 0xc2, 0x2d, 0xc0, 0x34, 0x2d, 0xc2, 0x34, 0x2d, 0xc1,
+  0x34, 0x2d, 0xc2, 0x28, 0x6b, 0x2d, 0x34, 0x39, 0x6e, 0x39, 0x28, 0x2d, 0xc4, 0x34, 0x2d, 0xc0,
+  0x39, 0xc2, 0x34, 0x2d, 0xc0, 0x28, 0xc5, 0x2d, 0xc0, 0x28, 0xc3, 0x34, 0x28, 0xc1, 0x23, 0xc0,
+  0x2d, 0x28, 0x23, 0x34, 0xc0, 0x2d, 0x39, 0xc2, 0x3e, 0x7b, 0x56, 0x39, 0x34, 0xc0, 0x39, 0x28,
+  0xc0, 0x2d, 0xc1, 0x39, 0xc1, 0x3e, 0xc0, 0x39, 0xc0, 0x3e, 0x39, 0x00, 0x05, 0xc0, 0x0a, 0x05,
+  0xc1, 0x0a, 0x0f, 0x6b, 0xc0, 0x6e, 0xc0, 0x6f, 0xc5, 0x66, 0x27, 0x1b, 0x22, 0x27, 0x22, 0x27,
+  0xc5, 0x22, 0xc4, 0x27, 0xc1, 0x22, 0x1b, 0x27, 0x1b, 0xc0, 0x27, 0x1b, 0x0f, 0xc0, 0x0a, 0x3e,
+  0xc0, 0x0f, 0x16, 0xc0, 0x0a, 0xa2, 0x87, 0x6f, 0xc0, 0x1b, 0xc4, 0x16, 0x1b, 0xc0, 0xa2, 0xb8,
+  0xa1, 0xa8, 0x61, 0xa3, 0x98, 0x5a, 0x03, 0x0b, 0x03, 0x52, 0x59, 0x46, 0xa1, 0xb8, 0xa0, 0xa8,
+  0x2f, 0x2c, 0xc0, 0x66, 0x2c, 0x2f, 0x7e, 0x0b, 0xc0, 0x66, 0xc0, 0x0e, 0x6b, 0x03, 0xa2, 0x87,
+  0x7a, 0x0e, 0x69, 0x52, 0x2f, 0x42, 0x45, 0xa3, 0xb7, 0xa8, 0xd6, 0xa3, 0xa9, 0x5b, 0x4e, 0x9c,
+  0x89, 0x99, 0x59, 0xc0, 0x0b, 0x5a, 0xa6, 0xb6, 0x9f, 0xab, 0x9b, 0x58, 0xa1, 0xa8, 0xa2, 0x87,
+  0x16, 0x7f, 0xa4, 0x96, 0x56, 0x16, 0x41, 0x66, 0x7f, 0x37, 0xa3, 0x97, 0xab, 0xd7, 0xa0, 0xa8,
+  0x96, 0x3a, 0x09, 0xc0, 0xac, 0xc4, 0xa6, 0xb8, 0xa5, 0xa8, 0x4a, 0x65, 0xa2, 0xa8, 0x9a, 0x7b,
+  0x59, 0x9c, 0x69, 0x9c, 0x6a, 0x59, 0x5a, 0x55, 0xa4, 0x97, 0x9a, 0x7a, 0x9d, 0x78, 0xa9, 0xd6,
+  0x9c, 0x6b, 0x50, 0xa4, 0x88, 0xa2, 0xa7, 0xab, 0xe6, 0xc0, 0x5a, 0x56, 0x52, 0x31, 0x56, 0x98,
+  0x7a, 0xa4, 0x77, 0x9e, 0x69, 0x9d, 0x78, 0x9d, 0x69, 0x22, 0xa4, 0xa8, 0x41, 0xa3, 0x98, 0x9b,
+  0x6a, 0x7a, 0x46, 0x69, 0xc0, 0x56, 0x9d, 0x79, 0x46, 0xa1, 0xb8, 0xfe, 0x13, 0xb3, 0xc0, 0x6b,
+  0xc0, 0x6e, 0xc0, 0xa2, 0x77, 0x28, 0x6e, 0xc0, 0x6f, 0xc0, 0x66, 0xc1, 0x2d, 0xc2, 0x28, 0xc2,
+  0x34, 0xa2, 0x77, 0x6f, 0x66, 0x0a, 0x6f, 0x05, 0x39, 0x05, 0xc5, 0x0a, 0xc0, 0x05, 0x39, 0xc0,
+  0x6b, 0x3e, 0x39, 0xc1, 0x3e, 0x39, 0x34, 0x39, 0x2d, 0xc0, 0x34, 0x39, 0x2d, 0xc0, 0x7f, 0x2d,
+  0x34, 0x2d, 0x34, 0x39, 0x34, 0x28, 0x34, 0x39, 0x34, 0x2d, 0x39, 0x2d, 0xc1, 0x34, 0xc0, 0x2d,
+  0x34, 0x39, 0xc7, 0x2d, 0xc1, 0x28, 0xc0, 0x2d, 0xc1, 0x39, 0x2d, 0x28, 0x2d, 0x28, 0xc0, 0x34,
+  0xc0, 0x28, 0xc0, 0x2d, 0x28, 0xc0, 0x2d, 0x28, 0xc0, 0x39, 0xc5, 0x0a, 0x05, 0x39, 0x05, 0x39,
+  0x34, 0x2d, 0xc4, 0x39, 0xc6, 0x05, 0xc6, 0x0a, 0x16, 0xc1, 0x6e, 0x6b, 0x6e, 0xc4, 0x22, 0x27,
+  0x22, 0x1b, 0x27, 0xc0, 0x22, 0xc1, 0x27, 0xc0, 0x22, 0x27, 0xc0, 0x1b, 0x22, 0x1b, 0x27, 0xc3,
+  0x1b, 0x16, 0xc3, 0x69, 0xc0, 0x65, 0x0a, 0xc0, 0x05, 0x0a, 0x16, 0xc0, 0x1b, 0xc0, 0x16, 0x1b,
+  0x6e, 0xc0, 0x0f, 0x7a, 0x6f, 0x1b, 0xc0, 0x16, 0xc0, 0xa1, 0xa8, 0xa2, 0xa8, 0x6e, 0x76, 0xa2,
+  0x87, 0x66, 0x55, 0x6f, 0xc0, 0x51, 0x5a, 0x2f, 0x7a, 0xc0, 0x69, 0x32, 0x5e, 0x65, 0xa1, 0xb9,
+  0xa2, 0x97, 0x46, 0x37, 0x06, 0x0b, 0xc0, 0x7f, 0x9d, 0x99, 0x37, 0xa3, 0xa8, 0x61, 0x9f, 0x68,
+  0x7b, 0x41, 0x2b, 0x16, 0xa2, 0xa8, 0xa3, 0xa7, 0xa6, 0x87, 0x7f, 0x98, 0x6a, 0x16, 0x03, 0x2c,
+  0xa3, 0xa9, 0xa2, 0xa7, 0x45, 0x16, 0xa2, 0xa7, 0xa3, 0x98, 0x6f, 0x41, 0x46, 0x7a, 0x7a, 0x9e,
+  0x68, 0x51, 0x6b, 0x0b, 0x0e, 0x45, 0xa6, 0xb6, 0xae, 0xd6, 0x94, 0x5b, 0xa2, 0x77, 0xa3, 0xa9,
+  0x9d, 0x89, 0xad, 0xf6, 0x5a, 0x95, 0x4c, 0x9a, 0x58, 0x11, 0xa7, 0xc7, 0xa3, 0x99, 0x9d, 0x7a,
+  0x7e, 0xa3, 0xa7, 0x96, 0x5c, 0x9d, 0x58, 0xa5, 0xa7, 0x52, 0x69, 0x28, 0x06, 0x44, 0xa8, 0xb7,
+  0x93, 0x6d, 0xa5, 0x95, 0xab, 0xa6, 0x9b, 0x8b, 0x65, 0x9c, 0x69, 0x56, 0xa7, 0xb6, 0x31, 0xc0,
+  0x41, 0x42, 0x1a, 0x59, 0xa3, 0xb9, 0x7e, 0x9d, 0x7a, 0x6e, 0x9d, 0x8a, 0x41, 0x9c, 0x29, 0xa0,
+  0xa8, 0x65, 0xa5, 0xb8, 0xa2, 0xa7, 0x9d, 0x69, 0x9f, 0xbb, 0xfe, 0x13, 0x93, 0x6e, 0xc2, 0x6b,
+  0x6e, 0xc2, 0x6e, 0x6b, 0xc1, 0x2d, 0xc1, 0x34, 0xc0, 0x2d, 0xc1, 0x34, 0x6e, 0x6f, 0xc1, 0x6e,
+  0x6f, 0x9d, 0xa9, 0x39, 0x05, 0xca, 0x39, 0xc1, 0x6e, 0x05, 0xc0, 0x39, 0xc0, 0x34, 0xc0, 0x39,
+  0xc0, 0x34, 0xc1, 0x7e, 0x2d, 0x34, 0x2d, 0x34, 0xc0, 0x39, 0x2d, 0xc0, 0x39, 0x34, 0xc1, 0x39,
+  0xc0, 0x34, 0xc2, 0x39, 0xc0, 0x05, 0xc0, 0x3e, 0xc0, 0x39, 0x3e, 0xc1, 0x39, 0x3e, 0x39, 0x2d,
+  0x34, 0x39, 0xc0, 0x34, 0x39, 0x34, 0x28, 0x34, 0xc3, 0x66, 0x2d, 0x34, 0xc0, 0x2f, 0x34, 0xc1,
+  0x39, 0x3e, 0xc0, 0x39, 0xc1, 0x0a, 0xc0, 0x3e, 0x39, 0x3e, 0x39, 0xc0, 0x34, 0x2d, 0xc1, 0x39,
+  0xc5, 0x00, 0x3e, 0xc0, 0x0a, 0x05, 0xc5, 0x0a, 0x6b, 0x16, 0xc0, 0x6f, 0xc1, 0x6e, 0xc3, 0x22,
+  0xc0, 0x69, 0xc0, 0x27, 0x22, 0xc1, 0x27, 0xc1, 0x22, 0x1b, 0xc0, 0x22, 0x27, 0xc5, 0x16, 0xc1,
+  0x0a, 0xc7, 0x11, 0x22, 0x1b, 0x65, 0x7f, 0xc0, 0x59, 0xc0, 0x16, 0x0a, 0xc0, 0x0f, 0x1b, 0xc0,
+  0x0f, 0x1e, 0xa2, 0xa7, 0xa2, 0x98, 0x52, 0xc0, 0x69, 0xa1, 0xb9, 0x56, 0x5e, 0x65, 0x46, 0x7a,
+  0x7a, 0xc1, 0x69, 0x5a, 0x56, 0x76, 0xa4, 0xa7, 0xc0, 0x46, 0xc0, 0x6f, 0x37, 0x03, 0x66, 0x2f,
+  0xc0, 0x2b, 0x7e, 0x7a, 0xa2, 0x99, 0xa3, 0x88, 0xa5, 0xa6, 0xa7, 0xb7, 0x9d, 0x9a, 0x9d, 0x69,
+  0x9a, 0x5a, 0x41, 0x61, 0x45, 0x08, 0xa1, 0xb8, 0x56, 0x6d, 0xa2, 0xa8, 0x7f, 0x5e, 0x7f, 0x35,
+  0x65, 0x56, 0x0c, 0x56, 0x02, 0x69, 0x0e, 0xa2, 0x87, 0x16, 0x13, 0x0c, 0xa3, 0xa8, 0xa1, 0xaa,
+  0xa4, 0xa6, 0xa3, 0x88, 0xa5, 0x98, 0xa5, 0xc8, 0x9b, 0x7a, 0x95, 0x5c, 0xa3, 0x86, 0xa8, 0xd7,
+  0xa4, 0x97, 0x52, 0xa4, 0x96, 0x56, 0xc0, 0x97, 0x7c, 0x6b, 0x9c, 0x69, 0x9c, 0x37, 0xa7, 0xc6,
+  0x6b, 0x98, 0x2a, 0xa4, 0xc5, 0xa7, 0xc8, 0x9e, 0x69, 0x9a, 0x5a, 0x55, 0xa6, 0xa5, 0x43, 0x52,
+  0x69, 0xc0, 0x9b, 0x6a, 0x65, 0xa5, 0x97, 0x6f, 0x9d, 0x9a, 0xa5, 0xc7, 0xa2, 0x87, 0x42, 0x9e,
+  0x68, 0xa2, 0xa7, 0x21, 0x9c, 0x59, 0xc0, 0xa2, 0x97, 0xa2, 0x98, 0xa1, 0xc8, 0xa2, 0x77, 0x9c,
+  0x69, 0x9d, 0x8b, 0xfe, 0x13, 0xb3, 0xc0, 0x66, 0x1c, 0xc2, 0x6f, 0xc4, 0x6e, 0xc1, 0x6f, 0x66,
+  0xc0, 0x2d, 0x34, 0xc0, 0x39, 0xa2, 0x78, 0x66, 0xc0, 0x0a, 0xc1, 0x62, 0x39, 0x05, 0xc0, 0x00,
+  0x05, 0xc5, 0x0a, 0xc0, 0x00, 0x39, 0xc0, 0x05, 0xc0, 0x39, 0x05, 0x39, 0x34, 0xc0, 0x39, 0xc0,
+  0x2d, 0x34, 0x39, 0x2d, 0xc0, 0x34, 0xc2, 0x2d, 0x39, 0xcd, 0x05, 0xc5, 0x39, 0x6e, 0xc0, 0x39,
+  0xc1, 0x05, 0x39, 0xc0, 0x00, 0x34, 0xc0, 0x00, 0xc3, 0x34, 0x39, 0xc0, 0x34, 0xc0, 0x39, 0xc0,
+  0x3e, 0x05, 0xc0, 0x39, 0xc0, 0x05, 0x0a, 0xc0, 0x3e, 0x05, 0x3e, 0x39, 0xc1, 0x2d, 0x28, 0x2d,
+  0x39, 0xc1, 0x3e, 0xc0, 0x39, 0xc0, 0x05, 0xc1, 0x3e, 0x05, 0xc0, 0x00, 0xc0, 0x05, 0x0a, 0xc0,
+  0x6f, 0xc1, 0x6e, 0xc0, 0x6f, 0x66, 0xc1, 0x1b, 0xc0, 0x27, 0x1b, 0xc0, 0x22, 0xc0, 0x1b, 0x27,
+  0xc3, 0x1b, 0x16, 0xc1, 0x1b, 0x22, 0x27, 0xc3, 0x22, 0x16, 0xc0, 0x69, 0x65, 0xc0, 0x0a, 0x05,
+  0x0a, 0xc1, 0x0f, 0x16, 0x1b, 0x7a, 0x1b, 0xc0, 0xa0, 0xa8, 0x55, 0x0a, 0xc1, 0x05, 0x0a, 0x0f,
+  0xc1, 0x1e, 0xc0, 0xa2, 0x87, 0xa1, 0xa9, 0x75, 0x7b, 0x34, 0xa0, 0xa8, 0x66, 0x5a, 0x5a, 0xc1,
+  0xa1, 0xa9, 0x3a, 0xc0, 0x59, 0x52, 0x56, 0x2f, 0xa2, 0xa8, 0x40, 0x32, 0xa2, 0x97, 0x09, 0x45,
+  0xc0, 0x23, 0x7a, 0xa2, 0x87, 0xa3, 0xa9, 0xa3, 0xa8, 0xa3, 0x97, 0xa3, 0xb8, 0xa3, 0x98, 0x44,
+  0x9b, 0x8a, 0x6b, 0x9c, 0x4a, 0x9a, 0x69, 0x5a, 0x34, 0xa2, 0xa7, 0x19, 0x56, 0x37, 0x02, 0x19,
+  0xa2, 0x87, 0x6f, 0x51, 0x69, 0x66, 0x5b, 0x56, 0x6e, 0x16, 0x5b, 0x16, 0x26, 0x19, 0x0e, 0xc0,
+  0xa8, 0x95, 0xa3, 0xc9, 0x97, 0x7b, 0xa3, 0x87, 0xa2, 0x78, 0xa5, 0xb7, 0xa2, 0x98, 0xa7, 0xa7,
+  0xa2, 0xb8, 0xc0, 0x66, 0x31, 0xc3, 0x9d, 0x7a, 0x94, 0x3d, 0x48, 0x41, 0x59, 0xa2, 0x99, 0x5a,
+  0xa2, 0xc6, 0xa5, 0xb8, 0x97, 0x2c, 0xa1, 0xa7, 0xc0, 0x1e, 0x54, 0x12, 0x0a, 0x9d, 0x79, 0x7e,
+  0x12, 0x6e, 0x42, 0xa1, 0xa7, 0xa2, 0x88, 0x12, 0x52, 0x55, 0xa3, 0x77, 0xa1, 0xa8, 0x63, 0xa2,
+  0x87, 0x46, 0x52, 0x00, 0x57, 0x55, 0xfe, 0x13, 0xb3, 0x66, 0xc1, 0x1c, 0xc0, 0x17, 0x1c, 0x6f,
+  0xc3, 0x6e, 0x6b, 0x2d, 0xc1, 0x34, 0xc2, 0xa2, 0x77, 0x6f, 0xc1, 0x6f, 0xc0, 0x61, 0x66, 0xc0,
+  0x69, 0xc0, 0x00, 0xc0, 0x0a, 0xc1, 0x16, 0x0a, 0xc2, 0x05, 0xc0, 0x39, 0xc0, 0x3e, 0x05, 0x39,
+  0xc2, 0x34, 0x2d, 0xc1, 0x39, 0x2d, 0x34, 0xc3, 0x39, 0xc5, 0x34, 0xc0, 0x39, 0x3e, 0xc0, 0x39,
+  0xc0, 0x3e, 0x39, 0x05, 0xc5, 0x00, 0x05, 0xc0, 0x39, 0x05, 0xc1, 0x00, 0x39, 0x00, 0xc4, 0x05,
+  0xc0, 0x00, 0xc0, 0x05, 0x39, 0x34, 0x00, 0x05, 0xc0, 0x00, 0x05, 0xc0, 0x00, 0x05, 0x0a, 0xc0,
+  0x00, 0x05, 0xc0, 0x3e, 0x39, 0xc0, 0x34, 0x2d, 0xc0, 0x6e, 0x39, 0xc0, 0x3e, 0x0a, 0x39, 0xc1,
+  0x05, 0xc3, 0x00, 0x05, 0x0a, 0x6e, 0xc0, 0x16, 0xc1, 0x6e, 0xcb, 0x6f, 0xc4, 0x1b, 0x16, 0xc2,
+  0x6f, 0x1b, 0x27, 0xc1, 0x22, 0x16, 0xc0, 0x0a, 0x69, 0x0f, 0x0a, 0xc0, 0x16, 0xc1, 0x0f, 0x16,
+  0x1b, 0x69, 0xa0, 0xa9, 0x69, 0x0a, 0x03, 0x3e, 0x0a, 0x05, 0x03, 0xc0, 0x0f, 0x1b, 0x0f, 0x7b,
+  0xa2, 0x88, 0x27, 0xc0, 0xa0, 0xb8, 0xa2, 0xa7, 0x69, 0x76, 0xc0, 0x5a, 0x69, 0x37, 0xc1, 0x7b,
+  0x79, 0x7a, 0x5e, 0x42, 0xc0, 0xa2, 0x87, 0x37, 0x65, 0x3a, 0x3d, 0xc0, 0x32, 0x45, 0x76, 0xa6,
+  0xb6, 0xa7, 0xa7, 0xa3, 0xb8, 0x7e, 0xa2, 0x78, 0x51, 0x9b, 0x89, 0x9b, 0x7a, 0x42, 0x6e, 0xa4,
+  0x78, 0xa5, 0xa8, 0x97, 0x6b, 0x55, 0xa4, 0x97, 0x9c, 0x78, 0x02, 0xc0, 0x7e, 0xa3, 0x98, 0xa3,
+  0x99, 0xc0, 0x9c, 0x88, 0x49, 0x66, 0x7f, 0x56, 0x1e, 0x26, 0x5b, 0x69, 0xa2, 0xa8, 0x32, 0x16,
+  0x1e, 0xa3, 0x87, 0x3d, 0x56, 0x6f, 0x32, 0x09, 0xab, 0xd7, 0xa6, 0xb6, 0xc0, 0x5a, 0x9d, 0x9a,
+  0x5a, 0x41, 0x6f, 0xa3, 0xb7, 0x56, 0x98, 0x4b, 0x9d, 0x68, 0xa2, 0x87, 0x9c, 0x7a, 0x31, 0x66,
+  0x69, 0x21, 0x64, 0x3e, 0xa2, 0xc9, 0x95, 0x1b, 0xa2, 0x96, 0xa2, 0x99, 0x41, 0x41, 0x3b, 0xc0,
+  0x66, 0xa2, 0x87, 0x53, 0x49, 0xa7, 0xd7, 0x21, 0x41, 0x42, 0xc0, 0xa5, 0xb6, 0x66, 0x0a, 0x9d,
+  0x59, 0x76, 0x2b, 0x25, 0x23, 0xfe, 0x13, 0xb3, 0x66, 0x1c, 0x17, 0xc1, 0x1c, 0xc0, 0x6f, 0xc5,
+  0x66, 0x28, 0xc0, 0x6f, 0x69, 0xc0, 0x6f, 0x6e, 0x6b, 0xc1, 0x6e, 0x05, 0x66, 0x39, 0x00, 0x39,
+  0x3e, 0x05, 0xc0, 0x0a, 0x6b, 0x6e, 0xc0, 0x0a, 0xc1, 0x05, 0xc3, 0x3e, 0xc0, 0x39, 0xc2, 0x34,
+  0xc1, 0x2d, 0xc1, 0x34, 0xc4, 0x39, 0x34, 0xc0, 0x39, 0xc4, 0x05, 0x0a, 0x3e, 0xc0, 0x05, 0xc1,
+  0x0a, 0x05, 0xc7, 0x0a, 0xc0, 0x05, 0xc0, 0x39, 0x00, 0xc3, 0x05, 0xc1, 0x00, 0xc4, 0x05, 0xc1,
+  0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0x05, 0x00, 0x05, 0xc0, 0x3e, 0x39, 0xc3, 0x34, 0x39, 0x3e, 0x0a,
+  0x7a, 0x39, 0x05, 0xc0, 0x39, 0x05, 0xc4, 0x0a, 0x16, 0xc1, 0x6e, 0xc4, 0x16, 0xc0, 0x1b, 0xc4,
+  0x6f, 0xc5, 0x1b, 0x16, 0xc0, 0x1b, 0xc2, 0x27, 0xc1, 0x1b, 0x16, 0x0a, 0xc0, 0x6e, 0xc0, 0x16,
+  0xc0, 0x1b, 0x16, 0xc0, 0x0f, 0x1b, 0x0f, 0x0a, 0x0f, 0x0a, 0x69, 0xc1, 0x3e, 0x05, 0x0a, 0x16,
+  0xc1, 0x1b, 0x7e, 0xc0, 0x5a, 0xc0, 0xa1, 0xb9, 0xa1, 0xb8, 0x69, 0x66, 0x7a, 0xc0, 0x55, 0x56,
+  0x3a, 0xa2, 0x77, 0x37, 0x3a, 0x7e, 0x3a, 0x37, 0x2b, 0xc0, 0x5a, 0x67, 0xa1, 0xb8, 0x3a, 0x23,
+  0x65, 0xa5, 0xa7, 0xa9, 0xc7, 0xa2, 0xb8, 0x9d, 0x69, 0x9b, 0x7a, 0x65, 0x7e, 0x6f, 0xc0, 0x20,
+  0x51, 0x9f, 0x59, 0x6f, 0xa7, 0xd7, 0x9d, 0x6a, 0x51, 0xa3, 0x98, 0x42, 0x51, 0xa2, 0x87, 0xa2,
+  0x99, 0x6e, 0x55, 0x26, 0x21, 0x2d, 0x55, 0x55, 0x1e, 0x35, 0xa4, 0x87, 0x3d, 0x35, 0xa3, 0x98,
+  0x9e, 0x69, 0x51, 0x26, 0x6f, 0x2d, 0x3e, 0xc0, 0xa4, 0xa7, 0xac, 0xd6, 0xa2, 0xa7, 0xc1, 0x56,
+  0x9d, 0x7a, 0x9c, 0x58, 0x67, 0x55, 0x5a, 0x46, 0x9d, 0x78, 0x66, 0xa2, 0xa8, 0xa2, 0x77, 0x7a,
+  0x51, 0xa2, 0xa8, 0x9a, 0x3b, 0x54, 0xfe, 0xdf, 0x9d, 0x97, 0x7d, 0x95, 0x1c, 0xa6, 0xa5, 0xc0,
+  0x3b, 0x9d, 0x89, 0xa5, 0x97, 0x9d, 0x8b, 0x41, 0xa6, 0xb5, 0x67, 0x0a, 0x01, 0x9d, 0x7a, 0x1a,
+  0xa6, 0xb7, 0x9d, 0x69, 0x01, 0x7b, 0x9d, 0x68, 0x6f, 0x52, 0x9c, 0x79, 0xa5, 0x96, 0xa2, 0x99,
+  0xfe, 0x13, 0x93, 0x6e, 0xc1, 0x17, 0xc0, 0x1c, 0xc0, 0x6b, 0xc5, 0x6e, 0xc0, 0x23, 0x28, 0xc0,
+  0xa2, 0x77, 0x6b, 0xc0, 0x6e, 0x6e, 0xa2, 0x78, 0x62, 0x39, 0x66, 0x39, 0xc2, 0x6f, 0xc1, 0x0a,
+  0x6f, 0xc0, 0x0a, 0xc0, 0x05, 0x0a, 0x05, 0xc0, 0x0a, 0xc0, 0x05, 0xc0, 0x39, 0xc0, 0x3e, 0x39,
+  0x34, 0x39, 0x34, 0xc3, 0x69, 0xc0, 0x34, 0x2d, 0x34, 0xc3, 0x39, 0xc1, 0x05, 0xc5, 0x66, 0x0a,
+  0x16, 0x0a, 0xc1, 0x05, 0xc0, 0x0a, 0x05, 0xc2, 0x0a, 0xc0, 0x05, 0x00, 0xc2, 0x05, 0x00, 0x05,
+  0xc4, 0x00, 0xc0, 0x05, 0xc1, 0x0a, 0x16, 0xc0, 0x05, 0xc2, 0x00, 0x05, 0x0a, 0x05, 0x39, 0xc0,
+  0x3e, 0xc0, 0x34, 0x3e, 0x03, 0x3e, 0xc0, 0x0a, 0x05, 0xc1, 0x3e, 0x05, 0x00, 0x0a, 0x6e, 0x05,
+  0x0f, 0xc0, 0x16, 0x6e, 0x16, 0x1b, 0xc4, 0x16, 0x0f, 0x16, 0xc1, 0x1b, 0xc1, 0x6b, 0x7e, 0x22,
+  0x6e, 0xc0, 0x6e, 0x27, 0x1b, 0x16, 0xc0, 0x1b, 0xc1, 0x16, 0x2a, 0x69, 0x22, 0x16, 0x0f, 0xc1,
+  0x16, 0xc0, 0x1b, 0x7a, 0xc0, 0x1b, 0x0a, 0xc1, 0x03, 0x05, 0x0a, 0x7e, 0x66, 0x0a, 0xc0, 0x05,
+  0x0f, 0x1b, 0x0f, 0x16, 0x1b, 0x1e, 0x1b, 0x23, 0x7a, 0x23, 0xa0, 0xb8, 0xa1, 0xa9, 0x69, 0xc0,
+  0x7a, 0x7a, 0x46, 0x65, 0xa3, 0x88, 0x3a, 0x55, 0xc0, 0xa1, 0xb8, 0x5e, 0x52, 0x55, 0xc0, 0x5b,
+  0x7b, 0x58, 0x66, 0xa5, 0xb8, 0xa7, 0xb7, 0xa4, 0xa7, 0x9c, 0x58, 0x9a, 0x7a, 0x79, 0x5a, 0xa1,
+  0xa9, 0x15, 0x7a, 0xa4, 0xa6, 0x51, 0x9b, 0x4a, 0x2b, 0xa6, 0xa7, 0x7b, 0x41, 0x6d, 0xa4, 0x97,
+  0x9d, 0x9a, 0x26, 0xa2, 0x88, 0x7f, 0x65, 0x9d, 0x89, 0x19, 0x26, 0x7e, 0x42, 0x46, 0x1e, 0xa2,
+  0x98, 0x3a, 0xa2, 0x88, 0x75, 0x47, 0x26, 0x35, 0x3a, 0xa3, 0xa8, 0xa1, 0xa9, 0xa5, 0x98, 0x9d,
+  0x9a, 0xa5, 0x96, 0xa7, 0xc7, 0x9d, 0x7a, 0x56, 0x55, 0x6e, 0x62, 0x9c, 0x69, 0x2b, 0xa6, 0xa7,
+  0x9a, 0x7b, 0x97, 0x3b, 0x9e, 0x56, 0xa0, 0xa8, 0xa3, 0x98, 0x77, 0x9b, 0x48, 0xa1, 0xa8, 0xa5,
+  0xb7, 0x1a, 0x9c, 0x78, 0xa9, 0xc6, 0xa4, 0xb9, 0x94, 0x3c, 0x9d, 0x38, 0x38, 0x7e, 0x9d, 0x8a,
+  0xa4, 0x95, 0xa1, 0xab, 0x9d, 0x7a, 0x59, 0xa5, 0xd7, 0x9f, 0x69, 0x9d, 0x89, 0x7e, 0x1a, 0xa4,
+  0xa7, 0x56, 0x7f, 0xa1, 0xa8, 0x08, 0xa2, 0x97, 0x39, 0x56, 0x01, 0xa4, 0xa7, 0xfe, 0x13, 0x93,
+  0xc0, 0x6e, 0xc3, 0x6b, 0x1c, 0xc4, 0x23, 0x6e, 0xc1, 0x23, 0xc0, 0xa3, 0x78, 0xc1, 0x6e, 0xc0,
+  0xa2, 0x78, 0x62, 0x39, 0x28, 0x6f, 0x39, 0xc0, 0x65, 0x39, 0x6b, 0x05, 0xc0, 0x6e, 0x6f, 0xc0,
+  0x05, 0xc0, 0x0a, 0x05, 0xc2, 0x0a, 0xc0, 0x05, 0x39, 0xc3, 0x2d, 0x34, 0xc1, 0x2d, 0xc1, 0x34,
+  0x39, 0x34, 0xc1, 0x2d, 0x67, 0x34, 0x39, 0xc0, 0x00, 0x05, 0xc0, 0x39, 0x05, 0x0a, 0x05, 0x00,
+  0x0a, 0x16, 0x0f, 0x0a, 0xc0, 0x05, 0x0a, 0x05, 0xc0, 0x0a, 0xc1, 0x05, 0x0a, 0xc0, 0x05, 0xc6,
+  0x6f, 0x05, 0xc0, 0x0a, 0x05, 0xc2, 0x0a, 0x16, 0xc2, 0x0a, 0xc0, 0x05, 0x00, 0x05, 0xc0, 0x39,
+  0xc1, 0x3e, 0xc0, 0x7f, 0xc0, 0x0a, 0x05, 0xc0, 0x0f, 0x0a, 0x05, 0xc0, 0x0a, 0x05, 0xc0, 0x0a,
+  0xc3, 0x16, 0xc0, 0x0f, 0xc0, 0x6f, 0xc0, 0x16, 0xc1, 0x0f, 0xc2, 0x16, 0xc0, 0x1b, 0xc4, 0xa2,
+  0x78, 0xc0, 0x66, 0x16, 0x0f, 0xc0, 0x1b, 0x16, 0xc0, 0x1b, 0xc1, 0x16, 0x6d, 0x16, 0xc0, 0x14,
+  0x16, 0x1b, 0x7e, 0x0f, 0x7e, 0x7a, 0x39, 0xc0, 0xa2, 0x77, 0x05, 0x03, 0x3e, 0x0a, 0x0f, 0xc0,
+  0x0a, 0x16, 0x1b, 0xc0, 0x9e, 0xb7, 0x5f, 0x16, 0xc0, 0x17, 0x7e, 0x6b, 0x7b, 0xa1, 0xa7, 0x7a,
+  0xc0, 0x7e, 0x66, 0x7a, 0xc0, 0x59, 0x56, 0xc0, 0xa1, 0xb8, 0x5a, 0xc0, 0x59, 0x9d, 0x9a, 0xa2,
+  0x87, 0x36, 0x56, 0xc0, 0xa4, 0x98, 0xa4, 0xa6, 0xa6, 0xc7, 0x5e, 0x97, 0x7a, 0x9c, 0x69, 0xa1,
+  0xa9, 0xa2, 0x76, 0xa2, 0x88, 0x9d, 0x7a, 0x9c, 0x68, 0x01, 0x6e, 0x33, 0x42, 0x2b, 0xac, 0xc6,
+  0x99, 0x7b, 0x33, 0xa4, 0xa7, 0x6f, 0x66, 0x26, 0x21, 0x26, 0x61, 0x19, 0xa2, 0x77, 0x66, 0x7d,
+  0x26, 0x42, 0xa2, 0x86, 0xa8, 0xa7, 0x73, 0x42, 0x44, 0x52, 0xa4, 0x97, 0xa3, 0xa9, 0xa2, 0x98,
+  0xa2, 0x98, 0xa6, 0x96, 0xa2, 0xa7, 0x9b, 0x8b, 0xa3, 0x87, 0x56, 0x98, 0x5b, 0xa2, 0x75, 0xc0,
+  0x42, 0xa4, 0xb8, 0x9d, 0x7a, 0x5d, 0x32, 0x9a, 0x59, 0x9b, 0x6a, 0x55, 0x7e, 0x4a, 0x52, 0x41,
+  0xa3, 0xa7, 0xa3, 0xa9, 0x9d, 0x79, 0xa2, 0x98, 0x6e, 0x6f, 0xa1, 0xa8, 0xc0, 0x9a, 0x8c, 0x44,
+  0xa2, 0x66, 0xa2, 0xa8, 0xa3, 0xb7, 0xa4, 0xb7, 0x9c, 0x5b, 0x0f, 0xa1, 0xa8, 0x9d, 0x79, 0xa2,
+  0xa8, 0x1a, 0x22, 0x7e, 0xa3, 0x99, 0x9b, 0x8a, 0x1a, 0x7f, 0x7a, 0x15, 0xa2, 0x77, 0x0f, 0xfe,
+  0x13, 0xb4, 0x6e, 0xc0, 0x23, 0xc2, 0x28, 0x61, 0x6e, 0xc4, 0x23, 0xc0, 0x28, 0x6e, 0xc0, 0x6f,
+  0xc2, 0x6e, 0x6f, 0x9d, 0xa9, 0xc0, 0x7a, 0x5d, 0x2d, 0x39, 0xc2, 0x6f, 0xc1, 0x0a, 0x6b, 0x6e,
+  0x11, 0x05, 0x0a, 0x05, 0xc0, 0x0a, 0xc2, 0x05, 0x39, 0xc0, 0x3e, 0x39, 0x2d, 0xc2, 0x28, 0x2d,
+  0x39, 0xc1, 0x34, 0xc4, 0x39, 0xc0, 0x6b, 0x39, 0x05, 0xc1, 0x0a, 0xc0, 0x05, 0x0a, 0xc4, 0x05,
+  0xc0, 0x0a, 0x05, 0x0a, 0x16, 0x0a, 0x05, 0xc0, 0x11, 0x05, 0xc0, 0x6b, 0x05, 0xc0, 0x0a, 0x0c,
+  0x11, 0xc2, 0x05, 0x3e, 0x05, 0x0a, 0x16, 0xc0, 0x0a, 0xc0, 0x16, 0x6e, 0x16, 0x05, 0x00, 0x0a,
+  0x05, 0x39, 0xc0, 0x3e, 0x05, 0x0a, 0xa2, 0x87, 0x66, 0x0a, 0x05, 0xc0, 0x0a, 0xc0, 0x05, 0x0a,
+  0xc2, 0x6e, 0x0a, 0x05, 0xc0, 0x0a, 0x16, 0x0f, 0x0a, 0xa2, 0x88, 0x16, 0x0f, 0x0a, 0x0f, 0xc4,
+  0x16, 0xc0, 0x0f, 0x1b, 0xc1, 0x16, 0x1b, 0x6e, 0x6b, 0x1b, 0x0f, 0xc3, 0x16, 0x1b, 0x16, 0x1b,
+  0x16, 0x1b, 0x16, 0x1b, 0x0f, 0xc1, 0x76, 0xc0, 0x59, 0x0d, 0x39, 0x03, 0x12, 0x0d, 0x03, 0xc0,
+  0x0f, 0x6e, 0x0f, 0x0a, 0x16, 0x1b, 0x7e, 0xc0, 0x1b, 0x1e, 0x0f, 0x0d, 0x6f, 0x14, 0xa2, 0xb8,
+  0xa0, 0xb8, 0xc1, 0x6e, 0x62, 0x69, 0x6e, 0x51, 0x5a, 0x7b, 0xa3, 0xb7, 0x7e, 0x52, 0xc0, 0x01,
+  0x4a, 0x7b, 0xa4, 0x97, 0xa4, 0xa6, 0xa5, 0xa9, 0xa1, 0xa8, 0x9d, 0x89, 0x96, 0x5a, 0x9e, 0x68,
+  0x05, 0x9d, 0x7a, 0x9d, 0x68, 0xab, 0xd6, 0xa1, 0xb9, 0x01, 0xa3, 0xa8, 0x9d, 0x69, 0x9c, 0x59,
+  0x7f, 0xa5, 0xb8, 0xc0, 0x9c, 0x78, 0xa3, 0x97, 0x5b, 0xc0, 0x19, 0x6e, 0x7a, 0xc1, 0x4a, 0x66,
+  0x19, 0x1e, 0x16, 0x1e, 0xc0, 0xa6, 0x97, 0xa4, 0xa8, 0x9b, 0x89, 0x16, 0xa7, 0xc8, 0xa6, 0xb7,
+  0x7e, 0x7e, 0x52, 0x21, 0x46, 0x23, 0xa3, 0xb8, 0x9d, 0x7a, 0x99, 0x3a, 0x69, 0xa3, 0xa7, 0x23,
+  0x6f, 0x23, 0x9b, 0x6b, 0x9a, 0x48, 0x5e, 0x7e, 0x9d, 0x9b, 0xc0, 0xa2, 0x87, 0x9e, 0x69, 0xa2,
+  0x97, 0x65, 0xa3, 0xa7, 0xa2, 0x99, 0x41, 0x6f, 0x0f, 0xaa, 0xf6, 0xa2, 0xa8, 0x96, 0x3b, 0x9e,
+  0x68, 0x9d, 0x59, 0xa2, 0xa7, 0x7e, 0xc0, 0x0a, 0x9e, 0x57, 0xa1, 0xb9, 0xa1, 0xa8, 0xa5, 0x87,
+  0xa2, 0xb9, 0x9d, 0x79, 0xc0, 0x12, 0xc0, 0x10, 0x9c, 0x89, 0x9b, 0x6b, 0x9f, 0x67, 0x1a, 0x9f,
+  0x69, 0xfe, 0x13, 0xd4, 0xc5, 0x6e, 0x62, 0xc7, 0x28, 0xa2, 0x78, 0xc4, 0x6f, 0x69, 0x28, 0xc0,
+  0x7f, 0x2d, 0x28, 0x2d, 0x39, 0xc1, 0x3e, 0xc0, 0x39, 0xa2, 0x78, 0xc0, 0x6f, 0xc1, 0x0a, 0xc0,
+  0x16, 0xc0, 0x0a, 0xc1, 0x05, 0xc0, 0x39, 0xc0, 0x66, 0x39, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0xc2,
+  0x34, 0xc0, 0x2d, 0xc0, 0x34, 0xc0, 0x39, 0xc0, 0x34, 0xc0, 0x39, 0x05, 0xc0, 0x0a, 0xc0, 0x05,
+  0xa2, 0x77, 0x16, 0x0a, 0xc2, 0x05, 0xc0, 0x0a, 0x6b, 0xc0, 0x16, 0x11, 0x0a, 0x05, 0xc3, 0x11,
+  0x0a, 0x67, 0x11, 0xc0, 0x05, 0x11, 0x0a, 0x05, 0xc0, 0x0a, 0x0f, 0x16, 0xc5, 0x0a, 0x05, 0x0a,
+  0xc0, 0x3e, 0x05, 0x0a, 0xc7, 0x05, 0x0a, 0xc1, 0x16, 0x0f, 0x05, 0xc1, 0x39, 0x05, 0x0a, 0xc1,
+  0x7f, 0x16, 0x0a, 0xc3, 0x0f, 0x0a, 0xc0, 0x0f, 0xc1, 0x6f, 0xc2, 0x16, 0x1b, 0xc0, 0x16, 0x0f,
+  0x0a, 0x0f, 0x0a, 0xc0, 0x16, 0xc1, 0x1b, 0x0f, 0x16, 0x0f, 0xc0, 0x6e, 0xa1, 0xb9, 0x9d, 0x88,
+  0x39, 0x3e, 0xc0, 0x7f, 0x3e, 0x6e, 0x7f, 0x0d, 0x0f, 0xc0, 0x14, 0x0f, 0xc0, 0x16, 0xc0, 0x1b,
+  0xa0, 0xa8, 0x5a, 0x14, 0x75, 0x03, 0xc0, 0x0f, 0xa1, 0xb9, 0xa2, 0xa7, 0xa1, 0xa8, 0xc0, 0x66,
+  0x5a, 0x51, 0x69, 0xa2, 0x98, 0xc0, 0xa2, 0xa7, 0xa2, 0x98, 0x6e, 0x7f, 0xa2, 0x97, 0xa2, 0x98,
+  0xa3, 0x88, 0x9c, 0x88, 0x34, 0x9d, 0x9a, 0xa3, 0x78, 0x34, 0x7a, 0x9a, 0x59, 0x96, 0x4b, 0xa2,
+  0x87, 0x1f, 0xa4, 0xa8, 0xa7, 0xb7, 0x1b, 0x9d, 0x78, 0x9a, 0x6a, 0x9d, 0x5a, 0x65, 0x3a, 0xa7,
+  0xd6, 0x4a, 0x2b, 0xc0, 0x02, 0x62, 0xa4, 0x86, 0x7e, 0x57, 0x46, 0x19, 0xc0, 0x49, 0x57, 0xaa,
+  0xb5, 0x9f, 0xab, 0x97, 0x5b, 0xa3, 0x85, 0xa4, 0xb9, 0xa4, 0x96, 0xa3, 0xb9, 0xa2, 0x98, 0xa2,
+  0x98, 0xa5, 0xa6, 0xc2, 0x9b, 0x6b, 0x9c, 0x68, 0x7f, 0xa3, 0xa7, 0xa2, 0x98, 0x94, 0x2c, 0x9d,
+  0x78, 0xa4, 0xa7, 0x56, 0xa3, 0x97, 0x9e, 0x68, 0x9d, 0x89, 0x5b, 0x42, 0xc0, 0xa0, 0xa7, 0x6f,
+  0x4a, 0x02, 0x1f, 0x9c, 0x6a, 0x55, 0xa2, 0x97, 0xa3, 0xb8, 0x66, 0x4b, 0xa2, 0xa7, 0x1b, 0xa1,
+  0xa8, 0x19, 0x56, 0x98, 0x4a, 0x9c, 0x59, 0x9d, 0x89, 0x6c, 0x5b, 0xa3, 0xb8, 0x00, 0x75, 0xa6,
+  0xb7, 0x03, 0xc0, 0x9d, 0x8a, 0x9d, 0x88, 0xaf, 0xc4, 0xa0, 0xb9, 0x09, 0x2e, 0xa4, 0x86, 0x9b,
+  0x7b, 0x98, 0x49, 0xfe, 0x13, 0xd4, 0x66, 0x28, 0x6e, 0xc1, 0x6f, 0x66, 0x23, 0x28, 0xc0, 0x23,
+  0xc0, 0x28, 0x23, 0x28, 0xc0, 0x34, 0xa2, 0x77, 0x39, 0xc3, 0x3e, 0x39, 0x23, 0x28, 0x2d, 0xc0,
+  0x28, 0xc1, 0x2d, 0x39, 0xc1, 0x34, 0x6f, 0xa2, 0x77, 0x6f, 0x66, 0x16, 0x0a, 0x11, 0x16, 0x69,
+  0x0a, 0xc0, 0x66, 0xc1, 0x39, 0xc0, 0x2d, 0xc1, 0x28, 0xc1, 0x2d, 0x28, 0xc0, 0x2d, 0xc0, 0x34,
+  0x2d, 0xc1, 0x39, 0xc0, 0x34, 0x39, 0x34, 0x39, 0x3e, 0x05, 0x0a, 0xc0, 0x05, 0x16, 0xc0, 0x0a,
+  0x0f, 0x0a, 0x05, 0xc0, 0x0a, 0x0f, 0x16, 0x0a, 0xc0, 0x16, 0xc0, 0x11, 0x0a, 0x05, 0x11, 0xc0,
+  0x0a, 0x11, 0xc1, 0x16, 0x11, 0xc1, 0x16, 0x0a, 0x16, 0xc2, 0x6e, 0x16, 0xc3, 0x0f, 0x16, 0x0f,
+  0x0a, 0x0f, 0x0a, 0xc3, 0x05, 0xc3, 0x39, 0x05, 0x0a, 0x0f, 0x0a, 0x39, 0xc0, 0x05, 0xc0, 0x0a,
+  0x05, 0xc1, 0x0a, 0xc5, 0x0f, 0xc0, 0x0a, 0xc1, 0x0f, 0xc0, 0x1b, 0xc0, 0x16, 0x7e, 0x0f, 0xc0,
+  0x0a, 0xc4, 0x0f, 0xc0, 0x16, 0x1b, 0x0f, 0xc1, 0x0a, 0xa2, 0x87, 0xa0, 0xa8, 0x9d, 0x89, 0x55,
+  0xc0, 0x3e, 0x6e, 0xc2, 0x0f, 0x7b, 0x0f, 0x7a, 0xc0, 0x1b, 0xc0, 0x0f, 0xc0, 0x9f, 0xb9, 0x59,
+  0xc0, 0x0a, 0x0f, 0xa1, 0xa8, 0xa1, 0xc9, 0xa1, 0xb8, 0x5f, 0x69, 0xc0, 0x66, 0x55, 0xc0, 0x79,
+  0xa4, 0x97, 0xa2, 0xa7, 0xc0, 0xa3, 0x89, 0xa4, 0xa8, 0x55, 0xa6, 0x87, 0xa4, 0x97, 0x9a, 0x8a,
+  0x9c, 0x88, 0xa2, 0x88, 0x9c, 0x6a, 0x5a, 0x9c, 0x78, 0x9d, 0x99, 0x59, 0x42, 0xa2, 0xa7, 0xa4,
+  0xb7, 0xa3, 0x98, 0x6e, 0x06, 0x9c, 0x69, 0xa5, 0xb8, 0xa4, 0x96, 0x52, 0xa3, 0x99, 0xa0, 0xa7,
+  0x15, 0x9d, 0x59, 0xa5, 0xb8, 0xa9, 0xc8, 0x95, 0x6b, 0x5d, 0xc0, 0x6e, 0xa1, 0xa9, 0x9d, 0x79,
+  0xa3, 0x97, 0x9d, 0xab, 0xa2, 0x77, 0xa3, 0x87, 0xa1, 0xa8, 0x6f, 0xa6, 0xb7, 0xa3, 0xba, 0xa5,
+  0xb6, 0x6e, 0xc1, 0x56, 0x9d, 0x79, 0x9d, 0x79, 0x9d, 0x7a, 0x69, 0x2b, 0xa7, 0xa7, 0x2c, 0x97,
+  0x4c, 0x9e, 0x58, 0x7b, 0x6d, 0x9b, 0x69, 0x9e, 0x68, 0x7b, 0xc0, 0x5a, 0x02, 0x45, 0xa2, 0x98,
+  0x79, 0x9d, 0x8a, 0x7f, 0xa2, 0x96, 0x9e, 0x69, 0x2e, 0x03, 0x66, 0xa4, 0xa7, 0x6e, 0x25, 0xa8,
+  0xc6, 0xa3, 0xa9, 0x45, 0x97, 0x4b, 0x12, 0xc0, 0x30, 0x9f, 0xb9, 0x9f, 0x58, 0x66, 0xa3, 0x97,
+  0xac, 0xe5, 0xa5, 0xe9, 0x9e, 0x69, 0xc0, 0x9c, 0x79, 0x7e, 0xa5, 0x97, 0x9d, 0x8a, 0xa1, 0xa8,
+  0x9e, 0x69, 0xa1, 0xa8, 0x01, 0x9d, 0x79, 0xfe, 0x13, 0xd4, 0x66, 0x28, 0x6e, 0x6b, 0x6e, 0xc0,
+  0x62, 0x34, 0x2d, 0xc0, 0x28, 0xc4, 0x39, 0xc3, 0x34, 0x39, 0xa2, 0x78, 0x2d, 0x23, 0x2d, 0x23,
+  0x28, 0x23, 0xc0, 0x28, 0xc2, 0x34, 0xc0, 0x39, 0x6e, 0x0a, 0x66, 0x0a, 0x6f, 0xc2, 0x69, 0x0a,
+  0x05, 0xc1, 0x39, 0xc0, 0x34, 0x2d, 0x28, 0xca, 0x2d, 0x39, 0xc0, 0x34, 0x39, 0xc2, 0x05, 0xc0,
+  0x0a, 0xc2, 0x0f, 0x0a, 0xc0, 0x05, 0xc0, 0x6f, 0x0a, 0xc1, 0x11, 0x0a, 0x16, 0xc0, 0x11, 0x66,
+  0x0a, 0x11, 0xc3, 0x16, 0x0a, 0x11, 0x16, 0xc1, 0x6e, 0xc1, 0x16, 0xc6, 0x0a, 0x0f, 0x1b, 0x0f,
+  0x16, 0xc0, 0x0a, 0xc0, 0x05, 0x3e, 0xc0, 0x05, 0x3e, 0x39, 0x3e, 0x05, 0x0a, 0xc0, 0x3e, 0xc1,
+  0x05, 0x0a, 0xc1, 0x3e, 0x39, 0x0a, 0x0f, 0x0a, 0x0f, 0x0a, 0x05, 0x0a, 0x0f, 0x7a, 0x0a, 0xc0,
+  0x0f, 0x16, 0x0f, 0x1b, 0x0f, 0xc0, 0x7e, 0x0a, 0x69, 0xc0, 0x0f, 0x0a, 0xc3, 0x0f, 0x0a, 0x12,
+  0x0f, 0xc1, 0x03, 0x3e, 0xa2, 0x97, 0x57, 0x39, 0xa2, 0x87, 0x7f, 0x0a, 0x3e, 0x06, 0x15, 0x12,
+  0x0f, 0x0a, 0x17, 0x6b, 0x0f, 0x0a, 0x05, 0x03, 0x3e, 0x06, 0x03, 0x0a, 0xa2, 0xb8, 0xa2, 0xb6,
+  0x76, 0xa2, 0x87, 0x36, 0x79, 0x7b, 0xa2, 0x78, 0x45, 0xa1, 0xa8, 0xa4, 0xb7, 0x7e, 0x47, 0x5a,
+  0xa4, 0xa7, 0xa6, 0xa6, 0x6f, 0x9d, 0x8a, 0x40, 0x38, 0xc0, 0x5b, 0x55, 0x34, 0xa2, 0x97, 0x9d,
+  0x99, 0x9d, 0x69, 0x6b, 0xa4, 0xa5, 0xa3, 0x99, 0x9d, 0x9a, 0x45, 0x2d, 0xa9, 0xc7, 0x6f, 0x9b,
+  0x89, 0xa3, 0x88, 0x9c, 0x88, 0x9a, 0x4a, 0x9e, 0x68, 0x6b, 0xa5, 0xb7, 0xa4, 0xa9, 0x98, 0x49,
+  0x7e, 0x46, 0x16, 0xa6, 0xa7, 0x66, 0xa9, 0xc6, 0x99, 0x7c, 0x9d, 0x76, 0xa4, 0x98, 0x9c, 0x7b,
+  0xa4, 0x86, 0xae, 0xe5, 0xc0, 0x9a, 0x6b, 0x9d, 0x79, 0x59, 0xa5, 0xa7, 0x6b, 0x96, 0x5b, 0xa3,
+  0x86, 0x1b, 0xa2, 0x88, 0x9d, 0x7a, 0x40, 0xa6, 0xb6, 0x1b, 0xc0, 0x9c, 0x69, 0x9e, 0x68, 0x56,
+  0x66, 0x9f, 0x68, 0x67, 0x59, 0xa2, 0xa7, 0x56, 0xc2, 0x7a, 0x56, 0x49, 0x36, 0xa2, 0x97, 0xa3,
+  0xa8, 0x42, 0x3b, 0xa3, 0xa7, 0xa8, 0xb6, 0x99, 0x7c, 0x1a, 0x06, 0xa4, 0x97, 0x9c, 0x7b, 0x12,
+  0x39, 0x9d, 0x8b, 0x7e, 0x9d, 0x8a, 0x55, 0xa4, 0x85, 0xa8, 0xb6, 0xa4, 0xc8, 0x9d, 0x7a, 0x31,
+  0xc0, 0x9c, 0x7a, 0xc0, 0xa4, 0x86, 0x21, 0x31, 0xc0, 0xfe, 0x13, 0xb4, 0x6e, 0xc1, 0xa2, 0x78,
+  0xc0, 0x28, 0xc0, 0x6f, 0x69, 0xc1, 0x28, 0xc0, 0x6b, 0x34, 0xc0, 0x39, 0x6e, 0x6f, 0x3e, 0x39,
+  0xc0, 0x6f, 0x39, 0x23, 0x28, 0xa2, 0x88, 0x28, 0x23, 0x28, 0x23, 0x28, 0x23, 0xc0, 0x28, 0x34,
+  0x3e, 0x39, 0xc1, 0x05, 0x0a, 0xc0, 0x6f, 0x69, 0xc0, 0x0a, 0xc0, 0x62, 0xc0, 0x05, 0x39, 0xc0,
+  0x2d, 0x28, 0xcc, 0x2d, 0xc2, 0x39, 0xc3, 0x05, 0x0a, 0xc0, 0x16, 0xc0, 0x0a, 0x05, 0x0a, 0x6b,
+  0x0a, 0xc2, 0x05, 0xc0, 0x0a, 0x11, 0x0a, 0xc1, 0x16, 0xc0, 0x11, 0x0a, 0xc1, 0x05, 0x0a, 0x0f,
+  0x16, 0x6e, 0xc0, 0x6f, 0x66, 0x1b, 0xc0, 0x16, 0x1b, 0xc0, 0x0f, 0x16, 0x1b, 0x7a, 0x16, 0x0f,
+  0xc0, 0x16, 0xc0, 0x0a, 0xc0, 0x3e, 0x7e, 0x3e, 0xc1, 0x39, 0x0a, 0xc2, 0x39, 0xc0, 0x3e, 0x0a,
+  0xc1, 0x3e, 0xc1, 0x0a, 0x0f, 0xc1, 0x0a, 0x05, 0x0a, 0x0f, 0xc0, 0x0a, 0xc0, 0x0f, 0xc3, 0x0a,
+  0x69, 0x3e, 0x03, 0x0a, 0x3e, 0xc0, 0x03, 0x0a, 0xc2, 0x7e, 0xa2, 0x98, 0x65, 0x0a, 0xc0, 0x64,
+  0x7b, 0xa2, 0x88, 0x03, 0xc0, 0xa2, 0x98, 0x1d, 0x3e, 0x01, 0x1d, 0xc0, 0x6b, 0x1b, 0x0f, 0x12,
+  0x0a, 0x3e, 0xc2, 0x12, 0x6e, 0xa1, 0x9a, 0xa1, 0xb7, 0x9e, 0xb7, 0xa2, 0x87, 0xa3, 0x98, 0x9d,
+  0xaa, 0x9d, 0xa8, 0xa4, 0x87, 0xa5, 0x89, 0x9d, 0x89, 0x40, 0xa3, 0xb8, 0xa4, 0x98, 0x5a, 0x56,
+  0xc0, 0x79, 0xa7, 0x87, 0x53, 0x3c, 0x9c, 0x99, 0xa2, 0x76, 0xa3, 0x7a, 0x34, 0x21, 0x9e, 0x69,
+  0xa1, 0xa8, 0x4a, 0x9b, 0x9a, 0xa4, 0xa8, 0xa9, 0x96, 0xa1, 0xb8, 0x7a, 0xa3, 0x88, 0x42, 0x46,
+  0x25, 0x9a, 0x89, 0xa4, 0x98, 0x9a, 0x4a, 0x9a, 0x5a, 0x21, 0xa2, 0x87, 0x65, 0x56, 0x2e, 0x6b,
+  0xa2, 0x87, 0xa3, 0xb9, 0x6e, 0x2b, 0xc0, 0x9d, 0x79, 0x2c, 0xad, 0xd7, 0x62, 0x9d, 0x7a, 0x99,
+  0x6a, 0xa4, 0x66, 0x9d, 0x88, 0xc0, 0x43, 0xa8, 0xb5, 0xa2, 0xa9, 0x9c, 0x6a, 0x65, 0xc0, 0x9e,
+  0x68, 0x69, 0x56, 0xa3, 0xa8, 0x56, 0x98, 0x5b, 0x40, 0xa3, 0x87, 0xa5, 0xb7, 0x9b, 0x7b, 0x9d,
+  0x69, 0xa2, 0x87, 0x67, 0x54, 0xa2, 0x98, 0x66, 0x5a, 0x9d, 0x89, 0xc0, 0x7f, 0x3b, 0x42, 0x41,
+  0x0b, 0x53, 0x56, 0xa4, 0xa6, 0xa3, 0x98, 0xa1, 0xa9, 0x56, 0xa2, 0x87, 0x23, 0x6b, 0xa3, 0xa8,
+  0x31, 0xc1, 0x56, 0x92, 0x2e, 0x7d, 0xa7, 0xa5, 0xa3, 0xb9, 0x59, 0x29, 0x31, 0x5a, 0x31, 0xc1,
+  0x2e, 0xc0, 0xfe, 0x13, 0xb4, 0x6e, 0xc0, 0x6e, 0xc0, 0x6f, 0x2d, 0x28, 0x2d, 0xc2, 0x6b, 0x66,
+  0x28, 0x2f, 0x39, 0x6e, 0x6b, 0x7e, 0x05, 0x39, 0xa2, 0x78, 0x05, 0x2d, 0x28, 0x23, 0x28, 0x7a,
+  0x28, 0x23, 0xc0, 0x28, 0x23, 0x69, 0x23, 0x28, 0x34, 0xc0, 0x39, 0xc1, 0xa2, 0x89, 0x0a, 0xc0,
+  0x6f, 0x0a, 0x05, 0xc3, 0x39, 0xc0, 0x28, 0x23, 0x28, 0xc6, 0x2d, 0x28, 0xc5, 0x2d, 0xc0, 0x34,
+  0x39, 0xc2, 0x3e, 0x0a, 0xc1, 0x05, 0x0a, 0xc2, 0x05, 0xc4, 0x0a, 0xc4, 0x05, 0xc4, 0x0a, 0x16,
+  0x6e, 0xc0, 0x6b, 0xc1, 0x1b, 0xc2, 0x65, 0x16, 0x0a, 0xa2, 0x88, 0x1b, 0xc0, 0x0f, 0x0a, 0x05,
+  0x3e, 0x39, 0xc1, 0x3e, 0xc2, 0x0a, 0x0f, 0xc0, 0x0a, 0x3e, 0xc0, 0x6e, 0xc0, 0x0a, 0xc0, 0x3e,
+  0xc0, 0x0a, 0x16, 0xc0, 0x1b, 0x16, 0xc0, 0x0f, 0x1b, 0xc0, 0x0f, 0xc0, 0x16, 0x0f, 0xc2, 0x0a,
+  0x03, 0x3e, 0x39, 0x3e, 0xc0, 0x7a, 0xc1, 0x03, 0x3e, 0x03, 0x0a, 0xa2, 0x87, 0xa0, 0xa9, 0xa0,
+  0xa7, 0x9e, 0x69, 0x3e, 0x03, 0xa1, 0xc9, 0x3e, 0x03, 0xa1, 0xa9, 0x6e, 0x0d, 0x3e, 0x0f, 0xa1,
+  0xa9, 0x7e, 0x1a, 0x4a, 0x0f, 0x0a, 0x39, 0x3e, 0x03, 0xc0, 0xa1, 0x9a, 0xa2, 0x87, 0x46, 0xa2,
+  0xd7, 0xa1, 0xc7, 0x41, 0xa2, 0xa8, 0xa2, 0x97, 0x56, 0xa5, 0x97, 0x57, 0x9b, 0x99, 0x9c, 0x77,
+  0xa4, 0x88, 0xa6, 0x98, 0xa2, 0x88, 0x65, 0x51, 0x5a, 0xc0, 0x34, 0x55, 0x35, 0x3c, 0xa5, 0x87,
+  0xa1, 0xb9, 0x9d, 0x79, 0x9a, 0x6a, 0x9b, 0x79, 0xa3, 0x88, 0x9c, 0x7a, 0xa5, 0xc5, 0xa5, 0xb8,
+  0xa2, 0x97, 0x46, 0x9a, 0x78, 0xa9, 0x87, 0x9b, 0x8b, 0x97, 0x6b, 0xaa, 0xb5, 0xa6, 0xc9, 0x5b,
+  0x66, 0x9a, 0x7a, 0x6c, 0xa4, 0x85, 0x5b, 0xa0, 0xa9, 0xa4, 0x87, 0x98, 0x4b, 0x7d, 0x2c, 0xa5,
+  0xa7, 0x9d, 0x8c, 0xa2, 0x97, 0xa3, 0x98, 0xa3, 0x98, 0xa3, 0xa7, 0xc1, 0x94, 0x5d, 0x98, 0x28,
+  0xa3, 0x96, 0xa9, 0xb7, 0xa4, 0xb8, 0xa4, 0xb7, 0x9c, 0x7a, 0x9d, 0x7a, 0x3d, 0x9a, 0x6a, 0x9e,
+  0x58, 0x7e, 0x66, 0x44, 0xa3, 0xa8, 0x7f, 0x96, 0x4b, 0x6d, 0xa2, 0x97, 0xa2, 0x98, 0xa2, 0x98,
+  0x42, 0x41, 0x42, 0xa3, 0xa8, 0x9e, 0x58, 0x25, 0xa9, 0xd7, 0x9a, 0x7b, 0x9d, 0x69, 0xa5, 0xa7,
+  0x41, 0x9c, 0x6a, 0xa4, 0xb6, 0xa5, 0xa7, 0x14, 0x5a, 0xc0, 0xa2, 0x97, 0x02, 0x19, 0x31, 0xc0,
+  0x66, 0x31, 0x19, 0x14, 0x9a, 0x4a, 0xa4, 0x96, 0xa6, 0xb6, 0x31, 0x56, 0x31, 0xc3, 0x9b, 0x8b,
+  0x19, 0x31, 0x29, 0xfe, 0x13, 0xb4, 0x6e, 0x6e, 0xc0, 0x28, 0xc0, 0x6f, 0x2d, 0x28, 0xc0, 0x34,
+  0x66, 0xc0, 0x2d, 0x28, 0x34, 0xa2, 0x78, 0xc1, 0x66, 0xa2, 0x88, 0x59, 0xc0, 0x61, 0xc1, 0x28,
+  0x23, 0xc1, 0x28, 0xc1, 0x23, 0x28, 0x65, 0xc0, 0x28, 0x34, 0xc1, 0x2d, 0x39, 0xa4, 0x88, 0x59,
+  0x56, 0x0a, 0x72, 0x05, 0x00, 0xc0, 0x39, 0xc0, 0x34, 0x2d, 0x28, 0xc5, 0x2d, 0xc0, 0x28, 0xc1,
+  0x23, 0x28, 0xc5, 0x39, 0x6e, 0x39, 0x34, 0x3e, 0x0f, 0x0a, 0x3e, 0x05, 0xc5, 0x00, 0x39, 0xc2,
+  0x00, 0x05, 0x0a, 0xc0, 0x05, 0x39, 0x05, 0xc1, 0x39, 0xc0, 0x3e, 0x05, 0x6f, 0xa2, 0x77, 0xc0,
+  0x66, 0xc0, 0x1b, 0xc2, 0x16, 0x0f, 0x7f, 0x0f, 0x6e, 0x1b, 0x16, 0x0a, 0x69, 0x39, 0xc2, 0x05,
+  0xc0, 0x3e, 0x03, 0x0a, 0x7e, 0xc0, 0x05, 0xc0, 0x0f, 0xc0, 0x1b, 0x16, 0x0f, 0xc0, 0x11, 0x16,
+  0x1b, 0x14, 0x21, 0x9d, 0xa8, 0x59, 0xa3, 0x88, 0x17, 0x14, 0x0f, 0x1b, 0x16, 0x0f, 0xc1, 0x0a,
+  0xc1, 0x03, 0x3e, 0x7a, 0x3e, 0xc0, 0x01, 0x3e, 0xc0, 0xa1, 0xa8, 0x0a, 0x12, 0xa1, 0xa8, 0x5a,
+  0xa1, 0xc8, 0x9e, 0x69, 0x0a, 0xa1, 0xa8, 0x66, 0x3e, 0x21, 0x7d, 0x12, 0x0a, 0x0f, 0x0a, 0xc0,
+  0x0f, 0x17, 0x0f, 0x0a, 0x3e, 0x0a, 0xc0, 0x16, 0x17, 0x12, 0x1a, 0xa1, 0xb8, 0x9e, 0xb7, 0x7b,
+  0xa6, 0x86, 0xa5, 0xb8, 0xa2, 0x88, 0x9d, 0x89, 0x54, 0x9b, 0x9a, 0x9c, 0x79, 0xa9, 0x87, 0xa5,
+  0xa8, 0x76, 0x6e, 0x67, 0x9d, 0x59, 0x99, 0x99, 0xa9, 0xb6, 0xa6, 0x97, 0x98, 0x5b, 0x65, 0x20,
+  0xa3, 0x97, 0x9d, 0x9a, 0x9c, 0x59, 0x9c, 0x79, 0xa2, 0x88, 0xa8, 0xc5, 0x9b, 0x8a, 0x9a, 0x5a,
+  0x9e, 0x67, 0x16, 0x46, 0xa2, 0x98, 0xa8, 0x96, 0xa3, 0xaa, 0xa2, 0x98, 0xa6, 0xa5, 0xa4, 0xa8,
+  0xa3, 0x98, 0x6b, 0x9b, 0x9a, 0x99, 0x5a, 0xa6, 0x85, 0xa4, 0xb9, 0x76, 0xa4, 0x76, 0x99, 0x7c,
+  0x99, 0x5a, 0x9c, 0x87, 0xaa, 0xb6, 0x31, 0xc0, 0x5a, 0x31, 0x9b, 0x8b, 0x9d, 0x68, 0x9e, 0x69,
+  0x9a, 0x59, 0xc0, 0xa7, 0xb6, 0xa1, 0xa9, 0xa2, 0x87, 0xa5, 0xc8, 0x9d, 0x8a, 0x9e, 0x68, 0xc0,
+  0x9c, 0x68, 0x9d, 0x7a, 0x41, 0x9a, 0x5a, 0xa8, 0xc5, 0x9d, 0x9b, 0x9a, 0x38, 0xa3, 0xa7, 0xa1,
+  0x9a, 0xa0, 0xa9, 0xa6, 0x95, 0xa5, 0xb8, 0xa0, 0xa8, 0x56, 0x97, 0x5c, 0x9d, 0x58, 0x5c, 0xa8,
+  0xd6, 0xa5, 0xc8, 0x5f, 0xa4, 0xa7, 0x3a, 0x7f, 0x54, 0xa2, 0x98, 0x31, 0x9c, 0x6a, 0x99, 0x5a,
+  0xa3, 0x96, 0x3a, 0xc0, 0xa2, 0x87, 0x0b, 0x9c, 0x58, 0x56, 0xa2, 0x97, 0xa6, 0xb7, 0x56, 0xa1,
+  0xa9, 0x09, 0x9c, 0x6a, 0xa7, 0xb5, 0xc1, 0x2e, 0x11, 0x9d, 0x89, 0x49, 0x20, 0x2e, 0x66, 0x99,
+  0x5c, 0xfe, 0x13, 0xd4, 0xc3, 0x66, 0xc0, 0x28, 0xc0, 0x6e, 0xc0, 0x67, 0xc0, 0x2d, 0x6b, 0xa2,
+  0x78, 0x6e, 0x05, 0xc1, 0xa2, 0x78, 0xa2, 0x77, 0x61, 0x9d, 0xa9, 0xc1, 0x2d, 0x28, 0x2f, 0x28,
+  0xc0, 0x65, 0x28, 0x23, 0x28, 0xc2, 0x34, 0x2d, 0xc0, 0x34, 0x2d, 0xa3, 0x89, 0x6e, 0x0f, 0x0a,
+  0x05, 0xc0, 0x66, 0xc0, 0x39, 0xc0, 0x69, 0x2d, 0x28, 0xd2, 0x39, 0xc0, 0x2d, 0xc0, 0x39, 0x6e,
+  0x39, 0x2d, 0x39, 0x3e, 0x39, 0xc2, 0x05, 0x39, 0xc5, 0x05, 0xc0, 0x39, 0xc1, 0x05, 0x39, 0x34,
+  0x2d, 0x34, 0x05, 0x0a, 0xc0, 0xa2, 0x78, 0x16, 0x0a, 0x16, 0xc3, 0x0f, 0x1b, 0x16, 0x0a, 0x0f,
+  0x0a, 0xc0, 0x3e, 0xc1, 0x32, 0x7f, 0x39, 0x7a, 0xa2, 0x77, 0x0f, 0x1b, 0x16, 0x0f, 0x79, 0x72,
+  0x06, 0x7a, 0x6e, 0xc0, 0x09, 0x69, 0x55, 0xa0, 0xb8, 0xa0, 0xa8, 0x64, 0x7a, 0x9c, 0xa9, 0xa2,
+  0x77, 0xa2, 0x88, 0x6b, 0xa0, 0x59, 0x12, 0x1b, 0x0f, 0x0a, 0x0f, 0xc1, 0x65, 0x0a, 0x0f, 0x0d,
+  0x06, 0x0a, 0x3e, 0xc0, 0x01, 0xa3, 0xa8, 0x46, 0x0a, 0xa2, 0xa7, 0xa1, 0xa8, 0x20, 0x66, 0x69,
+  0x5e, 0x06, 0x03, 0x1d, 0xc0, 0x12, 0x0f, 0x6b, 0x0f, 0xc3, 0x0a, 0xc0, 0x16, 0x6e, 0x1d, 0x9f,
+  0xb8, 0x6e, 0xc0, 0x9f, 0xc8, 0x79, 0xa3, 0x98, 0xa5, 0x99, 0xa4, 0x88, 0x55, 0x9c, 0x98, 0x9d,
+  0x98, 0x6f, 0x01, 0xa2, 0x88, 0x9d, 0x99, 0x50, 0xa6, 0x78, 0x9f, 0x7b, 0x9c, 0x78, 0xa0, 0xa7,
+  0xa0, 0xa8, 0x01, 0x10, 0x99, 0x79, 0xa2, 0x97, 0xa7, 0xa8, 0x9b, 0x99, 0x1c, 0x3c, 0xa3, 0x98,
+  0x66, 0x9a, 0x69, 0x45, 0x42, 0x79, 0xa4, 0x87, 0xa3, 0xaa, 0xa2, 0x79, 0xa4, 0xa8, 0x64, 0x6c,
+  0xa2, 0x99, 0x6e, 0x9c, 0x89, 0x01, 0x15, 0xa2, 0x89, 0xa6, 0x96, 0xa7, 0xd8, 0x9c, 0x69, 0x42,
+  0xa2, 0x87, 0xa0, 0xb8, 0x9d, 0x69, 0x3a, 0x76, 0x5d, 0x63, 0x45, 0x9c, 0x78, 0x5b, 0x9d, 0x6a,
+  0xa6, 0xa4, 0x3a, 0x06, 0x6e, 0xaa, 0xd5, 0x9b, 0x7b, 0x9a, 0x69, 0x9e, 0x57, 0x41, 0xc1, 0x25,
+  0x9b, 0x6a, 0xa3, 0xb7, 0x0e, 0x9d, 0x69, 0xac, 0xd6, 0x29, 0x62, 0x31, 0x66, 0x31, 0xc0, 0x62,
+  0x94, 0x1d, 0x9c, 0x68, 0xa6, 0xb3, 0xa4, 0x98, 0x9c, 0x6c, 0x9b, 0x68, 0x1d, 0x45, 0x36, 0xa2,
+  0x97, 0xa6, 0xa7, 0x9c, 0x69, 0x6d, 0xa1, 0xba, 0x9e, 0x59, 0xa2, 0x97, 0x1a, 0x9b, 0x6b, 0xa8,
+  0xc5, 0x5b, 0x51, 0xa9, 0xd7, 0x99, 0x5b, 0xab, 0xe4, 0xa1, 0xa8, 0x04, 0x9c, 0x58, 0xa3, 0x98,
+  0xa5, 0xa6, 0x9a, 0x7c, 0x9d, 0x68, 0xc0, 0x13, 0xa8, 0xa6, 0x76, 0x9c, 0x69, 0xc0, 0xfe, 0x13,
+  0xb4, 0x6e, 0xc4, 0x23, 0xc0, 0x28, 0x6e, 0x67, 0xc0, 0x6e, 0x6e, 0xa2, 0x78, 0xc2, 0x6b, 0x6e,
+  0xa2, 0x77, 0x0a, 0x66, 0x66, 0x39, 0xc2, 0x34, 0x2d, 0x23, 0xc0, 0x28, 0xc0, 0x2d, 0x39, 0x34,
+  0x39, 0xc0, 0x34, 0xc0, 0x2d, 0xc0, 0xa2, 0x78, 0xa3, 0x89, 0x0a, 0x39, 0x05, 0xc1, 0x39, 0xc0,
+  0x2d, 0xc0, 0x2f, 0x28, 0xc9, 0x23, 0xc0, 0x28, 0xc1, 0x23, 0x28, 0xc0, 0x34, 0x2d, 0x28, 0xc0,
+  0x39, 0xc0, 0x34, 0x28, 0x2d, 0x34, 0xc0, 0x2d, 0xc0, 0x39, 0xc1, 0x34, 0xc1, 0x39, 0xc4, 0x34,
+  0xc0, 0x39, 0xc0, 0x2d, 0x28, 0x2d, 0x05, 0xc0, 0x0a, 0xc2, 0x16, 0x69, 0xc3, 0x0a, 0xc2, 0x7a,
+  0x0a, 0xc1, 0x0d, 0x39, 0x3e, 0xa3, 0x88, 0x51, 0xc0, 0x0f, 0x75, 0x9e, 0xb8, 0xa0, 0xa7, 0x9f,
+  0xb8, 0x69, 0x56, 0xa2, 0x98, 0x65, 0x61, 0x6f, 0xa4, 0x97, 0x6f, 0x9d, 0x69, 0xa3, 0xa9, 0x75,
+  0x9d, 0x79, 0x2d, 0x30, 0x51, 0x7e, 0xa5, 0x79, 0xa2, 0x1b, 0x9e, 0x68, 0xc0, 0x0a, 0xc2, 0x3e,
+  0xc0, 0x0a, 0x03, 0x0f, 0x03, 0x0a, 0xc0, 0x0d, 0xa3, 0xa7, 0x9e, 0x69, 0x7a, 0xa1, 0xa8, 0xa2,
+  0x87, 0x20, 0xc0, 0x29, 0x15, 0xc0, 0x7f, 0x59, 0x0f, 0x7b, 0x5a, 0x6e, 0x6e, 0x7a, 0x1b, 0x16,
+  0x1b, 0xc0, 0x17, 0x9f, 0xb8, 0xa1, 0xc7, 0xa2, 0xb7, 0x51, 0x66, 0x9c, 0x98, 0xa4, 0x77, 0xa8,
+  0x98, 0xa6, 0x89, 0x9e, 0x67, 0x9c, 0x99, 0x99, 0x89, 0xc0, 0xa5, 0x99, 0x6e, 0x54, 0x7b, 0x6e,
+  0xa6, 0x89, 0xa4, 0x67, 0x9b, 0x9a, 0x9c, 0x98, 0x06, 0xa0, 0x8a, 0x9d, 0x99, 0x9b, 0x88, 0xa4,
+  0x96, 0xa8, 0xa7, 0x56, 0x9d, 0x88, 0xa8, 0x97, 0x5b, 0x95, 0x6b, 0x99, 0x6a, 0xa3, 0x98, 0xa5,
+  0xb6, 0xa5, 0xc8, 0x41, 0x47, 0xa6, 0x67, 0xa1, 0xba, 0xa0, 0xa8, 0x9b, 0x79, 0xa6, 0x96, 0x62,
+  0x52, 0xa3, 0x87, 0x9d, 0x8a, 0xa4, 0xa8, 0x56, 0x97, 0x59, 0xa5, 0x97, 0x52, 0x10, 0xa4, 0x97,
+  0x51, 0x2e, 0xa8, 0x96, 0xa2, 0x98, 0xa4, 0xa7, 0x99, 0x8c, 0x92, 0x0c, 0xae, 0xa1, 0xa3, 0xda,
+  0x94, 0x2b, 0xa4, 0xa6, 0xa8, 0xb6, 0x9d, 0x9a, 0x9c, 0x79, 0xa9, 0x95, 0xa1, 0xb9, 0x99, 0x7c,
+  0x99, 0x5a, 0x45, 0x1c, 0x9d, 0x88, 0x59, 0x6f, 0xa1, 0xa8, 0xa2, 0x97, 0xa2, 0x87, 0xa7, 0xb8,
+  0xa2, 0xc8, 0xa3, 0x88, 0x29, 0x9c, 0x6a, 0xa1, 0xa8, 0x26, 0x96, 0x4c, 0x9b, 0x68, 0x56, 0x7d,
+  0xaf, 0xe6, 0x76, 0x8c, 0x0f, 0xa3, 0x75, 0x7a, 0x4a, 0xc0, 0xa1, 0xb8, 0xa3, 0xa8, 0xa9, 0xa6,
+  0x9a, 0x7b, 0x9a, 0x59, 0xa3, 0x97, 0xa2, 0x98, 0xc0, 0xa5, 0xc7, 0x6f, 0x75, 0x35, 0x9a, 0x5b,
+  0xa4, 0x86, 0x20, 0xa5, 0xb7, 0x09, 0x9d, 0x79, 0x7e, 0x9b, 0x6a, 0xa9, 0xb5, 0xa3, 0xc8, 0x9d,
+  0x8a, 0xa3, 0x87, 0x9b, 0x8b, 0x12, 0xa6, 0xa5, 0xfe, 0x13, 0xb4, 0xc0, 0x6e, 0xc1, 0x6e, 0x6b,
+  0x28, 0xc1, 0x34, 0x66, 0x34, 0x6e, 0x6f, 0x6e, 0xc1, 0x7f, 0x5a, 0xa2, 0x78, 0x66, 0x16, 0x0a,
+  0x05, 0xc2, 0x39, 0xc0, 0x34, 0x28, 0xc1, 0x34, 0xc1, 0x39, 0x6e, 0x39, 0x34, 0x39, 0x69, 0x39,
+  0xc1, 0x05, 0xc1, 0x0a, 0xc0, 0x3e, 0x39, 0xc0, 0x34, 0xc0, 0x2d, 0xc1, 0x28, 0xcb, 0x23, 0x2d,
+  0x39, 0xc1, 0x2d, 0x28, 0x2d, 0x34, 0xc0, 0x28, 0x2d, 0xc3, 0x39, 0xc2, 0x2d, 0xc0, 0x34, 0xc2,
+  0x2d, 0xc2, 0x39, 0xc0, 0x34, 0x2d, 0x39, 0x05, 0x0a, 0xc3, 0x6e, 0x16, 0x0a, 0xc2, 0x05, 0x0f,
+  0x16, 0x0a, 0x0f, 0x0a, 0xc0, 0x0f, 0x16, 0x0a, 0xc0, 0xa2, 0xa7, 0x9c, 0xa7, 0x9f, 0xb8, 0x61,
+  0xa1, 0xa8, 0x9f, 0xb8, 0x5b, 0xc0, 0x6e, 0x28, 0x79, 0xa4, 0x89, 0x4f, 0xa2, 0x69, 0xa3, 0x79,
+  0x5f, 0x9f, 0x69, 0x6f, 0x60, 0xa2, 0xe6, 0x9d, 0xc7, 0x24, 0x66, 0xc0, 0x19, 0xa1, 0x2b, 0x0f,
+  0x0a, 0xc0, 0x69, 0xc0, 0x3e, 0x05, 0x0a, 0xc2, 0x03, 0x0a, 0x03, 0x0f, 0x6e, 0x7a, 0xa1, 0xa8,
+  0x56, 0x56, 0xa3, 0xb8, 0xc0, 0x0f, 0xc0, 0x17, 0x6b, 0x16, 0x6e, 0xa2, 0x77, 0x77, 0x69, 0x17,
+  0x5f, 0xc0, 0x23, 0x71, 0xa0, 0xc6, 0xa1, 0xc7, 0xa0, 0xa8, 0x7e, 0x55, 0x9d, 0x8a, 0x1f, 0xa3,
+  0x88, 0xae, 0x97, 0xa4, 0x79, 0x9a, 0x88, 0x99, 0x99, 0x6f, 0xa9, 0x77, 0x76, 0x9b, 0x89, 0x9a,
+  0x88, 0xa2, 0x67, 0xa8, 0xa9, 0xa6, 0x78, 0x9b, 0x89, 0x06, 0x66, 0x3c, 0xa3, 0x99, 0x9a, 0x78,
+  0x55, 0x30, 0xa5, 0xa8, 0x00, 0x99, 0x7b, 0xa3, 0x78, 0xa7, 0x97, 0x9b, 0x8a, 0x99, 0x7a, 0xa5,
+  0xa6, 0xa8, 0xd6, 0xa3, 0x98, 0x9d, 0x6a, 0x9b, 0x7b, 0xa3, 0x68, 0xa1, 0xa8, 0xa3, 0xa6, 0xa1,
+  0xa9, 0x67, 0x5d, 0xa3, 0xaa, 0x9c, 0x8a, 0xc0, 0x9c, 0x57, 0xac, 0xb5, 0x62, 0x9d, 0x8a, 0xa3,
+  0xa9, 0x29, 0x9b, 0x78, 0xa2, 0x77, 0xa5, 0xca, 0x97, 0x4d, 0xa6, 0x83, 0xa6, 0xa7, 0x62, 0xa2,
+  0x97, 0x96, 0x3c, 0x9d, 0x58, 0xa5, 0xc6, 0xa3, 0xa8, 0xa1, 0xaa, 0x9d, 0x89, 0x9d, 0x67, 0x99,
+  0x7a, 0x19, 0xa8, 0xc7, 0x9b, 0x7b, 0x9b, 0x78, 0xa3, 0x98, 0x57, 0x94, 0x3a, 0x6d, 0x66, 0xa2,
+  0x97, 0x59, 0xa6, 0xa7, 0xa6, 0xa8, 0x63, 0xa4, 0xa7, 0xa2, 0xa7, 0x91, 0x2e, 0x9e, 0x66, 0xa2,
+  0x77, 0x9e, 0x69, 0x7e, 0x03, 0xaa, 0xd6, 0xa7, 0xd7, 0x98, 0x5c, 0x95, 0x3a, 0xa6, 0x96, 0x56,
+  0x9c, 0x59, 0xa3, 0xa7, 0x29, 0x56, 0xa1, 0xa8, 0x6d, 0x9d, 0x7a, 0x2c, 0x9e, 0x69, 0x59, 0xa5,
+  0xb6, 0xa0, 0xaa, 0xa1, 0xa9, 0x7e, 0x32, 0x7e, 0x25, 0xa2, 0x77, 0xa6, 0xa5, 0x09, 0x32, 0x0c,
+  0xa3, 0xc8, 0x66, 0x9c, 0x6a, 0x9e, 0x67, 0xa2, 0x88, 0x97, 0x5c, 0x41, 0xfe, 0x13, 0xd4, 0x66,
+  0xc0, 0x28, 0x6e, 0x28, 0x23, 0xc0, 0xa2, 0x78, 0x66, 0x34, 0xc0, 0x6e, 0x6f, 0x6e, 0xa2, 0x78,
+  0x0a, 0xc0, 0x6f, 0x1b, 0x6f, 0x1b, 0x16, 0xc0, 0x0a, 0xc3, 0x05, 0x66, 0x39, 0xc0, 0x34, 0xc0,
+  0x39, 0x34, 0xc0, 0x39, 0x05, 0x39, 0xc1, 0x34, 0xc0, 0x39, 0x05, 0xc4, 0x39, 0xc1, 0x34, 0xc2,
+  0x2d, 0x28, 0xca, 0x2d, 0x34, 0xc0, 0x39, 0xc1, 0x2d, 0xc2, 0x28, 0x2d, 0xc3, 0x39, 0xc2, 0x34,
+  0x2d, 0xc2, 0x34, 0x2d, 0x28, 0x2d, 0x39, 0xc3, 0x6e, 0x05, 0x0a, 0x6e, 0x0a, 0xc0, 0x69, 0x0f,
+  0x0a, 0xc0, 0x03, 0xc0, 0x0f, 0x0a, 0x0f, 0x7b, 0x1b, 0x0f, 0x0a, 0x16, 0xc0, 0x6d, 0x9e, 0xb8,
+  0x9e, 0xc7, 0x9d, 0xb8, 0x75, 0xa4, 0x87, 0x67, 0xa2, 0x78, 0x6d, 0x9d, 0x8a, 0x7a, 0x59, 0xa4,
+  0x89, 0xa3, 0x59, 0xa4, 0x69, 0xa0, 0x58, 0x5a, 0x56, 0x50, 0xa1, 0xb9, 0x65, 0xa0, 0xa7, 0xa3,
+  0xe7, 0x98, 0x98, 0x9b, 0x89, 0x7f, 0x64, 0xa5, 0x69, 0xa4, 0x2a, 0x0f, 0xc0, 0x14, 0x16, 0xc0,
+  0x0f, 0x16, 0x14, 0x7b, 0x0f, 0xc0, 0x16, 0xc1, 0xa2, 0x87, 0x14, 0x23, 0x1b, 0xc0, 0xa2, 0xa7,
+  0xa3, 0xa8, 0x9e, 0x69, 0x55, 0xa1, 0xa9, 0x1e, 0x27, 0x23, 0x70, 0x9f, 0xd8, 0x75, 0x9d, 0xa8,
+  0xa4, 0x48, 0xa3, 0x6a, 0x9e, 0xb8, 0x74, 0x9f, 0xc7, 0xa4, 0xa8, 0xa3, 0x78, 0x9b, 0x99, 0x9c,
+  0x89, 0x6e, 0xa2, 0x79, 0xa6, 0x87, 0xa7, 0x99, 0x41, 0x97, 0x98, 0x08, 0xa2, 0x89, 0x5a, 0x59,
+  0x61, 0x9b, 0x8a, 0xa6, 0x87, 0xaa, 0x97, 0x9c, 0x88, 0x99, 0x8a, 0x9d, 0x88, 0xa7, 0x98, 0xa3,
+  0x7a, 0x9c, 0x88, 0x9d, 0xb8, 0xa2, 0x87, 0xa3, 0x98, 0x09, 0x9c, 0x69, 0x9b, 0x8a, 0x33, 0xc0,
+  0x1a, 0xa5, 0xb7, 0x38, 0xc0, 0xa3, 0xb8, 0x13, 0x9d, 0x6a, 0xa3, 0xa8, 0xa1, 0xa7, 0xa3, 0x88,
+  0xc1, 0x6e, 0x77, 0xa3, 0xa9, 0xc0, 0x9d, 0x6a, 0x9a, 0x67, 0xa4, 0xa7, 0xc0, 0xa5, 0x87, 0x7a,
+  0x69, 0x99, 0x7b, 0xa4, 0x67, 0xa2, 0xba, 0x97, 0x3b, 0xa3, 0x96, 0x67, 0xa3, 0x77, 0x76, 0xa2,
+  0x98, 0x63, 0x41, 0xa9, 0xc4, 0x62, 0x38, 0x9f, 0x58, 0xa3, 0xb9, 0xa6, 0x96, 0x7f, 0x97, 0x7c,
+  0x20, 0xa2, 0x98, 0x9e, 0x69, 0xa0, 0xa8, 0x6e, 0x9c, 0x89, 0xa2, 0x87, 0xa3, 0xa8, 0x11, 0xac,
+  0xb5, 0xa3, 0xb9, 0x99, 0x6a, 0x55, 0x97, 0x5c, 0x49, 0xa2, 0x87, 0x1a, 0x46, 0x9d, 0x99, 0xa6,
+  0xc6, 0xa7, 0xb7, 0x9a, 0x6b, 0x99, 0x4b, 0xa3, 0x96, 0xa2, 0x88, 0x55, 0x31, 0xa5, 0xb7, 0x9a,
+  0x6b, 0x9c, 0x68, 0xa8, 0xb6, 0x9b, 0x5a, 0xa4, 0xa6, 0xa0, 0xaa, 0x10, 0xa8, 0xd6, 0x7e, 0x7e,
+  0xc1, 0x29, 0x96, 0x4c, 0x9c, 0x48, 0xa8, 0xc5, 0x7f, 0x46, 0xa1, 0xa7, 0x37, 0x9b, 0x6b, 0x1a,
+  0x7f, 0x6e, 0x1e, 0xc0, 0xfe, 0x13, 0xd4, 0x6e, 0xc1, 0x28, 0xc0, 0x66, 0x7e, 0x28, 0xc1, 0x6f,
+  0x6e, 0x6f, 0x6e, 0x6f, 0x0a, 0xc1, 0x16, 0x6e, 0xc0, 0x16, 0x0a, 0xc2, 0x6b, 0x0a, 0x11, 0x0a,
+  0x05, 0x66, 0xc0, 0x39, 0xc2, 0x34, 0x39, 0xc6, 0x6e, 0x05, 0xc4, 0x3e, 0x39, 0xc2, 0x34, 0xc0,
+  0x28, 0xc0, 0x23, 0x28, 0xc4, 0x2d, 0xc0, 0x34, 0xc0, 0x39, 0xc1, 0x69, 0xc0, 0x34, 0x2d, 0xc3,
+  0x39, 0x34, 0xc0, 0x39, 0xc4, 0x2d, 0xc1, 0x39, 0x2d, 0x28, 0x2d, 0x39, 0xc1, 0x05, 0x0a, 0xc1,
+  0x6e, 0x0a, 0xc0, 0x3e, 0x0a, 0x7e, 0x55, 0xc0, 0x0a, 0xc0, 0x0f, 0xc1, 0x16, 0x0f, 0xc0, 0x16,
+  0x7d, 0x9f, 0xc7, 0x9c, 0xb8, 0xa0, 0xb7, 0xa1, 0xa9, 0x30, 0x6b, 0xa3, 0x87, 0xa2, 0x89, 0x51,
+  0xc0, 0x55, 0x10, 0xa5, 0x88, 0x5f, 0x4f, 0x51, 0x6b, 0xa2, 0x97, 0x69, 0x51, 0x76, 0x7a, 0xa2,
+  0x96, 0x95, 0xaa, 0x66, 0xa2, 0x78, 0xc0, 0x6d, 0x66, 0xa4, 0x3a, 0xa3, 0x4a, 0x64, 0x51, 0x7b,
+  0xa1, 0xb8, 0x6e, 0x9f, 0x59, 0xa2, 0x98, 0x7a, 0x55, 0x7a, 0x41, 0x7f, 0xa3, 0x98, 0x7a, 0x2d,
+  0x65, 0x6b, 0x7a, 0xa2, 0x77, 0x41, 0x22, 0x2d, 0x0f, 0x9b, 0x99, 0x9d, 0x98, 0x61, 0xa0, 0xb7,
+  0xa0, 0xa7, 0x9d, 0x89, 0x5a, 0xa3, 0x79, 0x62, 0x79, 0xa5, 0xa8, 0xa6, 0x77, 0x51, 0x9c, 0x88,
+  0x42, 0xa4, 0x69, 0xa3, 0x79, 0xa3, 0x87, 0xa5, 0xb8, 0x9b, 0x89, 0x96, 0x89, 0xa6, 0x97, 0x09,
+  0x9a, 0x79, 0x9c, 0x79, 0x7a, 0xa8, 0x85, 0xa2, 0x9a, 0x5a, 0x41, 0x98, 0x8a, 0x9d, 0xb7, 0xa7,
+  0x87, 0xa4, 0x88, 0x6b, 0x51, 0x6e, 0x52, 0x51, 0x5a, 0x9e, 0x69, 0x41, 0x47, 0x1c, 0xa8, 0xe6,
+  0xa2, 0x88, 0x9c, 0x87, 0xa7, 0xa7, 0xa2, 0x8a, 0x5b, 0x9e, 0x5a, 0x9d, 0xb7, 0x70, 0xa3, 0x79,
+  0xa2, 0x87, 0x5e, 0xc0, 0xa7, 0xa8, 0xa4, 0xa9, 0x9b, 0x89, 0x9c, 0x68, 0xa2, 0xb8, 0xa4, 0x88,
+  0x9b, 0x79, 0x9a, 0x79, 0x45, 0x5a, 0x46, 0xa3, 0x88, 0x47, 0x41, 0xa1, 0xa8, 0x9c, 0x79, 0xa7,
+  0xc6, 0xa5, 0xb9, 0xa5, 0xb7, 0x77, 0x97, 0x4a, 0x9c, 0x67, 0x9d, 0x88, 0x3a, 0x5b, 0xa2, 0x87,
+  0xc0, 0x9d, 0x79, 0x76, 0x59, 0x2a, 0x20, 0x1f, 0xa6, 0xc6, 0x2e, 0x97, 0x5b, 0x4e, 0xa4, 0xa7,
+  0x76, 0x9e, 0x68, 0x9b, 0x5a, 0x2c, 0xa1, 0xc9, 0x25, 0x9e, 0x6a, 0x03, 0x1a, 0x9d, 0x79, 0x03,
+  0x6f, 0xa3, 0xc8, 0x47, 0x9b, 0x5a, 0x40, 0xa3, 0xb8, 0xa5, 0xb6, 0xab, 0xe7, 0x9d, 0x8a, 0x42,
+  0xc0, 0x7d, 0xa6, 0xb6, 0x66, 0x31, 0xc1, 0x9a, 0x6a, 0x9d, 0x59, 0x66, 0x46, 0xc0, 0x7e, 0xc0,
+  0x9e, 0x68, 0x9d, 0x79, 0xa5, 0xb7, 0x13, 0x9c, 0x7a, 0x9e, 0x48, 0x59, 0x76, 0x02, 0x5a, 0xfe,
+  0x13, 0xf4, 0x6f, 0x2d, 0x66, 0xc4, 0x66, 0xc0, 0x2d, 0x39, 0x6e, 0xc2, 0x6b, 0x6e, 0xc0, 0x05,
+  0x0a, 0x3e, 0x39, 0xc0, 0x05, 0xc1, 0x0a, 0xc1, 0x6b, 0x0a, 0xc0, 0x05, 0x39, 0xc1, 0x66, 0xc1,
+  0x39, 0xc1, 0x05, 0x39, 0xc0, 0x05, 0x39, 0x05, 0x0a, 0xc1, 0x11, 0xc1, 0x05, 0xc2, 0x66, 0x39,
+  0x34, 0xc0, 0x2d, 0xc4, 0x34, 0x39, 0xc4, 0x34, 0x39, 0xc1, 0x2d, 0x34, 0x39, 0xc0, 0x3e, 0x39,
+  0x05, 0xc2, 0x0a, 0x05, 0x3e, 0x39, 0xc3, 0x34, 0x2d, 0x39, 0x05, 0xc0, 0x0a, 0x6f, 0xc0, 0x69,
+  0xc0, 0x0a, 0xc0, 0x3e, 0x0a, 0x0f, 0x65, 0xc0, 0x0a, 0xc2, 0x0f, 0x16, 0x0f, 0xc0, 0x0a, 0x9c,
+  0xd7, 0x9f, 0xe6, 0x7a, 0x5f, 0x6f, 0x6d, 0x7e, 0x67, 0x35, 0x7f, 0x56, 0x04, 0xa2, 0x88, 0x6f,
+  0x04, 0xa1, 0xa9, 0xa2, 0x77, 0x5a, 0x20, 0xa8, 0x87, 0xa2, 0x8a, 0x97, 0x79, 0x3f, 0x20, 0x2b,
+  0x69, 0x2b, 0xc1, 0x1f, 0xa2, 0x78, 0x5a, 0x56, 0x2b, 0x24, 0xa2, 0x88, 0x7e, 0x04, 0x6d, 0x35,
+  0x3c, 0x2b, 0x3f, 0xa2, 0x88, 0x38, 0xc0, 0x3d, 0xa4, 0x98, 0xa2, 0x88, 0x18, 0x6f, 0x75, 0x55,
+  0xa3, 0x89, 0x0c, 0x9d, 0xa8, 0x66, 0x5a, 0x6b, 0x4b, 0x4e, 0x7e, 0x9d, 0xc9, 0x22, 0xa5, 0x98,
+  0xa4, 0x67, 0x9d, 0x99, 0x38, 0x1d, 0xa4, 0x89, 0x4a, 0x61, 0x24, 0xa3, 0x88, 0xa2, 0x98, 0x6b,
+  0xa2, 0x87, 0x9c, 0x87, 0x9d, 0x79, 0x7f, 0x14, 0xa4, 0x88, 0x61, 0x35, 0x5f, 0x79, 0x76, 0xa3,
+  0x88, 0xa4, 0x97, 0x9d, 0x7a, 0x9d, 0x99, 0x6e, 0x9e, 0x69, 0x41, 0x56, 0xa1, 0xa9, 0x69, 0x6e,
+  0xa4, 0xa7, 0xa7, 0xc7, 0x9d, 0x99, 0x65, 0xa4, 0x69, 0xa3, 0x88, 0x7f, 0x9c, 0x78, 0xa2, 0x98,
+  0xa3, 0xa9, 0x9b, 0x79, 0xa2, 0xa8, 0xa2, 0x98, 0x9b, 0x79, 0xa7, 0x56, 0xa1, 0xa9, 0x9d, 0x9a,
+  0xa3, 0xa7, 0xa2, 0x79, 0x9c, 0x79, 0x7a, 0x99, 0x69, 0x9e, 0x67, 0xa1, 0xaa, 0x69, 0x9f, 0x69,
+  0x67, 0xa2, 0x96, 0x57, 0xa4, 0xb7, 0xaa, 0xb6, 0xa3, 0xb8, 0x9d, 0x79, 0x99, 0x59, 0x9d, 0x79,
+  0x9c, 0x79, 0x9f, 0x68, 0x57, 0x6e, 0x7a, 0x61, 0x6e, 0xa2, 0x87, 0x7f, 0x6e, 0x7b, 0x27, 0xaa,
+  0xe5, 0xaa, 0xb7, 0x13, 0x9b, 0x69, 0xa2, 0x88, 0x46, 0xa3, 0xb7, 0x9c, 0x7b, 0xa2, 0x96, 0x01,
+  0x7a, 0x9c, 0x5a, 0x9d, 0x89, 0xa2, 0x87, 0x34, 0xa4, 0xa7, 0x7f, 0xc0, 0xa5, 0xb7, 0x9b, 0x7b,
+  0x2a, 0xc0, 0xa6, 0xb6, 0xa2, 0x97, 0x56, 0x52, 0xa2, 0x77, 0x31, 0x96, 0x4c, 0x9c, 0x48, 0xa3,
+  0x97, 0xc0, 0x9a, 0x6a, 0x45, 0x9e, 0x69, 0x9d, 0x79, 0xa9, 0xd5, 0x13, 0x0a, 0xa3, 0xa7, 0x7f,
+  0x41, 0xa9, 0xd6, 0x1b, 0x95, 0x4c, 0xa4, 0x87, 0xa2, 0xa7, 0x66, 0x9b, 0x2a, 0x79, 0xfe, 0x13,
+  0xd4, 0xc0, 0x65, 0xc1, 0x6b, 0xc4, 0x28, 0xa2, 0x78, 0x6e, 0x39, 0x66, 0x39, 0xc0, 0xa2, 0x78,
+  0xc0, 0x39, 0x65, 0xc3, 0x39, 0x3e, 0xc2, 0x6b, 0x0a, 0xc0, 0x05, 0x66, 0x05, 0x39, 0xc0, 0x3e,
+  0x39, 0x34, 0x39, 0xc0, 0x05, 0x7a, 0x39, 0x3e, 0x0a, 0xc1, 0x6f, 0x6e, 0x6f, 0x66, 0xc0, 0x61,
+  0xc0, 0x16, 0x11, 0xc0, 0x0a, 0x05, 0x39, 0x34, 0x39, 0xc0, 0x34, 0x39, 0x2d, 0x34, 0xc0, 0x39,
+  0x3e, 0xc0, 0x05, 0xc0, 0x39, 0xc0, 0x05, 0xc0, 0x3e, 0xc1, 0x05, 0x0a, 0x05, 0x0a, 0xc0, 0x6e,
+  0x16, 0xc0, 0x0f, 0x0a, 0xc0, 0x05, 0x3e, 0x39, 0x3e, 0xc1, 0x05, 0x0a, 0xc4, 0x0f, 0x0a, 0x05,
+  0x6d, 0x3e, 0xc0, 0x03, 0x3e, 0xc0, 0x0a, 0xc3, 0x0f, 0xc1, 0x71, 0x61, 0xa2, 0x98, 0x74, 0x9e,
+  0xc7, 0x75, 0x6f, 0x61, 0x69, 0x1f, 0xa2, 0x68, 0x7f, 0x2b, 0x6e, 0x6e, 0xa2, 0x98, 0x51, 0x51,
+  0xab, 0x88, 0xa7, 0x88, 0x9c, 0x89, 0x96, 0x89, 0x1f, 0xa2, 0x88, 0x38, 0x35, 0x30, 0x55, 0x24,
+  0x30, 0x2b, 0x78, 0x6b, 0x57, 0xa2, 0x86, 0x30, 0x24, 0xa2, 0x89, 0x7d, 0x38, 0x6f, 0xa6, 0x97,
+  0xa4, 0x89, 0x9a, 0x89, 0x40, 0x7e, 0x62, 0xa4, 0x77, 0x20, 0x52, 0x00, 0xc0, 0xa0, 0xa9, 0x5a,
+  0x5a, 0x46, 0x5f, 0x6f, 0x9f, 0x59, 0x0f, 0x6b, 0xfe, 0x3b, 0xd2, 0x9e, 0xd6, 0xa5, 0x98, 0xa1,
+  0x59, 0x53, 0xa1, 0xa8, 0xa4, 0x77, 0xa4, 0x97, 0x2c, 0x3c, 0x04, 0xa5, 0x88, 0xa5, 0x89, 0x9d,
+  0x79, 0x51, 0x9d, 0x89, 0x9f, 0x69, 0xa3, 0xba, 0x6d, 0x7e, 0xa3, 0xa9, 0x50, 0x9f, 0xb9, 0x9e,
+  0x68, 0x4e, 0x7b, 0x3e, 0x32, 0x57, 0x2f, 0x36, 0x56, 0x69, 0x5a, 0x39, 0xa3, 0x97, 0xa2, 0xa7,
+  0xa3, 0xa9, 0x9b, 0x78, 0x7b, 0xaa, 0x87, 0x9d, 0x7a, 0x51, 0x54, 0xa3, 0xb8, 0xa2, 0x89, 0xa2,
+  0x9a, 0x7e, 0xa6, 0x75, 0x62, 0x99, 0x6a, 0x69, 0xa3, 0x98, 0x5a, 0x7b, 0x66, 0x58, 0x57, 0x05,
+  0x53, 0x98, 0x59, 0xab, 0xd5, 0x9a, 0x7c, 0x9d, 0x68, 0xa7, 0xb7, 0x96, 0x4a, 0x05, 0x0a, 0x9c,
+  0x68, 0x33, 0x45, 0x9a, 0x4a, 0x56, 0x5f, 0x55, 0x76, 0xa2, 0xa6, 0xa2, 0xa7, 0x52, 0x7e, 0x29,
+  0x5f, 0xa3, 0x98, 0x7e, 0xa6, 0xb7, 0xa1, 0x9a, 0x5a, 0x79, 0x6f, 0x9b, 0x7a, 0xa8, 0xd5, 0x93,
+  0x6e, 0xa2, 0x56, 0xa4, 0x86, 0x16, 0xa6, 0xa7, 0xa6, 0xc8, 0x66, 0xa2, 0x87, 0xa2, 0x97, 0xc2,
+  0x21, 0x31, 0xc0, 0x9c, 0x49, 0x99, 0x7b, 0x45, 0x9d, 0x89, 0x11, 0x67, 0x98, 0x3a, 0xa2, 0x97,
+  0x9b, 0x7b, 0x6d, 0x6b, 0x49, 0x56, 0xa1, 0xa7, 0xa6, 0xc6, 0xa0, 0x9a, 0x9d, 0x79, 0xa3, 0x97,
+  0xa7, 0xb7, 0x03, 0x52, 0xa5, 0xa6, 0xa2, 0x87, 0xa3, 0xb9, 0x9a, 0x7b, 0x98, 0x19, 0x48, 0xa1,
+  0xb8, 0xfe, 0x13, 0x93, 0xc5, 0x66, 0x17, 0xc0, 0x6e, 0xa2, 0x78, 0xc2, 0x6f, 0x69, 0x39, 0x6e,
+  0x39, 0x2d, 0x1c, 0xc0, 0x6f, 0x2d, 0x28, 0xc0, 0x2d, 0x32, 0x28, 0xc1, 0x39, 0x6f, 0xc2, 0x66,
+  0x05, 0xc0, 0x61, 0x7e, 0x34, 0x39, 0x05, 0x39, 0xc1, 0xa3, 0x78, 0x66, 0xc0, 0x6f, 0x6e, 0xc0,
+  0x6b, 0xc0, 0x6e, 0xc0, 0x22, 0xc0, 0x16, 0xc1, 0x66, 0x0a, 0x05, 0xc2, 0x00, 0x05, 0x00, 0x05,
+  0x16, 0x0f, 0x0a, 0xc1, 0x05, 0x00, 0x05, 0x0a, 0xc2, 0x0f, 0xc1, 0x16, 0xc1, 0x0f, 0x16, 0xc2,
+  0x0a, 0x05, 0x3e, 0x05, 0x0a, 0xc5, 0x05, 0xc0, 0x0a, 0x3e, 0xc3, 0x6e, 0x3e, 0xc2, 0x05, 0x3e,
+  0xc1, 0x03, 0x0f, 0x0a, 0x0f, 0x3e, 0xa0, 0xa8, 0x65, 0x66, 0x76, 0x69, 0x9f, 0xc8, 0x78, 0x7e,
+  0x5b, 0x1c, 0x7a, 0x69, 0x24, 0xaa, 0x98, 0xa5, 0x39, 0x99, 0x7a, 0x9b, 0xd8, 0x1f, 0xa2, 0x78,
+  0x69, 0x67, 0xa8, 0x76, 0xa2, 0x88, 0x9d, 0x99, 0x29, 0xa1, 0x9a, 0x65, 0xa4, 0x88, 0x59, 0xa4,
+  0x88, 0xa0, 0x6a, 0x9c, 0x78, 0xa2, 0x88, 0x7a, 0x9f, 0xb8, 0xa3, 0x88, 0xa2, 0x98, 0xa5, 0x88,
+  0x9b, 0x88, 0x67, 0x00, 0xc0, 0x27, 0x9c, 0x98, 0xa2, 0x68, 0x2a, 0x9d, 0xa9, 0x55, 0xa3, 0x69,
+  0x5f, 0x46, 0x0a, 0xc0, 0x6e, 0x0a, 0x0f, 0x79, 0xfe, 0x43, 0xd2, 0x6f, 0xa2, 0x59, 0xa2, 0x95,
+  0xa5, 0xc8, 0x7a, 0x00, 0x9d, 0x4b, 0x40, 0x10, 0x79, 0xa2, 0x78, 0x01, 0x28, 0x9d, 0x8a, 0xa5,
+  0xb6, 0x5b, 0x9c, 0x99, 0x26, 0xa2, 0x87, 0xa3, 0xa9, 0xa2, 0xa6, 0x7e, 0x98, 0x5a, 0x4b, 0x7e,
+  0x1f, 0xa2, 0x99, 0xa2, 0xa7, 0x45, 0x56, 0x66, 0x36, 0xa0, 0xa7, 0xa2, 0x98, 0x25, 0x7b, 0xa3,
+  0x77, 0xa2, 0xa9, 0xa2, 0x77, 0x55, 0xa0, 0xa8, 0x97, 0x8a, 0x79, 0xae, 0x96, 0xa5, 0xbb, 0x9b,
+  0x89, 0x9c, 0x77, 0x54, 0x9d, 0x8a, 0x59, 0xa5, 0x89, 0x20, 0xa2, 0xa8, 0x35, 0x58, 0x6b, 0xa0,
+  0x57, 0xa4, 0x99, 0x99, 0x7b, 0x9c, 0x58, 0xa8, 0xb7, 0x9d, 0x9a, 0x69, 0x79, 0x9a, 0x69, 0xa3,
+  0x98, 0x7e, 0x5b, 0x41, 0x47, 0x9f, 0x59, 0x7e, 0x52, 0x69, 0xa2, 0xc7, 0xa2, 0x97, 0x4f, 0x9d,
+  0x8a, 0x66, 0xa5, 0xa7, 0xa3, 0xb8, 0xa3, 0xa9, 0x6f, 0xa3, 0x96, 0xa4, 0x98, 0x9c, 0x7a, 0x9d,
+  0x88, 0xa2, 0x97, 0x9d, 0x79, 0xa7, 0xb7, 0x9c, 0x8b, 0x9d, 0x79, 0x22, 0xa4, 0xb6, 0xa5, 0xa7,
+  0xc0, 0x56, 0x9e, 0x69, 0x9d, 0x99, 0x9e, 0x67, 0x9c, 0x5a, 0x9c, 0x69, 0x65, 0xa3, 0x97, 0x9e,
+  0x6a, 0x9b, 0x6a, 0xa2, 0xa7, 0xa6, 0xb6, 0xa2, 0x98, 0x99, 0x7b, 0x45, 0xa6, 0xb6, 0xa9, 0xd7,
+  0x8f, 0x0e, 0x6c, 0x2b, 0x96, 0x1c, 0x97, 0x4a, 0x14, 0x1b, 0xa9, 0xd7, 0x22, 0x9c, 0x79, 0x0a,
+  0xa3, 0x98, 0x9d, 0x8a, 0xa3, 0xb7, 0x9d, 0x7a, 0x97, 0x1b, 0x99, 0x49, 0x61, 0xa5, 0xa7, 0xa2,
+  0xa8, 0xfe, 0x13, 0x72, 0xc7, 0x6e, 0x6f, 0xa2, 0x78, 0xc4, 0xa2, 0x78, 0x66, 0x61, 0x66, 0x65,
+  0xc0, 0x1c, 0xc3, 0x28, 0xc0, 0x23, 0xc0, 0x2d, 0x6b, 0x39, 0xc4, 0x3e, 0x39, 0xc0, 0x7a, 0x39,
+  0xc1, 0x6f, 0x39, 0x6b, 0x05, 0x6e, 0x6f, 0xc0, 0x66, 0x16, 0xa2, 0x78, 0xa2, 0x77, 0x66, 0x27,
+  0xa2, 0x97, 0x5a, 0x62, 0xc0, 0x27, 0x66, 0x16, 0xc2, 0x11, 0x6d, 0x6f, 0xc0, 0x16, 0x11, 0x0a,
+  0x16, 0xc0, 0x0a, 0xc0, 0x11, 0x16, 0xc6, 0x0a, 0x16, 0xc4, 0x0a, 0x05, 0xc0, 0x0a, 0xc0, 0x05,
+  0xc0, 0x0a, 0xc1, 0x05, 0x3e, 0xc1, 0x39, 0xc1, 0x3e, 0x6e, 0x3e, 0xc2, 0x39, 0x7e, 0xc0, 0x55,
+  0x3e, 0x39, 0xc0, 0x2d, 0x01, 0x3e, 0x03, 0x3e, 0xc0, 0x39, 0x01, 0x9f, 0xb8, 0x9e, 0xc6, 0x9f,
+  0xb8, 0x66, 0x55, 0x6e, 0xaa, 0x88, 0xa3, 0x4a, 0xa1, 0x59, 0x9c, 0xd7, 0x98, 0xc7, 0x1f, 0x6f,
+  0x6e, 0xa5, 0x88, 0xa1, 0xa8, 0x5a, 0x9b, 0xa9, 0x27, 0xa2, 0x78, 0xc0, 0xa3, 0x88, 0xa4, 0x88,
+  0x6f, 0x9a, 0x88, 0x56, 0xa3, 0xa8, 0x9d, 0xa9, 0x6e, 0x34, 0x7f, 0x41, 0x9d, 0x79, 0x5f, 0xc0,
+  0x5a, 0x56, 0xa2, 0x78, 0x6f, 0x6f, 0x6e, 0x9f, 0x69, 0x46, 0x1b, 0x69, 0xa1, 0xa9, 0x52, 0x3e,
+  0x6e, 0x6f, 0x71, 0x7a, 0x20, 0x9b, 0xd8, 0xa2, 0xf5, 0xa9, 0x98, 0x9e, 0x6a, 0x9d, 0x49, 0x47,
+  0x55, 0x9e, 0xc6, 0x72, 0x0b, 0xa2, 0x69, 0xc0, 0x66, 0x6d, 0x1c, 0x56, 0x7a, 0xa2, 0x97, 0xa2,
+  0x98, 0xa5, 0xa8, 0x61, 0x9a, 0x5a, 0x5e, 0xc1, 0xa3, 0xa8, 0x61, 0x51, 0xa3, 0xa7, 0x7f, 0x6b,
+  0xa7, 0x97, 0x66, 0xa2, 0x77, 0x31, 0x7d, 0xa2, 0x98, 0x9a, 0x89, 0xa6, 0xa8, 0x51, 0x6d, 0xa4,
+  0x97, 0xa5, 0x99, 0x46, 0x60, 0x56, 0x66, 0x9d, 0x9a, 0x5d, 0xa3, 0x78, 0x30, 0xa4, 0xa9, 0x99,
+  0x7b, 0xa0, 0x64, 0x6b, 0x7f, 0x9b, 0x69, 0x15, 0x9f, 0x8b, 0x99, 0x68, 0xa6, 0xa6, 0x7e, 0x9c,
+  0x89, 0x7b, 0x6d, 0xa2, 0x79, 0x9e, 0x59, 0x55, 0x47, 0x6f, 0x69, 0x9d, 0x8a, 0xa5, 0xd7, 0x9e,
+  0xb7, 0x9f, 0x68, 0xa2, 0x78, 0xa8, 0xa8, 0x42, 0x01, 0xa6, 0xb6, 0x7a, 0x9f, 0x8b, 0x41, 0x58,
+  0xa0, 0x8a, 0x9c, 0x89, 0xa2, 0x86, 0xa7, 0xa8, 0xa1, 0xa8, 0x7e, 0x52, 0xa2, 0x97, 0x7e, 0x42,
+  0x9b, 0x59, 0x99, 0x5b, 0x98, 0x69, 0xa2, 0x87, 0x7f, 0x9d, 0x8a, 0xa2, 0x77, 0x56, 0x6d, 0xa4,
+  0xa8, 0x9d, 0x7a, 0xa3, 0xa6, 0xa1, 0xa9, 0xc0, 0xa1, 0xa8, 0x6b, 0x9b, 0x59, 0xc0, 0x9e, 0x69,
+  0xa0, 0xb7, 0xa4, 0x86, 0x08, 0x1a, 0xa3, 0xa7, 0xa2, 0x99, 0xa2, 0xa7, 0xa4, 0x97, 0xa4, 0xa7,
+  0x31, 0x26, 0x9a, 0x5a, 0x9d, 0x69, 0x98, 0x6b, 0x9b, 0x59, 0xa4, 0x95, 0x33, 0x1c, 0xa4, 0xb7,
+  0xfe, 0x13, 0x72, 0xc0, 0x66, 0xc0, 0x0b, 0xc3, 0x6e, 0x6f, 0xa2, 0x78, 0xc0, 0x66, 0x2d, 0xc1,
+  0x6f, 0x2d, 0x1c, 0x66, 0xc0, 0x1c, 0xc3, 0x17, 0x1c, 0x6b, 0x28, 0x23, 0x1c, 0x28, 0x2d, 0xc0,
+  0x39, 0x66, 0x39, 0x34, 0xc0, 0x39, 0xc0, 0x34, 0x39, 0x6f, 0x39, 0x6b, 0x6d, 0x05, 0xc1, 0x6e,
+  0x05, 0xc0, 0x0a, 0x6f, 0x6e, 0xc0, 0xa2, 0x78, 0xa2, 0x98, 0x6e, 0xa0, 0xa8, 0xa2, 0x97, 0x67,
+  0x9e, 0x67, 0x46, 0x66, 0x52, 0xc0, 0x6e, 0x22, 0x27, 0xc0, 0x22, 0x1b, 0x16, 0x1b, 0xc0, 0x16,
+  0xcf, 0x0a, 0xc4, 0x05, 0xc0, 0x0a, 0xc0, 0x05, 0x3e, 0xc3, 0x39, 0xc2, 0x3e, 0xc0, 0x65, 0xc0,
+  0x2d, 0x32, 0x7e, 0xa2, 0x98, 0x9d, 0x89, 0x32, 0xc0, 0x67, 0x39, 0x32, 0xc1, 0x2d, 0x32, 0xa2,
+  0x78, 0xa2, 0x78, 0xfe, 0x43, 0xf1, 0x9c, 0xc8, 0x56, 0xa2, 0x88, 0xa6, 0x68, 0xa7, 0x49, 0xc0,
+  0xa1, 0xc6, 0x97, 0xb9, 0x51, 0x6f, 0x61, 0x6f, 0x38, 0x51, 0x52, 0x7d, 0x66, 0x7f, 0x7f, 0x54,
+  0xa3, 0x88, 0x00, 0x33, 0xc0, 0x10, 0x42, 0x5a, 0x5f, 0x5f, 0x66, 0x59, 0x5f, 0x11, 0x7e, 0x11,
+  0x6b, 0x7f, 0x69, 0xa1, 0xa8, 0x5b, 0x9e, 0x57, 0x3a, 0xa2, 0xa9, 0xa3, 0x86, 0x20, 0x3e, 0xa2,
+  0x78, 0xc1, 0x6f, 0x9d, 0xd8, 0xfe, 0x74, 0x92, 0xa1, 0x9a, 0x9f, 0x49, 0xa2, 0x49, 0x6f, 0xa0,
+  0xa7, 0xa0, 0x8a, 0x40, 0x09, 0x35, 0x7f, 0x7e, 0xa0, 0xa7, 0x0c, 0xa1, 0xa8, 0x5a, 0x55, 0x7b,
+  0xa2, 0x87, 0xa3, 0xb9, 0xa3, 0xb7, 0x05, 0x9d, 0x79, 0x1c, 0xa4, 0xb7, 0xa2, 0x98, 0xa4, 0x97,
+  0xa1, 0xaa, 0xa2, 0x76, 0xa4, 0xa9, 0x9b, 0x89, 0x1d, 0x9d, 0x88, 0xa5, 0xa8, 0x98, 0x9b, 0x9c,
+  0x68, 0xac, 0xa7, 0x92, 0x6a, 0xae, 0xa4, 0x9d, 0xab, 0xa3, 0x75, 0xa1, 0x9a, 0x30, 0x6e, 0x6f,
+  0x67, 0x51, 0xc0, 0xa2, 0x77, 0x51, 0x62, 0xa3, 0x88, 0x51, 0x5b, 0x9c, 0x89, 0x51, 0xad, 0xb6,
+  0xa2, 0xaa, 0x93, 0x1b, 0x9c, 0x87, 0xa2, 0xb6, 0xa2, 0x68, 0xa5, 0xa9, 0x9d, 0x89, 0x9d, 0x68,
+  0x9c, 0x4a, 0x46, 0xa4, 0xc7, 0x9f, 0x69, 0xa1, 0xa9, 0xc0, 0xa3, 0xa6, 0xa4, 0xd7, 0x66, 0x9c,
+  0x4a, 0xa8, 0xb6, 0xa4, 0xa7, 0x57, 0x7f, 0x9c, 0x68, 0xa7, 0xa6, 0xc0, 0x67, 0x01, 0x0c, 0x77,
+  0xa2, 0x87, 0xa2, 0xa7, 0x52, 0x31, 0x56, 0x32, 0x9a, 0x59, 0x9e, 0x67, 0x30, 0x9c, 0x49, 0xa7,
+  0xc7, 0xa5, 0xb8, 0x95, 0x4d, 0x99, 0x48, 0xa8, 0xb5, 0x9b, 0x6c, 0x9c, 0x78, 0xa6, 0xc6, 0xa3,
+  0x78, 0xa0, 0xa9, 0xa1, 0xa8, 0xa5, 0xb8, 0x76, 0x45, 0x9d, 0x4a, 0x9a, 0x7a, 0x50, 0x49, 0x46,
+  0xa4, 0xa6, 0xa3, 0xb9, 0xa4, 0xa6, 0x9b, 0x5a, 0x7b, 0xa3, 0xa8, 0x7d, 0xa4, 0x98, 0x93, 0x2d,
+  0x0c, 0xa3, 0x98, 0x7b, 0x19, 0xa3, 0xa7, 0x7b, 0xa6, 0xc7, 0xa8, 0xd6, 0xfe, 0x13, 0x72, 0xc7,
+  0xa2, 0x77, 0x6b, 0x6f, 0x6e, 0x28, 0xc0, 0x2d, 0x6f, 0x66, 0x28, 0x1c, 0x66, 0xc0, 0x1c, 0xc4,
+  0x17, 0x6f, 0xc2, 0x28, 0x23, 0x1c, 0x28, 0xc0, 0x34, 0x39, 0x34, 0xc3, 0x39, 0xc2, 0x6b, 0x6e,
+  0x69, 0xc0, 0x05, 0xc0, 0x6e, 0x6b, 0x0a, 0x6f, 0x6e, 0x16, 0xa2, 0x78, 0x7e, 0x7e, 0xa1, 0xa8,
+  0x6f, 0x59, 0x7a, 0xa1, 0xa9, 0x5a, 0x0e, 0x49, 0x66, 0x56, 0x56, 0xc1, 0x27, 0x66, 0x1b, 0xc0,
+  0x66, 0x1b, 0xc1, 0x16, 0xc0, 0x69, 0x16, 0xc1, 0x0f, 0x0a, 0x16, 0x0f, 0x0a, 0xc1, 0x05, 0x0a,
+  0xc1, 0x05, 0x39, 0x3e, 0xc2, 0x39, 0x3e, 0xc0, 0x39, 0xc1, 0x2d, 0xc0, 0x6e, 0x39, 0x32, 0x2d,
+  0x7a, 0x2d, 0xc0, 0x7e, 0x32, 0x2d, 0xc0, 0x32, 0x2d, 0x69, 0x2d, 0x32, 0xa2, 0x88, 0x6f, 0x55,
+  0x9d, 0xf8, 0x9b, 0xc7, 0xc0, 0xa6, 0x88, 0xa7, 0x88, 0x4a, 0x52, 0x9b, 0xc8, 0x5d, 0x9c, 0x99,
+  0xa2, 0x77, 0xa5, 0x88, 0x77, 0x9a, 0x78, 0x76, 0x1f, 0x69, 0xa1, 0x6a, 0xa2, 0x5a, 0x5e, 0x7a,
+  0x9f, 0xb8, 0xa2, 0x88, 0x03, 0xa2, 0x68, 0x6f, 0x7a, 0x1d, 0x0f, 0x71, 0xa1, 0xb7, 0xa1, 0xa9,
+  0x08, 0xc0, 0x00, 0xc2, 0x6e, 0x6b, 0x7a, 0x49, 0x0c, 0x66, 0x01, 0x59, 0x6f, 0x6f, 0xc1, 0x0a,
+  0xa0, 0xd6, 0xa1, 0xf7, 0x5e, 0xa1, 0x4a, 0x0f, 0x62, 0x0c, 0xa3, 0x77, 0xa1, 0xd9, 0x45, 0x9e,
+  0x68, 0x9d, 0x9a, 0xc0, 0x08, 0x66, 0x00, 0xa2, 0x98, 0x56, 0x0c, 0x7f, 0xa1, 0xb7, 0xa3, 0x98,
+  0xa3, 0x98, 0x9d, 0x99, 0x36, 0xa3, 0xb7, 0xa3, 0xa8, 0xa2, 0x77, 0xa5, 0x99, 0xa3, 0x98, 0x51,
+  0x98, 0x99, 0x59, 0xa3, 0x98, 0xa1, 0xa8, 0x42, 0x57, 0x30, 0xa9, 0xb6, 0x9c, 0x99, 0x9f, 0x6a,
+  0xa2, 0x87, 0x76, 0x9d, 0x88, 0xa2, 0x78, 0xa2, 0x87, 0xc0, 0xa2, 0x88, 0x7b, 0x5a, 0x9d, 0x89,
+  0x51, 0x6f, 0xa2, 0x88, 0xa8, 0xa7, 0x63, 0x9d, 0x69, 0x9b, 0x69, 0xa6, 0xa7, 0x99, 0x5a, 0x9c,
+  0x59, 0x69, 0x9d, 0xa8, 0xa4, 0x87, 0xa4, 0x98, 0x63, 0x9e, 0x57, 0x5a, 0x53, 0x56, 0x5d, 0x42,
+  0xa0, 0xa7, 0xa8, 0xf6, 0xc0, 0xa6, 0x76, 0x57, 0x9d, 0x9a, 0xa2, 0x87, 0xa8, 0xd7, 0x9c, 0x69,
+  0x34, 0xa8, 0xb6, 0x9b, 0x89, 0xa2, 0x77, 0xa3, 0x99, 0xa3, 0xb7, 0xa2, 0x98, 0x7a, 0xc1, 0x9d,
+  0x7a, 0x99, 0x6b, 0x9c, 0x58, 0x9c, 0x79, 0x56, 0x41, 0xa4, 0x96, 0x3f, 0x1d, 0x95, 0x1b, 0xa2,
+  0x85, 0xa3, 0xa9, 0xa3, 0xb8, 0xa4, 0xb7, 0xa3, 0xa8, 0xa5, 0xb7, 0x7e, 0xc1, 0x9b, 0x9b, 0x9c,
+  0x5a, 0xa2, 0x66, 0x99, 0x7b, 0x9a, 0x39, 0xa3, 0x87, 0xa3, 0xc8, 0x99, 0x6c, 0x9b, 0x48, 0xa4,
+  0xd6, 0xab, 0xc5, 0x43, 0xc0, 0xa8, 0xd6, 0x94, 0x3d, 0x9d, 0x48, 0xaa, 0xc4, 0x9f, 0xba, 0x95,
+  0x2c, 0x9f, 0x67, 0xa1, 0xb8, 0xac, 0xd4, 0xaa, 0xf7, 0x9e, 0x69, 0xfe, 0x13, 0x72, 0x66, 0x0b,
+  0xc4, 0x6e, 0x6f, 0x6e, 0x6b, 0x6e, 0x28, 0xc0, 0x2d, 0xc0, 0x28, 0x61, 0xc3, 0x1c, 0x28, 0x1c,
+  0xc1, 0x6b, 0xc1, 0x1c, 0x23, 0x1c, 0xc0, 0x21, 0x7f, 0xc0, 0x5e, 0x67, 0xc0, 0x2d, 0xc1, 0x34,
+  0x6e, 0xc5, 0x6e, 0x6b, 0xc3, 0x6e, 0xc2, 0x6b, 0x6e, 0x6e, 0x16, 0xc0, 0xa2, 0x88, 0xa3, 0x87,
+  0xa0, 0xa8, 0x6e, 0x7f, 0x7e, 0x66, 0x9d, 0x68, 0x46, 0xa2, 0x99, 0xc0, 0x9d, 0x89, 0x66, 0xc2,
+  0x27, 0xc0, 0x1b, 0x66, 0xc1, 0x11, 0x0a, 0xc6, 0x3e, 0x05, 0xc0, 0x3e, 0x39, 0xc0, 0x3e, 0xc1,
+  0x39, 0xc0, 0x32, 0xc1, 0x39, 0x32, 0x2d, 0xc1, 0x32, 0x2d, 0xc0, 0x7a, 0x32, 0x2d, 0xc1, 0x6d,
+  0x2d, 0xc2, 0x32, 0xc0, 0xa0, 0xd7, 0xa0, 0xa7, 0x9c, 0xa8, 0x79, 0xa3, 0x8a, 0xa7, 0x77, 0xae,
+  0x87, 0x97, 0x99, 0x98, 0x89, 0x9c, 0xa7, 0x42, 0xa2, 0x78, 0xc0, 0x65, 0xa3, 0x99, 0x7e, 0xa3,
+  0x78, 0x24, 0x1f, 0xa3, 0x59, 0xa2, 0x2a, 0xa2, 0x89, 0x55, 0x55, 0x0a, 0x6e, 0x7e, 0x75, 0x7a,
+  0x6f, 0x66, 0x65, 0x9d, 0xb8, 0x55, 0xa3, 0x98, 0x7f, 0x56, 0x46, 0x56, 0x6d, 0x7f, 0xa1, 0xa8,
+  0x56, 0x5b, 0x45, 0x6e, 0x76, 0x4e, 0x6f, 0x0a, 0xa2, 0x77, 0x1b, 0x0a, 0xfe, 0x4b, 0xf3, 0xaa,
+  0xd4, 0x9b, 0x5b, 0x9d, 0x1b, 0x0f, 0x3e, 0x04, 0x5d, 0x3a, 0x0c, 0x00, 0xa1, 0xb9, 0x5e, 0x9d,
+  0x89, 0x00, 0x0b, 0x56, 0x33, 0xa3, 0xa8, 0xa2, 0xa7, 0xa2, 0x76, 0xa1, 0xb9, 0x5a, 0x5b, 0x65,
+  0xc0, 0xa4, 0x98, 0x46, 0x65, 0x76, 0xa6, 0xb6, 0xa3, 0xa9, 0x9b, 0x69, 0x6e, 0xa2, 0x87, 0x9d,
+  0x99, 0x9b, 0x79, 0xa4, 0x86, 0x3b, 0x9c, 0x78, 0x6e, 0x7a, 0xa3, 0x98, 0xa2, 0x89, 0x9d, 0x99,
+  0x59, 0x3b, 0x65, 0xa6, 0x86, 0xa4, 0x9a, 0x7f, 0x67, 0xa4, 0x76, 0xa4, 0x98, 0x95, 0x7c, 0x9e,
+  0x66, 0xa8, 0xb6, 0x9a, 0x5b, 0x9c, 0x49, 0x9d, 0x69, 0x9d, 0x88, 0xa3, 0xc8, 0x65, 0x9f, 0x69,
+  0x7f, 0x5a, 0x47, 0xa8, 0xc4, 0xa8, 0xf8, 0x97, 0x3c, 0xfe, 0x25, 0x1a, 0xa2, 0xb7, 0x5a, 0xa2,
+  0xa6, 0xa1, 0xb9, 0xa2, 0xa6, 0x72, 0xaa, 0x76, 0xa5, 0xc8, 0xa2, 0x98, 0x9a, 0x6b, 0x99, 0x48,
+  0xa5, 0xa7, 0x62, 0x9d, 0x89, 0xa4, 0xa8, 0xa6, 0x96, 0xa4, 0xb7, 0xc0, 0x5a, 0x31, 0xc0, 0x97,
+  0x6d, 0x9e, 0x57, 0xa4, 0xa7, 0xa2, 0x98, 0x9c, 0x6a, 0x32, 0xa3, 0xb8, 0x99, 0x5b, 0x9b, 0x58,
+  0x9e, 0x68, 0xad, 0xf6, 0x31, 0x9b, 0x8b, 0x9c, 0x59, 0x6e, 0x6d, 0x3f, 0x2e, 0x31, 0x9b, 0x6a,
+  0x98, 0x5b, 0x9d, 0x59, 0x9b, 0x58, 0xa2, 0x98, 0xaa, 0xf5, 0xa6, 0xc7, 0x36, 0x9f, 0x58, 0x76,
+  0xa1, 0xa7, 0xa4, 0x87, 0x2e, 0x9d, 0x8a, 0xfe, 0x45, 0x1b, 0xab, 0xc4, 0xa3, 0xb9, 0x97, 0x4b,
+  0x3b, 0xa4, 0xb8, 0xa2, 0x98, 0xa9, 0xc5, 0x67, 0x5a, 0xfe, 0x13, 0x72, 0x6f, 0xc5, 0x6e, 0xc0,
+  0x6f, 0xc0, 0x6e, 0x28, 0x2d, 0x6f, 0x2d, 0x62, 0x17, 0xc0, 0x66, 0x17, 0x1c, 0x23, 0xc1, 0x1c,
+  0x23, 0x28, 0xc0, 0x1c, 0xc4, 0x28, 0xc0, 0x2d, 0xc0, 0x28, 0xc2, 0x39, 0xc0, 0x66, 0x39, 0xc3,
+  0x6f, 0xc3, 0x69, 0x05, 0x6e, 0xc2, 0x6b, 0x0a, 0x6f, 0xc0, 0x11, 0x16, 0xc0, 0x6e, 0x6e, 0x7f,
+  0x6e, 0xc0, 0x56, 0xa1, 0xa8, 0xc0, 0x2f, 0x1b, 0x6f, 0xc0, 0x1b, 0xc2, 0x16, 0x1b, 0x16, 0x11,
+  0x0a, 0xc5, 0x05, 0x3e, 0xc1, 0x39, 0xc1, 0x3e, 0xc1, 0x39, 0xc0, 0x69, 0xc0, 0x39, 0x32, 0x2d,
+  0xc0, 0x32, 0x2d, 0xc3, 0x32, 0x69, 0x2d, 0x7e, 0x2d, 0xc0, 0xa2, 0x77, 0x32, 0x67, 0xa0, 0xa6,
+  0x9e, 0xd7, 0x9f, 0xb7, 0x6f, 0xa2, 0x87, 0xa5, 0x79, 0xab, 0xa9, 0xa4, 0x67, 0x9a, 0x87, 0x98,
+  0x99, 0x99, 0x99, 0x62, 0x1f, 0xc2, 0x65, 0xa2, 0x69, 0xa6, 0x67, 0x9d, 0xb9, 0x5f, 0xa0, 0x1a,
+  0x3e, 0xa1, 0xa8, 0xc0, 0x52, 0x3e, 0x06, 0x09, 0x06, 0xa2, 0x87, 0x66, 0x9f, 0xb8, 0x9f, 0xb9,
+  0x55, 0x46, 0x7a, 0xa3, 0x88, 0x7b, 0x9e, 0x68, 0x56, 0x5d, 0xa2, 0xa9, 0x7a, 0x45, 0x6b, 0x59,
+  0x7e, 0xa3, 0x99, 0x9e, 0x69, 0x0a, 0xa2, 0x77, 0x66, 0xa0, 0xb8, 0xa0, 0xd5, 0x9e, 0xc7, 0xa6,
+  0x49, 0x9e, 0x2b, 0x41, 0x35, 0x3d, 0x00, 0x56, 0xc1, 0x79, 0x7e, 0x0b, 0xc0, 0x08, 0x7f, 0xa2,
+  0x88, 0xa0, 0xa7, 0x6e, 0xa0, 0xa9, 0x69, 0x9f, 0x69, 0x52, 0x6e, 0x6e, 0x17, 0x56, 0xa0, 0xa7,
+  0xa6, 0xa6, 0xa5, 0xa8, 0xa0, 0xa9, 0xa0, 0x57, 0x9c, 0x6a, 0x9b, 0x89, 0x55, 0x0e, 0xa5, 0xc7,
+  0xa2, 0x77, 0x00, 0x9d, 0x8a, 0xa3, 0xa6, 0xa7, 0xb8, 0xa3, 0x88, 0xa2, 0x88, 0x9d, 0x9a, 0x51,
+  0xa4, 0x77, 0x52, 0xa4, 0x77, 0xa7, 0xa8, 0xa4, 0xa8, 0x9c, 0x7a, 0x55, 0x7e, 0x99, 0x6a, 0x9a,
+  0x69, 0xa5, 0x88, 0x62, 0x9a, 0x59, 0x7c, 0x66, 0xa1, 0xa8, 0x9d, 0x5a, 0x5e, 0xa2, 0xa9, 0x9f,
+  0x68, 0xa0, 0x58, 0xa4, 0xd7, 0xa3, 0xb8, 0x9c, 0x59, 0x9d, 0x6a, 0x65, 0xa2, 0x88, 0xa3, 0x98,
+  0x65, 0xa2, 0xb8, 0xa4, 0xb7, 0xa7, 0xb7, 0xa3, 0x98, 0x66, 0x96, 0x4c, 0xa2, 0x76, 0x7e, 0xa2,
+  0x97, 0xa2, 0x98, 0xa2, 0x98, 0x31, 0xc3, 0x14, 0x21, 0x31, 0xc3, 0x99, 0x5c, 0x93, 0x1b, 0xaa,
+  0xd4, 0xa9, 0xc7, 0x31, 0xc0, 0x92, 0x1c, 0x98, 0x3a, 0xa7, 0xb6, 0xa5, 0xd7, 0x9b, 0x6b, 0x9c,
+  0x5a, 0xa3, 0xa6, 0x9d, 0x79, 0x59, 0xa3, 0xc8, 0xa2, 0x89, 0xa1, 0xa8, 0xa3, 0xb9, 0x9d, 0x58,
+  0x9b, 0x5a, 0x2c, 0xa6, 0xb6, 0x9d, 0x6b, 0x6d, 0x26, 0x97, 0x6b, 0x9a, 0x4a, 0xa5, 0x96, 0xa0,
+  0xa9, 0x0f, 0xa2, 0x97, 0x41, 0x52, 0x18, 0x28, 0xa2, 0xa9, 0xfe, 0x13, 0x93, 0x6f, 0xc2, 0x17,
+  0xc0, 0x23, 0x6e, 0xc0, 0x6e, 0xc2, 0x6f, 0x6e, 0x2d, 0x28, 0x7a, 0x17, 0xc1, 0x6e, 0xc0, 0x23,
+  0xa2, 0x87, 0x28, 0xc0, 0x2d, 0xc0, 0x28, 0xc0, 0x23, 0x28, 0x1c, 0xc0, 0x23, 0xc0, 0x28, 0x2d,
+  0x23, 0xc0, 0x28, 0x2d, 0x39, 0x2d, 0x6b, 0xc2, 0x39, 0xc0, 0x3e, 0x6f, 0xc1, 0x66, 0xc1, 0x0a,
+  0xc1, 0x05, 0x0a, 0x05, 0x0a, 0x6e, 0x0a, 0xc0, 0x6f, 0x0a, 0xc0, 0x16, 0xc0, 0xa2, 0x78, 0x65,
+  0x16, 0xc0, 0x1b, 0x16, 0xc1, 0x0a, 0xc1, 0x16, 0xc0, 0x1b, 0x16, 0xc0, 0x0a, 0xc3, 0x3e, 0xc0,
+  0x05, 0x3e, 0xc0, 0x39, 0xc3, 0x3e, 0xc0, 0x39, 0x69, 0xc1, 0x39, 0x32, 0x2d, 0xc3, 0x32, 0xc1,
+  0x2d, 0xc0, 0x32, 0x39, 0x3e, 0x32, 0x71, 0x7e, 0x9d, 0xc7, 0x9f, 0xb7, 0xa2, 0xa8, 0xa2, 0x79,
+  0x5a, 0xa3, 0x98, 0xa6, 0x68, 0x6e, 0xa0, 0xa8, 0x98, 0x99, 0x98, 0x89, 0xa5, 0x87, 0x33, 0x9d,
+  0x98, 0x6f, 0xc0, 0x61, 0x6f, 0xa4, 0x1a, 0xa5, 0x98, 0xa2, 0xa7, 0x7e, 0x9a, 0x3a, 0x55, 0x7b,
+  0x4a, 0x7e, 0xa2, 0x97, 0x67, 0x6e, 0xa1, 0xa8, 0x04, 0x65, 0x79, 0xa2, 0x98, 0x56, 0x45, 0xa2,
+  0x99, 0x0b, 0x66, 0x6f, 0x49, 0x56, 0x7a, 0x38, 0x3a, 0xc0, 0xa2, 0xa9, 0x2b, 0xa0, 0x58, 0x9e,
+  0x69, 0xc0, 0x09, 0x9d, 0xe7, 0x9f, 0xd8, 0x07, 0x3d, 0x0a, 0x7a, 0x3d, 0x3b, 0x7d, 0x3b, 0x65,
+  0xc1, 0x56, 0x2c, 0xa3, 0x98, 0x7f, 0xa2, 0xa7, 0xa1, 0xa8, 0xa2, 0x88, 0x9e, 0x68, 0x42, 0x46,
+  0x66, 0x08, 0x03, 0x12, 0x1f, 0x66, 0x2a, 0xa5, 0xb7, 0xa7, 0x97, 0x9c, 0x8a, 0x9a, 0x5a, 0x9b,
+  0x89, 0x06, 0xa2, 0x97, 0xa3, 0xa7, 0xa2, 0x98, 0xa5, 0x98, 0x09, 0x70, 0xa9, 0xa7, 0x7b, 0x6e,
+  0x41, 0xa7, 0xa8, 0xa1, 0x9a, 0x9a, 0x87, 0xa5, 0x77, 0xa3, 0xaa, 0x9d, 0x9b, 0x9f, 0x57, 0xa8,
+  0x96, 0xa1, 0xca, 0x9d, 0x7a, 0x9c, 0x78, 0xa2, 0x87, 0x9c, 0x6b, 0x99, 0x68, 0xa9, 0xb7, 0x97,
+  0x6b, 0x9c, 0x77, 0xa2, 0x87, 0x5a, 0xa1, 0x7a, 0x5a, 0xa4, 0xb6, 0x57, 0x9a, 0x5a, 0x7d, 0x56,
+  0x1c, 0xa3, 0xb8, 0x9f, 0x59, 0x1c, 0xa5, 0xb7, 0x46, 0x13, 0xae, 0xd5, 0xa1, 0xc9, 0x9c, 0x8a,
+  0x9a, 0x4a, 0x59, 0xa2, 0x87, 0x66, 0xa6, 0x96, 0x53, 0xa5, 0xb6, 0x66, 0xc0, 0x2e, 0x31, 0x42,
+  0x56, 0x29, 0x9d, 0x79, 0xa2, 0x77, 0x9d, 0xaa, 0x46, 0x9c, 0x6a, 0x98, 0x39, 0xa3, 0xa7, 0x20,
+  0x13, 0x1a, 0x9d, 0x6a, 0x99, 0x3a, 0xa7, 0xe6, 0xab, 0xe5, 0xa0, 0xb9, 0x96, 0x2d, 0x99, 0x39,
+  0x00, 0x9d, 0x8a, 0xa1, 0xa8, 0xfe, 0xdf, 0x7d, 0x19, 0x99, 0x7b, 0x9b, 0x49, 0x9e, 0x68, 0xa2,
+  0x98, 0xa3, 0xa7, 0xa3, 0xa8, 0x21, 0xa7, 0xb5, 0x9c, 0x7b, 0x9b, 0x79, 0xaa, 0xd4, 0x9d, 0x6b,
+  0x9e, 0x59, 0xa2, 0xa7, 0x9a, 0x3b, 0x58, 0xa4, 0xd6, 0xa7, 0xd7, 0x9f, 0x8b, 0x97, 0x5b, 0xfe,
+  0x13, 0xb4, 0xc1, 0x6e, 0xc2, 0x6e, 0x6b, 0xc1, 0x2d, 0xc1, 0x6f, 0x6e, 0x2d, 0x28, 0xc0, 0x65,
+  0xc2, 0x23, 0x28, 0xc0, 0x2d, 0x39, 0xc0, 0x34, 0xc1, 0x39, 0x2d, 0x23, 0x28, 0x23, 0xc0, 0x28,
+  0x2d, 0x28, 0x2d, 0x28, 0x39, 0x3e, 0x34, 0xc1, 0x2d, 0x34, 0x39, 0xc1, 0x6f, 0xc0, 0x6e, 0x6e,
+  0x0a, 0x05, 0xc1, 0x6f, 0x0a, 0x6f, 0xc0, 0x11, 0x0a, 0xc1, 0x0f, 0xc3, 0x16, 0xc0, 0x0f, 0xc0,
+  0x0a, 0x05, 0xc3, 0x0a, 0xc1, 0x16, 0x6e, 0x16, 0x0f, 0xc0, 0x0a, 0x0f, 0x0a, 0x3e, 0x0a, 0xc0,
+  0x3e, 0x39, 0xc1, 0x69, 0x39, 0x3e, 0x39, 0x3e, 0xa2, 0x88, 0x7a, 0x55, 0x3e, 0xc0, 0x2d, 0x39,
+  0xc0, 0x32, 0xc1, 0x39, 0x3e, 0xc2, 0x79, 0x7a, 0x9e, 0xb7, 0x9d, 0xa8, 0x9e, 0xb8, 0x7a, 0x69,
+  0x7f, 0xa2, 0x78, 0xc0, 0xa3, 0x78, 0xc0, 0xa5, 0x98, 0xa3, 0x88, 0x9a, 0x99, 0x9d, 0x99, 0xa2,
+  0x87, 0xa3, 0x89, 0x1f, 0x55, 0x7e, 0xc0, 0x9f, 0x6a, 0xa5, 0x69, 0xa1, 0x6a, 0x32, 0xa2, 0x88,
+  0x79, 0xa1, 0xa9, 0x46, 0x6e, 0x15, 0x45, 0x09, 0x0e, 0x7f, 0xa2, 0xb7, 0x9b, 0x79, 0xc1, 0x56,
+  0x3a, 0x38, 0x7f, 0xa1, 0xa8, 0x69, 0xc0, 0x12, 0x3d, 0x4a, 0x32, 0x6f, 0xc0, 0x7f, 0x0a, 0x0f,
+  0x7a, 0x9d, 0xe7, 0x9d, 0xe8, 0xa2, 0x76, 0x4b, 0x00, 0x03, 0x9f, 0xb9, 0x78, 0x72, 0x4a, 0x9f,
+  0xb9, 0x5e, 0x5e, 0x56, 0x56, 0x6e, 0x29, 0xa1, 0xb8, 0xa6, 0x87, 0xa2, 0xb8, 0x65, 0x9c, 0x5a,
+  0x9e, 0x48, 0xa1, 0xb9, 0x6f, 0x9e, 0x57, 0x0e, 0xa0, 0xb8, 0x75, 0xa4, 0xa7, 0xa2, 0x98, 0xc0,
+  0xa3, 0x87, 0x52, 0x42, 0x50, 0x9d, 0x89, 0xa5, 0xb8, 0xa8, 0xa6, 0x7f, 0xa2, 0x97, 0xc0, 0x5a,
+  0x76, 0x40, 0xa3, 0x8a, 0x9d, 0x99, 0x5a, 0xa5, 0x98, 0x53, 0x9e, 0x76, 0xa8, 0x98, 0xa3, 0xa9,
+  0x9a, 0x79, 0x9e, 0x69, 0xaa, 0xa5, 0xa2, 0xa8, 0xc0, 0x9a, 0x7b, 0x9e, 0x68, 0x9c, 0x47, 0xa3,
+  0xb9, 0xa2, 0x87, 0x94, 0x3c, 0x9d, 0x78, 0xa3, 0xa7, 0x6f, 0xa0, 0xa7, 0x66, 0xa7, 0xa6, 0x02,
+  0x99, 0x49, 0x9f, 0x59, 0x7b, 0x6d, 0x7a, 0x5b, 0x7a, 0xa2, 0x87, 0xa3, 0xa8, 0xa0, 0xb9, 0x28,
+  0xa6, 0xb7, 0x97, 0x6c, 0x59, 0xa6, 0xa7, 0x9c, 0x68, 0x0e, 0xa1, 0xa8, 0x56, 0xa4, 0x86, 0x7a,
+  0x76, 0x9f, 0x69, 0x2e, 0x66, 0x31, 0x9b, 0x6b, 0x9d, 0x79, 0x9c, 0x7a, 0x6d, 0xa5, 0x97, 0x9a,
+  0x6a, 0x64, 0x9e, 0x59, 0x98, 0x6b, 0xa2, 0x86, 0xa2, 0x87, 0x9b, 0x5b, 0xa6, 0xb6, 0xa1, 0xc8,
+  0x6f, 0x7f, 0x9a, 0x49, 0x65, 0x2d, 0x28, 0x1e, 0x31, 0x09, 0xc0, 0x95, 0x3c, 0x49, 0x40, 0xa3,
+  0x98, 0x9c, 0x5a, 0x59, 0xa7, 0xf6, 0x9c, 0x5c, 0x9e, 0x67, 0xa9, 0xf5, 0xa1, 0xaa, 0x95, 0x1c,
+  0xa3, 0x97, 0x9b, 0x5a, 0x14, 0xa5, 0xc7, 0x7b, 0xa3, 0xb7, 0x9a, 0x5c, 0xfe, 0x13, 0xd5, 0x6e,
+  0x6e, 0xc0, 0x34, 0x39, 0x6b, 0x6e, 0x69, 0x34, 0x39, 0xc4, 0x65, 0x66, 0xc1, 0x66, 0xc1, 0x28,
+  0xc0, 0x34, 0x39, 0xc2, 0x3e, 0x39, 0xc1, 0x34, 0xc1, 0x28, 0x34, 0x2d, 0x39, 0xc9, 0x05, 0x39,
+  0x05, 0xc1, 0x6e, 0xc2, 0x6b, 0x6e, 0xc1, 0x6e, 0x16, 0xc0, 0x0a, 0xc1, 0x6e, 0xc0, 0x0a, 0xc3,
+  0x05, 0xc0, 0x0a, 0x69, 0x3e, 0x05, 0x0a, 0x05, 0xc1, 0x0f, 0x1b, 0x16, 0xc0, 0x0f, 0x0a, 0x16,
+  0x0f, 0x0a, 0x0f, 0x0a, 0x03, 0x39, 0x3e, 0x34, 0x39, 0xc0, 0x3e, 0x39, 0x34, 0xa3, 0x97, 0xa2,
+  0x88, 0x46, 0x03, 0x3e, 0x39, 0x3e, 0x65, 0xc0, 0x39, 0x3e, 0x03, 0x3e, 0x32, 0xa0, 0xb8, 0x70,
+  0x9e, 0xb8, 0xa0, 0xa6, 0x55, 0x77, 0x5e, 0x6b, 0x0b, 0x6f, 0xa2, 0x87, 0x17, 0xa2, 0x88, 0x55,
+  0xa4, 0x87, 0xa4, 0x98, 0x5e, 0xa4, 0x78, 0x7a, 0x96, 0xa9, 0x9d, 0x78, 0x24, 0x5b, 0xa0, 0x39,
+  0xa2, 0x6a, 0x03, 0x75, 0x9f, 0xb9, 0x78, 0x9f, 0xb8, 0x28, 0xa4, 0x58, 0xc0, 0x75, 0x65, 0xa1,
+  0x6a, 0xa2, 0x3a, 0x0a, 0x75, 0xa2, 0xa7, 0x65, 0x56, 0x5b, 0xc2, 0x6d, 0x00, 0xc1, 0x3a, 0x5b,
+  0x03, 0x0a, 0x6e, 0xc0, 0x7f, 0x08, 0x2b, 0x75, 0xa4, 0x39, 0xa2, 0x69, 0x14, 0x56, 0x00, 0x65,
+  0x20, 0x56, 0x6b, 0xa2, 0x87, 0x4a, 0x7b, 0xa2, 0x98, 0x79, 0xa3, 0xa8, 0xa2, 0xa7, 0xa2, 0xa8,
+  0xa3, 0x78, 0x35, 0x9b, 0x7a, 0xa0, 0x28, 0x3e, 0xa2, 0x97, 0xa2, 0xb7, 0x51, 0xa2, 0x98, 0xa0,
+  0xa8, 0x61, 0xa4, 0x97, 0xa4, 0x77, 0x9c, 0x8a, 0x7d, 0x7e, 0xc0, 0x7f, 0x66, 0xa4, 0x87, 0xa7,
+  0x98, 0x72, 0x9d, 0x98, 0x59, 0xa6, 0x98, 0x9d, 0x9b, 0x9a, 0x77, 0xa5, 0x78, 0x79, 0xa5, 0x79,
+  0x9c, 0x9a, 0x23, 0xa5, 0x78, 0xa6, 0xb9, 0x98, 0x7a, 0xa4, 0x75, 0xa5, 0xa8, 0x7b, 0x9d, 0x89,
+  0x17, 0x9d, 0x9b, 0x94, 0x4b, 0xa1, 0x65, 0x47, 0x99, 0x5a, 0xa4, 0xa8, 0xa3, 0xb7, 0x46, 0x7a,
+  0xa0, 0xa7, 0xc0, 0xa4, 0x97, 0x9d, 0x8b, 0x59, 0x6e, 0x9d, 0x6a, 0x4a, 0x7a, 0xa2, 0xa8, 0xa2,
+  0x87, 0x56, 0xa4, 0xa7, 0xc0, 0x65, 0xa5, 0xa8, 0x9b, 0x9a, 0xa3, 0x77, 0xa5, 0xb8, 0xa4, 0xb7,
+  0x7a, 0x9d, 0x6a, 0xa2, 0x97, 0xa0, 0xa8, 0x26, 0x1e, 0x52, 0x6e, 0x19, 0xc0, 0x16, 0x29, 0x92,
+  0x2e, 0x9e, 0x67, 0xa3, 0x97, 0x3b, 0x06, 0xa1, 0xaa, 0x95, 0x3c, 0x30, 0x9e, 0x69, 0x9b, 0x69,
+  0xfe, 0x96, 0x7b, 0x9c, 0x7b, 0x9c, 0x67, 0xa4, 0x87, 0x57, 0x9d, 0x88, 0x32, 0xac, 0xe6, 0x9b,
+  0x7b, 0x9b, 0x69, 0xa8, 0xa5, 0xa0, 0xa9, 0x92, 0x0d, 0x9d, 0x49, 0x9d, 0x49, 0xa6, 0xf5, 0xa5,
+  0xc7, 0x9d, 0x6a, 0x66, 0x59, 0xa3, 0xa9, 0xa4, 0xc6, 0x98, 0x2b, 0xa6, 0xd4, 0x9b, 0x5d, 0x97,
+  0x2b, 0xaa, 0xe2, 0xa4, 0xc9, 0x98, 0x4b, 0x9c, 0x58, 0xa3, 0x77, 0xfe, 0x14, 0x16, 0xc0, 0x6e,
+  0xc2, 0x6e, 0xc1, 0x05, 0xc0, 0x00, 0x05, 0x0a, 0x05, 0x65, 0x66, 0xc0, 0x69, 0x66, 0xc1, 0x2d,
+  0x34, 0x39, 0x34, 0x39, 0x05, 0xc4, 0x00, 0x39, 0xc2, 0x00, 0xc0, 0x39, 0x05, 0xc9, 0x00, 0x05,
+  0x0a, 0xc0, 0x05, 0x6f, 0xa2, 0x77, 0xc1, 0x6f, 0x1b, 0xc0, 0x66, 0x1b, 0xc0, 0x16, 0xc1, 0x69,
+  0x16, 0x0f, 0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0xc0, 0x05, 0x0a, 0x05, 0xc0, 0x0a, 0x65, 0x05, 0x0a,
+  0x0f, 0x6e, 0x0f, 0xc1, 0x16, 0x1b, 0x16, 0x0f, 0x0a, 0x14, 0x05, 0x0f, 0x0a, 0x3e, 0xc1, 0x05,
+  0x0f, 0x0a, 0x0f, 0xc0, 0x0a, 0x7a, 0xa2, 0x87, 0x0a, 0x69, 0xc0, 0x3e, 0x03, 0xa1, 0xa8, 0x9c,
+  0xa8, 0xa0, 0xb8, 0xa3, 0xc7, 0x9b, 0x98, 0x56, 0xa2, 0x87, 0x5f, 0x76, 0x61, 0x17, 0xc0, 0x6e,
+  0xa3, 0x89, 0x79, 0x1c, 0x69, 0xa0, 0x9a, 0xa2, 0x77, 0x3c, 0xa3, 0x98, 0xa5, 0x79, 0x55, 0x9d,
+  0x99, 0x9f, 0xb8, 0x9d, 0x98, 0x9f, 0x2b, 0xa1, 0x59, 0xa4, 0xd6, 0x9d, 0x99, 0x9b, 0xa8, 0xa2,
+  0xb7, 0x7e, 0x41, 0x1f, 0x79, 0x56, 0x7f, 0x7e, 0x30, 0x4b, 0x4f, 0x6e, 0xa2, 0x78, 0x57, 0xc0,
+  0x55, 0x5b, 0x69, 0x03, 0x3a, 0x01, 0x3e, 0xc0, 0xa2, 0x88, 0x0f, 0x7e, 0xa0, 0xa8, 0x0d, 0xa0,
+  0xa8, 0x9d, 0xb9, 0x1f, 0xa2, 0x88, 0x13, 0xa0, 0x59, 0x3d, 0xa0, 0xa8, 0x56, 0x41, 0x65, 0xa2,
+  0x78, 0x39, 0x75, 0x3b, 0xa2, 0x98, 0xa3, 0xa7, 0xa0, 0xb7, 0x7d, 0xa0, 0x8a, 0x49, 0x4f, 0x42,
+  0x9d, 0x99, 0x76, 0x5a, 0x0b, 0x13, 0x7a, 0x6b, 0x6d, 0x6b, 0xa1, 0xa7, 0xa1, 0xa8, 0xa4, 0x98,
+  0xa2, 0x88, 0xa2, 0x88, 0xa3, 0x88, 0x76, 0xa1, 0xa8, 0x6b, 0x9e, 0x67, 0xa2, 0x98, 0x79, 0x46,
+  0x7a, 0xa2, 0x99, 0x57, 0x9d, 0x77, 0x9d, 0x88, 0xa5, 0x78, 0xa9, 0xa8, 0x99, 0xbd, 0x9a, 0x47,
+  0xab, 0xb5, 0xa0, 0xab, 0x9d, 0x69, 0x68, 0x9e, 0x68, 0x7f, 0x9c, 0x79, 0xa7, 0x96, 0xa5, 0xb9,
+  0x92, 0x4c, 0xa3, 0x86, 0x7e, 0x67, 0xa2, 0x98, 0x9c, 0x58, 0x41, 0x7e, 0xa2, 0xa8, 0x65, 0xa8,
+  0x97, 0x77, 0x98, 0x4a, 0xa2, 0x77, 0xa2, 0x87, 0xa1, 0xaa, 0x9b, 0x6a, 0x7d, 0xa3, 0xa7, 0xa4,
+  0x98, 0x66, 0x55, 0x0d, 0x08, 0x56, 0x9d, 0x89, 0x39, 0xa9, 0xc6, 0x6b, 0x51, 0xa5, 0xc7, 0xc0,
+  0x42, 0x7e, 0xc0, 0x9d, 0x6a, 0x66, 0xa2, 0x87, 0x66, 0x29, 0x9c, 0x5a, 0x93, 0x3d, 0x9e, 0x67,
+  0xad, 0xf4, 0xa6, 0xb7, 0x94, 0x3d, 0x12, 0x24, 0x9b, 0x1b, 0x69, 0x51, 0x55, 0xa0, 0xa8, 0xa4,
+  0x97, 0xa3, 0xa8, 0x57, 0x79, 0xa4, 0xa7, 0x9d, 0x7a, 0xa2, 0xa7, 0xa2, 0x87, 0x99, 0x4c, 0xa7,
+  0xb4, 0x9d, 0x9b, 0x98, 0x2b, 0x2d, 0xa5, 0xe6, 0xa5, 0xc9, 0x96, 0x2b, 0xa8, 0xb5, 0xa5, 0xb8,
+  0x16, 0x6e, 0xa2, 0xc7, 0x38, 0x9b, 0x5a, 0x9d, 0x49, 0x49, 0xa1, 0xa8, 0x42, 0x52, 0xfe, 0x14,
+  0x16, 0xc1, 0x6e, 0x6e, 0x6f, 0xc2, 0x0a, 0xc4, 0x00, 0x69, 0xc2, 0x66, 0xc2, 0x39, 0x6e, 0x05,
+  0xc1, 0x0a, 0x05, 0xc0, 0x0a, 0xc0, 0x05, 0xc1, 0x0a, 0x05, 0xc3, 0x00, 0xc0, 0x05, 0x0a, 0xc3,
+  0x00, 0xc0, 0x05, 0x0a, 0xc0, 0x67, 0x0a, 0x16, 0xc1, 0x6e, 0xc0, 0x16, 0x1b, 0xc0, 0x16, 0x1b,
+  0xc1, 0x16, 0xc1, 0x0a, 0xc0, 0x05, 0xc6, 0x3e, 0xc1, 0x0a, 0x6e, 0x1b, 0x16, 0x0a, 0x0f, 0x16,
+  0x1b, 0x6e, 0xc0, 0x1b, 0xc0, 0x62, 0x0a, 0x69, 0x0a, 0x05, 0x3e, 0x0f, 0x71, 0x79, 0xc0, 0x75,
+  0x4f, 0xa3, 0x79, 0xa1, 0xa8, 0x03, 0xa0, 0xa8, 0x64, 0x72, 0x75, 0x9f, 0xb8, 0x79, 0xa2, 0x97,
+  0xa4, 0x79, 0x9d, 0x89, 0xc0, 0xa2, 0x88, 0x55, 0xc0, 0xa2, 0x88, 0x01, 0xc0, 0x10, 0x15, 0x7f,
+  0x9c, 0x89, 0xa3, 0x88, 0xa3, 0x68, 0x5b, 0x7e, 0x9d, 0x8a, 0x9f, 0x58, 0xa1, 0xa9, 0x9e, 0xc7,
+  0x9c, 0xb7, 0x50, 0x4b, 0x7f, 0x79, 0x10, 0x72, 0xa3, 0x77, 0xa3, 0x79, 0x7e, 0x6f, 0x6e, 0x7b,
+  0x9d, 0x99, 0x2b, 0x69, 0x7a, 0x56, 0xc0, 0xa3, 0x59, 0xa4, 0x49, 0x9e, 0x6a, 0x3e, 0x69, 0xa2,
+  0x88, 0x7a, 0x0a, 0x0f, 0x0a, 0x75, 0xa1, 0xa7, 0xa2, 0x87, 0x9e, 0xba, 0x9f, 0xb7, 0x3f, 0x79,
+  0x2b, 0xa3, 0x59, 0xa1, 0x5a, 0x5a, 0x3a, 0x61, 0xa0, 0xa8, 0x29, 0x5f, 0xc0, 0x7b, 0xa0, 0xb7,
+  0xa6, 0xb5, 0xa2, 0x98, 0x51, 0x9d, 0x79, 0x7e, 0xa0, 0x6a, 0x41, 0x7f, 0x59, 0x76, 0x4a, 0x5a,
+  0xa0, 0xa9, 0x0b, 0xc0, 0x0e, 0x56, 0xa2, 0x86, 0xa3, 0xb9, 0xa5, 0x97, 0x6b, 0x75, 0xa4, 0x78,
+  0x66, 0x7f, 0x6d, 0x9b, 0x98, 0xa5, 0x99, 0xa2, 0x98, 0x76, 0xc0, 0x6e, 0x9c, 0x88, 0xaa, 0x97,
+  0x9b, 0x8c, 0x99, 0x68, 0xa4, 0x66, 0xa3, 0xb9, 0xa7, 0xb8, 0x6f, 0x97, 0x5b, 0xa3, 0x96, 0xa4,
+  0xb8, 0x9a, 0x6a, 0x9e, 0x57, 0xa2, 0x98, 0x9a, 0x59, 0x19, 0x5b, 0x5d, 0xa2, 0xc9, 0x9d, 0x89,
+  0xa2, 0x97, 0xa2, 0x88, 0x9c, 0x47, 0x1d, 0x7a, 0x9e, 0x68, 0xc0, 0x6f, 0x7e, 0x6e, 0x9c, 0x7a,
+  0x59, 0xa4, 0xc8, 0xa2, 0x77, 0x42, 0x7f, 0xa2, 0x87, 0xa1, 0xb8, 0xa3, 0xb8, 0xa4, 0x97, 0xa1,
+  0xa8, 0xc0, 0x42, 0x9a, 0x6b, 0xa2, 0x86, 0x56, 0x55, 0xa9, 0xc6, 0xa1, 0xa8, 0x66, 0x21, 0x26,
+  0x9b, 0x7b, 0x32, 0xa7, 0xa6, 0x7a, 0x11, 0xa2, 0x87, 0x31, 0x9d, 0x7a, 0x93, 0x2d, 0xa2, 0x76,
+  0xa1, 0xa8, 0x9c, 0x49, 0xac, 0xf5, 0x97, 0x6c, 0x9d, 0x69, 0xa2, 0x78, 0x99, 0x1a, 0x68, 0x77,
+  0x6d, 0xa7, 0xf7, 0x6b, 0x66, 0x9b, 0x49, 0xa4, 0xc6, 0xa6, 0xa6, 0x26, 0x9b, 0x6b, 0x9d, 0x48,
+  0x52, 0x5d, 0x05, 0x00, 0xa2, 0x98, 0x9d, 0x7a, 0x5a, 0x04, 0xa1, 0xa8, 0xa5, 0xd8, 0xa6, 0xa6,
+  0x99, 0x5b, 0x97, 0x2b, 0x9f, 0x59, 0x69, 0x3d, 0xc0, 0x66, 0xfe, 0x14, 0x16, 0xc0, 0x69, 0x6f,
+  0x6e, 0x6f, 0x6e, 0x16, 0xc2, 0x1b, 0xc0, 0x16, 0x66, 0x7e, 0x05, 0x39, 0xc2, 0x66, 0x69, 0x34,
+  0xc0, 0xa2, 0x77, 0x39, 0xc0, 0x05, 0xc1, 0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0xc1, 0x05, 0x0a, 0x05,
+  0xc1, 0x00, 0xc0, 0x05, 0x0a, 0xc1, 0x05, 0xc6, 0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0xc1, 0x05, 0x0a,
+  0xc1, 0x16, 0xc1, 0x69, 0x1b, 0x0f, 0x0a, 0x05, 0x0a, 0x05, 0x0a, 0xc1, 0x0f, 0x0a, 0x05, 0x0a,
+  0xc2, 0xa2, 0x77, 0x0f, 0x05, 0xc0, 0x16, 0x1b, 0x6e, 0xa2, 0x88, 0x7b, 0x20, 0x7f, 0x1b, 0x0a,
+  0xc2, 0x9d, 0xb7, 0x9d, 0xe8, 0x7e, 0x6e, 0x65, 0xa4, 0x49, 0xa6, 0x88, 0x9c, 0xa8, 0x99, 0x99,
+  0xa0, 0xa8, 0x69, 0x7e, 0x6f, 0x7f, 0xa3, 0x88, 0x6f, 0x6e, 0x7e, 0xa2, 0x77, 0x9c, 0x99, 0x62,
+  0xa5, 0x87, 0x15, 0x52, 0x6d, 0xa2, 0x99, 0xa3, 0x88, 0x29, 0x7f, 0x5f, 0xa0, 0x58, 0x9d, 0x9a,
+  0x6d, 0x5a, 0x56, 0x6e, 0x9f, 0xc9, 0x60, 0x55, 0x9f, 0xb9, 0xa4, 0xa7, 0x9c, 0x79, 0x28, 0x7e,
+  0xc0, 0xa2, 0x78, 0x10, 0xa2, 0x77, 0xa3, 0x9a, 0xa2, 0x87, 0x99, 0xa9, 0x9c, 0x87, 0x7b, 0xa2,
+  0x67, 0x30, 0x51, 0x24, 0xa3, 0x5a, 0xa2, 0x49, 0x5b, 0x56, 0xa0, 0xa7, 0x7a, 0x0c, 0x11, 0x75,
+  0x7a, 0x55, 0xa1, 0xa9, 0x76, 0xa0, 0xa7, 0xa2, 0x77, 0xa1, 0x5a, 0x9e, 0x59, 0x46, 0x39, 0x69,
+  0xc0, 0x3e, 0x6f, 0x32, 0x76, 0xa2, 0xa7, 0xa7, 0xd7, 0x7e, 0x29, 0xa0, 0x49, 0x9b, 0x8a, 0x9f,
+  0xb7, 0xa2, 0x98, 0xa5, 0x98, 0x59, 0x53, 0x0e, 0x03, 0xa1, 0x59, 0x3e, 0x3b, 0xa1, 0xa8, 0xa2,
+  0x87, 0xa0, 0xa8, 0x15, 0xa4, 0x98, 0xa3, 0x78, 0x5a, 0x77, 0x16, 0x33, 0x14, 0xa2, 0x99, 0x6e,
+  0x52, 0xa9, 0xa6, 0xa0, 0xb9, 0xa5, 0x88, 0x57, 0x9c, 0x87, 0x9d, 0x88, 0xa4, 0x77, 0x67, 0x98,
+  0x68, 0xab, 0xa6, 0xa8, 0xa9, 0x94, 0x5b, 0x9b, 0x87, 0xa6, 0x76, 0xa0, 0x9a, 0xa2, 0x77, 0x42,
+  0x9d, 0x99, 0x05, 0xa7, 0xb8, 0x9c, 0x8a, 0x97, 0x4b, 0x9e, 0x56, 0xa4, 0xb8, 0xa2, 0xa8, 0x6e,
+  0x1f, 0x7e, 0xa3, 0x97, 0xc0, 0x45, 0xa4, 0xb8, 0x67, 0x45, 0x5f, 0xa0, 0xa8, 0x59, 0x5a, 0xa1,
+  0xa8, 0xa2, 0x98, 0xa4, 0xa7, 0x7a, 0x29, 0x7e, 0xc4, 0x9a, 0x6b, 0x9e, 0x67, 0xa2, 0x88, 0xa4,
+  0xa7, 0x31, 0x29, 0x9c, 0x6a, 0x46, 0x1a, 0xa5, 0xa6, 0x16, 0xa2, 0x97, 0x46, 0x97, 0x5b, 0xa4,
+  0x96, 0x26, 0x99, 0x6b, 0x96, 0x1c, 0x9f, 0x66, 0x7e, 0xa0, 0x58, 0x9b, 0x7b, 0xa4, 0xb5, 0x67,
+  0x9d, 0x69, 0xa3, 0xa8, 0x04, 0xa6, 0xe5, 0x22, 0x9a, 0x6a, 0xa2, 0x87, 0xa3, 0xc8, 0xa1, 0xa8,
+  0x7d, 0xa7, 0xc7, 0x53, 0x97, 0x1b, 0xa3, 0x77, 0xa0, 0xa9, 0x9b, 0x69, 0xa3, 0x87, 0xa4, 0xd7,
+  0xa5, 0xc8, 0x97, 0x1d, 0xa4, 0xb4, 0xa4, 0xc7, 0x98, 0x2b, 0xa5, 0xb7, 0x9e, 0x69, 0x9d, 0x78,
+  0xc0, 0x7f, 0xa1, 0xb8, 0x9d, 0x6a, 0x7d, 0xfe, 0x13, 0xd4, 0xc1, 0x6e, 0xc0, 0x6f, 0xc3, 0x6e,
+  0xa2, 0x78, 0x6b, 0xc0, 0x65, 0xc0, 0x3e, 0x39, 0x66, 0x39, 0xc1, 0x2d, 0xc1, 0x28, 0xc0, 0x2d,
+  0x34, 0xc0, 0x39, 0x3e, 0xc0, 0x39, 0x6f, 0xc1, 0x39, 0x05, 0x39, 0x05, 0x39, 0xc3, 0x3e, 0x39,
+  0xc7, 0x05, 0x3e, 0x39, 0xc0, 0x2d, 0xc4, 0xa2, 0x88, 0x3e, 0xc1, 0x6e, 0x3e, 0xc0, 0x0a, 0xc3,
+  0x0f, 0x16, 0xa2, 0x77, 0x6e, 0x20, 0x66, 0xc0, 0x20, 0x1b, 0xc0, 0x16, 0x20, 0x1b, 0xc3, 0xa3,
+  0x88, 0x66, 0x34, 0x7e, 0x25, 0x20, 0x6f, 0x20, 0x6b, 0x9d, 0xd7, 0x9d, 0xe7, 0x5a, 0x7e, 0x6b,
+  0xa2, 0x78, 0x79, 0x39, 0x7b, 0xa3, 0x88, 0xa4, 0x88, 0x9d, 0x78, 0xa3, 0xa8, 0xa2, 0x98, 0x9d,
+  0x69, 0x6e, 0xa2, 0x98, 0x71, 0x9d, 0x79, 0xa3, 0x88, 0x7e, 0x7f, 0x9a, 0x88, 0x0d, 0x1c, 0xa2,
+  0x78, 0x32, 0x7a, 0x32, 0xc0, 0xa2, 0x88, 0x11, 0x3a, 0x1e, 0x5b, 0x59, 0xc0, 0xa2, 0x98, 0x9d,
+  0xa9, 0xa1, 0xa7, 0xa5, 0x88, 0x9a, 0x98, 0x9d, 0x89, 0x15, 0xc0, 0x6e, 0x51, 0xa3, 0x98, 0x62,
+  0x41, 0x79, 0x9d, 0x99, 0xc0, 0x35, 0x66, 0x59, 0x72, 0xc0, 0x5f, 0x4e, 0xa1, 0x9a, 0x7e, 0x69,
+  0x19, 0xa5, 0xa8, 0xc0, 0x9a, 0x59, 0x5f, 0x79, 0x7a, 0x19, 0x9f, 0x59, 0xa1, 0x49, 0x67, 0x65,
+  0x08, 0x0a, 0x3e, 0x69, 0x9e, 0xb9, 0xa6, 0xb6, 0xaa, 0xb6, 0xa2, 0x98, 0x99, 0x89, 0x18, 0x9c,
+  0x49, 0x5f, 0xa2, 0xb7, 0xa4, 0xa8, 0x45, 0x2a, 0x9d, 0x7a, 0x64, 0x17, 0x9e, 0x69, 0x55, 0xa1,
+  0xb8, 0xa0, 0xa7, 0xa1, 0xb8, 0x05, 0x0e, 0xa3, 0x97, 0xa4, 0xb7, 0xa1, 0xa9, 0xa0, 0x58, 0x56,
+  0x79, 0xa0, 0x9a, 0xa6, 0x97, 0xc0, 0xa2, 0x88, 0x7e, 0xa3, 0x89, 0x7e, 0xa3, 0x88, 0x52, 0x9a,
+  0x68, 0x5a, 0x9c, 0x8a, 0x6d, 0x5b, 0x6e, 0x6b, 0x55, 0x76, 0x7e, 0x03, 0x06, 0xa2, 0x77, 0x76,
+  0xa2, 0x87, 0xa5, 0xb8, 0x99, 0x6b, 0x02, 0xa7, 0xb7, 0xa3, 0xaa, 0x9c, 0x79, 0xa6, 0x96, 0xc0,
+  0xa1, 0xb9, 0x5a, 0x56, 0x32, 0xa5, 0xa7, 0x7a, 0x46, 0xa3, 0xb7, 0x21, 0x09, 0xa4, 0x96, 0x31,
+  0xc6, 0x56, 0x21, 0x56, 0x98, 0x5b, 0x0e, 0xa2, 0x77, 0x41, 0xa4, 0x97, 0x7e, 0x9c, 0x8a, 0xa2,
+  0x87, 0xa2, 0x98, 0xa2, 0x98, 0x9a, 0x6a, 0x9c, 0x68, 0xa6, 0x96, 0x97, 0x4d, 0x9c, 0x77, 0xab,
+  0xb4, 0xaa, 0xe7, 0x92, 0x5e, 0x23, 0x9e, 0x49, 0x45, 0x7a, 0x6e, 0x51, 0xa3, 0xb9, 0xa5, 0xb6,
+  0x3b, 0xa3, 0xa8, 0x51, 0x5a, 0xc0, 0x6e, 0x7a, 0xa2, 0xa8, 0x55, 0xa3, 0xb8, 0x66, 0x9e, 0x59,
+  0x25, 0x9f, 0x69, 0x7e, 0x7e, 0xa3, 0xc8, 0x99, 0x3b, 0x3b, 0xa7, 0xc6, 0xa4, 0xc8, 0x95, 0x1d,
+  0x55, 0xa2, 0x76, 0x66, 0xa7, 0xd7, 0x0c, 0x9a, 0x2a, 0x1a, 0xfe, 0x13, 0x93, 0x6e, 0xc0, 0x6f,
+  0xc2, 0x6e, 0x65, 0x1c, 0x21, 0xa2, 0x79, 0xc2, 0x28, 0xc2, 0x2d, 0xc2, 0x28, 0x2d, 0xc0, 0x28,
+  0x21, 0x1c, 0x28, 0xc0, 0x2d, 0xc1, 0x6b, 0x6d, 0x2d, 0xc0, 0x34, 0xc0, 0x39, 0xc5, 0x34, 0x2d,
+  0x28, 0xc0, 0x2d, 0xc3, 0x39, 0x2d, 0x28, 0xc0, 0x66, 0x21, 0x1c, 0xc0, 0x21, 0x1c, 0x2d, 0xc0,
+  0x32, 0xc1, 0x2d, 0x28, 0x32, 0x6f, 0xc0, 0x6f, 0xc0, 0x6e, 0x6b, 0x6e, 0x6e, 0x6f, 0xc1, 0x6e,
+  0x2c, 0xc1, 0x31, 0xa1, 0xb8, 0x6e, 0x42, 0xc0, 0x75, 0x45, 0xa1, 0xb8, 0xa2, 0x98, 0x46, 0x7a,
+  0xa1, 0xa9, 0x7e, 0x36, 0x45, 0xa3, 0xb8, 0x9d, 0xc8, 0x9b, 0x99, 0x7e, 0x6b, 0x6e, 0x7e, 0xa2,
+  0x89, 0xa3, 0x97, 0xa3, 0x99, 0x7e, 0x0e, 0xa1, 0xa9, 0x5a, 0x9d, 0x88, 0x66, 0x55, 0x7a, 0x35,
+  0x29, 0x65, 0x66, 0x6f, 0x55, 0xa2, 0x79, 0x3a, 0xa2, 0x98, 0x7a, 0xc0, 0x45, 0x35, 0x5a, 0x9b,
+  0x7a, 0x9d, 0x79, 0x6e, 0xa0, 0xa8, 0x06, 0x59, 0x65, 0x9e, 0xb8, 0xa1, 0xb8, 0x6e, 0xc0, 0x18,
+  0x69, 0x9d, 0x89, 0x65, 0xa6, 0x77, 0x38, 0x9d, 0x88, 0x6b, 0x7a, 0x6e, 0xc0, 0x1f, 0x5f, 0x7e,
+  0x1f, 0x6f, 0x59, 0x1c, 0x35, 0xa3, 0x89, 0x3a, 0xa2, 0x97, 0x52, 0x99, 0x79, 0x7e, 0x76, 0xc0,
+  0xa1, 0x6a, 0xa1, 0x39, 0x5a, 0x75, 0xa0, 0xb8, 0xa2, 0x97, 0x9d, 0x99, 0xa2, 0x97, 0xa7, 0xa8,
+  0xa4, 0x98, 0xa5, 0xa7, 0x9d, 0x89, 0x1d, 0x96, 0x79, 0xa6, 0x98, 0xa2, 0x69, 0xa2, 0x97, 0xa4,
+  0x77, 0xa1, 0x7b, 0x9d, 0x68, 0x9b, 0x7a, 0x69, 0xa1, 0xa9, 0xa2, 0xa6, 0x51, 0x9e, 0xb9, 0xa1,
+  0xa8, 0x45, 0xa3, 0x88, 0xa3, 0x89, 0x56, 0x26, 0x52, 0x5a, 0xa4, 0x87, 0xa6, 0xb7, 0x76, 0xa5,
+  0x98, 0xa6, 0x88, 0x9c, 0x79, 0x9a, 0x78, 0x7e, 0xa3, 0x88, 0x6f, 0x61, 0x9d, 0x79, 0x9a, 0x6a,
+  0xa3, 0x87, 0x5b, 0x5a, 0x10, 0xa2, 0x97, 0x76, 0xa5, 0x98, 0xa3, 0x98, 0x9a, 0x6a, 0x6d, 0x2a,
+  0x66, 0x5a, 0x57, 0x9d, 0x78, 0xa6, 0xd7, 0xa7, 0xb7, 0x7b, 0x7e, 0x9f, 0x68, 0x62, 0x9a, 0x68,
+  0xa9, 0x96, 0xa4, 0xc8, 0xc0, 0x56, 0x9d, 0x7a, 0xa2, 0x97, 0xc0, 0xa2, 0x87, 0x56, 0x31, 0xc8,
+  0x66, 0x26, 0x5a, 0x9b, 0x9b, 0x26, 0x9b, 0x7a, 0x9a, 0x5a, 0x66, 0xc0, 0xa5, 0x86, 0x7a, 0x1d,
+  0xa2, 0xa8, 0x03, 0x56, 0x41, 0x9d, 0x59, 0x9c, 0x69, 0xa6, 0xb4, 0xa7, 0xe8, 0x97, 0x3c, 0x9b,
+  0x49, 0x6e, 0x43, 0x59, 0xa2, 0x97, 0x66, 0x41, 0x7f, 0x59, 0xfe, 0x7e, 0x3b, 0x57, 0x9a, 0x4a,
+  0x9c, 0x59, 0x03, 0xa3, 0xa8, 0x38, 0xa3, 0xa8, 0xa2, 0x98, 0x7e, 0x42, 0x9c, 0x69, 0xa7, 0xe6,
+  0x9e, 0x69, 0x9e, 0x58, 0x38, 0x3a, 0x3f, 0x22, 0xa9, 0xe6, 0x96, 0x1c, 0x9e, 0x69, 0x14, 0x31,
+  0x9f, 0x68, 0x38, 0x7f, 0xa2, 0xb7, 0xfe, 0x13, 0x51, 0x6f, 0xc0, 0x6f, 0x6e, 0xc2, 0x17, 0x1c,
+  0xc2, 0x17, 0xc4, 0x69, 0xc0, 0x17, 0x1c, 0xc1, 0xa2, 0x78, 0xc0, 0x1c, 0xc2, 0x6b, 0x6e, 0x2d,
+  0xc7, 0x6f, 0xc0, 0x66, 0x2d, 0xc1, 0x28, 0xc0, 0x1c, 0x28, 0xc2, 0x1c, 0xc0, 0x28, 0x69, 0x17,
+  0xc0, 0x1c, 0xc1, 0x69, 0x21, 0xc1, 0x2d, 0xc0, 0x21, 0xc0, 0x28, 0x21, 0xc0, 0x28, 0x39, 0xc0,
+  0x6e, 0xa2, 0x78, 0x7a, 0x5f, 0x7e, 0x6e, 0x5a, 0xc2, 0x6b, 0x65, 0xa1, 0xb8, 0x6e, 0x25, 0xa1,
+  0xa8, 0x9f, 0xb9, 0x9e, 0x58, 0xa0, 0xb8, 0xa2, 0xe6, 0xa2, 0x77, 0x51, 0xc0, 0xa5, 0xa9, 0x46,
+  0x3f, 0x6b, 0x6b, 0x65, 0x5a, 0x6e, 0xa5, 0xa7, 0xa2, 0x98, 0x9c, 0x79, 0x42, 0x65, 0x55, 0xa6,
+  0x87, 0x9f, 0xba, 0x98, 0x78, 0x9d, 0x98, 0x66, 0x55, 0x3c, 0xc1, 0xa3, 0x88, 0xa3, 0x88, 0x7f,
+  0x9d, 0x99, 0x7e, 0x65, 0x5e, 0x9e, 0x69, 0x52, 0x52, 0x5a, 0x56, 0x9f, 0x68, 0x9f, 0xb9, 0x7e,
+  0xa2, 0x78, 0x6e, 0x42, 0x5e, 0xc0, 0x9d, 0xd9, 0xa1, 0xc6, 0xa2, 0x98, 0xa2, 0x77, 0x7f, 0x51,
+  0x41, 0x38, 0x9d, 0x8a, 0x54, 0x7b, 0x7e, 0x6f, 0x1c, 0x61, 0x2b, 0xa2, 0x77, 0xc0, 0xa2, 0x79,
+  0x6f, 0xa2, 0x98, 0xa3, 0x87, 0x7b, 0x52, 0x45, 0x41, 0x9d, 0xa8, 0xa2, 0x89, 0xa0, 0x58, 0x56,
+  0x6e, 0x9f, 0xb8, 0x56, 0x60, 0x21, 0xa4, 0x98, 0xab, 0x88, 0xa6, 0x87, 0x9c, 0x8a, 0x9b, 0x78,
+  0x01, 0x9a, 0x89, 0xa2, 0x88, 0xa7, 0x97, 0xa4, 0x89, 0x2d, 0xa6, 0x87, 0x47, 0x9b, 0x79, 0x9d,
+  0x99, 0x5a, 0x3a, 0x50, 0x3c, 0x39, 0x4f, 0x3a, 0x60, 0xa3, 0x99, 0xa2, 0x77, 0xa1, 0xa8, 0xa5,
+  0x9a, 0x9d, 0x79, 0xa8, 0xa7, 0xa8, 0xb7, 0x9c, 0x89, 0xa3, 0x98, 0x5a, 0x9b, 0x88, 0xa3, 0x87,
+  0x9d, 0x89, 0xa1, 0xa8, 0xa0, 0xa8, 0x51, 0x42, 0x9f, 0x68, 0x9a, 0x79, 0xc0, 0xa2, 0x79, 0x5f,
+  0x51, 0xa4, 0x97, 0xa2, 0x88, 0xa5, 0x88, 0x9c, 0x7a, 0x9d, 0x89, 0xa4, 0x96, 0xa5, 0x98, 0xa0,
+  0xa9, 0xa2, 0x88, 0x9d, 0x8a, 0xa2, 0x87, 0xa8, 0xb6, 0x9d, 0x89, 0xa3, 0x97, 0x67, 0x7a, 0xc0,
+  0x9c, 0x89, 0x46, 0x45, 0x3f, 0xa4, 0xa7, 0x19, 0xa3, 0xa7, 0x19, 0x16, 0x31, 0xc1, 0x9f, 0x69,
+  0xa1, 0xa8, 0x31, 0x2e, 0x16, 0x2e, 0x31, 0xc1, 0x42, 0x31, 0x66, 0x5a, 0x31, 0xc0, 0x98, 0x7c,
+  0x9a, 0x49, 0xa3, 0x76, 0x9d, 0x7a, 0x01, 0xa5, 0xa8, 0x10, 0x7a, 0x97, 0x1b, 0x54, 0xa5, 0xc8,
+  0x42, 0xa2, 0xb7, 0x9b, 0x4b, 0x59, 0x9c, 0x49, 0x7e, 0xa1, 0xa8, 0x9d, 0x7a, 0xa2, 0x97, 0xa1,
+  0xb9, 0x9c, 0x58, 0x33, 0xfe, 0x8e, 0x5a, 0x9e, 0x6b, 0x99, 0x4a, 0x46, 0xa3, 0xa7, 0x6e, 0xa6,
+  0xd7, 0x9d, 0x6b, 0x9a, 0x29, 0xa4, 0xd6, 0x57, 0x45, 0x45, 0x46, 0x7e, 0xfe, 0x8e, 0x9c, 0x17,
+  0x69, 0xa7, 0xe6, 0x9b, 0x8b, 0x9e, 0x48, 0x98, 0x2b, 0x11, 0x0b, 0x03, 0x7a, 0x5e, 0x06, 0xfe,
+  0x13, 0x31, 0x6e, 0x6f, 0xc0, 0x6e, 0xc0, 0x0b, 0xc1, 0xa2, 0x78, 0x6e, 0x1c, 0x66, 0x0b, 0xc2,
+  0x10, 0xc1, 0x0b, 0xc0, 0x6b, 0x17, 0x1c, 0xc1, 0x6b, 0x17, 0xc0, 0x1c, 0x23, 0x6e, 0xc1, 0x6f,
+  0x69, 0xca, 0x28, 0xc0, 0x1c, 0xc0, 0x23, 0x28, 0x1c, 0xc2, 0x17, 0x1c, 0xc7, 0x21, 0x6e, 0xc0,
+  0x21, 0xc0, 0x1c, 0xc0, 0x21, 0x2d, 0xc0, 0x6e, 0x6b, 0xa2, 0x78, 0x69, 0x7b, 0x6e, 0x03, 0xc0,
+  0x0a, 0x03, 0xc3, 0x0a, 0x03, 0x7a, 0x62, 0x39, 0x79, 0xa1, 0xa8, 0x56, 0x55, 0x7a, 0x7e, 0x7f,
+  0x6e, 0x7a, 0x08, 0x0b, 0xa4, 0xa7, 0xa6, 0xb6, 0x65, 0x9b, 0x7b, 0x46, 0x41, 0xc0, 0xa4, 0x97,
+  0xa2, 0x87, 0xa2, 0x99, 0x9c, 0x89, 0x9a, 0x87, 0xc0, 0x6f, 0x7a, 0xa2, 0x98, 0xa3, 0x88, 0x5e,
+  0x9b, 0xa9, 0x9b, 0xa9, 0x9f, 0x59, 0x4f, 0x6b, 0x7e, 0x59, 0x76, 0x6b, 0x26, 0x23, 0x55, 0x76,
+  0x26, 0x49, 0x67, 0x6e, 0x5f, 0x5f, 0x35, 0x9f, 0xd7, 0x1d, 0xc0, 0xa3, 0x99, 0x59, 0xc0, 0x51,
+  0x7a, 0xa1, 0xa8, 0x51, 0x7a, 0x55, 0xa2, 0x88, 0xa3, 0x88, 0xa4, 0x78, 0xa2, 0x5a, 0xc0, 0xa0,
+  0xa8, 0x3a, 0x04, 0x9d, 0x69, 0x66, 0x50, 0x56, 0xa2, 0x98, 0xa3, 0x88, 0x9e, 0x69, 0x5a, 0x03,
+  0x9e, 0xb7, 0x9f, 0xb8, 0xa3, 0x88, 0xa6, 0x78, 0xa6, 0x78, 0xa7, 0xa7, 0x98, 0x99, 0x91, 0x7a,
+  0x59, 0xa7, 0x99, 0xa5, 0x88, 0xa4, 0xa7, 0x67, 0x9d, 0x79, 0x69, 0x4b, 0xa2, 0x98, 0x9b, 0x89,
+  0x9c, 0x87, 0x9d, 0xa9, 0xa7, 0x97, 0xa9, 0xb9, 0x91, 0x5d, 0x0b, 0xa1, 0xa8, 0x7f, 0x01, 0x2a,
+  0x7a, 0xa5, 0x99, 0xab, 0xc7, 0xa6, 0x97, 0xa1, 0xa8, 0x9a, 0x89, 0x5a, 0xa6, 0x87, 0x98, 0x7b,
+  0x99, 0x87, 0xa2, 0x97, 0x69, 0x66, 0x7e, 0x52, 0x99, 0x69, 0x46, 0xa3, 0x89, 0xa2, 0x67, 0x3b,
+  0xa3, 0x89, 0xc0, 0x46, 0xa3, 0x98, 0xa4, 0xa7, 0xa1, 0xb9, 0x57, 0xa5, 0xa6, 0xa8, 0xc7, 0x7a,
+  0x42, 0x56, 0x6e, 0x98, 0x59, 0xa4, 0x97, 0xa8, 0xb6, 0x21, 0x7e, 0x2e, 0x9e, 0x69, 0x9b, 0x8a,
+  0x99, 0x6b, 0xa8, 0xb5, 0xa5, 0xa7, 0x56, 0x2e, 0x7a, 0x0c, 0x29, 0x31, 0xc2, 0x29, 0x9e, 0x69,
+  0xc0, 0x1e, 0x2e, 0x31, 0xc0, 0x2e, 0x31, 0x21, 0xc0, 0x26, 0x1e, 0x94, 0x5c, 0x9d, 0x58, 0x4a,
+  0x59, 0xa6, 0xd7, 0x9d, 0x8b, 0x9c, 0x58, 0x69, 0x9e, 0x58, 0x53, 0x7d, 0x6b, 0x5a, 0xa2, 0x86,
+  0xa1, 0xa9, 0x9a, 0x5a, 0x19, 0x1d, 0x9c, 0x6a, 0x1d, 0xa1, 0xa8, 0x9b, 0x4b, 0xa2, 0x87, 0x6d,
+  0xfe, 0x8e, 0x5c, 0x97, 0x0c, 0x69, 0x6e, 0x42, 0xfe, 0x7e, 0x7b, 0x9d, 0x8b, 0x9a, 0x2a, 0x5a,
+  0x69, 0x14, 0x04, 0x66, 0x04, 0xfe, 0x96, 0xbb, 0x9c, 0x7b, 0xa4, 0xa7, 0x9d, 0x7a, 0x99, 0x3a,
+  0xa1, 0xb8, 0x9a, 0x39, 0x69, 0xfe, 0x8e, 0x3b, 0x31, 0x98, 0x2b, 0x33, 0xa2, 0x97, 0xfe, 0x13,
+  0x52, 0xa2, 0x77, 0xc0, 0x66, 0x10, 0xc0, 0x0b, 0xc0, 0x10, 0x6e, 0x6b, 0x10, 0x0b, 0xc0, 0x06,
+  0xc0, 0x0b, 0xc5, 0xa2, 0x88, 0x1c, 0xc6, 0x6e, 0x1c, 0xc0, 0xa2, 0x78, 0xc0, 0x6e, 0xc0, 0x67,
+  0x2d, 0x34, 0x32, 0x2d, 0xc1, 0x34, 0x2d, 0x34, 0x2d, 0x66, 0x66, 0xc1, 0x1c, 0xc8, 0x21, 0x1c,
+  0xc0, 0x21, 0xc2, 0x1c, 0xc2, 0xa2, 0x77, 0x2d, 0x28, 0xc0, 0x2d, 0x32, 0x2d, 0xc2, 0x34, 0x2d,
+  0xc4, 0x28, 0xa2, 0x78, 0x32, 0xc0, 0x34, 0x32, 0x6f, 0xc0, 0x39, 0xc1, 0x2d, 0x28, 0x2d, 0x21,
+  0x2d, 0xc0, 0x75, 0x9f, 0xb8, 0xa2, 0xa8, 0xa4, 0x76, 0x7f, 0x76, 0x55, 0x65, 0xa6, 0x78, 0x6e,
+  0xa0, 0xa9, 0x50, 0x51, 0x66, 0x9d, 0x88, 0x76, 0x66, 0x45, 0xa1, 0x7a, 0xa1, 0x49, 0x5a, 0xa0,
+  0xa7, 0x76, 0xc0, 0x7e, 0x26, 0xc0, 0x42, 0x7d, 0x7b, 0x55, 0x5e, 0xc0, 0x7b, 0xa2, 0x78, 0x6e,
+  0x5a, 0x9d, 0x99, 0x1e, 0x26, 0x2f, 0xa2, 0xa7, 0xc0, 0x2e, 0x6f, 0x38, 0x2e, 0x75, 0x1c, 0xa4,
+  0x77, 0x7f, 0xa2, 0x89, 0xa2, 0x58, 0x66, 0x7a, 0x9d, 0x78, 0x62, 0x02, 0x4a, 0x6b, 0x6d, 0x7b,
+  0xa3, 0x98, 0x55, 0x62, 0xa0, 0xa8, 0xa2, 0x87, 0xa3, 0x88, 0xa3, 0x99, 0x7a, 0x9c, 0x88, 0x9d,
+  0x98, 0x6e, 0xa4, 0x88, 0xa2, 0x99, 0xa3, 0x78, 0xa4, 0x77, 0x9d, 0xa8, 0x9a, 0x7c, 0x9b, 0x48,
+  0xa4, 0xb8, 0x9d, 0x89, 0xa3, 0x87, 0x79, 0x7b, 0x9d, 0x88, 0xa8, 0x97, 0xae, 0xe7, 0x98, 0x5b,
+  0x94, 0x48, 0x3f, 0xa1, 0xaa, 0x40, 0xa4, 0x97, 0xad, 0xd9, 0x9d, 0x7a, 0x9b, 0x67, 0xa4, 0x98,
+  0x52, 0xa3, 0xa8, 0xa6, 0x87, 0x9d, 0x99, 0x9d, 0x6a, 0xa5, 0x87, 0x9c, 0x99, 0x9d, 0x97, 0xa3,
+  0xb9, 0x9d, 0x8a, 0x99, 0x5a, 0x15, 0xa2, 0x89, 0x9d, 0x7a, 0x7f, 0xa2, 0x97, 0x5a, 0xa2, 0x98,
+  0xa6, 0xa7, 0x66, 0x65, 0xa2, 0x96, 0x9b, 0x6b, 0xa8, 0x95, 0xa2, 0xb8, 0xc1, 0x52, 0x9b, 0x59,
+  0xa2, 0x98, 0x31, 0x24, 0x5e, 0x07, 0x9c, 0x79, 0x13, 0xa5, 0xa6, 0xa4, 0xb8, 0x31, 0x29, 0xc0,
+  0x6e, 0x31, 0xc0, 0x9a, 0x7b, 0x31, 0xc1, 0x29, 0x26, 0x66, 0x2e, 0x31, 0x21, 0xc0, 0x31, 0x9c,
+  0x7a, 0x9e, 0x59, 0x26, 0x62, 0x98, 0x4b, 0x23, 0x98, 0x4b, 0x9e, 0x58, 0x7e, 0xa2, 0x97, 0xa2,
+  0x98, 0x99, 0x5b, 0x45, 0xa2, 0x96, 0x1d, 0x66, 0x45, 0x9f, 0x69, 0x7e, 0x76, 0x1d, 0x7a, 0x9c,
+  0x49, 0xa2, 0xb7, 0xa6, 0xc7, 0x98, 0x1b, 0x33, 0xa2, 0x77, 0x76, 0x6f, 0xa4, 0xa6, 0x42, 0x9d,
+  0x7a, 0x6e, 0x7e, 0x7e, 0xa7, 0xe6, 0x9a, 0x3c, 0x79, 0x9f, 0x68, 0x3d, 0x0c, 0x14, 0x11, 0xa1,
+  0xc8, 0xaa, 0xf5, 0x9b, 0x5b, 0x9a, 0x49, 0xa7, 0xe6, 0x98, 0x5a, 0x9c, 0x4a, 0x33, 0xfe, 0x86,
+  0x3b, 0x9c, 0x4b, 0x38, 0xa2, 0x98, 0xa2, 0xa7, 0xfe, 0x13, 0x52, 0xa2, 0x77, 0x6f, 0x10, 0xc4,
+  0x1c, 0xc0, 0x61, 0xc0, 0x65, 0xc1, 0x0b, 0xc5, 0xa2, 0x77, 0x1c, 0xc7, 0x6e, 0x1c, 0x6f, 0xc0,
+  0x6e, 0x6f, 0xc2, 0x69, 0x2d, 0xc0, 0x6b, 0xc1, 0x39, 0xc2, 0x28, 0xc2, 0x1c, 0xc4, 0x21, 0xc7,
+  0x1c, 0xc1, 0x21, 0x6e, 0x2d, 0x28, 0xc0, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0xc1, 0x28, 0x21, 0x2d,
+  0x7e, 0x21, 0x26, 0x32, 0x2d, 0xc0, 0x26, 0x32, 0xc0, 0x2d, 0x7f, 0x5d, 0xc0, 0x32, 0x75, 0x2d,
+  0xc1, 0x32, 0x37, 0x6b, 0x6e, 0xc0, 0x75, 0xa1, 0xf8, 0x79, 0x66, 0x9c, 0x88, 0xa2, 0x68, 0x5a,
+  0xa4, 0x87, 0x6b, 0x9c, 0x59, 0x76, 0x45, 0x76, 0x7e, 0x4f, 0x37, 0x24, 0xa0, 0xb7, 0x1e, 0x59,
+  0xa2, 0x99, 0x7e, 0x2e, 0x26, 0x41, 0x7e, 0x26, 0x0f, 0xc0, 0x1e, 0xc0, 0x5a, 0xa2, 0x97, 0x32,
+  0x18, 0x7e, 0x7a, 0x59, 0x26, 0xa2, 0x78, 0x3a, 0x26, 0xa2, 0x59, 0xa3, 0xa8, 0x65, 0x32, 0xa0,
+  0xc6, 0x6e, 0x6f, 0xa2, 0x68, 0x9f, 0x6a, 0x52, 0x5e, 0xa2, 0xb7, 0xa0, 0xa8, 0x52, 0xa2, 0x77,
+  0x0b, 0x6e, 0xa4, 0x97, 0x9d, 0xa9, 0x61, 0xa1, 0xa7, 0x6b, 0x11, 0x9d, 0x9a, 0x45, 0xc0, 0x6e,
+  0xa5, 0x89, 0xaa, 0x87, 0x9f, 0xba, 0x98, 0x69, 0x10, 0xa3, 0xa9, 0xa2, 0x98, 0x9f, 0x68, 0x9a,
+  0x99, 0x16, 0xa2, 0x88, 0xa3, 0x98, 0x7f, 0x9d, 0x78, 0x7b, 0x2a, 0x7a, 0x52, 0x66, 0x7d, 0x64,
+  0xac, 0x97, 0xa5, 0xb9, 0x9b, 0x7a, 0xa7, 0x97, 0x43, 0x45, 0xa6, 0xa6, 0x56, 0x9b, 0x89, 0x5e,
+  0xa2, 0x89, 0x76, 0xc0, 0xa8, 0x96, 0x9c, 0x8a, 0x97, 0x69, 0xa6, 0x75, 0xa1, 0xb9, 0x2c, 0x7e,
+  0xa7, 0xb8, 0xa2, 0x89, 0x7d, 0xc0, 0x9a, 0x6a, 0x30, 0x46, 0xa2, 0x77, 0xa2, 0x97, 0xa4, 0xb8,
+  0x1c, 0x57, 0x5a, 0x9c, 0x68, 0xa8, 0xa6, 0xa5, 0xd8, 0x96, 0x4b, 0x2a, 0xa2, 0x98, 0xa6, 0xd7,
+  0xa5, 0xa7, 0xc1, 0x56, 0x19, 0x7e, 0x31, 0x9b, 0x6b, 0x6e, 0xa3, 0x97, 0x19, 0xa2, 0x87, 0x0e,
+  0x69, 0x2e, 0x31, 0x29, 0x19, 0x6e, 0x2e, 0x31, 0x9b, 0x8b, 0x09, 0x21, 0x9b, 0x6a, 0x97, 0x5b,
+  0xa0, 0x57, 0x5a, 0x51, 0xc0, 0x7b, 0x9d, 0x49, 0x7e, 0x7a, 0xc0, 0x9e, 0x59, 0xa0, 0xa8, 0x49,
+  0x42, 0x08, 0x56, 0x5e, 0x00, 0x38, 0xa3, 0xc8, 0x5e, 0x38, 0x6b, 0xa1, 0xa8, 0x1f, 0x9e, 0x69,
+  0xa1, 0xa9, 0x0c, 0xa3, 0xa8, 0x42, 0x45, 0xa2, 0xa8, 0xa5, 0xe6, 0x9f, 0x69, 0x9d, 0x8a, 0x5e,
+  0x77, 0x2b, 0x23, 0xa2, 0xb7, 0x23, 0x31, 0xa3, 0xb7, 0x56, 0x42, 0x9c, 0x79, 0x9e, 0x58, 0x6e,
+  0x3f, 0x6e, 0x7e, 0x0f, 0xa2, 0xa8, 0xfe, 0x13, 0x72, 0x6e, 0xc0, 0x0b, 0xc0, 0x10, 0xc0, 0x6e,
+  0x10, 0x6f, 0x15, 0x0b, 0xc2, 0x65, 0x0b, 0xc0, 0x66, 0xc0, 0x0b, 0xc1, 0x10, 0x6b, 0xc0, 0x1c,
+  0xc5, 0x6e, 0x1c, 0x6f, 0xc0, 0x66, 0x28, 0x6e, 0xc3, 0x6b, 0xc0, 0x6e, 0xc0, 0x6f, 0x6e, 0xc0,
+  0x05, 0x39, 0xc1, 0x34, 0x2d, 0xc0, 0x28, 0xc1, 0x2d, 0x28, 0x2d, 0xc3, 0x21, 0x28, 0x21, 0xc2,
+  0x2d, 0xc3, 0x6e, 0x2d, 0xc3, 0x69, 0x21, 0xc0, 0x2d, 0x7e, 0x2d, 0xc3, 0x32, 0x2d, 0x34, 0x32,
+  0x7e, 0x32, 0x2d, 0xc2, 0xa2, 0x77, 0x32, 0x6f, 0xc0, 0xa0, 0xa7, 0x9d, 0xa9, 0x69, 0xa3, 0xc8,
+  0x9c, 0xa8, 0x59, 0xa3, 0xa9, 0x5e, 0x47, 0x4a, 0x5e, 0xa1, 0x8a, 0x3e, 0x66, 0xc0, 0x32, 0x69,
+  0xc0, 0x21, 0x1c, 0x79, 0xc0, 0x27, 0x7e, 0x65, 0x7e, 0x9d, 0x99, 0x6b, 0x23, 0x66, 0xc0, 0x12,
+  0x6e, 0x23, 0xc0, 0x55, 0x6b, 0xa1, 0xa8, 0x23, 0x18, 0x66, 0x17, 0x26, 0x5e, 0xa2, 0x88, 0x6f,
+  0x46, 0x37, 0x9f, 0xc8, 0x6e, 0x6e, 0xa1, 0x7b, 0x3d, 0x66, 0x69, 0x3d, 0x08, 0x9f, 0xb8, 0x6e,
+  0x02, 0x07, 0xa2, 0xa8, 0x51, 0x9c, 0xa8, 0xc0, 0x6e, 0xc0, 0x6e, 0x01, 0x39, 0x30, 0xa3, 0x69,
+  0xa2, 0x39, 0x9f, 0xb9, 0xa2, 0x87, 0x66, 0x9d, 0x89, 0x7e, 0xa7, 0xa6, 0x63, 0x45, 0x67, 0xac,
+  0xb5, 0xa0, 0x9a, 0x95, 0x5a, 0xa4, 0x87, 0x1e, 0xa6, 0xa7, 0xaf, 0xb7, 0xa7, 0xb8, 0x92, 0x9d,
+  0x9c, 0x55, 0xa6, 0x95, 0xa5, 0x99, 0xa2, 0x79, 0x5a, 0x55, 0x9b, 0x89, 0x9b, 0x88, 0x76, 0x55,
+  0x42, 0xa5, 0x87, 0xa3, 0xa8, 0x56, 0x9b, 0x89, 0x51, 0xa3, 0x99, 0x41, 0x9c, 0x88, 0x42, 0x06,
+  0x7f, 0x5a, 0xa5, 0x88, 0x0f, 0x6f, 0x66, 0x1b, 0xa5, 0x98, 0xa1, 0xaa, 0x9d, 0x69, 0xa3, 0xa7,
+  0x57, 0x9d, 0x59, 0x7e, 0x7f, 0x62, 0xa2, 0x87, 0x7e, 0x6b, 0xa7, 0xa6, 0xa3, 0xb9, 0xa3, 0x98,
+  0x9a, 0x7a, 0xa4, 0x97, 0xa4, 0xa6, 0xc0, 0x7a, 0xc0, 0x9b, 0x7b, 0x2a, 0xa6, 0xa6, 0xc1, 0x52,
+  0xa2, 0x97, 0x31, 0x2e, 0x9d, 0x7a, 0x7a, 0xa2, 0x87, 0x9b, 0x7b, 0x26, 0x9c, 0x6a, 0x99, 0x4a,
+  0x6d, 0x9d, 0x9a, 0x46, 0x9d, 0x88, 0x5b, 0x7a, 0x46, 0x5a, 0x55, 0x46, 0x6e, 0x9d, 0x7a, 0x5a,
+  0x65, 0xa2, 0x87, 0x07, 0x04, 0x6e, 0x6b, 0x6e, 0x79, 0x66, 0x5e, 0xc0, 0x09, 0x07, 0x11, 0x7e,
+  0xa1, 0xb9, 0xa2, 0x87, 0x9f, 0xba, 0x9d, 0x4a, 0x6d, 0x19, 0xa3, 0xd8, 0x41, 0x1a, 0xa5, 0xd7,
+  0x45, 0x37, 0x05, 0xa6, 0xe7, 0x37, 0xa5, 0xb8, 0xa3, 0xb6, 0x9a, 0x2b, 0x98, 0x4a, 0x04, 0x11,
+  0xa6, 0xd6, 0x9b, 0x5c, 0x04, 0xa5, 0xd6, 0x9f, 0x9b, 0xa2, 0xa6, 0xfe, 0x13, 0x92, 0xc1, 0x66,
+  0xc0, 0x10, 0xc0, 0x6e, 0x6b, 0xc1, 0x0b, 0xc3, 0x66, 0xc2, 0x0b, 0xc0, 0x10, 0xc0, 0x0b, 0xc0,
+  0x6f, 0x1c, 0x17, 0xc0, 0x1c, 0xc3, 0x6f, 0xc0, 0x66, 0xc0, 0x28, 0x6e, 0xc2, 0x6b, 0x6e, 0xc1,
+  0x6f, 0x6f, 0x6e, 0x69, 0xc0, 0x16, 0x65, 0x05, 0x39, 0xc0, 0x2d, 0xc3, 0x39, 0x69, 0x39, 0xc0,
+  0x2d, 0x28, 0x2d, 0xc0, 0x32, 0x2d, 0xc1, 0x7a, 0x28, 0x32, 0x39, 0x32, 0x30, 0x2d, 0x32, 0xc0,
+  0x65, 0x2d, 0x28, 0x2d, 0xc1, 0x32, 0xc0, 0x2d, 0xc1, 0x32, 0x6f, 0x69, 0x3e, 0x2d, 0xc1, 0x28,
+  0xc0, 0x39, 0xa2, 0x77, 0xa0, 0xb8, 0x50, 0xa0, 0xa8, 0xa1, 0xb8, 0xa2, 0xa8, 0xa3, 0x78, 0x5a,
+  0x9c, 0x89, 0x9c, 0xa8, 0xa4, 0x76, 0xa5, 0x89, 0x51, 0x7e, 0x5a, 0x99, 0x9a, 0x65, 0x5f, 0xa2,
+  0x48, 0x47, 0x2d, 0x69, 0x66, 0x1c, 0x7d, 0x7f, 0x7a, 0x55, 0x76, 0x5a, 0x69, 0x7f, 0x1e, 0x45,
+  0x7a, 0x7b, 0x1e, 0x23, 0x20, 0x15, 0x76, 0x6e, 0x20, 0x6b, 0x5a, 0xa0, 0xa8, 0xa1, 0xa8, 0x37,
+  0x6e, 0x6b, 0x2f, 0x79, 0xa2, 0x97, 0x6b, 0x5b, 0xa0, 0x58, 0x56, 0x30, 0xa2, 0x77, 0xa0, 0xa8,
+  0x6b, 0x6d, 0xa1, 0xb9, 0x7d, 0x9d, 0xa9, 0x70, 0x6f, 0x5a, 0xc1, 0xa3, 0x79, 0x1a, 0x69, 0x16,
+  0xa3, 0xa8, 0x9f, 0x4a, 0x9d, 0x98, 0x75, 0x08, 0xa5, 0xb8, 0xa3, 0x98, 0xa0, 0xaa, 0x6c, 0xa8,
+  0x87, 0xa8, 0xc9, 0x90, 0x4c, 0xa4, 0x95, 0xaf, 0xc6, 0x97, 0x8c, 0x94, 0x59, 0x9b, 0x75, 0xb1,
+  0xc8, 0x9b, 0x8c, 0x9f, 0x65, 0xa0, 0xb8, 0x9a, 0x98, 0x5a, 0xa7, 0x68, 0x9d, 0x9a, 0x98, 0x78,
+  0x9c, 0xa8, 0x9d, 0x78, 0x6f, 0x6e, 0x2d, 0x7a, 0x7e, 0xc0, 0xa2, 0x88, 0xa2, 0x98, 0x7e, 0x50,
+  0x57, 0x07, 0x0f, 0x9d, 0x89, 0x6f, 0xa2, 0x77, 0xc0, 0xa2, 0x69, 0x62, 0x69, 0x6d, 0xa2, 0x78,
+  0xa1, 0xa9, 0xa6, 0x97, 0x9d, 0x8a, 0xa2, 0x78, 0xa3, 0x98, 0x9d, 0x79, 0xa3, 0x98, 0xa3, 0x99,
+  0x7b, 0xab, 0xb7, 0x9b, 0x8a, 0x9d, 0x79, 0x40, 0xa6, 0xa7, 0xa2, 0xa9, 0xa5, 0xb6, 0xc0, 0x66,
+  0x5e, 0x66, 0x66, 0x31, 0x9d, 0x7a, 0xc0, 0x31, 0xc1, 0x29, 0x46, 0x7a, 0x31, 0x98, 0x5c, 0x9b,
+  0x49, 0x6d, 0x4a, 0x9d, 0x8a, 0xa7, 0xc5, 0x9c, 0x8b, 0x98, 0x3a, 0xaa, 0xd4, 0xa1, 0xb9, 0x95,
+  0x2d, 0x4d, 0x69, 0x7b, 0x9f, 0x68, 0x56, 0x6b, 0xa0, 0x57, 0x67, 0x79, 0x7f, 0xa1, 0xa8, 0x79,
+  0x9f, 0xc8, 0x55, 0xa0, 0x48, 0xa0, 0x5a, 0xc0, 0x7e, 0x57, 0x09, 0xa5, 0xe7, 0x59, 0x9c, 0x5a,
+  0xa1, 0xb7, 0x43, 0x41, 0xa3, 0xa8, 0x9e, 0x68, 0xc0, 0x7f, 0xc0, 0x45, 0x14, 0x17, 0x6e, 0x01,
+  0xa2, 0xc8, 0x49, 0x26, 0x11, 0x14, 0x31, 0x9a, 0x59, 0xfe, 0x96, 0x7b, 0x9b, 0x5b, 0x1a, 0xa3,
+  0xa8, 0x31, 0x9d, 0x88, 0xfe, 0x13, 0x92, 0x6e, 0x10, 0xc0, 0x6b, 0xc0, 0x6e, 0xc3, 0x10, 0x66,
+  0xc3, 0x65, 0x0b, 0xc0, 0x10, 0xc4, 0x17, 0x1c, 0x6e, 0x1c, 0xc0, 0x6f, 0x1c, 0xc1, 0x28, 0x66,
+  0xc0, 0x28, 0xc0, 0x6e, 0xc3, 0x6b, 0xc1, 0x6e, 0x6f, 0x6e, 0xc1, 0x6e, 0x0a, 0xc0, 0x65, 0xc0,
+  0x65, 0x2d, 0xc3, 0x39, 0x32, 0xc0, 0x39, 0x34, 0xc0, 0x39, 0x3e, 0x39, 0x2d, 0x39, 0xc1, 0x3e,
+  0xc1, 0x7a, 0x39, 0xc0, 0x32, 0xc0, 0x01, 0x3e, 0x39, 0xc3, 0x34, 0x39, 0x7a, 0x32, 0x21, 0x7e,
+  0x6f, 0x01, 0x69, 0x32, 0xc0, 0x3a, 0x9d, 0xa9, 0x9f, 0xb8, 0xa1, 0xb8, 0xa4, 0x97, 0xa3, 0x88,
+  0xa2, 0x68, 0xa3, 0x89, 0x9c, 0x79, 0x9c, 0x78, 0x7e, 0xa2, 0x78, 0xa2, 0x98, 0xa1, 0xa9, 0xa2,
+  0x97, 0xa3, 0xc7, 0x9d, 0x89, 0x97, 0x7a, 0x9c, 0x98, 0x79, 0x4b, 0xa0, 0x2a, 0x6e, 0x24, 0x64,
+  0x9f, 0xc9, 0x7a, 0xa2, 0x79, 0x6e, 0x45, 0x6b, 0x1e, 0x55, 0xa2, 0x87, 0x66, 0x46, 0x5f, 0xc0,
+  0x24, 0xc0, 0x15, 0x21, 0xc1, 0x75, 0xa2, 0xa7, 0x7a, 0xc1, 0x69, 0x66, 0xc0, 0xa3, 0x88, 0xa2,
+  0x89, 0x55, 0x62, 0xa1, 0x59, 0x46, 0x5e, 0xa1, 0xa9, 0x79, 0x76, 0x69, 0xa3, 0xa8, 0x76, 0x55,
+  0xc0, 0x5b, 0x0a, 0xa0, 0xa8, 0x5b, 0x0a, 0x16, 0x5e, 0x66, 0xa2, 0x88, 0x56, 0x19, 0xa1, 0xa9,
+  0x16, 0x57, 0x18, 0xb7, 0xe6, 0xa0, 0xca, 0x8d, 0x3c, 0xaa, 0x63, 0xaa, 0xd8, 0x9d, 0x89, 0x9f,
+  0xbb, 0x96, 0x48, 0x9d, 0x97, 0x99, 0x79, 0xa4, 0x76, 0xa9, 0xca, 0x9a, 0x89, 0x9c, 0x66, 0x61,
+  0x52, 0x45, 0x9b, 0x78, 0x7b, 0xa1, 0xa9, 0x51, 0x7e, 0xa4, 0x97, 0x56, 0xa5, 0x97, 0xa1, 0xb8,
+  0x9d, 0x9a, 0xa4, 0x87, 0xa2, 0x97, 0x6f, 0xa1, 0xa8, 0x6e, 0x11, 0x69, 0xa3, 0xa9, 0x2d, 0x9f,
+  0x69, 0x9d, 0x8a, 0x5a, 0xa2, 0x78, 0x7e, 0x9c, 0x89, 0x6f, 0xa2, 0x79, 0x14, 0x54, 0xaa, 0x97,
+  0x9d, 0x8c, 0x9a, 0x86, 0xa4, 0x87, 0x6f, 0xa3, 0x88, 0xa5, 0xb8, 0xa7, 0x98, 0x52, 0x5b, 0xa7,
+  0xb8, 0xa4, 0xb6, 0x56, 0x6e, 0x31, 0x9e, 0x69, 0x52, 0xc0, 0xa3, 0x97, 0x31, 0x9b, 0x6b, 0xa2,
+  0x97, 0x31, 0xc2, 0x9a, 0x6b, 0x9c, 0x58, 0xa3, 0x97, 0x9b, 0x7b, 0xa0, 0x57, 0x9d, 0x8a, 0x65,
+  0x70, 0xa3, 0x97, 0xa9, 0xb9, 0x99, 0x5c, 0xa0, 0x95, 0xa4, 0x98, 0x97, 0x1c, 0x79, 0x6e, 0x46,
+  0x5a, 0x41, 0x6b, 0xa0, 0x58, 0x7a, 0xa7, 0xf6, 0x9c, 0xd9, 0x9a, 0xa8, 0xa2, 0x96, 0xa0, 0xb7,
+  0x99, 0x4b, 0xa0, 0x17, 0xa6, 0x29, 0x1c, 0xa1, 0xb9, 0x9c, 0x49, 0xc0, 0xa0, 0xa6, 0xa0, 0xa9,
+  0x9e, 0x69, 0x55, 0x6e, 0x6e, 0x7b, 0x31, 0x3b, 0xa9, 0xf5, 0x01, 0x99, 0x4b, 0x69, 0x6e, 0xa1,
+  0xaa, 0xa4, 0xc4, 0xa9, 0xf7, 0x97, 0x2d, 0x98, 0x4a, 0xfe, 0x8e, 0x5b, 0xa1, 0xb9, 0x97, 0x2b,
+  0x9e, 0x49, 0xaa, 0xe4, 0x1e, 0x9b, 0x7a, 0xa0, 0x57, 0xa6, 0xe6, 0x62, 0xfe, 0x13, 0xb3, 0xc7,
+  0x66, 0xc1, 0x69, 0xc0, 0x66, 0xc0, 0x10, 0x0b, 0xc0, 0x10, 0xc0, 0x6e, 0x10, 0xc2, 0x1c, 0x6e,
+  0x7a, 0x1c, 0xc0, 0x6f, 0x66, 0x1c, 0xc0, 0x28, 0xc2, 0x6e, 0xc9, 0x6e, 0x6b, 0xc2, 0x6e, 0x39,
+  0xc1, 0x2d, 0x28, 0xc1, 0x2d, 0x39, 0x2d, 0x6b, 0x39, 0xc1, 0x3e, 0x6b, 0x39, 0x3e, 0x39, 0x3e,
+  0x05, 0x3e, 0xc0, 0xa2, 0x78, 0xc0, 0x65, 0x6b, 0x3e, 0x05, 0x0a, 0xc0, 0x3e, 0x05, 0x3e, 0xc3,
+  0x7f, 0x3e, 0x60, 0x24, 0x9f, 0xb7, 0xa0, 0xa8, 0x56, 0xa2, 0x77, 0x6b, 0xa2, 0x88, 0x9f, 0xb8,
+  0xa4, 0x97, 0xa3, 0x78, 0x9d, 0x89, 0x9c, 0xa9, 0xa2, 0x58, 0x4f, 0x9d, 0x89, 0x5e, 0xc0, 0x7b,
+  0xa2, 0x67, 0x5a, 0xa2, 0xb9, 0x79, 0x71, 0xa1, 0xb7, 0x18, 0xa2, 0x78, 0x18, 0x9f, 0x39, 0x2c,
+  0x75, 0xa1, 0xb7, 0xa3, 0xb9, 0xa3, 0x89, 0x45, 0x9d, 0x98, 0x51, 0x2a, 0x1d, 0x5a, 0x17, 0x5b,
+  0x56, 0xc0, 0xa2, 0x77, 0x56, 0x1d, 0xc0, 0xa1, 0xa8, 0x1f, 0x9d, 0xa8, 0xa2, 0x99, 0xc0, 0x65,
+  0x79, 0xc0, 0x14, 0xa3, 0x98, 0x18, 0xa3, 0x88, 0x9c, 0x79, 0x51, 0xa2, 0x48, 0x56, 0x6b, 0xc0,
+  0x9f, 0xc8, 0xa0, 0xa7, 0x5f, 0x0d, 0xa2, 0x78, 0x9f, 0x69, 0x08, 0x1c, 0xa1, 0xa8, 0x9d, 0xa8,
+  0xa3, 0xa7, 0x21, 0x9c, 0x68, 0xc0, 0xa3, 0x98, 0x5b, 0x0e, 0xa3, 0xb8, 0xa2, 0x57, 0x9d, 0x8a,
+  0x7a, 0x7e, 0x9b, 0x79, 0xb7, 0xe5, 0xa3, 0xbb, 0x8b, 0x3b, 0x5d, 0xa7, 0x96, 0xa2, 0xa9, 0xa7,
+  0x97, 0x92, 0x6c, 0x9b, 0x87, 0xa7, 0xb7, 0x77, 0x3c, 0xa7, 0x76, 0x9b, 0xbb, 0x9b, 0x99, 0x9c,
+  0x77, 0xa3, 0x88, 0xa4, 0x97, 0xa3, 0xb8, 0xa1, 0x9a, 0x78, 0xa2, 0x97, 0xa6, 0x97, 0x6f, 0x9d,
+  0xb9, 0xa5, 0x97, 0x9e, 0x69, 0x99, 0x7a, 0xa4, 0x86, 0xa5, 0x89, 0x9b, 0xaa, 0x5e, 0x9d, 0xa9,
+  0xa3, 0x87, 0x9b, 0x8b, 0xa8, 0x85, 0x62, 0x9b, 0x6a, 0xa2, 0x99, 0xa2, 0x77, 0xc0, 0xa3, 0x98,
+  0x7a, 0x6f, 0x9e, 0x69, 0x9b, 0x89, 0xa8, 0x77, 0x9a, 0x8b, 0x99, 0x78, 0x5f, 0x46, 0x16, 0x7f,
+  0x69, 0xa4, 0x77, 0xb0, 0xb6, 0xa7, 0xe9, 0x66, 0x9c, 0x6a, 0xa2, 0x87, 0x31, 0xc1, 0x9d, 0x6a,
+  0x9a, 0x6a, 0x9e, 0x57, 0x55, 0xa2, 0xb9, 0xa6, 0xb6, 0x47, 0x41, 0x7e, 0x9a, 0x69, 0x9d, 0x5a,
+  0xa2, 0x97, 0x3e, 0x9d, 0x7a, 0x1e, 0x99, 0x99, 0x9e, 0xb6, 0xa7, 0x96, 0xa9, 0xb9, 0x9a, 0x89,
+  0x9b, 0x69, 0x46, 0xa2, 0x48, 0x5f, 0x5b, 0x9c, 0x59, 0x76, 0xa3, 0x97, 0x57, 0x9f, 0xb8, 0x9f,
+  0xd7, 0xa2, 0xc5, 0x9c, 0x99, 0x56, 0x0e, 0xa3, 0x68, 0x96, 0x4a, 0xa3, 0x49, 0xa5, 0x5a, 0x77,
+  0x5a, 0x51, 0xa2, 0xa6, 0x20, 0x6f, 0x9b, 0x6a, 0x58, 0xa2, 0x88, 0x7a, 0x2c, 0x6f, 0x03, 0x9f,
+  0xb8, 0xa3, 0x78, 0x67, 0x33, 0xc1, 0x65, 0xa7, 0xd7, 0xa2, 0x97, 0x99, 0x4b, 0xa1, 0xb8, 0xa7,
+  0xb7, 0x9d, 0x8a, 0xa6, 0xb6, 0x1e, 0x9b, 0x69, 0x9d, 0x8a, 0x59, 0xfe, 0x9e, 0x7b, 0xa2, 0x98,
+  0xfe, 0x13, 0xd4, 0x65, 0x28, 0xc0, 0x66, 0x28, 0x6e, 0x28, 0x1c, 0x66, 0xc2, 0x69, 0x66, 0x17,
+  0x10, 0xc1, 0x1c, 0xc1, 0x17, 0x1c, 0xc5, 0x23, 0x28, 0xc4, 0x2d, 0xc0, 0x6f, 0x2d, 0xc0, 0x6b,
+  0x39, 0x69, 0x2d, 0xc0, 0x28, 0xc2, 0x2d, 0x28, 0x2d, 0xc0, 0x39, 0x2d, 0xc4, 0x39, 0xc1, 0x34,
+  0x39, 0xc1, 0x6f, 0x6e, 0x05, 0xc2, 0x0a, 0xc0, 0x65, 0x0a, 0x6f, 0xc1, 0x6e, 0x6e, 0x1b, 0xc0,
+  0x16, 0x1b, 0xc1, 0x20, 0x1b, 0x6f, 0x20, 0x1b, 0xc0, 0xa2, 0x87, 0x76, 0x9f, 0xc7, 0xa1, 0xc7,
+  0xc0, 0x66, 0x7f, 0xa3, 0x97, 0xa4, 0x87, 0x9d, 0x9a, 0x99, 0x79, 0x9b, 0x6a, 0xa2, 0x78, 0xa3,
+  0x78, 0x67, 0x69, 0x49, 0x32, 0x2d, 0x32, 0xa2, 0x88, 0x65, 0x32, 0xc0, 0x65, 0xa0, 0xc7, 0x9f,
+  0xd8, 0xa3, 0x78, 0x21, 0xc0, 0x55, 0xa2, 0x98, 0xa4, 0x77, 0x67, 0x9b, 0x98, 0x9d, 0x89, 0x7a,
+  0x50, 0x52, 0x6b, 0x5a, 0x49, 0xc0, 0x71, 0x7f, 0x7a, 0x69, 0xc0, 0x7e, 0x7e, 0x46, 0x76, 0xa4,
+  0x87, 0x66, 0x3c, 0x29, 0xa2, 0x78, 0x6e, 0x65, 0x99, 0xa9, 0x9d, 0x98, 0x6b, 0x21, 0x1c, 0xa2,
+  0x78, 0xa2, 0x89, 0x45, 0x46, 0xa6, 0x88, 0x5b, 0xc0, 0xa3, 0x97, 0x27, 0x7e, 0xa0, 0xa8, 0xa2,
+  0x79, 0x41, 0xa0, 0xa8, 0xa2, 0x88, 0xa6, 0x97, 0xa3, 0xaa, 0xa2, 0x76, 0x9d, 0x8a, 0x96, 0x68,
+  0x9d, 0x88, 0x36, 0xa2, 0x87, 0x61, 0xa3, 0xb8, 0xa7, 0x88, 0x9a, 0x59, 0x9b, 0x9a, 0x3a, 0xa7,
+  0xb8, 0x9c, 0x6a, 0x56, 0x99, 0x79, 0x33, 0x04, 0x9a, 0x8a, 0x96, 0x77, 0x9d, 0x98, 0x6e, 0xa2,
+  0xa7, 0xa3, 0xa9, 0xa1, 0xa8, 0xaa, 0x95, 0x9c, 0xaa, 0x6d, 0x7f, 0x51, 0xa4, 0x87, 0x1c, 0x9b,
+  0x89, 0xaa, 0x85, 0x6f, 0x9c, 0xa9, 0x6f, 0x9f, 0x69, 0x52, 0x65, 0xa3, 0xa8, 0x6e, 0x9a, 0x7a,
+  0xa4, 0x86, 0x67, 0x52, 0xa5, 0x86, 0xa4, 0x88, 0x98, 0x7b, 0x9f, 0x67, 0xa0, 0xa9, 0xa4, 0x87,
+  0xa2, 0x88, 0xa3, 0xa8, 0x42, 0x6e, 0x6b, 0x9b, 0x5a, 0x14, 0xc0, 0x41, 0x52, 0xa6, 0x86, 0xa5,
+  0x98, 0xa5, 0xa9, 0xa6, 0x98, 0xa4, 0xb7, 0xc1, 0x9b, 0x7b, 0x9c, 0x58, 0x9c, 0x58, 0x7a, 0x9d,
+  0x6a, 0x59, 0xa2, 0xa8, 0xa2, 0x97, 0x47, 0x12, 0x55, 0xa7, 0xb7, 0xa3, 0xc8, 0x98, 0x3c, 0x48,
+  0x2e, 0x9a, 0x79, 0x9a, 0x98, 0xa1, 0xb7, 0xa5, 0xb7, 0x9c, 0x79, 0xa3, 0x97, 0xa2, 0x98, 0x9b,
+  0x8a, 0x33, 0xa1, 0x49, 0x9d, 0x4b, 0x56, 0x19, 0x9f, 0xb9, 0x9f, 0xb7, 0x9f, 0xc8, 0x64, 0x9f,
+  0x69, 0x7e, 0xa2, 0x98, 0x24, 0x99, 0x7b, 0x9c, 0x48, 0xab, 0x38, 0x9d, 0x6c, 0x65, 0x66, 0x7e,
+  0xa3, 0xb7, 0xa3, 0xa8, 0x9b, 0x6a, 0x33, 0xa4, 0xa7, 0x45, 0x7a, 0x08, 0x3b, 0xa0, 0xa8, 0x9d,
+  0x7a, 0xa2, 0x85, 0x32, 0xa0, 0xaa, 0xfe, 0x24, 0xfa, 0x9d, 0x88, 0x6e, 0x69, 0xa4, 0xa8, 0x46,
+  0x27, 0x38, 0xa6, 0xe6, 0xa3, 0xc8, 0x29, 0xfe, 0x8e, 0x3a, 0xab, 0xf8, 0x97, 0x5a, 0x98, 0x4b,
+  0x1d, 0xfe, 0x13, 0xf4, 0xc4, 0x6f, 0x69, 0x2d, 0x62, 0x69, 0xc2, 0x66, 0x1c, 0xc2, 0x6f, 0xc1,
+  0x23, 0xc0, 0x28, 0xc1, 0x1c, 0x28, 0xc3, 0x2d, 0xc3, 0x6b, 0xc0, 0x2d, 0xc1, 0x32, 0x2d, 0x39,
+  0x2d, 0x28, 0xc0, 0x2d, 0x28, 0xc0, 0x2d, 0x39, 0xc0, 0x6e, 0x39, 0x2d, 0x28, 0x2d, 0xc2, 0x32,
+  0x2d, 0x34, 0x39, 0xc0, 0x3e, 0x6f, 0x66, 0xc0, 0x0a, 0xc0, 0x6e, 0xc0, 0xa2, 0x78, 0x66, 0xc2,
+  0xa2, 0x78, 0xc0, 0x7a, 0x2c, 0xc0, 0x20, 0xa2, 0xa7, 0x5a, 0x66, 0xc0, 0x5a, 0x2b, 0x33, 0x2b,
+  0x4a, 0xa1, 0xc8, 0xa2, 0xc7, 0x7f, 0x7e, 0x6d, 0x9f, 0xba, 0x59, 0x71, 0x9e, 0x68, 0x9a, 0x79,
+  0x9d, 0x4a, 0x3e, 0x6e, 0x32, 0xa1, 0xb8, 0x9f, 0xc8, 0x6f, 0x00, 0x55, 0x00, 0x6e, 0x56, 0x51,
+  0x6f, 0x29, 0x9e, 0xb7, 0x9d, 0xd8, 0x5a, 0xa5, 0x69, 0xa2, 0xa7, 0x61, 0x01, 0x9d, 0x99, 0x5b,
+  0xa2, 0x88, 0xa2, 0x67, 0x65, 0x9b, 0xaa, 0x65, 0x7e, 0x79, 0x66, 0x5e, 0x14, 0x7e, 0x6b, 0xc1,
+  0x1c, 0xc0, 0x30, 0x5f, 0x07, 0xa3, 0x89, 0xa3, 0x79, 0x7a, 0x9b, 0xb8, 0x9f, 0xa6, 0x76, 0x9c,
+  0x89, 0x6e, 0x6b, 0x6d, 0x5b, 0xc0, 0x5f, 0xa3, 0x68, 0xa1, 0x9a, 0x51, 0xa4, 0x97, 0xa4, 0x98,
+  0x66, 0x7e, 0xa2, 0x98, 0xa4, 0x87, 0x6b, 0x9d, 0x78, 0xa7, 0xb8, 0xa4, 0xa8, 0xa7, 0xb7, 0x97,
+  0x6c, 0x1d, 0xa4, 0x97, 0x94, 0x4b, 0xa4, 0xa6, 0xa2, 0x99, 0x99, 0x69, 0x65, 0xa8, 0x97, 0x42,
+  0x99, 0x78, 0xaa, 0x87, 0xa1, 0xca, 0xa5, 0x97, 0xa2, 0x79, 0x93, 0x89, 0x30, 0x9c, 0x98, 0xa2,
+  0x77, 0x66, 0x03, 0xa3, 0xa8, 0xa2, 0x77, 0xa2, 0x98, 0xa2, 0xb7, 0xa1, 0xa8, 0xa4, 0x87, 0x6f,
+  0x60, 0xa3, 0x89, 0xa3, 0x88, 0x9c, 0x98, 0x9d, 0x8a, 0x66, 0x51, 0xa7, 0x86, 0x7b, 0x38, 0xa6,
+  0x68, 0x7a, 0x9d, 0x88, 0xa3, 0x98, 0x51, 0x7e, 0xc0, 0x16, 0x57, 0x0e, 0xa3, 0x97, 0x9f, 0x9b,
+  0x15, 0xa4, 0x77, 0x6b, 0x9c, 0x89, 0x69, 0x7f, 0xa7, 0x86, 0xa1, 0xaa, 0x9d, 0x7a, 0x9f, 0x59,
+  0x76, 0x69, 0x55, 0xa4, 0x98, 0x46, 0x04, 0xa3, 0x87, 0xa6, 0xa8, 0xa2, 0x88, 0xa1, 0x8a, 0x98,
+  0x5a, 0x9c, 0x69, 0xc0, 0x6d, 0xa3, 0x99, 0x65, 0x42, 0x6e, 0x22, 0x17, 0x12, 0xa4, 0x97, 0xa0,
+  0xa8, 0x9e, 0x69, 0x9e, 0x68, 0x6e, 0x98, 0x99, 0x9d, 0xb7, 0xa3, 0xa7, 0xaa, 0xb7, 0x76, 0x9a,
+  0x69, 0x40, 0xa5, 0x98, 0xa1, 0xa9, 0x9a, 0x8a, 0x05, 0x01, 0x62, 0x99, 0x79, 0xa1, 0xb8, 0xa5,
+  0x87, 0x9d, 0x8a, 0x9c, 0x89, 0xa5, 0x87, 0xa4, 0x97, 0xa5, 0x99, 0x91, 0x5c, 0x9f, 0x27, 0xa8,
+  0x49, 0x9d, 0x9a, 0x6b, 0x38, 0x65, 0x6b, 0x65, 0xa7, 0xc7, 0x56, 0x9d, 0x99, 0x9e, 0x58, 0x52,
+  0xa4, 0xa7, 0x55, 0xa3, 0xa8, 0x56, 0x27, 0xa4, 0xa6, 0xa5, 0xc8, 0x99, 0x4c, 0x27, 0x2c, 0xa2,
+  0x88, 0x38, 0xa5, 0xe7, 0x3c, 0x99, 0x5b, 0x99, 0x4a, 0xa2, 0x77, 0xa5, 0xb6, 0xa1, 0xb9, 0xa6,
+  0xb7, 0xa3, 0xb8, 0x9c, 0x69, 0xa1, 0x7a, 0xfe, 0x13, 0xf5, 0x6e, 0xc1, 0x34, 0x39, 0x6e, 0x39,
+  0x65, 0xc0, 0x66, 0xc5, 0x39, 0x69, 0x2d, 0x32, 0x2d, 0x28, 0x34, 0x39, 0xc0, 0x2d, 0x28, 0x2d,
+  0xc0, 0x39, 0x2d, 0xc0, 0x39, 0xc8, 0x32, 0x39, 0x3e, 0x39, 0xc1, 0x32, 0xc0, 0x39, 0xc1, 0x3e,
+  0x6f, 0x66, 0x39, 0xc1, 0x2d, 0xc1, 0x39, 0x3e, 0x39, 0xc0, 0x05, 0xc1, 0x0a, 0x6e, 0x6f, 0x0f,
+  0xa2, 0x88, 0xc0, 0x5a, 0x6e, 0x7f, 0x79, 0x77, 0x5e, 0x25, 0x34, 0x20, 0x25, 0x7a, 0xa1, 0xb8,
+  0x23, 0x69, 0xa1, 0xa9, 0x6e, 0x2e, 0x56, 0xa2, 0xa8, 0x4e, 0xa1, 0xc8, 0x9f, 0xc8, 0x5a, 0xa2,
+  0x86, 0x9d, 0xb9, 0x9b, 0x99, 0x51, 0x4f, 0xa0, 0x5a, 0xa1, 0x58, 0x6b, 0x70, 0x9f, 0xb6, 0xa2,
+  0xb8, 0x73, 0x6c, 0x3c, 0x5a, 0x42, 0x5e, 0x47, 0xa2, 0x87, 0x65, 0x9d, 0xba, 0xa0, 0xa6, 0x79,
+  0x5a, 0xa2, 0x79, 0x6e, 0x73, 0x59, 0x3c, 0x55, 0xa2, 0x98, 0xc0, 0x5a, 0xa5, 0x78, 0x9d, 0x99,
+  0x66, 0xc0, 0x9c, 0x98, 0x10, 0xc0, 0x28, 0x0d, 0xa3, 0x89, 0x01, 0x28, 0x39, 0x5a, 0xa7, 0x78,
+  0xa0, 0x5a, 0x65, 0x7e, 0x65, 0x9c, 0xa9, 0x9d, 0xa8, 0x79, 0x04, 0x0d, 0x12, 0x6f, 0x2b, 0x7a,
+  0x62, 0xa1, 0x59, 0x6e, 0xa5, 0xc9, 0xa4, 0x86, 0xa1, 0x9a, 0xc0, 0xa6, 0xb7, 0xa6, 0x98, 0x45,
+  0x52, 0x69, 0x9c, 0x79, 0x1c, 0x50, 0x9b, 0x7a, 0xa1, 0xa8, 0x9d, 0x69, 0x9c, 0x89, 0xa5, 0x97,
+  0xa2, 0x99, 0x69, 0x9a, 0x89, 0x45, 0x5a, 0xa5, 0x99, 0xa4, 0x97, 0xb1, 0xe6, 0x9c, 0x9b, 0x91,
+  0x2a, 0x9f, 0xb7, 0x94, 0x97, 0x6e, 0x56, 0x9c, 0x99, 0xa5, 0x96, 0xa6, 0xb7, 0xa2, 0xa9, 0x9c,
+  0x58, 0x7a, 0xa2, 0x97, 0x51, 0xa3, 0x99, 0xa3, 0xa7, 0xa7, 0xa7, 0x41, 0x46, 0x7e, 0xa5, 0xb8,
+  0x5a, 0x9c, 0x79, 0x9d, 0x99, 0x30, 0x59, 0xaa, 0x97, 0x7f, 0x9a, 0x88, 0xa2, 0x87, 0xa4, 0x87,
+  0x67, 0x55, 0xa2, 0x88, 0x41, 0x9c, 0x89, 0x6b, 0x9d, 0x89, 0xa3, 0x88, 0x6f, 0xa1, 0xa8, 0x9d,
+  0x99, 0x5a, 0x9d, 0x8b, 0xa3, 0x76, 0xa5, 0xa8, 0x6f, 0xa0, 0x48, 0x72, 0x7a, 0x6e, 0x6f, 0x55,
+  0x0f, 0x5a, 0x0f, 0xa4, 0x87, 0x5e, 0xa1, 0x9a, 0x9d, 0x69, 0xa4, 0x98, 0x9d, 0x7b, 0x51, 0x6f,
+  0x9b, 0x58, 0x7b, 0xa5, 0xa6, 0x7b, 0x9c, 0x69, 0x7e, 0x0a, 0x9e, 0x68, 0xa3, 0x87, 0x9c, 0xaa,
+  0x9a, 0xb7, 0x68, 0xa5, 0xc8, 0xa7, 0xb6, 0xa7, 0xa8, 0x94, 0x5c, 0x9c, 0x88, 0xab, 0x96, 0x9b,
+  0x8a, 0x96, 0x7a, 0xa5, 0x96, 0x1f, 0x9d, 0x89, 0x9d, 0x89, 0xa5, 0x97, 0x1f, 0x27, 0xc0, 0xa6,
+  0x87, 0x76, 0x9b, 0x49, 0x9b, 0x69, 0xab, 0x49, 0x9f, 0x5b, 0x61, 0xc0, 0xa2, 0x97, 0xa1, 0xc9,
+  0x9d, 0x59, 0xa1, 0xa8, 0xa2, 0x97, 0x67, 0x9c, 0x68, 0xa5, 0xc7, 0x9a, 0x5a, 0xc0, 0xa3, 0x98,
+  0x9c, 0x78, 0x6e, 0xa2, 0x78, 0x1b, 0x6f, 0x6f, 0xa4, 0xa7, 0x65, 0x43, 0xa1, 0xb7, 0xfe, 0xcf,
+  0x3d, 0xa6, 0xb7, 0x95, 0x5d, 0x95, 0x0b, 0xa8, 0xb3, 0xa7, 0xf8, 0xfe, 0x35, 0x1a, 0xa6, 0xa5,
+  0xa8, 0xf7, 0x9b, 0x7a, 0x9f, 0x68, 0xfe, 0x14, 0x36, 0xc3, 0x6e, 0x6b, 0x05, 0x69, 0x66, 0x66,
+  0xc1, 0x39, 0x34, 0xc1, 0x3e, 0xc0, 0x39, 0xc1, 0x34, 0x39, 0x05, 0x39, 0xc2, 0x3e, 0x39, 0xc1,
+  0x3e, 0xc0, 0x05, 0xc3, 0x0a, 0xc0, 0x05, 0xc1, 0x0a, 0xc0, 0x05, 0x0a, 0xc3, 0x05, 0x0a, 0xc0,
+  0x6f, 0x69, 0x0a, 0xc0, 0x69, 0x0a, 0x05, 0x3e, 0x05, 0x0a, 0x0f, 0x6f, 0xc4, 0xa2, 0x97, 0xa0,
+  0xa8, 0x5e, 0x9e, 0x68, 0xc0, 0x7a, 0xa3, 0xb8, 0xa2, 0xa8, 0x5a, 0x9f, 0x68, 0x57, 0x76, 0x49,
+  0xa2, 0xa8, 0x66, 0x55, 0xa2, 0xa8, 0x66, 0x69, 0x3e, 0xc0, 0x5a, 0x33, 0xa0, 0xa8, 0xa0, 0xa8,
+  0x9e, 0x68, 0x56, 0x70, 0x51, 0x56, 0x6e, 0xa1, 0x7a, 0x64, 0xa0, 0xc7, 0x9f, 0xc8, 0x9d, 0xa9,
+  0xa4, 0x78, 0x6e, 0x5f, 0x55, 0xa1, 0x6a, 0xa0, 0x4a, 0x69, 0x0d, 0x55, 0x64, 0x66, 0x9f, 0xb8,
+  0x66, 0x7e, 0x6e, 0x7a, 0x9e, 0xc8, 0x69, 0x6f, 0x30, 0xa4, 0x88, 0x6f, 0x9c, 0x78, 0xa2, 0x87,
+  0xa5, 0x99, 0x7e, 0x5a, 0x6b, 0x55, 0x51, 0x24, 0x3a, 0xa2, 0x78, 0x9a, 0x88, 0x76, 0xa3, 0x89,
+  0xa2, 0x88, 0xa3, 0x67, 0x7f, 0x98, 0xb8, 0x56, 0x6e, 0x6b, 0xa2, 0x77, 0x3a, 0x5a, 0xc0, 0xa2,
+  0x89, 0x6e, 0xa1, 0xa8, 0xa5, 0xa8, 0x42, 0x17, 0x22, 0xa2, 0x88, 0xa9, 0xc8, 0xa7, 0xb8, 0x9c,
+  0x69, 0x6d, 0x56, 0x9b, 0x8a, 0xa3, 0x97, 0xa4, 0x98, 0x17, 0x96, 0x5b, 0x97, 0x68, 0x69, 0x37,
+  0x7f, 0xa2, 0x97, 0xa4, 0xa9, 0x9c, 0x68, 0xa2, 0x97, 0x9c, 0x7a, 0xa2, 0x77, 0xa4, 0xa8, 0xa4,
+  0x98, 0x3a, 0xa2, 0x98, 0x94, 0x78, 0x94, 0x69, 0x9c, 0x87, 0x9d, 0x98, 0x66, 0xa2, 0x98, 0xa5,
+  0xa6, 0xa1, 0xaa, 0xa2, 0x96, 0x5b, 0x9d, 0x79, 0xc0, 0x2d, 0x65, 0x29, 0x45, 0xa5, 0xa8, 0x9c,
+  0x99, 0x9e, 0x69, 0x6e, 0xa5, 0xb7, 0xa6, 0x86, 0x43, 0x94, 0x7b, 0xa4, 0x86, 0xa3, 0x98, 0xa8,
+  0xa6, 0xa3, 0x99, 0x97, 0x8a, 0xa2, 0x88, 0xa5, 0x87, 0x9a, 0x69, 0x9c, 0x8a, 0xa5, 0x97, 0x56,
+  0x66, 0x9c, 0x88, 0x9f, 0x6a, 0x6e, 0x79, 0xa2, 0x88, 0x9d, 0x9a, 0xc0, 0xa2, 0x78, 0xa2, 0x78,
+  0x75, 0x6b, 0x5a, 0xa2, 0x87, 0xa3, 0x89, 0xa1, 0xa8, 0x51, 0x6b, 0x4d, 0x6b, 0x66, 0x3b, 0xa4,
+  0x87, 0xa1, 0xa9, 0x5a, 0xa5, 0x87, 0x9e, 0x6b, 0x9d, 0x6a, 0x41, 0x9b, 0x59, 0xa5, 0xb8, 0x69,
+  0x31, 0x9a, 0x6a, 0x59, 0x6e, 0x46, 0xa0, 0xa9, 0x9b, 0xb8, 0x9c, 0x86, 0xa5, 0xc7, 0xa8, 0xb6,
+  0xa0, 0xa8, 0xa5, 0x87, 0x9c, 0x7b, 0x99, 0x79, 0xa2, 0x87, 0x57, 0x9c, 0x79, 0x69, 0x5a, 0x9d,
+  0x98, 0x6f, 0x03, 0x69, 0x08, 0x52, 0x69, 0x2c, 0x9a, 0x59, 0xa4, 0x58, 0xac, 0x57, 0xfe, 0x9e,
+  0x9d, 0x98, 0x2b, 0x50, 0x4a, 0x69, 0xfe, 0x8e, 0x3c, 0x97, 0x3c, 0x9e, 0x47, 0x65, 0xa5, 0xb7,
+  0xa3, 0xd9, 0x98, 0x1a, 0x27, 0x6e, 0xa8, 0xd6, 0xa0, 0xa9, 0x97, 0x2c, 0xa5, 0xd6, 0x9f, 0x59,
+  0x45, 0xfe, 0x7e, 0x1a, 0x31, 0x9b, 0x5a, 0xa2, 0xa6, 0xa4, 0xa8, 0x9b, 0x6b, 0x9d, 0x59, 0x00,
+  0x65, 0xa7, 0xd6, 0x9c, 0x6b, 0x61, 0x0b, 0xa0, 0x8a, 0x94, 0x2b, 0xfe, 0x14, 0x77, 0xc0, 0x6e,
+  0x16, 0xc0, 0x1b, 0xc1, 0x75, 0x52, 0xc0, 0x69, 0xc0, 0x66, 0xc0, 0x3e, 0xc0, 0x6f, 0x05, 0x66,
+  0x3e, 0xc2, 0x39, 0xc3, 0x3e, 0x39, 0xc0, 0x05, 0xc3, 0x0a, 0xc7, 0x6e, 0x0a, 0xc5, 0x0f, 0xc0,
+  0xa2, 0x78, 0x7f, 0x20, 0x16, 0x0a, 0xc2, 0x0f, 0x6e, 0xc2, 0x0f, 0x65, 0x3e, 0x7e, 0x6e, 0x03,
+  0x14, 0xa3, 0xa8, 0x6b, 0x20, 0xa3, 0xa8, 0x7a, 0xc0, 0xa1, 0xa8, 0x51, 0x5b, 0x56, 0x33, 0x69,
+  0x9f, 0xba, 0x7d, 0x9e, 0x69, 0x66, 0xa2, 0x78, 0x75, 0x9d, 0x7a, 0x3e, 0x69, 0x66, 0x66, 0xc0,
+  0x37, 0x06, 0x9e, 0xd7, 0x46, 0x4f, 0xa0, 0xf5, 0x9c, 0x99, 0xa2, 0x78, 0x7d, 0x5b, 0xa4, 0x69,
+  0xa2, 0x89, 0x9c, 0x87, 0xa2, 0x78, 0xa5, 0x59, 0x61, 0x9d, 0xb9, 0x9a, 0x98, 0x4d, 0x76, 0x7a,
+  0x6e, 0x5a, 0x7b, 0xc0, 0x79, 0x28, 0x6e, 0xc0, 0xa2, 0x88, 0xa3, 0x88, 0x56, 0x66, 0x7e, 0xc0,
+  0x65, 0xa5, 0x79, 0xa3, 0x88, 0x7f, 0x6b, 0x59, 0x61, 0x42, 0x55, 0xa2, 0x98, 0x75, 0x65, 0xa4,
+  0x88, 0x9b, 0x79, 0x9b, 0x99, 0xa1, 0xa8, 0x0d, 0x69, 0x3a, 0x52, 0x68, 0x26, 0x66, 0xa4, 0x77,
+  0xa4, 0x98, 0x9c, 0x89, 0x40, 0x3d, 0x9c, 0x68, 0xaf, 0xa8, 0xa5, 0xa8, 0x66, 0x52, 0x62, 0x9e,
+  0x68, 0xa3, 0x86, 0xa5, 0xb9, 0x7a, 0xa2, 0x88, 0x98, 0x8b, 0x98, 0x57, 0x9d, 0x69, 0x55, 0xac,
+  0xe5, 0x94, 0x4a, 0x5a, 0x29, 0x52, 0xb0, 0xb5, 0xa6, 0xc7, 0x93, 0x5d, 0x91, 0x57, 0xa3, 0xa7,
+  0x28, 0x65, 0x61, 0x6e, 0xa3, 0xa9, 0xa7, 0xd6, 0xa9, 0xb5, 0x99, 0x8a, 0x9e, 0x59, 0xa8, 0x87,
+  0x96, 0x8a, 0x9d, 0x79, 0xa8, 0xb6, 0xa7, 0xb7, 0x9b, 0x7a, 0x59, 0xa2, 0x78, 0x99, 0x8b, 0x21,
+  0x2e, 0xa3, 0x98, 0x0d, 0xa2, 0x79, 0x65, 0xa3, 0xa7, 0xa6, 0x87, 0xa4, 0x98, 0x97, 0x8b, 0x0a,
+  0x52, 0xa9, 0xa6, 0x9a, 0x7b, 0x98, 0x59, 0xa5, 0x98, 0xa4, 0x97, 0x9b, 0x8a, 0x65, 0xa4, 0x87,
+  0x56, 0x66, 0x7e, 0x20, 0x7e, 0x20, 0x5a, 0x42, 0x3e, 0x6b, 0x55, 0x4e, 0x72, 0x5e, 0xa3, 0x99,
+  0x55, 0xa2, 0x78, 0x13, 0x46, 0xa3, 0x88, 0xa1, 0xa8, 0xa1, 0x9a, 0x2c, 0xa3, 0x99, 0xa2, 0x78,
+  0x5e, 0x43, 0xa3, 0x79, 0x62, 0x69, 0x9d, 0x6b, 0x9e, 0x57, 0xa1, 0xa8, 0x5b, 0x9d, 0xa9, 0x99,
+  0xb7, 0xa2, 0xa6, 0xaa, 0xc6, 0xa6, 0xb7, 0x9d, 0x89, 0x42, 0x51, 0x9d, 0x79, 0x9b, 0x79, 0xa4,
+  0x78, 0x08, 0x66, 0xa2, 0x76, 0xa9, 0xa9, 0x99, 0x9b, 0x9a, 0x78, 0x6e, 0x6d, 0x57, 0x41, 0x9c,
+  0x99, 0x49, 0xa8, 0x48, 0xa0, 0x4a, 0xa7, 0xd6, 0x9d, 0x8a, 0x98, 0x6b, 0x5e, 0xa7, 0xb7, 0xa5,
+  0xe9, 0xfe, 0x14, 0xfb, 0x68, 0x66, 0x38, 0xc1, 0x6b, 0x38, 0xfe, 0x76, 0x1a, 0xa1, 0xaa, 0x9e,
+  0x58, 0xfe, 0xc7, 0x1d, 0x99, 0x8c, 0x9e, 0x48, 0x6d, 0xa2, 0xa8, 0x9a, 0x4a, 0x68, 0xa6, 0xb7,
+  0x99, 0x4c, 0x99, 0x5b, 0xa3, 0x96, 0x7e, 0x33, 0x3e, 0xa3, 0x98, 0x9a, 0x79, 0xc0, 0xa2, 0x77,
+  0xfe, 0x14, 0x76, 0xc1, 0x6f, 0xc1, 0x0f, 0x7e, 0x6b, 0x51, 0xc0, 0x65, 0x66, 0xc1, 0x3e, 0x6b,
+  0x0f, 0x0a, 0x0f, 0x0a, 0x05, 0xc1, 0x39, 0xc2, 0x05, 0xc4, 0x0a, 0x05, 0xc0, 0x0a, 0xc0, 0x05,
+  0x0a, 0xc1, 0x3e, 0xc0, 0x39, 0x3e, 0xc3, 0x39, 0xc1, 0x3e, 0xc0, 0x0f, 0x6e, 0x0f, 0xc0, 0x3e,
+  0xc0, 0x39, 0xc0, 0x65, 0xc0, 0x65, 0xc0, 0x66, 0x69, 0xc1, 0x1c, 0x21, 0x2d, 0x3e, 0x7e, 0x6f,
+  0x0a, 0x69, 0x6e, 0x0f, 0xc0, 0x03, 0xc0, 0x3e, 0x65, 0x6e, 0x39, 0x3e, 0x2d, 0xc0, 0x21, 0x1c,
+  0xa2, 0x77, 0xc0, 0x32, 0xc1, 0x2d, 0xa2, 0xa5, 0x9d, 0xe9, 0x9c, 0xb8, 0xa3, 0x29, 0xa3, 0x5a,
+  0xa1, 0xc7, 0x35, 0x7a, 0x9e, 0xc7, 0xa3, 0x68, 0xa2, 0x69, 0xa1, 0xb8, 0x51, 0xc0, 0x59, 0xa3,
+  0x89, 0x9f, 0xc8, 0x9a, 0xb8, 0x50, 0x6e, 0x67, 0x6e, 0x10, 0xc0, 0x5b, 0x6f, 0x7a, 0x1c, 0x14,
+  0xc0, 0x28, 0x6e, 0xc1, 0x56, 0xa3, 0x88, 0x6e, 0x7b, 0xa4, 0x87, 0x9d, 0x79, 0x03, 0xa3, 0x89,
+  0xa3, 0x89, 0x61, 0xa2, 0xa7, 0x9b, 0xa8, 0xa0, 0x59, 0xc0, 0x9d, 0x9a, 0x54, 0xa2, 0xa7, 0x66,
+  0xa2, 0x78, 0x12, 0x0d, 0xa3, 0x98, 0x9b, 0x89, 0xa4, 0x88, 0x12, 0x7a, 0x5b, 0x55, 0x56, 0xae,
+  0xa6, 0xa6, 0xa9, 0x9c, 0x69, 0xab, 0xd6, 0xa3, 0xa8, 0x9b, 0x7b, 0x97, 0x59, 0xa3, 0x88, 0xaa,
+  0xd6, 0x42, 0x9d, 0x79, 0x31, 0x97, 0x6c, 0xa7, 0xa6, 0x5a, 0x97, 0x7b, 0x9b, 0x78, 0xad, 0xd6,
+  0x9c, 0x7b, 0x40, 0x29, 0x19, 0x8b, 0x5a, 0x95, 0x88, 0x1c, 0x69, 0x56, 0xa5, 0xb8, 0x7e, 0x9d,
+  0x89, 0xa2, 0xa8, 0x7e, 0x61, 0xa3, 0x88, 0xa6, 0x95, 0x9d, 0x8b, 0x9c, 0x88, 0xa9, 0xa5, 0xab,
+  0xa7, 0x9d, 0x9a, 0x52, 0x54, 0x9c, 0x8a, 0x6e, 0xa2, 0x87, 0x29, 0x7e, 0x99, 0x7a, 0xc0, 0xa4,
+  0xa7, 0xa2, 0x68, 0x9c, 0x7a, 0x99, 0x8a, 0xa2, 0x87, 0xc0, 0x1c, 0x9d, 0xaa, 0x99, 0x59, 0x6e,
+  0xa4, 0x97, 0x6b, 0x0c, 0xa6, 0x86, 0x6f, 0x9e, 0x7b, 0x98, 0x89, 0x35, 0x42, 0x41, 0x5f, 0x42,
+  0x51, 0xa3, 0x78, 0x7b, 0x41, 0xc1, 0x6e, 0x46, 0xa2, 0x98, 0xa3, 0xa9, 0x59, 0x51, 0xa3, 0x98,
+  0x7b, 0x55, 0x7e, 0xad, 0x96, 0xa0, 0xbb, 0x98, 0x68, 0xa2, 0x57, 0xa2, 0x89, 0xa1, 0x8a, 0x9d,
+  0x69, 0x56, 0x4a, 0x9f, 0x69, 0x9b, 0xd8, 0x9c, 0xb6, 0xa7, 0xb7, 0xac, 0xd5, 0x57, 0x56, 0x9b,
+  0x8b, 0x69, 0x9d, 0x78, 0x9c, 0x59, 0x75, 0xa5, 0x97, 0x9d, 0x89, 0x67, 0xaf, 0x86, 0x97, 0x9c,
+  0x97, 0x78, 0x5a, 0xa5, 0x97, 0xa2, 0x99, 0x9b, 0x99, 0x9d, 0x69, 0x9f, 0x58, 0xa6, 0x49, 0x9d,
+  0x6a, 0x67, 0xa8, 0xc5, 0xa5, 0xb7, 0x95, 0x1d, 0xa2, 0x98, 0xc0, 0xa5, 0xa7, 0x4a, 0x36, 0x57,
+  0x41, 0xa1, 0xa8, 0x9b, 0x6a, 0xa4, 0xa5, 0x66, 0xa7, 0xe7, 0xfe, 0xff, 0xff, 0x9d, 0x8a, 0x9d,
+  0x89, 0x97, 0x3c, 0x95, 0x0a, 0xa7, 0xd6, 0x9c, 0x79, 0xab, 0xe5, 0xa8, 0xc7, 0x8f, 0x0e, 0xa3,
+  0x97, 0xac, 0xf4, 0x9b, 0x6b, 0x9d, 0x7a, 0x99, 0x3a, 0x3a, 0x6e, 0x65, 0xa2, 0x78, 0xfe, 0x14,
+  0x15, 0xc1, 0xa2, 0x78, 0xc1, 0x66, 0xc0, 0x0a, 0x65, 0x05, 0xc1, 0x3e, 0xc0, 0x39, 0xc0, 0x3e,
+  0x0a, 0x6e, 0xc0, 0x0a, 0xc2, 0x05, 0xc0, 0x39, 0xc0, 0x05, 0xc2, 0x0a, 0xc0, 0x05, 0xc0, 0x0a,
+  0x3e, 0x39, 0xc0, 0x66, 0x69, 0xc1, 0x66, 0xc0, 0x69, 0x6e, 0x28, 0xc0, 0x21, 0xc1, 0x28, 0xc0,
+  0xa2, 0x77, 0x39, 0xc0, 0x3e, 0xc0, 0x2d, 0x28, 0x21, 0x66, 0x65, 0xc0, 0x6e, 0x10, 0x65, 0x10,
+  0x69, 0xc0, 0x67, 0x10, 0x21, 0xc1, 0x2d, 0xa2, 0x77, 0x6e, 0x3e, 0x6e, 0x3e, 0x39, 0x32, 0x2d,
+  0xc0, 0x03, 0x2d, 0x21, 0xc0, 0x15, 0x21, 0xc0, 0x7f, 0x6e, 0x7f, 0x5a, 0x37, 0xfe, 0x4c, 0x13,
+  0x79, 0x9e, 0x59, 0xa0, 0x59, 0x32, 0xc0, 0x01, 0x32, 0xc0, 0xa0, 0xa8, 0x7e, 0x6e, 0x76, 0xc0,
+  0x55, 0xa2, 0x77, 0x7f, 0x9d, 0xc9, 0x9c, 0xc8, 0x49, 0x6e, 0xc0, 0x7a, 0x51, 0x76, 0x6e, 0x08,
+  0x56, 0x08, 0xc0, 0x06, 0x08, 0x66, 0x00, 0x08, 0x14, 0x76, 0x08, 0x14, 0xc0, 0xa7, 0x77, 0xa4,
+  0x89, 0x9d, 0x99, 0xc0, 0xa4, 0x97, 0x9a, 0x88, 0x46, 0xa2, 0x88, 0x9d, 0x99, 0x51, 0x7e, 0xa4,
+  0x87, 0xa2, 0x89, 0x9c, 0x98, 0xa4, 0x86, 0x7b, 0x42, 0x56, 0x59, 0xa2, 0x98, 0x47, 0xa3, 0x79,
+  0xa5, 0x97, 0xae, 0xc7, 0xa6, 0xc7, 0xc0, 0x9c, 0x6a, 0xa3, 0xb7, 0x31, 0x42, 0xc0, 0x31, 0xc0,
+  0x11, 0x9b, 0x6a, 0x9c, 0x76, 0xa2, 0x98, 0x30, 0xa5, 0xb8, 0x9b, 0x8a, 0xa2, 0x87, 0xa2, 0x87,
+  0x21, 0x98, 0x59, 0x8e, 0x69, 0x9a, 0x97, 0x7a, 0x45, 0x7b, 0xaa, 0xb5, 0xa0, 0xb9, 0x9d, 0x78,
+  0xc0, 0x42, 0x9c, 0x77, 0xa1, 0x9a, 0xa5, 0xc7, 0xa4, 0xa7, 0x9e, 0x68, 0x65, 0xa7, 0x97, 0xa5,
+  0x88, 0x9d, 0x99, 0x9a, 0x79, 0xa4, 0x88, 0xa4, 0x97, 0x9d, 0x79, 0x65, 0x57, 0x66, 0x59, 0x67,
+  0x40, 0x56, 0x6f, 0xa2, 0x89, 0x79, 0xa2, 0x88, 0x9b, 0x89, 0x7e, 0x32, 0x9c, 0x79, 0xa3, 0x88,
+  0xc0, 0x9b, 0x8a, 0x55, 0x6f, 0x28, 0x9d, 0x8a, 0x9d, 0x68, 0x4f, 0x7b, 0x6f, 0x5e, 0x7f, 0xa7,
+  0xb7, 0xa4, 0x88, 0x96, 0x4b, 0xa1, 0xa7, 0x5b, 0x2b, 0xaa, 0xc6, 0xa0, 0x8a, 0x98, 0x49, 0x2b,
+  0x36, 0x59, 0x9d, 0x99, 0x7b, 0x51, 0xa9, 0x86, 0x9f, 0xba, 0x98, 0x88, 0xb2, 0xc5, 0x9c, 0x8b,
+  0x97, 0x79, 0xa5, 0x56, 0xa5, 0xa8, 0x9d, 0x7b, 0x9a, 0x59, 0x13, 0xa1, 0xc8, 0xab, 0xe5, 0xa8,
+  0xa7, 0x9a, 0x7a, 0xa4, 0x87, 0x99, 0x7a, 0x55, 0x9b, 0x6a, 0x6f, 0x9d, 0xa7, 0x0b, 0xc0, 0xa3,
+  0x98, 0x9d, 0x79, 0x9c, 0x89, 0x6f, 0x69, 0xa3, 0x88, 0x76, 0xa7, 0x98, 0x95, 0x5b, 0xa1, 0x48,
+  0xa4, 0x49, 0xfe, 0x7d, 0xfa, 0x9d, 0x6b, 0x9d, 0x69, 0xa3, 0xb7, 0x9b, 0x3b, 0x59, 0xa8, 0xc5,
+  0xfe, 0xef, 0x9e, 0x9d, 0x8b, 0x6e, 0x97, 0x3a, 0x18, 0x45, 0x9d, 0x89, 0xa5, 0xb6, 0xa6, 0xd7,
+  0xa3, 0x98, 0x9d, 0x6a, 0x9d, 0x89, 0x9e, 0x69, 0x06, 0x6e, 0x16, 0xa5, 0xd8, 0x47, 0x5a, 0xa3,
+  0xa7, 0xa2, 0x98, 0x9a, 0x4a, 0xa2, 0x97, 0x41, 0x99, 0x1c, 0x9c, 0x58, 0xa2, 0x87, 0xa2, 0xa7,
+  0xa5, 0xe7, 0xfe, 0x13, 0xf5, 0xc0, 0x6e, 0x6f, 0xc0, 0x39, 0xc7, 0x6e, 0x05, 0x6e, 0x3e, 0xc1,
+  0x6e, 0xc1, 0x0a, 0xc0, 0x05, 0xc2, 0x0a, 0xc0, 0x05, 0x0a, 0xc0, 0x05, 0x3e, 0x39, 0xc0, 0x65,
+  0xc0, 0x66, 0x65, 0xc4, 0x69, 0x66, 0x1c, 0xc0, 0x15, 0xc0, 0x1c, 0xc1, 0x28, 0x2d, 0xc0, 0x6e,
+  0x39, 0x2d, 0x65, 0xc0, 0x1c, 0xc0, 0x21, 0x15, 0x10, 0x66, 0x10, 0xc0, 0x65, 0x0b, 0x15, 0x6e,
+  0x7b, 0x6f, 0x59, 0x7f, 0x3e, 0x03, 0xc0, 0x65, 0x3e, 0xc0, 0x32, 0xc0, 0x2d, 0x1c, 0x15, 0x7b,
+  0x21, 0xc1, 0xa3, 0x98, 0xa1, 0xa9, 0x69, 0x42, 0xc0, 0xa3, 0x88, 0x65, 0x9f, 0xb8, 0x3d, 0x37,
+  0x3e, 0x79, 0x3d, 0x26, 0x38, 0x79, 0xc0, 0x76, 0x7e, 0x5e, 0x42, 0x5a, 0xa2, 0x98, 0x9d, 0xc8,
+  0x61, 0x69, 0x7a, 0xa2, 0x77, 0x14, 0xa1, 0x58, 0xc0, 0x9e, 0xb9, 0x75, 0x66, 0xa2, 0x77, 0xc0,
+  0x03, 0x5e, 0x66, 0x69, 0x00, 0x08, 0x7e, 0x14, 0x7e, 0xa6, 0x77, 0x7b, 0x9c, 0x88, 0xa5, 0x79,
+  0x65, 0x9d, 0x97, 0xa0, 0x8a, 0x56, 0x65, 0xa2, 0x87, 0xa7, 0xa7, 0x9d, 0x7a, 0xc0, 0x6d, 0x7a,
+  0x66, 0xa4, 0x78, 0x9a, 0x89, 0xa4, 0x96, 0x47, 0x6b, 0xa4, 0x77, 0xac, 0x98, 0xa0, 0xa9, 0x9a,
+  0x78, 0xa6, 0x97, 0xa8, 0xa8, 0xa2, 0xa7, 0xc1, 0x46, 0x99, 0x7b, 0x9b, 0x78, 0x7e, 0x99, 0x69,
+  0x9a, 0x78, 0x3a, 0xa2, 0x97, 0xa3, 0xb7, 0x57, 0xa2, 0x77, 0xa2, 0x98, 0x5a, 0x15, 0x99, 0xa9,
+  0xc0, 0x00, 0xa2, 0x97, 0xa7, 0xb8, 0xa1, 0xb8, 0x9d, 0x78, 0xa1, 0xa9, 0xa2, 0x87, 0x56, 0x7d,
+  0x7f, 0xa4, 0x97, 0x9d, 0x8a, 0x9a, 0x68, 0xc0, 0x9d, 0x7a, 0xa2, 0x97, 0xc0, 0xa2, 0x78, 0xa4,
+  0x98, 0x69, 0xa0, 0xa9, 0xa2, 0x88, 0x99, 0x7a, 0x55, 0xa8, 0x96, 0xa2, 0x98, 0x9c, 0x79, 0x6b,
+  0x2a, 0xa7, 0x98, 0x9d, 0xb8, 0x9e, 0x69, 0x9d, 0x89, 0x45, 0x9c, 0x7a, 0x51, 0x41, 0x17, 0xa2,
+  0x68, 0x6f, 0xa1, 0x5a, 0xa3, 0x97, 0xa2, 0x69, 0x9e, 0x5a, 0xa1, 0xa7, 0xa2, 0x77, 0xa0, 0xa9,
+  0x6e, 0xa3, 0x98, 0xa3, 0xb8, 0x9b, 0x7a, 0x31, 0xa2, 0x87, 0x57, 0xa2, 0x87, 0xa6, 0xb7, 0x5a,
+  0x9d, 0x9a, 0x51, 0xa3, 0x98, 0x33, 0x7a, 0x1f, 0xc0, 0xa0, 0xa8, 0x9c, 0x68, 0x65, 0xb4, 0xe5,
+  0x94, 0x7c, 0x92, 0x57, 0x18, 0xa2, 0x88, 0xc0, 0x15, 0x5e, 0x53, 0xa6, 0xd6, 0xaf, 0xd4, 0xa4,
+  0x78, 0x98, 0x6c, 0x95, 0x89, 0xa4, 0x87, 0x45, 0x9d, 0x89, 0x0e, 0xa3, 0x88, 0x51, 0x9c, 0x89,
+  0xa2, 0x67, 0xc0, 0x6e, 0xa2, 0x99, 0x9c, 0x89, 0xa9, 0xa5, 0x9c, 0x6c, 0x95, 0x59, 0xac, 0x58,
+  0x9c, 0x4b, 0x78, 0x47, 0x51, 0xa8, 0xd6, 0x9d, 0x6a, 0x27, 0xa5, 0xc7, 0xa9, 0xf7, 0x98, 0x5b,
+  0x9c, 0x58, 0x27, 0xa7, 0xe6, 0x9f, 0x9b, 0x9c, 0x49, 0xa2, 0x96, 0xa5, 0xc7, 0x9a, 0x5a, 0x9d,
+  0x5a, 0xa7, 0xb6, 0xa4, 0xc7, 0x43, 0x59, 0xa4, 0xc6, 0xa8, 0xd7, 0x96, 0x1c, 0x97, 0x1b, 0xa7,
+  0xc4, 0xa2, 0xc9, 0x55, 0x5b, 0x9b, 0x4a, 0xa3, 0xa6, 0xa4, 0xd7, 0x98, 0x2c, 0x44, 0xfe, 0xae,
+  0xbb, 0xfe, 0x14, 0x15, 0x66, 0x39, 0xa2, 0x78, 0x66, 0x39, 0xc5, 0x34, 0xc0, 0x39, 0x6e, 0x05,
+  0xc1, 0x3e, 0xc1, 0x39, 0xc0, 0x05, 0xc0, 0x0a, 0x6e, 0x0a, 0xc0, 0x3e, 0x05, 0x3e, 0xc0, 0x39,
+  0xc0, 0x65, 0xc1, 0x66, 0x69, 0x66, 0x65, 0x6e, 0x10, 0xc1, 0x15, 0x10, 0x1c, 0xc5, 0x28, 0x2d,
+  0x39, 0x3e, 0xc0, 0x39, 0x2d, 0x1c, 0x15, 0x1c, 0x21, 0x15, 0xc0, 0x62, 0xc0, 0x10, 0x69, 0x15,
+  0x1c, 0x21, 0xc0, 0x7e, 0x2d, 0xc0, 0xa3, 0x77, 0x6b, 0x39, 0x3e, 0xc0, 0x03, 0x2d, 0x7a, 0x59,
+  0x1c, 0x15, 0x1c, 0x21, 0x26, 0x7f, 0x7a, 0xa1, 0xa8, 0x6e, 0x38, 0xa3, 0x88, 0x08, 0x9f, 0xc8,
+  0x9f, 0xb7, 0x9f, 0x69, 0x4b, 0x46, 0xa2, 0x68, 0x35, 0x26, 0xa1, 0xa8, 0xc0, 0x65, 0x76, 0x7b,
+  0x2b, 0x2d, 0x4e, 0x29, 0xa0, 0xa8, 0xc0, 0xa0, 0xa7, 0x71, 0x45, 0xa2, 0x78, 0x4b, 0x21, 0x15,
+  0x9f, 0xc8, 0x9f, 0xb7, 0xc0, 0x7a, 0x05, 0x62, 0xc0, 0x69, 0x7f, 0xa2, 0x77, 0x7e, 0x66, 0x6f,
+  0x10, 0xa3, 0x89, 0xa5, 0x89, 0x5a, 0x9a, 0x98, 0x69, 0xa1, 0x8a, 0x69, 0xc0, 0xa2, 0x97, 0xa7,
+  0x97, 0x4b, 0xa3, 0xb7, 0x52, 0x9d, 0x78, 0xa5, 0x89, 0x9a, 0x89, 0x66, 0xc0, 0x42, 0x6b, 0xa4,
+  0x87, 0xa3, 0x88, 0x76, 0x9c, 0x68, 0xa4, 0x97, 0xab, 0xa7, 0xaa, 0xb8, 0xa1, 0xa9, 0x94, 0x6a,
+  0x92, 0x48, 0xa8, 0x97, 0x57, 0x94, 0x67, 0xa5, 0xa8, 0xa1, 0x9a, 0x9d, 0x98, 0x9d, 0x98, 0x66,
+  0x5d, 0xa2, 0x89, 0x30, 0x41, 0x28, 0x75, 0x03, 0xa7, 0x97, 0xa6, 0xd6, 0x9d, 0x89, 0x7e, 0x3d,
+  0x21, 0x56, 0xc0, 0x29, 0x21, 0x9d, 0x7a, 0x41, 0xa3, 0x98, 0x76, 0x59, 0x7a, 0x52, 0x46, 0xa4,
+  0x97, 0x21, 0x51, 0xa9, 0x97, 0xa3, 0x98, 0x9b, 0x8a, 0xa2, 0x97, 0x7e, 0x52, 0xa2, 0x77, 0x5f,
+  0x9b, 0x8a, 0x9d, 0x89, 0x9d, 0x79, 0x51, 0x9d, 0x8a, 0x4a, 0x34, 0x4f, 0xa3, 0x59, 0x4e, 0x6f,
+  0x0f, 0xa2, 0xb7, 0xa1, 0xa8, 0x9c, 0x69, 0xa2, 0x88, 0xc0, 0xa4, 0x97, 0x47, 0xa6, 0xd6, 0x9d,
+  0x7a, 0x9a, 0x38, 0xa2, 0x98, 0x56, 0xa2, 0x97, 0x5a, 0x57, 0xa1, 0xb8, 0xaa, 0xe6, 0x9b, 0x5b,
+  0x9c, 0x47, 0xa2, 0x98, 0xa1, 0xa9, 0xa3, 0xa6, 0xa0, 0x8a, 0xa2, 0x87, 0x9d, 0x49, 0x9d, 0x89,
+  0x9f, 0xb9, 0x9e, 0x58, 0xa1, 0xb8, 0x9c, 0x98, 0x9d, 0x99, 0xa1, 0xb7, 0xa3, 0xb8, 0x9d, 0x88,
+  0x9c, 0x79, 0xa6, 0xb6, 0xb5, 0xf4, 0xa2, 0x79, 0x90, 0x6b, 0x9d, 0x89, 0xa3, 0x88, 0x51, 0x9c,
+  0x88, 0xa3, 0x89, 0xa2, 0x77, 0x5a, 0x62, 0x9d, 0x99, 0xa4, 0x87, 0x45, 0xa4, 0x98, 0xa2, 0x99,
+  0x5b, 0x90, 0x5a, 0xa9, 0x66, 0xa3, 0x3a, 0x9c, 0x6a, 0xc0, 0x6f, 0x2c, 0xa3, 0xb7, 0x6b, 0x9c,
+  0x69, 0x7a, 0x52, 0x6d, 0x27, 0xc0, 0xa7, 0xd6, 0xa5, 0xc8, 0x95, 0x1c, 0xab, 0xe5, 0x9a, 0x5b,
+  0x7a, 0x6e, 0xa5, 0xb7, 0xa6, 0xd6, 0x9c, 0x6a, 0x99, 0x3b, 0x9f, 0x68, 0x9d, 0x69, 0x38, 0xa2,
+  0x88, 0x76, 0xa7, 0xd5, 0xa7, 0xf7, 0xfe, 0x35, 0x3b, 0x0a, 0xfe, 0xbe, 0xdc, 0x9b, 0x4b, 0x99,
+  0x4b, 0xa2, 0x96, 0x22, 0xfe, 0x14, 0x15, 0xc0, 0x6f, 0xc2, 0x39, 0xc0, 0x6e, 0x39, 0x6b, 0x39,
+  0xc0, 0x00, 0x05, 0x39, 0xc3, 0x05, 0x3e, 0x05, 0xc0, 0x3e, 0x05, 0x6e, 0xc1, 0x3e, 0xc0, 0x39,
+  0xc1, 0x69, 0x66, 0xc1, 0x65, 0x66, 0xc1, 0x66, 0x1c, 0xc0, 0x65, 0x6e, 0x1c, 0x15, 0xc0, 0x1c,
+  0xc3, 0x2d, 0xc0, 0x39, 0x3e, 0xc2, 0x2d, 0x1c, 0x21, 0x1c, 0xc0, 0x21, 0x15, 0x10, 0xc1, 0x15,
+  0x10, 0x21, 0x6e, 0x2d, 0x32, 0xa3, 0x88, 0x56, 0x75, 0x6e, 0x56, 0x39, 0x3e, 0xc1, 0x64, 0x21,
+  0x26, 0xc0, 0x1c, 0x21, 0xc0, 0x7b, 0xa2, 0x86, 0x6f, 0x7f, 0x7e, 0x9d, 0xc8, 0x64, 0xa3, 0x99,
+  0x64, 0x9c, 0x99, 0x7a, 0x5b, 0xa1, 0x39, 0x26, 0x31, 0x7a, 0x66, 0x79, 0x6b, 0x55, 0x6b, 0x2b,
+  0xc0, 0x9f, 0x6a, 0x23, 0x7a, 0xa2, 0x97, 0x66, 0x45, 0x26, 0x66, 0x49, 0xc0, 0xa0, 0xa8, 0x9f,
+  0xb8, 0x61, 0xc0, 0x5a, 0xa2, 0x98, 0x14, 0x00, 0x03, 0x1c, 0x14, 0x79, 0xa2, 0x88, 0x1c, 0xa3,
+  0x78, 0xa5, 0x79, 0x9b, 0xb9, 0x9c, 0x87, 0xa1, 0x9a, 0x6e, 0x7e, 0xa6, 0x87, 0xa5, 0x97, 0x9c,
+  0x69, 0x25, 0xa6, 0xb6, 0x9c, 0x59, 0x9c, 0x79, 0xa6, 0x88, 0x9d, 0x89, 0x61, 0x5b, 0x56, 0x55,
+  0x19, 0x21, 0x75, 0xa3, 0x88, 0xa4, 0x88, 0xa5, 0x89, 0x52, 0x9d, 0x98, 0x98, 0x78, 0xa3, 0x98,
+  0xa2, 0x98, 0xa3, 0x99, 0x99, 0x79, 0x69, 0x1d, 0x62, 0x55, 0x55, 0x3c, 0x79, 0x41, 0x76, 0x6f,
+  0x40, 0xa3, 0xb8, 0xaa, 0xc6, 0x51, 0x41, 0xa1, 0xa9, 0x55, 0xc0, 0x26, 0x56, 0x9b, 0x89, 0x5a,
+  0xa2, 0xa8, 0x26, 0xa0, 0xa8, 0xa4, 0x87, 0x51, 0x05, 0xa3, 0x98, 0x51, 0xa5, 0x97, 0xa2, 0xa7,
+  0x9d, 0x7a, 0xab, 0xa6, 0xa2, 0x98, 0x56, 0x56, 0x9d, 0x69, 0x99, 0x8a, 0x9d, 0x69, 0x7b, 0x9a,
+  0x7a, 0x9c, 0x58, 0xa3, 0x78, 0xa2, 0x79, 0xa2, 0x79, 0xa4, 0x77, 0x4a, 0x47, 0x56, 0x5a, 0xc0,
+  0x3e, 0x65, 0xa2, 0xb6, 0xa1, 0x9a, 0x5e, 0xa2, 0x89, 0x79, 0x4a, 0xaa, 0xd7, 0x9c, 0x6a, 0x99,
+  0x49, 0xa7, 0xd6, 0xa1, 0x9b, 0x97, 0x4a, 0xa3, 0x86, 0x43, 0x26, 0xa8, 0xc5, 0xac, 0xf7, 0x9a,
+  0x5b, 0x9c, 0x59, 0x9b, 0x79, 0x45, 0x45, 0xa7, 0xc6, 0xa0, 0x7a, 0x97, 0x6b, 0xa5, 0xa5, 0xa2,
+  0x89, 0x9e, 0x69, 0xa6, 0xc6, 0xa3, 0xb9, 0x98, 0x99, 0x95, 0x89, 0xa2, 0xa5, 0xac, 0xa6, 0xa2,
+  0xc8, 0xa2, 0x96, 0x9a, 0x7b, 0x9d, 0x68, 0x66, 0x9c, 0x78, 0x5b, 0x69, 0xa2, 0x68, 0x9b, 0xaa,
+  0xa7, 0x87, 0xa7, 0xa9, 0x96, 0x8a, 0x6c, 0x9d, 0x89, 0xa4, 0x76, 0xae, 0xa7, 0x96, 0x5e, 0x91,
+  0x68, 0xaa, 0x66, 0xa0, 0x3b, 0x46, 0xc0, 0x7b, 0x51, 0xa3, 0xa7, 0xa9, 0xf6, 0x14, 0xa2, 0x77,
+  0xa1, 0xa9, 0x9c, 0x5a, 0x36, 0x2c, 0xc0, 0xfe, 0x9e, 0x9b, 0x9d, 0x7c, 0x95, 0x0b, 0xa2, 0x86,
+  0xa2, 0xb8, 0xa6, 0xb5, 0xa0, 0xaa, 0x9d, 0x89, 0x9e, 0x58, 0x9b, 0x4a, 0x2c, 0x6f, 0xa1, 0xb8,
+  0x46, 0x51, 0x2c, 0xa6, 0xe7, 0x6e, 0x06, 0xa2, 0xc6, 0xa5, 0x99, 0x06, 0x7a, 0xa8, 0xd5, 0xfe,
+  0x14, 0x36, 0x6e, 0x6f, 0x69, 0x0a, 0xc7, 0x05, 0xc0, 0x65, 0xc2, 0x66, 0xc0, 0x39, 0xc3, 0x6e,
+  0x39, 0xc1, 0x65, 0x39, 0xc0, 0x2d, 0xc1, 0x65, 0xc0, 0x66, 0xc0, 0x66, 0x1c, 0xc2, 0x69, 0xc1,
+  0x1c, 0xc1, 0xa2, 0x77, 0xc0, 0x21, 0x2d, 0xc0, 0x3e, 0x6e, 0xc0, 0x3e, 0xc1, 0x2d, 0x21, 0xc0,
+  0x1c, 0xc0, 0x21, 0xc0, 0x15, 0xc0, 0x1c, 0x21, 0x1c, 0x21, 0x2d, 0xa2, 0x77, 0x3e, 0x7a, 0x65,
+  0x65, 0xa2, 0x78, 0x03, 0x3e, 0x65, 0xc0, 0x37, 0x32, 0xc3, 0x21, 0xc0, 0x7a, 0x3a, 0x37, 0xa0,
+  0xb8, 0x9f, 0xe7, 0x69, 0x6f, 0x7a, 0x61, 0x56, 0xa2, 0x59, 0xa0, 0x58, 0x24, 0x21, 0xa1, 0xb8,
+  0xc0, 0x7e, 0xc1, 0x66, 0x59, 0x66, 0xc1, 0x7e, 0x65, 0xa2, 0x88, 0x9f, 0xb9, 0x5a, 0x5b, 0x64,
+  0x69, 0x67, 0x9e, 0xb7, 0x5a, 0x76, 0x5a, 0x66, 0xa3, 0x88, 0xc0, 0x03, 0x5a, 0xa3, 0x88, 0x66,
+  0xa2, 0x97, 0xa5, 0x78, 0x9c, 0x99, 0xa2, 0x68, 0xa2, 0x89, 0x9b, 0xa7, 0x61, 0x5a, 0xa2, 0x99,
+  0xc0, 0xa6, 0x86, 0xa5, 0xa8, 0x9e, 0x68, 0x5f, 0x9b, 0xa9, 0x30, 0x69, 0xab, 0x97, 0xa3, 0x8a,
+  0x96, 0x89, 0x49, 0xa1, 0x9a, 0x79, 0xa4, 0x88, 0x55, 0x52, 0x1d, 0xa9, 0x87, 0xaa, 0xaa, 0x90,
+  0x6a, 0x1d, 0xa5, 0x88, 0x63, 0x9b, 0x78, 0x29, 0x7b, 0x3c, 0x6d, 0x77, 0x59, 0x51, 0x24, 0xc0,
+  0x66, 0x69, 0x10, 0x66, 0xa3, 0xa8, 0x69, 0xc0, 0xa2, 0x88, 0x56, 0x37, 0xa1, 0xa8, 0x7a, 0x02,
+  0xa3, 0xa8, 0xa3, 0x98, 0x51, 0xa1, 0xa8, 0x9d, 0x79, 0xc0, 0x29, 0x05, 0xa7, 0xa6, 0xa5, 0x98,
+  0x9b, 0x9a, 0xc0, 0x7a, 0x45, 0x9e, 0x6a, 0x59, 0x9e, 0x6a, 0x98, 0x7a, 0x50, 0xa5, 0x87, 0x04,
+  0xa5, 0x78, 0xa7, 0x99, 0x42, 0x9d, 0x6b, 0x9f, 0x67, 0x51, 0x9d, 0x79, 0xa0, 0xa8, 0x7e, 0x4a,
+  0xa1, 0xa9, 0xa2, 0x87, 0xa3, 0xb9, 0x9c, 0x7a, 0x9e, 0x66, 0x20, 0xc0, 0xa2, 0xa8, 0xa3, 0xa8,
+  0x9c, 0x39, 0x59, 0x20, 0xa9, 0xc6, 0xa0, 0x8a, 0x97, 0x3b, 0xa2, 0x87, 0x55, 0x35, 0x26, 0xae,
+  0xe4, 0xa4, 0xd9, 0x99, 0x4b, 0x97, 0x3a, 0x78, 0x7f, 0xa7, 0xc7, 0xa2, 0x99, 0x97, 0x2b, 0x48,
+  0xfe, 0x86, 0x1a, 0x2c, 0x5a, 0xa2, 0x77, 0x93, 0xdb, 0x96, 0x56, 0xae, 0xd4, 0xa8, 0xc8, 0xa2,
+  0x87, 0xa4, 0x88, 0x94, 0x6b, 0x9a, 0x68, 0x79, 0xa6, 0x77, 0x3a, 0x9e, 0x67, 0x7b, 0xa2, 0x88,
+  0xa3, 0x88, 0x9b, 0x9a, 0xa4, 0x96, 0xa4, 0x88, 0x99, 0x7a, 0xa2, 0x86, 0xaa, 0x78, 0x8f, 0x7e,
+  0xa3, 0x66, 0xa5, 0x3a, 0x9e, 0x69, 0xa0, 0xa8, 0x6f, 0xa1, 0xa8, 0xa4, 0xb7, 0x04, 0x69, 0xa7,
+  0xc7, 0xa3, 0xc8, 0x46, 0x9c, 0x6a, 0x98, 0x2a, 0x6c, 0x3f, 0xa8, 0xc7, 0x9a, 0x6a, 0x09, 0x33,
+  0x9d, 0x58, 0xa3, 0xb9, 0x9e, 0x69, 0xa2, 0xa6, 0x56, 0x9d, 0x8a, 0x47, 0xa2, 0x86, 0x7e, 0x9b,
+  0x6b, 0x69, 0xc0, 0xa2, 0x77, 0xa4, 0xe6, 0x9d, 0x6a, 0x27, 0xc1, 0xa8, 0xd5, 0xa9, 0xe7, 0xfe,
+  0x14, 0x56, 0x6e, 0x6b, 0xc1, 0x0a, 0xc1, 0x65, 0xc2, 0x0a, 0xc1, 0x3e, 0x6b, 0x65, 0xc0, 0x69,
+  0x66, 0xcc, 0x66, 0xc1, 0x69, 0x66, 0xca, 0x21, 0x2d, 0x32, 0xc0, 0x3e, 0xc0, 0x0a, 0x0f, 0x65,
+  0x39, 0x32, 0x2d, 0xc0, 0x21, 0x1c, 0x69, 0x66, 0x1c, 0x21, 0xc2, 0x2d, 0xc1, 0x32, 0xc0, 0x6e,
+  0x32, 0x37, 0x3e, 0x37, 0x3e, 0xc0, 0x39, 0x66, 0x32, 0x3e, 0xc0, 0x37, 0x32, 0x37, 0x39, 0x3e,
+  0x7f, 0xa2, 0x97, 0x6e, 0x9f, 0xb9, 0x9f, 0xb7, 0x65, 0x7e, 0x5a, 0x43, 0xc0, 0x5a, 0x56, 0x45,
+  0xc0, 0xa3, 0xb8, 0x51, 0x5f, 0xc0, 0x76, 0x65, 0x5a, 0x56, 0xa1, 0xa7, 0x79, 0x6b, 0x2b, 0x75,
+  0x2e, 0x7a, 0x2e, 0x61, 0x7e, 0x9d, 0x98, 0x76, 0xc1, 0x6e, 0x03, 0x55, 0x08, 0xa3, 0x99, 0x5a,
+  0x50, 0x08, 0xa2, 0x88, 0xa5, 0x78, 0x76, 0x9f, 0x69, 0x65, 0x9f, 0xb8, 0x1c, 0x08, 0xa4, 0x77,
+  0x24, 0x26, 0x2a, 0x2b, 0xa3, 0x87, 0x31, 0x71, 0xa4, 0x96, 0xab, 0x77, 0xa2, 0x89, 0x96, 0x99,
+  0x46, 0xa2, 0x88, 0x15, 0xa5, 0x98, 0x6b, 0x9b, 0x89, 0x29, 0x5a, 0xa7, 0xb8, 0x05, 0x9b, 0x78,
+  0xa6, 0xb8, 0x97, 0x7a, 0xa5, 0x97, 0xc0, 0x51, 0x9c, 0x89, 0xc0, 0x51, 0xc1, 0x66, 0x69, 0xc1,
+  0x66, 0x65, 0xc0, 0x56, 0xc0, 0x6e, 0xa2, 0x87, 0xa1, 0xa9, 0xa3, 0x98, 0xa3, 0xa8, 0xa0, 0xb7,
+  0xa3, 0x98, 0xa3, 0x88, 0xa1, 0xa8, 0x9d, 0x79, 0x7f, 0x56, 0x51, 0xa3, 0x77, 0x65, 0xa0, 0x8a,
+  0x9b, 0x7a, 0x9d, 0x98, 0x37, 0x9c, 0x79, 0x3c, 0x9d, 0x89, 0xa2, 0x97, 0xa6, 0x88, 0x29, 0x9d,
+  0x7a, 0xb0, 0xa6, 0xa3, 0x9a, 0x65, 0x9c, 0x59, 0x94, 0x4a, 0x78, 0x6f, 0x9e, 0x69, 0x79, 0xc0,
+  0x28, 0xa5, 0xb8, 0x9d, 0x6a, 0xaa, 0xd5, 0x9a, 0x6c, 0x99, 0x38, 0xa4, 0x97, 0x9d, 0x69, 0xa3,
+  0xa7, 0x72, 0xa3, 0x87, 0x9e, 0x6a, 0x9d, 0x79, 0x79, 0xfe, 0x85, 0xfa, 0x9a, 0x3b, 0x9c, 0x47,
+  0xa2, 0xb8, 0xa2, 0x97, 0xa3, 0xb8, 0x47, 0x7d, 0x9a, 0x4a, 0xa3, 0x98, 0xa3, 0xb8, 0xa5, 0xc7,
+  0x6b, 0xa7, 0xe6, 0xfe, 0x5d, 0xdb, 0x98, 0x3a, 0x0e, 0xfe, 0x8e, 0x1b, 0x9a, 0x3a, 0x98, 0x78,
+  0xfe, 0x53, 0xf4, 0xa4, 0xa5, 0xb1, 0xc4, 0x9c, 0x8a, 0xa1, 0xa8, 0xa3, 0x79, 0x99, 0x6a, 0x9a,
+  0x79, 0x50, 0x7f, 0xa3, 0x77, 0x9c, 0x89, 0x66, 0xa4, 0x87, 0x3a, 0x9c, 0x79, 0x23, 0xa6, 0x77,
+  0xa4, 0x99, 0x99, 0x9a, 0x9b, 0x69, 0x0a, 0xa9, 0x49, 0x9c, 0x5b, 0x55, 0xa5, 0xe7, 0x30, 0x9b,
+  0x7a, 0xa5, 0xc7, 0x9c, 0x4a, 0x9d, 0x88, 0xa5, 0xb7, 0x30, 0x98, 0x5a, 0xa4, 0x96, 0x3e, 0xc0,
+  0x5a, 0x9d, 0x98, 0xa3, 0x88, 0xa0, 0xa8, 0x6f, 0x9d, 0x79, 0xa3, 0xa7, 0xfe, 0x96, 0x7a, 0x9e,
+  0x9b, 0x9a, 0x49, 0x4a, 0x0e, 0xa2, 0xb7, 0xa4, 0xb7, 0x99, 0x2c, 0x9c, 0x78, 0x1b, 0xa2, 0x88,
+  0xa2, 0xb7, 0xa6, 0xb7, 0x98, 0x4c, 0x9d, 0x77, 0xa4, 0x87, 0xfe, 0xae, 0xbb, 0xa1, 0xaa, 0xfe,
+  0x14, 0x36, 0x6e, 0xc0, 0x05, 0x69, 0x66, 0x66, 0x69, 0xc0, 0x66, 0x2d, 0xc0, 0x39, 0x3e, 0x39,
+  0xc5, 0x2d, 0xc1, 0x28, 0xc3, 0x2d, 0xc7, 0x65, 0x66, 0xc5, 0x21, 0x1c, 0x21, 0xc0, 0x28, 0x2d,
+  0x39, 0xc0, 0x3e, 0xc0, 0xa2, 0x78, 0x65, 0x3e, 0xc0, 0x65, 0x2d, 0x69, 0xc0, 0x21, 0xc0, 0x65,
+  0xc0, 0x1c, 0x21, 0x2d, 0xc1, 0x32, 0x3e, 0x32, 0xc3, 0x3e, 0xc1, 0x2d, 0x32, 0x6e, 0x7b, 0x32,
+  0x37, 0xa3, 0x7a, 0xa3, 0xa7, 0xa1, 0xc9, 0x5e, 0x7e, 0xc0, 0x7a, 0x9e, 0x68, 0x47, 0xa0, 0xa7,
+  0x9d, 0xc8, 0x4e, 0x9e, 0x6a, 0x55, 0x7a, 0x79, 0x66, 0x45, 0x9f, 0xb9, 0xa1, 0xb8, 0x4a, 0x00,
+  0x65, 0xc1, 0x56, 0xa1, 0xa9, 0xa0, 0xb7, 0x55, 0x4a, 0x69, 0xa3, 0x99, 0x7f, 0x9c, 0x88, 0x69,
+  0x9d, 0xa9, 0x76, 0x6e, 0x65, 0x7a, 0x08, 0x51, 0x6b, 0xa3, 0x87, 0xa3, 0x99, 0x6f, 0x41, 0x08,
+  0x0d, 0x62, 0xa3, 0x98, 0xa3, 0x78, 0x5b, 0x61, 0x35, 0x41, 0x9d, 0xba, 0x6e, 0xa2, 0x87, 0x25,
+  0x6e, 0x9b, 0xc9, 0x08, 0xa2, 0x78, 0x17, 0xa4, 0x87, 0xa6, 0x87, 0x6e, 0xa9, 0xa7, 0x9b, 0x8b,
+  0x97, 0x6a, 0xa4, 0x87, 0xa1, 0xaa, 0x9b, 0x88, 0x55, 0xa9, 0x78, 0xa5, 0x98, 0x99, 0xa9, 0x9c,
+  0x89, 0x69, 0x66, 0x7f, 0xa4, 0x87, 0x9a, 0x78, 0x9c, 0x99, 0x1f, 0xc0, 0x2b, 0x17, 0xc1, 0x69,
+  0x0b, 0xc2, 0x65, 0xc2, 0x7e, 0x0b, 0x51, 0x69, 0xa9, 0xd7, 0xa9, 0xb6, 0x9d, 0x79, 0xa4, 0xa8,
+  0x9e, 0x68, 0x46, 0x9d, 0x99, 0x99, 0x7b, 0x5a, 0x41, 0x9d, 0x8a, 0x59, 0x61, 0x46, 0xa5, 0x88,
+  0xa7, 0x98, 0xaa, 0xa8, 0x9b, 0x6c, 0xa2, 0x56, 0xa8, 0x98, 0x9c, 0x79, 0xa9, 0xd7, 0x9b, 0x8a,
+  0x9b, 0x68, 0xa8, 0xa7, 0x9b, 0x7b, 0x96, 0x59, 0x6d, 0x41, 0x46, 0x15, 0x7d, 0xa6, 0x89, 0x9c,
+  0x79, 0xa3, 0xc7, 0x6e, 0x9b, 0x3b, 0xa2, 0x87, 0x61, 0x33, 0xa2, 0xb8, 0x46, 0x9e, 0x58, 0xa2,
+  0xa8, 0x9c, 0x69, 0xac, 0xf5, 0x9d, 0x6a, 0x23, 0x34, 0x33, 0xa2, 0xa8, 0x9f, 0x69, 0xa5, 0xc7,
+  0x9e, 0x6b, 0x9d, 0x79, 0xa3, 0xa7, 0x79, 0xa4, 0xb8, 0x9f, 0x69, 0x9b, 0x5a, 0x9d, 0x78, 0xc0,
+  0x23, 0xa1, 0xc9, 0x9b, 0xc8, 0x9d, 0xb6, 0xaa, 0xc5, 0xa9, 0xa8, 0x52, 0xa4, 0x87, 0x92, 0x7b,
+  0x5d, 0xa3, 0x88, 0x6b, 0x98, 0x79, 0xa2, 0x87, 0x7f, 0x6e, 0xc0, 0x9d, 0x9a, 0xa3, 0x88, 0x28,
+  0x23, 0xa8, 0x88, 0x9b, 0x8a, 0x95, 0x68, 0xab, 0x47, 0xa2, 0x5c, 0x9d, 0x7a, 0x69, 0x7a, 0x35,
+  0xa3, 0xa7, 0xa5, 0xc7, 0xa9, 0xe8, 0x91, 0x0e, 0x9b, 0x57, 0xa5, 0xa8, 0x7e, 0xa2, 0xa8, 0x9c,
+  0x69, 0x32, 0x42, 0xa3, 0x97, 0xa3, 0x98, 0x9d, 0x8a, 0xa4, 0xc6, 0x9c, 0x5a, 0x41, 0xaa, 0xe4,
+  0xa1, 0x8a, 0x99, 0x5b, 0x66, 0x9f, 0x47, 0x22, 0x35, 0x02, 0xaa, 0xd7, 0x97, 0x5b, 0x9b, 0x69,
+  0xa8, 0xd6, 0x21, 0x06, 0x9c, 0x5a, 0x09, 0x65, 0xa8, 0xd5, 0xfe, 0x14, 0x35, 0xc1, 0x66, 0x65,
+  0x66, 0x69, 0x66, 0xc5, 0x28, 0x2d, 0x6e, 0xc0, 0x39, 0xc1, 0x66, 0x2d, 0xc0, 0x28, 0x2d, 0x28,
+  0xc1, 0x2d, 0xc0, 0x34, 0x39, 0xc3, 0x32, 0x2d, 0x28, 0xc0, 0x21, 0xc5, 0x2d, 0xc0, 0x32, 0x39,
+  0x3e, 0xc1, 0x6f, 0x6e, 0x3e, 0xc0, 0x32, 0xc0, 0x2d, 0x69, 0xc0, 0x2d, 0x21, 0x69, 0x66, 0x1c,
+  0x21, 0x2d, 0x32, 0x7b, 0x39, 0x3e, 0x32, 0x2d, 0xc1, 0x32, 0xc1, 0x39, 0x32, 0xc0, 0x6e, 0xc1,
+  0x0f, 0xa6, 0xc7, 0xa1, 0xe6, 0x9c, 0x49, 0xa0, 0x59, 0x5a, 0x46, 0x7e, 0xc1, 0x2a, 0x9d, 0xd8,
+  0x79, 0xa0, 0x3a, 0x46, 0x6e, 0xa1, 0xa8, 0x9d, 0x9a, 0x2d, 0xa2, 0xa8, 0x6e, 0x75, 0x70, 0x75,
+  0x5a, 0xa2, 0x69, 0x03, 0x9f, 0xb7, 0xa0, 0xa8, 0x46, 0x5e, 0x36, 0xa3, 0x89, 0x66, 0x59, 0x25,
+  0x9d, 0xa8, 0xa2, 0x78, 0x6b, 0x68, 0x7f, 0x66, 0x9c, 0x99, 0x69, 0x12, 0xa1, 0x9a, 0x25, 0xc0,
+  0x76, 0x54, 0x7b, 0x7e, 0xa2, 0x78, 0xa3, 0x79, 0x30, 0x5e, 0x67, 0xa4, 0x87, 0x66, 0x55, 0x1c,
+  0x17, 0x1c, 0x21, 0x1c, 0xc0, 0xa2, 0x87, 0x7b, 0xa5, 0x87, 0xa3, 0x98, 0xa5, 0x97, 0x47, 0x52,
+  0xa2, 0x89, 0x9a, 0x79, 0x15, 0xa3, 0x88, 0xa5, 0xa8, 0x55, 0x15, 0x9d, 0xa9, 0xac, 0x87, 0x72,
+  0x98, 0x68, 0x17, 0x1f, 0x6e, 0x1f, 0xc1, 0x1c, 0x65, 0x66, 0xc0, 0x55, 0x7a, 0xc2, 0x55, 0x3c,
+  0x7e, 0x62, 0x3f, 0x30, 0xa3, 0xa8, 0xa8, 0xb6, 0x9e, 0x6a, 0x0f, 0x56, 0x37, 0x30, 0x3f, 0xc2,
+  0x46, 0xa7, 0x87, 0xa7, 0xaa, 0x6f, 0xab, 0x98, 0x47, 0x45, 0x76, 0xa2, 0x87, 0xa4, 0xa8, 0x6e,
+  0x95, 0x5b, 0x44, 0xaa, 0xa6, 0xa4, 0xc7, 0x3c, 0x97, 0x19, 0xa3, 0xb8, 0x5a, 0x42, 0x69, 0x0f,
+  0xa1, 0xa8, 0xa2, 0xb7, 0xa9, 0xd7, 0x97, 0x3c, 0x9d, 0x78, 0xa2, 0x97, 0x17, 0xa7, 0xd8, 0x9d,
+  0x69, 0x9c, 0x58, 0xa3, 0xa8, 0x1e, 0xaa, 0xf5, 0x9f, 0x7b, 0x1e, 0xa4, 0xa7, 0xa1, 0xb8, 0x9f,
+  0x49, 0x9f, 0x6a, 0xc0, 0x65, 0x7e, 0xa4, 0xb7, 0x56, 0x65, 0x9d, 0x6a, 0xa5, 0xb6, 0x9d, 0x8b,
+  0x45, 0xa2, 0x98, 0x9d, 0xc8, 0x96, 0xd8, 0xa6, 0x84, 0xae, 0xd6, 0x9d, 0x9b, 0x9d, 0x78, 0x9d,
+  0x89, 0xc0, 0x51, 0x42, 0x60, 0xa2, 0x68, 0x9d, 0x99, 0x66, 0xa2, 0x77, 0xa2, 0x78, 0x66, 0xa2,
+  0x99, 0xc0, 0x02, 0x56, 0x97, 0x7a, 0xa3, 0x58, 0xac, 0x48, 0x9e, 0x7b, 0x2c, 0xc1, 0xa7, 0xf6,
+  0x43, 0x09, 0xa5, 0xa7, 0x20, 0x9c, 0x59, 0xa3, 0x96, 0xa0, 0xba, 0x36, 0x52, 0xa2, 0x96, 0xa2,
+  0x97, 0x9c, 0x6a, 0xa2, 0xa7, 0x02, 0x9d, 0x6a, 0x7d, 0x27, 0x65, 0x2c, 0xa2, 0x97, 0xa2, 0xc8,
+  0x6f, 0x7f, 0x20, 0xa6, 0xd6, 0xa5, 0xc8, 0x9e, 0x69, 0x93, 0x0c, 0xa2, 0x86, 0x9e, 0x69, 0xa9,
+  0xf5, 0x57, 0x97, 0x3b, 0x33, 0xa3, 0x97, 0xfe, 0x14, 0x35, 0x66, 0x65, 0x66, 0x65, 0x66, 0x6d,
+  0x66, 0xc5, 0x17, 0x1c, 0xc0, 0x6e, 0xc0, 0x2d, 0xc5, 0x6e, 0xc0, 0x2d, 0xc4, 0x32, 0x39, 0x3e,
+  0xc0, 0x39, 0xc0, 0x2d, 0x28, 0xc2, 0x2d, 0xc2, 0x39, 0xc1, 0xa2, 0x78, 0xc0, 0x6e, 0xc1, 0x65,
+  0x32, 0x2d, 0x69, 0xc0, 0x2d, 0xc0, 0x26, 0x21, 0xc0, 0x26, 0xc0, 0x2d, 0x32, 0x3e, 0x39, 0x3e,
+  0xc0, 0x2d, 0xc3, 0x32, 0x7a, 0x3e, 0x69, 0xc0, 0x32, 0x3e, 0xa3, 0x78, 0xa6, 0xc8, 0x9f, 0xc7,
+  0x99, 0x88, 0x21, 0x3e, 0x6d, 0x3e, 0xa4, 0x77, 0xa3, 0xb8, 0x56, 0x41, 0x9d, 0xb9, 0x9e, 0xc7,
+  0xa3, 0x59, 0x0c, 0x6e, 0x76, 0x55, 0x5a, 0xa0, 0xa8, 0x69, 0x9e, 0xb7, 0x71, 0x66, 0x1c, 0xa5,
+  0x69, 0xc0, 0x9b, 0xb9, 0xa2, 0x77, 0x6f, 0x2d, 0xc0, 0xa2, 0x88, 0xa2, 0x78, 0x7f, 0x69, 0x01,
+  0x66, 0x59, 0xc0, 0x72, 0x45, 0x2b, 0x1c, 0x55, 0x19, 0x7f, 0x2b, 0xa4, 0x77, 0x1a, 0x66, 0x01,
+  0x3c, 0x69, 0x51, 0x2d, 0xa7, 0x99, 0x5e, 0x12, 0x39, 0x9d, 0xb8, 0x69, 0x21, 0x3c, 0x35, 0x61,
+  0x6f, 0x3c, 0xa5, 0x87, 0x9d, 0x9a, 0xa5, 0x96, 0xa2, 0x98, 0xa2, 0x68, 0x7f, 0x17, 0x9d, 0x8a,
+  0x66, 0xa2, 0x97, 0xa9, 0x98, 0x93, 0x8a, 0x9a, 0x87, 0xaa, 0x87, 0x9a, 0x89, 0x28, 0x71, 0x69,
+  0x1f, 0x1a, 0x5a, 0x69, 0x66, 0xc1, 0x69, 0x56, 0x7a, 0xc0, 0x3c, 0x3f, 0xc0, 0x3c, 0xc0, 0x3f,
+  0xc1, 0x56, 0x9d, 0x89, 0xa2, 0x87, 0x37, 0x3f, 0xc0, 0x66, 0x6d, 0xc0, 0xa3, 0x79, 0xa6, 0x78,
+  0xaa, 0xa9, 0xa1, 0x7a, 0xa4, 0x77, 0x56, 0x9c, 0x78, 0x9a, 0x78, 0xac, 0xb6, 0xa8, 0xd8, 0x56,
+  0x9d, 0x79, 0x9b, 0x6a, 0xa3, 0xa7, 0x9a, 0x7b, 0x9a, 0x58, 0xc0, 0x9b, 0x28, 0xa3, 0x88, 0xfe,
+  0x75, 0x79, 0x99, 0x1a, 0x55, 0x76, 0x7d, 0x0c, 0x6e, 0xfe, 0xa6, 0x5a, 0x9a, 0x8c, 0x97, 0x18,
+  0x6d, 0x6f, 0xa2, 0xa9, 0x45, 0x9d, 0x6a, 0xa4, 0x96, 0xa8, 0xf7, 0xa5, 0xc8, 0x42, 0xfe, 0x2c,
+  0xd9, 0xa2, 0x96, 0xa3, 0xb8, 0xa0, 0x7a, 0x9e, 0x68, 0x49, 0x9d, 0x8a, 0xa2, 0xa7, 0xa1, 0xb8,
+  0x9d, 0x39, 0x65, 0x7f, 0x7a, 0xa6, 0xc6, 0xa4, 0xa8, 0x9b, 0x4b, 0x93, 0xd9, 0x9d, 0xc5, 0xab,
+  0xb6, 0xa5, 0xb8, 0x9c, 0x79, 0x5e, 0x99, 0x8a, 0xa3, 0x97, 0x6f, 0x9d, 0x9a, 0x40, 0x6e, 0xa3,
+  0xa9, 0x9d, 0x7a, 0x50, 0xc0, 0xa2, 0x78, 0x00, 0xa5, 0x99, 0x7e, 0x9d, 0x79, 0x98, 0x69, 0xb2,
+  0x47, 0xa4, 0x9a, 0x99, 0x6a, 0x9c, 0x49, 0x56, 0x3b, 0xa1, 0xa7, 0xa1, 0xa9, 0x33, 0x09, 0x69,
+  0xa2, 0x78, 0xa5, 0xe8, 0x97, 0x4c, 0x5c, 0x42, 0xa8, 0xd6, 0xa0, 0xb9, 0x97, 0x1a, 0x7e, 0x37,
+  0x28, 0x56, 0x9d, 0x79, 0xa2, 0x87, 0x5f, 0x3b, 0x7e, 0xa4, 0x97, 0xa0, 0xa8, 0xa2, 0x97, 0x9d,
+  0x7a, 0x9a, 0x5a, 0xa7, 0xd6, 0x9e, 0x4a, 0x33, 0x6e, 0x33, 0xc0, 0xa6, 0xb6, 0xa2, 0x78, 0x9b,
+  0x6a, 0xfe, 0x13, 0xf4, 0x66, 0x65, 0xc0, 0x65, 0x66, 0x10, 0xc1, 0x0b, 0xc1, 0x10, 0xc5, 0x6e,
+  0x1c, 0xc0, 0x6e, 0x1c, 0x2d, 0x28, 0x2d, 0xc0, 0x6e, 0x2d, 0xc0, 0x28, 0xc1, 0x2d, 0xc1, 0x32,
+  0x6b, 0xc1, 0x66, 0x32, 0xc2, 0x39, 0x6e, 0x39, 0x3e, 0xc0, 0x6f, 0xc0, 0x6e, 0xc1, 0x65, 0x3e,
+  0xc0, 0x2d, 0x21, 0x28, 0x2d, 0x32, 0x2d, 0xc0, 0x32, 0xc1, 0x3e, 0x39, 0xc0, 0x32, 0xc0, 0x2d,
+  0x32, 0x69, 0x66, 0xc1, 0x2d, 0x32, 0xc2, 0x7e, 0xa4, 0x69, 0xa5, 0x97, 0xfe, 0x85, 0x96, 0x95,
+  0x7a, 0xa3, 0x4a, 0x56, 0x46, 0x7a, 0xc0, 0x5e, 0xa3, 0x99, 0x6b, 0x6d, 0x23, 0x65, 0x0b, 0x79,
+  0x9f, 0xca, 0x68, 0x9d, 0xb9, 0x61, 0x65, 0x7e, 0xc0, 0x14, 0x6e, 0x1c, 0xa4, 0x78, 0x61, 0x9d,
+  0x99, 0xa3, 0x78, 0x66, 0x30, 0x01, 0x30, 0x6f, 0xa2, 0x78, 0xa3, 0x87, 0x6b, 0x0d, 0x51, 0xa0,
+  0xa7, 0x51, 0x1c, 0x30, 0x1c, 0x51, 0x65, 0x08, 0x17, 0xa7, 0x77, 0xa2, 0x89, 0x9d, 0x99, 0x01,
+  0x66, 0x75, 0xa2, 0x87, 0x9c, 0x7a, 0xa4, 0x87, 0x30, 0x20, 0x2d, 0x60, 0x7a, 0x24, 0x04, 0xa2,
+  0x78, 0x55, 0xa4, 0x88, 0x6f, 0x76, 0x6e, 0x38, 0xa5, 0x87, 0xa3, 0x98, 0x9b, 0xa9, 0x55, 0xa3,
+  0x88, 0x6b, 0x5f, 0xa2, 0xa9, 0x92, 0x88, 0x54, 0xa3, 0x9a, 0x9b, 0x98, 0x55, 0x6e, 0x10, 0x7a,
+  0x10, 0x13, 0x56, 0x69, 0x0b, 0xc1, 0x04, 0x66, 0xcc, 0xa5, 0x87, 0x62, 0x13, 0x3c, 0xa3, 0x59,
+  0xa7, 0x99, 0x5e, 0xfe, 0xd7, 0x5d, 0x96, 0x5c, 0x93, 0x29, 0xa7, 0x96, 0x62, 0x9d, 0x89, 0xac,
+  0xc5, 0xa6, 0xc9, 0x6e, 0xa3, 0xa8, 0x2a, 0xa7, 0xa5, 0xa5, 0xc9, 0x66, 0x91, 0x0d, 0x9c, 0x66,
+  0x5a, 0x0b, 0x9c, 0x59, 0x0f, 0xa2, 0xa7, 0x6f, 0x46, 0x65, 0xab, 0xf6, 0xa1, 0x9b, 0x96, 0x39,
+  0x08, 0x52, 0xa7, 0xc5, 0x9e, 0x4a, 0x9c, 0x89, 0xa5, 0x97, 0xaa, 0xe6, 0x67, 0x52, 0x98, 0x09,
+  0x9d, 0x58, 0x7b, 0xa1, 0xca, 0x21, 0x9e, 0x59, 0x9d, 0x79, 0xa1, 0xc9, 0xa0, 0x57, 0xa4, 0xa7,
+  0xa3, 0xc9, 0x03, 0xa5, 0xd7, 0xa1, 0xa9, 0xa1, 0x58, 0x93, 0x8c, 0xfe, 0x43, 0x50, 0xa4, 0x86,
+  0xac, 0xc5, 0xa1, 0x8a, 0x9b, 0x7a, 0x51, 0x59, 0xa1, 0xa9, 0x9d, 0x79, 0x9d, 0x99, 0x6e, 0xaa,
+  0x77, 0xa7, 0x9a, 0x8e, 0x8b, 0xa1, 0x85, 0x6b, 0x1f, 0xa9, 0x87, 0xa4, 0xa9, 0x9b, 0x77, 0x9d,
+  0x7c, 0xa1, 0x39, 0xac, 0x67, 0x9b, 0x7b, 0x03, 0xa2, 0xb8, 0x9c, 0x49, 0xc0, 0x03, 0x7a, 0xc0,
+  0x7f, 0xa5, 0xe5, 0xa7, 0xc8, 0x9c, 0x7b, 0xfe, 0x14, 0xda, 0x6d, 0x33, 0xa3, 0x87, 0x38, 0x33,
+  0x38, 0xc0, 0xfe, 0xa6, 0xbc, 0x99, 0x4d, 0x9a, 0x58, 0xa7, 0xc6, 0x98, 0x1b, 0x38, 0x7f, 0x05,
+  0x56, 0x7f, 0xa1, 0xa8, 0xa4, 0xd7, 0x17, 0x38, 0x6f, 0x3d, 0x6f, 0xa1, 0xa9, 0x51, 0x38, 0x09,
+  0xfe, 0x13, 0xd4, 0x69, 0x66, 0xc0, 0x65, 0xc1, 0x66, 0x10, 0xc0, 0x6b, 0x10, 0xc1, 0x0b, 0xc5,
+  0x10, 0xc1, 0x1c, 0xc2, 0x21, 0xc2, 0x1c, 0x21, 0x1c, 0x21, 0xc1, 0x6f, 0xc0, 0x6e, 0x6b, 0xc2,
+  0x6e, 0xc3, 0x6e, 0x6b, 0x03, 0xc0, 0x0a, 0x03, 0x3e, 0x2d, 0x32, 0x28, 0x21, 0xc0, 0x2d, 0x32,
+  0xc0, 0x3e, 0xc0, 0x32, 0x6e, 0x32, 0xc1, 0x2d, 0x21, 0xc6, 0x6e, 0x7f, 0x59, 0x37, 0xa3, 0x8a,
+  0xa5, 0xc6, 0x9a, 0xc7, 0x99, 0xa9, 0xa7, 0x58, 0xa1, 0x5a, 0x42, 0x3e, 0xa1, 0xa7, 0x7a, 0x46,
+  0xa2, 0x88, 0x55, 0xa2, 0xb8, 0xa3, 0x78, 0x5b, 0x66, 0xa2, 0x87, 0xc0, 0x9d, 0x89, 0x9b, 0xa9,
+  0x9f, 0xb8, 0x9e, 0xb7, 0x14, 0xa2, 0x88, 0xc0, 0x65, 0xc0, 0x14, 0xc1, 0x1c, 0x7f, 0xa2, 0x77,
+  0x5a, 0xc0, 0x66, 0xc0, 0x56, 0x2d, 0x7a, 0x32, 0x30, 0x28, 0x50, 0xa2, 0x88, 0x7a, 0x9c, 0x89,
+  0x65, 0xa2, 0x78, 0x30, 0x5f, 0x66, 0x35, 0xc0, 0x6f, 0xa2, 0x98, 0x5a, 0x21, 0x2b, 0xc0, 0x50,
+  0x35, 0x18, 0x56, 0x35, 0x30, 0xa3, 0x88, 0x12, 0xa2, 0x98, 0xa6, 0x98, 0x51, 0x9d, 0x78, 0xa2,
+  0x98, 0x51, 0xa6, 0x87, 0x7b, 0x9b, 0x78, 0xa3, 0x98, 0x9b, 0x7a, 0xa1, 0x6a, 0x9d, 0xa8, 0x2b,
+  0x7e, 0x66, 0x2b, 0x50, 0x6e, 0x76, 0xc2, 0x55, 0x66, 0x6f, 0x3f, 0x66, 0x6f, 0x0b, 0x3f, 0xc1,
+  0x69, 0x3f, 0x7e, 0x3f, 0x59, 0x3f, 0x38, 0x07, 0x0b, 0xa3, 0x87, 0xab, 0x88, 0x9a, 0xaa, 0x15,
+  0xa7, 0x7a, 0xa4, 0x48, 0x52, 0xa1, 0xa8, 0xa9, 0xc6, 0x9b, 0x6c, 0x97, 0x69, 0xa4, 0x86, 0xa2,
+  0x99, 0xab, 0xe7, 0x9d, 0x69, 0xa4, 0xa8, 0x7f, 0xa4, 0xa7, 0x07, 0xa3, 0xa8, 0xa3, 0x98, 0x98,
+  0x5a, 0x59, 0x37, 0x66, 0x9d, 0x49, 0x98, 0x39, 0x56, 0xa2, 0xa6, 0x5b, 0x69, 0xa7, 0xf8, 0xa1,
+  0xa9, 0x4e, 0x67, 0x09, 0x98, 0x4a, 0xa1, 0x57, 0xa4, 0xb9, 0xa2, 0x97, 0x45, 0x9a, 0x4a, 0xfe,
+  0x75, 0xf9, 0xa4, 0xb8, 0x37, 0x98, 0x0b, 0x9c, 0x58, 0xa2, 0xb7, 0x5e, 0x66, 0xc0, 0xa4, 0xb7,
+  0x9b, 0x4b, 0xa2, 0x95, 0xa4, 0xe8, 0x9c, 0x4a, 0xa6, 0xa5, 0xa5, 0xb8, 0x97, 0x4d, 0x91, 0xe7,
+  0x03, 0xa6, 0xa7, 0xa8, 0xa7, 0x41, 0x9b, 0x89, 0x5b, 0xa2, 0x87, 0x5a, 0x9c, 0x89, 0x7a, 0x6e,
+  0xa2, 0x78, 0x56, 0x62, 0x6d, 0x33, 0x3e, 0xa7, 0x87, 0x52, 0x45, 0xb1, 0xb8, 0xa1, 0x6b, 0xfe,
+  0x14, 0xba, 0x2c, 0xa2, 0x78, 0x66, 0xc1, 0xa1, 0xa8, 0xc0, 0xa3, 0xa7, 0xfe, 0xb6, 0xfc, 0x9e,
+  0xab, 0xfe, 0x3d, 0x1a, 0x4e, 0xa2, 0x87, 0x9e, 0x69, 0x7e, 0x0c, 0xa1, 0xb8, 0xa1, 0xa9, 0x1f,
+  0x56, 0x41, 0xa1, 0xb8, 0x0b, 0xa7, 0xe6, 0x2c, 0x17, 0xa3, 0xc8, 0x46, 0x17, 0x47, 0x1a, 0x1f,
+  0x0c, 0x3d, 0x7b, 0x5a, 0xc0, 0x3d, 0x17, 0xa2, 0x98, 0x04, 0xfe, 0x13, 0xb3, 0xc1, 0x65, 0xc3,
+  0x66, 0x10, 0xc1, 0x0b, 0xc0, 0x10, 0xc0, 0x65, 0x0b, 0x10, 0x0b, 0xc3, 0x10, 0xc7, 0x6e, 0x1c,
+  0xc3, 0x6e, 0xc0, 0x6b, 0x6e, 0xc0, 0x6e, 0x6b, 0xc1, 0x32, 0xc0, 0x6e, 0x6b, 0x39, 0x32, 0x37,
+  0x32, 0x65, 0xc0, 0x21, 0xc0, 0x26, 0x21, 0xc0, 0x2d, 0x32, 0x37, 0x3e, 0x32, 0xc1, 0x2d, 0x26,
+  0x76, 0x21, 0xc0, 0x1c, 0x21, 0xc1, 0x1c, 0x21, 0x32, 0x2d, 0x32, 0xa4, 0x68, 0xa2, 0x88, 0x9a,
+  0xf6, 0x51, 0xa5, 0x59, 0x63, 0x0a, 0xa0, 0x59, 0x32, 0x7e, 0x66, 0x26, 0x3a, 0x59, 0x9f, 0xba,
+  0x74, 0xa2, 0x98, 0xa3, 0x79, 0xa2, 0x78, 0xa1, 0xa9, 0x51, 0x9f, 0x68, 0xa5, 0xa8, 0x9c, 0xc7,
+  0x75, 0x9d, 0x88, 0x9c, 0x89, 0x7a, 0x7e, 0x5a, 0x1c, 0xc0, 0x59, 0x76, 0xc0, 0x5b, 0xa4, 0x87,
+  0x6f, 0x21, 0x19, 0xa2, 0x88, 0x7f, 0x35, 0xc1, 0x66, 0x3c, 0x30, 0x9d, 0x99, 0x7e, 0x10, 0x21,
+  0x35, 0x5b, 0x3c, 0xc1, 0x01, 0x62, 0x1f, 0x1c, 0x69, 0xc0, 0x1c, 0x35, 0xa2, 0x88, 0x7f, 0x1d,
+  0x62, 0x30, 0x17, 0xa3, 0x87, 0xa7, 0x89, 0xa4, 0x87, 0x9b, 0x9a, 0x5e, 0xa6, 0x87, 0x72, 0x9b,
+  0x8a, 0x9f, 0x58, 0x9e, 0x5a, 0xa3, 0x88, 0x9e, 0xb7, 0x9b, 0xe7, 0xa2, 0x78, 0x24, 0x10, 0xc0,
+  0x76, 0x6e, 0xc0, 0x0e, 0x10, 0x66, 0x65, 0xc0, 0x5a, 0xc0, 0x3f, 0xc2, 0x6e, 0x75, 0x6b, 0x55,
+  0x5a, 0x3f, 0x56, 0x33, 0xa4, 0x78, 0x6e, 0xa1, 0x9a, 0x38, 0x65, 0x10, 0x38, 0x2e, 0x4b, 0xa3,
+  0x9a, 0x68, 0x9f, 0x5a, 0x9d, 0xb9, 0xa3, 0x97, 0xa6, 0x97, 0xa3, 0xc8, 0x5e, 0xa7, 0xc9, 0x53,
+  0x44, 0x36, 0xa6, 0x97, 0x9a, 0x7a, 0x97, 0x4b, 0x6d, 0xc0, 0xa7, 0xb6, 0x99, 0x6c, 0x9a, 0x69,
+  0xa2, 0x67, 0x9b, 0x7a, 0xc0, 0xa5, 0xa5, 0xa3, 0xd9, 0x9e, 0x69, 0xab, 0xc6, 0x9a, 0x7b, 0x9a,
+  0x39, 0x9d, 0x58, 0x5a, 0xa1, 0xa8, 0x43, 0x41, 0x6d, 0x7a, 0xfe, 0x8e, 0x5b, 0x57, 0x99, 0x3a,
+  0x55, 0xa2, 0xa7, 0x9d, 0x6a, 0x69, 0x56, 0xa6, 0xd7, 0x9f, 0x59, 0x9b, 0x69, 0xa3, 0xc8, 0xa2,
+  0x88, 0x1b, 0xa4, 0x98, 0x93, 0xca, 0x99, 0xd6, 0xa4, 0x86, 0xa4, 0xb8, 0x52, 0x65, 0xa2, 0x77,
+  0x9d, 0x8a, 0xc0, 0x6e, 0x33, 0x24, 0x7a, 0x1f, 0x9d, 0x99, 0x15, 0xa1, 0x9a, 0x33, 0xa1, 0xa8,
+  0x6f, 0x1f, 0xad, 0x97, 0xad, 0x7a, 0x9a, 0x5b, 0x99, 0x2a, 0x9d, 0x78, 0xa2, 0x78, 0x10, 0x7e,
+  0xfe, 0x8e, 0x5b, 0x9a, 0x3b, 0x9c, 0x59, 0x6d, 0xa4, 0xa7, 0xa1, 0xd9, 0x12, 0xa5, 0xa5, 0xfe,
+  0xc7, 0x1d, 0x67, 0xa3, 0xa7, 0x92, 0x0e, 0x48, 0x38, 0x12, 0xa5, 0xd6, 0xa1, 0xa9, 0x9e, 0x59,
+  0x69, 0xa3, 0xb8, 0x9b, 0x5a, 0xa3, 0x88, 0x9d, 0x9a, 0x9e, 0x68, 0x08, 0x7f, 0x45, 0x5a, 0x05,
+  0x02, 0x35, 0x9e, 0x69, 0x9d, 0x6a, 0x17, 0xa4, 0xa6, 0x42, 0x9e, 0x69, 0xfe, 0x13, 0xb3, 0xc1,
+  0x65, 0xc9, 0x65, 0x6b, 0xc5, 0x04, 0x10, 0xc4, 0x0b, 0x04, 0x0b, 0xc0, 0x10, 0xc3, 0x6e, 0x1c,
+  0xc1, 0x6e, 0xc0, 0x1c, 0x21, 0x6f, 0x6e, 0x2d, 0xc0, 0x66, 0xc1, 0x32, 0x2d, 0x28, 0x21, 0xc7,
+  0x6e, 0xc0, 0x32, 0xc1, 0x26, 0xc0, 0x21, 0xc0, 0x69, 0x21, 0xc2, 0x26, 0xc0, 0x2d, 0x32, 0xa3,
+  0x79, 0x6e, 0x9d, 0xa9, 0x6e, 0xa3, 0x79, 0x0f, 0x32, 0x7e, 0x66, 0x59, 0x35, 0x69, 0x26, 0x2d,
+  0x35, 0x6d, 0x9d, 0xa9, 0xa1, 0xb9, 0xa2, 0x78, 0xa0, 0xb7, 0x79, 0x9d, 0x99, 0x7e, 0xa2, 0x77,
+  0xa3, 0x7a, 0xa7, 0x88, 0x70, 0x96, 0x89, 0x28, 0x65, 0x5a, 0x69, 0x77, 0x1c, 0x65, 0x56, 0x1c,
+  0x6e, 0x51, 0x1c, 0xa5, 0x78, 0x3a, 0xa1, 0x9a, 0x01, 0x06, 0x01, 0x66, 0xa5, 0x88, 0xc0, 0x3c,
+  0x01, 0x7a, 0x6e, 0x01, 0x55, 0xa3, 0x99, 0x7e, 0x30, 0x17, 0x7e, 0x1c, 0xc1, 0x1f, 0x55, 0x0d,
+  0x1c, 0xa3, 0x88, 0x15, 0x35, 0x30, 0x66, 0x69, 0x3c, 0xa8, 0x96, 0x0a, 0x9d, 0xaa, 0xa4, 0x87,
+  0x9d, 0x79, 0x9e, 0x48, 0x4b, 0x6b, 0x5b, 0x9d, 0xe7, 0x9b, 0xd7, 0x59, 0x66, 0x69, 0x57, 0xc0,
+  0x13, 0xc0, 0x0b, 0xc0, 0x65, 0x5a, 0x3f, 0x56, 0xc0, 0x3c, 0x3f, 0x75, 0x5e, 0x6f, 0x13, 0x9e,
+  0x68, 0x30, 0x7a, 0x37, 0x3f, 0x52, 0x04, 0xa5, 0x89, 0xa3, 0x88, 0x9a, 0x9b, 0xa3, 0x87, 0x15,
+  0xa7, 0x97, 0x6b, 0x99, 0xa9, 0xaa, 0x66, 0x9f, 0x8b, 0x97, 0x6a, 0x59, 0xa2, 0x88, 0xa4, 0x97,
+  0x9d, 0x7b, 0xa5, 0xb6, 0xa6, 0x98, 0x99, 0x7b, 0xa3, 0x96, 0xab, 0xb7, 0xa3, 0xc9, 0x9a, 0x7a,
+  0x9d, 0x48, 0x98, 0x6a, 0xa3, 0x96, 0xa5, 0x98, 0xa1, 0xc9, 0x9d, 0x7a, 0xa2, 0x68, 0x9a, 0x5a,
+  0x9e, 0x86, 0xfe, 0xcf, 0x3d, 0x97, 0x4c, 0x9c, 0x47, 0xa9, 0xd7, 0xa1, 0xb9, 0x37, 0x9b, 0x49,
+  0xa4, 0xa6, 0xa2, 0xb7, 0x9a, 0x2b, 0xa2, 0xc7, 0xa2, 0x87, 0x9b, 0x6a, 0x29, 0xa6, 0xd7, 0x98,
+  0x3c, 0x2f, 0xa1, 0xa8, 0xa0, 0x58, 0x7f, 0x79, 0xa2, 0xa8, 0x7a, 0x9f, 0x59, 0xa1, 0xa7, 0xa3,
+  0xe9, 0x9c, 0x0a, 0x9a, 0xa9, 0xfe, 0x3b, 0x91, 0xa1, 0xa7, 0xa9, 0xb7, 0x9d, 0x9a, 0x51, 0xc0,
+  0x45, 0x9d, 0x89, 0x7e, 0x6e, 0x1f, 0xc0, 0x6f, 0x1f, 0xa2, 0x98, 0xa6, 0x68, 0x9a, 0x8a, 0x70,
+  0xa4, 0x87, 0x41, 0x9b, 0x89, 0xac, 0x27, 0x00, 0x9c, 0x98, 0xad, 0xf5, 0x9f, 0x7b, 0x95, 0x4b,
+  0xa9, 0xe5, 0x42, 0xa3, 0xa7, 0x9e, 0x6a, 0x97, 0x4a, 0xa6, 0x86, 0xa3, 0xc9, 0x9c, 0x59, 0x79,
+  0xfe, 0xcf, 0x5d, 0xa3, 0xd9, 0x97, 0x3b, 0x9b, 0x3a, 0x99, 0x3a, 0x9d, 0x88, 0x6e, 0x00, 0xa5,
+  0xc6, 0xa3, 0xd9, 0x96, 0x0c, 0x6d, 0xab, 0xf4, 0x9c, 0x6c, 0x9c, 0x48, 0xfe, 0x7e, 0x3b, 0x9b,
+  0x5c, 0x9f, 0x58, 0x9f, 0xb7, 0xa8, 0xd6, 0x9b, 0x5c, 0x9b, 0x49, 0xc0, 0xa2, 0xa6, 0x66, 0x9e,
+  0x69, 0x7e, 0x52, 0x2c, 0xa3, 0x98, 0xfe, 0x13, 0xd4, 0x65, 0xc0, 0x66, 0x69, 0xc8, 0x65, 0x6b,
+  0x04, 0xc1, 0x0b, 0xc0, 0x04, 0xc1, 0x0b, 0x10, 0xc1, 0x0b, 0x04, 0xc4, 0x6e, 0xc0, 0x10, 0xc3,
+  0x6e, 0xc0, 0x1c, 0xc0, 0x6e, 0x6e, 0x6b, 0x21, 0xc1, 0x26, 0x6f, 0xc0, 0x21, 0xc1, 0x1c, 0x21,
+  0xc3, 0x26, 0xc0, 0x21, 0x2d, 0x32, 0xc0, 0x2d, 0xc0, 0x26, 0x21, 0xc3, 0x28, 0x32, 0xc0, 0x6f,
+  0xa2, 0x78, 0x65, 0x3e, 0x0f, 0xa3, 0x78, 0x61, 0x9d, 0xa8, 0x32, 0x69, 0xc0, 0x21, 0x1c, 0xa2,
+  0x87, 0x26, 0xc0, 0xa1, 0xa8, 0x7f, 0x26, 0xc0, 0xa2, 0xa7, 0x9f, 0xd8, 0x75, 0x41, 0x61, 0x19,
+  0x7f, 0xc0, 0xa2, 0x87, 0x6b, 0x30, 0x3c, 0x55, 0xc0, 0x76, 0x30, 0xc1, 0xa2, 0x78, 0x55, 0x2d,
+  0x2b, 0x2d, 0xc0, 0x55, 0x30, 0xa6, 0x87, 0x01, 0x32, 0xa5, 0x99, 0x55, 0x76, 0x51, 0xc0, 0xa2,
+  0x78, 0x65, 0x7a, 0x1a, 0xc0, 0x7b, 0x04, 0x35, 0x2b, 0x55, 0x76, 0x6e, 0xc0, 0x55, 0x1c, 0x7e,
+  0xc0, 0x1f, 0x01, 0x75, 0x35, 0xa7, 0x89, 0x71, 0x6e, 0x5b, 0x9c, 0x68, 0xa1, 0x6a, 0xa2, 0x58,
+  0x66, 0x65, 0xa3, 0x88, 0xfe, 0x64, 0x74, 0x1a, 0x55, 0x69, 0xc0, 0x66, 0x04, 0x7f, 0x66, 0x04,
+  0x0b, 0x04, 0x56, 0x66, 0x6d, 0x66, 0x7b, 0x3f, 0x0b, 0x5e, 0xa3, 0x69, 0x00, 0x5a, 0xaa, 0xc7,
+  0x99, 0x9a, 0x94, 0xb6, 0x3f, 0x3a, 0x37, 0x04, 0xb4, 0x77, 0xa1, 0x9b, 0x92, 0x88, 0x9c, 0x77,
+  0xab, 0x77, 0xa1, 0xca, 0x97, 0x79, 0xa6, 0x86, 0xaa, 0x88, 0x9b, 0x8b, 0x6f, 0x9a, 0x59, 0x59,
+  0xa4, 0x98, 0x56, 0x9b, 0x79, 0xa4, 0x87, 0xa6, 0xb8, 0x51, 0xa5, 0xa7, 0x43, 0x50, 0xa3, 0x79,
+  0x98, 0x7a, 0xa2, 0x76, 0xa5, 0xb7, 0xa6, 0xd8, 0x52, 0x9b, 0x4a, 0x9d, 0x79, 0xa4, 0x87, 0xa1,
+  0xa7, 0x9b, 0x6b, 0xa2, 0x96, 0xa0, 0x8a, 0x98, 0x29, 0x6e, 0xa5, 0xd7, 0x15, 0x96, 0x0a, 0xa2,
+  0x97, 0x7b, 0x37, 0x3c, 0xa8, 0xf7, 0xfe, 0x3d, 0x5b, 0x9e, 0x47, 0xa2, 0xa7, 0x3d, 0x7e, 0x10,
+  0x52, 0x41, 0x6e, 0x79, 0xa6, 0xd8, 0x9d, 0x4a, 0x94, 0xf7, 0x08, 0xa6, 0xa8, 0xa4, 0xa7, 0x5a,
+  0x9d, 0x78, 0x9d, 0x9a, 0x55, 0x36, 0x59, 0x27, 0x6f, 0x6e, 0x27, 0x56, 0xa8, 0x87, 0xa4, 0x6a,
+  0x96, 0xa8, 0xa7, 0x97, 0x9d, 0x8a, 0x96, 0x88, 0xa5, 0x58, 0xa7, 0x0a, 0x6f, 0x63, 0xa3, 0xb7,
+  0xa2, 0x88, 0x9d, 0x59, 0xa6, 0xe6, 0x53, 0x9c, 0x48, 0x29, 0x9d, 0x9a, 0xa9, 0xe7, 0x56, 0xfe,
+  0x1c, 0xd9, 0x1b, 0xa3, 0xc9, 0x98, 0x1b, 0x9a, 0x39, 0xa7, 0xe6, 0xa5, 0xc7, 0x96, 0x3d, 0xa0,
+  0x46, 0xa3, 0xc8, 0x9e, 0x49, 0x10, 0xa2, 0x98, 0xa5, 0xc8, 0xa4, 0xd7, 0x98, 0x3b, 0x40, 0xa8,
+  0xe5, 0x9a, 0x1b, 0x9d, 0x99, 0xa6, 0xc5, 0xfe, 0xe7, 0x7e, 0x93, 0x1d, 0x95, 0x2b, 0xa4, 0x65,
+  0x22, 0x6e, 0x22, 0x69, 0xa6, 0xc6, 0xa8, 0xe7, 0x94, 0x0c, 0xfe, 0x13, 0xd3, 0x66, 0xc0, 0x66,
+  0x69, 0xc7, 0x66, 0x69, 0x66, 0xc2, 0x04, 0xcc, 0x3f, 0xc0, 0x0b, 0x10, 0xc0, 0x0b, 0xc0, 0x10,
+  0xc1, 0x6e, 0xc2, 0x1c, 0x21, 0xc2, 0x6f, 0x6e, 0x2d, 0x69, 0xc0, 0x21, 0xc2, 0x26, 0x2d, 0x21,
+  0x26, 0xc0, 0x2d, 0x32, 0xc4, 0x2d, 0xc0, 0x32, 0xc1, 0x6b, 0x6e, 0xa2, 0x78, 0xc2, 0x7e, 0x6e,
+  0x56, 0x61, 0x32, 0xc1, 0x6e, 0x65, 0x21, 0x2b, 0x76, 0x66, 0x26, 0x7e, 0xc0, 0x26, 0xa1, 0xa8,
+  0xa0, 0xb8, 0xc0, 0x60, 0x70, 0xa3, 0x89, 0x7f, 0x9d, 0x98, 0x41, 0x7a, 0x1c, 0xc0, 0x5a, 0xc0,
+  0x6e, 0x7b, 0x19, 0xa1, 0xa8, 0x6b, 0x56, 0x28, 0x9d, 0x87, 0x08, 0xa5, 0x8a, 0x3c, 0xc0, 0x6d,
+  0x5b, 0x7f, 0xa3, 0x98, 0xa7, 0x99, 0x99, 0x99, 0x50, 0x51, 0x65, 0x6b, 0x59, 0x28, 0x2d, 0xa7,
+  0x99, 0x69, 0x9a, 0x78, 0x28, 0x1c, 0x24, 0xc0, 0x55, 0x62, 0xc0, 0x24, 0x6e, 0x35, 0x3f, 0x69,
+  0x04, 0xa6, 0x68, 0x9e, 0x69, 0x9d, 0x79, 0xa4, 0x87, 0xa0, 0x7a, 0x56, 0x9f, 0x57, 0x62, 0xa2,
+  0xb8, 0xa0, 0xc7, 0x99, 0xc7, 0x66, 0x51, 0x6d, 0xc0, 0x66, 0x7e, 0x6f, 0x0b, 0x13, 0x0b, 0x3f,
+  0x0b, 0x61, 0x55, 0xa4, 0x68, 0x28, 0xa2, 0x68, 0xa1, 0x5a, 0x56, 0x00, 0x65, 0xa2, 0x98, 0x7f,
+  0x99, 0x79, 0x06, 0x3a, 0x5a, 0x3f, 0x65, 0xa1, 0x9a, 0xb0, 0x56, 0xa2, 0x98, 0xa4, 0xa8, 0xa3,
+  0x89, 0xa3, 0x88, 0x6b, 0x98, 0x89, 0x9d, 0x77, 0xa8, 0x87, 0xa5, 0xb9, 0x9d, 0x8a, 0x95, 0x4a,
+  0x9c, 0x79, 0x5e, 0xa3, 0xa9, 0x6d, 0x66, 0x57, 0xa9, 0x95, 0xa1, 0xba, 0x9d, 0x78, 0xa1, 0xa9,
+  0x98, 0x5b, 0xa4, 0x95, 0x9f, 0x67, 0xa8, 0xd7, 0xa0, 0x8a, 0x9b, 0x69, 0xa2, 0x88, 0x99, 0x4a,
+  0xa5, 0xc7, 0x19, 0x69, 0x22, 0x97, 0x4c, 0x9f, 0x56, 0xa7, 0xd8, 0x42, 0x9b, 0x6a, 0xa2, 0x87,
+  0xa2, 0xa8, 0x6d, 0xa3, 0xc8, 0xa1, 0xc8, 0x9a, 0x0a, 0x9e, 0x69, 0x6d, 0x9f, 0xba, 0x45, 0x69,
+  0x77, 0x56, 0xa4, 0x96, 0xa4, 0xa9, 0x9d, 0x79, 0x96, 0xe7, 0x9b, 0xb7, 0xa5, 0x96, 0xab, 0xd7,
+  0x9b, 0x7b, 0x9c, 0x77, 0x52, 0x6e, 0x41, 0x62, 0x6e, 0x2c, 0x56, 0xc0, 0x7f, 0x1f, 0x41, 0x22,
+  0xa7, 0xa7, 0x4b, 0x99, 0x7b, 0x9f, 0x67, 0xa9, 0x19, 0xa0, 0x7b, 0x65, 0xc0, 0xa3, 0xa9, 0x5a,
+  0x45, 0x32, 0xa2, 0x87, 0x9c, 0x7a, 0x6d, 0xaa, 0xf6, 0xa4, 0xb7, 0x96, 0x0c, 0x27, 0xfe, 0x96,
+  0x5b, 0x9c, 0x6a, 0x99, 0x1b, 0x00, 0xa4, 0xd6, 0xfe, 0xbe, 0xfc, 0x9d, 0x6b, 0x98, 0x3b, 0x9b,
+  0x38, 0x7a, 0xa6, 0xe6, 0xa9, 0xe5, 0xa3, 0xba, 0x91, 0x2e, 0x01, 0x5a, 0x34, 0x7a, 0xa6, 0xd6,
+  0xa4, 0xa8, 0x96, 0x4c, 0x9e, 0x68, 0x2c, 0x27, 0x2c, 0xc0, 0x62, 0x20, 0xaa, 0xe6, 0xa2, 0xa8,
+  0x95, 0x4c, 0xfe, 0x13, 0xd3, 0x66, 0xc1, 0x66, 0x69, 0xc5, 0x66, 0x69, 0xc0, 0x66, 0xc0, 0x04,
+  0x3f, 0xc1, 0x04, 0xcd, 0x6e, 0x10, 0x09, 0x10, 0xc2, 0x1c, 0xc1, 0x69, 0xc0, 0x1c, 0x21, 0x6e,
+  0xc0, 0x6f, 0xc0, 0x26, 0xc6, 0x6b, 0x26, 0x2d, 0xc1, 0x32, 0x6f, 0x32, 0xc3, 0x3e, 0x66, 0x3e,
+  0xa2, 0x78, 0x6e, 0xc0, 0x7f, 0x14, 0x0f, 0xa2, 0x87, 0x6f, 0x61, 0x14, 0x65, 0x0f, 0x14, 0x0f,
+  0xa1, 0xa7, 0x6f, 0xc1, 0x08, 0x32, 0xc0, 0x26, 0x7a, 0x66, 0x29, 0xa2, 0x97, 0x61, 0x9e, 0xc7,
+  0x7a, 0x6e, 0x7f, 0xc0, 0x9c, 0x88, 0x6e, 0x7e, 0x62, 0x08, 0xc0, 0x5f, 0x0d, 0xc1, 0x08, 0x66,
+  0x0d, 0xa4, 0x89, 0x30, 0x6e, 0xaa, 0x99, 0x55, 0x56, 0xa4, 0x87, 0xa2, 0x88, 0x61, 0xa2, 0x88,
+  0x9c, 0x79, 0x9d, 0x98, 0x9c, 0x88, 0xa3, 0x89, 0x5a, 0x9c, 0x88, 0xc0, 0x69, 0x7f, 0x18, 0x6e,
+  0x9c, 0x78, 0x66, 0xa1, 0xa9, 0x55, 0x56, 0x7a, 0x30, 0xa2, 0x88, 0x06, 0x57, 0x5f, 0xa4, 0x77,
+  0x66, 0x4b, 0x4f, 0x6e, 0x76, 0xa2, 0x97, 0xc0, 0x41, 0x4b, 0x9c, 0xc8, 0x0b, 0x64, 0x6f, 0xc0,
+  0x7b, 0x04, 0xc0, 0x0e, 0x6e, 0xc1, 0x5a, 0x75, 0x56, 0x0b, 0xa3, 0x59, 0xa4, 0x69, 0xa2, 0x88,
+  0x61, 0x9e, 0x48, 0x51, 0xa3, 0xb8, 0x6b, 0x29, 0xa2, 0x68, 0x9f, 0xd9, 0xfe, 0x53, 0x2e, 0x4a,
+  0x7a, 0x38, 0x04, 0x3f, 0x9e, 0x67, 0xac, 0x97, 0xba, 0xa7, 0xa1, 0xba, 0x56, 0x93, 0x5a, 0x6d,
+  0xa5, 0xa8, 0x76, 0x9a, 0x69, 0xa3, 0x87, 0x99, 0x8b, 0x9c, 0x68, 0xa9, 0x97, 0xa3, 0x99, 0x95,
+  0x4c, 0x58, 0xa3, 0xd8, 0x5e, 0xa9, 0xb7, 0x9f, 0x9b, 0x9d, 0x88, 0x9c, 0x6a, 0x65, 0x9f, 0x68,
+  0xa4, 0xb7, 0x57, 0x9b, 0x4a, 0x9d, 0x48, 0xa1, 0xb8, 0xa9, 0xd6, 0x9b, 0x5c, 0x9d, 0x78, 0xfe,
+  0xa6, 0xbb, 0x9b, 0x8c, 0x9a, 0x38, 0xa3, 0x98, 0xa3, 0xc8, 0x99, 0x4b, 0xa2, 0x96, 0x6e, 0x1c,
+  0x9d, 0x79, 0x41, 0x3d, 0x9e, 0x59, 0x7d, 0x2b, 0x5b, 0x51, 0x6e, 0xa2, 0x98, 0xac, 0xf5, 0xa0,
+  0x6a, 0x8f, 0x9b, 0x97, 0xd6, 0x7d, 0xac, 0xc6, 0xa2, 0x87, 0x99, 0x6a, 0x9c, 0x89, 0xa2, 0x88,
+  0xc0, 0x41, 0x65, 0x1f, 0xc2, 0x13, 0xa2, 0x98, 0xa2, 0x88, 0xa1, 0xa9, 0x59, 0x9b, 0x6a, 0x4e,
+  0xa7, 0x29, 0xa2, 0x5b, 0x1b, 0x6e, 0xc0, 0x2c, 0x6e, 0x9d, 0xaa, 0x1b, 0xa2, 0x88, 0xa5, 0xc7,
+  0x27, 0xa2, 0x78, 0xa2, 0xa7, 0x56, 0x21, 0xa5, 0xc7, 0xa0, 0xaa, 0x98, 0x1a, 0xa5, 0xb6, 0x9e,
+  0x59, 0x9d, 0x89, 0x21, 0x9c, 0x6a, 0x9f, 0x69, 0x65, 0xa9, 0xe6, 0xa5, 0xe8, 0x1d, 0x95, 0x1d,
+  0x54, 0x2c, 0x27, 0x7b, 0x03, 0xa2, 0xa7, 0x06, 0x2f, 0x27, 0x2f, 0xa2, 0xa8, 0x9f, 0x68, 0x27,
+  0x76, 0x6e, 0x1b, 0xa3, 0x98, 0xfe, 0x13, 0xb3, 0xc2, 0x66, 0x69, 0x6e, 0xc1, 0x10, 0xc1, 0x66,
+  0x69, 0xc0, 0x66, 0x04, 0xc1, 0x3f, 0xc0, 0x04, 0xc2, 0x3f, 0x04, 0xc9, 0x6e, 0xc0, 0x10, 0xc2,
+  0x1c, 0xc0, 0x6e, 0x1c, 0xc1, 0x21, 0x6f, 0x6e, 0x6f, 0xc1, 0x32, 0xc4, 0x2d, 0x32, 0x6e, 0x3e,
+  0x66, 0xc0, 0x3e, 0xc5, 0x6e, 0x7f, 0x5e, 0x6f, 0xc0, 0x69, 0x7a, 0x14, 0x65, 0x7f, 0xa2, 0x88,
+  0x19, 0x14, 0xc0, 0x1c, 0x7a, 0x7e, 0xa2, 0xb8, 0x46, 0xa2, 0x87, 0x42, 0x14, 0x08, 0x03, 0x08,
+  0x9d, 0xa8, 0x32, 0x7e, 0x9f, 0xb8, 0x9c, 0xc7, 0xa1, 0xb8, 0x5a, 0x65, 0x1c, 0x69, 0x52, 0xa2,
+  0x77, 0x1c, 0x55, 0xc0, 0x1c, 0xc0, 0x9d, 0x99, 0x08, 0xc1, 0x65, 0xa4, 0x88, 0xa6, 0x89, 0x9c,
+  0x88, 0x49, 0xa4, 0x78, 0xa6, 0xa8, 0xa5, 0x88, 0x9d, 0x9a, 0x9d, 0x97, 0xa5, 0x88, 0x9a, 0x89,
+  0xc0, 0xa6, 0x68, 0x9a, 0x99, 0x69, 0x52, 0x50, 0xa3, 0x98, 0x6b, 0x5a, 0x9c, 0xa9, 0xa2, 0x77,
+  0x42, 0x59, 0x66, 0xc0, 0xa2, 0x88, 0x6e, 0x5b, 0x9e, 0x58, 0xa3, 0xa9, 0xa5, 0xa8, 0x9f, 0x69,
+  0x52, 0xa3, 0x97, 0xa1, 0xa8, 0x41, 0x9d, 0x89, 0x56, 0x35, 0x57, 0x04, 0x1d, 0x95, 0xc9, 0x99,
+  0xc7, 0x7e, 0xc1, 0x6e, 0x7f, 0xc3, 0x6e, 0x61, 0x57, 0xa3, 0x77, 0xa7, 0x59, 0xa1, 0x5b, 0x9c,
+  0x88, 0x7a, 0x55, 0xa6, 0xa7, 0x34, 0x9a, 0x88, 0xa5, 0x87, 0xa2, 0x9a, 0x99, 0x89, 0x9e, 0xe5,
+  0x9c, 0xa7, 0x52, 0x7e, 0x3f, 0xc2, 0x41, 0xa7, 0x77, 0xb3, 0xb7, 0xab, 0xba, 0x99, 0x9a, 0xa3,
+  0x88, 0xa4, 0x86, 0xa0, 0x8a, 0x97, 0x79, 0x9c, 0x69, 0x59, 0x9c, 0x88, 0x69, 0x9f, 0x69, 0x9b,
+  0x8b, 0xa3, 0x77, 0xa5, 0x89, 0x66, 0x7e, 0xa0, 0x9a, 0xa5, 0xb5, 0x5b, 0x51, 0xa4, 0xa9, 0x97,
+  0x5a, 0xa0, 0x57, 0x52, 0x59, 0xa6, 0xc7, 0xa2, 0xb7, 0x9d, 0x8b, 0x9b, 0x49, 0xa8, 0xa5, 0x9f,
+  0xba, 0x99, 0x5b, 0xa7, 0xa4, 0xa1, 0xbb, 0x94, 0x0a, 0x6e, 0xc0, 0x35, 0xa4, 0xa6, 0x9e, 0x49,
+  0x9d, 0x89, 0x7f, 0x5a, 0x7e, 0x2f, 0x56, 0xa2, 0x77, 0xa3, 0xc8, 0xa4, 0x97, 0x08, 0x93, 0xe8,
+  0x64, 0xaa, 0xa6, 0xa3, 0xd8, 0x99, 0x6a, 0x45, 0x6b, 0x51, 0xc0, 0x6e, 0x24, 0x61, 0x6f, 0xc0,
+  0x13, 0x7e, 0xa1, 0x9a, 0xa4, 0x86, 0x67, 0x9a, 0x68, 0x45, 0xab, 0x19, 0xa1, 0x5b, 0x67, 0x20,
+  0xc0, 0x27, 0x2c, 0xc0, 0xa3, 0x98, 0x75, 0x42, 0x35, 0xa6, 0xa7, 0xa4, 0xb7, 0x9a, 0x5a, 0x9a,
+  0x4a, 0xa5, 0xa6, 0xa8, 0xe5, 0x9c, 0x8b, 0x98, 0x1a, 0xa3, 0x97, 0x7f, 0x27, 0x3f, 0xa2, 0xa9,
+  0x99, 0x6a, 0xa9, 0xc5, 0xfe, 0xff, 0x9e, 0x94, 0x1d, 0x23, 0x9c, 0x5a, 0x2c, 0x27, 0xa6, 0xd6,
+  0x20, 0x9a, 0x58, 0xa6, 0xd7, 0x9d, 0x49, 0x41, 0x29, 0x7f, 0x9d, 0x89, 0x9b, 0x5a, 0x2c, 0x2a,
+  0x1b, 0x27, 0x20, 0xfe, 0x13, 0xb3, 0xc1, 0x66, 0xc0, 0x1c, 0x6e, 0x1c, 0x69, 0xc1, 0x66, 0xc1,
+  0x66, 0x69, 0x0b, 0xc0, 0x04, 0x66, 0x04, 0xc9, 0x6e, 0x0b, 0x04, 0xc2, 0x0b, 0xc0, 0x10, 0xc2,
+  0x15, 0xc0, 0x1c, 0xc0, 0x21, 0xc0, 0x6f, 0x6e, 0xa2, 0x78, 0x6e, 0x6b, 0x03, 0xc1, 0x66, 0xc0,
+  0x03, 0xc0, 0x3e, 0x03, 0xc9, 0x0f, 0xa2, 0x77, 0x6b, 0xc0, 0x66, 0xc0, 0xa2, 0x77, 0x20, 0x65,
+  0x7a, 0x7e, 0x17, 0x14, 0xc1, 0x1f, 0xa1, 0xa8, 0x41, 0x6b, 0xc0, 0xa3, 0x97, 0x7b, 0x46, 0x59,
+  0x9d, 0x9a, 0x56, 0x03, 0x79, 0x9f, 0xb9, 0x75, 0x9d, 0xb8, 0x9f, 0xb7, 0x6f, 0x7e, 0x6f, 0x55,
+  0x51, 0x10, 0x1c, 0x51, 0x51, 0xa2, 0x99, 0x1c, 0x0d, 0x6f, 0x76, 0xa2, 0x78, 0x19, 0xa3, 0x89,
+  0xa3, 0x98, 0x51, 0xa5, 0x98, 0x7e, 0x94, 0x7a, 0xb3, 0xa7, 0xa4, 0x98, 0x8e, 0x69, 0xaa, 0x77,
+  0xa1, 0xa9, 0x69, 0xab, 0x88, 0x7b, 0x9c, 0x99, 0x98, 0x58, 0xa6, 0x97, 0x9c, 0x88, 0x5e, 0x57,
+  0x9b, 0xa9, 0x58, 0x6b, 0x9d, 0x89, 0xc0, 0x66, 0x9d, 0x99, 0x4e, 0xa5, 0x98, 0xa9, 0x99, 0x9b,
+  0x99, 0x59, 0x5a, 0x76, 0x9e, 0x68, 0x66, 0x9c, 0x98, 0x5f, 0x6e, 0x56, 0x41, 0xa5, 0xa7, 0xa1,
+  0xd8, 0x94, 0xa8, 0x59, 0x0b, 0x65, 0xc0, 0x7e, 0x6e, 0x6f, 0x66, 0xc0, 0x7a, 0x61, 0xa3, 0x69,
+  0xa6, 0x29, 0xa2, 0x68, 0x67, 0x68, 0xaa, 0xe7, 0x1d, 0x14, 0xaa, 0xc6, 0xa1, 0x9a, 0x97, 0x49,
+  0xab, 0xc6, 0x9c, 0x7b, 0x8e, 0xb8, 0xa0, 0xa4, 0x5a, 0x67, 0xc0, 0x38, 0x3f, 0x5a, 0x3f, 0x0b,
+  0xc0, 0x37, 0xad, 0x76, 0xb2, 0xb8, 0xa6, 0x89, 0x94, 0x69, 0x5d, 0xa1, 0xaa, 0x96, 0x89, 0x9b,
+  0x88, 0x50, 0xa2, 0x78, 0x6b, 0x76, 0x29, 0x5f, 0xa6, 0x77, 0xa3, 0x7b, 0x59, 0x9d, 0x99, 0xa3,
+  0xa8, 0x6e, 0xa4, 0xe8, 0x99, 0x4b, 0xa0, 0x57, 0x9d, 0x99, 0x69, 0xa3, 0x97, 0x9f, 0xba, 0x5a,
+  0x5a, 0xa5, 0xb7, 0xa1, 0xba, 0x9e, 0x58, 0x55, 0x9b, 0x4b, 0x55, 0xa7, 0xe6, 0x9b, 0x4b, 0x9a,
+  0x49, 0xa5, 0xc5, 0x57, 0x9c, 0x59, 0xa1, 0xa8, 0xc0, 0x20, 0xa2, 0x98, 0x7e, 0xc0, 0x52, 0xa1,
+  0xa7, 0x98, 0xd9, 0x9a, 0xa6, 0xa6, 0xb6, 0xaa, 0xa6, 0x99, 0x8b, 0x2f, 0xc0, 0x67, 0x45, 0x69,
+  0x1f, 0xa2, 0x87, 0x1f, 0xc0, 0x7a, 0xa5, 0x87, 0xa2, 0xa8, 0x65, 0x56, 0x9b, 0x8a, 0x34, 0xaa,
+  0x18, 0xa7, 0x4b, 0x9b, 0xab, 0x6d, 0x27, 0xc0, 0x20, 0x67, 0x20, 0x3f, 0x37, 0x46, 0x22, 0xa9,
+  0xf5, 0xa4, 0xb8, 0x95, 0x1c, 0xa2, 0x66, 0xa1, 0xa9, 0xa2, 0x88, 0xa0, 0xa8, 0x2c, 0x7e, 0x6b,
+  0x56, 0xa1, 0xa7, 0xa6, 0xc7, 0x99, 0x4b, 0xa5, 0xc6, 0xa6, 0xd7, 0x96, 0x2b, 0x9b, 0x79, 0x1b,
+  0x27, 0x7d, 0xa6, 0xc6, 0x53, 0x04, 0xa2, 0xb6, 0xa3, 0x88, 0x3f, 0xa0, 0xa8, 0x6b, 0x9e, 0x47,
+  0x20, 0x67, 0x79, 0x1b, 0xc0, 0xa1, 0xa9, 0xfe, 0x13, 0xb3, 0xc0, 0x66, 0xc0, 0x1c, 0x6e, 0x6e,
+  0x1c, 0xc4, 0x69, 0x66, 0xc2, 0x65, 0xc6, 0x6e, 0x04, 0x09, 0x67, 0x10, 0x09, 0xc0, 0x10, 0xc1,
+  0x0b, 0xc0, 0x10, 0xc2, 0x15, 0x1c, 0xc0, 0x21, 0xc1, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0xc0, 0x03,
+  0xc0, 0x0f, 0x66, 0x03, 0xc1, 0x0f, 0xc0, 0x69, 0xc0, 0x03, 0x0f, 0xc1, 0x08, 0x0f, 0xc0, 0x6e,
+  0xc4, 0x6e, 0x7a, 0x66, 0x14, 0x17, 0x1c, 0x0f, 0x14, 0xc0, 0x7f, 0x1c, 0xa3, 0xa8, 0x75, 0x46,
+  0xa0, 0xb9, 0x59, 0xa2, 0x88, 0x27, 0x52, 0x55, 0x3e, 0x03, 0x75, 0xa1, 0xa8, 0x9d, 0xc8, 0x9d,
+  0xb8, 0xa4, 0x88, 0xc0, 0xa2, 0x87, 0x51, 0x51, 0xa6, 0x88, 0x9d, 0x99, 0x9c, 0x78, 0x35, 0xa2,
+  0x99, 0x9a, 0x88, 0x55, 0x14, 0xa7, 0x88, 0xa3, 0x88, 0x65, 0x15, 0x5a, 0x61, 0x9c, 0x98, 0xab,
+  0x88, 0x1d, 0xa3, 0x99, 0xaa, 0x97, 0x8f, 0x8a, 0x9e, 0x68, 0xa6, 0x98, 0x5a, 0xa5, 0xa7, 0xa5,
+  0x9a, 0x59, 0xaa, 0xa7, 0xa5, 0xa9, 0x6e, 0x97, 0x6a, 0xa5, 0xa8, 0x6e, 0x9b, 0x99, 0x9d, 0x69,
+  0x9d, 0x89, 0x51, 0x9d, 0xa9, 0x99, 0x89, 0x15, 0xaa, 0x97, 0xa9, 0xa8, 0xa3, 0xaa, 0x91, 0x58,
+  0x5b, 0x9b, 0x69, 0xa8, 0xa6, 0xa5, 0xa9, 0x98, 0x7a, 0x59, 0x9f, 0x68, 0x9c, 0x7a, 0x7a, 0x9c,
+  0x88, 0xa3, 0x97, 0x9b, 0xe9, 0x9a, 0x86, 0xa2, 0x88, 0x7f, 0x41, 0x7a, 0x7e, 0x13, 0x69, 0x6f,
+  0x07, 0x76, 0xa6, 0x48, 0xa6, 0x49, 0x2d, 0x9d, 0x8a, 0x69, 0xa2, 0x97, 0xa3, 0xd9, 0x55, 0x9c,
+  0x58, 0xa5, 0x88, 0xa5, 0xc8, 0x9d, 0x8a, 0xa2, 0x88, 0x93, 0xa9, 0x9a, 0xa6, 0xa2, 0x98, 0x37,
+  0xc0, 0x66, 0xc0, 0x3f, 0x3c, 0x3f, 0xc0, 0xa2, 0x77, 0x13, 0x42, 0xa2, 0x77, 0xaa, 0x87, 0xa5,
+  0x89, 0xa4, 0x87, 0xa4, 0x89, 0x8f, 0x9b, 0x9a, 0x97, 0xa3, 0x87, 0xa4, 0x88, 0x9d, 0x8b, 0x9c,
+  0x96, 0xa2, 0x88, 0xa2, 0x89, 0xa7, 0x77, 0xa4, 0x98, 0x1e, 0xa2, 0x79, 0xa0, 0x6a, 0x9d, 0x68,
+  0x44, 0xa7, 0xe9, 0x3e, 0x9a, 0x59, 0xa4, 0xa6, 0x47, 0x9d, 0x69, 0x9d, 0x78, 0xa9, 0xe6, 0xfe,
+  0xd7, 0x5d, 0xa2, 0x99, 0x92, 0x2b, 0x78, 0xa3, 0x99, 0x95, 0x1c, 0xa3, 0xb6, 0x9e, 0x69, 0x6d,
+  0x15, 0x9a, 0x4a, 0x6e, 0x7a, 0xa2, 0x78, 0xa1, 0xa9, 0xa2, 0x88, 0x69, 0x51, 0x9e, 0x68, 0xfe,
+  0x3c, 0x13, 0x9b, 0xd8, 0xa2, 0x76, 0xa8, 0xb7, 0x9d, 0x99, 0x9d, 0x79, 0x6b, 0x2f, 0x52, 0xc0,
+  0x7e, 0x22, 0x59, 0x7f, 0xc1, 0xa3, 0x98, 0xa7, 0xb7, 0x6f, 0x22, 0x9a, 0x68, 0xab, 0x1a, 0xa6,
+  0x3a, 0x71, 0x55, 0x6f, 0x20, 0x6b, 0xc0, 0x2c, 0xc0, 0x27, 0x2c, 0x6e, 0xc0, 0x9d, 0xaa, 0x27,
+  0x31, 0xa3, 0xc7, 0xa2, 0xb9, 0x9c, 0x49, 0x27, 0x06, 0x34, 0x27, 0x06, 0xa2, 0xa7, 0x9f, 0xb9,
+  0x9c, 0x4a, 0x40, 0x61, 0x20, 0xa3, 0xb8, 0x9d, 0x7a, 0x65, 0xa2, 0x98, 0x1b, 0xc0, 0xa3, 0x98,
+  0x20, 0x23, 0x7e, 0x27, 0x2a, 0x27, 0x1b, 0xc3, 0xa0, 0xa8, 0xfe, 0x13, 0xb3, 0xc3, 0x6e, 0x6e,
+  0x21, 0x6b, 0x26, 0x21, 0xc2, 0x65, 0xc0, 0x66, 0xc1, 0x69, 0x66, 0xc1, 0x6b, 0x10, 0x09, 0xc1,
+  0x0b, 0x10, 0xc2, 0x15, 0xc0, 0x21, 0x10, 0xc1, 0x15, 0xc1, 0x1c, 0xc0, 0x21, 0xc0, 0x26, 0x6b,
+  0x6e, 0x6f, 0xc0, 0x6e, 0x6f, 0x03, 0x3e, 0xc1, 0x03, 0xc0, 0x3e, 0xc1, 0x03, 0xc5, 0x0f, 0x7a,
+  0x0f, 0x66, 0x0f, 0x6e, 0xc0, 0x6f, 0x14, 0xa0, 0xb8, 0xa1, 0xa8, 0x9f, 0x58, 0x5f, 0x12, 0x14,
+  0xc2, 0x7a, 0xa1, 0xa8, 0xa3, 0x98, 0xa2, 0x97, 0x66, 0x42, 0x5a, 0x69, 0x42, 0x17, 0x55, 0x7a,
+  0x1f, 0xa2, 0xb7, 0x09, 0xa0, 0xa7, 0xa0, 0xa8, 0x9b, 0x89, 0x7a, 0x79, 0x9c, 0x88, 0x9d, 0x99,
+  0xa6, 0x88, 0xa3, 0x78, 0x35, 0xa2, 0x88, 0x18, 0x9c, 0x88, 0x1d, 0x9b, 0xa9, 0x9d, 0x89, 0x18,
+  0x17, 0x6d, 0x6f, 0x9d, 0x89, 0x1c, 0xa3, 0x99, 0xa3, 0x77, 0x2e, 0x6f, 0x97, 0x98, 0xa3, 0x99,
+  0x7f, 0x01, 0xaa, 0xa8, 0x5b, 0xa3, 0x87, 0xa2, 0xa9, 0xa8, 0x76, 0xa5, 0xb9, 0xa2, 0xa7, 0x9b,
+  0x6a, 0x9a, 0x68, 0xa4, 0xa8, 0x9e, 0x69, 0x99, 0x69, 0x79, 0x9d, 0xa8, 0x9b, 0x79, 0x6e, 0xa9,
+  0xa8, 0x56, 0x97, 0x5a, 0xa3, 0x98, 0x0d, 0xa2, 0x98, 0x9f, 0x69, 0x9b, 0x8a, 0x9d, 0x77, 0xa3,
+  0xc8, 0x9a, 0x59, 0x9d, 0x98, 0x5b, 0xa3, 0x88, 0x18, 0x96, 0x98, 0x7e, 0x66, 0x3f, 0x6e, 0x6f,
+  0x69, 0x76, 0x10, 0x07, 0x76, 0xa6, 0x19, 0x3e, 0xa2, 0xb7, 0x99, 0x8b, 0xa0, 0x57, 0x17, 0x56,
+  0x96, 0x4a, 0xa2, 0x96, 0x6b, 0x56, 0x3d, 0x08, 0x98, 0xc9, 0x97, 0x97, 0x37, 0x3f, 0x37, 0xc0,
+  0x69, 0x37, 0x3a, 0x3f, 0x5a, 0xc0, 0x3f, 0x6f, 0x7e, 0x0b, 0x3c, 0xa3, 0x88, 0xa8, 0x77, 0xad,
+  0x98, 0x9d, 0x9a, 0x98, 0x99, 0x41, 0x18, 0xa3, 0x89, 0x7e, 0x9c, 0x98, 0x9d, 0x88, 0xa2, 0x88,
+  0x56, 0x38, 0x0c, 0xa2, 0x77, 0x47, 0xa1, 0x6a, 0xb1, 0xe5, 0xa1, 0x9b, 0x90, 0x0b, 0xa4, 0x86,
+  0xa2, 0x97, 0x5b, 0x7a, 0x57, 0xa5, 0xa5, 0xa6, 0xd8, 0x9b, 0x8a, 0x9c, 0x49, 0x6e, 0x9a, 0x3a,
+  0x44, 0xa2, 0xa8, 0x6f, 0x9d, 0x89, 0x55, 0xa2, 0x87, 0x37, 0x13, 0x7a, 0x76, 0xa2, 0x77, 0x9c,
+  0x6a, 0x98, 0xc8, 0x9b, 0xe5, 0x7e, 0xa6, 0xb7, 0xa6, 0x87, 0x9b, 0x79, 0x9c, 0x79, 0x65, 0xa1,
+  0x9a, 0x69, 0x66, 0xc0, 0x5a, 0x61, 0x22, 0x2e, 0x27, 0xa2, 0x98, 0x66, 0x99, 0x69, 0x5e, 0xfe,
+  0x1c, 0xd4, 0xa3, 0x6c, 0x62, 0x79, 0xc0, 0x56, 0x7a, 0x5e, 0x34, 0x31, 0x2c, 0x2f, 0x56, 0xc1,
+  0xa3, 0xb8, 0x59, 0x34, 0x9f, 0xba, 0x9e, 0x66, 0xfe, 0x9e, 0x5a, 0x99, 0x4d, 0x99, 0x49, 0x6d,
+  0x7a, 0xa4, 0xb7, 0x9d, 0x7b, 0x9d, 0x68, 0xc1, 0x64, 0xa5, 0xa8, 0xa9, 0xe7, 0x97, 0x2c, 0x9c,
+  0x78, 0x69, 0x6f, 0xa3, 0xa8, 0xa2, 0x96, 0x27, 0xa1, 0xa8, 0x37, 0x2f, 0x7d, 0x2f, 0x25, 0x1b,
+  0xc0, 0x16, 0x1b, 0xc0, 0xfe, 0x13, 0xd4, 0x65, 0xc0, 0x28, 0xc0, 0x6e, 0xc0, 0x65, 0xc0, 0x28,
+  0x2d, 0xc1, 0x28, 0x21, 0xc0, 0x1c, 0xc0, 0x69, 0x66, 0xc8, 0x15, 0xc1, 0x1c, 0xc0, 0x21, 0x2d,
+  0xc0, 0x21, 0xc4, 0x6e, 0xc0, 0x2d, 0xc1, 0x6f, 0x6e, 0x6e, 0xa2, 0x78, 0x66, 0xc0, 0x66, 0x3e,
+  0x03, 0xc0, 0x6e, 0x03, 0x3e, 0x03, 0xc5, 0x0f, 0xc3, 0x14, 0xa2, 0x88, 0x7a, 0xc0, 0x65, 0xa0,
+  0xb8, 0x5a, 0x9f, 0x5a, 0xa2, 0x86, 0x66, 0x66, 0xc0, 0x59, 0x0f, 0x64, 0x66, 0x66, 0x03, 0xa3,
+  0xa8, 0x25, 0x7e, 0x7e, 0x5a, 0xc0, 0x5a, 0x6b, 0x7e, 0x7e, 0x7a, 0x56, 0xa8, 0xa6, 0x60, 0x52,
+  0x97, 0xb9, 0x55, 0x66, 0x55, 0x9d, 0xa9, 0xa4, 0x88, 0x55, 0x9b, 0x99, 0x1c, 0x35, 0x9d, 0xa9,
+  0x56, 0x08, 0x9d, 0x99, 0xa4, 0x77, 0xa2, 0x88, 0xa9, 0x99, 0x50, 0x9c, 0x99, 0xc0, 0x15, 0x9b,
+  0x89, 0x1c, 0xa2, 0x88, 0xc0, 0x35, 0x15, 0xa8, 0x87, 0xa3, 0x89, 0xa1, 0xa8, 0x98, 0x79, 0xa3,
+  0x88, 0x1e, 0x66, 0xa4, 0x89, 0x64, 0x9b, 0x8a, 0x9d, 0x89, 0x55, 0xa4, 0xa7, 0x9b, 0x7a, 0x55,
+  0xa4, 0x77, 0xa1, 0x59, 0xa1, 0xaa, 0xa5, 0x97, 0xa4, 0xa8, 0x7f, 0x94, 0x59, 0x9a, 0x79, 0xa9,
+  0xb6, 0x9b, 0x99, 0x9d, 0x7a, 0x50, 0xa5, 0x98, 0xa7, 0xc6, 0x96, 0x98, 0x98, 0x8a, 0xc0, 0xa2,
+  0x87, 0xc1, 0x66, 0x04, 0xc0, 0x7b, 0x6d, 0xa6, 0x69, 0xa7, 0x1b, 0xa3, 0x98, 0xa4, 0xe8, 0x97,
+  0x19, 0xc0, 0xa3, 0xb8, 0xa2, 0xa8, 0x9d, 0x69, 0x9c, 0x49, 0x64, 0x30, 0xa7, 0xb8, 0xa0, 0xc6,
+  0x89, 0x9a, 0x9a, 0x69, 0x37, 0xc2, 0x69, 0x37, 0xc0, 0x6e, 0x37, 0x3c, 0x3f, 0xc0, 0xa2, 0x78,
+  0x66, 0xc1, 0x37, 0xa6, 0x76, 0xaa, 0x88, 0xa5, 0x99, 0x9c, 0x99, 0x9c, 0x68, 0xa3, 0xa9, 0xc0,
+  0xa2, 0x77, 0xa2, 0xa8, 0x51, 0x9b, 0x89, 0x9a, 0x7a, 0x9c, 0x88, 0xa2, 0x75, 0xb3, 0xb7, 0x9c,
+  0x9d, 0x93, 0x57, 0xb4, 0x95, 0x99, 0xac, 0x93, 0x59, 0xa4, 0x66, 0xa3, 0x89, 0xb0, 0xd6, 0x98,
+  0x5c, 0x59, 0x9d, 0x7a, 0xa2, 0x86, 0x9f, 0x6a, 0xa3, 0xa8, 0x9d, 0x89, 0x9b, 0x59, 0xc0, 0x66,
+  0x41, 0x7f, 0x49, 0xa1, 0xa9, 0xa3, 0xb9, 0x9d, 0x88, 0x49, 0x3f, 0x97, 0xd9, 0x9b, 0xe6, 0x6e,
+  0xa6, 0x97, 0xa2, 0x98, 0x9d, 0x99, 0x41, 0x56, 0x27, 0x1f, 0x69, 0x1f, 0xc0, 0xa2, 0x88, 0x76,
+  0x3e, 0x7e, 0x66, 0x9c, 0x69, 0x9d, 0x78, 0x4f, 0xad, 0x18, 0xa1, 0x6c, 0x61, 0xc0, 0x6e, 0x76,
+  0x56, 0x69, 0x27, 0xc0, 0x23, 0x67, 0x59, 0xa4, 0xc7, 0xa5, 0xb8, 0x9b, 0x6a, 0x9c, 0x68, 0xa2,
+  0x87, 0x9d, 0x79, 0xa6, 0xb7, 0xfe, 0xae, 0x7b, 0x95, 0x1c, 0x9d, 0x79, 0x9d, 0x78, 0x6e, 0xa2,
+  0x98, 0x56, 0x0f, 0xc1, 0x0a, 0x2e, 0x3c, 0x9b, 0x6b, 0x9a, 0x5a, 0x26, 0xc0, 0x23, 0xa2, 0xa8,
+  0x0d, 0x20, 0x32, 0xc0, 0x1b, 0xa1, 0xa9, 0xa3, 0xa7, 0x1b, 0xc4, 0xfe, 0x13, 0xd4, 0xc1, 0x6e,
+  0xc2, 0x28, 0xc0, 0x2d, 0xc4, 0x6e, 0xc0, 0x2d, 0x28, 0xc0, 0x69, 0xc4, 0x66, 0xc0, 0x21, 0xc0,
+  0x6e, 0xc0, 0x2d, 0x32, 0xc1, 0x6f, 0x32, 0xc1, 0x3e, 0xc2, 0x32, 0xc0, 0x6b, 0xc0, 0x3e, 0xc0,
+  0xa2, 0x78, 0xc1, 0x6e, 0x0f, 0x69, 0x0f, 0x14, 0xc0, 0x0f, 0x66, 0x0f, 0xc0, 0x08, 0x0f, 0xc4,
+  0x14, 0xc0, 0x76, 0x14, 0x7f, 0xc0, 0x59, 0xa0, 0xa8, 0xa1, 0xb8, 0x1f, 0x0f, 0xa1, 0xa7, 0x56,
+  0x56, 0x69, 0x66, 0x7a, 0x7a, 0x56, 0x26, 0xc1, 0x32, 0x3a, 0xa2, 0x97, 0x7f, 0x7f, 0x5a, 0x5a,
+  0x25, 0x28, 0xa2, 0x86, 0x6b, 0xae, 0xa5, 0xa5, 0xc6, 0x97, 0x8a, 0x97, 0x7a, 0x9d, 0x8a, 0x9c,
+  0x98, 0x50, 0x9d, 0xba, 0x7e, 0x49, 0x66, 0xa2, 0x88, 0x7a, 0x9c, 0x78, 0xae, 0x88, 0xa2, 0x78,
+  0x9c, 0x98, 0xc1, 0x7e, 0x61, 0x46, 0x9a, 0x89, 0xa4, 0x87, 0x1f, 0x55, 0xc0, 0x6f, 0x28, 0xa2,
+  0x77, 0x16, 0x7a, 0x9d, 0x9a, 0x31, 0x5a, 0x9a, 0x69, 0xa3, 0xa8, 0xa8, 0xa7, 0xa1, 0x9a, 0x9b,
+  0x78, 0x9b, 0x89, 0xa2, 0x87, 0xa4, 0x89, 0x9d, 0xa8, 0x12, 0xa2, 0x5a, 0x25, 0x51, 0xa6, 0x96,
+  0xa3, 0xc8, 0xa3, 0x99, 0xa3, 0xa9, 0x98, 0x78, 0x6f, 0x9c, 0x89, 0x9e, 0x57, 0x2b, 0xa6, 0xb5,
+  0x99, 0xd8, 0x97, 0x79, 0xc2, 0x7a, 0x56, 0xc0, 0x07, 0x65, 0x67, 0xa9, 0x38, 0xa7, 0x3b, 0xa0,
+  0xb8, 0xa4, 0x96, 0x9f, 0x69, 0x9b, 0x7a, 0x45, 0x36, 0x7f, 0x9d, 0x78, 0x2d, 0xb1, 0xe5, 0xa4,
+  0xd7, 0x92, 0x79, 0x91, 0x79, 0x9a, 0x89, 0xa2, 0x68, 0x7a, 0xc0, 0x69, 0x67, 0x3c, 0x37, 0x35,
+  0x3c, 0x7a, 0x37, 0x3c, 0xc1, 0x7b, 0x3c, 0x6e, 0x7b, 0x3c, 0xc0, 0xa7, 0x88, 0xa2, 0x98, 0xa7,
+  0x88, 0xa8, 0x98, 0x9c, 0x88, 0x51, 0x00, 0x2c, 0xa6, 0x98, 0x9b, 0x8a, 0x96, 0x79, 0x9d, 0x78,
+  0xab, 0xa7, 0x9a, 0x8a, 0x95, 0x68, 0xab, 0x87, 0x7b, 0x98, 0x99, 0x68, 0xa3, 0x89, 0x66, 0xaa,
+  0x76, 0x02, 0x4f, 0x9f, 0x6a, 0x9b, 0x58, 0xa9, 0xc7, 0x9b, 0x6b, 0x9b, 0x69, 0x79, 0x46, 0x4a,
+  0x5b, 0xa1, 0xa8, 0x79, 0xa3, 0x99, 0x6b, 0x9c, 0x78, 0x97, 0xf8, 0x9d, 0xc7, 0x0b, 0xa4, 0x87,
+  0xa1, 0xa9, 0x55, 0x5f, 0x51, 0xc0, 0x66, 0xc3, 0xa6, 0x97, 0x79, 0x66, 0x7a, 0x9c, 0x79, 0x99,
+  0x49, 0xa6, 0x48, 0xa7, 0x4a, 0xa1, 0x7a, 0x9d, 0xa9, 0x6e, 0xc5, 0x76, 0xa3, 0x97, 0x7b, 0x9e,
+  0x68, 0xa4, 0xa6, 0x57, 0xa4, 0xb7, 0x9a, 0x3a, 0x9d, 0x98, 0x6e, 0xa5, 0xc8, 0xa9, 0xd7, 0x99,
+  0x5b, 0x9a, 0x49, 0xaa, 0xe5, 0x9e, 0x5a, 0x97, 0x5a, 0x0f, 0x6e, 0xa1, 0xb9, 0x2e, 0x39, 0xa7,
+  0xd8, 0xa2, 0x98, 0x94, 0x2b, 0x19, 0xa3, 0x87, 0x7f, 0x41, 0x56, 0x7f, 0x6e, 0x52, 0x6e, 0xc0,
+  0xa2, 0x87, 0xa1, 0xa8, 0x9e, 0x69, 0x27, 0xc2, 0x2c, 0xfe, 0x13, 0xf4, 0xc8, 0x6e, 0xc1, 0x6b,
+  0x32, 0xc2, 0x2d, 0x32, 0xc0, 0x2d, 0xc2, 0x32, 0x2d, 0xc1, 0x32, 0xc1, 0x6f, 0xc1, 0x6e, 0xc3,
+  0x6e, 0xc0, 0x03, 0xc2, 0x3e, 0xc0, 0x03, 0xc0, 0x6f, 0xc2, 0x03, 0xc1, 0xa2, 0x78, 0xc0, 0x0f,
+  0xc1, 0x14, 0xc0, 0x03, 0x0f, 0xc0, 0x14, 0x7a, 0x0f, 0x03, 0xa2, 0x89, 0x17, 0x0f, 0x14, 0xc1,
+  0x17, 0x64, 0x52, 0x61, 0x6e, 0xc0, 0xa0, 0xa9, 0x59, 0x52, 0x79, 0x6f, 0x2e, 0x65, 0x29, 0xc0,
+  0x1d, 0x7b, 0x79, 0x5f, 0xa3, 0x78, 0x5f, 0x6e, 0xa1, 0xb9, 0x6e, 0x65, 0xa0, 0xb6, 0xa4, 0xb8,
+  0xa7, 0x87, 0xa4, 0xa7, 0x9c, 0x7a, 0x9c, 0x68, 0x95, 0x9a, 0xa3, 0x87, 0x66, 0x9a, 0x99, 0x61,
+  0xa3, 0x88, 0xa7, 0x99, 0xa6, 0x97, 0x98, 0x68, 0xa6, 0x78, 0xa4, 0x88, 0xa1, 0xa9, 0x94, 0x88,
+  0x9b, 0x99, 0x9d, 0x78, 0xa6, 0x98, 0x7f, 0x35, 0x9c, 0x89, 0xa1, 0xa8, 0x1c, 0x59, 0x21, 0x7a,
+  0x6f, 0xa7, 0x88, 0x6f, 0x55, 0x3d, 0x9c, 0x88, 0x66, 0x9d, 0x88, 0x55, 0xa6, 0x89, 0x2e, 0x65,
+  0x2e, 0x99, 0x89, 0x66, 0xa2, 0x58, 0xa5, 0x69, 0x7b, 0xa3, 0x98, 0x79, 0xa2, 0x98, 0xa7, 0x87,
+  0xa0, 0xc9, 0x41, 0xa2, 0x77, 0x9a, 0x7a, 0x9a, 0x49, 0xa8, 0xb5, 0x9a, 0xe7, 0x94, 0x79, 0xc3,
+  0x6e, 0x6b, 0x66, 0x65, 0xa3, 0x88, 0xa6, 0x58, 0xa6, 0x4a, 0x9d, 0x6a, 0xa2, 0xa7, 0x6e, 0x9d,
+  0x99, 0x5b, 0x45, 0xc0, 0x62, 0xab, 0xc5, 0xfe, 0xdf, 0x5b, 0x9c, 0xa8, 0x8d, 0x5b, 0x96, 0x79,
+  0x04, 0xc0, 0x51, 0xc0, 0x3f, 0x5a, 0x55, 0x6e, 0x3c, 0xc0, 0x37, 0xc3, 0x3c, 0x3f, 0x3c, 0xc0,
+  0x7f, 0xc0, 0x10, 0x3f, 0x3c, 0xa4, 0x87, 0xa8, 0x87, 0xa5, 0x89, 0xa4, 0x88, 0xa3, 0x99, 0x7a,
+  0xa3, 0xa8, 0xa2, 0x88, 0x55, 0x9d, 0x8a, 0x99, 0x79, 0x55, 0x7b, 0x9c, 0x88, 0x9b, 0x8a, 0x50,
+  0x55, 0x14, 0x9d, 0x89, 0xa5, 0x87, 0xae, 0xa6, 0xa7, 0xba, 0x96, 0x7a, 0x48, 0xa1, 0x9a, 0x9b,
+  0x69, 0x3d, 0x6f, 0x5a, 0xa0, 0x59, 0xa5, 0xa8, 0x9c, 0xa9, 0xa0, 0x58, 0xa1, 0x58, 0x9d, 0xc9,
+  0x99, 0xe8, 0x9c, 0x97, 0x5d, 0x7f, 0xa1, 0xa8, 0xa2, 0x78, 0x9d, 0x8a, 0x65, 0x7e, 0xc1, 0x6e,
+  0x24, 0x1f, 0xa2, 0x88, 0x27, 0x1a, 0x65, 0x9d, 0x88, 0xa1, 0x59, 0xa7, 0x4a, 0xa4, 0x4a, 0x66,
+  0x60, 0x6b, 0x6d, 0xc1, 0x6b, 0x7e, 0x5e, 0x66, 0x76, 0xa2, 0x87, 0xc0, 0x12, 0x0d, 0x03, 0x1a,
+  0xa8, 0xe6, 0x5b, 0x98, 0x4b, 0x14, 0xa1, 0xa8, 0x13, 0x42, 0xa7, 0xb7, 0x9a, 0x3a, 0x9d, 0x78,
+  0x7b, 0xa2, 0x87, 0xa6, 0xd7, 0x09, 0xa4, 0xb6, 0x9c, 0x4a, 0x9d, 0x89, 0xa5, 0xa6, 0x9b, 0x6b,
+  0xc2, 0x6e, 0xa3, 0x88, 0xa2, 0xa8, 0x9c, 0x79, 0x6e, 0xc1, 0x56, 0x6e, 0x38, 0x69, 0x00, 0xc0,
+  0x38, 0xfe, 0x13, 0xf4, 0xc3, 0x6f, 0xc9, 0x6e, 0xc0, 0x39, 0xc0, 0x3e, 0x39, 0x3e, 0xc0, 0x39,
+  0xc0, 0x69, 0x3e, 0xc9, 0x6e, 0xc7, 0x3e, 0x6f, 0x6e, 0xc2, 0x03, 0x3e, 0xc3, 0x03, 0xc1, 0x7e,
+  0x6f, 0x55, 0xc0, 0x0f, 0x6e, 0x17, 0x0f, 0x03, 0x0a, 0x0f, 0xc0, 0x14, 0x0f, 0xc0, 0x08, 0x9d,
+  0xa8, 0x72, 0x59, 0x66, 0x1a, 0xa1, 0xa8, 0x5a, 0x5b, 0x1a, 0x7a, 0x6f, 0x1a, 0x22, 0x6f, 0x22,
+  0x7b, 0x75, 0x9f, 0xb8, 0xa3, 0x59, 0xa2, 0x58, 0x7f, 0xa3, 0xb7, 0x56, 0x5b, 0x9d, 0xc7, 0x9e,
+  0xd7, 0x5a, 0xa8, 0x76, 0x5f, 0x9d, 0x99, 0x98, 0x9a, 0xa3, 0x87, 0x6f, 0x9d, 0x99, 0x65, 0xa2,
+  0x88, 0x38, 0x6f, 0xa5, 0x88, 0x9c, 0x89, 0x9d, 0x98, 0x21, 0x65, 0xa6, 0x88, 0x6f, 0x21, 0x7a,
+  0x15, 0x66, 0x6f, 0x66, 0x59, 0x1c, 0x30, 0x24, 0x1c, 0x35, 0xa4, 0x78, 0x66, 0x9d, 0x99, 0x04,
+  0x5a, 0x7f, 0xa3, 0x88, 0xc0, 0x61, 0x35, 0x1c, 0x28, 0xa1, 0x59, 0xa5, 0x79, 0xa5, 0xa8, 0x9d,
+  0x79, 0xa1, 0xa8, 0xa2, 0x98, 0x9c, 0x79, 0x65, 0xa8, 0x97, 0xa5, 0x78, 0x94, 0x89, 0x11, 0xa2,
+  0x97, 0x24, 0x9d, 0x88, 0x7e, 0x6b, 0x61, 0x01, 0xa2, 0x88, 0x10, 0x3f, 0xa5, 0x68, 0xa8, 0x59,
+  0xa2, 0x5a, 0xc0, 0x54, 0x57, 0xc0, 0x7e, 0xa2, 0x97, 0x0f, 0xa3, 0x87, 0xaa, 0xe5, 0xa3, 0xc8,
+  0x93, 0x7b, 0x8e, 0x59, 0x55, 0xa2, 0x98, 0xc0, 0x3c, 0xc0, 0x65, 0x6b, 0x7a, 0x4a, 0xc0, 0x6f,
+  0x69, 0x37, 0xc0, 0x6d, 0x37, 0xc0, 0x3c, 0x3f, 0x3c, 0xc0, 0x7b, 0x5e, 0x66, 0x7e, 0xc0, 0x3c,
+  0x34, 0x37, 0xa9, 0x76, 0xac, 0xa7, 0xaa, 0x99, 0xa6, 0x98, 0x9d, 0x79, 0x52, 0xa4, 0x96, 0x1f,
+  0x61, 0xa2, 0x89, 0x9d, 0x78, 0x97, 0x8a, 0x9e, 0x67, 0x9b, 0x89, 0x62, 0xa4, 0x87, 0x52, 0xa3,
+  0x99, 0x99, 0x8a, 0x9a, 0x76, 0xa2, 0x77, 0x1d, 0x28, 0x06, 0xa4, 0x76, 0xa8, 0x98, 0xa9, 0xa9,
+  0x9c, 0x7a, 0x99, 0x68, 0xa3, 0x88, 0x9b, 0x8a, 0x9b, 0xb7, 0x69, 0x6f, 0x67, 0xa2, 0x97, 0x5a,
+  0x65, 0x33, 0x36, 0x7e, 0x27, 0xc0, 0x33, 0x1f, 0x65, 0xc0, 0x9d, 0x8a, 0x50, 0xa3, 0x58, 0xa5,
+  0x5a, 0xa5, 0x59, 0xa0, 0x7b, 0x0a, 0xc2, 0x6e, 0x0a, 0x0f, 0x6e, 0x6b, 0x7e, 0x52, 0x0f, 0x7a,
+  0x0f, 0x1b, 0xa3, 0xb7, 0x9e, 0x6a, 0x1b, 0xa3, 0xc7, 0xa7, 0xb8, 0x9c, 0x6a, 0x9e, 0x67, 0x7e,
+  0x36, 0xaa, 0xd6, 0x9a, 0x5a, 0x56, 0x9d, 0x4a, 0x7d, 0x56, 0xa2, 0x98, 0x9c, 0x79, 0x6e, 0x6e,
+  0xa3, 0xb8, 0x7e, 0x9a, 0x6b, 0x2c, 0x7a, 0x31, 0x6b, 0x31, 0x7f, 0x6e, 0x7a, 0x7b, 0x56, 0x4a,
+  0x6d, 0xa0, 0xa9, 0x5a, 0x55, 0x00, 0x38, 0xfe, 0x13, 0xf4, 0xc3, 0x6f, 0xc4, 0x6e, 0xc0, 0x39,
+  0x3e, 0x39, 0x3e, 0x6e, 0x6e, 0xc0, 0x6b, 0xc0, 0x66, 0x03, 0xc6, 0x3e, 0xc1, 0x65, 0x3e, 0x32,
+  0xc1, 0x3e, 0xc3, 0x32, 0x3e, 0xc2, 0x0f, 0xc0, 0x08, 0x03, 0xc0, 0x3e, 0xc0, 0x32, 0x2d, 0x69,
+  0x32, 0x6e, 0xc1, 0x7f, 0x03, 0x08, 0xc0, 0x03, 0x3e, 0x03, 0xc1, 0x0f, 0x08, 0x0f, 0xc0, 0x3e,
+  0x26, 0x65, 0x7b, 0x69, 0x56, 0x7a, 0x1d, 0x1a, 0x6b, 0xc0, 0x26, 0x1a, 0x21, 0x7d, 0x1a, 0x21,
+  0x24, 0xa1, 0xa7, 0x9f, 0xc8, 0x5f, 0x6e, 0x6b, 0xa3, 0x67, 0xa1, 0x8a, 0xa4, 0x87, 0xa0, 0xb8,
+  0xa3, 0x87, 0x9d, 0xb8, 0x97, 0x9a, 0xa2, 0x88, 0x5e, 0x61, 0x61, 0x7f, 0x6e, 0x2d, 0x21, 0x30,
+  0x56, 0x2d, 0x61, 0x21, 0x9d, 0x99, 0x45, 0xa7, 0x98, 0xa6, 0xa8, 0x9c, 0x79, 0x28, 0xa4, 0x87,
+  0x61, 0x9d, 0x79, 0x1c, 0x66, 0x5d, 0x76, 0xc1, 0x1c, 0x30, 0x1c, 0x2d, 0xa6, 0x98, 0x6e, 0x9d,
+  0x89, 0xa2, 0x77, 0x9d, 0x99, 0x2d, 0x28, 0x30, 0x6f, 0xa4, 0x58, 0xc0, 0xac, 0xb7, 0x9b, 0x7a,
+  0x98, 0x48, 0xa5, 0xb8, 0xa2, 0x99, 0x9e, 0x48, 0xa5, 0x98, 0x9f, 0xba, 0x94, 0xc7, 0xa3, 0xa5,
+  0x9d, 0x89, 0x9b, 0x89, 0xc0, 0x6e, 0x04, 0xc0, 0x56, 0xa2, 0x98, 0x04, 0xa2, 0x88, 0xaa, 0x19,
+  0xa1, 0x6a, 0x66, 0x7a, 0xa2, 0x77, 0xa0, 0xa8, 0xa4, 0xb7, 0xa6, 0x87, 0xa3, 0xd8, 0x9c, 0x98,
+  0xa2, 0x75, 0x9d, 0xaa, 0x34, 0x9b, 0x79, 0xa2, 0x87, 0x04, 0x66, 0x3c, 0xc0, 0x66, 0x6d, 0x3c,
+  0x65, 0x56, 0x6f, 0xc0, 0x71, 0x69, 0x28, 0xc0, 0x66, 0x26, 0xa2, 0x87, 0x67, 0x5a, 0x30, 0xc0,
+  0x7b, 0x01, 0x08, 0xc0, 0x66, 0xa2, 0x87, 0x66, 0x3c, 0x69, 0xa7, 0x88, 0xab, 0xa8, 0xa9, 0x99,
+  0xa4, 0x98, 0xa3, 0x89, 0x62, 0x44, 0x51, 0x9c, 0x89, 0x99, 0x7a, 0x69, 0xa2, 0x77, 0xab, 0xb7,
+  0xa6, 0xb9, 0xc0, 0x96, 0x6a, 0x99, 0x79, 0x9d, 0x78, 0xa2, 0xa8, 0xc0, 0x9b, 0x89, 0x9c, 0x88,
+  0xab, 0xa6, 0x9b, 0x8c, 0x5d, 0x9b, 0x99, 0x17, 0xa2, 0xa7, 0x55, 0x6e, 0xa1, 0x9a, 0xa2, 0x87,
+  0x38, 0x66, 0x7f, 0xc0, 0x41, 0xc1, 0x2d, 0x2b, 0x17, 0x3f, 0x51, 0x4a, 0xa4, 0x68, 0xa5, 0x6a,
+  0xa4, 0x2a, 0xa2, 0x78, 0x62, 0xc0, 0x20, 0xc1, 0x6e, 0x7f, 0x56, 0x27, 0x2c, 0x76, 0xa2, 0x87,
+  0x27, 0x2c, 0xc4, 0x31, 0x27, 0x20, 0x2c, 0x7a, 0x2c, 0x31, 0xa1, 0xa8, 0xfe, 0x85, 0xfa, 0x46,
+  0x97, 0x1c, 0x31, 0x7b, 0x31, 0xc0, 0x67, 0xc0, 0xa4, 0xa6, 0x72, 0xc0, 0xa2, 0x97, 0x9a, 0x4a,
+  0x34, 0x31, 0x6b, 0x3b, 0xa2, 0x77, 0x56, 0xa3, 0xa7, 0x67, 0x3d, 0xc0, 0x05, 0x66, 0x38, 0x3d,
+  0xc0, 0xfe, 0x13, 0xf4, 0xc0, 0x6e, 0x6b, 0xc6, 0x6e, 0xc2, 0x39, 0x3e, 0xc1, 0x69, 0x3e, 0x6e,
+  0xc1, 0x6f, 0xc0, 0x6e, 0x65, 0x0f, 0xc0, 0x66, 0x03, 0xc0, 0x3e, 0xc0, 0x32, 0x3e, 0x32, 0xc0,
+  0x3e, 0x32, 0xc7, 0x03, 0xc1, 0x3e, 0x37, 0x32, 0x69, 0x32, 0x65, 0xc2, 0x2b, 0x26, 0x66, 0x32,
+  0x37, 0x03, 0xc0, 0x0f, 0x14, 0xc0, 0x0f, 0xc1, 0x08, 0x3e, 0x26, 0x65, 0x66, 0x7e, 0xc0, 0x6b,
+  0x7e, 0x1d, 0x15, 0x1d, 0xc0, 0x6f, 0x26, 0x1a, 0x1d, 0x1a, 0x26, 0x7e, 0x7a, 0x7a, 0x79, 0x71,
+  0x7a, 0x7e, 0xa3, 0x59, 0xa4, 0x78, 0x9f, 0xb8, 0x55, 0xa8, 0x67, 0x9c, 0xa9, 0x9c, 0xa8, 0x6e,
+  0x9b, 0xa9, 0xc0, 0x6e, 0x7b, 0x7e, 0x35, 0xa4, 0x88, 0xa2, 0x88, 0x9a, 0x78, 0x2d, 0xa3, 0x88,
+  0x1a, 0x1d, 0x2d, 0x9d, 0x99, 0xa3, 0x98, 0xa2, 0x78, 0x04, 0x65, 0x9d, 0x89, 0x6e, 0x56, 0x1c,
+  0x35, 0x61, 0x66, 0x1c, 0xa2, 0x87, 0x57, 0x30, 0xa6, 0x88, 0x1d, 0x51, 0x01, 0x29, 0x30, 0x19,
+  0x31, 0x52, 0x9d, 0x79, 0xa7, 0x88, 0xa2, 0x68, 0x41, 0x9d, 0x4a, 0xc0, 0x5a, 0x9f, 0xb9, 0xa0,
+  0xa7, 0xa2, 0xb6, 0x38, 0x50, 0xc0, 0x9d, 0x99, 0x55, 0x7b, 0xc0, 0x35, 0xc0, 0x7e, 0xa6, 0x97,
+  0x3c, 0xa0, 0x29, 0x9d, 0xba, 0x75, 0x46, 0x65, 0xb3, 0xf4, 0xa5, 0xc7, 0x95, 0x6a, 0xa5, 0xa7,
+  0x9c, 0x89, 0x98, 0x79, 0x95, 0x8a, 0x9d, 0x89, 0xa2, 0x97, 0x66, 0x04, 0x5a, 0x3c, 0xc2, 0x01,
+  0x62, 0x55, 0x7a, 0x65, 0xa3, 0x7a, 0xa8, 0x28, 0xa2, 0x59, 0x56, 0x9d, 0xb8, 0x9f, 0xd8, 0xa2,
+  0x58, 0x4a, 0x52, 0x9d, 0xc8, 0x71, 0x61, 0xa0, 0xa7, 0x7d, 0x5a, 0x6f, 0xc0, 0x7f, 0x6e, 0xa2,
+  0x88, 0x0b, 0x9d, 0x79, 0xa3, 0xa7, 0xa9, 0x88, 0xa5, 0x98, 0xa6, 0x88, 0xa8, 0x97, 0x6b, 0x5b,
+  0x9d, 0x99, 0x99, 0x89, 0x50, 0xa9, 0x97, 0xa6, 0x97, 0xa4, 0xaa, 0x66, 0x9c, 0x67, 0x99, 0x8a,
+  0x2f, 0xa5, 0x98, 0x52, 0x9b, 0x79, 0x66, 0x96, 0x99, 0x93, 0x59, 0x69, 0x75, 0x51, 0x7e, 0xa3,
+  0x88, 0xa2, 0x99, 0x6e, 0x56, 0x42, 0x65, 0x56, 0x56, 0x65, 0x51, 0x76, 0x56, 0xa2, 0x57, 0xa3,
+  0x68, 0xa1, 0x7a, 0xa5, 0x59, 0xa3, 0x79, 0xa1, 0x7a, 0x65, 0xc6, 0xa2, 0x88, 0x65, 0x2c, 0xc0,
+  0x65, 0xc0, 0x34, 0xc0, 0x5a, 0x38, 0xc0, 0x31, 0xc0, 0x2c, 0xc2, 0x69, 0x31, 0x67, 0x65, 0xa1,
+  0xa8, 0x20, 0x27, 0x34, 0x31, 0x38, 0x31, 0x38, 0xc0, 0x27, 0x20, 0xa4, 0x88, 0xa0, 0xa9, 0x33,
+  0xc0, 0x38, 0xa2, 0x87, 0xa3, 0xa8, 0x52, 0x9f, 0x69, 0xc0, 0xa1, 0xa8, 0x56, 0x55, 0x31, 0x3d,
+  0x38, 0x7a, 0x3d, 0xfe, 0x13, 0xd4, 0x6e, 0x6e, 0x6b, 0xca, 0x32, 0x2d, 0xc5, 0x32, 0xc1, 0x6f,
+  0x6e, 0xc3, 0x3e, 0xc1, 0x32, 0xc3, 0x2d, 0x69, 0xc3, 0x32, 0xc0, 0x6e, 0xc1, 0x32, 0xc1, 0x26,
+  0xc3, 0x66, 0xc0, 0x26, 0xc2, 0x2d, 0x3e, 0x03, 0xc2, 0x3e, 0x37, 0x32, 0x69, 0xc0, 0x26, 0xc0,
+  0x21, 0xa2, 0x87, 0x62, 0x59, 0x7f, 0x2b, 0xc0, 0x9f, 0xb9, 0x65, 0x29, 0x2b, 0xc1, 0x32, 0x39,
+  0x03, 0xc0, 0x69, 0x7a, 0x6f, 0x66, 0xa0, 0xb7, 0xa0, 0xc7, 0xa2, 0x78, 0x40, 0x71, 0xc0, 0xa5,
+  0x78, 0x7a, 0x9c, 0x99, 0x51, 0x69, 0x66, 0x65, 0x7f, 0x6f, 0x6e, 0xa4, 0x87, 0x4b, 0x61, 0x35,
+  0x1f, 0xa5, 0xaa, 0x9b, 0x88, 0x41, 0x32, 0x2d, 0x61, 0x55, 0xa1, 0xa9, 0x55, 0x0d, 0x66, 0x21,
+  0xa4, 0x88, 0x1c, 0x5a, 0xa2, 0x97, 0x35, 0x52, 0x24, 0x29, 0xa2, 0x78, 0xa2, 0x88, 0x32, 0x2d,
+  0xc0, 0xa4, 0x48, 0x42, 0xa1, 0xa9, 0xa3, 0x68, 0x9e, 0x5a, 0x03, 0x7e, 0x03, 0x3f, 0x9c, 0xf7,
+  0xa0, 0xc6, 0x5a, 0x55, 0x56, 0x62, 0x65, 0xc0, 0x5b, 0x33, 0x5e, 0x33, 0x6e, 0xac, 0x48, 0xa2,
+  0x4b, 0x9a, 0x79, 0x7a, 0x09, 0xc0, 0xad, 0xd5, 0xa7, 0xf4, 0x93, 0x7c, 0x97, 0x7a, 0xa4, 0x87,
+  0x51, 0x9a, 0x99, 0x55, 0x11, 0x3f, 0xc0, 0x5e, 0xc0, 0x66, 0x37, 0x3c, 0x01, 0x3c, 0x65, 0xa4,
+  0x88, 0x32, 0x9f, 0x5a, 0xa6, 0x49, 0xa2, 0x59, 0xc0, 0x69, 0x31, 0xa2, 0x97, 0xa2, 0x78, 0x42,
+  0x75, 0x01, 0x76, 0x9d, 0x89, 0x9d, 0xd8, 0x9c, 0xb7, 0x50, 0x70, 0x30, 0x7b, 0x13, 0x18, 0xc0,
+  0x57, 0x7e, 0x9d, 0x89, 0x51, 0x39, 0xa5, 0x98, 0xa3, 0x99, 0xa5, 0x77, 0xa2, 0xa9, 0x42, 0xa5,
+  0x87, 0xa3, 0xa9, 0xa5, 0x97, 0xa5, 0x98, 0x7f, 0xc0, 0x52, 0x40, 0x7a, 0x9b, 0x7a, 0x97, 0x99,
+  0x9a, 0x89, 0x9e, 0x86, 0x9c, 0x9a, 0x13, 0xa5, 0x78, 0x7f, 0xa2, 0x88, 0xa3, 0x79, 0x5a, 0x66,
+  0x55, 0x76, 0x41, 0x9c, 0x89, 0x6e, 0x55, 0x4a, 0xa2, 0x69, 0xa2, 0x68, 0xa2, 0x79, 0xa3, 0x69,
+  0xc0, 0x6b, 0x61, 0x65, 0x6e, 0x1b, 0x27, 0x1b, 0x76, 0x1b, 0x6b, 0x1b, 0xc0, 0x66, 0x69, 0x1b,
+  0xc1, 0xa3, 0x98, 0x23, 0x5f, 0x38, 0xc0, 0x2c, 0xc1, 0x31, 0x2c, 0xc0, 0x31, 0xc2, 0x67, 0x31,
+  0x6f, 0x33, 0xc0, 0x38, 0x2c, 0x33, 0x2c, 0x33, 0x2c, 0x33, 0x31, 0x3d, 0x38, 0xc0, 0x3d, 0x7a,
+  0x6f, 0x5a, 0xc0, 0x76, 0x3d, 0xc0, 0x38, 0x2c, 0x7e, 0x2c, 0x27, 0xfe, 0x13, 0xd4, 0x6e, 0xc1,
+  0x6f, 0xc2, 0x69, 0x39, 0xc5, 0x32, 0xc0, 0x2d, 0xc0, 0x28, 0xc0, 0x69, 0x6e, 0x21, 0xc1, 0x26,
+  0x6e, 0x32, 0xc3, 0x2d, 0xc3, 0x26, 0x2d, 0x21, 0xc2, 0x26, 0x2b, 0x32, 0xc0, 0x6e, 0xc0, 0x32,
+  0x2d, 0xc0, 0x26, 0x2d, 0xc0, 0x26, 0xc3, 0x32, 0xc0, 0x2b, 0x32, 0x37, 0x32, 0x26, 0xc3, 0x21,
+  0x26, 0xc2, 0x32, 0xc0, 0x2b, 0x32, 0xc0, 0x37, 0xa2, 0x77, 0x77, 0x32, 0xc0, 0xa2, 0x77, 0x6f,
+  0xc0, 0x66, 0x08, 0x37, 0x39, 0x03, 0xc0, 0x3c, 0x7f, 0xa1, 0xa8, 0xa2, 0xa7, 0xa1, 0xa8, 0xc0,
+  0x6b, 0x9b, 0xa8, 0x9d, 0xa7, 0xa2, 0x89, 0x51, 0x60, 0x5a, 0x15, 0xc0, 0x56, 0x12, 0x7b, 0xc0,
+  0x01, 0xa2, 0x78, 0x66, 0x79, 0x46, 0x01, 0x6e, 0x09, 0x61, 0x41, 0x61, 0xc0, 0x5a, 0x1c, 0x61,
+  0xa3, 0x88, 0x6f, 0xc0, 0x24, 0x1c, 0xc0, 0x21, 0xa2, 0x99, 0x30, 0x2d, 0xa4, 0x68, 0x56, 0x5b,
+  0x4a, 0xa2, 0x68, 0x7b, 0x7e, 0x9e, 0x68, 0x08, 0x9f, 0xb9, 0x76, 0x58, 0xa0, 0xc9, 0x9c, 0xd6,
+  0x54, 0x52, 0x6e, 0x9d, 0x99, 0x7e, 0x3f, 0x33, 0x2b, 0x7a, 0x5e, 0x2e, 0xa3, 0x88, 0x05, 0xa2,
+  0x49, 0xa2, 0xc6, 0x25, 0x0b, 0xad, 0xf5, 0x9c, 0xd7, 0x95, 0x7a, 0x10, 0x7e, 0x6e, 0x51, 0xc0,
+  0x04, 0x3f, 0xc0, 0x5a, 0xc5, 0x5d, 0xac, 0xa7, 0xa5, 0x3a, 0x99, 0x3c, 0x5f, 0x14, 0x66, 0x69,
+  0x67, 0x14, 0xa1, 0xa8, 0x5e, 0x56, 0x6b, 0xa1, 0xa8, 0x5a, 0x66, 0x25, 0xc0, 0x14, 0x71, 0x9e,
+  0xb8, 0x70, 0x70, 0x9f, 0xb8, 0x7e, 0x66, 0xc1, 0x0b, 0x6b, 0x59, 0x61, 0x5a, 0xc0, 0xa2, 0x78,
+  0x0d, 0x24, 0xa4, 0x88, 0x7e, 0xa2, 0x78, 0xa1, 0xa9, 0x9d, 0x89, 0x9d, 0x89, 0x55, 0x13, 0x9d,
+  0x99, 0x07, 0xa4, 0x78, 0xa3, 0x88, 0xa3, 0x5a, 0xa5, 0x69, 0xa3, 0x99, 0x56, 0x6b, 0x34, 0x67,
+  0x69, 0xc0, 0x9f, 0x69, 0x46, 0x5a, 0x9f, 0x69, 0x56, 0x6f, 0x69, 0x61, 0x66, 0xc0, 0x61, 0x20,
+  0xc0, 0x1b, 0x20, 0xc2, 0x6b, 0x20, 0xc1, 0x7b, 0x1b, 0x66, 0x1b, 0xc0, 0x16, 0x1b, 0x27, 0xa2,
+  0x78, 0xc0, 0x31, 0x2c, 0x6b, 0x38, 0x33, 0xc1, 0x38, 0x33, 0x2c, 0xc0, 0x31, 0xc2, 0x2c, 0x38,
+  0x2c, 0x31, 0x7a, 0x2c, 0x33, 0x2c, 0x38, 0xc0, 0x3d, 0xc1, 0x38, 0x7e, 0x3d, 0xc2, 0x38, 0x34,
+  0x7b, 0x2c, 0xc0, 0xfe, 0x13, 0xf4, 0xc4, 0x6f, 0xc0, 0x69, 0x39, 0xc4, 0x6e, 0xc2, 0x32, 0x2d,
+  0xc0, 0x69, 0x66, 0xc0, 0x26, 0xc3, 0x21, 0xc3, 0x26, 0xc4, 0x21, 0x66, 0x21, 0xc0, 0x26, 0x6e,
+  0x6f, 0x3e, 0xc0, 0x37, 0x32, 0xc2, 0x37, 0x32, 0xc3, 0x3e, 0x37, 0x6f, 0xc1, 0x37, 0x32, 0x26,
+  0xc1, 0x2b, 0x32, 0x26, 0x2b, 0xc1, 0x26, 0x32, 0x37, 0xc0, 0x03, 0xc0, 0x6e, 0x6e, 0x08, 0xc0,
+  0x03, 0x08, 0x0d, 0x3e, 0x6d, 0x37, 0x32, 0x2b, 0x37, 0x7a, 0xc0, 0xa0, 0xc8, 0x7d, 0x56, 0x51,
+  0xa2, 0xa8, 0xa3, 0x87, 0x4b, 0x9c, 0xb8, 0x65, 0x6e, 0x65, 0x9d, 0x9a, 0x68, 0x14, 0x6d, 0x66,
+  0x7f, 0x7e, 0xa3, 0x78, 0x6f, 0xc0, 0x66, 0x7a, 0xa2, 0x68, 0x06, 0x3a, 0x61, 0xc1, 0x24, 0x1c,
+  0x7a, 0xa2, 0x88, 0xa4, 0x67, 0x9a, 0x88, 0x0e, 0x7b, 0x06, 0xa3, 0x99, 0x6f, 0x9e, 0x68, 0x65,
+  0x66, 0xa2, 0x68, 0x57, 0x5e, 0x7f, 0x65, 0xa5, 0x88, 0x9d, 0x99, 0x45, 0x5a, 0x66, 0x5a, 0x7b,
+  0xa2, 0xc6, 0x9a, 0xd6, 0x99, 0x99, 0xa2, 0x78, 0x66, 0x55, 0x33, 0x30, 0xc0, 0x6f, 0x30, 0x66,
+  0x04, 0xaa, 0x38, 0xa0, 0x4b, 0xc0, 0xa5, 0xa6, 0x9d, 0x9a, 0xaa, 0xc5, 0x9a, 0xd7, 0x91, 0x7b,
+  0xa2, 0x77, 0xc0, 0x66, 0x1d, 0x9d, 0xa9, 0x04, 0x3c, 0x66, 0xc1, 0x3c, 0xc1, 0x5a, 0x65, 0xa3,
+  0x88, 0xac, 0x67, 0xa6, 0x6a, 0x98, 0x5b, 0x03, 0xc0, 0x65, 0xc0, 0x3e, 0x79, 0x3e, 0x6d, 0x03,
+  0xc0, 0x08, 0x6e, 0x6b, 0xc1, 0x6f, 0x6e, 0xc0, 0x6e, 0x25, 0x20, 0x9f, 0xb8, 0xa0, 0xc7, 0x9f,
+  0xb8, 0x9d, 0x99, 0x54, 0x9d, 0xa9, 0x75, 0x75, 0x0b, 0x07, 0x6b, 0x3f, 0x56, 0xc0, 0x56, 0x65,
+  0x37, 0x7a, 0x2b, 0x2f, 0x6e, 0xa5, 0x88, 0xa2, 0x79, 0xa4, 0x68, 0xa4, 0x79, 0x6f, 0xa3, 0x78,
+  0x62, 0x69, 0x5a, 0x51, 0x6b, 0x7a, 0x08, 0x45, 0x4b, 0x59, 0x6b, 0xc0, 0x5a, 0x66, 0xc3, 0x31,
+  0xc0, 0x2c, 0xc1, 0x6d, 0x31, 0xc0, 0x2c, 0x31, 0xc1, 0x34, 0x52, 0x2c, 0xc0, 0x20, 0xc0, 0x27,
+  0x2c, 0xc0, 0x31, 0xc2, 0x6b, 0x31, 0xc1, 0x38, 0x2c, 0x31, 0xc6, 0x2c, 0x31, 0xc0, 0x2c, 0x38,
+  0x2c, 0x38, 0x2c, 0x38, 0x2c, 0x38, 0x7e, 0x5a, 0x38, 0x3d, 0xc1, 0x38, 0xc0, 0x2c, 0xc1, 0xfe,
+  0x14, 0x15, 0xc0, 0x69, 0xc0, 0x39, 0xc1, 0x32, 0x6f, 0xc0, 0x39, 0xc0, 0x3e, 0xc2, 0x39, 0x3e,
+  0xc4, 0x69, 0x3e, 0xc0, 0x37, 0x32, 0xc0, 0x66, 0x69, 0x66, 0xc1, 0x26, 0x21, 0xc1, 0x7a, 0x21,
+  0x66, 0x21, 0x6b, 0x21, 0x28, 0x32, 0x3e, 0x6e, 0x6f, 0xc0, 0x69, 0x03, 0x08, 0x0f, 0xc0, 0x08,
+  0xc1, 0x6e, 0x6b, 0xc0, 0x0f, 0x08, 0x0f, 0x03, 0x3e, 0x37, 0x65, 0x26, 0xc0, 0x32, 0xc0, 0x7e,
+  0x37, 0xc0, 0x32, 0x2b, 0xc0, 0x37, 0xc0, 0x03, 0x08, 0xc1, 0x03, 0xc4, 0x37, 0x32, 0x2b, 0xc0,
+  0x37, 0xc0, 0x79, 0x9e, 0xb8, 0x7f, 0xa2, 0x98, 0x54, 0x76, 0x65, 0x72, 0xa3, 0x58, 0xa3, 0x88,
+  0x9d, 0xc8, 0x65, 0x41, 0xc0, 0x62, 0x7e, 0x6e, 0x12, 0x10, 0xa2, 0x88, 0xa4, 0x78, 0xa2, 0x78,
+  0x56, 0x1a, 0x5a, 0x7f, 0x61, 0x9d, 0x99, 0x55, 0xc0, 0x6e, 0xa3, 0x78, 0xa1, 0xc9, 0x9d, 0x88,
+  0x09, 0xa2, 0x89, 0x9d, 0x98, 0xa4, 0x88, 0x9d, 0x69, 0xa2, 0x58, 0xa5, 0x89, 0x7a, 0x41, 0xc0,
+  0x45, 0xc0, 0x76, 0xa1, 0xa8, 0xa2, 0x88, 0x9d, 0x7a, 0xa3, 0x87, 0x67, 0x3a, 0x3c, 0x28, 0x4e,
+  0xa1, 0xc8, 0x9c, 0xe6, 0x9a, 0x88, 0x10, 0x65, 0x62, 0x59, 0xc0, 0x66, 0x6f, 0x6d, 0x5a, 0x9d,
+  0xba, 0xa8, 0x66, 0xaa, 0x1a, 0x9d, 0x8b, 0x21, 0x9e, 0x69, 0xab, 0xe6, 0x9e, 0xe5, 0x90, 0x6b,
+  0xc0, 0xa2, 0x87, 0x5a, 0x65, 0x62, 0x04, 0x56, 0x30, 0x35, 0xc0, 0x3c, 0xc1, 0x5a, 0x51, 0xa3,
+  0x98, 0xac, 0x58, 0xa3, 0x79, 0x9a, 0x5a, 0x9c, 0x78, 0x6b, 0xc0, 0x6e, 0xc0, 0x3e, 0x7e, 0x5e,
+  0x6f, 0xc3, 0x6f, 0xc1, 0x6e, 0x7a, 0x5e, 0x25, 0x6f, 0xc0, 0xa3, 0xa8, 0xa1, 0xa8, 0xc0, 0x9e,
+  0x69, 0x9d, 0x89, 0x9c, 0xb8, 0x9c, 0xf5, 0xa2, 0x67, 0xa3, 0x6a, 0x56, 0x65, 0x76, 0x6e, 0xc1,
+  0x7a, 0x6f, 0x0d, 0x66, 0x47, 0xa2, 0x57, 0xa4, 0xa8, 0x6f, 0x4a, 0x02, 0x7a, 0x09, 0x7b, 0x6e,
+  0x56, 0x55, 0x6e, 0x01, 0x56, 0x46, 0x20, 0x69, 0x14, 0xa1, 0xa8, 0x56, 0x5b, 0xc0, 0x66, 0x1b,
+  0x20, 0xc3, 0x28, 0xa2, 0x99, 0x41, 0x5a, 0xc1, 0x31, 0x2c, 0x20, 0x2c, 0x66, 0xc0, 0x1b, 0xc0,
+  0x27, 0x2c, 0x6f, 0x31, 0xc2, 0x2c, 0xc0, 0x31, 0x6e, 0x31, 0xc2, 0x2c, 0x31, 0xc1, 0x38, 0x2c,
+  0x31, 0xc4, 0x2c, 0x38, 0xc3, 0x31, 0x67, 0x38, 0xc0, 0x2c, 0x38, 0xc0, 0x31, 0x2c, 0xc0, 0xfe,
+  0x14, 0x55, 0xc1, 0x66, 0xcf, 0x03, 0xc2, 0x6e, 0xc5, 0x03, 0xc0, 0x3e, 0x69, 0xc1, 0x7f, 0x03,
+  0xc0, 0x06, 0xc0, 0x03, 0xc0, 0x08, 0x6b, 0xc0, 0x6e, 0x6e, 0xc0, 0x14, 0x0f, 0xc1, 0x14, 0x0f,
+  0x08, 0xc3, 0x3e, 0xc1, 0x65, 0xc1, 0x69, 0x66, 0xc0, 0x2b, 0xc0, 0x32, 0xc0, 0x37, 0xc1, 0x6e,
+  0x03, 0x08, 0x03, 0x08, 0x14, 0x08, 0xc0, 0x03, 0xc0, 0x08, 0x03, 0xc0, 0x37, 0x32, 0xc0, 0x3e,
+  0x03, 0x3e, 0x32, 0x6d, 0xa2, 0x88, 0x76, 0xa0, 0xa7, 0x7a, 0xc0, 0x9f, 0xb8, 0xc0, 0x5f, 0x70,
+  0x61, 0x51, 0x6e, 0x7b, 0x65, 0x0d, 0x69, 0x7f, 0x21, 0xa7, 0x79, 0xa3, 0x88, 0x66, 0x26, 0x7f,
+  0xa2, 0x87, 0x45, 0x9c, 0x79, 0x7a, 0x7a, 0x9d, 0x89, 0xa2, 0x77, 0x0f, 0x10, 0x51, 0x1c, 0xa5,
+  0x89, 0xc0, 0x9e, 0x58, 0xa3, 0x59, 0x5a, 0xc0, 0xa3, 0xa9, 0xa2, 0x87, 0xa2, 0xa8, 0x9d, 0x99,
+  0x52, 0x59, 0xa2, 0x78, 0x9d, 0x89, 0xa3, 0xa8, 0x3a, 0x9d, 0x89, 0xa1, 0xa9, 0x1e, 0xa3, 0xb9,
+  0x9f, 0xd5, 0x95, 0x99, 0x56, 0xa1, 0xa8, 0x66, 0x9d, 0x89, 0xc0, 0x69, 0xc0, 0x6f, 0xc0, 0x5b,
+  0x78, 0xaa, 0x59, 0xa4, 0x3a, 0x52, 0x9c, 0x78, 0xa8, 0xc7, 0xa5, 0xf4, 0x8e, 0x7b, 0x07, 0xa2,
+  0x98, 0x5e, 0x13, 0x07, 0x09, 0x66, 0x3c, 0x66, 0x7e, 0x59, 0x3c, 0xc0, 0x5a, 0x61, 0xa6, 0x87,
+  0xac, 0x67, 0xa0, 0x5a, 0x99, 0x6b, 0x9e, 0x68, 0x66, 0xa2, 0x77, 0x6f, 0xa2, 0x98, 0x55, 0x08,
+  0x6f, 0x66, 0xa2, 0x77, 0xc2, 0x7f, 0x66, 0x14, 0xc1, 0x19, 0x23, 0x28, 0x14, 0x7a, 0x23, 0xc0,
+  0x5e, 0x66, 0xc1, 0x17, 0xa1, 0x7a, 0xa2, 0x76, 0x6b, 0x2a, 0x67, 0x31, 0xc3, 0x6e, 0xc0, 0xa1,
+  0xa9, 0x76, 0x44, 0x28, 0x2d, 0xa1, 0xa8, 0x7b, 0xa1, 0xb8, 0x6e, 0x10, 0x55, 0xc0, 0x6e, 0x62,
+  0xc0, 0x06, 0x23, 0x19, 0x67, 0x17, 0x6b, 0x0f, 0x1b, 0xc0, 0x0f, 0x1b, 0x20, 0xc0, 0x1b, 0xc0,
+  0x23, 0xc0, 0x1b, 0x2c, 0x31, 0xc0, 0x2c, 0xc5, 0x31, 0x6f, 0xc0, 0x66, 0x31, 0xc0, 0x2c, 0xc0,
+  0x31, 0xc0, 0x7a, 0x66, 0x31, 0xc1, 0x2c, 0x31, 0xc3, 0x38, 0x2c, 0xc0, 0xa2, 0x88, 0x6e, 0x31,
+  0xc0, 0x38, 0xc0, 0x2c, 0x38, 0xc0, 0x31, 0x34, 0x6b, 0x2c, 0x31, 0xc0, 0x2c, 0xc3, 0xfe, 0x14,
+  0x35, 0xc2, 0x66, 0xc2, 0x3e, 0xc7, 0x6e, 0xc4, 0x6f, 0x69, 0xc3, 0x6f, 0xc8, 0x6e, 0xc0, 0x7a,
+  0xc2, 0x6e, 0xa1, 0xa8, 0x6f, 0x42, 0x19, 0xc1, 0x14, 0x0f, 0xc0, 0x03, 0x3e, 0xc0, 0x65, 0xc0,
+  0x66, 0x69, 0x32, 0x69, 0x2d, 0x26, 0xc4, 0x2b, 0x6f, 0xc0, 0x3e, 0x03, 0x08, 0x03, 0x0f, 0xc1,
+  0x14, 0xc1, 0x0f, 0xc2, 0x14, 0x08, 0x03, 0x37, 0x03, 0x08, 0x14, 0xc2, 0xa3, 0xa8, 0xa2, 0xb8,
+  0x55, 0x56, 0x59, 0x7a, 0x9c, 0xc8, 0x9d, 0x98, 0xa2, 0x78, 0xc0, 0x71, 0x65, 0x65, 0x51, 0x7e,
+  0x0d, 0xc0, 0x7f, 0xa5, 0x78, 0x7f, 0x51, 0x6f, 0x7d, 0xa3, 0x99, 0x59, 0x15, 0x60, 0x51, 0x42,
+  0x61, 0x41, 0xa1, 0xa8, 0xc1, 0xa3, 0x88, 0xa4, 0x98, 0xa4, 0x69, 0xa0, 0x58, 0x52, 0x66, 0xa2,
+  0x67, 0xa0, 0xb8, 0xa0, 0xb7, 0x7e, 0xa1, 0x59, 0x7f, 0x9f, 0x69, 0x9e, 0x49, 0xa4, 0xa8, 0x5a,
+  0x66, 0x32, 0x65, 0x3a, 0x99, 0xc6, 0x3c, 0xa2, 0x87, 0x66, 0x7a, 0x41, 0x62, 0x6e, 0xc0, 0x59,
+  0x2b, 0x65, 0xa6, 0x67, 0xa9, 0x2b, 0x32, 0x9d, 0x6a, 0xa4, 0x96, 0xfe, 0x9e, 0x17, 0x90, 0x99,
+  0x07, 0xa3, 0x88, 0x65, 0x6b, 0x09, 0x04, 0xc0, 0x09, 0x3c, 0x55, 0x6b, 0x7a, 0x3c, 0x5a, 0x61,
+  0xa2, 0x87, 0xae, 0x58, 0xa1, 0x5a, 0x9c, 0x69, 0x03, 0x6e, 0x17, 0x6e, 0x5a, 0x7f, 0xc0, 0x5a,
+  0x7e, 0xc0, 0x6b, 0x25, 0x19, 0x66, 0xc2, 0x0f, 0x14, 0xc0, 0x17, 0xc0, 0x14, 0x1c, 0x14, 0xc0,
+  0x6f, 0x28, 0x19, 0xc0, 0x20, 0xc0, 0x28, 0x66, 0x19, 0xc0, 0x20, 0x66, 0x20, 0xc0, 0x25, 0xc0,
+  0x2d, 0xa1, 0xb8, 0xa1, 0xa9, 0x9e, 0x69, 0x25, 0x7b, 0x2d, 0x7b, 0xa1, 0xb8, 0x0d, 0xa1, 0xa9,
+  0xc0, 0x59, 0x05, 0x5a, 0xa0, 0xa8, 0x05, 0x20, 0x1b, 0xc1, 0x0f, 0x1b, 0x66, 0xc0, 0x1b, 0xc0,
+  0x20, 0xc0, 0x6b, 0x20, 0xc1, 0x7b, 0x27, 0xc1, 0x20, 0x6f, 0xc3, 0x6e, 0xc1, 0x6b, 0x2c, 0x31,
+  0xc0, 0x2c, 0xc0, 0x31, 0xc1, 0x2f, 0x2c, 0xc0, 0x31, 0x2c, 0x2f, 0xc0, 0x2c, 0x31, 0x38, 0x2c,
+  0xc2, 0x31, 0xc0, 0x6e, 0x2c, 0xc3, 0x31, 0x6f, 0xc0, 0x38, 0x3d, 0xc0, 0x38, 0xc3, 0xfe, 0x14,
+  0x15, 0x69, 0xc0, 0x6f, 0x32, 0x3e, 0xc3, 0x32, 0x3e, 0xc8, 0x6e, 0xc4, 0x3e, 0xc0, 0x69, 0xc1,
+  0x32, 0x37, 0xc0, 0x32, 0xc0, 0x66, 0xc1, 0x69, 0x2d, 0xc0, 0x32, 0x03, 0xa2, 0x88, 0x6e, 0x7a,
+  0x4a, 0x66, 0xc2, 0x65, 0xc0, 0x03, 0x3e, 0xc1, 0x32, 0x2d, 0xc0, 0x26, 0xc5, 0x32, 0x37, 0xc0,
+  0x3e, 0x03, 0xc0, 0x08, 0xc2, 0x6b, 0xc0, 0x14, 0x1c, 0x19, 0xc3, 0x14, 0xc0, 0x08, 0xc0, 0x0f,
+  0x14, 0xc0, 0x1c, 0xc0, 0x5e, 0xa1, 0xb8, 0xa1, 0xa9, 0x56, 0x5a, 0xc0, 0x2c, 0x9d, 0xd8, 0x61,
+  0xa5, 0x79, 0x65, 0x9c, 0x99, 0x9b, 0xb8, 0x9d, 0xa7, 0xa2, 0x88, 0x6f, 0x5a, 0x65, 0xc0, 0xa2,
+  0x88, 0x55, 0xa3, 0x99, 0xa4, 0x78, 0x21, 0x7e, 0xa4, 0x68, 0xc0, 0x9a, 0xb9, 0x3c, 0x56, 0x56,
+  0xa3, 0x98, 0xa4, 0x77, 0x12, 0x1c, 0x29, 0xa4, 0x78, 0x51, 0xa2, 0x98, 0xa7, 0x89, 0x11, 0x10,
+  0x66, 0xc0, 0x26, 0xaf, 0x97, 0xa2, 0xa9, 0x92, 0x79, 0xa5, 0x69, 0x45, 0xa1, 0x9a, 0xa0, 0x48,
+  0x52, 0xa4, 0xc6, 0x95, 0xc8, 0x9d, 0xa8, 0xa2, 0x78, 0x10, 0x69, 0x66, 0x51, 0x66, 0x66, 0xc0,
+  0x2b, 0x6b, 0x64, 0xa9, 0x49, 0xa5, 0x3b, 0x9d, 0x99, 0x7e, 0xad, 0xf5, 0x93, 0xb8, 0x97, 0x8a,
+  0xa4, 0x77, 0x62, 0x69, 0x5a, 0xc0, 0x04, 0x3f, 0x3c, 0x55, 0xc1, 0x34, 0x6d, 0x62, 0xa4, 0x68,
+  0xa9, 0x68, 0xa4, 0x69, 0x9d, 0x5a, 0x46, 0x6b, 0xc0, 0x6e, 0x7e, 0x25, 0xc0, 0x20, 0x25, 0x19,
+  0x7b, 0x20, 0x66, 0x69, 0xc3, 0x0f, 0xc2, 0x69, 0x0f, 0xc0, 0x14, 0x23, 0x7a, 0x19, 0x20, 0x79,
+  0x14, 0xc1, 0x1b, 0x14, 0xc1, 0x0f, 0x14, 0xc6, 0x0f, 0x03, 0x0f, 0xc0, 0x20, 0x7e, 0xa2, 0x97,
+  0xc0, 0x5b, 0x5a, 0x3c, 0x7b, 0xc0, 0x9f, 0x68, 0x7b, 0x69, 0xc0, 0x7a, 0x46, 0xc7, 0x66, 0x20,
+  0xc1, 0x1b, 0xc3, 0x20, 0xc0, 0x2c, 0xc0, 0x31, 0xc1, 0x6b, 0x31, 0xc0, 0x2c, 0x27, 0x2c, 0xc1,
+  0x31, 0xc1, 0x2c, 0xc1, 0x31, 0xc0, 0x2c, 0x31, 0xc7, 0x2c, 0x38, 0xc3, 0x6e, 0xc0, 0x38, 0xc5,
+  0xfe, 0x14, 0x55, 0x66, 0xc3, 0x03, 0x3e, 0x69, 0x66, 0xc3, 0x66, 0xc3, 0x32, 0x2d, 0x6d, 0x32,
+  0x2d, 0x32, 0xc0, 0x2d, 0x69, 0xc0, 0x66, 0xc1, 0x66, 0x21, 0xc5, 0x69, 0x21, 0xc1, 0x26, 0x2b,
+  0x37, 0xc1, 0x03, 0xc0, 0x3e, 0xc1, 0x03, 0x3e, 0x03, 0xc1, 0x37, 0x32, 0xc1, 0x37, 0xc0, 0x32,
+  0x37, 0xc0, 0x03, 0xc0, 0x7f, 0x6e, 0xc1, 0x59, 0xc1, 0x6b, 0xc0, 0x65, 0x6b, 0x08, 0xc0, 0x14,
+  0xc5, 0x03, 0xc3, 0x37, 0x03, 0x08, 0x69, 0x03, 0xc0, 0x0d, 0xa2, 0xa8, 0x76, 0x6e, 0x55, 0xa0,
+  0xa8, 0x9e, 0xb9, 0x9c, 0x97, 0x9c, 0x97, 0xa2, 0x97, 0x5a, 0x05, 0x7e, 0xc0, 0x12, 0x76, 0x56,
+  0xa3, 0x88, 0xc0, 0x15, 0xa4, 0x78, 0xa2, 0x88, 0x9a, 0x89, 0x9c, 0xa8, 0xc0, 0x55, 0x08, 0x7f,
+  0x0d, 0x37, 0x6f, 0x08, 0xa8, 0x87, 0xc0, 0x21, 0xae, 0x76, 0x9c, 0x9a, 0x98, 0x99, 0x03, 0x79,
+  0x08, 0xa6, 0x87, 0xa5, 0x88, 0xa3, 0x89, 0xa2, 0x88, 0x99, 0xa9, 0xa3, 0x78, 0xa6, 0x68, 0x7e,
+  0x97, 0xc8, 0x94, 0x9a, 0xa3, 0x87, 0x6f, 0x66, 0x65, 0x55, 0x52, 0xc1, 0x6e, 0x76, 0x59, 0xa5,
+  0x78, 0xa6, 0x2b, 0x5b, 0xa7, 0xb6, 0xaa, 0xc6, 0x93, 0xc9, 0x38, 0xa2, 0x98, 0x66, 0x0c, 0x5a,
+  0x66, 0xc0, 0x3f, 0xc0, 0x37, 0x59, 0xc0, 0x37, 0x2d, 0xc0, 0x10, 0xa8, 0x19, 0xa2, 0x49, 0x62,
+  0x6f, 0x14, 0xc1, 0x66, 0x65, 0x6e, 0xc1, 0x03, 0xc1, 0x08, 0x0f, 0x03, 0xc0, 0x08, 0x0f, 0x08,
+  0xc0, 0x0f, 0xc2, 0x14, 0xc0, 0x6e, 0x7a, 0x27, 0x23, 0x14, 0x1c, 0x14, 0x0f, 0x14, 0x6b, 0x14,
+  0x0f, 0xc3, 0x14, 0xc0, 0x19, 0x6b, 0x19, 0x20, 0x1b, 0xc0, 0x19, 0x20, 0xc0, 0x6e, 0x6f, 0x66,
+  0xc0, 0x31, 0xc1, 0xa1, 0xc8, 0xa2, 0x87, 0x46, 0x7a, 0x9f, 0x69, 0x31, 0x2c, 0x31, 0xc0, 0x2c,
+  0xc4, 0x66, 0xc1, 0x2c, 0xc0, 0x27, 0xc1, 0x2c, 0x31, 0x6f, 0xc2, 0x66, 0x2c, 0x31, 0x2c, 0x27,
+  0xc2, 0x2c, 0xc0, 0x31, 0xc2, 0x2c, 0x31, 0xcb, 0x38, 0xc1, 0x31, 0xa3, 0xa9, 0x55, 0x31, 0x38,
+  0x31, 0xc1, 0x7b, 0x31, 0x2c, 0x27, 0xfe, 0x14, 0x35, 0xc3, 0x69, 0xc0, 0x66, 0x66, 0xc4, 0x66,
+  0x69, 0x6e, 0x21, 0x26, 0x21, 0xc0, 0x26, 0x21, 0xc3, 0x66, 0x69, 0xc1, 0x1c, 0xc0, 0x21, 0xc0,
+  0x26, 0xc0, 0x21, 0xc1, 0x1c, 0xc0, 0x26, 0xc2, 0x32, 0x37, 0x32, 0xc2, 0x3e, 0xc2, 0x6e, 0xc3,
+  0x6e, 0x6e, 0x7f, 0x56, 0xc1, 0x66, 0x08, 0x7f, 0x7e, 0xc1, 0x7a, 0xc0, 0x56, 0x59, 0x14, 0xc1,
+  0x0d, 0xc1, 0x08, 0xc0, 0x03, 0xc0, 0x08, 0xc3, 0x03, 0x69, 0x37, 0x65, 0x32, 0x37, 0x32, 0xc0,
+  0x2b, 0xa2, 0x88, 0xa2, 0x88, 0x75, 0x6f, 0x13, 0x9e, 0xc8, 0x9d, 0xb9, 0x9f, 0x96, 0x61, 0x7f,
+  0x0d, 0x66, 0x69, 0x08, 0xc1, 0x7a, 0x08, 0x0d, 0x7e, 0xa2, 0x89, 0x1c, 0x9d, 0x98, 0x66, 0x3c,
+  0xa5, 0x88, 0x62, 0x3c, 0x9d, 0x98, 0xc0, 0x6b, 0x6e, 0xa3, 0x98, 0x29, 0xa4, 0x88, 0x6f, 0xa9,
+  0x87, 0x9a, 0x99, 0x99, 0x99, 0x1f, 0x0b, 0x37, 0x45, 0xa6, 0x87, 0x7b, 0xa4, 0x88, 0x38, 0xa5,
+  0x97, 0xa6, 0xa7, 0x92, 0x7a, 0x9c, 0x78, 0x04, 0x7a, 0x56, 0x69, 0x66, 0x56, 0xc0, 0x30, 0xc1,
+  0x65, 0xac, 0x78, 0xb0, 0x67, 0xa1, 0xa8, 0x9c, 0xa9, 0x97, 0x99, 0x93, 0x99, 0xa2, 0x67, 0x66,
+  0x7a, 0x0c, 0xc0, 0x04, 0x6e, 0x01, 0xc0, 0x3c, 0x55, 0x6b, 0x2d, 0x67, 0xa6, 0x77, 0xa7, 0x39,
+  0x14, 0xc0, 0x6e, 0x14, 0x7e, 0x6e, 0xa1, 0xa9, 0x52, 0x14, 0xc0, 0x17, 0x56, 0xc0, 0x14, 0x0f,
+  0x14, 0x0f, 0xc1, 0x03, 0x0f, 0xc0, 0x03, 0xc0, 0x6e, 0x14, 0x0f, 0xc0, 0x26, 0x65, 0x14, 0xa2,
+  0xa8, 0x26, 0x14, 0xc5, 0x0f, 0xc0, 0x14, 0xc0, 0x6f, 0xc1, 0xa2, 0x77, 0x66, 0x6f, 0x66, 0x76,
+  0x25, 0xc0, 0x20, 0x66, 0x20, 0xc1, 0x7a, 0x19, 0xc0, 0x14, 0x17, 0x6b, 0x1b, 0x17, 0x1b, 0x0f,
+  0xc0, 0x6b, 0x1b, 0xc0, 0x14, 0xc0, 0x1b, 0xc0, 0x14, 0xc0, 0x1b, 0xc1, 0x16, 0xc0, 0x1b, 0xc0,
+  0x14, 0x20, 0x2c, 0x31, 0xc0, 0x2c, 0x66, 0xc0, 0x2c, 0xc0, 0x27, 0xc0, 0x2c, 0xc5, 0x31, 0x2c,
+  0xc0, 0x27, 0x2c, 0x31, 0x6b, 0x31, 0xc7, 0x2c, 0x31, 0xc0, 0xa1, 0xa9, 0x69, 0x31, 0x6e, 0x38,
+  0x31, 0xc3, 0x38, 0xfe, 0x14, 0x14, 0x6f, 0xc1, 0x6e, 0x3e, 0xc0, 0x03, 0xc1, 0x3e, 0xc0, 0x32,
+  0x3e, 0x32, 0xc0, 0x66, 0xc2, 0x69, 0xc0, 0x66, 0x26, 0x21, 0xcd, 0x69, 0x66, 0xc0, 0x21, 0x26,
+  0xc0, 0x32, 0x6e, 0xc0, 0x32, 0x37, 0xc0, 0x3e, 0xc0, 0x03, 0xc1, 0x6f, 0xc1, 0x6e, 0x76, 0x59,
+  0x14, 0x75, 0x03, 0x08, 0x03, 0x37, 0xc1, 0x6e, 0x03, 0xc0, 0x37, 0x7a, 0xc0, 0x6e, 0x03, 0x3e,
+  0x32, 0x2d, 0x32, 0xc4, 0x37, 0x08, 0xc1, 0x03, 0xc0, 0x37, 0xc0, 0x3a, 0xc0, 0x3c, 0x3a, 0x37,
+  0xc0, 0x7f, 0xa4, 0x87, 0x7e, 0x51, 0x66, 0x9a, 0xd6, 0x9d, 0xa9, 0x7e, 0x7e, 0x67, 0x50, 0x6e,
+  0x3c, 0xc0, 0x6f, 0x01, 0xc0, 0x0d, 0xc0, 0x7f, 0x7a, 0x51, 0x9d, 0x88, 0x6e, 0x7b, 0xa5, 0x88,
+  0x3c, 0x28, 0x7a, 0x28, 0x66, 0xc0, 0x55, 0xc0, 0x0b, 0xab, 0x88, 0xa6, 0x78, 0xa2, 0x77, 0xa4,
+  0x88, 0x92, 0x99, 0x95, 0xa9, 0xc1, 0x52, 0x68, 0xa2, 0x88, 0xa2, 0x98, 0xa3, 0x88, 0xa2, 0x88,
+  0x07, 0x9d, 0x99, 0x7f, 0x5d, 0xc1, 0x6b, 0x30, 0x2b, 0x30, 0xc1, 0x65, 0xb0, 0x87, 0xa9, 0x98,
+  0x97, 0x9a, 0x34, 0x9b, 0x99, 0x7e, 0x6f, 0x55, 0xc0, 0x07, 0x5e, 0x66, 0x07, 0x04, 0x3c, 0xc0,
+  0x55, 0x28, 0x5a, 0xa9, 0x58, 0xa4, 0x59, 0x9e, 0x5a, 0x6f, 0x08, 0x6e, 0x14, 0x6e, 0x7b, 0xa1,
+  0xa8, 0x56, 0x19, 0x7f, 0x6b, 0x55, 0x14, 0xa2, 0x78, 0x20, 0xc0, 0x28, 0xc0, 0x23, 0x28, 0x20,
+  0x14, 0xc0, 0x66, 0x14, 0xc0, 0x23, 0x14, 0x19, 0x25, 0xc0, 0xa3, 0xc8, 0x9f, 0x69, 0x25, 0x20,
+  0x14, 0xc2, 0x0f, 0x14, 0x0f, 0x14, 0xc0, 0x19, 0xc0, 0x20, 0xc1, 0x25, 0x20, 0x66, 0xc1, 0x0f,
+  0xc0, 0x1b, 0x20, 0x25, 0xc0, 0x20, 0xc0, 0x19, 0xc0, 0x1b, 0x14, 0x19, 0x0f, 0xc1, 0x14, 0x62,
+  0xc3, 0x0f, 0x0a, 0x03, 0x0a, 0xc0, 0x0f, 0x0a, 0xc4, 0x1b, 0xa2, 0x78, 0x20, 0x6b, 0xc0, 0x2c,
+  0x6e, 0xc0, 0x27, 0x2c, 0x31, 0x2c, 0x7e, 0xc0, 0x31, 0xc1, 0x6b, 0xc0, 0x6e, 0xc0, 0x31, 0xc1,
+  0x38, 0x31, 0xc4, 0x38, 0x31, 0xc0, 0x38, 0x7a, 0x38, 0xc0, 0xa2, 0x77, 0x7a, 0x3d, 0xc1, 0x38,
+  0xc0, 0x3d, 0x38, 0xfe, 0x14, 0x35, 0xc1, 0x69, 0xc3, 0x6f, 0x69, 0x3e, 0x37, 0x3e, 0xc2, 0x65,
+  0x66, 0xc2, 0x32, 0x65, 0xc2, 0x66, 0xc6, 0x66, 0x21, 0x69, 0x66, 0xc0, 0x21, 0x1c, 0xc0, 0x21,
+  0xa2, 0x77, 0x26, 0x32, 0x03, 0xc0, 0x32, 0x37, 0x3e, 0x03, 0xc0, 0x3e, 0xc0, 0x03, 0x6e, 0x03,
+  0xc1, 0x37, 0xc3, 0x32, 0xc0, 0x37, 0xc3, 0x32, 0xc0, 0x26, 0xc0, 0x32, 0xc0, 0x26, 0xc4, 0x2d,
+  0x32, 0x03, 0xa2, 0x78, 0xc1, 0x3e, 0x32, 0xc2, 0xa2, 0x87, 0x6f, 0x66, 0x03, 0x3f, 0x06, 0xa2,
+  0x67, 0xa2, 0x98, 0x66, 0x4b, 0x9d, 0xe7, 0x99, 0xe7, 0x5a, 0x7e, 0xc0, 0x62, 0x69, 0x66, 0x3c,
+  0x7f, 0x6e, 0x3c, 0xc0, 0x08, 0xc0, 0x10, 0x6e, 0x3c, 0x37, 0x3c, 0x55, 0x66, 0xc0, 0x37, 0x28,
+  0x66, 0x28, 0x23, 0x28, 0xc0, 0x23, 0xa5, 0x98, 0xa2, 0x78, 0xa2, 0x88, 0xaf, 0x78, 0x97, 0x99,
+  0x0d, 0x08, 0x2d, 0x6b, 0x37, 0xc0, 0x13, 0xa2, 0x88, 0x9d, 0x98, 0xc0, 0x41, 0x66, 0x7e, 0x6e,
+  0x6b, 0x30, 0x69, 0x30, 0xc0, 0x2b, 0xc0, 0x3f, 0xa3, 0x88, 0x65, 0x07, 0xa3, 0x97, 0x5a, 0x1c,
+  0x57, 0x0c, 0x65, 0x07, 0x5a, 0xc1, 0x3c, 0x3f, 0x07, 0x2b, 0x34, 0xa6, 0x48, 0xa6, 0x48, 0x9e,
+  0x6a, 0xc2, 0x66, 0xc0, 0x6b, 0x6e, 0xc2, 0x6e, 0x6e, 0x14, 0xc0, 0x19, 0xc1, 0x20, 0x14, 0xc0,
+  0x20, 0x19, 0xc0, 0x14, 0x19, 0x14, 0x7f, 0xc1, 0x6e, 0x20, 0xc0, 0x28, 0xc0, 0x20, 0xc1, 0x66,
+  0x14, 0xc3, 0x1b, 0x20, 0x6e, 0xc1, 0x6b, 0x25, 0xc0, 0x20, 0x25, 0xc2, 0x2c, 0xc5, 0x6e, 0xc3,
+  0x7a, 0x7e, 0x34, 0x31, 0x2c, 0x66, 0xc0, 0x20, 0x27, 0x20, 0x1b, 0xc9, 0x20, 0x2c, 0x27, 0xc1,
+  0x2c, 0xc1, 0xa2, 0x78, 0x31, 0xc0, 0x7e, 0x7f, 0x3d, 0xc0, 0x31, 0xc0, 0x2c, 0x31, 0xc0, 0x39,
+  0x34, 0x66, 0x34, 0xc0, 0x31, 0xc1, 0x6b, 0x31, 0xc0, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0xc0, 0x38,
+  0x3d, 0x31, 0xc0, 0x7f, 0x34, 0xc0, 0x31, 0x38, 0x2c, 0xfe, 0x13, 0xf4, 0x69, 0xc0, 0x66, 0xc0,
+  0x66, 0xc0, 0x21, 0xc1, 0x26, 0xc0, 0x6f, 0xc2, 0x6f, 0x32, 0xc2, 0x69, 0x26, 0xc3, 0x21, 0xc1,
+  0x1c, 0xc0, 0x21, 0xc0, 0x1c, 0xc0, 0x21, 0xc0, 0x26, 0xc1, 0x32, 0xc0, 0x6e, 0xc0, 0x6f, 0x6e,
+  0x03, 0x3e, 0xc0, 0x03, 0xc0, 0x3e, 0xc0, 0x32, 0x37, 0xc0, 0x32, 0xc2, 0x2d, 0x26, 0xc6, 0x2b,
+  0xc0, 0x26, 0xc0, 0x21, 0xc0, 0x26, 0xc1, 0x2d, 0x37, 0xc0, 0x03, 0xc0, 0x08, 0x6e, 0xc1, 0x03,
+  0x3e, 0x37, 0x32, 0x26, 0x2b, 0x37, 0x7e, 0xa2, 0x88, 0xc0, 0x56, 0x13, 0x66, 0x0b, 0x69, 0x3e,
+  0x08, 0xfe, 0x3b, 0xd1, 0x9c, 0xb8, 0x5a, 0x79, 0x5a, 0x66, 0x7a, 0xc0, 0x3c, 0x7f, 0xc0, 0x39,
+  0xc0, 0x3c, 0xc0, 0x6f, 0x3c, 0x34, 0xa3, 0x98, 0x6e, 0x08, 0x39, 0x62, 0x69, 0xc2, 0x66, 0x28,
+  0xc0, 0x34, 0x28, 0x37, 0xc1, 0x10, 0xc0, 0xa3, 0x89, 0x15, 0x37, 0xc0, 0x65, 0xa4, 0x77, 0x7f,
+  0x9c, 0x88, 0x3c, 0x2b, 0xc0, 0x30, 0x7f, 0xc0, 0x2b, 0x69, 0x30, 0xc1, 0x2b, 0xc0, 0xa3, 0x98,
+  0xa2, 0x88, 0x69, 0x6e, 0x1b, 0x14, 0x07, 0xc0, 0x5a, 0xc1, 0x5a, 0xc0, 0x65, 0x37, 0xa3, 0x97,
+  0xa3, 0x59, 0xa3, 0x4a, 0x4b, 0x56, 0x6f, 0x66, 0xc0, 0x03, 0xc2, 0x6f, 0x6e, 0xc1, 0x6e, 0x14,
+  0x19, 0x6b, 0x19, 0xc1, 0x20, 0xc1, 0x6e, 0xc3, 0x20, 0x19, 0x14, 0x7f, 0xc0, 0x56, 0x20, 0x25,
+  0x20, 0x25, 0x6e, 0x7b, 0x65, 0x2a, 0x25, 0x2a, 0x6b, 0xc5, 0x66, 0x31, 0x25, 0x2c, 0x31, 0x2c,
+  0xc6, 0x31, 0xc2, 0x2c, 0xc0, 0x25, 0xc0, 0x7b, 0x25, 0xc0, 0x2c, 0x25, 0x2c, 0x25, 0x2c, 0x25,
+  0x2c, 0x31, 0x2c, 0xc1, 0x31, 0xc0, 0x2c, 0x31, 0xc0, 0x2c, 0xc1, 0x31, 0x2c, 0xc0, 0x6f, 0xc0,
+  0x31, 0xc1, 0x2c, 0x2f, 0x34, 0x2c, 0xc1, 0x20, 0xc0, 0x1b, 0xc0, 0x28, 0x34, 0x25, 0x2c, 0xc2,
+  0x31, 0xc1, 0x2c, 0x31, 0x2c, 0xa2, 0x98, 0xc0, 0x2c, 0x31, 0x6f, 0xc0, 0x31, 0xc3, 0x3d, 0xc1,
+  0xfe, 0x13, 0xb3, 0xc1, 0x69, 0x66, 0xc1, 0x15, 0x6f, 0xc4, 0x6e, 0x6b, 0xc0, 0x6e, 0xcd, 0x6e,
+  0xc0, 0x6b, 0x6e, 0xc0, 0x6e, 0x03, 0xc1, 0x08, 0xc0, 0x6b, 0xc0, 0x6e, 0xc0, 0x03, 0xc2, 0x3e,
+  0x37, 0x32, 0xc1, 0x69, 0xc1, 0x26, 0xc1, 0x21, 0xc5, 0x26, 0xc2, 0x21, 0xc1, 0x26, 0x32, 0x37,
+  0x03, 0x0f, 0x14, 0x6e, 0x14, 0xc0, 0x08, 0x37, 0xc0, 0x32, 0xc0, 0x7e, 0x32, 0x2b, 0x32, 0x37,
+  0x7e, 0xa2, 0xa8, 0x46, 0xc0, 0x69, 0x5b, 0x66, 0x37, 0x08, 0x9e, 0xc7, 0x9a, 0xe7, 0x51, 0x6f,
+  0x34, 0xc0, 0x69, 0x34, 0x7e, 0xc1, 0x66, 0x55, 0x34, 0x3c, 0xc1, 0x34, 0x55, 0xa5, 0x89, 0xa2,
+  0x98, 0x08, 0x28, 0xc0, 0x66, 0x28, 0x23, 0xc0, 0x28, 0xc0, 0x23, 0x28, 0x37, 0xc2, 0x3c, 0xc0,
+  0xa2, 0x88, 0x65, 0x51, 0x66, 0x30, 0xa3, 0x88, 0xc0, 0x51, 0x30, 0x2b, 0xc0, 0x7f, 0x30, 0xc0,
+  0x2b, 0x66, 0x2b, 0x2d, 0x65, 0x2b, 0xa2, 0x88, 0xa2, 0x87, 0x7e, 0x6e, 0xc0, 0x0c, 0xc0, 0x04,
+  0x09, 0xc0, 0x04, 0xc0, 0x3f, 0x3c, 0x52, 0xa5, 0x77, 0xa6, 0x68, 0xa1, 0x4a, 0x9e, 0x69, 0x66,
+  0xc3, 0x3e, 0xc0, 0x37, 0x3e, 0x03, 0xc2, 0x6f, 0xc1, 0x6e, 0xc0, 0x6e, 0x6f, 0x66, 0xc5, 0x25,
+  0x20, 0x25, 0xc0, 0x7a, 0x25, 0xc0, 0x6e, 0x7f, 0xc0, 0x6e, 0xc0, 0x39, 0xc0, 0x6f, 0x55, 0x66,
+  0xc2, 0x66, 0xc0, 0x31, 0xc0, 0x2c, 0x31, 0x2c, 0xc1, 0x20, 0xc4, 0x2c, 0x20, 0xc3, 0x66, 0x14,
+  0xc3, 0x0f, 0x14, 0x0f, 0x7e, 0xc0, 0x0f, 0x1b, 0xc0, 0x20, 0x1b, 0x20, 0x6b, 0xc0, 0x20, 0x27,
+  0xc0, 0x20, 0x27, 0x2c, 0xc1, 0x27, 0x2c, 0xc1, 0x25, 0x1b, 0x27, 0x20, 0x1b, 0xc0, 0x20, 0x1b,
+  0x20, 0x7f, 0x20, 0xc0, 0x1b, 0x20, 0xc0, 0x2c, 0x31, 0xc3, 0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0xa1,
+  0xa9, 0x59, 0x2c, 0x31, 0x6b, 0x6e, 0x31, 0xc6, 0xfe, 0x13, 0xb2, 0x6b, 0x15, 0xc0, 0x66, 0xc1,
+  0x15, 0x1c, 0x6e, 0xc0, 0x6f, 0xc0, 0x69, 0x2d, 0xc0, 0x6e, 0xc0, 0x6f, 0xc2, 0x6e, 0xc0, 0x6e,
+  0xc5, 0x6e, 0x6b, 0xc1, 0x6e, 0x14, 0xc0, 0x66, 0x03, 0xc0, 0x08, 0xc0, 0x0f, 0xc0, 0x14, 0xc0,
+  0x08, 0xc3, 0x03, 0x3e, 0xc1, 0x69, 0xc1, 0x32, 0x26, 0xc2, 0x21, 0xc7, 0x2d, 0x32, 0x3e, 0x03,
+  0x08, 0xc0, 0x0d, 0xc0, 0x08, 0x03, 0x37, 0x32, 0xc0, 0x26, 0x32, 0x69, 0xc0, 0x32, 0x2b, 0x32,
+  0xc0, 0x2b, 0x37, 0xa2, 0x98, 0x5a, 0xc0, 0x6d, 0x63, 0x59, 0x03, 0x9f, 0xc7, 0x9b, 0xe7, 0x61,
+  0x5a, 0x66, 0x56, 0x7d, 0xc0, 0x66, 0x3c, 0xc0, 0x66, 0x34, 0x28, 0x34, 0x39, 0x3c, 0x65, 0x37,
+  0x39, 0xc0, 0x7f, 0x9d, 0x99, 0x28, 0xc0, 0x56, 0x7a, 0xc1, 0x28, 0xc1, 0x37, 0xa2, 0x88, 0xc0,
+  0x3c, 0x30, 0xa2, 0x88, 0x66, 0x30, 0x28, 0x7a, 0x30, 0x3f, 0x04, 0x3c, 0x69, 0x3c, 0x30, 0x3c,
+  0x2b, 0xc0, 0x30, 0x28, 0x75, 0x6b, 0x59, 0xc0, 0x30, 0xa3, 0x98, 0xc1, 0x7e, 0x0c, 0xc0, 0x66,
+  0xc0, 0x04, 0xc0, 0x35, 0x3f, 0x5e, 0x28, 0xa6, 0x67, 0xa7, 0x59, 0x9e, 0x6a, 0x9e, 0x69, 0xc1,
+  0x7b, 0x37, 0xc1, 0x3e, 0xc1, 0x03, 0x6e, 0x6f, 0xc0, 0x19, 0x6b, 0xc0, 0x7a, 0x20, 0x6e, 0xc0,
+  0x69, 0x14, 0xc0, 0x0f, 0xc1, 0x14, 0xc1, 0x6b, 0x20, 0x19, 0x7f, 0xc0, 0x25, 0x6e, 0x6b, 0xc1,
+  0x25, 0x2a, 0x7a, 0x67, 0x31, 0xc7, 0x25, 0xc1, 0x20, 0xc5, 0x1b, 0x20, 0x1b, 0xc3, 0x20, 0xc1,
+  0x2f, 0x23, 0x1b, 0xc0, 0x20, 0xc0, 0x2f, 0x6e, 0x25, 0xc0, 0x31, 0xc0, 0x34, 0x56, 0xc0, 0x31,
+  0x2c, 0xc0, 0x20, 0xc8, 0x6b, 0xc0, 0x20, 0x1b, 0x20, 0x27, 0x1b, 0xc0, 0x2f, 0x2c, 0xc5, 0x31,
+  0xc1, 0x2c, 0x27, 0xc1, 0x2c, 0xc1, 0x27, 0xc0, 0x2c, 0xc2, 0x6f, 0x31, 0xc3, 0x2c, 0xc0, 0xfe,
+  0x14, 0x14, 0xc1, 0x66, 0x69, 0xc0, 0x66, 0x26, 0x2d, 0xc0, 0x32, 0x6e, 0x6b, 0xc4, 0x6e, 0xc1,
+  0x6e, 0xc1, 0x03, 0xc1, 0x37, 0xc0, 0x3e, 0x37, 0xc0, 0x32, 0xc1, 0x37, 0xc3, 0x6e, 0x03, 0x08,
+  0x6b, 0x08, 0x6e, 0x08, 0x03, 0xc0, 0x3e, 0xc5, 0x03, 0x3e, 0xc1, 0x32, 0xc0, 0x37, 0xc0, 0x32,
+  0x37, 0x32, 0x37, 0xc1, 0x03, 0x3e, 0x7e, 0x03, 0x08, 0x6f, 0x0d, 0x08, 0x3e, 0x37, 0xc3, 0x32,
+  0xc0, 0x37, 0xc0, 0x65, 0x26, 0xc4, 0x32, 0x37, 0x7a, 0xa2, 0x88, 0xc0, 0x06, 0x3c, 0xc0, 0xfe,
+  0x3b, 0x90, 0x9e, 0xb7, 0x4b, 0x69, 0x66, 0x56, 0x79, 0x6b, 0x28, 0x6e, 0x34, 0x2f, 0xc0, 0x5e,
+  0x34, 0x39, 0x34, 0x7a, 0xc0, 0x34, 0xc0, 0x2f, 0x59, 0x66, 0x7a, 0x28, 0x20, 0x23, 0x28, 0xc0,
+  0x23, 0x28, 0x37, 0x6e, 0xc1, 0x65, 0xc0, 0x66, 0xc3, 0x3c, 0x69, 0x2d, 0x30, 0xc0, 0x35, 0x30,
+  0x35, 0x30, 0x62, 0x2b, 0x26, 0x55, 0x26, 0xc0, 0x5d, 0xa2, 0x98, 0x7f, 0xc0, 0x6e, 0xc0, 0x07,
+  0xc1, 0x3c, 0xc2, 0x2d, 0xa3, 0x89, 0xa8, 0x48, 0x9d, 0x4b, 0x65, 0x32, 0x37, 0xc1, 0x7e, 0x67,
+  0x3e, 0x03, 0x14, 0xc0, 0x6e, 0x6e, 0x6b, 0xc0, 0x6e, 0xc0, 0x25, 0xc5, 0x66, 0xc0, 0x25, 0xc1,
+  0x20, 0x25, 0xc2, 0x20, 0x25, 0x6f, 0xc3, 0x66, 0xc0, 0x25, 0xc0, 0x2c, 0x31, 0xce, 0x2c, 0x31,
+  0x2c, 0x31, 0x2c, 0x31, 0xc1, 0x25, 0x31, 0xc1, 0x7a, 0x2c, 0xc0, 0x31, 0x2c, 0xc1, 0x31, 0x2c,
+  0xc0, 0x25, 0x31, 0x34, 0x66, 0x2c, 0xc0, 0x25, 0x2c, 0xc0, 0x20, 0xc2, 0x2c, 0xc1, 0x66, 0xc0,
+  0x2c, 0xc6, 0x27, 0x2c, 0xc4, 0x27, 0xc9, 0x2c, 0xc0, 0x27, 0xc0, 0x2c, 0x31, 0x6b, 0x31, 0xc5,
+  0xfe, 0x14, 0x14, 0x6f, 0xc1, 0x66, 0xc2, 0x6d, 0xc0, 0x3e, 0xc4, 0x32, 0x37, 0x32, 0xc1, 0x37,
+  0xc0, 0x32, 0xc1, 0x66, 0x32, 0xc7, 0x2d, 0xc1, 0x32, 0xc1, 0x3e, 0xc0, 0x6e, 0xc0, 0x3e, 0xc2,
+  0x37, 0x32, 0xc2, 0x37, 0xc2, 0x3e, 0xc0, 0x03, 0xc0, 0x6e, 0xc0, 0x6b, 0xc0, 0x6e, 0xc2, 0x08,
+  0x03, 0x3e, 0x6d, 0x37, 0x32, 0x69, 0x32, 0xc0, 0x37, 0xc2, 0x2b, 0xc1, 0x66, 0xc4, 0x66, 0x2b,
+  0x32, 0x2b, 0x7f, 0xa1, 0xa8, 0x3a, 0x32, 0xc0, 0x9e, 0xb8, 0x9c, 0xe6, 0x5a, 0x69, 0x56, 0xc1,
+  0x65, 0x7b, 0x69, 0xc0, 0x2f, 0x5a, 0x25, 0xc0, 0x7f, 0x39, 0x76, 0xc0, 0x34, 0xc0, 0x69, 0x28,
+  0x56, 0xc0, 0x7a, 0x28, 0x25, 0x20, 0x28, 0xc0, 0x23, 0x56, 0x28, 0x37, 0x39, 0x37, 0xc1, 0x28,
+  0xc0, 0x7a, 0x6e, 0x51, 0x30, 0x6f, 0x28, 0x2d, 0xc0, 0x30, 0xc0, 0x3c, 0x30, 0x2b, 0xc0, 0x28,
+  0xa2, 0x87, 0x30, 0x2b, 0x66, 0x6d, 0xa2, 0x88, 0x7b, 0x6e, 0x6e, 0x07, 0x38, 0x6b, 0x37, 0x39,
+  0xc0, 0x3c, 0xa3, 0x79, 0xab, 0x28, 0x9d, 0x6b, 0x9d, 0x99, 0x7d, 0x3e, 0x03, 0x08, 0xc0, 0xa2,
+  0x89, 0xc0, 0x59, 0x6e, 0x6b, 0xc0, 0x66, 0x19, 0x14, 0xc2, 0x25, 0x6e, 0xc2, 0x6f, 0xc0, 0x66,
+  0x25, 0x20, 0x14, 0x20, 0x14, 0xc2, 0x20, 0xc2, 0x25, 0x31, 0xc1, 0x7a, 0x25, 0x2a, 0x25, 0xc0,
+  0x31, 0x25, 0x31, 0xc1, 0x66, 0x31, 0x7e, 0x36, 0x6f, 0x36, 0xc1, 0x31, 0x2c, 0x31, 0xc3, 0x2c,
+  0x31, 0xc0, 0x39, 0x34, 0x25, 0xc1, 0x20, 0x25, 0xc1, 0x20, 0xc3, 0x66, 0xc1, 0x66, 0x1b, 0xc2,
+  0x20, 0x6b, 0xc0, 0x2c, 0xc1, 0x31, 0xc3, 0x2c, 0xc1, 0x31, 0x27, 0x2c, 0xc1, 0x27, 0xc3, 0x20,
+  0xc0, 0x27, 0x20, 0xc0, 0x27, 0xc2, 0x7e, 0x2c, 0x27, 0x20, 0x27, 0x2c, 0xc1, 0x31, 0xc0, 0x6b,
+  0x31, 0xc0, 0x38, 0x31, 0xc2, 0xfe, 0x13, 0xf4, 0xc0, 0x69, 0x2d, 0xc1, 0x6e, 0xc2, 0x2d, 0x26,
+  0xc1, 0x32, 0xc6, 0x6e, 0xc0, 0x6f, 0xc2, 0x66, 0x37, 0x32, 0xc3, 0x37, 0x32, 0xc2, 0x3e, 0x37,
+  0xc0, 0x03, 0xc1, 0x3e, 0x37, 0x03, 0xc0, 0x3e, 0xc0, 0x03, 0xc2, 0x69, 0xc0, 0x03, 0xc3, 0x6e,
+  0xc0, 0x03, 0x3e, 0xc1, 0x37, 0x32, 0x26, 0xc0, 0x2d, 0x6d, 0xc0, 0x26, 0xc0, 0x66, 0x26, 0xc1,
+  0x21, 0x26, 0x21, 0xc0, 0x26, 0xc2, 0x32, 0xc1, 0x37, 0xc0, 0x3c, 0xc0, 0x08, 0x75, 0x66, 0x37,
+  0xc0, 0x9b, 0xe8, 0x9f, 0xc7, 0x56, 0x55, 0x7a, 0xc0, 0x55, 0xc1, 0x66, 0x25, 0x6b, 0x25, 0xc0,
+  0x6e, 0x34, 0x69, 0xc0, 0x66, 0xc2, 0x20, 0x65, 0x20, 0x7a, 0x20, 0x23, 0x20, 0x66, 0x23, 0xc0,
+  0x1b, 0x28, 0xa2, 0x88, 0x34, 0x28, 0x7a, 0xc0, 0x6e, 0x28, 0x2b, 0x28, 0x2b, 0x30, 0xc0, 0x2d,
+  0xc1, 0x28, 0xc0, 0x3c, 0x30, 0xc0, 0x23, 0x30, 0xa3, 0x98, 0x28, 0x2b, 0xc0, 0x23, 0x6d, 0xa1,
+  0xa9, 0x6f, 0x0c, 0x56, 0x30, 0xc0, 0x2d, 0x6e, 0x2b, 0xa5, 0x59, 0xa9, 0x29, 0xa0, 0x5a, 0x62,
+  0x7d, 0xc0, 0x56, 0x6e, 0xc0, 0xa2, 0x78, 0xc3, 0x25, 0xc0, 0x2a, 0xc0, 0x25, 0x76, 0x14, 0xc0,
+  0x19, 0xc0, 0x6b, 0xc1, 0x25, 0x2a, 0x6f, 0x66, 0x25, 0x20, 0x19, 0x14, 0xc2, 0x66, 0x14, 0xc0,
+  0x7a, 0x20, 0x25, 0xc1, 0x7a, 0x25, 0x20, 0xc0, 0x25, 0x20, 0xc1, 0x25, 0xc1, 0x31, 0x36, 0xc4,
+  0x31, 0xc0, 0x66, 0x31, 0xc1, 0x2c, 0xc1, 0x31, 0x7a, 0xc0, 0x2c, 0xc5, 0x31, 0x2c, 0x31, 0xc5,
+  0x2c, 0x31, 0xc2, 0x2c, 0xc1, 0x25, 0x2c, 0x31, 0xc0, 0x2c, 0xc6, 0x66, 0x20, 0x2c, 0x27, 0x20,
+  0xc0, 0x27, 0xc0, 0x20, 0xc2, 0x27, 0x2c, 0xc0, 0x27, 0xc0, 0x2c, 0xc0, 0x20, 0x2c, 0x27, 0xc0,
+  0x2c, 0xc0, 0x31, 0xc1, 0x6b, 0xc0, 0x31, 0xc1, 0x2c, 0xc0, 0xfe, 0x13, 0xd3, 0xc0, 0x6e, 0xc1,
+  0x21, 0xc7, 0x26, 0xc0, 0x6e, 0x6b, 0xc1, 0x6f, 0xc0, 0x6e, 0x6e, 0x3e, 0xc0, 0x69, 0x32, 0x37,
+  0x32, 0xc3, 0x37, 0xc1, 0x32, 0x37, 0x6e, 0x03, 0xc0, 0x08, 0x6f, 0xc0, 0x08, 0xc3, 0x03, 0xc5,
+  0x3e, 0xc0, 0x03, 0x3e, 0xc0, 0x37, 0x32, 0xc4, 0x2b, 0x26, 0xc2, 0x6b, 0xc1, 0x26, 0x32, 0xc1,
+  0x37, 0xc5, 0x3e, 0x03, 0x08, 0xc0, 0x6e, 0xc0, 0x14, 0x6e, 0xc2, 0x7a, 0x0d, 0x19, 0xfe, 0x33,
+  0xd1, 0x9b, 0xc8, 0x5a, 0x34, 0xc0, 0x66, 0x56, 0x69, 0x6e, 0xc4, 0x7a, 0x34, 0xc0, 0x28, 0xc0,
+  0x20, 0x7a, 0x20, 0xc0, 0x66, 0x20, 0x23, 0x1b, 0x69, 0x6e, 0x14, 0xc0, 0x20, 0x23, 0xa2, 0x88,
+  0x34, 0x28, 0x23, 0x28, 0x7a, 0x37, 0x23, 0x69, 0xc0, 0x28, 0xa2, 0x88, 0x55, 0xc0, 0x28, 0xc2,
+  0x2d, 0x7a, 0x28, 0xc0, 0x30, 0x2b, 0x23, 0x28, 0xc0, 0x2b, 0x1c, 0x2b, 0xa2, 0x87, 0x6f, 0x3c,
+  0x34, 0xc1, 0x28, 0xa4, 0x68, 0xa8, 0x19, 0xa1, 0x6a, 0x08, 0x6f, 0x66, 0x08, 0x0f, 0xc0, 0x14,
+  0x19, 0xc0, 0x14, 0xc1, 0x19, 0x14, 0x0f, 0xc0, 0x14, 0xc0, 0x19, 0x6b, 0xc0, 0x19, 0x20, 0x6e,
+  0xc4, 0x6e, 0xc2, 0x25, 0x2a, 0x25, 0xc0, 0x20, 0x79, 0xa2, 0x89, 0x2a, 0x6b, 0x25, 0xc1, 0x20,
+  0xc6, 0x25, 0xc0, 0x20, 0xc0, 0x25, 0xc0, 0x7f, 0xc0, 0x25, 0x31, 0x2a, 0xc0, 0x25, 0xc2, 0x6b,
+  0x25, 0x31, 0x2a, 0x2c, 0x31, 0xc3, 0x2c, 0x31, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0x2c, 0x31, 0xc5,
+  0x2c, 0xc0, 0x31, 0x25, 0x20, 0x34, 0x2c, 0xc1, 0x31, 0x2c, 0xc2, 0x25, 0x2c, 0x66, 0x20, 0xc4,
+  0x27, 0x20, 0xc1, 0x2c, 0x20, 0x2c, 0x27, 0xc9, 0x2c, 0xc1, 0x34, 0xc0, 0x20, 0x2c, 0x27, 0x2c,
+  0xc0, 0xfe, 0x13, 0xd3, 0xc0, 0x6e, 0xc1, 0x21, 0xc2, 0x26, 0xc1, 0x6f, 0xc1, 0x6f, 0xc0, 0x32,
+  0x3e, 0xc3, 0x32, 0xc0, 0x66, 0xc1, 0x32, 0xc0, 0x6e, 0xc1, 0x6f, 0x6e, 0xc0, 0x03, 0xc0, 0x08,
+  0xc0, 0x6e, 0x08, 0x6b, 0x6e, 0xc0, 0x03, 0xc2, 0x08, 0x0f, 0x08, 0x03, 0xc1, 0x08, 0xc7, 0x03,
+  0x3e, 0x03, 0xc2, 0x69, 0x37, 0x3e, 0x03, 0xc0, 0x3e, 0x03, 0xc0, 0x08, 0x14, 0xc1, 0x6e, 0x14,
+  0xc9, 0x19, 0xc0, 0x6e, 0xc1, 0x7e, 0x19, 0x6f, 0x98, 0xf6, 0x9b, 0xc8, 0xc0, 0x7a, 0xc0, 0x56,
+  0x65, 0x6e, 0xc3, 0x20, 0x25, 0x7a, 0x34, 0x69, 0x28, 0x20, 0x28, 0x20, 0x65, 0xc1, 0x20, 0xc0,
+  0x66, 0x14, 0x5a, 0x14, 0xc0, 0x20, 0x34, 0x7e, 0x34, 0x66, 0x28, 0xc2, 0x66, 0x14, 0xc0, 0xa2,
+  0x98, 0x6e, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0xc1, 0x7e, 0x28, 0xc0, 0xa3, 0x88, 0x2b, 0x23, 0xc1,
+  0x28, 0xc0, 0x69, 0xa2, 0x99, 0x6e, 0x35, 0x67, 0x34, 0x2d, 0x34, 0xa9, 0x19, 0x0d, 0x0f, 0x08,
+  0xc1, 0x6f, 0xc0, 0x0f, 0x14, 0xc4, 0x0f, 0xc0, 0x14, 0xc0, 0x6f, 0x6e, 0xc1, 0x20, 0x19, 0xc0,
+  0x20, 0x25, 0x6e, 0x25, 0x19, 0xc0, 0x14, 0xc0, 0x19, 0x7b, 0x20, 0xc0, 0x25, 0xc2, 0x2a, 0xc0,
+  0x6b, 0xc2, 0x66, 0x25, 0xc2, 0x20, 0xc2, 0x23, 0xc0, 0x56, 0x20, 0xc0, 0x23, 0x20, 0xc2, 0x14,
+  0xc0, 0x20, 0x14, 0x20, 0x14, 0x20, 0xc1, 0x25, 0x20, 0xc9, 0x1b, 0xc0, 0x20, 0xc1, 0x1b, 0xc1,
+  0x20, 0x6b, 0x2c, 0xc9, 0x7e, 0x2c, 0x20, 0x27, 0xc0, 0x20, 0x27, 0x20, 0x27, 0x2c, 0xc3, 0x27,
+  0x2c, 0x27, 0x2c, 0xc2, 0x20, 0xc4, 0x1b, 0x20, 0xc1, 0x2c, 0xc2, 0x27, 0xc0, 0x2c, 0xc0, 0xfe,
+  0x13, 0xd3, 0xc1, 0x6e, 0x6b, 0xc1, 0x6e, 0xc2, 0x6f, 0xc0, 0x32, 0x3e, 0x32, 0xcb, 0x6e, 0xc0,
+  0x32, 0xc4, 0x2d, 0x6d, 0x37, 0xc0, 0x6e, 0x6f, 0x6f, 0xc0, 0x08, 0x66, 0x3e, 0x03, 0x3e, 0x37,
+  0xc3, 0x3e, 0xc0, 0x03, 0x08, 0xc4, 0x14, 0x08, 0xcc, 0x14, 0x6e, 0xc2, 0x14, 0xc2, 0x08, 0xc3,
+  0x6b, 0x14, 0xc1, 0x19, 0xc0, 0x65, 0x08, 0xc0, 0x03, 0x9a, 0xd7, 0x9d, 0xd7, 0x5a, 0x34, 0x31,
+  0x65, 0x66, 0x25, 0x20, 0xc0, 0x25, 0xc0, 0x20, 0x7e, 0x6e, 0xc0, 0x7b, 0x28, 0x20, 0xc1, 0x66,
+  0x69, 0x1b, 0x7e, 0x1b, 0x14, 0xc4, 0x28, 0xa2, 0x78, 0x2d, 0x67, 0x28, 0xc1, 0x65, 0xc0, 0x20,
+  0x14, 0xa2, 0x98, 0x6e, 0x2d, 0x28, 0x25, 0x28, 0x2d, 0x25, 0x28, 0x30, 0x28, 0xa2, 0x88, 0xa2,
+  0x88, 0x23, 0x20, 0x1c, 0x23, 0x59, 0x28, 0x30, 0x37, 0xa2, 0x77, 0x3c, 0x59, 0x2d, 0xa2, 0x79,
+  0xa8, 0x28, 0xa2, 0x4a, 0x66, 0xc3, 0x19, 0xc0, 0x14, 0xc0, 0x19, 0xc1, 0x14, 0xc2, 0x19, 0xc0,
+  0x6f, 0xc1, 0x66, 0x19, 0x20, 0xc1, 0x25, 0xc3, 0x19, 0x20, 0x19, 0xc0, 0x14, 0xc3, 0x20, 0x25,
+  0xc0, 0xa2, 0x78, 0xc1, 0x66, 0x66, 0x20, 0xc4, 0x25, 0xc0, 0x20, 0xc2, 0x25, 0xc0, 0x20, 0x25,
+  0x20, 0x14, 0xc7, 0x20, 0x7e, 0x66, 0x20, 0x66, 0x20, 0xc1, 0x2c, 0x25, 0x20, 0xc1, 0x25, 0x20,
+  0xc1, 0x1b, 0xc2, 0x20, 0xc0, 0x2c, 0x20, 0xc4, 0x6b, 0x20, 0xc0, 0x27, 0x2c, 0xc0, 0x20, 0xc4,
+  0x25, 0xc0, 0x2c, 0xc5, 0x27, 0xc1, 0x20, 0xc0, 0x1b, 0xc4, 0x20, 0xc0, 0x2c, 0xc3, 0x31, 0xc0,
+  0x2c, 0x31, 0xfe, 0x13, 0xd3, 0x6e, 0x6b, 0xc0, 0x6e, 0xc2, 0x6e, 0xc0, 0x32, 0xc2, 0x2d, 0x26,
+  0xc0, 0x2d, 0xc0, 0x32, 0xcb, 0x26, 0xc2, 0x21, 0x26, 0xc2, 0x32, 0x37, 0xc6, 0x32, 0x37, 0xc3,
+  0x32, 0xc5, 0x37, 0xc1, 0x32, 0x26, 0x32, 0xc1, 0x37, 0x6f, 0xc4, 0x6e, 0xc0, 0x03, 0x08, 0xc0,
+  0x03, 0xc3, 0x08, 0xc4, 0x6f, 0xc1, 0x7a, 0x5e, 0x14, 0x69, 0xc0, 0x99, 0xd8, 0x9b, 0xe8, 0x6e,
+  0x7a, 0x2c, 0xc0, 0x65, 0xc2, 0x6b, 0x2c, 0x20, 0xc0, 0x7e, 0xc1, 0x20, 0xc1, 0x66, 0xc0, 0x69,
+  0x1b, 0x7e, 0x14, 0xc0, 0x20, 0x14, 0x66, 0x14, 0xc0, 0x23, 0x28, 0xc0, 0x23, 0xc0, 0x28, 0xc0,
+  0x65, 0x23, 0x59, 0x14, 0x28, 0x7f, 0x28, 0xc1, 0x5a, 0xc0, 0x23, 0x28, 0x6e, 0x28, 0xa3, 0x88,
+  0x6f, 0x9a, 0xa8, 0x23, 0xc2, 0x28, 0xc0, 0x34, 0xc0, 0x2d, 0x2c, 0x23, 0xa7, 0x48, 0xa8, 0x0a,
+  0x62, 0x66, 0x14, 0x69, 0x0f, 0x14, 0x0f, 0xc0, 0x14, 0x6e, 0x1e, 0x19, 0x14, 0xc4, 0x6f, 0x19,
+  0x14, 0x20, 0x6e, 0xc0, 0x6e, 0xc4, 0x6f, 0x2a, 0x25, 0x20, 0x19, 0x14, 0x19, 0xc0, 0x14, 0xc0,
+  0x6b, 0x20, 0x25, 0x2a, 0x36, 0xc2, 0x66, 0x25, 0x20, 0xc0, 0x25, 0x20, 0xc1, 0x25, 0xc0, 0x20,
+  0x25, 0xc2, 0x2a, 0x31, 0xc1, 0x25, 0xc9, 0x31, 0x66, 0x31, 0xc2, 0x2c, 0xc0, 0x31, 0xc0, 0x7a,
+  0x62, 0x20, 0xc4, 0x2c, 0xc1, 0x20, 0xc0, 0x1b, 0xc1, 0x20, 0xc0, 0x1b, 0x20, 0x1b, 0xc1, 0x20,
+  0x1b, 0x14, 0x1b, 0xc8, 0x20, 0xc0, 0x6b, 0xc0, 0x25, 0xc1, 0x20, 0xc4, 0x25, 0x2c, 0x31, 0xc7,
+  0xfe, 0x13, 0xf4, 0x69, 0xc5, 0x2d, 0x26, 0xc3, 0x66, 0xc6, 0x26, 0x21, 0xc1, 0x26, 0x2d, 0x6e,
+  0x2d, 0x32, 0xc4, 0x26, 0x6e, 0x32, 0xc1, 0x6e, 0xc1, 0x32, 0xc0, 0x2d, 0xc0, 0x32, 0x37, 0xc0,
+  0x6b, 0x6e, 0x3e, 0xc1, 0x03, 0xc1, 0x3e, 0x03, 0xc2, 0x69, 0x37, 0x32, 0xc0, 0x37, 0xc3, 0x3e,
+  0x37, 0xc3, 0x3c, 0x37, 0xc4, 0x3e, 0x03, 0x6e, 0x03, 0xc0, 0x08, 0xc0, 0x6e, 0x7f, 0xc0, 0x5a,
+  0xc2, 0x0d, 0x19, 0x99, 0xe8, 0x9a, 0xd7, 0x6e, 0x2c, 0xc1, 0x65, 0xc2, 0x6e, 0xc2, 0x7a, 0x6b,
+  0x5d, 0x20, 0x65, 0x20, 0xc0, 0x14, 0xc0, 0x66, 0x14, 0xc3, 0x0f, 0xc0, 0x14, 0x7f, 0x28, 0xc0,
+  0x23, 0xc4, 0x14, 0x6e, 0xa3, 0x99, 0x66, 0x28, 0xc1, 0x25, 0xc1, 0x28, 0x7e, 0x31, 0x7e, 0x25,
+  0x62, 0x20, 0x25, 0x28, 0x25, 0xc0, 0x7e, 0x23, 0x20, 0x14, 0xa1, 0x8a, 0x1b, 0xa6, 0x37, 0xa9,
+  0x2a, 0x73, 0x5a, 0x6e, 0x0f, 0xc0, 0x14, 0xc0, 0x6e, 0x6f, 0xc1, 0x19, 0xc1, 0x25, 0xc1, 0x66,
+  0x25, 0x69, 0x19, 0xc1, 0x14, 0xc1, 0x19, 0xc0, 0x20, 0xc0, 0x25, 0xc1, 0x20, 0x19, 0x20, 0x25,
+  0xc1, 0x20, 0xc1, 0x25, 0xc0, 0x6e, 0xc0, 0x6b, 0x25, 0xc0, 0x20, 0xc1, 0x66, 0x14, 0xc1, 0x1b,
+  0x20, 0xc5, 0x25, 0x31, 0xc0, 0x2a, 0x25, 0xc0, 0x31, 0xc1, 0x7a, 0x31, 0xc0, 0x2a, 0x25, 0xc0,
+  0x6b, 0x25, 0x31, 0x2a, 0x25, 0x20, 0xc3, 0x1b, 0xc4, 0x20, 0x1b, 0xc3, 0x66, 0x1b, 0xc2, 0x0f,
+  0xc0, 0x1b, 0xc0, 0x0f, 0xc7, 0x1b, 0xc3, 0x16, 0x1b, 0xc1, 0x20, 0xc0, 0x1b, 0xc3, 0x20, 0xc2,
+  0x6b, 0x31, 0xc0, 0x2c, 0x31, 0x2c, 0xc0, 0x31, 0x2c, 0xfe, 0x13, 0xd3, 0xc3, 0x66, 0x69, 0x1c,
+  0xc0, 0x15, 0xc1, 0x21, 0xc0, 0x15, 0xc1, 0x66, 0xc0, 0x15, 0x6e, 0x21, 0x6e, 0x6b, 0x6e, 0x6e,
+  0x6f, 0xc0, 0x6e, 0xc0, 0x03, 0xc2, 0x66, 0x37, 0x32, 0x37, 0xc0, 0x3e, 0x37, 0x03, 0x08, 0x03,
+  0x37, 0xc1, 0x3e, 0x03, 0xc0, 0x08, 0x6e, 0x6b, 0xc2, 0x6e, 0x14, 0x19, 0x14, 0x19, 0xc2, 0x0d,
+  0x08, 0xc1, 0x03, 0xc0, 0x3e, 0xc0, 0x37, 0xc1, 0x32, 0xc0, 0x37, 0xc4, 0x32, 0xc0, 0x69, 0xc0,
+  0x32, 0x37, 0xc0, 0x3e, 0x03, 0x08, 0x0d, 0x7f, 0x19, 0xc1, 0x62, 0x08, 0x65, 0x0f, 0x9c, 0xb6,
+  0x99, 0xf8, 0x5e, 0x66, 0xc0, 0x65, 0x7a, 0xc0, 0x6b, 0x1d, 0xc1, 0x2c, 0x69, 0x2c, 0x6e, 0x69,
+  0x25, 0x20, 0xc1, 0x65, 0xc2, 0x66, 0x5a, 0xc0, 0x14, 0xc1, 0x20, 0x7a, 0xc1, 0x6e, 0xc0, 0x65,
+  0x23, 0xc0, 0x56, 0x14, 0x23, 0xa2, 0x77, 0x28, 0xc1, 0x23, 0x25, 0x20, 0x25, 0x28, 0x2d, 0x2a,
+  0x2c, 0x1b, 0x1d, 0xc0, 0x25, 0x28, 0x20, 0x14, 0x1b, 0xa5, 0x58, 0xa5, 0x59, 0x66, 0x99, 0xc8,
+  0x70, 0xa9, 0x29, 0xa7, 0x4a, 0x62, 0xc0, 0x19, 0xc1, 0x6f, 0xc2, 0x14, 0xc1, 0x25, 0xc0, 0x6e,
+  0x25, 0x66, 0x19, 0x14, 0xc1, 0x66, 0xc3, 0x14, 0x19, 0x20, 0xc0, 0x25, 0xc3, 0x1e, 0x20, 0x19,
+  0xc0, 0x14, 0xc2, 0x19, 0x20, 0x25, 0x20, 0xc1, 0x14, 0xc8, 0x6b, 0x19, 0xc3, 0x14, 0xc2, 0x20,
+  0x14, 0x20, 0xc5, 0x14, 0xc8, 0x1b, 0xc1, 0x14, 0x1b, 0xc6, 0x0f, 0xc2, 0x14, 0xc0, 0x0f, 0xc1,
+  0x14, 0xc0, 0x0f, 0xc6, 0x1b, 0xca, 0x66, 0xc1, 0x1b, 0x0f, 0x16, 0x1b, 0x16, 0x1b, 0x6f, 0xc0,
+  0x20, 0x6f, 0x27, 0x20, 0x27, 0xc0, 0xfe, 0x13, 0xd3, 0xc0, 0x65, 0xc2, 0x6b, 0xc3, 0x21, 0xc3,
+  0x6e, 0xc0, 0x6f, 0x6e, 0xc0, 0x6b, 0x6d, 0xc1, 0x6f, 0xc5, 0x6f, 0x69, 0x08, 0xc4, 0x7f, 0x5e,
+  0xc0, 0x14, 0x66, 0x14, 0xc1, 0x0d, 0xc4, 0x14, 0xc1, 0x08, 0xc0, 0x66, 0x3e, 0x03, 0xc0, 0x3e,
+  0xc4, 0x37, 0xc2, 0x32, 0x37, 0x32, 0xc1, 0x37, 0x32, 0x37, 0xc0, 0x65, 0xc0, 0x32, 0xc1, 0x37,
+  0xc0, 0x03, 0xc0, 0x08, 0xc0, 0x0d, 0x14, 0xc6, 0x3c, 0xfe, 0x2b, 0x2f, 0x65, 0xc0, 0x69, 0x66,
+  0x7a, 0xc0, 0x6b, 0x1d, 0x66, 0x20, 0xa2, 0x77, 0x6b, 0x66, 0xc0, 0x20, 0xc1, 0x65, 0x6b, 0xc0,
+  0x14, 0x1b, 0x59, 0x66, 0xc1, 0x14, 0xc0, 0x66, 0x20, 0x7a, 0xc1, 0x6e, 0x23, 0x69, 0x14, 0x1b,
+  0x14, 0xc0, 0x6e, 0x6f, 0xc0, 0x20, 0x25, 0xc3, 0x7b, 0x2a, 0x31, 0x25, 0x19, 0x20, 0x25, 0x23,
+  0x14, 0x11, 0xa4, 0x59, 0xa6, 0x49, 0xa5, 0x59, 0x6f, 0x6f, 0x9c, 0xa8, 0x9e, 0xa6, 0xa5, 0x59,
+  0x77, 0x55, 0x25, 0x66, 0x19, 0x0f, 0x14, 0xc2, 0x08, 0xc0, 0x14, 0x0f, 0x14, 0xc8, 0x19, 0xc0,
+  0x20, 0xc0, 0x25, 0xc1, 0x6e, 0x25, 0xc0, 0x19, 0x14, 0x0f, 0x14, 0xc0, 0x0f, 0xc2, 0x14, 0x19,
+  0x25, 0xc2, 0x20, 0x14, 0xc0, 0x0f, 0x14, 0xc2, 0x6b, 0xc0, 0x20, 0xc0, 0x19, 0x20, 0xc2, 0x1b,
+  0xc0, 0x0f, 0x14, 0xcb, 0x0f, 0x1b, 0xc0, 0x14, 0x0f, 0x14, 0x0f, 0xc0, 0x1b, 0x0f, 0xc0, 0x1b,
+  0xc1, 0x0f, 0x1b, 0xc1, 0x0f, 0xc2, 0x14, 0x0f, 0xc1, 0x1b, 0x14, 0xc2, 0x1b, 0x0f, 0xc3, 0x6b,
+  0x0f, 0x14, 0xc0, 0x1b, 0xc8, 0x16, 0x1b, 0xc0, 0x16, 0x1b, 0xc2, 0xa2, 0x78, 0x20, 0x6b, 0xc1,
+  0x2c, 0xc1, 0xfe, 0x13, 0xd3, 0xc1, 0x6e, 0xc1, 0x6b, 0x6e, 0xc0, 0x6f, 0x32, 0x6e, 0x3e, 0x6e,
+  0xc3, 0x6e, 0x03, 0xc0, 0x3e, 0x37, 0x32, 0x69, 0xc1, 0x26, 0xc1, 0x2b, 0xc0, 0x32, 0x37, 0x32,
+  0xc3, 0x37, 0x08, 0xc2, 0x03, 0x08, 0xc0, 0x03, 0x69, 0xc0, 0x37, 0xc0, 0x32, 0xc1, 0x37, 0x3e,
+  0x37, 0xc1, 0x32, 0x37, 0xc5, 0x32, 0xc2, 0x2b, 0xc2, 0x32, 0xc0, 0x37, 0xc2, 0x32, 0x37, 0x03,
+  0xc1, 0x6f, 0x6e, 0xc4, 0x6e, 0x6f, 0xc0, 0x19, 0x14, 0xc0, 0x69, 0x08, 0x14, 0x98, 0xe7, 0x9b,
+  0xc7, 0x6f, 0x66, 0x59, 0x1d, 0x7a, 0x1d, 0xc0, 0xa2, 0x78, 0x1d, 0x20, 0xc1, 0x1d, 0x7f, 0x69,
+  0x1d, 0x66, 0xc0, 0x69, 0xc2, 0x66, 0xc1, 0x7a, 0xc0, 0x0c, 0x7e, 0x20, 0x7a, 0xc5, 0x56, 0x0f,
+  0x14, 0x25, 0x6e, 0x25, 0x20, 0x69, 0x7f, 0x25, 0xc0, 0x7b, 0x6e, 0x5a, 0x1d, 0x0c, 0x0f, 0x1b,
+  0x29, 0xa3, 0x59, 0xa6, 0x48, 0xa5, 0x69, 0x6f, 0x66, 0x65, 0xc0, 0x6b, 0x25, 0x61, 0xc3, 0x08,
+  0x03, 0xc1, 0x08, 0x0d, 0xc0, 0x08, 0xc0, 0x03, 0x08, 0xc1, 0x14, 0xc5, 0x19, 0xc0, 0x25, 0xc4,
+  0x20, 0xc0, 0x14, 0xc8, 0x19, 0x25, 0xc2, 0x20, 0x14, 0xc5, 0x20, 0xc0, 0x25, 0xc1, 0x6f, 0xc0,
+  0x2a, 0x67, 0x25, 0xc0, 0x20, 0x66, 0x7e, 0x19, 0x14, 0xc0, 0x1b, 0x14, 0xc0, 0x7e, 0x14, 0xc9,
+  0x1b, 0xc0, 0x65, 0x14, 0x1b, 0xc1, 0x0f, 0xc0, 0x1b, 0x0f, 0xc0, 0x1b, 0xc5, 0x20, 0x1b, 0xc5,
+  0x66, 0x0f, 0xc2, 0x1b, 0xc2, 0x16, 0xc0, 0x1b, 0xc1, 0x20, 0xc0, 0x1b, 0xc3, 0x20, 0xc2, 0x2c,
+  0xc3, 0x31, 0xc0, 0x2c, 0xfe, 0x14, 0x14, 0xc0, 0x6f, 0xc1, 0x6e, 0x3e, 0x03, 0xc5, 0x69, 0x03,
+  0xc1, 0x3c, 0x32, 0xc0, 0x69, 0x62, 0xc0, 0x6e, 0x21, 0x26, 0x21, 0xc1, 0x26, 0xc2, 0x21, 0xc1,
+  0x26, 0xc0, 0x32, 0x6e, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0xc0, 0x32, 0x26, 0xc1, 0x32, 0xc2,
+  0x37, 0xc1, 0x03, 0xc1, 0x6e, 0xc1, 0x03, 0xc1, 0x37, 0x32, 0xc4, 0x37, 0x3e, 0x03, 0xc1, 0x08,
+  0xc2, 0x6f, 0xc7, 0x6e, 0xc0, 0x14, 0x08, 0x03, 0xc0, 0x3c, 0x03, 0x3c, 0x08, 0x9b, 0xc9, 0x9a,
+  0xe6, 0x5a, 0x55, 0xc1, 0x7a, 0x66, 0x1d, 0xa8, 0x29, 0x5a, 0x71, 0x61, 0x75, 0x9d, 0xc8, 0x6e,
+  0x62, 0x18, 0xc0, 0x69, 0xc1, 0x66, 0x11, 0x0c, 0xc3, 0x11, 0x7e, 0x20, 0xc1, 0x65, 0xc0, 0xa2,
+  0x88, 0xc0, 0x1b, 0xc0, 0x7a, 0x69, 0x20, 0x25, 0x20, 0x25, 0xc0, 0x28, 0x25, 0x20, 0xa2, 0x78,
+  0x79, 0x20, 0x52, 0x1a, 0xa5, 0x59, 0xa5, 0x59, 0xa3, 0x79, 0xa3, 0x79, 0x66, 0x66, 0x69, 0xc1,
+  0x76, 0x56, 0x6e, 0xc0, 0x0d, 0x08, 0xc0, 0x14, 0xc0, 0x0d, 0x0f, 0xc3, 0x08, 0xc4, 0x14, 0xc2,
+  0x0f, 0x14, 0x19, 0xc0, 0x20, 0xc0, 0x25, 0xc1, 0x6f, 0xc0, 0x25, 0xc0, 0x20, 0xc1, 0x19, 0xc1,
+  0x20, 0xc3, 0x2a, 0x25, 0xc3, 0x20, 0x25, 0x20, 0xc5, 0x25, 0xc1, 0x31, 0x25, 0xc0, 0x6b, 0x25,
+  0xc0, 0x20, 0x2c, 0x25, 0x2c, 0xc1, 0x25, 0xc0, 0x20, 0xc0, 0x66, 0xc1, 0x20, 0xc0, 0x1b, 0x20,
+  0xc2, 0x1b, 0xc1, 0x14, 0x1b, 0xc5, 0x14, 0x1b, 0xc0, 0x0f, 0x1b, 0xc1, 0x20, 0x1b, 0xc0, 0x20,
+  0xc0, 0x1b, 0xc1, 0x66, 0x1b, 0xc1, 0x14, 0x1b, 0xc3, 0x16, 0x1b, 0xc2, 0x20, 0x6b, 0x1b, 0x27,
+  0x1b, 0x27, 0x20, 0xc3, 0x2c, 0xc0, 0x27, 0xc0, 0x2c, 0x27, 0xc0, 0x2c, 0xfe, 0x14, 0x55, 0x66,
+  0xc1, 0x69, 0xc2, 0x3e, 0x37, 0xc1, 0x3e, 0xc1, 0x37, 0xc2, 0x66, 0x69, 0x66, 0xc7, 0x32, 0xc3,
+  0x2b, 0xc0, 0x26, 0xc0, 0x37, 0xc0, 0x32, 0x2b, 0xc0, 0x32, 0xc0, 0x2b, 0x32, 0x2b, 0x32, 0xc1,
+  0x37, 0x32, 0xc4, 0x3e, 0xc0, 0x03, 0xc2, 0x69, 0xc1, 0x03, 0x37, 0x3e, 0x7a, 0x3e, 0x03, 0xc0,
+  0x6e, 0x6f, 0x6e, 0x14, 0xc1, 0x03, 0xc1, 0x08, 0xc3, 0x03, 0xc0, 0x08, 0xc0, 0x14, 0xc1, 0x08,
+  0x03, 0xc0, 0x3e, 0x03, 0xc0, 0x3c, 0x37, 0x98, 0xe7, 0x75, 0x55, 0x67, 0x79, 0x6e, 0xc0, 0x62,
+  0xa9, 0x19, 0xa5, 0x6a, 0x03, 0x08, 0x69, 0x9d, 0xb9, 0x9d, 0xa8, 0x61, 0x76, 0x50, 0x61, 0x79,
+  0x66, 0x7a, 0x55, 0x0c, 0xc1, 0x6e, 0xc1, 0x7a, 0xc0, 0x6b, 0xc1, 0x7d, 0xc0, 0x6b, 0x1b, 0x6d,
+  0x14, 0xc0, 0x1b, 0xa2, 0x77, 0x66, 0xc1, 0x25, 0xc0, 0x6b, 0x25, 0xa4, 0x59, 0xa5, 0x49, 0xc0,
+  0x01, 0xa3, 0x79, 0x67, 0x69, 0x66, 0x08, 0xc1, 0x14, 0xc0, 0x0f, 0xc0, 0x08, 0xc1, 0x0f, 0xc1,
+  0x14, 0xc5, 0x19, 0xc1, 0x14, 0x0f, 0xc0, 0x14, 0x0f, 0x14, 0xc2, 0x19, 0x6f, 0x6e, 0xc1, 0x6e,
+  0x67, 0xc0, 0x66, 0x25, 0xc1, 0x20, 0xc0, 0x19, 0x20, 0x19, 0xc0, 0x20, 0xc2, 0x25, 0xc6, 0x19,
+  0x67, 0x20, 0xc0, 0x1b, 0x14, 0xc0, 0x1b, 0x19, 0xc2, 0x1b, 0xc0, 0x14, 0x1b, 0x25, 0x20, 0xc4,
+  0x25, 0x2c, 0x25, 0x31, 0x2a, 0x31, 0xc0, 0x25, 0x2c, 0x31, 0x2c, 0x25, 0x20, 0xc3, 0x1b, 0x20,
+  0x1b, 0xc5, 0x66, 0x1b, 0xc0, 0x14, 0xc0, 0x1b, 0xc5, 0x16, 0x1b, 0x16, 0x1b, 0xc2, 0x16, 0x1b,
+  0xc6, 0x20, 0x1b, 0x20, 0x1b, 0xc3, 0x6b, 0x1b, 0xc0, 0x20, 0x2c, 0x76, 0x5a, 0x20, 0x25, 0x20,
+  0xc0, 0xfe, 0x14, 0x14, 0x66, 0x69, 0xc0, 0x66, 0xc3, 0x26, 0xc0, 0x6e, 0x32, 0xc1, 0x2b, 0x32,
+  0x6e, 0xc1, 0x6f, 0xc0, 0x37, 0xc3, 0x32, 0xc2, 0x6f, 0xc1, 0x03, 0x6e, 0xc2, 0x6f, 0xc0, 0x66,
+  0x03, 0x3e, 0xc0, 0x37, 0xc0, 0x32, 0xcb, 0x2d, 0x32, 0xc5, 0x37, 0x3e, 0xc1, 0x03, 0x08, 0x03,
+  0x08, 0xc3, 0x03, 0x3e, 0x37, 0x03, 0xc1, 0x08, 0x03, 0xc2, 0x08, 0xc0, 0x14, 0xc0, 0x6e, 0xc0,
+  0x14, 0xc1, 0x69, 0xc1, 0x08, 0x96, 0xe7, 0x9e, 0xb7, 0x5b, 0x66, 0x6d, 0x76, 0x1d, 0x62, 0xa6,
+  0x38, 0x08, 0xc0, 0x03, 0x08, 0xc1, 0x03, 0x37, 0x32, 0x61, 0x65, 0x6e, 0x65, 0x2f, 0x9b, 0xb8,
+  0x75, 0xa2, 0x88, 0x7e, 0x0c, 0x18, 0x14, 0xc0, 0x6b, 0x14, 0xc0, 0x7e, 0x66, 0x14, 0x1b, 0x14,
+  0xc1, 0x66, 0xa2, 0x78, 0x6f, 0x69, 0xc1, 0x20, 0x25, 0x5a, 0xaa, 0x09, 0xa5, 0x6a, 0x62, 0x19,
+  0x0d, 0xc0, 0x6b, 0xcb, 0x66, 0xc1, 0x03, 0x0f, 0x14, 0xc2, 0x19, 0xc0, 0x20, 0xc5, 0x6e, 0xc1,
+  0x2a, 0xc5, 0x25, 0xc1, 0x20, 0x25, 0xc0, 0x20, 0x25, 0xc1, 0x20, 0xc4, 0x66, 0x14, 0xcb, 0x0f,
+  0x14, 0xc0, 0x20, 0xc7, 0x1b, 0xc5, 0x20, 0xc1, 0x25, 0x20, 0xc5, 0x1b, 0xc5, 0x0f, 0x1b, 0xc0,
+  0x0f, 0x6b, 0xc0, 0x1b, 0xc4, 0x16, 0x1b, 0x16, 0x1b, 0xc2, 0x16, 0xc1, 0x1b, 0xc9, 0x20, 0xc1,
+  0x1b, 0xc6, 0x20, 0xc0, 0x6f, 0x66, 0x20, 0x27, 0x20, 0xc0, 0xfe, 0x13, 0xb3, 0xc4, 0x6e, 0xc5,
+  0x6e, 0xc0, 0x21, 0x26, 0x6f, 0x6e, 0x32, 0x37, 0x6b, 0xc1, 0x6e, 0xc2, 0x3e, 0xc0, 0x03, 0xc3,
+  0x6e, 0x6f, 0x69, 0x14, 0xc2, 0x08, 0xc0, 0x03, 0xc0, 0x08, 0xc0, 0x3e, 0xc1, 0x37, 0xc1, 0x3e,
+  0x37, 0xc0, 0x32, 0x26, 0xc1, 0x6b, 0xc0, 0x26, 0x2d, 0xc2, 0x32, 0xc0, 0x37, 0x3e, 0x03, 0xc0,
+  0x37, 0xc0, 0x03, 0xc0, 0x08, 0xc0, 0x03, 0xc0, 0x08, 0xc0, 0x65, 0x32, 0xc2, 0x37, 0x03, 0x08,
+  0xc0, 0x6b, 0x14, 0xc0, 0x6e, 0x14, 0xc0, 0x0f, 0x08, 0x3c, 0x37, 0xc0, 0x99, 0xd8, 0x9c, 0xc7,
+  0x5f, 0x55, 0x7e, 0xc1, 0x66, 0xa2, 0x79, 0x37, 0x03, 0x3c, 0x03, 0x37, 0xc2, 0x3c, 0x37, 0x03,
+  0xc0, 0x14, 0x08, 0x9c, 0xa7, 0x98, 0xd8, 0x9c, 0xc7, 0xa2, 0x78, 0x6e, 0x7a, 0x6b, 0x14, 0x1b,
+  0x14, 0x11, 0x1b, 0x7a, 0x5d, 0x14, 0x11, 0x14, 0xc1, 0x19, 0xa2, 0x78, 0x66, 0x66, 0x6f, 0x55,
+  0x20, 0xa5, 0x39, 0x0d, 0x08, 0x03, 0x08, 0x0d, 0x77, 0x5e, 0xc3, 0x6f, 0x69, 0xc4, 0x14, 0xc3,
+  0x0f, 0x14, 0xc0, 0x0f, 0xc1, 0x14, 0xc0, 0x19, 0x20, 0xc1, 0x6e, 0xc1, 0x6e, 0x25, 0xc0, 0x20,
+  0x19, 0xc0, 0x25, 0x2a, 0xc1, 0x25, 0x20, 0x66, 0x19, 0xc1, 0x20, 0x19, 0xc1, 0x14, 0x20, 0xc1,
+  0x25, 0xc0, 0x20, 0xc0, 0x1b, 0x14, 0xc2, 0x0f, 0x1b, 0xc0, 0x14, 0xc1, 0x1b, 0x20, 0xc4, 0x14,
+  0xc2, 0x20, 0x7a, 0x1b, 0xce, 0x0f, 0xc2, 0x1b, 0x0f, 0xc5, 0x1b, 0xc1, 0x0f, 0x1b, 0xc4, 0x66,
+  0xc0, 0x1b, 0xc2, 0x16, 0x1b, 0x16, 0x1b, 0xc8, 0x20, 0xc0, 0x1b, 0xc7, 0x20, 0xc0, 0x6b, 0xc1,
+  0x20, 0xc1, 0xfe, 0x13, 0xd3, 0xc9, 0x66, 0xc0, 0x21, 0xc0, 0x1c, 0x21, 0x6e, 0xc0, 0x21, 0xc2,
+  0x26, 0xc0, 0x6f, 0xc3, 0x6e, 0xc1, 0x32, 0x37, 0x6e, 0x6b, 0xc4, 0x66, 0xc0, 0x37, 0xc2, 0x32,
+  0xc2, 0x37, 0x32, 0xc1, 0x69, 0xc0, 0x26, 0xc6, 0x6b, 0x32, 0xc0, 0x37, 0x03, 0xc2, 0x3e, 0x03,
+  0xc0, 0x6e, 0xc1, 0x03, 0x3e, 0x37, 0xc1, 0x32, 0x37, 0xc0, 0x03, 0x08, 0xc0, 0x6e, 0x6b, 0xc1,
+  0x66, 0x14, 0x08, 0xc0, 0x03, 0x3c, 0x37, 0xc0, 0x32, 0x9b, 0xc8, 0x9b, 0xc7, 0x5a, 0xc0, 0x7f,
+  0x69, 0xc0, 0x15, 0xa2, 0x68, 0xa7, 0x49, 0x2b, 0xc2, 0x37, 0xc5, 0x32, 0xc0, 0x3e, 0x37, 0x9a,
+  0xb7, 0x99, 0xd8, 0x7e, 0x7f, 0x75, 0xa2, 0x78, 0x59, 0x76, 0xc3, 0x6e, 0x14, 0x6b, 0x19, 0x20,
+  0xc1, 0x5e, 0x66, 0x65, 0xc0, 0xa4, 0x58, 0xa9, 0x2a, 0xa1, 0x8a, 0x3e, 0xc0, 0x03, 0xc0, 0x08,
+  0x6b, 0x14, 0x0f, 0xc1, 0x14, 0xc3, 0x0f, 0x14, 0xc0, 0x0d, 0x14, 0xc1, 0x0f, 0x14, 0xc0, 0x0f,
+  0xc0, 0x14, 0xcb, 0x6e, 0xc0, 0x6b, 0xc1, 0x19, 0xc0, 0x14, 0xc1, 0x0f, 0x14, 0xc2, 0x0f, 0xc1,
+  0x14, 0x19, 0xc0, 0x6f, 0xc1, 0x20, 0xc5, 0x66, 0xc0, 0x14, 0xc1, 0x1b, 0xc5, 0x14, 0x0f, 0x14,
+  0xc1, 0x1b, 0xc2, 0x20, 0xc0, 0x1b, 0x20, 0xce, 0x1b, 0xc2, 0x0f, 0x1b, 0x66, 0x1b, 0x14, 0x1b,
+  0xc9, 0x16, 0xc0, 0x1b, 0xcf, 0x16, 0xc0, 0x1b, 0xc2, 0x20, 0x6b, 0xc1, 0x6e, 0xc0, 0x27, 0xc0,
+  0x2c, 0xfe, 0x14, 0x14, 0xc1, 0x66, 0x69, 0xc2, 0x66, 0xc8, 0x26, 0xc0, 0x21, 0xc0, 0x26, 0x6e,
+  0x32, 0xc1, 0x6e, 0xc1, 0x6b, 0xc0, 0x37, 0xc0, 0x6f, 0xc6, 0x3e, 0xc3, 0x32, 0xcf, 0x37, 0xc0,
+  0x3e, 0x03, 0x6e, 0xc0, 0x6b, 0xc0, 0x08, 0xc1, 0x0f, 0xc2, 0x08, 0x03, 0xc0, 0x37, 0xc0, 0x3e,
+  0x6d, 0x08, 0xc2, 0x3c, 0xc0, 0x03, 0xc0, 0xa2, 0x78, 0xc0, 0x03, 0xc0, 0x3e, 0x3c, 0xc1, 0x03,
+  0xc0, 0x9b, 0xb8, 0x99, 0xd7, 0x6f, 0x12, 0xc0, 0x7b, 0x69, 0xc0, 0x1e, 0xa7, 0x49, 0x37, 0xc1,
+  0x32, 0x37, 0xc1, 0x32, 0x37, 0xc0, 0x32, 0x37, 0x32, 0x2b, 0x37, 0x3c, 0x9a, 0xb9, 0x1a, 0x69,
+  0x98, 0xf8, 0x74, 0xa2, 0x79, 0xc0, 0x66, 0x59, 0x7a, 0xc0, 0x1b, 0xc0, 0x20, 0xc0, 0x11, 0x6f,
+  0x18, 0xc0, 0x55, 0xa6, 0x48, 0xa5, 0x59, 0xa3, 0x7a, 0xa2, 0x78, 0x08, 0x0f, 0x08, 0x6e, 0x6b,
+  0x08, 0x0f, 0xc0, 0x14, 0xc3, 0x0f, 0x08, 0x0f, 0xc2, 0x08, 0xc1, 0x0f, 0xc0, 0x14, 0xc7, 0x0f,
+  0xc3, 0x14, 0xc0, 0x19, 0x6b, 0x19, 0xc3, 0x14, 0xc3, 0x0f, 0xc0, 0x14, 0xc0, 0x0f, 0xc2, 0x14,
+  0x19, 0x20, 0x6e, 0xc1, 0x20, 0xc9, 0x66, 0xc0, 0x20, 0xc6, 0x1b, 0x20, 0xcc, 0x1b, 0x20, 0xc7,
+  0x1b, 0xc1, 0x0f, 0xc2, 0x1b, 0x14, 0x1b, 0xc2, 0x20, 0x1b, 0xc4, 0x66, 0xc0, 0x1b, 0xc7, 0x16,
+  0x1b, 0xc1, 0x16, 0x1b, 0x16, 0x1b, 0xc5, 0x20, 0x6b, 0xc0, 0x6e, 0xc4, 0xfe, 0x14, 0x14, 0xc3,
+  0x66, 0x69, 0xc1, 0x2d, 0xc1, 0x26, 0xc1, 0x2d, 0x32, 0xc1, 0x6e, 0x6b, 0x32, 0x3e, 0x6e, 0xc4,
+  0x3e, 0xc3, 0x03, 0xc1, 0x6f, 0x03, 0x6e, 0x03, 0xc0, 0x08, 0xc0, 0x03, 0x08, 0xc0, 0x0f, 0x08,
+  0x0f, 0xc0, 0x03, 0xc3, 0x3e, 0x03, 0xc7, 0x08, 0xc1, 0x03, 0xc1, 0x08, 0x03, 0x0f, 0x6e, 0xc2,
+  0x0f, 0x08, 0x03, 0x3e, 0xc0, 0x37, 0x03, 0xc3, 0x3e, 0x08, 0xc0, 0x14, 0xc1, 0x08, 0x03, 0x3e,
+  0x03, 0xc0, 0x3e, 0xc0, 0x03, 0x26, 0x98, 0xc6, 0x76, 0xc2, 0x7b, 0x6d, 0xc0, 0xa7, 0x3a, 0x08,
+  0x03, 0xc0, 0x3e, 0xc0, 0x03, 0x37, 0xc3, 0x32, 0xc0, 0x37, 0x32, 0xc0, 0x3e, 0x03, 0x37, 0x65,
+  0x98, 0xc7, 0x9c, 0xd8, 0xa2, 0x87, 0x6b, 0xc1, 0x5e, 0x7a, 0x56, 0xc0, 0x1d, 0x1b, 0x4a, 0x69,
+  0x66, 0xa6, 0x49, 0xaa, 0x29, 0x6f, 0x61, 0xc1, 0x0f, 0x08, 0xc2, 0x0f, 0x08, 0xc0, 0x14, 0xc6,
+  0x0f, 0xc0, 0x14, 0xc0, 0x0f, 0xc4, 0x14, 0xc0, 0x0f, 0x14, 0x0f, 0xc2, 0x14, 0xc8, 0x19, 0xc0,
+  0x14, 0xcc, 0x6b, 0x6e, 0xc5, 0x14, 0x20, 0xc7, 0x25, 0xc5, 0x20, 0xc8, 0x1b, 0x14, 0x1b, 0xc2,
+  0x0f, 0x1b, 0xc5, 0x0f, 0x1b, 0xc1, 0x0f, 0xc0, 0x7a, 0x0f, 0xc3, 0x1b, 0xc1, 0x20, 0xc0, 0x1b,
+  0xc4, 0x66, 0x1b, 0xc0, 0x16, 0xc3, 0x1b, 0xc0, 0x16, 0x1b, 0x16, 0xc2, 0x1b, 0xc6, 0x20, 0x6b,
+  0xc1, 0x6e, 0xc3, 0xfe, 0x14, 0x14, 0xc6, 0x6f, 0x6e, 0x3e, 0xc0, 0x69, 0xc2, 0x3e, 0x37, 0xc1,
+  0x3e, 0xc0, 0x32, 0x3e, 0x37, 0x32, 0xc3, 0x6b, 0xc0, 0x32, 0x3e, 0x03, 0x6e, 0xc1, 0x03, 0x08,
+  0x03, 0xc6, 0x3e, 0x03, 0xc0, 0x3e, 0xc1, 0x37, 0x3e, 0x37, 0xc6, 0x32, 0x37, 0x03, 0xc1, 0x3e,
+  0x03, 0xc0, 0x3e, 0x03, 0x6f, 0xc1, 0x6e, 0xc0, 0x0f, 0x08, 0xc0, 0x3e, 0xc1, 0x03, 0xc1, 0x08,
+  0xc1, 0x14, 0x6e, 0xc1, 0x14, 0x0f, 0x08, 0x03, 0xc0, 0x08, 0x03, 0xc0, 0x08, 0x37, 0x97, 0xd8,
+  0x70, 0xc3, 0xa2, 0x87, 0x62, 0xa8, 0x39, 0x14, 0x03, 0xc1, 0x3e, 0xc0, 0x32, 0x37, 0x32, 0x69,
+  0xc0, 0x32, 0xc3, 0x37, 0xc0, 0x2b, 0x3e, 0x32, 0x9a, 0xc6, 0x9a, 0xd7, 0x6e, 0x7f, 0x5a, 0xc1,
+  0x6b, 0xc0, 0x11, 0x15, 0x66, 0x65, 0xa8, 0x27, 0xa9, 0x4a, 0x0f, 0x08, 0xc0, 0x0f, 0xc0, 0x08,
+  0xc0, 0x03, 0xc4, 0x08, 0x6f, 0xc0, 0x0f, 0xc0, 0x14, 0xc6, 0x19, 0x14, 0xc0, 0x0f, 0xc9, 0x14,
+  0xc0, 0x0f, 0x14, 0xc3, 0x19, 0xc1, 0x14, 0xc8, 0x0f, 0xc1, 0x14, 0xc1, 0x6f, 0xc3, 0x66, 0x14,
+  0x1b, 0xc2, 0x20, 0xcc, 0x1b, 0xc2, 0x0f, 0xc0, 0x1b, 0xc4, 0x20, 0x1b, 0xcb, 0x0f, 0xc0, 0x1b,
+  0xc0, 0x66, 0xc0, 0x1b, 0xc3, 0x20, 0xc0, 0x1b, 0xc4, 0x16, 0xc6, 0x1b, 0x16, 0x1b, 0xc0, 0x16,
+  0xc0, 0x1b, 0xc7, 0x20, 0x6b, 0xc2, 0x6e, 0xc3, 0xfe, 0x13, 0xf4, 0xc6, 0x6e, 0x6f, 0x32, 0x2d,
+  0x32, 0xc1, 0x2d, 0xc2, 0x69, 0xc0, 0x2d, 0xc4, 0x32, 0x3e, 0x69, 0xc1, 0x3e, 0xc1, 0x6e, 0xc2,
+  0x3e, 0xc0, 0x66, 0x32, 0xc4, 0x2d, 0x32, 0x2d, 0x32, 0x69, 0xc0, 0x32, 0xc1, 0x2d, 0xc0, 0x32,
+  0xc0, 0x2d, 0x32, 0xc2, 0x37, 0x3e, 0xc4, 0x03, 0x6e, 0x6b, 0xc1, 0x03, 0xc1, 0x08, 0x03, 0x37,
+  0x3e, 0x37, 0xc1, 0x6e, 0xc0, 0x3e, 0x03, 0xa2, 0x78, 0x6e, 0xc0, 0x14, 0xc0, 0x0f, 0xc0, 0x08,
+  0xc0, 0x03, 0xc0, 0x08, 0xc0, 0x98, 0xd7, 0x9b, 0xc8, 0x5b, 0x59, 0x7a, 0x7b, 0xa2, 0x76, 0x15,
+  0xa7, 0x39, 0x08, 0x03, 0xc0, 0x3c, 0x37, 0xc0, 0x3e, 0x37, 0xc0, 0x32, 0xc0, 0x37, 0x32, 0x37,
+  0x32, 0xc0, 0x37, 0x32, 0x37, 0x32, 0x37, 0xc0, 0x9c, 0xa8, 0x98, 0xd7, 0x9f, 0xb7, 0xa1, 0x8a,
+  0xc0, 0x69, 0xc0, 0x6e, 0x0c, 0x56, 0xc0, 0xa8, 0x38, 0xa8, 0x39, 0x08, 0x3c, 0x03, 0xc1, 0x6f,
+  0x03, 0xc0, 0x08, 0x03, 0xc0, 0x3e, 0x03, 0x08, 0x0f, 0xc1, 0x08, 0xc2, 0x0f, 0xc1, 0x14, 0xce,
+  0x0f, 0x14, 0xc1, 0x0f, 0x14, 0xc2, 0x6e, 0xc0, 0x6b, 0x66, 0x20, 0xc0, 0x14, 0xc0, 0x19, 0x14,
+  0x19, 0xc0, 0x14, 0xc4, 0x20, 0xcd, 0x14, 0x20, 0xc9, 0x1b, 0xc7, 0x20, 0xc3, 0x1b, 0xd0, 0x66,
+  0x1b, 0x0f, 0x1b, 0x20, 0xc3, 0x1b, 0xc6, 0x16, 0xc0, 0x1b, 0xc6, 0x20, 0xc1, 0x6b, 0xc9, 0x6e,
+  0xc0, 0x27, 0xc0, 0xfe, 0x13, 0xf3, 0xcc, 0x66, 0xc1, 0x26, 0xc2, 0x6f, 0xc4, 0x6f, 0xc2, 0x32,
+  0x6b, 0x3e, 0xc1, 0x6e, 0xc1, 0x3e, 0xc1, 0x32, 0xd3, 0x3e, 0x69, 0xc1, 0x32, 0x3e, 0xc3, 0x03,
+  0xc8, 0x3e, 0x37, 0xc3, 0x3e, 0x03, 0x6e, 0x6f, 0xc1, 0x66, 0xc0, 0x14, 0x08, 0xc3, 0x03, 0x08,
+  0x9a, 0xb8, 0x98, 0xc7, 0xa2, 0x78, 0x65, 0x7a, 0x7a, 0x6f, 0x15, 0xa6, 0x39, 0x14, 0x03, 0x69,
+  0x3e, 0xc1, 0x37, 0xc0, 0x32, 0xc0, 0x37, 0xc1, 0x32, 0xc3, 0x37, 0x32, 0xc1, 0x03, 0x9c, 0xa8,
+  0x9d, 0xa7, 0x7a, 0x61, 0x60, 0x61, 0x7a, 0x15, 0xa2, 0x68, 0xa5, 0x59, 0xa6, 0x58, 0x03, 0x3e,
+  0x03, 0xc0, 0x08, 0x03, 0x08, 0x03, 0xc1, 0x08, 0xc2, 0x6b, 0xc0, 0x14, 0xc0, 0x0f, 0xc1, 0x14,
+  0xc0, 0x0f, 0xc0, 0x14, 0x0f, 0x08, 0x67, 0x0f, 0xc2, 0x14, 0xcc, 0x6b, 0x6e, 0x69, 0x20, 0x19,
+  0x20, 0xc1, 0x14, 0xc0, 0x19, 0xc1, 0x20, 0xc8, 0x6e, 0x20, 0xc6, 0x1b, 0xc0, 0x14, 0xc1, 0x19,
+  0x20, 0xc2, 0x1b, 0xc0, 0x20, 0xc8, 0x1b, 0xc2, 0x20, 0xc0, 0xa2, 0x78, 0x25, 0x20, 0x1b, 0x20,
+  0x1b, 0xc7, 0x66, 0x1b, 0x0f, 0x16, 0x1b, 0x16, 0x1b, 0xc5, 0x20, 0xc0, 0x1b, 0xc6, 0x16, 0xc0,
+  0x1b, 0xc5, 0x20, 0xc0, 0x6b, 0xc3, 0x1b, 0x27, 0xc4, 0x6e, 0xc3, 0xfe, 0x13, 0xf4, 0xc0, 0x69,
+  0xc1, 0x66, 0xc2, 0x26, 0xc0, 0x67, 0x2d, 0xc2, 0x6e, 0xc9, 0x6f, 0xc1, 0x69, 0xc0, 0x3e, 0xc1,
+  0x6e, 0xc2, 0x3e, 0xc8, 0x37, 0xc0, 0x3e, 0x32, 0xc0, 0x3e, 0xc3, 0x32, 0x37, 0xc0, 0x32, 0x3e,
+  0x37, 0x3e, 0xc2, 0x03, 0x3e, 0xc1, 0x03, 0xc0, 0x6f, 0xc0, 0x03, 0x6e, 0x03, 0xc1, 0x3e, 0x37,
+  0xc1, 0x3e, 0xc0, 0x6d, 0x03, 0x08, 0x6f, 0x6e, 0xc0, 0x14, 0x0f, 0x03, 0x08, 0x03, 0x08, 0xc0,
+  0x03, 0xc1, 0xa2, 0x77, 0x9c, 0xa8, 0x96, 0xd7, 0xc0, 0x7a, 0xc0, 0x6e, 0xc0, 0x76, 0xa6, 0x39,
+  0x08, 0x75, 0x3c, 0x03, 0x37, 0xc0, 0x7b, 0x32, 0x6b, 0x32, 0xc1, 0x37, 0x32, 0xc1, 0x2b, 0xc1,
+  0x32, 0x37, 0xc2, 0x03, 0xc0, 0x32, 0x21, 0x69, 0xc0, 0x37, 0x0d, 0x19, 0x03, 0x37, 0xc1, 0x3e,
+  0x08, 0xc0, 0x6b, 0xc0, 0x03, 0x0f, 0xc2, 0x14, 0xc0, 0x0f, 0x14, 0x19, 0x14, 0xc2, 0x19, 0x14,
+  0xc0, 0x19, 0x6b, 0x6e, 0x19, 0xc0, 0x14, 0x19, 0xc1, 0x14, 0xc0, 0x0f, 0xc0, 0x14, 0x0f, 0x14,
+  0xc3, 0x6b, 0x20, 0xc8, 0x14, 0x19, 0xc1, 0x20, 0xc3, 0x1b, 0x20, 0xc6, 0x1b, 0xc6, 0x14, 0x20,
+  0xc3, 0x1b, 0xc3, 0x20, 0xc1, 0x1b, 0xc9, 0x20, 0xc0, 0x1b, 0xc9, 0x66, 0x0f, 0x16, 0xc2, 0x0f,
+  0x16, 0xc5, 0x1b, 0xc0, 0x16, 0x1b, 0xc6, 0x16, 0x1b, 0xc7, 0x6f, 0x1b, 0xc6, 0x27, 0xc1, 0x6e,
+  0xc3, 0xfe, 0x13, 0xf3, 0xc1, 0x6b, 0xc2, 0x26, 0x6f, 0xc1, 0x2d, 0xc2, 0x32, 0xc9, 0x2d, 0x32,
+  0x6f, 0xc0, 0x32, 0xc0, 0x6e, 0x3e, 0xc0, 0x6e, 0xc2, 0x3e, 0xc0, 0x32, 0xc1, 0x3e, 0xc1, 0x32,
+  0xc2, 0x3e, 0xc0, 0x32, 0xc4, 0x3e, 0xc0, 0x32, 0xc0, 0x3e, 0xc4, 0x03, 0x3e, 0xc1, 0x03, 0xc8,
+  0x37, 0x3e, 0xc2, 0x03, 0x6e, 0x6b, 0x6e, 0xc0, 0x6e, 0x14, 0x0f, 0x66, 0x03, 0xc0, 0x08, 0xc0,
+  0x03, 0x08, 0xc0, 0x03, 0x69, 0x96, 0xd8, 0x9d, 0xa8, 0x6e, 0x7a, 0x6e, 0x6b, 0x71, 0xa4, 0x58,
+  0xaa, 0x28, 0x03, 0x32, 0x61, 0xa2, 0x77, 0x3e, 0x37, 0x32, 0xc4, 0x2b, 0xc0, 0x26, 0xc2, 0x32,
+  0x37, 0xc0, 0x32, 0x37, 0x3c, 0x37, 0xc1, 0x03, 0x6f, 0x14, 0x19, 0x14, 0x08, 0xc2, 0x0f, 0x08,
+  0xc0, 0x03, 0xc1, 0x0f, 0xc5, 0x14, 0xc4, 0x19, 0xc2, 0x6b, 0x6e, 0x19, 0x14, 0xc4, 0x6b, 0x14,
+  0x1b, 0xc0, 0x14, 0xc2, 0x19, 0x20, 0xc0, 0x1b, 0x20, 0xca, 0x1b, 0x20, 0xc0, 0x1b, 0xc3, 0x20,
+  0xc4, 0x1b, 0xc0, 0x0f, 0x14, 0xc1, 0x1b, 0xc0, 0x20, 0xc5, 0x1b, 0x0f, 0x1b, 0xc1, 0x20, 0xc1,
+  0x1b, 0x0f, 0x1b, 0x14, 0x1b, 0xce, 0x66, 0xc0, 0x1b, 0xc1, 0x16, 0xc1, 0x1b, 0x16, 0xc3, 0x1b,
+  0xc7, 0x16, 0x1b, 0xcd, 0x6b, 0x1b, 0xc8, 0x6f, 0xc0, 0x6e, 0xc0, 0x6e, 0xc0, 0xfe, 0x13, 0xf3,
+  0xc2, 0x6f, 0xc1, 0x66, 0x32, 0x2d, 0xc4, 0x26, 0xc1, 0x2d, 0xc1, 0x26, 0x2d, 0x32, 0xc2, 0x2d,
+  0xc0, 0x32, 0xc1, 0x6e, 0x32, 0x6f, 0xc1, 0x6e, 0xc1, 0x37, 0x32, 0xc3, 0x3e, 0xc0, 0x32, 0xc1,
+  0x3e, 0xc1, 0x32, 0xc0, 0x3e, 0xcb, 0x03, 0x3e, 0xc1, 0x03, 0xc5, 0x3e, 0x03, 0xc1, 0x3e, 0x37,
+  0x3e, 0x03, 0xc0, 0x6e, 0x6b, 0x6e, 0xc2, 0x08, 0x03, 0xc1, 0x08, 0xc0, 0x03, 0x08, 0xc0, 0x65,
+  0x08, 0x98, 0xc8, 0x99, 0xc8, 0xa2, 0x87, 0xa2, 0x88, 0xc0, 0x45, 0x7a, 0x6b, 0xa8, 0x39, 0xa5,
+  0x68, 0xa3, 0xc8, 0xaf, 0xf7, 0x97, 0x49, 0x92, 0x5b, 0x37, 0x66, 0x69, 0x26, 0x2d, 0x2b, 0x32,
+  0xc1, 0x26, 0xc1, 0x2b, 0xc0, 0x32, 0x37, 0xc4, 0x32, 0x37, 0x7f, 0x08, 0x03, 0x08, 0x0f, 0xc0,
+  0x6e, 0x6e, 0x14, 0xc0, 0x0f, 0x03, 0xc0, 0x0f, 0xc3, 0x14, 0xc2, 0x19, 0xc0, 0x14, 0xc3, 0x0f,
+  0xc9, 0x14, 0xc0, 0x19, 0x14, 0xc5, 0x6f, 0x14, 0x19, 0x67, 0x20, 0xc1, 0x1b, 0xc1, 0x20, 0xc1,
+  0x1b, 0xc0, 0x14, 0xc1, 0x1b, 0xc2, 0x20, 0xc5, 0x1b, 0xc1, 0x14, 0xc0, 0x20, 0x1b, 0x20, 0xc2,
+  0x1b, 0xc0, 0x20, 0xc0, 0x1b, 0xc6, 0x0f, 0xc0, 0x14, 0x1b, 0xc0, 0x20, 0xc2, 0x1b, 0xc3, 0x20,
+  0x1b, 0xc9, 0x66, 0x1b, 0xc2, 0x16, 0x1b, 0xc2, 0x16, 0xc0, 0x1b, 0xc5, 0x16, 0x1b, 0xd4, 0x6b,
+  0x6e, 0xc1, 0x6e, 0xc1, 0xfe, 0x13, 0xf4, 0xc0, 0x69, 0x2d, 0x6e, 0xc1, 0x2d, 0xc1, 0x26, 0xc4,
+  0x66, 0xc0, 0x26, 0xc2, 0x2d, 0x32, 0x6e, 0x32, 0xc5, 0x6f, 0xc3, 0x37, 0x32, 0xcc, 0x3e, 0xc0,
+  0x37, 0xc0, 0x32, 0xc1, 0x37, 0xc2, 0x32, 0xc0, 0x37, 0x3e, 0xc1, 0x6e, 0x3e, 0xc0, 0x03, 0xc0,
+  0x6f, 0xc1, 0x03, 0xc0, 0x3e, 0xc0, 0x03, 0xc1, 0x3e, 0xc0, 0x03, 0x6e, 0xc1, 0x6f, 0xc2, 0x08,
+  0x03, 0xc1, 0x08, 0xc3, 0x03, 0xc0, 0x08, 0x26, 0x97, 0xd7, 0x7a, 0xa2, 0x88, 0x66, 0x49, 0x7f,
+  0x21, 0xa3, 0x59, 0xa5, 0x68, 0xb6, 0xf4, 0xa5, 0xa9, 0x93, 0x6b, 0x93, 0x4a, 0x2d, 0xc0, 0x69,
+  0x2d, 0x26, 0x6e, 0x32, 0x2b, 0xc0, 0x32, 0xc3, 0x2d, 0x26, 0x32, 0x37, 0x32, 0xc2, 0x37, 0xc0,
+  0x3e, 0xc1, 0x03, 0xc0, 0x08, 0xc0, 0x7a, 0x08, 0x03, 0xc0, 0x6f, 0xc0, 0x6e, 0x0f, 0xc0, 0x14,
+  0xc6, 0x0f, 0xc9, 0x14, 0xc4, 0x6e, 0xc0, 0x14, 0xc2, 0x6b, 0xc1, 0x19, 0xc0, 0x14, 0xc0, 0x6f,
+  0xc0, 0x1b, 0xc0, 0x20, 0x1b, 0xc1, 0x14, 0xc6, 0x1b, 0x14, 0x20, 0xc4, 0x1b, 0xc4, 0x20, 0xc3,
+  0x1b, 0x20, 0xc0, 0x6e, 0x6b, 0x20, 0x1b, 0xc6, 0x20, 0xc0, 0x1b, 0xc2, 0x20, 0xc1, 0x1b, 0xc0,
+  0x20, 0xc1, 0x1b, 0xc1, 0x66, 0xc0, 0x1b, 0xc0, 0x0f, 0xc0, 0x16, 0xc8, 0x1b, 0xc8, 0x16, 0x1b,
+  0xc0, 0x16, 0x1b, 0xc8, 0x6f, 0x1b, 0xc1, 0x27, 0x1b, 0xc3, 0x6b, 0xc0, 0x27, 0x2c, 0xc1, 0xfe,
+  0x13, 0xf4, 0xc0, 0x69, 0x2d, 0x6e, 0x2d, 0xc4, 0x26, 0xc1, 0x2d, 0xc0, 0x26, 0x2d, 0xc2, 0x32,
+  0xc5, 0x2d, 0xc0, 0x32, 0xc2, 0x6f, 0xc1, 0x69, 0x32, 0xc6, 0x37, 0x32, 0x37, 0xc0, 0x32, 0x3e,
+  0xc0, 0x37, 0xc1, 0x32, 0xc0, 0x37, 0xc1, 0x32, 0x37, 0xc0, 0x32, 0xc0, 0x37, 0x3e, 0xc0, 0x6e,
+  0xc3, 0x6f, 0x03, 0x0f, 0x03, 0xc0, 0x3e, 0x03, 0xc4, 0x6e, 0xc0, 0x6e, 0x6b, 0xc4, 0x0d, 0x08,
+  0xc5, 0x03, 0xc0, 0x08, 0x32, 0x96, 0xd7, 0x69, 0x6f, 0x7e, 0x7a, 0x52, 0x6e, 0xc1, 0xa8, 0x88,
+  0x49, 0x9a, 0x89, 0xa0, 0xa8, 0xa5, 0x59, 0xa3, 0x79, 0x56, 0xc0, 0x65, 0x6e, 0x32, 0x2d, 0x26,
+  0x32, 0xc3, 0x26, 0xc0, 0x2b, 0x32, 0xc3, 0x37, 0x3e, 0xc0, 0x03, 0x69, 0xc1, 0x03, 0xc0, 0x08,
+  0x03, 0xc0, 0x6f, 0xc5, 0x14, 0xc0, 0x0f, 0x14, 0xc0, 0x0f, 0xc0, 0x14, 0x0f, 0xc1, 0x14, 0xc2,
+  0x0f, 0x14, 0xce, 0x0f, 0x14, 0xc0, 0x0f, 0xc1, 0x6f, 0xc0, 0x6e, 0x1b, 0xc1, 0x14, 0xc9, 0x1b,
+  0x20, 0xc0, 0x1b, 0xc2, 0x0f, 0x1b, 0xc2, 0x20, 0x1b, 0xc3, 0x20, 0xc1, 0x6e, 0x20, 0x1b, 0xc2,
+  0x20, 0xc2, 0x1b, 0x20, 0x1b, 0xc1, 0x66, 0x1b, 0xc1, 0x20, 0xc1, 0x1b, 0xc3, 0x16, 0xc0, 0x1b,
+  0xc2, 0x16, 0xc1, 0x1b, 0x16, 0x1b, 0x16, 0xc2, 0x1b, 0x20, 0x1b, 0xc9, 0x16, 0xc0, 0x1b, 0xc2,
+  0x6b, 0x1b, 0xc2, 0x22, 0x1b, 0xc6, 0x22, 0xc1, 0x6e, 0x6e, 0xc1, 0xfe, 0x13, 0xf3, 0xc0, 0x6b,
+  0xc0, 0x6e, 0x2d, 0xc1, 0x32, 0x2d, 0xc0, 0x32, 0xc3, 0x2d, 0x32, 0xcc, 0x6f, 0x32, 0x3e, 0xc7,
+  0x69, 0x32, 0x37, 0xc0, 0x3e, 0xc0, 0x32, 0x3e, 0xc2, 0x37, 0xc3, 0x3e, 0x37, 0x32, 0xc1, 0x37,
+  0xc1, 0x32, 0xc0, 0x3e, 0xc1, 0x6e, 0xc0, 0x6e, 0x6b, 0xc1, 0x03, 0xc6, 0x08, 0x0f, 0x6e, 0xc2,
+  0x6e, 0xc0, 0x14, 0xc0, 0x69, 0x08, 0xc6, 0x03, 0x14, 0x9c, 0xa7, 0x96, 0xd8, 0x7d, 0x5f, 0x16,
+  0x7e, 0x65, 0x5f, 0x65, 0x1e, 0x5f, 0xc0, 0xa3, 0x78, 0x1b, 0xa4, 0x78, 0x37, 0x2b, 0xc1, 0x26,
+  0xc1, 0x2b, 0xc0, 0x32, 0xc0, 0x2d, 0xc0, 0x26, 0x2b, 0xc0, 0x32, 0xc1, 0x26, 0x32, 0x37, 0x3e,
+  0xc0, 0x37, 0x3e, 0xc0, 0x03, 0x08, 0x14, 0x66, 0xc8, 0x14, 0x0f, 0x14, 0xc5, 0x0f, 0x14, 0xc4,
+  0x0f, 0x14, 0xc4, 0x0f, 0xcb, 0x14, 0x6b, 0xc0, 0x6e, 0xc1, 0x1b, 0xc0, 0x14, 0xc8, 0x20, 0x1b,
+  0xc0, 0x20, 0x1b, 0xd0, 0x20, 0x1b, 0x20, 0xc0, 0x1b, 0xc0, 0x20, 0xc0, 0x1b, 0x20, 0xc0, 0x1b,
+  0xc6, 0x20, 0xc1, 0x1b, 0xc9, 0x66, 0xc0, 0x1b, 0xc7, 0x20, 0x1b, 0xc4, 0x16, 0x1b, 0x16, 0x1b,
+  0xc1, 0x16, 0x1b, 0xd2, 0x6f, 0xc1, 0x6e, 0xc0, 0xfe, 0x13, 0xd3, 0x6e, 0xc2, 0x6b, 0x6e, 0xc1,
+  0x2d, 0x32, 0xc3, 0x2d, 0xc3, 0x32, 0xc9, 0x6e, 0xc0, 0x6f, 0x66, 0xc3, 0x66, 0x3e, 0xc1, 0x32,
+  0x3e, 0xc8, 0x37, 0x3e, 0x37, 0x3e, 0xc1, 0x37, 0xc3, 0x32, 0xc1, 0x3e, 0xc0, 0x03, 0xc0, 0x6f,
+  0xc3, 0x03, 0xc5, 0x6e, 0xc1, 0x6f, 0x0f, 0x14, 0xc3, 0x08, 0xc4, 0x03, 0x08, 0xc3, 0x0f, 0x96,
+  0xd7, 0x9c, 0xa6, 0xa1, 0x8a, 0x69, 0x16, 0x6e, 0x0f, 0x16, 0xc0, 0x1b, 0xa2, 0x77, 0xa2, 0x89,
+  0x9c, 0xa8, 0xa4, 0x67, 0xa7, 0x4b, 0x32, 0xc5, 0x69, 0x26, 0x32, 0xc2, 0x2b, 0xc1, 0x32, 0x26,
+  0x2b, 0x37, 0xc0, 0x3e, 0x66, 0x37, 0x03, 0x3e, 0x03, 0x6f, 0xc0, 0x08, 0x0f, 0xc5, 0x14, 0x0f,
+  0xc2, 0x14, 0xcb, 0x0f, 0xc1, 0x14, 0x0f, 0x14, 0xc1, 0x0f, 0xc6, 0x14, 0xc3, 0x6b, 0x6e, 0x1b,
+  0x14, 0x1b, 0xc0, 0x0f, 0x14, 0xc8, 0x1b, 0xc0, 0x20, 0xc1, 0x1b, 0xc6, 0x20, 0xc0, 0x1b, 0xcc,
+  0x20, 0x1b, 0xc1, 0x20, 0x1b, 0xc2, 0x66, 0x1b, 0xc1, 0x20, 0xc0, 0x1b, 0xc5, 0x16, 0x1b, 0xc1,
+  0x16, 0x0f, 0x16, 0xc0, 0x1b, 0xc0, 0x16, 0xc2, 0x1b, 0xc6, 0x16, 0xc1, 0x1b, 0xc0, 0x16, 0xc1,
+  0x1b, 0xd0, 0x6f, 0xc4, 0xfe, 0x13, 0xf3, 0xc2, 0x6f, 0x66, 0x32, 0x69, 0x2d, 0x26, 0xc1, 0x32,
+  0x2d, 0xc3, 0x32, 0xc6, 0x6b, 0xc0, 0x32, 0xc0, 0x6f, 0xc6, 0x32, 0x6e, 0x3e, 0x32, 0x3e, 0xc0,
+  0x32, 0xc0, 0x3e, 0x32, 0x37, 0x3e, 0x32, 0x3e, 0xc0, 0x32, 0x3e, 0xc7, 0x32, 0x3e, 0xc5, 0x6e,
+  0x6e, 0x6b, 0x08, 0x03, 0xc1, 0x3e, 0xc0, 0x03, 0xc3, 0x0f, 0x08, 0xc0, 0x6e, 0x0f, 0xc1, 0x08,
+  0xc0, 0x03, 0xc1, 0x08, 0x03, 0xc1, 0x0f, 0xc0, 0x08, 0x03, 0xc0, 0xa2, 0x78, 0x26, 0x96, 0xd7,
+  0x6e, 0x6e, 0x6b, 0xc0, 0x66, 0x1b, 0x0f, 0xc0, 0x0a, 0x6b, 0x64, 0xa8, 0x58, 0xa7, 0x5a, 0x52,
+  0x32, 0x37, 0x32, 0xc1, 0x37, 0xc0, 0x32, 0xc0, 0x2b, 0x32, 0xc1, 0x37, 0x32, 0x2b, 0xc0, 0x32,
+  0x3e, 0xc1, 0x37, 0x3e, 0xc0, 0x03, 0xc0, 0x6f, 0x03, 0xc0, 0x0f, 0xc0, 0x08, 0x0f, 0x08, 0xc1,
+  0x0f, 0xc0, 0x03, 0xc0, 0x0f, 0xc3, 0x6e, 0xc9, 0x0f, 0x14, 0xc2, 0x0f, 0x14, 0xc0, 0x0f, 0xc1,
+  0x14, 0xc0, 0x0f, 0xc3, 0x14, 0xc3, 0x6b, 0x0f, 0x1b, 0xc0, 0x0f, 0xc0, 0x1b, 0xc2, 0x0f, 0xc1,
+  0x1b, 0xc0, 0x6e, 0xc1, 0x1b, 0xcb, 0x66, 0x1b, 0xc6, 0x20, 0xc1, 0x1b, 0xc7, 0x16, 0xc0, 0x1b,
+  0xca, 0x16, 0xc1, 0x1b, 0x0f, 0x1b, 0xc2, 0x16, 0xc0, 0x1b, 0x16, 0x1b, 0xc6, 0x16, 0x1b, 0xc1,
+  0x16, 0xc0, 0x1b, 0xcf, 0x20, 0x1b, 0x20, 0xc0, 0x6b, 0xc2, 0xfe, 0x13, 0xf4, 0xc0, 0x69, 0xc0,
+  0x2d, 0xc1, 0x26, 0x2d, 0xc2, 0x6e, 0x2d, 0xc0, 0x32, 0x2d, 0xc0, 0x32, 0xc6, 0x6f, 0x32, 0xc0,
+  0x3e, 0xce, 0x32, 0x3e, 0xc5, 0x32, 0x3e, 0xc7, 0x32, 0xc0, 0x3e, 0x32, 0x3e, 0xc2, 0x6e, 0xc2,
+  0x6e, 0x03, 0x3e, 0xc1, 0x03, 0xc2, 0x08, 0x6b, 0x6e, 0xc4, 0x0f, 0x08, 0xc1, 0x03, 0xc7, 0x3e,
+  0xc0, 0x08, 0x99, 0xc8, 0x99, 0xc8, 0x69, 0x0a, 0x6e, 0x6f, 0x0a, 0x03, 0x1b, 0xa3, 0x79, 0x6e,
+  0xc0, 0x32, 0xa2, 0x79, 0x3e, 0x69, 0xc3, 0x3e, 0xc1, 0x32, 0xc0, 0x37, 0x3e, 0xc2, 0x37, 0x32,
+  0x37, 0x3e, 0xc2, 0x6e, 0xc2, 0x0a, 0x03, 0xc0, 0x6f, 0xc3, 0x03, 0x0f, 0xc5, 0x14, 0x0f, 0x14,
+  0xc4, 0x0f, 0xc1, 0x14, 0x0f, 0xc4, 0x14, 0x0f, 0xc5, 0x14, 0xc0, 0x0f, 0xc1, 0x14, 0xc2, 0x6b,
+  0xc5, 0x0f, 0xc0, 0x1b, 0xc1, 0x0f, 0xc0, 0x1b, 0xc0, 0x0f, 0x1b, 0xc3, 0x0f, 0x1b, 0xc0, 0x0f,
+  0xc1, 0x14, 0x1b, 0xc0, 0x66, 0x1b, 0xc9, 0x6e, 0x1b, 0xc2, 0x16, 0x1b, 0xc4, 0x16, 0x1b, 0xc0,
+  0x16, 0x1b, 0xc6, 0x16, 0xc2, 0x1b, 0x16, 0x1b, 0xc1, 0x16, 0x1b, 0xc1, 0x16, 0x1b, 0xc6, 0x16,
+  0x1b, 0xc1, 0x16, 0xc0, 0x1b, 0x16, 0xc1, 0x1b, 0xcb, 0x6b, 0x1b, 0xc0, 0x6f, 0xc1, 0x6e, 0xc0,
+  0xfe, 0x13, 0xf4, 0xc1, 0x69, 0x2d, 0xc3, 0x6e, 0xc2, 0x2d, 0xc3, 0x32, 0xc6, 0x6f, 0x32, 0xc0,
+  0x3e, 0xcb, 0x32, 0x3e, 0xda, 0x6e, 0x6e, 0xc0, 0x6e, 0x08, 0x6b, 0x03, 0xc5, 0x08, 0x0f, 0x6e,
+  0xc6, 0x0f, 0xc0, 0x03, 0xc7, 0x3e, 0x7a, 0x03, 0x3e, 0x26, 0x9c, 0xa8, 0x9d, 0xb9, 0x58, 0x66,
+  0xc0, 0xa5, 0x69, 0x3e, 0x0f, 0xc0, 0x14, 0x03, 0xc0, 0x3e, 0x03, 0x3e, 0xcb, 0x03, 0xc0, 0x3e,
+  0xc0, 0x03, 0xc1, 0x3e, 0xc0, 0x03, 0xc0, 0x0f, 0xc6, 0x03, 0xc0, 0x0f, 0xc6, 0x14, 0xc3, 0x0f,
+  0xc5, 0x14, 0x0f, 0xc1, 0x14, 0xc1, 0x0f, 0xc5, 0x14, 0xc6, 0x6b, 0xc3, 0x0f, 0x14, 0x0f, 0xc1,
+  0x1b, 0x0f, 0xc4, 0x1b, 0xc3, 0x0f, 0xc0, 0x1b, 0xc5, 0x66, 0x1b, 0xd8, 0x16, 0x1b, 0x16, 0x1b,
+  0xc3, 0x16, 0xc5, 0x1b, 0xc0, 0x16, 0xc0, 0x1b, 0xc0, 0x16, 0x1b, 0xc6, 0x16, 0xc8, 0x1b, 0xc2,
+  0x16, 0xc1, 0x1b, 0xc9, 0x6f, 0xc0, 0x6e, 0xc0, 0xfe, 0x14, 0x14, 0x66, 0x32, 0xc2, 0x2d, 0xc2,
+  0x32, 0xc3, 0x2d, 0x32, 0xc0, 0x2d, 0x32, 0xc5, 0x6f, 0xca, 0x66, 0xc0, 0x3e, 0xc0, 0x32, 0xc0,
+  0x3e, 0xcf, 0x39, 0x32, 0x3e, 0xc5, 0x6e, 0x6e, 0x6f, 0xc1, 0x66, 0xc1, 0x03, 0xc2, 0x08, 0xc1,
+  0x14, 0xc6, 0x0f, 0xc0, 0x03, 0xc8, 0x3e, 0x03, 0x3e, 0xc0, 0x14, 0xc0, 0x60, 0x66, 0xc0, 0x3e,
+  0x0f, 0xc0, 0x03, 0xc1, 0x3e, 0xc0, 0x03, 0x6b, 0x03, 0x3e, 0xc1, 0x03, 0xc3, 0x3e, 0xc1, 0x03,
+  0xc9, 0x08, 0x0f, 0xc3, 0x14, 0x0f, 0xc4, 0x14, 0xc0, 0x0f, 0x14, 0xc7, 0x0f, 0xc9, 0x14, 0x0f,
+  0xc6, 0x14, 0xc4, 0x6b, 0xc1, 0x0f, 0x1b, 0xc0, 0x14, 0x0f, 0x14, 0xc0, 0x1b, 0xc3, 0x0f, 0x1b,
+  0xc2, 0x6e, 0xc0, 0x1b, 0xce, 0x20, 0xc0, 0x1b, 0xc7, 0x66, 0x1b, 0xc5, 0x16, 0x1b, 0xc2, 0x16,
+  0xc0, 0x0f, 0x1b, 0x16, 0xc5, 0x1b, 0x16, 0x1b, 0xc0, 0x16, 0xc5, 0x1b, 0xc3, 0x16, 0xc0, 0x1b,
+  0xc0, 0x16, 0xc5, 0x1b, 0xc2, 0x16, 0xc2, 0x1b, 0xc6, 0x6b, 0xc1, 0x6e, 0xc1, 0xfe, 0x13, 0xf4,
+  0x69, 0x2d, 0x6e, 0xc1, 0x2d, 0xc1, 0x32, 0xc2, 0x2d, 0x32, 0xc7, 0x2d, 0x32, 0x6f, 0xc4, 0x6e,
+  0x3e, 0xc9, 0x32, 0x3e, 0xc6, 0x32, 0x3e, 0xce, 0x03, 0xc0, 0x6f, 0xc4, 0x03, 0xc1, 0x6b, 0x03,
+  0x6e, 0xc1, 0x0f, 0xc1, 0x6e, 0xc3, 0x0f, 0x0a, 0x03, 0xc7, 0x3e, 0xc1, 0x69, 0x3e, 0x37, 0x3e,
+  0x08, 0x0f, 0xc0, 0x0a, 0x03, 0xc1, 0x08, 0x03, 0x3e, 0x03, 0xc2, 0x3e, 0xc0, 0x03, 0xc5, 0x3e,
+  0x03, 0xc7, 0x08, 0x03, 0xc1, 0x0f, 0xc1, 0x14, 0xc0, 0x0f, 0xc4, 0x14, 0xc1, 0x0f, 0x14, 0xc1,
+  0x0f, 0x14, 0xc3, 0x0f, 0xd1, 0x14, 0xc5, 0x6b, 0xc2, 0x0f, 0x1b, 0x14, 0xc2, 0x1b, 0xc3, 0x0f,
+  0x1b, 0x0f, 0x1b, 0xc0, 0x6e, 0xc0, 0x1b, 0xc3, 0x0f, 0x1b, 0xc2, 0x0f, 0x6b, 0xc1, 0x1b, 0xc4,
+  0x16, 0x1b, 0xc1, 0x16, 0x1b, 0xc0, 0x16, 0x1b, 0x0f, 0x1b, 0xc0, 0x16, 0xc0, 0x1b, 0xc2, 0x16,
+  0x1b, 0xc3, 0x16, 0xc7, 0x1b, 0xc0, 0x16, 0xc3, 0x1b, 0xc6, 0x16, 0xca, 0x1b, 0xc0, 0x16, 0xc2,
+  0x1b, 0xc4, 0x6b, 0xc0, 0x1b, 0xc0, 0x22, 0x6e, 0xc1, 0xfe, 0x13, 0xf4, 0xc1, 0x6e, 0xc0, 0x2d,
+  0xc0, 0x32, 0x2d, 0x32, 0xc2, 0x2d, 0xc0, 0x32, 0xc2, 0x6f, 0xc0, 0x32, 0xc6, 0x3e, 0xc0, 0x6e,
+  0x3e, 0xc3, 0x66, 0x3e, 0xc0, 0x32, 0x3e, 0xd6, 0x03, 0x3e, 0xc0, 0x03, 0xc1, 0x6f, 0xc1, 0x6e,
+  0xc0, 0x65, 0xc2, 0x0f, 0x08, 0x0f, 0xc4, 0x14, 0xc3, 0x0f, 0x03, 0xc8, 0x3e, 0x69, 0x3e, 0x03,
+  0xc0, 0x3e, 0xc0, 0x03, 0xc5, 0x3e, 0x03, 0xd8, 0x3e, 0x03, 0xc0, 0x0f, 0xc1, 0x14, 0xc0, 0x0f,
+  0xc4, 0x14, 0xc0, 0x0f, 0x14, 0xc2, 0x0f, 0x14, 0xc3, 0x0f, 0xc0, 0x14, 0xc0, 0x0f, 0xc8, 0x14,
+  0xc0, 0x0f, 0xc0, 0x14, 0x0f, 0xc0, 0x14, 0xc2, 0x6b, 0xc2, 0x0f, 0xc0, 0x1b, 0x14, 0xc2, 0x0f,
+  0xc0, 0x1b, 0x0f, 0xc1, 0x1b, 0x0f, 0xc0, 0x1b, 0xc6, 0x0f, 0xc1, 0x1b, 0xc2, 0x66, 0x1b, 0x6e,
+  0xc0, 0x1b, 0xc2, 0x16, 0x1b, 0x16, 0xc3, 0x1b, 0xc0, 0x0f, 0xc0, 0x1b, 0x16, 0xc0, 0x1b, 0xc2,
+  0x16, 0x1b, 0xc1, 0x16, 0xc0, 0x1b, 0xc4, 0x16, 0xc0, 0x1b, 0xc2, 0x16, 0xc1, 0x1b, 0xc7, 0x16,
+  0xca, 0x1b, 0xc1, 0x16, 0xc1, 0x1b, 0xc5, 0x6b, 0xc2, 0x1b, 0xc0, 0x6f, 0xfe, 0x13, 0xf4, 0xc2,
+  0x6e, 0x2d, 0xc2, 0x32, 0x2d, 0xc0, 0x32, 0x2d, 0xc1, 0x32, 0xc3, 0x2d, 0x32, 0xc4, 0x6f, 0xc6,
+  0x32, 0xc0, 0x3e, 0x32, 0xc1, 0x3e, 0xcc, 0x6e, 0xc1, 0x3e, 0xc2, 0x03, 0xc0, 0x3e, 0xc1, 0x03,
+  0xc1, 0x6f, 0xc4, 0x03, 0xc2, 0x6e, 0x0f, 0xc1, 0x08, 0x0f, 0xc0, 0x6e, 0xc3, 0x0f, 0x66, 0x03,
+  0xc7, 0x3e, 0xc1, 0x03, 0xc1, 0x7a, 0x03, 0xc3, 0x3e, 0x03, 0x3e, 0xc4, 0x03, 0xd5, 0x08, 0x0f,
+  0xc2, 0x14, 0x0f, 0xc4, 0x14, 0x0f, 0xc0, 0x14, 0x6e, 0x14, 0xc6, 0x0f, 0xc1, 0x14, 0x0f, 0xc8,
+  0x14, 0x0f, 0xc2, 0x14, 0x0f, 0x6f, 0x0f, 0xc2, 0x1b, 0xc0, 0x14, 0x0f, 0x1b, 0xc1, 0x0f, 0xca,
+  0x1b, 0xc8, 0x0f, 0x1b, 0xc1, 0x66, 0xc0, 0x1b, 0xc5, 0x16, 0xc2, 0x1b, 0xc2, 0x0f, 0xc0, 0x1b,
+  0xc1, 0x16, 0x1b, 0xc6, 0x16, 0xc0, 0x1b, 0x16, 0x1b, 0xc2, 0x16, 0xc0, 0x1b, 0xc2, 0x16, 0xc1,
+  0x1b, 0x16, 0x1b, 0xc5, 0x16, 0xcb, 0x1b, 0xc0, 0x16, 0xc1, 0x1b, 0xc1, 0x6b, 0xc0, 0x1b, 0xc0,
+  0x22, 0xc0, 0x1b, 0xc2, 0x6f, 0xfe, 0x13, 0xf4, 0xc2, 0x6e, 0x2d, 0xc6, 0x32, 0xc0, 0x2d, 0xc0,
+  0x32, 0xc1, 0x2d, 0xc0, 0x32, 0xc0, 0x6f, 0xc0, 0x32, 0xc0, 0x3e, 0xc6, 0x32, 0xc1, 0x6e, 0x32,
+  0xc0, 0x3e, 0xc0, 0x32, 0x3e, 0xc0, 0x32, 0x37, 0x3e, 0xc5, 0x6e, 0xc1, 0x3e, 0xc0, 0x37, 0xc0,
+  0x3e, 0xc1, 0x03, 0xc2, 0x6f, 0xc1, 0x6e, 0x0f, 0xc0, 0x03, 0xc3, 0x6e, 0x0f, 0xc0, 0x14, 0x0f,
+  0xc2, 0x14, 0x0f, 0xc2, 0x66, 0x03, 0xc6, 0x3e, 0x37, 0x3e, 0x03, 0xc0, 0x08, 0x03, 0xc2, 0x3e,
+  0x03, 0xc6, 0x3e, 0x03, 0xc0, 0x3e, 0x03, 0xd2, 0x0f, 0xc1, 0x14, 0xc4, 0x0f, 0xc2, 0x14, 0xc2,
+  0x6e, 0x14, 0xc5, 0x0f, 0x14, 0x0f, 0xc2, 0x6f, 0x14, 0x0f, 0xc0, 0x0a, 0x0f, 0xce, 0x1b, 0xc0,
+  0x14, 0x0f, 0x1b, 0xc0, 0x0f, 0xcb, 0x1b, 0xd8, 0x66, 0x1b, 0x16, 0x0f, 0x1b, 0xc3, 0x16, 0xc0,
+  0x1b, 0xc3, 0x16, 0xc3, 0x1b, 0xc0, 0x16, 0xc4, 0x1b, 0xc2, 0x16, 0xc1, 0x1b, 0x16, 0xc0, 0x1b,
+  0xc1, 0x6b, 0x1b, 0xc1, 0x16, 0xc8, 0x1b, 0x16, 0x1b, 0x16, 0xc2, 0x1b, 0xc4, 0x16, 0xc0, 0x1b,
+  0xc1, 0x22, 0xc1, 0xfe, 0x13, 0xf4, 0xc1, 0x69, 0x2d, 0xc2, 0x6e, 0xc0, 0x2d, 0xc5, 0x32, 0xc4,
+  0x6b, 0x6e, 0x32, 0x3e, 0xc1, 0x6e, 0x3e, 0xc0, 0x39, 0xc0, 0x3e, 0xc0, 0x32, 0xc3, 0x3e, 0xc3,
+  0x32, 0x3e, 0xc0, 0x32, 0xc0, 0x3e, 0xc3, 0x03, 0x3e, 0xc8, 0x03, 0xc1, 0x6e, 0x6b, 0xc1, 0x08,
+  0x03, 0xc4, 0x08, 0xc1, 0x0f, 0xc2, 0x6e, 0xc2, 0x0f, 0x03, 0xc7, 0x3e, 0x69, 0x3e, 0x03, 0xd4,
+  0x08, 0x03, 0xcb, 0x08, 0x03, 0xc1, 0x0f, 0xc1, 0x14, 0x0f, 0x14, 0x6b, 0x14, 0xc3, 0x0f, 0x14,
+  0xd0, 0x0f, 0x14, 0x0f, 0xc4, 0x14, 0x0f, 0xc3, 0x14, 0xc0, 0x0f, 0xc2, 0x1b, 0xc2, 0x0f, 0xc1,
+  0x1b, 0x0f, 0xc4, 0x1b, 0x0f, 0xc1, 0x1b, 0x0f, 0x14, 0x1b, 0xc6, 0x0f, 0x14, 0x1b, 0xc1, 0x66,
+  0xc0, 0x1b, 0xc3, 0x16, 0x1b, 0xc0, 0x16, 0x1b, 0xc0, 0x16, 0xc1, 0x0f, 0xc0, 0x14, 0x0f, 0xc0,
+  0x1b, 0xc1, 0x16, 0x1b, 0xc3, 0x16, 0x1b, 0x16, 0xc0, 0x1b, 0xc5, 0x16, 0x1b, 0xc1, 0x16, 0x1b,
+  0x16, 0xc1, 0x1b, 0x16, 0x1b, 0xc1, 0x6f, 0x1b, 0xc1, 0x16, 0xc2, 0x1b, 0xc1, 0x16, 0xc2, 0x1b,
+  0x16, 0xc6, 0x1b, 0xc7, 0x6b, 0xc0, 0xfe, 0x13, 0xf4, 0xc6, 0x6e, 0xc0, 0x2d, 0xc5, 0x32, 0xc4,
+  0x6b, 0x6e, 0xc5, 0x39, 0xc1, 0x3e, 0xc2, 0x32, 0x3e, 0x32, 0x3e, 0xc3, 0x32, 0x39, 0xc1, 0x3e,
+  0x39, 0x3e, 0xc1, 0x6e, 0x3e, 0xca, 0x03, 0xc0, 0x6f, 0xc2, 0x03, 0xc6, 0x0f, 0xc6, 0x6e, 0x0f,
+  0xc0, 0x03, 0xc7, 0x3e, 0xc0, 0x03, 0xd2, 0x3e, 0x03, 0xc1, 0x0f, 0x03, 0xce, 0x0f, 0xc3, 0x14,
+  0x6b, 0x14, 0xc0, 0x0f, 0xc3, 0x14, 0xcb, 0x0f, 0xc0, 0x14, 0x0f, 0xc1, 0x14, 0x0f, 0xca, 0x14,
+  0x0f, 0xc4, 0x1b, 0xc0, 0x0f, 0xc1, 0x1b, 0x0f, 0xc4, 0x1b, 0x0f, 0xc4, 0x1b, 0xc4, 0x66, 0x1b,
+  0x16, 0x0f, 0x16, 0x1b, 0x16, 0x0f, 0x16, 0x1b, 0xc8, 0x16, 0x1b, 0xc0, 0x16, 0x0f, 0xc3, 0x1b,
+  0x16, 0x1b, 0x16, 0x1b, 0xc3, 0x16, 0x1b, 0xc0, 0x16, 0xc0, 0x1b, 0x16, 0xc1, 0x1b, 0x16, 0xc1,
+  0x1b, 0xc0, 0x16, 0xc3, 0x1b, 0xc6, 0x16, 0xca, 0x1b, 0x16, 0xc1, 0x1b, 0x16, 0xc1, 0x1b, 0xc4,
+  0x6b, 0x6e, 0x1b, 0xc0, 0x27, 0x1b, 0xfe, 0x13, 0xf4, 0xcd, 0x6e, 0xc5, 0x6b, 0xc0, 0x6e, 0xc4,
+  0x39, 0xc1, 0x3e, 0xc3, 0x32, 0x3e, 0x32, 0x3e, 0xc0, 0x32, 0x3e, 0xc0, 0x39, 0xc0, 0x3e, 0x39,
+  0xc2, 0x3e, 0x6e, 0x3e, 0xc0, 0x39, 0xc1, 0x3e, 0xc0, 0x39, 0xc0, 0x3e, 0xc2, 0x03, 0xc0, 0x6b,
+  0x6e, 0xc0, 0x0a, 0x03, 0xc6, 0x0f, 0xc4, 0x6e, 0xc0, 0x0f, 0xc1, 0x03, 0xc7, 0x3e, 0xc0, 0x03,
+  0xcd, 0x3e, 0x03, 0x3e, 0xc3, 0x03, 0xd1, 0x0a, 0x0f, 0xc3, 0x14, 0xc0, 0x0f, 0xc6, 0x14, 0xc5,
+  0x0f, 0xc2, 0x14, 0x0f, 0xd5, 0x6f, 0x0f, 0x1b, 0xc1, 0x0f, 0xcc, 0x1b, 0x66, 0xc0, 0x1b, 0xc7,
+  0x16, 0x1b, 0x16, 0xc1, 0x1b, 0xc1, 0x16, 0x1b, 0xc2, 0x16, 0xc2, 0x1b, 0xc0, 0x16, 0x0f, 0xc0,
+  0x1b, 0x16, 0x1b, 0x16, 0x1b, 0xc3, 0x16, 0xc1, 0x1b, 0xc1, 0x16, 0xc7, 0x1b, 0xc1, 0x16, 0xc4,
+  0x1b, 0x16, 0x1b, 0xc2, 0x16, 0xce, 0x1b, 0x16, 0xc1, 0x1b, 0xc0, 0x6b, 0xc0, 0x1b, 0xc0, 0x6f,
+  0xc1, 0x1b, 0xc1, 0xfe, 0x13, 0xf4, 0xc8, 0x6e, 0xc1, 0x2d, 0x32, 0xc6, 0x6b, 0x6e, 0x32, 0x3e,
+  0xc1, 0x6e, 0x3e, 0x39, 0x3e, 0x39, 0x3e, 0xc0, 0x32, 0x3e, 0xc2, 0x32, 0x3e, 0xc0, 0x39, 0xc2,
+  0x3e, 0x39, 0xc2, 0x3e, 0xc2, 0x39, 0xc7, 0x3e, 0xc1, 0x03, 0xc0, 0x6b, 0xc0, 0x03, 0xc8, 0x6f,
+  0xc0, 0x6e, 0x0f, 0xc1, 0x14, 0xc0, 0x0f, 0xc0, 0x03, 0xc7, 0x3e, 0xc1, 0x03, 0xca, 0x3e, 0xc9,
+  0x03, 0xd1, 0x0a, 0x0f, 0xc2, 0x14, 0xc0, 0x0f, 0xc5, 0x14, 0xc2, 0x0f, 0xc0, 0x14, 0xc1, 0x0f,
+  0xd9, 0x6f, 0x0f, 0xd0, 0x1b, 0x66, 0xc0, 0x1b, 0xc4, 0x16, 0x1b, 0x0f, 0x1b, 0xc0, 0x16, 0xc1,
+  0x1b, 0xc1, 0x16, 0xc0, 0x1b, 0xc5, 0x16, 0x1b, 0xc0, 0x16, 0xc2, 0x1b, 0x16, 0x1b, 0xc4, 0x16,
+  0xc1, 0x1b, 0xc0, 0x16, 0xc7, 0x1b, 0xc1, 0x16, 0xc6, 0x1b, 0xc0, 0x16, 0xd4, 0x1b, 0xc1, 0x6b,
+  0x1b, 0xc5, 0x6f, 0xfe, 0x13, 0xf4, 0xc6, 0x6e, 0xcc, 0x6f, 0x66, 0x32, 0xc0, 0x3e, 0xc1, 0x39,
+  0xc0, 0x3e, 0x39, 0xc0, 0x3e, 0x32, 0xc4, 0x3e, 0xc0, 0x39, 0xc2, 0x3e, 0xc0, 0x39, 0xc2, 0x3e,
+  0xc2, 0x39, 0xc0, 0x3e, 0xc0, 0x39, 0xc0, 0x3e, 0x39, 0x3e, 0xc1, 0x6e, 0xc1, 0x6b, 0x03, 0xc8,
+  0x6f, 0x6e, 0xc1, 0x0f, 0xc0, 0x14, 0xc1, 0x0f, 0x03, 0xc7, 0x3e, 0xc2, 0x03, 0xc8, 0x3e, 0xca,
+  0x03, 0xc3, 0x3e, 0x03, 0xcb, 0x0a, 0x0f, 0xc2, 0x14, 0xc0, 0x0f, 0xc6, 0x14, 0xc0, 0x0f, 0xc0,
+  0x14, 0xc2, 0x0f, 0xdc, 0x6f, 0x0f, 0xca, 0x1b, 0x0f, 0xc1, 0x6b, 0x1b, 0xc5, 0x16, 0x1b, 0x0f,
+  0x1b, 0xc0, 0x16, 0xc1, 0x1b, 0xc1, 0x16, 0xc0, 0x1b, 0xc2, 0x16, 0x1b, 0xc0, 0x16, 0xc5, 0x1b,
+  0x16, 0xc2, 0x1b, 0x16, 0xc5, 0x1b, 0xc0, 0x16, 0xc6, 0x1b, 0xc0, 0x16, 0xc6, 0x1b, 0xc1, 0x16,
+  0xc0, 0x1b, 0xc0, 0x16, 0xcf, 0x1b, 0xca, 0xfe, 0x13, 0xf4, 0xc6, 0x6e, 0xc1, 0x2d, 0xc3, 0x32,
+  0xc3, 0x6f, 0xc1, 0x66, 0xc0, 0x3e, 0xc1, 0x39, 0xc3, 0x32, 0xc0, 0x39, 0xc1, 0x32, 0xc0, 0x39,
+  0xca, 0x3e, 0xc3, 0x39, 0x3e, 0xc0, 0x32, 0x39, 0x3e, 0xc3, 0x6e, 0xcb, 0x6e, 0x6f, 0xc0, 0x66,
+  0xc1, 0x14, 0xc1, 0x0f, 0xc0, 0x03, 0xc7, 0x3e, 0xc3, 0x03, 0xc5, 0x3e, 0xc8, 0x39, 0x3e, 0xc0,
+  0x03, 0xc1, 0x3e, 0xc3, 0x03, 0xc5, 0x3e, 0xc1, 0x03, 0xc0, 0x0f, 0xc4, 0x14, 0x0f, 0xc2, 0x66,
+  0x0f, 0xc5, 0x14, 0xc4, 0x0f, 0xda, 0x6f, 0x0f, 0xcf, 0x1b, 0xc3, 0x66, 0x1b, 0xc4, 0x16, 0xc1,
+  0x1b, 0xc6, 0x16, 0xc0, 0x1b, 0xc1, 0x16, 0xc4, 0x1b, 0xc0, 0x16, 0xc9, 0x1b, 0xc0, 0x16, 0xce,
+  0x1b, 0x16, 0x1b, 0xc5, 0x16, 0xd0, 0x1b, 0xc1, 0x16, 0x1b, 0xc1, 0x16, 0xc0, 0x1b, 0xc0, 0xfe,
+  0x13, 0xf4, 0xc6, 0x6e, 0xc0, 0x2d, 0xc3, 0x32, 0xc4, 0x6f, 0xc0, 0x66, 0xc0, 0x3e, 0xc1, 0x39,
+  0xc4, 0x32, 0x39, 0xc5, 0x3e, 0x39, 0xcb, 0x3e, 0xc1, 0x39, 0x32, 0xc0, 0x3e, 0x39, 0xc1, 0x3e,
+  0xc0, 0x6e, 0xc4, 0x3e, 0xc1, 0x03, 0xc2, 0x6f, 0xc0, 0x6e, 0x0f, 0xc1, 0x14, 0xc0, 0x0f, 0xc0,
+  0x03, 0xc8, 0x3e, 0xc3, 0x03, 0xc6, 0x3e, 0xc6, 0x39, 0xc0, 0x3e, 0xc0, 0x03, 0xc0, 0x3e, 0xc4,
+  0x03, 0xc5, 0x3e, 0xc1, 0x03, 0xc0, 0x0f, 0xd2, 0x14, 0xc2, 0x0f, 0xcf, 0x66, 0x0f, 0xc9, 0x6b,
+  0x0f, 0xc9, 0x6f, 0x0f, 0xc4, 0x1b, 0xc2, 0x16, 0xc2, 0x1b, 0x16, 0xc2, 0x1b, 0xc0, 0x16, 0xc2,
+  0x1b, 0xc0, 0x16, 0xc0, 0x1b, 0x16, 0xcb, 0x1b, 0xc2, 0x16, 0xd8, 0x1b, 0xc4, 0x16, 0xc6, 0x66,
+  0x16, 0xc7, 0x1b, 0xc5, 0x16, 0xc0, 0x1b, 0xc0, 0xfe, 0x13, 0xf4, 0xc6, 0x6e, 0xc0, 0x2d, 0xc4,
+  0x32, 0xc2, 0x6f, 0xc1, 0x66, 0x3e, 0x6e, 0xc0, 0x3e, 0xc0, 0x39, 0xcb, 0x3e, 0x39, 0xc1, 0x32,
+  0x39, 0xc2, 0x3e, 0x39, 0xc2, 0x3e, 0x39, 0xc2, 0x32, 0xc0, 0x3e, 0x39, 0xc0, 0x3e, 0xc0, 0x03,
+  0xc4, 0x3e, 0xc0, 0x03, 0xc3, 0x6f, 0xc4, 0x6e, 0xc0, 0x0f, 0xc0, 0x03, 0xc8, 0x3e, 0xc2, 0x03,
+  0xc8, 0x3e, 0x03, 0xc0, 0x3e, 0xc2, 0x39, 0xc0, 0x3e, 0xc0, 0x03, 0xc0, 0x3e, 0xc4, 0x03, 0xc5,
+  0x3e, 0xc2, 0x03, 0x0f, 0xd2, 0x14, 0xc1, 0x0f, 0xd0, 0x66, 0x0f, 0x0a, 0x0f, 0xc6, 0x6b, 0xc0,
+  0x0f, 0xcf, 0x6f, 0xc4, 0x16, 0xc0, 0x1b, 0x0f, 0x1b, 0xc0, 0x16, 0xc0, 0x1b, 0xc1, 0x16, 0xc0,
+  0x1b, 0xc3, 0x16, 0xcc, 0x1b, 0xc2, 0x16, 0xd9, 0x1b, 0xc1, 0x16, 0x1b, 0x16, 0xc4, 0x66, 0x16,
+  0xca, 0x1b, 0xc0, 0x6b, 0x1b, 0xc5, 0xfe, 0x13, 0xf4, 0xcc, 0x6e, 0x2d, 0xc0, 0x32, 0x6b, 0xc4,
+  0x6e, 0x6e, 0x3e, 0xc0, 0x39, 0x32, 0x3e, 0x32, 0x39, 0xc6, 0x3e, 0x39, 0xc5, 0x32, 0x3e, 0x39,
+  0xc5, 0x3e, 0xc0, 0x39, 0xc3, 0x32, 0xc0, 0x3e, 0x03, 0xc6, 0x3e, 0xc0, 0x03, 0xc2, 0x6f, 0xc3,
+  0x6e, 0xc1, 0x0f, 0x03, 0xc4, 0x3e, 0x03, 0xc1, 0x3e, 0xc5, 0x03, 0xc1, 0x3e, 0x03, 0x3e, 0xc0,
+  0x03, 0xc2, 0x3e, 0xc1, 0x39, 0xc0, 0x3e, 0xc1, 0x03, 0xc0, 0x3e, 0xc1, 0x03, 0xc4, 0x3e, 0x03,
+  0xc6, 0x6b, 0x0f, 0xc5, 0x0a, 0xc0, 0x0f, 0xc8, 0x14, 0xc2, 0x0f, 0xc4, 0x0a, 0x0f, 0xc1, 0x0a,
+  0xc0, 0x0f, 0xc4, 0x0a, 0xc0, 0x0f, 0xda, 0x6f, 0xc2, 0x66, 0xc0, 0x1b, 0x14, 0xc0, 0x0f, 0x16,
+  0xc2, 0x0f, 0x1b, 0x16, 0xc0, 0x1b, 0x16, 0xc0, 0x1b, 0xc0, 0x16, 0x1b, 0xc0, 0x16, 0x1b, 0xc0,
+  0x16, 0xc6, 0x1b, 0x16, 0x1b, 0xc1, 0x16, 0xc3, 0x0f, 0x16, 0xc4, 0x66, 0x16, 0xc7, 0x1b, 0xc1,
+  0x16, 0xda, 0x1b, 0x16, 0x1b, 0xc3, 0xfe, 0x13, 0xf4, 0xce, 0x6e, 0xc0, 0x6b, 0xc3, 0x6e, 0xc2,
+  0x39, 0xc1, 0x32, 0xc0, 0x39, 0xce, 0x32, 0x3e, 0x39, 0xce, 0x3e, 0x6e, 0xc3, 0x3e, 0x03, 0xc0,
+  0x3e, 0xc1, 0x03, 0xc1, 0x6f, 0xc3, 0x6e, 0xc1, 0x0f, 0x03, 0xc3, 0x6b, 0x03, 0xc1, 0x3e, 0xc6,
+  0x03, 0xc1, 0x3e, 0xc9, 0x39, 0xc0, 0x3e, 0xc1, 0x03, 0xc0, 0x3e, 0xc1, 0x03, 0xc3, 0x3e, 0xc1,
+  0x03, 0xc1, 0x3e, 0x03, 0xc2, 0x0a, 0x0f, 0xc5, 0x0a, 0x0f, 0x0a, 0x0f, 0xc0, 0x7a, 0x0f, 0xcf,
+  0x0a, 0x0f, 0xc0, 0x0a, 0xc0, 0x0f, 0xc3, 0x0a, 0xc1, 0x0f, 0xd9, 0x6f, 0xc3, 0x66, 0x0f, 0xc2,
+  0x16, 0xc0, 0x1b, 0x16, 0xc0, 0x1b, 0x16, 0xc0, 0x1b, 0x16, 0xc0, 0x1b, 0xc2, 0x16, 0xca, 0x1b,
+  0x16, 0x1b, 0xc0, 0x16, 0xcb, 0x66, 0x16, 0xc9, 0x1b, 0x16, 0xc5, 0x11, 0xc0, 0x16, 0xd5, 0x1b,
+  0xc1, 0xfe, 0x13, 0xf4, 0xcc, 0x6e, 0xc1, 0x6f, 0x66, 0xc0, 0x3e, 0xc0, 0x39, 0xc1, 0x3e, 0xc0,
+  0x39, 0xd6, 0x3e, 0xc0, 0x39, 0xc2, 0x3e, 0xc0, 0x39, 0xc4, 0x3e, 0xc0, 0x6e, 0xc5, 0x3e, 0xc3,
+  0x03, 0x6b, 0x6d, 0x6b, 0xc2, 0x6e, 0xc0, 0x0f, 0xc0, 0x03, 0xc8, 0x3e, 0xc6, 0x03, 0x3e, 0xc8,
+  0x39, 0xc2, 0x3e, 0xc1, 0x03, 0x3e, 0xc4, 0x03, 0xc1, 0x3e, 0xc2, 0x03, 0xc0, 0x3e, 0xc0, 0x03,
+  0xc1, 0x0a, 0x0f, 0xc5, 0x0a, 0x0f, 0x0a, 0x0f, 0xc1, 0x0a, 0x0f, 0xc9, 0x0a, 0x0f, 0xc0, 0x0a,
+  0xc0, 0x0f, 0xc1, 0x0a, 0xc1, 0x0f, 0xc1, 0x0a, 0xc2, 0x0f, 0x0a, 0x0f, 0xd7, 0x6f, 0xc2, 0x66,
+  0xc2, 0x0f, 0x16, 0x1b, 0x16, 0x1b, 0x16, 0xc2, 0x1b, 0xc0, 0x16, 0xc0, 0x1b, 0xc1, 0x16, 0xc2,
+  0x0f, 0x16, 0xc2, 0x0f, 0xc0, 0x16, 0xc0, 0x1b, 0xc2, 0x16, 0xc7, 0x66, 0xc0, 0x16, 0xcf, 0x1b,
+  0x16, 0xc3, 0x11, 0x16, 0xc2, 0x11, 0xc0, 0x16, 0xc2, 0x1b, 0x16, 0xcb, 0x1b, 0xc0, 0xfe, 0x13,
+  0xf4, 0xcc, 0x6f, 0xc0, 0x69, 0xc0, 0x39, 0x6e, 0xc2, 0x32, 0x39, 0x3e, 0x39, 0xc7, 0x2d, 0xc0,
+  0x32, 0x39, 0xcb, 0x3e, 0xc0, 0x39, 0xca, 0x3e, 0xc0, 0x6e, 0xc4, 0x3e, 0xc4, 0x03, 0x6f, 0xc3,
+  0x6e, 0xc1, 0x0f, 0x66, 0x03, 0xc8, 0x3e, 0xc6, 0x03, 0x3e, 0xc8, 0x39, 0x3e, 0xc0, 0x39, 0x3e,
+  0xc8, 0x03, 0xc2, 0x3e, 0xc5, 0x03, 0xc1, 0x0f, 0xc5, 0x0a, 0xc0, 0x0f, 0xc3, 0x0a, 0x0f, 0xc9,
+  0x0a, 0x0f, 0xc0, 0x0a, 0xc5, 0x0f, 0x0a, 0x0f, 0xc0, 0x0a, 0xc2, 0x0f, 0x0a, 0x0f, 0xd7, 0x6b,
+  0x6e, 0xc1, 0x16, 0xc4, 0x1b, 0x16, 0xc5, 0x1b, 0xc4, 0x16, 0xcb, 0x1b, 0xc1, 0x16, 0x1b, 0xc0,
+  0x16, 0xc5, 0x0f, 0x67, 0x16, 0xd9, 0x11, 0xc2, 0x16, 0xd0, 0x1b, 0xfe, 0x13, 0xd4, 0xc0, 0x6e,
+  0xc9, 0x6e, 0x6b, 0xc0, 0x32, 0x39, 0xc1, 0x32, 0xc0, 0x6f, 0xc0, 0x32, 0x3e, 0x39, 0xd7, 0x3e,
+  0xc0, 0x39, 0xca, 0x3e, 0xc1, 0x6e, 0xc0, 0x3e, 0xc7, 0x03, 0x6e, 0x6b, 0xc2, 0x6e, 0xc1, 0x0f,
+  0x03, 0xc1, 0x3e, 0x03, 0xc4, 0x3e, 0xd2, 0x39, 0xc2, 0x3e, 0xc8, 0x03, 0xc0, 0x3e, 0xc7, 0x03,
+  0xc0, 0x6b, 0x0f, 0xc1, 0x0a, 0xc5, 0x0f, 0xc1, 0x0a, 0xc0, 0x0f, 0xc9, 0x0a, 0xc0, 0x0f, 0xc0,
+  0x0a, 0xc4, 0x0f, 0xc2, 0x0a, 0xc5, 0x0f, 0xd6, 0x6b, 0x6e, 0xc0, 0x16, 0xc0, 0x1b, 0xc0, 0x16,
+  0xc1, 0x1b, 0x16, 0xc1, 0x0f, 0x16, 0xc2, 0x1b, 0xc1, 0x16, 0x1b, 0xc0, 0x16, 0x1b, 0x16, 0xc6,
+  0x0f, 0x16, 0x1b, 0x16, 0x1b, 0xc0, 0x16, 0xc8, 0x0a, 0xc0, 0x16, 0xc1, 0x66, 0x16, 0xd3, 0x11,
+  0xc3, 0x16, 0xd0, 0x1b, 0xfe, 0x13, 0xd3, 0xc0, 0x6f, 0xc9, 0x6e, 0xc0, 0x6b, 0x32, 0x39, 0xc1,
+  0x6e, 0x32, 0x3e, 0x39, 0xc7, 0x32, 0xc0, 0x2d, 0xc0, 0x39, 0xcd, 0x3e, 0x39, 0xcb, 0x3e, 0xc2,
+  0x6e, 0x3e, 0xc6, 0x03, 0xc0, 0x6e, 0x6b, 0xc0, 0x08, 0x0f, 0x6e, 0xc1, 0x62, 0x03, 0xc2, 0x3e,
+  0x03, 0xc2, 0x3e, 0xc5, 0x39, 0x3e, 0xca, 0x39, 0xc3, 0x3e, 0xc8, 0x03, 0x3e, 0xc8, 0x03, 0xc0,
+  0x0f, 0xc3, 0x0a, 0xc5, 0x0f, 0xc0, 0x0a, 0xc1, 0x0f, 0xcb, 0x0a, 0xc6, 0x0f, 0xc2, 0x0a, 0xc1,
+  0x0f, 0x0a, 0xc0, 0x0f, 0xcb, 0x0a, 0x0f, 0xc8, 0x6b, 0x6e, 0xc4, 0x16, 0x1b, 0xc1, 0x16, 0xc3,
+  0x1b, 0x16, 0xc1, 0x1b, 0x16, 0x1b, 0xc1, 0x16, 0x1b, 0x16, 0xc6, 0x0f, 0x16, 0xc2, 0x1b, 0x16,
+  0xc6, 0x0f, 0xc2, 0x16, 0xc0, 0x66, 0x16, 0xca, 0x1b, 0x16, 0xc7, 0x11, 0xc3, 0x16, 0xd0, 0x1b,
+  0xfe, 0x13, 0xd4, 0xc0, 0x6e, 0xc9, 0x6e, 0x6b, 0xd0, 0x2d, 0xc2, 0x39, 0xd5, 0x32, 0x2d, 0x32,
+  0x39, 0xc1, 0x6e, 0xcb, 0x6e, 0xc0, 0x6f, 0xc1, 0x03, 0x0f, 0xc2, 0x03, 0xc3, 0x3e, 0xc0, 0x03,
+  0xc1, 0x3e, 0xc5, 0x39, 0xc0, 0x3e, 0xc6, 0x39, 0xc1, 0x3e, 0xc0, 0x39, 0xc2, 0x3e, 0xd2, 0x03,
+  0xc1, 0x0f, 0xc2, 0x66, 0xc2, 0x0f, 0x0a, 0xc4, 0x0f, 0xca, 0x0a, 0xc0, 0x0f, 0x0a, 0xc4, 0x0f,
+  0x0a, 0xc0, 0x0f, 0x0a, 0xc2, 0x0f, 0x0a, 0xc0, 0x0f, 0xc7, 0x0a, 0xc1, 0x0f, 0xc6, 0x0a, 0xc0,
+  0x0f, 0xc0, 0x6b, 0x6e, 0xc2, 0x16, 0xc2, 0x1b, 0x16, 0xc8, 0x1b, 0x16, 0x1b, 0xc0, 0x16, 0xc0,
+  0x1b, 0x16, 0xce, 0x0f, 0xc1, 0x16, 0x0f, 0xc4, 0x0a, 0x16, 0x66, 0x16, 0xc2, 0x11, 0xc1, 0x16,
+  0xcc, 0x11, 0xc3, 0x16, 0xc1, 0x11, 0x16, 0xce, 0xfe, 0x13, 0xd4, 0xc1, 0x6e, 0xc8, 0x6e, 0x6b,
+  0xcb, 0x32, 0xc0, 0x39, 0xc1, 0x2d, 0xc1, 0x32, 0xc0, 0x39, 0xd0, 0x32, 0x39, 0xc1, 0x32, 0x2d,
+  0x39, 0xc2, 0x6e, 0xca, 0x6e, 0xc1, 0x6f, 0xc0, 0x66, 0xc0, 0x0f, 0xc2, 0x03, 0xc2, 0x3e, 0xc8,
+  0x39, 0xc0, 0x3e, 0xc4, 0x39, 0xc0, 0x3e, 0x39, 0xc1, 0x3e, 0x39, 0x3e, 0x32, 0xc0, 0x39, 0xc1,
+  0x3e, 0xd3, 0x03, 0xc0, 0x0a, 0x0f, 0xc0, 0x0a, 0xca, 0x0f, 0xc8, 0x0a, 0xc2, 0x0f, 0x0a, 0xc0,
+  0x66, 0xc0, 0x0a, 0xcb, 0x0f, 0x0a, 0x0f, 0xc4, 0x0a, 0xc2, 0x0f, 0xc0, 0x0a, 0x0f, 0x0a, 0x0f,
+  0xc1, 0x0a, 0xc0, 0x0f, 0xc0, 0x6b, 0x6e, 0x16, 0xca, 0x0f, 0x16, 0xc4, 0x1b, 0x16, 0xcd, 0x0f,
+  0x16, 0xc3, 0x0f, 0xc1, 0x0a, 0x0f, 0x0a, 0xc0, 0x0f, 0x0a, 0xc0, 0x0f, 0x67, 0x0a, 0xc1, 0x16,
+  0xc0, 0x11, 0xc3, 0x16, 0xc3, 0x1b, 0x16, 0xc4, 0x11, 0xc0, 0x16, 0x11, 0xc2, 0x16, 0xd0, 0xfe,
+  0x13, 0xd3, 0xc0, 0x6b, 0xc0, 0x6e, 0xc2, 0x28, 0x2d, 0xc1, 0x6f, 0xc0, 0x69, 0x39, 0x32, 0x39,
+  0xc1, 0x32, 0xc0, 0x6f, 0x39, 0xc1, 0x32, 0x2d, 0x32, 0x39, 0xc0, 0x32, 0x2d, 0x32, 0xc1, 0x39,
+  0xc0, 0x32, 0x3e, 0x39, 0xc1, 0x2d, 0x32, 0x39, 0x32, 0xc0, 0x39, 0xc9, 0x32, 0xc0, 0x39, 0xc2,
+  0x3e, 0xc7, 0x39, 0x3e, 0xc1, 0x6e, 0xc0, 0x6f, 0xc0, 0x66, 0x0f, 0xc2, 0x03, 0x3e, 0xc1, 0x03,
+  0x3e, 0x0a, 0x66, 0x3e, 0xc4, 0x39, 0x3e, 0xc5, 0x39, 0xc3, 0x3e, 0x39, 0xc6, 0x3e, 0xc4, 0x39,
+  0x3e, 0xce, 0x03, 0x0a, 0xc0, 0x0f, 0x0a, 0xc4, 0x03, 0x0a, 0xc4, 0x0f, 0xc8, 0x0a, 0xc1, 0x0f,
+  0x0a, 0xc2, 0x05, 0xc0, 0x0a, 0xc8, 0x0f, 0xc2, 0x0a, 0x0f, 0xc2, 0x0a, 0xc1, 0x0f, 0xc7, 0x0a,
+  0x0f, 0xc0, 0x6b, 0xc1, 0x6e, 0xc2, 0x16, 0xcc, 0x1b, 0x16, 0xc2, 0x0f, 0x16, 0xc2, 0x0f, 0x16,
+  0xc0, 0x0a, 0x0f, 0xc1, 0x16, 0xc1, 0x1b, 0x16, 0xc1, 0x0f, 0xc4, 0x0a, 0xc2, 0x6b, 0xc0, 0x0a,
+  0xc0, 0x11, 0x16, 0x11, 0xc0, 0x0a, 0xc0, 0x11, 0xc0, 0x16, 0xc7, 0x11, 0x16, 0x11, 0x0a, 0x11,
+  0xc4, 0x16, 0x11, 0xc0, 0x16, 0xcc, 0xfe, 0x13, 0xd3, 0x6b, 0xc1, 0x6e, 0xc2, 0x28, 0x2d, 0xc2,
+  0x6e, 0xc2, 0x6b, 0xc1, 0x32, 0x6f, 0xc0, 0x39, 0xc1, 0x2d, 0xc0, 0x39, 0xc0, 0x32, 0x2d, 0xc1,
+  0x32, 0xc2, 0x39, 0x3e, 0x39, 0x32, 0x2d, 0xc1, 0x32, 0x39, 0xc6, 0x32, 0xc0, 0x39, 0xc1, 0x32,
+  0x2d, 0x32, 0x39, 0xc1, 0x3e, 0xc5, 0x39, 0x3e, 0x39, 0x3e, 0xc1, 0x6e, 0xc0, 0x6f, 0xc0, 0x66,
+  0x0f, 0xc2, 0x03, 0x3e, 0x03, 0xc3, 0x3e, 0xc4, 0x39, 0xc3, 0x3e, 0xc3, 0x39, 0xc8, 0x32, 0x39,
+  0xc0, 0x3e, 0xd5, 0x03, 0x0a, 0xc3, 0x03, 0xc2, 0x0a, 0x0f, 0x0a, 0xc3, 0x0f, 0x0a, 0xc0, 0x0f,
+  0xc5, 0x0a, 0xc6, 0x66, 0xc0, 0x0a, 0xca, 0x0f, 0xc5, 0x0a, 0xc1, 0x0f, 0xc6, 0x0a, 0xc0, 0x0f,
+  0xc3, 0x6f, 0xc0, 0x0f, 0xc0, 0x6b, 0xc0, 0x1b, 0x16, 0xc2, 0x0f, 0x16, 0xc4, 0x1b, 0xc2, 0x16,
+  0xc1, 0x0f, 0xc0, 0x0a, 0xc0, 0x0f, 0xc0, 0x0a, 0xc1, 0x0f, 0xc1, 0x16, 0x1b, 0x16, 0xc1, 0x0f,
+  0xc4, 0x0a, 0xc4, 0x16, 0xc0, 0x66, 0xc2, 0x0a, 0xc0, 0x11, 0xc0, 0x16, 0xc6, 0x11, 0xc0, 0x16,
+  0x11, 0x0a, 0xc0, 0x11, 0xc6, 0x16, 0xc2, 0x11, 0x16, 0xc7, 0xfe, 0x13, 0xd4, 0xc7, 0x6e, 0xc5,
+  0x6e, 0x6b, 0xc2, 0x6e, 0xc0, 0x39, 0xc0, 0x2d, 0xca, 0x32, 0x39, 0x32, 0xc0, 0x2d, 0xc2, 0x39,
+  0xc6, 0x32, 0x2d, 0xc0, 0x32, 0xc0, 0x2d, 0xc1, 0x32, 0x39, 0xc2, 0x3e, 0xc3, 0x39, 0x3e, 0xc4,
+  0x6e, 0xc0, 0x6f, 0x66, 0xc0, 0x0f, 0xc2, 0x03, 0x3e, 0xc0, 0x03, 0xc1, 0x3e, 0xc5, 0x39, 0xc2,
+  0x3e, 0xc3, 0x39, 0xc9, 0x32, 0xc0, 0x39, 0x3e, 0xd5, 0x03, 0x0a, 0xc1, 0x03, 0xc4, 0x0f, 0xc1,
+  0x03, 0x0a, 0xc4, 0x0f, 0xc0, 0x0a, 0xcb, 0x66, 0xc0, 0x0a, 0xc7, 0x05, 0x0a, 0xc1, 0x0f, 0x0a,
+  0x0f, 0xc1, 0x0a, 0xc3, 0x0f, 0xc0, 0x0a, 0xc1, 0x0f, 0xc0, 0x0a, 0xc1, 0x0f, 0xc6, 0x6b, 0xc5,
+  0x0f, 0x16, 0x0f, 0xc0, 0x16, 0xc3, 0x6e, 0xc0, 0x16, 0xc3, 0x0a, 0x0f, 0xc1, 0x0a, 0xc1, 0x0f,
+  0x0a, 0x0f, 0x16, 0x1b, 0x16, 0x0f, 0xc1, 0x0a, 0xc6, 0x0f, 0x0a, 0xc1, 0x16, 0xc0, 0x66, 0xc0,
+  0x0a, 0x11, 0x0a, 0xc1, 0x11, 0x16, 0xc4, 0x11, 0x0a, 0xc4, 0x11, 0xc3, 0x0a, 0x11, 0x16, 0xc0,
+  0x11, 0xc3, 0x16, 0xc6, 0xfe, 0x13, 0xd4, 0xc7, 0x6e, 0xc5, 0x6f, 0xc1, 0x69, 0x39, 0x6e, 0xc0,
+  0x39, 0x2d, 0xcc, 0x39, 0x32, 0x2d, 0xc6, 0x39, 0xc2, 0x32, 0x2d, 0xc0, 0x32, 0x2d, 0xc3, 0x32,
+  0x39, 0xc2, 0x3e, 0xc0, 0x39, 0x3e, 0xc0, 0x39, 0x3e, 0xc4, 0x6e, 0x6f, 0x66, 0x03, 0xc0, 0x0f,
+  0xc1, 0x0a, 0x03, 0x3e, 0xca, 0x39, 0x3e, 0xc1, 0x39, 0xce, 0x32, 0x39, 0xc0, 0x3e, 0xc3, 0x39,
+  0x3e, 0xcf, 0x03, 0x0a, 0xc0, 0x0f, 0x03, 0xc1, 0x3e, 0x03, 0xc1, 0x0f, 0xc0, 0x0a, 0xc4, 0x0f,
+  0xc1, 0x0a, 0xc9, 0x03, 0x0a, 0x66, 0xc0, 0x0a, 0x05, 0x0a, 0xc1, 0x03, 0x0a, 0xc1, 0x05, 0x0a,
+  0xc0, 0x0f, 0xc4, 0x0a, 0xcd, 0x0f, 0xc6, 0x0a, 0x6f, 0xc4, 0x0f, 0xc2, 0x16, 0xc0, 0x0f, 0x16,
+  0xc6, 0x0f, 0xc0, 0x0a, 0xc0, 0x0f, 0xc1, 0x0a, 0x0f, 0xc1, 0x16, 0x6e, 0x16, 0x0f, 0xc0, 0x0a,
+  0xc0, 0x0f, 0x0a, 0xc1, 0x0f, 0x0a, 0xc5, 0x6b, 0xc1, 0x0a, 0xc3, 0x16, 0xc5, 0x11, 0xc0, 0x0a,
+  0xc3, 0x11, 0xc2, 0x0a, 0xc0, 0x11, 0x16, 0xc0, 0x11, 0x16, 0xc0, 0x11, 0xc0, 0x16, 0xc6, 0xfe,
+  0x13, 0xd3, 0x6b, 0xc6, 0x6e, 0xc1, 0x28, 0x2d, 0xc1, 0x6f, 0xc0, 0x69, 0xc0, 0x39, 0xc1, 0x2d,
+  0xcb, 0x32, 0x39, 0xc0, 0x32, 0x2d, 0xc6, 0x32, 0x39, 0xc2, 0x2d, 0xc0, 0x32, 0x2d, 0xc4, 0x32,
+  0x39, 0xc1, 0x6e, 0xc0, 0x39, 0xc3, 0x3e, 0xc0, 0x39, 0x3e, 0xc0, 0x6e, 0x6f, 0xc0, 0x03, 0xc0,
+  0x0f, 0xc1, 0x03, 0xc0, 0x3e, 0xc9, 0x39, 0xc0, 0x32, 0x3e, 0xc0, 0x39, 0xd1, 0x3e, 0xc0, 0x39,
+  0x3e, 0xc0, 0x39, 0x3e, 0xc4, 0x39, 0x3e, 0xc8, 0x03, 0x6b, 0xc1, 0x03, 0xc1, 0x3e, 0xc0, 0x03,
+  0xc0, 0x0f, 0x03, 0x0a, 0x03, 0x0a, 0xc3, 0x0f, 0xc0, 0x0a, 0xc9, 0x03, 0xc0, 0x67, 0xc0, 0x0a,
+  0xc7, 0x05, 0x0a, 0xc0, 0x0f, 0xc1, 0x0a, 0xce, 0x05, 0x0a, 0x0f, 0xc0, 0x0a, 0x0f, 0xc3, 0x0a,
+  0x0f, 0xc2, 0x0a, 0x0f, 0x6b, 0x0a, 0xc0, 0x0f, 0x16, 0xc9, 0x0a, 0x0f, 0x0a, 0xc1, 0x0f, 0x0a,
+  0xc2, 0x0f, 0x16, 0xc2, 0x0a, 0xc4, 0x0f, 0x0a, 0xc3, 0x0f, 0x0a, 0xc2, 0x16, 0xc0, 0x0a, 0xc2,
+  0x16, 0xc5, 0x66, 0xc2, 0x0a, 0xc0, 0x05, 0x11, 0xc2, 0x0a, 0xc0, 0x11, 0xc0, 0x16, 0xc3, 0x11,
+  0xc1, 0x16, 0xc4, 0xfe, 0x13, 0xd3, 0xc2, 0x6b, 0xc2, 0x6e, 0xc3, 0x28, 0xc0, 0x2d, 0x6f, 0x69,
+  0x2d, 0x32, 0x39, 0xc0, 0x2d, 0xcc, 0x32, 0x39, 0x32, 0xc0, 0x2d, 0xc6, 0x32, 0x39, 0xc1, 0x32,
+  0x2d, 0x32, 0x39, 0xc0, 0x2d, 0xc3, 0x39, 0xc3, 0x6e, 0xc0, 0x39, 0xc2, 0x3e, 0x39, 0xc0, 0x3e,
+  0xc0, 0x6e, 0x6f, 0x66, 0x03, 0x0a, 0x0f, 0xc0, 0x03, 0xc0, 0x3e, 0xca, 0x39, 0xc2, 0x32, 0x39,
+  0xd1, 0x3e, 0xc2, 0x39, 0xc0, 0x3e, 0xc3, 0x39, 0xc0, 0x3e, 0xc2, 0x39, 0x3e, 0xc0, 0x39, 0x3e,
+  0xc0, 0x03, 0x0a, 0xc1, 0x03, 0xc0, 0x3e, 0xc0, 0x03, 0x3e, 0x03, 0xc4, 0x0a, 0xc2, 0x0f, 0x0a,
+  0xc7, 0x03, 0x0a, 0xc0, 0x03, 0xc0, 0x0a, 0x66, 0x0a, 0xc3, 0x05, 0x3e, 0x0a, 0xc0, 0x05, 0xc0,
+  0x0a, 0x0f, 0xc0, 0x0a, 0xce, 0x05, 0xc0, 0x0a, 0xc1, 0x0f, 0xc0, 0x0a, 0x0f, 0xc0, 0x0a, 0xc6,
+  0x6f, 0x0f, 0x0a, 0x0f, 0xc2, 0x16, 0xc3, 0x0f, 0x16, 0xc0, 0x0a, 0x0f, 0x0a, 0xc5, 0x0f, 0xc0,
+  0x16, 0xc2, 0x0a, 0xcf, 0x16, 0xc0, 0x0a, 0xc2, 0x6b, 0xc0, 0x16, 0xc3, 0x11, 0xc3, 0x0a, 0xc0,
+  0x11, 0xc3, 0x0a, 0xc0, 0x11, 0x16, 0x11, 0xc1, 0x16, 0xc8, 0xfe, 0x13, 0xd3, 0xc0, 0x66, 0x21,
+  0xc0, 0x6b, 0xc2, 0x6e, 0xc1, 0x28, 0x2d, 0xc1, 0x6f, 0x2d, 0xc0, 0x6e, 0x39, 0xc0, 0x2d, 0xcd,
+  0x32, 0x2d, 0xc8, 0x32, 0xc1, 0x2d, 0xc2, 0x32, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0x32, 0x39, 0xc4,
+  0x6e, 0xc1, 0x39, 0x32, 0x39, 0xc1, 0x3e, 0xc0, 0x6e, 0x6f, 0x03, 0xc0, 0x0f, 0xc1, 0x03, 0x3e,
+  0xca, 0x39, 0xd0, 0x32, 0x39, 0xc4, 0x3e, 0xc1, 0x39, 0xc1, 0x3e, 0xc2, 0x39, 0xc2, 0x3e, 0xc7,
+  0x03, 0xc0, 0x6b, 0xc0, 0x03, 0x3e, 0xc3, 0x03, 0xc0, 0x3e, 0xc0, 0x03, 0xc1, 0x0a, 0xc1, 0x0f,
+  0x0a, 0xc6, 0x03, 0x3e, 0x0a, 0xc0, 0x3e, 0xc0, 0x0a, 0x66, 0xc1, 0x0a, 0x03, 0xc0, 0x3e, 0xc1,
+  0x0a, 0x05, 0x0a, 0xc0, 0x0f, 0x0a, 0xcf, 0x05, 0xc0, 0x0a, 0xc1, 0x0f, 0xc0, 0x0a, 0x0f, 0xc1,
+  0x0a, 0xc0, 0x0f, 0xc0, 0x0a, 0xc1, 0x0f, 0xc5, 0x6b, 0xc3, 0x0f, 0xc0, 0x16, 0x0f, 0xc0, 0x0a,
+  0xc5, 0x0f, 0xc0, 0x16, 0xc2, 0x0a, 0xcf, 0x6b, 0xc0, 0x0a, 0xc1, 0x11, 0x16, 0x11, 0x0a, 0x0f,
+  0x16, 0xc1, 0x11, 0xc3, 0x0a, 0xc1, 0x11, 0xc0, 0x66, 0x05, 0x11, 0x0a, 0xc0, 0x11, 0xc3, 0x0a,
+  0x16, 0xc6, 0xfe, 0x13, 0xd4, 0xc0, 0x65, 0xc0, 0x28, 0xc3, 0x6e, 0xc4, 0x6f, 0xc0, 0x2d, 0xc0,
+  0x39, 0xc1, 0x2d, 0xc7, 0x28, 0x2d, 0xc3, 0x6e, 0x2d, 0xc0, 0x28, 0x2d, 0xd3, 0x39, 0xc2, 0x6e,
+  0xc0, 0x32, 0x3e, 0xc0, 0x39, 0x3e, 0x32, 0x39, 0xc0, 0x3e, 0x6e, 0xc3, 0x6f, 0xc1, 0x03, 0x3e,
+  0xc7, 0x39, 0xc6, 0x3e, 0x39, 0xcc, 0x32, 0x39, 0x32, 0x39, 0xc0, 0x3e, 0x39, 0xc3, 0x3e, 0x39,
+  0x3e, 0xc0, 0x39, 0xc4, 0x3e, 0xc6, 0x03, 0x6b, 0x3e, 0xc1, 0x03, 0x3e, 0xc1, 0x03, 0xc0, 0x3e,
+  0xc1, 0x03, 0xc1, 0x0a, 0xc9, 0x3e, 0xc3, 0x03, 0x0a, 0x66, 0xc1, 0x0a, 0x03, 0x3e, 0xc1, 0x05,
+  0x03, 0x0a, 0xc6, 0x05, 0x0a, 0xca, 0x05, 0xc1, 0x0a, 0xc2, 0x0f, 0xc0, 0x6b, 0x0a, 0x0f, 0xc1,
+  0x0a, 0xc2, 0x0f, 0xc4, 0x16, 0xc3, 0x0a, 0xc0, 0x0f, 0x16, 0xc0, 0x0f, 0x0a, 0xc5, 0x0f, 0xc1,
+  0x16, 0xc0, 0x0f, 0x0a, 0xc3, 0x05, 0x0a, 0xc1, 0x05, 0xc2, 0x0a, 0xc3, 0x0f, 0x0a, 0xc1, 0x6b,
+  0x16, 0xc1, 0x0f, 0x16, 0xc1, 0x11, 0xc0, 0x05, 0xc0, 0x11, 0x0a, 0x05, 0x0a, 0x11, 0x05, 0xc0,
+  0x6b, 0x05, 0xc0, 0x0a, 0x11, 0xc3, 0x0a, 0x11, 0x16, 0xc5, 0xfe, 0x13, 0xb4, 0x69, 0xc0, 0x6e,
+  0x1c, 0xc0, 0x6f, 0xc0, 0x6e, 0xc0, 0x28, 0x2d, 0xc2, 0x6e, 0xc0, 0x2d, 0xc0, 0x6f, 0xc0, 0x2d,
+  0xd0, 0x28, 0x2d, 0xce, 0x28, 0x2d, 0x28, 0x2d, 0xc1, 0x39, 0xc8, 0x6e, 0x39, 0x3e, 0x32, 0x3e,
+  0x6e, 0x6b, 0x03, 0x3e, 0x03, 0x0a, 0x6e, 0x03, 0x3e, 0xc7, 0x39, 0xd2, 0x32, 0x39, 0xc1, 0x32,
+  0x2d, 0x39, 0xc1, 0x3e, 0xc0, 0x39, 0xcc, 0x3e, 0x39, 0x3e, 0xc4, 0x03, 0xc0, 0x3e, 0xc3, 0x03,
+  0xc0, 0x3e, 0x6b, 0xc0, 0x3e, 0xc0, 0x03, 0xc1, 0x0a, 0xc9, 0x05, 0x3e, 0xc2, 0x0a, 0xc1, 0x05,
+  0x0a, 0xc1, 0x05, 0xc0, 0x3e, 0x05, 0x3e, 0x0a, 0x05, 0xc0, 0x0a, 0xc1, 0x05, 0x0a, 0xc6, 0x05,
+  0x0a, 0x05, 0x0a, 0xc2, 0x05, 0xc1, 0x0a, 0xc1, 0x6b, 0x6e, 0x0f, 0xc1, 0x0a, 0x0f, 0xc0, 0x0a,
+  0xc5, 0x0f, 0xc1, 0x16, 0xc1, 0x0f, 0xc0, 0x0a, 0x0f, 0x16, 0x0a, 0xc8, 0x0f, 0x16, 0x0f, 0x16,
+  0x0a, 0xcb, 0x05, 0xc0, 0x0a, 0xc1, 0x0f, 0xc0, 0x0a, 0x0f, 0x0a, 0xc2, 0x11, 0x16, 0xc2, 0x11,
+  0x0a, 0xc1, 0x05, 0x0a, 0xc2, 0x05, 0x0a, 0xc1, 0x05, 0x0a, 0xc4, 0x11, 0xc2, 0x16, 0xc3, 0xfe,
+  0x13, 0xd3, 0x66, 0xc3, 0x21, 0x6b, 0x6e, 0xc0, 0x28, 0xc1, 0x2d, 0xc0, 0x6e, 0x2d, 0xc1, 0x6f,
+  0x32, 0x2d, 0xc7, 0x28, 0x2d, 0xd2, 0x28, 0x2d, 0xc8, 0x39, 0xca, 0x6e, 0xc1, 0x6e, 0xc4, 0x6b,
+  0x03, 0x3e, 0xc8, 0x39, 0xc9, 0x32, 0x39, 0xc5, 0x2d, 0x32, 0xc2, 0x39, 0xc2, 0x3e, 0x39, 0xcd,
+  0x3e, 0x39, 0xc0, 0x3e, 0xc2, 0x03, 0xc2, 0x3e, 0xc2, 0x03, 0x3e, 0xc4, 0x03, 0xc0, 0x0a, 0xc8,
+  0x3e, 0xc0, 0x6b, 0x0a, 0x3e, 0xc4, 0x0a, 0xc2, 0x3e, 0xc2, 0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0xc1,
+  0x05, 0x0a, 0xc2, 0x05, 0xc6, 0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0x05, 0x0a, 0xc1, 0x6e, 0x6b, 0xc0,
+  0x0f, 0xc3, 0x0a, 0xc6, 0x0f, 0xc5, 0x0a, 0xc0, 0x0f, 0x0a, 0xcb, 0x0f, 0x0a, 0xc2, 0x05, 0x0a,
+  0xc6, 0x05, 0xc0, 0x0a, 0xcb, 0x6b, 0x16, 0x11, 0x0a, 0xc2, 0x05, 0x0a, 0x05, 0x0a, 0xc0, 0x05,
+  0x0a, 0xc0, 0x05, 0x0a, 0xc5, 0x11, 0xc4, 0x16, 0xc1, 0xfe, 0x13, 0xb3, 0xc0, 0x6f, 0xc0, 0x1c,
+  0xc0, 0x6e, 0x28, 0x6e, 0xc0, 0x28, 0xc1, 0x2d, 0xc0, 0x6f, 0x2d, 0xc1, 0x39, 0x2d, 0x28, 0xc1,
+  0x2d, 0xc6, 0x6e, 0x2d, 0xdb, 0x39, 0xca, 0x32, 0x6f, 0xc0, 0x6e, 0xc5, 0x3e, 0xc7, 0x39, 0xc4,
+  0x32, 0x39, 0xca, 0x32, 0xc3, 0x2d, 0x32, 0x39, 0x32, 0x39, 0xcf, 0x3e, 0xc0, 0x39, 0xc0, 0x3e,
+  0xc3, 0x03, 0xc0, 0x3e, 0xcb, 0x03, 0x6b, 0xc8, 0x3e, 0xc0, 0x6b, 0xc1, 0x3e, 0xc4, 0x0a, 0xc0,
+  0x3e, 0xc3, 0x05, 0x0a, 0x05, 0xc0, 0x0a, 0xc3, 0x05, 0xc9, 0x0a, 0xc0, 0x05, 0xc3, 0x0a, 0xc0,
+  0x6f, 0xc1, 0x69, 0xc2, 0x0a, 0xc7, 0x0f, 0xc0, 0x0a, 0x0f, 0xc1, 0x0a, 0x0f, 0x0a, 0xcb, 0x0f,
+  0x0a, 0xc7, 0x05, 0xc1, 0x0a, 0x05, 0x0a, 0x05, 0xc1, 0x0a, 0xc0, 0x0f, 0x16, 0x0f, 0x0a, 0xc4,
+  0x05, 0x0a, 0x16, 0x66, 0xc0, 0x0a, 0xc1, 0x05, 0x0a, 0x05, 0xc1, 0x0a, 0xc0, 0x05, 0xc0, 0x0a,
+  0xc3, 0x11, 0x0a, 0xc1, 0x11, 0xc4, 0x16, 0xfe, 0x13, 0xb3, 0xc0, 0x6f, 0x1c, 0xc1, 0x6e, 0x6f,
+  0xc0, 0x28, 0xc2, 0x2d, 0x6b, 0x6d, 0x28, 0x2d, 0x32, 0xc0, 0x2d, 0x28, 0xc1, 0x2d, 0xc2, 0x28,
+  0x2d, 0xc7, 0x28, 0xc0, 0x2d, 0xce, 0x28, 0x2d, 0xc3, 0x6f, 0xcb, 0x6e, 0xc0, 0x6e, 0xc0, 0x3e,
+  0x03, 0xc2, 0x3e, 0xc4, 0x39, 0xc7, 0x32, 0xc1, 0x39, 0xc0, 0x32, 0x39, 0xc3, 0x32, 0x39, 0x32,
+  0x39, 0x32, 0xc1, 0x2d, 0x32, 0x39, 0x32, 0x39, 0xd4, 0x3e, 0xc2, 0x03, 0xc0, 0x3e, 0xcc, 0x6f,
+  0x3e, 0x0a, 0xc6, 0x3e, 0xc5, 0x6b, 0x3e, 0xc2, 0x0a, 0x3e, 0xc4, 0x05, 0xc1, 0x0a, 0xc5, 0x05,
+  0xc3, 0x0a, 0x05, 0xc2, 0x0a, 0xc0, 0x05, 0xc2, 0x0a, 0x6e, 0xc0, 0x6b, 0x0f, 0x0a, 0x0f, 0x0a,
+  0xc9, 0x0f, 0xc0, 0x0a, 0xc0, 0x0f, 0x16, 0x0f, 0x0a, 0xc0, 0x0f, 0x16, 0x0a, 0xc0, 0x05, 0x0a,
+  0xc7, 0x0f, 0xc0, 0x0a, 0xc1, 0x05, 0x0a, 0xc0, 0x05, 0xc1, 0x0a, 0x05, 0xc0, 0x0a, 0x05, 0xc1,
+  0x0a, 0xc0, 0x0f, 0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0xc3, 0x6b, 0xc1, 0x0a, 0xc1, 0x05, 0xc0, 0x0a,
+  0xc4, 0x05, 0xc0, 0x0a, 0xc6, 0x11, 0xc1, 0x16, 0x11, 0xc0, 0x16, 0xfe, 0x13, 0xb3, 0xc3, 0x6e,
+  0xc0, 0x6f, 0x66, 0xc3, 0x2d, 0xc3, 0x6f, 0x2d, 0xc0, 0x28, 0xc1, 0x2d, 0xc1, 0x28, 0x21, 0x28,
+  0x2d, 0xc5, 0x28, 0xc0, 0x2d, 0xc8, 0x28, 0x2d, 0xc4, 0x28, 0xc0, 0x2d, 0xc2, 0x39, 0x69, 0x39,
+  0xc7, 0x32, 0x39, 0x6e, 0x6e, 0xc1, 0x3e, 0x03, 0xc2, 0x3e, 0xc4, 0x39, 0xc6, 0x32, 0x39, 0xc2,
+  0x32, 0xc0, 0x39, 0xc3, 0x2d, 0xc0, 0x39, 0x32, 0x2d, 0xc1, 0x32, 0xc0, 0x39, 0x32, 0x39, 0xcf,
+  0x3e, 0x39, 0xc2, 0x3e, 0x39, 0x3e, 0xc0, 0x6f, 0x03, 0x3e, 0xcf, 0x0a, 0xc0, 0x66, 0x3e, 0xc0,
+  0x0a, 0x05, 0x3e, 0xd1, 0x05, 0xc1, 0x0a, 0xc0, 0x05, 0x0a, 0xc0, 0x3e, 0xc1, 0x05, 0xc1, 0x0a,
+  0x05, 0xc9, 0x0a, 0xc0, 0x6e, 0xc1, 0x0a, 0xc2, 0x05, 0xc0, 0x0a, 0xc5, 0x0f, 0xc0, 0x6b, 0x0a,
+  0x0f, 0x16, 0xc0, 0x0a, 0xc5, 0x05, 0x0a, 0xc1, 0x05, 0xc0, 0x0a, 0xc1, 0x0f, 0x0a, 0xc1, 0x05,
+  0xc1, 0x0a, 0xc0, 0x05, 0xc6, 0x0a, 0xc3, 0x05, 0xc1, 0x0a, 0xc4, 0x6b, 0xc0, 0x0a, 0xc0, 0x05,
+  0x0a, 0x05, 0x0a, 0xc5, 0x05, 0x0a, 0x05, 0xc0, 0x0a, 0xc4, 0x11, 0xc0, 0x0a, 0x11, 0xc1, 0xfe,
+  0x13, 0xb3, 0xc0, 0x6b, 0xc0, 0x1c, 0x6e, 0xc0, 0x6b, 0xc3, 0x6e, 0xc3, 0x6f, 0x69, 0x2d, 0x28,
+  0xc2, 0x2d, 0xc1, 0x28, 0xc1, 0x2d, 0x28, 0xc0, 0x2d, 0xce, 0x28, 0x2d, 0xc4, 0x28, 0xc0, 0x2d,
+  0xc1, 0x39, 0xc1, 0x32, 0x39, 0xc0, 0x32, 0x39, 0xc2, 0x32, 0xc0, 0x39, 0x6e, 0xc0, 0x6e, 0xc0,
+  0x3e, 0x03, 0xc1, 0x3e, 0xc1, 0x39, 0x3e, 0xc0, 0x39, 0xc6, 0x32, 0xc4, 0x2d, 0x32, 0x39, 0xc0,
+  0x32, 0x39, 0x32, 0x2d, 0xc9, 0x39, 0xc3, 0x32, 0x3e, 0x39, 0xc6, 0x32, 0x39, 0xc4, 0x3e, 0x39,
+  0xc0, 0x3e, 0x03, 0x3e, 0xd0, 0x03, 0x6b, 0x66, 0x3e, 0xca, 0x39, 0xc0, 0x3e, 0xc3, 0x39, 0xc0,
+  0x3e, 0x39, 0xc0, 0x05, 0xc3, 0x0a, 0xc0, 0x3e, 0xc1, 0x05, 0xc1, 0x0a, 0x05, 0xc1, 0x0a, 0xc4,
+  0x05, 0xc1, 0x0a, 0x6e, 0xc2, 0x0a, 0xc1, 0x05, 0xc2, 0x0a, 0xc3, 0x0f, 0xc0, 0x6b, 0x0f, 0xc0,
+  0x16, 0xc0, 0x0a, 0xc4, 0x05, 0xc0, 0x0a, 0xc1, 0x05, 0xc0, 0x0a, 0xc4, 0x05, 0xc3, 0x0a, 0x05,
+  0xc9, 0x0a, 0xc1, 0x05, 0xc0, 0x0a, 0xc4, 0x6b, 0xc1, 0x0a, 0x05, 0x0a, 0x05, 0xc1, 0x0a, 0xc1,
+  0x05, 0xc3, 0x0a, 0xc0, 0x05, 0x0a, 0x11, 0x0a, 0xc0, 0x11, 0xc0, 0x0a, 0x11, 0xc0, 0x16, 0xfe,
+  0x13, 0xb3, 0xc0, 0x6b, 0x1c, 0xc0, 0x6e, 0x6f, 0x66, 0x21, 0x28, 0xc1, 0x2d, 0xc2, 0x6e, 0xc0,
+  0x2d, 0xc0, 0x28, 0xc2, 0x2d, 0x28, 0xc5, 0x21, 0x2d, 0xc1, 0x28, 0xc0, 0x2d, 0xc2, 0x28, 0xc1,
+  0x2d, 0xc3, 0x28, 0xc0, 0x2d, 0xc1, 0x28, 0xc1, 0x2d, 0xc2, 0x32, 0xc0, 0x6b, 0xca, 0x6e, 0x6e,
+  0xc0, 0x3e, 0x03, 0xc1, 0x3e, 0xc0, 0x39, 0xc9, 0x2d, 0xc2, 0x32, 0x2d, 0xd2, 0x32, 0x39, 0xc2,
+  0x32, 0x3e, 0xc0, 0x39, 0xc2, 0x32, 0x39, 0xc7, 0x3e, 0x39, 0xc0, 0x3e, 0x03, 0x3e, 0xcf, 0x6b,
+  0x6e, 0xc0, 0x05, 0x3e, 0xc5, 0x39, 0x3e, 0xc4, 0x39, 0xc0, 0x3e, 0xc0, 0x39, 0xc4, 0x3e, 0x0a,
+  0xc0, 0x05, 0xc1, 0x0a, 0x3e, 0xc0, 0x05, 0xca, 0x3e, 0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0xc1, 0x6e,
+  0xc0, 0x0a, 0xc1, 0x05, 0xc2, 0x0a, 0x05, 0xc0, 0x0a, 0xc2, 0x0f, 0xc0, 0x0a, 0xc7, 0x05, 0xc0,
+  0x0a, 0xc2, 0x05, 0x0a, 0xc4, 0x05, 0xcf, 0x0a, 0xc0, 0x05, 0xc2, 0x0a, 0xc0, 0x05, 0x0a, 0xc1,
+  0x6b, 0xc0, 0x0a, 0x05, 0xc4, 0x0a, 0x05, 0xc4, 0x0a, 0xc8, 0x11, 0xc1, 0xfe, 0x13, 0xd4, 0x65,
+  0x6b, 0x1c, 0xc0, 0x28, 0x6e, 0x28, 0x69, 0x28, 0xc0, 0x2d, 0xc1, 0x28, 0x2d, 0x6e, 0xc0, 0x2d,
+  0xc0, 0x28, 0xc3, 0x21, 0xc5, 0x28, 0x2d, 0xc1, 0x28, 0xc1, 0x21, 0x28, 0xc3, 0x2d, 0xc1, 0x28,
+  0xc2, 0x2d, 0xc0, 0x28, 0xc3, 0x2d, 0xc1, 0x32, 0xc0, 0x6b, 0xc0, 0x32, 0x2d, 0x39, 0xc6, 0x6e,
+  0x6e, 0x3e, 0xc0, 0x03, 0xc1, 0x3e, 0xc0, 0x39, 0xc9, 0x2d, 0xd8, 0x32, 0x39, 0xc1, 0x32, 0xc0,
+  0x39, 0xc1, 0x2d, 0xc0, 0x32, 0x39, 0xc7, 0x3e, 0xc2, 0x03, 0x3e, 0xc8, 0x39, 0xc0, 0x3e, 0xc3,
+  0x6f, 0xc1, 0x66, 0x3e, 0x0a, 0xc0, 0x3e, 0xc4, 0x39, 0xc1, 0x3e, 0xc0, 0x39, 0x3e, 0xc1, 0x39,
+  0xc5, 0x3e, 0x0a, 0x05, 0xc1, 0x0a, 0x05, 0xcb, 0x3e, 0xc0, 0x0a, 0x03, 0x0a, 0x05, 0xc0, 0x0a,
+  0xc6, 0x05, 0xc5, 0x0a, 0xcc, 0x05, 0x0a, 0x05, 0xc0, 0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0xc3, 0x05,
+  0xcf, 0x0a, 0xc0, 0x05, 0xc3, 0x0a, 0x05, 0x0a, 0xc1, 0x6b, 0xc0, 0x0a, 0x05, 0xcb, 0x0a, 0xc0,
+  0x05, 0xc0, 0x0a, 0xc3, 0x11, 0xc2, 0xfe, 0x13, 0xb3, 0xc3, 0x6f, 0x6e, 0x65, 0x67, 0x28, 0x2d,
+  0xc7, 0x28, 0xc1, 0x21, 0x28, 0x21, 0x28, 0x1c, 0xc0, 0x28, 0xc0, 0x1c, 0x21, 0x28, 0x2d, 0xc0,
+  0x28, 0xc1, 0x21, 0xc0, 0x2d, 0x28, 0xc3, 0x2d, 0xc0, 0x21, 0x28, 0xc1, 0x2d, 0xc0, 0x21, 0xc0,
+  0x28, 0xc0, 0x2d, 0xc4, 0x6f, 0xc1, 0x69, 0x39, 0x32, 0x39, 0xc3, 0x6e, 0x6e, 0x3e, 0xc1, 0x03,
+  0x3e, 0xc1, 0x39, 0xc9, 0x2d, 0x39, 0x2d, 0xd1, 0x28, 0x2d, 0xc3, 0x39, 0xc2, 0x32, 0x39, 0xc2,
+  0x32, 0xc1, 0x2d, 0x39, 0x32, 0xc0, 0x39, 0xc4, 0x3e, 0xc6, 0x39, 0x3e, 0xc0, 0x39, 0xc0, 0x3e,
+  0x39, 0xc0, 0x3e, 0xc3, 0x6f, 0xc1, 0x3e, 0x0a, 0x3e, 0xc3, 0x39, 0xc6, 0x3e, 0xc1, 0x39, 0xc0,
+  0x3e, 0x39, 0xc1, 0x3e, 0xc1, 0x0a, 0xc0, 0x3e, 0x6b, 0xc7, 0x3e, 0x05, 0xc6, 0x0a, 0xc0, 0x05,
+  0xc0, 0x0a, 0xc5, 0x05, 0x0a, 0xc0, 0x05, 0xc4, 0x0a, 0xc7, 0x05, 0x0a, 0xc0, 0x05, 0xc5, 0x0a,
+  0xc5, 0x05, 0xd0, 0x0a, 0xc0, 0x05, 0xc3, 0x0a, 0x05, 0xc0, 0x0a, 0xc0, 0x6e, 0x0a, 0xc0, 0x05,
+  0xcb, 0x0a, 0x05, 0xc0, 0x0a, 0xc0, 0x05, 0xc0, 0x6b, 0x05, 0xc0, 0x0a, 0xc0, 0xfe, 0x13, 0xb3,
+  0xc3, 0x6f, 0xc0, 0x69, 0x67, 0x28, 0xc0, 0x6e, 0xc5, 0x28, 0x1c, 0x28, 0x1c, 0x28, 0xc0, 0x21,
+  0xc0, 0x1c, 0xc0, 0x28, 0x1c, 0xc0, 0x21, 0xc0, 0x28, 0x2d, 0x28, 0xc1, 0x21, 0xc0, 0x2d, 0x28,
+  0xc5, 0x21, 0xc0, 0x28, 0xc2, 0x21, 0xc0, 0x28, 0xc0, 0x2d, 0x28, 0x2d, 0xc2, 0x6f, 0xc0, 0x69,
+  0xc0, 0x39, 0x32, 0xc0, 0x2d, 0x39, 0xc1, 0x6e, 0x6e, 0x3e, 0xc5, 0x39, 0xc9, 0x2d, 0xd0, 0x28,
+  0x2d, 0xc0, 0x28, 0x2d, 0xc3, 0x39, 0x32, 0x2d, 0x32, 0x39, 0xc2, 0x32, 0x2d, 0xc0, 0x32, 0x2d,
+  0xc1, 0x32, 0x39, 0xc4, 0x3e, 0xc6, 0x39, 0x3e, 0xc1, 0x39, 0xc2, 0x3e, 0xc3, 0x6b, 0x6e, 0x3e,
+  0xc6, 0x39, 0xc4, 0x3e, 0x39, 0xc6, 0x05, 0x3e, 0x39, 0x3e, 0xc0, 0x0a, 0xc0, 0x3e, 0x05, 0xcb,
+  0x3e, 0xc1, 0x05, 0xc4, 0x0a, 0xc4, 0x05, 0xc8, 0x0a, 0xc5, 0x05, 0xc1, 0x0a, 0xc0, 0x05, 0xc5,
+  0x0a, 0xc4, 0x05, 0xd8, 0x0a, 0x05, 0xc1, 0x6f, 0x6e, 0x69, 0x05, 0xd0, 0x6b, 0x05, 0xc0, 0x0c,
+  0xc0, 0x05, 0x0c, 0x11, 0xfe, 0x13, 0xb3, 0xc2, 0x6e, 0x6b, 0xc0, 0x1c, 0xc0, 0x28, 0xc0, 0x6e,
+  0xc4, 0x28, 0x1c, 0xc0, 0x6b, 0x1c, 0x28, 0x21, 0xc1, 0x1c, 0xc3, 0x21, 0xc0, 0x28, 0x2d, 0x28,
+  0xc0, 0x1c, 0xc0, 0x21, 0x28, 0xc7, 0x21, 0x28, 0xc2, 0x1c, 0x28, 0xc1, 0x2d, 0x28, 0x2d, 0xc2,
+  0x6f, 0x2d, 0xc0, 0x6e, 0xc0, 0x2d, 0xc1, 0x32, 0xc0, 0x39, 0x6e, 0xc6, 0x39, 0xc0, 0x32, 0x39,
+  0xc0, 0x3e, 0xc1, 0x32, 0xc1, 0x2d, 0xd0, 0x28, 0xc0, 0x2d, 0xcb, 0x39, 0x32, 0xc0, 0x2d, 0xc0,
+  0x32, 0xc0, 0x2d, 0xc1, 0x39, 0xc6, 0x3e, 0xc2, 0x39, 0xc0, 0x3e, 0xc2, 0x39, 0xc3, 0x3e, 0xcc,
+  0x39, 0xc7, 0x3e, 0x39, 0xc4, 0x3e, 0xc0, 0x39, 0xc0, 0x3e, 0xc3, 0x6b, 0xc2, 0x39, 0x05, 0xc4,
+  0x3e, 0xc2, 0x05, 0xc5, 0x6e, 0xc3, 0x05, 0xc2, 0x0a, 0x05, 0xc4, 0x0a, 0xc6, 0x05, 0x0a, 0xc0,
+  0x05, 0xc2, 0x3e, 0x05, 0xc2, 0x0a, 0xc2, 0x05, 0xd0, 0x0a, 0x05, 0xc9, 0x0a, 0x6e, 0x0a, 0x05,
+  0xc8, 0x66, 0x05, 0xc8, 0x6b, 0xc0, 0x6e, 0x0c, 0xc0, 0xfe, 0x13, 0xb3, 0xc2, 0x6e, 0x6b, 0x1c,
+  0xc0, 0x6b, 0x28, 0x6e, 0xc1, 0x28, 0xc0, 0x2d, 0x28, 0xc0, 0x1c, 0x23, 0x1c, 0xc0, 0x28, 0xc0,
+  0x21, 0xc1, 0x1c, 0xc2, 0x21, 0xc0, 0x28, 0xc2, 0x1c, 0x28, 0x21, 0xc0, 0x1c, 0xc0, 0x28, 0xc5,
+  0x21, 0xc1, 0x28, 0xc3, 0x2d, 0xc4, 0x6f, 0x2d, 0xc6, 0x6e, 0x6f, 0xc7, 0x39, 0xc0, 0x32, 0x39,
+  0xc0, 0x32, 0x3e, 0x32, 0xc1, 0x2d, 0xc7, 0x28, 0x2d, 0xc3, 0x28, 0x2d, 0xda, 0x39, 0xc0, 0x2d,
+  0xc0, 0x32, 0x39, 0xc0, 0x3e, 0xc2, 0x39, 0xca, 0x3e, 0xc2, 0x39, 0xc0, 0x3e, 0xc2, 0x39, 0xcc,
+  0x3e, 0x39, 0xc5, 0x3e, 0xc1, 0x6f, 0x3e, 0xc1, 0x6b, 0xc1, 0x3e, 0xc1, 0x05, 0xc4, 0x3e, 0xc1,
+  0x05, 0xc6, 0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0x05, 0xc1, 0x0a, 0xc1, 0x05, 0xc3, 0x0a, 0xc0, 0x05,
+  0x0a, 0xc2, 0x05, 0xc5, 0x0a, 0x05, 0xc4, 0x0a, 0xc1, 0x05, 0xc4, 0x66, 0x05, 0xd5, 0x0a, 0xc0,
+  0x05, 0xc2, 0x00, 0xc0, 0x05, 0xc2, 0x00, 0xc0, 0x05, 0xc8, 0x0a, 0x6b, 0xc0, 0x05, 0xfe, 0x13,
+  0xb3, 0xc2, 0x6e, 0x6b, 0x1c, 0xc0, 0x28, 0xc0, 0x6e, 0xc4, 0x28, 0x66, 0x1c, 0xc2, 0x28, 0xc0,
+  0x21, 0x1c, 0x21, 0x1c, 0xc2, 0x21, 0xc0, 0x28, 0xc1, 0x1c, 0xc2, 0x21, 0x23, 0x1c, 0x28, 0xc2,
+  0x1c, 0xc1, 0x21, 0xc1, 0x1c, 0xc0, 0x28, 0xc1, 0x2d, 0xcc, 0x6e, 0xc1, 0x6f, 0xc6, 0x66, 0xc0,
+  0x32, 0xc0, 0x39, 0xc4, 0x2d, 0xc0, 0x28, 0x2d, 0xc4, 0x28, 0xc0, 0x2d, 0x28, 0x2d, 0xc0, 0x28,
+  0xc9, 0x2d, 0xd0, 0x39, 0x32, 0x2d, 0xc0, 0x32, 0x39, 0xc0, 0x32, 0x3e, 0xc1, 0x39, 0xcb, 0x3e,
+  0xc7, 0x39, 0xc4, 0x3e, 0x39, 0xc5, 0x3e, 0x39, 0xc5, 0x3e, 0x39, 0x3e, 0xc1, 0x39, 0xc1, 0x3e,
+  0xc5, 0x6b, 0xc2, 0x39, 0x3e, 0xc0, 0x39, 0xc0, 0x05, 0xc2, 0x6e, 0x05, 0xc1, 0x0a, 0x05, 0xcb,
+  0x0a, 0xc0, 0x05, 0xc0, 0x0a, 0x05, 0xc7, 0x0a, 0x05, 0xc4, 0x0a, 0xc1, 0x05, 0xc4, 0x66, 0x05,
+  0xc1, 0x00, 0x05, 0xc0, 0x00, 0xc0, 0x05, 0xc1, 0x00, 0x05, 0xc9, 0x0a, 0xc0, 0x05, 0xc9, 0x00,
+  0xc0, 0x05, 0xc8, 0x6f, 0xc0, 0x05, 0xfe, 0x13, 0xb3, 0xc0, 0x6e, 0xc1, 0x6b, 0x1c, 0xc1, 0x28,
+  0x6e, 0xc0, 0x21, 0x2d, 0xc0, 0x28, 0xc0, 0x1c, 0xc3, 0x28, 0xc0, 0x1c, 0xc6, 0x28, 0xc0, 0x1c,
+  0xc1, 0x6b, 0x28, 0xc0, 0x1c, 0x23, 0x28, 0x21, 0x28, 0xc2, 0x1c, 0xc0, 0x21, 0xc0, 0x1c, 0xc2,
+  0x28, 0xc0, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0xc8, 0x6e, 0xc1, 0x6f, 0xc5, 0x66, 0xc8, 0x2d, 0xc3,
+  0x28, 0xc0, 0x2d, 0xc0, 0x28, 0xc3, 0x2d, 0xc0, 0x28, 0xc3, 0x2d, 0x28, 0xc3, 0x2d, 0xc4, 0x28,
+  0xc0, 0x2d, 0xc9, 0x6b, 0x2d, 0xc0, 0x39, 0xc2, 0x3e, 0xc1, 0x39, 0xcb, 0x3e, 0xc7, 0x39, 0xc1,
+  0x3e, 0x39, 0xc4, 0x32, 0x39, 0xc9, 0x3e, 0xc2, 0x39, 0x3e, 0xc9, 0x39, 0x6f, 0xc2, 0x39, 0xc0,
+  0x05, 0xc3, 0x6e, 0x05, 0xc1, 0x0a, 0x05, 0xcb, 0x0a, 0xc0, 0x05, 0xc8, 0x66, 0x05, 0xc6, 0x0a,
+  0xc0, 0x05, 0xc5, 0x00, 0xc4, 0x05, 0x00, 0xc0, 0x05, 0xc0, 0x00, 0xc0, 0x05, 0xc9, 0x0a, 0x6b,
+  0x0a, 0x05, 0xc3, 0x00, 0x05, 0xc1, 0x00, 0xc2, 0x05, 0xc8, 0x11, 0x05, 0xfe, 0x13, 0xb3, 0xc1,
+  0x6e, 0xc0, 0x1c, 0xc0, 0x21, 0x1c, 0x6f, 0x6e, 0xc0, 0x21, 0x2d, 0xc0, 0x28, 0x66, 0x1c, 0xc0,
+  0x21, 0x1c, 0xca, 0x28, 0xc0, 0x1c, 0xc5, 0x21, 0xc1, 0x28, 0xc1, 0x1c, 0x23, 0x21, 0x1c, 0x21,
+  0x1c, 0xc2, 0x28, 0xc1, 0x2d, 0x28, 0xc0, 0x2d, 0xc8, 0x6e, 0xc1, 0x6f, 0xc0, 0x66, 0x3e, 0xc1,
+  0x39, 0xc1, 0x32, 0x39, 0xc4, 0x2d, 0xc8, 0x28, 0xc2, 0x2d, 0xc1, 0x28, 0xcb, 0x2d, 0xc6, 0x28,
+  0x2d, 0xc9, 0x39, 0xc2, 0x3e, 0xc0, 0x39, 0xcc, 0x3e, 0xc4, 0x39, 0x3e, 0xc0, 0x39, 0xc1, 0x3e,
+  0x39, 0xc1, 0x66, 0x39, 0xcd, 0x3e, 0xc1, 0x39, 0xc0, 0x3e, 0xc7, 0x39, 0x3e, 0x39, 0xc0, 0x6f,
+  0x39, 0xc0, 0x05, 0xc2, 0x39, 0x05, 0xd2, 0x6e, 0x05, 0xd1, 0x0a, 0xc0, 0x05, 0xc2, 0x66, 0xce,
+  0x05, 0xc0, 0x00, 0x05, 0xc6, 0x0a, 0xc1, 0x05, 0xc1, 0x00, 0xca, 0x05, 0xc6, 0x0a, 0xc0, 0xfe,
+  0x13, 0xb3, 0xc2, 0x6f, 0x1c, 0xc0, 0x6e, 0x67, 0x28, 0xc5, 0x1c, 0xc1, 0x21, 0x1c, 0xc2, 0x21,
+  0xc0, 0x1c, 0xc2, 0x21, 0xc0, 0x28, 0xc0, 0x1c, 0xc6, 0x21, 0xc1, 0x28, 0x1c, 0xc0, 0x21, 0x1c,
+  0xc5, 0x28, 0x21, 0x28, 0xc1, 0x6e, 0xc1, 0x28, 0xc0, 0x2d, 0xc4, 0x6e, 0xc0, 0x6f, 0xc0, 0x66,
+  0xc0, 0x3e, 0xc0, 0x39, 0xc1, 0x32, 0x2d, 0xc1, 0x32, 0x39, 0x32, 0x2d, 0xca, 0x28, 0xc1, 0x2d,
+  0xc1, 0x28, 0xcc, 0x2d, 0xc5, 0x28, 0x2d, 0xc9, 0x39, 0xc3, 0x3e, 0x39, 0xc0, 0x32, 0x39, 0xcb,
+  0x3e, 0xc2, 0x39, 0x3e, 0x39, 0xc6, 0x66, 0xc0, 0x39, 0xce, 0x3e, 0x39, 0xc0, 0x3e, 0xc0, 0x39,
+  0xc5, 0x3e, 0xc0, 0x39, 0xc0, 0x6f, 0x39, 0x3e, 0xc1, 0x05, 0x39, 0xc0, 0x05, 0xc0, 0x6e, 0x05,
+  0xc1, 0x0a, 0xc0, 0x05, 0xc4, 0x3e, 0x05, 0xc3, 0x0a, 0x05, 0xc0, 0x0a, 0x05, 0xc4, 0x66, 0xc2,
+  0x05, 0xc0, 0x00, 0xc1, 0x05, 0xc0, 0x0a, 0x05, 0x00, 0xc0, 0x05, 0xc0, 0x00, 0xc2, 0x05, 0xc0,
+  0x00, 0xc0, 0x05, 0x00, 0xc3, 0x05, 0xc1, 0x00, 0x05, 0xc2, 0x00, 0xc1, 0x05, 0xc0, 0x0a, 0xc0,
+  0x05, 0xc1, 0x00, 0xc0, 0x05, 0x00, 0x05, 0x00, 0xc6, 0x05, 0xc7, 0xfe, 0x13, 0xb3, 0xc0, 0x6f,
+  0x1c, 0xc2, 0x6e, 0xc0, 0x28, 0xc2, 0x6e, 0x28, 0x1c, 0xc8, 0x21, 0x1c, 0xc1, 0x21, 0xc1, 0x28,
+  0x1c, 0xc3, 0x28, 0x1c, 0xc1, 0x28, 0xc0, 0x21, 0xc1, 0x1c, 0xc1, 0x21, 0xc0, 0x1c, 0xc2, 0x21,
+  0x28, 0xc1, 0x21, 0x2d, 0xc2, 0x28, 0x2d, 0xc5, 0x6e, 0x6b, 0xc2, 0x6e, 0x39, 0x32, 0x3e, 0x32,
+  0xc0, 0x2d, 0x32, 0x2d, 0x39, 0x2d, 0x39, 0x2d, 0xc4, 0x28, 0xc0, 0x2d, 0x28, 0xc5, 0x7e, 0x2d,
+  0x28, 0xcc, 0x2d, 0xc0, 0x28, 0xc1, 0x2d, 0x28, 0xc0, 0x2d, 0xc5, 0x28, 0x2d, 0xc2, 0x32, 0x39,
+  0xc6, 0x66, 0x39, 0xc3, 0x2d, 0x39, 0xc2, 0x3e, 0xc0, 0x39, 0x3e, 0xc1, 0x39, 0xc8, 0x32, 0xc1,
+  0x39, 0xcb, 0x3e, 0xc0, 0x39, 0x3e, 0x39, 0xc7, 0x3e, 0x39, 0xc1, 0x3e, 0x39, 0xc4, 0x3e, 0x39,
+  0x6f, 0xc9, 0x39, 0x6b, 0x39, 0xc1, 0x05, 0xc4, 0x6e, 0x05, 0xc0, 0x0a, 0x05, 0xc2, 0x39, 0xc0,
+  0x00, 0x05, 0x00, 0xc1, 0x05, 0x3e, 0x0a, 0xc0, 0x05, 0x00, 0xc1, 0x05, 0x39, 0xc0, 0x00, 0x05,
+  0x00, 0x05, 0xc0, 0x00, 0xc5, 0x05, 0xc1, 0x00, 0xc0, 0x05, 0xc0, 0x00, 0xc2, 0x05, 0xc0, 0x0a,
+  0xc0, 0x05, 0x00, 0xc3, 0x05, 0x00, 0xc7, 0x05, 0x00, 0x05, 0xc4, 0x0a, 0xfe, 0x13, 0xb3, 0xc5,
+  0x6e, 0xc0, 0x6b, 0xc4, 0x1c, 0xcc, 0x21, 0x1c, 0x21, 0x1c, 0xc8, 0x28, 0x1c, 0xc0, 0x21, 0x28,
+  0xc0, 0x1c, 0xc6, 0x21, 0x28, 0xc0, 0x21, 0xc0, 0x6f, 0xc9, 0x6e, 0x6b, 0xc5, 0x6e, 0xc0, 0x39,
+  0x32, 0x2d, 0xc7, 0x28, 0xcb, 0x2d, 0xc0, 0x28, 0xca, 0x2d, 0xc2, 0x28, 0xc0, 0x2d, 0xc1, 0x28,
+  0x2d, 0xc3, 0x28, 0x2d, 0xc1, 0x28, 0x2d, 0xc0, 0x32, 0x39, 0xc4, 0x32, 0x67, 0x39, 0xc1, 0x32,
+  0xc0, 0x39, 0x32, 0xc0, 0x39, 0xc1, 0x3e, 0xc0, 0x39, 0xca, 0x32, 0x39, 0xcb, 0x34, 0x39, 0xda,
+  0x3e, 0x39, 0x6f, 0xc7, 0x39, 0xc0, 0x6b, 0x39, 0xc0, 0x05, 0x6e, 0x05, 0xc0, 0x0a, 0x05, 0xc0,
+  0x0a, 0x05, 0xc0, 0x0a, 0x05, 0xc2, 0x39, 0xc0, 0x3e, 0x05, 0x00, 0xc1, 0x05, 0x3e, 0x05, 0xc1,
+  0x00, 0xc1, 0x05, 0x39, 0xc1, 0x00, 0xc4, 0x05, 0xc0, 0x00, 0xcc, 0x05, 0xc1, 0x0a, 0x05, 0x00,
+  0xd0, 0x05, 0xc4, 0xfe, 0x13, 0xb3, 0xc6, 0x6e, 0xc0, 0x6b, 0xc2, 0x1c, 0xcd, 0x21, 0x1c, 0x28,
+  0x1c, 0xc8, 0x6b, 0x1c, 0x28, 0x21, 0x1c, 0xc8, 0x21, 0xc3, 0x6f, 0xc1, 0x28, 0xc1, 0x2d, 0xc0,
+  0x28, 0x2d, 0x6e, 0xc0, 0x6b, 0xc4, 0x32, 0x39, 0xc0, 0x32, 0x2d, 0xc7, 0x28, 0xc9, 0x21, 0x28,
+  0xc4, 0x1c, 0x28, 0x1c, 0x28, 0xcb, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0xc3, 0x28, 0x2d, 0xc5, 0x39,
+  0xc3, 0x32, 0xc0, 0x39, 0xc0, 0x2d, 0x39, 0x32, 0xc0, 0x39, 0x32, 0xc0, 0x39, 0xd0, 0x32, 0xc1,
+  0x2d, 0x32, 0x39, 0xc2, 0x66, 0xc0, 0x39, 0x34, 0xc0, 0x39, 0xc9, 0x6e, 0x39, 0xc5, 0x3e, 0xc0,
+  0x39, 0xc7, 0x6f, 0xc5, 0x3e, 0x05, 0xc0, 0x39, 0xc3, 0x05, 0xc6, 0x3e, 0x6f, 0x05, 0xc0, 0x0a,
+  0x05, 0x39, 0xc3, 0x6b, 0x39, 0x05, 0x3e, 0x05, 0xc2, 0x39, 0xc1, 0x00, 0xc1, 0x39, 0xc1, 0x05,
+  0x00, 0xc0, 0x05, 0x00, 0xcd, 0x05, 0xc1, 0x0a, 0xc0, 0x00, 0xd3, 0x05, 0xc1, 0xfe, 0x13, 0xb3,
+  0xc5, 0x6e, 0xc1, 0x1c, 0x6f, 0xc1, 0x1c, 0xce, 0x6b, 0x1c, 0xcb, 0x21, 0x1c, 0xc9, 0x21, 0xc3,
+  0x28, 0x6e, 0xc1, 0x28, 0x2d, 0xc1, 0x28, 0x2d, 0x6e, 0xc0, 0x6b, 0xc3, 0x32, 0xc0, 0x39, 0xc0,
+  0x2d, 0xc8, 0x28, 0xc9, 0x21, 0xc0, 0x28, 0xc4, 0x1c, 0xc0, 0x28, 0xcb, 0x2d, 0xc0, 0x28, 0xc0,
+  0x2d, 0x28, 0x2d, 0x28, 0x2d, 0xc8, 0x32, 0x39, 0xc0, 0x32, 0x2d, 0xc2, 0x6b, 0x32, 0x39, 0xc0,
+  0x32, 0xc0, 0x39, 0x32, 0x39, 0xc5, 0x6e, 0x39, 0xc7, 0x32, 0xc3, 0x34, 0x39, 0xc1, 0x34, 0xc0,
+  0x39, 0x34, 0xc0, 0x39, 0xcd, 0x3e, 0xc0, 0x39, 0xcb, 0x6f, 0x3e, 0x05, 0xc0, 0x6e, 0xc0, 0x05,
+  0x3e, 0x05, 0xc1, 0x39, 0x05, 0x39, 0xc1, 0x05, 0xcb, 0x39, 0x3e, 0x39, 0xc4, 0x05, 0xc4, 0x39,
+  0xc1, 0x6b, 0xc1, 0x39, 0xc0, 0x00, 0xc6, 0x39, 0xc0, 0x00, 0xc1, 0x05, 0x00, 0xc5, 0x05, 0xc0,
+  0x0a, 0x00, 0xd4, 0x05, 0xc0, 0xfe, 0x13, 0xb3, 0xc1, 0x6e, 0x1c, 0xc2, 0x6f, 0xc0, 0x1c, 0xc0,
+  0x28, 0xc0, 0x1c, 0xc1, 0x66, 0x1c, 0xc7, 0x21, 0xc0, 0x67, 0x1c, 0xc8, 0x21, 0x1c, 0xc0, 0x21,
+  0x1c, 0xc9, 0x28, 0x1c, 0x28, 0x21, 0xc1, 0x28, 0xc0, 0x6e, 0xc3, 0x28, 0xc0, 0x2d, 0x6e, 0xc0,
+  0x6b, 0xc3, 0x6e, 0x32, 0x39, 0xc0, 0x2d, 0xc7, 0x28, 0xc7, 0x23, 0x28, 0xc0, 0x21, 0xc0, 0x28,
+  0xc2, 0x23, 0xc0, 0x1c, 0xc2, 0x28, 0xc0, 0x23, 0x28, 0xc5, 0x2d, 0x28, 0xc8, 0x2d, 0xc6, 0x39,
+  0xc0, 0x32, 0x67, 0x2d, 0xc2, 0x34, 0x32, 0x39, 0xc0, 0x2d, 0xc2, 0x39, 0xcd, 0x34, 0x39, 0x32,
+  0xc0, 0x39, 0xc1, 0x34, 0x39, 0xc3, 0x34, 0xc1, 0x39, 0xdb, 0x3e, 0xc1, 0x6b, 0xc0, 0x3e, 0xc0,
+  0x39, 0xc0, 0x05, 0x39, 0xc5, 0x05, 0xc2, 0x3e, 0x05, 0xc6, 0x39, 0xc0, 0x05, 0x39, 0xc4, 0x05,
+  0xc1, 0x66, 0xc0, 0x39, 0xc1, 0x00, 0xc0, 0x05, 0xc0, 0x00, 0xc7, 0x39, 0xc1, 0x00, 0xc7, 0x05,
+  0xc2, 0x00, 0xc2, 0x39, 0x00, 0xcf, 0x05, 0xc0, 0xfe, 0x13, 0xb3, 0xc5, 0x6e, 0x6b, 0x1c, 0xc0,
+  0x28, 0x1c, 0xc3, 0x66, 0x1c, 0xc8, 0x21, 0x1c, 0xcb, 0x21, 0x1c, 0xcb, 0x28, 0xc5, 0x6e, 0xc2,
+  0x28, 0xc1, 0x2d, 0xc0, 0x6f, 0xc7, 0x69, 0x2d, 0x28, 0x2d, 0xc3, 0x28, 0xc5, 0x66, 0x28, 0xc0,
+  0x1c, 0xc4, 0x28, 0xc0, 0x1c, 0xc0, 0x23, 0x1c, 0xc2, 0x23, 0xc2, 0x28, 0xc5, 0x2d, 0x28, 0xc8,
+  0x2d, 0xc6, 0x32, 0x39, 0x32, 0x2d, 0xc3, 0x6b, 0x32, 0x2d, 0xc4, 0x34, 0xc0, 0x39, 0xce, 0x34,
+  0x2d, 0x39, 0xc6, 0x34, 0xc0, 0x32, 0xc0, 0x34, 0x39, 0xd9, 0x6e, 0x39, 0x6f, 0xc0, 0x3e, 0xc2,
+  0x39, 0xc8, 0x05, 0xc7, 0x39, 0x05, 0xc0, 0x39, 0xc7, 0x05, 0xc1, 0x66, 0xc0, 0x39, 0xc2, 0x00,
+  0xc2, 0x39, 0xc1, 0x00, 0xd0, 0x05, 0xc1, 0x00, 0xc2, 0x39, 0x00, 0xd0, 0x05, 0xfe, 0x13, 0xb3,
+  0xc5, 0x6f, 0x1c, 0xc5, 0x66, 0xc1, 0x1c, 0xc1, 0x17, 0x1c, 0xc2, 0x17, 0x1c, 0xcc, 0x6e, 0xc0,
+  0x1c, 0xc2, 0x21, 0x1c, 0xc6, 0x28, 0x66, 0xc0, 0x28, 0xc3, 0x6e, 0x28, 0xc3, 0x2d, 0xc0, 0x6f,
+  0xc0, 0x6e, 0x39, 0xc1, 0x69, 0x39, 0xc0, 0x2d, 0xc0, 0x28, 0x2d, 0xc2, 0x28, 0xc4, 0x23, 0x28,
+  0x23, 0x1c, 0x28, 0x21, 0x1c, 0xc2, 0x28, 0x1c, 0xc6, 0x23, 0x28, 0x23, 0x28, 0xc7, 0x21, 0x28,
+  0xc8, 0x2d, 0x28, 0xc0, 0x2d, 0xc3, 0x32, 0x39, 0xc0, 0x2d, 0xcb, 0x6b, 0xc0, 0x32, 0x39, 0xc9,
+  0x32, 0xc1, 0x2d, 0x34, 0x2d, 0xc0, 0x32, 0xc1, 0x39, 0x32, 0x39, 0xc0, 0x34, 0x32, 0xc0, 0x2d,
+  0x34, 0x39, 0xc5, 0x34, 0x39, 0xd1, 0x3e, 0xc0, 0x6b, 0xc0, 0x3e, 0xc2, 0x39, 0xca, 0x05, 0xc7,
+  0x39, 0xc9, 0x05, 0xc2, 0x39, 0xc9, 0x6b, 0xc8, 0x39, 0xc0, 0x00, 0xc4, 0x05, 0xc2, 0x00, 0xd4,
+  0x05, 0xfe, 0x13, 0xb3, 0xcc, 0x66, 0xc1, 0x1c, 0xc2, 0x17, 0x1c, 0xc2, 0x17, 0x1c, 0xc3, 0x17,
+  0x1c, 0xd0, 0x17, 0xc0, 0x1c, 0xc1, 0x6f, 0x1c, 0xc1, 0x28, 0xc1, 0x69, 0x28, 0xc4, 0x6e, 0xc0,
+  0x6e, 0x6b, 0xc0, 0x32, 0x39, 0xc3, 0x2d, 0xc5, 0x28, 0xc4, 0x66, 0xc1, 0x1c, 0xc5, 0x23, 0x1c,
+  0xc2, 0x21, 0x1c, 0xc4, 0x28, 0xc4, 0x1c, 0x28, 0x2d, 0x21, 0x28, 0xce, 0x2d, 0xc0, 0x32, 0xc1,
+  0x39, 0x2d, 0xc9, 0x6b, 0xc1, 0x32, 0xc0, 0x39, 0xc0, 0x32, 0x39, 0xc0, 0x34, 0x39, 0x34, 0x39,
+  0xc0, 0x2d, 0xc2, 0x34, 0x2d, 0xc1, 0x32, 0xc0, 0x39, 0x32, 0xc1, 0x2d, 0xc2, 0x34, 0xc0, 0x39,
+  0xc3, 0x34, 0xc0, 0x39, 0xc5, 0x34, 0xc0, 0x39, 0x34, 0xc0, 0x39, 0xc7, 0x6e, 0x6b, 0x3e, 0xc0,
+  0x39, 0xcc, 0x05, 0x39, 0xc5, 0x05, 0x39, 0xc8, 0x05, 0xc2, 0x66, 0xc1, 0x39, 0xc7, 0x00, 0x39,
+  0x00, 0xc0, 0x39, 0x00, 0x39, 0xc1, 0x00, 0x39, 0xc1, 0x00, 0xc3, 0x05, 0x00, 0x05, 0xc1, 0x00,
+  0xc2, 0x39, 0x05, 0x00, 0xc3, 0x39, 0x00, 0xc8, 0xfe, 0x13, 0xb3, 0xca, 0x66, 0x1c, 0xc0, 0x17,
+  0xc5, 0x1c, 0xd6, 0x6e, 0x1c, 0xc9, 0x21, 0x1c, 0x6f, 0xc2, 0x21, 0xc1, 0x28, 0xc1, 0x6e, 0xc0,
+  0x6e, 0x6b, 0xc2, 0x32, 0x39, 0xc0, 0x2d, 0xc7, 0x28, 0xc1, 0x1c, 0x6b, 0xc0, 0x28, 0x23, 0xc0,
+  0x1c, 0xc4, 0x28, 0x1c, 0xcc, 0x28, 0xc0, 0x1c, 0x23, 0x1c, 0x21, 0x28, 0xc1, 0x23, 0x28, 0xca,
+  0x2d, 0xc1, 0x39, 0x2d, 0xca, 0x28, 0x2d, 0xc1, 0x32, 0x39, 0xc0, 0x2d, 0x39, 0xc0, 0x32, 0x2d,
+  0x6b, 0xc2, 0x39, 0x34, 0x2d, 0xc6, 0x34, 0x39, 0x34, 0x2d, 0x34, 0x2d, 0xc2, 0x39, 0xc9, 0x34,
+  0x39, 0xc0, 0x34, 0xc0, 0x39, 0xc0, 0x34, 0x39, 0x34, 0xc0, 0x39, 0xc4, 0x6e, 0x39, 0xc0, 0x3e,
+  0xc1, 0x39, 0xca, 0x6b, 0x39, 0xc1, 0x00, 0x6e, 0x39, 0x00, 0xc0, 0x39, 0xca, 0x05, 0xc1, 0x3e,
+  0xc0, 0x00, 0x39, 0xc9, 0x00, 0x39, 0x00, 0x39, 0x34, 0xc0, 0x00, 0x39, 0xc2, 0x00, 0x34, 0x00,
+  0xc4, 0x05, 0xc1, 0x00, 0xc2, 0x39, 0x00, 0xc4, 0x39, 0xc0, 0x00, 0xc7, 0xfe, 0x13, 0xb3, 0xc3,
+  0x6e, 0x1c, 0xc7, 0x66, 0xc3, 0x69, 0x17, 0x1c, 0xcc, 0x17, 0xc0, 0x1c, 0xd4, 0x6f, 0xc2, 0x21,
+  0xc1, 0x28, 0xc0, 0x6e, 0xc1, 0x6f, 0xc3, 0x69, 0x39, 0x2d, 0xc1, 0x28, 0xc2, 0x2d, 0x28, 0xc2,
+  0x1c, 0xc3, 0x6b, 0x1c, 0xc4, 0x23, 0x1c, 0xc6, 0x21, 0x1c, 0xc4, 0x28, 0xc0, 0x1c, 0xc1, 0x28,
+  0xc2, 0x23, 0x28, 0xca, 0x2d, 0xc1, 0x39, 0x2d, 0xc9, 0x28, 0xc1, 0x2d, 0xc1, 0x32, 0x39, 0xc1,
+  0x32, 0x2d, 0xc0, 0x39, 0x2d, 0xc0, 0x39, 0xc0, 0x2d, 0xc7, 0x6b, 0x32, 0x34, 0x2d, 0xc4, 0x34,
+  0xc0, 0x39, 0xcb, 0x34, 0xc1, 0x39, 0xc8, 0x6e, 0xc0, 0x39, 0xc0, 0x3e, 0xc1, 0x39, 0xc9, 0x3e,
+  0x39, 0xc1, 0x6b, 0x6e, 0xc0, 0x39, 0xc2, 0x05, 0x39, 0xc9, 0x05, 0x39, 0xc0, 0x00, 0x39, 0xca,
+  0x34, 0x39, 0xc2, 0x00, 0xc0, 0x39, 0xc0, 0x00, 0xc0, 0x39, 0x00, 0xc3, 0x05, 0xc1, 0x00, 0xc3,
+  0x39, 0xc0, 0x00, 0x39, 0x00, 0x39, 0xc1, 0x00, 0xc8, 0xfe, 0x13, 0xb3, 0xcb, 0x66, 0xc4, 0x69,
+  0xc0, 0x17, 0x1c, 0x17, 0x1c, 0x17, 0xc0, 0x1c, 0xc2, 0x17, 0xc1, 0x1c, 0xc0, 0x17, 0xc0, 0x1c,
+  0xca, 0x17, 0x1c, 0xc7, 0x6b, 0x6e, 0xc2, 0x69, 0xc0, 0x28, 0xc0, 0x6e, 0xc1, 0x6f, 0xc2, 0x69,
+  0xc1, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0x28, 0xc0, 0x2d, 0x28, 0x2d, 0x28, 0xc0, 0x1c, 0xcc, 0x23,
+  0x1c, 0xd2, 0x28, 0xc8, 0x2d, 0x28, 0xc2, 0x2d, 0xc0, 0x28, 0x32, 0x2d, 0xc9, 0x28, 0xc1, 0x2d,
+  0xc1, 0x32, 0x2d, 0x39, 0xc0, 0x32, 0x2d, 0xc0, 0x6b, 0x2d, 0x34, 0x39, 0xc0, 0x2d, 0xc1, 0x28,
+  0xc1, 0x2d, 0xc2, 0x32, 0xc0, 0x2d, 0xc5, 0x34, 0xc1, 0x39, 0xc1, 0x34, 0xc2, 0x39, 0x34, 0xc0,
+  0x39, 0x34, 0x39, 0x34, 0xc3, 0x39, 0xc5, 0x6e, 0x39, 0xd3, 0x6f, 0xc0, 0x39, 0xce, 0x05, 0x39,
+  0x05, 0x39, 0x34, 0x39, 0xce, 0x6b, 0xcb, 0x05, 0xc0, 0x00, 0xc2, 0x34, 0x39, 0x00, 0x39, 0x00,
+  0xc1, 0x39, 0x00, 0xc9, 0xfe, 0x13, 0xb3, 0xca, 0x66, 0xc0, 0x69, 0x17, 0x10, 0x17, 0xc0, 0x10,
+  0xc0, 0x17, 0xc1, 0x10, 0xc0, 0x1c, 0xc3, 0x17, 0x1c, 0xc2, 0x17, 0xc0, 0x1c, 0xc3, 0x17, 0xc0,
+  0x1c, 0xc3, 0x17, 0x1c, 0xc7, 0x6b, 0x6e, 0xc2, 0x69, 0xc0, 0x28, 0xc0, 0x6e, 0xc1, 0x6f, 0xc2,
+  0x2d, 0xc4, 0x28, 0x2d, 0xc3, 0x28, 0xc1, 0x1c, 0xcc, 0x23, 0x1c, 0xcb, 0x21, 0x1c, 0x23, 0x1c,
+  0x23, 0xc1, 0x28, 0x23, 0x28, 0x1c, 0x28, 0xc0, 0x23, 0xc0, 0x28, 0xc2, 0x23, 0x28, 0x2d, 0xc5,
+  0x28, 0x2d, 0xc0, 0x28, 0x2d, 0xc0, 0x28, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0xc2, 0x6e, 0xc1, 0x39,
+  0x32, 0x2d, 0xc0, 0x6b, 0xc0, 0x39, 0x34, 0x2d, 0xc1, 0x28, 0xc2, 0x2d, 0xc1, 0x34, 0x32, 0xc0,
+  0x2d, 0xc0, 0x28, 0x2d, 0xc4, 0x34, 0xc6, 0x39, 0x34, 0xc0, 0x39, 0xc1, 0x34, 0xc1, 0x2d, 0x34,
+  0x39, 0x34, 0xc1, 0x39, 0xc2, 0x6e, 0x39, 0xc7, 0x34, 0xc0, 0x39, 0x34, 0x39, 0xe2, 0x34, 0xc1,
+  0x39, 0xc5, 0x6b, 0xc4, 0x39, 0x00, 0xc3, 0x39, 0x6f, 0xc0, 0x00, 0xc2, 0x34, 0x00, 0xc0, 0x39,
+  0x00, 0xc0, 0x39, 0x34, 0xc1, 0x39, 0x34, 0x00, 0xc5, 0xfe, 0x13, 0xb3, 0xc0, 0x66, 0x1c, 0xc5,
+  0x17, 0xc0, 0x69, 0xc2, 0x17, 0xc1, 0x10, 0x17, 0x10, 0xc1, 0x17, 0xc0, 0x1c, 0xc1, 0x17, 0xc0,
+  0x10, 0x17, 0x1c, 0xc1, 0x17, 0xc0, 0x1c, 0xc0, 0x17, 0x1c, 0xc0, 0x17, 0xc0, 0x1c, 0x17, 0xc4,
+  0x1c, 0xc6, 0x6f, 0xc3, 0x1c, 0x6e, 0x28, 0xc0, 0x6e, 0xc1, 0x6f, 0xc0, 0x69, 0x2d, 0xc4, 0x28,
+  0xc1, 0x2d, 0xc1, 0x28, 0xc2, 0x66, 0x1c, 0xca, 0x23, 0x1c, 0xcc, 0x21, 0x1c, 0xc1, 0x23, 0xc4,
+  0x1c, 0xc0, 0x23, 0xc1, 0x28, 0xc2, 0x23, 0x28, 0xc0, 0x2d, 0xc3, 0x28, 0xc3, 0x2d, 0xc0, 0x28,
+  0x2d, 0xc2, 0x28, 0xc1, 0x2d, 0x39, 0x32, 0xc1, 0x2d, 0xc2, 0x6b, 0x39, 0x34, 0x2d, 0xc1, 0x28,
+  0xc4, 0x2d, 0xc4, 0x28, 0x2d, 0xc1, 0x34, 0xc0, 0x39, 0x34, 0xc1, 0x39, 0xc0, 0x34, 0xc2, 0x2d,
+  0xc0, 0x34, 0xc3, 0x39, 0x2d, 0x34, 0x39, 0x34, 0x39, 0x34, 0x39, 0xcf, 0x34, 0x39, 0xcd, 0x34,
+  0xc0, 0x39, 0xc0, 0x34, 0x39, 0xc2, 0x6b, 0x6e, 0x39, 0xc2, 0x34, 0xc0, 0x39, 0xc6, 0x34, 0xc0,
+  0x39, 0xc3, 0x00, 0xc3, 0x39, 0x00, 0xc2, 0x39, 0xc1, 0x05, 0x00, 0xc1, 0x39, 0x34, 0x00, 0x39,
+  0x00, 0xc0, 0x39, 0x34, 0xc4, 0x00, 0xc5, 0xfe, 0x13, 0xb3, 0x66, 0xc0, 0x1c, 0xc5, 0x17, 0x69,
+  0xc0, 0x17, 0x10, 0xc1, 0x17, 0xc0, 0x10, 0xc2, 0x17, 0x1c, 0xc4, 0x17, 0x10, 0x17, 0x1c, 0xc0,
+  0x17, 0xc0, 0x10, 0x1c, 0xc4, 0x17, 0xc3, 0x10, 0xc0, 0x17, 0x1c, 0xc5, 0x6e, 0x6b, 0xc1, 0x1c,
+  0x28, 0x1c, 0x28, 0xc0, 0x6e, 0xc2, 0x6e, 0x6b, 0x2d, 0xc4, 0x28, 0xc7, 0x21, 0x1c, 0xcc, 0x21,
+  0x1c, 0xd0, 0x6b, 0xc1, 0x1c, 0xc2, 0x28, 0x1c, 0x23, 0xc0, 0x28, 0xc2, 0x23, 0x28, 0xc1, 0x2d,
+  0xc2, 0x28, 0xc8, 0x2d, 0x28, 0xc1, 0x2d, 0xc0, 0x32, 0xc1, 0x2d, 0xc5, 0x6b, 0x2d, 0x28, 0x2d,
+  0x28, 0xc3, 0x2d, 0xc6, 0x28, 0xc0, 0x2d, 0xc0, 0x34, 0xc4, 0x2d, 0xc6, 0x34, 0xc2, 0x2d, 0xc1,
+  0x34, 0x39, 0x34, 0xc1, 0x39, 0xcb, 0x34, 0xc3, 0x39, 0xc0, 0x6e, 0x39, 0xc9, 0x34, 0xc0, 0x39,
+  0xca, 0x34, 0xc1, 0x39, 0x34, 0xc0, 0x39, 0xc0, 0x34, 0xc2, 0x39, 0xc0, 0x34, 0x39, 0xc1, 0x6b,
+  0xc3, 0x39, 0xc1, 0x00, 0x39, 0xc0, 0x00, 0xc4, 0x39, 0x34, 0xc0, 0x39, 0x00, 0x39, 0xc0, 0x34,
+  0xc1, 0x6b, 0x34, 0xc0, 0x00, 0xc5, 0xfe, 0x13, 0x93, 0xc0, 0x6e, 0xc6, 0x65, 0xc0, 0x66, 0x17,
+  0xc0, 0x10, 0xc1, 0x17, 0x10, 0xc1, 0x17, 0x1c, 0xc3, 0x17, 0x10, 0x17, 0x10, 0x17, 0x1c, 0x17,
+  0x10, 0x17, 0x10, 0x17, 0x1c, 0xc0, 0x17, 0x1c, 0xc0, 0x17, 0xc4, 0x10, 0xc0, 0x1c, 0xc5, 0x6e,
+  0x1c, 0xc0, 0x6f, 0x1c, 0x28, 0x1c, 0xc0, 0x28, 0xc0, 0x6e, 0xc1, 0x6e, 0xc0, 0x2d, 0xc4, 0x28,
+  0xc5, 0x21, 0x28, 0x1c, 0xc8, 0x17, 0x1c, 0xc5, 0x17, 0xc2, 0x1c, 0xca, 0x6b, 0xc0, 0x1c, 0xc3,
+  0x23, 0x1c, 0x23, 0x1c, 0xc0, 0x28, 0xc0, 0x23, 0xc0, 0x28, 0xc1, 0x2d, 0xc3, 0x28, 0xcc, 0x2d,
+  0xcb, 0x28, 0x2d, 0x28, 0xc2, 0x2d, 0xc7, 0x28, 0xc0, 0x2d, 0xc3, 0x6b, 0x6e, 0x34, 0x2d, 0xc1,
+  0x34, 0xc0, 0x2d, 0xc1, 0x34, 0xc2, 0x2d, 0x34, 0x39, 0x34, 0xc4, 0x39, 0xc6, 0x34, 0xc0, 0x39,
+  0xc0, 0x34, 0x39, 0x34, 0xc0, 0x39, 0xcd, 0x34, 0xc0, 0x39, 0xc6, 0x6f, 0xc0, 0x39, 0xc1, 0x34,
+  0x39, 0x34, 0x39, 0x34, 0xc9, 0x39, 0xc1, 0x6b, 0x39, 0xc0, 0x34, 0x00, 0x39, 0x00, 0x39, 0xc1,
+  0x00, 0xc4, 0x39, 0x34, 0xc7, 0x6b, 0x34, 0xc0, 0x39, 0xc0, 0x00, 0xc3, 0xfe, 0x13, 0x92, 0x6b,
+  0x6e, 0xc6, 0x10, 0xc0, 0x66, 0xc0, 0x17, 0x10, 0xc5, 0x17, 0x1c, 0xc2, 0x17, 0xc0, 0x10, 0xc1,
+  0x17, 0x1c, 0x10, 0xc0, 0x17, 0x10, 0xc1, 0x17, 0x1c, 0x17, 0x1c, 0xc0, 0x17, 0xc0, 0x1c, 0x17,
+  0xc0, 0x10, 0x17, 0xc1, 0x1c, 0xc0, 0x17, 0x1c, 0xc0, 0x6e, 0x1c, 0xc0, 0x6b, 0xc0, 0x1c, 0xc2,
+  0x6f, 0xc0, 0x6e, 0xc0, 0x6e, 0x2d, 0xc4, 0x28, 0xc6, 0x21, 0x28, 0x1c, 0xc7, 0x17, 0xc0, 0x1c,
+  0xc5, 0x17, 0xc0, 0x1c, 0xd5, 0x23, 0x1c, 0xc1, 0x23, 0xc2, 0x28, 0xc0, 0x2d, 0xc3, 0x28, 0xcc,
+  0x2d, 0xc5, 0x28, 0x2d, 0xc3, 0x28, 0x2d, 0xc0, 0x28, 0xc1, 0x2d, 0x28, 0xc0, 0x2d, 0x28, 0xc1,
+  0x2d, 0x28, 0xc0, 0x2d, 0xc4, 0x6b, 0xc1, 0x2d, 0xc1, 0x34, 0x6e, 0x2d, 0xc0, 0x34, 0xc0, 0x32,
+  0xc0, 0x2d, 0xc0, 0x32, 0x39, 0x34, 0x39, 0x34, 0xc1, 0x39, 0xc7, 0x34, 0xc0, 0x39, 0xc0, 0x2d,
+  0x34, 0x2d, 0x34, 0xc0, 0x39, 0xcb, 0x34, 0xc1, 0x39, 0xcb, 0x34, 0x39, 0xc0, 0x34, 0xcc, 0x6f,
+  0xc0, 0x34, 0xc2, 0x39, 0xc3, 0x00, 0xc3, 0x39, 0xc1, 0x34, 0xc5, 0x6b, 0xc0, 0x34, 0xc2, 0x39,
+  0x00, 0xc2, 0xfe, 0x13, 0x93, 0xc0, 0x6e, 0xc4, 0x17, 0xc0, 0x69, 0xc0, 0x66, 0x10, 0x67, 0xc0,
+  0x10, 0x0b, 0x10, 0xc3, 0x1c, 0xc1, 0x17, 0x10, 0xc2, 0x17, 0xc3, 0x10, 0x1c, 0xc0, 0x17, 0xc0,
+  0x10, 0xc1, 0x17, 0xc1, 0x10, 0x0b, 0x10, 0xc0, 0x17, 0x1c, 0xc6, 0x6e, 0x1c, 0xc3, 0x6b, 0x6e,
+  0xc1, 0x6e, 0x6e, 0x67, 0x2d, 0xc4, 0x28, 0xc6, 0x1c, 0xc7, 0x69, 0x1c, 0xc0, 0x17, 0xc1, 0x1c,
+  0xc3, 0x17, 0xc2, 0x1c, 0xd6, 0x23, 0xc4, 0x28, 0x2d, 0xc1, 0x28, 0xcd, 0x2d, 0xcb, 0x28, 0xd1,
+  0x2d, 0xc1, 0x34, 0xc2, 0x2d, 0x34, 0xc0, 0x2d, 0xc3, 0x34, 0x2d, 0xc3, 0x34, 0xc0, 0x6e, 0x34,
+  0x2d, 0x34, 0xc0, 0x39, 0xc6, 0x34, 0x39, 0xc0, 0x34, 0xc1, 0x2d, 0xc1, 0x34, 0x39, 0xcb, 0x34,
+  0xc0, 0x39, 0xc0, 0x34, 0x39, 0xc6, 0x34, 0xc1, 0x39, 0xc1, 0x34, 0xc9, 0x39, 0x6b, 0xc1, 0x39,
+  0x34, 0xc3, 0x00, 0x39, 0x00, 0xc0, 0x34, 0xc0, 0x00, 0xc0, 0x39, 0x34, 0xce, 0x39, 0x00, 0xc0,
+  0x66, 0xfe, 0x13, 0x93, 0xc1, 0x6e, 0x17, 0xc0, 0x1c, 0xc0, 0x17, 0x69, 0x66, 0x10, 0x0b, 0xc4,
+  0x10, 0xc3, 0x17, 0xc2, 0x10, 0xc4, 0x17, 0x10, 0xc0, 0x17, 0x1c, 0x17, 0x10, 0x17, 0x10, 0xc1,
+  0x17, 0xc1, 0x10, 0x0b, 0xc0, 0x10, 0x17, 0xc0, 0x1c, 0xcc, 0x6f, 0xc1, 0x6e, 0x6e, 0x2d, 0xc3,
+  0x28, 0xc8, 0x1c, 0xc9, 0x17, 0xc2, 0x1c, 0xc2, 0x17, 0xc3, 0x1c, 0xc2, 0x17, 0x1c, 0xc0, 0x6e,
+  0x1c, 0xce, 0x6b, 0xc0, 0x1c, 0xc1, 0x28, 0xc0, 0x2d, 0xc1, 0x28, 0x23, 0xc0, 0x28, 0xc6, 0x23,
+  0x28, 0xc2, 0x2d, 0xc7, 0x28, 0x2d, 0xc0, 0x28, 0xc4, 0x23, 0xc0, 0x28, 0xc9, 0x2d, 0xc1, 0x6b,
+  0xc0, 0x2d, 0xce, 0x34, 0xc2, 0x2d, 0xc0, 0x34, 0x6e, 0xc6, 0x34, 0xc0, 0x39, 0xc2, 0x34, 0x2d,
+  0x34, 0x39, 0xcc, 0x34, 0xc0, 0x39, 0xc0, 0x34, 0xc2, 0x39, 0xc4, 0x34, 0xd1, 0x6f, 0xc0, 0x34,
+  0xc2, 0x00, 0x39, 0x34, 0xc0, 0x00, 0x34, 0x39, 0x00, 0xc1, 0x39, 0x34, 0xcc, 0x39, 0x34, 0x39,
+  0x00, 0xc0, 0xfe, 0x13, 0x93, 0xc1, 0x6e, 0xc2, 0x17, 0xc0, 0x69, 0xc0, 0x66, 0x10, 0x0b, 0x10,
+  0xc8, 0x17, 0x10, 0xc8, 0x0b, 0x10, 0x17, 0x10, 0xc1, 0x0b, 0x10, 0xc0, 0x17, 0xc1, 0x66, 0x0b,
+  0xc0, 0x10, 0xc0, 0x17, 0x1c, 0xc1, 0x17, 0x1c, 0xc8, 0x6f, 0x69, 0xc0, 0x6f, 0x6e, 0x2d, 0xc2,
+  0x28, 0xc1, 0x66, 0x28, 0xc5, 0x23, 0x1c, 0xc7, 0x17, 0x10, 0x17, 0xc1, 0x1c, 0xc2, 0x17, 0x10,
+  0xc0, 0x17, 0xc0, 0x1c, 0xc6, 0x17, 0xc0, 0x1c, 0xd1, 0x28, 0xd3, 0x2d, 0xc0, 0x28, 0xc0, 0x2d,
+  0x28, 0x2d, 0xc1, 0x28, 0x2d, 0xc0, 0x28, 0xc9, 0x2d, 0x28, 0xc0, 0x23, 0x28, 0xc3, 0x2d, 0xd5,
+  0x6b, 0xc3, 0x6e, 0xc8, 0x34, 0xc1, 0x2d, 0xc1, 0x34, 0xc1, 0x39, 0xc3, 0x34, 0x39, 0x34, 0x39,
+  0xc1, 0x34, 0xc7, 0x39, 0xc2, 0x34, 0xc5, 0x66, 0x34, 0xd5, 0x39, 0xc0, 0x6b, 0xc1, 0x39, 0x34,
+  0xd0, 0x6b, 0xfe, 0x13, 0x92, 0x6b, 0xc0, 0x6e, 0xc0, 0x17, 0x1c, 0xc0, 0x10, 0x66, 0xc2, 0x10,
+  0xc5, 0x0b, 0xc0, 0x10, 0xc0, 0x17, 0x10, 0xc7, 0x0b, 0xc0, 0x10, 0x17, 0x10, 0xc0, 0x0b, 0xc1,
+  0x10, 0x17, 0xc0, 0x0b, 0xc1, 0x10, 0xc1, 0x17, 0xc0, 0x1c, 0xc0, 0x17, 0x1c, 0xc8, 0x6e, 0xc0,
+  0x6f, 0xc4, 0x21, 0x6b, 0xc1, 0x1c, 0x28, 0x1c, 0xc7, 0x17, 0xc0, 0x1c, 0xc2, 0x17, 0xc1, 0x10,
+  0x17, 0xc0, 0x1c, 0xc1, 0x17, 0xc0, 0x10, 0xc1, 0x17, 0x1c, 0xc2, 0x17, 0x1c, 0xc3, 0x17, 0xc0,
+  0x1c, 0xcf, 0x28, 0xc4, 0x66, 0xc0, 0x28, 0xcb, 0x2d, 0xc0, 0x28, 0xc4, 0x2d, 0x28, 0xc0, 0x2d,
+  0x28, 0xc4, 0x23, 0x28, 0xc5, 0x23, 0x28, 0x23, 0x28, 0xc0, 0x2d, 0xc8, 0x28, 0xc0, 0x2d, 0xcb,
+  0x6b, 0x2d, 0x34, 0xc1, 0x6e, 0xc7, 0x34, 0xc0, 0x2d, 0xc2, 0x34, 0x39, 0xc2, 0x34, 0x39, 0xc1,
+  0x34, 0xc0, 0x39, 0xc1, 0x34, 0xc1, 0x66, 0x34, 0xc4, 0x39, 0xc1, 0x34, 0xc5, 0x2f, 0x34, 0xd5,
+  0x39, 0xc0, 0x6b, 0xc0, 0x39, 0x34, 0xd1, 0x6b, 0xfe, 0x13, 0x92, 0x6b, 0xc0, 0x6e, 0xc0, 0x17,
+  0x1c, 0xc0, 0x10, 0x66, 0xc2, 0x10, 0xc0, 0x0b, 0xc6, 0x10, 0xc1, 0x0b, 0x10, 0xc0, 0x0b, 0x10,
+  0xc0, 0x0b, 0xc2, 0x10, 0xc1, 0x0b, 0xc1, 0x10, 0xc2, 0x0b, 0xc2, 0x10, 0xc0, 0x17, 0x10, 0x17,
+  0x1c, 0xca, 0x6e, 0xc0, 0x6f, 0xc3, 0x66, 0x21, 0xc0, 0x28, 0xc0, 0x1c, 0xc9, 0x17, 0xc1, 0x1c,
+  0xc0, 0x17, 0xc5, 0x1c, 0xc0, 0x10, 0xc0, 0x17, 0x10, 0xc1, 0x17, 0x1c, 0x17, 0xc1, 0x1c, 0xc4,
+  0x17, 0xc0, 0x1c, 0xc0, 0x17, 0x1c, 0x17, 0x1c, 0xca, 0x6b, 0x28, 0xc3, 0x23, 0xc0, 0x28, 0xc4,
+  0x1c, 0xc2, 0x28, 0xc2, 0x2d, 0x28, 0xc3, 0x23, 0x28, 0xc1, 0x2d, 0x28, 0xc4, 0x23, 0x28, 0xc7,
+  0x23, 0x28, 0xc0, 0x2d, 0x28, 0xc0, 0x2d, 0xc3, 0x28, 0x2d, 0x28, 0xc0, 0x2d, 0xce, 0x6b, 0x2d,
+  0x34, 0x6e, 0xc4, 0x69, 0x34, 0xc0, 0x2d, 0x28, 0x2d, 0xc2, 0x34, 0xc0, 0x39, 0xc0, 0x34, 0xc6,
+  0x39, 0x34, 0x66, 0xc1, 0x34, 0xc3, 0x39, 0xc2, 0x34, 0xc7, 0x28, 0x2f, 0x34, 0xc1, 0x28, 0x34,
+  0xcf, 0x39, 0x6b, 0xc0, 0x39, 0x34, 0xd2, 0xfe, 0x13, 0x92, 0xc0, 0x6b, 0x6e, 0xc2, 0x17, 0x10,
+  0x66, 0xcc, 0x10, 0xc2, 0x0b, 0xc3, 0x10, 0x0b, 0xc0, 0x10, 0xc3, 0x0b, 0x10, 0x17, 0x10, 0xc0,
+  0x0b, 0xc4, 0x10, 0x17, 0x10, 0x17, 0x1c, 0xcb, 0x6e, 0x6f, 0xc1, 0x66, 0x2d, 0x21, 0xc3, 0x1c,
+  0xc7, 0x17, 0x1c, 0xc2, 0x17, 0xc4, 0x10, 0xc0, 0x17, 0xc1, 0x10, 0xc4, 0x17, 0xc0, 0x1c, 0xc0,
+  0x17, 0xc0, 0x1c, 0xc3, 0x17, 0xc0, 0x1c, 0x17, 0xc2, 0x1c, 0xc5, 0x21, 0x1c, 0xc4, 0x28, 0xc2,
+  0x1c, 0xc0, 0x28, 0xc3, 0x1c, 0xc0, 0x6b, 0x1c, 0xc0, 0x28, 0x1c, 0x28, 0xc6, 0x23, 0xc0, 0x28,
+  0xd7, 0x2d, 0x28, 0x2d, 0x28, 0xc6, 0x2d, 0xc6, 0x28, 0x2d, 0xc5, 0x6f, 0xc2, 0x66, 0x39, 0x69,
+  0xc0, 0x34, 0xc0, 0x2d, 0x28, 0xc0, 0x2d, 0xc3, 0x34, 0x39, 0xc0, 0x34, 0xc1, 0x39, 0xc0, 0x34,
+  0xc2, 0x28, 0x34, 0xc7, 0x39, 0xc0, 0x34, 0xc0, 0x66, 0xc0, 0x34, 0xc1, 0x2f, 0xc3, 0x34, 0xc0,
+  0x28, 0xc1, 0x2f, 0x34, 0xcd, 0x39, 0x6b, 0xc0, 0x34, 0xcd, 0x2f, 0x34, 0xc2, 0xfe, 0x13, 0x92,
+  0xc0, 0x6f, 0x66, 0xc2, 0x10, 0x66, 0xcb, 0x10, 0xc3, 0x0b, 0xc3, 0x10, 0x0b, 0xc1, 0x10, 0xc3,
+  0x0b, 0x10, 0xc1, 0x0b, 0xc4, 0x10, 0xc0, 0x17, 0xc0, 0x10, 0x1c, 0xcb, 0x6f, 0x6e, 0xc1, 0x28,
+  0xc0, 0x69, 0x28, 0x21, 0x1c, 0xc9, 0x17, 0xc1, 0x1c, 0x17, 0xc4, 0x10, 0xc1, 0x17, 0x10, 0x17,
+  0xc0, 0x10, 0xc0, 0x17, 0xc0, 0x10, 0x17, 0x10, 0xc2, 0x17, 0x1c, 0xc0, 0x17, 0x1c, 0xc0, 0x17,
+  0x1c, 0xc0, 0x17, 0xc2, 0x1c, 0xc0, 0x17, 0xc1, 0x1c, 0xc6, 0x6b, 0x28, 0xc3, 0x1c, 0x28, 0xc2,
+  0x23, 0x1c, 0xc3, 0x28, 0xc8, 0x23, 0xc2, 0x28, 0xc2, 0x1c, 0xc2, 0x28, 0xd9, 0x2d, 0xc1, 0x28,
+  0xc0, 0x2d, 0x28, 0xc0, 0x2d, 0xc0, 0x28, 0x2d, 0xc1, 0x6b, 0x6e, 0xc2, 0x34, 0xc0, 0x6d, 0xc0,
+  0x39, 0x34, 0x2d, 0x28, 0xc1, 0x2d, 0xc1, 0x34, 0xc0, 0x39, 0xc2, 0x34, 0x39, 0x34, 0xc9, 0x2d,
+  0x34, 0xc0, 0x39, 0xc2, 0x34, 0x66, 0xc1, 0x34, 0xc0, 0x2f, 0x28, 0x2f, 0x34, 0x2f, 0xc0, 0x34,
+  0xc2, 0x2f, 0x34, 0xce, 0x6f, 0xc0, 0x34, 0xd2, 0xfe, 0x13, 0x93, 0x69, 0x6f, 0x10, 0xc0, 0x17,
+  0x10, 0x66, 0xcc, 0x10, 0x0b, 0x10, 0xc0, 0x0b, 0xc9, 0x10, 0xc0, 0x0b, 0x10, 0xc1, 0x0b, 0xc6,
+  0x10, 0xc3, 0x1c, 0xcb, 0x6f, 0x6e, 0xc1, 0x28, 0xc0, 0x69, 0xc0, 0x1c, 0xca, 0x17, 0xc0, 0x10,
+  0x1c, 0xc2, 0x17, 0x10, 0xc4, 0x17, 0xc1, 0x10, 0x17, 0xc1, 0x0b, 0x10, 0xc1, 0x17, 0xc0, 0x10,
+  0x17, 0x1c, 0xc0, 0x10, 0x17, 0x10, 0x17, 0xc4, 0x1c, 0x17, 0xc2, 0x1c, 0xc5, 0x6b, 0xc0, 0x28,
+  0xc1, 0x23, 0xc1, 0x28, 0xc1, 0x23, 0xc3, 0x1c, 0xc0, 0x28, 0xc3, 0x2d, 0xc0, 0x28, 0xc1, 0x23,
+  0x28, 0x23, 0x28, 0xc1, 0x23, 0x28, 0x1c, 0xc1, 0x23, 0x28, 0xc2, 0x23, 0xc1, 0x28, 0xc0, 0x23,
+  0xc1, 0x28, 0xcb, 0x2d, 0x28, 0x2d, 0xc0, 0x28, 0xc4, 0x2d, 0xc0, 0x28, 0x2d, 0xc4, 0x6e, 0x67,
+  0xc1, 0x2d, 0x6f, 0xc0, 0x2d, 0xc1, 0x28, 0xc0, 0x2d, 0xc1, 0x34, 0x2d, 0x34, 0xc7, 0x2d, 0xc4,
+  0x34, 0x2d, 0xc0, 0x34, 0xc2, 0x39, 0x34, 0xc0, 0x66, 0xc2, 0x34, 0x2f, 0x34, 0x28, 0x2f, 0xc0,
+  0x34, 0x28, 0xc0, 0x34, 0x2f, 0xc0, 0x34, 0xce, 0x6f, 0xc0, 0x34, 0xc2, 0x2f, 0x34, 0xcd, 0xfe,
+  0x13, 0x92, 0x6b, 0x10, 0xc0, 0x66, 0x10, 0x0b, 0xde, 0x10, 0xc0, 0x0b, 0xc8, 0x17, 0xc0, 0x10,
+  0xc1, 0x6f, 0xc2, 0x17, 0xc3, 0x1c, 0xc2, 0x6e, 0x6b, 0x6e, 0xc0, 0x28, 0xc1, 0x1c, 0xcb, 0x17,
+  0xc1, 0x1c, 0xc0, 0x17, 0xc1, 0x10, 0xc2, 0x17, 0xc1, 0x10, 0x17, 0x10, 0xc0, 0x0b, 0x10, 0xc6,
+  0x1c, 0xc0, 0x17, 0xc0, 0x10, 0xc0, 0x17, 0xc5, 0x1c, 0x17, 0xc2, 0x1c, 0x17, 0xc1, 0x1c, 0xc0,
+  0x6b, 0x28, 0xc2, 0x23, 0xc2, 0x28, 0xc0, 0x23, 0xc0, 0x1c, 0xc1, 0x23, 0xc1, 0x28, 0xc7, 0x23,
+  0xc1, 0x28, 0xc1, 0x23, 0x28, 0x23, 0x1c, 0xc1, 0x28, 0xc5, 0x23, 0x28, 0x23, 0x28, 0xc0, 0x23,
+  0xc0, 0x28, 0xc5, 0x23, 0x28, 0xcc, 0x2d, 0xc2, 0x6b, 0xc0, 0x2d, 0x34, 0xc0, 0x6e, 0x34, 0x2d,
+  0xc3, 0x28, 0xc3, 0x2d, 0xc2, 0x34, 0x2d, 0x34, 0x2d, 0x34, 0xc4, 0x2d, 0x28, 0xc0, 0x34, 0xc0,
+  0x2d, 0xc4, 0x34, 0x39, 0x34, 0xc1, 0x28, 0x6b, 0xc2, 0x34, 0x2f, 0xc0, 0x34, 0x28, 0x2f, 0xc0,
+  0x28, 0x2f, 0xc1, 0x34, 0xc5, 0x2f, 0x34, 0xc5, 0x39, 0x6b, 0x34, 0xc2, 0x2f, 0xc2, 0x34, 0xc2,
+  0x2f, 0xc1, 0x34, 0xc3, 0xfe, 0x13, 0x92, 0xc2, 0x66, 0xd0, 0x10, 0x0b, 0xc4, 0x10, 0x0b, 0xc7,
+  0x10, 0xc0, 0x0b, 0xc7, 0x10, 0xc2, 0x6b, 0xc0, 0x6e, 0xc1, 0x17, 0xc3, 0x1c, 0xc2, 0x6e, 0x6f,
+  0xc0, 0x66, 0xc2, 0x1c, 0xc9, 0x17, 0xc1, 0x10, 0x17, 0xc5, 0x1c, 0x10, 0x0b, 0x17, 0xc1, 0x10,
+  0xc2, 0x0b, 0xc1, 0x10, 0xc3, 0x17, 0x1c, 0x17, 0x10, 0xc3, 0x17, 0xc9, 0x1c, 0x17, 0xc1, 0x1c,
+  0xc3, 0x28, 0xc1, 0x66, 0xc0, 0x1c, 0xc1, 0x23, 0x1c, 0xc3, 0x23, 0x1c, 0xc0, 0x28, 0xc0, 0x2d,
+  0x28, 0xc8, 0x23, 0x28, 0xc0, 0x1c, 0xc2, 0x28, 0xca, 0x23, 0xc2, 0x28, 0xd3, 0x2d, 0xc4, 0x6f,
+  0x66, 0xc0, 0x2d, 0xc4, 0x28, 0xc3, 0x2d, 0xc0, 0x34, 0x2d, 0x34, 0xc8, 0x2d, 0xc1, 0x34, 0xca,
+  0x28, 0xc0, 0x34, 0xc1, 0x66, 0x34, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0xc0, 0x28, 0x23, 0x28, 0x34,
+  0xc2, 0x39, 0x34, 0xca, 0x39, 0x34, 0xc1, 0x2f, 0x34, 0x2f, 0xc1, 0x34, 0xc2, 0x2f, 0xc0, 0x34,
+  0x2f, 0x34, 0xc2, 0xfe, 0x13, 0x72, 0xc1, 0x6e, 0x0b, 0xd0, 0x10, 0x0b, 0xce, 0x10, 0xc0, 0x0b,
+  0xc6, 0x10, 0x0b, 0xc0, 0x10, 0x6b, 0x10, 0x17, 0x6e, 0xc1, 0x17, 0x1c, 0xc6, 0x6e, 0x6f, 0xc0,
+  0x66, 0xc0, 0x1c, 0xca, 0x17, 0xc1, 0x10, 0xc0, 0x17, 0x10, 0xc0, 0x17, 0x10, 0x0b, 0x10, 0xc1,
+  0x0b, 0xc0, 0x17, 0xc0, 0x10, 0x0b, 0xc4, 0x10, 0xc1, 0x0b, 0x10, 0xc0, 0x17, 0x10, 0xc4, 0x17,
+  0xcd, 0x1c, 0xc3, 0x28, 0xc1, 0x1c, 0xc0, 0x6b, 0x1c, 0xc1, 0x23, 0x1c, 0xc5, 0x28, 0xc8, 0x23,
+  0x28, 0xc1, 0x1c, 0xc5, 0x28, 0xc3, 0x23, 0xc0, 0x28, 0x23, 0x28, 0x23, 0xc6, 0x28, 0xc9, 0x23,
+  0x28, 0xc0, 0x23, 0xc0, 0x28, 0xc1, 0x2d, 0xc4, 0x6b, 0x2d, 0xc5, 0x28, 0xc3, 0x2d, 0xc1, 0x34,
+  0x2d, 0x34, 0xc8, 0x2d, 0x28, 0xc0, 0x34, 0x28, 0x34, 0xc5, 0x6e, 0x34, 0x28, 0xc1, 0x34, 0xc0,
+  0x28, 0xc0, 0x6b, 0xc0, 0x34, 0xc0, 0x2f, 0xc0, 0x28, 0x23, 0x28, 0x2f, 0xc1, 0x34, 0x39, 0x34,
+  0xc1, 0x2f, 0xc0, 0x34, 0xc1, 0x2f, 0xc0, 0x34, 0xc5, 0x2f, 0xc2, 0x34, 0xc2, 0x2f, 0xc3, 0x34,
+  0xc1, 0xfe, 0x13, 0x72, 0xc5, 0x66, 0x0b, 0xdc, 0x6e, 0xc0, 0x0b, 0xca, 0x10, 0xc1, 0x6b, 0x6e,
+  0x17, 0xc0, 0x1c, 0xc1, 0x17, 0x1c, 0xc3, 0x6e, 0x6f, 0xc0, 0x66, 0x1c, 0xcb, 0x17, 0xc1, 0x0b,
+  0x10, 0xc2, 0x17, 0x10, 0x0b, 0xc1, 0x10, 0x0b, 0x10, 0x17, 0x10, 0x0b, 0xc5, 0x10, 0xc0, 0x0b,
+  0xc0, 0x10, 0xc7, 0x17, 0xcd, 0x1c, 0xc4, 0x28, 0x66, 0xc5, 0x1c, 0xc4, 0x23, 0xc0, 0x28, 0xc4,
+  0x23, 0x1c, 0xc1, 0x28, 0xc2, 0x1c, 0xc5, 0x28, 0xc3, 0x23, 0x28, 0x23, 0xc0, 0x28, 0xc1, 0x23,
+  0xc3, 0x28, 0xc9, 0x23, 0xc0, 0x28, 0x23, 0xc2, 0x28, 0xc1, 0x2d, 0x28, 0xc0, 0x2d, 0xc2, 0x6b,
+  0x2d, 0xc3, 0x28, 0xc3, 0x2d, 0xc3, 0x34, 0xc2, 0x2d, 0xc2, 0x34, 0xc0, 0x28, 0xc4, 0x34, 0xc1,
+  0x28, 0x34, 0x6e, 0x34, 0xc0, 0x28, 0x34, 0x28, 0xc0, 0x34, 0x28, 0xc0, 0x6b, 0xc0, 0x28, 0x34,
+  0x2f, 0xc0, 0x28, 0xc3, 0x2f, 0x34, 0xc7, 0x2f, 0xc2, 0x34, 0xc3, 0x2f, 0xc7, 0x34, 0x2f, 0xc2,
+  0x34, 0x2f, 0xc0, 0xfe, 0x13, 0x72, 0xc4, 0x66, 0xc1, 0x0b, 0xd2, 0x6e, 0x0b, 0xc6, 0x10, 0xc1,
+  0x0b, 0xc9, 0x10, 0xc1, 0x6b, 0xc0, 0x10, 0x17, 0xc1, 0x6e, 0xc5, 0x6f, 0x6e, 0x28, 0xc0, 0x1c,
+  0xcb, 0x17, 0xc1, 0x0b, 0xc0, 0x10, 0xc3, 0x0b, 0xc4, 0x10, 0xc0, 0x0b, 0xc5, 0x10, 0x0b, 0xc1,
+  0x10, 0xc4, 0x0b, 0x10, 0xc1, 0x17, 0xcd, 0x1c, 0xc2, 0x6e, 0x1c, 0xc2, 0x6b, 0x1c, 0xc9, 0x23,
+  0xc0, 0x28, 0xc2, 0x23, 0xc0, 0x1c, 0xc0, 0x28, 0xc0, 0x23, 0xc2, 0x1c, 0xc2, 0x23, 0x28, 0xc3,
+  0x23, 0xc3, 0x28, 0xc1, 0x23, 0xc1, 0x28, 0xc4, 0x23, 0xc2, 0x28, 0xc0, 0x23, 0xc6, 0x28, 0xc2,
+  0x2d, 0xc9, 0x28, 0xc5, 0x2d, 0xc1, 0x6b, 0xc2, 0x2d, 0xc3, 0x28, 0x6b, 0xc0, 0x28, 0xc3, 0x34,
+  0xc2, 0x6e, 0x34, 0xc1, 0x28, 0xc4, 0x2f, 0xc0, 0x28, 0xc0, 0x2f, 0xc0, 0x28, 0xc0, 0x23, 0x28,
+  0x34, 0x2f, 0x34, 0xc2, 0x2f, 0xc0, 0x34, 0x2f, 0xc4, 0x34, 0xc4, 0x2f, 0xce, 0xfe, 0x13, 0x72,
+  0xc2, 0x66, 0xc0, 0x0b, 0xc0, 0x06, 0x0b, 0xd2, 0x6e, 0x0b, 0xc3, 0x10, 0x0b, 0xc7, 0x06, 0x0b,
+  0xc3, 0x10, 0xc6, 0x6b, 0xc0, 0x6e, 0xc4, 0x6e, 0x6f, 0xc0, 0x66, 0x1c, 0xc0, 0x21, 0x1c, 0xc8,
+  0x17, 0xc1, 0x0b, 0xc1, 0x10, 0x17, 0xc0, 0x0b, 0xc5, 0x10, 0xc0, 0x0b, 0xc7, 0x10, 0x0b, 0xc1,
+  0x10, 0xc1, 0x0b, 0xc0, 0x10, 0xc3, 0x67, 0x0b, 0x17, 0xc8, 0x10, 0x17, 0x1c, 0xd5, 0x28, 0xc0,
+  0x66, 0x28, 0x1c, 0x23, 0xc4, 0x1c, 0x23, 0xc0, 0x1c, 0xc2, 0x23, 0x28, 0xc1, 0x1c, 0xc2, 0x23,
+  0xc1, 0x28, 0xcb, 0x23, 0xc1, 0x28, 0xcf, 0x2d, 0xc6, 0x28, 0xc5, 0x2d, 0xc2, 0x6b, 0xc1, 0x2d,
+  0xc0, 0x34, 0x2d, 0xc1, 0x28, 0xc5, 0x2d, 0x34, 0xc4, 0x66, 0xc1, 0x28, 0xc2, 0x2f, 0xc0, 0x28,
+  0xc0, 0x2f, 0xc0, 0x28, 0xc0, 0x23, 0x28, 0xc0, 0x2f, 0xc0, 0x34, 0xc1, 0x2f, 0xc0, 0x34, 0x2f,
+  0xc1, 0x34, 0x2f, 0xc1, 0x34, 0xc2, 0x2f, 0xcf, 0xfe, 0x13, 0x72, 0xc1, 0x66, 0xc1, 0x69, 0x0b,
+  0x06, 0xc0, 0x0b, 0xd7, 0x6e, 0xc0, 0x0b, 0xcb, 0x10, 0x0b, 0xc0, 0x10, 0x6b, 0x10, 0x17, 0x10,
+  0x17, 0x6e, 0xc0, 0x17, 0x1c, 0xc3, 0x6e, 0x6f, 0x66, 0x21, 0x1c, 0xcb, 0x17, 0x10, 0x0b, 0xc2,
+  0x10, 0xc1, 0x0b, 0xc5, 0x10, 0xc0, 0x0b, 0xc8, 0x10, 0xc0, 0x0b, 0x10, 0xc0, 0x0b, 0xc1, 0x10,
+  0x0b, 0x10, 0xc1, 0x0b, 0x10, 0x17, 0xc1, 0x0b, 0x17, 0x10, 0x17, 0xc3, 0x1c, 0xd4, 0x6b, 0x1c,
+  0xc5, 0x23, 0x1c, 0xc9, 0x23, 0xc0, 0x1c, 0xc5, 0x23, 0xc0, 0x28, 0xc0, 0x23, 0xc1, 0x28, 0x23,
+  0xc1, 0x28, 0x23, 0x28, 0xd4, 0x2d, 0xc5, 0x28, 0xc7, 0x2d, 0xc1, 0x6b, 0xc0, 0x2d, 0xc1, 0x28,
+  0x34, 0x2d, 0x28, 0xc6, 0x2d, 0x34, 0xc5, 0x66, 0xc1, 0x28, 0xc1, 0x23, 0x2f, 0x28, 0x23, 0xc1,
+  0x28, 0x23, 0xc1, 0x2f, 0x28, 0x34, 0xc0, 0x2f, 0x34, 0x2f, 0x34, 0xc1, 0x2f, 0xc0, 0x28, 0x2f,
+  0xc1, 0x34, 0xc2, 0x2f, 0xcf, 0xfe, 0x13, 0x72, 0xc1, 0x66, 0x69, 0x0b, 0xc2, 0x06, 0xc0, 0x0b,
+  0x06, 0x0b, 0xc2, 0x06, 0x0b, 0xc6, 0x06, 0x0b, 0xc2, 0x06, 0xc0, 0x0b, 0xcf, 0x6e, 0x0b, 0xc1,
+  0x6f, 0xc0, 0x10, 0x17, 0xc0, 0x10, 0xc0, 0x17, 0x6e, 0xc1, 0x17, 0x1c, 0x6f, 0x6e, 0x28, 0xc0,
+  0x1c, 0xcb, 0x10, 0xc0, 0x0b, 0xc0, 0x10, 0xc2, 0x0b, 0xc7, 0x10, 0x0b, 0xc9, 0x10, 0x0b, 0xc4,
+  0x17, 0x0b, 0xc0, 0x10, 0xc3, 0x17, 0xc1, 0x10, 0xc1, 0x17, 0xc0, 0x10, 0x6e, 0x1c, 0xcb, 0x17,
+  0xc0, 0x1c, 0x17, 0x6f, 0x1c, 0xc2, 0x23, 0x1c, 0xc5, 0x23, 0x1c, 0xca, 0x23, 0xc0, 0x1c, 0x23,
+  0x1c, 0xc3, 0x23, 0xc0, 0x1c, 0xc1, 0x23, 0xc5, 0x28, 0xc6, 0x23, 0x28, 0xcb, 0x2d, 0xc1, 0x28,
+  0x2d, 0xc1, 0x28, 0xc7, 0x2d, 0xc0, 0x28, 0xc0, 0x2d, 0xc2, 0x28, 0xc4, 0x23, 0xc0, 0x28, 0xc2,
+  0x6f, 0x66, 0x34, 0xc1, 0x28, 0xc0, 0x23, 0xc0, 0x2f, 0x23, 0x28, 0x23, 0xc0, 0x2f, 0x28, 0x23,
+  0x2f, 0xc0, 0x28, 0x23, 0xc0, 0x6b, 0x2f, 0x28, 0x2f, 0xc1, 0x28, 0x2f, 0x34, 0xc1, 0x2f, 0xc0,
+  0x34, 0x2f, 0xc1, 0x34, 0xc3, 0x2f, 0xce, 0xfe, 0x13, 0x72, 0x66, 0xc1, 0x0b, 0xc0, 0x65, 0xc0,
+  0x06, 0xc0, 0x0b, 0xcd, 0x06, 0xc0, 0x0b, 0xc1, 0x06, 0xc0, 0x0b, 0xc0, 0x06, 0xc1, 0x0b, 0xc5,
+  0x06, 0x0b, 0x06, 0x0b, 0xc2, 0x6e, 0x0b, 0xc0, 0x10, 0x7f, 0x10, 0xc3, 0x6b, 0x6e, 0xc3, 0x6e,
+  0xc0, 0x6b, 0x1c, 0xc3, 0x17, 0x1c, 0xc0, 0x17, 0x1c, 0xc3, 0x10, 0x0b, 0xd2, 0x06, 0xc0, 0x0b,
+  0xd2, 0x6b, 0x17, 0x12, 0x17, 0xc0, 0x10, 0xc2, 0x17, 0xc1, 0x1c, 0xc0, 0x17, 0xc0, 0x1c, 0xc6,
+  0x17, 0xc0, 0x1c, 0x17, 0xc0, 0x1c, 0xc5, 0x6b, 0x1c, 0xc1, 0x23, 0xc0, 0x1c, 0xd4, 0x23, 0xc0,
+  0x1c, 0xc0, 0x23, 0x28, 0xc1, 0x23, 0x28, 0x1c, 0xc0, 0x23, 0xc0, 0x28, 0x23, 0xc0, 0x28, 0x23,
+  0xc0, 0x28, 0xc2, 0x23, 0xc1, 0x28, 0xc4, 0x6e, 0xc0, 0x28, 0xca, 0x23, 0x28, 0x2d, 0xc6, 0x67,
+  0x28, 0xc2, 0x23, 0xc1, 0x28, 0xc2, 0x2f, 0x28, 0x2d, 0xc0, 0x6b, 0x28, 0x2f, 0xc0, 0x23, 0x28,
+  0x23, 0x28, 0xc1, 0x2f, 0x23, 0xc0, 0x28, 0x2f, 0x23, 0xc2, 0x28, 0xc0, 0x2f, 0xc1, 0x28, 0x2f,
+  0xc3, 0x28, 0xc0, 0x2f, 0xc2, 0x34, 0xc2, 0x2f, 0xc0, 0x23, 0xc0, 0x2f, 0xc4, 0x66, 0x2f, 0x2a,
+  0xc0, 0x2f, 0xc0, 0xfe, 0x13, 0x52, 0xc2, 0x69, 0x6f, 0x3f, 0x0b, 0x06, 0xc2, 0x0b, 0xca, 0x06,
+  0xc0, 0x0b, 0xc1, 0x06, 0xc2, 0x0b, 0x06, 0xc2, 0x0b, 0xc1, 0x06, 0xc6, 0x0b, 0xc4, 0x6e, 0xc4,
+  0x6b, 0x6e, 0xc3, 0x6e, 0x6b, 0x21, 0x1c, 0xca, 0x17, 0xc0, 0x10, 0x0b, 0xd2, 0x06, 0xc1, 0x0b,
+  0xd2, 0x6b, 0x17, 0xc0, 0x0b, 0x10, 0xc2, 0x17, 0xc1, 0x1c, 0xc1, 0x17, 0xc4, 0x1c, 0xc1, 0x17,
+  0xc5, 0x1c, 0xc3, 0x6b, 0x1c, 0xcb, 0x17, 0x1c, 0xcc, 0x23, 0x1c, 0xc1, 0x23, 0xc1, 0x28, 0x1c,
+  0xc2, 0x23, 0x28, 0x23, 0x28, 0x23, 0xc1, 0x28, 0x23, 0xc1, 0x28, 0xc0, 0x23, 0x28, 0xd0, 0x23,
+  0xc1, 0x28, 0xc4, 0x6f, 0x28, 0x6b, 0x28, 0xc2, 0x23, 0xc2, 0x28, 0xc4, 0x6e, 0x34, 0xc1, 0x2f,
+  0xc0, 0x23, 0x28, 0x23, 0x28, 0xc1, 0x23, 0xc1, 0x28, 0x2f, 0x23, 0xc3, 0x28, 0xc0, 0x2f, 0xc0,
+  0x28, 0x2f, 0x28, 0x2f, 0xc0, 0x28, 0x34, 0xc0, 0x2f, 0xc2, 0x34, 0xc1, 0x2f, 0xc3, 0x66, 0xc0,
+  0x2f, 0xc1, 0x2a, 0xc3, 0x2f, 0xc0, 0xfe, 0x13, 0x51, 0xc2, 0x6b, 0xc9, 0x6e, 0xc4, 0x06, 0xc0,
+  0x0b, 0xc4, 0x06, 0xc3, 0x3f, 0x0b, 0x06, 0xc0, 0x0b, 0xc0, 0x06, 0xc8, 0x0b, 0xc4, 0x6e, 0xc3,
+  0x6b, 0x6e, 0xc3, 0x6e, 0xc0, 0x1c, 0xc9, 0x17, 0xc2, 0x10, 0x0b, 0xc9, 0x06, 0xc0, 0x0b, 0xc5,
+  0x06, 0xc0, 0x0b, 0xd3, 0x17, 0xc1, 0x10, 0xc5, 0x17, 0x1c, 0xc1, 0x17, 0xc0, 0x1c, 0x17, 0xcb,
+  0x1c, 0xc3, 0x6b, 0x1c, 0xc2, 0x23, 0xc0, 0x1c, 0xc4, 0x17, 0xc2, 0x1c, 0xc9, 0x23, 0xc0, 0x1c,
+  0xc4, 0x23, 0x1c, 0xc2, 0x23, 0xc2, 0x6e, 0xc0, 0x23, 0xc5, 0x28, 0xc0, 0x23, 0x28, 0xce, 0x23,
+  0xc1, 0x28, 0xcb, 0x23, 0xc2, 0x28, 0xc4, 0x6f, 0xc2, 0x66, 0xc0, 0x23, 0xc2, 0x28, 0xc0, 0x23,
+  0xc1, 0x28, 0xc0, 0x2f, 0x23, 0xc1, 0x28, 0xc1, 0x2f, 0xc0, 0x28, 0xc1, 0x34, 0xc0, 0x28, 0x34,
+  0xc0, 0x2f, 0xc1, 0x34, 0xc2, 0x2f, 0xc4, 0x23, 0xc0, 0x2f, 0x66, 0xc4, 0x2f, 0xc0, 0xfe, 0x13,
+  0x51, 0xc2, 0x6b, 0xca, 0x6e, 0xc3, 0x06, 0xc1, 0x3f, 0x06, 0xc9, 0x0b, 0x06, 0xc9, 0x0b, 0xc0,
+  0x06, 0x0b, 0xc1, 0x6e, 0x0b, 0xc0, 0x10, 0xc3, 0x6f, 0xc3, 0x6e, 0x6b, 0x1c, 0xc1, 0x66, 0x1c,
+  0x17, 0xc2, 0x1c, 0xc2, 0x10, 0xc0, 0x0b, 0x10, 0xc0, 0x0b, 0xc6, 0x06, 0xc2, 0x0b, 0xc4, 0x06,
+  0xc0, 0x0b, 0xd3, 0x10, 0x0b, 0xc1, 0x10, 0xc3, 0x17, 0x1c, 0xc2, 0x17, 0xc0, 0x1c, 0xc2, 0x17,
+  0xc8, 0x1c, 0xc3, 0x6b, 0x1c, 0xca, 0x17, 0xc1, 0x1c, 0xcb, 0x23, 0x1c, 0xc9, 0x23, 0xc2, 0x28,
+  0xc0, 0x1c, 0xc1, 0x23, 0x28, 0x23, 0x28, 0xd3, 0x23, 0x28, 0xcc, 0x23, 0xc4, 0x28, 0xc3, 0x6f,
+  0xc1, 0x28, 0xc0, 0x23, 0xc1, 0x28, 0xc1, 0x23, 0xc2, 0x6f, 0x23, 0xc4, 0x2f, 0xc1, 0x28, 0xc2,
+  0x34, 0xc1, 0x28, 0x2f, 0xc3, 0x34, 0x2f, 0xc1, 0x66, 0xc0, 0x23, 0xc1, 0x2f, 0xc0, 0x2a, 0xc6,
+  0xfe, 0x13, 0x51, 0xc2, 0x6b, 0xcb, 0x6e, 0xc2, 0x3f, 0xc0, 0x0b, 0x3f, 0xc2, 0x0b, 0xc0, 0x3f,
+  0x06, 0xc2, 0x0b, 0x06, 0xc2, 0x0b, 0xc1, 0x3f, 0xc3, 0x0b, 0xc0, 0x06, 0x0b, 0xc5, 0x6e, 0xc0,
+  0x6b, 0xc0, 0x6e, 0xc6, 0x17, 0xc0, 0x1c, 0xc1, 0x17, 0x10, 0xc0, 0x17, 0xc0, 0x1c, 0x17, 0x10,
+  0x0b, 0xc9, 0x06, 0x0b, 0x06, 0xc1, 0x0b, 0xc1, 0x06, 0xc2, 0x0b, 0xd8, 0x10, 0xc0, 0x0b, 0xc1,
+  0x10, 0x17, 0x1c, 0xc1, 0x17, 0xc3, 0x1c, 0x17, 0xc8, 0x1c, 0xc3, 0x6b, 0x1c, 0xca, 0x17, 0xc1,
+  0x1c, 0xcb, 0x23, 0x1c, 0xca, 0x23, 0x1c, 0xc0, 0x6f, 0xc0, 0x1c, 0xc2, 0x23, 0xc1, 0x28, 0xc9,
+  0x23, 0xc0, 0x28, 0xc2, 0x23, 0xc2, 0x28, 0xc6, 0x23, 0x28, 0xc3, 0x23, 0xc0, 0x28, 0xc0, 0x23,
+  0xc2, 0x28, 0x23, 0x28, 0xc0, 0x6f, 0xc0, 0x28, 0x23, 0xc2, 0x28, 0xc0, 0x23, 0xca, 0x6f, 0xc3,
+  0x28, 0xc4, 0x23, 0xc0, 0x28, 0xc1, 0x34, 0xc0, 0x2f, 0xc0, 0x66, 0xc0, 0x23, 0xc3, 0x2a, 0xc4,
+  0x23, 0xc0, 0xfe, 0x13, 0x72, 0x65, 0xc1, 0x6b, 0xcc, 0x0b, 0xc2, 0x3f, 0xc0, 0x0b, 0x3f, 0x0b,
+  0xc0, 0x3f, 0xc2, 0x06, 0xc5, 0x0b, 0xc0, 0x3f, 0xc8, 0x0b, 0xc5, 0x6e, 0xc1, 0x6b, 0x6e, 0xc8,
+  0x17, 0xc0, 0x1c, 0xc0, 0x17, 0xc0, 0x10, 0x17, 0xc0, 0x10, 0xc0, 0x0b, 0xc8, 0x06, 0x3f, 0x0b,
+  0x06, 0xc1, 0x0b, 0xc0, 0x06, 0xc3, 0x0b, 0xd9, 0x10, 0xc0, 0x0b, 0xc0, 0x10, 0xc1, 0x17, 0xc3,
+  0x1c, 0xc1, 0x17, 0xc9, 0x1c, 0xc7, 0x6b, 0xc3, 0x17, 0xc0, 0x1c, 0x17, 0xc1, 0x1c, 0xc2, 0x17,
+  0xc5, 0x1c, 0xcd, 0x23, 0x1c, 0xcb, 0x6f, 0xc2, 0x23, 0x28, 0xc1, 0x23, 0x28, 0xc2, 0x23, 0x28,
+  0xc3, 0x23, 0x28, 0xc1, 0x23, 0x28, 0xc1, 0x23, 0x28, 0xc3, 0x23, 0xc1, 0x28, 0x23, 0x28, 0x23,
+  0xc0, 0x28, 0xc3, 0x6b, 0x28, 0x23, 0xc2, 0x28, 0x23, 0xcd, 0x2f, 0xc1, 0x28, 0xc2, 0x2f, 0xc1,
+  0x23, 0xc0, 0x28, 0x6f, 0xc0, 0x2f, 0xc1, 0x66, 0xc0, 0x23, 0x2f, 0x23, 0xc1, 0x2f, 0xc0, 0x2a,
+  0xc2, 0x23, 0xc0, 0xfe, 0x13, 0x52, 0xc2, 0x69, 0xc1, 0x6f, 0x06, 0xc3, 0x3f, 0x06, 0xc2, 0x3f,
+  0xc1, 0x0b, 0xc1, 0x3f, 0xc6, 0x0b, 0x3f, 0xc1, 0x06, 0x3f, 0xc0, 0x0b, 0x3f, 0xc1, 0x0b, 0xc3,
+  0x06, 0x3f, 0xc0, 0x0b, 0xc6, 0x6e, 0xc0, 0x6b, 0x6e, 0xc2, 0x6e, 0xc0, 0x1c, 0xc1, 0x17, 0x1c,
+  0x17, 0x1c, 0x17, 0xc1, 0x10, 0xc0, 0x17, 0x10, 0x0b, 0xc7, 0x06, 0x3f, 0x06, 0x3f, 0x0b, 0x06,
+  0xc1, 0x0b, 0xc0, 0x3f, 0x0b, 0xc0, 0x3f, 0x06, 0x0b, 0xc2, 0x06, 0xc0, 0x0b, 0xc2, 0x06, 0x0b,
+  0xce, 0x10, 0x0b, 0xc2, 0x10, 0x17, 0xc3, 0x1c, 0xc1, 0x17, 0xc5, 0x10, 0xc0, 0x17, 0xc2, 0x1c,
+  0xc6, 0x17, 0x1c, 0xc2, 0x17, 0xc4, 0x1c, 0xc2, 0x17, 0xc6, 0x1c, 0xdb, 0x6f, 0xc0, 0x66, 0x28,
+  0xc1, 0x23, 0xc0, 0x28, 0xc2, 0x23, 0x28, 0xc5, 0x23, 0x28, 0xc3, 0x23, 0xc1, 0x28, 0x23, 0xc1,
+  0x28, 0xc1, 0x23, 0xc3, 0x28, 0xc2, 0x6b, 0x28, 0x23, 0xd1, 0x2f, 0xc2, 0x23, 0xc0, 0x2f, 0x23,
+  0x2f, 0xc1, 0x23, 0xc0, 0x28, 0x2f, 0x6e, 0x2f, 0xc1, 0x66, 0xc0, 0x23, 0x2f, 0x28, 0x23, 0xc0,
+  0x2f, 0xc0, 0x23, 0x2a, 0xc1, 0x23, 0xc0, 0xfe, 0x13, 0x52, 0xc2, 0x69, 0xc0, 0x6f, 0x06, 0x0b,
+  0x3f, 0xc1, 0x0b, 0x3f, 0xc1, 0x0b, 0x3f, 0xc1, 0x0b, 0xc0, 0x06, 0xc0, 0x0b, 0xc0, 0x3f, 0xc3,
+  0x0b, 0xc0, 0x3f, 0xc2, 0x0b, 0x3f, 0xc2, 0x06, 0x3f, 0xc1, 0x0b, 0x3f, 0x06, 0x3f, 0xc0, 0x0b,
+  0xc5, 0x6e, 0xc1, 0x6b, 0x6e, 0x17, 0x1c, 0x6e, 0xc0, 0x1c, 0xc4, 0x10, 0x17, 0x10, 0x17, 0xc0,
+  0x10, 0x17, 0xc0, 0x0b, 0xc8, 0x06, 0x3f, 0x06, 0xc0, 0x3f, 0x06, 0xc0, 0x3f, 0x0b, 0xc0, 0x3f,
+  0xc1, 0x06, 0xc0, 0x0b, 0xc2, 0x06, 0xc0, 0x0b, 0xc2, 0x06, 0xc0, 0x0b, 0xd2, 0x10, 0x17, 0xcd,
+  0x10, 0xc0, 0x0b, 0x17, 0xc2, 0x1c, 0xc2, 0x17, 0xc1, 0x1c, 0xc3, 0x17, 0xc9, 0x1c, 0xc0, 0x17,
+  0xc3, 0x1c, 0xdc, 0x6b, 0xc0, 0x6e, 0xc1, 0x23, 0xc0, 0x28, 0xc4, 0x23, 0xc1, 0x28, 0xc7, 0x23,
+  0xc0, 0x28, 0xc2, 0x23, 0xc7, 0x28, 0xc4, 0x23, 0xd1, 0x28, 0x6b, 0xc1, 0x23, 0xc3, 0x2f, 0xc0,
+  0x23, 0xc0, 0x2f, 0xc1, 0x6e, 0x2f, 0x23, 0x6b, 0xc0, 0x23, 0xc3, 0x28, 0xc0, 0x23, 0x2a, 0xc1,
+  0x23, 0xc0, 0xfe, 0x13, 0x52, 0xc4, 0x69, 0xc0, 0x6f, 0xc0, 0x3f, 0xc0, 0x06, 0xc1, 0x3f, 0xc0,
+  0x0b, 0x3f, 0xc0, 0x06, 0xc2, 0x3f, 0xc5, 0x0b, 0x06, 0xc2, 0x3f, 0xcc, 0x0b, 0xc6, 0x6f, 0x69,
+  0xc0, 0x17, 0x6e, 0xc2, 0x6e, 0x1c, 0xc4, 0x17, 0xc0, 0x10, 0xc0, 0x17, 0xc0, 0x10, 0x17, 0x10,
+  0x0b, 0xc6, 0x06, 0xc0, 0x3f, 0xc1, 0x06, 0x3f, 0xc0, 0x06, 0x0b, 0xc1, 0x3f, 0xc1, 0x0b, 0x06,
+  0xc0, 0x0b, 0x06, 0xc1, 0x0b, 0xc1, 0x06, 0xc3, 0x0b, 0xd0, 0x10, 0xc1, 0x17, 0xc1, 0x10, 0xc0,
+  0x17, 0xc3, 0x66, 0xc0, 0x17, 0x12, 0x10, 0x0b, 0x17, 0xc2, 0x1c, 0xc3, 0x17, 0xc1, 0x1c, 0x17,
+  0xc7, 0x12, 0x17, 0x1c, 0x17, 0xc6, 0x1c, 0xc1, 0x17, 0x1c, 0xc0, 0x17, 0xc1, 0x1c, 0x17, 0xc1,
+  0x1c, 0xc3, 0x6b, 0x1c, 0xc4, 0x23, 0x1c, 0xc0, 0x23, 0x1c, 0xc0, 0x23, 0x6e, 0xc0, 0x23, 0xc3,
+  0x28, 0x23, 0xc0, 0x28, 0x23, 0xc5, 0x28, 0xc3, 0x23, 0xc3, 0x28, 0xc1, 0x23, 0xc7, 0x28, 0xc1,
+  0x6b, 0x28, 0x23, 0xd2, 0x2f, 0x28, 0xc0, 0x23, 0xc3, 0x2f, 0xc0, 0x23, 0xc1, 0x2f, 0xc3, 0x23,
+  0xc5, 0x28, 0x2f, 0xc0, 0x66, 0xc1, 0x23, 0x2f, 0xfe, 0x13, 0x52, 0x69, 0xc5, 0x6f, 0x3f, 0xc2,
+  0x06, 0x0b, 0x3f, 0xcf, 0x0b, 0xc0, 0x3f, 0xcb, 0x06, 0xc1, 0x0b, 0xc6, 0x6f, 0x69, 0xc0, 0x17,
+  0xc0, 0x6e, 0x17, 0x1c, 0x6e, 0x1c, 0xc1, 0x17, 0xc1, 0x10, 0xc2, 0x0b, 0x17, 0x10, 0x17, 0x10,
+  0x0b, 0xc2, 0x06, 0x0b, 0xc0, 0x06, 0xc1, 0x3f, 0xc1, 0x0b, 0x3f, 0xc0, 0x06, 0xc1, 0x3f, 0xc3,
+  0x06, 0xc0, 0x0b, 0x06, 0xc1, 0x0b, 0x06, 0xc6, 0x0b, 0xc0, 0x06, 0xc1, 0x0b, 0xc9, 0x10, 0xc2,
+  0x17, 0xc0, 0x0b, 0x10, 0xc0, 0x17, 0xc6, 0x0b, 0xc0, 0x17, 0xc3, 0x1c, 0xc2, 0x17, 0xc1, 0x1c,
+  0xc1, 0x17, 0xc8, 0x1c, 0x17, 0xc7, 0x1c, 0xc0, 0x17, 0xc9, 0x1c, 0xc0, 0x17, 0x1c, 0x6b, 0x1c,
+  0xca, 0x23, 0x6e, 0x23, 0x28, 0xc8, 0x23, 0xc1, 0x28, 0xc0, 0x23, 0xc0, 0x28, 0xc1, 0x23, 0xc2,
+  0x28, 0xc2, 0x23, 0xc8, 0x28, 0xc3, 0x23, 0xd2, 0x28, 0xc1, 0x6b, 0x23, 0xc3, 0x2f, 0x23, 0xc1,
+  0x2f, 0xc3, 0x23, 0x6b, 0xc0, 0x23, 0xc4, 0x2f, 0x2a, 0xc1, 0x2f, 0x23, 0xfe, 0x13, 0x51, 0xce,
+  0x6b, 0x3f, 0xd5, 0x66, 0xc0, 0x3f, 0x3a, 0xc1, 0x3f, 0xc1, 0x06, 0xc0, 0x6e, 0xc5, 0x6f, 0x69,
+  0xc1, 0x17, 0x6e, 0xc4, 0x17, 0xc0, 0x10, 0xc3, 0x0b, 0xc0, 0x17, 0x10, 0xc0, 0x0b, 0xc1, 0x3f,
+  0x06, 0xc0, 0x0b, 0x3f, 0x06, 0xc1, 0x3f, 0xc4, 0x06, 0xc0, 0x3f, 0xc0, 0x0b, 0x3f, 0xc2, 0x06,
+  0xc2, 0x3f, 0x06, 0xc6, 0x0b, 0xc0, 0x06, 0xc4, 0x0b, 0xc7, 0x10, 0xc0, 0x0b, 0x10, 0x17, 0x10,
+  0xc2, 0x17, 0x10, 0xc1, 0x17, 0xc2, 0x0b, 0x10, 0x17, 0xc5, 0x1c, 0x17, 0xcb, 0x0b, 0x17, 0xd3,
+  0x1c, 0x17, 0xc2, 0x1c, 0xd1, 0x6f, 0xc9, 0x66, 0xc0, 0x28, 0xc1, 0x23, 0x28, 0xc3, 0x23, 0xc0,
+  0x28, 0xc2, 0x23, 0xca, 0x28, 0xc0, 0x23, 0xc5, 0x1c, 0x23, 0xcc, 0x28, 0xc1, 0x6b, 0x23, 0xc2,
+  0x2f, 0xc0, 0x23, 0xc2, 0x28, 0x6f, 0x2f, 0xc1, 0x66, 0xc0, 0x23, 0xc4, 0x2f, 0x2a, 0xc0, 0x23,
+  0xc1, 0xfe, 0x13, 0x51, 0xd9, 0x66, 0x3f, 0xc9, 0x3a, 0xc1, 0x3f, 0xc0, 0x3a, 0xc1, 0x3f, 0xc3,
+  0x6f, 0xc1, 0x6e, 0x0b, 0xc0, 0x6b, 0x10, 0xc0, 0x6b, 0xc0, 0x6e, 0xc3, 0x17, 0xc2, 0x10, 0xc2,
+  0x0b, 0xc0, 0x10, 0xc0, 0x0b, 0xc1, 0x66, 0x3f, 0x06, 0xc1, 0x3f, 0x0b, 0x06, 0x3f, 0xc4, 0x06,
+  0x0b, 0x3f, 0xc6, 0x06, 0xc1, 0x3f, 0xc4, 0x06, 0xc2, 0x0b, 0x06, 0xc6, 0x0b, 0xc6, 0x10, 0x0b,
+  0xc1, 0x10, 0xc5, 0x0b, 0x10, 0x17, 0xc2, 0x0b, 0x10, 0x17, 0xc5, 0x1c, 0x17, 0xcb, 0x0b, 0x17,
+  0xd7, 0x1c, 0xc6, 0x17, 0x1c, 0xc9, 0x6b, 0x1c, 0x23, 0x6e, 0xc0, 0x23, 0xc0, 0x28, 0xc1, 0x23,
+  0xc1, 0x28, 0xc0, 0x23, 0xc4, 0x28, 0xc0, 0x23, 0x28, 0xc2, 0x23, 0xcc, 0x28, 0x23, 0xc7, 0x1c,
+  0x23, 0xc9, 0x28, 0xc1, 0x23, 0xc3, 0x6f, 0x23, 0xc2, 0x2f, 0x28, 0xc0, 0x2f, 0xc0, 0x23, 0x6b,
+  0xc0, 0x23, 0xc5, 0x2a, 0xc0, 0x23, 0xc1, 0xfe, 0x13, 0x51, 0xc9, 0x66, 0x3f, 0xc3, 0x3a, 0x3f,
+  0xc6, 0x3a, 0xc1, 0x3f, 0xc7, 0x3a, 0xc0, 0x3f, 0x3a, 0x3f, 0xc0, 0x3a, 0xc0, 0x3f, 0xc0, 0x6f,
+  0x3f, 0xc0, 0x0b, 0x66, 0x0b, 0xc0, 0x6e, 0x0b, 0xc2, 0x10, 0x6b, 0x10, 0x17, 0x6e, 0xc2, 0x17,
+  0x10, 0xc9, 0x0b, 0xc2, 0x3f, 0x06, 0xc1, 0x0b, 0xc0, 0x3f, 0xc5, 0x06, 0x0b, 0xc0, 0x3f, 0xc6,
+  0x06, 0xc0, 0x3f, 0xc0, 0x0b, 0xc0, 0x3f, 0xc1, 0x06, 0xc1, 0x0b, 0xc0, 0x06, 0xc6, 0x0b, 0xc0,
+  0x06, 0x0b, 0xc4, 0x6b, 0x0b, 0xc0, 0x10, 0xc1, 0x17, 0xc0, 0x0b, 0xc1, 0x17, 0xc2, 0x0b, 0x10,
+  0xc0, 0x17, 0xc2, 0x1c, 0x17, 0xcc, 0x0b, 0xc0, 0x17, 0xd4, 0x1c, 0xc1, 0x17, 0xc0, 0x1c, 0xc3,
+  0x17, 0xc1, 0x1c, 0xca, 0x6b, 0xc1, 0x6e, 0xc2, 0x23, 0xcc, 0x28, 0xc3, 0x23, 0xc1, 0x28, 0x23,
+  0xdb, 0x66, 0x23, 0xc0, 0x28, 0xc0, 0x23, 0xc5, 0x28, 0x6b, 0x23, 0xc2, 0x2f, 0x28, 0x2f, 0x23,
+  0x6b, 0x23, 0xcb, 0xfe, 0x13, 0x51, 0x66, 0x3f, 0xc3, 0x3a, 0xc6, 0x3f, 0x3a, 0xc1, 0x3f, 0xc0,
+  0x3a, 0x3f, 0xc2, 0x3a, 0x3f, 0x3a, 0xc0, 0x3f, 0xc5, 0x3a, 0xc4, 0x3f, 0x3a, 0x3f, 0xc4, 0x6f,
+  0x66, 0x0b, 0xc6, 0x6e, 0xc1, 0x6f, 0xc2, 0x66, 0x10, 0xc0, 0x17, 0x10, 0xc3, 0x0b, 0x10, 0x17,
+  0x0b, 0xc1, 0x06, 0xc1, 0x3f, 0xc0, 0x0b, 0x3f, 0xc1, 0x3a, 0xc1, 0x3f, 0xc0, 0x06, 0x0b, 0xc0,
+  0x3f, 0xcf, 0x0b, 0x06, 0xc0, 0x0b, 0xc0, 0x06, 0xca, 0x0b, 0xcd, 0x10, 0x17, 0xc1, 0x10, 0xc0,
+  0x17, 0xc4, 0x1c, 0xc0, 0x17, 0xcb, 0x66, 0xc0, 0x17, 0x12, 0x17, 0xc2, 0x12, 0xc0, 0x17, 0xd4,
+  0x1c, 0xc0, 0x17, 0xc2, 0x1c, 0xc9, 0x6b, 0xc1, 0x6e, 0x23, 0x28, 0xc0, 0x23, 0xc1, 0x1c, 0xc0,
+  0x23, 0xc7, 0x28, 0x23, 0xc0, 0x28, 0x23, 0xc1, 0x28, 0xc0, 0x23, 0xd3, 0x66, 0x23, 0xc0, 0x1e,
+  0xc0, 0x23, 0x1e, 0xc0, 0x17, 0x23, 0xc0, 0x28, 0xc1, 0x23, 0xc5, 0x28, 0x23, 0xc2, 0x6f, 0xc2,
+  0x23, 0xc4, 0x1e, 0x23, 0xc5, 0xfe, 0x13, 0x51, 0x66, 0x3f, 0xc3, 0x3a, 0xc1, 0x3f, 0xc0, 0x3a,
+  0xc9, 0x3f, 0xc0, 0x3a, 0xc0, 0x3f, 0x3a, 0xc0, 0x3f, 0xc3, 0x3a, 0x3f, 0x3a, 0x3f, 0x3a, 0xc4,
+  0x3f, 0x3a, 0x3f, 0xc1, 0x6f, 0x66, 0xc0, 0x0b, 0xc1, 0x6e, 0x0b, 0xc1, 0x10, 0xc0, 0x6b, 0x6d,
+  0x6b, 0xc1, 0x17, 0x10, 0xc1, 0x0b, 0x10, 0x17, 0x10, 0x0b, 0xc5, 0x06, 0x3f, 0xc6, 0x3a, 0xc1,
+  0x3f, 0xc0, 0x3a, 0x3f, 0x0b, 0x3f, 0xc0, 0x3a, 0x3f, 0xc2, 0x0b, 0x3f, 0xc7, 0x0b, 0xc0, 0x06,
+  0xc0, 0x0b, 0xc0, 0x06, 0x3f, 0xc2, 0x06, 0x3f, 0x06, 0xc3, 0x0b, 0xcc, 0x10, 0xc0, 0x17, 0xc0,
+  0x0b, 0xc0, 0x10, 0xc0, 0x17, 0xc7, 0x10, 0x17, 0xc8, 0x0b, 0x6b, 0x17, 0xe5, 0x1c, 0xc7, 0x6b,
+  0x6e, 0xc0, 0x23, 0x28, 0x23, 0xc1, 0x1c, 0xc4, 0x23, 0xc4, 0x28, 0x23, 0x28, 0x23, 0xd9, 0x66,
+  0xc0, 0x23, 0x1e, 0xc5, 0x23, 0xcf, 0x6f, 0xc0, 0x23, 0xc5, 0x1e, 0x23, 0xc5, 0xfe, 0x13, 0x31,
+  0xc0, 0x6e, 0xc2, 0x3a, 0xc3, 0x3f, 0xc1, 0x3a, 0xc3, 0x3f, 0x3a, 0xc1, 0x3f, 0xc0, 0x3a, 0xc0,
+  0x3f, 0x3a, 0xc0, 0x3f, 0xc2, 0x3a, 0xc0, 0x3f, 0x3a, 0xc6, 0x3f, 0x3a, 0xc0, 0x3f, 0xc0, 0x6f,
+  0x3f, 0x6b, 0x0b, 0xc0, 0x6e, 0x0b, 0xc2, 0x10, 0xc2, 0x6f, 0xc0, 0x66, 0xc0, 0x10, 0xc0, 0x0b,
+  0xc2, 0x10, 0x0b, 0xc4, 0x06, 0x0b, 0x3f, 0xc6, 0x3a, 0xc2, 0x3f, 0x3a, 0x3f, 0x0b, 0x3f, 0xc0,
+  0x3a, 0xc0, 0x3f, 0xc1, 0x0b, 0x3f, 0xcb, 0x06, 0xc1, 0x3f, 0xc5, 0x06, 0xc2, 0x0b, 0xcc, 0x10,
+  0xc1, 0x17, 0x0b, 0xc3, 0x17, 0xc6, 0x10, 0xc0, 0x17, 0xc5, 0x0b, 0x17, 0x66, 0x0b, 0x17, 0xd8,
+  0x1c, 0xc1, 0x17, 0xc9, 0x1c, 0xc7, 0x6f, 0xc0, 0x66, 0x28, 0x23, 0xc1, 0x1c, 0xc4, 0x23, 0xc4,
+  0x28, 0xc1, 0x23, 0xc2, 0x1c, 0x17, 0xc2, 0x23, 0x17, 0x23, 0xc9, 0x17, 0x6b, 0x17, 0x1e, 0xc2,
+  0x23, 0xc1, 0x1e, 0xc1, 0x23, 0x17, 0x23, 0xc8, 0x6f, 0x23, 0xc4, 0x28, 0xc0, 0x23, 0xc4, 0x1e,
+  0x23, 0xc6, 0xfe, 0x13, 0x31, 0xc0, 0x6e, 0x3a, 0xc2, 0x3f, 0xc1, 0x3a, 0xc0, 0x3f, 0xc0, 0x3a,
+  0xc2, 0x3f, 0x3a, 0xc0, 0x3f, 0x3a, 0xc9, 0x3f, 0x3a, 0xcc, 0x3f, 0xc0, 0x6b, 0xc0, 0x6e, 0xc5,
+  0x6e, 0xc2, 0x6b, 0x6e, 0xc0, 0x17, 0xc1, 0x66, 0x0b, 0xc0, 0x10, 0x0b, 0xc5, 0x06, 0x0b, 0x3f,
+  0xc1, 0x06, 0xc0, 0x3f, 0xc1, 0x3a, 0xc4, 0x3f, 0xc2, 0x3a, 0xc1, 0x3f, 0xc1, 0x06, 0x0b, 0x3f,
+  0xca, 0x06, 0xc1, 0x3f, 0xc4, 0x0b, 0xc0, 0x3f, 0xc0, 0x06, 0xc1, 0x0b, 0xca, 0x10, 0xc0, 0x0b,
+  0xc5, 0x10, 0xc1, 0x17, 0xca, 0x12, 0xc0, 0x0b, 0xc3, 0x10, 0x17, 0x12, 0xc0, 0x17, 0xe0, 0x1c,
+  0xc8, 0x6b, 0x1c, 0xc0, 0x23, 0xc3, 0x17, 0xc0, 0x23, 0x1c, 0xc0, 0x23, 0xc5, 0x6e, 0xc0, 0x23,
+  0xc2, 0x17, 0xc6, 0x23, 0xc9, 0x66, 0xc0, 0x23, 0xc4, 0x1e, 0xc1, 0x23, 0x1e, 0x23, 0xc1, 0x28,
+  0x23, 0xcd, 0x6f, 0x28, 0x23, 0xcc, 0xfe, 0x13, 0x31, 0xc5, 0x6e, 0xc0, 0x3a, 0xc2, 0x3f, 0x3a,
+  0x3f, 0xc0, 0x3a, 0xca, 0x3f, 0x3a, 0xc1, 0x3f, 0x3a, 0xcc, 0x3f, 0xc1, 0x6b, 0xc0, 0x6e, 0xc6,
+  0x6e, 0xc0, 0x6b, 0x6e, 0x17, 0x10, 0xc0, 0x0b, 0xc2, 0x10, 0x0b, 0xc5, 0x06, 0xc0, 0x3f, 0xc6,
+  0x3a, 0xc5, 0x3f, 0xc1, 0x3a, 0xc3, 0x3f, 0xc1, 0x06, 0x3f, 0xc2, 0x3a, 0x3f, 0xc5, 0x06, 0xc0,
+  0x3f, 0xc8, 0x06, 0xc1, 0x0b, 0xcb, 0x10, 0x0b, 0xc6, 0x10, 0x0b, 0x17, 0xc3, 0x66, 0xc0, 0x17,
+  0xc3, 0x12, 0xc0, 0x0b, 0xc3, 0x10, 0x17, 0x12, 0x0b, 0x17, 0x0b, 0x17, 0xd8, 0x12, 0x17, 0xc7,
+  0x1c, 0xc5, 0x6b, 0x1c, 0x23, 0xc3, 0x17, 0xc1, 0x1c, 0xc0, 0x23, 0x1c, 0x23, 0xc8, 0x17, 0xc4,
+  0x23, 0x17, 0x1c, 0x23, 0xc6, 0x17, 0xc0, 0x23, 0x66, 0xc0, 0x23, 0xc3, 0x1e, 0xc0, 0x23, 0x1e,
+  0xc2, 0x23, 0xd0, 0x6f, 0x69, 0x23, 0xc6, 0x1e, 0xc0, 0x23, 0xc2, 0xfe, 0x13, 0x31, 0xcf, 0x6e,
+  0x3a, 0xc3, 0x3f, 0x3a, 0xd6, 0x3f, 0xc1, 0x6b, 0xc1, 0x6e, 0xc3, 0x6e, 0xc2, 0x6f, 0xc0, 0x66,
+  0x10, 0xc1, 0x0b, 0xc9, 0x06, 0x3f, 0xc7, 0x3a, 0xc1, 0x3f, 0x3a, 0xc0, 0x3f, 0xc1, 0x3a, 0xc4,
+  0x3f, 0xc2, 0x3a, 0xc1, 0x3f, 0xc6, 0x3a, 0x3f, 0xca, 0x06, 0xc2, 0x0b, 0xd5, 0x17, 0xc2, 0x66,
+  0xc0, 0x0b, 0x17, 0xc3, 0x12, 0x0b, 0xc5, 0x17, 0x0b, 0xc3, 0x17, 0xc6, 0x12, 0xc0, 0x17, 0xd7,
+  0x1c, 0xc7, 0x6b, 0xc1, 0x1c, 0xc0, 0x17, 0xc2, 0x1c, 0x17, 0xc0, 0x23, 0xca, 0x17, 0xc1, 0x23,
+  0xc0, 0x17, 0x1c, 0x23, 0xc6, 0x17, 0xc0, 0x1c, 0x17, 0x23, 0xc0, 0x17, 0x6b, 0xc1, 0x17, 0x1e,
+  0xc0, 0x17, 0xc1, 0x1e, 0xc0, 0x23, 0xcf, 0x6f, 0xc0, 0x23, 0xc4, 0x1e, 0x23, 0x1e, 0xc0, 0x23,
+  0xc1, 0x1e, 0xfe, 0x13, 0x31, 0xcf, 0x6e, 0x3a, 0x3f, 0x3a, 0xd8, 0x3f, 0x3a, 0x3f, 0xc0, 0x6f,
+  0x66, 0xc4, 0x0b, 0xc0, 0x6e, 0xc2, 0x6f, 0xc0, 0x10, 0xc3, 0x0b, 0xc8, 0x06, 0x3f, 0xc6, 0x3a,
+  0xc5, 0x3f, 0xc2, 0x3a, 0xc3, 0x3f, 0xc3, 0x3a, 0x3f, 0xc1, 0x3a, 0xc0, 0x3f, 0xd0, 0x06, 0xc1,
+  0x0b, 0xd5, 0x10, 0xc0, 0x6b, 0xc0, 0x0b, 0xc1, 0x10, 0x0b, 0x17, 0xc1, 0x66, 0x0b, 0xc5, 0x12,
+  0xc0, 0x0b, 0x12, 0x0b, 0xc1, 0x17, 0xc3, 0x12, 0xc2, 0x17, 0xc4, 0x12, 0xc0, 0x17, 0xce, 0x1c,
+  0xc9, 0x6b, 0xc0, 0x1c, 0xc2, 0x17, 0xc6, 0x1c, 0x23, 0xc5, 0x17, 0xc2, 0x23, 0x17, 0xc0, 0x23,
+  0xc7, 0x17, 0xc5, 0x23, 0xc2, 0x66, 0x23, 0x1e, 0x17, 0x1e, 0xc2, 0x23, 0xc3, 0x1e, 0x23, 0xc4,
+  0x1e, 0x23, 0xc8, 0x1e, 0x23, 0x1e, 0xc2, 0x23, 0xc0, 0x1e, 0xfe, 0x13, 0x31, 0xc8, 0x69, 0x3a,
+  0xc2, 0x6e, 0xc1, 0x3a, 0xc0, 0x3f, 0x3a, 0xd6, 0x3f, 0xc0, 0x3a, 0xc0, 0x3f, 0xc0, 0x6f, 0x66,
+  0xc3, 0x0b, 0xc2, 0x6e, 0x6b, 0xc0, 0x10, 0xc2, 0x0b, 0xca, 0x3f, 0xc6, 0x3a, 0xc6, 0x3f, 0xc1,
+  0x3a, 0xc6, 0x3f, 0xc0, 0x3a, 0xc1, 0x3f, 0x3a, 0xc1, 0x3f, 0xd1, 0x0b, 0x06, 0x0b, 0xd5, 0x10,
+  0xc0, 0x17, 0x66, 0x0b, 0xc1, 0x10, 0x0b, 0xc5, 0x10, 0x0b, 0xc2, 0x12, 0xc2, 0x0b, 0xc1, 0x17,
+  0xc0, 0x12, 0x0b, 0x17, 0x12, 0xc0, 0x0b, 0x12, 0xc0, 0x17, 0xc2, 0x12, 0xc0, 0x17, 0xd0, 0x6e,
+  0xc1, 0x17, 0x1c, 0xc4, 0x6b, 0x1c, 0xc3, 0x17, 0xc7, 0x23, 0xc0, 0x17, 0xc0, 0x1c, 0x23, 0x17,
+  0xc6, 0x23, 0xc6, 0x66, 0x17, 0xc3, 0x1c, 0x17, 0xc2, 0x23, 0x1e, 0x23, 0xc0, 0x1e, 0x17, 0x1e,
+  0xc1, 0x23, 0xca, 0x1e, 0xc0, 0x23, 0xc7, 0x1e, 0x23, 0x1e, 0xc0, 0x23, 0xc3, 0xfe, 0x13, 0x31,
+  0xc8, 0x69, 0x3a, 0xc3, 0x6e, 0x3a, 0xc6, 0x3f, 0x3a, 0xd5, 0x3f, 0xc2, 0x6f, 0x66, 0xc1, 0x0b,
+  0xc2, 0x6e, 0x6b, 0xc0, 0x10, 0xc2, 0x0b, 0xc4, 0x06, 0x0b, 0xc3, 0x3f, 0xc6, 0x3a, 0xc6, 0x3f,
+  0xc0, 0x3a, 0xd0, 0x3f, 0xc7, 0x3a, 0x3f, 0x3a, 0xc2, 0x3f, 0xc2, 0x0b, 0xd7, 0x10, 0xc0, 0x67,
+  0xc1, 0x0b, 0xc3, 0x10, 0xc0, 0x0b, 0xc6, 0x12, 0x0b, 0xc5, 0x12, 0xc0, 0x0b, 0x17, 0x12, 0x0b,
+  0xc1, 0x12, 0x17, 0xc1, 0x0b, 0x17, 0xc1, 0x12, 0x17, 0xc3, 0x0b, 0x17, 0xc9, 0x6e, 0xc0, 0x17,
+  0x1c, 0xc8, 0x17, 0xc8, 0x6f, 0xc0, 0x1c, 0x23, 0xc2, 0x17, 0xca, 0x23, 0xc3, 0x17, 0xd0, 0x6b,
+  0x23, 0xc9, 0x1e, 0xc2, 0x23, 0xc6, 0x1e, 0xc0, 0x23, 0xc3, 0x1e, 0x23, 0xfe, 0x13, 0x31, 0xc5,
+  0x69, 0x3a, 0xca, 0x6e, 0xc0, 0x3a, 0xd7, 0x3f, 0x3a, 0x3f, 0xc2, 0x6f, 0x66, 0x0b, 0xc4, 0x6e,
+  0xc0, 0x6b, 0x10, 0xc2, 0x0b, 0xc3, 0x06, 0xc1, 0x0b, 0xc0, 0x3f, 0xc2, 0x3a, 0xdd, 0x3f, 0xc0,
+  0x3a, 0xc0, 0x3f, 0xc1, 0x3a, 0xc2, 0x3f, 0x3a, 0xc4, 0x3f, 0xc2, 0x06, 0xc0, 0x0b, 0xcc, 0x06,
+  0x0b, 0xdc, 0x06, 0x0b, 0xc3, 0x6b, 0xc3, 0x0b, 0xc2, 0x12, 0xc0, 0x0b, 0xc0, 0x17, 0xc0, 0x12,
+  0xc0, 0x17, 0xc0, 0x12, 0x17, 0xc1, 0x0b, 0x17, 0xc5, 0x12, 0x17, 0xc0, 0x6e, 0xc0, 0x17, 0x1c,
+  0xc8, 0x17, 0xc9, 0x6f, 0xc5, 0x17, 0xca, 0x23, 0xc2, 0x17, 0xd0, 0x6b, 0x23, 0xca, 0x1e, 0x23,
+  0xc7, 0x1e, 0x23, 0xc1, 0x1e, 0xc0, 0x23, 0xc0, 0x1e, 0xc0, 0xfe, 0x13, 0x31, 0xc5, 0x69, 0x3a,
+  0xc3, 0x6e, 0xc0, 0x3a, 0xd4, 0x66, 0x3a, 0xc1, 0x33, 0xc0, 0x3a, 0xc4, 0x3f, 0xc1, 0x6f, 0xc0,
+  0x66, 0x0b, 0xc4, 0x6e, 0xc3, 0x0b, 0xc5, 0x06, 0xc1, 0x0b, 0xc0, 0x3f, 0xc0, 0x3a, 0xc0, 0x3f,
+  0x3a, 0xdb, 0x3f, 0x3a, 0xc4, 0x3f, 0x3a, 0xc2, 0x3f, 0x3a, 0xc5, 0x3f, 0x0b, 0x06, 0xc1, 0x0b,
+  0xc7, 0x06, 0xc0, 0x0b, 0xc0, 0x06, 0xc0, 0x0b, 0xc7, 0x10, 0x0b, 0xc6, 0x10, 0x0b, 0xd0, 0x6b,
+  0xc0, 0x0b, 0xc9, 0x6f, 0xc4, 0x12, 0xc0, 0x17, 0xc4, 0x0b, 0x12, 0x17, 0xc2, 0x6e, 0x17, 0x1c,
+  0xc0, 0x17, 0x1c, 0xc5, 0x17, 0xcb, 0x6f, 0xc3, 0x17, 0xc7, 0x23, 0xc0, 0x17, 0xc0, 0x23, 0xc1,
+  0x17, 0xd3, 0x23, 0xc4, 0x66, 0x23, 0xc1, 0x1e, 0xc1, 0x23, 0xc3, 0x1e, 0x23, 0xc3, 0x1e, 0xc0,
+  0x23, 0xc2, 0x1e, 0xfe, 0x13, 0x11, 0x6e, 0xd2, 0x6e, 0x3a, 0xcf, 0x69, 0x3a, 0xc5, 0x3f, 0x3a,
+  0x3f, 0xc1, 0x6f, 0x3f, 0x0b, 0xc4, 0x6e, 0xc4, 0x0b, 0xc3, 0x66, 0x0b, 0x06, 0xc2, 0x0b, 0xc0,
+  0x3f, 0x3a, 0x3f, 0x3a, 0xc2, 0x3f, 0x3a, 0xc0, 0x35, 0xc1, 0x3a, 0xd9, 0x3f, 0x3a, 0xc6, 0x3f,
+  0x3a, 0xc0, 0x3f, 0xc0, 0x06, 0xc2, 0x0b, 0xc4, 0x06, 0xc1, 0x0b, 0xc0, 0x06, 0x0b, 0x06, 0xc0,
+  0x0b, 0xf1, 0x6f, 0x66, 0xc2, 0x17, 0xc2, 0x0b, 0xc0, 0x17, 0xc2, 0x12, 0xc1, 0x17, 0x6e, 0xc0,
+  0x17, 0xc2, 0x1c, 0xc3, 0x17, 0xc7, 0x1c, 0x17, 0xc1, 0x6f, 0xc0, 0x17, 0xcb, 0x23, 0x17, 0xc1,
+  0x23, 0xc1, 0x17, 0xcf, 0x12, 0x17, 0x6b, 0x17, 0x1e, 0x23, 0xc2, 0x1e, 0xc0, 0x23, 0x1e, 0x23,
+  0x1e, 0xc1, 0x23, 0x1e, 0x23, 0xc5, 0x1e, 0xc1, 0x23, 0xc0, 0x1e, 0x23, 0xc1, 0xfe, 0x13, 0x11,
+  0x6e, 0xe4, 0x69, 0x3a, 0xc7, 0x6e, 0xc1, 0x6f, 0x3f, 0x0b, 0x66, 0x0b, 0xc2, 0x6e, 0xc3, 0x0b,
+  0xc3, 0x06, 0xc0, 0x0b, 0x06, 0xc2, 0x0b, 0x3f, 0xc0, 0x3a, 0x3f, 0x3a, 0xc1, 0x3f, 0x3a, 0xc1,
+  0x35, 0x3a, 0xe4, 0x3f, 0xc0, 0x3a, 0x3f, 0xc0, 0x06, 0xc3, 0x0b, 0xc3, 0x06, 0xc1, 0x0b, 0xc0,
+  0x06, 0x0b, 0x06, 0xc1, 0x0b, 0xe9, 0x6b, 0xc0, 0x0b, 0xc2, 0x12, 0xc2, 0x6e, 0xc3, 0x0b, 0xc0,
+  0x12, 0xc0, 0x17, 0xc0, 0x12, 0x17, 0x12, 0xc0, 0x17, 0xc5, 0x6e, 0xc3, 0x17, 0xd7, 0x12, 0x17,
+  0xc6, 0x6f, 0x17, 0xcd, 0x12, 0xc1, 0x17, 0xc2, 0x23, 0xc2, 0x66, 0xc6, 0x23, 0x17, 0x23, 0xc0,
+  0x6e, 0x23, 0xc0, 0x1e, 0xc0, 0x23, 0xc0, 0x1e, 0xc4, 0x23, 0xfe, 0x13, 0x11, 0x6e, 0xcd, 0x69,
+  0x3a, 0xd4, 0x33, 0x3a, 0xc8, 0x6e, 0xc0, 0x6f, 0xc0, 0x3f, 0x6b, 0x0b, 0xc2, 0x6e, 0xc3, 0x0b,
+  0xc2, 0x06, 0xc2, 0x0b, 0xc0, 0x3f, 0x06, 0x3f, 0xc0, 0x3a, 0xc3, 0x3f, 0xc0, 0x3a, 0xcb, 0x35,
+  0xc0, 0x3a, 0xdd, 0x3f, 0xc3, 0x06, 0xc6, 0x0b, 0xc1, 0x06, 0x0b, 0x06, 0xc0, 0x0b, 0x06, 0x0b,
+  0x06, 0xc1, 0x0b, 0xe3, 0x06, 0x0b, 0xc2, 0x6b, 0xc3, 0x6e, 0xc1, 0x0b, 0xc2, 0x12, 0xc0, 0x0b,
+  0x17, 0xc0, 0x12, 0x17, 0x12, 0xc0, 0x17, 0xc8, 0x6e, 0x17, 0xcc, 0x6f, 0xc0, 0x17, 0xe0, 0x12,
+  0xc4, 0x17, 0xc1, 0x23, 0xc0, 0x66, 0xc0, 0x23, 0x1e, 0x23, 0x1e, 0xc0, 0x17, 0xc0, 0x1e, 0xc0,
+  0x23, 0xc3, 0x1e, 0xc5, 0x23, 0xc0, 0x1e, 0xc0, 0xfe, 0x13, 0x11, 0x6e, 0xcd, 0x69, 0x3a, 0xdf,
+  0x6e, 0xc0, 0x6f, 0xc0, 0x3f, 0x6b, 0x0b, 0x06, 0x0b, 0xc1, 0x6e, 0xc2, 0x0b, 0xc1, 0x06, 0xc2,
+  0x0b, 0xc1, 0x3f, 0x0b, 0x3f, 0xc0, 0x3a, 0xc9, 0x35, 0x69, 0x33, 0x35, 0x3a, 0xc2, 0x35, 0xc5,
+  0x3a, 0xc7, 0x35, 0x3a, 0xcb, 0x3f, 0x3a, 0xc1, 0x3f, 0xc1, 0x0b, 0x3f, 0x0b, 0xc1, 0x3f, 0xc1,
+  0x0b, 0x06, 0xc0, 0x0b, 0xc0, 0x06, 0x0b, 0x3f, 0x06, 0xc5, 0x0b, 0xe7, 0x6b, 0xc3, 0x0b, 0x6f,
+  0xc1, 0x0b, 0xc1, 0x12, 0xc3, 0x17, 0x12, 0x17, 0x12, 0xc0, 0x17, 0xc8, 0x6e, 0x17, 0xc1, 0x12,
+  0x17, 0xd2, 0x12, 0xc0, 0x17, 0x12, 0x17, 0xd4, 0x12, 0xc2, 0x17, 0x12, 0x17, 0xc1, 0x6f, 0x66,
+  0xc5, 0x17, 0x1e, 0xc3, 0x23, 0xc2, 0x1e, 0xc2, 0x17, 0x1e, 0xc4, 0xfe, 0x13, 0x11, 0x6e, 0xc5,
+  0x69, 0x3a, 0xc7, 0x35, 0x3a, 0xc1, 0x33, 0x3a, 0xd4, 0x33, 0x3a, 0xc0, 0x6e, 0xc3, 0x6f, 0x3f,
+  0xc0, 0x6b, 0xc0, 0x0b, 0xc1, 0x6e, 0xc0, 0x0b, 0xc2, 0x06, 0xc3, 0x3f, 0xc5, 0x3a, 0xc9, 0x65,
+  0xc0, 0x33, 0x3a, 0xc3, 0x35, 0xc5, 0x3a, 0xc6, 0x35, 0x3a, 0xc1, 0x35, 0xc0, 0x3a, 0xc7, 0x3f,
+  0x3a, 0xc1, 0x3f, 0xc1, 0x0b, 0x06, 0xc1, 0x3f, 0xc2, 0x0b, 0x06, 0xc3, 0x3f, 0xc1, 0x06, 0xc4,
+  0x0b, 0xc4, 0x06, 0x0b, 0xc8, 0x06, 0x0b, 0xd4, 0x06, 0xc0, 0x0b, 0xc4, 0x6b, 0xc1, 0x0b, 0xc5,
+  0x6f, 0xc2, 0x12, 0x17, 0xcc, 0x12, 0xc3, 0x17, 0x12, 0xc0, 0x17, 0xcd, 0x12, 0xc0, 0x17, 0xc6,
+  0x6f, 0x17, 0xcc, 0x12, 0xc1, 0x17, 0xc0, 0x12, 0x17, 0xc1, 0x6b, 0x17, 0xc4, 0x1e, 0xc0, 0x17,
+  0xc2, 0x1e, 0x23, 0xc1, 0x1e, 0xc2, 0x17, 0xc0, 0x1e, 0xc3, 0xfe, 0x13, 0x11, 0x6e, 0xc1, 0x35,
+  0x3a, 0xc2, 0x35, 0xc0, 0x3a, 0xc5, 0x35, 0xc1, 0x69, 0x6e, 0x3a, 0x2e, 0x3a, 0xd6, 0x6e, 0xc2,
+  0x6f, 0xc5, 0x6e, 0xc1, 0x0b, 0xc2, 0x66, 0x3f, 0xc8, 0x3a, 0xca, 0x2e, 0xc0, 0x35, 0x3a, 0xc2,
+  0x35, 0xc0, 0x2e, 0xc2, 0x3a, 0xc8, 0x35, 0xc0, 0x3a, 0x35, 0xc1, 0x3a, 0xcb, 0x3f, 0xc8, 0x0b,
+  0xc0, 0x06, 0xc3, 0x3f, 0xc1, 0x06, 0xc4, 0x0b, 0xc3, 0x06, 0xc1, 0x0b, 0xc5, 0x06, 0xc1, 0x0b,
+  0xcd, 0x06, 0x0b, 0xcd, 0x6b, 0x0b, 0xc4, 0x12, 0x0b, 0x6f, 0xd1, 0x12, 0xc0, 0x17, 0x12, 0xc0,
+  0x17, 0xcd, 0x12, 0xc3, 0x17, 0xca, 0x12, 0xc4, 0x17, 0x12, 0xc0, 0x17, 0xc0, 0x12, 0xc2, 0x17,
+  0xc3, 0x6b, 0x17, 0xc3, 0x1e, 0xc0, 0x17, 0xc3, 0x1e, 0xc7, 0x17, 0x1e, 0xc3, 0xfe, 0x13, 0x11,
+  0x6e, 0xc1, 0x35, 0x3a, 0xc3, 0x65, 0x3a, 0xc1, 0x35, 0xc0, 0x3a, 0xc0, 0x35, 0x2e, 0xc2, 0x35,
+  0xc0, 0x3a, 0xcf, 0x6e, 0x3a, 0xc5, 0x3f, 0xc1, 0x6f, 0xc5, 0x6e, 0x0b, 0xc3, 0x66, 0xc0, 0x0b,
+  0xc0, 0x3f, 0xc3, 0x0b, 0x3f, 0x3a, 0xc9, 0x35, 0x2e, 0xc1, 0x35, 0x3a, 0x35, 0x3a, 0x69, 0x2e,
+  0x35, 0x2e, 0xc3, 0x3a, 0xc3, 0x33, 0x3a, 0xc1, 0x35, 0xc0, 0x3a, 0x35, 0xc1, 0x3a, 0xcb, 0x3f,
+  0xc5, 0x0b, 0xc0, 0x3f, 0xc0, 0x0b, 0xc0, 0x3f, 0xc4, 0x3a, 0x3f, 0xc2, 0x06, 0xc0, 0x0b, 0xc2,
+  0x06, 0xc3, 0x0b, 0xc4, 0x06, 0xc2, 0x0b, 0xc4, 0x06, 0x0b, 0xc3, 0x06, 0xc2, 0x0b, 0xcc, 0x6b,
+  0x0b, 0xc6, 0x12, 0x6e, 0xc7, 0x12, 0x17, 0xc3, 0x12, 0x17, 0x12, 0xc0, 0x17, 0xc1, 0x12, 0x17,
+  0x12, 0x17, 0xc0, 0x12, 0xc0, 0x17, 0xc6, 0x12, 0xc4, 0x17, 0xc5, 0x6f, 0x17, 0xc1, 0x12, 0xc5,
+  0x17, 0xc0, 0x12, 0x17, 0x12, 0xc4, 0x17, 0xc2, 0x6b, 0x17, 0xca, 0x1e, 0x23, 0xc0, 0x1e, 0xc3,
+  0x17, 0xc0, 0x1e, 0xc3, 0xfe, 0x13, 0x11, 0xc0, 0x6e, 0x65, 0x35, 0x3a, 0xc0, 0x69, 0x3a, 0xc1,
+  0x2e, 0xc0, 0x3a, 0x35, 0x3a, 0x33, 0xc0, 0x2e, 0xc3, 0x3a, 0x35, 0xc0, 0x2e, 0x3a, 0xc5, 0x2e,
+  0x3a, 0xc4, 0x33, 0x3a, 0xc0, 0x6e, 0x3a, 0xc2, 0x3f, 0xc3, 0x6f, 0xc4, 0x6e, 0x0b, 0xc2, 0x66,
+  0xc1, 0x0b, 0xc0, 0x3f, 0xc5, 0x3a, 0xc1, 0x33, 0xc0, 0x35, 0x3a, 0xc1, 0x35, 0x3a, 0x2e, 0xc0,
+  0x35, 0xc1, 0x3a, 0x35, 0x3a, 0xc0, 0x2e, 0xc5, 0x35, 0x3a, 0xc0, 0x2e, 0xc0, 0x35, 0xc1, 0x33,
+  0x2e, 0x35, 0x3a, 0x35, 0xc1, 0x3a, 0xcb, 0x3f, 0xd1, 0x3a, 0x3f, 0xc2, 0x06, 0xc1, 0x0b, 0xc1,
+  0x06, 0xc3, 0x0b, 0xc4, 0x06, 0xc4, 0x0b, 0xc1, 0x06, 0xc0, 0x0b, 0xc3, 0x06, 0xc2, 0x0b, 0xcc,
+  0x6b, 0x0b, 0xc5, 0x12, 0x0b, 0x12, 0xc0, 0x0b, 0x12, 0x6e, 0xc6, 0x12, 0xc0, 0x17, 0xc1, 0x12,
+  0x17, 0x12, 0xc1, 0x17, 0xc0, 0x12, 0xc0, 0x17, 0xc9, 0x12, 0xc4, 0x17, 0xc9, 0x12, 0xc8, 0x17,
+  0x12, 0xc5, 0x17, 0xc1, 0x6b, 0xc0, 0x17, 0xc6, 0x12, 0x17, 0xc0, 0x1e, 0xc6, 0x17, 0xc0, 0x1e,
+  0xc0, 0x66, 0xc1, 0xfe, 0x13, 0x10, 0x6f, 0x66, 0x3a, 0xc0, 0x35, 0x3a, 0x35, 0x3a, 0xc1, 0x35,
+  0xc0, 0x2e, 0xc0, 0x6e, 0x35, 0x2e, 0xc4, 0x3a, 0x35, 0xc0, 0x3a, 0xc0, 0x35, 0xc2, 0x3a, 0xd0,
+  0x6e, 0xc3, 0x6b, 0x6e, 0xc0, 0x6e, 0x0b, 0xc7, 0x3f, 0xc6, 0x3a, 0x3f, 0x3a, 0xc8, 0x2e, 0x35,
+  0xc1, 0x3a, 0xc0, 0x35, 0xc3, 0x2e, 0xc4, 0x35, 0x3a, 0xc0, 0x2e, 0xc0, 0x35, 0x2e, 0x33, 0x35,
+  0xc3, 0x2e, 0x33, 0x3a, 0xc6, 0x35, 0x3a, 0xc2, 0x3f, 0xcc, 0x3a, 0x3f, 0xc6, 0x06, 0x0b, 0x06,
+  0xc0, 0x0b, 0xc1, 0x06, 0x3f, 0x0b, 0x06, 0x0b, 0x06, 0xc0, 0x0b, 0xc0, 0x06, 0xc7, 0x3f, 0xc0,
+  0x0b, 0x06, 0xc4, 0x0b, 0xc0, 0x06, 0xc1, 0x0b, 0xd5, 0x6b, 0xc2, 0x6e, 0xc1, 0x12, 0x17, 0x12,
+  0x17, 0xc2, 0x12, 0x17, 0x12, 0xc0, 0x17, 0x12, 0xc0, 0x17, 0x12, 0xc1, 0x17, 0xc0, 0x12, 0x17,
+  0xc3, 0x12, 0x17, 0xc2, 0x12, 0xc0, 0x17, 0x12, 0x17, 0xc9, 0x12, 0xd1, 0x17, 0xc0, 0x6b, 0xc0,
+  0x17, 0xca, 0x1e, 0x6e, 0xc0, 0x1e, 0xc5, 0x12, 0xc0, 0x1e, 0xc0, 0xfe, 0x13, 0x10, 0x6b, 0xc4,
+  0x6e, 0xc1, 0x2e, 0xc0, 0x35, 0x2e, 0xca, 0x3a, 0xc2, 0x2e, 0xc0, 0x35, 0x3a, 0xc2, 0x35, 0x3a,
+  0x35, 0xc0, 0x6d, 0x3a, 0xc8, 0x6e, 0xc2, 0x6f, 0xc8, 0x3f, 0xca, 0x3a, 0xc4, 0x35, 0x3a, 0xc0,
+  0x35, 0xc0, 0x2e, 0x35, 0x3a, 0xc1, 0x2e, 0x3a, 0xc1, 0x35, 0x2e, 0x35, 0xc1, 0x2e, 0xc1, 0x35,
+  0xc0, 0x3a, 0xc0, 0x35, 0x2e, 0xc1, 0x35, 0xc1, 0x2e, 0xc2, 0x3a, 0xc5, 0x35, 0xc0, 0x3a, 0xc3,
+  0x3f, 0xcb, 0x3a, 0x3f, 0xc6, 0x6b, 0xc4, 0x0b, 0x06, 0x3f, 0x06, 0xc1, 0x0b, 0x06, 0xc0, 0x0b,
+  0xc0, 0x06, 0xc7, 0x0b, 0xc0, 0x06, 0xc4, 0x0b, 0xc0, 0x06, 0xc1, 0x0b, 0xd7, 0x6b, 0x0b, 0xc0,
+  0x6f, 0xc2, 0x12, 0x17, 0x12, 0xc0, 0x17, 0x12, 0x17, 0x12, 0xc2, 0x17, 0xc1, 0x12, 0xc0, 0x17,
+  0xc0, 0x12, 0xc0, 0x17, 0xc5, 0x12, 0xc2, 0x17, 0x12, 0xc2, 0x17, 0xc6, 0x12, 0xd1, 0x17, 0xce,
+  0x6b, 0xc0, 0x6e, 0x1e, 0xc5, 0x12, 0xc0, 0x1e, 0xc0, 0xfe, 0x13, 0x10, 0xc0, 0x6f, 0xc0, 0x66,
+  0x3a, 0xc1, 0x69, 0x2e, 0xce, 0x33, 0x3a, 0x35, 0x3a, 0x2e, 0xc0, 0x35, 0x2e, 0xc0, 0x33, 0x2e,
+  0x35, 0xc2, 0x33, 0xc0, 0x3a, 0xc8, 0x6e, 0xc1, 0x6f, 0xc4, 0x66, 0x0b, 0xc0, 0x3f, 0xc1, 0x0b,
+  0xc1, 0x3f, 0xc4, 0x3a, 0xc4, 0x35, 0xc0, 0x3a, 0xc0, 0x35, 0x2e, 0x35, 0xc3, 0x3a, 0xc2, 0x35,
+  0xc2, 0x2e, 0xc1, 0x35, 0xc1, 0x3a, 0xc0, 0x35, 0x2e, 0x35, 0x2e, 0x35, 0xc3, 0x2e, 0xc0, 0x35,
+  0xc0, 0x3a, 0xc1, 0x35, 0xc2, 0x3a, 0xc3, 0x3f, 0xcb, 0x3a, 0xc2, 0x3f, 0x3a, 0x3f, 0xc5, 0x06,
+  0xc2, 0x0b, 0x3f, 0x06, 0xc4, 0x0b, 0x3f, 0xc0, 0x06, 0x3f, 0xc0, 0x0b, 0xc0, 0x3f, 0xc0, 0x06,
+  0xc0, 0x3f, 0x06, 0xc3, 0x0b, 0xc1, 0x06, 0xc0, 0x0b, 0xc3, 0x06, 0xc1, 0x0b, 0xca, 0x06, 0x6f,
+  0x0b, 0xc3, 0x6f, 0xc9, 0x12, 0x17, 0xc0, 0x0b, 0xc0, 0x17, 0xc0, 0x12, 0xc0, 0x17, 0x12, 0xc2,
+  0x17, 0x12, 0x17, 0xc3, 0x12, 0xc4, 0x17, 0x12, 0xc3, 0x17, 0xc2, 0x12, 0xc4, 0x17, 0x12, 0xcc,
+  0x17, 0xc1, 0x6b, 0x17, 0xc5, 0x12, 0xc0, 0x17, 0xc0, 0x1e, 0xc0, 0x6e, 0x1e, 0x17, 0xc3, 0x12,
+  0x6b, 0x1e, 0xc1, 0xfe, 0x13, 0x10, 0xc0, 0x6b, 0xc3, 0x6e, 0xc0, 0x35, 0x2e, 0xc3, 0x66, 0x2e,
+  0xc8, 0x35, 0x2e, 0x35, 0x2e, 0xc6, 0x35, 0x3a, 0xc1, 0x69, 0x3a, 0xc7, 0x6e, 0xc4, 0x6f, 0xc1,
+  0x66, 0x0b, 0xc1, 0x3f, 0xc0, 0x0b, 0x3f, 0xc7, 0x3a, 0xc4, 0x35, 0x2e, 0x35, 0xc1, 0x33, 0x2e,
+  0xc3, 0x35, 0x2e, 0xc0, 0x3a, 0x35, 0xc1, 0x2e, 0xc2, 0x35, 0x2e, 0x35, 0x3a, 0x35, 0xc4, 0x2e,
+  0xc4, 0x35, 0xc1, 0x3a, 0xc0, 0x35, 0xc2, 0x3a, 0xc3, 0x3f, 0xc4, 0x3a, 0xc0, 0x3f, 0xc2, 0x3a,
+  0xc5, 0x3f, 0xc5, 0x06, 0xc1, 0x3f, 0xc1, 0x06, 0xc3, 0x3f, 0x0b, 0x3f, 0xc9, 0x06, 0xc4, 0x0b,
+  0xc1, 0x06, 0xc1, 0x0b, 0xc1, 0x06, 0xc2, 0x0b, 0xc9, 0x06, 0xc2, 0x0b, 0xc2, 0x6f, 0xc7, 0x66,
+  0x17, 0x12, 0x17, 0x12, 0x0b, 0xc0, 0x12, 0xc8, 0x17, 0x12, 0x17, 0xc3, 0x12, 0x17, 0x12, 0xc4,
+  0x17, 0xc0, 0x12, 0x17, 0xc2, 0x12, 0xc4, 0x17, 0x12, 0xcd, 0x17, 0xc8, 0x12, 0xc0, 0x17, 0xc1,
+  0x6b, 0xc1, 0x17, 0xc2, 0x12, 0x17, 0xc0, 0x67, 0x1e, 0xc0, 0xfe, 0x13, 0x10, 0xc5, 0x6b, 0x2e,
+  0xd0, 0x35, 0x2e, 0xc9, 0x35, 0x6e, 0xc3, 0x35, 0xc0, 0x3a, 0xc3, 0x6e, 0xc4, 0x6f, 0xc3, 0x3f,
+  0x0b, 0x3f, 0xc0, 0x0b, 0xc0, 0x3f, 0xc6, 0x3a, 0xc4, 0x35, 0xc5, 0x2e, 0x35, 0x2e, 0xc0, 0x35,
+  0xc0, 0x3a, 0xc1, 0x35, 0xc0, 0x2e, 0xc0, 0x35, 0xc0, 0x2e, 0xc0, 0x35, 0x3a, 0x35, 0xc5, 0x2e,
+  0xc0, 0x35, 0x2e, 0x35, 0x2e, 0xc1, 0x35, 0xc3, 0x3a, 0xc5, 0x3f, 0x3a, 0x3f, 0xc1, 0x3a, 0xc1,
+  0x3f, 0xc1, 0x3a, 0xc5, 0x3f, 0xc5, 0x6b, 0xc2, 0x3f, 0xc0, 0x06, 0xc1, 0x3f, 0xcd, 0x0b, 0x06,
+  0xc9, 0x0b, 0xc0, 0x06, 0xc5, 0x0b, 0xc7, 0x06, 0xc3, 0x0b, 0xc2, 0x6f, 0x66, 0xc0, 0x0b, 0x17,
+  0xc4, 0x12, 0xc1, 0x0b, 0x12, 0xc8, 0x17, 0xc1, 0x12, 0xc2, 0x17, 0xc2, 0x12, 0xc2, 0x17, 0xc0,
+  0x12, 0x17, 0xc3, 0x12, 0xd4, 0x17, 0xce, 0x6b, 0x17, 0xc5, 0x12, 0xc1, 0x17, 0xfe, 0x13, 0x10,
+  0xd7, 0x6b, 0xc1, 0x2e, 0xc8, 0x6f, 0xc0, 0x35, 0xc0, 0x3a, 0xc0, 0x35, 0xc0, 0x3a, 0xc3, 0x6e,
+  0xc3, 0x6f, 0xc2, 0x3f, 0xc0, 0x0b, 0xc0, 0x3f, 0xc5, 0x3a, 0x3f, 0xc1, 0x3a, 0xc1, 0x3f, 0x3a,
+  0xc0, 0x35, 0xc3, 0x3a, 0x35, 0x2e, 0xc4, 0x35, 0x3a, 0xc0, 0x35, 0xc0, 0x2e, 0xc1, 0x35, 0x2e,
+  0xc3, 0x35, 0xc0, 0x2e, 0x35, 0xc0, 0x2e, 0xc1, 0x35, 0x2e, 0xc3, 0x35, 0xc3, 0x3a, 0xc2, 0x3f,
+  0x3a, 0xc3, 0x3f, 0xc1, 0x3a, 0xc3, 0x3f, 0x3a, 0xc6, 0x3f, 0xc5, 0x6b, 0xc2, 0x3f, 0x06, 0xc1,
+  0x3f, 0x0b, 0x3f, 0xc0, 0x3a, 0x3f, 0xc0, 0x3a, 0xc0, 0x3f, 0xc6, 0x06, 0xc8, 0x0b, 0x06, 0xc1,
+  0x0b, 0x06, 0xc3, 0x0b, 0xc7, 0x06, 0x0b, 0x06, 0x0b, 0xc3, 0x6b, 0x0b, 0xc1, 0x6f, 0x12, 0xc1,
+  0x17, 0xc0, 0x12, 0xc5, 0x0b, 0x12, 0xc4, 0x17, 0xc2, 0x12, 0xc2, 0x17, 0x12, 0x17, 0x12, 0x06,
+  0x12, 0xc1, 0x17, 0x12, 0x17, 0xc3, 0x12, 0xc3, 0x66, 0x12, 0xd0, 0x17, 0x12, 0xc4, 0x17, 0xc5,
+  0x6b, 0xc1, 0x17, 0xc2, 0x12, 0xc3, 0xfe, 0x13, 0x10, 0xd1, 0x66, 0xc0, 0x2e, 0xc1, 0x6b, 0xc2,
+  0x2e, 0xc8, 0x35, 0x2e, 0x35, 0x6e, 0xc0, 0x35, 0xc1, 0x3a, 0xc2, 0x6e, 0xc4, 0x6f, 0xc2, 0x3f,
+  0xc0, 0x0b, 0x3f, 0x0b, 0x3f, 0xc8, 0x3a, 0xc1, 0x3f, 0x3a, 0xc0, 0x35, 0xc3, 0x3a, 0x2e, 0xc2,
+  0x35, 0xc3, 0x2e, 0xca, 0x35, 0xc0, 0x2e, 0xcc, 0x35, 0xc1, 0x3a, 0xc7, 0x3f, 0xc2, 0x3a, 0xc1,
+  0x3f, 0xc2, 0x3a, 0xc6, 0x3f, 0x3a, 0x3f, 0xc0, 0x6b, 0x3f, 0xc1, 0x06, 0x3f, 0xc0, 0x06, 0x3f,
+  0xc3, 0x06, 0x3f, 0xc0, 0x3a, 0xc1, 0x3f, 0xc5, 0x06, 0xc5, 0x3f, 0xc0, 0x06, 0xc7, 0x0b, 0x06,
+  0xc0, 0x0b, 0xc4, 0x06, 0x0b, 0xc0, 0x06, 0xc0, 0x0b, 0xc5, 0x6b, 0xc0, 0x0b, 0x12, 0xcb, 0x0b,
+  0x12, 0xc6, 0x6e, 0xc0, 0x12, 0xc5, 0x06, 0xc0, 0x12, 0xc1, 0x17, 0xc0, 0x12, 0xc0, 0x17, 0xc1,
+  0x12, 0xcd, 0x66, 0xc0, 0x12, 0xd0, 0x17, 0xc1, 0x6b, 0x6e, 0x1e, 0x17, 0x12, 0x17, 0xc0, 0x12,
+  0xc0, 0x17, 0x12, 0xc0, 0xfe, 0x13, 0x10, 0xc3, 0x6e, 0x2e, 0xc2, 0x66, 0x2e, 0xc5, 0x29, 0xc2,
+  0x2e, 0xc1, 0x6b, 0x2e, 0xc2, 0x29, 0x2e, 0xc5, 0x35, 0x2e, 0xc0, 0x6f, 0xc0, 0x2e, 0xc0, 0x35,
+  0x3a, 0xc0, 0x6e, 0x3a, 0x3f, 0xc4, 0x6f, 0xc2, 0x3f, 0xc0, 0x0b, 0x3f, 0xc2, 0x3a, 0xc1, 0x3f,
+  0xc3, 0x3a, 0xc5, 0x35, 0xc3, 0x2e, 0xc2, 0x35, 0xc1, 0x2e, 0xce, 0x35, 0x2e, 0xc2, 0x29, 0xc0,
+  0x2e, 0xc8, 0x3a, 0x35, 0x3a, 0xc6, 0x3f, 0xc1, 0x3a, 0xc3, 0x3f, 0xc3, 0x3a, 0xc6, 0x3f, 0x6b,
+  0x3f, 0xc4, 0x0b, 0x3f, 0x06, 0x3f, 0xc2, 0x3a, 0x3f, 0xc1, 0x3a, 0xc0, 0x3f, 0xc3, 0x0b, 0x06,
+  0xc6, 0x3f, 0xc0, 0x06, 0xc6, 0x0b, 0xc5, 0x06, 0xc2, 0x0b, 0xc4, 0x06, 0xc0, 0x0b, 0xc0, 0x6b,
+  0x0b, 0xc0, 0x12, 0xc2, 0x6e, 0x12, 0xc5, 0x0b, 0x06, 0x12, 0xc8, 0x17, 0xc0, 0x12, 0xc2, 0x06,
+  0xc0, 0x12, 0x06, 0x12, 0xc4, 0x17, 0xc2, 0x12, 0xcf, 0x66, 0x12, 0xd0, 0x17, 0xc0, 0x6b, 0xc0,
+  0x17, 0x12, 0x17, 0x12, 0xc4, 0xfe, 0x13, 0x10, 0xde, 0x66, 0x2e, 0xc3, 0x6b, 0x2e, 0xc0, 0x35,
+  0xc2, 0x2e, 0x6f, 0xc0, 0x6e, 0x3a, 0xc2, 0x3f, 0xc2, 0x6f, 0xc0, 0x3f, 0xc2, 0x0b, 0x3f, 0xc2,
+  0x3a, 0xc2, 0x3f, 0x3a, 0xc5, 0x35, 0x2e, 0xce, 0x29, 0xc1, 0x2e, 0xcd, 0x29, 0xc0, 0x2e, 0xc1,
+  0x29, 0x2e, 0xc3, 0x35, 0x3a, 0x2e, 0x3a, 0xc7, 0x3f, 0x3a, 0xc6, 0x3f, 0xc0, 0x3a, 0xc7, 0x3f,
+  0xcd, 0x3a, 0xc2, 0x3f, 0xc6, 0x6b, 0xc3, 0x3f, 0xc0, 0x0b, 0xc0, 0x06, 0xc4, 0x3f, 0x06, 0xc0,
+  0x0b, 0xc0, 0x06, 0xc0, 0x0b, 0xc2, 0x06, 0xc1, 0x0b, 0xc5, 0x06, 0xc0, 0x0b, 0x6b, 0x0b, 0xc1,
+  0x12, 0xc8, 0x0b, 0xc0, 0x06, 0x12, 0xc5, 0x6e, 0x12, 0xc5, 0x06, 0xc3, 0x12, 0xc0, 0x17, 0x12,
+  0xd2, 0x66, 0x12, 0xc0, 0x0d, 0xc0, 0x12, 0xd0, 0x17, 0xc5, 0x12, 0xc4, 0xfe, 0x13, 0x10, 0xcb,
+  0x66, 0x2e, 0xc4, 0x29, 0x2e, 0xc8, 0x29, 0xc1, 0x2e, 0xc5, 0x6b, 0xc1, 0x6e, 0xc7, 0x6e, 0xc1,
+  0x6f, 0xc1, 0x3f, 0xc0, 0x0b, 0x3f, 0xc0, 0x3a, 0x3f, 0xc2, 0x3a, 0xc1, 0x3f, 0x3a, 0xc4, 0x2e,
+  0x35, 0xc0, 0x2e, 0xcc, 0x29, 0xc2, 0x2e, 0xc7, 0x29, 0x2e, 0xcf, 0x35, 0xc0, 0x3a, 0xd1, 0x3f,
+  0x3a, 0xc6, 0x3f, 0xce, 0x3a, 0xc3, 0x3f, 0xc8, 0x6b, 0xc0, 0x3f, 0xc3, 0x06, 0xc3, 0x3f, 0x06,
+  0xcc, 0x0b, 0xc4, 0x06, 0xc1, 0x0b, 0x06, 0xc0, 0x0b, 0xc0, 0x6b, 0xc6, 0x0b, 0xc4, 0x12, 0xca,
+  0x0b, 0x06, 0xc2, 0x6b, 0x12, 0xc0, 0x6e, 0xc1, 0x12, 0xd0, 0x0d, 0x12, 0xc1, 0x0d, 0x12, 0xd1,
+  0x17, 0xc2, 0x12, 0x17, 0xc0, 0x12, 0xc3, 0xfe, 0x13, 0x10, 0xc6, 0x66, 0x2e, 0xc2, 0x29, 0x2e,
+  0xc3, 0x29, 0xc1, 0x2e, 0xc6, 0x29, 0xc3, 0x2e, 0xc2, 0x6b, 0xc1, 0x6e, 0xc9, 0x6e, 0xc2, 0x6f,
+  0x3f, 0xc4, 0x3a, 0x3f, 0xc2, 0x3a, 0xc0, 0x3f, 0x3a, 0xc4, 0x35, 0x2e, 0x35, 0x2e, 0xca, 0x35,
+  0x2e, 0xc0, 0x29, 0xc6, 0x2e, 0xc0, 0x29, 0xc9, 0x2e, 0xc2, 0x29, 0xc0, 0x2e, 0xc3, 0x35, 0x3a,
+  0x35, 0xc0, 0x3a, 0xc8, 0x3f, 0x3a, 0xc3, 0x3f, 0x3a, 0xc3, 0x3f, 0x3a, 0xc0, 0x3f, 0xcd, 0x3a,
+  0xc4, 0x3f, 0xc8, 0x6b, 0xc0, 0x3f, 0xc4, 0x06, 0xc1, 0x3f, 0xc0, 0x06, 0xcc, 0x0b, 0xc3, 0x06,
+  0xc1, 0x6f, 0x0b, 0x06, 0xc0, 0x0b, 0xc1, 0x12, 0xc2, 0x0b, 0xc7, 0x12, 0xc4, 0x6e, 0x12, 0xc5,
+  0x06, 0xc1, 0x12, 0xc1, 0x17, 0x12, 0xd2, 0x66, 0xc0, 0x12, 0xc0, 0x0d, 0x12, 0xd2, 0x17, 0xc3,
+  0x12, 0xc3, 0x17, 0xfe, 0x13, 0x10, 0xc6, 0x66, 0xc0, 0x2e, 0xc0, 0x29, 0xc1, 0x2e, 0xc2, 0x29,
+  0xc1, 0x2e, 0xc5, 0x29, 0xc1, 0x2e, 0x29, 0xc1, 0x2e, 0xc1, 0x6f, 0xc0, 0x69, 0xc0, 0x3a, 0xc8,
+  0x6e, 0xc2, 0x6f, 0x3f, 0xc3, 0x3a, 0x3f, 0xc3, 0x3a, 0xc7, 0x2e, 0xc5, 0x29, 0xc2, 0x2e, 0xc4,
+  0x29, 0xc4, 0x2e, 0xc3, 0x29, 0xc5, 0x2e, 0xc0, 0x29, 0xc1, 0x2e, 0xc8, 0x6b, 0xc2, 0x3a, 0xd2,
+  0x35, 0x3a, 0xc2, 0x3f, 0xc5, 0x3a, 0xc0, 0x3f, 0xc3, 0x3a, 0xc6, 0x3f, 0xcf, 0x6b, 0xc2, 0x3f,
+  0xc2, 0x06, 0x3f, 0x06, 0xc1, 0x0b, 0x06, 0xc2, 0x0b, 0xc3, 0x06, 0xc3, 0x0b, 0x06, 0x0b, 0xca,
+  0x06, 0xc0, 0x0b, 0xc1, 0x6b, 0xcc, 0x06, 0xc1, 0x12, 0xcd, 0x06, 0x12, 0xca, 0x66, 0xc0, 0x06,
+  0x12, 0xcf, 0x6e, 0xc4, 0x12, 0xc4, 0xfe, 0x13, 0x10, 0xc6, 0x66, 0xcd, 0x2e, 0xc3, 0x29, 0xc6,
+  0x2e, 0xc2, 0x6f, 0x69, 0xc1, 0x3a, 0xc4, 0x33, 0x6f, 0x3a, 0x3f, 0xc2, 0x6f, 0x3f, 0xc3, 0x3a,
+  0x3f, 0x3a, 0x3f, 0xc0, 0x3a, 0xc5, 0x66, 0xc1, 0x2e, 0xc5, 0x29, 0xc0, 0x2e, 0x29, 0xc0, 0x2e,
+  0xc2, 0x29, 0xc5, 0x2e, 0xc2, 0x29, 0xc6, 0x2e, 0xc1, 0x29, 0xc0, 0x2e, 0xc8, 0x35, 0xc2, 0x3a,
+  0xd8, 0x3f, 0xc3, 0x3a, 0xc3, 0x3f, 0xc1, 0x3a, 0xc7, 0x3f, 0xc2, 0x3a, 0xc2, 0x3f, 0xc3, 0x3a,
+  0x3f, 0xc0, 0x6b, 0xc2, 0x3f, 0xc1, 0x06, 0xc6, 0x0b, 0x06, 0xc0, 0x0b, 0xc0, 0x06, 0x0b, 0xc0,
+  0x06, 0xc3, 0x0b, 0xc2, 0x6b, 0x0b, 0xc1, 0x12, 0x0b, 0xc3, 0x06, 0xc7, 0x12, 0xc8, 0x06, 0xc3,
+  0x12, 0xc0, 0x6e, 0x12, 0xc8, 0x06, 0x12, 0xca, 0x66, 0x06, 0xc0, 0x12, 0xcc, 0x0d, 0x12, 0xc1,
+  0x17, 0xc3, 0x12, 0xc4, 0xfe, 0x13, 0x10, 0xc1, 0x66, 0x2e, 0xc1, 0x29, 0xce, 0x2e, 0xc3, 0x29,
+  0xc6, 0x2e, 0xc4, 0x6e, 0xc0, 0x6b, 0xc5, 0x6e, 0x3a, 0x3f, 0xca, 0x3a, 0xc0, 0x3f, 0x3a, 0xc1,
+  0x33, 0x3a, 0xc1, 0x66, 0xc0, 0x2e, 0xc5, 0x29, 0xc5, 0x2e, 0x29, 0xc1, 0x2e, 0x29, 0xc5, 0x2e,
+  0x29, 0x2e, 0xc0, 0x29, 0xc2, 0x2e, 0x29, 0xc4, 0x2e, 0xc3, 0x29, 0xc0, 0x2e, 0xc1, 0x35, 0xc1,
+  0x3a, 0xc6, 0x35, 0x3a, 0xd1, 0x3f, 0xc1, 0x3a, 0xc4, 0x3f, 0x3a, 0x3f, 0xc0, 0x3a, 0xc8, 0x3f,
+  0xc0, 0x3a, 0xc3, 0x3f, 0xc1, 0x3a, 0xc0, 0x3f, 0x3a, 0x6f, 0xc3, 0x3f, 0x06, 0xc1, 0x3f, 0xc0,
+  0x06, 0xc3, 0x6e, 0xc0, 0x06, 0xc2, 0x0b, 0x06, 0xc1, 0x0b, 0xc0, 0x06, 0x0b, 0xc5, 0x6b, 0x0b,
+  0xc3, 0x06, 0xc7, 0x12, 0xc6, 0x66, 0x12, 0x06, 0xc4, 0x12, 0xc9, 0x06, 0xc4, 0x12, 0xc4, 0x06,
+  0x0d, 0x06, 0xc1, 0x12, 0xd1, 0x6e, 0xc1, 0x12, 0xc5, 0xfe, 0x12, 0xf0, 0x6e, 0x29, 0xc1, 0x2e,
+  0x29, 0xcb, 0x2e, 0x29, 0xc1, 0x2e, 0xc2, 0x29, 0xc8, 0x2e, 0xc3, 0x6e, 0x2e, 0xc0, 0x6f, 0xc1,
+  0x66, 0x3a, 0xc3, 0x6e, 0xc8, 0x3a, 0xc8, 0x35, 0x2e, 0xc2, 0x29, 0x2e, 0xc1, 0x29, 0xc4, 0x69,
+  0xc0, 0x29, 0xc5, 0x2e, 0x29, 0xc4, 0x2e, 0xc0, 0x29, 0xd0, 0x2e, 0xc3, 0x35, 0x3a, 0xcb, 0x35,
+  0x3a, 0xc2, 0x35, 0x3a, 0xc7, 0x3f, 0xc2, 0x3a, 0xc1, 0x3f, 0xc0, 0x3a, 0xc0, 0x3f, 0xc1, 0x3a,
+  0xd3, 0x3f, 0x3a, 0x6f, 0xc0, 0x3a, 0xc0, 0x3f, 0x3a, 0x6b, 0x06, 0xc0, 0x3f, 0xc2, 0x06, 0xc1,
+  0x3f, 0xc0, 0x06, 0xc2, 0x6e, 0x06, 0xc2, 0x0b, 0xc9, 0x6b, 0x06, 0xca, 0x12, 0x0b, 0x12, 0xc5,
+  0x06, 0xc6, 0x12, 0xc8, 0x06, 0x6b, 0xc0, 0x06, 0xc8, 0x12, 0x06, 0xc1, 0x12, 0xcb, 0x0d, 0x12,
+  0xc3, 0x6e, 0xc1, 0x12, 0xc5, 0xfe, 0x12, 0xf0, 0xd5, 0x6e, 0xc1, 0x29, 0xc0, 0x69, 0x29, 0xc6,
+  0x2e, 0xc2, 0x6e, 0xc0, 0x2e, 0xc0, 0x6b, 0xc1, 0x6e, 0xc4, 0x6e, 0x6e, 0x3f, 0xc6, 0x3a, 0xc8,
+  0x35, 0x2e, 0xc2, 0x29, 0x2e, 0xc0, 0x29, 0xc1, 0x22, 0xc0, 0x29, 0xc0, 0x22, 0x2e, 0xc0, 0x29,
+  0xc0, 0x22, 0xc0, 0x29, 0xcb, 0x2e, 0x29, 0xc2, 0x2e, 0x29, 0xc7, 0x2e, 0xc5, 0x35, 0x33, 0xc2,
+  0x3a, 0xc0, 0x35, 0x3a, 0xc3, 0x35, 0xc1, 0x3a, 0x35, 0xc0, 0x3a, 0xc7, 0x3f, 0xc2, 0x3a, 0xc0,
+  0x3f, 0xc1, 0x3a, 0xc1, 0x3f, 0xc0, 0x3a, 0xcc, 0x6f, 0x3a, 0xc6, 0x06, 0xc0, 0x3f, 0xc1, 0x3a,
+  0x06, 0xc1, 0x3f, 0xc2, 0x06, 0xc1, 0x3f, 0xc0, 0x06, 0xc2, 0x6e, 0xc0, 0x06, 0xc1, 0x0b, 0xc1,
+  0x06, 0x0b, 0xc1, 0x6b, 0x0b, 0xc1, 0x06, 0xc6, 0x0b, 0x06, 0xc3, 0x0b, 0x12, 0xc4, 0x66, 0x06,
+  0xc6, 0x12, 0xc8, 0x06, 0x0d, 0xc0, 0x06, 0xc1, 0x0d, 0x06, 0xc0, 0x0d, 0x06, 0xc5, 0x0d, 0xc0,
+  0x12, 0xc9, 0x0d, 0x12, 0xc4, 0x6e, 0xc0, 0x12, 0xc5, 0xfe, 0x12, 0xf0, 0xc5, 0x6e, 0x29, 0xc3,
+  0x2e, 0xc0, 0x29, 0xc7, 0x2e, 0x29, 0xc0, 0x69, 0xc3, 0x29, 0xc2, 0x2e, 0xc5, 0x6e, 0x6b, 0x2e,
+  0x33, 0x2e, 0x33, 0x2e, 0x3a, 0xc1, 0x6e, 0xc8, 0x33, 0x3a, 0xc7, 0x2e, 0xc4, 0x29, 0x2e, 0x29,
+  0xc4, 0x22, 0x29, 0xc7, 0x22, 0xc1, 0x29, 0xc3, 0x2e, 0xc0, 0x29, 0xc0, 0x6b, 0x29, 0xc0, 0x2e,
+  0x29, 0xc4, 0x2e, 0x29, 0xc4, 0x2e, 0xc4, 0x6b, 0x3a, 0xc4, 0x35, 0x3a, 0xc1, 0x35, 0x33, 0x3a,
+  0xc0, 0x35, 0xc2, 0x3a, 0xc7, 0x3f, 0xc0, 0x3a, 0xc1, 0x3f, 0xc2, 0x3a, 0x3f, 0x3a, 0xd6, 0x3f,
+  0xc4, 0x3a, 0x3f, 0xc0, 0x6b, 0xc0, 0x3a, 0x3f, 0x06, 0xc3, 0x6e, 0x3f, 0x06, 0xc7, 0x0b, 0xc0,
+  0x06, 0x0b, 0xc2, 0x6b, 0x06, 0xcf, 0x12, 0xc3, 0x06, 0x6b, 0x06, 0xc4, 0x0d, 0x12, 0xc9, 0x06,
+  0x0d, 0xc1, 0x06, 0xc5, 0x0d, 0x06, 0xc4, 0x0d, 0x12, 0xc6, 0x0d, 0x12, 0xd0, 0xfe, 0x12, 0xf0,
+  0xc6, 0x69, 0xc0, 0x6f, 0x22, 0x29, 0xc1, 0x22, 0xc1, 0x29, 0xc9, 0x22, 0xc1, 0x29, 0xc3, 0x2e,
+  0xc2, 0x6e, 0x2e, 0xc4, 0x33, 0xc0, 0x6b, 0xc1, 0x6e, 0xc7, 0x3a, 0x33, 0x3a, 0xc5, 0x66, 0x2e,
+  0xc4, 0x29, 0xc4, 0x22, 0xc0, 0x29, 0xc7, 0x22, 0xc1, 0x29, 0x22, 0x29, 0xd7, 0x2e, 0xc6, 0x35,
+  0xc3, 0x3a, 0x35, 0x3a, 0x35, 0xc0, 0x3a, 0x35, 0xc7, 0x3a, 0xe9, 0x3f, 0xc2, 0x3a, 0xc1, 0x3f,
+  0x3a, 0x3f, 0x3a, 0x3f, 0x6b, 0xc0, 0x3f, 0x06, 0x3f, 0xc1, 0x06, 0xc7, 0x6e, 0x06, 0xc0, 0x0b,
+  0xc2, 0x06, 0xd0, 0x6f, 0xc0, 0x66, 0x12, 0x06, 0xc0, 0x12, 0x06, 0xc5, 0x0d, 0x12, 0xc8, 0x06,
+  0x0d, 0xc1, 0x06, 0xc5, 0x0d, 0x06, 0xc5, 0x0d, 0xc0, 0x12, 0xc6, 0x0d, 0x12, 0xce, 0xfe, 0x12,
+  0xf0, 0xc6, 0x69, 0xc3, 0x29, 0x22, 0xc3, 0x29, 0x22, 0x29, 0xc3, 0x22, 0xc0, 0x29, 0x22, 0xc0,
+  0x29, 0xc3, 0x6e, 0xc4, 0x6e, 0x2e, 0xc1, 0x33, 0xc3, 0x6b, 0xc0, 0x6e, 0xc6, 0x3a, 0xc0, 0x33,
+  0x3a, 0xc5, 0x2e, 0xc3, 0x29, 0xc6, 0x22, 0xc1, 0x29, 0xc5, 0x22, 0xc1, 0x29, 0xc1, 0x22, 0x29,
+  0xc4, 0x22, 0x29, 0xca, 0x2e, 0x29, 0xc3, 0x2e, 0x6b, 0x29, 0x2e, 0xc1, 0x35, 0xc1, 0x2e, 0x35,
+  0x2e, 0x35, 0xcd, 0x3a, 0xd3, 0x35, 0xc0, 0x3a, 0xca, 0x35, 0x3a, 0xc7, 0x3f, 0xc0, 0x3a, 0xc3,
+  0x3f, 0x3a, 0xc0, 0x6f, 0x3f, 0xc3, 0x06, 0xc1, 0x3f, 0x06, 0xc4, 0x6e, 0x06, 0xc5, 0x6b, 0x06,
+  0xc5, 0x0b, 0x06, 0xcc, 0x0d, 0x06, 0xc6, 0x6f, 0xc8, 0x06, 0xc1, 0x0d, 0xc0, 0x06, 0xcc, 0x0d,
+  0xc0, 0x12, 0xc2, 0x0d, 0x12, 0xc0, 0x0d, 0x12, 0xc2, 0x0d, 0x12, 0xca, 0xfe, 0x12, 0xf0, 0xc3,
+  0x69, 0x29, 0x22, 0xc4, 0x29, 0x22, 0xc5, 0x29, 0xc3, 0x22, 0x66, 0x22, 0xc2, 0x29, 0xc2, 0x6e,
+  0xc7, 0x6e, 0xc3, 0x6b, 0xc2, 0x6e, 0xc4, 0x3a, 0xc1, 0x33, 0x3a, 0xc2, 0x66, 0x3a, 0x2e, 0xc3,
+  0x29, 0xc7, 0x22, 0xc0, 0x1d, 0xc0, 0x22, 0x29, 0xc3, 0x22, 0xc1, 0x29, 0xc0, 0x66, 0x22, 0x29,
+  0xc4, 0x22, 0xc1, 0x29, 0xd1, 0x2e, 0xc2, 0x35, 0xc0, 0x2e, 0x35, 0xc1, 0x2e, 0x35, 0xc5, 0x2e,
+  0x35, 0xc0, 0x2e, 0xc0, 0x35, 0xc2, 0x3a, 0xd0, 0x35, 0xc0, 0x3a, 0x35, 0x3a, 0xd2, 0x3f, 0xc0,
+  0x3a, 0xc6, 0x3f, 0xc4, 0x6b, 0xc1, 0x3f, 0x06, 0xc1, 0x3f, 0x06, 0xc4, 0x6e, 0x06, 0xcb, 0x0b,
+  0x06, 0xc5, 0x6f, 0x0b, 0x12, 0xc0, 0x06, 0xc7, 0x12, 0x06, 0x12, 0xc7, 0x06, 0xd1, 0x12, 0xc0,
+  0x66, 0x12, 0xc4, 0x0d, 0x12, 0xc1, 0x0d, 0x12, 0xcb, 0xfe, 0x12, 0xf0, 0xc3, 0x69, 0xcf, 0x29,
+  0xc2, 0x22, 0x66, 0x22, 0x29, 0x22, 0xc0, 0x29, 0xc3, 0x6e, 0xc4, 0x6e, 0x2e, 0x33, 0xc4, 0x6b,
+  0xc2, 0x6e, 0x3a, 0x3f, 0xc0, 0x3a, 0xc2, 0x33, 0x3a, 0xc1, 0x2e, 0xc0, 0x33, 0xc0, 0x2e, 0xc1,
+  0x29, 0xc8, 0x22, 0x1d, 0xc1, 0x22, 0x29, 0xc0, 0x22, 0x29, 0xc1, 0x1d, 0x22, 0x29, 0xc1, 0x22,
+  0xc0, 0x29, 0xc3, 0x22, 0xc3, 0x29, 0xcf, 0x2e, 0xc3, 0x6b, 0x2e, 0xc1, 0x35, 0x2e, 0x35, 0x3a,
+  0xc0, 0x35, 0x2e, 0xc2, 0x35, 0xc0, 0x2e, 0xc0, 0x35, 0xc0, 0x3a, 0xd5, 0x35, 0x3a, 0xd2, 0x3f,
+  0xc0, 0x3a, 0xc5, 0x3f, 0xc5, 0x6b, 0xc1, 0x3f, 0x06, 0xc0, 0x3f, 0x06, 0xc5, 0x6e, 0x06, 0xcd,
+  0x0b, 0xc0, 0x06, 0xc2, 0x6f, 0xc1, 0x0b, 0x06, 0xca, 0x12, 0x66, 0xc1, 0x06, 0x12, 0xc0, 0x06,
+  0xcd, 0x0d, 0x06, 0xc2, 0x0d, 0x12, 0xc4, 0x0d, 0x12, 0xd1, 0xfe, 0x12, 0xf0, 0x69, 0xc5, 0x66,
+  0xc0, 0x22, 0xca, 0x29, 0xc1, 0x22, 0xc0, 0x1d, 0x22, 0x29, 0xc7, 0x6e, 0xc3, 0x6e, 0x2e, 0xc0,
+  0x33, 0xc3, 0x6b, 0xca, 0x33, 0x3a, 0xc0, 0x2e, 0xc1, 0x33, 0xc0, 0x2e, 0xc1, 0x29, 0xc7, 0x22,
+  0x1d, 0xc1, 0x6b, 0x22, 0x29, 0xc2, 0x22, 0xc0, 0x1d, 0xc3, 0x22, 0xc5, 0x29, 0x22, 0xc3, 0x29,
+  0xce, 0x2e, 0xc3, 0x6b, 0x2e, 0xc1, 0x35, 0xc0, 0x33, 0xc0, 0x35, 0xc0, 0x2e, 0xc2, 0x33, 0x2e,
+  0xc1, 0x35, 0xc0, 0x3a, 0xd1, 0x35, 0xc2, 0x3a, 0xc5, 0x35, 0x3a, 0xcb, 0x6e, 0xc0, 0x3a, 0xc2,
+  0x3f, 0x3a, 0x3f, 0xc6, 0x3a, 0x6b, 0x3f, 0xc2, 0x6b, 0xd1, 0x3f, 0xc0, 0x06, 0xc2, 0x6e, 0x06,
+  0xc2, 0x0b, 0x6b, 0x0b, 0xc0, 0x06, 0xca, 0x6b, 0xc2, 0x06, 0xd5, 0x0d, 0xc0, 0x12, 0xc3, 0x0d,
+  0xc7, 0x12, 0xc9, 0xfe, 0x12, 0xf0, 0x69, 0xc0, 0x29, 0x22, 0xcb, 0x66, 0xc0, 0x22, 0xc0, 0x29,
+  0x22, 0x29, 0xc0, 0x22, 0xc4, 0x29, 0xc0, 0x22, 0x29, 0xc3, 0x6e, 0xc6, 0x6e, 0xc2, 0x6b, 0xc8,
+  0x2e, 0x6b, 0xc2, 0x2e, 0xc5, 0x29, 0xc6, 0x22, 0xc2, 0x1d, 0xc0, 0x6b, 0x22, 0xc3, 0x1d, 0xc0,
+  0x24, 0x1d, 0xc2, 0x22, 0xc0, 0x29, 0xc1, 0x22, 0xc0, 0x29, 0x22, 0x29, 0xd2, 0x2e, 0xc4, 0x35,
+  0xc2, 0x2e, 0xc2, 0x35, 0x2e, 0xc0, 0x35, 0x2e, 0xc5, 0x3a, 0xd0, 0x35, 0xc1, 0x2e, 0x35, 0x3a,
+  0xc5, 0x35, 0x3a, 0x6e, 0x3a, 0xd0, 0x3f, 0xc1, 0x3a, 0x3f, 0xc1, 0x3a, 0x3f, 0x3a, 0xc1, 0x3f,
+  0xc1, 0x6b, 0xd1, 0x3f, 0xc0, 0x06, 0xc8, 0x6e, 0x06, 0x0b, 0x06, 0xcb, 0x6b, 0x6e, 0xc0, 0x0d,
+  0x06, 0xd5, 0x0d, 0x12, 0xc5, 0x0d, 0xc4, 0x12, 0xc7, 0x0d, 0x12, 0xc0, 0xfe, 0x12, 0xef, 0xc2,
+  0x66, 0x22, 0xc7, 0x1d, 0x22, 0x1d, 0xc0, 0x22, 0xc2, 0x1d, 0x6b, 0x22, 0x1d, 0x22, 0xc7, 0x6b,
+  0xc3, 0x6e, 0xc6, 0x6e, 0xc1, 0x6b, 0xc8, 0x66, 0x2e, 0xc3, 0x33, 0xc0, 0x2e, 0xc1, 0x29, 0xc0,
+  0x2e, 0x29, 0x22, 0xc2, 0x29, 0x22, 0xc2, 0x1d, 0xc2, 0x22, 0xc1, 0x1d, 0xc6, 0x29, 0x22, 0x29,
+  0xc1, 0x22, 0xc0, 0x1d, 0x22, 0x29, 0xc4, 0x22, 0xc2, 0x29, 0xc8, 0x2e, 0xcc, 0x35, 0x2e, 0xc3,
+  0x35, 0x2e, 0xc0, 0x35, 0x2e, 0x3a, 0xd0, 0x35, 0xc0, 0x3a, 0x2e, 0x35, 0x3a, 0xc0, 0x35, 0xc2,
+  0x3a, 0xc5, 0x35, 0xc0, 0x3a, 0xcb, 0x6e, 0xc1, 0x3a, 0x3f, 0xc1, 0x3a, 0x3f, 0xc1, 0x3a, 0x3f,
+  0xc1, 0x3a, 0x6f, 0x3f, 0xc1, 0x06, 0xc4, 0x6e, 0x06, 0xc0, 0x0b, 0xc0, 0x06, 0xc1, 0x66, 0x06,
+  0xd8, 0x6f, 0xc2, 0x06, 0xc0, 0x6b, 0x06, 0xd5, 0x0d, 0xc0, 0x06, 0x12, 0x06, 0x12, 0xc0, 0x0d,
+  0xc3, 0x12, 0xc6, 0x0d, 0xc2, 0xfe, 0x12, 0xcf, 0x6e, 0x1d, 0xc0, 0x22, 0xc2, 0x1d, 0x22, 0xc1,
+  0x1d, 0xc1, 0x22, 0xc0, 0x1d, 0xc0, 0x22, 0xc2, 0x1d, 0xc5, 0x22, 0xc2, 0x6b, 0xc4, 0x6e, 0xc7,
+  0x6e, 0xc0, 0x6b, 0xc8, 0x2e, 0xc9, 0x29, 0xc2, 0x22, 0xc2, 0x67, 0x1d, 0xc0, 0x22, 0x1d, 0x22,
+  0x1d, 0xc1, 0x22, 0xc2, 0x1d, 0x24, 0x1d, 0xc2, 0x22, 0x1d, 0x22, 0xc2, 0x1d, 0xc3, 0x22, 0xc0,
+  0x29, 0x22, 0xc2, 0x29, 0x22, 0x29, 0xc1, 0x2e, 0x29, 0xc2, 0x2e, 0x29, 0xc1, 0x2e, 0xcb, 0x29,
+  0x2e, 0xc5, 0x6b, 0x2e, 0x3a, 0xc3, 0x33, 0x3a, 0xc8, 0x6e, 0x3a, 0x35, 0x3a, 0xc0, 0x2e, 0x35,
+  0xc1, 0x3a, 0x35, 0xc0, 0x3a, 0xc7, 0x35, 0x3a, 0xd0, 0x3f, 0xc5, 0x3a, 0xc0, 0x6b, 0x3a, 0xc0,
+  0x3f, 0xc0, 0x6b, 0xc9, 0x6e, 0xc0, 0x06, 0x3f, 0x06, 0xd9, 0x6f, 0xc1, 0x66, 0x06, 0xc2, 0x0d,
+  0x06, 0x01, 0x06, 0xc6, 0x01, 0xc1, 0x06, 0x01, 0x06, 0xc0, 0x0d, 0xc0, 0x06, 0xc1, 0x0d, 0xc0,
+  0x06, 0xc1, 0x12, 0x0d, 0xc4, 0x06, 0x12, 0xc5, 0x0d, 0xc0, 0x12, 0xfe, 0x12, 0xef, 0xc0, 0x66,
+  0xc0, 0x22, 0xc0, 0x1d, 0xc2, 0x22, 0xc0, 0x1d, 0xc3, 0x22, 0x1d, 0x22, 0xc1, 0x6b, 0x1d, 0xc1,
+  0x22, 0x1d, 0xc1, 0x22, 0xc1, 0x29, 0xc5, 0x6e, 0xc4, 0x6e, 0xc3, 0x6b, 0xc8, 0x2e, 0xc8, 0x29,
+  0xc4, 0x22, 0xc1, 0x29, 0x1d, 0xc6, 0x22, 0x1d, 0x22, 0xc0, 0x1d, 0xc6, 0x22, 0xc3, 0x1d, 0xc1,
+  0x22, 0xc3, 0x29, 0x22, 0xc2, 0x29, 0xc6, 0x2e, 0x29, 0xc0, 0x2e, 0x29, 0x2e, 0xc9, 0x29, 0x2e,
+  0xcb, 0x6b, 0x2e, 0x3a, 0xc7, 0x35, 0x3a, 0xc1, 0x35, 0xc1, 0x2e, 0x35, 0xc5, 0x3a, 0x35, 0xc8,
+  0x3a, 0xd9, 0x6e, 0xc1, 0x6b, 0xcd, 0x3f, 0x06, 0xd3, 0x66, 0x06, 0xc4, 0x6b, 0xc0, 0x06, 0xc2,
+  0x0d, 0x06, 0xc9, 0x01, 0xc2, 0x06, 0xc5, 0x0d, 0xc0, 0x06, 0xc0, 0x0d, 0x6e, 0x0d, 0xc5, 0x12,
+  0xc5, 0x0d, 0xc1, 0xfe, 0x12, 0xcf, 0xc5, 0x6e, 0x1d, 0xc0, 0x22, 0xc0, 0x1d, 0xc5, 0x22, 0xc2,
+  0x1d, 0xc5, 0x22, 0xc4, 0x6b, 0xc1, 0x6e, 0xc8, 0x6e, 0xc0, 0x6b, 0xc6, 0x33, 0xc0, 0x2e, 0xc8,
+  0x29, 0xc1, 0x22, 0xc4, 0x1d, 0xc6, 0x22, 0x1d, 0xca, 0x22, 0xc3, 0x1d, 0xc1, 0x22, 0xc1, 0x1d,
+  0xc1, 0x22, 0xc0, 0x29, 0xc5, 0x22, 0xc0, 0x29, 0xc4, 0x2e, 0xc7, 0x29, 0xc2, 0x2e, 0xc0, 0x29,
+  0xc1, 0x2e, 0xc4, 0x6b, 0xc2, 0x3a, 0xc6, 0x2e, 0x35, 0x3a, 0xc1, 0x35, 0xca, 0x3a, 0xc0, 0x35,
+  0xc0, 0x3a, 0x35, 0xc2, 0x3a, 0xda, 0x6e, 0xc0, 0x6b, 0xcd, 0x66, 0x06, 0xc2, 0x3f, 0x06, 0xcc,
+  0x01, 0x3f, 0xc0, 0x06, 0xc5, 0x6b, 0xc1, 0x06, 0x0d, 0x06, 0x01, 0x06, 0xc4, 0x01, 0x06, 0xc2,
+  0x01, 0x06, 0xc2, 0x01, 0x06, 0xc3, 0x0d, 0x06, 0xc0, 0x0d, 0xc0, 0x06, 0xc0, 0x0d, 0xc0, 0x06,
+  0xc2, 0x0d, 0x6e, 0xc3, 0x0d, 0xc1, 0xfe, 0x12, 0xef, 0x66, 0xc1, 0x22, 0xc1, 0x1d, 0x22, 0xc1,
+  0x1d, 0xc5, 0x22, 0x1d, 0x22, 0xc2, 0x1d, 0xc2, 0x22, 0x1d, 0x22, 0xc4, 0x6b, 0xc4, 0x6e, 0xc4,
+  0x6e, 0xc1, 0x6b, 0xc6, 0x33, 0x2e, 0x33, 0xc0, 0x2e, 0xc6, 0x29, 0xc1, 0x22, 0x29, 0x22, 0xc1,
+  0x1d, 0xc0, 0x22, 0xc0, 0x1d, 0xd1, 0x22, 0xc2, 0x1d, 0xc0, 0x22, 0xc3, 0x1d, 0xc0, 0x22, 0xc1,
+  0x29, 0xc4, 0x22, 0xc0, 0x29, 0xc4, 0x2e, 0xc7, 0x29, 0x2e, 0xc0, 0x29, 0xc7, 0x2e, 0xc1, 0x6b,
+  0xc4, 0x3a, 0xc1, 0x35, 0x3a, 0x35, 0x2e, 0x3a, 0xc2, 0x35, 0xc0, 0x66, 0x35, 0xd0, 0x3a, 0xda,
+  0x6e, 0xc0, 0x67, 0x6e, 0xcc, 0x3f, 0x06, 0xc1, 0x3f, 0xc0, 0x06, 0xcb, 0x01, 0x3a, 0xc0, 0x3f,
+  0x06, 0x01, 0x06, 0xc3, 0x6f, 0x66, 0xc0, 0x06, 0xc7, 0x01, 0x06, 0xc8, 0x01, 0xc0, 0x06, 0xc2,
+  0x0d, 0x06, 0xc0, 0x0d, 0xc0, 0x06, 0xc6, 0x12, 0xc3, 0x0d, 0xc1, 0x12, 0xfe, 0x12, 0xcf, 0x6e,
+  0x1d, 0x22, 0xc0, 0x1d, 0x22, 0x1d, 0x22, 0xc1, 0x1d, 0xc5, 0x22, 0x1d, 0x22, 0xc2, 0x1d, 0xc5,
+  0x22, 0xc3, 0x6b, 0xc3, 0x6e, 0xc5, 0x6e, 0xc1, 0x6b, 0xc6, 0x2e, 0xca, 0x29, 0xc1, 0x22, 0xc2,
+  0x1d, 0xc0, 0x22, 0xc0, 0x1d, 0xd2, 0x22, 0xc2, 0x1d, 0xc3, 0x22, 0x1d, 0xc0, 0x22, 0xc5, 0x29,
+  0x22, 0xc1, 0x1d, 0x22, 0xc0, 0x29, 0xc2, 0x2e, 0xc7, 0x29, 0xc1, 0x2e, 0xc0, 0x29, 0x2e, 0x29,
+  0xc4, 0x2e, 0xc1, 0x6b, 0xc4, 0x3a, 0xc0, 0x35, 0x3a, 0x2e, 0xc0, 0x3a, 0x35, 0xc1, 0x2e, 0xc0,
+  0x35, 0xc5, 0x3a, 0x35, 0xcb, 0x3a, 0xd8, 0x6e, 0x3a, 0x6f, 0xc1, 0x3f, 0xc2, 0x06, 0xc2, 0x3f,
+  0x06, 0xc0, 0x3f, 0xc0, 0x06, 0xc1, 0x3f, 0xc0, 0x06, 0xc0, 0x66, 0x06, 0xc9, 0x01, 0x3a, 0x3f,
+  0x06, 0x01, 0x06, 0xc2, 0x6f, 0xc1, 0x66, 0x06, 0xc7, 0x01, 0x06, 0xc3, 0x0d, 0x06, 0xc2, 0x01,
+  0x06, 0xc3, 0x0d, 0x06, 0xc0, 0x0d, 0x06, 0xc7, 0x0d, 0xc0, 0x12, 0xc1, 0x0d, 0xc1, 0x12, 0xfe,
+  0x12, 0xcf, 0xc4, 0x6e, 0x1d, 0xc0, 0x22, 0xc0, 0x1d, 0xc2, 0x22, 0x1d, 0xc1, 0x22, 0xc3, 0x1d,
+  0x22, 0xc0, 0x1d, 0xc2, 0x22, 0xc3, 0x6b, 0xc0, 0x6e, 0x29, 0xc1, 0x2e, 0xc5, 0x6e, 0xc0, 0x6b,
+  0xc0, 0x33, 0x3a, 0x33, 0xc2, 0x2e, 0xca, 0x29, 0xc1, 0x22, 0xc1, 0x1d, 0xc5, 0x66, 0x1d, 0xcf,
+  0x22, 0x1d, 0x22, 0xc0, 0x1d, 0xc9, 0x22, 0xc2, 0x29, 0x22, 0x1d, 0x22, 0xc2, 0x29, 0xc2, 0x2e,
+  0xc8, 0x29, 0xc0, 0x2e, 0x29, 0xc3, 0x2e, 0x29, 0xc0, 0x2e, 0xc3, 0x6b, 0x33, 0x35, 0x2e, 0xc0,
+  0x35, 0xc2, 0x2e, 0x33, 0x2e, 0x35, 0x2e, 0xc3, 0x35, 0xc9, 0x3a, 0x35, 0xc6, 0x3a, 0xc4, 0x35,
+  0x3a, 0xc5, 0x35, 0x3a, 0xca, 0x6e, 0x3a, 0xc0, 0x3f, 0x3a, 0x3f, 0x6b, 0xc0, 0x3f, 0x06, 0xc1,
+  0x3f, 0xc0, 0x06, 0x3f, 0xc0, 0x3a, 0x6b, 0x06, 0x3f, 0xc1, 0x06, 0x01, 0x06, 0xc8, 0x01, 0x06,
+  0xc3, 0x01, 0x06, 0xc2, 0x6f, 0xc0, 0x66, 0x06, 0xd2, 0x01, 0x06, 0x0d, 0x12, 0x06, 0xc0, 0x0d,
+  0x06, 0xcb, 0x0d, 0x12, 0xc1, 0x0d, 0xc0, 0x12, 0xc0, 0xfe, 0x12, 0xcf, 0xc3, 0x6e, 0xc0, 0x1d,
+  0xc0, 0x22, 0x1d, 0xc4, 0x22, 0xc0, 0x1d, 0xc1, 0x22, 0xc0, 0x1d, 0x22, 0xc0, 0x1d, 0xc4, 0x22,
+  0xc2, 0x6b, 0xc1, 0x22, 0x29, 0xc1, 0x6e, 0xc3, 0x6e, 0xc1, 0x6b, 0xc0, 0x33, 0xc2, 0x3a, 0xc0,
+  0x2e, 0xca, 0x29, 0xc0, 0x22, 0xc4, 0x1d, 0xc2, 0x66, 0x1d, 0xc4, 0x22, 0x1d, 0xc9, 0x22, 0x1d,
+  0xcf, 0x22, 0xc2, 0x29, 0xc0, 0x22, 0xc0, 0x29, 0xc3, 0x2e, 0xc4, 0x29, 0xcc, 0x2e, 0xc5, 0x6b,
+  0x2e, 0x35, 0x2e, 0xc0, 0x35, 0xc0, 0x2e, 0x35, 0x3a, 0x35, 0x2e, 0xc6, 0x35, 0xc3, 0x2e, 0x35,
+  0xca, 0x3a, 0xc3, 0x35, 0x3a, 0x35, 0x3a, 0xc3, 0x35, 0x3a, 0xcb, 0x6e, 0xc0, 0x6b, 0xc0, 0x66,
+  0x06, 0xc0, 0x3f, 0x06, 0xc4, 0x3f, 0xc0, 0x3a, 0xc3, 0x3f, 0x3a, 0x01, 0x06, 0xcc, 0x01, 0xc1,
+  0x06, 0xc2, 0x6f, 0xc0, 0x66, 0x06, 0xd0, 0x01, 0xc2, 0x06, 0xc2, 0x0d, 0x06, 0xc4, 0x0d, 0xc1,
+  0x06, 0xc2, 0x0d, 0x12, 0xc1, 0x0d, 0x12, 0xc1, 0xb5, 0x0d, 0x6e, 0xc3, 0x6e, 0x1d, 0xc0, 0x22,
+  0x1d, 0xc4, 0x22, 0xc0, 0x1d, 0xc1, 0x22, 0xc3, 0x1d, 0xc4, 0x22, 0x1d, 0xc0, 0x22, 0xc0, 0x6b,
+  0x6e, 0xc0, 0x29, 0xc0, 0x2e, 0xc4, 0x6e, 0xc1, 0x6b, 0xc0, 0x33, 0xc4, 0x2e, 0xc8, 0x29, 0xc3,
+  0x22, 0xc2, 0x1d, 0xca, 0x22, 0xc0, 0x1d, 0xd6, 0x22, 0x1d, 0xc0, 0x6b, 0x1d, 0xc3, 0x22, 0xc1,
+  0x29, 0xc3, 0x2e, 0xc1, 0x29, 0xc6, 0x2e, 0x29, 0xc0, 0x2e, 0x29, 0xc3, 0x2e, 0xc4, 0x6b, 0xc0,
+  0x2e, 0xc2, 0x35, 0xc0, 0x2e, 0x35, 0x33, 0xc0, 0x2e, 0xc0, 0x35, 0x2e, 0xc3, 0x35, 0xc3, 0x2e,
+  0xc0, 0x35, 0xc3, 0x66, 0x35, 0xc2, 0x3a, 0xc3, 0x35, 0x3a, 0xc0, 0x35, 0x3a, 0xcd, 0x35, 0x3a,
+  0xc2, 0x6e, 0x6b, 0x66, 0x06, 0x01, 0x06, 0xc0, 0x3f, 0xc0, 0x06, 0xc0, 0x3f, 0x06, 0x3f, 0xc0,
+  0x3a, 0xc6, 0x3f, 0x06, 0xc3, 0x01, 0x06, 0xc3, 0x01, 0xc0, 0x3a, 0x3f, 0xc0, 0x06, 0xce, 0x01,
+  0x06, 0xc6, 0x01, 0xc2, 0x06, 0xc1, 0x6b, 0x06, 0xc5, 0x0d, 0xc1, 0x06, 0xc3, 0x0d, 0x6e, 0xc0,
+  0x0d, 0xc0, 0x12, 0xc0, 0xfe, 0x12, 0xcf, 0xc6, 0x6e, 0x1d, 0xc9, 0x22, 0x1d, 0xc2, 0x22, 0x1d,
+  0xc7, 0x22, 0xc1, 0x6f, 0xc0, 0x66, 0xc0, 0x2e, 0xc4, 0x6e, 0xc1, 0x6b, 0xc1, 0x33, 0x2e, 0x3a,
+  0xc0, 0x2e, 0xc8, 0x29, 0xc2, 0x22, 0xc1, 0x1d, 0xc9, 0x66, 0x1d, 0xc5, 0x18, 0xc0, 0x1d, 0xd5,
+  0x6b, 0x1d, 0xc4, 0x22, 0xc0, 0x29, 0xc5, 0x2e, 0x29, 0xc6, 0x2e, 0xc0, 0x29, 0x2e, 0x29, 0xc5,
+  0x2e, 0xcc, 0x6b, 0x2e, 0xc2, 0x35, 0x2e, 0xc1, 0x35, 0xc0, 0x2e, 0x35, 0x2e, 0xc5, 0x35, 0xcd,
+  0x3a, 0xc1, 0x35, 0x3a, 0xd0, 0x6e, 0xc2, 0x6b, 0xc1, 0x3f, 0xc1, 0x06, 0x3f, 0x3a, 0xc3, 0x6b,
+  0x3a, 0xc0, 0x01, 0xc0, 0x3a, 0x06, 0xc4, 0x3f, 0x06, 0xc0, 0x01, 0xc1, 0x3a, 0x3f, 0x01, 0x06,
+  0xca, 0x01, 0xc3, 0x06, 0xc6, 0x01, 0xc1, 0x06, 0xc0, 0x01, 0xc1, 0x06, 0x6b, 0xc2, 0x06, 0xc8,
+  0x0d, 0xc5, 0x6e, 0xfe, 0x12, 0xcf, 0xc9, 0x66, 0x1d, 0xc5, 0x6e, 0xc0, 0x1d, 0xc7, 0x22, 0x1d,
+  0xc2, 0x22, 0xc2, 0x6f, 0x66, 0xc1, 0x2e, 0xc1, 0x6e, 0xc3, 0x6b, 0x33, 0xc0, 0x2e, 0xc0, 0x3a,
+  0x66, 0x2e, 0xc6, 0x29, 0xc3, 0x22, 0xc1, 0x1d, 0xc1, 0x22, 0x1d, 0x22, 0x1d, 0xc4, 0x18, 0x1d,
+  0xc1, 0x18, 0x1d, 0xc0, 0x18, 0xc1, 0x1d, 0xdc, 0x22, 0xc0, 0x29, 0xdb, 0x2e, 0xc3, 0x35, 0x2e,
+  0xcb, 0x29, 0xc0, 0x2e, 0x35, 0x2e, 0xc1, 0x35, 0x2e, 0xc3, 0x35, 0xc1, 0x2e, 0x35, 0xca, 0x3a,
+  0xd1, 0x6b, 0xc0, 0x3a, 0xc0, 0x6e, 0xc2, 0x6b, 0x3f, 0x3a, 0x06, 0xc1, 0x3a, 0xc3, 0x01, 0x3a,
+  0x3f, 0xc0, 0x01, 0x3a, 0x06, 0xc1, 0x01, 0x06, 0x01, 0x3a, 0x06, 0xc0, 0x01, 0xc1, 0x3a, 0xc0,
+  0x01, 0x06, 0xc9, 0x01, 0xc3, 0x3a, 0x06, 0xc6, 0x01, 0xc5, 0x06, 0xc8, 0x01, 0x06, 0xc3, 0x6b,
+  0xc6, 0xfe, 0x12, 0xcf, 0xd0, 0x6e, 0xc1, 0x1d, 0xc9, 0x22, 0xc6, 0x6b, 0xc0, 0x6e, 0xc6, 0x6e,
+  0xc1, 0x2e, 0xc0, 0x33, 0x67, 0x2e, 0xc7, 0x29, 0xc2, 0x22, 0xc3, 0x1d, 0xc1, 0x22, 0x1d, 0xca,
+  0x66, 0xc2, 0x1d, 0xdd, 0x22, 0xc2, 0x29, 0xd9, 0x2e, 0xd0, 0x29, 0xc0, 0x2e, 0xca, 0x35, 0xc1,
+  0x2e, 0x35, 0xc1, 0x29, 0x35, 0xc4, 0x6e, 0xc6, 0x35, 0xc2, 0x3a, 0xc8, 0x6b, 0x3a, 0xc0, 0x6e,
+  0xc2, 0x6b, 0x3f, 0xc0, 0x06, 0xc0, 0x01, 0x3a, 0xc3, 0x01, 0x3a, 0xc4, 0x3f, 0x06, 0x01, 0x3a,
+  0xc0, 0x3f, 0x06, 0xc1, 0x01, 0x3a, 0xc1, 0x01, 0x3a, 0x01, 0x06, 0xc5, 0x3f, 0x06, 0xc0, 0x01,
+  0xc0, 0x3a, 0xc0, 0x01, 0x06, 0xc0, 0x01, 0x3f, 0x06, 0xc2, 0x01, 0xc6, 0x06, 0xce, 0x6b, 0xc2,
+  0x6e, 0x0d, 0xc0, 0xb5, 0x0d, 0x6e, 0xd0, 0x6e, 0xc0, 0x1d, 0xc8, 0x22, 0xc3, 0x6b, 0x22, 0xc1,
+  0x29, 0xc0, 0x6e, 0x29, 0x2e, 0xc4, 0x6e, 0xc0, 0x2e, 0xc6, 0x29, 0xc0, 0x2e, 0xc1, 0x29, 0xc3,
+  0x22, 0xc3, 0x1d, 0xc5, 0x18, 0x1d, 0xc0, 0x18, 0x1d, 0xc4, 0x18, 0xc0, 0x1d, 0xc4, 0x18, 0x1d,
+  0x18, 0xc1, 0x1d, 0xc5, 0x22, 0x1d, 0xcc, 0x22, 0x1d, 0x22, 0x29, 0xd9, 0x2e, 0x29, 0xc0, 0x2e,
+  0xcb, 0x29, 0xc4, 0x2e, 0xc6, 0x6b, 0x2e, 0xc2, 0x29, 0x2e, 0x35, 0xc7, 0x6e, 0xc5, 0x35, 0xc3,
+  0x3a, 0x35, 0x3a, 0xca, 0x6e, 0xc3, 0x3a, 0x6b, 0xc0, 0x3a, 0xc0, 0x3f, 0x3a, 0xc1, 0x01, 0x3a,
+  0xc9, 0x3f, 0x6b, 0xc0, 0x01, 0xc0, 0x3a, 0xc1, 0x01, 0x06, 0xc0, 0x3f, 0x06, 0xc7, 0x01, 0xc1,
+  0x3a, 0x01, 0x3a, 0x3f, 0xc1, 0x06, 0xc3, 0x01, 0xc5, 0x06, 0xc8, 0x01, 0xc0, 0x06, 0xc0, 0x01,
+  0x06, 0xc0, 0x6b, 0x6e, 0x0d, 0xc1, 0x06, 0xfe, 0x12, 0xcf, 0xd2, 0x6e, 0x1d, 0xc8, 0x22, 0x1d,
+  0xc1, 0x22, 0x6b, 0x6e, 0xc1, 0x29, 0xc3, 0x2e, 0xc3, 0x6e, 0xc1, 0x2e, 0xc4, 0x29, 0xc3, 0x2e,
+  0x29, 0xc1, 0x22, 0xc4, 0x1d, 0xe0, 0x66, 0xc0, 0x1d, 0xcf, 0x22, 0xc1, 0x29, 0x22, 0xc0, 0x29,
+  0xc9, 0x22, 0xc0, 0x29, 0xcc, 0x2e, 0xcb, 0x29, 0xc4, 0x2e, 0xce, 0x6b, 0x29, 0x35, 0xc7, 0x6e,
+  0x35, 0x3a, 0xc0, 0x35, 0xc5, 0x3a, 0xc3, 0x35, 0x3a, 0xc6, 0x6e, 0xc1, 0x3a, 0xc2, 0x3f, 0xc0,
+  0x3a, 0xc1, 0x6b, 0x3a, 0xc4, 0x01, 0xc2, 0x6e, 0xc1, 0x01, 0xc1, 0x3a, 0xc2, 0x06, 0xc0, 0x3f,
+  0x06, 0xc7, 0x01, 0xc3, 0x06, 0xc6, 0x01, 0xc6, 0x06, 0xc9, 0x01, 0x06, 0x01, 0xc0, 0x06, 0xc1,
+  0x6b, 0xc1, 0x06, 0xc0, 0xb5, 0x0d, 0x6e, 0xdc, 0x6e, 0xc3, 0x6b, 0xc0, 0x6e, 0xc1, 0x29, 0xc2,
+  0x2e, 0xc5, 0x6e, 0x2e, 0xc3, 0x29, 0xc7, 0x22, 0xc5, 0x1d, 0xc2, 0x18, 0xc0, 0x1d, 0xd9, 0x18,
+  0xc1, 0x1d, 0xd1, 0x22, 0xc4, 0x29, 0xc2, 0x22, 0xc0, 0x29, 0xc1, 0x22, 0xc1, 0x29, 0xc7, 0x2e,
+  0x29, 0xc1, 0x2e, 0xca, 0x29, 0xc7, 0x2e, 0xc3, 0x29, 0x2e, 0xc7, 0x29, 0x6f, 0xc5, 0x6e, 0xc3,
+  0x35, 0xc1, 0x3a, 0x35, 0xc0, 0x3a, 0xcf, 0x6e, 0xc0, 0x3a, 0xc2, 0x3f, 0xc0, 0x3a, 0xc8, 0x6b,
+  0xc2, 0x6e, 0x3f, 0x06, 0x01, 0x3a, 0xc5, 0x01, 0x06, 0xc5, 0x01, 0x06, 0xc0, 0x01, 0xc1, 0x3a,
+  0x01, 0xc0, 0x3a, 0x3f, 0xc0, 0x06, 0xc2, 0x01, 0xc7, 0x06, 0xc7, 0x01, 0x06, 0xc2, 0x01, 0x06,
+  0xc5, 0xb5, 0x0d, 0x6e, 0xc6, 0x18, 0xc2, 0x1d, 0xc4, 0x6e, 0x1d, 0xcd, 0x22, 0x6b, 0x6e, 0xc2,
+  0x29, 0xc2, 0x2e, 0xcb, 0x29, 0xc8, 0x22, 0xc2, 0x1d, 0xc3, 0x18, 0x1d, 0x18, 0xc6, 0x1d, 0xc1,
+  0x18, 0xc2, 0x1d, 0xc4, 0x18, 0xc1, 0x1d, 0xc0, 0x18, 0xc0, 0x1d, 0xc9, 0x18, 0x1d, 0xc7, 0x22,
+  0xc5, 0x29, 0xc2, 0x22, 0xc3, 0x29, 0xca, 0x2e, 0x29, 0xc2, 0x2e, 0xc3, 0x29, 0xc0, 0x2e, 0xc1,
+  0x29, 0xc8, 0x2e, 0xc3, 0x29, 0xc1, 0x2e, 0xc4, 0x29, 0xc0, 0x6f, 0xc4, 0x2e, 0x35, 0x6e, 0xc2,
+  0x35, 0xc3, 0x3a, 0xc2, 0x35, 0x3a, 0xc0, 0x35, 0x3a, 0xc7, 0x6e, 0xc0, 0x3a, 0xc3, 0x3f, 0xc0,
+  0x3a, 0xce, 0x6f, 0x66, 0x3a, 0xc6, 0x01, 0x06, 0x3f, 0x06, 0xc1, 0x01, 0xc0, 0x06, 0xc0, 0x01,
+  0xc1, 0x3a, 0x01, 0x3a, 0xc1, 0x01, 0x06, 0xc2, 0x01, 0xc8, 0x06, 0xc6, 0x01, 0x06, 0xc2, 0x01,
+  0x06, 0xc3, 0x6b, 0xc0, 0xb5, 0x0c, 0x6f, 0xc5, 0x66, 0x11, 0xc1, 0x18, 0x1d, 0x18, 0x1d, 0xc1,
+  0x6e, 0xc0, 0x1d, 0xc2, 0x18, 0x1d, 0xc8, 0x22, 0xc1, 0x6f, 0xc0, 0x66, 0xc0, 0x2e, 0xca, 0x6e,
+  0x2e, 0xc2, 0x29, 0xc0, 0x2e, 0x29, 0xc0, 0x2e, 0x22, 0xc3, 0x1d, 0xc4, 0x18, 0xc0, 0x1d, 0xc0,
+  0x18, 0x11, 0x18, 0xc2, 0x11, 0x1d, 0xc1, 0x11, 0xc1, 0x18, 0xc0, 0x1d, 0xc6, 0x18, 0xc1, 0x1d,
+  0xc8, 0x18, 0xc1, 0x1d, 0xc7, 0x22, 0xc6, 0x29, 0xc2, 0x22, 0xc3, 0x29, 0xc2, 0x22, 0x29, 0xd0,
+  0x2e, 0xc1, 0x29, 0xca, 0x2e, 0xc3, 0x29, 0xc0, 0x2e, 0xc0, 0x29, 0xc2, 0x2e, 0xc0, 0x6b, 0xc0,
+  0x2e, 0xc2, 0x35, 0xc2, 0x6e, 0x35, 0xc5, 0x3a, 0xc3, 0x35, 0x3a, 0xc6, 0x6e, 0xc1, 0x3a, 0xc4,
+  0x3f, 0x3a, 0xce, 0x6b, 0xc0, 0x3a, 0xc6, 0x01, 0x6e, 0xc3, 0x3a, 0xc0, 0x3f, 0x06, 0x3a, 0xc0,
+  0x3f, 0x01, 0x3a, 0xc2, 0x01, 0x06, 0xc1, 0x01, 0xc9, 0x06, 0xc2, 0x6f, 0x06, 0xcc, 0x6b, 0xc0,
+  0xb5, 0x0c, 0x6f, 0xc0, 0x66, 0x11, 0x18, 0x1d, 0x18, 0x11, 0xc3, 0x18, 0xc1, 0x1d, 0xd0, 0x6e,
+  0xc3, 0x6b, 0x6e, 0x29, 0x2e, 0xcb, 0x6e, 0x2e, 0xc0, 0x29, 0x2e, 0x22, 0x2e, 0x29, 0xc0, 0x22,
+  0xc4, 0x1d, 0xc5, 0x11, 0x1d, 0x18, 0x11, 0xc2, 0x18, 0xc0, 0x1d, 0xc1, 0x18, 0xc0, 0x11, 0xc3,
+  0x1d, 0xc5, 0x18, 0x11, 0xc0, 0x1d, 0xc6, 0x18, 0x1d, 0xc0, 0x18, 0x1d, 0xc1, 0x18, 0xc0, 0x1d,
+  0xc3, 0x22, 0xc1, 0x29, 0xc0, 0x22, 0xc0, 0x29, 0x22, 0xc3, 0x29, 0x22, 0xc2, 0x29, 0xc1, 0x22,
+  0x29, 0xc0, 0x2e, 0x29, 0xc4, 0x2e, 0x29, 0xc7, 0x2e, 0xc0, 0x29, 0xca, 0x2e, 0x29, 0xcb, 0x2e,
+  0xc7, 0x6b, 0xc0, 0x6e, 0x35, 0xc8, 0x3a, 0xc0, 0x35, 0x3a, 0xc5, 0x6e, 0xc0, 0x3a, 0x3f, 0xc0,
+  0x3a, 0xcf, 0x6b, 0xc2, 0x3a, 0xc8, 0x01, 0xc0, 0x6e, 0x3f, 0xc2, 0x01, 0x3a, 0xc1, 0x3f, 0x3a,
+  0xc7, 0x3f, 0x06, 0xc0, 0x01, 0xc7, 0x06, 0xc6, 0x01, 0xc3, 0x6f, 0x06, 0x01, 0xc0, 0x06, 0xc1,
+  0x0d, 0xc0, 0xb5, 0x0d, 0x6e, 0x18, 0xc4, 0x69, 0xc3, 0x18, 0xc1, 0x1d, 0xc6, 0x18, 0x1d, 0xc7,
+  0x6e, 0x6b, 0x22, 0xc3, 0x6f, 0x22, 0x2e, 0xca, 0x6e, 0x2e, 0x29, 0x2e, 0xc0, 0x22, 0xc0, 0x2e,
+  0x22, 0x2e, 0x22, 0xc2, 0x1d, 0xc6, 0x18, 0xc1, 0x11, 0xc2, 0x18, 0xc2, 0x1d, 0x18, 0x11, 0xc3,
+  0x1d, 0xc6, 0x18, 0x11, 0xc0, 0x18, 0xc0, 0x11, 0x18, 0x1d, 0xc1, 0x18, 0xc2, 0x1d, 0xca, 0x22,
+  0xcb, 0x1d, 0xc2, 0x22, 0xc2, 0x29, 0xc8, 0x2e, 0xc0, 0x29, 0xc5, 0x2e, 0xc0, 0x29, 0xc9, 0x2e,
+  0x29, 0xc4, 0x2e, 0x29, 0xc5, 0x2e, 0xc8, 0x6b, 0xc9, 0x6e, 0xc9, 0x6e, 0xc2, 0x3a, 0xd0, 0x6b,
+  0x3a, 0xc4, 0x01, 0x3a, 0xc6, 0x3f, 0x6b, 0xc3, 0x01, 0x3a, 0xca, 0x06, 0xc0, 0x01, 0xc7, 0x06,
+  0x01, 0x06, 0xc5, 0x01, 0xc1, 0x06, 0x01, 0xc0, 0x06, 0xc0, 0x01, 0x06, 0xc3, 0xb5, 0x0d, 0x6e,
+  0x18, 0xc4, 0x69, 0xc3, 0x18, 0x11, 0x18, 0x1d, 0xc6, 0x18, 0x1d, 0xc6, 0x6e, 0xc4, 0x6f, 0xc1,
+  0x22, 0x2e, 0xc9, 0x6e, 0xc0, 0x2e, 0xc0, 0x22, 0xc8, 0x1d, 0xc4, 0x18, 0xc0, 0x1d, 0x18, 0xc0,
+  0x11, 0x18, 0xc6, 0x1d, 0x18, 0xc0, 0x11, 0xc3, 0x18, 0xc6, 0x11, 0xc0, 0x18, 0xc3, 0x1d, 0x18,
+  0xc0, 0x1d, 0xc0, 0x18, 0x1d, 0x18, 0x1d, 0xc3, 0x18, 0x1d, 0xc1, 0x22, 0xc1, 0x1d, 0xc1, 0x22,
+  0x6b, 0xc0, 0x22, 0x29, 0x22, 0x1d, 0xc6, 0x22, 0xc1, 0x29, 0xc4, 0x2e, 0x29, 0xc0, 0x2e, 0xc1,
+  0x29, 0xd1, 0x2e, 0xc0, 0x29, 0xcd, 0x2e, 0xc4, 0x6b, 0xc0, 0x6e, 0x35, 0xca, 0x3a, 0xc7, 0x6e,
+  0xc1, 0x3a, 0xdd, 0x35, 0x3a, 0xc2, 0x6f, 0xc2, 0x66, 0xc0, 0x3a, 0xc4, 0x35, 0xc0, 0x3a, 0xc2,
+  0x3f, 0x06, 0x01, 0xc7, 0x06, 0xc7, 0x01, 0xc0, 0x06, 0xc2, 0x01, 0x06, 0x01, 0x06, 0xc3, 0xb5,
+  0x0d, 0xc3, 0x6e, 0x18, 0x69, 0xc3, 0x18, 0xc0, 0x11, 0x1d, 0xc3, 0x18, 0x1d, 0xc5, 0x18, 0x1d,
+  0xc1, 0x6e, 0xc5, 0x6f, 0x22, 0xc1, 0x2e, 0xc6, 0x66, 0x2e, 0xc4, 0x22, 0x29, 0xc0, 0x2e, 0x22,
+  0xc4, 0x1d, 0xc4, 0x18, 0xc2, 0x11, 0xc4, 0x18, 0xc1, 0x11, 0xc2, 0x66, 0x11, 0xc2, 0x18, 0xc9,
+  0x1d, 0xc0, 0x18, 0xc7, 0x1d, 0xc0, 0x18, 0x1d, 0xc6, 0x22, 0xc4, 0x29, 0x22, 0xc5, 0x1d, 0xc0,
+  0x22, 0xc0, 0x1d, 0x22, 0xc0, 0x29, 0x22, 0x29, 0xc8, 0x2e, 0x29, 0xc0, 0x2e, 0x29, 0xc8, 0x2e,
+  0x29, 0xc5, 0x2e, 0x29, 0xcc, 0x2e, 0x29, 0xc0, 0x2e, 0xc1, 0x6b, 0xc0, 0x6e, 0x35, 0xca, 0x3a,
+  0x35, 0x3a, 0xc6, 0x6e, 0xc0, 0x3a, 0xda, 0x35, 0xc2, 0x3a, 0xc1, 0x3f, 0x6b, 0xc2, 0x66, 0xc0,
+  0x3a, 0xc4, 0x35, 0xc0, 0x3a, 0xc0, 0x01, 0x3a, 0xc0, 0x06, 0x01, 0xc1, 0x3a, 0x01, 0xc0, 0x3a,
+  0xc0, 0x01, 0xc2, 0x06, 0xc1, 0x01, 0x06, 0xc0, 0x01, 0x06, 0xc3, 0x01, 0xc1, 0x06, 0xc3, 0xb5,
+  0x0d, 0x69, 0xc1, 0x18, 0xc1, 0x65, 0x11, 0xc3, 0x18, 0x11, 0x6f, 0xc2, 0x18, 0xc1, 0x1d, 0xc4,
+  0x18, 0x1d, 0xc1, 0x6e, 0xc9, 0x6f, 0xc4, 0x66, 0xc4, 0x22, 0xc2, 0x29, 0xc0, 0x22, 0xc1, 0x6e,
+  0x22, 0xc0, 0x1d, 0xc4, 0x18, 0x1d, 0x18, 0xc1, 0x11, 0xc5, 0x18, 0x1d, 0xc0, 0x11, 0xc0, 0x0c,
+  0xc0, 0x11, 0xc1, 0x18, 0xd5, 0x1d, 0xc1, 0x18, 0xc0, 0x1d, 0xc5, 0x22, 0xc0, 0x1d, 0xc1, 0x22,
+  0xc9, 0x29, 0x22, 0xc4, 0x29, 0xca, 0x2e, 0x29, 0xe4, 0x2e, 0xc2, 0x6b, 0xc4, 0x29, 0x35, 0xc6,
+  0x6e, 0xd7, 0x35, 0x3a, 0xca, 0x35, 0xc3, 0x3a, 0xc1, 0x6f, 0xc1, 0x66, 0xc0, 0x3a, 0xc4, 0x35,
+  0xc2, 0x3a, 0xc1, 0x01, 0x3a, 0xc0, 0x01, 0xc2, 0x3a, 0xc1, 0x01, 0x06, 0x01, 0x06, 0xca, 0x01,
+  0xc1, 0x06, 0xc3, 0xb5, 0x0d, 0x69, 0xc1, 0x18, 0xc0, 0x11, 0xc4, 0x18, 0xc0, 0x11, 0x18, 0x6e,
+  0x18, 0xc4, 0x11, 0x18, 0x1d, 0xc5, 0x6e, 0xc6, 0x6f, 0x22, 0xc2, 0x2e, 0xc9, 0x22, 0xc8, 0x1d,
+  0xc4, 0x18, 0x11, 0x18, 0xc1, 0x11, 0xc1, 0x66, 0x11, 0xc3, 0x18, 0xc0, 0x11, 0xc6, 0x18, 0xc0,
+  0x1d, 0xc1, 0x18, 0xc1, 0x11, 0xc0, 0x18, 0x11, 0xc3, 0x18, 0xc4, 0x1d, 0xc1, 0x18, 0xc0, 0x1d,
+  0xc4, 0x22, 0x1d, 0x22, 0x1d, 0xc0, 0x22, 0xc3, 0x1d, 0xc3, 0x22, 0xc3, 0x1d, 0x22, 0xc1, 0x6b,
+  0xd0, 0x2e, 0x29, 0xc0, 0x22, 0xc0, 0x29, 0xc6, 0x2e, 0xc0, 0x29, 0xca, 0x2e, 0x29, 0xc1, 0x2e,
+  0xc4, 0x6b, 0xc2, 0x29, 0xc1, 0x2e, 0x35, 0xc7, 0x6e, 0xc6, 0x35, 0x3a, 0xc4, 0x35, 0x3a, 0xd2,
+  0x35, 0xc1, 0x3a, 0x35, 0xc0, 0x3a, 0xc1, 0x6e, 0x6b, 0xc0, 0x66, 0x3a, 0xc4, 0x35, 0xc4, 0x3a,
+  0xc0, 0x01, 0xc3, 0x3a, 0xc2, 0x01, 0xc1, 0x06, 0xc2, 0x01, 0x06, 0xc0, 0x01, 0xc0, 0x06, 0xc0,
+  0x01, 0xc3, 0x06, 0xc2, 0xb5, 0x0d, 0x69, 0xc2, 0x18, 0x11, 0xc8, 0x6f, 0x18, 0xc1, 0x11, 0xc2,
+  0x18, 0xc0, 0x1d, 0xc0, 0x18, 0x1d, 0xc2, 0x6e, 0xc5, 0x6f, 0x22, 0xc0, 0x6b, 0x2e, 0xcb, 0x22,
+  0xc4, 0x29, 0xc0, 0x22, 0x1d, 0xc5, 0x18, 0xc1, 0x11, 0xc1, 0x66, 0xc0, 0x11, 0xc0, 0x18, 0x11,
+  0xc5, 0x0c, 0xc0, 0x11, 0xc1, 0x18, 0xc1, 0x1d, 0xc0, 0x11, 0xc2, 0x18, 0xc0, 0x11, 0xc3, 0x18,
+  0xc0, 0x11, 0x0c, 0x11, 0x18, 0xc0, 0x1d, 0xc0, 0x18, 0x1d, 0xc1, 0x18, 0x1d, 0xc3, 0x22, 0xc4,
+  0x1d, 0xc7, 0x22, 0x1d, 0xc2, 0x22, 0xc0, 0x29, 0xd3, 0x22, 0xc1, 0x29, 0xc3, 0x2e, 0x29, 0xc0,
+  0x2e, 0x29, 0xca, 0x2e, 0x29, 0x2e, 0x29, 0x2e, 0xc0, 0x29, 0x2e, 0xc2, 0x6b, 0xc2, 0x29, 0x35,
+  0x2e, 0xc0, 0x35, 0xc6, 0x6e, 0xc1, 0x35, 0xc1, 0x3a, 0xc1, 0x35, 0x3a, 0xc3, 0x35, 0x3a, 0xd7,
+  0x35, 0x3a, 0xc2, 0x6e, 0x6b, 0x66, 0x3a, 0xc4, 0x35, 0x3a, 0xc0, 0x35, 0x3a, 0xc2, 0x01, 0xc0,
+  0x66, 0x01, 0xc0, 0x3a, 0xc0, 0x01, 0x3a, 0xc0, 0x01, 0xc1, 0x06, 0xc1, 0x01, 0x06, 0xc1, 0x01,
+  0xc6, 0x06, 0xc2, 0xb4, 0x0c, 0x6e, 0xc0, 0x6b, 0x11, 0x0c, 0x11, 0xca, 0x18, 0xc1, 0x11, 0xc1,
+  0x18, 0xc1, 0x6e, 0xc4, 0x6e, 0xc0, 0x1d, 0xc0, 0x22, 0xc1, 0x6f, 0x22, 0xc0, 0x2e, 0x22, 0x2e,
+  0xc2, 0x66, 0xc3, 0x2e, 0x22, 0xca, 0x1d, 0xc3, 0x18, 0xc1, 0x11, 0xc3, 0x67, 0x0c, 0xc0, 0x18,
+  0xc3, 0x11, 0x0c, 0xc0, 0x11, 0xc6, 0x18, 0xc0, 0x11, 0x0c, 0x11, 0xc1, 0x18, 0xc0, 0x11, 0xc2,
+  0x0c, 0x11, 0xc0, 0x0c, 0x11, 0x18, 0xc0, 0x1d, 0xca, 0x22, 0x1d, 0xca, 0x6b, 0x1d, 0xc3, 0x22,
+  0xc1, 0x29, 0xc2, 0x22, 0x29, 0xd0, 0x22, 0x29, 0xd1, 0x2e, 0xc2, 0x29, 0xc3, 0x2e, 0xc2, 0x6b,
+  0xc0, 0x29, 0x35, 0xc1, 0x2e, 0xc0, 0x35, 0xc7, 0x6e, 0xc0, 0x35, 0x3a, 0xc9, 0x35, 0x3a, 0xc5,
+  0x35, 0x3a, 0xc7, 0x35, 0x3a, 0xc7, 0x6b, 0x3a, 0x01, 0x6d, 0x6b, 0x3a, 0xc7, 0x35, 0xc1, 0x3a,
+  0xc0, 0x3f, 0x3a, 0x01, 0x66, 0x01, 0xc1, 0x3a, 0x01, 0x3a, 0xc2, 0x01, 0x06, 0xc0, 0x01, 0xc0,
+  0x06, 0xc1, 0x01, 0xc2, 0x06, 0x01, 0xc3, 0x06, 0xc0, 0xb5, 0x0c, 0xc6, 0x66, 0x11, 0xcb, 0x6b,
+  0x11, 0x6f, 0x18, 0x1d, 0xc7, 0x6e, 0x6b, 0x22, 0xc0, 0x6f, 0xc0, 0x22, 0xc1, 0x29, 0xc1, 0x2e,
+  0xc3, 0x29, 0xc0, 0x2e, 0x22, 0x2e, 0xc0, 0x22, 0xc6, 0x1d, 0xc4, 0x11, 0x18, 0xc0, 0x11, 0xc2,
+  0x0c, 0xc0, 0x11, 0xc4, 0x18, 0xc0, 0x11, 0x0c, 0xc2, 0x6b, 0xc0, 0x11, 0x18, 0x11, 0x18, 0xc0,
+  0x11, 0x18, 0x11, 0x18, 0xc1, 0x11, 0xc4, 0x0c, 0x11, 0x0c, 0x11, 0x1d, 0xc0, 0x18, 0x1d, 0xc1,
+  0x18, 0x1d, 0xc2, 0x22, 0x1d, 0xc4, 0x22, 0x1d, 0x22, 0xc0, 0x1d, 0xc5, 0x22, 0x1d, 0xc2, 0x6b,
+  0x22, 0xc3, 0x29, 0xc1, 0x22, 0x29, 0xe1, 0x2e, 0x29, 0x6b, 0x29, 0xc4, 0x2e, 0xc1, 0x6b, 0xc0,
+  0x29, 0x35, 0x29, 0xc0, 0x2e, 0xc1, 0x35, 0x2e, 0x30, 0x35, 0xc4, 0x6e, 0xc1, 0x35, 0x3a, 0xc6,
+  0x35, 0xc0, 0x3a, 0xc2, 0x35, 0xc1, 0x3a, 0xcd, 0x35, 0x3a, 0xc5, 0x6b, 0xc0, 0x3a, 0xc5, 0x35,
+  0x3a, 0x35, 0x3a, 0xc0, 0x35, 0xc0, 0x3a, 0xc0, 0x35, 0x6b, 0x01, 0x3a, 0xc5, 0x3c, 0x01, 0xc3,
+  0x6e, 0xc1, 0x01, 0xc9, 0x06, 0xc0, 0xb5, 0x0c, 0xce, 0x6b, 0xc0, 0x11, 0xc3, 0x18, 0x6e, 0x18,
+  0xc1, 0x1d, 0xc4, 0x6e, 0x1d, 0xa2, 0x78, 0x22, 0x6b, 0x6d, 0x22, 0x29, 0x22, 0xc0, 0x29, 0xc2,
+  0x2e, 0xc2, 0x29, 0xc0, 0x22, 0xc6, 0x1d, 0xc0, 0x22, 0x1d, 0xc5, 0x11, 0x18, 0x11, 0xc4, 0x66,
+  0xc0, 0x6b, 0x18, 0xc3, 0x11, 0xc0, 0x0c, 0x18, 0x11, 0xc0, 0x0c, 0x11, 0x18, 0xc3, 0x11, 0xc1,
+  0x18, 0x11, 0xc2, 0x0c, 0xc0, 0x11, 0xc4, 0x18, 0x1d, 0xc5, 0x18, 0xc0, 0x1d, 0x22, 0x1d, 0xc1,
+  0x22, 0x1d, 0x22, 0xc0, 0x1d, 0x22, 0xc0, 0x1d, 0xcb, 0x22, 0xc3, 0x29, 0xce, 0x22, 0xc3, 0x29,
+  0xca, 0x2e, 0x29, 0xc3, 0xa2, 0x77, 0x2e, 0x29, 0xc3, 0x2e, 0x29, 0xc0, 0x2e, 0xc0, 0x6b, 0xc0,
+  0x29, 0xc2, 0x2e, 0xc1, 0x35, 0x2e, 0x6f, 0x35, 0xc7, 0x3a, 0x35, 0xc0, 0x3a, 0xc9, 0x35, 0xc2,
+  0x3a, 0xca, 0x35, 0x3a, 0x35, 0xc1, 0x3a, 0xc0, 0x35, 0xc0, 0x3a, 0xc0, 0x6b, 0x6e, 0x01, 0x3a,
+  0xc0, 0x35, 0xc0, 0x3a, 0xc0, 0x35, 0xc0, 0x7e, 0x3a, 0x35, 0x3a, 0x35, 0xc0, 0x3a, 0x35, 0x3a,
+  0x01, 0xc0, 0x3a, 0xc3, 0x01, 0xc5, 0x06, 0xc2, 0x01, 0x3a, 0x01, 0xc6, 0x06, 0xc0, 0xb5, 0x0c,
+  0xc3, 0x66, 0x11, 0xc0, 0x0c, 0x11, 0xc5, 0x6b, 0xc0, 0x11, 0xc4, 0x18, 0x6e, 0x18, 0xc1, 0x1d,
+  0xc1, 0x69, 0x6f, 0xc1, 0x1d, 0x22, 0xc5, 0x6b, 0xc1, 0x6e, 0x22, 0x2e, 0xc3, 0x29, 0x22, 0xc5,
+  0x1d, 0xc6, 0x18, 0xc0, 0x11, 0xc6, 0x67, 0x18, 0xc5, 0x11, 0xc0, 0x0c, 0xc1, 0x13, 0x0c, 0x11,
+  0x0c, 0x11, 0x18, 0x11, 0x18, 0xc0, 0x11, 0x18, 0xc7, 0x11, 0x0c, 0x13, 0xc0, 0x11, 0x18, 0xc0,
+  0x1d, 0xc1, 0x18, 0x1d, 0xc0, 0x18, 0x1d, 0xc6, 0x22, 0x1d, 0xc0, 0x22, 0x1d, 0xcc, 0x22, 0xc9,
+  0x29, 0xc2, 0x22, 0x29, 0x22, 0xc0, 0x29, 0x22, 0xc5, 0x29, 0xd0, 0x2e, 0xc0, 0x29, 0xc4, 0x2e,
+  0xc1, 0x6b, 0xc0, 0x29, 0xc3, 0x2e, 0xc1, 0x35, 0xc7, 0x6e, 0x35, 0x3a, 0xc1, 0x35, 0xc0, 0x3a,
+  0xc5, 0x35, 0xc0, 0x3a, 0xc0, 0x35, 0xc0, 0x3a, 0xca, 0x35, 0xc3, 0x3a, 0xc0, 0x35, 0xc0, 0x3a,
+  0xc1, 0x6e, 0xc0, 0x3a, 0xc2, 0x35, 0x3a, 0xc0, 0x35, 0xc0, 0x3a, 0x35, 0xc2, 0x3a, 0x35, 0x3a,
+  0x6b, 0x3a, 0xc3, 0x01, 0xc6, 0x6e, 0xc1, 0x01, 0xc0, 0x3a, 0xc0, 0x01, 0xc3, 0x06, 0xc2, 0xb5,
+  0x0c, 0xc3, 0x66, 0xc0, 0x11, 0xcf, 0x6b, 0xc3, 0x6e, 0xc2, 0x6e, 0xc0, 0x1d, 0xae, 0xa7, 0xb0,
+  0xc6, 0xa8, 0xb7, 0xa3, 0x88, 0xf5, 0x9d, 0x8a, 0x96, 0x78, 0x90, 0x4a, 0x11, 0xc1, 0x6b, 0x11,
+  0x18, 0x0c, 0x11, 0xc1, 0x18, 0x11, 0xc1, 0x0c, 0x11, 0x0c, 0xc0, 0x6b, 0x11, 0x18, 0x11, 0x18,
+  0x1d, 0xc0, 0x18, 0x1d, 0x18, 0xc1, 0x1d, 0xc1, 0xad, 0xb7, 0xb0, 0xb7, 0xa9, 0xb7, 0x31, 0xf5,
+  0x52, 0x97, 0x59, 0x90, 0x59, 0x93, 0x6b, 0xc3, 0x6e, 0x29, 0xc6, 0x2e, 0xc0, 0x29, 0x6f, 0xc0,
+  0x29, 0xc2, 0x2e, 0xc2, 0x35, 0xc1, 0x66, 0x2e, 0xc0, 0xac, 0xa7, 0x03, 0xa8, 0xc7, 0x31, 0xf5,
+  0x42, 0x97, 0x6a, 0x8f, 0x5a, 0x35, 0x6e, 0x35, 0x3a, 0xc8, 0x6b, 0xc5, 0x6e, 0xc0, 0x01, 0xc0,
+  0x3a, 0x01, 0x3a, 0x01, 0xc2, 0x06, 0x01, 0x06, 0xc0, 0xb5, 0x0c, 0xc3, 0x66, 0xc0, 0x11, 0xc5,
+  0x0c, 0xc0, 0x11, 0xc5, 0x6b, 0xc4, 0x6e, 0xc3, 0xa2, 0x88, 0xb9, 0xf6, 0xae, 0xa6, 0xfb, 0x92,
+  0x69, 0x85, 0x3c, 0x52, 0x11, 0x0c, 0xc0, 0x7a, 0x13, 0xc0, 0x0c, 0x11, 0xc5, 0x13, 0xc0, 0x11,
+  0xc2, 0x1d, 0xc4, 0x18, 0x1d, 0x7e, 0x2d, 0x31, 0xfb, 0x93, 0x5a, 0x86, 0x3b, 0x56, 0x69, 0x29,
+  0x66, 0x29, 0xc0, 0x6e, 0x29, 0xc6, 0x2e, 0xc0, 0x29, 0xc2, 0x2e, 0xc0, 0x6b, 0x2e, 0x35, 0xc0,
+  0x6e, 0x35, 0x7e, 0xb9, 0xf6, 0xad, 0xb6, 0xfb, 0x93, 0x6a, 0x3d, 0x3a, 0xc1, 0x6b, 0xc0, 0x3a,
+  0xc4, 0x01, 0xc0, 0x3a, 0xc1, 0x01, 0xce, 0x6e, 0xb5, 0x0c, 0xc2, 0x66, 0xc1, 0x11, 0xc1, 0x0c,
+  0xc0, 0x11, 0x0c, 0x11, 0xca, 0x6b, 0x6e, 0x18, 0x1d, 0xc2, 0x6e, 0xba, 0xe6, 0xae, 0xb6, 0xfd,
+  0x91, 0x6b, 0x0c, 0xc1, 0x18, 0x0c, 0x11, 0xc0, 0x0c, 0xc0, 0x11, 0xc1, 0x0c, 0xc0, 0x11, 0x0c,
+  0x6b, 0x11, 0xc2, 0x18, 0x11, 0xc0, 0x18, 0xc0, 0x1d, 0x18, 0x1d, 0xba, 0xe5, 0x31, 0xfd, 0x2a,
+  0x22, 0x6b, 0xc0, 0x22, 0x29, 0xc9, 0x6e, 0x29, 0xc3, 0x2e, 0x29, 0xc1, 0x6f, 0xc0, 0x66, 0xc0,
+  0x2a, 0x31, 0xfd, 0x2a, 0x35, 0x6e, 0xc0, 0x6b, 0xc0, 0x3a, 0xc2, 0x67, 0x3a, 0xc1, 0x3c, 0x01,
+  0xd0, 0x6e, 0xb4, 0x0c, 0x6e, 0xc1, 0x0c, 0xc5, 0x11, 0x0c, 0xc0, 0x11, 0xcb, 0x6b, 0xc0, 0x6e,
+  0xc2, 0xac, 0xb6, 0xbd, 0xe6, 0xfd, 0xc1, 0x81, 0x3c, 0x0c, 0xc7, 0x11, 0xc0, 0x0c, 0xc0, 0x11,
+  0xc0, 0x67, 0x11, 0xc2, 0x18, 0xc0, 0x0c, 0x18, 0x11, 0x18, 0xc0, 0xac, 0xa6, 0x31, 0xfd, 0xc1,
+  0x83, 0x2c, 0x95, 0x6a, 0xc0, 0x69, 0x29, 0xc7, 0x6e, 0x29, 0xc8, 0x2e, 0x29, 0x6b, 0x2e, 0xab,
+  0xb7, 0x31, 0xfd, 0xc1, 0x84, 0x1c, 0x96, 0x59, 0xc1, 0x6b, 0x3a, 0xc2, 0x66, 0xc2, 0x6b, 0xc0,
+  0x01, 0xc7, 0x3a, 0x01, 0xc0, 0x3c, 0xc0, 0x01, 0xc1, 0x6e, 0xb5, 0x0c, 0xc2, 0x66, 0xc8, 0x11,
+  0xc3, 0x0c, 0x11, 0xc6, 0x6b, 0x6e, 0xc2, 0xbd, 0xf6, 0xac, 0xa6, 0xfd, 0xc1, 0x93, 0x6a, 0x82,
+  0x3c, 0x0c, 0xc1, 0x11, 0x0c, 0xc2, 0x18, 0x11, 0xc0, 0x0c, 0x11, 0xc1, 0x0c, 0x11, 0xc0, 0x0c,
+  0x11, 0x18, 0x11, 0x13, 0x11, 0x18, 0xc0, 0x32, 0x31, 0xfd, 0xc1, 0x01, 0x83, 0x2c, 0x6d, 0xc1,
+  0x1d, 0x6f, 0x6e, 0x29, 0xc4, 0x2e, 0x29, 0xc0, 0x2e, 0x29, 0xc2, 0x2e, 0xc1, 0x6b, 0x66, 0x2e,
+  0xba, 0xf6, 0x31, 0xfd, 0xc1, 0x94, 0x5a, 0x86, 0x1b, 0xc5, 0x6b, 0x35, 0xc2, 0x01, 0x66, 0xc0,
+  0x01, 0x3c, 0x01, 0xc4, 0x3a, 0x01, 0x3a, 0xc0, 0x01, 0xc3, 0xb5, 0x0c, 0xc1, 0x66, 0xc7, 0x11,
+  0xc4, 0x0c, 0x11, 0xc0, 0x0c, 0x11, 0xc1, 0x6b, 0xc0, 0x11, 0xc0, 0x18, 0x6e, 0xc1, 0xfe, 0xff,
+  0xbf, 0xa2, 0x77, 0xfd, 0xc1, 0x9d, 0x99, 0x0c, 0xc0, 0x11, 0xc2, 0x0c, 0xc3, 0x11, 0x0c, 0xc1,
+  0x11, 0x67, 0xc0, 0x11, 0x0c, 0xc0, 0x6f, 0xc0, 0x11, 0x18, 0x1d, 0x18, 0xfe, 0xf7, 0x9e, 0x31,
+  0xdd, 0x8a, 0x88, 0x81, 0x99, 0x97, 0x88, 0xa3, 0x99, 0xb4, 0x88, 0xfe, 0xef, 0x5d, 0x31, 0xda,
+  0x51, 0xfe, 0x12, 0xd0, 0x6e, 0x69, 0x29, 0x22, 0x29, 0xc6, 0x6e, 0x29, 0xc0, 0x2e, 0x29, 0xc4,
+  0x2e, 0xc2, 0xfe, 0xef, 0x7e, 0x31, 0xfd, 0xc1, 0x18, 0xfe, 0x13, 0x31, 0x66, 0xc0, 0x3a, 0xc0,
+  0x35, 0x3a, 0xc0, 0x35, 0xc2, 0x6f, 0xc0, 0x66, 0x01, 0xc0, 0x35, 0x3a, 0x3c, 0x01, 0xc0, 0x3a,
+  0xc3, 0x3c, 0xc0, 0x01, 0xc1, 0xb5, 0x0c, 0xc2, 0x66, 0xc7, 0x11, 0xc1, 0x0c, 0xc1, 0x11, 0x0c,
+  0xc0, 0x11, 0xc1, 0x6b, 0xc3, 0x6e, 0xc1, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x11, 0x0c, 0xc0, 0x11,
+  0xc0, 0x0c, 0x11, 0x67, 0x0c, 0xc5, 0x11, 0x0c, 0x11, 0xc0, 0x0c, 0x11, 0x18, 0xc0, 0x11, 0xc1,
+  0x18, 0x31, 0xdd, 0x8a, 0x99, 0x00, 0xa3, 0x88, 0xad, 0x99, 0x99, 0x88, 0x00, 0xab, 0x88, 0xfe,
+  0xff, 0xdf, 0x31, 0xda, 0xfe, 0x12, 0xd0, 0xc0, 0x6e, 0x69, 0xc0, 0x29, 0xd0, 0x6e, 0xc0, 0x29,
+  0xc0, 0x31, 0xfd, 0xc3, 0xfe, 0x13, 0x31, 0x66, 0xc0, 0x3a, 0xc0, 0x35, 0xc3, 0x3a, 0xc2, 0x6b,
+  0xc1, 0x66, 0x35, 0xc0, 0x01, 0xc0, 0x3a, 0xc3, 0x01, 0x3c, 0x01, 0xc1, 0xb5, 0x0c, 0xc0, 0x66,
+  0xc4, 0x11, 0x0c, 0xc2, 0x11, 0xc0, 0x0c, 0xc1, 0x11, 0xc1, 0x0c, 0x11, 0xc0, 0x6e, 0x67, 0xc3,
+  0x6e, 0xc1, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x0c, 0xc0, 0x11, 0x0c, 0x11, 0x0c, 0x11, 0xc0, 0x0c,
+  0xc0, 0x11, 0x0c, 0xc7, 0x11, 0xc0, 0x67, 0x11, 0x18, 0x11, 0x18, 0x31, 0xdd, 0xfe, 0x29, 0x45,
+  0x97, 0x88, 0xfe, 0xde, 0xdb, 0x31, 0xc0, 0xfe, 0x63, 0x0c, 0x00, 0xfe, 0x9c, 0xf3, 0x31, 0xda,
+  0xfe, 0x12, 0xf0, 0x69, 0xc2, 0x67, 0x29, 0xd3, 0x31, 0xfd, 0xc3, 0xfe, 0x13, 0x31, 0xc2, 0x66,
+  0xc4, 0x3a, 0xc4, 0x6b, 0xc0, 0x3a, 0xc0, 0x01, 0x3a, 0xc4, 0x01, 0xc3, 0xb5, 0x0c, 0xc1, 0x66,
+  0xc8, 0x11, 0xc0, 0x0c, 0xc3, 0x11, 0xc3, 0x6b, 0x11, 0xc0, 0x18, 0xc0, 0x6e, 0xc1, 0xfe, 0xff,
+  0xff, 0xfd, 0xc3, 0x11, 0x0c, 0xca, 0x11, 0xc0, 0x0c, 0xc4, 0x11, 0x0c, 0x11, 0xc1, 0x18, 0x31,
+  0xdc, 0x51, 0x00, 0xae, 0x88, 0x31, 0xc1, 0x90, 0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0xfe, 0x12,
+  0xd0, 0x6d, 0xc1, 0x66, 0x24, 0x22, 0x6b, 0xce, 0x6e, 0x29, 0xc1, 0x31, 0xfd, 0xc3, 0xfe, 0x13,
+  0x11, 0xc6, 0x6b, 0x35, 0x6f, 0xc0, 0x69, 0xc2, 0x35, 0x3a, 0xc8, 0x01, 0xc2, 0x3a, 0xb4, 0x0c,
+  0xd2, 0x6e, 0xc6, 0x6b, 0xc2, 0x6e, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x0c, 0xc5, 0x11, 0x0c, 0xca,
+  0x11, 0xc0, 0x0c, 0x11, 0xc1, 0x18, 0x31, 0xdc, 0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91,
+  0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0x1d, 0xc1, 0x6e, 0x1d, 0x6f, 0x22, 0x29, 0xcf, 0x6e, 0x29,
+  0xc0, 0x31, 0xda, 0x9b, 0x99, 0x8c, 0x88, 0x9a, 0x88, 0x18, 0x9c, 0x88, 0x9c, 0x88, 0x9d, 0x88,
+  0x9c, 0x99, 0x9d, 0x88, 0x9c, 0x88, 0x9d, 0x88, 0x9d, 0x99, 0x08, 0x31, 0xd8, 0xfe, 0x13, 0x11,
+  0xc6, 0x6b, 0x35, 0x6f, 0xc4, 0x69, 0xc8, 0x01, 0x3a, 0xc3, 0xb4, 0x0c, 0xc8, 0x6e, 0x0c, 0xc8,
+  0x11, 0xc6, 0x6f, 0xc2, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x0c, 0xce, 0x11, 0x0c, 0xc3, 0x6b, 0x11,
+  0xc2, 0x31, 0xd9, 0x9d, 0x99, 0x99, 0x99, 0xa6, 0x88, 0x18, 0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91,
+  0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0x1d, 0xc4, 0x6e, 0x6b, 0xc9, 0x6e, 0x29, 0xc4, 0x2e, 0xc0,
+  0x31, 0xd9, 0x8c, 0x99, 0xfe, 0x10, 0x62, 0x00, 0xc4, 0xa3, 0x88, 0xa3, 0x99, 0xa4, 0x88, 0xa2,
+  0x88, 0x00, 0x23, 0x31, 0xd8, 0xfe, 0x13, 0x11, 0xc8, 0x6e, 0xc2, 0x6b, 0x3a, 0xc1, 0x01, 0xc0,
+  0x3a, 0xca, 0xb4, 0x0c, 0xd3, 0x6e, 0xc6, 0x6f, 0xc2, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x11, 0x0c,
+  0xd1, 0x11, 0x0c, 0xc1, 0x11, 0x6b, 0xc0, 0x31, 0xd7, 0x51, 0xfe, 0x5a, 0xcb, 0x8b, 0x88, 0x00,
+  0xc0, 0xaf, 0x88, 0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0xfe,
+  0x12, 0xcf, 0xc3, 0x6e, 0xc2, 0x6b, 0xc6, 0x6e, 0xc0, 0x29, 0xc2, 0x2e, 0x29, 0x2e, 0x29, 0x31,
+  0xd8, 0x97, 0x99, 0xfe, 0x08, 0x41, 0xc0, 0xfe, 0x8c, 0x51, 0x20, 0xa4, 0x88, 0xa4, 0x88, 0xa4,
+  0x88, 0x31, 0xc2, 0x89, 0x99, 0x00, 0xb8, 0x88, 0x31, 0xd8, 0xfe, 0x13, 0x11, 0xc8, 0x6e, 0x67,
+  0x3a, 0xc1, 0x35, 0xc2, 0x3c, 0x35, 0x3a, 0xc0, 0x35, 0xc0, 0x3a, 0x35, 0x3a, 0xc3, 0xb4, 0x0c,
+  0xd1, 0x69, 0x0c, 0x6e, 0xc6, 0x6b, 0x6e, 0xc1, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x0c, 0xd0, 0x11,
+  0x0c, 0xc2, 0x11, 0x18, 0x0c, 0x18, 0x31, 0xd7, 0xfe, 0x6b, 0x2d, 0x00, 0xac, 0x88, 0xae, 0x88,
+  0x96, 0x88, 0x00, 0xc0, 0x20, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0x1d, 0xc2,
+  0x6e, 0x1d, 0x22, 0xc1, 0x6b, 0xd0, 0x31, 0xd8, 0x04, 0x00, 0xfe, 0x9c, 0xb3, 0x31, 0xc7, 0xfe,
+  0x29, 0x65, 0x00, 0xfe, 0xde, 0xbb, 0x31, 0xd8, 0xfe, 0x13, 0x11, 0xc1, 0x66, 0x35, 0xc2, 0x30,
+  0x35, 0x6b, 0xc0, 0x35, 0xc4, 0x3c, 0xc0, 0x35, 0xc0, 0x6e, 0xc0, 0x35, 0xc4, 0x3a, 0x6b, 0xb4,
+  0x0c, 0xc0, 0x6e, 0x0c, 0xc1, 0x69, 0x66, 0x0c, 0xc1, 0x05, 0x0c, 0xc0, 0x11, 0x0c, 0xc0, 0x05,
+  0x0c, 0xc1, 0x11, 0xc9, 0x6b, 0xfe, 0xff, 0xff, 0xc5, 0x62, 0x82, 0x88, 0x89, 0x88, 0x99, 0x88,
+  0x66, 0xea, 0x05, 0xa8, 0x88, 0xb7, 0x99, 0xbe, 0x88, 0x31, 0xc6, 0x0c, 0xd3, 0x11, 0x0c, 0x11,
+  0x0c, 0xc0, 0x18, 0x31, 0xd7, 0xfe, 0x18, 0xc3, 0x51, 0x2c, 0x31, 0xc0, 0xfe, 0x63, 0x0c, 0x88,
+  0x88, 0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0xfe, 0x12, 0xd0, 0xc0,
+  0x69, 0xc2, 0x6e, 0xc0, 0x6b, 0xc0, 0x22, 0xc1, 0x6f, 0x29, 0xcb, 0x31, 0xd8, 0xfe, 0x29, 0x45,
+  0x98, 0x88, 0x27, 0x31, 0xc6, 0x8e, 0x88, 0x00, 0xb3, 0x88, 0x31, 0xd9, 0x29, 0x6f, 0xd9, 0x6b,
+  0x6d, 0x6b, 0xc0, 0xb4, 0x0b, 0xc0, 0x6b, 0xc2, 0x05, 0xc0, 0x0c, 0xc0, 0x05, 0xc0, 0x0c, 0xc0,
+  0x6e, 0x0c, 0xc3, 0x11, 0xc6, 0x6e, 0x11, 0x16, 0x11, 0x6b, 0xfe, 0xff, 0xff, 0xc4, 0x62, 0xfe,
+  0x39, 0xc7, 0x98, 0x88, 0xbc, 0x88, 0xab, 0x99, 0xa2, 0x77, 0xc4, 0x7b, 0x11, 0xc3, 0x1b, 0x11,
+  0x1b, 0x11, 0xc4, 0x1b, 0x11, 0xc1, 0x1b, 0x11, 0xc7, 0x1b, 0x11, 0xc2, 0x1b, 0x11, 0x1b, 0x11,
+  0x07, 0x14, 0x3c, 0xa9, 0x88, 0x27, 0x31, 0xc5, 0xfe, 0x12, 0x8e, 0xd4, 0x6e, 0xc0, 0x0c, 0xc0,
+  0x11, 0x31, 0xd7, 0xfe, 0x10, 0x82, 0xa4, 0x88, 0x31, 0xc1, 0x94, 0x88, 0x00, 0xb0, 0x88, 0x31,
+  0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0xfe, 0x12, 0xcf, 0xc3, 0x6e, 0x1d, 0x22, 0xc3,
+  0x6b, 0xcd, 0x31, 0xd7, 0x9c, 0x99, 0x00, 0xae, 0x88, 0x31, 0xc7, 0xfe, 0x41, 0xe8, 0x00, 0xfe,
+  0xc6, 0x38, 0x31, 0xd9, 0xfe, 0x13, 0x11, 0xc5, 0x66, 0x35, 0xc6, 0x30, 0x35, 0xc0, 0x6e, 0x35,
+  0xc6, 0x6b, 0x3a, 0xc0, 0x6b, 0xb4, 0x0c, 0x69, 0x0c, 0xc3, 0x05, 0xc0, 0x0c, 0xc4, 0x05, 0xc1,
+  0x0c, 0xc0, 0x6e, 0xc8, 0x6e, 0x11, 0xc0, 0xfe, 0xff, 0xff, 0xc4, 0x80, 0x88, 0x87, 0x99, 0xfe,
+  0xef, 0x5d, 0xa5, 0x88, 0xee, 0x9a, 0x88, 0x3c, 0xba, 0x88, 0x31, 0xc5, 0x0c, 0xc7, 0x05, 0xc0,
+  0x0c, 0xcd, 0x11, 0x31, 0xd7, 0xfe, 0x10, 0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0xfe, 0x00,
+  0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0xfe, 0x12, 0xcf, 0xc5,
+  0x6e, 0xc1, 0x6b, 0x22, 0xc0, 0x29, 0xcc, 0x31, 0xd7, 0x8f, 0x99, 0x00, 0xbb, 0x99, 0x31, 0xc6,
+  0x93, 0x99, 0x00, 0xae, 0x88, 0x31, 0xda, 0xfe, 0x13, 0x11, 0xc2, 0x66, 0x35, 0xc0, 0x30, 0xc1,
+  0x35, 0xc4, 0x30, 0x35, 0xc0, 0x6e, 0x35, 0xc7, 0x3a, 0xc0, 0x6b, 0xb4, 0x0c, 0xc5, 0x69, 0xc0,
+  0x0c, 0xc2, 0x05, 0x0c, 0x05, 0xc1, 0x0c, 0xc0, 0x6e, 0xcb, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x21,
+  0x24, 0xbb, 0x99, 0x31, 0xf0, 0x84, 0x88, 0x87, 0x99, 0x31, 0xc5, 0x0c, 0xc2, 0x66, 0x0c, 0xc2,
+  0x05, 0xc1, 0x0c, 0xca, 0x11, 0x0c, 0xc0, 0x31, 0xd7, 0xfe, 0x10, 0x82, 0xa4, 0x88, 0x31, 0xc1,
+  0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0xfe, 0x12,
+  0xcf, 0xc6, 0x6e, 0x6b, 0xc0, 0x22, 0xc1, 0x29, 0xcb, 0x31, 0xd7, 0x80, 0x99, 0x00, 0xfe, 0xad,
+  0x55, 0x31, 0xc6, 0xfe, 0x52, 0x8a, 0x00, 0xfe, 0xb5, 0x96, 0x31, 0xda, 0xfe, 0x13, 0x11, 0xc2,
+  0x66, 0x35, 0xc0, 0x30, 0xc1, 0x35, 0xc3, 0x30, 0xc1, 0x35, 0xc9, 0x6e, 0xc0, 0x6b, 0xb4, 0x0b,
+  0x6b, 0xc3, 0x05, 0xc1, 0x0c, 0xc0, 0x05, 0x0c, 0xc6, 0x6e, 0xca, 0x6b, 0xfe, 0xff, 0xff, 0xc4,
+  0x00, 0xfe, 0xc5, 0xf8, 0x31, 0xf0, 0x8e, 0x88, 0xfe, 0x08, 0x21, 0x31, 0xc5, 0x0c, 0xc1, 0x66,
+  0xc0, 0x0c, 0xc2, 0x05, 0x0c, 0xcf, 0x31, 0xd7, 0xfe, 0x10, 0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d,
+  0x99, 0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0xfe, 0x12, 0xcf,
+  0xc4, 0x6e, 0xc5, 0x6b, 0xcc, 0x31, 0xd7, 0xfe, 0x4a, 0x49, 0x00, 0xfe, 0xe6, 0xfc, 0x31, 0xc5,
+  0x97, 0x99, 0xfe, 0x00, 0x20, 0xa9, 0x99, 0x31, 0xdb, 0xfe, 0x13, 0x11, 0xc2, 0x66, 0x35, 0x30,
+  0xc3, 0x35, 0xc1, 0x30, 0xc1, 0x35, 0xca, 0x6b, 0xc1, 0xb4, 0x0b, 0x6b, 0xc0, 0x05, 0xc0, 0x0c,
+  0x05, 0x67, 0x05, 0x0c, 0x05, 0xc0, 0x0c, 0xc6, 0x6e, 0xc1, 0x0c, 0x11, 0xc5, 0x6b, 0xc0, 0xfe,
+  0xff, 0xff, 0xc4, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xf0, 0x8e, 0x99, 0x00, 0x31, 0xc5, 0x0c, 0x66,
+  0x0c, 0xc0, 0x07, 0xc1, 0x0c, 0xc1, 0x11, 0xc0, 0x05, 0x0c, 0xcb, 0x11, 0x31, 0xd7, 0xfe, 0x10,
+  0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc,
+  0x88, 0x31, 0xda, 0xfe, 0x12, 0xcf, 0xc6, 0x6e, 0xc0, 0x1d, 0x22, 0xc2, 0x6b, 0xc1, 0x22, 0x29,
+  0xc0, 0x22, 0xc0, 0x29, 0xc2, 0x31, 0xd7, 0x28, 0x7f, 0x31, 0xc6, 0xfe, 0x63, 0x2c, 0x00, 0xfe,
+  0xa4, 0xf4, 0x31, 0xdb, 0xfe, 0x13, 0x11, 0xc4, 0x66, 0xc3, 0x35, 0xc1, 0x30, 0xc1, 0x35, 0xc0,
+  0x30, 0xc0, 0x35, 0x30, 0xc0, 0x35, 0xc6, 0xb4, 0x0b, 0x6b, 0x05, 0x0c, 0xc0, 0x05, 0x66, 0xc0,
+  0x05, 0x0c, 0x05, 0x0c, 0xc1, 0x05, 0xc0, 0x0c, 0xc2, 0x6e, 0xc0, 0x0c, 0xc0, 0x11, 0xc4, 0x6e,
+  0x67, 0x6e, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xce, 0x39, 0x31, 0xf0, 0x8e, 0x99,
+  0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6e, 0xc0, 0x0c, 0xd6, 0x11, 0x31, 0xd7, 0xfe, 0x10, 0x82, 0xa4,
+  0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88, 0x31,
+  0xda, 0x1d, 0xc0, 0x66, 0x1d, 0xc6, 0x6e, 0xc1, 0x6b, 0xc1, 0x22, 0xc0, 0x29, 0x22, 0xc2, 0x29,
+  0xc1, 0x31, 0xd6, 0x97, 0x99, 0x00, 0xb3, 0x99, 0x31, 0xc5, 0x9b, 0x99, 0xfe, 0x08, 0x21, 0xa5,
+  0x88, 0xfe, 0xff, 0xdf, 0x31, 0xdb, 0xfe, 0x13, 0x11, 0xc1, 0x66, 0xc0, 0x35, 0x30, 0xca, 0x35,
+  0x30, 0x35, 0xca, 0xb4, 0x0b, 0x6b, 0xc1, 0x05, 0xc0, 0x66, 0xc0, 0x05, 0xc3, 0x0c, 0xc2, 0x05,
+  0x0c, 0xc0, 0x6e, 0x0c, 0x11, 0x67, 0x11, 0xc6, 0x6b, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00,
+  0xfe, 0xc6, 0x38, 0x31, 0xc5, 0x9b, 0x99, 0xfe, 0x42, 0x28, 0x00, 0x25, 0x31, 0xc2, 0x62, 0x8a,
+  0x88, 0x8f, 0x88, 0x00, 0x1c, 0xb1, 0x88, 0x27, 0x31, 0xc3, 0x04, 0x85, 0x99, 0x25, 0xc0, 0x3b,
+  0x04, 0x31, 0xc2, 0x98, 0x99, 0x00, 0xc4, 0x1c, 0xb5, 0x88, 0x31, 0xc2, 0x8e, 0x99, 0x00, 0x31,
+  0xc5, 0xfe, 0x12, 0x6e, 0x0c, 0xc0, 0x07, 0x69, 0x0c, 0xc2, 0x07, 0x0c, 0xc0, 0x05, 0x07, 0x0c,
+  0xca, 0x11, 0x31, 0xd7, 0xfe, 0x10, 0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0xfe, 0x00, 0x00,
+  0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88, 0x31, 0xda, 0xfe, 0x12, 0xcf, 0xc0, 0x66,
+  0x1d, 0xc1, 0x6e, 0x1d, 0xc2, 0x22, 0x6b, 0x6e, 0x29, 0xc4, 0x22, 0xc2, 0x29, 0xc1, 0x31, 0xd6,
+  0x89, 0x99, 0x00, 0xfe, 0x8c, 0x31, 0x31, 0xc5, 0xfe, 0x7b, 0xcf, 0x00, 0xfe, 0x8c, 0x51, 0x31,
+  0xdc, 0xfe, 0x13, 0x11, 0xc1, 0x66, 0xc6, 0x35, 0xc0, 0x30, 0xc2, 0x35, 0xc0, 0x30, 0xc2, 0x35,
+  0xc0, 0x30, 0xc0, 0x35, 0xc3, 0xb3, 0x1c, 0x6e, 0xc0, 0x6b, 0x05, 0x00, 0xc0, 0x05, 0x00, 0xc2,
+  0x05, 0xc2, 0x0c, 0xc3, 0x6e, 0xc1, 0x0c, 0x11, 0xc5, 0x6b, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00,
+  0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc5, 0xfe, 0x6b, 0x6d, 0x00, 0xc1, 0x31, 0xc1, 0x9b, 0x99, 0xfe,
+  0x42, 0x28, 0x00, 0xc3, 0x25, 0x04, 0x31, 0xc1, 0x98, 0x99, 0xfe, 0x29, 0x25, 0x00, 0xc2, 0xaa,
+  0x88, 0xfe, 0xe7, 0x1c, 0x31, 0xc1, 0x04, 0x00, 0xc6, 0x09, 0x31, 0xc1, 0x8e, 0x99, 0x00, 0x31,
+  0xc5, 0xfe, 0x12, 0x6e, 0xc3, 0x0c, 0xc2, 0x07, 0x0c, 0xce, 0x11, 0x31, 0xd7, 0xfe, 0x10, 0x82,
+  0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc, 0x88,
+  0x31, 0xda, 0xfe, 0x12, 0xcf, 0x66, 0x1d, 0xc8, 0x6e, 0xc1, 0x6b, 0xc0, 0x22, 0xc5, 0x29, 0xc1,
+  0x31, 0xd6, 0xfe, 0x6b, 0x4d, 0x00, 0xfe, 0xbd, 0xf7, 0x31, 0xc5, 0xfe, 0x18, 0xa3, 0x28, 0xfe,
+  0xf7, 0x9e, 0x31, 0xdc, 0xfe, 0x13, 0x11, 0xc2, 0x66, 0xc2, 0x35, 0x30, 0x35, 0xc5, 0x30, 0x35,
+  0xc3, 0x30, 0x35, 0xc2, 0x30, 0x35, 0xc1, 0xb4, 0x0b, 0xc0, 0x66, 0xc2, 0x05, 0xc0, 0x00, 0xc3,
+  0x05, 0xc1, 0x6b, 0xc1, 0x05, 0x0c, 0xc3, 0x6e, 0xc6, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00,
+  0xfe, 0xc6, 0x38, 0x31, 0xc4, 0x92, 0x99, 0x00, 0xaa, 0x88, 0x00, 0xc0, 0x31, 0xc1, 0x84, 0x99,
+  0x00, 0xb0, 0x88, 0xfe, 0xd6, 0x9a, 0xa9, 0x99, 0x08, 0x20, 0x00, 0x23, 0x31, 0xc0, 0x27, 0xfe,
+  0x42, 0x28, 0x00, 0xb6, 0x88, 0xb8, 0x88, 0xc0, 0x1c, 0x00, 0x25, 0x27, 0x31, 0xc0, 0x9b, 0x99,
+  0x00, 0xa9, 0x99, 0xfe, 0xce, 0x59, 0x2f, 0xc1, 0x96, 0x88, 0x00, 0xc0, 0x0c, 0x31, 0xc0, 0x8e,
+  0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12, 0x8e, 0xc0, 0x66, 0xc1, 0x0c, 0xd3, 0x11, 0x31, 0xd7, 0xfe,
+  0x10, 0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0x20, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xbc,
+  0x88, 0x31, 0xda, 0xfe, 0x12, 0xcf, 0x66, 0x1d, 0xc9, 0x6e, 0x6b, 0xc1, 0x22, 0x1d, 0xc0, 0x22,
+  0xc2, 0x29, 0x66, 0x29, 0x31, 0xd6, 0xfe, 0x31, 0xa6, 0x00, 0xfe, 0xf7, 0x9e, 0x31, 0xc4, 0x18,
+  0x00, 0xae, 0x88, 0x31, 0xdd, 0xfe, 0x13, 0x11, 0xc2, 0x66, 0xd2, 0x35, 0x30, 0xc3, 0x35, 0xc0,
+  0xb3, 0x1c, 0x6e, 0xc1, 0x00, 0xc7, 0x05, 0xc1, 0x6b, 0xc7, 0x6e, 0xc6, 0xfe, 0xff, 0xff, 0xc4,
+  0xfe, 0x00, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc3, 0x62, 0xfe, 0x29, 0x45, 0x00, 0xfe, 0x9c, 0xf3,
+  0x00, 0xc0, 0x31, 0xc1, 0xfe, 0x42, 0x08, 0x00, 0xfe, 0xce, 0x39, 0x31, 0xc1, 0x93, 0x99, 0x00,
+  0xb1, 0x88, 0x31, 0xc0, 0x8c, 0x88, 0x00, 0x25, 0xfe, 0xf7, 0xbe, 0x31, 0xc0, 0x27, 0x25, 0x00,
+  0x29, 0x31, 0xc0, 0x9c, 0x88, 0x00, 0xc0, 0x31, 0xc3, 0x88, 0x99, 0x00, 0xbb, 0x88, 0x31, 0xc0,
+  0x8e, 0x99, 0x00, 0x31, 0xc5, 0x0c, 0xc5, 0x66, 0xc1, 0x0c, 0xce, 0x11, 0x31, 0xd7, 0xfe, 0x10,
+  0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0x20, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xac, 0x88,
+  0xc0, 0x28, 0xa9, 0x88, 0xbc, 0x99, 0x31, 0xd6, 0xfe, 0x12, 0xcf, 0x66, 0x1d, 0xca, 0x6e, 0xc0,
+  0x6b, 0x22, 0x1d, 0xc3, 0x22, 0x29, 0x66, 0x29, 0x31, 0xd5, 0x27, 0xfe, 0x00, 0x20, 0xaa, 0x88,
+  0x31, 0xc6, 0x10, 0x99, 0x99, 0xfe, 0x9c, 0xd3, 0x1f, 0x9b, 0x88, 0x9a, 0x88, 0x9b, 0x88, 0x9a,
+  0x88, 0x9a, 0x99, 0x10, 0x35, 0x31, 0xd4, 0xfe, 0x12, 0xf0, 0xc0, 0x6f, 0xc0, 0x66, 0xc3, 0x35,
+  0x30, 0xcc, 0x35, 0x30, 0xc2, 0x35, 0xc1, 0xb3, 0x1c, 0x6e, 0xc1, 0x00, 0xc4, 0x05, 0x00, 0xc0,
+  0x05, 0xc1, 0x6b, 0xc3, 0x05, 0x0c, 0x6e, 0xc1, 0x0c, 0x11, 0xc3, 0x6b, 0xfe, 0xff, 0xff, 0xc4,
+  0xfe, 0x00, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc3, 0x84, 0x99, 0x00, 0xbb, 0x88, 0xfe, 0xef, 0x7d,
+  0x00, 0xc0, 0x31, 0xc1, 0x00, 0xc0, 0x09, 0x31, 0xc1, 0x9b, 0x99, 0x00, 0xaa, 0x88, 0x31, 0xc0,
+  0xfe, 0x5a, 0xcb, 0x00, 0xfe, 0xbd, 0xd7, 0x31, 0xc2, 0x0c, 0x00, 0x1c, 0x31, 0xc0, 0x04, 0x00,
+  0xc0, 0x31, 0xc3, 0x98, 0x99, 0x00, 0x24, 0x31, 0xc0, 0x8e, 0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12,
+  0x6e, 0xc0, 0x6e, 0xc3, 0x07, 0xc1, 0x0c, 0xc5, 0x07, 0xc0, 0x0c, 0xc6, 0x31, 0xd7, 0xfe, 0x10,
+  0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc1, 0x91, 0x99, 0x00, 0xc0,
+  0x7f, 0x24, 0x98, 0x88, 0x00, 0xfe, 0x9c, 0xf3, 0x31, 0xd5, 0xfe, 0x12, 0xcf, 0x66, 0x1d, 0xc9,
+  0x6e, 0xc1, 0x6b, 0xc0, 0x22, 0x1d, 0xc2, 0x22, 0x29, 0xc1, 0x31, 0xd5, 0x25, 0x00, 0xb9, 0x88,
+  0x31, 0xc6, 0x8e, 0x99, 0x14, 0x00, 0xc4, 0x0f, 0x00, 0x0f, 0x31, 0xd4, 0xfe, 0x12, 0xf1, 0x29,
+  0xc0, 0x30, 0xc3, 0x6d, 0x6b, 0x30, 0x29, 0x30, 0xc3, 0x29, 0x30, 0xc3, 0x35, 0x30, 0xc3, 0x35,
+  0xc0, 0x30, 0xb4, 0x0b, 0xc0, 0x66, 0xc6, 0x05, 0x00, 0xc0, 0x05, 0xc1, 0x6b, 0xc5, 0x6e, 0xc7,
+  0x6b, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc2, 0x95, 0x99, 0x00,
+  0xaa, 0x88, 0xfe, 0xef, 0x5d, 0xc0, 0x00, 0xc0, 0x31, 0xc1, 0xfe, 0x6b, 0x6d, 0x00, 0xfe, 0xad,
+  0x75, 0x31, 0xc1, 0x8b, 0x99, 0x00, 0x09, 0x31, 0xc0, 0x00, 0xc0, 0x04, 0x31, 0xc2, 0x04, 0x00,
+  0xc0, 0x31, 0xc0, 0x04, 0x00, 0xc0, 0x31, 0xc3, 0x98, 0x99, 0x00, 0xaa, 0x88, 0x31, 0xc0, 0x8e,
+  0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6e, 0xc0, 0x0c, 0xcd, 0x07, 0xc0, 0x0c, 0xc4, 0x11, 0xc0,
+  0x31, 0xd7, 0xfe, 0x10, 0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc1,
+  0x91, 0x99, 0x00, 0xa5, 0x88, 0xfe, 0xde, 0xfb, 0x31, 0x96, 0x99, 0xfe, 0x08, 0x41, 0xa4, 0x88,
+  0x31, 0xd5, 0xfe, 0x12, 0xcf, 0x66, 0x1d, 0xca, 0x6e, 0x6b, 0xc0, 0x22, 0xc0, 0x1d, 0xc1, 0x22,
+  0xc0, 0x29, 0xc1, 0x31, 0xd5, 0x84, 0x88, 0x00, 0xfe, 0x9c, 0xd3, 0x31, 0xc7, 0x99, 0x99, 0x3c,
+  0xc0, 0xa5, 0x99, 0xa6, 0x88, 0xa5, 0x88, 0xa7, 0x88, 0x87, 0x99, 0x00, 0xb5, 0x99, 0x31, 0xd4,
+  0xfe, 0x12, 0xf1, 0xc0, 0x29, 0x30, 0x29, 0x30, 0xc1, 0x6d, 0xc0, 0x29, 0x30, 0xc4, 0x29, 0xc0,
+  0x30, 0x6e, 0x30, 0xc6, 0x35, 0xc0, 0x30, 0xb3, 0x1c, 0xca, 0x6e, 0x6b, 0x05, 0xc1, 0x0c, 0xc8,
+  0x6e, 0xc4, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc2, 0xfe, 0x42,
+  0x28, 0x00, 0xfe, 0xad, 0x75, 0x31, 0x9c, 0x88, 0x00, 0xc0, 0x31, 0xc1, 0x92, 0x99, 0x00, 0xc0,
+  0x29, 0x2f, 0x96, 0x88, 0x00, 0xc0, 0x2f, 0x31, 0x9b, 0x99, 0x00, 0xaa, 0x88, 0x31, 0xc4, 0x24,
+  0x00, 0x04, 0x31, 0x04, 0x00, 0xc0, 0x31, 0xc3, 0x0b, 0x00, 0xbb, 0x88, 0x31, 0xc0, 0x8e, 0x99,
+  0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6e, 0xc0, 0x0c, 0xc7, 0x07, 0xc0, 0x0c, 0xc1, 0x07, 0x0c, 0xc6,
+  0x11, 0xc0, 0x31, 0xd7, 0xfe, 0x10, 0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0, 0x88,
+  0x31, 0xc1, 0x95, 0x99, 0x00, 0xbf, 0x88, 0xfe, 0xff, 0xff, 0xc1, 0xfe, 0x52, 0x8a, 0x00, 0xfe,
+  0xb5, 0x76, 0x95, 0x88, 0x9d, 0x88, 0xac, 0x99, 0x31, 0xd1, 0xfe, 0x12, 0xcf, 0xcc, 0x6e, 0xc2,
+  0x1d, 0xc2, 0x22, 0xc0, 0x67, 0x6e, 0xc0, 0x31, 0xd5, 0xfe, 0x52, 0xaa, 0x8b, 0x99, 0xfe, 0xd6,
+  0x9a, 0x31, 0xcd, 0x04, 0x28, 0x51, 0xfe, 0xe7, 0x1c, 0x31, 0xd4, 0xfe, 0x12, 0xf1, 0xc0, 0x29,
+  0xc0, 0x30, 0xc0, 0x6e, 0x30, 0x35, 0xc1, 0x30, 0xc0, 0x29, 0x30, 0xc1, 0x29, 0xc0, 0x30, 0xc8,
+  0x35, 0xc1, 0xb3, 0x1c, 0xcb, 0x6e, 0x6b, 0xc2, 0x05, 0xc0, 0x0c, 0xc5, 0x6e, 0xc4, 0xfe, 0xff,
+  0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc1, 0x88, 0x99, 0x00, 0xb1, 0x88, 0x31,
+  0xc0, 0x9b, 0x99, 0x00, 0xc0, 0x31, 0xc2, 0x8c, 0x88, 0x00, 0xc3, 0x29, 0x31, 0xc0, 0x9c, 0x88,
+  0x00, 0xc0, 0x31, 0xc4, 0x00, 0xc0, 0x04, 0x31, 0x04, 0x00, 0xa9, 0x99, 0xfe, 0xce, 0x59, 0x66,
+  0xc1, 0x0b, 0x00, 0xc0, 0xfe, 0xbd, 0xd7, 0x31, 0xc0, 0x8e, 0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12,
+  0x6e, 0xc2, 0x6e, 0xc2, 0x07, 0x0c, 0xc1, 0x07, 0x0c, 0xca, 0x11, 0xc0, 0x31, 0xd7, 0xfe, 0x10,
+  0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc2, 0x99, 0x99, 0x31, 0xc2,
+  0xfe, 0x73, 0x8e, 0x00, 0xc3, 0xae, 0x88, 0xfe, 0xf7, 0xbe, 0x31, 0xcf, 0xfe, 0x12, 0xcf, 0xcd,
+  0x6e, 0xc1, 0x1d, 0xc2, 0x22, 0xc0, 0x67, 0xc1, 0x31, 0xd5, 0xfe, 0x18, 0xe3, 0x9b, 0x99, 0xfe,
+  0xde, 0xdb, 0x9d, 0x88, 0x9b, 0x99, 0x9c, 0x88, 0x9b, 0x99, 0x9c, 0x88, 0x9c, 0x77, 0x9b, 0x99,
+  0x51, 0xb2, 0x88, 0x31, 0xc4, 0xfe, 0x6b, 0x2d, 0x00, 0xfe, 0x84, 0x10, 0x31, 0xd5, 0xfe, 0x12,
+  0xf1, 0xc0, 0x69, 0xc1, 0x6f, 0xc0, 0x30, 0x29, 0x30, 0xd1, 0x35, 0xc2, 0xb4, 0x0b, 0xc0, 0x66,
+  0xc4, 0x05, 0x00, 0xc3, 0x05, 0x6b, 0x05, 0xc0, 0x0c, 0xc6, 0x6e, 0xc4, 0x6b, 0xfe, 0xff, 0xff,
+  0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc0, 0x98, 0x99, 0x00, 0xc0, 0xfe, 0xd6, 0x9a,
+  0x31, 0xc0, 0x9b, 0x99, 0x00, 0xc0, 0x31, 0xc2, 0x80, 0x99, 0x00, 0xc0, 0xaa, 0x88, 0x00, 0xc0,
+  0xb1, 0x88, 0x2b, 0x31, 0x04, 0x00, 0x24, 0x31, 0xc4, 0x24, 0x00, 0x04, 0x31, 0x9c, 0x88, 0x00,
+  0xc6, 0xbb, 0x88, 0x31, 0xc1, 0x8e, 0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6e, 0xc2, 0x0c, 0x07,
+  0x0c, 0xc0, 0x07, 0xc0, 0x0c, 0xc0, 0x07, 0x0c, 0xca, 0x11, 0x0c, 0x31, 0xd2, 0x96, 0x88, 0x93,
+  0x99, 0xa9, 0x99, 0x31, 0xc0, 0xfe, 0x10, 0x82, 0xa4, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0,
+  0x88, 0x31, 0xc7, 0xfe, 0x73, 0x8e, 0x00, 0xa3, 0x88, 0xfe, 0xad, 0x35, 0xaa, 0x77, 0x80, 0x99,
+  0x00, 0xbd, 0x99, 0x31, 0xcf, 0xfe, 0x12, 0xcf, 0xce, 0x6e, 0xc0, 0x1d, 0xc2, 0x22, 0xc0, 0x6b,
+  0x66, 0xc0, 0x31, 0xd5, 0xfe, 0x08, 0x21, 0x00, 0xc9, 0xba, 0x88, 0x31, 0xc2, 0x39, 0x00, 0x10,
+  0xfe, 0xff, 0xdf, 0x31, 0xd5, 0xfe, 0x12, 0xf1, 0xc0, 0x29, 0xc2, 0x6f, 0x29, 0xc0, 0x30, 0xc0,
+  0x29, 0xc5, 0x30, 0xc7, 0x35, 0x30, 0x35, 0xc1, 0xb4, 0x0b, 0x66, 0xca, 0x05, 0xc0, 0x6b, 0xc4,
+  0x05, 0x0c, 0xc2, 0x6e, 0xc3, 0x6b, 0x11, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc6,
+  0x38, 0x31, 0xc0, 0xfe, 0x5a, 0xcb, 0x00, 0xbb, 0x88, 0xfe, 0xff, 0xbf, 0xc1, 0x40, 0x00, 0xc0,
+  0x27, 0x31, 0xc0, 0x88, 0x99, 0x00, 0xb1, 0x88, 0xfe, 0xe6, 0xfc, 0x31, 0x27, 0x0b, 0x00, 0xaa,
+  0x88, 0x27, 0x31, 0x00, 0xc0, 0xfe, 0xef, 0x5d, 0x31, 0xc2, 0x04, 0x00, 0xc0, 0x31, 0xc0, 0x04,
+  0x00, 0xc4, 0x1c, 0xb5, 0x88, 0x31, 0xc2, 0x8e, 0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6e, 0xc1,
+  0x69, 0x07, 0xc0, 0x00, 0x07, 0xc1, 0x00, 0x05, 0x0c, 0xc0, 0x07, 0x0c, 0xc0, 0x07, 0xc0, 0x0c,
+  0xc6, 0x31, 0xd1, 0xfe, 0x6b, 0x2d, 0x87, 0x88, 0xc1, 0xae, 0x88, 0x09, 0xfe, 0x10, 0x82, 0xa4,
+  0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc7, 0xfe, 0x73, 0x8e, 0x00, 0xfe, 0x8c,
+  0x51, 0x31, 0xc0, 0x9d, 0x99, 0xfe, 0x10, 0x62, 0x10, 0x31, 0xcf, 0xfe, 0x12, 0xcf, 0x66, 0x1d,
+  0xc1, 0x18, 0x1d, 0xc9, 0x6e, 0xc0, 0x1d, 0xc1, 0x6b, 0x22, 0x6b, 0xc1, 0x31, 0xd5, 0x87, 0x99,
+  0x8f, 0x88, 0xa4, 0x88, 0xa4, 0x99, 0x14, 0x3c, 0xa4, 0x88, 0xa5, 0x88, 0xa4, 0x99, 0x2b, 0x55,
+  0x10, 0x00, 0x04, 0x31, 0xc1, 0x0c, 0x00, 0xfe, 0xb5, 0x96, 0x31, 0xd6, 0x29, 0x6b, 0xc1, 0x29,
+  0xc1, 0x30, 0x29, 0xc6, 0x30, 0xc0, 0x29, 0x30, 0xc8, 0x6e, 0x30, 0xc0, 0xb3, 0x1c, 0x6e, 0x00,
+  0xca, 0x05, 0x6b, 0xc1, 0x05, 0x0c, 0xc3, 0x6e, 0xc6, 0x6e, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00,
+  0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc0, 0x00, 0xc8, 0xbf, 0x99, 0x31, 0xfe, 0x42, 0x28, 0x00, 0xfe,
+  0xad, 0x75, 0x31, 0xc2, 0xfe, 0x29, 0x45, 0x00, 0xfe, 0xbd, 0xd7, 0x31, 0xfe, 0x5a, 0xcb, 0x00,
+  0x0c, 0x31, 0xc2, 0x0c, 0x00, 0x1c, 0x31, 0xc0, 0x9c, 0x88, 0x00, 0xc0, 0x31, 0xc8, 0x8e, 0x99,
+  0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6e, 0xc1, 0x05, 0x07, 0xc4, 0x69, 0xc0, 0x6f, 0x07, 0x0c, 0x07,
+  0x0c, 0x07, 0xc0, 0x0c, 0xc6, 0x31, 0xd0, 0x83, 0x99, 0xfe, 0x00, 0x00, 0x24, 0xbb, 0x99, 0x8d,
+  0x88, 0x00, 0xad, 0x88, 0x96, 0x99, 0xa5, 0x88, 0x31, 0xc1, 0x9d, 0x99, 0x00, 0xb0, 0x88, 0x31,
+  0xc7, 0x8f, 0x99, 0x86, 0x88, 0x18, 0x31, 0xc1, 0x10, 0x9c, 0x88, 0x31, 0xcf, 0xfe, 0x12, 0xcf,
+  0xc2, 0x66, 0xc0, 0x1d, 0xce, 0x6b, 0x6e, 0xc2, 0x31, 0xe0, 0xfe, 0x62, 0xec, 0x00, 0xfe, 0xd6,
+  0x9a, 0x31, 0xc0, 0x89, 0x99, 0x00, 0x34, 0x31, 0xd7, 0x29, 0x6b, 0xc0, 0x29, 0xc2, 0x30, 0x29,
+  0xc1, 0x30, 0x29, 0x30, 0x29, 0xc0, 0x30, 0x29, 0xc0, 0x30, 0xcb, 0xb3, 0x1c, 0xcd, 0x6e, 0x6b,
+  0xc6, 0x6e, 0xc0, 0x0c, 0x11, 0xc3, 0x6e, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc6,
+  0x38, 0x31, 0xc0, 0xfe, 0x42, 0x28, 0x00, 0xc3, 0xaa, 0x88, 0x00, 0xc1, 0xbf, 0x99, 0x31, 0x25,
+  0x00, 0xfe, 0xa4, 0xf4, 0x31, 0xc1, 0x62, 0x00, 0xc0, 0xfe, 0xbd, 0xd7, 0x31, 0x8c, 0x88, 0x00,
+  0x25, 0x27, 0x31, 0xc0, 0x27, 0x25, 0x00, 0x29, 0x31, 0xc0, 0x9b, 0x99, 0x00, 0xc0, 0x31, 0xc8,
+  0x8e, 0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6e, 0xc1, 0x6e, 0x07, 0xc2, 0x69, 0xc0, 0x07, 0xc0,
+  0x0c, 0x07, 0xc4, 0x00, 0x0c, 0xc0, 0x11, 0x0c, 0xc2, 0x31, 0xd0, 0xfe, 0x18, 0xe3, 0x9c, 0x88,
+  0xfe, 0xef, 0x7d, 0x31, 0xc0, 0xfe, 0x52, 0x6a, 0x8d, 0x88, 0xc0, 0xa8, 0x88, 0x31, 0xc2, 0x01,
+  0xb2, 0x99, 0x31, 0xcd, 0xfe, 0x31, 0x66, 0x19, 0x31, 0xcf, 0xfe, 0x12, 0xcf, 0xc0, 0x66, 0x1d,
+  0xd2, 0x6b, 0x6e, 0xc1, 0x31, 0xe0, 0xfe, 0x31, 0x86, 0x95, 0x88, 0xfe, 0xf7, 0x9e, 0x31, 0x18,
+  0xfe, 0x18, 0xc3, 0x9b, 0x99, 0xfe, 0xde, 0xdb, 0x31, 0xd7, 0xfe, 0x12, 0xf1, 0xc0, 0x29, 0xca,
+  0x30, 0x29, 0x30, 0x29, 0xc2, 0x30, 0xc3, 0x29, 0xc1, 0x30, 0xc1, 0xb3, 0x1c, 0xcd, 0x6e, 0x6b,
+  0xc7, 0x6e, 0xc5, 0x6e, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc6,
+  0x9c, 0x88, 0x00, 0xc0, 0x31, 0xc1, 0x88, 0x99, 0x00, 0xc0, 0xfe, 0xad, 0x75, 0xaf, 0x99, 0x9a,
+  0x88, 0x87, 0x88, 0x00, 0xaa, 0x88, 0xfe, 0xff, 0xbf, 0x31, 0x27, 0xfe, 0x42, 0x08, 0x00, 0xb6,
+  0x88, 0xb8, 0x88, 0xc0, 0x1c, 0x00, 0x20, 0x27, 0x31, 0xc0, 0x04, 0x00, 0xc0, 0x31, 0xc8, 0x8e,
+  0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6e, 0xc1, 0x6e, 0x07, 0xc2, 0x69, 0xc0, 0x07, 0xc8, 0x05,
+  0x0c, 0xc2, 0x11, 0x0c, 0x31, 0xd0, 0xfe, 0x00, 0x00, 0xad, 0x88, 0x31, 0xc1, 0x9a, 0x88, 0xfe,
+  0x08, 0x61, 0x00, 0xa8, 0x88, 0x31, 0xd3, 0xfe, 0x31, 0x86, 0x00, 0x31, 0xcf, 0xfe, 0x12, 0xcf,
+  0xd6, 0x6b, 0x6e, 0xc0, 0x31, 0xdf, 0x9d, 0x99, 0x00, 0x38, 0x31, 0xc0, 0xfe, 0x73, 0xae, 0x00,
+  0xbd, 0x99, 0x31, 0xd8, 0x29, 0xce, 0x6b, 0xc0, 0x29, 0xc1, 0x30, 0xc1, 0x29, 0xc3, 0x30, 0xc1,
+  0xb3, 0x1c, 0xc0, 0x6e, 0x00, 0xca, 0x05, 0x6b, 0xc0, 0x05, 0x0c, 0x05, 0x0c, 0xc3, 0x6e, 0xc4,
+  0x6e, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xc6, 0x9b, 0x99, 0x00,
+  0xc0, 0x31, 0xc1, 0x62, 0xfe, 0x5a, 0xcb, 0x00, 0xc4, 0xfe, 0xce, 0x39, 0x31, 0xc1, 0x96, 0x88,
+  0xfe, 0x29, 0x45, 0x00, 0xc2, 0x24, 0xfe, 0xe6, 0xfc, 0x31, 0xc1, 0x04, 0x00, 0xc0, 0x31, 0xc8,
+  0x8e, 0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6d, 0x6b, 0xc0, 0x0c, 0x07, 0xc0, 0x00, 0xc0, 0x07,
+  0xc2, 0x00, 0xc1, 0x07, 0xc3, 0x05, 0x0c, 0xc1, 0x11, 0xc1, 0x31, 0xd0, 0xfe, 0x20, 0xe4, 0x9b,
+  0x88, 0xfe, 0xe7, 0x1c, 0x31, 0xc1, 0x84, 0x88, 0xfe, 0x00, 0x00, 0xa8, 0x88, 0x31, 0xd3, 0xfe,
+  0x31, 0x86, 0x00, 0x31, 0xcf, 0xfe, 0x12, 0xcf, 0xcc, 0x6e, 0x1d, 0xc7, 0x6b, 0x1d, 0x6f, 0x31,
+  0xdf, 0x8f, 0x99, 0x00, 0xbb, 0x99, 0x31, 0x97, 0x99, 0xfe, 0x08, 0x21, 0xa5, 0x88, 0xfe, 0xf7,
+  0x9e, 0x31, 0xd8, 0x29, 0x6b, 0x29, 0xc9, 0x24, 0x29, 0x30, 0xc2, 0x29, 0x24, 0x30, 0xc2, 0x29,
+  0xc1, 0x30, 0xc0, 0x29, 0xc0, 0xb3, 0x1c, 0xc2, 0x66, 0xc0, 0x00, 0xc8, 0x6f, 0xc0, 0x69, 0x0c,
+  0x05, 0x0c, 0xc1, 0x6e, 0x0c, 0x11, 0xc3, 0x6e, 0x11, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00,
+  0xfe, 0xc6, 0x38, 0x31, 0xc6, 0x98, 0x99, 0x00, 0xb0, 0x88, 0x31, 0xc3, 0x8c, 0x88, 0x8b, 0x99,
+  0x00, 0xb1, 0x88, 0xae, 0x99, 0x2b, 0x31, 0xc3, 0x9b, 0x99, 0x3b, 0x25, 0xc0, 0x3b, 0x04, 0x31,
+  0xc2, 0x2b, 0x00, 0x25, 0x31, 0xc8, 0x8e, 0x99, 0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6d, 0x6b, 0xc2,
+  0x00, 0xc1, 0x07, 0xc1, 0x00, 0x05, 0x0c, 0x00, 0x07, 0xc1, 0x00, 0x07, 0x05, 0x0c, 0xc2, 0x11,
+  0xc0, 0x31, 0xd0, 0x86, 0x99, 0xfe, 0x00, 0x00, 0xb7, 0x88, 0x31, 0xc2, 0xfe, 0x41, 0xe8, 0xa5,
+  0x88, 0x31, 0xd3, 0x20, 0x00, 0x31, 0xcf, 0xfe, 0x12, 0xaf, 0xc1, 0x6e, 0xd6, 0x31, 0xdf, 0xfe,
+  0x7b, 0xcf, 0x00, 0xfe, 0xad, 0x55, 0x31, 0xfe, 0x4a, 0x29, 0x00, 0xfe, 0xa5, 0x14, 0x31, 0xd9,
+  0xfe, 0x12, 0xf0, 0x6b, 0x29, 0xcb, 0x30, 0xc2, 0x29, 0xc0, 0x67, 0xc0, 0x30, 0x29, 0xc4, 0x30,
+  0x29, 0xb3, 0x1c, 0xc1, 0x66, 0xc0, 0x69, 0x00, 0xc5, 0x6e, 0x00, 0xc0, 0x6f, 0xc2, 0x05, 0x0c,
+  0xc2, 0x6e, 0xc6, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0xf0, 0x8e,
+  0x88, 0x00, 0x31, 0xc5, 0xfe, 0x12, 0x6d, 0xc0, 0x6b, 0x05, 0x07, 0x00, 0xc2, 0x07, 0xc1, 0x00,
+  0x05, 0x07, 0xc2, 0x05, 0xc1, 0x0c, 0x05, 0x0c, 0xc2, 0x31, 0xd1, 0xfe, 0x29, 0x25, 0x97, 0x88,
+  0xfe, 0xce, 0x79, 0x31, 0xd8, 0xfe, 0x39, 0xc7, 0x00, 0x31, 0xcf, 0xfe, 0x12, 0xaf, 0x6e, 0xd8,
+  0x31, 0xdf, 0xfe, 0x41, 0xe8, 0x00, 0xfe, 0xef, 0x3d, 0x93, 0x88, 0x00, 0x0c, 0x31, 0xda, 0xfe,
+  0x12, 0xf0, 0xce, 0x6b, 0x29, 0xc0, 0x30, 0xc0, 0x29, 0xc1, 0x67, 0x30, 0x29, 0x30, 0x29, 0xc0,
+  0x30, 0xc0, 0xb3, 0x1c, 0xc1, 0x66, 0xc1, 0x00, 0xc5, 0x6e, 0x00, 0x05, 0x6b, 0x05, 0xc2, 0x0c,
+  0xc4, 0x6e, 0xc4, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x00, 0x00, 0xfe, 0xc5, 0xf8, 0x31, 0xf0, 0x8e,
+  0x99, 0xfe, 0x08, 0x21, 0x31, 0xc5, 0xfe, 0x12, 0x6d, 0xc1, 0x05, 0x00, 0xc5, 0x6b, 0xc0, 0x0c,
+  0x07, 0xc0, 0x00, 0xc0, 0x0c, 0xc2, 0x05, 0x0c, 0xc2, 0x31, 0xd1, 0x8d, 0x99, 0xfe, 0x00, 0x00,
+  0xae, 0x88, 0x31, 0xd8, 0xfe, 0x31, 0x86, 0x00, 0x31, 0xcf, 0xfe, 0x12, 0xcf, 0x66, 0x1d, 0x18,
+  0x1d, 0xd5, 0x31, 0xde, 0x66, 0xfe, 0x08, 0x41, 0xa6, 0x88, 0x2c, 0x10, 0x99, 0x88, 0xfe, 0xd6,
+  0x7a, 0x31, 0xda, 0xfe, 0x12, 0xf0, 0xca, 0x66, 0xc0, 0x29, 0xc5, 0x24, 0x29, 0xc0, 0x6b, 0xc3,
+  0x29, 0x30, 0x29, 0xb3, 0x1c, 0xc1, 0x66, 0xc0, 0x00, 0xc0, 0x3b, 0x00, 0xc5, 0x6e, 0x6b, 0x00,
+  0xc0, 0x05, 0x0c, 0xc0, 0x6e, 0x0c, 0x11, 0x0c, 0x11, 0xc5, 0xfe, 0xff, 0xff, 0xc4, 0xfe, 0x21,
+  0x04, 0xbb, 0x99, 0x31, 0xf0, 0x83, 0x99, 0x88, 0x88, 0x31, 0xc5, 0x00, 0xca, 0x6b, 0xc0, 0x00,
+  0xc1, 0x05, 0x0c, 0xc2, 0x05, 0x0c, 0xc2, 0x31, 0xd2, 0xfe, 0x4a, 0x49, 0x8e, 0x88, 0xfe, 0x9c,
+  0xd3, 0x31, 0xd7, 0xfe, 0x10, 0xa2, 0x7f, 0x31, 0xcf, 0xfe, 0x12, 0xaf, 0xc1, 0x6e, 0x18, 0x1d,
+  0x18, 0x1d, 0xc6, 0x6e, 0x1d, 0xc9, 0x31, 0xde, 0x92, 0x88, 0x00, 0xb8, 0x88, 0xa8, 0x88, 0x80,
+  0x88, 0xb9, 0x99, 0x31, 0xdb, 0xfe, 0x12, 0xf0, 0xcf, 0x6b, 0xc0, 0x29, 0xc2, 0x66, 0xc1, 0x6b,
+  0x30, 0xc0, 0x29, 0xc1, 0xb3, 0x1c, 0xc1, 0x66, 0xc1, 0x00, 0xca, 0x6e, 0x6b, 0xc1, 0x6e, 0x0c,
+  0xc1, 0x11, 0xc5, 0xfe, 0xff, 0xff, 0xc4, 0x80, 0x88, 0x87, 0x99, 0xfe, 0xef, 0x5d, 0xa5, 0x88,
+  0xee, 0x9a, 0x88, 0x3c, 0xba, 0x88, 0x31, 0xc5, 0xfe, 0x12, 0x6d, 0xc4, 0x6b, 0x00, 0xc3, 0x0c,
+  0x07, 0xc0, 0x00, 0xc1, 0x05, 0xc1, 0x0c, 0xc0, 0x07, 0xc0, 0x0c, 0xc0, 0x31, 0xd2, 0x97, 0x99,
+  0xfe, 0x08, 0x61, 0x7f, 0xfe, 0xad, 0x35, 0xa7, 0x88, 0xd4, 0x66, 0x98, 0x77, 0xfe, 0x00, 0x00,
+  0xb4, 0x88, 0x31, 0xcf, 0xfe, 0x12, 0xaf, 0xc1, 0x6e, 0x18, 0x1d, 0xc8, 0x6e, 0x1d, 0xc9, 0x31,
+  0xde, 0x83, 0x99, 0x00, 0xbf, 0x99, 0x83, 0x88, 0x28, 0xfe, 0xef, 0x7d, 0x31, 0xdb, 0xfe, 0x12,
+  0xd0, 0x6e, 0xd4, 0x24, 0xc2, 0x6f, 0x29, 0xc1, 0x30, 0xb3, 0x1c, 0xc1, 0x66, 0xc0, 0x00, 0xc7,
+  0x6e, 0x00, 0xc2, 0x05, 0x6b, 0xc3, 0x6e, 0xc6, 0xfe, 0xff, 0xff, 0xc4, 0x62, 0xfe, 0x39, 0xc7,
+  0x98, 0x88, 0xbc, 0x88, 0xab, 0x99, 0xa2, 0x77, 0xc0, 0x7b, 0x11, 0xe7, 0x07, 0x14, 0x3c, 0x0c,
+  0x27, 0x31, 0xc5, 0x00, 0xc4, 0x6b, 0x00, 0xc2, 0x07, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0xc0, 0x07,
+  0xc0, 0x05, 0x6b, 0xc1, 0x07, 0x0c, 0xc0, 0x31, 0xd3, 0x89, 0x99, 0xfe, 0x00, 0x20, 0x66, 0xd8,
+  0x1b, 0x31, 0xcf, 0xfe, 0x12, 0xaf, 0xc1, 0x6e, 0xd6, 0x31, 0xde, 0xfe, 0x4a, 0x49, 0x00, 0xab,
+  0x88, 0x00, 0xfe, 0x94, 0xb2, 0x31, 0xdc, 0xfe, 0x12, 0xf0, 0xd6, 0x66, 0xc1, 0x29, 0xc3, 0xb3,
+  0x1c, 0xc1, 0x66, 0xc0, 0x00, 0xca, 0x6f, 0x69, 0xc0, 0x0c, 0xc2, 0x6e, 0xc7, 0xfe, 0xff, 0xff,
+  0xc5, 0x51, 0x82, 0x99, 0x8a, 0x77, 0x98, 0x88, 0x66, 0xea, 0x7f, 0x15, 0xb7, 0x99, 0xbe, 0x88,
+  0x31, 0xc6, 0xfe, 0x12, 0x6d, 0xc3, 0x6b, 0xc0, 0x00, 0x07, 0x00, 0xc0, 0x07, 0xc0, 0x00, 0x07,
+  0x00, 0xc1, 0x07, 0xc0, 0x0c, 0xc5, 0x31, 0xd4, 0x96, 0x88, 0x8d, 0x99, 0x51, 0xd6, 0xac, 0x88,
+  0x31, 0xd0, 0xfe, 0x12, 0xaf, 0xc2, 0x6e, 0xd5, 0x31, 0xde, 0xfe, 0x10, 0x82, 0x9c, 0x88, 0xc0,
+  0xab, 0x99, 0x31, 0xdd, 0xfe, 0x12, 0xd0, 0xc0, 0x6e, 0xc6, 0x6e, 0x29, 0xcc, 0x24, 0xc0, 0x29,
+  0x24, 0xc0, 0x29, 0xc0, 0xb3, 0x1c, 0xc0, 0x66, 0xc1, 0x00, 0xc2, 0x3b, 0xa2, 0x77, 0xc0, 0x00,
+  0xc3, 0x05, 0x00, 0x6f, 0xc3, 0x6e, 0xc7, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x00, 0xc4, 0x6b, 0xc0,
+  0x00, 0xc2, 0x07, 0x00, 0x07, 0x00, 0xc0, 0x07, 0xc2, 0x0c, 0xc4, 0x31, 0xd5, 0xfe, 0x7b, 0xaf,
+  0x93, 0x88, 0xd5, 0xa5, 0x88, 0xfe, 0xf7, 0x9e, 0x31, 0xd0, 0xfe, 0x12, 0xaf, 0xc2, 0x6e, 0xc0,
+  0x18, 0xc0, 0x1d, 0xd1, 0x31, 0xdd, 0x96, 0x88, 0xfe, 0x00, 0x00, 0xc1, 0xfe, 0xc6, 0x18, 0x31,
+  0xdd, 0xfe, 0x12, 0xd0, 0x6e, 0xcc, 0x24, 0x29, 0xce, 0xb3, 0x1c, 0xc8, 0x6e, 0xc0, 0x00, 0x6f,
+  0x05, 0x00, 0xc0, 0x05, 0xc0, 0x0c, 0xc3, 0x6e, 0xc7, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x00, 0xc4,
+  0x6b, 0xc0, 0x00, 0xc3, 0x07, 0xc0, 0x00, 0xc4, 0x07, 0x00, 0x0c, 0xc2, 0x31, 0xd5, 0xfe, 0x29,
+  0x65, 0x95, 0x99, 0xd5, 0xa2, 0x88, 0xfe, 0xe7, 0x1c, 0x31, 0xd0, 0xfe, 0x12, 0xaf, 0xc5, 0x6e,
+  0xc1, 0x18, 0x1d, 0xce, 0x31, 0xdd, 0x86, 0x88, 0x00, 0xc0, 0xb6, 0x88, 0x31, 0xde, 0xfe, 0x12,
+  0xf0, 0xcd, 0x66, 0x29, 0xc2, 0x6b, 0xc0, 0x29, 0xc0, 0x24, 0x29, 0xc1, 0x24, 0xc0, 0x29, 0xc0,
+  0xb3, 0x1c, 0xcb, 0x6f, 0x69, 0xc2, 0x0c, 0xc2, 0x6e, 0xc9, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x00,
+  0xc9, 0x05, 0x00, 0xc9, 0x0c, 0xc2, 0x31, 0xfd, 0xc3, 0xfe, 0x12, 0xaf, 0xc4, 0x6e, 0xc1, 0x18,
+  0x1d, 0xc6, 0x18, 0xc3, 0x1d, 0xc2, 0x31, 0xdd, 0xfe, 0x63, 0x2c, 0x87, 0x99, 0xa2, 0x88, 0xfe,
+  0xe7, 0x3c, 0x31, 0xde, 0xfe, 0x12, 0xd0, 0x6e, 0xcc, 0x24, 0x29, 0xc3, 0x6b, 0x29, 0xc0, 0x24,
+  0x29, 0xc0, 0x24, 0xc1, 0x29, 0xc0, 0xb3, 0x1c, 0xc6, 0x66, 0x00, 0xc0, 0x6e, 0xc0, 0x00, 0xc0,
+  0x05, 0x00, 0x05, 0x6b, 0xc2, 0x6e, 0x0c, 0x11, 0x0c, 0x11, 0xc5, 0xfe, 0xff, 0xff, 0xfd, 0xc3,
+  0x00, 0xd5, 0x6b, 0x00, 0x0c, 0xc0, 0x31, 0xfd, 0xc3, 0xfe, 0x12, 0xaf, 0xc1, 0x6e, 0x18, 0xc4,
+  0x1d, 0xc6, 0x18, 0xc3, 0x1d, 0xc2, 0x31, 0xdd, 0x8b, 0x99, 0xfe, 0x08, 0x41, 0xfe, 0x94, 0x92,
+  0x31, 0xdf, 0xfe, 0x12, 0xd0, 0xc0, 0x6e, 0xcb, 0x24, 0x29, 0xc0, 0x24, 0xc0, 0x6b, 0x29, 0xc1,
+  0x24, 0x29, 0xc1, 0x24, 0xc0, 0x29, 0xc0, 0xb3, 0x1c, 0xc9, 0x6e, 0xc0, 0x00, 0xc2, 0x6f, 0xc7,
+  0x6e, 0xc5, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x00, 0xd1, 0x05, 0x00, 0xc1, 0x6b, 0x00, 0x0c, 0x07,
+  0x31, 0xfd, 0xc3, 0x11, 0xc0, 0x6b, 0xc6, 0x6e, 0xc2, 0x18, 0x1d, 0x18, 0xc2, 0x1d, 0x18, 0x1d,
+  0x18, 0x1d, 0x18, 0x1d, 0x31, 0xfd, 0xc3, 0xfe, 0x12, 0xf0, 0x66, 0x29, 0x24, 0x29, 0xc1, 0x24,
+  0x29, 0xc4, 0x24, 0xc1, 0x29, 0x24, 0xc1, 0x29, 0xc5, 0x24, 0xc0, 0x29, 0xc0, 0xb3, 0x1c, 0xca,
+  0x6e, 0x00, 0xc1, 0x05, 0x6b, 0xc7, 0x6e, 0xc5, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x00, 0xd7, 0x6b,
+  0xc0, 0x31, 0xfd, 0xc3, 0x11, 0xc0, 0x6b, 0xc8, 0x6e, 0xc2, 0x18, 0xc6, 0x1d, 0xc1, 0x31, 0xfd,
+  0xc3, 0xfe, 0x12, 0xd0, 0xc0, 0x6e, 0xc1, 0x24, 0x29, 0xc8, 0x24, 0x29, 0xc0, 0x24, 0xc0, 0x29,
+  0xc4, 0x24, 0x29, 0xc2, 0xb3, 0x1c, 0xca, 0x6e, 0xc1, 0x6b, 0xc1, 0x05, 0x0c, 0xc6, 0x6e, 0xc4,
+  0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x00, 0xd7, 0x6b, 0xc0, 0x31, 0xfd, 0xc3, 0x11, 0xc0, 0x6b, 0xc5,
+  0x6e, 0xc3, 0x18, 0xc0, 0x1d, 0x18, 0xc5, 0x1d, 0xc1, 0x31, 0xfd, 0xc3, 0xfe, 0x12, 0xf0, 0xc8,
+  0x66, 0xc0, 0x29, 0xc2, 0x24, 0xc0, 0x29, 0xcc, 0xb3, 0x1c, 0xca, 0x6e, 0xc2, 0x6b, 0xc9, 0x6e,
+  0xc4, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x00, 0xd8, 0x6b, 0x31, 0xfd, 0xc3, 0x11, 0x0c, 0xc0, 0x6f,
+  0xc6, 0x6e, 0x18, 0xc2, 0x1d, 0xc0, 0x18, 0xc5, 0x1d, 0xc0, 0x31, 0xfd, 0xc3, 0xfe, 0x12, 0xf0,
+  0xc0, 0x66, 0xc0, 0x29, 0xc2, 0x24, 0xc0, 0x29, 0xc4, 0x24, 0xc0, 0x29, 0x24, 0x29, 0xc2, 0x24,
+  0x29, 0xc5, 0xb3, 0x1c, 0xc7, 0x6e, 0xc0, 0x00, 0xc0, 0x05, 0xc1, 0x6b, 0xca, 0x6e, 0xc3, 0xfe,
+  0xff, 0xff, 0xfd, 0xc3, 0x00, 0xd8, 0x6b, 0x31, 0xfd, 0xc3, 0x11, 0xc0, 0x67, 0xc1, 0x6e, 0xc9,
+  0x6e, 0x18, 0xc7, 0x1d, 0x31, 0xfd, 0xc3, 0xfe, 0x12, 0xf0, 0xc0, 0x66, 0x29, 0xc3, 0x24, 0x29,
+  0xc6, 0x24, 0x29, 0x24, 0x29, 0xc2, 0x24, 0x29, 0xc5, 0xb3, 0x1c, 0xc7, 0x6e, 0x00, 0xc0, 0x6f,
+  0xc2, 0x05, 0x0c, 0xc4, 0x6e, 0x0c, 0xc4, 0x11, 0xc1, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x00, 0xc5,
+  0x05, 0x00, 0xc4, 0x66, 0x00, 0xc9, 0x6b, 0x31, 0xfd, 0xc3, 0x0c, 0xc0, 0x6b, 0x0c, 0x13, 0x6e,
+  0x0c, 0x18, 0xcd, 0x6e, 0x18, 0xc1, 0x1d, 0x31, 0xfd, 0xc3, 0xfe, 0x12, 0xf0, 0xc5, 0x66, 0xc0,
+  0x29, 0xc1, 0x24, 0x29, 0xc0, 0x24, 0x29, 0xce, 0xb3, 0x1c, 0xca, 0x6f, 0xc0, 0x69, 0x0c, 0x05,
+  0x0c, 0xc9, 0x6e, 0xc3, 0xfe, 0xff, 0xff, 0xfd, 0xc3, 0x00, 0xd9, 0x31, 0xfd, 0xc3, 0x0c, 0x11,
+  0x67, 0xc0, 0x6e, 0x13, 0xc0, 0x18, 0xcd, 0x6e, 0xc0, 0x18, 0xc0, 0x1d, 0x31, 0xfd, 0xc3, 0xfe,
+  0x12, 0xf0, 0xc9, 0x66, 0xc3, 0x29, 0xc3, 0x24, 0x29, 0x24, 0x29, 0xc6, 0xb2, 0x1c, 0x6e, 0xc9,
+  0x6e, 0xc6, 0x6b, 0xc6, 0x6e, 0xc3, 0xfe, 0xff, 0xff, 0xca, 0x80, 0x99, 0x81, 0x88, 0xfe, 0xad,
+  0x75, 0x31, 0xc0, 0x8f, 0x99, 0xfe, 0x29, 0x45, 0x00, 0xbb, 0x88, 0xfe, 0xf7, 0xbe, 0x31, 0xc0,
+  0x95, 0x99, 0x82, 0x88, 0x00, 0x1c, 0x08, 0x31, 0xc7, 0x62, 0x3b, 0x00, 0xb1, 0x88, 0xfe, 0xce,
+  0x39, 0x31, 0x27, 0x3b, 0x24, 0x00, 0x3b, 0x27, 0x31, 0x27, 0x86, 0x88, 0x24, 0xc0, 0x23, 0x27,
+  0x31, 0xc8, 0xfe, 0x12, 0x4d, 0x6e, 0x3b, 0xc0, 0x00, 0xd5, 0x31, 0xca, 0x09, 0x85, 0x99, 0xc4,
+  0xfe, 0xd6, 0xba, 0x31, 0x08, 0x1c, 0x00, 0x24, 0xbd, 0x99, 0x27, 0x31, 0xc0, 0x00, 0x29, 0x31,
+  0xc1, 0x29, 0x00, 0x31, 0xc1, 0x0d, 0x1c, 0x00, 0x24, 0x0b, 0x27, 0x31, 0xc0, 0x00, 0xfe, 0xad,
+  0x55, 0x31, 0xc1, 0x24, 0x00, 0x31, 0xcb, 0xfe, 0x12, 0xaf, 0x11, 0x66, 0x6b, 0x11, 0x13, 0x0c,
+  0x13, 0xc0, 0x18, 0xc8, 0x6e, 0x18, 0x11, 0x18, 0xc1, 0x1d, 0x18, 0x31, 0xcb, 0x98, 0x99, 0x25,
+  0x00, 0x09, 0x27, 0x2b, 0x00, 0xfe, 0xbd, 0xd7, 0x31, 0xc2, 0x1c, 0xc0, 0x31, 0x2b, 0xfe, 0x42,
+  0x08, 0x00, 0x09, 0x27, 0x31, 0xc2, 0x29, 0x00, 0xc1, 0x25, 0x23, 0x27, 0x31, 0xc1, 0x27, 0x23,
+  0x87, 0x88, 0x00, 0x09, 0x08, 0x31, 0xcc, 0xfe, 0x12, 0xf0, 0xc1, 0x66, 0x29, 0x24, 0xc0, 0x29,
+  0xc0, 0x24, 0xc6, 0x29, 0xc0, 0x24, 0xc5, 0x29, 0xc4, 0xb3, 0x1c, 0xca, 0x6e, 0xc2, 0x6b, 0xc5,
+  0x05, 0x0c, 0x6e, 0x0c, 0xc1, 0x11, 0xc2, 0xfe, 0xff, 0xff, 0xc9, 0x92, 0x99, 0xfe, 0x00, 0x00,
+  0xc0, 0xfe, 0xad, 0x75, 0x31, 0x95, 0x99, 0x00, 0xfe, 0x94, 0x72, 0xab, 0x88, 0x83, 0x88, 0xa5,
+  0x99, 0x31, 0x98, 0x99, 0x00, 0x1c, 0xb1, 0x99, 0x1c, 0x00, 0x2b, 0x31, 0xc6, 0x23, 0x87, 0x88,
+  0x0b, 0x94, 0x77, 0x00, 0xfe, 0xff, 0xbf, 0x23, 0x24, 0x0b, 0x59, 0x24, 0xb5, 0x99, 0x31, 0x3b,
+  0x00, 0x23, 0xc0, 0x00, 0x3b, 0x31, 0xc8, 0xfe, 0x12, 0x4d, 0xc0, 0x6e, 0x3b, 0xc0, 0x00, 0xd4,
+  0x31, 0xca, 0x2f, 0x29, 0xc0, 0xfe, 0x00, 0x00, 0x09, 0x29, 0xc0, 0xaf, 0x99, 0x2f, 0x00, 0x25,
+  0x23, 0x09, 0x00, 0x09, 0x27, 0x31, 0x00, 0x29, 0x31, 0xc1, 0x29, 0x00, 0x31, 0xc0, 0x2f, 0x00,
+  0x25, 0x23, 0x98, 0x88, 0x00, 0x13, 0x31, 0xc0, 0x00, 0x29, 0x31, 0xc1, 0x29, 0x00, 0x31, 0xcb,
+  0x11, 0x66, 0xc0, 0x11, 0x0c, 0xc0, 0x6b, 0xc1, 0x11, 0xc0, 0x6b, 0x13, 0xc0, 0x18, 0xca, 0x6e,
+  0x31, 0xca, 0x27, 0x24, 0x1c, 0x0b, 0x82, 0x88, 0xb6, 0x88, 0x31, 0x1c, 0xc0, 0x31, 0xc1, 0x2b,
+  0x00, 0x29, 0x27, 0x24, 0x1c, 0x0b, 0x24, 0x3b, 0x31, 0xc2, 0x29, 0x00, 0x29, 0xc0, 0x3b, 0x00,
+  0x25, 0x27, 0x31, 0x51, 0x1c, 0x00, 0x09, 0x23, 0x25, 0x00, 0x08, 0x31, 0xcb, 0xfe, 0x12, 0xd0,
+  0xc0, 0x6e, 0xc0, 0x24, 0xc2, 0x29, 0x24, 0xc9, 0x29, 0xc1, 0x24, 0xc1, 0x29, 0xc2, 0x24, 0xc0,
+  0xb3, 0x1c, 0xcd, 0x6e, 0xc0, 0x6b, 0xc4, 0x05, 0x6f, 0xc0, 0x0c, 0xc0, 0x11, 0xc3, 0xfe, 0xff,
+  0xff, 0xc8, 0x9b, 0x99, 0xfe, 0x29, 0x45, 0xb9, 0x99, 0xfe, 0x00, 0x00, 0xfe, 0xad, 0x75, 0x31,
+  0x29, 0x00, 0x31, 0xc0, 0x88, 0x99, 0x00, 0x31, 0x80, 0x99, 0x24, 0xfe, 0xff, 0xbf, 0x31, 0x51,
+  0x24, 0x3b, 0x27, 0x24, 0x3b, 0x31, 0x27, 0xfe, 0x42, 0x28, 0xaa, 0x88, 0x31, 0x24, 0x29, 0x31,
+  0x27, 0x00, 0xfe, 0xce, 0x39, 0x24, 0x29, 0x31, 0xc0, 0x0b, 0x00, 0x04, 0x00, 0x29, 0x31, 0xc0,
+  0x29, 0x00, 0x04, 0x31, 0xc7, 0xfe, 0x12, 0x4d, 0xc4, 0x6e, 0xcc, 0x05, 0x00, 0xc4, 0x31, 0xcd,
+  0xfe, 0x00, 0x00, 0x29, 0x31, 0xc0, 0x27, 0x24, 0x09, 0x31, 0xc1, 0x96, 0x88, 0x00, 0x29, 0x31,
+  0x00, 0x29, 0x31, 0xc1, 0x29, 0x00, 0x31, 0x27, 0xfe, 0x29, 0x25, 0x09, 0x31, 0xc1, 0x2f, 0x00,
+  0xfe, 0xbd, 0xd7, 0x31, 0x00, 0x29, 0x31, 0xc1, 0x29, 0x00, 0x31, 0xcb, 0x11, 0x66, 0xc0, 0x11,
+  0x0c, 0x11, 0x67, 0xc0, 0x11, 0xc1, 0x0c, 0xc0, 0x13, 0xc0, 0x6e, 0xc8, 0x6e, 0xc0, 0x31, 0xca,
+  0x93, 0x99, 0x00, 0xfe, 0xef, 0x7d, 0x31, 0x8f, 0x99, 0x00, 0x31, 0x0c, 0x00, 0xfe, 0xe7, 0x1c,
+  0x31, 0xc0, 0x23, 0x00, 0x27, 0x2f, 0x00, 0x04, 0x31, 0x0c, 0x00, 0x31, 0xc2, 0x29, 0x00, 0x31,
+  0xc1, 0x98, 0x99, 0x00, 0x0b, 0x31, 0x29, 0x00, 0xfe, 0xd6, 0x9a, 0x31, 0xc1, 0xfe, 0x5a, 0xcb,
+  0x1f, 0x31, 0xcb, 0xfe, 0x12, 0xb0, 0x6e, 0xc5, 0x6e, 0x24, 0xca, 0x29, 0x24, 0x29, 0xc0, 0x24,
+  0x29, 0xc4, 0xb3, 0x1c, 0xce, 0x6f, 0x69, 0x0c, 0xc8, 0x6e, 0xc3, 0xfe, 0xff, 0xff, 0xc8, 0xfe,
+  0x5a, 0xcb, 0x9b, 0x88, 0xfe, 0xff, 0xbf, 0xfe, 0x00, 0x00, 0xfe, 0xad, 0x75, 0x31, 0x98, 0x99,
+  0xfe, 0x29, 0x45, 0xb5, 0x99, 0xa8, 0x88, 0x24, 0xba, 0x88, 0x31, 0x24, 0xb9, 0x99, 0x31, 0xc1,
+  0x23, 0x86, 0x88, 0x31, 0x8f, 0x99, 0x00, 0xfe, 0xd6, 0x9a, 0x0b, 0x00, 0x2b, 0x31, 0x9b, 0x99,
+  0xc0, 0x31, 0x08, 0x00, 0x08, 0x27, 0xc0, 0x31, 0xc0, 0x23, 0x25, 0x0c, 0x00, 0x27, 0x31, 0xc0,
+  0x27, 0x00, 0x0c, 0x31, 0xc7, 0xfe, 0x12, 0x4d, 0xc4, 0x6e, 0xd3, 0x31, 0xcd, 0xfe, 0x00, 0x00,
+  0x29, 0x31, 0xc0, 0x92, 0x99, 0x00, 0x2b, 0x31, 0xc2, 0x80, 0x99, 0x25, 0x31, 0x00, 0x29, 0x31,
+  0xc1, 0x29, 0x00, 0x31, 0x2f, 0x00, 0x04, 0x31, 0xc2, 0x29, 0xad, 0x99, 0x31, 0x00, 0x29, 0x31,
+  0xc1, 0x29, 0x00, 0x31, 0xcb, 0xfe, 0x12, 0x8e, 0xc1, 0x11, 0xc1, 0x0c, 0x11, 0xc2, 0x0c, 0xc0,
+  0x6b, 0xc0, 0x6e, 0xc8, 0x6e, 0xc0, 0x31, 0xcb, 0x08, 0x31, 0xc0, 0x23, 0x25, 0x31, 0x27, 0x00,
+  0x23, 0x31, 0xc0, 0x1f, 0x3b, 0x31, 0xc0, 0x08, 0x31, 0xc0, 0x23, 0x24, 0x31, 0xc2, 0x29, 0x00,
+  0x31, 0xc2, 0x3b, 0x25, 0x31, 0x25, 0x3b, 0x31, 0xc2, 0x08, 0x29, 0x31, 0xcb, 0xfe, 0x12, 0xd0,
+  0xd3, 0x6e, 0xc0, 0x24, 0x29, 0xc4, 0x24, 0x29, 0xb3, 0x1c, 0xc0, 0x66, 0xc2, 0x00, 0xc8, 0x6f,
+  0x69, 0xc2, 0x0c, 0xc4, 0x6e, 0xc4, 0xfe, 0xff, 0xff, 0xc7, 0x8c, 0x88, 0xfe, 0x00, 0x00, 0xfe,
+  0xd6, 0x9a, 0x31, 0x00, 0x29, 0x31, 0x51, 0xfe, 0x5a, 0xcb, 0x00, 0xc0, 0xa9, 0x99, 0xfe, 0xef,
+  0x5d, 0x31, 0x00, 0x29, 0x31, 0xc1, 0x29, 0x00, 0x31, 0xc0, 0x1c, 0x9b, 0x88, 0x00, 0xfe, 0xa4,
+  0xf4, 0x31, 0xc2, 0x00, 0xc0, 0xfe, 0x84, 0x10, 0x31, 0xc2, 0x92, 0x99, 0xfe, 0x00, 0x00, 0x29,
+  0xc0, 0x00, 0x31, 0xc2, 0x00, 0x29, 0x31, 0xc7, 0x3b, 0xc4, 0x6e, 0xd1, 0x6b, 0x0c, 0x31, 0xcd,
+  0xfe, 0x00, 0x00, 0x29, 0x31, 0xc0, 0x29, 0x00, 0x31, 0xc3, 0x29, 0x00, 0x31, 0x00, 0xfe, 0xad,
+  0x55, 0x31, 0xc1, 0x29, 0x00, 0x31, 0x29, 0x00, 0x31, 0xc6, 0x00, 0xc5, 0x31, 0xcb, 0x0c, 0xc1,
+  0x11, 0xc0, 0x0c, 0x11, 0xc3, 0x0c, 0x6b, 0xc1, 0x11, 0xc0, 0x6b, 0xc8, 0x31, 0xcc, 0x2f, 0x00,
+  0xc0, 0x2f, 0x31, 0xc0, 0x80, 0x99, 0x1f, 0x31, 0x2f, 0x00, 0x08, 0x31, 0xc1, 0x2f, 0x00, 0xc0,
+  0x0b, 0x31, 0xc2, 0x24, 0x00, 0x31, 0xc2, 0x29, 0x00, 0x31, 0x00, 0x29, 0x31, 0xd1, 0xfe, 0x12,
+  0xd0, 0xd3, 0x6e, 0x24, 0xc1, 0x29, 0x24, 0x29, 0xc1, 0x24, 0xc0, 0xb3, 0x1c, 0xc1, 0x66, 0x00,
+  0xc7, 0x6e, 0x00, 0xc0, 0x6f, 0xc1, 0x05, 0xc1, 0x0c, 0xc3, 0x6e, 0xc4, 0xfe, 0xff, 0xff, 0xc6,
+  0x9b, 0x99, 0xfe, 0x00, 0x00, 0xb6, 0x88, 0xb8, 0x88, 0xc0, 0x00, 0xbf, 0x99, 0xb8, 0x88, 0x1c,
+  0x9b, 0x88, 0xfe, 0xff, 0xbf, 0x59, 0x25, 0x1c, 0x31, 0xfe, 0x29, 0x45, 0xb9, 0x99, 0x31, 0xc1,
+  0x23, 0x24, 0x31, 0xc0, 0x95, 0x99, 0x00, 0xc0, 0x27, 0x31, 0xc2, 0x92, 0x99, 0x96, 0x88, 0x82,
+  0x88, 0xfe, 0xef, 0x7d, 0x31, 0xc0, 0x2f, 0x00, 0x3b, 0x31, 0x0c, 0x00, 0x27, 0x31, 0xc0, 0x1d,
+  0x00, 0x0c, 0x31, 0xc7, 0xfe, 0x12, 0x4d, 0x69, 0x3b, 0xc2, 0x6e, 0xc9, 0x3b, 0x00, 0xc1, 0x6b,
+  0x00, 0xc1, 0x07, 0x6e, 0x31, 0xcd, 0xfe, 0x00, 0x00, 0xfe, 0xad, 0x75, 0x31, 0xc0, 0x2f, 0x00,
+  0x04, 0x31, 0xc2, 0x80, 0x99, 0x25, 0x31, 0x00, 0x0b, 0x31, 0xc1, 0x0b, 0x00, 0x31, 0x2f, 0x00,
+  0x04, 0x31, 0xc2, 0x0b, 0x08, 0x31, 0x00, 0xbb, 0x88, 0x29, 0xc1, 0x09, 0x00, 0x31, 0xcb, 0x0c,
+  0xc2, 0x11, 0x0c, 0x11, 0xc2, 0x0c, 0xc2, 0x11, 0xc1, 0x6b, 0xc8, 0x31, 0xcc, 0x9c, 0x88, 0x93,
+  0x99, 0x1c, 0xa5, 0x88, 0x31, 0xc0, 0x08, 0x00, 0xfe, 0xce, 0x59, 0x09, 0x25, 0x31, 0xc2, 0x04,
+  0x0c, 0x23, 0x24, 0x04, 0x31, 0xc1, 0x29, 0x00, 0x31, 0xc2, 0x3b, 0x25, 0x31, 0x25, 0xaf, 0x99,
+  0x31, 0xc2, 0x96, 0x88, 0x29, 0x31, 0xcb, 0xfe, 0x12, 0xd0, 0x69, 0x24, 0xd5, 0x6e, 0x24, 0xc0,
+  0x29, 0xc1, 0x24, 0xb3, 0x1c, 0xc1, 0x66, 0x00, 0xc6, 0x6e, 0x00, 0xc0, 0x6f, 0x05, 0x0c, 0x6e,
+  0x69, 0xc0, 0x05, 0xc1, 0x0c, 0xc1, 0x11, 0xc4, 0xfe, 0xff, 0xff, 0xc6, 0x96, 0x88, 0xfe, 0x00,
+  0x00, 0xc4, 0xfe, 0x94, 0x72, 0x00, 0xbf, 0x99, 0x31, 0xc0, 0x3b, 0x00, 0x31, 0x3b, 0x8b, 0x88,
+  0xfe, 0xff, 0xbf, 0x31, 0x27, 0x24, 0x3b, 0x31, 0xc0, 0xfe, 0x6b, 0x6d, 0x24, 0x00, 0xfe, 0xad,
+  0x75, 0x31, 0x92, 0x99, 0x24, 0x27, 0x31, 0xc0, 0x00, 0x2f, 0x31, 0x8b, 0x99, 0x00, 0x23, 0x31,
+  0xc0, 0x98, 0x99, 0x00, 0x29, 0x31, 0xc0, 0x29, 0x00, 0x2b, 0x31, 0xc7, 0xfe, 0x12, 0x4d, 0x69,
+  0x3b, 0xc5, 0x6e, 0xc0, 0x3b, 0x00, 0xc2, 0x3b, 0xc1, 0x00, 0xc4, 0x6b, 0x05, 0x31, 0xcd, 0xfe,
+  0x00, 0x00, 0x29, 0x31, 0xc0, 0x27, 0xfe, 0x29, 0x45, 0x09, 0x31, 0xc1, 0x95, 0x99, 0x00, 0xfe,
+  0xa4, 0xf4, 0x31, 0xfe, 0x73, 0x6e, 0x96, 0x77, 0x27, 0x31, 0x27, 0x25, 0x09, 0x31, 0x27, 0x24,
+  0x09, 0x31, 0xc1, 0x2f, 0x00, 0xfe, 0xbd, 0xd7, 0x31, 0x00, 0x29, 0x31, 0xc1, 0x29, 0x00, 0x31,
+  0xcb, 0xfe, 0x12, 0x8e, 0xc2, 0x11, 0xc0, 0x0c, 0xc1, 0x11, 0x67, 0xc2, 0x0c, 0x11, 0xc1, 0x6b,
+  0xc7, 0x31, 0xca, 0xfe, 0x5a, 0xcb, 0x23, 0x31, 0xc0, 0x8f, 0x99, 0x00, 0x31, 0xc1, 0x25, 0x1c,
+  0x00, 0x29, 0x31, 0xc0, 0x2f, 0x24, 0x27, 0x31, 0xc0, 0x00, 0x2f, 0x31, 0xc1, 0x29, 0x00, 0x31,
+  0xc1, 0x2b, 0x00, 0x0b, 0x31, 0x88, 0x88, 0x00, 0x08, 0x31, 0xc1, 0x1c, 0x93, 0x99, 0x31, 0xcb,
+  0xfe, 0x12, 0xcf, 0xc1, 0x6b, 0xc1, 0x66, 0x24, 0xcf, 0x6e, 0xc6, 0xb3, 0x1c, 0xcc, 0x6e, 0x6b,
+  0x05, 0xc2, 0x6e, 0x0c, 0xc3, 0x6e, 0xc5, 0xfe, 0xff, 0xff, 0xcb, 0xfe, 0x00, 0x00, 0xfe, 0xad,
+  0x75, 0x31, 0x81, 0x99, 0x80, 0x88, 0xfe, 0x9c, 0xf3, 0x7b, 0x00, 0xbf, 0x99, 0x31, 0x98, 0x99,
+  0x00, 0xb6, 0x88, 0x0b, 0x1c, 0x00, 0x2b, 0x31, 0x8f, 0x99, 0x00, 0xfe, 0xce, 0x39, 0x92, 0x88,
+  0x00, 0xfe, 0xef, 0x7d, 0x66, 0xfe, 0x29, 0x45, 0x1c, 0x29, 0x90, 0x88, 0x24, 0xfe, 0xf7, 0xbe,
+  0x29, 0x00, 0x24, 0x29, 0xc0, 0x66, 0x31, 0x3b, 0x00, 0x23, 0xc0, 0x00, 0x3b, 0x31, 0xc8, 0xfe,
+  0x12, 0x4d, 0xc0, 0x6e, 0xc0, 0x3b, 0xc4, 0x00, 0x3b, 0xc0, 0x00, 0xc0, 0x3b, 0xc5, 0x00, 0xc3,
+  0x31, 0xcd, 0xfe, 0x00, 0x00, 0x29, 0x31, 0xc1, 0x0c, 0x00, 0xb1, 0x88, 0x23, 0x98, 0x88, 0x00,
+  0x09, 0xfe, 0xff, 0xbf, 0x31, 0x95, 0x99, 0x00, 0x25, 0x23, 0x25, 0x00, 0x08, 0x31, 0xc0, 0x0c,
+  0x00, 0x25, 0x23, 0x13, 0x00, 0x09, 0x31, 0xc0, 0x00, 0x24, 0x31, 0xc1, 0x29, 0x00, 0x31, 0xcb,
+  0xfe, 0x12, 0x8e, 0xc4, 0x11, 0xc3, 0x0c, 0xc0, 0x11, 0x0c, 0x11, 0xc1, 0x0c, 0x6f, 0xc0, 0x11,
+  0xc2, 0x18, 0xc0, 0x31, 0xca, 0x0b, 0x00, 0x23, 0x0b, 0x83, 0x88, 0xb6, 0x88, 0x31, 0xc1, 0x29,
+  0xfe, 0x00, 0x00, 0xc0, 0x1d, 0x31, 0xc0, 0x04, 0xfe, 0x29, 0x25, 0x1c, 0x29, 0x09, 0x24, 0x27,
+  0x31, 0xc1, 0x8b, 0x99, 0x00, 0x24, 0x29, 0x94, 0x99, 0x00, 0x25, 0x27, 0x31, 0x27, 0x1c, 0x00,
+  0x09, 0x23, 0x25, 0x00, 0xfe, 0xd6, 0xba, 0x31, 0xcb, 0xfe, 0x12, 0xcf, 0xc0, 0x18, 0x1d, 0x6b,
+  0xc1, 0x66, 0xc0, 0x24, 0xcb, 0x6e, 0x24, 0x29, 0xc2, 0x24, 0x29, 0xc1, 0xb3, 0x1c, 0xcc, 0x6e,
+  0xc1, 0x6b, 0x05, 0xc2, 0x0c, 0xc0, 0x05, 0x0c, 0x6e, 0x0c, 0x11, 0xc3, 0xfe, 0xff, 0xff, 0xcb,
+  0xfe, 0x00, 0x00, 0xfe, 0xad, 0x75, 0x31, 0x62, 0x82, 0x88, 0x00, 0xc0, 0xfe, 0x84, 0x10, 0x27,
+  0x31, 0xc0, 0x96, 0x88, 0x81, 0x99, 0x8a, 0x88, 0x1c, 0xbe, 0x88, 0x31, 0x27, 0xfe, 0x29, 0x45,
+  0xb1, 0x88, 0x31, 0x27, 0xfe, 0x42, 0x28, 0x09, 0x31, 0x98, 0x99, 0x1c, 0x00, 0x25, 0x08, 0x31,
+  0x25, 0x00, 0xc3, 0x31, 0x51, 0x86, 0x99, 0x24, 0xc0, 0x23, 0x27, 0x31, 0xc8, 0xfe, 0x12, 0x4d,
+  0xc0, 0x6e, 0xc0, 0x3b, 0x69, 0x66, 0x3b, 0xc4, 0x00, 0xc0, 0x3b, 0x00, 0x3b, 0xc3, 0x00, 0xc3,
+  0x31, 0xcd, 0xfe, 0x00, 0x00, 0x29, 0x31, 0xc2, 0x08, 0x1c, 0x00, 0x24, 0x23, 0x27, 0x31, 0xc1,
+  0x08, 0x1c, 0x00, 0x25, 0x08, 0x31, 0xc2, 0x08, 0x1c, 0x00, 0x24, 0xbd, 0x99, 0x27, 0x31, 0xc0,
+  0x00, 0x29, 0x31, 0xc1, 0x29, 0x00, 0x31, 0xcb, 0x0c, 0xc4, 0x11, 0xc3, 0x0c, 0xc1, 0x6b, 0x11,
+  0x0c, 0xc0, 0x11, 0x13, 0x0c, 0x11, 0xc4, 0x31, 0xcb, 0x0b, 0x82, 0x88, 0x00, 0xbf, 0x99, 0x27,
+  0x31, 0xc1, 0x27, 0x00, 0x09, 0x31, 0xc2, 0x99, 0x99, 0x1c, 0x00, 0x25, 0x08, 0x31, 0xc2, 0x29,
+  0x00, 0xc1, 0xb0, 0x88, 0x23, 0x27, 0x31, 0xc1, 0x27, 0x23, 0x24, 0x00, 0x09, 0x08, 0x31, 0xcc,
+  0xfe, 0x12, 0xb0, 0x6d, 0xc1, 0x1f, 0x6e, 0xc0, 0x65, 0x1f, 0x24, 0xc6, 0x1d, 0xc2, 0x24, 0x6e,
+  0xc1, 0x24, 0x29, 0xc4, 0xb3, 0x1c, 0xcc, 0x6f, 0x69, 0x00, 0x05, 0x0c, 0xc4, 0x05, 0x0c, 0xc1,
+  0x6e, 0xc3, 0xfe, 0xef, 0x9e, 0xa3, 0x98, 0xfd, 0xc1, 0x9c, 0x89, 0xfe, 0x12, 0x4c, 0xc1, 0x6b,
+  0xc3, 0x34, 0x3b, 0xc4, 0x00, 0xc0, 0x3b, 0x00, 0x3b, 0xc1, 0x00, 0xc2, 0x05, 0xfe, 0xf7, 0x9e,
+  0x31, 0xfd, 0xc1, 0x15, 0x0c, 0xc1, 0x11, 0x0c, 0xc1, 0x11, 0xc1, 0x0c, 0x11, 0xc0, 0x0c, 0xc0,
+  0x11, 0x0c, 0x6b, 0xc1, 0x6e, 0x11, 0xc0, 0x18, 0xc0, 0x13, 0x18, 0x10, 0x31, 0xfd, 0xc1, 0x9d,
+  0x8a, 0xfe, 0x12, 0xb0, 0xc0, 0x6e, 0x1f, 0x24, 0xc1, 0x1f, 0x24, 0xc0, 0x1f, 0x24, 0x1f, 0x18,
+  0xc1, 0x6e, 0xc1, 0x24, 0x1d, 0x24, 0xc3, 0x6e, 0xc0, 0x24, 0xc2, 0xb3, 0x1c, 0xc1, 0x66, 0xc0,
+  0x00, 0xc7, 0x6e, 0x00, 0xc1, 0x6f, 0xc8, 0x6e, 0x0c, 0xc2, 0xbe, 0xd5, 0xad, 0xb7, 0xfd, 0xc1,
+  0x92, 0x69, 0x3b, 0xc1, 0x66, 0x3b, 0xcd, 0x00, 0x3b, 0x00, 0xc4, 0xbe, 0xd6, 0x31, 0xfd, 0xc1,
+  0x32, 0x82, 0x4b, 0x0c, 0xc0, 0x11, 0x0c, 0xc7, 0x11, 0x0c, 0x11, 0xc0, 0x0c, 0x6b, 0xc0, 0x6e,
+  0x11, 0xc2, 0x13, 0x18, 0xbd, 0xd5, 0x31, 0xfd, 0xc1, 0x32, 0x84, 0x2c, 0xc0, 0x66, 0xc1, 0x24,
+  0xc0, 0x1f, 0xc1, 0x24, 0xc0, 0x1f, 0xc1, 0x18, 0x6e, 0x24, 0x1d, 0xc1, 0x24, 0xc4, 0x6e, 0xc0,
+  0x24, 0xc0, 0x29, 0xb3, 0x1c, 0xc0, 0x66, 0xc1, 0x00, 0xcb, 0x6e, 0x6b, 0xc5, 0x6e, 0x0c, 0xc4,
+  0xac, 0xb7, 0xbf, 0xd5, 0xfd, 0xc1, 0xfe, 0x4b, 0xd2, 0x3b, 0x7a, 0x3b, 0x69, 0x3b, 0xcc, 0x00,
+  0xc7, 0xab, 0xb8, 0x31, 0xfd, 0xc1, 0x81, 0x3c, 0x11, 0x0c, 0xc7, 0x11, 0xc0, 0x0c, 0x11, 0x0c,
+  0x11, 0xc0, 0x0c, 0x6b, 0x6e, 0x0c, 0x11, 0x0c, 0xc1, 0x11, 0x18, 0xab, 0xa7, 0x31, 0xfd, 0xc1,
+  0x81, 0x3d, 0x96, 0x59, 0xc1, 0x66, 0xc1, 0x24, 0x1f, 0xc2, 0x24, 0x1f, 0xc1, 0x6d, 0xc4, 0x24,
+  0xc5, 0x6e, 0xc2, 0xb2, 0x1c, 0x6e, 0xc0, 0x3b, 0x00, 0xce, 0x6f, 0xc1, 0x69, 0x0c, 0xc8, 0xbd,
+  0xd5, 0xae, 0xb7, 0xfd, 0x8f, 0x6a, 0x84, 0x4a, 0x3b, 0xc1, 0x34, 0x3b, 0xc1, 0x00, 0xc0, 0x3b,
+  0xc9, 0x00, 0xc4, 0x3b, 0x00, 0xbc, 0xd6, 0x31, 0xfd, 0x19, 0x85, 0x3c, 0xc0, 0x0c, 0x6e, 0x0c,
+  0xc0, 0x6f, 0x0c, 0xc0, 0x11, 0x0c, 0xc0, 0x11, 0x0c, 0x11, 0x0c, 0xc0, 0x11, 0x13, 0xc1, 0x0c,
+  0xc1, 0x18, 0x0c, 0x11, 0x18, 0xc0, 0xba, 0xd5, 0x31, 0xfd, 0x91, 0x5b, 0x86, 0x3b, 0xc4, 0x66,
+  0x24, 0xc1, 0x1f, 0xc4, 0x24, 0x69, 0xc2, 0x24, 0xc7, 0x6e, 0xc1, 0xb2, 0x1c, 0x6e, 0xc5, 0x3b,
+  0x00, 0xc5, 0x3b, 0x00, 0xc1, 0x6e, 0x6b, 0xc5, 0x6e, 0x0c, 0xc2, 0x7a, 0x6e, 0xba, 0xd6, 0xb0,
+  0xa6, 0xfb, 0x19, 0x83, 0x5b, 0x3b, 0xc1, 0x69, 0x3b, 0xc2, 0x00, 0xc0, 0x3b, 0xc3, 0x65, 0x3b,
+  0xc2, 0x00, 0xc7, 0x0f, 0x19, 0x31, 0xfb, 0x19, 0x0f, 0x0c, 0xc3, 0x6b, 0x11, 0x0c, 0x11, 0x0c,
+  0xc6, 0x11, 0xc0, 0x0c, 0x11, 0xc2, 0x0c, 0x6f, 0xc1, 0x11, 0x7f, 0xb9, 0xd6, 0x31, 0xfb, 0x91,
+  0x6b, 0x87, 0x3b, 0x56, 0xc1, 0x66, 0xc4, 0x24, 0x1f, 0x6d, 0x1f, 0xc0, 0x24, 0x1f, 0x1d, 0x18,
+  0xc0, 0x1d, 0xc0, 0x1f, 0x24, 0xc9, 0xb2, 0x1c, 0x6e, 0xc5, 0x3b, 0xc1, 0x00, 0xc7, 0x6f, 0xcb,
+  0x69, 0x0c, 0xc0, 0xac, 0xa6, 0xb1, 0xc8, 0xab, 0xa7, 0xa3, 0x98, 0xf5, 0x9d, 0x8a, 0x95, 0x78,
+  0x8d, 0x6b, 0x3b, 0x69, 0x3b, 0x34, 0x3b, 0xc4, 0x00, 0x3b, 0x34, 0x3b, 0xc1, 0x34, 0x3b, 0xc6,
+  0x00, 0xc6, 0x32, 0x2d, 0xab, 0xb8, 0x31, 0xf5, 0x15, 0x2d, 0x8e, 0x5a, 0x95, 0x79, 0x0c, 0x00,
+  0x0c, 0xc0, 0x6e, 0x0c, 0xc1, 0x11, 0xc0, 0x0c, 0xc6, 0x11, 0xc0, 0x0c, 0xc0, 0x11, 0x0c, 0xc0,
+  0x6b, 0x6e, 0xc0, 0x11, 0x18, 0xc0, 0x11, 0xab, 0xb8, 0xb2, 0xb7, 0x15, 0x31, 0xf5, 0x1c, 0x39,
+  0x8f, 0x5a, 0x95, 0x69, 0x6e, 0x67, 0x66, 0x24, 0x1f, 0x18, 0xc0, 0x1f, 0xc0, 0x24, 0x1f, 0x24,
+  0x1d, 0xc1, 0x24, 0x1d, 0xc0, 0x18, 0xc0, 0x1d, 0x18, 0x1f, 0x24, 0xc9, 0xb2, 0x1c, 0xc0, 0x6e,
+  0xc4, 0x3b, 0xc1, 0x00, 0xc7, 0x6e, 0xc0, 0x6b, 0x05, 0x0c, 0xca, 0x05, 0x00, 0x0c, 0xc0, 0x05,
+  0x0c, 0xc0, 0x05, 0x00, 0xc2, 0x05, 0xc1, 0x00, 0xc5, 0x3b, 0xc5, 0x65, 0xc1, 0x3b, 0xc0, 0x2f,
+  0xc2, 0x3b, 0x69, 0xc3, 0x2f, 0xc0, 0x3b, 0xc2, 0x34, 0xc0, 0x3b, 0xc7, 0x7a, 0x3b, 0x2f, 0x3b,
+  0xc4, 0x00, 0xc0, 0x3b, 0x34, 0x3b, 0xc7, 0x34, 0x3b, 0xc0, 0x00, 0xc7, 0x3b, 0xc0, 0x00, 0xc0,
+  0x6b, 0x00, 0xca, 0x07, 0xc2, 0x0c, 0xc2, 0x07, 0xc1, 0x0c, 0xc4, 0x07, 0xc0, 0x0c, 0x07, 0xc4,
+  0x00, 0xc0, 0x0c, 0xc1, 0x07, 0xc1, 0x0c, 0xc0, 0x05, 0x07, 0xc0, 0x00, 0x07, 0x0c, 0x07, 0x0c,
+  0x76, 0x0c, 0xc1, 0x6e, 0x0c, 0xc2, 0x11, 0x0c, 0xc6, 0x11, 0x0c, 0xc0, 0x11, 0x0c, 0xc0, 0x6b,
+  0xc0, 0x11, 0x6b, 0x11, 0x18, 0xc6, 0x6e, 0xc0, 0x11, 0x1d, 0xc2, 0x18, 0xc2, 0x1d, 0xc6, 0x18,
+  0xd2, 0x1d, 0x18, 0xc2, 0x1d, 0xc4, 0x6b, 0x1d, 0x24, 0xc1, 0x6e, 0x24, 0x29, 0xc0, 0x24, 0xc0,
+  0x66, 0xc0, 0x18, 0xc0, 0x1f, 0xc0, 0x18, 0x1f, 0x18, 0x1d, 0xc2, 0x18, 0xc3, 0x1d, 0xc0, 0x24,
+  0xc8, 0xb2, 0x1c, 0xc0, 0x6e, 0xc4, 0x3b, 0x00, 0xca, 0x6e, 0x6b, 0xc0, 0x05, 0x0c, 0xc5, 0x05,
+  0xc0, 0x67, 0x0c, 0x6e, 0x0c, 0xc5, 0x00, 0xc2, 0x0c, 0x05, 0x00, 0xc6, 0x3b, 0xc1, 0x00, 0x3b,
+  0xc0, 0x69, 0xc0, 0x66, 0x34, 0xc6, 0x3b, 0xc0, 0x34, 0xc1, 0x2f, 0x34, 0xc7, 0x3b, 0xc1, 0x34,
+  0x3b, 0x34, 0xc0, 0x3b, 0x34, 0x3b, 0x66, 0x34, 0xc0, 0x3b, 0xc0, 0x00, 0xc2, 0x3b, 0xc0, 0x34,
+  0xc0, 0x3b, 0xc5, 0x00, 0x3b, 0x6d, 0x3b, 0x00, 0xc3, 0x07, 0x3b, 0x00, 0x3b, 0x00, 0xce, 0x0c,
+  0xc0, 0x07, 0x0c, 0xc2, 0x07, 0xc1, 0x0c, 0xc4, 0x07, 0xc7, 0x00, 0xc0, 0x0c, 0xc1, 0x07, 0x00,
+  0x07, 0x0c, 0xc0, 0x07, 0x0c, 0xc0, 0x07, 0xc2, 0x0c, 0xd0, 0x11, 0x0c, 0xc0, 0x11, 0xc0, 0x0c,
+  0x11, 0x0c, 0xc0, 0x6f, 0x11, 0x18, 0x7a, 0x18, 0x11, 0x18, 0xc1, 0x6e, 0x18, 0xc2, 0x1d, 0xc0,
+  0x18, 0x1d, 0xc2, 0x18, 0xd8, 0x1d, 0xc4, 0x18, 0xc1, 0x1d, 0xc4, 0x6b, 0x1d, 0x24, 0x6e, 0x24,
+  0x29, 0x24, 0xc0, 0x1d, 0x67, 0xc2, 0x18, 0xc0, 0x1f, 0xc0, 0x18, 0xc0, 0x1d, 0x18, 0xc0, 0x1d,
+  0xc0, 0x18, 0xc2, 0x1d, 0xc2, 0x24, 0x1f, 0x24, 0xc4, 0xb2, 0x1c, 0x6e, 0xc6, 0x3b, 0x00, 0xc7,
+  0x6e, 0x00, 0x05, 0x6b, 0xc0, 0x05, 0x0c, 0xc2, 0x05, 0x0c, 0xc0, 0x05, 0x0c, 0x05, 0xc0, 0x0c,
+  0xc1, 0x05, 0x0c, 0x05, 0xc0, 0x0c, 0x00, 0xc0, 0x05, 0xc2, 0x67, 0x00, 0xc1, 0x07, 0x00, 0xc0,
+  0x3b, 0xc1, 0x00, 0xc1, 0x3b, 0xc0, 0x69, 0x66, 0xc5, 0x34, 0xc6, 0x2f, 0x34, 0x3b, 0x34, 0xc0,
+  0x3b, 0xc0, 0x34, 0xc0, 0x3b, 0x2f, 0x34, 0xc0, 0x2f, 0xc1, 0x3b, 0xc2, 0x34, 0xc0, 0x3b, 0xc1,
+  0x00, 0x3b, 0xc0, 0x34, 0x3b, 0xc3, 0x34, 0x3b, 0xc0, 0x34, 0x3b, 0x00, 0xdb, 0x0c, 0x00, 0x07,
+  0xc0, 0x0c, 0xc2, 0x07, 0x0c, 0xc0, 0x05, 0x0c, 0x07, 0x0c, 0x07, 0xc0, 0x0c, 0x05, 0x07, 0xc6,
+  0x00, 0x0c, 0x07, 0x00, 0x07, 0xc0, 0x0c, 0xc2, 0x07, 0xc0, 0x0c, 0xc1, 0x07, 0x0c, 0xc2, 0x07,
+  0xc0, 0x0c, 0x07, 0x0c, 0xc0, 0x6e, 0x0c, 0xc8, 0x11, 0xc0, 0x0c, 0xc1, 0x11, 0xc4, 0x6b, 0xcb,
+  0x6e, 0xc1, 0x18, 0xc6, 0x1d, 0x18, 0xce, 0x1d, 0xc0, 0x18, 0x1d, 0x18, 0xc3, 0x1d, 0xc4, 0x6b,
+  0x1d, 0x24, 0x1d, 0x24, 0x6e, 0x24, 0x29, 0x24, 0x1d, 0x67, 0x24, 0x1f, 0x18, 0x1f, 0xc0, 0x18,
+  0xc2, 0x1d, 0xc2, 0x18, 0xc2, 0x1d, 0x18, 0x1d, 0xc3, 0x24, 0xc1, 0x1d, 0xc0, 0xb3, 0x1c, 0xd0,
+  0x6e, 0xc1, 0x00, 0x05, 0xc0, 0x6b, 0xca, 0x05, 0x0c, 0xc0, 0x05, 0x0c, 0x05, 0x0c, 0x05, 0x00,
+  0xc0, 0x05, 0xc0, 0x00, 0xca, 0x66, 0x00, 0xc1, 0x3b, 0x65, 0xc7, 0x6e, 0x2f, 0x34, 0xc1, 0x2f,
+  0x34, 0xc4, 0x3b, 0x34, 0xc0, 0x2f, 0xc0, 0x34, 0xc1, 0x2f, 0xc1, 0x3b, 0x34, 0x3b, 0xc1, 0x2f,
+  0xc0, 0x34, 0x3b, 0xc1, 0x00, 0x3b, 0x00, 0x3b, 0xc5, 0x34, 0x3b, 0x00, 0xdb, 0x05, 0x00, 0x6b,
+  0x0c, 0xc0, 0x07, 0xc2, 0x0c, 0xc4, 0x07, 0x0c, 0x07, 0x0c, 0x07, 0xc2, 0x00, 0x07, 0xc0, 0x00,
+  0xc0, 0x05, 0x0c, 0x07, 0xc2, 0x0c, 0xc0, 0x07, 0xc1, 0x0c, 0x07, 0x0c, 0xc3, 0x07, 0xc0, 0x0c,
+  0x07, 0xc0, 0x0c, 0xcc, 0x6e, 0x0c, 0x11, 0x0c, 0x11, 0xc4, 0x6b, 0xc8, 0x6e, 0x18, 0xc0, 0x1d,
+  0xc0, 0x18, 0xe2, 0x1d, 0xc5, 0x6b, 0x1d, 0x24, 0x6e, 0x24, 0xc0, 0x1d, 0x24, 0x1d, 0x67, 0xc1,
+  0x18, 0xcc, 0x1d, 0x18, 0x1d, 0xc3, 0x24, 0xc2, 0x1d, 0xb3, 0x1c, 0xce, 0x6e, 0xc1, 0x00, 0xc0,
+  0x05, 0xc1, 0x6b, 0x6e, 0x0c, 0xc1, 0x05, 0x0c, 0x05, 0x0c, 0xc2, 0x05, 0x0c, 0xc2, 0x05, 0x0c,
+  0xc0, 0x00, 0xc8, 0x6b, 0x00, 0xc2, 0x65, 0x6b, 0xc3, 0x65, 0xc5, 0x3b, 0xc1, 0x2f, 0xc3, 0x34,
+  0xc4, 0x3b, 0xc0, 0x34, 0xc0, 0x2f, 0xc0, 0x34, 0xc1, 0x2f, 0xc0, 0x3b, 0xc5, 0x2f, 0xc0, 0x34,
+  0x3b, 0xc7, 0x34, 0xc0, 0x3b, 0xc2, 0x00, 0xdc, 0x0c, 0xc0, 0x07, 0x00, 0xc0, 0x07, 0x0c, 0xc3,
+  0x07, 0xc0, 0x0c, 0x07, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0xc1, 0x07, 0x0c, 0x00, 0xc0, 0x0c, 0xc2,
+  0x07, 0x00, 0x07, 0xc0, 0x0c, 0xc0, 0x07, 0x00, 0x07, 0xc0, 0x0c, 0xc0, 0x07, 0xc4, 0x0c, 0xc6,
+  0x11, 0x0c, 0xc3, 0x11, 0x0c, 0xc1, 0x11, 0xc1, 0x6b, 0xc1, 0x66, 0xc0, 0x18, 0xc2, 0x6e, 0x18,
+  0xc4, 0x1d, 0xc1, 0x18, 0xe0, 0x1d, 0xc4, 0x6b, 0xc6, 0x1d, 0x24, 0x1d, 0xc2, 0x18, 0xc0, 0x1d,
+  0x18, 0xcb, 0x1d, 0xc3, 0x24, 0xc1, 0x66, 0x18, 0xb3, 0x1c, 0xd3, 0x6e, 0x6b, 0xc1, 0x6e, 0x0c,
+  0xc1, 0x05, 0x0c, 0x05, 0x0c, 0xc6, 0x66, 0x00, 0x05, 0xc0, 0x00, 0xcd, 0x65, 0x6b, 0x34, 0xc1,
+  0x3b, 0x65, 0xc5, 0x34, 0x3b, 0x2f, 0xc1, 0x34, 0xc7, 0x3b, 0xc0, 0x34, 0x2f, 0xc0, 0x34, 0xc2,
+  0x2f, 0xc0, 0x3b, 0xc1, 0x2f, 0xc0, 0x3b, 0xc0, 0x2f, 0x34, 0x3b, 0xcd, 0x00, 0xdd, 0x07, 0xc4,
+  0x0c, 0xc2, 0x07, 0xc5, 0x0c, 0xc0, 0x07, 0x00, 0xc1, 0x07, 0x00, 0x07, 0xc2, 0x0c, 0x07, 0xce,
+  0x0c, 0x07, 0x0c, 0xcc, 0x11, 0x0c, 0x11, 0x0c, 0x11, 0xc0, 0x6b, 0xc2, 0x66, 0x18, 0xc5, 0x6e,
+  0xc0, 0x18, 0xc0, 0x1d, 0xc2, 0x18, 0xdd, 0x1d, 0x18, 0x1d, 0xcb, 0x6b, 0x1d, 0xc6, 0x18, 0xcd,
+  0x1d, 0xc4, 0x24, 0x66, 0xc1, 0xb3, 0x1c, 0xd2, 0x6f, 0xc2, 0x6e, 0x0c, 0xc4, 0x69, 0x0c, 0x05,
+  0x0c, 0xc2, 0x66, 0x0c, 0x07, 0x00, 0xcf, 0x66, 0x69, 0x3b, 0xc0, 0x34, 0xc0, 0x3b, 0xc0, 0x65,
+  0xc4, 0x34, 0xc0, 0x2f, 0xc1, 0x34, 0xc7, 0x2f, 0x34, 0x2f, 0x3b, 0xc1, 0x34, 0x2f, 0xc6, 0x3b,
+  0xc0, 0x2f, 0xc2, 0x3b, 0xc2, 0x34, 0x3b, 0xc5, 0x00, 0xc2, 0x3b, 0x00, 0xc8, 0x3b, 0xc0, 0x00,
+  0xcf, 0x07, 0xd2, 0x00, 0xc2, 0x07, 0x0c, 0x07, 0x00, 0x0c, 0xc0, 0x07, 0xc3, 0x0c, 0x07, 0xc6,
+  0x0c, 0x07, 0xc0, 0x0c, 0xce, 0x11, 0x0c, 0xc1, 0x6f, 0xc8, 0x6e, 0x18, 0xc6, 0x1d, 0x18, 0xdd,
+  0x1d, 0x18, 0x1d, 0xca, 0x6b, 0x6e, 0x1d, 0xc6, 0x18, 0xc2, 0x1d, 0x18, 0xc8, 0x1d, 0xc4, 0x24,
+  0xc2, 0xb3, 0x1c, 0xce, 0x6e, 0x00, 0xc0, 0x05, 0x6b, 0x05, 0xc0, 0x0c, 0xc4, 0x05, 0xc0, 0x0c,
+  0xc0, 0x05, 0x0c, 0xc1, 0x05, 0xc0, 0x0c, 0x00, 0xcd, 0x66, 0x00, 0xc1, 0x3b, 0xc0, 0x65, 0xc0,
+  0x3b, 0x2f, 0xc0, 0x3b, 0x2f, 0xc3, 0x6e, 0xc1, 0x2f, 0x34, 0x2f, 0xc0, 0x34, 0x2f, 0xc0, 0x34,
+  0xc2, 0x2f, 0x34, 0x2f, 0x3b, 0xc1, 0x34, 0x2f, 0xc1, 0x3b, 0x2f, 0xc7, 0x3b, 0xcb, 0x00, 0x3b,
+  0xc0, 0x00, 0xc8, 0x3b, 0x00, 0x3b, 0xc3, 0x00, 0xcf, 0x6b, 0xc2, 0x0c, 0x07, 0x0c, 0x07, 0xc8,
+  0x00, 0xc1, 0x07, 0xc0, 0x0c, 0x07, 0xc0, 0x0c, 0x07, 0x00, 0xc0, 0x07, 0xc1, 0x0c, 0x07, 0xc5,
+  0x0c, 0x07, 0xc1, 0x0c, 0xc2, 0x07, 0x0c, 0xc7, 0x6e, 0xc0, 0x0c, 0xc2, 0x6f, 0xca, 0x6e, 0x18,
+  0xc5, 0x1d, 0x18, 0xdc, 0x1d, 0x18, 0x1d, 0xc2, 0x18, 0xc0, 0x1d, 0xc4, 0x6b, 0x6e, 0x1d, 0xc2,
+  0x24, 0x1d, 0xc1, 0x18, 0xc0, 0x1d, 0x18, 0xc0, 0x1d, 0xc0, 0x18, 0xc6, 0x1d, 0xc5, 0x24, 0xc1,
+  0xb3, 0x1c, 0xd2, 0x6f, 0x69, 0x0c, 0xc0, 0x6e, 0x0c, 0xcd, 0x00, 0xcd, 0x66, 0x00, 0xc1, 0x3b,
+  0xc1, 0x69, 0x3b, 0x65, 0x3b, 0x2f, 0xc4, 0x34, 0xc6, 0x2f, 0xc2, 0x34, 0x2f, 0xc0, 0x34, 0x2f,
+  0xc0, 0x3b, 0x34, 0x2f, 0x34, 0x2f, 0x3b, 0x34, 0xc2, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0xc1, 0x3b,
+  0xc2, 0x34, 0x3b, 0xc4, 0x00, 0xc8, 0x3b, 0x00, 0xc4, 0x3b, 0xc2, 0x00, 0x3b, 0x00, 0xc7, 0x6b,
+  0xc2, 0x00, 0xc1, 0x07, 0x00, 0xc0, 0x07, 0xc0, 0x0c, 0xc0, 0x07, 0xc2, 0x00, 0xc0, 0x07, 0xc2,
+  0x00, 0xc0, 0x07, 0xc2, 0x00, 0x07, 0xc0, 0x00, 0x07, 0x0c, 0xc0, 0x07, 0x0c, 0x07, 0xc6, 0x0c,
+  0xc0, 0x07, 0x0c, 0xc1, 0x07, 0xc2, 0x0c, 0xc5, 0x11, 0xc0, 0x0c, 0xc1, 0x11, 0x6b, 0xce, 0x6e,
+  0x18, 0xc0, 0x1d, 0x18, 0xe0, 0x1d, 0xc0, 0x18, 0xc2, 0x1d, 0xc6, 0x18, 0x1d, 0xc4, 0x18, 0xc0,
+  0x6f, 0x18, 0xc0, 0x24, 0x1d, 0x18, 0xc6, 0x1d, 0xc5, 0x24, 0xc1, 0xb3, 0x1c, 0xc0, 0x6e, 0x00,
+  0xcd, 0x05, 0x00, 0x05, 0x6b, 0xc9, 0x05, 0x0c, 0xc3, 0x05, 0xc0, 0x00, 0xcc, 0x66, 0xc0, 0x00,
+  0xc1, 0x3b, 0xc0, 0x69, 0xc0, 0x66, 0xc0, 0x3b, 0xc0, 0x2f, 0xc0, 0x3b, 0xc1, 0x34, 0xc1, 0x2f,
+  0x34, 0xc1, 0x2f, 0x34, 0xc0, 0x2f, 0xc0, 0x3b, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0x34, 0xc3, 0x2f,
+  0x34, 0xc2, 0x2f, 0x34, 0xc1, 0x2f, 0x34, 0xc0, 0x3b, 0xc1, 0x34, 0x2f, 0xc0, 0x3b, 0xc0, 0x34,
+  0xc0, 0x3b, 0x00, 0x3b, 0xc0, 0x00, 0xc1, 0x3b, 0x00, 0xc2, 0x3b, 0xc2, 0x00, 0x3b, 0xc7, 0x00,
+  0xc5, 0x6b, 0x00, 0xc0, 0x07, 0xc0, 0x00, 0xc4, 0x07, 0x0c, 0xc1, 0x07, 0xc0, 0x00, 0xc1, 0x07,
+  0xc3, 0x00, 0xc0, 0x07, 0xc6, 0x0c, 0x07, 0x00, 0x07, 0x0c, 0x07, 0x00, 0x07, 0xc2, 0x00, 0xc0,
+  0x07, 0xc0, 0x0c, 0xc2, 0x07, 0xc1, 0x0c, 0xca, 0x6e, 0xc0, 0x6b, 0xd0, 0x6e, 0x18, 0xd9, 0x1d,
+  0x18, 0xca, 0x1d, 0xc2, 0x67, 0xc0, 0x1d, 0xc0, 0x18, 0xc0, 0x1d, 0xc0, 0x6b, 0x1d, 0xc0, 0x18,
+  0xcd, 0x1d, 0xc6, 0x24, 0xc0, 0xb3, 0x1c, 0xcf, 0x6e, 0x00, 0xc0, 0x6f, 0xd2, 0x00, 0xcc, 0x66,
+  0xc0, 0x00, 0xc0, 0x3b, 0x69, 0xc1, 0x3b, 0x34, 0xc2, 0x66, 0xc3, 0x34, 0xc0, 0x2f, 0xc0, 0x34,
+  0xc0, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0xc0, 0x3b, 0xc0, 0x2f, 0xc5, 0x34, 0xc1, 0x2f, 0xc2, 0x34,
+  0x2f, 0xc2, 0x34, 0x3b, 0x34, 0xc0, 0x3b, 0xc1, 0x2f, 0xc0, 0x3b, 0xc5, 0x00, 0xc1, 0x3b, 0xc1,
+  0x00, 0x3b, 0xc6, 0x66, 0x3b, 0xc1, 0x00, 0xc0, 0x3b, 0x00, 0xc7, 0x6b, 0xc0, 0x00, 0xc2, 0x07,
+  0x00, 0xc3, 0x0c, 0xc0, 0x07, 0x00, 0xc9, 0x07, 0xc0, 0x0c, 0xc1, 0x00, 0xc1, 0x07, 0xc1, 0x00,
+  0xc0, 0x07, 0xc3, 0x0c, 0xc0, 0x07, 0x0c, 0xc0, 0x07, 0xc1, 0x0c, 0x07, 0xc0, 0x0c, 0xc8, 0x6e,
+  0xc0, 0x6b, 0xc1, 0x11, 0xc0, 0x18, 0xe4, 0x6e, 0x18, 0xc2, 0x1d, 0xc0, 0x18, 0xc6, 0x1d, 0x18,
+  0xc1, 0x1d, 0xc0, 0x18, 0xc0, 0x1d, 0xc7, 0x6b, 0x18, 0xcd, 0x6b, 0xc0, 0x1d, 0xc3, 0x18, 0x24,
+  0x1f, 0xb3, 0x1c, 0xcf, 0x6e, 0x00, 0xc0, 0x6f, 0xcc, 0x05, 0x0c, 0xc1, 0x00, 0xcc, 0x66, 0x00,
+  0xc0, 0x3b, 0x00, 0xc0, 0x3b, 0x69, 0xc0, 0x66, 0xc0, 0x34, 0xc3, 0x2f, 0xc2, 0x34, 0xc0, 0x2f,
+  0xc4, 0x34, 0x2f, 0x34, 0xc0, 0x2f, 0x34, 0x2f, 0x34, 0xc2, 0x2f, 0xc1, 0x34, 0x2f, 0x34, 0xc0,
+  0x2f, 0x34, 0x2f, 0xc1, 0x34, 0xc3, 0x3b, 0xc1, 0x34, 0x2f, 0x34, 0x3b, 0xc8, 0x00, 0x3b, 0xc0,
+  0x00, 0x3b, 0xca, 0x00, 0xc0, 0x3b, 0x00, 0xc2, 0x6b, 0x00, 0x07, 0x00, 0xc0, 0x07, 0x00, 0xc8,
+  0x07, 0xc1, 0x00, 0xc3, 0x07, 0xc0, 0x00, 0xc4, 0x07, 0x0c, 0xc0, 0x07, 0x00, 0x07, 0xca, 0x0c,
+  0xc1, 0x07, 0x0c, 0xc0, 0x07, 0xc4, 0x0c, 0xc8, 0x6e, 0x67, 0x6e, 0xd1, 0x6e, 0x18, 0xd6, 0x1d,
+  0x18, 0xca, 0x1d, 0x18, 0x1d, 0x18, 0x1d, 0x18, 0xc0, 0x1d, 0xc2, 0x18, 0xc0, 0x1d, 0xc2, 0x18,
+  0xce, 0x6b, 0xc0, 0x1d, 0xc4, 0x6b, 0x1f, 0xb2, 0x1c, 0xc0, 0x6e, 0xc9, 0x6e, 0xc2, 0x00, 0xc0,
+  0x05, 0x6b, 0xc9, 0x05, 0x67, 0xc0, 0x05, 0x0c, 0x05, 0xc0, 0x00, 0xcc, 0x3b, 0x00, 0xc0, 0x65,
+  0x00, 0x3b, 0x65, 0x34, 0xc0, 0x2f, 0x3b, 0xc0, 0x34, 0xc3, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0xc5,
+  0x34, 0x2f, 0x34, 0xc2, 0x2f, 0xc0, 0x34, 0xc2, 0x2f, 0x34, 0xc0, 0x2f, 0x34, 0xc2, 0x2f, 0x34,
+  0xc6, 0x3b, 0xc0, 0x34, 0x2f, 0x34, 0xc2, 0x3b, 0xc0, 0x34, 0x3b, 0xc3, 0x00, 0xc1, 0x3b, 0xca,
+  0x00, 0xc0, 0x3b, 0xc0, 0x07, 0x66, 0x00, 0x07, 0xc1, 0x00, 0xc4, 0x07, 0xc5, 0x00, 0x07, 0xc0,
+  0x00, 0xc3, 0x07, 0x00, 0xc4, 0x07, 0x0c, 0xc0, 0x05, 0x0c, 0x07, 0xd7, 0x0c, 0xc9, 0x6b, 0x6e,
+  0xc9, 0x69, 0xc0, 0x18, 0xd2, 0x13, 0xc0, 0x18, 0xc6, 0x6e, 0x18, 0xcd, 0x1d, 0x18, 0xc3, 0x1d,
+  0xc2, 0x18, 0xd4, 0x6b, 0x1d, 0xc4, 0x6b, 0x1f, 0xb2, 0x1c, 0xc0, 0x6e, 0xc9, 0x6e, 0xc3, 0x00,
+  0x05, 0x6b, 0xc9, 0x05, 0x67, 0xc0, 0x05, 0xc0, 0x00, 0x05, 0x00, 0xcc, 0x3b, 0x00, 0xc0, 0x65,
+  0x3b, 0xc1, 0x34, 0xc0, 0x66, 0xc0, 0x34, 0xc3, 0x2f, 0xca, 0x34, 0x2f, 0xc0, 0x34, 0xc1, 0x2f,
+  0xc1, 0x34, 0xc0, 0x2f, 0xc1, 0x34, 0x2f, 0xc1, 0x34, 0x2f, 0xc4, 0x34, 0xc0, 0x2f, 0xc0, 0x34,
+  0x3b, 0xc0, 0x34, 0xc0, 0x2f, 0x34, 0xc0, 0x3b, 0xc7, 0x00, 0xc0, 0x3b, 0xcb, 0x00, 0x3b, 0xc3,
+  0x00, 0x07, 0x0c, 0x00, 0xc5, 0x07, 0x00, 0x07, 0xc2, 0x00, 0x07, 0xc0, 0x00, 0xca, 0x07, 0x0c,
+  0xc0, 0x05, 0x0c, 0x07, 0x00, 0x07, 0xd5, 0x0c, 0xc1, 0x07, 0xc1, 0x0c, 0xc2, 0x6b, 0x0c, 0xc0,
+  0x6f, 0xc8, 0x69, 0xc0, 0x18, 0xcc, 0x13, 0xc0, 0x18, 0xcc, 0x6e, 0x18, 0xd3, 0x1d, 0xc2, 0x18,
+  0xcc, 0x1d, 0xc0, 0x18, 0xc5, 0x1d, 0xc4, 0x67, 0x6e, 0xb2, 0x1c, 0xc0, 0x6e, 0xcb, 0x6e, 0xc1,
+  0x6b, 0xca, 0x05, 0x0c, 0xc0, 0x05, 0xc1, 0x0c, 0xc1, 0x00, 0xca, 0x3b, 0xc0, 0x00, 0xc0, 0x3b,
+  0xc1, 0x65, 0x6e, 0xc0, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0xc0, 0x34, 0x2f, 0xc2, 0x34, 0x2f, 0xc5,
+  0x34, 0x2f, 0x34, 0xc2, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0xcb, 0x34, 0x2f, 0x34, 0x2f, 0xc0, 0x34,
+  0xc3, 0x2f, 0xc0, 0x3b, 0xc1, 0x34, 0x3b, 0x34, 0x3b, 0xc3, 0x00, 0xc1, 0x3b, 0xc4, 0x2f, 0x34,
+  0xc0, 0x3b, 0xc4, 0x00, 0xc2, 0x6b, 0x0c, 0x07, 0xc0, 0x00, 0xc5, 0x07, 0x00, 0x07, 0x00, 0xc1,
+  0x07, 0x00, 0xc3, 0x3b, 0xc0, 0x00, 0xc5, 0x0c, 0x05, 0x07, 0xc8, 0x00, 0xc0, 0x07, 0x00, 0x07,
+  0x00, 0xc0, 0x07, 0xc7, 0x0c, 0xc0, 0x07, 0x0c, 0x07, 0xc2, 0x0c, 0xc3, 0x6f, 0xc5, 0x6e, 0x18,
+  0xc0, 0x69, 0xc0, 0x18, 0xc4, 0x1d, 0x18, 0xc5, 0x66, 0x18, 0xe2, 0x1d, 0x6b, 0x1d, 0xc0, 0x18,
+  0xd6, 0x1d, 0xc5, 0x24, 0xb2, 0x1c, 0x6e, 0xcd, 0x6e, 0xc0, 0x6b, 0xc0, 0x05, 0x0c, 0xca, 0x05,
+  0x0c, 0x05, 0xc1, 0x00, 0xcb, 0x3b, 0x00, 0xc1, 0x3b, 0x69, 0xc0, 0x66, 0x34, 0xc0, 0x2f, 0xc0,
+  0x34, 0xc0, 0x2f, 0xc0, 0x34, 0x2f, 0xc0, 0x34, 0x2f, 0xc7, 0x34, 0x2f, 0xc0, 0x34, 0x2f, 0xc0,
+  0x34, 0x2f, 0x34, 0x2f, 0xc1, 0x34, 0xc0, 0x2f, 0xc7, 0x34, 0x2f, 0x34, 0x2f, 0xc2, 0x34, 0xc3,
+  0x3b, 0x34, 0x3b, 0x34, 0xc0, 0x3b, 0xc4, 0x00, 0xc1, 0x3b, 0xc4, 0x34, 0x3b, 0xc6, 0x00, 0xc3,
+  0x6b, 0xc1, 0x0c, 0x07, 0x00, 0xc0, 0x3b, 0x00, 0xc2, 0x07, 0x00, 0xc6, 0x3b, 0x00, 0xc7, 0x07,
+  0xc6, 0x0c, 0x07, 0xc0, 0x00, 0x3b, 0x07, 0x00, 0xc3, 0x07, 0x00, 0xc0, 0x07, 0xc6, 0x0c, 0xc0,
+  0x07, 0xc2, 0x0c, 0xc1, 0x6b, 0xc0, 0x6e, 0xc9, 0x69, 0x18, 0xcb, 0x13, 0xc0, 0x18, 0xc3, 0x11,
+  0x18, 0xdd, 0x6e, 0xc1, 0x18, 0xd8, 0x1d, 0xc0, 0x18, 0xc0, 0x1d, 0x67, 0xb3, 0x1c, 0xc6, 0x6e,
+  0x00, 0xc5, 0x05, 0xc1, 0x6b, 0x05, 0x0c, 0xcc, 0x05, 0xc0, 0x00, 0xc9, 0x66, 0x00, 0xc3, 0x3b,
+  0xc1, 0x65, 0xc0, 0x6e, 0xc0, 0x2f, 0xc0, 0x34, 0x2f, 0xc0, 0x34, 0x2f, 0xc1, 0x34, 0x2f, 0xc7,
+  0x34, 0x2f, 0xc3, 0x34, 0x2f, 0xd1, 0x34, 0xca, 0x2f, 0xc3, 0x3b, 0x2f, 0x34, 0x3b, 0x00, 0xc0,
+  0x3b, 0xc2, 0x34, 0xc0, 0x3b, 0xc7, 0x00, 0xc1, 0x3b, 0xc0, 0x00, 0x0c, 0xc0, 0x66, 0x00, 0x3b,
+  0xc1, 0x00, 0xc2, 0x07, 0xc0, 0x00, 0xc5, 0x3b, 0x00, 0xc5, 0x07, 0x00, 0xc0, 0x07, 0xc1, 0x00,
+  0xc0, 0x07, 0xc3, 0x00, 0xc1, 0x07, 0x00, 0xc3, 0x07, 0xc0, 0x00, 0x07, 0xc0, 0x0c, 0xc0, 0x07,
+  0xc2, 0x0c, 0x07, 0xc1, 0x0c, 0xc3, 0x6b, 0xc0, 0x6d, 0xc1, 0x6b, 0xe4, 0x13, 0x18, 0xd3, 0x6e,
+  0xc1, 0x18, 0xd3, 0x13, 0x18, 0xc3, 0x1d, 0xc0, 0x18, 0xc1, 0xb3, 0x1c, 0xd1, 0x6e, 0xc0, 0x6b,
+  0xc2, 0x05, 0x0c, 0xc2, 0x05, 0xc0, 0x0c, 0xc1, 0x00, 0x05, 0x00, 0xcb, 0x66, 0x69, 0xc1, 0x3b,
+  0xc0, 0x34, 0x66, 0xc0, 0x34, 0xc0, 0x2f, 0xc2, 0x34, 0xc0, 0x2f, 0xcc, 0x7f, 0x2f, 0xd3, 0x34,
+  0x2f, 0xc0, 0x34, 0x2f, 0xc0, 0x34, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0x34, 0xc3, 0x2f, 0x3b, 0xda,
+  0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x3b, 0x00, 0x3b, 0x00, 0xc6, 0x6b, 0x00, 0xc2, 0x3b, 0xc2, 0x00,
+  0xc2, 0x07, 0x66, 0x3b, 0x00, 0xc1, 0x07, 0xc1, 0x00, 0xc3, 0x02, 0x00, 0x07, 0xc1, 0x00, 0xc1,
+  0x07, 0xc0, 0x00, 0xc0, 0x07, 0xc0, 0x0c, 0xc0, 0x07, 0xc5, 0x0c, 0xc6, 0x6e, 0x0c, 0x6f, 0xe3,
+  0x66, 0xc0, 0x18, 0xce, 0x6e, 0xc1, 0x18, 0x1d, 0xc2, 0x18, 0xc0, 0x6b, 0x18, 0xce, 0x13, 0xc0,
+  0x18, 0xc5, 0x1d, 0x18, 0xc1, 0xb3, 0x1c, 0xcc, 0x6b, 0x6e, 0x07, 0x00, 0xc1, 0x6e, 0x0c, 0xc8,
+  0x00, 0x0c, 0x07, 0xc0, 0x00, 0x05, 0x00, 0xcb, 0x66, 0xc0, 0x69, 0xc0, 0x3b, 0xc1, 0x65, 0x34,
+  0x2f, 0xc5, 0x34, 0x2f, 0x34, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0xdf, 0x34, 0x2f, 0xc5, 0x34, 0x2f,
+  0xc1, 0x34, 0xc0, 0x2f, 0x3b, 0xc0, 0x34, 0x3b, 0xd5, 0x00, 0xc3, 0x07, 0x00, 0xc4, 0x3b, 0x00,
+  0xc1, 0x3b, 0xc0, 0x00, 0xc4, 0x3b, 0xc1, 0x00, 0xc0, 0x3b, 0x00, 0x07, 0xc0, 0x3b, 0xc1, 0x00,
+  0x3b, 0xc0, 0x00, 0x07, 0x00, 0xc1, 0x3b, 0x00, 0xc0, 0x3b, 0x00, 0xc6, 0x07, 0xc7, 0x0c, 0xc6,
+  0x6e, 0x67, 0x0c, 0xc1, 0x11, 0x6b, 0xc8, 0x13, 0x18, 0xcb, 0x13, 0xc3, 0x18, 0xc1, 0x11, 0x18,
+  0xc1, 0x13, 0x18, 0xc7, 0x13, 0xc0, 0x18, 0xc4, 0x6e, 0xc1, 0x18, 0xc0, 0x1d, 0xc1, 0x18, 0xc6,
+  0x1d, 0x18, 0xca, 0x13, 0x18, 0xc8, 0xb3, 0x1c, 0xd1, 0x6f, 0xc1, 0x69, 0x0c, 0xc6, 0x05, 0x0c,
+  0x66, 0x0c, 0x00, 0x05, 0x00, 0xcb, 0x66, 0xc4, 0x69, 0xc1, 0x66, 0xc5, 0x34, 0x2f, 0xc3, 0x34,
+  0xc0, 0x2f, 0xde, 0x34, 0xc0, 0x2f, 0xc1, 0x34, 0xc3, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0xc1, 0x34,
+  0x3b, 0x66, 0x3b, 0xcf, 0x00, 0x3b, 0xc1, 0x00, 0xc2, 0x3b, 0x00, 0xc3, 0x3b, 0xc1, 0x00, 0xc1,
+  0x3b, 0xc0, 0x00, 0xc4, 0x3b, 0xc1, 0x00, 0xc0, 0x3b, 0x00, 0xc2, 0x3b, 0xc0, 0x00, 0xc0, 0x3b,
+  0x00, 0xc3, 0x3b, 0x00, 0xc0, 0x3b, 0x00, 0xc2, 0x3b, 0x00, 0xc2, 0x07, 0xc4, 0x0c, 0xc9, 0x6e,
+  0x0c, 0xc2, 0x11, 0x6b, 0xc6, 0x66, 0xc1, 0x18, 0xcb, 0x13, 0xc1, 0x0c, 0x18, 0xc3, 0x13, 0xc0,
+  0x18, 0xc0, 0x13, 0xc4, 0x18, 0xc9, 0x6e, 0xc1, 0x18, 0xc0, 0x1d, 0x18, 0xda, 0x1d, 0x18, 0xc2,
+  0xb3, 0x1c, 0xd1, 0x6f, 0xc7, 0x69, 0x0c, 0xc0, 0x05, 0xc0, 0x67, 0x0c, 0x00, 0xcd, 0x66, 0xc1,
+  0x69, 0xc0, 0x3b, 0x34, 0xc1, 0x66, 0xc7, 0x34, 0x2f, 0xc1, 0x34, 0x2f, 0xcd, 0x34, 0x2f, 0xcf,
+  0x34, 0x2f, 0xc4, 0x34, 0xc0, 0x2f, 0xc0, 0x34, 0x2f, 0x34, 0x3b, 0x2f, 0xc0, 0x34, 0x3b, 0x66,
+  0xc0, 0x3b, 0xc7, 0x00, 0xc0, 0x3b, 0xc0, 0x00, 0x3b, 0xc4, 0x00, 0xc1, 0x3b, 0xc2, 0x00, 0xc0,
+  0x3b, 0xc2, 0x00, 0xc0, 0x07, 0x00, 0x3b, 0x00, 0xc3, 0x07, 0x00, 0x3b, 0x00, 0xc0, 0x3b, 0xc0,
+  0x00, 0xcf, 0x3b, 0xc0, 0x00, 0xc1, 0x3b, 0x00, 0xc0, 0x07, 0x00, 0x07, 0xc4, 0x0c, 0xca, 0x6e,
+  0xc3, 0x6b, 0xc6, 0x66, 0xc1, 0x18, 0xcc, 0x13, 0x18, 0xc5, 0x0c, 0x18, 0xc0, 0x13, 0xc5, 0x18,
+  0xcf, 0x6b, 0x18, 0xda, 0x6e, 0xc1, 0x18, 0xb3, 0x1c, 0xc5, 0x66, 0x00, 0xc8, 0x6e, 0x6b, 0xc2,
+  0x05, 0x0c, 0xc2, 0x05, 0x0c, 0xc1, 0x05, 0xc1, 0x00, 0xcc, 0x3b, 0xc2, 0x6d, 0xc1, 0x62, 0x6e,
+  0xc0, 0x2f, 0xc1, 0x34, 0x2f, 0xc1, 0x34, 0xc1, 0x2f, 0xd1, 0x34, 0x2f, 0xcf, 0x34, 0x2f, 0xc4,
+  0x34, 0x2f, 0xc1, 0x34, 0xc2, 0x2f, 0xc0, 0x34, 0x2f, 0x6b, 0xc1, 0x3b, 0xc1, 0x34, 0xc0, 0x3b,
+  0xc2, 0x00, 0x3b, 0x00, 0x3b, 0xc5, 0x00, 0x3b, 0xc4, 0x00, 0xc1, 0x3b, 0xc1, 0x00, 0xc0, 0x6b,
+  0x00, 0xc0, 0x3b, 0xc2, 0x00, 0x07, 0x00, 0x3b, 0x00, 0x3b, 0xc0, 0x00, 0xc1, 0x07, 0x00, 0xc7,
+  0x07, 0x00, 0xc4, 0x3b, 0xc0, 0x00, 0xc2, 0x07, 0xc1, 0x00, 0x07, 0xc5, 0x0c, 0xc0, 0x07, 0x0c,
+  0x07, 0x0c, 0xc2, 0x6e, 0xc0, 0x0c, 0x11, 0x0c, 0x6f, 0xc6, 0x0c, 0xc0, 0x6b, 0xc0, 0x18, 0xc9,
+  0x13, 0x18, 0xc3, 0x13, 0xc1, 0x18, 0xc3, 0x13, 0xc4, 0x18, 0xc5, 0x13, 0x18, 0xc7, 0x6b, 0x18,
+  0xd2, 0x13, 0x18, 0xc3, 0x13, 0x18, 0xc3, 0xb3, 0x1c, 0xc4, 0x66, 0xc0, 0x00, 0xc8, 0x6e, 0x6b,
+  0xc2, 0x05, 0xc0, 0x0c, 0xc4, 0x05, 0xc2, 0x00, 0xc1, 0x05, 0xc0, 0x00, 0xc7, 0x3b, 0xc1, 0x00,
+  0x69, 0xc1, 0x62, 0xc8, 0x6e, 0x2f, 0xcc, 0x34, 0xc0, 0x2f, 0xc3, 0x34, 0x2f, 0xd9, 0x34, 0x2f,
+  0x34, 0xc1, 0x2f, 0xc0, 0x34, 0x3b, 0x66, 0x3b, 0x2f, 0x3b, 0xc1, 0x34, 0xc0, 0x2f, 0xc1, 0x3b,
+  0xc1, 0x00, 0x3b, 0xc3, 0x00, 0xc0, 0x3b, 0xc4, 0x00, 0xc2, 0x3b, 0xc0, 0x00, 0x3b, 0xc0, 0x00,
+  0xc4, 0x3b, 0x00, 0xc1, 0x3b, 0xc5, 0x00, 0xc1, 0x3b, 0x00, 0xc6, 0x3b, 0xc0, 0x00, 0xc2, 0x3b,
+  0x00, 0xc3, 0x6b, 0xcb, 0x0c, 0x07, 0xc0, 0x0c, 0xc0, 0x6e, 0xc0, 0x0c, 0xc1, 0x11, 0x6b, 0xc5,
+  0x66, 0xc2, 0x0c, 0x13, 0x18, 0xce, 0x13, 0xc2, 0x18, 0xc3, 0x13, 0xc2, 0x18, 0xcb, 0x6e, 0xc0,
+  0x18, 0xc3, 0x6b, 0x18, 0xcc, 0x13, 0x18, 0xc3, 0x13, 0x18, 0xc0, 0x13, 0x18, 0xc4, 0xb3, 0x1c,
+  0xce, 0x6e, 0x00, 0xc0, 0x6f, 0xc0, 0x05, 0xc2, 0x0c, 0xc2, 0x05, 0x0c, 0x05, 0x0c, 0xc0, 0x05,
+  0x00, 0xc0, 0x05, 0x00, 0xc7, 0x66, 0xc3, 0x00, 0xc0, 0x3b, 0x69, 0xc0, 0x66, 0xc7, 0x34, 0xc0,
+  0x2f, 0xcd, 0x34, 0xc0, 0x2f, 0xc1, 0x34, 0x2f, 0xd7, 0x34, 0xc1, 0x2f, 0xc0, 0x34, 0xc0, 0x2f,
+  0xc0, 0x34, 0x2f, 0xc0, 0x3b, 0xc0, 0x34, 0x3b, 0xc0, 0x2f, 0xc1, 0x34, 0xc0, 0x3b, 0xc7, 0x00,
+  0xc0, 0x3b, 0xc4, 0x00, 0xc3, 0x3b, 0x00, 0xc5, 0x3b, 0xc2, 0x00, 0xc0, 0x3b, 0xc6, 0x00, 0x3b,
+  0xc5, 0x00, 0xc1, 0x3b, 0xc0, 0x00, 0xc1, 0x3b, 0x00, 0xc5, 0x6b, 0xc4, 0x00, 0x07, 0x0c, 0xc1,
+  0x07, 0x0c, 0x07, 0xc0, 0x0c, 0xc4, 0x6e, 0xc0, 0x67, 0x6e, 0xc4, 0x13, 0x0c, 0xc2, 0x18, 0xce,
+  0x11, 0x13, 0xc3, 0x18, 0xc4, 0x13, 0xc0, 0x18, 0xc7, 0x13, 0x18, 0xc1, 0x6e, 0x18, 0xd2, 0x13,
+  0x18, 0xc4, 0x13, 0x18, 0x13, 0x18, 0xc4, 0x13, 0xb3, 0x1c, 0xd1, 0x6f, 0xc2, 0x6e, 0x65, 0xc0,
+  0x0c, 0xc1, 0x05, 0x0c, 0xc0, 0x11, 0x0c, 0x66, 0x00, 0xc0, 0x0c, 0xc0, 0x05, 0xc1, 0x00, 0xc2,
+  0x66, 0xc4, 0x00, 0xc0, 0x3b, 0xc0, 0x69, 0x66, 0xd8, 0x34, 0xc0, 0x2f, 0xd3, 0x34, 0x2f, 0xc5,
+  0x34, 0xc1, 0x2f, 0xc1, 0x34, 0x2f, 0xc0, 0x34, 0xc0, 0x2f, 0x3b, 0x34, 0x2f, 0xc5, 0x34, 0x2f,
+  0x3b, 0xc5, 0x00, 0xc9, 0x3b, 0x00, 0xc7, 0x3b, 0xc9, 0x00, 0x3b, 0xc9, 0x00, 0xc1, 0x3b, 0xc1,
+  0x00, 0x3b, 0xc2, 0x00, 0xc6, 0x0c, 0xc0, 0x00, 0x07, 0xc2, 0x0c, 0x07, 0xc2, 0x0c, 0xc3, 0x11,
+  0xc0, 0x0c, 0xc2, 0x6f, 0xc0, 0x11, 0x18, 0x66, 0x0c, 0xc0, 0x13, 0xc0, 0x18, 0xc6, 0x13, 0x18,
+  0xc5, 0x11, 0x13, 0xc3, 0x18, 0xc0, 0x0c, 0x18, 0xc0, 0x13, 0xc1, 0x18, 0xe0, 0x13, 0x18, 0xc1,
+  0x13, 0x18, 0xc5, 0x13, 0x18, 0xc2, 0xb3, 0x1c, 0xce, 0x6e, 0xc0, 0x6b, 0xc0, 0x05, 0xc0, 0x6f,
+  0x69, 0x05, 0xc1, 0x0c, 0xc0, 0x05, 0xc0, 0x0c, 0x05, 0x00, 0x6b, 0x00, 0xc0, 0x0c, 0x07, 0x00,
+  0xc0, 0x05, 0xc0, 0x00, 0xc1, 0x66, 0xc4, 0x00, 0xc0, 0x3b, 0x65, 0xc0, 0x6e, 0x2f, 0xc4, 0x34,
+  0xc0, 0x2f, 0xce, 0x34, 0x2f, 0xc2, 0x34, 0x2f, 0xce, 0x34, 0x2f, 0xcb, 0x34, 0x2f, 0x34, 0x2f,
+  0x34, 0xc1, 0x3b, 0xc0, 0x34, 0xc1, 0x2f, 0xc3, 0x34, 0x2f, 0x34, 0xc0, 0x3b, 0xc3, 0x00, 0xc0,
+  0x3b, 0x00, 0xd0, 0x3b, 0xc0, 0x00, 0x3b, 0xd2, 0x00, 0xc1, 0x3b, 0xc2, 0x00, 0x3b, 0xc1, 0x07,
+  0x00, 0xc1, 0x07, 0xc0, 0x00, 0xc0, 0x07, 0x0c, 0x07, 0xc0, 0x00, 0x07, 0xc1, 0x00, 0x07, 0xc1,
+  0x0c, 0xc3, 0x11, 0x0c, 0xc1, 0x6b, 0x6e, 0xc0, 0x11, 0xc1, 0x13, 0x0c, 0xc1, 0x13, 0x18, 0x0c,
+  0x18, 0xc3, 0x13, 0x0c, 0x18, 0xc4, 0x0c, 0x11, 0x13, 0x18, 0x0c, 0xc0, 0x13, 0x18, 0xc3, 0x13,
+  0xc2, 0x18, 0xda, 0x13, 0x18, 0xc0, 0x13, 0x18, 0x13, 0x18, 0xc1, 0x13, 0x18, 0xc0, 0x13, 0x18,
+  0xc7,
+};
+
+const splash_rle_t sea_rle = {
+    .w = 320,
+    .h = 480,
+    .rows = sea_rle_rows,
+    .data = sea_rle_data,
+};
@@ -0,0 +1,85 @@
+// ---------------------------------------------------------------- //
+// This file is autogenerated by pioasm version 2.2.0; do not edit! //
+// ---------------------------------------------------------------- //
+
+#pragma once
+
+#if !PICO_NO_HARDWARE
+#include "hardware/pio.h"
+#endif
+
+// ---------- //
+// st7796_lcd //
+// ---------- //
+
+#define st7796_lcd_wrap_target 0
+#define st7796_lcd_wrap 18
+#define st7796_lcd_pio_version 0
+
+static const uint16_t st7796_lcd_program_instructions[] = {
+            //     .wrap_target
+    0x80a0, //  0: pull   block           side 0
+    0x6021, //  1: out    x, 1            side 0
+    0x0025, //  2: jmp    !x, 5           side 0
+    0xe002, //  3: set    pins, 2         side 0
+    0x0006, //  4: jmp    6               side 0
+    0xe000, //  5: set    pins, 0         side 0
+    0x6021, //  6: out    x, 1            side 0
+    0x0030, //  7: jmp    !x, 16          side 0
+    0x60c5, //  8: out    isr, 5          side 0
+    0x6059, //  9: out    y, 25           side 0
+    0x80a0, // 10: pull   block           side 0
+    0xa026, // 11: mov    x, isr          side 0
+    0x6001, // 12: out    pins, 1         side 0
+    0x104c, // 13: jmp    x--, 12         side 1
+    0x008a, // 14: jmp    y--, 10         side 0
+    0x0000, // 15: jmp    0               side 0
+    0xe027, // 16: set    x, 7            side 0
+    0x6001, // 17: out    pins, 1         side 0
+    0x1051, // 18: jmp    x--, 17         side 1
+            //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program st7796_lcd_program = {
+    .instructions = st7796_lcd_program_instructions,
+    .length = 19,
+    .origin = -1,
+    .pio_version = st7796_lcd_pio_version,
+#if PICO_PIO_VERSION > 0
+    .used_gpio_ranges = 0x0
+#endif
+};
+
+static inline pio_sm_config st7796_lcd_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + st7796_lcd_wrap_target, offset + st7796_lcd_wrap);
+    sm_config_set_sideset(&c, 1, false, false);
+    return c;
+}
+
+#include "hardware/clocks.h"
+static inline void st7796_lcd_program_init(PIO pio, uint sm, uint offset, uint pin_clk, uint pin_mosi, uint pin_cs, float clk_div) {
+    uint pin_dc = pin_cs + 1;
+    // Idle levels before handing the pins to PIO: SCLK low, CS and DC high
+    pio_sm_set_pins_with_mask(pio, sm, (1u << pin_cs) | (1u << pin_dc),
+                              (1u << pin_clk) | (1u << pin_mosi) | (1u << pin_cs) | (1u << pin_dc));
+    pio_sm_set_consecutive_pindirs(pio, sm, pin_clk, 1, true);
+    pio_sm_set_consecutive_pindirs(pio, sm, pin_mosi, 1, true);
+    pio_sm_set_consecutive_pindirs(pio, sm, pin_cs, 2, true);
+    pio_gpio_init(pio, pin_clk);
+    pio_gpio_init(pio, pin_mosi);
+    pio_gpio_init(pio, pin_cs);
+    pio_gpio_init(pio, pin_dc);
+    pio_sm_config c = st7796_lcd_program_get_default_config(offset);
+    sm_config_set_sideset_pins(&c, pin_clk);
+    sm_config_set_out_pins(&c, pin_mosi, 1);
+    sm_config_set_set_pins(&c, pin_cs, 2);
+    sm_config_set_out_shift(&c, false, false, 32);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    sm_config_set_clkdiv(&c, clk_div);
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+#endif
@@ -12,16 +12,74 @@
 #include "gt911.h"
 #include "hardware/i2c.h"
 #include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/dma.h"
 #include "pico/stdlib.h"
 #include <string.h>
 
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/**********************
+ *      DEFINES
+ **********************/
+/* I2C interrupt of GT911_I2C_PORT */
+#define GT911_I2C_IRQ               (I2C0_IRQ + i2c_hw_index(GT911_I2C_PORT))
+
+/* Longest transaction in command words: the configuration write (address, block, checksum, fresh flag) */
+#define GT911_I2C_XFER_MAX          (2 + GT911_CONFIG_LEN + 2)
+
+/* Ticks a task waits for a completion due in us: rounded up, plus the tick in progress */
+#define GT911_I2C_TICKS(us)         (pdMS_TO_TICKS(((us) + 999) / 1000) + 1)
+
+/* Half SCL period of the bus recovery clocks (~100 kHz) */
+#define GT911_I2C_RECOVER_HALF_US   5
+
+/* Settle time after a new configuration block before the next access (ms) */
+#define GT911_CONFIG_APPLY_MS       10
+
+/* Offset of a configuration register in the block */
+#define GT911_CFG(reg)              ((reg) - GT911_REG_CONFIG_VERSION)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief I2C transaction state
+ */
+typedef enum {
+    GT911_XFER_IDLE = 0,
+    GT911_XFER_BUSY,            // Submitted, DMA feeds the controller
+    GT911_XFER_DONE,            // STOP seen, all bytes transferred
+    GT911_XFER_ERROR,           // NAK or abort
+} gt911_xfer_state_t;
+
+/**
+ * @brief Transaction completion, called from the I2C interrupt
+ * @param ok true if every byte was transferred
+ */
+typedef void (*gt911_xfer_cb_t)(bool ok, void *ctx);
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool gt911_i2c_init(void);
+static bool gt911_i2c_hw_init(void);
+static bool gt911_i2c_xfer(const uint8_t *tx, uint32_t tx_len, uint8_t *rx, uint32_t rx_len);
+static void gt911_i2c_submit(const uint8_t *tx, uint32_t tx_len, uint8_t *rx, uint32_t rx_len,
+                             gt911_xfer_cb_t cb, void *ctx);
+static void gt911_i2c_cancel(void);
+static uint32_t gt911_i2c_deadline_us(uint32_t tx_len, uint32_t rx_len);
+static void gt911_i2c_wake(bool ok, void *ctx);
+static void gt911_i2c_irq_handler(void);
+static void gt911_i2c_recover(void);
 static bool gt911_i2c_read_reg(uint16_t reg, uint8_t *data, uint8_t len);
-static bool gt911_i2c_write_reg(uint16_t reg, uint8_t *data, uint8_t len);
+static bool gt911_i2c_write_reg(uint16_t reg, const uint8_t *data, uint8_t len);
 static void gt911_clear_status(void);
+static void gt911_irq_handler(void);
+static bool gt911_config_read(void);
+static uint8_t gt911_config_checksum(const uint8_t *block);
 
 /**********************
  *  STATIC VARIABLES
@@ -34,6 +92,31 @@ static gt911_dev_t gt911_dev = {
     .i2c_addr = GT911_I2C_ADDR
 };
 
+/* New touch frame callback and the INT edge that reports a frame (gt911_irq_enable) */
+static gt911_irq_cb_t gt911_irq_cb = NULL;
+static uint32_t gt911_int_edge = GT911_INT_EVENTS;
+
+/* Bus statistics */
+static gt911_stats_t gt911_stats;
+
+/* Configuration write transaction: register address, block, checksum, fresh flag */
+static uint8_t gt911_cfg[2 + GT911_CONFIG_LEN + 2];
+
+/* Current I2C transaction, shared with gt911_i2c_irq_handler() */
+static uint16_t xfer_cmd[GT911_I2C_XFER_MAX];      // DATA_CMD words: writes, then one read command per byte
+static uint32_t xfer_rx_len = 0;
+static bool xfer_aborted = false;                   // TX_ABRT seen, waiting for its STOP
+static gt911_xfer_cb_t xfer_cb = NULL;
+static void *xfer_ctx = NULL;
+static volatile gt911_xfer_state_t xfer_state = GT911_XFER_IDLE;
+
+/* DMA channels feeding DATA_CMD and draining received bytes */
+static int xfer_tx_chan = -1;
+static int xfer_rx_chan = -1;
+
+/* Given by the completion interrupt to the waiting task */
+static SemaphoreHandle_t xfer_done = NULL;
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -44,7 +127,7 @@ static gt911_dev_t gt911_dev = {
  */
 bool gt911_init(void)
 {
-    uint8_t data;
+    uint8_t info[GT911_INFO_LEN];
     
     // Prevent duplicate initialization
     if (gt911_dev.initialized) {
@@ -56,49 +139,26 @@ bool gt911_init(void)
         return false;
     }
     
-    // 2. Try to read Product ID to verify communication
-    if (!gt911_i2c_read_reg(GT911_REG_PRODUCT_ID1, &data, 1)) {
+    // 2. Read the whole info block in one transaction, also verifies communication
+    // 0x8140-0x8143: Product ID (4 ASCII bytes), example: GT911 returns "911" (0x39, 0x31, 0x31)
+    // 0x8144-0x8145: Firmware version
+    // 0x8146-0x8149: X/Y resolution (16-bit, low byte first)
+    // 0x814A:        Vendor ID
+    if (!gt911_i2c_read_reg(GT911_REG_PRODUCT_ID1, info, sizeof(info))) {
         return false;  // I2C communication failed
     }
     
-    // 3. Read complete Product ID (4 ASCII bytes)
-    // Example: GT911 returns "911" (0x39, 0x31, 0x31)
-    for (int i = 0; i < GT911_PRODUCT_ID_LEN; i++) {
-        if (!gt911_i2c_read_reg(GT911_REG_PRODUCT_ID1 + i, (uint8_t *)&gt911_dev.product_id[i], 1)) {
-            return false;
-        }
-    }
+    // 3. Product ID
+    memcpy(gt911_dev.product_id, &info[GT911_REG_PRODUCT_ID1 - GT911_REG_PRODUCT_ID1], GT911_PRODUCT_ID_LEN);
     gt911_dev.product_id[GT911_PRODUCT_ID_LEN] = '\0';  // Null terminator
     
-    // 4. Read Vendor ID (optional, for verification)
-    if (!gt911_i2c_read_reg(GT911_REG_VENDOR_ID, &data, 1)) {
-        return false;
-    }
-    
-    // 5. Read touchscreen resolution configuration
-    // X resolution (16-bit, low byte first)
-    if (!gt911_i2c_read_reg(GT911_REG_X_RES_L, &data, 1)) {
-        return false;
-    }
-    gt911_dev.max_x = data;
+    // 4. Touchscreen resolution configuration
+    gt911_dev.max_x = info[GT911_REG_X_RES_L - GT911_REG_PRODUCT_ID1] |
+                      ((uint16_t)info[GT911_REG_X_RES_H - GT911_REG_PRODUCT_ID1] << 8);
+    gt911_dev.max_y = info[GT911_REG_Y_RES_L - GT911_REG_PRODUCT_ID1] |
+                      ((uint16_t)info[GT911_REG_Y_RES_H - GT911_REG_PRODUCT_ID1] << 8);
     
-    if (!gt911_i2c_read_reg(GT911_REG_X_RES_H, &data, 1)) {
-        return false;
-    }
-    gt911_dev.max_x |= ((uint16_t)data << 8);
-    
-    // Y resolution (16-bit, low byte first)
-    if (!gt911_i2c_read_reg(GT911_REG_Y_RES_L, &data, 1)) {
-        return false;
-    }
-    gt911_dev.max_y = data;
-    
-    if (!gt911_i2c_read_reg(GT911_REG_Y_RES_H, &data, 1)) {
-        return false;
-    }
-    gt911_dev.max_y |= ((uint16_t)data << 8);
-    
-    // 6. Initialization complete
+    // 5. Initialization complete
     gt911_dev.initialized = true;
     
     return true;
@@ -110,75 +170,116 @@ bool gt911_init(void)
  * @param y Output parameter: Y coordinate
  * @param pressed Output parameter: Touch state
  * @return true on success, false on failure
+ * @note First point of gt911_read_points(), the last coordinates are kept after release
  */
 bool gt911_read_touch(uint16_t *x, uint16_t *y, bool *pressed)
 {
-    uint8_t status_reg;
-    uint8_t data;
     static uint16_t last_x = 0;  // Save last coordinates
     static uint16_t last_y = 0;
+    gt911_touch_t touch;
+    
+    if (!gt911_read_points(&touch)) {
+        return false;
+    }
+    
+    if (touch.count > 0) {
+        last_x = touch.points[0].x;
+        last_y = touch.points[0].y;
+    }
+    
+    *x = last_x;
+    *y = last_y;
+    *pressed = (touch.count > 0);
+    
+    return true;
+}
+
+/**
+ * @brief Read all touch points
+ * @param touch Output: the latest frame
+ * @return true on success, false on failure
+ * @note One burst read of the status register and the first point. Only when the GT911
+ *       reports more points are the rest read, in a second burst right behind the first.
+ *       Until the GT911 has a new frame (status bit7 clear) the previous frame is reported.
+ */
+bool gt911_read_points(gt911_touch_t *touch)
+{
+    uint8_t buf[1 + GT911_MAX_POINTS * GT911_POINT_SIZE];
+    static gt911_touch_t last = {0};  // Last frame read
     
     // Check if initialized
     if (!gt911_dev.initialized) {
         return false;
     }
     
-    // 1. Read status register
-    if (!gt911_i2c_read_reg(GT911_REG_STATUS, &status_reg, 1)) {
+    // 1. Read status register and first touch point in one transaction
+    if (!gt911_i2c_read_reg(GT911_REG_STATUS, buf, GT911_TOUCH_LEN)) {
         return false;
     }
+    uint8_t status_reg = buf[0];
     
-    // 2. Get touch point count (lower 4 bits)
-    uint8_t touch_count = status_reg & GT911_STATUS_PT_MASK;
-    
-    // 3. Check if data is ready and clear status register
+    // 2. New frame: parse it and clear the status register
     // bit7=1 indicates new touch data, need to clear status register after reading
-    if ((status_reg & GT911_STATUS_BUF_READY) || (touch_count < 6)) {
-        gt911_clear_status();  // Clear status to tell GT911 we have read the data
-    }
-    
-    // 4. Process touch data
-    if (touch_count == 1) {
-        // Single touch: read first touch point coordinates
-        
-        // Read X coordinate (16-bit, low byte first)
-        if (!gt911_i2c_read_reg(GT911_REG_PT1_X_L, &data, 1)) {
-            return false;
+    if (status_reg & GT911_STATUS_BUF_READY) {
+        // Get touch point count (lower 4 bits), up to 5 points
+        uint8_t touch_count = status_reg & GT911_STATUS_PT_MASK;
+        if (touch_count > GT911_MAX_POINTS) {
+            touch_count = 0;  // Invalid count, treat as released
         }
-        last_x = data;
         
-        if (!gt911_i2c_read_reg(GT911_REG_PT1_X_H, &data, 1)) {
-            return false;
+        // Points 2-5 follow point 1 back to back
+        if (touch_count > 1 &&
+            !gt911_i2c_read_reg(GT911_REG_TRACK_ID1 + GT911_POINT_SIZE, &buf[GT911_TOUCH_LEN],
+                                (touch_count - 1) * GT911_POINT_SIZE)) {
+            return false;  // Status stays set, the frame is read again next time
         }
-        last_x |= ((uint16_t)data << 8);
         
-        // Read Y coordinate (16-bit, low byte first)
-        if (!gt911_i2c_read_reg(GT911_REG_PT1_Y_L, &data, 1)) {
-            return false;
+        // Each point: track ID, X, Y, size (16-bit, low byte first), reserved
+        const uint8_t *pt = &buf[GT911_REG_TRACK_ID1 - GT911_REG_STATUS];
+        for (uint8_t i = 0; i < touch_count; i++, pt += GT911_POINT_SIZE) {
+            last.points[i].id = pt[0];
+            last.points[i].x = pt[1] | ((uint16_t)pt[2] << 8);
+            last.points[i].y = pt[3] | ((uint16_t)pt[4] << 8);
+            last.points[i].size = pt[5] | ((uint16_t)pt[6] << 8);
         }
-        last_y = data;
+        last.count = touch_count;
+        last.frame++;
         
-        if (!gt911_i2c_read_reg(GT911_REG_PT1_Y_H, &data, 1)) {
-            return false;
-        }
-        last_y |= ((uint16_t)data << 8);
-        
-        // Set output parameters
-        *x = last_x;
-        *y = last_y;
-        *pressed = true;
-        
-    } else {
-        // No touch or multi-touch (multi-touch not supported yet)
-        // Return last coordinates with released state
-        *x = last_x;
-        *y = last_y;
-        *pressed = false;
+        gt911_clear_status();  // Clear status to tell GT911 we have read the data
     }
     
+    // 3. Set output parameter
+    *touch = last;
+    
     return true;
 }
 
+/**
+ * @brief Report new touch frames through the INT pin
+ * @param cb Called from the GPIO interrupt once per new frame
+ */
+void gt911_irq_enable(gt911_irq_cb_t cb)
+{
+    uint8_t trigger;
+    
+    // 1. INT is an output of the GT911 once it has booted, no pulls needed
+    gpio_init(GT911_PIN_INT);
+    gpio_set_dir(GT911_PIN_INT, GPIO_IN);
+    gpio_disable_pulls(GT911_PIN_INT);
+    
+    // 2. The edge that starts the configured pulse (or level): rising for 0 / 3, falling for 1 / 2
+    if (gt911_dev.initialized && gt911_i2c_read_reg(GT911_REG_MODULE_SWITCH1, &trigger, 1)) {
+        trigger &= 0x03;
+        gt911_int_edge = (trigger == 1 || trigger == 2) ? GPIO_IRQ_EDGE_FALL : GPIO_IRQ_EDGE_RISE;
+    }
+    
+    // 3. Raw handler: main.c's buttons use the shared per-core GPIO callback
+    gt911_irq_cb = cb;
+    gpio_add_raw_irq_handler(GT911_PIN_INT, gt911_irq_handler);
+    gpio_set_irq_enabled(GT911_PIN_INT, gt911_int_edge, true);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
 /**
  * @brief Get device information
  * @return Pointer to device information structure
@@ -188,6 +289,90 @@ gt911_dev_t* gt911_get_dev_info(void)
     return &gt911_dev;
 }
 
+/**
+ * @brief Read and validate the configuration block
+ * @param cfg Output: tunable settings
+ * @return false on I2C failure or a bad checksum
+ */
+bool gt911_config_get(gt911_config_t *cfg)
+{
+    const uint8_t *block = &gt911_cfg[2];
+    
+    if (!gt911_dev.initialized || !gt911_config_read()) {
+        return false;
+    }
+    
+    cfg->version = block[0];
+    cfg->report_ms = GT911_REPORT_MS_MIN + (block[GT911_CFG(GT911_REG_REFRESH_RATE)] & 0x0F);
+    cfg->touch_level = block[GT911_CFG(GT911_REG_TOUCH_LEVEL)];
+    cfg->leave_level = block[GT911_CFG(GT911_REG_LEAVE_LEVEL)];
+    cfg->noise_reduction = block[GT911_CFG(GT911_REG_NOISE_REDUCTION)] & 0x0F;
+    
+    return true;
+}
+
+/**
+ * @brief Change the configuration block
+ * @param cfg Settings to apply (version is ignored)
+ * @return true if the block now holds these settings
+ * @note The GT911 stores every new block, so unchanged settings are never written
+ */
+bool gt911_config_set(const gt911_config_t *cfg)
+{
+    uint8_t *block = &gt911_cfg[2];
+    
+    if (!gt911_dev.initialized ||
+        cfg->report_ms < GT911_REPORT_MS_MIN || cfg->report_ms > GT911_REPORT_MS_MAX ||
+        cfg->noise_reduction > 0x0F || cfg->leave_level >= cfg->touch_level) {
+        return false;
+    }
+    
+    // 1. Start from the block the GT911 holds, never from one that failed its checksum
+    if (!gt911_config_read()) {
+        return false;
+    }
+    
+    // 2. Patch the tunables, keeping the other bits of their registers
+    uint8_t refresh = (block[GT911_CFG(GT911_REG_REFRESH_RATE)] & 0xF0) | (cfg->report_ms - GT911_REPORT_MS_MIN);
+    uint8_t noise = (block[GT911_CFG(GT911_REG_NOISE_REDUCTION)] & 0xF0) | cfg->noise_reduction;
+    
+    if (block[GT911_CFG(GT911_REG_REFRESH_RATE)] == refresh &&
+        block[GT911_CFG(GT911_REG_NOISE_REDUCTION)] == noise &&
+        block[GT911_CFG(GT911_REG_TOUCH_LEVEL)] == cfg->touch_level &&
+        block[GT911_CFG(GT911_REG_LEAVE_LEVEL)] == cfg->leave_level) {
+        return true;  // Already set, don't wear the GT911's flash
+    }
+    
+    block[GT911_CFG(GT911_REG_REFRESH_RATE)] = refresh;
+    block[GT911_CFG(GT911_REG_NOISE_REDUCTION)] = noise;
+    block[GT911_CFG(GT911_REG_TOUCH_LEVEL)] = cfg->touch_level;
+    block[GT911_CFG(GT911_REG_LEAVE_LEVEL)] = cfg->leave_level;
+    
+    // 3. Same version (a lower one is rejected), new checksum, fresh flag: one transaction
+    gt911_cfg[0] = (GT911_REG_CONFIG_VERSION >> 8) & 0xFF;
+    gt911_cfg[1] = GT911_REG_CONFIG_VERSION & 0xFF;
+    block[GT911_CONFIG_LEN] = gt911_config_checksum(block);
+    block[GT911_CONFIG_LEN + 1] = 1;
+    
+    if (!gt911_i2c_xfer(gt911_cfg, sizeof(gt911_cfg), NULL, 0)) {
+        return false;
+    }
+    
+    sleep_ms(GT911_CONFIG_APPLY_MS);
+    return true;
+}
+
+/**
+ * @brief Get I2C bus statistics
+ * @param stats Output: counters since boot
+ */
+void gt911_get_stats(gt911_stats_t *stats)
+{
+    if (stats != NULL) {
+        *stats = gt911_stats;
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -198,18 +383,20 @@ gt911_dev_t* gt911_get_dev_info(void)
  */
 static bool gt911_i2c_init(void)
 {
-    // 1. Initialize I2C peripheral, set baudrate to 100kHz
-    uint32_t actual_baudrate = i2c_init(GT911_I2C_PORT, GT911_I2C_BAUDRATE);
-    
-    if (actual_baudrate == 0) {
+    // 1. Initialize I2C peripheral, the DMA channels and the completion interrupt
+    if (!gt911_i2c_hw_init()) {
         return false;  // I2C initialization failed
     }
+    xfer_tx_chan = dma_claim_unused_channel(true);
+    xfer_rx_chan = dma_claim_unused_channel(true);
+    xfer_done = xSemaphoreCreateBinary();
+    if (xfer_done == NULL) {
+        return false;
+    }
+    irq_set_exclusive_handler(GT911_I2C_IRQ, gt911_i2c_irq_handler);
+    irq_set_enabled(GT911_I2C_IRQ, true);
     
-    // 2. Configure GPIO pins for I2C function
-    gpio_set_function(GT911_PIN_SDA, GPIO_FUNC_I2C);
-    gpio_set_function(GT911_PIN_SCL, GPIO_FUNC_I2C);
-    
-    // 3. Enable internal pull-up resistors
+    // 2. Enable internal pull-up resistors
     // I2C bus requires pull-up resistors to work properly
     gpio_pull_up(GT911_PIN_SDA);
     gpio_pull_up(GT911_PIN_SCL);
@@ -220,6 +407,257 @@ static bool gt911_i2c_init(void)
     return true;
 }
 
+/**
+ * @brief Reset the I2C block and hand it the pins
+ * @return true on success, false on failure
+ * @note Also used after bus recovery, the reset clears any stuck controller state
+ */
+static bool gt911_i2c_hw_init(void)
+{
+    // 1. Reset and initialize I2C peripheral, set baudrate
+    uint32_t actual_baudrate = i2c_init(GT911_I2C_PORT, GT911_I2C_BAUDRATE);
+    
+    if (actual_baudrate == 0) {
+        return false;
+    }
+    
+    // 2. DMA handshakes are on after i2c_init(); STOP / abort interrupts unmasked per transaction
+    i2c_hw_t *hw = i2c_get_hw(GT911_I2C_PORT);
+    hw->rx_tl = 0;
+    hw->tx_tl = 0;
+    hw->intr_mask = 0;
+    
+    // 3. Configure GPIO pins for I2C function
+    gpio_set_function(GT911_PIN_SDA, GPIO_FUNC_I2C);
+    gpio_set_function(GT911_PIN_SCL, GPIO_FUNC_I2C);
+    
+    return true;
+}
+
+/**
+ * @brief Run one I2C transaction: write tx, then (repeated start) read rx
+ * @param tx Bytes to write (register address + data)
+ * @param tx_len Number of bytes to write, at least 1
+ * @param rx Read buffer (NULL if rx_len is 0)
+ * @param rx_len Number of bytes to read
+ * @return true on success, false on NAK, abort or timeout
+ * @note A task sleeps on the completion semaphore, before the scheduler runs (gt911_init() from
+ *       main()) the wait spins. Bounded by the transaction's bus time plus GT911_I2C_TIMEOUT_US,
+ *       a timeout or a held-down SDA triggers bus recovery.
+ */
+static bool gt911_i2c_xfer(const uint8_t *tx, uint32_t tx_len, uint8_t *rx, uint32_t rx_len)
+{
+    bool in_task = xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+    
+    if (tx_len == 0 || tx_len + rx_len > GT911_I2C_XFER_MAX) {
+        return false;
+    }
+    uint32_t deadline_us = gt911_i2c_deadline_us(tx_len, rx_len);
+    
+    // 1. Submit, completion gives the semaphore
+    gt911_i2c_submit(tx, tx_len, rx, rx_len, in_task ? gt911_i2c_wake : NULL, NULL);
+    
+    // 2. Wait for completion, bounded
+    if (in_task) {
+        xSemaphoreTake(xfer_done, GT911_I2C_TICKS(deadline_us));
+    } else {
+        absolute_time_t deadline = make_timeout_time_us(deadline_us);
+        while (xfer_state == GT911_XFER_BUSY && !time_reached(deadline)) {
+            tight_loop_contents();
+        }
+    }
+    
+    // 3. Timeout: stop the engine; a completion racing the timeout still counts
+    if (xfer_state == GT911_XFER_BUSY) {
+        gt911_i2c_cancel();
+    }
+    if (xfer_state == GT911_XFER_BUSY) {
+        xfer_state = GT911_XFER_IDLE;
+        gt911_stats.timeouts++;
+        gt911_i2c_recover();
+        return false;
+    }
+    if (in_task) {
+        xSemaphoreTake(xfer_done, 0);
+    }
+    
+    // 4. NAK / arbitration loss: a slave holding SDA low needs recovery, a NAK doesn't
+    if (xfer_state == GT911_XFER_ERROR) {
+        xfer_state = GT911_XFER_IDLE;
+        gt911_stats.errors++;
+        if (!gpio_get(GT911_PIN_SDA)) {
+            gt911_i2c_recover();
+        }
+        return false;
+    }
+    
+    xfer_state = GT911_XFER_IDLE;
+    return true;
+}
+
+/**
+ * @brief Start a transaction, the completion interrupt ends it
+ * @param cb Called from the interrupt when STOP is seen (NULL: poll xfer_state)
+ * @note Builds the DATA_CMD words (STOP on the last, RESTART on the first read command) and
+ *       hands both directions to DMA: the TX channel is paced by the TX FIFO, the RX channel
+ *       moves each received byte. No interrupt per byte.
+ */
+static void gt911_i2c_submit(const uint8_t *tx, uint32_t tx_len, uint8_t *rx, uint32_t rx_len,
+                             gt911_xfer_cb_t cb, void *ctx)
+{
+    i2c_hw_t *hw = i2c_get_hw(GT911_I2C_PORT);
+    uint32_t n = 0;
+    
+    // 1. Command words
+    for (uint32_t i = 0; i < tx_len; i++) {
+        xfer_cmd[n++] = tx[i];
+    }
+    for (uint32_t i = 0; i < rx_len; i++) {
+        xfer_cmd[n++] = I2C_IC_DATA_CMD_CMD_BITS | (i == 0 ? I2C_IC_DATA_CMD_RESTART_BITS : 0);
+    }
+    xfer_cmd[n - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    
+    xfer_rx_len = rx_len;
+    xfer_aborted = false;
+    xfer_cb = cb;
+    xfer_ctx = ctx;
+    xfer_state = GT911_XFER_BUSY;
+    gt911_stats.xfers++;
+    
+    // 2. Target, stale STOP / abort status cleared, completion interrupts on
+    hw->enable = 0;
+    hw->tar = gt911_dev.i2c_addr;
+    hw->enable = 1;
+    (void)hw->clr_intr;
+    hw->intr_mask = I2C_IC_INTR_MASK_M_TX_ABRT_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS;
+    
+    // 3. RX first, so no received byte waits for its channel
+    if (rx_len > 0) {
+        dma_channel_config c = dma_channel_get_default_config(xfer_rx_chan);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, true);
+        channel_config_set_dreq(&c, i2c_get_dreq(GT911_I2C_PORT, false));
+        dma_channel_configure(xfer_rx_chan, &c, rx, &hw->data_cmd, rx_len, true);
+    }
+    
+    dma_channel_config c = dma_channel_get_default_config(xfer_tx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(GT911_I2C_PORT, true));
+    dma_channel_configure(xfer_tx_chan, &c, &hw->data_cmd, xfer_cmd, n, true);
+}
+
+/**
+ * @brief Stop a transaction that did not complete: no interrupt, no DMA
+ */
+static void gt911_i2c_cancel(void)
+{
+    i2c_get_hw(GT911_I2C_PORT)->intr_mask = 0;
+    dma_channel_abort(xfer_tx_chan);
+    dma_channel_abort(xfer_rx_chan);
+}
+
+/**
+ * @brief Completion deadline of a transaction
+ * @return Bus time of the address bytes (a second one before reading), the written and the read
+ *         bytes at 9 clocks each, plus GT911_I2C_TIMEOUT_US (us)
+ */
+static uint32_t gt911_i2c_deadline_us(uint32_t tx_len, uint32_t rx_len)
+{
+    uint32_t bytes = tx_len + rx_len + (rx_len > 0 ? 2 : 1);
+    
+    return (uint32_t)(((uint64_t)bytes * 9 * 1000000 + GT911_I2C_BAUDRATE - 1) / GT911_I2C_BAUDRATE) +
+           GT911_I2C_TIMEOUT_US;
+}
+
+/**
+ * @brief Completion callback of gt911_i2c_xfer(): wake the waiting task
+ */
+static void gt911_i2c_wake(bool ok, void *ctx)
+{
+    BaseType_t woken = pdFALSE;
+    
+    (void)ok;
+    (void)ctx;
+    xSemaphoreGiveFromISR(xfer_done, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief I2C interrupt handler: transaction complete (STOP) or aborted (NAK, then STOP)
+ */
+static void gt911_i2c_irq_handler(void)
+{
+    i2c_hw_t *hw = i2c_get_hw(GT911_I2C_PORT);
+    uint32_t stat = hw->intr_stat;
+    
+    // 1. Abort: the controller flushes the FIFO and sends STOP. DMA stops first, nothing may
+    //    refill the FIFO once the clear ends the flush; the transaction ends with the STOP.
+    if (stat & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        dma_channel_abort(xfer_tx_chan);
+        dma_channel_abort(xfer_rx_chan);
+        (void)hw->clr_tx_abrt;
+        hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS;
+        xfer_aborted = true;
+    }
+    if (!(stat & I2C_IC_INTR_STAT_R_STOP_DET_BITS)) {
+        return;
+    }
+    (void)hw->clr_stop_det;
+    
+    // 2. All bytes in: the RX channel moves the last one a few cycles after STOP
+    bool ok = !xfer_aborted;
+    if (ok && xfer_rx_len > 0) {
+        while (dma_channel_is_busy(xfer_rx_chan) && hw->rxflr > 0) {
+            tight_loop_contents();
+        }
+        ok = !dma_channel_is_busy(xfer_rx_chan);
+    }
+    
+    // 3. Engine off, report
+    gt911_i2c_cancel();
+    xfer_state = ok ? GT911_XFER_DONE : GT911_XFER_ERROR;
+    if (xfer_cb != NULL) {
+        xfer_cb(ok, xfer_ctx);
+    }
+}
+
+/**
+ * @brief Free a stuck bus: clock SCL until the slave releases SDA, then send STOP
+ * @note The pins are driven open-drain style (output low / input with pull-up),
+ *       afterwards the I2C block is reset and takes the pins back
+ */
+static void gt911_i2c_recover(void)
+{
+    gt911_stats.recoveries++;
+    
+    // 1. Pins to SIO, released (high through the pull-ups)
+    gpio_init(GT911_PIN_SDA);
+    gpio_init(GT911_PIN_SCL);
+    gpio_put(GT911_PIN_SDA, 0);
+    gpio_put(GT911_PIN_SCL, 0);
+    sleep_us(GT911_I2C_RECOVER_HALF_US);
+    
+    // 2. Up to 9 clocks: a slave in the middle of a read shifts out its byte and sees no ACK
+    for (int i = 0; i < 9 && !gpio_get(GT911_PIN_SDA); i++) {
+        gpio_set_dir(GT911_PIN_SCL, GPIO_OUT);
+        sleep_us(GT911_I2C_RECOVER_HALF_US);
+        gpio_set_dir(GT911_PIN_SCL, GPIO_IN);
+        sleep_us(GT911_I2C_RECOVER_HALF_US);
+    }
+    
+    // 3. STOP: SDA low to high while SCL is high
+    gpio_set_dir(GT911_PIN_SDA, GPIO_OUT);
+    sleep_us(GT911_I2C_RECOVER_HALF_US);
+    gpio_set_dir(GT911_PIN_SDA, GPIO_IN);
+    sleep_us(GT911_I2C_RECOVER_HALF_US);
+    
+    // 4. Fresh controller state
+    gt911_i2c_hw_init();
+}
+
 /**
  * @brief Read data from GT911 register
  * @param reg Register address (16-bit)
@@ -239,20 +677,8 @@ static bool gt911_i2c_read_reg(uint16_t reg, uint8_t *data, uint8_t len)
         reg & 0xFF          // Register address low byte
     };
     
-    // I2C read operation in two steps:
-    // 1. Write register address (keep bus, no STOP signal)
-    int ret = i2c_write_blocking(GT911_I2C_PORT, gt911_dev.i2c_addr, reg_addr, 2, true);
-    if (ret < 0) {
-        return false;  // Write failed
-    }
-    
-    // 2. Read data
-    ret = i2c_read_blocking(GT911_I2C_PORT, gt911_dev.i2c_addr, data, len, false);
-    if (ret < 0) {
-        return false;  // Read failed
-    }
-    
-    return true;
+    // Write register address, then read data after a repeated start
+    return gt911_i2c_xfer(reg_addr, 2, data, len);
 }
 
 /**
@@ -262,7 +688,7 @@ static bool gt911_i2c_read_reg(uint16_t reg, uint8_t *data, uint8_t len)
  * @param len Number of bytes to write
  * @return true on success, false on failure
  */
-static bool gt911_i2c_write_reg(uint16_t reg, uint8_t *data, uint8_t len)
+static bool gt911_i2c_write_reg(uint16_t reg, const uint8_t *data, uint8_t len)
 {
     if (data == NULL || len == 0) {
         return false;
@@ -271,7 +697,7 @@ static bool gt911_i2c_write_reg(uint16_t reg, uint8_t *data, uint8_t len)
     // Combine register address and data
     uint8_t buffer[32];  // Temporary buffer
     
-    if (len + 2 > sizeof(buffer)) {
+    if (len + 2u > sizeof(buffer)) {
         return false;  // Data too long
     }
     
@@ -283,9 +709,7 @@ static bool gt911_i2c_write_reg(uint16_t reg, uint8_t *data, uint8_t len)
     memcpy(&buffer[2], data, len);
     
     // Send data
-    int ret = i2c_write_blocking(GT911_I2C_PORT, gt911_dev.i2c_addr, buffer, len + 2, false);
-    
-    return (ret > 0);
+    return gt911_i2c_xfer(buffer, len + 2, NULL, 0);
 }
 
 /**
@@ -298,16 +722,48 @@ static void gt911_clear_status(void)
     // This tells GT911 chip: "I have read the touch data, you can prepare next frame"
     uint8_t clear_data = 0x00;
     
-    // Method 1: Use wrapped write register function
-    // gt911_i2c_write_reg(GT911_REG_STATUS, &clear_data, 1);
+    gt911_i2c_write_reg(GT911_REG_STATUS, &clear_data, 1);
+}
+
+/**
+ * @brief Read the configuration block and its checksum into gt911_cfg
+ * @return false on I2C failure or a bad checksum
+ */
+static bool gt911_config_read(void)
+{
+    uint8_t *block = &gt911_cfg[2];
     
-    // Method 2: Direct send (more efficient)
-    uint8_t buffer[3] = {
-        0x81,       // Register address high byte (0x814E >> 8)
-        0x4E,       // Register address low byte (0x814E & 0xFF)
-        0x00        // Clear data
-    };
+    if (!gt911_i2c_read_reg(GT911_REG_CONFIG_VERSION, block, GT911_CONFIG_LEN + 1)) {
+        return false;
+    }
+    
+    return block[GT911_CONFIG_LEN] == gt911_config_checksum(block);
+}
+
+/**
+ * @brief Checksum of a configuration block
+ * @param block GT911_CONFIG_LEN bytes from 0x8047
+ * @return Byte that makes the sum of block and checksum 0 (mod 256)
+ */
+static uint8_t gt911_config_checksum(const uint8_t *block)
+{
+    uint8_t sum = 0;
     
-    i2c_write_blocking(GT911_I2C_PORT, gt911_dev.i2c_addr, buffer, 3, false);
+    for (uint32_t i = 0; i < GT911_CONFIG_LEN; i++) {
+        sum += block[i];
+    }
+    return (uint8_t)(~sum + 1);
 }
 
+/**
+ * @brief GPIO interrupt handler of the INT pin
+ */
+static void gt911_irq_handler(void)
+{
+    if (gpio_get_irq_event_mask(GT911_PIN_INT) & gt911_int_edge) {
+        gpio_acknowledge_irq(GT911_PIN_INT, gt911_int_edge);
+        if (gt911_irq_cb != NULL) {
+            gt911_irq_cb();
+        }
+    }
+}
@@ -25,7 +25,20 @@
  #define GT911_I2C_PORT          i2c0
  #define GT911_PIN_SDA           8
  #define GT911_PIN_SCL           9
- #define GT911_I2C_BAUDRATE      100000  // 100kHz
+ #define GT911_I2C_BAUDRATE      400000  // 400kHz (Fast-mode)
+ 
+ /* Margin over a transaction's bus time before the bus is considered stuck and recovered (us),
+  * covers the GT911 stretching SCL */
+ #ifndef GT911_I2C_TIMEOUT_US
+ #define GT911_I2C_TIMEOUT_US    1000
+ #endif
+ #define GT911_PIN_INT           11      // TPINT: pulses once per new touch frame
+ 
+ /* INT edge that signals a new frame. The panel's config block picks the trigger (0x804D),
+  * this one is used when it can't be read. One edge per frame: one wakeup per frame. */
+ #ifndef GT911_INT_EVENTS
+ #define GT911_INT_EVENTS        GPIO_IRQ_EDGE_RISE
+ #endif
  
  /* GT911 Register Addresses - from chip datasheet */
  #define GT911_REG_PRODUCT_ID1       0x8140
@@ -40,6 +53,16 @@
  #define GT911_REG_Y_RES_H           0x8149  // Y resolution high byte
  #define GT911_REG_VENDOR_ID         0x814A
  
+ /* Configuration block 0x8047-0x80FE, checksum and fresh flag behind it */
+ #define GT911_REG_CONFIG_VERSION    0x8047  // First byte of the block, must not go backwards
+ #define GT911_REG_MODULE_SWITCH1    0x804D  // INT trigger (bits 1:0): 0 rising, 1 falling, 2 low, 3 high level
+ #define GT911_REG_NOISE_REDUCTION   0x8052  // Noise reduction level (bits 3:0)
+ #define GT911_REG_TOUCH_LEVEL       0x8053  // Screen touch threshold
+ #define GT911_REG_LEAVE_LEVEL       0x8054  // Screen leave threshold
+ #define GT911_REG_REFRESH_RATE      0x8056  // Report period = 5 + bits 3:0 ms
+ #define GT911_REG_CONFIG_CHKSUM     0x80FF  // Two's complement of the byte sum of the block
+ #define GT911_REG_CONFIG_FRESH      0x8100  // Write 1 to apply (and store) the new block
+ 
  #define GT911_REG_STATUS            0x814E  // Touch status register
  #define GT911_REG_TRACK_ID1         0x814F
  #define GT911_REG_PT1_X_L           0x8150  // Touch point 1 X coordinate low byte
@@ -49,6 +72,20 @@
  #define GT911_REG_PT1_SIZE_L        0x8154
  #define GT911_REG_PT1_SIZE_H        0x8155
  
+ /* Burst read blocks */
+ #define GT911_INFO_LEN              11    // 0x8140-0x814A: product ID, firmware, resolution, vendor
+ #define GT911_POINT_SIZE            8     // Track ID, X, Y, size, reserved
+ #define GT911_TOUCH_LEN             (1 + GT911_POINT_SIZE)  // Status + first point
+ 
+ #define GT911_CONFIG_LEN            (GT911_REG_CONFIG_CHKSUM - GT911_REG_CONFIG_VERSION)  // 184
+ 
+ /* Report period range (ms) */
+ #define GT911_REPORT_MS_MIN         5
+ #define GT911_REPORT_MS_MAX         20
+ 
+ /* Touch points the GT911 tracks at once */
+ #define GT911_MAX_POINTS            5
+ 
  /* Status Register Bit Definitions */
  #define GT911_STATUS_BUF_READY      0x80  // Data ready flag
  #define GT911_STATUS_LARGE          0x40
@@ -70,6 +107,52 @@
      uint8_t i2c_addr;               // I2C address
  } gt911_dev_t;
  
+ /**
+  * @brief One touch point
+  */
+ typedef struct {
+     uint8_t id;                     // Track ID, stays the same while the finger is down
+     uint16_t x;                     // X coordinate
+     uint16_t y;                     // Y coordinate
+     uint16_t size;                  // Contact size
+ } gt911_point_t;
+ 
+ /**
+  * @brief Touch frame: all points reported by the GT911
+  */
+ typedef struct {
+     uint32_t frame;                 // New frames read since init, changes only with new data
+     uint8_t count;                  // Points in use, 0 = released
+     gt911_point_t points[GT911_MAX_POINTS];
+ } gt911_touch_t;
+ 
+ /**
+  * @brief Tunable part of the configuration block
+  */
+ typedef struct {
+     uint8_t version;                // Config version (read only)
+     uint8_t report_ms;              // Coordinate report period, GT911_REPORT_MS_MIN-MAX (rate = 1000 / period)
+     uint8_t touch_level;            // Touch threshold, higher = less sensitive
+     uint8_t leave_level;            // Release threshold, below touch_level
+     uint8_t noise_reduction;        // Noise reduction level 0-15
+ } gt911_config_t;
+ 
+ /**
+  * @brief I2C bus statistics
+  */
+ typedef struct {
+     uint32_t xfers;                 // Transactions started
+     uint32_t errors;                // NAK / abort
+     uint32_t timeouts;              // No completion within the bus time plus GT911_I2C_TIMEOUT_US
+     uint32_t recoveries;            // Bus recoveries (SCL clocked until SDA released)
+ } gt911_stats_t;
+ 
+ /**
+  * @brief New touch frame callback
+  * @note Called from GPIO interrupt context, keep it short
+  */
+ typedef void (*gt911_irq_cb_t)(void);
+ 
  /**********************
   * FUNCTION PROTOTYPES
   **********************/
@@ -88,10 +171,50 @@
   */
  bool gt911_read_touch(uint16_t *x, uint16_t *y, bool *pressed);
  
+ /**
+  * @brief Read all touch points
+  * @param touch Output: the latest frame (the previous one again if the GT911 has nothing new)
+  * @return true on success, false on failure
+  * @note Fixed-size output, no allocation. The I2C read grows with the number of points.
+  */
+ bool gt911_read_points(gt911_touch_t *touch);
+ 
+ /**
+  * @brief Report new touch frames through the INT pin
+  * @param cb Called from the GPIO interrupt once per new frame
+  * @note Reads the INT trigger of the config block and enables that one edge (GT911_INT_EVENTS
+  *       if it can't be read). The interrupt is handled on the calling core. Uses a raw GPIO handler, so it
+  *       coexists with other GPIO interrupt users (gpio_set_irq_enabled_with_callback()).
+  */
+ void gt911_irq_enable(gt911_irq_cb_t cb);
+ 
+ /**
+  * @brief Read and validate the configuration block
+  * @param cfg Output: tunable settings
+  * @return false on I2C failure or a bad checksum
+  * @note Not safe against concurrent touch reads, call before the touch task starts
+  */
+ bool gt911_config_get(gt911_config_t *cfg);
+ 
+ /**
+  * @brief Change the configuration block
+  * @param cfg Settings to apply (version is ignored)
+  * @return true if the block now holds these settings
+  * @note Rewritten (and stored by the GT911) only when it differs, with a new checksum.
+  *       Not safe against concurrent touch reads, call before the touch task starts.
+  */
+ bool gt911_config_set(const gt911_config_t *cfg);
+ 
  /**
   * @brief Get device information (optional)
   * @return Pointer to device information structure
   */
  gt911_dev_t* gt911_get_dev_info(void);
  
+ /**
+  * @brief Get I2C bus statistics
+  * @param stats Output: counters since boot
+  */
+ void gt911_get_stats(gt911_stats_t *stats);
+ 
  #endif /* GT911_H */
\ No newline at end of file
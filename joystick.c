@@ -0,0 +1,187 @@
+/**
+ * @file joystick.c
+ * @brief Joystick ADC Sampling Implementation
+ * @note Two DMA channels chained into each other fill the two halves of a sample buffer from
+ *       the ADC FIFO. Each completed half is averaged per axis (decimation), smoothed and
+ *       compared against the last reported position, while the other half keeps filling.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "joystick.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "pico/stdlib.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define JOYSTICK_DMA_IRQ        (DMA_IRQ_0 + JOYSTICK_DMA_IRQ_INDEX)
+
+/* Filtered positions are kept in 1/16 LSB */
+#define JOYSTICK_FRAC           4
+
+#if JOYSTICK_BLOCK & (JOYSTICK_BLOCK - 1)
+#error "JOYSTICK_BLOCK must be a power of two"
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void joystick_dma_irq_handler(void);
+static void joystick_filter(const uint16_t *block);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* Ping-pong halves, each starts with an X conversion (even length) */
+static uint16_t joystick_buf[2][JOYSTICK_BLOCK];
+static int joystick_chan[2] = {-1, -1};
+
+static joystick_cb_t joystick_cb = NULL;
+static bool joystick_primed = false;            // First block seeds the filter
+static int32_t joystick_filt[2];                // Smoothed X/Y (1/16 LSB)
+static volatile int32_t joystick_pos[2];        // Last reported X/Y (1/16 LSB)
+static joystick_stats_t joystick_stats;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Start free-running sampling of both axes
+ * @param cb Called when the filtered position moved, may be NULL
+ */
+void joystick_init(joystick_cb_t cb)
+{
+    joystick_cb = cb;
+
+    // 1. ADC: high-impedance inputs, round robin X, Y, X, ... every result into the FIFO
+    adc_init();
+    adc_gpio_init(JOYSTICK_PIN_X);
+    adc_gpio_init(JOYSTICK_PIN_Y);
+    adc_select_input(JOYSTICK_ADC_X);
+    adc_set_round_robin((1u << JOYSTICK_ADC_X) | (1u << JOYSTICK_ADC_Y));
+    adc_fifo_setup(true,    // Results into the FIFO
+                   true,    // DREQ for DMA
+                   1,       // DREQ as soon as one result is there
+                   false,   // No error bit, 12-bit results
+                   false);  // No byte shift
+    adc_set_clkdiv((float)clock_get_hz(clk_adc) / JOYSTICK_SAMPLE_HZ - 1.0f);
+
+    // 2. Two channels, each fills its half then starts the other one
+    for (int i = 0; i < 2; i++) {
+        joystick_chan[i] = dma_claim_unused_channel(true);
+    }
+    for (int i = 0; i < 2; i++) {
+        dma_channel_config cfg = dma_channel_get_default_config(joystick_chan[i]);
+        channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+        channel_config_set_read_increment(&cfg, false);
+        channel_config_set_write_increment(&cfg, true);
+        channel_config_set_dreq(&cfg, DREQ_ADC);
+        channel_config_set_chain_to(&cfg, joystick_chan[i ^ 1]);
+        dma_channel_configure(joystick_chan[i], &cfg, joystick_buf[i], &adc_hw->fifo, JOYSTICK_BLOCK, false);
+        dma_irqn_set_channel_enabled(JOYSTICK_DMA_IRQ_INDEX, joystick_chan[i], true);
+    }
+    irq_add_shared_handler(JOYSTICK_DMA_IRQ, joystick_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(JOYSTICK_DMA_IRQ, true);
+
+    // 3. Go: from here on no CPU time except one interrupt per block
+    adc_fifo_drain();
+    dma_channel_start(joystick_chan[0]);
+    adc_run(true);
+}
+
+/**
+ * @brief Get the last reported position
+ */
+void joystick_get(uint16_t *x, uint16_t *y)
+{
+    *x = (uint16_t)((joystick_pos[0] + (1 << (JOYSTICK_FRAC - 1))) >> JOYSTICK_FRAC);
+    *y = (uint16_t)((joystick_pos[1] + (1 << (JOYSTICK_FRAC - 1))) >> JOYSTICK_FRAC);
+}
+
+/**
+ * @brief Get sampling statistics
+ */
+void joystick_get_stats(joystick_stats_t *stats)
+{
+    *stats = joystick_stats;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief DMA interrupt: a half is full
+ * @note Shared DMA_IRQ_1 handler, only handles its own channels
+ */
+static void joystick_dma_irq_handler(void)
+{
+    for (int i = 0; i < 2; i++) {
+        if (!dma_irqn_get_channel_status(JOYSTICK_DMA_IRQ_INDEX, joystick_chan[i])) {
+            continue;
+        }
+        dma_irqn_acknowledge_channel(JOYSTICK_DMA_IRQ_INDEX, joystick_chan[i]);
+
+        // The count reloads on the next chain trigger, the write address has to be reset.
+        // That trigger is a whole block away, the other half is filling now.
+        dma_channel_set_write_addr(joystick_chan[i], joystick_buf[i], false);
+        joystick_filter(joystick_buf[i]);
+    }
+}
+
+/**
+ * @brief Decimate one block, smooth it and report a move
+ * @param block JOYSTICK_BLOCK conversions, X at even and Y at odd indices
+ */
+static void joystick_filter(const uint16_t *block)
+{
+    uint32_t sum[2] = {0, 0};
+    bool moved = false;
+
+    // 1. Block average per axis (the division by a power of two is a shift)
+    for (uint32_t i = 0; i < JOYSTICK_BLOCK; i += 2) {
+        sum[0] += block[i];
+        sum[1] += block[i + 1];
+    }
+
+    for (int axis = 0; axis < 2; axis++) {
+        int32_t avg = (int32_t)((sum[axis] << JOYSTICK_FRAC) / (JOYSTICK_BLOCK / 2));
+
+        // 2. Exponential smoothing, the first block seeds it
+        if (!joystick_primed) {
+            joystick_filt[axis] = avg;
+            joystick_pos[axis] = avg;
+        } else {
+            joystick_filt[axis] += (avg - joystick_filt[axis]) >> JOYSTICK_FILTER_SHIFT;
+        }
+
+        // 3. Report only moves past the hysteresis
+        int32_t delta = joystick_filt[axis] - joystick_pos[axis];
+        if (delta > (JOYSTICK_HYSTERESIS << JOYSTICK_FRAC) || delta < -(JOYSTICK_HYSTERESIS << JOYSTICK_FRAC)) {
+            moved = true;
+        }
+    }
+
+    joystick_stats.blocks++;
+    if (!joystick_primed) {
+        joystick_primed = true;
+        moved = true;  // First position
+    }
+
+    if (moved) {
+        joystick_pos[0] = joystick_filt[0];
+        joystick_pos[1] = joystick_filt[1];
+        joystick_stats.changes++;
+        if (joystick_cb != NULL) {
+            joystick_cb();
+        }
+    }
+}
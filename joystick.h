@@ -0,0 +1,89 @@
+/**
+ * @file joystick.h
+ * @brief Joystick ADC Sampling Header
+ * @note Both axes are sampled free-running (ADC round robin into a DMA ring) and filtered in
+ *       the DMA interrupt. The application is notified only when the filtered position moved.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef JOYSTICK_H
+#define JOYSTICK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ *      DEFINES
+ **********************/
+/* Hardware Pin Configuration */
+#define JOYSTICK_PIN_X          26      // ADC0
+#define JOYSTICK_PIN_Y          27      // ADC1
+#define JOYSTICK_ADC_X          0
+#define JOYSTICK_ADC_Y          1
+
+/* Conversions per second, both axes together */
+#ifndef JOYSTICK_SAMPLE_HZ
+#define JOYSTICK_SAMPLE_HZ      8000
+#endif
+
+/* Conversions per DMA block (both axes interleaved, power of two). One filter step per block:
+ * 64 at 8 kHz averages 32 samples per axis, 125 filtered positions per second. */
+#ifndef JOYSTICK_BLOCK
+#define JOYSTICK_BLOCK          64
+#endif
+
+/* Smoothing of the block averages: new = old + (avg - old) / 2^shift */
+#ifndef JOYSTICK_FILTER_SHIFT
+#define JOYSTICK_FILTER_SHIFT   2
+#endif
+
+/* Movement (ADC LSB) before a change is reported, keeps noise from waking the UI */
+#ifndef JOYSTICK_HYSTERESIS
+#define JOYSTICK_HYSTERESIS     12
+#endif
+
+/* DMA interrupt line (DMA_IRQ_1, the display uses DMA_IRQ_0) */
+#define JOYSTICK_DMA_IRQ_INDEX  1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Position changed callback
+ * @note Called from DMA interrupt context, keep it short
+ */
+typedef void (*joystick_cb_t)(void);
+
+/**
+ * @brief Sampling statistics
+ */
+typedef struct {
+    uint32_t blocks;            // DMA blocks filtered
+    uint32_t changes;           // Position changes reported
+} joystick_stats_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Start free-running sampling of both axes
+ * @param cb Called when the filtered position moved, may be NULL
+ * @note Claims two DMA channels, the interrupt is handled on the calling core
+ */
+void joystick_init(joystick_cb_t cb);
+
+/**
+ * @brief Get the last reported position
+ * @param x Output: X (0-4095)
+ * @param y Output: Y (0-4095)
+ */
+void joystick_get(uint16_t *x, uint16_t *y);
+
+/**
+ * @brief Get sampling statistics
+ * @param stats Output: counters since joystick_init()
+ */
+void joystick_get_stats(joystick_stats_t *stats);
+
+#endif /* JOYSTICK_H */
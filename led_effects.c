@@ -0,0 +1,436 @@
+/**
+ * @file led_effects.c
+ * @brief RGB LED Effects Engine Implementation
+ * @note Every frame renders each pixel as 8.8 fixed point colour, looks it up in the
+ *       gamma/brightness table (interpolated, 16-bit linear result) and keeps the part below
+ *       one output step as a per-channel residue that is added to the next frame. Over a few
+ *       frames the LED then averages to the 16-bit level instead of the truncated 8-bit one.
+ *       Once the effect has settled the last frame is rounded to the nearest 8-bit level and
+ *       the timer stops, a constant colour is never dithered.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "led_effects.h"
+#include "ws2812_strip.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "hardware/sync.h"
+#include <math.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Chase tail length (pixels), the lit pixel included */
+#define LED_EFFECTS_CHASE_TAIL  4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    LED_EFFECT_FADE = 0,
+    LED_EFFECT_BREATHE,
+    LED_EFFECT_RAINBOW,
+    LED_EFFECT_CHASE,
+    LED_EFFECT_SEQUENCE,
+} led_effect_type_t;
+
+/**
+ * @brief Effect and its parameters
+ */
+typedef struct {
+    led_effect_type_t type;
+    uint8_t r, g, b;
+    uint32_t ms;                        // Fade time, period or step time
+    const led_keyframe_t *keys;
+    uint32_t count;
+    bool loop;
+} led_effect_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void led_effects_request(const led_effect_t *effect);
+static void led_effects_wake(bool idle);
+static void led_effects_frame(TimerHandle_t timer);
+static bool led_effects_render(uint32_t t);
+static bool led_effects_render_sequence(uint32_t t, uint32_t i);
+static void led_effects_hue(uint32_t hue, uint16_t *c);
+static void led_effects_scale(uint8_t r, uint8_t g, uint8_t b, uint32_t level, uint16_t *c);
+static uint16_t led_effects_mix(uint16_t from, uint16_t to, uint32_t k);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* 8-bit colour to 16-bit linear output, one extra entry for the interpolation */
+static uint16_t effects_gamma[257];
+static uint16_t effects_lut[257];               // effects_gamma scaled by the brightness
+
+static TimerHandle_t effects_timer = NULL;
+
+/* Requests from the application, guarded by effects_lock */
+static spin_lock_t *effects_lock = NULL;
+static led_effect_t effects_req;
+static bool effects_req_new = false;
+static uint8_t effects_req_brightness = 255;
+static bool effects_idle = true;                // Timer stopped (or stopping) on a settled output
+
+/* Timer task only */
+static led_effect_t effects_cur;                // Starts as a finished fade to black
+static uint32_t effects_start_ms = 0;
+static uint8_t effects_brightness = 255;        // Brightness effects_lut was built for
+static uint16_t effects_from[WS2812_STRIP_LEN][3];  // Colour when the effect started (8.8)
+static uint16_t effects_out[WS2812_STRIP_LEN][3];   // Colour of the last frame (8.8)
+static uint8_t effects_err[WS2812_STRIP_LEN][3];    // Dither residue (1/256 output step)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Build the tables and create the frame timer
+ */
+void led_effects_init(void)
+{
+    if (effects_timer != NULL) {
+        return;  // Already running
+    }
+
+    // 1. Gamma table, the only floating point: once at start-up
+    for (int i = 0; i < 256; i++) {
+        effects_gamma[i] = (uint16_t)(powf(i / 255.0f, LED_EFFECTS_GAMMA) * 65535.0f + 0.5f);
+    }
+    effects_gamma[256] = effects_gamma[255];
+    memcpy(effects_lut, effects_gamma, sizeof(effects_lut));
+
+    // 2. Frame timer, started by the first request
+    effects_lock = spin_lock_init(spin_lock_claim_unused(true));
+    effects_timer = xTimerCreate("led_fx", pdMS_TO_TICKS(LED_EFFECTS_PERIOD_MS), pdTRUE, NULL, led_effects_frame);
+}
+
+/**
+ * @brief Set the overall brightness
+ */
+void led_effects_set_brightness(uint8_t level)
+{
+    uint32_t irq = spin_lock_blocking(effects_lock);
+    effects_req_brightness = level;
+    bool idle = effects_idle;
+    effects_idle = false;
+    spin_unlock(effects_lock, irq);
+
+    led_effects_wake(idle);
+}
+
+/**
+ * @brief Fade every pixel from its current colour to one colour
+ */
+void led_effects_fade(uint8_t r, uint8_t g, uint8_t b, uint32_t ms)
+{
+    led_effect_t e = { .type = LED_EFFECT_FADE, .r = r, .g = g, .b = b, .ms = ms };
+    led_effects_request(&e);
+}
+
+/**
+ * @brief Pulse one colour smoothly from dark to full and back
+ */
+void led_effects_breathe(uint8_t r, uint8_t g, uint8_t b, uint32_t period_ms)
+{
+    led_effect_t e = { .type = LED_EFFECT_BREATHE, .r = r, .g = g, .b = b, .ms = period_ms };
+    led_effects_request(&e);
+}
+
+/**
+ * @brief Cycle through the hues, pixels spread over the colour circle
+ */
+void led_effects_rainbow(uint32_t period_ms)
+{
+    led_effect_t e = { .type = LED_EFFECT_RAINBOW, .ms = period_ms };
+    led_effects_request(&e);
+}
+
+/**
+ * @brief Run a lit pixel with a fading tail along the strip
+ */
+void led_effects_chase(uint8_t r, uint8_t g, uint8_t b, uint32_t step_ms)
+{
+    led_effect_t e = { .type = LED_EFFECT_CHASE, .r = r, .g = g, .b = b, .ms = step_ms };
+    led_effects_request(&e);
+}
+
+/**
+ * @brief Play a keyframe sequence on all pixels
+ */
+void led_effects_sequence(const led_keyframe_t *keys, uint32_t count, bool loop)
+{
+    led_effect_t e = { .type = LED_EFFECT_SEQUENCE, .keys = keys, .count = count, .loop = loop };
+    led_effects_request(&e);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Hand an effect to the timer task and make sure it runs
+ */
+static void led_effects_request(const led_effect_t *effect)
+{
+    uint32_t irq = spin_lock_blocking(effects_lock);
+    effects_req = *effect;
+    effects_req_new = true;
+    bool idle = effects_idle;
+    effects_idle = false;
+    spin_unlock(effects_lock, irq);
+
+    led_effects_wake(idle);
+}
+
+/**
+ * @brief Start the frame timer unless it runs
+ * @param idle The timer was stopped on a settled output
+ * @note xTimerStart() on a running timer restarts its period: a storm of requests (a colour
+ *       wheel being dragged) would hold the next frame back for as long as it lasts.
+ */
+static void led_effects_wake(bool idle)
+{
+    if (idle || xTimerIsTimerActive(effects_timer) == pdFALSE) {
+        xTimerStart(effects_timer, 0);
+    }
+}
+
+/**
+ * @brief Frame timer: render, map, dither and send one frame
+ * @note Runs in the FreeRTOS timer task. Stops the timer once the effect has settled.
+ */
+static void led_effects_frame(TimerHandle_t timer)
+{
+    uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
+
+    // 1. New effect or brightness
+    uint32_t irq = spin_lock_blocking(effects_lock);
+    bool restart = effects_req_new;
+    if (restart) {
+        effects_cur = effects_req;
+        effects_req_new = false;
+    }
+    uint8_t brightness = effects_req_brightness;
+    spin_unlock(effects_lock, irq);
+
+    if (restart) {
+        memcpy(effects_from, effects_out, sizeof(effects_from));
+        effects_start_ms = now;
+    }
+    if (brightness != effects_brightness) {
+        for (int i = 0; i < 257; i++) {
+            effects_lut[i] = (uint16_t)((effects_gamma[i] * brightness + 127) / 255);
+        }
+        effects_brightness = brightness;
+    }
+
+    // 2. Colours of this frame
+    bool active = led_effects_render(now - effects_start_ms);
+
+    // 3. Linear 16-bit level, the residue below one output step carries to the next frame.
+    //    Settled: the nearest level, no residue left for the next effect.
+    for (uint32_t i = 0; i < WS2812_STRIP_LEN; i++) {
+        uint8_t rgb[3];
+        for (int ch = 0; ch < 3; ch++) {
+            uint32_t v = effects_out[i][ch];
+            uint32_t lo = effects_lut[v >> 8];
+            uint32_t hi = effects_lut[(v >> 8) + 1];
+            uint32_t lin = lo + (((hi - lo) * (v & 0xFF)) >> 8);  // Table is monotonic
+
+            uint32_t acc = active ? lin + effects_err[i][ch] : lin + 128;
+            effects_err[i][ch] = active ? (uint8_t)acc : 0;
+            rgb[ch] = (acc >> 8) > 255 ? 255 : (uint8_t)(acc >> 8);
+        }
+        ws2812_strip_set(i, rgb[0], rgb[1], rgb[2]);
+    }
+    ws2812_strip_show();
+
+    // 4. Settled: stop, unless a request came in meanwhile (it saw the timer still active)
+    if (!active) {
+        xTimerStop(timer, 0);
+
+        irq = spin_lock_blocking(effects_lock);
+        bool again = effects_req_new || effects_req_brightness != effects_brightness;
+        effects_idle = !again;
+        spin_unlock(effects_lock, irq);
+
+        if (again) {
+            xTimerStart(timer, 0);
+        }
+    }
+}
+
+/**
+ * @brief Render the current effect into effects_out
+ * @param t Time since the effect started (ms)
+ * @return false once the effect reached a constant colour
+ */
+static bool led_effects_render(uint32_t t)
+{
+    const led_effect_t *e = &effects_cur;
+    uint32_t period = e->ms ? e->ms : 1;
+    uint32_t phase = (uint32_t)(((uint64_t)(t % period) << 16) / period);  // Q16 of the period
+    bool active = true;
+
+    for (uint32_t i = 0; i < WS2812_STRIP_LEN; i++) {
+        uint16_t *c = effects_out[i];
+
+        switch (e->type) {
+            case LED_EFFECT_FADE: {
+                uint32_t k = 65536;
+                if (t < e->ms) {
+                    k = (uint32_t)(((uint64_t)t << 16) / e->ms);
+                } else {
+                    active = false;
+                }
+                c[0] = led_effects_mix(effects_from[i][0], e->r << 8, k);
+                c[1] = led_effects_mix(effects_from[i][1], e->g << 8, k);
+                c[2] = led_effects_mix(effects_from[i][2], e->b << 8, k);
+                break;
+            }
+            case LED_EFFECT_BREATHE: {
+                // Triangle squared: slow near dark, where the eye is most sensitive
+                uint32_t tri = (phase < 32768) ? phase * 2 : (65535 - phase) * 2;
+                led_effects_scale(e->r, e->g, e->b, (tri * tri) >> 16, c);
+                break;
+            }
+            case LED_EFFECT_RAINBOW:
+                led_effects_hue((phase + (i << 16) / WS2812_STRIP_LEN) & 0xFFFF, c);
+                break;
+            case LED_EFFECT_CHASE: {
+                // Head position in 1/256 pixel, distance of this pixel behind it
+                uint32_t span = WS2812_STRIP_LEN << 8;
+                uint32_t head = (uint32_t)(((uint64_t)t << 8) / period) % span;
+                uint32_t behind = (head + span - (i << 8)) % span;
+                uint32_t level = 0;
+                if (behind < (LED_EFFECTS_CHASE_TAIL << 8)) {
+                    level = 65536 - behind * 256 / LED_EFFECTS_CHASE_TAIL;
+                }
+                led_effects_scale(e->r, e->g, e->b, level, c);
+                break;
+            }
+            case LED_EFFECT_SEQUENCE:
+            default:
+                active = led_effects_render_sequence(t, i) && active;
+                break;
+        }
+    }
+    return active;
+}
+
+/**
+ * @brief Render a keyframe sequence for one pixel
+ * @param t Time since the sequence started (ms)
+ * @param i Pixel
+ * @return false once a non-looping sequence ended
+ * @note The first keyframe fades from the pixel's colour at the start, on later loops from
+ *       the last keyframe.
+ */
+static bool led_effects_render_sequence(uint32_t t, uint32_t i)
+{
+    const led_effect_t *e = &effects_cur;
+    const uint16_t *from = effects_from[i];
+    uint16_t *c = effects_out[i];
+    uint32_t total = 0;
+
+    if (e->keys == NULL || e->count == 0) {
+        memcpy(c, from, 3 * sizeof(uint16_t));
+        return false;
+    }
+    for (uint32_t k = 0; k < e->count; k++) {
+        total += e->keys[k].fade_ms + e->keys[k].hold_ms;
+    }
+
+    // 1. Position in the sequence
+    bool wrapped = false;
+    if (total == 0 || (!e->loop && t >= total)) {
+        const led_keyframe_t *last = &e->keys[e->count - 1];
+        c[0] = last->r << 8;
+        c[1] = last->g << 8;
+        c[2] = last->b << 8;
+        return false;
+    }
+    if (t >= total) {
+        wrapped = true;
+        t %= total;
+    }
+
+    // 2. Keyframe and the colour it fades from
+    uint16_t prev[3] = { from[0], from[1], from[2] };
+    if (wrapped) {
+        const led_keyframe_t *last = &e->keys[e->count - 1];
+        prev[0] = last->r << 8;
+        prev[1] = last->g << 8;
+        prev[2] = last->b << 8;
+    }
+    for (uint32_t k = 0; k < e->count; k++) {
+        const led_keyframe_t *key = &e->keys[k];
+        uint32_t k16 = 65536;
+        if (t < key->fade_ms) {
+            k16 = (t << 16) / key->fade_ms;
+        }
+        if (t < (uint32_t)key->fade_ms + key->hold_ms) {
+            c[0] = led_effects_mix(prev[0], key->r << 8, k16);
+            c[1] = led_effects_mix(prev[1], key->g << 8, k16);
+            c[2] = led_effects_mix(prev[2], key->b << 8, k16);
+            return true;
+        }
+        t -= key->fade_ms + key->hold_ms;
+        prev[0] = key->r << 8;
+        prev[1] = key->g << 8;
+        prev[2] = key->b << 8;
+    }
+    return true;
+}
+
+/**
+ * @brief Fully saturated colour of a hue
+ * @param hue 0..65535 for the whole circle
+ * @param c Output: colour (8.8)
+ */
+static void led_effects_hue(uint32_t hue, uint16_t *c)
+{
+    uint32_t h6 = hue * 6;
+    uint32_t sector = h6 >> 16;
+    uint16_t up = (uint16_t)(h6 & 0xFF00);      // Rising channel (8.8)
+    uint16_t down = 0xFF00 - up;                 // Falling channel
+
+    switch (sector) {
+        case 0:  c[0] = 0xFF00; c[1] = up;     c[2] = 0;      break;
+        case 1:  c[0] = down;   c[1] = 0xFF00; c[2] = 0;      break;
+        case 2:  c[0] = 0;      c[1] = 0xFF00; c[2] = up;     break;
+        case 3:  c[0] = 0;      c[1] = down;   c[2] = 0xFF00; break;
+        case 4:  c[0] = up;     c[1] = 0;      c[2] = 0xFF00; break;
+        default: c[0] = 0xFF00; c[1] = 0;      c[2] = down;   break;
+    }
+}
+
+/**
+ * @brief Colour at a level
+ * @param level Q16, 65536 = full
+ * @param c Output: colour (8.8)
+ */
+static void led_effects_scale(uint8_t r, uint8_t g, uint8_t b, uint32_t level, uint16_t *c)
+{
+    c[0] = (uint16_t)((r * level) >> 8);
+    c[1] = (uint16_t)((g * level) >> 8);
+    c[2] = (uint16_t)((b * level) >> 8);
+}
+
+/**
+ * @brief Blend two 8.8 values
+ * @param k Q16 weight of to, 65536 = to
+ */
+static uint16_t led_effects_mix(uint16_t from, uint16_t to, uint32_t k)
+{
+    return (uint16_t)(from + (((int32_t)to - from) * (int64_t)k >> 16));
+}
@@ -0,0 +1,93 @@
+/**
+ * @file led_effects.h
+ * @brief RGB LED Effects Engine Header
+ * @note Effects are rendered by a FreeRTOS software timer straight into the WS2812 strip, no
+ *       LVGL involvement. Colours are interpolated in 8.8 fixed point, mapped through a
+ *       gamma/brightness table and temporally dithered, so slow fades stay smooth down to the
+ *       darkest levels. No allocation after led_effects_init().
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef LED_EFFECTS_H
+#define LED_EFFECTS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ *      DEFINES
+ **********************/
+/* Frame period (ms), matches WS2812_STRIP_FRAME_US */
+#ifndef LED_EFFECTS_PERIOD_MS
+#define LED_EFFECTS_PERIOD_MS   10
+#endif
+
+/* Gamma of the LED response (perceived brightness = output ^ (1 / gamma)) */
+#ifndef LED_EFFECTS_GAMMA
+#define LED_EFFECTS_GAMMA       2.2f
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief One step of a keyframe sequence
+ */
+typedef struct {
+    uint8_t r, g, b;
+    uint16_t fade_ms;           // Fade from the previous colour to this one
+    uint16_t hold_ms;           // Then stay on it
+} led_keyframe_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Build the tables and create the frame timer
+ * @note Call after ws2812_strip_init(). Starts dark, the timer runs only while needed.
+ */
+void led_effects_init(void);
+
+/**
+ * @brief Set the overall brightness
+ * @param level 0 (off) .. 255 (full)
+ */
+void led_effects_set_brightness(uint8_t level);
+
+/**
+ * @brief Fade every pixel from its current colour to one colour
+ * @param r Red
+ * @param g Green
+ * @param b Blue
+ * @param ms Fade time, 0 = at once
+ */
+void led_effects_fade(uint8_t r, uint8_t g, uint8_t b, uint32_t ms);
+
+/**
+ * @brief Pulse one colour smoothly from dark to full and back
+ * @param period_ms One breath
+ */
+void led_effects_breathe(uint8_t r, uint8_t g, uint8_t b, uint32_t period_ms);
+
+/**
+ * @brief Cycle through the hues, pixels spread over the colour circle
+ * @param period_ms One turn of the colour circle
+ */
+void led_effects_rainbow(uint32_t period_ms);
+
+/**
+ * @brief Run a lit pixel with a fading tail along the strip
+ * @param step_ms Time per pixel
+ */
+void led_effects_chase(uint8_t r, uint8_t g, uint8_t b, uint32_t step_ms);
+
+/**
+ * @brief Play a keyframe sequence on all pixels
+ * @param keys Keyframes, must stay valid while the sequence plays (e.g. const data)
+ * @param count Number of keyframes
+ * @param loop true = repeat, false = stay on the last colour
+ */
+void led_effects_sequence(const led_keyframe_t *keys, uint32_t count, bool loop);
+
+#endif /* LED_EFFECTS_H */
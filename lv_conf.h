@@ -28,8 +28,12 @@
 /*Color depth: 1 (1 byte per pixel), 8 (RGB332), 16 (RGB565), 32 (ARGB8888)*/
 #define LV_COLOR_DEPTH 16
 
-/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)*/
-#define LV_COLOR_16_SWAP 1
+/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)
+ *0: LVGL renders native RGB565, the ST7796 transfer (16-bit SPI frames / PIO) swaps for free.
+ *   Must match ST7796_PIXEL_SWAPPED in st7796.h*/
+#ifndef LV_COLOR_16_SWAP
+#define LV_COLOR_16_SWAP 0
+#endif
 
 //#define LV_COLOR_CHROMA_KEY lv_color_hex(0x00ff00)
 
@@ -11,19 +11,192 @@
  *********************/
 #include "lv_port_disp.h"
 #include "st7796.h"
+#include "disp_tune.h"
+#include "disp_perf.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/regs/addressmap.h"
+#include "hardware/sync.h"
 #include <stdbool.h>
 
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
 /*********************
  *      DEFINES
  *********************/
 #define MY_DISP_HOR_RES    320
 #define MY_DISP_VER_RES    480
 
+/* Flush mode: 1 = DMA transfer with double buffer (render overlaps transfer), 0 = blocking single buffer */
+#ifndef DISP_USE_DMA_FLUSH
+#define DISP_USE_DMA_FLUSH 1
+#endif
+
+/* Draw buffer height in rows */
+#ifndef DISP_BUF_ROWS
+#define DISP_BUF_ROWS      10
+#endif
+
+/* Display engine: 1 = a task on the other core sends stripes from a ring of DISP_ENGINE_BUFS
+ * buffers while LVGL keeps rendering (replaces DISP_USE_DMA_FLUSH), 0 = flush from the LVGL task */
+#ifndef DISP_USE_ENGINE_TASK
+#define DISP_USE_ENGINE_TASK   1
+#endif
+#ifndef DISP_ENGINE_BUFS
+#define DISP_ENGINE_BUFS       3
+#endif
+#define DISP_ENGINE_CORE       0        // LVGL (task1) runs on core 1
+#define DISP_ENGINE_PRIORITY   3        // Mostly blocked, must preempt task0 to keep the bus busy
+#define DISP_ENGINE_STACK      512
+
+/* Adaptive draw buffers: 1 = buffer count and stripe height are picked to fit DISP_BUF_BUDGET from
+ * measured render/transfer costs and re-tuned at runtime (needs DISP_USE_ENGINE_TASK),
+ * 0 = fixed DISP_ENGINE_BUFS buffers of DISP_BUF_ROWS rows */
+#ifndef DISP_USE_ADAPTIVE_BUF
+#define DISP_USE_ADAPTIVE_BUF  1
+#endif
+
+/* RAM for all draw buffers in bytes, depends on the headroom left by the enabled screens */
+#ifndef DISP_BUF_BUDGET
+#define DISP_BUF_BUDGET        (MY_DISP_HOR_RES * 30 * 2)
+#endif
+
+#define DISP_TUNE_FRAMES       32       // Refreshes between re-tuning
+#define DISP_TUNE_GAIN_PCT     10       // Estimated gain needed to change the layout
+
+#if DISP_USE_ADAPTIVE_BUF && !DISP_USE_ENGINE_TASK
+#error "DISP_USE_ADAPTIVE_BUF sizes the buffer ring of DISP_USE_ENGINE_TASK"
+#endif
+
+#if DISP_USE_ADAPTIVE_BUF && DISP_BUF_BUDGET < MY_DISP_HOR_RES * DISP_TUNE_MIN_ROWS * 2
+#error "DISP_BUF_BUDGET must hold at least one buffer of DISP_TUNE_MIN_ROWS rows"
+#endif
+
+#if DISP_USE_ADAPTIVE_BUF
+#define DISP_RING_MAX          DISP_TUNE_MAX_BUFS
+#define DISP_ARENA_PX          (DISP_BUF_BUDGET / sizeof(lv_color_t))
+#else
+#define DISP_RING_MAX          DISP_ENGINE_BUFS
+#define DISP_ARENA_PX          (DISP_ENGINE_BUFS * MY_DISP_HOR_RES * DISP_BUF_ROWS)
+#endif
+
+/* Solid fill acceleration: 1 = DMA fills (to the panel when a whole stripe is one color), 0 = LVGL software fill */
+#ifndef DISP_USE_DMA_FILL
+#define DISP_USE_DMA_FILL  1
+#endif
+
+/* Smallest in-buffer fill worth a DMA transfer (pixels), smaller ones use lv_color_fill() */
+#define DISP_DMA_FILL_MIN_PX   512
+
+/* Flash images: 1 = stripes fully covered by an opaque unscaled image are DMA-streamed from flash
+ * to the panel without touching the draw buffer (needs DISP_USE_DMA_FILL), 0 = always copied */
+#ifndef DISP_USE_XIP_STREAM
+#define DISP_USE_XIP_STREAM 1
+#endif
+
+/* Flush pipeline profiling: 1 = stage timing and per-refresh histograms (see disp_perf.h), 0 = off.
+ * Needs ST7796_USE_TIMING, both are enabled together by the DISP_PERF CMake option */
+#ifndef DISP_USE_PERF
+#define DISP_USE_PERF       0
+#endif
+
+#if DISP_USE_PERF && !ST7796_USE_TIMING
+#error "DISP_USE_PERF reads the transfer timestamps of ST7796_USE_TIMING"
+#endif
+
+#if LV_COLOR_16_SWAP != ST7796_PIXEL_SWAPPED
+#error "LV_COLOR_16_SWAP (lv_conf.h) and ST7796_PIXEL_SWAPPED (st7796.h) must match"
+#endif
+
+#if DISP_USE_XIP_STREAM && !DISP_USE_DMA_FILL
+#error "DISP_USE_XIP_STREAM uses the deferred stripe content of DISP_USE_DMA_FILL"
+#endif
+
+/* Flash address to its uncached, non-allocating alias (streaming must not evict code from the XIP cache) */
+#define DISP_XIP_UNCACHED(p)   ((const uint16_t *)((uintptr_t)(p) - XIP_BASE + XIP_NOCACHE_NOALLOC_BASE))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+#if DISP_USE_DMA_FILL
+/**
+ * @brief Content of a deferred stripe
+ */
+typedef enum {
+    DISP_PENDING_FILL,      // One color
+    DISP_PENDING_IMG,       // Window of a flash-resident true color image
+} disp_pending_kind_t;
+
+/**
+ * @brief Stripe whose whole area so far only received one opaque fill or image
+ * @note The content is not written into the draw buffer; it is either sent to the panel
+ *       by DMA in disp_flush(), or written out before anything else is drawn
+ */
+typedef struct {
+    lv_color_t * buf;           // Draw buffer the content belongs to, NULL if none pending
+    lv_area_t area;             // Draw area of the stripe
+    disp_pending_kind_t kind;
+    lv_color_t color;           // FILL: fill color
+    const lv_color_t * src;     // IMG: image pixel at the stripe's top-left corner
+    lv_coord_t src_stride;      // IMG: image width in pixels
+} disp_pending_t;
+#endif
+
+/**
+ * @brief Rendered stripe on its way to the panel
+ */
+typedef struct {
+    lv_area_t area;             // Panel window
+    lv_color_t * buf;           // Draw buffer holding the pixels
+#if DISP_USE_DMA_FILL
+    disp_pending_t pending;     // Deferred content, used instead of buf when pending.buf == buf
+#endif
+#if DISP_USE_PERF
+    uint32_t flush_us;          // time_us_32() at disp_flush() entry
+#endif
+} disp_stripe_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void disp_init(void);
 static void disp_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+static void disp_send_stripe(const disp_stripe_t * stripe, st7796_xfer_done_cb_t done_cb, void * user_data);
+#if DISP_USE_ENGINE_TASK
+static void disp_engine_init(void);
+static void disp_engine_layout(lv_disp_draw_buf_t * draw_buf, uint32_t bufs, uint32_t rows);
+static void disp_engine_submit(lv_disp_drv_t * disp_drv, const disp_stripe_t * stripe);
+static void disp_engine_task(void * param);
+static void disp_engine_xfer_done(void * user_data);
+#if DISP_USE_ADAPTIVE_BUF
+static void disp_tune_apply(lv_disp_draw_buf_t * draw_buf);
+#endif
+#elif DISP_USE_DMA_FLUSH
+static void disp_flush_done(void * user_data);
+static void disp_flush_wait(lv_disp_drv_t * disp_drv);
+#endif
+#if DISP_USE_ADAPTIVE_BUF || DISP_USE_PERF
+static void disp_monitor(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px);
+#endif
+#if DISP_USE_PERF
+static void disp_perf_xfer_done(uint32_t flush_us);
+#endif
+#if DISP_USE_DMA_FILL
+static void disp_draw_ctx_init(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx);
+static void disp_draw_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+#if DISP_USE_XIP_STREAM
+static void disp_draw_img_decoded(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc,
+                                  const lv_area_t * coords, const uint8_t * src_buf, lv_img_cf_t cf);
+#endif
+static struct _lv_draw_layer_ctx_t * disp_draw_layer_init(lv_draw_ctx_t * draw_ctx,
+        struct _lv_draw_layer_ctx_t * layer_ctx, lv_draw_layer_flags_t flags);
+static bool disp_is_draw_buf(lv_draw_ctx_t * draw_ctx);
+static void disp_pending_materialize(void);
+static void gpu_fill(lv_color_t * dest_buf, uint32_t px_num, lv_color_t color);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -31,6 +204,61 @@ static void disp_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_colo
 /* Display flush enable/disable flag */
 static volatile bool disp_flush_enabled = true;
 
+#if DISP_USE_DMA_FILL
+static disp_pending_t stripe_pending;      // Deferred full-stripe content
+static int fill_dma_chan = -1;              // Memory fill DMA channel
+static uint32_t fill_dma_word;              // Two pixels of the current fill color
+/* Software layer_init, wrapped so pending fills are written before a layer snapshots the buffer */
+static struct _lv_draw_layer_ctx_t * (*sw_layer_init)(lv_draw_ctx_t * draw_ctx,
+        struct _lv_draw_layer_ctx_t * layer_ctx, lv_draw_layer_flags_t flags);
+#endif
+
+#if DISP_USE_ENGINE_TASK
+/* Stripe ring: slot i is rendered into engine_bufs[i % engine_nbufs] (counted from engine_base),
+ * so buffers are released in submission order. Single producer (LVGL task), single consumer (engine task). */
+static lv_color_t engine_arena[DISP_ARENA_PX];      // Draw buffer RAM, carved by disp_engine_layout()
+static lv_color_t * engine_bufs[DISP_RING_MAX];
+static disp_stripe_t engine_ring[DISP_RING_MAX];
+static uint32_t engine_nbufs = 0;                   // Buffers in use
+static uint32_t engine_rows = 0;                    // Stripe height in rows
+static uint32_t engine_base = 0;                    // engine_head when the ring was laid out
+static volatile uint32_t engine_head = 0;           // Stripes submitted, written by the LVGL task only
+static volatile uint32_t engine_tail = 0;           // Stripes sent, written by the engine task only
+static TaskHandle_t engine_task = NULL;
+static SemaphoreHandle_t engine_free_sem = NULL;    // Given when the engine releases a buffer
+static SemaphoreHandle_t engine_xfer_sem = NULL;    // Given from the DMA interrupt
+static disp_engine_stats_t engine_stats;
+
+#if DISP_USE_ADAPTIVE_BUF
+static disp_tune_fit_t render_fit;                  // LVGL task only
+static disp_tune_fit_t xfer_fit;                    // Engine task, read once the ring is drained
+static disp_tune_cost_t render_cost = {300.0f, 0.25f, 0.0f};     // Initial guess, refined by measurement
+static disp_tune_cost_t xfer_cost = {40.0f, 16e6f / ST7796_SPI_BAUDRATE, 0.0f};
+static uint32_t render_mark = 0;                    // Time LVGL started the current stripe, 0 if unknown
+static uint32_t tune_frames = 0;                    // Refreshes since the last re-tune
+#endif
+#endif
+
+#if !DISP_USE_ENGINE_TASK && DISP_USE_DMA_FLUSH
+static SemaphoreHandle_t flush_done_sem = NULL;     // Given from the DMA interrupt, see disp_flush_wait()
+#endif
+
+#if DISP_USE_PERF
+static uint32_t perf_render_mark = 0;               // Time LVGL started the current stripe, 0 if unknown
+static uint32_t perf_frame_bytes = 0;               // Pixel bytes flushed in the current refresh
+static uint32_t perf_frame_flushes = 0;             // Flushes in the current refresh
+#if !DISP_USE_ENGINE_TASK && DISP_USE_DMA_FLUSH
+static volatile uint32_t perf_flush_us = 0;         // disp_flush() entry of the stripe in transfer
+#endif
+#endif
+
+#if DISP_USE_XIP_STREAM
+static volatile uint32_t xip_stream_bytes = 0;     // Pixel bytes sent straight from flash
+/* Software image blit, used when an image can't be streamed */
+static void (*sw_draw_img_decoded)(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc,
+                                   const lv_area_t * coords, const uint8_t * src_buf, lv_img_cf_t cf);
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -68,17 +296,31 @@ void lv_port_disp_init(void)
      *    LVGL will always provide complete rendered screen in `flush_cb`, only need to change framebuffer address.
      */
 
-    /* Example 1: Single buffer configuration (saves memory) */
-    static lv_disp_draw_buf_t draw_buf_dsc_1;
-    static lv_color_t buf_1[MY_DISP_HOR_RES * 10];  // 10-row buffer
-    lv_disp_draw_buf_init(&draw_buf_dsc_1, buf_1, NULL, MY_DISP_HOR_RES * 10);
-
-    /* Example 2: Double buffer configuration (better performance, but requires more memory)
-    static lv_disp_draw_buf_t draw_buf_dsc_2;
-    static lv_color_t buf_2_1[MY_DISP_HOR_RES * 10];  // First buffer
-    static lv_color_t buf_2_2[MY_DISP_HOR_RES * 10];  // Second buffer
-    lv_disp_draw_buf_init(&draw_buf_dsc_2, buf_2_1, buf_2_2, MY_DISP_HOR_RES * 10);
-    */
+#if DISP_USE_ENGINE_TASK
+    /* Buffer ring: LVGL renders into one buffer while the engine task sends the others,
+     * disp_engine_submit() swaps the next free one in after every flush */
+    static lv_disp_draw_buf_t draw_buf_dsc;
+    lv_disp_draw_buf_init(&draw_buf_dsc, engine_arena, NULL, MY_DISP_HOR_RES * DISP_BUF_ROWS);
+#if DISP_USE_ADAPTIVE_BUF
+    disp_tune_cfg_t cfg;
+    disp_tune_pick(&render_cost, &xfer_cost, DISP_BUF_BUDGET, MY_DISP_HOR_RES, MY_DISP_VER_RES, &cfg);
+    disp_engine_layout(&draw_buf_dsc, cfg.bufs, cfg.rows);
+    engine_stats.frame_est_us = cfg.frame_us;
+#else
+    disp_engine_layout(&draw_buf_dsc, DISP_ENGINE_BUFS, DISP_BUF_ROWS);
+#endif
+#elif DISP_USE_DMA_FLUSH
+    /* Double buffer: LVGL renders into one buffer while DMA sends the other */
+    static lv_disp_draw_buf_t draw_buf_dsc;
+    static lv_color_t buf_1[MY_DISP_HOR_RES * DISP_BUF_ROWS];  // First buffer
+    static lv_color_t buf_2[MY_DISP_HOR_RES * DISP_BUF_ROWS];  // Second buffer
+    lv_disp_draw_buf_init(&draw_buf_dsc, buf_1, buf_2, MY_DISP_HOR_RES * DISP_BUF_ROWS);
+#else
+    /* Single buffer configuration (saves memory) */
+    static lv_disp_draw_buf_t draw_buf_dsc;
+    static lv_color_t buf_1[MY_DISP_HOR_RES * DISP_BUF_ROWS];
+    lv_disp_draw_buf_init(&draw_buf_dsc, buf_1, NULL, MY_DISP_HOR_RES * DISP_BUF_ROWS);
+#endif
 
     /*-----------------------------------
      * Register display driver in LVGL
@@ -94,18 +336,37 @@ void lv_port_disp_init(void)
     disp_drv.flush_cb = disp_flush;
 
     /* Set display buffer */
-    disp_drv.draw_buf = &draw_buf_dsc_1;
+    disp_drv.draw_buf = &draw_buf_dsc;
 
     /* If using Example 3 full-screen double buffer, enable this option
     disp_drv.full_refresh = 1;
     */
 
-    /* GPU fill callback (if hardware acceleration available)
-    disp_drv.gpu_fill_cb = gpu_fill;
-    */
+#if DISP_USE_DMA_FILL
+    /* Software renderer with DMA solid fills and flash image streaming (see disp_draw_blend) */
+    disp_drv.draw_ctx_init = disp_draw_ctx_init;
+    disp_drv.draw_ctx_deinit = lv_draw_sw_deinit_ctx;
+    disp_drv.draw_ctx_size = sizeof(lv_draw_sw_ctx_t);
+#endif
+
+#if DISP_USE_ADAPTIVE_BUF || DISP_USE_PERF
+    /* End of every refresh: re-tune the buffer layout from the measured costs, per-refresh histograms */
+    disp_drv.monitor_cb = disp_monitor;
+#endif
+
+#if !DISP_USE_ENGINE_TASK && DISP_USE_DMA_FLUSH
+    /* LVGL waiting for a flush blocks until the DMA interrupt instead of spinning */
+    flush_done_sem = xSemaphoreCreateBinary();
+    disp_drv.wait_cb = disp_flush_wait;
+#endif
 
     /* Finally register the driver */
     lv_disp_drv_register(&disp_drv);
+    
+#if DISP_USE_ENGINE_TASK
+    /* Start the task that feeds the panel */
+    disp_engine_init();
+#endif
 }
 
 /**
@@ -126,6 +387,35 @@ void disp_disable_update(void)
     disp_flush_enabled = false;
 }
 
+/**
+ * @brief Get display engine statistics
+ * @param stats Output, all zero when DISP_USE_ENGINE_TASK is disabled
+ */
+void disp_get_engine_stats(disp_engine_stats_t * stats)
+{
+#if DISP_USE_ENGINE_TASK
+    *stats = engine_stats;
+    stats->depth = engine_head - engine_tail;
+    stats->bufs = engine_nbufs;
+    stats->rows = engine_rows;
+#else
+    lv_memset_00(stats, sizeof(*stats));
+#endif
+}
+
+/**
+ * @brief Get the number of pixel bytes streamed to the panel straight from flash
+ * @return Byte count since boot (0 when DISP_USE_XIP_STREAM is disabled)
+ */
+uint32_t disp_get_xip_stream_bytes(void)
+{
+#if DISP_USE_XIP_STREAM
+    return xip_stream_bytes;
+#else
+    return 0;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -139,6 +429,20 @@ static void disp_init(void)
     // Call ST7796 hardware driver initialization function
     // This completes: SPI initialization, GPIO configuration, screen reset, initialization command sequence
     st7796_init();
+    
+#if DISP_USE_DMA_FILL
+    // Memory fill channel: one fill word repeated into the draw buffer
+    fill_dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(fill_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    dma_channel_configure(fill_dma_chan, &c, NULL, &fill_dma_word, 0, false);
+#endif
+
+#if DISP_USE_PERF
+    disp_perf_init();
+#endif
 }
 
 /**
@@ -146,48 +450,556 @@ static void disp_init(void)
  * @param disp_drv Display driver pointer
  * @param area Area to refresh
  * @param color_p Color data pointer (RGB565 format)
- * @note Can use DMA or hardware acceleration for this operation, but must call lv_disp_flush_ready() when complete
+ * @note With DISP_USE_ENGINE_TASK the stripe is queued and LVGL continues in the next ring buffer.
+ *       With DISP_USE_DMA_FLUSH the transfer runs in the background and lv_disp_flush_ready()
+ *       is called from the DMA interrupt, so LVGL can render into the other buffer meanwhile
  */
 static void disp_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
 {
+    disp_stripe_t stripe = {
+        .area = *area,
+        .buf = color_p,
+    };
+    
+#if DISP_USE_DMA_FILL
+    // Deferred content belongs to this stripe only, whatever happens below
+    stripe.pending = stripe_pending;
+    stripe_pending.buf = NULL;
+#endif
+    
     // Check if refresh is allowed
     if (!disp_flush_enabled) {
         lv_disp_flush_ready(disp_drv);
         return;
     }
     
+#if DISP_USE_PERF
+    // Render time of this stripe (unknown for the first stripe of a refresh)
+    stripe.flush_us = time_us_32();
+    if (perf_render_mark != 0) {
+        disp_perf_add(DISP_PERF_RENDER_US, stripe.flush_us - perf_render_mark);
+    }
+    perf_frame_bytes += lv_area_get_size(area) * sizeof(lv_color_t);
+    perf_frame_flushes++;
+#endif
+    
+#if DISP_USE_ENGINE_TASK
+#if DISP_USE_ADAPTIVE_BUF
+    // Render time of this stripe (unknown for the first stripe of a refresh)
+    if (render_mark != 0) {
+        disp_tune_add(&render_fit, lv_area_get_size(area), time_us_32() - render_mark);
+    }
+#endif
+    
+    // Hand the stripe to the engine task, it owns the buffer until the transfer is done
+    disp_engine_submit(disp_drv, &stripe);
+    
+#if DISP_USE_ADAPTIVE_BUF
+    render_mark = time_us_32();
+#endif
+#elif DISP_USE_DMA_FLUSH
+    // disp_flush_done() notifies LVGL from the DMA interrupt once the stripe is on the panel
+#if DISP_USE_PERF
+    // The previous transfer's disp_flush_done() still reads perf_flush_us until the bus is idle
+    st7796_wait_idle();
+    perf_flush_us = stripe.flush_us;
+#endif
+    disp_send_stripe(&stripe, disp_flush_done, disp_drv);
+#else
+    disp_send_stripe(&stripe, NULL, NULL);
+    st7796_wait_idle();
+#if DISP_USE_PERF
+    disp_perf_xfer_done(stripe.flush_us);
+#endif
+    
+    // Notify LVGL that flush is complete
+    // Important: Must call this function to tell LVGL it can continue rendering next frame
+    lv_disp_flush_ready(disp_drv);
+#endif
+    
+#if DISP_USE_PERF
+    perf_render_mark = time_us_32();
+    disp_perf_add(DISP_PERF_BLOCK_US, perf_render_mark - stripe.flush_us);
+#endif
+}
+
+/**
+ * @brief Set the panel window and start the stripe's pixel transfer
+ * @param stripe Stripe to send
+ * @param done_cb Called from the DMA interrupt once the pixels are on the panel (may be NULL)
+ * @param user_data Passed through to done_cb
+ */
+static void disp_send_stripe(const disp_stripe_t * stripe, st7796_xfer_done_cb_t done_cb, void * user_data)
+{
+    const lv_area_t * area = &stripe->area;
+    
     // 1. Set display window (rectangular area to draw)
     st7796_set_window(area->x1, area->y1, area->x2, area->y2);
     
     // 2. Calculate pixel count
     uint32_t size = lv_area_get_width(area) * lv_area_get_height(area);
     
+#if DISP_USE_DMA_FILL
+    // 3a. Draw buffer was never written: the panel gets the deferred content directly
+    const disp_pending_t * pending = &stripe->pending;
+    if (pending->buf == stripe->buf) {
+        if (pending->kind == DISP_PENDING_FILL) {
+            // Single color: DMA repeats one pixel word
+            st7796_fill_color_async(pending->color.full, size, done_cb, user_data);
+        } else {
+            // Flash image: DMA reads the rows through the uncached alias straight into the bus
+            uint32_t w = lv_area_get_width(area);
+            st7796_write_rect_async(DISP_XIP_UNCACHED(pending->src), w, size / w,
+                                    pending->src_stride, done_cb, user_data);
+#if DISP_USE_XIP_STREAM
+            xip_stream_bytes += size * sizeof(lv_color_t);
+#endif
+        }
+        return;
+    }
+#endif
+    
     // 3. Write color data
     // LVGL's lv_color_t is configured as RGB565 (16-bit) in lv_conf.h
     // This is compatible with ST7796's RGB565 format, can be transferred directly
-    st7796_write_color((uint16_t *)color_p, size);
+    st7796_write_color_async((const uint16_t *)stripe->buf, size, done_cb, user_data);
+}
+
+#if DISP_USE_ENGINE_TASK
+/**
+ * @brief Create the display engine task and its semaphores
+ */
+static void disp_engine_init(void)
+{
+    engine_free_sem = xSemaphoreCreateBinary();
+    engine_xfer_sem = xSemaphoreCreateBinary();
     
-    // 4. Notify LVGL that flush is complete
-    // Important: Must call this function to tell LVGL it can continue rendering next frame
+    xTaskCreate(disp_engine_task, "disp", DISP_ENGINE_STACK, NULL, DISP_ENGINE_PRIORITY, &engine_task);
+    vTaskCoreAffinitySet(engine_task, (1 << DISP_ENGINE_CORE));
+}
+
+/**
+ * @brief Carve the draw buffers out of the arena and restart the ring on them
+ * @param draw_buf LVGL draw buffer descriptor
+ * @param bufs Number of buffers
+ * @param rows Stripe height in rows
+ * @note The ring must be empty (engine idle), LVGL continues in the first new buffer
+ */
+static void disp_engine_layout(lv_disp_draw_buf_t * draw_buf, uint32_t bufs, uint32_t rows)
+{
+    for (uint32_t i = 0; i < bufs; i++) {
+        engine_bufs[i] = engine_arena + i * MY_DISP_HOR_RES * rows;
+    }
+    engine_nbufs = bufs;
+    engine_rows = rows;
+    engine_base = engine_head;
+    
+    draw_buf->buf1 = engine_bufs[0];
+    draw_buf->buf_act = draw_buf->buf1;
+    draw_buf->size = MY_DISP_HOR_RES * rows;
+    __dmb();
+}
+
+/**
+ * @brief Queue a rendered stripe and give LVGL the next free ring buffer
+ * @param disp_drv Display driver pointer
+ * @param stripe Rendered stripe, its buffer is the current ring slot's buffer
+ * @note Runs in the LVGL task. Blocks only when all engine_nbufs buffers are queued.
+ */
+static void disp_engine_submit(lv_disp_drv_t * disp_drv, const disp_stripe_t * stripe)
+{
+    uint32_t head = engine_head;
+    
+    // 1. Publish the stripe to the engine
+    engine_ring[(head - engine_base) % engine_nbufs] = *stripe;
+    __dmb();
+    engine_head = ++head;
+    xTaskNotifyGive(engine_task);
+    
+    engine_stats.submitted++;
+    if (head - engine_tail > engine_stats.max_depth) {
+        engine_stats.max_depth = head - engine_tail;
+    }
+    
+    // 2. The next buffer is free once the stripe that used it engine_nbufs slots ago is sent
+    if (head - engine_tail >= engine_nbufs) {
+        engine_stats.render_stalls++;
+        while (head - engine_tail >= engine_nbufs) {
+            xSemaphoreTake(engine_free_sem, portMAX_DELAY);
+        }
+    }
+    __dmb();
+    
+    // 3. Render the next stripe there, LVGL doesn't have to wait for the panel
+    lv_disp_draw_buf_t * draw_buf = disp_drv->draw_buf;
+    draw_buf->buf1 = engine_bufs[(head - engine_base) % engine_nbufs];
+    draw_buf->buf_act = draw_buf->buf1;
     lv_disp_flush_ready(disp_drv);
 }
 
-/*
- * Optional GPU acceleration callback function examples below
- * Can be implemented to improve performance if hardware supports it
+/**
+ * @brief Display engine task: window setup and pixel transfer of queued stripes
+ * @param param Unused
+ */
+static void disp_engine_task(void * param)
+{
+    LV_UNUSED(param);
+    
+    for (;;) {
+        // 1. Wait for a rendered stripe
+        if (engine_tail == engine_head) {
+            engine_stats.engine_idle++;
+            while (engine_tail == engine_head) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            }
+        }
+        __dmb();
+        
+        // 2. Send it, sleeping until the DMA interrupt reports completion
+        const disp_stripe_t * stripe = &engine_ring[(engine_tail - engine_base) % engine_nbufs];
+#if DISP_USE_ADAPTIVE_BUF
+        uint32_t start = time_us_32();
+#endif
+        disp_send_stripe(stripe, disp_engine_xfer_done, NULL);
+        xSemaphoreTake(engine_xfer_sem, portMAX_DELAY);
+#if DISP_USE_ADAPTIVE_BUF
+        disp_tune_add(&xfer_fit, lv_area_get_size(&stripe->area), time_us_32() - start);
+#endif
+#if DISP_USE_PERF
+        disp_perf_xfer_done(stripe->flush_us);
+#endif
+        
+        // 3. Release the buffer to the LVGL task
+        __dmb();
+        engine_tail++;
+        xSemaphoreGive(engine_free_sem);
+    }
+}
+
+/**
+ * @brief Transfer complete callback of the engine task
+ * @param user_data Unused
+ * @note Normally runs in the DMA interrupt, very short fills complete synchronously in the task
+ */
+static void disp_engine_xfer_done(void * user_data)
+{
+    LV_UNUSED(user_data);
+    
+    if (__get_current_exception() == 0) {
+        xSemaphoreGive(engine_xfer_sem);
+        return;
+    }
+    
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(engine_xfer_sem, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+#if DISP_USE_ADAPTIVE_BUF
+/**
+ * @brief Refit the cost models and switch buffer layout if clearly faster
+ * @param draw_buf LVGL draw buffer descriptor
+ */
+static void disp_tune_apply(lv_disp_draw_buf_t * draw_buf)
+{
+    // 1. Let the engine drain: its transfer samples are then complete and the ring can be relaid
+    while (engine_tail != engine_head) {
+        xSemaphoreTake(engine_free_sem, portMAX_DELAY);
+    }
+    __dmb();
+    
+    disp_tune_solve(&render_fit, &render_cost);
+    disp_tune_solve(&xfer_fit, &xfer_cost);
+    lv_memset_00(&render_fit, sizeof(render_fit));
+    lv_memset_00(&xfer_fit, sizeof(xfer_fit));
+    
+    // 2. Best layout for the budget, switch only for a clear gain (measurements are noisy)
+    disp_tune_cfg_t cfg;
+    if (!disp_tune_pick(&render_cost, &xfer_cost, DISP_BUF_BUDGET, MY_DISP_HOR_RES, MY_DISP_VER_RES, &cfg)) {
+        return;
+    }
+    uint32_t cur_us = disp_tune_estimate(&render_cost, &xfer_cost, engine_nbufs, engine_rows,
+                                         MY_DISP_HOR_RES, MY_DISP_VER_RES);
+    engine_stats.frame_est_us = cur_us;
+    
+    if ((cfg.bufs != engine_nbufs || cfg.rows != engine_rows) &&
+        (uint64_t)cfg.frame_us * 100 < (uint64_t)cur_us * (100 - DISP_TUNE_GAIN_PCT)) {
+        disp_engine_layout(draw_buf, cfg.bufs, cfg.rows);
+        engine_stats.frame_est_us = cfg.frame_us;
+        engine_stats.relayouts++;
+    }
+}
+#endif
+
+#elif DISP_USE_DMA_FLUSH
+/**
+ * @brief DMA transfer complete callback
+ * @param user_data Display driver pointer passed to st7796_write_color_async()
+ * @note Runs in interrupt context, lv_disp_flush_ready() only clears the flushing flag
+ */
+static void disp_flush_done(void * user_data)
+{
+#if DISP_USE_PERF
+    disp_perf_xfer_done(perf_flush_us);
+#endif
+    lv_disp_flush_ready((lv_disp_drv_t *)user_data);
+    
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(flush_done_sem, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Called by LVGL in a loop while a flush is in progress
+ * @param disp_drv Display driver pointer
+ * @note Sleeps until disp_flush_done(), the core is free for other tasks meanwhile.
+ *       A give left over from a flush LVGL didn't wait for only costs one extra loop.
+ */
+static void disp_flush_wait(lv_disp_drv_t * disp_drv)
+{
+    LV_UNUSED(disp_drv);
+    xSemaphoreTake(flush_done_sem, 1);
+}
+#endif
+
+#if DISP_USE_ADAPTIVE_BUF || DISP_USE_PERF
+/**
+ * @brief Refresh monitor callback, runs in the LVGL task after every refresh
+ * @param disp_drv Display driver pointer
+ * @param time Refresh time in ms (unused, stripes are timed individually)
+ * @param px Refreshed pixels (unused)
  */
+static void disp_monitor(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(time);
+    LV_UNUSED(px);
+    
+#if DISP_USE_PERF
+    disp_perf_add(DISP_PERF_FRAME_BYTES, perf_frame_bytes);
+    disp_perf_add(DISP_PERF_FRAME_FLUSHES, perf_frame_flushes);
+    perf_frame_bytes = 0;
+    perf_frame_flushes = 0;
+    perf_render_mark = 0;
+#endif
+    
+#if DISP_USE_ADAPTIVE_BUF
+    // The next stripe's render time would include the idle time between refreshes
+    render_mark = 0;
+    
+    if (++tune_frames >= DISP_TUNE_FRAMES) {
+        tune_frames = 0;
+        disp_tune_apply(disp_drv->draw_buf);
+    }
+#endif
+}
+#endif
 
-#if 0  // Change to 1 if GPU fill support is needed
+#if DISP_USE_PERF
+/**
+ * @brief Record the stage timing of a stripe whose pixels just reached the panel
+ * @param flush_us disp_flush() entry of the stripe
+ * @note Runs in the engine task, the DMA interrupt or the LVGL task depending on the flush mode
+ */
+static void disp_perf_xfer_done(uint32_t flush_us)
+{
+    st7796_timing_t t;
+    st7796_get_timing(&t);
+    
+    uint32_t xfer_us = t.end_us - t.start_us;
+    disp_perf_add(DISP_PERF_WINDOW_US, t.window_us);
+    disp_perf_add(DISP_PERF_XFER_US, xfer_us);
+    disp_perf_add(DISP_PERF_FLUSH_US, t.end_us - flush_us);
+    if (xfer_us > 0) {
+        // bytes per us is MB/s
+        disp_perf_add(DISP_PERF_XFER_KBPS, (uint32_t)((uint64_t)t.bytes * 1000 / xfer_us));
+    }
+}
+#endif
+
+#if DISP_USE_DMA_FILL
+
+/**
+ * @brief Initialize draw context: software renderer with DMA-accelerated blend
+ * @param drv Display driver pointer
+ * @param draw_ctx Draw context to initialize (sizeof(lv_draw_sw_ctx_t))
+ */
+static void disp_draw_ctx_init(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
+{
+    lv_draw_sw_init_ctx(drv, draw_ctx);
+    
+    lv_draw_sw_ctx_t * sw_ctx = (lv_draw_sw_ctx_t *)draw_ctx;
+    sw_ctx->blend = disp_draw_blend;
+    
+#if DISP_USE_XIP_STREAM
+    sw_draw_img_decoded = draw_ctx->draw_img_decoded;
+    draw_ctx->draw_img_decoded = disp_draw_img_decoded;
+#endif
+    
+    sw_layer_init = draw_ctx->layer_init;
+    draw_ctx->layer_init = disp_draw_layer_init;
+}
 
 /**
- * @brief GPU fill callback (optional)
- * @note Can implement this function to accelerate fill operations if GPU or DMA support available
+ * @brief Blend callback with solid fill fast paths
+ * @param draw_ctx Draw context
+ * @param dsc Blend descriptor
+ * @note Opaque unmasked fills covering the whole draw area (screen clears, full-width
+ *       backgrounds) are deferred and become a panel-side DMA fill in disp_flush().
+ *       Opaque unmasked fills spanning full rows of a draw buffer are contiguous and use a memory
+ *       DMA fill. Everything else, including layers (their pixels may carry an alpha byte), goes
+ *       to the LVGL software blender.
  */
-static void gpu_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, lv_coord_t dest_width,
-        const lv_area_t * fill_area, lv_color_t color)
+static void disp_draw_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
 {
-    /* Implement GPU fill logic */
-    /* Example: Use DMA to quickly fill with single color */
+    lv_area_t blend_area;
+    if (!_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) {
+        return;
+    }
+    
+    bool solid = dsc->src_buf == NULL &&
+                 dsc->opa >= LV_OPA_MAX &&
+                 dsc->blend_mode == LV_BLEND_MODE_NORMAL &&
+                 (dsc->mask_buf == NULL || dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER);
+    
+    if (solid && _lv_area_is_in(draw_ctx->buf_area, &blend_area, 0) && disp_is_draw_buf(draw_ctx)) {
+        // Covers everything drawn so far, just remember the color
+        stripe_pending.buf = draw_ctx->buf;
+        stripe_pending.area = *draw_ctx->buf_area;
+        stripe_pending.kind = DISP_PENDING_FILL;
+        stripe_pending.color = dsc->color;
+        return;
+    }
+    
+    // Anything else needs the real buffer content underneath
+    if (stripe_pending.buf == draw_ctx->buf) {
+        disp_pending_materialize();
+    }
+    
+    lv_coord_t buf_w = lv_area_get_width(draw_ctx->buf_area);
+    if (solid && lv_area_get_width(&blend_area) == buf_w && disp_is_draw_buf(draw_ctx)) {
+        lv_color_t * dest = (lv_color_t *)draw_ctx->buf +
+                            (blend_area.y1 - draw_ctx->buf_area->y1) * buf_w;
+        gpu_fill(dest, lv_area_get_size(&blend_area), dsc->color);
+        return;
+    }
+    
+    lv_draw_sw_blend_basic(draw_ctx, dsc);
+}
+
+#if DISP_USE_XIP_STREAM
+/**
+ * @brief Image blit callback with flash streaming
+ * @param draw_ctx Draw context
+ * @param dsc Image draw descriptor
+ * @param coords Image area
+ * @param src_buf Decoded pixels (the image data itself for true color variable images)
+ * @param cf Color format of src_buf
+ * @note An opaque, unscaled true color image in flash covering the whole unmasked draw area
+ *       is deferred like a full-area fill; disp_flush() streams its rows to the panel by DMA
+ */
+static void disp_draw_img_decoded(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc,
+                                  const lv_area_t * coords, const uint8_t * src_buf, lv_img_cf_t cf)
+{
+    lv_area_t draw_area;
+    bool streamable = cf == LV_IMG_CF_TRUE_COLOR &&
+                      (uintptr_t)src_buf >= XIP_BASE && (uintptr_t)src_buf < XIP_NOALLOC_BASE &&
+                      dsc->angle == 0 && dsc->zoom == LV_IMG_ZOOM_NONE &&
+                      dsc->opa >= LV_OPA_MAX && dsc->recolor_opa <= LV_OPA_MIN &&
+                      dsc->blend_mode == LV_BLEND_MODE_NORMAL &&
+                      _lv_area_intersect(&draw_area, coords, draw_ctx->clip_area) &&
+                      _lv_area_is_in(draw_ctx->buf_area, &draw_area, 0) &&
+                      !lv_draw_mask_is_any(draw_ctx->buf_area) &&
+                      disp_is_draw_buf(draw_ctx);
+    
+    if (!streamable) {
+        sw_draw_img_decoded(draw_ctx, dsc, coords, src_buf, cf);
+        return;
+    }
+    
+    lv_coord_t stride = lv_area_get_width(coords);
+    stripe_pending.buf = draw_ctx->buf;
+    stripe_pending.area = *draw_ctx->buf_area;
+    stripe_pending.kind = DISP_PENDING_IMG;
+    stripe_pending.src = (const lv_color_t *)src_buf +
+                         (draw_ctx->buf_area->y1 - coords->y1) * stride +
+                         (draw_ctx->buf_area->x1 - coords->x1);
+    stripe_pending.src_stride = stride;
+}
+#endif
+
+/**
+ * @brief Layer init wrapper, writes out pending content before the layer is created
+ */
+static struct _lv_draw_layer_ctx_t * disp_draw_layer_init(lv_draw_ctx_t * draw_ctx,
+        struct _lv_draw_layer_ctx_t * layer_ctx, lv_draw_layer_flags_t flags)
+{
+    if (stripe_pending.buf == draw_ctx->buf) {
+        disp_pending_materialize();
+    }
+    return sw_layer_init(draw_ctx, layer_ctx, flags);
+}
+
+/**
+ * @brief Check whether the draw context renders into a display draw buffer
+ * @note Only those reach disp_flush(), layer buffers are read back by LVGL
+ */
+static bool disp_is_draw_buf(lv_draw_ctx_t * draw_ctx)
+{
+    lv_disp_draw_buf_t * draw_buf = _lv_refr_get_disp_refreshing()->driver->draw_buf;
+    return draw_ctx->buf == draw_buf->buf1 || draw_ctx->buf == draw_buf->buf2;
+}
+
+/**
+ * @brief Write the pending full-stripe content into its draw buffer
+ */
+static void disp_pending_materialize(void)
+{
+    lv_color_t * buf = stripe_pending.buf;
+    stripe_pending.buf = NULL;
+    
+    if (stripe_pending.kind == DISP_PENDING_FILL) {
+        gpu_fill(buf, lv_area_get_size(&stripe_pending.area), stripe_pending.color);
+        return;
+    }
+    
+    lv_coord_t w = lv_area_get_width(&stripe_pending.area);
+    lv_coord_t h = lv_area_get_height(&stripe_pending.area);
+    const lv_color_t * src = stripe_pending.src;
+    for (lv_coord_t y = 0; y < h; y++) {
+        lv_memcpy(buf, src, w * sizeof(lv_color_t));
+        buf += w;
+        src += stripe_pending.src_stride;
+    }
+}
+
+/**
+ * @brief Fill a contiguous run of the draw buffer with one color
+ * @param dest_buf First pixel to fill
+ * @param px_num Number of pixels
+ * @param color Fill color
+ * @note Large runs use a non-incrementing 32-bit DMA read (2 pixels per transfer)
+ */
+static void gpu_fill(lv_color_t * dest_buf, uint32_t px_num, lv_color_t color)
+{
+    if (px_num < DISP_DMA_FILL_MIN_PX) {
+        lv_color_fill(dest_buf, color, px_num);
+        return;
+    }
+    
+    // Word-align the destination for 32-bit transfers
+    if ((uintptr_t)dest_buf & 3) {
+        *dest_buf++ = color;
+        px_num--;
+    }
+    if (px_num & 1) {
+        dest_buf[px_num - 1] = color;
+    }
+    
+    fill_dma_word = ((uint32_t)color.full << 16) | color.full;
+    dma_channel_set_write_addr(fill_dma_chan, dest_buf, false);
+    dma_channel_set_trans_count(fill_dma_chan, px_num / 2, true);
+    dma_channel_wait_for_finish_blocking(fill_dma_chan);
 }
 
-#endif
\ No newline at end of file
+#endif /* DISP_USE_DMA_FILL */
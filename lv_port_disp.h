@@ -25,6 +25,20 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+/**
+ * @brief Display engine statistics (DISP_USE_ENGINE_TASK)
+ */
+typedef struct {
+    uint32_t submitted;         // Stripes handed to the engine task
+    uint32_t depth;             // Stripes queued or in transfer right now
+    uint32_t max_depth;         // Highest depth seen
+    uint32_t render_stalls;     // Times LVGL waited for a free buffer
+    uint32_t engine_idle;       // Times the engine waited for a stripe
+    uint32_t bufs;              // Draw buffers in use
+    uint32_t rows;              // Stripe height in rows
+    uint32_t relayouts;         // Buffer layout changes by the adaptive sizing
+    uint32_t frame_est_us;      // Estimated full-screen refresh time of the current layout
+} disp_engine_stats_t;
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -45,6 +59,18 @@ void disp_enable_update(void);
  */
 void disp_disable_update(void);
 
+/**
+ * @brief Get display engine statistics
+ * @param stats Output
+ */
+void disp_get_engine_stats(disp_engine_stats_t * stats);
+
+/**
+ * @brief Get the number of pixel bytes streamed to the panel straight from flash
+ * @return Byte count since boot
+ */
+uint32_t disp_get_xip_stream_bytes(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -12,57 +12,560 @@
 #include "lv_port_indev.h"
 #include "lvgl.h"
 #include "gt911.h"
+#include "touch_calib.h"
+#include "touch_filter.h"
+#include "lv_port_os.h"
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Touch sampling: 1 = the GT911 INT pin wakes a touch task that does the I2C read and queues
+ * the samples for touchpad_read(), 0 = touchpad_read() polls the GT911 from the LVGL task */
+#define INDEV_USE_TOUCH_TASK    1
+#define INDEV_TOUCH_CORE        0       // LVGL (task1) runs on core 1
+#define INDEV_TOUCH_PRIORITY    2       // Above task0, below the display engine
+#define INDEV_TOUCH_STACK       256
+
+/* Longest LVGL task stall (full-screen refresh plus a read period) samples are queued through (ms) */
+#define INDEV_TOUCH_STALL_MS    120
+
+/* Queued samples, power of two: one per GT911 report over INDEV_TOUCH_STALL_MS. Beyond that moves
+ * are coalesced into the newest sample (lv_port_touch_stats_t counts them). */
+#define INDEV_TOUCH_QUEUE       32
+
+/* While pressed, re-read after this long without INT edges so a lost release can't stick (ms) */
+#define INDEV_TOUCH_HOLD_MS     100
+
+/* GT911 coordinate report period (ms, 5 = 200 Hz), 0 = keep the panel vendor's configuration */
+#define INDEV_TOUCH_REPORT_MS   5
+
+#if INDEV_USE_TOUCH_TASK && INDEV_TOUCH_REPORT_MS && \
+    INDEV_TOUCH_QUEUE < INDEV_TOUCH_STALL_MS / INDEV_TOUCH_REPORT_MS
+#error "INDEV_TOUCH_QUEUE must hold the GT911 reports of INDEV_TOUCH_STALL_MS"
+#endif
+
+/* Pointer filter: 1 = smooth and extrapolate the LVGL pointer (touch_filter.h), 0 = raw points */
+#define INDEV_USE_TOUCH_FILTER  1
+
+/* Queued gesture events, power of two */
+#define INDEV_GESTURE_QUEUE     16
+
+/* Keypad (joystick and buttons): queued key events, power of two */
+#define INDEV_KEY_QUEUE         16
+
+/* Joystick deflection from center (ADC LSB) that presses a navigation key, and the smaller
+ * one that releases it again (hysteresis) */
+#define INDEV_JOY_CENTER        2048
+#define INDEV_JOY_PRESS         1200
+#define INDEV_JOY_RELEASE       600
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+#if INDEV_USE_TOUCH_TASK
+/**
+ * @brief Touch sample as read by the touch task
+ */
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    bool pressed;
+    uint32_t time_ms;           // Tick count when the sample was read
+} touch_sample_t;
+#endif
+
+/**
+ * @brief Queued key event
+ */
+typedef struct {
+    uint32_t key;
+    bool pressed;
+    uint32_t time_us;           // When it was queued (latency statistics)
+} key_event_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void touchpad_init(void);
+static bool touchpad_init(void);
 static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
+static void touchpad_calibrate(gt911_touch_t *touch);
+static void touchpad_filter(uint16_t *x, uint16_t *y, bool pressed, uint32_t time_ms);
+#if INDEV_USE_TOUCH_TASK
+static void touch_task(void *param);
+static void touch_irq(void);
+static bool touch_push(const touch_sample_t *s);
+static void gesture_dispatch(void);
+#endif
+static void keypad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
+static bool keypad_push(uint32_t key, bool pressed);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 lv_indev_t *indev_touchpad;
+lv_indev_t *indev_keypad;
 
 /* Store last touch coordinates */
 static int16_t last_x = 0;
 static int16_t last_y = 0;
 
+/* Gestures: recognized where the touch frames are read, reported in the LVGL task */
+static gesture_state_t gesture_state;
+static lv_port_gesture_cb_t gesture_cb = NULL;
+
+#if INDEV_USE_TOUCH_FILTER
+static touch_filter_t pointer_filter;   // LVGL pointer (first point) only, gestures see unfiltered points
+#endif
+
+#if INDEV_USE_TOUCH_TASK
+/* Gesture queue: same single producer / single consumer scheme as the sample queue */
+static gesture_event_t gesture_queue[INDEV_GESTURE_QUEUE];
+static volatile uint32_t gesture_head = 0;
+static volatile uint32_t gesture_tail = 0;
+
+/* Sample queue: single producer (touch task), single consumer (LVGL task), no locks */
+static touch_sample_t touch_queue[INDEV_TOUCH_QUEUE];
+static volatile uint32_t touch_head = 0;        // Samples pushed, written by the touch task only
+static volatile uint32_t touch_tail = 0;        // Samples popped, written by the LVGL task only
+static TaskHandle_t touch_task_handle = NULL;
+static bool touch_last_pressed = false;         // State reported by the last popped sample
+#endif
+static lv_port_touch_stats_t touch_stats;
+
+/* Key queue: producers are interrupts and tasks on either core, so pushes take key_lock.
+ * The only consumer is the LVGL task. */
+static key_event_t key_queue[INDEV_KEY_QUEUE];
+static volatile uint32_t key_head = 0;
+static volatile uint32_t key_tail = 0;
+static spin_lock_t *key_lock = NULL;
+static key_event_t key_last = {0};              // Reported while the queue is empty
+static uint32_t joy_key = 0;                    // Navigation key held by the joystick, 0 = none
+static lv_port_key_stats_t key_stats;
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
 
 /**
  * @brief Initialize LVGL input device driver
- * @note Currently only touchpad (GT911) is implemented
+ * @note Touchpad (GT911), plus a keypad fed through lv_port_indev_key() / lv_port_indev_joystick()
  */
 void lv_port_indev_init(void)
 {
     static lv_indev_drv_t indev_drv;
+    static lv_indev_drv_t keypad_drv;
+    
+    /* Initialize and register touchpad, without a GT911 answering there is no pointer to read */
+    if (touchpad_init()) {
+        lv_indev_drv_init(&indev_drv);
+        indev_drv.type = LV_INDEV_TYPE_POINTER;
+        indev_drv.read_cb = touchpad_read;
+        indev_touchpad = lv_indev_drv_register(&indev_drv);
+    }
+    
+    /* Register keypad, objects created from here on join the default group it navigates */
+    key_lock = spin_lock_init(spin_lock_claim_unused(true));
+    
+    lv_indev_drv_init(&keypad_drv);
+    keypad_drv.type = LV_INDEV_TYPE_KEYPAD;
+    keypad_drv.read_cb = keypad_read;
+    indev_keypad = lv_indev_drv_register(&keypad_drv);
+    
+    lv_group_t *group = lv_group_create();
+    lv_group_set_default(group);
+    lv_indev_set_group(indev_keypad, group);
+}
+
+/**
+ * @brief Get touch sample statistics
+ */
+void lv_port_indev_get_touch_stats(lv_port_touch_stats_t *stats)
+{
+    *stats = touch_stats;
+}
 
-    /* Initialize and register touchpad */
-    touchpad_init();
+/**
+ * @brief Set the callback for touch gestures
+ * @param cb Callback, NULL to ignore gestures
+ */
+void lv_port_indev_set_gesture_cb(lv_port_gesture_cb_t cb)
+{
+    gesture_cb = cb;
+}
+
+/**
+ * @brief Queue a key event from a task
+ */
+void lv_port_indev_key(uint32_t key, bool pressed)
+{
+    if (keypad_push(key, pressed)) {
+        lv_port_os_wake();
+    }
+}
+
+/**
+ * @brief Queue a key event from an interrupt
+ */
+void lv_port_indev_key_from_isr(uint32_t key, bool pressed)
+{
+    if (keypad_push(key, pressed)) {
+        lv_port_os_wake_from_isr();
+    }
+}
+
+/**
+ * @brief Feed the joystick position
+ * @note The dominant axis picks the key: right / down = LV_KEY_NEXT, left / up = LV_KEY_PREV.
+ *       Held deflection auto-repeats through LVGL's long-press repeat.
+ */
+void lv_port_indev_joystick(uint16_t x, uint16_t y)
+{
+    int32_t dx = (int32_t)x - INDEV_JOY_CENTER;
+    int32_t dy = INDEV_JOY_CENTER - (int32_t)y;     // Down is positive, like the screen
+    int32_t ax = dx < 0 ? -dx : dx;
+    int32_t ay = dy < 0 ? -dy : dy;
+    int32_t threshold = joy_key ? INDEV_JOY_RELEASE : INDEV_JOY_PRESS;
+    uint32_t key = 0;
     
-    lv_indev_drv_init(&indev_drv);
-    indev_drv.type = LV_INDEV_TYPE_POINTER;
-    indev_drv.read_cb = touchpad_read;
-    indev_touchpad = lv_indev_drv_register(&indev_drv);
+    if (ax > threshold || ay > threshold) {
+        int32_t d = (ax >= ay) ? dx : dy;
+        key = (d > 0) ? LV_KEY_NEXT : LV_KEY_PREV;
+    }
+    
+    if (key != joy_key) {
+        if (joy_key) {
+            lv_port_indev_key(joy_key, false);
+        }
+        if (key) {
+            lv_port_indev_key(key, true);
+        }
+        joy_key = key;
+    }
+}
+
+/**
+ * @brief Release the key held by a joystick deflection
+ * @note Same as feeding the centered position
+ */
+void lv_port_indev_joystick_release(void)
+{
+    lv_port_indev_joystick(INDEV_JOY_CENTER, INDEV_JOY_CENTER);
+}
+
+/**
+ * @brief Get keypad statistics
+ */
+void lv_port_indev_get_key_stats(lv_port_key_stats_t *stats)
+{
+    *stats = key_stats;
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * @brief Queue a key event
+ * @return false if the queue is full (event dropped)
+ */
+static bool keypad_push(uint32_t key, bool pressed)
+{
+    if (key_lock == NULL) {
+        return false;  // Not initialized yet
+    }
+    
+    uint32_t irq = spin_lock_blocking(key_lock);
+    uint32_t head = key_head;
+    bool ok = (head - key_tail < INDEV_KEY_QUEUE);
+    if (ok) {
+        key_queue[head % INDEV_KEY_QUEUE] = (key_event_t){ key, pressed, time_us_32() };
+        __dmb();
+        key_head = head + 1;
+    } else {
+        key_stats.dropped++;
+    }
+    spin_unlock(key_lock, irq);
+    
+    return ok;
+}
+
+/**
+ * @brief Report queued key events to LVGL
+ * @param indev_drv Input device driver pointer
+ * @param data Output data structure for LVGL
+ * @note One event per call, the rest follow in the same indev period through continue_reading.
+ *       Called on the wakeup of lv_port_indev_key*(), and polled by the read timer only while a
+ *       key is held (long press repeat): lv_port_os_timer_handler() pauses it otherwise.
+ */
+static void keypad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
+{
+    LV_UNUSED(indev_drv);
+    
+    uint32_t tail = key_tail;
+    
+    if (tail != key_head) {
+        __dmb();
+        key_last = key_queue[tail % INDEV_KEY_QUEUE];
+        __dmb();
+        key_tail = ++tail;
+        
+        uint32_t latency = time_us_32() - key_last.time_us;
+        key_stats.events++;
+        key_stats.latency_sum_us += latency;
+        if (latency > key_stats.latency_max_us) {
+            key_stats.latency_max_us = latency;
+        }
+    }
+    
+    data->key = key_last.key;
+    data->state = key_last.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    data->continue_reading = (tail != key_head);
+}
+
 /**
  * @brief Initialize GT911 touch driver
+ * @return false if the GT911 doesn't answer (not fitted, no power), the pointer isn't registered
  */
-static void touchpad_init(void)
+static bool touchpad_init(void)
 {
+    touch_gesture_init(&gesture_state);
+    
     if (!gt911_init()) {
-        // TODO: Add error handling if needed
+        touch_stats.init_failed = true;
+        return false;
+    }
+    
+#if INDEV_TOUCH_REPORT_MS
+    // Faster reports cut drag latency, only written when the panel isn't set up that way yet
+    gt911_config_t cfg;
+    if (gt911_config_get(&cfg) && cfg.report_ms != INDEV_TOUCH_REPORT_MS) {
+        cfg.report_ms = INDEV_TOUCH_REPORT_MS;
+        gt911_config_set(&cfg);
+    }
+#endif
+    
+    // Raw coordinates are scaled from the GT911's configured resolution
+    gt911_dev_t *dev = gt911_get_dev_info();
+    touch_calib_init(dev->max_x, dev->max_y);
+    
+#if INDEV_USE_TOUCH_TASK
+    xTaskCreate(touch_task, "touch", INDEV_TOUCH_STACK, NULL, INDEV_TOUCH_PRIORITY, &touch_task_handle);
+    vTaskCoreAffinitySet(touch_task_handle, (1 << INDEV_TOUCH_CORE));
+#endif
+    return true;
+}
+
+/**
+ * @brief Map all points of a frame to display coordinates (calibration and orientation)
+ * @param touch Frame from gt911_read_points()
+ */
+static void touchpad_calibrate(gt911_touch_t *touch)
+{
+    for (uint8_t i = 0; i < touch->count; i++) {
+        touch_calib_apply(&touch->points[i].x, &touch->points[i].y);
     }
 }
 
+/**
+ * @brief Filter the pointer position
+ * @param x In/out: X coordinate
+ * @param y In/out: Y coordinate
+ * @param pressed Touch state, a release resets the filter
+ * @param time_ms Time of the sample
+ */
+static void touchpad_filter(uint16_t *x, uint16_t *y, bool pressed, uint32_t time_ms)
+{
+#if INDEV_USE_TOUCH_FILTER
+    if (pressed) {
+        touch_filter_update(&pointer_filter, x, y, time_ms);
+    } else {
+        touch_filter_reset(&pointer_filter);
+    }
+#else
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+    LV_UNUSED(pressed);
+    LV_UNUSED(time_ms);
+#endif
+}
+
+#if INDEV_USE_TOUCH_TASK
+/**
+ * @brief Read touch data and update LVGL input state
+ * @param indev_drv Input device driver pointer
+ * @param data Output data structure for LVGL
+ * @note Called periodically by LVGL, only drains the touch task's queue (no I2C).
+ *       Buffered samples are all reported in one indev period through continue_reading.
+ */
+static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
+{
+    LV_UNUSED(indev_drv);
+    
+    gesture_dispatch();
+    
+    uint32_t tail = touch_tail;
+    
+    if (tail != touch_head) {
+        __dmb();
+        const touch_sample_t *s = &touch_queue[tail % INDEV_TOUCH_QUEUE];
+        if (s->pressed) {
+            last_x = s->x;
+            last_y = s->y;
+        }
+        touch_last_pressed = s->pressed;
+        __dmb();
+        touch_tail = ++tail;
+        touch_stats.samples++;
+    }
+    
+    // Nothing new: the last state still holds
+    data->point.x = last_x;
+    data->point.y = last_y;
+    data->state = touch_last_pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    data->continue_reading = (tail != touch_head);
+}
+
+/**
+ * @brief Touch task: reads the GT911 when its INT pin reports a new frame
+ * @param param Unused
+ */
+static void touch_task(void *param)
+{
+    LV_UNUSED(param);
+    
+    touch_sample_t last = {0};
+    touch_sample_t pending = {0};               // Newest sample, waiting for queue space
+    bool has_pending = false;
+    uint32_t frame = 0;                         // gt911_touch_t.frame of the last read
+    
+    // Interrupt on this core, now that the task can be notified
+    gt911_irq_enable(touch_irq);
+    
+    for (;;) {
+        // 1. Sleep until INT, while pressed also re-read now and then. While a sample waits for
+        //    queue space retry every tick, without a read unless INT came.
+        TickType_t wait = last.pressed ? pdMS_TO_TICKS(INDEV_TOUCH_HOLD_MS) : portMAX_DELAY;
+        uint32_t notified = ulTaskNotifyTake(pdTRUE, has_pending ? 1 : wait);
+        if (has_pending) {
+            has_pending = !touch_push(&pending);
+            if (notified == 0) {
+                continue;
+            }
+        }
+        
+        gt911_touch_t touch;
+        if (!gt911_read_points(&touch)) {
+            continue;
+        }
+        touchpad_calibrate(&touch);
+        touch_sample_t s = {
+            .x = touch.points[0].x,
+            .y = touch.points[0].y,
+            .pressed = (touch.count > 0),
+            .time_ms = xTaskGetTickCount() * portTICK_PERIOD_MS,
+        };
+        
+        // 2. Gestures see every frame (and the hold timeouts, for long-press)
+        gesture_event_t events[GESTURE_MAX_EVENTS];
+        uint32_t n = touch_gesture_update(&gesture_state, &touch, s.time_ms, events);
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t head = gesture_head;
+            if (head - gesture_tail >= INDEV_GESTURE_QUEUE) {
+                break;
+            }
+            gesture_queue[head % INDEV_GESTURE_QUEUE] = events[i];
+            __dmb();
+            gesture_head = head + 1;
+        }
+        if (n > 0) {
+            lv_port_os_wake();
+        }
+        touchpad_filter(&s.x, &s.y, s.pressed, s.time_ms);
+        if (!s.pressed) {
+            s.x = last.x;
+            s.y = last.y;
+        }
+        
+        // 3. Hold timeouts and retries re-read the same frame, only queue pointer changes
+        bool fresh = (touch.frame != frame);
+        frame = touch.frame;
+        if (s.pressed == last.pressed && (!s.pressed || (s.x == last.x && s.y == last.y))) {
+            touch_stats.unchanged += fresh;
+            continue;
+        }
+        last = s;
+        
+        // 4. Queue it. Full: the newest sample waits here, a move onto a waiting move (or the
+        //    release ending it) replaces it. Only a press landing on a waiting release is lost.
+        if (!has_pending && touch_push(&s)) {
+            continue;
+        }
+        if (has_pending) {
+            if (pending.pressed) {
+                touch_stats.coalesced++;
+            } else {
+                touch_stats.dropped++;
+            }
+        }
+        pending = s;
+        has_pending = true;
+    }
+}
+
+/**
+ * @brief Queue a sample for touchpad_read() and wake the LVGL task
+ * @return false if the queue is full
+ */
+static bool touch_push(const touch_sample_t *s)
+{
+    uint32_t head = touch_head;
+    
+    if (head - touch_tail >= INDEV_TOUCH_QUEUE) {
+        return false;
+    }
+    touch_queue[head % INDEV_TOUCH_QUEUE] = *s;
+    __dmb();
+    touch_head = head + 1;
+    
+    lv_port_os_wake();
+    return true;
+}
+
+/**
+ * @brief GT911 INT callback, runs in the GPIO interrupt
+ */
+static void touch_irq(void)
+{
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(touch_task_handle, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Report queued gesture events to the application
+ */
+static void gesture_dispatch(void)
+{
+    uint32_t tail = gesture_tail;
+    
+    while (tail != gesture_head) {
+        __dmb();
+        gesture_event_t ev = gesture_queue[tail % INDEV_GESTURE_QUEUE];
+        __dmb();
+        gesture_tail = ++tail;
+        
+        if (gesture_cb != NULL) {
+            gesture_cb(&ev);
+        }
+    }
+}
+
+#else
 /**
  * @brief Read touch data and update LVGL input state
  * @param indev_drv Input device driver pointer
@@ -71,13 +574,26 @@ static void touchpad_init(void)
  */
 static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
 {
-    uint16_t x, y;
-    bool pressed;
+    gt911_touch_t touch;
     
+    LV_UNUSED(indev_drv);
     data->continue_reading = false;
     
-    if (gt911_read_touch(&x, &y, &pressed)) {
-        if (pressed) {
+    if (gt911_read_points(&touch)) {
+        touchpad_calibrate(&touch);
+        
+        // Gestures go straight to the application, this is the LVGL task
+        gesture_event_t events[GESTURE_MAX_EVENTS];
+        uint32_t n = touch_gesture_update(&gesture_state, &touch, lv_tick_get(), events);
+        for (uint32_t i = 0; i < n && gesture_cb != NULL; i++) {
+            gesture_cb(&events[i]);
+        }
+        
+        uint16_t x = touch.points[0].x;
+        uint16_t y = touch.points[0].y;
+        touchpad_filter(&x, &y, touch.count > 0, lv_tick_get());
+        
+        if (touch.count > 0) {
             // Touch detected: update coordinates and state
             data->point.x = x;
             data->point.y = y;
@@ -97,4 +613,5 @@ static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
         data->point.y = last_y;
         data->state = LV_INDEV_STATE_REL;
     }
-}
\ No newline at end of file
+}
+#endif
@@ -16,16 +16,98 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "lvgl.h"
+#include "touch_gesture.h"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Gesture event callback
+ * @note Called from the LVGL task during input reading, LVGL calls are allowed
+ */
+typedef void (*lv_port_gesture_cb_t)(const gesture_event_t *event);
+
+/**
+ * @brief Keypad statistics
+ */
+typedef struct {
+    uint32_t events;            // Key events delivered to LVGL
+    uint32_t dropped;           // Key events lost to a full queue
+    uint32_t latency_max_us;    // Longest queue to LVGL latency
+    uint64_t latency_sum_us;    // Sum of latencies (mean = sum / events)
+} lv_port_key_stats_t;
+
+/**
+ * @brief Touch sample statistics
+ */
+typedef struct {
+    uint32_t samples;           // Samples delivered to LVGL
+    uint32_t coalesced;         // Moves merged into a newer sample while the queue was full
+    uint32_t dropped;           // Samples lost (a press onto a waiting release, queue full)
+    uint32_t unchanged;         // New frames that didn't move the filtered pointer (not queued)
+    bool init_failed;           // GT911 didn't answer, no pointer input device
+} lv_port_touch_stats_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 /**
  * @brief Initialize input device driver
- * @note Must be called before using LVGL touch functionality
+ * @note Must be called before using LVGL touch functionality. Without a GT911 answering no
+ *       pointer device is registered (see lv_port_touch_stats_t), the keypad works regardless.
  */
 void lv_port_indev_init(void);
 
+/**
+ * @brief Get touch sample statistics
+ * @param stats Output: counters since boot
+ */
+void lv_port_indev_get_touch_stats(lv_port_touch_stats_t *stats);
+
+/**
+ * @brief Set the callback for touch gestures (pinch, two-finger pan, rotate, long-press)
+ * @param cb Callback, NULL to ignore gestures
+ */
+void lv_port_indev_set_gesture_cb(lv_port_gesture_cb_t cb);
+
+/**
+ * @brief Queue a key event for the keypad input device (focus navigation)
+ * @param key LV_KEY_... or a character
+ * @param pressed true = pressed, false = released
+ * @note From a task, wakes the LVGL task. The keypad is not polled: lv_port_os_timer_handler()
+ *       keeps its read timer paused while no key is held and reads it on this wakeup.
+ */
+void lv_port_indev_key(uint32_t key, bool pressed);
+
+/**
+ * @brief Queue a key event from an interrupt
+ * @param key LV_KEY_... or a character
+ * @param pressed true = pressed, false = released
+ * @note Wakes the LVGL task like lv_port_indev_key()
+ */
+void lv_port_indev_key_from_isr(uint32_t key, bool pressed);
+
+/**
+ * @brief Feed the joystick position, deflections become LV_KEY_PREV / LV_KEY_NEXT
+ * @param x X (0-4095, larger = right)
+ * @param y Y (0-4095, larger = up)
+ * @note Call when the position changed (joystick.h callback), from a task
+ */
+void lv_port_indev_joystick(uint16_t x, uint16_t y);
+
+/**
+ * @brief Release the key held by a joystick deflection, if any
+ * @note Call from the same task instead of lv_port_indev_joystick() once the joystick is used
+ *       for something else, a key still held at the switch would otherwise never be released
+ */
+void lv_port_indev_joystick_release(void);
+
+/**
+ * @brief Get keypad statistics
+ * @param stats Output: counters since boot
+ */
+void lv_port_indev_get_key_stats(lv_port_key_stats_t *stats);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -0,0 +1,133 @@
+/**
+ * @file lv_port_os.c
+ * @brief LVGL FreeRTOS Service Task Porting Layer
+ * @note The service task blocks on its task notification. The timeout is the next LVGL timer
+ *       deadline, input and display events give the notification to run LVGL right away.
+ *       Timers that would wake it for nothing are paused: input devices are read on events and
+ *       polled only while pressed, the refresh timer runs only while there is something to draw.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_os.h"
+#include "lvgl.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static TaskHandle_t os_task = NULL;        // LVGL service task, NULL until lv_port_os_init()
+static lv_port_os_stats_t os_stats;        // Written by the service task only
+static bool os_event = false;              // The last wakeup was an event, input may be pending
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Register the calling task as the LVGL service task
+ */
+void lv_port_os_init(void)
+{
+    os_task = xTaskGetCurrentTaskHandle();
+}
+
+/**
+ * @brief Sleep until the next LVGL timer is due or an event arrives
+ */
+void lv_port_os_wait(uint32_t next_ms)
+{
+    // 1. No pending timer (LV_NO_TIMER_READY) or far away: sleep at most LV_PORT_OS_MAX_SLEEP_MS
+    if (next_ms > LV_PORT_OS_MAX_SLEEP_MS) {
+        next_ms = LV_PORT_OS_MAX_SLEEP_MS;
+    }
+
+    // 2. Round up to whole ticks, waking before the deadline only runs LVGL for nothing
+    TickType_t ticks = (next_ms * configTICK_RATE_HZ + 999) / 1000;
+    if (ticks == 0) {
+        ticks = 1;
+    }
+
+    // 3. Any number of events since the last call count as one wakeup
+    if (ulTaskNotifyTake(pdTRUE, ticks) != 0) {
+        os_event = true;
+        os_stats.events++;
+    } else {
+        os_stats.timeouts++;
+    }
+    os_stats.wakeups++;
+}
+
+/**
+ * @brief Run LVGL's timers with the idle ones paused
+ */
+uint32_t lv_port_os_timer_handler(void)
+{
+    // 1. Input: read every device after an event, keep polling the pressed ones (long press, drag).
+    //    The poll period restarts at the event read, a resumed timer would read again right away.
+    bool event = os_event;
+    os_event = false;
+    for (lv_indev_t * indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev)) {
+        lv_timer_t * read_timer = indev->driver->read_timer;
+        if (event) {
+            lv_indev_read_timer_cb(read_timer);
+            lv_timer_reset(read_timer);
+        }
+        if (indev->proc.state == LV_INDEV_STATE_PRESSED) {
+            lv_timer_resume(read_timer);
+        } else {
+            lv_timer_pause(read_timer);
+        }
+    }
+    
+    // 2. Display: nothing invalid, nothing to refresh. _lv_inv_area() resumes the timer.
+    lv_disp_t * disp = lv_disp_get_default();
+    if (disp != NULL && disp->inv_p == 0) {
+        lv_timer_pause(_lv_disp_get_refr_timer(disp));
+    }
+    
+    // 3. A timer resumed by a later one in the list (refresh after an animation step) is due right
+    //    away, run it in this wakeup instead of sleeping a tick for it
+    uint32_t next_ms = lv_timer_handler();
+    if (next_ms == 0) {
+        next_ms = lv_timer_handler();
+    }
+    return next_ms;
+}
+
+/**
+ * @brief Wake the LVGL service task from a task
+ */
+void lv_port_os_wake(void)
+{
+    if (os_task != NULL) {
+        xTaskNotifyGive(os_task);
+    }
+}
+
+/**
+ * @brief Wake the LVGL service task from an interrupt
+ */
+void lv_port_os_wake_from_isr(void)
+{
+    if (os_task == NULL) {
+        return;
+    }
+
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(os_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Get LVGL service task statistics
+ */
+void lv_port_os_get_stats(lv_port_os_stats_t * stats)
+{
+    *stats = os_stats;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file lv_port_os.h
+ * @brief LVGL FreeRTOS Service Task Porting Layer Interface
+ * @note The LVGL task sleeps until the next LVGL timer is due or an input/display event wakes it.
+ *       Input device and refresh timers are paused while they have nothing to do.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef LV_PORT_OS_H
+#define LV_PORT_OS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Longest sleep when no LVGL timer is pending (ms) */
+#ifndef LV_PORT_OS_MAX_SLEEP_MS
+#define LV_PORT_OS_MAX_SLEEP_MS     500
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief LVGL service task statistics
+ */
+typedef struct {
+    uint32_t wakeups;           // Times the service task woke up
+    uint32_t events;            // Wakeups caused by lv_port_os_wake() / lv_port_os_wake_from_isr()
+    uint32_t timeouts;          // Wakeups because the next LVGL timer was due
+} lv_port_os_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+/**
+ * @brief Register the calling task as the LVGL service task
+ * @note Call from the LVGL task before its loop, wakeups before that are ignored
+ */
+void lv_port_os_init(void);
+
+/**
+ * @brief Sleep until the next LVGL timer is due or an event arrives
+ * @param next_ms Return value of lv_timer_handler() (LV_NO_TIMER_READY if none)
+ * @note Call without holding the LVGL mutex. Events during lv_timer_handler() are not lost,
+ *       the next call returns immediately.
+ */
+void lv_port_os_wait(uint32_t next_ms);
+
+/**
+ * @brief Run LVGL's timers, replaces lv_task_handler() in the service task
+ * @return Time until the next timer is due (ms), for lv_port_os_wait()
+ * @note Call with the LVGL mutex held. After an event wakeup every input device is read once,
+ *       the read timers run only while their device is pressed. The refresh timer is paused
+ *       while no area is invalid, invalidating an area resumes it.
+ */
+uint32_t lv_port_os_timer_handler(void);
+
+/**
+ * @brief Wake the LVGL service task from a task
+ * @note Call after changing LVGL objects outside the service task, or when input is pending
+ */
+void lv_port_os_wake(void);
+
+/**
+ * @brief Wake the LVGL service task from an interrupt
+ */
+void lv_port_os_wake_from_isr(void);
+
+/**
+ * @brief Get LVGL service task statistics
+ * @param stats Output
+ */
+void lv_port_os_get_stats(lv_port_os_stats_t * stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PORT_OS_H*/
@@ -15,15 +15,20 @@
 #include "lvgl.h"
 #include "lv_port_disp.h"
 #include "lv_port_indev.h"
+#include "lv_port_os.h"
+#include "disp_perf.h"
+#include "splash.h"
+#include "joystick.h"
+#include "buttons.h"
+#include "ws2812_strip.h"
+#include "led_effects.h"
+#include "ws2812_parallel.h"
+#include "audio.h"
 
-#include "hardware/pio.h"
 #include "hardware/clocks.h"
-#include "hardware/adc.h"
 #include "hardware/watchdog.h"
 #include "pico/bootrom.h"
 
-#include "ws2812.pio.h"
-
 // ========================================
 // GPIO Pin Definitions
 // ========================================
@@ -34,8 +39,21 @@
 #define GPIO_BUTTON_RESET   22  // Reset button input
 #define GPIO_LED_1          16  // LED 1 output
 #define GPIO_LED_2          17  // LED 2 output
-#define GPIO_ADC_X          26  // Joystick X-axis ADC
-#define GPIO_ADC_Y          27  // Joystick Y-axis ADC
+#define GPIO_WS2812_PARALLEL 18 // First external strip data pin (18..21), see WS2812_PARALLEL_STRIPS
+// Joystick X/Y ADC: GPIO 26/27, see joystick.h
+
+// buttons.pio debounces GPIO 14..22 as one window (BUTTONS_PIN_BASE in buttons.h), so the LED
+// outputs 16/17 and the strip outputs 18..21 are watched too. Their edges never become button
+// events, but each one restarts the debounce hold: while strips are being sent, button reports
+// wait for a gap between frames. Pin moves must keep all three buttons inside that window.
+
+// External WS2812 strips on the parallel outputs, set by the build (CMake cache), 0 = none
+#ifndef WS2812_PARALLEL_STRIPS
+#define WS2812_PARALLEL_STRIPS  0
+#endif
+#if WS2812_PARALLEL_STRIPS > 4
+#error "WS2812_PARALLEL_STRIPS: only GPIO 18..21 are free for external strips"
+#endif
 
 // LVGL Mutex - Ensures thread safety (required by LVGL official documentation)
 SemaphoreHandle_t lvgl_mutex = NULL;
@@ -54,18 +72,16 @@ lv_obj_t *joystick_circle = NULL;  // Joystick outer circle
 lv_obj_t *joystick_ball = NULL;    // Joystick inner ball
 
 bool joystick_enabled = false;     // Joystick ADC enable flag
+static TaskHandle_t joystick_task = NULL;  // Task woken when the joystick moved
 
-// WS2812 RGB LED configuration
-static PIO rgb_pio = NULL;
-static uint rgb_sm = 0;
-
-// Buzzer state
+// Buzzer state, the tone plays on an audio voice
 static bool buzzer_state = false;
+static int buzzer_voice = -1;
+#define BUZZER_TONE_HZ      2000
 
-// Button debounce tracking
-static uint32_t btn1_last_time = 0;
-static uint32_t btn2_last_time = 0;
-#define BTN_DEBOUNCE_MS 50
+// RGB LED fade times (ms)
+#define RGB_FADE_MS         150
+#define RGB_OFF_FADE_MS     400
 
 // Joystick ADC configuration
 #define ADC_MAX_VALUE       4095        // 12-bit ADC max value
@@ -74,7 +90,6 @@ static uint32_t btn2_last_time = 0;
 
 // Forward function declarations
 static void reboot_handler(lv_event_t *e);
-void on_button_interrupt(uint gpio_pin, uint32_t events);
 
 // Calculator related variables
 lv_obj_t *calc_display = NULL;
@@ -287,31 +302,30 @@ static void on_buzzer_toggle(lv_event_t *e)
     if (lv_event_get_code(e) != LV_EVENT_VALUE_CHANGED) return;
     
     buzzer_state = !buzzer_state;
-    gpio_put(GPIO_BUZZER, buzzer_state);
-}
-
-/**
- * @brief Write RGB color to WS2812 LED
- */
-static void ws2812_write(uint8_t r, uint8_t g, uint8_t b)
-{
-    uint32_t grb = ((uint32_t)g << 16) | ((uint32_t)r << 8) | b;
-    pio_sm_put_blocking(rgb_pio, rgb_sm, grb << 8u);
+    if (buzzer_state) {
+        buzzer_voice = audio_tone(BUZZER_TONE_HZ, 0, 255);
+    } else {
+        audio_stop(buzzer_voice);
+        buzzer_voice = -1;
+    }
 }
 
 /**
  * @brief Convert LVGL color to RGB values
+ * @note lv_color_to32() expands the channels independent of LV_COLOR_16_SWAP
  */
 static void lvgl_color_to_rgb(lv_color_t color, uint8_t *r, uint8_t *g, uint8_t *b)
 {
-    *r = (color.ch.red * 255) / 31;
-    uint8_t green_full = (color.ch.green_h << 3) | color.ch.green_l;
-    *g = (green_full * 255) / 63;
-    *b = (color.ch.blue * 255) / 31;
+    lv_color32_t c32;
+    c32.full = lv_color_to32(color);
+    *r = c32.ch.red;
+    *g = c32.ch.green;
+    *b = c32.ch.blue;
 }
 
 /**
  * @brief Colorwheel change event handler
+ * @note Dragging fires a storm of events, each one just retargets the fade
  */
 static void on_colorwheel_changed(lv_event_t *e)
 {
@@ -320,7 +334,7 @@ static void on_colorwheel_changed(lv_event_t *e)
     lv_color_t color = lv_colorwheel_get_rgb(lv_event_get_target(e));
     uint8_t r, g, b;
     lvgl_color_to_rgb(color, &r, &g, &b);
-    ws2812_write(r, g, b);
+    led_effects_fade(r, g, b, RGB_FADE_MS);
 }
 
 /**
@@ -329,7 +343,7 @@ static void on_colorwheel_changed(lv_event_t *e)
 static void on_rgb_off_clicked(lv_event_t *e)
 {
     if (lv_event_get_code(e) != LV_EVENT_CLICKED) return;
-    ws2812_write(0, 0, 0);
+    led_effects_fade(0, 0, 0, RGB_OFF_FADE_MS);
 }
 
 /**
@@ -369,27 +383,37 @@ static int map_adc_with_deadzone(uint adc_raw, int max_pos, bool invert)
     return invert ? (max_pos - mapped) : mapped;
 }
 
+/**
+ * @brief Joystick moved, runs in the DMA interrupt
+ */
+static void joystick_moved(void)
+{
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(joystick_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Buttons, set up at boot: the buttons are keypad keys on every screen
+ * @note Debounced by PIO, the interrupt only queues the events and wakes the LVGL task
+ */
+static void init_buttons(void)
+{
+    buttons_init((1u << GPIO_BUTTON_1) | (1u << GPIO_BUTTON_2) | (1u << GPIO_BUTTON_RESET), lv_port_os_wake_from_isr);
+}
+
 /**
  * @brief Initialize all hardware peripherals
  */
 static void init_hardware_peripherals(void)
 {
-    // Buzzer GPIO setup
-    gpio_init(GPIO_BUZZER);
-    gpio_set_dir(GPIO_BUZZER, GPIO_OUT);
-    gpio_put(GPIO_BUZZER, 0);
-    
-    // WS2812 RGB LED via PIO
-    rgb_pio = pio0;
-    rgb_sm = pio_claim_unused_sm(rgb_pio, true);
-    uint ws2812_offset = pio_add_program(rgb_pio, &ws2812_program);
-    ws2812_program_init(rgb_pio, rgb_sm, ws2812_offset, GPIO_WS2812, 800000, true);
-    ws2812_write(0, 0, 0);  // Turn off LED initially
-    
-    // Button interrupts with debouncing
-    gpio_set_irq_enabled_with_callback(GPIO_BUTTON_1, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true, &on_button_interrupt);
-    gpio_set_irq_enabled_with_callback(GPIO_BUTTON_2, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true, &on_button_interrupt);
-    gpio_set_irq_enabled_with_callback(GPIO_BUTTON_RESET, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true, &on_button_interrupt);
+    // WS2812 RGB LED via PIO + DMA, starts with the LED off. Effects run from a timer.
+    ws2812_strip_init(GPIO_WS2812, true);
+    led_effects_init();
+#if WS2812_PARALLEL_STRIPS > 0
+    // External strips, all off until the application draws on them
+    ws2812_parallel_init(GPIO_WS2812_PARALLEL, WS2812_PARALLEL_STRIPS);
+#endif
     
     // Physical LED GPIOs
     gpio_init(GPIO_LED_1);
@@ -485,29 +509,41 @@ static void create_hardware_ui(void)
 }
 
 /**
- * @brief Button interrupt handler with debouncing
+ * @brief Handle the queued button events, runs in the LVGL task with lvgl_mutex held
+ * @note In the hardware demo the buttons toggle the LEDs, elsewhere they are keypad keys:
+ *       button 1 = LV_KEY_ENTER, button 2 = LV_KEY_NEXT. The reset button has no action.
  */
-void on_button_interrupt(uint gpio_pin, uint32_t events)
+static void buttons_dispatch(void)
 {
-    // Only handle button press (rising edge)
-    if (!(events & GPIO_IRQ_EDGE_RISE)) return;
+    button_event_t ev;
     
-    uint32_t now = to_ms_since_boot(get_absolute_time());
-    
-    if (gpio_pin == GPIO_BUTTON_1) {
-        // Debounce check for button 1
-        if (now - btn1_last_time > BTN_DEBOUNCE_MS) {
-            btn1_last_time = now;
-            lv_led_toggle(led1);
-            gpio_put(GPIO_LED_1, !gpio_get(GPIO_LED_1));  // Toggle LED GPIO
+    while (buttons_get(&ev)) {
+        lv_obj_t *led;
+        uint led_gpio;
+        uint32_t key;
+        
+        if (ev.gpio == GPIO_BUTTON_1) {
+            led = led1;
+            led_gpio = GPIO_LED_1;
+            key = LV_KEY_ENTER;
+        } else if (ev.gpio == GPIO_BUTTON_2) {
+            led = led2;
+            led_gpio = GPIO_LED_2;
+            key = LV_KEY_NEXT;
+        } else {
+            continue;
         }
-    } 
-    else if (gpio_pin == GPIO_BUTTON_2) {
-        // Debounce check for button 2
-        if (now - btn2_last_time > BTN_DEBOUNCE_MS) {
-            btn2_last_time = now;
-            lv_led_toggle(led2);
-            gpio_put(GPIO_LED_2, !gpio_get(GPIO_LED_2));  // Toggle LED GPIO
+        
+        if (ev.pressed) {
+            audio_click();
+        }
+        
+        // Releases always go to the keypad, a key pressed before the demo opened must end
+        if (led != NULL && ev.pressed) {
+            lv_led_toggle(led);
+            gpio_put(led_gpio, !gpio_get(led_gpio));  // Toggle LED GPIO
+        } else {
+            lv_port_indev_key(key, ev.pressed);
         }
     }
 }
@@ -563,68 +599,74 @@ void lv_example_btn_1(void)
 
 void task0(void *pvParam)
 {
-    // Lock mutex when initializing UI
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-    lv_obj_clean(lv_scr_act());
-    xSemaphoreGive(lvgl_mutex);
-    
-    vTaskDelay(100 / portTICK_PERIOD_MS);
-
-    // Lock mutex when creating initial UI
+    // Lock mutex when creating initial UI (splash image is already created in main)
     xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-    splash_image = lv_img_create(lv_scr_act());
-    LV_IMG_DECLARE(sea);
-    lv_img_set_src(splash_image, &sea);
-    lv_obj_align(splash_image, LV_ALIGN_DEFAULT, 0, 0);
     lv_example_btn_1();
     xSemaphoreGive(lvgl_mutex);
 
+    // Sampled and filtered in the background, wakes this task only when it moved.
+    // Always running: it drives keypad focus navigation, in the hardware demo the ball.
+    joystick_task = xTaskGetCurrentTaskHandle();
+    joystick_init(joystick_moved);
+
+    int last_x = -1;
+    int last_y = -1;
+
     for (;;)
     {
-        if (joystick_enabled)
+        // Wake up now and then anyway for the profiling dump below
+        ulTaskNotifyTake(pdTRUE, 200 / portTICK_PERIOD_MS);
+
+        uint16_t adc_x_raw, adc_y_raw;
+        joystick_get(&adc_x_raw, &adc_y_raw);
+
+        if (!joystick_enabled)
         {
-            adc_init();
-            // Make sure GPIO is high-impedance, no pullups etc
-            adc_gpio_init(GPIO_ADC_X);
-            adc_gpio_init(GPIO_ADC_Y);
-
-            for (;;)
-            {
-                char buf[50];
-
-                // ADC read doesn't need mutex lock
-                adc_select_input(0);
-                uint adc_x_raw = adc_read();
-                adc_select_input(1);
-                uint adc_y_raw = adc_read();
-
-                // Map ADC values with deadzone handling
-                const int max_pos = 88;  // 100-12=88 (outer frame 100, ball 12)
-                int ball_x = map_adc_with_deadzone(adc_x_raw, max_pos, false);
-                int ball_y = map_adc_with_deadzone(adc_y_raw, max_pos, true);  // Y-axis inverted
-
-                // Lock mutex when updating LVGL objects
+            // Deflections become LV_KEY_PREV / LV_KEY_NEXT (no LVGL call, no mutex)
+            lv_port_indev_joystick(adc_x_raw, adc_y_raw);
+        }
+        else
+        {
+            // The ball took over, maybe with the stick deflected: release its navigation key
+            lv_port_indev_joystick_release();
+
+            // Map ADC values with deadzone handling
+            const int max_pos = 88;  // 100-12=88 (outer frame 100, ball 12)
+            int ball_x = map_adc_with_deadzone(adc_x_raw, max_pos, false);
+            int ball_y = map_adc_with_deadzone(adc_y_raw, max_pos, true);  // Y-axis inverted
+
+            // Lock mutex when updating LVGL objects, only wake LVGL when the ball moved
+            if (ball_x != last_x || ball_y != last_y) {
                 xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
                 lv_obj_set_pos(joystick_ball, ball_x, ball_y);
                 xSemaphoreGive(lvgl_mutex);
+                lv_port_os_wake();
 
-                vTaskDelay(200 / portTICK_PERIOD_MS);
+                last_x = ball_x;
+                last_y = ball_y;
             }
         }
-        vTaskDelay(1000 / portTICK_PERIOD_MS);
+
+        // Host requested a flush profiling dump (disp_perf_decode.py)
+        disp_perf_poll();
     }
 }
 
 void task1(void *pvParam)
 {
+    // Input and display events wake this task through lv_port_os_wake()
+    lv_port_os_init();
+
     for (;;)
     {
-        // Must lock mutex before/after lv_task_handler (LVGL official requirement)
+        // Must lock mutex before/after running LVGL timers (LVGL official requirement)
         xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-        lv_task_handler();
+        buttons_dispatch();
+        uint32_t next_ms = lv_port_os_timer_handler();
         xSemaphoreGive(lvgl_mutex);
         
-        vTaskDelay(5 / portTICK_PERIOD_MS);
+        // Sleep until the next LVGL timer is due or an event arrives
+        lv_port_os_wait(next_ms);
     }
 }
 
@@ -635,6 +677,16 @@ int main()
     lv_init();
     lv_port_disp_init();
     lv_port_indev_init();
+    init_buttons();
+    audio_init(GPIO_BUZZER);  // Buzzer as PWM audio, DMA_IRQ_1 on core0 like the joystick
+
+    // Splash goes straight to the panel, then becomes the first LVGL screen content
+    // so the first rendered frame repaints the same image instead of clearing it
+    splash_init();
+    splash_show();
+    splash_image = lv_img_create(lv_scr_act());
+    lv_img_set_src(splash_image, &splash_img);
+    lv_obj_align(splash_image, LV_ALIGN_DEFAULT, 0, 0);
 
     // Create LVGL mutex (must be created before task startup)
     lvgl_mutex = xSemaphoreCreateMutex();
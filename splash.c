@@ -0,0 +1,273 @@
+/**
+ * @file splash.c
+ * @brief Compressed Splash Image Decoder
+ * @note Decodes the splash generated by splash_compress.py, either for LVGL (image decoder)
+ *       or straight to the ST7796 at boot (splash_show)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "splash.h"
+#include "st7796.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_COLOR_DEPTH != 16
+#error "splash: compressed image is RGB565, requires LV_COLOR_DEPTH 16"
+#endif
+
+/* Splash image size, must match splash_compress.py */
+#define SPLASH_IMG_W        320
+#define SPLASH_IMG_H        480
+
+/* Stream opcodes (see splash_compress.py) */
+#define SPLASH_OP_DIFF      0x40
+#define SPLASH_OP_LUMA      0x80
+#define SPLASH_OP_RUN       0xC0
+#define SPLASH_OP_RAW       0xFE
+
+/* Color index slot of an RGB565 pixel */
+#define SPLASH_HASH(px)     ((((px) >> 11) * 3 + (((px) >> 5) & 0x3F) * 5 + ((px) & 0x1F) * 7) & 0x3F)
+
+/* RGB565 to lv_color_t layout (LV_COLOR_16_SWAP keeps pixels in wire byte order) */
+#if LV_COLOR_16_SWAP
+#define SPLASH_COLOR(px)    ((uint16_t)(((px) >> 8) | ((px) << 8)))
+#else
+#define SPLASH_COLOR(px)    ((uint16_t)(px))
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Open decoder state: last decoded row, reused for partial row reads
+ */
+typedef struct {
+    int32_t y;                  // Row held in row[], -1 if none
+    lv_color_t row[SPLASH_IMG_W];
+} splash_dec_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void splash_decode_row(const splash_rle_t *img, uint32_t y, lv_color_t *out);
+static bool splash_is_src(const void *src);
+static lv_res_t splash_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header);
+static lv_res_t splash_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+static lv_res_t splash_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+                                 lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf);
+static void splash_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+
+/**********************
+ * GLOBAL VARIABLES
+ **********************/
+const lv_img_dsc_t splash_img = {
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = SPLASH_IMG_W,
+    .header.h = SPLASH_IMG_H,
+    .data_size = sizeof(splash_rle_t),
+    .data = (const uint8_t *)&sea_rle,
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Register the splash image decoder with LVGL
+ */
+void splash_init(void)
+{
+    lv_img_decoder_t *dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, splash_info);
+    lv_img_decoder_set_open_cb(dec, splash_open);
+    lv_img_decoder_set_read_line_cb(dec, splash_read_line);
+    lv_img_decoder_set_close_cb(dec, splash_close);
+}
+
+/**
+ * @brief Stream the splash image straight to the panel
+ * @note Stripes are decoded into the LVGL draw buffers (idle before the first frame),
+ *       decoding one while the other is sent by DMA
+ */
+void splash_show(void)
+{
+    const splash_rle_t *img = &sea_rle;
+    lv_disp_draw_buf_t *draw_buf = lv_disp_get_default()->driver->draw_buf;
+
+    lv_color_t *stripe[2] = {draw_buf->buf1, draw_buf->buf2 ? draw_buf->buf2 : draw_buf->buf1};
+    uint32_t stripe_rows = draw_buf->size / img->w;
+    uint32_t i = 0;
+
+    for (uint32_t y = 0; y < img->h; y += stripe_rows, i ^= 1) {
+        uint32_t rows = LV_MIN(stripe_rows, img->h - y);
+
+        // 1. Single buffer: wait until the previous stripe has left it
+        if (stripe[0] == stripe[1]) {
+            st7796_wait_idle();
+        }
+
+        // 2. Decode the stripe while the other one is still on the bus
+        for (uint32_t r = 0; r < rows; r++) {
+            splash_decode_row(img, y + r, stripe[i] + r * img->w);
+        }
+
+        // 3. Send it (set_window waits for the previous transfer)
+        st7796_set_window(0, y, img->w - 1, y + rows - 1);
+        st7796_write_color_async((const uint16_t *)stripe[i], rows * img->w, NULL, NULL);
+    }
+
+    st7796_wait_idle();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Decode one image row
+ * @param img Compressed image
+ * @param y Row to decode
+ * @param out Output, img->w pixels
+ * @note Rows are coded independently: previous pixel and color index start cleared
+ */
+static void splash_decode_row(const splash_rle_t *img, uint32_t y, lv_color_t *out)
+{
+    const uint8_t *p = img->data + img->rows[y];
+    uint16_t index[64];
+    uint16_t prev = 0;
+    uint32_t n = 0;
+
+    memset(index, 0, sizeof(index));
+
+    while (n < img->w) {
+        uint8_t op = *p++;
+        uint16_t px;
+
+        if (op == SPLASH_OP_RAW) {
+            px = ((uint16_t)p[0] << 8) | p[1];
+            p += 2;
+        } else if (op >= SPLASH_OP_RUN) {
+            uint32_t run = (op & 0x3F) + 1;
+            uint16_t c = SPLASH_COLOR(prev);
+            while (run-- && n < img->w) {
+                out[n++].full = c;
+            }
+            continue;
+        } else if (op < SPLASH_OP_DIFF) {
+            px = index[op];
+        } else {
+            int r = prev >> 11;
+            int g = (prev >> 5) & 0x3F;
+            int b = prev & 0x1F;
+
+            if (op < SPLASH_OP_LUMA) {
+                r += ((op >> 4) & 0x03) - 2;
+                g += ((op >> 2) & 0x03) - 2;
+                b += (op & 0x03) - 2;
+            } else {
+                int dg = (op & 0x3F) - 32;
+                uint8_t rb = *p++;
+                g += dg;
+                r += (dg >> 1) + (rb >> 4) - 8;
+                b += (dg >> 1) + (rb & 0x0F) - 8;
+            }
+            px = ((r & 0x1F) << 11) | ((g & 0x3F) << 5) | (b & 0x1F);
+        }
+
+        index[SPLASH_HASH(px)] = px;
+        out[n++].full = SPLASH_COLOR(px);
+        prev = px;
+    }
+}
+
+/**
+ * @brief Check whether an image source is the compressed splash
+ */
+static bool splash_is_src(const void *src)
+{
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) {
+        return false;
+    }
+    const lv_img_dsc_t *img = src;
+    return img->header.cf == LV_IMG_CF_USER_ENCODED_0 && img->data == (const uint8_t *)&sea_rle;
+}
+
+/**
+ * @brief Decoder info callback: reported to LVGL as an opaque true color image
+ */
+static lv_res_t splash_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    LV_UNUSED(decoder);
+
+    if (!splash_is_src(src)) {
+        return LV_RES_INV;
+    }
+
+    const lv_img_dsc_t *img = src;
+    header->always_zero = 0;
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief Decoder open callback: no full frame, rows are served by splash_read_line()
+ */
+static lv_res_t splash_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+
+    if (!splash_is_src(dsc->src)) {
+        return LV_RES_INV;
+    }
+
+    splash_dec_t *dec = lv_mem_alloc(sizeof(splash_dec_t));
+    if (dec == NULL) {
+        return LV_RES_INV;
+    }
+    dec->y = -1;
+
+    dsc->user_data = dec;
+    dsc->img_data = NULL;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief Decoder read line callback
+ */
+static lv_res_t splash_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+                                 lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf)
+{
+    LV_UNUSED(decoder);
+    splash_dec_t *dec = dsc->user_data;
+
+    if (dec->y != y) {
+        splash_decode_row(&sea_rle, y, dec->row);
+        dec->y = y;
+    }
+
+    memcpy(buf, &dec->row[x], len * sizeof(lv_color_t));
+    return LV_RES_OK;
+}
+
+/**
+ * @brief Decoder close callback
+ */
+static void splash_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+
+    if (dsc->user_data != NULL) {
+        lv_mem_free(dsc->user_data);
+        dsc->user_data = NULL;
+    }
+}
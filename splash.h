@@ -0,0 +1,53 @@
+/**
+ * @file splash.h
+ * @brief Compressed Splash Image Header
+ * @note Image data is generated from sea.c by splash_compress.py at build time
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef SPLASH_H
+#define SPLASH_H
+
+#include <stdint.h>
+#include "lvgl.h"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Compressed RGB565 image (format described in splash_compress.py)
+ */
+typedef struct {
+    uint16_t w;                 // Width in pixels
+    uint16_t h;                 // Height in pixels
+    const uint32_t *rows;       // Offset of each row in data, h + 1 entries
+    const uint8_t *data;        // Compressed pixel stream
+} splash_rle_t;
+
+/**********************
+ * GLOBAL VARIABLES
+ **********************/
+/* Splash image data (generated/sea_rle.c) */
+extern const splash_rle_t sea_rle;
+
+/* Splash image for lv_img_set_src(), decoded by the splash image decoder */
+extern const lv_img_dsc_t splash_img;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Register the splash image decoder with LVGL
+ * @note Call after lv_init()
+ */
+void splash_init(void);
+
+/**
+ * @brief Stream the splash image straight to the panel
+ * @note Call after lv_port_disp_init() and before LVGL renders the first frame,
+ *       the LVGL draw buffers are borrowed as decode stripes
+ */
+void splash_show(void);
+
+#endif /* SPLASH_H */
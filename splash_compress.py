@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+#
+# Splash image compressor
+#
+# Reads the RGB565 pixel array of an LVGL image converter output (sea.c,
+# the "LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0" variant) and writes a
+# compressed C asset for splash.c.
+#
+# Format (tuned for photographic RGB565), every row is coded independently so
+# the decoder can start at any row through the row offset table. Per row the
+# previous pixel starts at 0x0000 and the 64 entry color index is cleared.
+#
+#   0b00iiiiii                    INDEX  pixel = index[i]
+#   0b01rrggbb                    DIFF   r/g/b = prev + (-2..1)
+#   0b10gggggg 0brrrrbbbb         LUMA   g = prev + (-32..31),
+#                                        r/b = prev + dg/2 + (-8..7)
+#   0b11nnnnnn (n < 62)           RUN    prev repeated n + 1 times
+#   0xfe hi lo                    RAW    pixel = hi << 8 | lo
+#
+# Every pixel that is not a RUN is stored in index[hash(pixel)], with
+# hash = (r * 3 + g * 5 + b * 7) & 63.
+#
+# The encoder decodes its own output and aborts on any pixel mismatch, so the
+# build fails rather than shipping a corrupted splash.
+#
+# Usage: splash_compress.py <sea.c> <output.c>
+#
+
+import re
+import sys
+
+WIDTH = 320
+HEIGHT = 480
+NAME = "sea_rle"
+
+VARIANT = "#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0"
+
+OP_RUN = 0xc0
+OP_RAW = 0xfe
+RUN_MAX = 62
+
+
+def load_pixels(path):
+    lines = open(path).read().split("\n")
+    start = lines.index(VARIANT) + 1
+    end = next(i for i in range(start, len(lines)) if lines[i].startswith("#endif"))
+    data = bytes(int(v, 16) for line in lines[start:end]
+                 for v in re.findall(r"0x([0-9a-fA-F]{2})", line))
+    if len(data) != WIDTH * HEIGHT * 2:
+        sys.exit("%s: expected %d bytes of RGB565, found %d" % (path, WIDTH * HEIGHT * 2, len(data)))
+    return [data[i] | data[i + 1] << 8 for i in range(0, len(data), 2)]
+
+
+def split(p):
+    return p >> 11, (p >> 5) & 0x3f, p & 0x1f
+
+
+def index_hash(p):
+    r, g, b = split(p)
+    return (r * 3 + g * 5 + b * 7) & 0x3f
+
+
+def encode_row(row):
+    out = bytearray()
+    index = [0] * 64
+    prev = 0
+    run = 0
+
+    for p in row:
+        if p == prev:
+            run += 1
+            if run == RUN_MAX:
+                out.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(OP_RUN | (run - 1))
+            run = 0
+
+        h = index_hash(p)
+        if index[h] == p:
+            out.append(h)
+        else:
+            index[h] = p
+            r, g, b = split(p)
+            pr, pg, pb = split(prev)
+            dr, dg, db = r - pr, g - pg, b - pb
+            dr_dg, db_dg = dr - (dg >> 1), db - (dg >> 1)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                out += bytes([0x80 | (dg + 32), (dr_dg + 8) << 4 | (db_dg + 8)])
+            else:
+                out += bytes([OP_RAW, p >> 8, p & 0xff])
+        prev = p
+
+    if run:
+        out.append(OP_RUN | (run - 1))
+    return out
+
+
+def decode_row(data, pos, width):
+    row = []
+    index = [0] * 64
+    prev = 0
+
+    while len(row) < width:
+        op = data[pos]
+        pos += 1
+        if op == OP_RAW:
+            p = data[pos] << 8 | data[pos + 1]
+            pos += 2
+        elif op >= OP_RUN:
+            row += [prev] * ((op & 0x3f) + 1)
+            continue
+        elif op < 0x40:
+            p = index[op]
+        else:
+            r, g, b = split(prev)
+            if op < 0x80:
+                r += ((op >> 4) & 3) - 2
+                g += ((op >> 2) & 3) - 2
+                b += (op & 3) - 2
+            else:
+                dg = (op & 0x3f) - 32
+                rb = data[pos]
+                pos += 1
+                g += dg
+                r += (dg >> 1) + (rb >> 4) - 8
+                b += (dg >> 1) + (rb & 0xf) - 8
+            p = (r & 0x1f) << 11 | (g & 0x3f) << 5 | (b & 0x1f)
+        index[index_hash(p)] = p
+        row.append(p)
+        prev = p
+
+    return row[:width], pos
+
+
+def c_array(data, per_line, fmt):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("  " + ", ".join(fmt % v for v in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: %s <sea.c> <output.c>" % sys.argv[0])
+
+    pixels = load_pixels(sys.argv[1])
+
+    data = bytearray()
+    rows = []
+    for y in range(HEIGHT):
+        rows.append(len(data))
+        data += encode_row(pixels[y * WIDTH:(y + 1) * WIDTH])
+    rows.append(len(data))
+
+    # Round trip check, pixel exact against the source array
+    for y in range(HEIGHT):
+        row, end = decode_row(data, rows[y], WIDTH)
+        if row != pixels[y * WIDTH:(y + 1) * WIDTH] or end != rows[y + 1]:
+            sys.exit("%s: round trip mismatch in row %d" % (sys.argv[0], y))
+
+    with open(sys.argv[2], "w") as f:
+        f.write("/* Generated by splash_compress.py from sea.c, do not edit */\n")
+        f.write("/* %d x %d RGB565, %d bytes (raw %d bytes) */\n\n"
+                % (WIDTH, HEIGHT, len(data), WIDTH * HEIGHT * 2))
+        f.write('#include "splash.h"\n\n')
+        f.write("static const uint32_t %s_rows[] = {\n%s\n};\n\n"
+                % (NAME, c_array(rows, 8, "%6d")))
+        f.write("static const uint8_t %s_data[] = {\n%s\n};\n\n"
+                % (NAME, c_array(data, 16, "0x%02x")))
+        f.write("const splash_rle_t %s = {\n" % NAME)
+        f.write("    .w = %d,\n    .h = %d,\n" % (WIDTH, HEIGHT))
+        f.write("    .rows = %s_rows,\n    .data = %s_data,\n};\n" % (NAME, NAME))
+
+    print("%s: %d -> %d bytes" % (sys.argv[2], WIDTH * HEIGHT * 2, len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -12,8 +12,16 @@
 #include "st7796.h"
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
 #include <string.h>
 
+#if ST7796_BUS_PIO
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+#include "st7796.pio.h"
+#endif
+
 /**********************
  *      DEFINES
  **********************/
@@ -25,6 +33,47 @@
 #define LCD_RST_LOW()   gpio_put(ST7796_PIN_RST, 0)
 #define LCD_RST_HIGH()  gpio_put(ST7796_PIN_RST, 1)
 
+/* Optional settle time around command transactions */
+#if ST7796_CMD_DELAY_US > 0
+#define LCD_CMD_DELAY() sleep_us(ST7796_CMD_DELAY_US)
+#else
+#define LCD_CMD_DELAY() ((void)0)
+#endif
+
+/* Transfer timestamps (ST7796_USE_TIMING) */
+#if ST7796_USE_TIMING
+#define LCD_TIME_NOW()  time_us_32()
+#else
+#define LCD_TIME_NOW()  0u
+#endif
+
+/* DMA IRQ line derived from the configured index */
+#define LCD_DMA_IRQ     (DMA_IRQ_0 + ST7796_DMA_IRQ_INDEX)
+
+/* Pixel buffer value to native RGB565 (see ST7796_PIXEL_SWAPPED) */
+#if ST7796_PIXEL_SWAPPED
+#define LCD_PIXEL_TO_NATIVE(c)  ((uint16_t)(((c) >> 8) | ((c) << 8)))
+#else
+#define LCD_PIXEL_TO_NATIVE(c)  ((uint16_t)(c))
+#endif
+
+#if ST7796_BUS_PIO
+#if ST7796_PIN_DC != ST7796_PIN_CS + 1
+#error "ST7796_BUS_PIO drives CS and DC with one SET instruction, DC must follow CS"
+#endif
+
+/* PIO stream unit encoding, see st7796.pio for the word layout */
+#define PIO_UNIT_DATA               (1u << 31)
+#define PIO_UNIT_RUN                (1u << 30)
+#define PIO_UNIT_CMD(c)             ((uint32_t)(c) << 22)
+#define PIO_UNIT_BYTE(b)            (PIO_UNIT_DATA | ((uint32_t)(b) << 22))
+#define PIO_UNIT_RUN_HDR(w, bits)   (PIO_UNIT_DATA | PIO_UNIT_RUN | \
+                                     (((uint32_t)(bits) - 1) << 25) | ((uint32_t)(w) - 1))
+
+/* Window setup (CASET + 4, RASET + 4, RAMWR), an odd fill pixel and the pixel run header */
+#define PIO_PROLOGUE_MAX            16
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -41,16 +90,61 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void st7796_write_cmd(uint8_t cmd);
-static void st7796_write_data(const uint8_t *data, uint16_t len);
+static void st7796_write_cmd_data(uint8_t cmd, const uint8_t *data, uint16_t len);
 static void st7796_hw_reset(void);
 static void st7796_gpio_init(void);
+#if ST7796_BUS_PIO
+static void st7796_pio_init(void);
+static void st7796_pio_flush_prologue(void);
+static void st7796_pio_wait_drained(void);
+static uint32_t *st7796_pio_encode_cmd(uint32_t *p, uint8_t cmd, const uint8_t *data, uint16_t len);
+#else
 static void st7796_spi_init(void);
+static void st7796_spi_cmd_data(uint8_t cmd, const uint8_t *data, uint16_t len);
+#endif
+static void st7796_dma_init(void);
+static void st7796_dma_start(const volatile void *src, uint32_t count,
+                             enum dma_channel_transfer_size size, bool read_inc);
+static void st7796_dma_irq_handler(void);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static st7796_orientation_t current_orientation = ST7796_PORTRAIT;
 
+/* Panel address window as last programmed, RAMWR restarts at its origin */
+static bool win_valid = false;
+static uint16_t win_x1, win_y1, win_x2, win_y2;
+
+/* Bus command statistics */
+static st7796_stats_t bus_stats;
+
+/* Timing of the current / last transfer (ST7796_USE_TIMING) */
+static st7796_timing_t bus_timing;
+
+/* DMA transfer state */
+static int dma_tx_chan = -1;                        // Claimed DMA channel (pixel data)
+static volatile bool dma_busy = false;              // Transfer in progress
+static st7796_xfer_done_cb_t dma_done_cb = NULL;    // Completion callback
+static void *dma_done_user_data = NULL;             // Completion callback argument
+static uint32_t dma_fill_word = 0;                  // Source of non-incrementing fill transfers
+static const uint16_t *dma_row_src = NULL;          // Current row of a strided transfer
+static uint32_t dma_row_stride = 0;                 // Row stride in pixels
+static uint32_t dma_row_count = 0;                  // DMA transfers per row
+static volatile uint32_t dma_rows_left = 0;         // Rows still to be started by the IRQ handler
+#if !ST7796_BUS_PIO
+static volatile bool dma_wide_active = false;       // SPI switched to 16-bit frames for pixel data
+#endif
+
+#if ST7796_BUS_PIO
+/* PIO transport state */
+static uint pio_sm = 0;                             // State machine running st7796_lcd
+static uint pio_offset = 0;                         // Program offset, the idle pull is at its wrap target
+static int dma_pre_chan = -1;                       // Prologue channel, chains into dma_tx_chan
+static uint32_t pio_prologue[PIO_PROLOGUE_MAX];     // Encoded window setup awaiting pixel data
+static uint32_t pio_prologue_len = 0;               // Number of words in pio_prologue
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -60,12 +154,17 @@ static st7796_orientation_t current_orientation = ST7796_PORTRAIT;
  */
 void st7796_init(void)
 {
-    // 1. Initialize SPI interface
-    st7796_spi_init();
-    
-    // 2. Initialize GPIO pins
+    // 1. Initialize GPIO pins
     st7796_gpio_init();
     
+    // 2. Initialize bus transport and its TX DMA channel
+#if ST7796_BUS_PIO
+    st7796_pio_init();
+#else
+    st7796_spi_init();
+#endif
+    st7796_dma_init();
+    
     // 3. Hardware reset
     st7796_hw_reset();
     
@@ -121,13 +220,9 @@ void st7796_init(void)
     // 5. Send initialization commands sequentially
     uint16_t cmd_idx = 0;
     while (init_cmds[cmd_idx].databytes != 0xFF) {
-        st7796_write_cmd(init_cmds[cmd_idx].cmd);
-        
-        // If there is data, send it
+        // Command and its data go out in one CS-held transaction
         uint8_t data_len = init_cmds[cmd_idx].databytes & 0x1F;  // Lower 5 bits = data length
-        if (data_len > 0) {
-            st7796_write_data(init_cmds[cmd_idx].data, data_len);
-        }
+        st7796_write_cmd_data(init_cmds[cmd_idx].cmd, init_cmds[cmd_idx].data, data_len);
         
         // If delay is needed (bit7=1)
         if (init_cmds[cmd_idx].databytes & 0x80) {
@@ -142,6 +237,9 @@ void st7796_init(void)
     
     // 7. Enable color inversion (may be needed depending on screen characteristics)
     st7796_write_cmd(0x21);  // Display Inversion ON
+    
+    // The init sequence programmed its own address window, don't trust it
+    win_valid = false;
 }
 
 /**
@@ -152,8 +250,6 @@ void st7796_set_orientation(st7796_orientation_t orientation)
 {
     current_orientation = orientation;
     
-    st7796_write_cmd(ST7796_CMD_MADCTL);  // 0x36
-    
     uint8_t madctl_value;
     
     // Set MADCTL register according to orientation
@@ -183,10 +279,19 @@ void st7796_set_orientation(st7796_orientation_t orientation)
             break;
     }
     
-    LCD_CS_LOW();
-    LCD_DC_DATA();
-    spi_write_blocking(ST7796_SPI_PORT, &madctl_value, 1);
-    LCD_CS_HIGH();
+    st7796_write_cmd_data(ST7796_CMD_MADCTL, &madctl_value, 1);  // 0x36
+    
+    // Row/column exchange changes what the address window means
+    win_valid = false;
+}
+
+/**
+ * @brief Get display orientation
+ * @return Orientation set by the last st7796_set_orientation()
+ */
+st7796_orientation_t st7796_get_orientation(void)
+{
+    return current_orientation;
 }
 
 /**
@@ -198,26 +303,53 @@ void st7796_set_orientation(st7796_orientation_t orientation)
  */
 void st7796_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
-    uint8_t data[4];
-    
-    // Set column address range (X coordinate)
-    st7796_write_cmd(ST7796_CMD_CASET);  // 0x2A
-    data[0] = (x1 >> 8) & 0xFF;  // Start X high byte
-    data[1] = x1 & 0xFF;         // Start X low byte
-    data[2] = (x2 >> 8) & 0xFF;  // End X high byte
-    data[3] = x2 & 0xFF;         // End X low byte
-    st7796_write_data(data, 4);
-    
-    // Set row address range (Y coordinate)
-    st7796_write_cmd(ST7796_CMD_RASET);  // 0x2B
-    data[0] = (y1 >> 8) & 0xFF;  // Start Y high byte
-    data[1] = y1 & 0xFF;         // Start Y low byte
-    data[2] = (y2 >> 8) & 0xFF;  // End Y high byte
-    data[3] = y2 & 0xFF;         // End Y low byte
-    st7796_write_data(data, 4);
-    
-    // Prepare to write GRAM
-    st7796_write_cmd(ST7796_CMD_RAMWR);  // 0x2C
+    // RAMWR always restarts at the window origin, so CASET/RASET only need to be
+    // sent when the range changes (full-width stripes share the same columns)
+    bool send_col = !win_valid || x1 != win_x1 || x2 != win_x2;
+    bool send_row = !win_valid || y1 != win_y1 || y2 != win_y2;
+    
+    uint8_t col[4] = {x1 >> 8, x1 & 0xFF, x2 >> 8, x2 & 0xFF};  // Start/end X, high byte first
+    uint8_t row[4] = {y1 >> 8, y1 & 0xFF, y2 >> 8, y2 & 0xFF};  // Start/end Y, high byte first
+    
+    st7796_wait_idle();
+    uint32_t start_us = LCD_TIME_NOW();
+    
+#if ST7796_BUS_PIO
+    // Only encoded here: the prologue is sent by DMA right ahead of the pixel data
+    st7796_pio_flush_prologue();
+    
+    uint32_t *p = pio_prologue;
+    if (send_col) {
+        p = st7796_pio_encode_cmd(p, ST7796_CMD_CASET, col, 4);  // 0x2A
+    }
+    if (send_row) {
+        p = st7796_pio_encode_cmd(p, ST7796_CMD_RASET, row, 4);  // 0x2B
+    }
+    p = st7796_pio_encode_cmd(p, ST7796_CMD_RAMWR, NULL, 0);     // 0x2C
+    pio_prologue_len = p - pio_prologue;
+#else
+    // Whole burst in one CS-held transaction
+    LCD_CS_LOW();
+    if (send_col) {
+        st7796_spi_cmd_data(ST7796_CMD_CASET, col, 4);  // 0x2A
+    }
+    if (send_row) {
+        st7796_spi_cmd_data(ST7796_CMD_RASET, row, 4);  // 0x2B
+    }
+    st7796_spi_cmd_data(ST7796_CMD_RAMWR, NULL, 0);     // 0x2C
+    LCD_CS_HIGH();
+#endif
+    
+    bus_timing.window_us = LCD_TIME_NOW() - start_us;
+    bus_stats.windows++;
+    bus_stats.cmds_sent += 1 + send_col + send_row;
+    bus_stats.cmds_elided += !send_col + !send_row;
+    
+    win_valid = true;
+    win_x1 = x1;
+    win_y1 = y1;
+    win_x2 = x2;
+    win_y2 = y2;
 }
 
 /**
@@ -232,55 +364,267 @@ void st7796_write_color(const uint16_t *color, uint32_t len)
         return;
     }
     
+#if ST7796_BUS_PIO
+    // The PIO stream needs the prologue/run framing, reuse the DMA path and wait for it
+    st7796_write_color_async(color, len, NULL, NULL);
+    st7796_wait_idle();
+#else
+    st7796_wait_idle();
+    
     LCD_CS_LOW();
     LCD_DC_DATA();
     
     // Write color data
     // RGB565 format: 2 bytes per pixel
+#if ST7796_PIXEL_SWAPPED
     spi_write_blocking(ST7796_SPI_PORT, (const uint8_t *)color, len * 2);
+#else
+    // Native pixels: 16-bit frames send the high byte first
+    spi_set_format(ST7796_SPI_PORT, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    spi_write16_blocking(ST7796_SPI_PORT, color, len);
+    spi_set_format(ST7796_SPI_PORT, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+#endif
     
     LCD_CS_HIGH();
+#endif
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+/**
+ * @brief Start DMA transfer of color data to display area (non-blocking)
+ * @param color Color data pointer (RGB565 format), must stay valid until done_cb runs
+ * @param len Number of pixels
+ * @param done_cb Called from IRQ context once the last pixel has left the SPI bus (may be NULL)
+ * @param user_data Passed through to done_cb
+ * @note Must call st7796_set_window() to set display area before calling this function
+ */
+void st7796_write_color_async(const uint16_t *color, uint32_t len,
+                              st7796_xfer_done_cb_t done_cb, void *user_data)
+{
+    // A contiguous buffer is a single row
+    st7796_write_rect_async(color, len, 1, len, done_cb, user_data);
+}
 
 /**
- * @brief Send command to ST7796
- * @param cmd Command byte
+ * @brief Start DMA transfer of a pixel rectangle with a row stride (non-blocking)
+ * @param color First pixel (RGB565 format), RAM or XIP flash, must stay valid until done_cb runs
+ * @param w Pixels per row
+ * @param h Number of rows
+ * @param stride Distance between row starts in pixels
+ * @param done_cb Called from IRQ context once the last row has been consumed (may be NULL)
+ * @param user_data Passed through to done_cb
+ * @note Must call st7796_set_window() to set display area before calling this function
  */
-static void st7796_write_cmd(uint8_t cmd)
+void st7796_write_rect_async(const uint16_t *color, uint32_t w, uint32_t h, uint32_t stride,
+                             st7796_xfer_done_cb_t done_cb, void *user_data)
 {
-    LCD_CS_LOW();
-    LCD_DC_CMD();       // DC=0 means sending command
-    sleep_us(1);        // Brief delay to ensure signal stability
+    if (w == 0 || h == 0 || color == NULL) {
+        if (done_cb != NULL) {
+            done_cb(user_data);
+        }
+        return;
+    }
     
-    spi_write_blocking(ST7796_SPI_PORT, &cmd, 1);
+    st7796_wait_idle();
     
-    sleep_us(1);
-    LCD_CS_HIGH();
+    dma_done_cb = done_cb;
+    dma_done_user_data = user_data;
+    dma_busy = true;
+    
+    // First row is started here, the rest by st7796_dma_irq_handler()
+    dma_row_src = color;
+    dma_row_stride = stride;
+    dma_rows_left = h - 1;
+    bus_timing.bytes = w * h * 2;
+    
+#if ST7796_BUS_PIO
+    // Whole 32-bit words (2 pixels each) when every row allows it, otherwise one pixel per word.
+    // Native pixels always go one per word: the DMA can swap bytes but not the two pixels of a word.
+    bool wide = ST7796_PIXEL_SWAPPED &&
+                ((w & 1) == 0) && (((uintptr_t)color & 3) == 0) && (h == 1 || (stride & 1) == 0);
+    dma_row_count = wide ? w / 2 : w;
+    
+    // One run header for all rows, the engine just waits for words between rows
+    pio_prologue[pio_prologue_len++] = PIO_UNIT_RUN_HDR(dma_row_count * h, wide ? 32 : 16);
+    st7796_dma_start(color, dma_row_count, wide ? DMA_SIZE_32 : DMA_SIZE_16, true);
+#else
+    // 16-bit frames: one transfer per pixel, the frame's high byte goes first.
+    // Halves the reads compared to 8-bit frames, which matters for uncached flash sources.
+    dma_row_count = w;
+    dma_wide_active = true;
+    spi_set_format(ST7796_SPI_PORT, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    
+    LCD_CS_LOW();
+    LCD_DC_DATA();
+    
+    // Hand the buffer to DMA; completion is reported by st7796_dma_irq_handler()
+    st7796_dma_start(color, w, DMA_SIZE_16, true);
+#endif
 }
 
 /**
- * @brief Send data to ST7796
- * @param data Data buffer pointer
- * @param len Data length (bytes)
+ * @brief Fill display area with a single color (blocking)
+ * @param color Pixel value, same in-memory representation as st7796_write_color() buffers
+ * @param len Number of pixels
+ * @note Must call st7796_set_window() to set display area before calling this function
+ */
+void st7796_fill_color(uint16_t color, uint32_t len)
+{
+    st7796_fill_color_async(color, len, NULL, NULL);
+    st7796_wait_idle();
+}
+
+/**
+ * @brief Fill display area with a single color by DMA (non-blocking)
+ * @param color Pixel value, same in-memory representation as st7796_write_color() buffers
+ * @param len Number of pixels
+ * @param done_cb Called from IRQ context once the fill has been queued (may be NULL)
+ * @param user_data Passed through to done_cb
+ * @note Must call st7796_set_window() to set display area before calling this function
  */
-static void st7796_write_data(const uint8_t *data, uint16_t len)
+void st7796_fill_color_async(uint16_t color, uint32_t len,
+                             st7796_xfer_done_cb_t done_cb, void *user_data)
 {
-    if (len == 0 || data == NULL) {
+    if (len == 0) {
+        if (done_cb != NULL) {
+            done_cb(user_data);
+        }
         return;
     }
     
+    st7796_wait_idle();
+    
+    uint16_t native = LCD_PIXEL_TO_NATIVE(color);
+    
+#if ST7796_BUS_PIO
+    // Odd pixel goes inline in the prologue, the rest as 2-pixel words
+    if (len & 1) {
+        pio_prologue[pio_prologue_len++] = PIO_UNIT_RUN_HDR(1, 16);
+        pio_prologue[pio_prologue_len++] = (uint32_t)native << 16;
+    }
+    bus_timing.bytes = len * 2;
+    if (len < 2) {
+        bus_timing.start_us = LCD_TIME_NOW();
+        st7796_pio_flush_prologue();
+        st7796_pio_wait_drained();
+        bus_timing.end_us = LCD_TIME_NOW();
+        if (done_cb != NULL) {
+            done_cb(user_data);
+        }
+        return;
+    }
+    
+    dma_fill_word = ((uint32_t)native << 16) | native;
+    dma_done_cb = done_cb;
+    dma_done_user_data = user_data;
+    dma_busy = true;
+    
+    pio_prologue[pio_prologue_len++] = PIO_UNIT_RUN_HDR(len / 2, 32);
+    st7796_dma_start(&dma_fill_word, len / 2, DMA_SIZE_32, false);
+#else
+    // 16-bit frames so a non-incrementing read repeats the whole pixel,
+    // the IRQ handler switches back to 8-bit frames
+    dma_fill_word = native;
+    bus_timing.bytes = len * 2;
+    dma_done_cb = done_cb;
+    dma_done_user_data = user_data;
+    dma_busy = true;
+    dma_wide_active = true;
+    
+    spi_set_format(ST7796_SPI_PORT, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    
     LCD_CS_LOW();
-    LCD_DC_DATA();      // DC=1 means sending data
-    sleep_us(1);
+    LCD_DC_DATA();
+    st7796_dma_start(&dma_fill_word, len, DMA_SIZE_16, false);
+#endif
+}
+
+/**
+ * @brief Get bus command statistics
+ * @param stats Output: counters accumulated since init or the last reset
+ */
+void st7796_get_stats(st7796_stats_t *stats)
+{
+    if (stats != NULL) {
+        *stats = bus_stats;
+    }
+}
+
+/**
+ * @brief Reset bus command statistics
+ */
+void st7796_reset_stats(void)
+{
+    memset(&bus_stats, 0, sizeof(bus_stats));
+}
+
+/**
+ * @brief Get the timing of the last completed transfer
+ * @param timing Output, all zero when ST7796_USE_TIMING is disabled
+ */
+void st7796_get_timing(st7796_timing_t *timing)
+{
+    if (timing != NULL) {
+        *timing = bus_timing;
+    }
+}
+
+/**
+ * @brief Check whether a DMA transfer is in progress
+ * @return true if the bus is busy
+ */
+bool st7796_is_busy(void)
+{
+    return dma_busy;
+}
+
+/**
+ * @brief Block until any DMA transfer in progress has completed
+ */
+void st7796_wait_idle(void)
+{
+    while (dma_busy) {
+        tight_loop_contents();
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Send command to ST7796
+ * @param cmd Command byte
+ */
+static void st7796_write_cmd(uint8_t cmd)
+{
+    st7796_write_cmd_data(cmd, NULL, 0);
+}
+
+/**
+ * @brief Send command and its parameters to ST7796 in one transaction
+ * @param cmd Command byte
+ * @param data Parameter buffer pointer (may be NULL when len is 0)
+ * @param len Parameter length (bytes)
+ */
+static void st7796_write_cmd_data(uint8_t cmd, const uint8_t *data, uint16_t len)
+{
+    st7796_wait_idle();
     
-    spi_write_blocking(ST7796_SPI_PORT, data, len);
+#if ST7796_BUS_PIO
+    st7796_pio_flush_prologue();
     
-    sleep_us(1);
+    uint32_t units[1 + 16];
+    uint32_t *end = st7796_pio_encode_cmd(units, cmd, data, len > 16 ? 16 : len);
+    for (uint32_t *p = units; p < end; p++) {
+        pio_sm_put_blocking(ST7796_PIO, pio_sm, *p);
+    }
+#else
+    LCD_CS_LOW();
+    st7796_spi_cmd_data(cmd, data, len);
     LCD_CS_HIGH();
+#endif
+    
+    bus_stats.cmds_sent++;
 }
 
 /**
@@ -320,6 +664,89 @@ static void st7796_gpio_init(void)
     gpio_put(ST7796_PIN_RST, 1);  // Default high (no reset)
 }
 
+#if ST7796_BUS_PIO
+/**
+ * @brief Initialize PIO bus engine
+ * @note Two PIO cycles per bit, clock divider chosen to match ST7796_SPI_BAUDRATE
+ */
+static void st7796_pio_init(void)
+{
+    pio_sm = pio_claim_unused_sm(ST7796_PIO, true);
+    uint offset = pio_add_program(ST7796_PIO, &st7796_lcd_program);
+    pio_offset = offset;
+    
+    float div = (float)clock_get_hz(clk_sys) / (2.0f * ST7796_SPI_BAUDRATE);
+    if (div < 1.0f) {
+        div = 1.0f;
+    }
+    
+    st7796_lcd_program_init(ST7796_PIO, pio_sm, offset,
+                            ST7796_PIN_CLK, ST7796_PIN_MOSI, ST7796_PIN_CS, div);
+}
+
+/**
+ * @brief Encode a command and its parameters as PIO stream units
+ * @param p Output position
+ * @param cmd Command byte
+ * @param data Parameter buffer pointer (may be NULL when len is 0)
+ * @param len Parameter length (bytes)
+ * @return Output position after the encoded units
+ */
+static uint32_t *st7796_pio_encode_cmd(uint32_t *p, uint8_t cmd, const uint8_t *data, uint16_t len)
+{
+    *p++ = PIO_UNIT_CMD(cmd);
+    for (uint16_t i = 0; i < len; i++) {
+        *p++ = PIO_UNIT_BYTE(data[i]);
+    }
+    return p;
+}
+
+/**
+ * @brief Push a window prologue that was never followed by pixel data
+ * @note Keeps command order intact when st7796_set_window() is followed by another command
+ */
+static void st7796_pio_flush_prologue(void)
+{
+    for (uint32_t i = 0; i < pio_prologue_len; i++) {
+        pio_sm_put_blocking(ST7796_PIO, pio_sm, pio_prologue[i]);
+    }
+    pio_prologue_len = 0;
+}
+
+/**
+ * @brief Wait until the state machine has shifted out everything queued (ST7796_USE_TIMING only)
+ * @note Empty FIFO and the PC on the header pull: the last bit of the last unit is on the wire
+ */
+static void st7796_pio_wait_drained(void)
+{
+#if ST7796_USE_TIMING
+    while (!pio_sm_is_tx_fifo_empty(ST7796_PIO, pio_sm) ||
+           pio_sm_get_pc(ST7796_PIO, pio_sm) != pio_offset + st7796_lcd_wrap_target) {
+        tight_loop_contents();
+    }
+#endif
+}
+#else
+/**
+ * @brief Clock out a command and its parameters
+ * @param cmd Command byte
+ * @param data Parameter buffer pointer (may be NULL when len is 0)
+ * @param len Parameter length (bytes)
+ * @note CS must already be low; DC is switched in between without releasing CS
+ */
+static void st7796_spi_cmd_data(uint8_t cmd, const uint8_t *data, uint16_t len)
+{
+    LCD_DC_CMD();       // DC=0 means sending command
+    LCD_CMD_DELAY();
+    spi_write_blocking(ST7796_SPI_PORT, &cmd, 1);
+    
+    if (len > 0 && data != NULL) {
+        LCD_DC_DATA();  // DC=1 means sending data
+        spi_write_blocking(ST7796_SPI_PORT, data, len);
+    }
+    LCD_CMD_DELAY();
+}
+
 /**
  * @brief Initialize SPI interface
  */
@@ -336,4 +763,132 @@ static void st7796_spi_init(void)
     gpio_set_function(ST7796_PIN_MOSI, GPIO_FUNC_SPI);  // MOSI (data output)
     gpio_set_function(ST7796_PIN_CLK, GPIO_FUNC_SPI);   // CLK (clock)
 }
+#endif
+
+/**
+ * @brief Initialize DMA channels for pixel transfers
+ * @note Pixel transfers run MSB first (16-bit SPI frames / PIO engine). Wire order buffers
+ *       (ST7796_PIXEL_SWAPPED) are byte-swapped by the DMA, native buffers need nothing.
+ */
+static void st7796_dma_init(void)
+{
+    dma_tx_chan = dma_claim_unused_channel(true);
+    
+    dma_channel_config c = dma_channel_get_default_config(dma_tx_chan);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+#if ST7796_BUS_PIO
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);  // Updated per transfer
+    channel_config_set_bswap(&c, ST7796_PIXEL_SWAPPED);
+    channel_config_set_dreq(&c, pio_get_dreq(ST7796_PIO, pio_sm, true));
+    dma_channel_configure(dma_tx_chan, &c, &ST7796_PIO->txf[pio_sm], NULL, 0, false);
+    
+    // Prologue channel: window setup words from RAM, then triggers the pixel channel
+    dma_pre_chan = dma_claim_unused_channel(true);
+    dma_channel_config pc = dma_channel_get_default_config(dma_pre_chan);
+    channel_config_set_transfer_data_size(&pc, DMA_SIZE_32);
+    channel_config_set_read_increment(&pc, true);
+    channel_config_set_write_increment(&pc, false);
+    channel_config_set_dreq(&pc, pio_get_dreq(ST7796_PIO, pio_sm, true));
+    channel_config_set_chain_to(&pc, dma_tx_chan);
+    dma_channel_configure(dma_pre_chan, &pc, &ST7796_PIO->txf[pio_sm], pio_prologue, 0, false);
+#else
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);  // Updated per transfer
+    channel_config_set_dreq(&c, spi_get_dreq(ST7796_SPI_PORT, true));
+    
+    dma_channel_configure(dma_tx_chan, &c,
+                          &spi_get_hw(ST7796_SPI_PORT)->dr,  // Write to SPI data register
+                          NULL,                              // Read address set per transfer
+                          0,                                 // Transfer count set per transfer
+                          false);                            // Don't start yet
+#endif
+    
+    // Completion interrupt (shared so other drivers can use the same DMA IRQ line)
+    dma_irqn_set_channel_enabled(ST7796_DMA_IRQ_INDEX, dma_tx_chan, true);
+    irq_add_shared_handler(LCD_DMA_IRQ, st7796_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(LCD_DMA_IRQ, true);
+}
+
+/**
+ * @brief Start the pixel DMA channel
+ * @param src Source address
+ * @param count Number of transfers
+ * @param size Transfer size
+ * @param read_inc true to walk a buffer, false to repeat one word (fill)
+ * @note Wire order buffers are byte-swapped into MSB-first order, native buffers and
+ *       fill words are already in that order.
+ *       PIO: the pending prologue goes first on the chained channel.
+ */
+static void st7796_dma_start(const volatile void *src, uint32_t count,
+                             enum dma_channel_transfer_size size, bool read_inc)
+{
+    dma_channel_config c = dma_get_channel_config(dma_tx_chan);
+    channel_config_set_transfer_data_size(&c, size);
+    channel_config_set_read_increment(&c, read_inc);
+    channel_config_set_bswap(&c, read_inc && ST7796_PIXEL_SWAPPED);
+    bus_timing.start_us = LCD_TIME_NOW();
+#if ST7796_BUS_PIO
+    dma_channel_configure(dma_tx_chan, &c, &ST7796_PIO->txf[pio_sm], src, count, false);
+    
+    // Prologue channel sends window setup + run header, then chains into the pixel channel
+    uint32_t pre_len = pio_prologue_len;
+    pio_prologue_len = 0;
+    dma_channel_transfer_from_buffer_now(dma_pre_chan, pio_prologue, pre_len);
+#else
+    dma_channel_configure(dma_tx_chan, &c, &spi_get_hw(ST7796_SPI_PORT)->dr, src, count, true);
+#endif
+}
 
+/**
+ * @brief DMA completion interrupt handler
+ * @note SPI: DMA completion only means the last byte entered the SPI FIFO,
+ *       wait for the shifter to drain before releasing CS.
+ *       PIO: CS stays asserted and later units queue behind the pixels, nothing to wait for
+ *       except with ST7796_USE_TIMING, where end_us waits for the FIFO to drain (up to 8 words).
+ */
+static void st7796_dma_irq_handler(void)
+{
+    if (!dma_irqn_get_channel_status(ST7796_DMA_IRQ_INDEX, dma_tx_chan)) {
+        return;  // Not our channel
+    }
+    dma_irqn_acknowledge_channel(ST7796_DMA_IRQ_INDEX, dma_tx_chan);
+    
+    // Strided transfer: start the next row, the bus transaction stays open
+    if (dma_rows_left > 0) {
+        dma_rows_left--;
+        dma_row_src += dma_row_stride;
+        dma_channel_transfer_from_buffer_now(dma_tx_chan, dma_row_src, dma_row_count);
+        return;
+    }
+    
+#if !ST7796_BUS_PIO
+    while (spi_is_busy(ST7796_SPI_PORT)) {
+        tight_loop_contents();
+    }
+    LCD_CS_HIGH();
+    
+    // DMA only writes TX, discard whatever was clocked into RX and clear the overrun flag
+    while (spi_is_readable(ST7796_SPI_PORT)) {
+        (void)spi_get_hw(ST7796_SPI_PORT)->dr;
+    }
+    spi_get_hw(ST7796_SPI_PORT)->icr = SPI_SSPICR_RORIC_BITS;
+    
+    if (dma_wide_active) {
+        spi_set_format(ST7796_SPI_PORT, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+        dma_wide_active = false;
+    }
+#else
+    st7796_pio_wait_drained();
+#endif
+    
+    bus_timing.end_us = LCD_TIME_NOW();
+    
+    st7796_xfer_done_cb_t cb = dma_done_cb;
+    void *user_data = dma_done_user_data;
+    dma_done_cb = NULL;
+    dma_busy = false;
+    
+    if (cb != NULL) {
+        cb(user_data);
+    }
+}
@@ -30,6 +30,42 @@
 /* SPI Clock Frequency (Hz) */
 #define ST7796_SPI_BAUDRATE (62500000)  // 62.5MHz
 
+/* Bus Transport Selection
+ * 0: Hardware SPI, CS/DC driven by the CPU around each transaction
+ * 1: PIO engine (st7796.pio), CS/DC carried inside the FIFO word stream so
+ *    window setup and pixels are queued by chained DMA without CPU gaps
+ *    (requires ST7796_PIN_DC == ST7796_PIN_CS + 1)
+ */
+#ifndef ST7796_BUS_PIO
+#define ST7796_BUS_PIO      0
+#endif
+#define ST7796_PIO          pio1    // PIO block used by the PIO transport
+
+/* Delay (us) inserted around command transactions, 0 = none.
+ * spi_write_blocking() already returns only after the last bit has left the
+ * shifter, so DC/CS can change right away at the configured bus speed. */
+#ifndef ST7796_CMD_DELAY_US
+#define ST7796_CMD_DELAY_US 0
+#endif
+
+/* Pixel Buffer Byte Order
+ * 0: native RGB565 (uint16_t value per pixel), the transfer stage swaps to wire order
+ *    (16-bit SPI frames / PIO shifter send the high byte first)
+ * 1: wire order, high byte first in memory (LVGL LV_COLOR_16_SWAP)
+ */
+#ifndef ST7796_PIXEL_SWAPPED
+#define ST7796_PIXEL_SWAPPED    0
+#endif
+
+/* DMA Configuration */
+#define ST7796_DMA_IRQ_INDEX    0   // Shared DMA IRQ line used for transfer completion (DMA_IRQ_0)
+
+/* Transfer timestamps: 1 = st7796_get_timing() reports the last transfer (profiling), 0 = off.
+ * On the PIO bus the completion interrupt then also waits for the TX FIFO to drain */
+#ifndef ST7796_USE_TIMING
+#define ST7796_USE_TIMING       0
+#endif
+
 /* ST7796 Command Definitions - from datasheet */
 #define ST7796_CMD_SWRESET      0x01
 #define ST7796_CMD_SLPIN        0x10
@@ -55,6 +91,31 @@ typedef enum {
     ST7796_LANDSCAPE_INV    = 3   // Landscape mode inverted
 } st7796_orientation_t;
 
+/**
+ * @brief Bus command statistics
+ */
+typedef struct {
+    uint32_t cmds_sent;         // Commands put on the bus
+    uint32_t cmds_elided;       // CASET/RASET skipped because the address range was unchanged
+    uint32_t windows;           // st7796_set_window() calls
+} st7796_stats_t;
+
+/**
+ * @brief Timing of the last window setup and pixel transfer (time_us_32() timestamps)
+ */
+typedef struct {
+    uint32_t window_us;         // st7796_set_window() time once the bus was idle
+    uint32_t start_us;          // Pixel transfer started
+    uint32_t end_us;            // Pixel transfer completed (last pixel left the bus, SPI and PIO alike)
+    uint32_t bytes;             // Pixel bytes sent
+} st7796_timing_t;
+
+/**
+ * @brief Transfer completion callback
+ * @note Called from DMA interrupt context, keep it short
+ */
+typedef void (*st7796_xfer_done_cb_t)(void *user_data);
+
 /**********************
  * FUNCTION PROTOTYPES
  **********************/
@@ -70,6 +131,12 @@ void st7796_init(void);
  */
 void st7796_set_orientation(st7796_orientation_t orientation);
 
+/**
+ * @brief Get display orientation
+ * @return Orientation set by the last st7796_set_orientation()
+ */
+st7796_orientation_t st7796_get_orientation(void);
+
 /**
  * @brief Set display window (drawing area)
  * @param x1 Start X coordinate
@@ -86,4 +153,75 @@ void st7796_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
  */
 void st7796_write_color(const uint16_t *color, uint32_t len);
 
+/**
+ * @brief Start DMA transfer of color data to display area (non-blocking)
+ * @param color Color data pointer (RGB565 format), must stay valid until done_cb runs
+ * @param len Number of pixels
+ * @param done_cb Called from IRQ context once the buffer has been consumed (may be NULL)
+ * @param user_data Passed through to done_cb
+ */
+void st7796_write_color_async(const uint16_t *color, uint32_t len,
+                              st7796_xfer_done_cb_t done_cb, void *user_data);
+
+/**
+ * @brief Start DMA transfer of a pixel rectangle with a row stride (non-blocking)
+ * @param color First pixel (RGB565 format), RAM or XIP flash, must stay valid until done_cb runs
+ * @param w Pixels per row
+ * @param h Number of rows
+ * @param stride Distance between row starts in pixels
+ * @param done_cb Called from IRQ context once the last row has been consumed (may be NULL)
+ * @param user_data Passed through to done_cb
+ * @note Rows after the first are chained from the DMA interrupt, the bus transaction stays open
+ */
+void st7796_write_rect_async(const uint16_t *color, uint32_t w, uint32_t h, uint32_t stride,
+                             st7796_xfer_done_cb_t done_cb, void *user_data);
+
+/**
+ * @brief Fill display area with a single color (blocking)
+ * @param color Pixel value, same in-memory representation as st7796_write_color() buffers
+ * @param len Number of pixels
+ * @note Must call st7796_set_window() to set display area before calling this function
+ */
+void st7796_fill_color(uint16_t color, uint32_t len);
+
+/**
+ * @brief Fill display area with a single color by DMA (non-blocking)
+ * @param color Pixel value, same in-memory representation as st7796_write_color() buffers
+ * @param len Number of pixels
+ * @param done_cb Called from IRQ context once the fill has been queued (may be NULL)
+ * @param user_data Passed through to done_cb
+ * @note The DMA re-reads one pixel word without incrementing, no pixel buffer is needed
+ */
+void st7796_fill_color_async(uint16_t color, uint32_t len,
+                             st7796_xfer_done_cb_t done_cb, void *user_data);
+
+/**
+ * @brief Get bus command statistics
+ * @param stats Output: counters accumulated since init or the last reset
+ */
+void st7796_get_stats(st7796_stats_t *stats);
+
+/**
+ * @brief Reset bus command statistics
+ */
+void st7796_reset_stats(void);
+
+/**
+ * @brief Get the timing of the last completed transfer
+ * @param timing Output, all zero when ST7796_USE_TIMING is disabled
+ * @note Read it from the done_cb or before the next st7796_set_window()
+ */
+void st7796_get_timing(st7796_timing_t *timing);
+
+/**
+ * @brief Check whether a DMA transfer is in progress
+ * @return true if the bus is busy
+ */
+bool st7796_is_busy(void);
+
+/**
+ * @brief Block until any DMA transfer in progress has completed
+ */
+void st7796_wait_idle(void);
+
 #endif /* ST7796_H */
\ No newline at end of file
@@ -0,0 +1,34 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Host mock of the FreeRTOS SMP kernel API used by the firmware (model in sim_rtos.c)
+ * @note Tasks are coroutines scheduled on two simulated cores. Task code takes no simulated time
+ *       except busy waits (sim_cpu_ns), blocking calls sleep until their object or timeout.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include "pico/types.h"
+#include "FreeRTOSConfig.h"
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define pdFALSE                 ((BaseType_t)0)
+#define pdTRUE                  ((BaseType_t)1)
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+
+#define portMAX_DELAY           ((TickType_t)0xFFFFFFFFu)
+#define portTICK_PERIOD_MS      ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000u))
+
+/* The scheduler re-evaluates when the interrupt returns */
+#define portYIELD_FROM_ISR(x)   ((void)(x))
+#define portYIELD()             taskYIELD()
+
+#endif /* INC_FREERTOS_H */
@@ -0,0 +1,43 @@
+/**
+ * @file adc.h
+ * @brief Pico SDK hardware_adc subset (host build)
+ * @note Free-running conversions at the programmed divider into a 4-deep FIFO, round robin over
+ *       the selected inputs. The results come from the source set with sim_adc_set_source().
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef _HARDWARE_ADC_H
+#define _HARDWARE_ADC_H
+
+#include "pico/types.h"
+#include "hardware/regs/dreq.h"
+
+typedef struct {
+    io_rw_32 cs;
+    io_ro_32 result;
+    io_rw_32 fcs;
+    io_ro_32 fifo;
+    io_rw_32 div;
+    io_ro_32 intr;
+    io_rw_32 inte;
+    io_rw_32 intf;
+    io_ro_32 ints;
+} adc_hw_t;
+
+extern adc_hw_t sim_adc_hw;
+#define adc_hw              (&sim_adc_hw)
+
+void adc_init(void);
+void adc_gpio_init(uint gpio);
+void adc_select_input(uint input);
+uint adc_get_selected_input(void);
+void adc_set_round_robin(uint input_mask);
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift);
+void adc_set_clkdiv(float clkdiv);
+void adc_run(bool run);
+void adc_fifo_drain(void);
+bool adc_fifo_is_empty(void);
+uint8_t adc_fifo_get_level(void);
+
+#endif /* _HARDWARE_ADC_H */
@@ -0,0 +1,29 @@
+/**
+ * @file clocks.h
+ * @brief Pico SDK hardware_clocks subset (host build)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef _HARDWARE_CLOCKS_H
+#define _HARDWARE_CLOCKS_H
+
+#include "pico/types.h"
+
+enum clock_index {
+    clk_gpout0 = 0,
+    clk_gpout1,
+    clk_gpout2,
+    clk_gpout3,
+    clk_ref,
+    clk_sys,
+    clk_peri,
+    clk_usb,
+    clk_adc,
+    clk_rtc,
+    CLK_COUNT
+};
+
+uint32_t clock_get_hz(enum clock_index clk_index);
+
+#endif /* _HARDWARE_CLOCKS_H */
@@ -0,0 +1,153 @@
+/**
+ * @file pio.h
+ * @brief Host mock of hardware/pio.h (instruction-level PIO emulator in sim_pio.c)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef _HARDWARE_PIO_H
+#define _HARDWARE_PIO_H
+
+#include "pico/types.h"
+#include "hardware/gpio.h"
+#include "hardware/regs/dreq.h"
+
+#define NUM_PIOS                2
+#define NUM_PIO_STATE_MACHINES  4
+#define PIO_INSTRUCTION_COUNT   32
+
+/* Only the FIFO registers are accessed directly (as DMA targets) */
+typedef struct {
+    io_wo_32 txf[NUM_PIO_STATE_MACHINES];
+    io_ro_32 rxf[NUM_PIO_STATE_MACHINES];
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t sim_pio_hw[NUM_PIOS];
+#define pio0                (&sim_pio_hw[0])
+#define pio1                (&sim_pio_hw[1])
+
+enum pio_fifo_join {
+    PIO_FIFO_JOIN_NONE = 0,
+    PIO_FIFO_JOIN_TX = 1,
+    PIO_FIFO_JOIN_RX = 2,
+};
+
+enum pio_mov_status_type {
+    STATUS_TX_LESSTHAN = 0,
+    STATUS_RX_LESSTHAN = 1,
+};
+
+typedef enum pio_interrupt_source {
+    pis_sm0_rx_fifo_not_empty = 0,
+    pis_sm1_rx_fifo_not_empty = 1,
+    pis_sm2_rx_fifo_not_empty = 2,
+    pis_sm3_rx_fifo_not_empty = 3,
+    pis_sm0_tx_fifo_not_full = 4,
+    pis_sm1_tx_fifo_not_full = 5,
+    pis_sm2_tx_fifo_not_full = 6,
+    pis_sm3_tx_fifo_not_full = 7,
+    pis_interrupt0 = 8,
+    pis_interrupt1 = 9,
+    pis_interrupt2 = 10,
+    pis_interrupt3 = 11,
+} pio_interrupt_source_t;
+
+typedef struct {
+    uint32_t clkdiv_q8;             // Clock divider, 8 fractional bits
+    uint wrap_target;
+    uint wrap;
+    uint sideset_count;             // Including the enable bit when optional
+    bool sideset_optional;
+    bool sideset_pindirs;
+    uint sideset_base;
+    uint out_base;
+    uint out_count;
+    uint set_base;
+    uint set_count;
+    uint in_base;
+    uint jmp_pin;
+    bool out_shift_right;
+    bool autopull;
+    uint pull_threshold;
+    bool in_shift_right;
+    bool autopush;
+    uint push_threshold;
+    enum pio_fifo_join fifo_join;
+    enum pio_mov_status_type status_sel;
+    uint status_n;
+} pio_sm_config;
+
+struct pio_program {
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+    uint8_t pio_version;
+};
+
+static inline uint pio_get_index(PIO pio) { return pio == pio1 ? 1u : 0u; }
+static inline uint pio_get_dreq(PIO pio, uint sm, bool is_tx)
+{
+    return DREQ_PIO0_TX0 + pio_get_index(pio) * 8 + (is_tx ? 0 : 4) + sm;
+}
+static inline pio_interrupt_source_t pio_get_rx_fifo_not_empty_interrupt_source(uint sm)
+{
+    return (pio_interrupt_source_t)(pis_sm0_rx_fifo_not_empty + sm);
+}
+static inline pio_interrupt_source_t pio_get_tx_fifo_not_full_interrupt_source(uint sm)
+{
+    return (pio_interrupt_source_t)(pis_sm0_tx_fifo_not_full + sm);
+}
+
+pio_sm_config pio_get_default_sm_config(void);
+void sm_config_set_wrap(pio_sm_config *c, uint wrap_target, uint wrap);
+void sm_config_set_sideset(pio_sm_config *c, uint bit_count, bool optional, bool pindirs);
+void sm_config_set_sideset_pins(pio_sm_config *c, uint sideset_base);
+void sm_config_set_out_pins(pio_sm_config *c, uint out_base, uint out_count);
+void sm_config_set_set_pins(pio_sm_config *c, uint set_base, uint set_count);
+void sm_config_set_in_pins(pio_sm_config *c, uint in_base);
+void sm_config_set_jmp_pin(pio_sm_config *c, uint pin);
+void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull, uint pull_threshold);
+void sm_config_set_in_shift(pio_sm_config *c, bool shift_right, bool autopush, uint push_threshold);
+void sm_config_set_fifo_join(pio_sm_config *c, enum pio_fifo_join join);
+void sm_config_set_clkdiv(pio_sm_config *c, float div);
+void sm_config_set_clkdiv_int_frac(pio_sm_config *c, uint16_t div_int, uint8_t div_frac);
+void sm_config_set_mov_status(pio_sm_config *c, enum pio_mov_status_type status_sel, uint status_n);
+
+uint pio_add_program(PIO pio, const struct pio_program *program);
+void pio_remove_program(PIO pio, const struct pio_program *program, uint loaded_offset);
+int pio_claim_unused_sm(PIO pio, bool required);
+void pio_sm_claim(PIO pio, uint sm);
+void pio_gpio_init(PIO pio, uint pin);
+
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+void pio_sm_set_pins_with_mask(PIO pio, uint sm, uint32_t pin_values, uint32_t pin_mask);
+void pio_sm_set_pindirs_with_mask(PIO pio, uint sm, uint32_t pin_dirs, uint32_t pin_mask);
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out);
+void pio_sm_clear_fifos(PIO pio, uint sm);
+void pio_sm_restart(PIO pio, uint sm);
+
+void pio_sm_put(PIO pio, uint sm, uint32_t data);
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
+uint32_t pio_sm_get(PIO pio, uint sm);
+uint32_t pio_sm_get_blocking(PIO pio, uint sm);
+bool pio_sm_is_tx_fifo_empty(PIO pio, uint sm);
+bool pio_sm_is_tx_fifo_full(PIO pio, uint sm);
+bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm);
+bool pio_sm_is_rx_fifo_full(PIO pio, uint sm);
+uint pio_sm_get_tx_fifo_level(PIO pio, uint sm);
+uint pio_sm_get_rx_fifo_level(PIO pio, uint sm);
+uint8_t pio_sm_get_pc(PIO pio, uint sm);
+
+void pio_set_irqn_source_enabled(PIO pio, uint irq_index, pio_interrupt_source_t source, bool enabled);
+void pio_set_irq0_source_enabled(PIO pio, pio_interrupt_source_t source, bool enabled);
+void pio_set_irq1_source_enabled(PIO pio, pio_interrupt_source_t source, bool enabled);
+bool pio_interrupt_get(PIO pio, uint pio_interrupt_num);
+void pio_interrupt_clear(PIO pio, uint pio_interrupt_num);
+
+/* Test access: cycles executed and stalls of a state machine */
+uint64_t sim_pio_get_cycles(PIO pio, uint sm);
+
+#endif /* _HARDWARE_PIO_H */
@@ -0,0 +1,18 @@
+/**
+ * @file addressmap.h
+ * @brief RP2040 address map subset (host build)
+ * @note Flash image tests map a file at XIP_BASE and its aliases
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef _HARDWARE_REGS_ADDRESSMAP_H
+#define _HARDWARE_REGS_ADDRESSMAP_H
+
+#define XIP_BASE                    0x10000000u
+#define XIP_NOALLOC_BASE            0x11000000u
+#define XIP_NOCACHE_BASE            0x12000000u
+#define XIP_NOCACHE_NOALLOC_BASE    0x13000000u
+#define SRAM_BASE                   0x20000000u
+
+#endif /* _HARDWARE_REGS_ADDRESSMAP_H */
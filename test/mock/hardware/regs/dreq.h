@@ -0,0 +1,36 @@
+/**
+ * @file dreq.h
+ * @brief RP2040 DMA request numbers (host build)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef _HARDWARE_REGS_DREQ_H
+#define _HARDWARE_REGS_DREQ_H
+
+#define DREQ_PIO0_TX0       0
+#define DREQ_PIO0_RX0       4
+#define DREQ_PIO1_TX0       8
+#define DREQ_PIO1_RX0       12
+#define DREQ_SPI0_TX        16
+#define DREQ_SPI0_RX        17
+#define DREQ_SPI1_TX        18
+#define DREQ_SPI1_RX        19
+#define DREQ_UART0_TX       20
+#define DREQ_UART0_RX       21
+#define DREQ_UART1_TX       22
+#define DREQ_UART1_RX       23
+#define DREQ_PWM_WRAP0      24
+#define DREQ_I2C0_TX        32
+#define DREQ_I2C0_RX        33
+#define DREQ_I2C1_TX        34
+#define DREQ_I2C1_RX        35
+#define DREQ_ADC            36
+#define DREQ_DMA_TIMER0     59
+#define DREQ_DMA_TIMER1     60
+#define DREQ_DMA_TIMER2     61
+#define DREQ_DMA_TIMER3     62
+#define DREQ_FORCE          63
+#define NUM_DREQS           64
+
+#endif /* _HARDWARE_REGS_DREQ_H */
@@ -0,0 +1,62 @@
+/**
+ * @file spi.h
+ * @brief Pico SDK hardware_spi subset (host build)
+ * @note Shifts frames out at the configured rate through an 8-deep FIFO; received frames go to
+ *       the device model set with sim_spi_set_sink(). The RX side is not modelled.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef _HARDWARE_SPI_H
+#define _HARDWARE_SPI_H
+
+#include "pico/types.h"
+#include "hardware/regs/dreq.h"
+
+typedef struct {
+    io_rw_32 cr0;
+    io_rw_32 cr1;
+    io_rw_32 dr;
+    io_ro_32 sr;
+    io_rw_32 cpsr;
+    io_rw_32 imsc;
+    io_ro_32 ris;
+    io_ro_32 mis;
+    io_rw_32 icr;
+    io_rw_32 dmacr;
+} spi_hw_t;
+
+typedef struct spi_inst spi_inst_t;
+
+extern spi_hw_t sim_spi_hw[2];
+#define spi0_hw             (&sim_spi_hw[0])
+#define spi1_hw             (&sim_spi_hw[1])
+#define spi0                ((spi_inst_t *)spi0_hw)
+#define spi1                ((spi_inst_t *)spi1_hw)
+
+#define SPI_SSPICR_RORIC_BITS   0x00000001u
+#define SPI_SSPICR_RTIC_BITS    0x00000002u
+
+typedef enum { SPI_CPHA_0 = 0, SPI_CPHA_1 = 1 } spi_cpha_t;
+typedef enum { SPI_CPOL_0 = 0, SPI_CPOL_1 = 1 } spi_cpol_t;
+typedef enum { SPI_LSB_FIRST = 0, SPI_MSB_FIRST = 1 } spi_order_t;
+
+static inline spi_hw_t *spi_get_hw(spi_inst_t *spi) { return (spi_hw_t *)spi; }
+static inline uint spi_get_index(const spi_inst_t *spi) { return spi == spi1 ? 1u : 0u; }
+static inline uint spi_get_dreq(spi_inst_t *spi, bool is_tx)
+{
+    return DREQ_SPI0_TX + 2 * spi_get_index(spi) + (is_tx ? 0 : 1);
+}
+
+uint spi_init(spi_inst_t *spi, uint baudrate);
+void spi_deinit(spi_inst_t *spi);
+uint spi_set_baudrate(spi_inst_t *spi, uint baudrate);
+uint spi_get_baudrate(const spi_inst_t *spi);
+void spi_set_format(spi_inst_t *spi, uint data_bits, spi_cpol_t cpol, spi_cpha_t cpha, spi_order_t order);
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len);
+int spi_write16_blocking(spi_inst_t *spi, const uint16_t *src, size_t len);
+bool spi_is_writable(const spi_inst_t *spi);
+bool spi_is_readable(const spi_inst_t *spi);
+bool spi_is_busy(const spi_inst_t *spi);
+
+#endif /* _HARDWARE_SPI_H */
@@ -0,0 +1,26 @@
+/**
+ * @file uart.h
+ * @brief Pico SDK hardware_uart subset (host build)
+ * @note Written bytes are captured for the test, input comes from sim_uart_feed()
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef _HARDWARE_UART_H
+#define _HARDWARE_UART_H
+
+#include "pico/types.h"
+
+typedef struct uart_inst uart_inst_t;
+
+extern uart_inst_t *const sim_uart0;
+#define uart0               sim_uart0
+#define uart_default        uart0
+
+void uart_write_blocking(uart_inst_t *uart, const uint8_t *src, size_t len);
+
+/* Test side */
+size_t sim_uart_take(uint8_t *dst, size_t max);
+void sim_uart_feed(const uint8_t *src, size_t len);
+
+#endif /* _HARDWARE_UART_H */
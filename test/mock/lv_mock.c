@@ -0,0 +1,1734 @@
+/**
+ * @file lv_mock.c
+ * @brief Host mock of LVGL v8.3: timers, refresh, software renderer, image decoders, indev, animations
+ * @note Follows the library's control flow where the ports hook into it (stripe rendering through
+ *       draw_ctx and flush_cb, wait_cb, monitor_cb, layer_init, read timers, continue_reading) and
+ *       keeps everything else minimal. lv_mock_render_reference() draws the active screen with the
+ *       plain software renderer, the expected panel content for the tests.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include "sim.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MOCK_OBJ_DEF_SIZE       100
+#define MOCK_BTN_COLOR          0x2196F3
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void refr_join_areas(lv_disp_t *disp);
+static void refr_area(lv_disp_t *disp, const lv_area_t *area);
+static void refr_area_part(lv_disp_t *disp, const lv_area_t *area);
+static void refr_flush(lv_disp_t *disp);
+static void draw_obj(lv_draw_ctx_t *draw_ctx, lv_obj_t *obj);
+static void draw_obj_main(lv_draw_ctx_t *draw_ctx, lv_obj_t *obj);
+static void draw_rect(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords, lv_coord_t radius,
+                      lv_color_t color, lv_opa_t opa);
+static void draw_img(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords, const void *src);
+static lv_draw_layer_ctx_t *sw_layer_init(lv_draw_ctx_t *draw_ctx, lv_draw_layer_ctx_t *layer,
+                                          lv_draw_layer_flags_t flags);
+static void sw_layer_blend(lv_draw_ctx_t *draw_ctx, lv_draw_layer_ctx_t *layer,
+                           const lv_draw_img_dsc_t *draw_dsc);
+static void sw_layer_destroy(lv_draw_ctx_t *draw_ctx, lv_draw_layer_ctx_t *layer);
+static lv_res_t builtin_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header);
+static lv_res_t builtin_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+static void obj_update_coords(lv_obj_t *obj);
+static lv_obj_t *obj_alloc(lv_obj_t *parent, lv_mock_obj_type_t type);
+static lv_obj_t *indev_hit(lv_obj_t *obj, const lv_point_t *p);
+static void indev_keypad_proc(lv_indev_t *indev, const lv_indev_data_t *data);
+static void indev_pointer_proc(lv_indev_t *indev, const lv_indev_data_t *data);
+static void anim_timer_cb(lv_timer_t *timer);
+static void anim_mark_list_change(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static volatile uint32_t tick_ms = 0;
+static lv_timer_t *timer_ll = NULL;
+static bool timer_list_changed = false;
+static lv_disp_t *disp_def = NULL;
+static lv_disp_t *disp_refr = NULL;        // Display being refreshed
+static lv_img_decoder_t *decoder_ll = NULL;
+static lv_indev_t *indev_ll = NULL;
+static lv_group_t *group_def = NULL;
+static lv_anim_t *anim_ll = NULL;
+static lv_timer_t *anim_timer = NULL;
+static uint32_t mask_count = 0;             // Masks active while drawing
+static uint32_t refreshes = 0;
+static uint32_t render_stripe_ns = 0;     // Simulated CPU time of drawing a stripe: fixed part
+static uint32_t render_ns_per_px = 0;     // and per pixel
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_init(void)
+{
+    lv_img_decoder_t *dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, builtin_info);
+    lv_img_decoder_set_open_cb(dec, builtin_open);
+
+    anim_timer = lv_timer_create(anim_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    anim_mark_list_change();
+}
+
+void lv_tick_inc(uint32_t tick_period)
+{
+    tick_ms += tick_period;
+}
+
+uint32_t lv_tick_get(void)
+{
+    return tick_ms;
+}
+
+uint32_t lv_tick_elaps(uint32_t prev_tick)
+{
+    return tick_ms - prev_tick;
+}
+
+/**
+ * @brief Run the due timers
+ * @return Time until the next timer is due, LV_NO_TIMER_READY if all are paused
+ */
+uint32_t lv_timer_handler(void)
+{
+    // 1. Run every due timer, restart the walk if a callback changed the list
+    lv_timer_t *t = timer_ll;
+    while (t != NULL) {
+        lv_timer_t *next = t->next;
+        if (!t->paused && lv_tick_elaps(t->last_run) >= t->period) {
+            t->last_run = lv_tick_get();
+            timer_list_changed = false;
+            t->timer_cb(t);
+            if (t->repeat_count > 0 && --t->repeat_count == 0) {
+                lv_timer_del(t);
+            }
+            if (timer_list_changed) {
+                t = timer_ll;
+                continue;
+            }
+        }
+        t = next;
+    }
+
+    // 2. Time until the next one
+    uint32_t next_ms = LV_NO_TIMER_READY;
+    for (t = timer_ll; t != NULL; t = t->next) {
+        if (t->paused) {
+            continue;
+        }
+        uint32_t elaps = lv_tick_elaps(t->last_run);
+        uint32_t left = elaps >= t->period ? 0 : t->period - elaps;
+        next_ms = LV_MIN(next_ms, left);
+    }
+    return next_ms;
+}
+
+/* Memory */
+
+void *lv_mem_alloc(size_t size)
+{
+    return malloc(size);
+}
+
+void lv_mem_free(void *data)
+{
+    free(data);
+}
+
+void lv_memcpy(void *dst, const void *src, size_t len)
+{
+    memcpy(dst, src, len);
+}
+
+void lv_memset(void *dst, uint8_t v, size_t len)
+{
+    memset(dst, v, len);
+}
+
+void lv_memset_00(void *dst, size_t len)
+{
+    memset(dst, 0, len);
+}
+
+/* Timers */
+
+lv_timer_t *lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void *user_data)
+{
+    lv_timer_t *t = calloc(1, sizeof(lv_timer_t));
+    t->period = period;
+    t->timer_cb = timer_xcb;
+    t->user_data = user_data;
+    t->repeat_count = -1;
+    t->last_run = lv_tick_get();
+    t->next = timer_ll;
+    timer_ll = t;
+    timer_list_changed = true;
+    return t;
+}
+
+void lv_timer_del(lv_timer_t *timer)
+{
+    for (lv_timer_t **p = &timer_ll; *p != NULL; p = &(*p)->next) {
+        if (*p == timer) {
+            *p = timer->next;
+            free(timer);
+            timer_list_changed = true;
+            return;
+        }
+    }
+}
+
+void lv_timer_pause(lv_timer_t *timer)
+{
+    timer->paused = 1;
+}
+
+void lv_timer_resume(lv_timer_t *timer)
+{
+    timer->paused = 0;
+}
+
+void lv_timer_set_period(lv_timer_t *timer, uint32_t period)
+{
+    timer->period = period;
+}
+
+void lv_timer_ready(lv_timer_t *timer)
+{
+    timer->last_run = lv_tick_get() - timer->period - 1;
+}
+
+void lv_timer_reset(lv_timer_t *timer)
+{
+    timer->last_run = lv_tick_get();
+}
+
+void lv_timer_set_repeat_count(lv_timer_t *timer, int32_t repeat_count)
+{
+    timer->repeat_count = repeat_count;
+}
+
+/* Colors */
+
+/**
+ * @brief Mix two colors, mix = 255 gives c1
+ */
+lv_color_t lv_color_mix(lv_color_t c1, lv_color_t c2, uint8_t mix)
+{
+#if LV_COLOR_16_SWAP
+    uint16_t v1 = (uint16_t)((c1.full >> 8) | (c1.full << 8));
+    uint16_t v2 = (uint16_t)((c2.full >> 8) | (c2.full << 8));
+#else
+    uint16_t v1 = c1.full;
+    uint16_t v2 = c2.full;
+#endif
+    uint32_t r = ((v1 >> 11) * mix + (v2 >> 11) * (255u - mix) + 127) / 255;
+    uint32_t g = (((v1 >> 5) & 0x3F) * mix + ((v2 >> 5) & 0x3F) * (255u - mix) + 127) / 255;
+    uint32_t b = ((v1 & 0x1F) * mix + (v2 & 0x1F) * (255u - mix) + 127) / 255;
+    uint16_t v = (uint16_t)((r << 11) | (g << 5) | b);
+    lv_color_t c;
+#if LV_COLOR_16_SWAP
+    c.full = (uint16_t)((v >> 8) | (v << 8));
+#else
+    c.full = v;
+#endif
+    return c;
+}
+
+void lv_color_fill(lv_color_t *buf, lv_color_t color, uint32_t px_num)
+{
+    while (px_num-- > 0) {
+        *buf++ = color;
+    }
+}
+
+/* Areas */
+
+void lv_area_set(lv_area_t *area, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2)
+{
+    area->x1 = x1;
+    area->y1 = y1;
+    area->x2 = x2;
+    area->y2 = y2;
+}
+
+uint32_t lv_area_get_size(const lv_area_t *area)
+{
+    return (uint32_t)lv_area_get_width(area) * (uint32_t)lv_area_get_height(area);
+}
+
+bool _lv_area_intersect(lv_area_t *res, const lv_area_t *a1, const lv_area_t *a2)
+{
+    res->x1 = LV_MAX(a1->x1, a2->x1);
+    res->y1 = LV_MAX(a1->y1, a2->y1);
+    res->x2 = LV_MIN(a1->x2, a2->x2);
+    res->y2 = LV_MIN(a1->y2, a2->y2);
+    return res->x1 <= res->x2 && res->y1 <= res->y2;
+}
+
+void _lv_area_join(lv_area_t *res, const lv_area_t *a1, const lv_area_t *a2)
+{
+    res->x1 = LV_MIN(a1->x1, a2->x1);
+    res->y1 = LV_MIN(a1->y1, a2->y1);
+    res->x2 = LV_MAX(a1->x2, a2->x2);
+    res->y2 = LV_MAX(a1->y2, a2->y2);
+}
+
+bool _lv_area_is_on(const lv_area_t *a1, const lv_area_t *a2)
+{
+    return a1->x1 <= a2->x2 && a1->x2 >= a2->x1 && a1->y1 <= a2->y2 && a1->y2 >= a2->y1;
+}
+
+/**
+ * @brief Check whether ain is completely inside aholder (radius is not modelled)
+ */
+bool _lv_area_is_in(const lv_area_t *ain, const lv_area_t *aholder, lv_coord_t radius)
+{
+    LV_UNUSED(radius);
+    return ain->x1 >= aholder->x1 && ain->y1 >= aholder->y1 &&
+           ain->x2 <= aholder->x2 && ain->y2 <= aholder->y2;
+}
+
+/* Display */
+
+void lv_disp_draw_buf_init(lv_disp_draw_buf_t *draw_buf, void *buf1, void *buf2, uint32_t size_in_px_cnt)
+{
+    memset(draw_buf, 0, sizeof(*draw_buf));
+    draw_buf->buf1 = buf1;
+    draw_buf->buf2 = buf2;
+    draw_buf->buf_act = buf1;
+    draw_buf->size = size_in_px_cnt;
+}
+
+void lv_disp_drv_init(lv_disp_drv_t *driver)
+{
+    memset(driver, 0, sizeof(*driver));
+    driver->hor_res = 320;
+    driver->ver_res = 240;
+    driver->draw_ctx_init = lv_draw_sw_init_ctx;
+    driver->draw_ctx_deinit = lv_draw_sw_deinit_ctx;
+    driver->draw_ctx_size = sizeof(lv_draw_sw_ctx_t);
+}
+
+/**
+ * @brief Register a display: draw context, refresh timer and a default screen
+ */
+lv_disp_t *lv_disp_drv_register(lv_disp_drv_t *driver)
+{
+    lv_disp_t *disp = calloc(1, sizeof(lv_disp_t));
+    disp->driver = driver;
+
+    driver->draw_ctx = calloc(1, driver->draw_ctx_size);
+    driver->draw_ctx_init(driver, driver->draw_ctx);
+
+    disp->refr_timer = lv_timer_create(_lv_disp_refr_timer, LV_DEF_REFR_PERIOD, disp);
+    if (disp_def == NULL) {
+        disp_def = disp;
+    }
+
+    lv_disp_t *disp_prev = disp_def;
+    disp_def = disp;
+    disp->act_scr = lv_obj_create(NULL);
+    disp_def = disp_prev;
+
+    lv_timer_ready(disp->refr_timer);       // Refresh right away on start up
+    return disp;
+}
+
+/**
+ * @brief Tell LVGL the draw buffer has been sent (callable from interrupts)
+ */
+void lv_disp_flush_ready(lv_disp_drv_t *disp_drv)
+{
+    disp_drv->draw_buf->flushing = 0;
+    disp_drv->draw_buf->flushing_last = 0;
+}
+
+lv_disp_t *lv_disp_get_default(void)
+{
+    return disp_def;
+}
+
+lv_obj_t *lv_disp_get_scr_act(lv_disp_t *disp)
+{
+    return disp == NULL ? NULL : disp->act_scr;
+}
+
+lv_timer_t *_lv_disp_get_refr_timer(lv_disp_t *disp)
+{
+    return disp->refr_timer;
+}
+
+lv_disp_t *_lv_refr_get_disp_refreshing(void)
+{
+    return disp_refr;
+}
+
+/**
+ * @brief Display refresh timer: redraw the invalid areas stripe by stripe
+ * @note Like v8.3 the timer is never paused here, it runs every period even when there is nothing to do
+ */
+void _lv_disp_refr_timer(lv_timer_t *timer)
+{
+    lv_disp_t *disp = timer->user_data;
+    uint32_t start = lv_tick_get();
+
+    disp_refr = disp;
+    if (disp->inv_p == 0) {
+        disp_refr = NULL;
+        return;
+    }
+
+    // 1. Merge overlapping areas where that saves pixels
+    refr_join_areas(disp);
+
+    // 2. Redraw them, the last stripe of the last area is flagged for flushing_last
+    int32_t last_i = -1;
+    for (int32_t i = 0; i < disp->inv_p; i++) {
+        if (!disp->inv_area_joined[i]) {
+            last_i = i;
+        }
+    }
+
+    uint32_t px = 0;
+    lv_disp_draw_buf_t *draw_buf = disp->driver->draw_buf;
+    draw_buf->last_area = 0;
+    draw_buf->last_part = 0;
+    disp->rendering_in_progress = 1;
+    for (int32_t i = 0; i < disp->inv_p; i++) {
+        if (disp->inv_area_joined[i]) {
+            continue;
+        }
+        draw_buf->last_area = i == last_i;
+        draw_buf->last_part = 0;
+        refr_area(disp, &disp->inv_areas[i]);
+        px += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    disp->rendering_in_progress = 0;
+
+    // 3. Clean up and report
+    memset(disp->inv_area_joined, 0, sizeof(disp->inv_area_joined));
+    disp->inv_p = 0;
+    refreshes++;
+    if (disp->driver->monitor_cb != NULL) {
+        disp->driver->monitor_cb(disp->driver, lv_tick_elaps(start), px);
+    }
+    disp_refr = NULL;
+}
+
+/**
+ * @brief Mark an area for redraw and make sure the refresh timer runs
+ */
+void _lv_inv_area(lv_disp_t *disp, const lv_area_t *area_p)
+{
+    if (disp == NULL) {
+        disp = lv_disp_get_default();
+    }
+    if (disp == NULL || disp->rendering_in_progress) {
+        return;
+    }
+
+    lv_area_t scr;
+    lv_area_t area;
+    lv_area_set(&scr, 0, 0, disp->driver->hor_res - 1, disp->driver->ver_res - 1);
+    if (area_p == NULL) {
+        disp->inv_p = 0;
+        area = scr;
+    } else if (!_lv_area_intersect(&area, area_p, &scr)) {
+        return;
+    }
+    if (disp->driver->rounder_cb != NULL) {
+        disp->driver->rounder_cb(disp->driver, &area);
+    }
+
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (_lv_area_is_in(&area, &disp->inv_areas[i], 0)) {
+            return;
+        }
+    }
+
+    if (disp->inv_p < LV_INV_BUF_SIZE) {
+        disp->inv_areas[disp->inv_p++] = area;
+    } else {
+        // No place for the area: redraw the whole screen
+        disp->inv_p = 1;
+        disp->inv_areas[0] = scr;
+    }
+
+    if (disp->refr_timer != NULL) {
+        lv_timer_resume(disp->refr_timer);
+    }
+}
+
+void lv_refr_now(lv_disp_t *disp)
+{
+    _lv_disp_refr_timer((disp != NULL ? disp : disp_def)->refr_timer);
+}
+
+/* Draw */
+
+bool lv_draw_mask_is_any(const lv_area_t *a)
+{
+    LV_UNUSED(a);
+    return mask_count > 0;
+}
+
+void lv_draw_sw_init_ctx(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx)
+{
+    LV_UNUSED(drv);
+    lv_draw_sw_ctx_t *sw_ctx = (lv_draw_sw_ctx_t *)draw_ctx;
+    memset(sw_ctx, 0, sizeof(*sw_ctx));
+    draw_ctx->draw_img_decoded = lv_draw_sw_img_decoded;
+    draw_ctx->layer_init = sw_layer_init;
+    draw_ctx->layer_blend = sw_layer_blend;
+    draw_ctx->layer_destroy = sw_layer_destroy;
+    draw_ctx->layer_instance_size = sizeof(lv_draw_sw_layer_ctx_t);
+    sw_ctx->blend = lv_draw_sw_blend_basic;
+}
+
+void lv_draw_sw_deinit_ctx(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx)
+{
+    LV_UNUSED(drv);
+    memset(draw_ctx, 0, sizeof(lv_draw_sw_ctx_t));
+}
+
+/**
+ * @brief Blend entry point: drops invisible blends and calls the context's blend callback
+ */
+void lv_draw_sw_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc)
+{
+    if (dsc->opa <= LV_OPA_MIN || dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) {
+        return;
+    }
+    lv_area_t area;
+    if (!_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+        return;
+    }
+    ((lv_draw_sw_ctx_t *)draw_ctx)->blend(draw_ctx, dsc);
+}
+
+/**
+ * @brief Blend one pixel into a LV_IMG_PX_SIZE_ALPHA_BYTE pixel of a layer with alpha
+ */
+static void blend_px_argb(uint8_t *d, lv_color_t c, uint32_t opa)
+{
+    lv_color_t dc;
+    uint32_t da = d[2];
+
+    if (opa >= LV_OPA_MAX || da == 0) {
+        da = opa >= LV_OPA_MAX ? LV_OPA_COVER : opa;
+    } else {
+        uint32_t ra = LV_OPA_COVER - (LV_OPA_COVER - opa) * (LV_OPA_COVER - da) / LV_OPA_COVER;
+        memcpy(&dc, d, sizeof(dc));
+        c = lv_color_mix(c, dc, (uint8_t)(opa * LV_OPA_COVER / ra));
+        da = ra;
+    }
+    memcpy(d, &c, sizeof(c));
+    d[2] = (uint8_t)da;
+}
+
+/**
+ * @brief Software blend: fill or copy with opacity and mask into the draw buffer
+ * @note Writes color and alpha pixels while the display's screen_transp is set (layers with alpha)
+ */
+void lv_draw_sw_blend_basic(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc)
+{
+    lv_area_t area;
+    if (!_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area) ||
+        !_lv_area_intersect(&area, &area, draw_ctx->buf_area)) {
+        return;
+    }
+
+    bool argb = disp_refr != NULL && disp_refr->driver->screen_transp;
+    lv_color_t *dest = draw_ctx->buf;
+    lv_coord_t dest_w = lv_area_get_width(draw_ctx->buf_area);
+    lv_coord_t src_w = lv_area_get_width(dsc->blend_area);
+    const lv_opa_t *mask = dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER ? NULL : dsc->mask_buf;
+    lv_coord_t mask_w = mask != NULL ? lv_area_get_width(dsc->mask_area) : 0;
+
+    for (lv_coord_t y = area.y1; y <= area.y2; y++) {
+        for (lv_coord_t x = area.x1; x <= area.x2; x++) {
+            uint32_t i = (uint32_t)((y - draw_ctx->buf_area->y1) * dest_w + (x - draw_ctx->buf_area->x1));
+            lv_color_t *d = &dest[i];
+            lv_color_t c = dsc->src_buf != NULL ?
+                           dsc->src_buf[(y - dsc->blend_area->y1) * src_w + (x - dsc->blend_area->x1)] :
+                           dsc->color;
+            uint32_t opa = dsc->opa;
+            if (mask != NULL) {
+                opa = opa * mask[(y - dsc->mask_area->y1) * mask_w + (x - dsc->mask_area->x1)] / 255;
+            }
+            if (argb) {
+                if (opa > LV_OPA_MIN) {
+                    blend_px_argb((uint8_t *)draw_ctx->buf + i * LV_IMG_PX_SIZE_ALPHA_BYTE, c, opa);
+                }
+            } else if (opa >= LV_OPA_MAX) {
+                *d = c;
+            } else if (opa > LV_OPA_MIN) {
+                *d = lv_color_mix(c, *d, (uint8_t)opa);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draw decoded pixels (unscaled true color only)
+ */
+void lv_draw_sw_img_decoded(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+                            const lv_area_t *coords, const uint8_t *src_buf, lv_img_cf_t cf)
+{
+    if (cf != LV_IMG_CF_TRUE_COLOR) {
+        sim_fatal("lv_mock: image color format %u not supported", cf);
+    }
+    lv_draw_sw_blend_dsc_t blend = {
+        .blend_area = coords,
+        .src_buf = (const lv_color_t *)src_buf,
+        .opa = dsc->opa,
+        .blend_mode = dsc->blend_mode,
+        .mask_res = LV_DRAW_MASK_RES_FULL_COVER,
+    };
+    lv_draw_sw_blend(draw_ctx, &blend);
+}
+
+/* Images */
+
+lv_img_src_t lv_img_src_get_type(const void *src)
+{
+    return src == NULL ? LV_IMG_SRC_UNKNOWN : LV_IMG_SRC_VARIABLE;
+}
+
+/**
+ * @brief Add a decoder, tried before the ones created earlier
+ */
+lv_img_decoder_t *lv_img_decoder_create(void)
+{
+    lv_img_decoder_t *dec = calloc(1, sizeof(lv_img_decoder_t));
+    dec->next = decoder_ll;
+    decoder_ll = dec;
+    return dec;
+}
+
+void lv_img_decoder_set_info_cb(lv_img_decoder_t *decoder, lv_img_decoder_info_f_t info_cb)
+{
+    decoder->info_cb = info_cb;
+}
+
+void lv_img_decoder_set_open_cb(lv_img_decoder_t *decoder, lv_img_decoder_open_f_t open_cb)
+{
+    decoder->open_cb = open_cb;
+}
+
+void lv_img_decoder_set_read_line_cb(lv_img_decoder_t *decoder, lv_img_decoder_read_line_f_t read_line_cb)
+{
+    decoder->read_line_cb = read_line_cb;
+}
+
+void lv_img_decoder_set_close_cb(lv_img_decoder_t *decoder, lv_img_decoder_close_f_t close_cb)
+{
+    decoder->close_cb = close_cb;
+}
+
+lv_res_t lv_img_decoder_get_info(const void *src, lv_img_header_t *header)
+{
+    for (lv_img_decoder_t *d = decoder_ll; d != NULL; d = d->next) {
+        if (d->info_cb != NULL && d->info_cb(d, src, header) == LV_RES_OK) {
+            return LV_RES_OK;
+        }
+    }
+    return LV_RES_INV;
+}
+
+lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t *dsc, const void *src, lv_color_t color, int32_t frame_id)
+{
+    memset(dsc, 0, sizeof(*dsc));
+    dsc->src = src;
+    dsc->src_type = lv_img_src_get_type(src);
+    dsc->color = color;
+    dsc->frame_id = frame_id;
+
+    for (lv_img_decoder_t *d = decoder_ll; d != NULL; d = d->next) {
+        if (d->info_cb == NULL || d->open_cb == NULL || d->info_cb(d, src, &dsc->header) != LV_RES_OK) {
+            continue;
+        }
+        dsc->decoder = d;
+        if (d->open_cb(d, dsc) == LV_RES_OK) {
+            return LV_RES_OK;
+        }
+        dsc->decoder = NULL;
+        dsc->user_data = NULL;
+        dsc->img_data = NULL;
+    }
+    return LV_RES_INV;
+}
+
+lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t *dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                                  uint8_t *buf)
+{
+    if (dsc->decoder == NULL || dsc->decoder->read_line_cb == NULL) {
+        return LV_RES_INV;
+    }
+    return dsc->decoder->read_line_cb(dsc->decoder, dsc, x, y, len, buf);
+}
+
+void lv_img_decoder_close(lv_img_decoder_dsc_t *dsc)
+{
+    if (dsc->decoder != NULL && dsc->decoder->close_cb != NULL) {
+        dsc->decoder->close_cb(dsc->decoder, dsc);
+    }
+}
+
+/* Objects */
+
+lv_obj_t *lv_obj_create(lv_obj_t *parent)
+{
+    return obj_alloc(parent, LV_MOCK_OBJ_BASE);
+}
+
+lv_obj_t *lv_btn_create(lv_obj_t *parent)
+{
+    lv_obj_t *obj = obj_alloc(parent, LV_MOCK_OBJ_BTN);
+    obj->bg_color = lv_color_hex(MOCK_BTN_COLOR);
+    obj->flags |= LV_OBJ_FLAG_CLICKABLE;
+    if (group_def != NULL) {
+        lv_group_add_obj(group_def, obj);
+    }
+    return obj;
+}
+
+lv_obj_t *lv_img_create(lv_obj_t *parent)
+{
+    lv_obj_t *obj = obj_alloc(parent, LV_MOCK_OBJ_IMG);
+    obj->bg_opa = LV_OPA_TRANSP;
+    lv_obj_set_size(obj, 0, 0);
+    return obj;
+}
+
+void lv_obj_del(lv_obj_t *obj)
+{
+    lv_obj_invalidate(obj);
+    lv_event_send(obj, LV_EVENT_DELETE, NULL);
+    while (obj->child != NULL) {
+        lv_obj_del(obj->child);
+    }
+    if (obj->group != NULL) {
+        lv_group_t *g = obj->group;
+        for (uint32_t i = 0; i < g->obj_count; i++) {
+            if (g->objs[i] == obj) {
+                memmove(&g->objs[i], &g->objs[i + 1], (g->obj_count - i - 1) * sizeof(lv_obj_t *));
+                g->obj_count--;
+                if (g->focus >= (int32_t)g->obj_count || g->focus == (int32_t)i) {
+                    g->focus = g->obj_count > 0 ? 0 : -1;
+                }
+                break;
+            }
+        }
+    }
+    if (obj->parent != NULL) {
+        for (lv_obj_t **p = &obj->parent->child; *p != NULL; p = &(*p)->next) {
+            if (*p == obj) {
+                *p = obj->next;
+                break;
+            }
+        }
+    }
+    free(obj);
+}
+
+void lv_obj_set_pos(lv_obj_t *obj, lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_invalidate(obj);
+    obj->x = x;
+    obj->y = y;
+    obj_update_coords(obj);
+    lv_obj_invalidate(obj);
+}
+
+void lv_obj_set_x(lv_obj_t *obj, lv_coord_t x)
+{
+    lv_obj_set_pos(obj, x, obj->y);
+}
+
+void lv_obj_set_y(lv_obj_t *obj, lv_coord_t y)
+{
+    lv_obj_set_pos(obj, obj->x, y);
+}
+
+void lv_obj_set_size(lv_obj_t *obj, lv_coord_t w, lv_coord_t h)
+{
+    lv_obj_invalidate(obj);
+    obj->coords.x2 = (lv_coord_t)(obj->coords.x1 + w - 1);
+    obj->coords.y2 = (lv_coord_t)(obj->coords.y1 + h - 1);
+    lv_obj_invalidate(obj);
+}
+
+void lv_obj_set_style_bg_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector)
+{
+    LV_UNUSED(selector);
+    obj->bg_color = value;
+    lv_obj_invalidate(obj);
+}
+
+void lv_obj_set_style_bg_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector)
+{
+    LV_UNUSED(selector);
+    obj->bg_opa = value;
+    lv_obj_invalidate(obj);
+}
+
+void lv_obj_set_style_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector)
+{
+    LV_UNUSED(selector);
+    obj->opa = value;
+    lv_obj_invalidate(obj);
+}
+
+void lv_obj_set_style_radius(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector)
+{
+    LV_UNUSED(selector);
+    obj->radius = value;
+    lv_obj_invalidate(obj);
+}
+
+/**
+ * @brief Set an image source, the object takes the image size
+ */
+void lv_img_set_src(lv_obj_t *obj, const void *src)
+{
+    lv_img_header_t header;
+    obj->img_src = src;
+    if (lv_img_decoder_get_info(src, &header) == LV_RES_OK) {
+        lv_obj_set_size(obj, (lv_coord_t)header.w, (lv_coord_t)header.h);
+    }
+    lv_obj_invalidate(obj);
+}
+
+void lv_obj_add_flag(lv_obj_t *obj, lv_obj_flag_t f)
+{
+    if (f & LV_OBJ_FLAG_HIDDEN) {
+        lv_obj_invalidate(obj);
+    }
+    obj->flags |= f;
+}
+
+void lv_obj_clear_flag(lv_obj_t *obj, lv_obj_flag_t f)
+{
+    obj->flags &= ~(uint32_t)f;
+    if (f & LV_OBJ_FLAG_HIDDEN) {
+        lv_obj_invalidate(obj);
+    }
+}
+
+/**
+ * @brief Invalidate the visible part of an object
+ */
+void lv_obj_invalidate(const lv_obj_t *obj)
+{
+    lv_area_t area = obj->coords;
+    for (const lv_obj_t *p = obj; p != NULL; p = p->parent) {
+        if (p->flags & LV_OBJ_FLAG_HIDDEN) {
+            return;
+        }
+        if (p->parent != NULL && !_lv_area_intersect(&area, &area, &p->parent->coords)) {
+            return;
+        }
+    }
+    _lv_inv_area(lv_disp_get_default(), &area);
+}
+
+void lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t event_cb, lv_event_code_t filter, void *user_data)
+{
+    obj->event_cb = event_cb;
+    obj->event_filter = filter;
+    obj->event_user_data = user_data;
+}
+
+lv_res_t lv_event_send(lv_obj_t *obj, lv_event_code_t event_code, void *param)
+{
+    if (obj == NULL || obj->event_cb == NULL ||
+        (obj->event_filter != LV_EVENT_ALL && obj->event_filter != event_code)) {
+        return LV_RES_OK;
+    }
+    lv_event_t e = {
+        .target = obj,
+        .current_target = obj,
+        .code = event_code,
+        .user_data = obj->event_user_data,
+        .param = param,
+    };
+    obj->event_cb(&e);
+    return LV_RES_OK;
+}
+
+/* Groups */
+
+lv_group_t *lv_group_create(void)
+{
+    lv_group_t *g = calloc(1, sizeof(lv_group_t));
+    g->focus = -1;
+    return g;
+}
+
+void lv_group_set_default(lv_group_t *group)
+{
+    group_def = group;
+}
+
+lv_group_t *lv_group_get_default(void)
+{
+    return group_def;
+}
+
+/**
+ * @brief Add an object to a group, the first one gets the focus
+ */
+void lv_group_add_obj(lv_group_t *group, lv_obj_t *obj)
+{
+    if (group->obj_count >= sizeof(group->objs) / sizeof(group->objs[0])) {
+        sim_fatal("lv_mock: group full");
+    }
+    obj->group = group;
+    group->objs[group->obj_count++] = obj;
+    if (group->focus < 0) {
+        lv_group_focus_obj(obj);
+    }
+}
+
+void lv_group_focus_obj(lv_obj_t *obj)
+{
+    lv_group_t *g = obj->group;
+    if (g == NULL) {
+        return;
+    }
+    for (uint32_t i = 0; i < g->obj_count; i++) {
+        if (g->objs[i] != obj) {
+            continue;
+        }
+        if (g->focus >= 0 && g->objs[g->focus] != obj) {
+            lv_obj_t *old = g->objs[g->focus];
+            old->focused = false;
+            lv_obj_invalidate(old);
+            lv_event_send(old, LV_EVENT_DEFOCUSED, NULL);
+        }
+        g->focus = (int32_t)i;
+        obj->focused = true;
+        lv_obj_invalidate(obj);
+        lv_event_send(obj, LV_EVENT_FOCUSED, NULL);
+        return;
+    }
+}
+
+void lv_group_focus_next(lv_group_t *group)
+{
+    if (group->obj_count > 0) {
+        lv_group_focus_obj(group->objs[(group->focus + 1) % (int32_t)group->obj_count]);
+    }
+}
+
+void lv_group_focus_prev(lv_group_t *group)
+{
+    if (group->obj_count > 0) {
+        int32_t n = (int32_t)group->obj_count;
+        lv_group_focus_obj(group->objs[(group->focus - 1 + n) % n]);
+    }
+}
+
+lv_obj_t *lv_group_get_focused(const lv_group_t *group)
+{
+    return group == NULL || group->focus < 0 ? NULL : group->objs[group->focus];
+}
+
+/* Input devices */
+
+void lv_indev_drv_init(lv_indev_drv_t *driver)
+{
+    memset(driver, 0, sizeof(*driver));
+    driver->type = LV_INDEV_TYPE_NONE;
+    driver->long_press_time = LV_INDEV_DEF_LONG_PRESS_TIME;
+    driver->long_press_repeat_time = LV_INDEV_DEF_LONG_PRESS_REP_TIME;
+}
+
+/**
+ * @brief Register an input device, its read timer polls read_cb every LV_INDEV_DEF_READ_PERIOD
+ */
+lv_indev_t *lv_indev_drv_register(lv_indev_drv_t *driver)
+{
+    if (driver->disp == NULL) {
+        driver->disp = lv_disp_get_default();
+    }
+    lv_indev_t *indev = calloc(1, sizeof(lv_indev_t));
+    indev->driver = driver;
+    driver->read_timer = lv_timer_create(lv_indev_read_timer_cb, LV_INDEV_DEF_READ_PERIOD, indev);
+
+    lv_indev_t **p = &indev_ll;
+    while (*p != NULL) {
+        p = &(*p)->next;
+    }
+    *p = indev;
+    return indev;
+}
+
+/**
+ * @brief Read an input device until its driver stops asking for more, and process the data
+ */
+void lv_indev_read_timer_cb(lv_timer_t *timer)
+{
+    lv_indev_t *indev = timer->user_data;
+    lv_indev_data_t data;
+
+    do {
+        memset(&data, 0, sizeof(data));
+        if (indev->driver->type == LV_INDEV_TYPE_POINTER) {
+            data.point = indev->proc.types.pointer.last_point;
+        } else if (indev->driver->type == LV_INDEV_TYPE_KEYPAD) {
+            data.key = indev->proc.types.keypad.last_key;
+        }
+        indev->driver->read_cb(indev->driver, &data);
+
+        if (indev->driver->type == LV_INDEV_TYPE_POINTER) {
+            indev_pointer_proc(indev, &data);
+        } else if (indev->driver->type == LV_INDEV_TYPE_KEYPAD) {
+            indev_keypad_proc(indev, &data);
+        }
+        indev->proc.state = data.state;
+    } while (data.continue_reading);
+}
+
+void lv_indev_set_group(lv_indev_t *indev, lv_group_t *group)
+{
+    indev->group = group;
+}
+
+void lv_indev_get_point(const lv_indev_t *indev, lv_point_t *point)
+{
+    *point = indev->proc.types.pointer.act_point;
+}
+
+lv_indev_t *lv_indev_get_next(lv_indev_t *indev)
+{
+    return indev == NULL ? indev_ll : indev->next;
+}
+
+/* Animations */
+
+void lv_anim_init(lv_anim_t *a)
+{
+    memset(a, 0, sizeof(*a));
+    a->time = 500;
+    a->repeat_cnt = 1;
+}
+
+/**
+ * @brief Start an animation (replaces one on the same variable and exec_cb)
+ */
+lv_anim_t *lv_anim_start(const lv_anim_t *a)
+{
+    lv_anim_del(a->var, a->exec_cb);
+
+    lv_anim_t *n = malloc(sizeof(lv_anim_t));
+    *n = *a;
+    n->act_time = 0;
+    n->current_value = a->start_value;
+    n->next = anim_ll;
+    anim_ll = n;
+    if (n->exec_cb != NULL) {
+        n->exec_cb(n->var, n->start_value);
+    }
+    anim_timer->last_run = lv_tick_get();
+    anim_mark_list_change();
+    return n;
+}
+
+bool lv_anim_del(void *var, lv_anim_exec_xcb_t exec_cb)
+{
+    bool del = false;
+    for (lv_anim_t **p = &anim_ll; *p != NULL;) {
+        lv_anim_t *a = *p;
+        if ((var == NULL || a->var == var) && (exec_cb == NULL || a->exec_cb == exec_cb)) {
+            *p = a->next;
+            free(a);
+            del = true;
+        } else {
+            p = &a->next;
+        }
+    }
+    anim_mark_list_change();
+    return del;
+}
+
+uint16_t lv_anim_count_running(void)
+{
+    uint16_t n = 0;
+    for (lv_anim_t *a = anim_ll; a != NULL; a = a->next) {
+        n++;
+    }
+    return n;
+}
+
+/* Test access */
+
+/**
+ * @brief Draw the active screen of the default display with the plain software renderer
+ * @param fb hor_res x ver_res pixels
+ */
+void lv_mock_render_reference(lv_color_t *fb)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    lv_draw_sw_ctx_t ctx;
+    lv_area_t area;
+
+    lv_draw_sw_init_ctx(NULL, &ctx.base_draw);
+    lv_area_set(&area, 0, 0, disp->driver->hor_res - 1, disp->driver->ver_res - 1);
+    ctx.base_draw.buf = fb;
+    ctx.base_draw.buf_area = &area;
+    ctx.base_draw.clip_area = &area;
+    disp_refr = disp;           // Layers with alpha switch the display to the ARGB blender
+    draw_obj(&ctx.base_draw, disp->act_scr);
+    disp_refr = NULL;
+}
+
+uint32_t lv_mock_get_refreshes(void)
+{
+    return refreshes;
+}
+
+/**
+ * @brief Charge simulated CPU time for every stripe drawn by the refresh
+ * @param stripe_ns Fixed time per stripe (object tree walk, clipping)
+ * @param ns_per_px Time per stripe pixel, both 0 = drawing is free
+ */
+void lv_mock_set_render_cost(uint32_t stripe_ns, uint32_t ns_per_px)
+{
+    render_stripe_ns = stripe_ns;
+    render_ns_per_px = ns_per_px;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Join invalid areas whose bounding box is smaller than the two of them
+ */
+static void refr_join_areas(lv_disp_t *disp)
+{
+    for (uint32_t join_in = 0; join_in < disp->inv_p; join_in++) {
+        if (disp->inv_area_joined[join_in]) {
+            continue;
+        }
+        for (uint32_t join_from = 0; join_from < disp->inv_p; join_from++) {
+            if (disp->inv_area_joined[join_from] || join_in == join_from ||
+                !_lv_area_is_on(&disp->inv_areas[join_in], &disp->inv_areas[join_from])) {
+                continue;
+            }
+            lv_area_t joined;
+            _lv_area_join(&joined, &disp->inv_areas[join_in], &disp->inv_areas[join_from]);
+            if (lv_area_get_size(&joined) < lv_area_get_size(&disp->inv_areas[join_in]) +
+                                             lv_area_get_size(&disp->inv_areas[join_from])) {
+                disp->inv_areas[join_in] = joined;
+                disp->inv_area_joined[join_from] = 1;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Redraw an area in stripes of at most draw_buf->size pixels
+ */
+static void refr_area(lv_disp_t *disp, const lv_area_t *area)
+{
+    lv_disp_draw_buf_t *draw_buf = disp->driver->draw_buf;
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t h = lv_area_get_height(area);
+    lv_coord_t y2 = area->y2 >= disp->driver->ver_res ? disp->driver->ver_res - 1 : area->y2;
+
+    // The stripe height follows draw_buf->size, which the port may change between stripes
+    for (lv_coord_t y = area->y1; y <= y2;) {
+        lv_coord_t max_row = (lv_coord_t)LV_MIN((uint32_t)h, draw_buf->size / (uint32_t)w);
+        lv_area_t sub;
+        lv_area_set(&sub, area->x1, y, area->x2, (lv_coord_t)LV_MIN(y + max_row - 1, y2));
+        if (sub.y2 == y2) {
+            draw_buf->last_part = 1;
+        }
+        refr_area_part(disp, &sub);
+        y = (lv_coord_t)(sub.y2 + 1);
+    }
+}
+
+/**
+ * @brief Draw one stripe into the active draw buffer and flush it
+ */
+static void refr_area_part(lv_disp_t *disp, const lv_area_t *area)
+{
+    lv_disp_draw_buf_t *draw_buf = disp->driver->draw_buf;
+    lv_draw_ctx_t *draw_ctx = disp->driver->draw_ctx;
+    static lv_area_t buf_area;
+
+    // 1. Single buffer: wait until the previous stripe has left it
+    if (draw_buf->buf1 != NULL && draw_buf->buf2 == NULL) {
+        while (draw_buf->flushing) {
+            if (disp->driver->wait_cb != NULL) {
+                disp->driver->wait_cb(disp->driver);
+            } else {
+                sim_wait();
+            }
+        }
+    }
+
+    // 2. Draw the object tree into it
+    buf_area = *area;
+    draw_ctx->buf = draw_buf->buf_act;
+    draw_ctx->buf_area = &buf_area;
+    draw_ctx->clip_area = area;
+    draw_obj(draw_ctx, disp->act_scr);
+    if (render_stripe_ns != 0 || render_ns_per_px != 0) {
+        sim_cpu_ns(render_stripe_ns + (uint64_t)render_ns_per_px * lv_area_get_size(area));
+    }
+
+    refr_flush(disp);
+}
+
+/**
+ * @brief Hand the rendered stripe to flush_cb
+ */
+static void refr_flush(lv_disp_t *disp)
+{
+    lv_disp_draw_buf_t *draw_buf = disp->driver->draw_buf;
+    lv_draw_ctx_t *draw_ctx = disp->driver->draw_ctx;
+
+    if (draw_ctx->wait_for_finish != NULL) {
+        draw_ctx->wait_for_finish(draw_ctx);
+    }
+
+    // 1. Double buffer: the other buffer must be sent before it's handed out again
+    if (draw_buf->buf1 != NULL && draw_buf->buf2 != NULL) {
+        while (draw_buf->flushing) {
+            if (disp->driver->wait_cb != NULL) {
+                disp->driver->wait_cb(disp->driver);
+            } else {
+                sim_wait();
+            }
+        }
+    }
+
+    // 2. Flush
+    draw_buf->flushing = 1;
+    draw_buf->flushing_last = draw_buf->last_area && draw_buf->last_part;
+    disp->driver->flush_cb(disp->driver, draw_ctx->buf_area, draw_ctx->buf);
+
+    // 3. Render the next stripe into the other buffer
+    if (draw_buf->buf1 != NULL && draw_buf->buf2 != NULL) {
+        draw_buf->buf_act = draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+    }
+}
+
+/**
+ * @brief Draw an object and its children clipped to the context's clip area
+ * @note Objects with opa below LV_OPA_MAX are drawn into a layer and blended as a whole
+ */
+static void draw_obj(lv_draw_ctx_t *draw_ctx, lv_obj_t *obj)
+{
+    lv_area_t clip;
+    if ((obj->flags & LV_OBJ_FLAG_HIDDEN) || obj->opa <= LV_OPA_MIN ||
+        !_lv_area_intersect(&clip, draw_ctx->clip_area, &obj->coords)) {
+        return;
+    }
+
+    const lv_area_t *clip_ori = draw_ctx->clip_area;
+    lv_draw_layer_ctx_t *layer = NULL;
+
+    // 1. Translucent object: redirect drawing into a layer covering the visible part,
+    //    with alpha when the ARGB blender is there and the background does not cover it
+    if (obj->opa < LV_OPA_MAX) {
+        lv_draw_layer_flags_t flags = LV_DRAW_LAYER_FLAG_NONE;
+#if LV_COLOR_SCREEN_TRANSP
+        if (obj->bg_opa < LV_OPA_COVER || obj->radius > 0) {
+            flags = LV_DRAW_LAYER_FLAG_HAS_ALPHA;
+        }
+#endif
+        layer = calloc(1, draw_ctx->layer_instance_size);
+        layer->area_full = clip;
+        layer->area_act = clip;
+        layer = draw_ctx->layer_init(draw_ctx, layer, flags);
+    }
+
+    // 2. Background, then children clipped to the object
+    draw_ctx->clip_area = &clip;
+    draw_obj_main(draw_ctx, obj);
+    for (lv_obj_t *child = obj->child; child != NULL; child = child->next) {
+        draw_obj(draw_ctx, child);
+    }
+    draw_ctx->clip_area = clip_ori;
+
+    // 3. Blend the layer back with the object's opacity
+    if (layer != NULL) {
+        lv_draw_img_dsc_t dsc = {
+            .zoom = LV_IMG_ZOOM_NONE,
+            .opa = obj->opa,
+            .blend_mode = LV_BLEND_MODE_NORMAL,
+        };
+        draw_ctx->layer_blend(draw_ctx, layer, &dsc);
+        draw_ctx->layer_destroy(draw_ctx, layer);
+        free(layer);
+    }
+}
+
+static void draw_obj_main(lv_draw_ctx_t *draw_ctx, lv_obj_t *obj)
+{
+    if (obj->bg_opa > LV_OPA_MIN) {
+        draw_rect(draw_ctx, &obj->coords, obj->radius, obj->bg_color, obj->bg_opa);
+    }
+    if (obj->type == LV_MOCK_OBJ_IMG && obj->img_src != NULL) {
+        draw_img(draw_ctx, &obj->coords, obj->img_src);
+    }
+}
+
+/**
+ * @brief Filled rectangle, rounded corners are blended row by row through a coverage mask
+ * @note Like the library, a radius mask is active (lv_draw_mask_is_any()) for the whole rectangle
+ *       and the straight middle part goes out as one unmasked blend
+ */
+static void draw_rect(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords, lv_coord_t radius,
+                      lv_color_t color, lv_opa_t opa)
+{
+    lv_draw_sw_blend_dsc_t blend = {
+        .color = color,
+        .opa = opa,
+        .blend_mode = LV_BLEND_MODE_NORMAL,
+        .mask_res = LV_DRAW_MASK_RES_FULL_COVER,
+    };
+
+    lv_coord_t r = LV_MIN(radius, LV_MIN(lv_area_get_width(coords), lv_area_get_height(coords)) / 2);
+    if (r <= 0) {
+        blend.blend_area = coords;
+        lv_draw_sw_blend(draw_ctx, &blend);
+        return;
+    }
+
+    mask_count++;
+
+    // 1. Middle part
+    lv_area_t mid = *coords;
+    mid.y1 = (lv_coord_t)(coords->y1 + r);
+    mid.y2 = (lv_coord_t)(coords->y2 - r);
+    if (mid.y1 <= mid.y2) {
+        blend.blend_area = &mid;
+        lv_draw_sw_blend(draw_ctx, &blend);
+    }
+
+    // 2. Corner rows: coverage from the distance to the corner circle centre
+    lv_coord_t w = lv_area_get_width(coords);
+    lv_opa_t *mask = malloc((size_t)w);
+    for (lv_coord_t i = 0; i < r; i++) {
+        float dy = (float)r - (float)i - 0.5f;
+        float half = sqrtf((float)r * (float)r - dy * dy);
+        lv_coord_t inset = (lv_coord_t)((float)r - half + 0.5f);
+        for (lv_coord_t x = 0; x < w; x++) {
+            mask[x] = (x < inset || x >= w - inset) ? LV_OPA_TRANSP : LV_OPA_COVER;
+        }
+
+        lv_coord_t rows[2] = {(lv_coord_t)(coords->y1 + i), (lv_coord_t)(coords->y2 - i)};
+        for (int k = 0; k < 2; k++) {
+            lv_area_t row;
+            lv_area_set(&row, coords->x1, rows[k], coords->x2, rows[k]);
+            blend.blend_area = &row;
+            blend.mask_area = &row;
+            blend.mask_buf = mask;
+            blend.mask_res = LV_DRAW_MASK_RES_CHANGED;
+            lv_draw_sw_blend(draw_ctx, &blend);
+        }
+    }
+    free(mask);
+
+    mask_count--;
+}
+
+/**
+ * @brief Draw an image: whole-image blit when the decoder gives the pixels, else line by line
+ */
+static void draw_img(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords, const void *src)
+{
+    lv_draw_img_dsc_t dsc = {
+        .zoom = LV_IMG_ZOOM_NONE,
+        .opa = LV_OPA_COVER,
+        .blend_mode = LV_BLEND_MODE_NORMAL,
+    };
+    lv_img_decoder_dsc_t dec;
+    if (lv_img_decoder_open(&dec, src, lv_color_black(), 0) != LV_RES_OK) {
+        return;
+    }
+
+    if (dec.img_data != NULL) {
+        draw_ctx->draw_img_decoded(draw_ctx, &dsc, coords, dec.img_data, dec.header.cf);
+        lv_img_decoder_close(&dec);
+        return;
+    }
+
+    lv_area_t com;
+    if (!_lv_area_intersect(&com, draw_ctx->clip_area, coords)) {
+        lv_img_decoder_close(&dec);
+        return;
+    }
+    lv_coord_t width = lv_area_get_width(&com);
+    uint8_t *buf = malloc((size_t)width * sizeof(lv_color_t));
+    const lv_area_t *clip_ori = draw_ctx->clip_area;
+    lv_area_t line = com;
+    line.y2 = line.y1;
+    lv_coord_t x = (lv_coord_t)(com.x1 - coords->x1);
+    lv_coord_t y = (lv_coord_t)(com.y1 - coords->y1);
+
+    for (lv_coord_t row = com.y1; row <= com.y2; row++, y++) {
+        lv_area_t mask_line;
+        if (_lv_area_intersect(&mask_line, clip_ori, &line) &&
+            lv_img_decoder_read_line(&dec, x, y, width, buf) == LV_RES_OK) {
+            draw_ctx->clip_area = &mask_line;
+            draw_ctx->draw_img_decoded(draw_ctx, &dsc, &line, buf, dec.header.cf);
+        }
+        line.y1++;
+        line.y2++;
+    }
+    draw_ctx->clip_area = clip_ori;
+    free(buf);
+    lv_img_decoder_close(&dec);
+}
+
+/**
+ * @brief Layer without alpha: a copy of the content underneath that the children are drawn over.
+ *        Layer with alpha: transparent LV_IMG_PX_SIZE_ALPHA_BYTE pixels, drawn with the ARGB blender
+ */
+static lv_draw_layer_ctx_t *sw_layer_init(lv_draw_ctx_t *draw_ctx, lv_draw_layer_ctx_t *layer,
+                                          lv_draw_layer_flags_t flags)
+{
+    lv_draw_sw_layer_ctx_t *sw_layer = (lv_draw_sw_layer_ctx_t *)layer;
+    lv_coord_t w = lv_area_get_width(&layer->area_act);
+    lv_coord_t h = lv_area_get_height(&layer->area_act);
+
+    layer->original.buf = draw_ctx->buf;
+    layer->original.buf_area = draw_ctx->buf_area;
+    layer->original.clip_area = draw_ctx->clip_area;
+    layer->original.screen_transp = disp_refr->driver->screen_transp;
+
+    if (flags & LV_DRAW_LAYER_FLAG_HAS_ALPHA) {
+        sw_layer->buf_size_bytes = (uint32_t)w * (uint32_t)h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        sw_layer->has_alpha = 1;
+        layer->buf = calloc(1, sw_layer->buf_size_bytes);
+        layer->max_row_with_alpha = h;
+        disp_refr->driver->screen_transp = 1;
+        draw_ctx->buf = layer->buf;
+        draw_ctx->buf_area = &layer->area_act;
+        draw_ctx->clip_area = &layer->area_act;
+        return layer;
+    }
+
+    lv_color_t *buf = malloc((size_t)w * (size_t)h * sizeof(lv_color_t));
+    const lv_color_t *under = draw_ctx->buf;
+    lv_coord_t under_w = lv_area_get_width(draw_ctx->buf_area);
+
+    for (lv_coord_t y = 0; y < h; y++) {
+        memcpy(&buf[y * w],
+               &under[(layer->area_act.y1 + y - draw_ctx->buf_area->y1) * under_w +
+                      (layer->area_act.x1 - draw_ctx->buf_area->x1)],
+               (size_t)w * sizeof(lv_color_t));
+    }
+
+    sw_layer->buf_size_bytes = (uint32_t)w * (uint32_t)h * sizeof(lv_color_t);
+    layer->buf = buf;
+    layer->max_row_with_no_alpha = h;
+
+    draw_ctx->buf = buf;
+    draw_ctx->buf_area = &layer->area_act;
+    draw_ctx->clip_area = &layer->area_act;
+    return layer;
+}
+
+static void sw_layer_blend(lv_draw_ctx_t *draw_ctx, lv_draw_layer_ctx_t *layer,
+                           const lv_draw_img_dsc_t *draw_dsc)
+{
+    draw_ctx->buf = layer->original.buf;
+    draw_ctx->buf_area = layer->original.buf_area;
+    draw_ctx->clip_area = layer->original.clip_area;
+    disp_refr->driver->screen_transp = layer->original.screen_transp;
+
+    lv_draw_sw_blend_dsc_t blend = {
+        .blend_area = &layer->area_act,
+        .src_buf = layer->buf,
+        .opa = draw_dsc->opa,
+        .blend_mode = draw_dsc->blend_mode,
+        .mask_res = LV_DRAW_MASK_RES_FULL_COVER,
+    };
+    if (!((lv_draw_sw_layer_ctx_t *)layer)->has_alpha) {
+        lv_draw_sw_blend(draw_ctx, &blend);
+        return;
+    }
+
+    // Split the color and alpha bytes into a source buffer and a mask
+    uint32_t px = lv_area_get_size(&layer->area_act);
+    const uint8_t *argb = layer->buf;
+    lv_color_t *src = malloc(px * sizeof(lv_color_t));
+    lv_opa_t *mask = malloc(px);
+    for (uint32_t i = 0; i < px; i++) {
+        memcpy(&src[i], &argb[i * LV_IMG_PX_SIZE_ALPHA_BYTE], sizeof(lv_color_t));
+        mask[i] = argb[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 2];
+    }
+    blend.src_buf = src;
+    blend.mask_buf = mask;
+    blend.mask_area = &layer->area_act;
+    blend.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    lv_draw_sw_blend(draw_ctx, &blend);
+    free(src);
+    free(mask);
+}
+
+static void sw_layer_destroy(lv_draw_ctx_t *draw_ctx, lv_draw_layer_ctx_t *layer)
+{
+    LV_UNUSED(draw_ctx);
+    free(layer->buf);
+    layer->buf = NULL;
+}
+
+/**
+ * @brief Built-in decoder: true color variable images, pixels used in place
+ */
+static lv_res_t builtin_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    LV_UNUSED(decoder);
+    const lv_img_dsc_t *img = src;
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE || img->header.cf != LV_IMG_CF_TRUE_COLOR) {
+        return LV_RES_INV;
+    }
+    *header = img->header;
+    return LV_RES_OK;
+}
+
+static lv_res_t builtin_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+    dsc->img_data = ((const lv_img_dsc_t *)dsc->src)->data;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief Recompute the absolute coordinates of an object and its children
+ */
+static void obj_update_coords(lv_obj_t *obj)
+{
+    lv_coord_t w = lv_area_get_width(&obj->coords);
+    lv_coord_t h = lv_area_get_height(&obj->coords);
+    lv_coord_t px = obj->parent != NULL ? obj->parent->coords.x1 : 0;
+    lv_coord_t py = obj->parent != NULL ? obj->parent->coords.y1 : 0;
+    lv_area_set(&obj->coords, (lv_coord_t)(px + obj->x), (lv_coord_t)(py + obj->y),
+                (lv_coord_t)(px + obj->x + w - 1), (lv_coord_t)(py + obj->y + h - 1));
+    for (lv_obj_t *child = obj->child; child != NULL; child = child->next) {
+        obj_update_coords(child);
+    }
+}
+
+/**
+ * @brief Create an object, NULL parent creates a screen (the active one if there is none)
+ */
+static lv_obj_t *obj_alloc(lv_obj_t *parent, lv_mock_obj_type_t type)
+{
+    lv_obj_t *obj = calloc(1, sizeof(lv_obj_t));
+    obj->type = type;
+    obj->parent = parent;
+    obj->bg_color = lv_color_white();
+    obj->bg_opa = LV_OPA_COVER;
+    obj->opa = LV_OPA_COVER;
+
+    if (parent == NULL) {
+        lv_disp_t *disp = lv_disp_get_default();
+        lv_area_set(&obj->coords, 0, 0, disp->driver->hor_res - 1, disp->driver->ver_res - 1);
+        if (disp->act_scr == NULL) {
+            disp->act_scr = obj;
+        }
+        _lv_inv_area(disp, NULL);
+        return obj;
+    }
+
+    // Appended: drawn after (above) the existing children
+    lv_obj_t **p = &parent->child;
+    while (*p != NULL) {
+        p = &(*p)->next;
+    }
+    *p = obj;
+
+    lv_area_set(&obj->coords, parent->coords.x1, parent->coords.y1,
+                (lv_coord_t)(parent->coords.x1 + MOCK_OBJ_DEF_SIZE - 1),
+                (lv_coord_t)(parent->coords.y1 + MOCK_OBJ_DEF_SIZE - 1));
+    lv_obj_invalidate(obj);
+    return obj;
+}
+
+/**
+ * @brief Topmost visible clickable object under a point
+ */
+static lv_obj_t *indev_hit(lv_obj_t *obj, const lv_point_t *p)
+{
+    if ((obj->flags & LV_OBJ_FLAG_HIDDEN) ||
+        p->x < obj->coords.x1 || p->x > obj->coords.x2 || p->y < obj->coords.y1 || p->y > obj->coords.y2) {
+        return NULL;
+    }
+    lv_obj_t *hit = (obj->flags & LV_OBJ_FLAG_CLICKABLE) ? obj : NULL;
+    for (lv_obj_t *child = obj->child; child != NULL; child = child->next) {
+        lv_obj_t *h = indev_hit(child, p);
+        if (h != NULL) {
+            hit = h;
+        }
+    }
+    return hit;
+}
+
+/**
+ * @brief Keypad: NEXT/PREV move the group focus (repeated on long press), ENTER clicks the focused object
+ */
+static void indev_keypad_proc(lv_indev_t *indev, const lv_indev_data_t *data)
+{
+    _lv_indev_proc_t *proc = &indev->proc;
+    lv_group_t *g = indev->group;
+    lv_indev_state_t prev_state = proc->types.keypad.last_state;
+    uint32_t key = data->key;
+
+    proc->types.keypad.last_state = data->state;
+    proc->types.keypad.last_key = key;
+    if (g == NULL) {
+        return;
+    }
+    lv_obj_t *focused = lv_group_get_focused(g);
+
+    if (data->state == LV_INDEV_STATE_PR && prev_state == LV_INDEV_STATE_REL) {
+        // 1. Key pressed
+        proc->pr_timestamp = lv_tick_get();
+        if (key == LV_KEY_NEXT) {
+            lv_group_focus_next(g);
+        } else if (key == LV_KEY_PREV) {
+            lv_group_focus_prev(g);
+        } else if (key == LV_KEY_ENTER) {
+            lv_event_send(focused, LV_EVENT_PRESSED, NULL);
+        } else {
+            lv_event_send(focused, LV_EVENT_KEY, &key);
+        }
+    } else if (data->state == LV_INDEV_STATE_PR && prev_state == LV_INDEV_STATE_PR) {
+        // 2. Held: long press, then repeat
+        if (!proc->long_pr_sent && lv_tick_elaps(proc->pr_timestamp) > indev->driver->long_press_time) {
+            proc->long_pr_sent = 1;
+            proc->longpr_rep_timestamp = lv_tick_get();
+        } else if (proc->long_pr_sent &&
+                   lv_tick_elaps(proc->longpr_rep_timestamp) > indev->driver->long_press_repeat_time) {
+            proc->longpr_rep_timestamp = lv_tick_get();
+            if (key == LV_KEY_NEXT) {
+                lv_group_focus_next(g);
+            } else if (key == LV_KEY_PREV) {
+                lv_group_focus_prev(g);
+            } else if (key != LV_KEY_ENTER) {
+                lv_event_send(focused, LV_EVENT_KEY, &key);
+            }
+        }
+    } else if (data->state == LV_INDEV_STATE_REL && prev_state == LV_INDEV_STATE_PR) {
+        // 3. Released
+        if (key == LV_KEY_ENTER) {
+            lv_event_send(focused, LV_EVENT_RELEASED, NULL);
+            lv_event_send(focused, LV_EVENT_CLICKED, NULL);
+        }
+        proc->long_pr_sent = 0;
+    }
+}
+
+/**
+ * @brief Pointer: press/release on the clickable object under the point
+ */
+static void indev_pointer_proc(lv_indev_t *indev, const lv_indev_data_t *data)
+{
+    _lv_indev_proc_t *proc = &indev->proc;
+    lv_disp_t *disp = indev->driver->disp;
+    static lv_obj_t *pressed_obj = NULL;
+
+    proc->types.pointer.last_point = data->point;
+    proc->types.pointer.act_point = data->point;
+
+    if (data->state == LV_INDEV_STATE_PR && proc->state == LV_INDEV_STATE_REL) {
+        proc->pr_timestamp = lv_tick_get();
+        pressed_obj = disp != NULL ? indev_hit(disp->act_scr, &data->point) : NULL;
+        lv_event_send(pressed_obj, LV_EVENT_PRESSED, NULL);
+    } else if (data->state == LV_INDEV_STATE_REL && proc->state == LV_INDEV_STATE_PR) {
+        lv_event_send(pressed_obj, LV_EVENT_RELEASED, NULL);
+        if (pressed_obj != NULL && disp != NULL && indev_hit(disp->act_scr, &data->point) == pressed_obj) {
+            lv_event_send(pressed_obj, LV_EVENT_CLICKED, NULL);
+        }
+        pressed_obj = NULL;
+    }
+    proc->state = data->state;
+}
+
+/**
+ * @brief Advance the running animations (linear path)
+ */
+static void anim_timer_cb(lv_timer_t *timer)
+{
+    LV_UNUSED(timer);
+    static uint32_t last_tick = 0;
+    uint32_t elaps = lv_tick_elaps(last_tick);
+    last_tick = lv_tick_get();
+    if (elaps > (uint32_t)LV_DEF_REFR_PERIOD * 4) {
+        elaps = LV_DEF_REFR_PERIOD;         // First run after a pause
+    }
+
+    for (lv_anim_t **p = &anim_ll; *p != NULL;) {
+        lv_anim_t *a = *p;
+        a->act_time += (int32_t)elaps;
+        int32_t t = LV_MIN(a->act_time, a->time);
+        int32_t from = a->backwards ? a->end_value : a->start_value;
+        int32_t to = a->backwards ? a->start_value : a->end_value;
+        a->current_value = a->time > 0 ? from + (int32_t)((int64_t)(to - from) * t / a->time) : to;
+        if (a->exec_cb != NULL) {
+            a->exec_cb(a->var, a->current_value);
+        }
+
+        if (a->act_time < a->time) {
+            p = &a->next;
+            continue;
+        }
+
+        // End of a run: play back, repeat or finish
+        a->act_time -= a->time;
+        if (a->playback && !a->backwards) {
+            a->backwards = true;
+            p = &a->next;
+            continue;
+        }
+        a->backwards = false;
+        if (a->repeat_cnt == LV_ANIM_REPEAT_INFINITE || --a->repeat_cnt > 0) {
+            p = &a->next;
+            continue;
+        }
+        *p = a->next;
+        free(a);
+    }
+    anim_mark_list_change();
+}
+
+/**
+ * @brief The animation timer only runs while there are animations
+ */
+static void anim_mark_list_change(void)
+{
+    if (anim_timer == NULL) {
+        return;
+    }
+    if (anim_ll == NULL) {
+        lv_timer_pause(anim_timer);
+    } else {
+        lv_timer_resume(anim_timer);
+    }
+}
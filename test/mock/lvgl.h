@@ -0,0 +1,612 @@
+/**
+ * @file lvgl.h
+ * @brief Host mock of the LVGL v8.3 API used by the porting layers (model in lv_mock.c)
+ * @note Enough of LVGL to drive the ports the way the library does: timers, a display with
+ *       invalidation, stripe rendering through the draw context and flush_cb, image decoders,
+ *       indev read timers with keypad group navigation, and linear animations. Widgets are
+ *       plain rectangles and images; the software renderer only fills, blits and blends.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef LVGL_H
+#define LVGL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_conf.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_UNUSED(x)                ((void)(x))
+#define LV_MIN(a, b)                ((a) < (b) ? (a) : (b))
+#define LV_MAX(a, b)                ((a) > (b) ? (a) : (b))
+
+#define LV_NO_TIMER_READY           0xFFFFFFFFu
+#define LV_INV_BUF_SIZE             32
+#define LV_COORD_MAX                ((lv_coord_t)0x1FFF)
+
+#ifndef LV_INDEV_DEF_READ_PERIOD
+#define LV_INDEV_DEF_READ_PERIOD    LV_DEF_REFR_PERIOD
+#endif
+#define LV_INDEV_DEF_LONG_PRESS_TIME        400
+#define LV_INDEV_DEF_LONG_PRESS_REP_TIME    100
+
+#define LV_OPA_TRANSP               0
+#define LV_OPA_0                    0
+#define LV_OPA_50                   127
+#define LV_OPA_COVER                255
+#define LV_OPA_MIN                  2
+#define LV_OPA_MAX                  253
+
+#define LV_IMG_ZOOM_NONE            256
+#define LV_RADIUS_CIRCLE            0x7FFF
+#define LV_ANIM_REPEAT_INFINITE     0xFFFF
+
+#define LV_COLOR_SIZE               16
+#define LV_IMG_PX_SIZE_ALPHA_BYTE   3       // RGB565 + alpha byte, the pixels of a layer with alpha
+
+/* Layers with alpha need an ARGB blender, without it LVGL skips the widgets that use them */
+#ifndef LV_COLOR_SCREEN_TRANSP
+#define LV_COLOR_SCREEN_TRANSP      0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef int16_t lv_coord_t;
+typedef uint8_t lv_opa_t;
+typedef uint32_t lv_style_selector_t;
+
+typedef enum {
+    LV_RES_INV = 0,
+    LV_RES_OK,
+} lv_res_t;
+
+typedef union {
+    struct {
+#if LV_COLOR_16_SWAP == 0
+        uint16_t blue : 5;
+        uint16_t green : 6;
+        uint16_t red : 5;
+#else
+        uint16_t green_h : 3;
+        uint16_t red : 5;
+        uint16_t blue : 5;
+        uint16_t green_l : 3;
+#endif
+    } ch;
+    uint16_t full;
+} lv_color16_t;
+typedef lv_color16_t lv_color_t;
+
+typedef struct {
+    lv_coord_t x;
+    lv_coord_t y;
+} lv_point_t;
+
+typedef struct {
+    lv_coord_t x1;
+    lv_coord_t y1;
+    lv_coord_t x2;
+    lv_coord_t y2;
+} lv_area_t;
+
+typedef enum {
+    LV_BLEND_MODE_NORMAL,
+    LV_BLEND_MODE_ADDITIVE,
+    LV_BLEND_MODE_SUBTRACTIVE,
+    LV_BLEND_MODE_MULTIPLY,
+    LV_BLEND_MODE_REPLACE,
+} lv_blend_mode_t;
+
+typedef enum {
+    LV_DRAW_MASK_RES_TRANSP,
+    LV_DRAW_MASK_RES_FULL_COVER,
+    LV_DRAW_MASK_RES_CHANGED,
+    LV_DRAW_MASK_RES_UNKNOWN,
+} lv_draw_mask_res_t;
+
+/* Timers */
+struct _lv_timer_t;
+typedef void (*lv_timer_cb_t)(struct _lv_timer_t *);
+
+typedef struct _lv_timer_t {
+    uint32_t period;
+    uint32_t last_run;
+    lv_timer_cb_t timer_cb;
+    void *user_data;
+    int32_t repeat_count;
+    uint32_t paused : 1;
+    struct _lv_timer_t *next;
+} lv_timer_t;
+
+/* Images */
+typedef uint8_t lv_img_cf_t;
+enum {
+    LV_IMG_CF_UNKNOWN = 0,
+    LV_IMG_CF_RAW,
+    LV_IMG_CF_RAW_ALPHA,
+    LV_IMG_CF_RAW_CHROMA_KEYED,
+    LV_IMG_CF_TRUE_COLOR,
+    LV_IMG_CF_TRUE_COLOR_ALPHA,
+    LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED,
+    LV_IMG_CF_USER_ENCODED_0 = 24,
+};
+
+typedef enum {
+    LV_IMG_SRC_VARIABLE,
+    LV_IMG_SRC_FILE,
+    LV_IMG_SRC_SYMBOL,
+    LV_IMG_SRC_UNKNOWN,
+} lv_img_src_t;
+
+typedef struct {
+    uint32_t cf : 5;
+    uint32_t always_zero : 3;
+    uint32_t reserved : 2;
+    uint32_t w : 11;
+    uint32_t h : 11;
+} lv_img_header_t;
+
+typedef struct {
+    lv_img_header_t header;
+    uint32_t data_size;
+    const uint8_t *data;
+} lv_img_dsc_t;
+
+struct _lv_img_decoder_dsc_t;
+struct _lv_img_decoder_t;
+typedef lv_res_t (*lv_img_decoder_info_f_t)(struct _lv_img_decoder_t *decoder, const void *src,
+                                            lv_img_header_t *header);
+typedef lv_res_t (*lv_img_decoder_open_f_t)(struct _lv_img_decoder_t *decoder,
+                                            struct _lv_img_decoder_dsc_t *dsc);
+typedef lv_res_t (*lv_img_decoder_read_line_f_t)(struct _lv_img_decoder_t *decoder,
+                                                 struct _lv_img_decoder_dsc_t *dsc,
+                                                 lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf);
+typedef void (*lv_img_decoder_close_f_t)(struct _lv_img_decoder_t *decoder,
+                                         struct _lv_img_decoder_dsc_t *dsc);
+
+typedef struct _lv_img_decoder_t {
+    lv_img_decoder_info_f_t info_cb;
+    lv_img_decoder_open_f_t open_cb;
+    lv_img_decoder_read_line_f_t read_line_cb;
+    lv_img_decoder_close_f_t close_cb;
+    void *user_data;
+    struct _lv_img_decoder_t *next;
+} lv_img_decoder_t;
+
+typedef struct _lv_img_decoder_dsc_t {
+    lv_img_decoder_t *decoder;
+    const void *src;
+    lv_color_t color;
+    int32_t frame_id;
+    lv_img_src_t src_type;
+    lv_img_header_t header;
+    const uint8_t *img_data;
+    uint32_t time_to_open;
+    const char *error_msg;
+    void *user_data;
+} lv_img_decoder_dsc_t;
+
+typedef struct {
+    int16_t angle;
+    uint16_t zoom;
+    lv_point_t pivot;
+    lv_color_t recolor;
+    lv_opa_t recolor_opa;
+    lv_opa_t opa;
+    lv_blend_mode_t blend_mode;
+    int32_t frame_id;
+    uint8_t antialias : 1;
+} lv_draw_img_dsc_t;
+
+/* Drawing */
+typedef enum {
+    LV_DRAW_LAYER_FLAG_NONE,
+    LV_DRAW_LAYER_FLAG_HAS_ALPHA,
+    LV_DRAW_LAYER_FLAG_CAN_SUBDIVIDE,
+} lv_draw_layer_flags_t;
+
+typedef struct _lv_draw_layer_ctx_t {
+    lv_area_t area_full;
+    lv_area_t area_act;
+    lv_coord_t max_row_with_alpha;
+    lv_coord_t max_row_with_no_alpha;
+    void *buf;
+    struct {
+        const lv_area_t *clip_area;
+        lv_area_t *buf_area;
+        void *buf;
+        bool screen_transp;
+    } original;
+} lv_draw_layer_ctx_t;
+
+typedef struct _lv_draw_ctx_t {
+    void *buf;
+    lv_area_t *buf_area;
+    const lv_area_t *clip_area;
+    void (*draw_img_decoded)(struct _lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+                             const lv_area_t *coords, const uint8_t *map_p, lv_img_cf_t color_format);
+    void (*wait_for_finish)(struct _lv_draw_ctx_t *draw_ctx);
+    struct _lv_draw_layer_ctx_t *(*layer_init)(struct _lv_draw_ctx_t *draw_ctx,
+                                               struct _lv_draw_layer_ctx_t *layer,
+                                               lv_draw_layer_flags_t flags);
+    void (*layer_blend)(struct _lv_draw_ctx_t *draw_ctx, struct _lv_draw_layer_ctx_t *layer,
+                        const lv_draw_img_dsc_t *draw_dsc);
+    void (*layer_destroy)(struct _lv_draw_ctx_t *draw_ctx, lv_draw_layer_ctx_t *layer);
+    size_t layer_instance_size;
+    void *user_data;
+} lv_draw_ctx_t;
+
+/* Display */
+typedef struct _lv_disp_draw_buf_t {
+    void *buf1;
+    void *buf2;
+    void *buf_act;
+    uint32_t size;                  // In pixels
+    volatile int flushing;
+    volatile int flushing_last;
+    volatile uint32_t last_area : 1;
+    volatile uint32_t last_part : 1;
+} lv_disp_draw_buf_t;
+
+typedef struct _lv_disp_drv_t {
+    lv_coord_t hor_res;
+    lv_coord_t ver_res;
+    lv_disp_draw_buf_t *draw_buf;
+    uint32_t direct_mode : 1;
+    uint32_t full_refresh : 1;
+    uint32_t screen_transp : 1;         // The buffer being drawn holds LV_IMG_PX_SIZE_ALPHA_BYTE pixels
+    void (*flush_cb)(struct _lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+    void (*rounder_cb)(struct _lv_disp_drv_t *disp_drv, lv_area_t *area);
+    void (*monitor_cb)(struct _lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
+    void (*wait_cb)(struct _lv_disp_drv_t *disp_drv);
+    void (*draw_ctx_init)(struct _lv_disp_drv_t *disp_drv, lv_draw_ctx_t *draw_ctx);
+    void (*draw_ctx_deinit)(struct _lv_disp_drv_t *disp_drv, lv_draw_ctx_t *draw_ctx);
+    size_t draw_ctx_size;
+    lv_draw_ctx_t *draw_ctx;
+    void *user_data;
+} lv_disp_drv_t;
+
+struct _lv_obj_t;
+
+typedef struct _lv_disp_t {
+    lv_disp_drv_t *driver;
+    lv_timer_t *refr_timer;
+    struct _lv_obj_t *act_scr;
+    lv_area_t inv_areas[LV_INV_BUF_SIZE];
+    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+    uint16_t inv_p;
+    uint32_t rendering_in_progress : 1;
+    uint32_t last_activity_time;
+} lv_disp_t;
+
+/* Objects */
+typedef enum {
+    LV_EVENT_ALL = 0,
+    LV_EVENT_PRESSED,
+    LV_EVENT_RELEASED,
+    LV_EVENT_CLICKED,
+    LV_EVENT_KEY,
+    LV_EVENT_FOCUSED,
+    LV_EVENT_DEFOCUSED,
+    LV_EVENT_VALUE_CHANGED,
+    LV_EVENT_DELETE,
+} lv_event_code_t;
+
+typedef struct _lv_event_t {
+    struct _lv_obj_t *target;
+    struct _lv_obj_t *current_target;
+    lv_event_code_t code;
+    void *user_data;
+    void *param;
+} lv_event_t;
+
+typedef void (*lv_event_cb_t)(lv_event_t *e);
+
+typedef enum {
+    LV_OBJ_FLAG_HIDDEN = (1 << 0),
+    LV_OBJ_FLAG_CLICKABLE = (1 << 1),
+    LV_OBJ_FLAG_SCROLLABLE = (1 << 4),
+} lv_obj_flag_t;
+
+typedef enum {
+    LV_MOCK_OBJ_BASE,
+    LV_MOCK_OBJ_IMG,
+    LV_MOCK_OBJ_BTN,
+} lv_mock_obj_type_t;
+
+typedef struct _lv_obj_t {
+    struct _lv_obj_t *parent;
+    struct _lv_obj_t *child;            // First child (drawn first)
+    struct _lv_obj_t *next;             // Next sibling
+    lv_mock_obj_type_t type;
+    lv_area_t coords;
+    lv_coord_t x;                       // Position relative to the parent
+    lv_coord_t y;
+    uint32_t flags;
+    lv_color_t bg_color;
+    lv_opa_t bg_opa;
+    lv_opa_t opa;                       // Below LV_OPA_MAX: drawn through a layer
+    lv_coord_t radius;
+    const void *img_src;
+    struct _lv_group_t *group;
+    bool focused;
+    lv_event_cb_t event_cb;
+    lv_event_code_t event_filter;
+    void *event_user_data;
+    void *user_data;
+} lv_obj_t;
+
+/* Groups */
+typedef struct _lv_group_t {
+    lv_obj_t *objs[64];
+    uint32_t obj_count;
+    int32_t focus;                      // Index in objs, -1 if none
+} lv_group_t;
+
+/* Input devices */
+typedef enum {
+    LV_INDEV_TYPE_NONE,
+    LV_INDEV_TYPE_POINTER,
+    LV_INDEV_TYPE_KEYPAD,
+    LV_INDEV_TYPE_BUTTON,
+    LV_INDEV_TYPE_ENCODER,
+} lv_indev_type_t;
+
+typedef enum {
+    LV_INDEV_STATE_RELEASED = 0,
+    LV_INDEV_STATE_PRESSED,
+} lv_indev_state_t;
+#define LV_INDEV_STATE_REL  LV_INDEV_STATE_RELEASED
+#define LV_INDEV_STATE_PR   LV_INDEV_STATE_PRESSED
+
+enum {
+    LV_KEY_UP = 17,
+    LV_KEY_DOWN = 18,
+    LV_KEY_RIGHT = 19,
+    LV_KEY_LEFT = 20,
+    LV_KEY_ESC = 27,
+    LV_KEY_DEL = 127,
+    LV_KEY_BACKSPACE = 8,
+    LV_KEY_ENTER = 10,
+    LV_KEY_NEXT = 9,
+    LV_KEY_PREV = 11,
+    LV_KEY_HOME = 2,
+    LV_KEY_END = 3,
+};
+
+typedef struct {
+    lv_point_t point;
+    uint32_t key;
+    uint32_t btn_id;
+    int16_t enc_diff;
+    lv_indev_state_t state;
+    bool continue_reading;
+} lv_indev_data_t;
+
+struct _lv_indev_t;
+
+typedef struct _lv_indev_drv_t {
+    lv_indev_type_t type;
+    void (*read_cb)(struct _lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
+    void (*feedback_cb)(struct _lv_indev_drv_t *indev_drv, uint8_t code);
+    void *user_data;
+    lv_disp_t *disp;
+    lv_timer_t *read_timer;
+    uint16_t long_press_time;
+    uint16_t long_press_repeat_time;
+} lv_indev_drv_t;
+
+typedef struct _lv_indev_proc_t {
+    lv_indev_state_t state;
+    union {
+        struct {
+            lv_point_t act_point;
+            lv_point_t last_point;
+        } pointer;
+        struct {
+            lv_indev_state_t last_state;
+            uint32_t last_key;
+        } keypad;
+    } types;
+    uint32_t pr_timestamp;
+    uint32_t longpr_rep_timestamp;
+    uint8_t long_pr_sent : 1;
+} _lv_indev_proc_t;
+
+typedef struct _lv_indev_t {
+    lv_indev_drv_t *driver;
+    _lv_indev_proc_t proc;
+    lv_group_t *group;
+    struct _lv_indev_t *next;
+} lv_indev_t;
+
+/* Animations */
+struct _lv_anim_t;
+typedef void (*lv_anim_exec_xcb_t)(void *var, int32_t value);
+
+typedef struct _lv_anim_t {
+    void *var;
+    lv_anim_exec_xcb_t exec_cb;
+    int32_t start_value;
+    int32_t current_value;
+    int32_t end_value;
+    int32_t time;
+    int32_t act_time;
+    uint16_t repeat_cnt;
+    bool playback;
+    bool backwards;
+    struct _lv_anim_t *next;
+} lv_anim_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/* Core */
+void lv_init(void);
+void lv_tick_inc(uint32_t tick_period);
+uint32_t lv_tick_get(void);
+uint32_t lv_tick_elaps(uint32_t prev_tick);
+uint32_t lv_timer_handler(void);
+static inline uint32_t lv_task_handler(void) { return lv_timer_handler(); }
+
+/* Memory */
+void *lv_mem_alloc(size_t size);
+void lv_mem_free(void *data);
+void lv_memcpy(void *dst, const void *src, size_t len);
+void lv_memset(void *dst, uint8_t v, size_t len);
+void lv_memset_00(void *dst, size_t len);
+
+/* Timers */
+lv_timer_t *lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void *user_data);
+void lv_timer_del(lv_timer_t *timer);
+void lv_timer_pause(lv_timer_t *timer);
+void lv_timer_resume(lv_timer_t *timer);
+void lv_timer_set_period(lv_timer_t *timer, uint32_t period);
+void lv_timer_ready(lv_timer_t *timer);
+void lv_timer_reset(lv_timer_t *timer);
+void lv_timer_set_repeat_count(lv_timer_t *timer, int32_t repeat_count);
+
+/* Colors */
+static inline lv_color_t lv_color_make(uint8_t r8, uint8_t g8, uint8_t b8)
+{
+    uint16_t v = (uint16_t)(((r8 >> 3) << 11) | ((g8 >> 2) << 5) | (b8 >> 3));
+    lv_color_t c;
+#if LV_COLOR_16_SWAP
+    c.full = (uint16_t)((v >> 8) | (v << 8));
+#else
+    c.full = v;
+#endif
+    return c;
+}
+static inline lv_color_t lv_color_hex(uint32_t c)
+{
+    return lv_color_make((uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+}
+static inline lv_color_t lv_color_white(void) { return lv_color_make(0xFF, 0xFF, 0xFF); }
+static inline lv_color_t lv_color_black(void) { return lv_color_make(0, 0, 0); }
+lv_color_t lv_color_mix(lv_color_t c1, lv_color_t c2, uint8_t mix);
+void lv_color_fill(lv_color_t *buf, lv_color_t color, uint32_t px_num);
+
+/* Areas */
+static inline lv_coord_t lv_area_get_width(const lv_area_t *a) { return (lv_coord_t)(a->x2 - a->x1 + 1); }
+static inline lv_coord_t lv_area_get_height(const lv_area_t *a) { return (lv_coord_t)(a->y2 - a->y1 + 1); }
+static inline void lv_area_copy(lv_area_t *dest, const lv_area_t *src) { *dest = *src; }
+void lv_area_set(lv_area_t *area, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2);
+uint32_t lv_area_get_size(const lv_area_t *area);
+bool _lv_area_intersect(lv_area_t *res, const lv_area_t *a1, const lv_area_t *a2);
+void _lv_area_join(lv_area_t *res, const lv_area_t *a1, const lv_area_t *a2);
+bool _lv_area_is_on(const lv_area_t *a1, const lv_area_t *a2);
+bool _lv_area_is_in(const lv_area_t *ain, const lv_area_t *aholder, lv_coord_t radius);
+
+/* Display */
+void lv_disp_draw_buf_init(lv_disp_draw_buf_t *draw_buf, void *buf1, void *buf2, uint32_t size_in_px_cnt);
+void lv_disp_drv_init(lv_disp_drv_t *driver);
+lv_disp_t *lv_disp_drv_register(lv_disp_drv_t *driver);
+void lv_disp_flush_ready(lv_disp_drv_t *disp_drv);
+lv_disp_t *lv_disp_get_default(void);
+lv_obj_t *lv_disp_get_scr_act(lv_disp_t *disp);
+static inline lv_obj_t *lv_scr_act(void) { return lv_disp_get_scr_act(lv_disp_get_default()); }
+lv_timer_t *_lv_disp_get_refr_timer(lv_disp_t *disp);
+void _lv_disp_refr_timer(lv_timer_t *timer);
+lv_disp_t *_lv_refr_get_disp_refreshing(void);
+void _lv_inv_area(lv_disp_t *disp, const lv_area_t *area_p);
+void lv_refr_now(lv_disp_t *disp);
+
+/* Draw (lv_draw_sw.h has the software renderer) */
+bool lv_draw_mask_is_any(const lv_area_t *a);
+
+/* Images */
+lv_img_src_t lv_img_src_get_type(const void *src);
+lv_img_decoder_t *lv_img_decoder_create(void);
+void lv_img_decoder_set_info_cb(lv_img_decoder_t *decoder, lv_img_decoder_info_f_t info_cb);
+void lv_img_decoder_set_open_cb(lv_img_decoder_t *decoder, lv_img_decoder_open_f_t open_cb);
+void lv_img_decoder_set_read_line_cb(lv_img_decoder_t *decoder, lv_img_decoder_read_line_f_t read_line_cb);
+void lv_img_decoder_set_close_cb(lv_img_decoder_t *decoder, lv_img_decoder_close_f_t close_cb);
+lv_res_t lv_img_decoder_get_info(const void *src, lv_img_header_t *header);
+lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t *dsc, const void *src, lv_color_t color, int32_t frame_id);
+lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t *dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                                  uint8_t *buf);
+void lv_img_decoder_close(lv_img_decoder_dsc_t *dsc);
+
+/* Objects */
+lv_obj_t *lv_obj_create(lv_obj_t *parent);
+lv_obj_t *lv_btn_create(lv_obj_t *parent);
+lv_obj_t *lv_img_create(lv_obj_t *parent);
+void lv_obj_del(lv_obj_t *obj);
+void lv_obj_set_pos(lv_obj_t *obj, lv_coord_t x, lv_coord_t y);
+void lv_obj_set_x(lv_obj_t *obj, lv_coord_t x);
+void lv_obj_set_y(lv_obj_t *obj, lv_coord_t y);
+void lv_obj_set_size(lv_obj_t *obj, lv_coord_t w, lv_coord_t h);
+void lv_obj_set_style_bg_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector);
+void lv_obj_set_style_bg_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+void lv_obj_set_style_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+void lv_obj_set_style_radius(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_img_set_src(lv_obj_t *obj, const void *src);
+void lv_obj_add_flag(lv_obj_t *obj, lv_obj_flag_t f);
+void lv_obj_clear_flag(lv_obj_t *obj, lv_obj_flag_t f);
+void lv_obj_invalidate(const lv_obj_t *obj);
+void lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t event_cb, lv_event_code_t filter, void *user_data);
+lv_res_t lv_event_send(lv_obj_t *obj, lv_event_code_t event_code, void *param);
+static inline lv_event_code_t lv_event_get_code(lv_event_t *e) { return e->code; }
+static inline lv_obj_t *lv_event_get_target(lv_event_t *e) { return e->target; }
+static inline void *lv_event_get_user_data(lv_event_t *e) { return e->user_data; }
+static inline void *lv_event_get_param(lv_event_t *e) { return e->param; }
+
+/* Groups */
+lv_group_t *lv_group_create(void);
+void lv_group_set_default(lv_group_t *group);
+lv_group_t *lv_group_get_default(void);
+void lv_group_add_obj(lv_group_t *group, lv_obj_t *obj);
+void lv_group_focus_obj(lv_obj_t *obj);
+void lv_group_focus_next(lv_group_t *group);
+void lv_group_focus_prev(lv_group_t *group);
+lv_obj_t *lv_group_get_focused(const lv_group_t *group);
+
+/* Input devices */
+void lv_indev_drv_init(lv_indev_drv_t *driver);
+lv_indev_t *lv_indev_drv_register(lv_indev_drv_t *driver);
+void lv_indev_read_timer_cb(lv_timer_t *timer);
+void lv_indev_set_group(lv_indev_t *indev, lv_group_t *group);
+void lv_indev_get_point(const lv_indev_t *indev, lv_point_t *point);
+lv_indev_t *lv_indev_get_next(lv_indev_t *indev);
+
+/* Animations */
+void lv_anim_init(lv_anim_t *a);
+static inline void lv_anim_set_var(lv_anim_t *a, void *var) { a->var = var; }
+static inline void lv_anim_set_exec_cb(lv_anim_t *a, lv_anim_exec_xcb_t exec_cb) { a->exec_cb = exec_cb; }
+static inline void lv_anim_set_values(lv_anim_t *a, int32_t start, int32_t end)
+{
+    a->start_value = start;
+    a->current_value = start;
+    a->end_value = end;
+}
+static inline void lv_anim_set_time(lv_anim_t *a, uint32_t duration) { a->time = (int32_t)duration; }
+static inline void lv_anim_set_repeat_count(lv_anim_t *a, uint16_t cnt) { a->repeat_cnt = cnt; }
+static inline void lv_anim_set_playback(lv_anim_t *a, bool en) { a->playback = en; }
+lv_anim_t *lv_anim_start(const lv_anim_t *a);
+bool lv_anim_del(void *var, lv_anim_exec_xcb_t exec_cb);
+uint16_t lv_anim_count_running(void);
+
+/* Test access */
+void lv_mock_render_reference(lv_color_t *fb);
+uint32_t lv_mock_get_refreshes(void);
+void lv_mock_set_render_cost(uint32_t stripe_ns, uint32_t ns_per_px);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /* LVGL_H */
@@ -0,0 +1,33 @@
+/**
+ * @file platform.h
+ * @brief Pico SDK platform helpers (host build)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef _PICO_PLATFORM_H
+#define _PICO_PLATFORM_H
+
+#include "pico/types.h"
+
+#define __not_in_flash_func(f)      f
+#define __time_critical_func(f)     f
+#define __isr
+
+#define PICO_ERROR_NONE             0
+#define PICO_ERROR_TIMEOUT          (-1)
+#define PICO_ERROR_GENERIC          (-2)
+
+#define count_of(a)                 (sizeof(a) / sizeof((a)[0]))
+
+/* Busy-wait body: moves simulated time to the next model event */
+void tight_loop_contents(void);
+
+/* Exception number of the running handler, 0 in thread mode */
+uint __get_current_exception(void);
+
+uint get_core_num(void);
+
+static inline void __breakpoint(void) {}
+
+#endif /* _PICO_PLATFORM_H */
@@ -0,0 +1,26 @@
+/**
+ * @file types.h
+ * @brief Pico SDK base types (host build)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef _PICO_TYPES_H
+#define _PICO_TYPES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+/* Microseconds since boot */
+typedef uint64_t absolute_time_t;
+
+typedef volatile uint32_t io_rw_32;
+typedef volatile uint32_t io_ro_32;
+typedef volatile uint32_t io_wo_32;
+typedef volatile uint16_t io_rw_16;
+typedef volatile uint8_t io_rw_8;
+
+#endif /* _PICO_TYPES_H */
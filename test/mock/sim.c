@@ -0,0 +1,990 @@
+/**
+ * @file sim.c
+ * @brief Host Simulation Core: event loop, interrupts, GPIO, time, alarms, spin locks
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SIM_SHARED_HANDLERS     8
+#define SIM_GPIO_HOOKS          4
+#define SIM_ALARMS              16
+#define SIM_SPIN_LOCKS          32
+#define SIM_SPIN_LOCK_FIRST     24          // Like PICO_SPINLOCK_ID_CLAIM_FREE_FIRST
+#define SIM_MMIO_PORTS          32
+#define SIM_UART_CAPTURE        (256 * 1024)
+#define SIM_LIVELOCK            10000000u   // Events at one instant before giving up
+#define SIM_IRQ_STORM           1000000u    // Handler runs without time moving on
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    irq_handler_t handler;
+    uint8_t order;
+} sim_shared_handler_t;
+
+typedef struct {
+    irq_handler_t exclusive;
+    sim_shared_handler_t shared[SIM_SHARED_HANDLERS];
+    uint shared_count;
+    bool enabled;
+    sim_irq_level_t level;
+} sim_irq_t;
+
+typedef struct {
+    uint func;
+    bool oe;                    // SIO direction
+    bool out;                   // SIO output level
+    bool pull_up;
+    bool pull_down;
+    int ext;                    // Driven from outside, -1 = not driven
+    bool level;                 // Resolved pad level
+    uint32_t events;            // Latched edge events
+    uint32_t irq_en;            // Enabled events (proc 0)
+    sim_gpio_hook_t hooks[SIM_GPIO_HOOKS];
+    void *hook_ctx[SIM_GPIO_HOOKS];
+    uint hook_count;
+} sim_gpio_t;
+
+typedef struct {
+    alarm_id_t id;
+    uint64_t t_ns;
+    alarm_callback_t cb;
+    void *user_data;
+    bool active;
+    bool due;
+} sim_alarm_t;
+
+typedef struct {
+    volatile void *addr;
+    sim_mmio_write_t write;
+    sim_mmio_read_t read;
+    void *ctx;
+} sim_mmio_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void sim_check_limit(void);
+static bool sim_gpio_irq_level(void);
+static uint64_t sim_timer_next(void);
+static void sim_timer_service(void);
+static bool sim_timer_irq_level(void);
+static void sim_timer_irq_handler(void);
+static void sim_gpio_default_handler(void);
+static void sim_init(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint64_t now_ns = 0;
+static uint64_t limit_ns = SIM_MS(3600 * 1000ull);
+static sim_model_t *models = NULL;
+
+static sim_irq_t irqs[NUM_IRQS];
+static uint32_t primask = 0;
+static int isr_active = -1;
+
+static sim_gpio_t gpios[NUM_BANK0_GPIOS];
+static bool (*pio_oe_fn)(uint pio, uint pin) = NULL;
+static bool (*pio_out_fn)(uint pio, uint pin) = NULL;
+static gpio_irq_callback_t gpio_callback = NULL;
+static void (*gpio_change_fn)(uint pin, bool level) = NULL;
+
+static sim_alarm_t alarms[SIM_ALARMS];
+static alarm_id_t alarm_next_id = 1;
+static sim_model_t timer_model = { "timer", sim_timer_next, sim_timer_service, NULL };
+
+static spin_lock_t spin_locks[SIM_SPIN_LOCKS];
+static uint32_t spin_claimed = 0;
+
+static sim_mmio_t mmio_ports[SIM_MMIO_PORTS];
+static uint mmio_count = 0;
+
+static uint8_t uart_out[SIM_UART_CAPTURE];
+static size_t uart_out_len = 0;
+static uint8_t uart_in[4096];
+static size_t uart_in_head = 0;
+static size_t uart_in_tail = 0;
+
+static bool initialized = false;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+void (*sim_rtos_cpu_hook)(uint64_t ns) = NULL;
+bool (*sim_rtos_in_task_hook)(void) = NULL;
+uint (*sim_rtos_core_hook)(void) = NULL;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/*---------------------
+ * Event loop
+ *--------------------*/
+
+uint64_t sim_now(void)
+{
+    return now_ns;
+}
+
+void sim_add_model(sim_model_t *model)
+{
+    sim_init();
+    model->next = NULL;
+    sim_model_t **p = &models;
+    while (*p != NULL) {
+        p = &(*p)->next;
+    }
+    *p = model;
+}
+
+void sim_run_until(uint64_t t_ns)
+{
+    uint32_t spins = 0;
+
+    sim_init();
+    for (;;) {
+        sim_irq_dispatch();
+
+        uint64_t next = sim_next_event();
+        if (next > t_ns) {
+            break;
+        }
+        if (next <= now_ns) {
+            if (++spins > SIM_LIVELOCK) {
+                sim_fatal("models keep scheduling events at t=%llu ns", (unsigned long long)now_ns);
+            }
+        } else {
+            spins = 0;
+            now_ns = next;
+            sim_check_limit();
+        }
+
+        for (sim_model_t *m = models; m != NULL; m = m->next) {
+            if (m->next_ns() <= now_ns) {
+                m->service();
+            }
+        }
+    }
+
+    // A busy wait in an interrupt handler may already have gone past t_ns
+    if (t_ns > now_ns) {
+        now_ns = t_ns;
+        sim_check_limit();
+    }
+    sim_irq_dispatch();
+}
+
+void sim_run_for(uint64_t ns)
+{
+    sim_run_until(now_ns + ns);
+}
+
+/**
+ * @brief Time of the earliest pending model event, SIM_NEVER if none
+ */
+uint64_t sim_next_event(void)
+{
+    uint64_t next = SIM_NEVER;
+    for (sim_model_t *m = models; m != NULL; m = m->next) {
+        uint64_t t = m->next_ns();
+        if (t < next) {
+            next = t;
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief Advance to the next model event, at most SIM_STEP_NS
+ */
+void sim_step(void)
+{
+    uint64_t next = sim_next_event();
+    uint64_t cap = now_ns + SIM_STEP_NS;
+    sim_run_until(next < cap ? next : cap);
+}
+
+/**
+ * @brief Body of a busy wait: a task burns its core until the next event, anything else steps
+ */
+void sim_wait(void)
+{
+    if (isr_active < 0 && sim_rtos_in_task_hook != NULL && sim_rtos_in_task_hook()) {
+        uint64_t next = sim_next_event();
+        uint64_t ns = (next > now_ns) ? next - now_ns : SIM_CYCLE_NS;
+        sim_rtos_cpu_hook(ns < SIM_STEP_NS ? ns : SIM_STEP_NS);
+        return;
+    }
+    sim_step();
+}
+
+/**
+ * @brief Charge CPU time to the calling context
+ * @note A task occupies its core for that long, other contexts just let time pass
+ */
+void sim_cpu_ns(uint64_t ns)
+{
+    if (isr_active < 0 && sim_rtos_in_task_hook != NULL && sim_rtos_in_task_hook()) {
+        sim_rtos_cpu_hook(ns);
+        return;
+    }
+    if (isr_active >= 0) {
+        // Interrupt handlers can't be preempted, no other interrupt is taken meanwhile
+        uint64_t end = now_ns + ns;
+        while (now_ns < end) {
+            uint64_t next = sim_next_event();
+            sim_run_until(next < end ? next : end);
+        }
+        return;
+    }
+    sim_run_for(ns);
+}
+
+void sim_set_limit(uint64_t t_ns)
+{
+    limit_ns = t_ns;
+}
+
+void sim_fatal(const char *fmt, ...)
+{
+    va_list ap;
+
+    fflush(stdout);
+    fprintf(stderr, "SIM FATAL: ");
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fprintf(stderr, "\n");
+    exit(2);
+}
+
+/*---------------------
+ * Interrupts
+ *--------------------*/
+
+void sim_irq_set_level_fn(uint num, sim_irq_level_t fn)
+{
+    irqs[num].level = fn;
+}
+
+/**
+ * @brief Take all pending, enabled interrupts (lowest number first, no nesting)
+ */
+void sim_irq_dispatch(void)
+{
+    uint32_t runs = 0;
+
+    if (isr_active >= 0 || primask != 0) {
+        return;
+    }
+
+    for (;;) {
+        int num = -1;
+        for (uint i = 0; i < NUM_IRQS; i++) {
+            if (irqs[i].enabled && irqs[i].level != NULL && irqs[i].level()) {
+                num = (int)i;
+                break;
+            }
+        }
+        if (num < 0) {
+            return;
+        }
+        if (++runs > SIM_IRQ_STORM) {
+            sim_fatal("IRQ %d stays asserted after its handlers ran", num);
+        }
+
+        isr_active = num;
+        sim_irq_t *irq = &irqs[num];
+        if (irq->exclusive != NULL) {
+            irq->exclusive();
+        }
+        for (uint i = 0; i < irq->shared_count; i++) {
+            irq->shared[i].handler();
+        }
+        isr_active = -1;
+    }
+}
+
+bool sim_irq_masked(void)
+{
+    return primask != 0 || isr_active >= 0;
+}
+
+int sim_irq_active(void)
+{
+    return isr_active;
+}
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler)
+{
+    irqs[num].exclusive = handler;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority)
+{
+    sim_irq_t *irq = &irqs[num];
+    if (irq->shared_count >= SIM_SHARED_HANDLERS) {
+        sim_fatal("too many shared handlers on IRQ %u", num);
+    }
+
+    // Higher order priority runs first, equal ones in the order they were added
+    uint i = irq->shared_count;
+    while (i > 0 && irq->shared[i - 1].order < order_priority) {
+        irq->shared[i] = irq->shared[i - 1];
+        i--;
+    }
+    irq->shared[i] = (sim_shared_handler_t){ handler, order_priority };
+    irq->shared_count++;
+}
+
+void irq_remove_handler(uint num, irq_handler_t handler)
+{
+    sim_irq_t *irq = &irqs[num];
+    if (irq->exclusive == handler) {
+        irq->exclusive = NULL;
+    }
+    for (uint i = 0; i < irq->shared_count; i++) {
+        if (irq->shared[i].handler == handler) {
+            memmove(&irq->shared[i], &irq->shared[i + 1], (irq->shared_count - i - 1) * sizeof(irq->shared[0]));
+            irq->shared_count--;
+            break;
+        }
+    }
+}
+
+void irq_set_enabled(uint num, bool enabled)
+{
+    sim_init();
+    irqs[num].enabled = enabled;
+    sim_irq_dispatch();
+}
+
+bool irq_is_enabled(uint num)
+{
+    return irqs[num].enabled;
+}
+
+void irq_set_priority(uint num, uint8_t hardware_priority)
+{
+    (void)num;
+    (void)hardware_priority;
+}
+
+uint __get_current_exception(void)
+{
+    return isr_active >= 0 ? 16u + (uint)isr_active : 0u;
+}
+
+uint get_core_num(void)
+{
+    return sim_rtos_core_hook != NULL ? sim_rtos_core_hook() : 0u;
+}
+
+uint32_t save_and_disable_interrupts(void)
+{
+    uint32_t status = primask;
+    primask = 1;
+    return status;
+}
+
+void restore_interrupts(uint32_t status)
+{
+    primask = status;
+    if (primask == 0) {
+        sim_irq_dispatch();
+    }
+}
+
+/*---------------------
+ * Spin locks
+ *--------------------*/
+
+int spin_lock_claim_unused(bool required)
+{
+    for (uint i = SIM_SPIN_LOCK_FIRST; i < SIM_SPIN_LOCKS; i++) {
+        if (!(spin_claimed & (1u << i))) {
+            spin_claimed |= 1u << i;
+            return (int)i;
+        }
+    }
+    if (required) {
+        sim_fatal("no free spin lock");
+    }
+    return -1;
+}
+
+spin_lock_t *spin_lock_init(uint lock_num)
+{
+    spin_locks[lock_num] = 0;
+    return &spin_locks[lock_num];
+}
+
+uint32_t spin_lock_blocking(spin_lock_t *lock)
+{
+    uint32_t status = save_and_disable_interrupts();
+    if (*lock != 0) {
+        sim_fatal("spin lock %d taken twice", (int)(lock - spin_locks));
+    }
+    *lock = 1;
+    return status;
+}
+
+void spin_unlock(spin_lock_t *lock, uint32_t saved_irq)
+{
+    *lock = 0;
+    restore_interrupts(saved_irq);
+}
+
+/*---------------------
+ * GPIO
+ *--------------------*/
+
+void gpio_init(uint gpio)
+{
+    sim_init();
+    sim_gpio_t *g = &gpios[gpio];
+    g->oe = false;
+    g->out = false;
+    g->func = GPIO_FUNC_SIO;
+    sim_gpio_update(gpio);
+}
+
+void gpio_init_mask(uint32_t gpio_mask)
+{
+    for (uint i = 0; i < NUM_BANK0_GPIOS; i++) {
+        if (gpio_mask & (1u << i)) {
+            gpio_init(i);
+        }
+    }
+}
+
+void gpio_set_function(uint gpio, enum gpio_function fn)
+{
+    sim_init();
+    gpios[gpio].func = fn;
+    sim_gpio_update(gpio);
+}
+
+void gpio_set_dir(uint gpio, bool out)
+{
+    gpios[gpio].oe = out;
+    sim_gpio_update(gpio);
+}
+
+void gpio_put(uint gpio, bool value)
+{
+    gpios[gpio].out = value;
+    sim_gpio_update(gpio);
+}
+
+bool gpio_get(uint gpio)
+{
+    return gpios[gpio].level;
+}
+
+bool gpio_get_out_level(uint gpio)
+{
+    return gpios[gpio].out;
+}
+
+void gpio_set_pulls(uint gpio, bool up, bool down)
+{
+    gpios[gpio].pull_up = up;
+    gpios[gpio].pull_down = down;
+    sim_gpio_update(gpio);
+}
+
+void gpio_pull_up(uint gpio)
+{
+    gpio_set_pulls(gpio, true, false);
+}
+
+void gpio_pull_down(uint gpio)
+{
+    gpio_set_pulls(gpio, false, true);
+}
+
+void gpio_disable_pulls(uint gpio)
+{
+    gpio_set_pulls(gpio, false, false);
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled)
+{
+    // Like the SDK: stale edges are cleared before enabling
+    gpio_acknowledge_irq(gpio, event_mask);
+    if (enabled) {
+        gpios[gpio].irq_en |= event_mask;
+    } else {
+        gpios[gpio].irq_en &= ~event_mask;
+    }
+    sim_irq_dispatch();
+}
+
+void gpio_set_irq_callback(gpio_irq_callback_t callback)
+{
+    if (gpio_callback == NULL) {
+        irq_add_shared_handler(IO_IRQ_BANK0, sim_gpio_default_handler, PICO_SHARED_IRQ_HANDLER_LOWEST_ORDER_PRIORITY);
+    }
+    gpio_callback = callback;
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled, gpio_irq_callback_t callback)
+{
+    gpio_set_irq_enabled(gpio, event_mask, enabled);
+    gpio_set_irq_callback(callback);
+    if (enabled) {
+        irq_set_enabled(IO_IRQ_BANK0, true);
+    }
+}
+
+void gpio_add_raw_irq_handler(uint gpio, irq_handler_t handler)
+{
+    (void)gpio;
+    irq_add_shared_handler(IO_IRQ_BANK0, handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+}
+
+uint32_t gpio_get_irq_event_mask(uint gpio)
+{
+    sim_gpio_t *g = &gpios[gpio];
+    uint32_t status = g->events | (g->level ? GPIO_IRQ_LEVEL_HIGH : GPIO_IRQ_LEVEL_LOW);
+    return status & g->irq_en;
+}
+
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask)
+{
+    gpios[gpio].events &= ~(event_mask & (GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE));
+}
+
+/**
+ * @brief Drive a pin from outside (device model or test)
+ * @param level 0 / 1, -1 releases the pin
+ * @note Pins driven by both sides resolve like an open-drain bus: low wins
+ */
+void sim_gpio_drive(uint pin, int level)
+{
+    sim_init();
+    gpios[pin].ext = level;
+    sim_gpio_update(pin);
+    sim_irq_dispatch();
+}
+
+bool sim_gpio_level(uint pin)
+{
+    return gpios[pin].level;
+}
+
+uint sim_gpio_function(uint pin)
+{
+    return gpios[pin].func;
+}
+
+void sim_gpio_add_hook(uint pin, sim_gpio_hook_t hook, void *ctx)
+{
+    sim_gpio_t *g = &gpios[pin];
+    if (g->hook_count >= SIM_GPIO_HOOKS) {
+        sim_fatal("too many hooks on GPIO %u", pin);
+    }
+    g->hooks[g->hook_count] = hook;
+    g->hook_ctx[g->hook_count] = ctx;
+    g->hook_count++;
+}
+
+void sim_gpio_set_pio_source(bool (*oe)(uint pio, uint pin), bool (*out)(uint pio, uint pin))
+{
+    pio_oe_fn = oe;
+    pio_out_fn = out;
+}
+
+/**
+ * @brief Called on every pad level change (lets sleeping PIO state machines wake up)
+ */
+void sim_gpio_set_change_fn(void (*fn)(uint pin, bool level))
+{
+    gpio_change_fn = fn;
+}
+
+/**
+ * @brief Resolve the pad level after a change on either side, latch edges, run hooks
+ */
+void sim_gpio_update(uint pin)
+{
+    sim_gpio_t *g = &gpios[pin];
+    int drive = -1;
+
+    if (g->func == GPIO_FUNC_SIO && g->oe) {
+        drive = g->out;
+    } else if ((g->func == GPIO_FUNC_PIO0 || g->func == GPIO_FUNC_PIO1) && pio_oe_fn != NULL) {
+        uint pio = g->func - GPIO_FUNC_PIO0;
+        if (pio_oe_fn(pio, pin)) {
+            drive = pio_out_fn(pio, pin);
+        }
+    }
+
+    bool level;
+    if (drive >= 0 && g->ext >= 0) {
+        level = drive && g->ext;
+    } else if (drive >= 0) {
+        level = drive;
+    } else if (g->ext >= 0) {
+        level = g->ext;
+    } else {
+        level = g->pull_up || (g->func == GPIO_FUNC_I2C);
+    }
+
+    if (level == g->level) {
+        return;
+    }
+    g->level = level;
+    g->events |= level ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+    for (uint i = 0; i < g->hook_count; i++) {
+        g->hooks[i](pin, level, g->hook_ctx[i]);
+    }
+    if (gpio_change_fn != NULL) {
+        gpio_change_fn(pin, level);
+    }
+}
+
+/*---------------------
+ * DMA targets
+ *--------------------*/
+
+void sim_mmio_register(volatile void *addr, sim_mmio_write_t write, sim_mmio_read_t read, void *ctx)
+{
+    if (mmio_count >= SIM_MMIO_PORTS) {
+        sim_fatal("too many MMIO ports");
+    }
+    mmio_ports[mmio_count++] = (sim_mmio_t){ addr, write, read, ctx };
+}
+
+/**
+ * @brief Find the register model behind an address, NULL for plain memory
+ */
+const void *sim_mmio_find(const volatile void *addr, sim_mmio_write_t *write, sim_mmio_read_t *read, void **ctx)
+{
+    for (uint i = 0; i < mmio_count; i++) {
+        if (mmio_ports[i].addr == addr) {
+            *write = mmio_ports[i].write;
+            *read = mmio_ports[i].read;
+            *ctx = mmio_ports[i].ctx;
+            return &mmio_ports[i];
+        }
+    }
+    return NULL;
+}
+
+/*---------------------
+ * Time
+ *--------------------*/
+
+void tight_loop_contents(void)
+{
+    sim_wait();
+}
+
+uint32_t time_us_32(void)
+{
+    return (uint32_t)(now_ns / 1000);
+}
+
+uint64_t time_us_64(void)
+{
+    return now_ns / 1000;
+}
+
+absolute_time_t get_absolute_time(void)
+{
+    return now_ns / 1000;
+}
+
+absolute_time_t make_timeout_time_us(uint64_t us)
+{
+    return now_ns / 1000 + us;
+}
+
+absolute_time_t make_timeout_time_ms(uint32_t ms)
+{
+    return now_ns / 1000 + (uint64_t)ms * 1000;
+}
+
+absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us)
+{
+    return t + us;
+}
+
+bool time_reached(absolute_time_t t)
+{
+    return now_ns / 1000 >= t;
+}
+
+int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to)
+{
+    return (int64_t)(to - from);
+}
+
+void sleep_us(uint64_t us)
+{
+    sim_cpu_ns(SIM_US(us));
+}
+
+void sleep_ms(uint32_t ms)
+{
+    sim_cpu_ns(SIM_MS(ms));
+}
+
+void busy_wait_us_32(uint32_t us)
+{
+    sim_cpu_ns(SIM_US(us));
+}
+
+void busy_wait_us(uint64_t us)
+{
+    sim_cpu_ns(SIM_US(us));
+}
+
+uint32_t clock_get_hz(enum clock_index clk_index)
+{
+    switch (clk_index) {
+        case clk_sys:
+        case clk_peri:
+            return SIM_SYS_HZ;
+        case clk_usb:
+        case clk_adc:
+            return 48000000u;
+        case clk_ref:
+            return 12000000u;
+        default:
+            return 0;
+    }
+}
+
+/*---------------------
+ * Alarms
+ *--------------------*/
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    sim_init();
+    if (us == 0 && fire_if_past) {
+        int64_t again = callback(0, user_data);
+        if (again == 0) {
+            return 0;
+        }
+        us = (uint64_t)(again < 0 ? -again : again);
+    }
+
+    for (uint i = 0; i < SIM_ALARMS; i++) {
+        if (!alarms[i].active) {
+            alarms[i] = (sim_alarm_t){
+                .id = alarm_next_id++,
+                .t_ns = now_ns + SIM_US(us),
+                .cb = callback,
+                .user_data = user_data,
+                .active = true,
+                .due = false,
+            };
+            return alarms[i].id;
+        }
+    }
+    return -1;
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    return add_alarm_in_us((uint64_t)ms * 1000, callback, user_data, fire_if_past);
+}
+
+bool cancel_alarm(alarm_id_t alarm_id)
+{
+    for (uint i = 0; i < SIM_ALARMS; i++) {
+        if (alarms[i].active && alarms[i].id == alarm_id) {
+            alarms[i].active = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*---------------------
+ * stdio / UART
+ *--------------------*/
+
+uart_inst_t *const sim_uart0 = (uart_inst_t *)&uart_out;
+
+bool stdio_init_all(void)
+{
+    return true;
+}
+
+void uart_write_blocking(uart_inst_t *uart, const uint8_t *src, size_t len)
+{
+    (void)uart;
+    if (uart_out_len + len > sizeof(uart_out)) {
+        sim_fatal("UART capture overflow");
+    }
+    memcpy(&uart_out[uart_out_len], src, len);
+    uart_out_len += len;
+
+    // 115200 baud, 10 bits per byte
+    sim_cpu_ns((uint64_t)len * 86806);
+}
+
+size_t sim_uart_take(uint8_t *dst, size_t max)
+{
+    size_t n = uart_out_len < max ? uart_out_len : max;
+    memcpy(dst, uart_out, n);
+    memmove(uart_out, &uart_out[n], uart_out_len - n);
+    uart_out_len -= n;
+    return n;
+}
+
+void sim_uart_feed(const uint8_t *src, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        uart_in[uart_in_head++ % sizeof(uart_in)] = src[i];
+    }
+}
+
+int getchar_timeout_us(uint32_t timeout_us)
+{
+    if (uart_in_tail != uart_in_head) {
+        return uart_in[uart_in_tail++ % sizeof(uart_in)];
+    }
+    sim_cpu_ns(SIM_US(timeout_us));
+    return PICO_ERROR_TIMEOUT;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void sim_init(void)
+{
+    if (initialized) {
+        return;
+    }
+    initialized = true;
+
+    for (uint i = 0; i < NUM_BANK0_GPIOS; i++) {
+        gpios[i].func = GPIO_FUNC_NULL;
+        gpios[i].ext = -1;
+        gpios[i].pull_down = true;      // Reset state of the pads
+    }
+
+    irqs[IO_IRQ_BANK0].level = sim_gpio_irq_level;
+    irqs[TIMER_IRQ_3].level = sim_timer_irq_level;
+    irqs[TIMER_IRQ_3].exclusive = sim_timer_irq_handler;
+    irqs[TIMER_IRQ_3].enabled = true;
+    sim_add_model(&timer_model);
+}
+
+static void sim_check_limit(void)
+{
+    if (now_ns > limit_ns) {
+        sim_fatal("simulated time limit of %llu ms exceeded (deadlock?)",
+                  (unsigned long long)(limit_ns / 1000000));
+    }
+}
+
+static bool sim_gpio_irq_level(void)
+{
+    for (uint i = 0; i < NUM_BANK0_GPIOS; i++) {
+        if (gpio_get_irq_event_mask(i) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Default GPIO handler: acknowledge and report each pin through the callback
+ */
+static void sim_gpio_default_handler(void)
+{
+    for (uint i = 0; i < NUM_BANK0_GPIOS; i++) {
+        uint32_t events = gpio_get_irq_event_mask(i);
+        if (events != 0 && gpio_callback != NULL) {
+            gpio_acknowledge_irq(i, events);
+            gpio_callback(i, events);
+        }
+    }
+}
+
+static uint64_t sim_timer_next(void)
+{
+    uint64_t next = SIM_NEVER;
+    for (uint i = 0; i < SIM_ALARMS; i++) {
+        if (alarms[i].active && !alarms[i].due && alarms[i].t_ns < next) {
+            next = alarms[i].t_ns;
+        }
+    }
+    return next;
+}
+
+static void sim_timer_service(void)
+{
+    for (uint i = 0; i < SIM_ALARMS; i++) {
+        if (alarms[i].active && !alarms[i].due && alarms[i].t_ns <= now_ns) {
+            alarms[i].due = true;
+        }
+    }
+}
+
+static bool sim_timer_irq_level(void)
+{
+    for (uint i = 0; i < SIM_ALARMS; i++) {
+        if (alarms[i].active && alarms[i].due) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Timer interrupt: run the earliest due alarm, reschedule it as the SDK does
+ */
+static void sim_timer_irq_handler(void)
+{
+    sim_alarm_t *a = NULL;
+    for (uint i = 0; i < SIM_ALARMS; i++) {
+        if (alarms[i].active && alarms[i].due && (a == NULL || alarms[i].t_ns < a->t_ns)) {
+            a = &alarms[i];
+        }
+    }
+    if (a == NULL) {
+        return;
+    }
+
+    a->due = false;
+    int64_t again = a->cb(a->id, a->user_data);
+    if (again > 0) {
+        a->t_ns += SIM_US(again);          // From the time it was due
+    } else if (again < 0) {
+        a->t_ns = now_ns + SIM_US(-again);  // From now
+    } else {
+        a->active = false;
+        return;
+    }
+    if (a->t_ns <= now_ns) {
+        a->due = true;
+    }
+}
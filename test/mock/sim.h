@@ -0,0 +1,116 @@
+/**
+ * @file sim.h
+ * @brief Host Simulation Core
+ * @note The firmware modules are compiled unchanged against the SDK headers in test/mock.
+ *       Peripherals are models that run in simulated time (ns): busy waits, sleeps and blocking
+ *       calls move time forward to the next model event, interrupts are taken between events
+ *       (never nested, masked while interrupts are disabled). Everything is deterministic.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "pico/types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SIM_NEVER           UINT64_MAX
+
+/* System clock: 125 MHz, 8 ns per cycle */
+#define SIM_SYS_HZ          125000000u
+#define SIM_CYCLE_NS        8u
+
+/* Longest step of a busy wait without model events (ns) */
+#define SIM_STEP_NS         1000u
+
+#define SIM_MS(ms)          ((uint64_t)(ms) * 1000000u)
+#define SIM_US(us)          ((uint64_t)(us) * 1000u)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Peripheral model advanced by the event loop
+ */
+typedef struct sim_model {
+    const char *name;
+    uint64_t (*next_ns)(void);      // Next event not yet serviced, SIM_NEVER if none
+    void (*service)(void);          // Run the events due at sim_now()
+    struct sim_model *next;
+} sim_model_t;
+
+typedef bool (*sim_irq_level_t)(void);
+typedef void (*sim_gpio_hook_t)(uint pin, bool level, void *ctx);
+typedef void (*sim_mmio_write_t)(uint32_t value, uint size, void *ctx);
+typedef uint32_t (*sim_mmio_read_t)(void *ctx);
+typedef bool (*sim_dreq_ready_t)(void *ctx);
+typedef void (*sim_spi_sink_t)(uint32_t frame, uint bits, void *ctx);
+typedef uint16_t (*sim_adc_source_t)(uint input, void *ctx);
+typedef void (*sim_pwm_sink_t)(uint slice, uint32_t cc, void *ctx);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/* Time and event loop */
+uint64_t sim_now(void);
+void sim_add_model(sim_model_t *model);
+void sim_run_until(uint64_t t_ns);
+void sim_run_for(uint64_t ns);
+uint64_t sim_next_event(void);
+void sim_step(void);
+void sim_wait(void);
+void sim_cpu_ns(uint64_t ns);
+void sim_set_limit(uint64_t t_ns);
+void sim_fatal(const char *fmt, ...) __attribute__((noreturn, format(printf, 1, 2)));
+
+/* Interrupts */
+void sim_irq_set_level_fn(uint num, sim_irq_level_t fn);
+void sim_irq_dispatch(void);
+bool sim_irq_masked(void);
+int sim_irq_active(void);
+
+/* GPIO: pins driven by the outside world, level hooks, peripheral outputs */
+void sim_gpio_drive(uint pin, int level);
+bool sim_gpio_level(uint pin);
+uint sim_gpio_function(uint pin);
+void sim_gpio_add_hook(uint pin, sim_gpio_hook_t hook, void *ctx);
+void sim_gpio_update(uint pin);
+void sim_gpio_set_pio_source(bool (*oe)(uint pio, uint pin), bool (*out)(uint pio, uint pin));
+void sim_gpio_set_change_fn(void (*fn)(uint pin, bool level));
+
+/* DMA targets: registers with side effects and their DREQs */
+void sim_mmio_register(volatile void *addr, sim_mmio_write_t write, sim_mmio_read_t read, void *ctx);
+const void *sim_mmio_find(const volatile void *addr, sim_mmio_write_t *write, sim_mmio_read_t *read, void **ctx);
+void sim_dreq_register(uint dreq, sim_dreq_ready_t ready, void *ctx);
+void sim_dma_pump(void);
+uint32_t sim_dma_get_transfers(uint channel);
+uint32_t sim_dma_get_fill_transfers(void);
+
+/* SPI: received frames go to the sink (the device on the bus) */
+void sim_spi_set_sink(uint index, sim_spi_sink_t sink, void *ctx);
+
+/* ADC: each conversion's result comes from the source (the analog side), at sim_now() */
+void sim_adc_set_source(sim_adc_source_t source, void *ctx);
+uint32_t sim_adc_get_overruns(void);
+
+/* PWM: every write of a CC register goes to the sink (the load on the pin), at sim_now() */
+void sim_pwm_set_sink(sim_pwm_sink_t sink, void *ctx);
+
+/* RTOS hooks, set by the FreeRTOS model when linked */
+extern void (*sim_rtos_cpu_hook)(uint64_t ns);
+extern bool (*sim_rtos_in_task_hook)(void);
+extern uint (*sim_rtos_core_hook)(void);
+
+/* FreeRTOS model (sim_rtos.c): run the scheduler from the test's main() */
+void sim_rtos_run_until(uint64_t t_ns);
+void sim_rtos_run_for(uint64_t ns);
+uint64_t sim_rtos_get_busy_ns(uint core);
+
+#endif /* SIM_H */
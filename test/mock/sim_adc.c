@@ -0,0 +1,209 @@
+/**
+ * @file sim_adc.c
+ * @brief Host Simulation: ADC (free-running mode)
+ * @note A conversion completes every 1 + div ADC clocks (96 at least), its result is pushed into
+ *       the 4-deep FIFO and the next input of the round robin mask is selected. A result arriving
+ *       at a full FIFO is lost and counted. The FIFO is read through adc_hw->fifo (DMA or CPU).
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "sim.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/gpio.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SIM_ADC_FIFO_DEPTH  4
+#define SIM_ADC_INPUTS      5
+#define SIM_ADC_MIN_CYCLES  96
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint64_t sim_adc_next(void);
+static void sim_adc_service(void);
+static uint64_t sim_adc_conversion_ns(uint64_t n);
+static uint32_t sim_adc_fifo_read(void *ctx);
+static bool sim_adc_rx_ready(void *ctx);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static sim_model_t adc_model = { "adc", sim_adc_next, sim_adc_service, NULL };
+static bool initialized = false;
+static sim_adc_source_t source = NULL;
+static void *source_ctx = NULL;
+
+static uint input = 0;
+static uint rrobin = 0;
+static uint32_t div_fx = 0;             // Divider in 1/256 ADC clocks
+static bool running = false;
+static uint64_t run_start_ns = 0;
+static uint64_t conversions = 0;        // Since adc_run(true)
+static uint16_t fifo[SIM_ADC_FIFO_DEPTH];
+static uint fifo_head = 0;
+static uint fifo_count = 0;
+static uint32_t overruns = 0;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+adc_hw_t sim_adc_hw;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void sim_adc_set_source(sim_adc_source_t fn, void *ctx)
+{
+    source = fn;
+    source_ctx = ctx;
+}
+
+uint32_t sim_adc_get_overruns(void)
+{
+    return overruns;
+}
+
+void adc_init(void)
+{
+    if (!initialized) {
+        initialized = true;
+        sim_add_model(&adc_model);
+        sim_mmio_register(&adc_hw->fifo, NULL, sim_adc_fifo_read, NULL);
+        sim_dreq_register(DREQ_ADC, sim_adc_rx_ready, NULL);
+    }
+    running = false;
+    rrobin = 0;
+    div_fx = 0;
+    fifo_count = 0;
+}
+
+void adc_gpio_init(uint gpio)
+{
+    gpio_set_function(gpio, GPIO_FUNC_NULL);
+}
+
+void adc_select_input(uint in)
+{
+    input = in;
+}
+
+uint adc_get_selected_input(void)
+{
+    return input;
+}
+
+void adc_set_round_robin(uint input_mask)
+{
+    rrobin = input_mask;
+}
+
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift)
+{
+    if (!en || !dreq_en || dreq_thresh != 1 || err_in_fifo || byte_shift) {
+        sim_fatal("ADC FIFO: only 12-bit results with DREQ at 1 are modelled");
+    }
+}
+
+void adc_set_clkdiv(float clkdiv)
+{
+    div_fx = (uint32_t)(clkdiv * 256.0f);
+}
+
+void adc_run(bool run)
+{
+    if (run && !running) {
+        run_start_ns = sim_now();
+        conversions = 0;
+    }
+    running = run;
+}
+
+void adc_fifo_drain(void)
+{
+    fifo_count = 0;
+}
+
+bool adc_fifo_is_empty(void)
+{
+    return fifo_count == 0;
+}
+
+uint8_t adc_fifo_get_level(void)
+{
+    return (uint8_t)fifo_count;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief End time of conversion n (0 = the first) since adc_run(true), no accumulated rounding
+ * @note ADC clock in whole MHz, keeps the product in 64 bits for hours of conversions
+ */
+static uint64_t sim_adc_conversion_ns(uint64_t n)
+{
+    uint64_t cycles_fx = 256 + div_fx;
+
+    if (cycles_fx < SIM_ADC_MIN_CYCLES * 256) {
+        cycles_fx = SIM_ADC_MIN_CYCLES * 256;
+    }
+    return run_start_ns + (n + 1) * cycles_fx * 1000u / (clock_get_hz(clk_adc) / 1000000u * 256u);
+}
+
+static uint64_t sim_adc_next(void)
+{
+    return running ? sim_adc_conversion_ns(conversions) : SIM_NEVER;
+}
+
+static void sim_adc_service(void)
+{
+    while (running && sim_adc_conversion_ns(conversions) <= sim_now()) {
+        uint16_t value = source != NULL ? (uint16_t)(source(input, source_ctx) & 0x0FFF) : 0;
+
+        conversions++;
+        if (fifo_count < SIM_ADC_FIFO_DEPTH) {
+            fifo[(fifo_head + fifo_count) % SIM_ADC_FIFO_DEPTH] = value;
+            fifo_count++;
+        } else {
+            overruns++;
+        }
+
+        // Next input of the round robin, wrapping
+        for (uint i = 1; rrobin != 0 && i <= SIM_ADC_INPUTS; i++) {
+            uint next = (input + i) % SIM_ADC_INPUTS;
+            if (rrobin & (1u << next)) {
+                input = next;
+                break;
+            }
+        }
+        sim_dma_pump();
+    }
+}
+
+static uint32_t sim_adc_fifo_read(void *ctx)
+{
+    (void)ctx;
+
+    if (fifo_count == 0) {
+        return 0;
+    }
+    uint16_t value = fifo[fifo_head];
+    fifo_head = (fifo_head + 1) % SIM_ADC_FIFO_DEPTH;
+    fifo_count--;
+    return value;
+}
+
+static bool sim_adc_rx_ready(void *ctx)
+{
+    (void)ctx;
+    return fifo_count > 0;
+}
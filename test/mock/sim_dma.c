@@ -0,0 +1,541 @@
+/**
+ * @file sim_dma.c
+ * @brief Host Simulation: DMA controller
+ * @note Channels move data between host memory and registered MMIO ports.
+ *       - DREQ_FORCE: the whole block completes as one event, one transfer per system clock
+ *       - Peripheral DREQs: transfers run whenever the peripheral model reports space / data
+ *       - DMA timers: one transfer per numerator/denominator system clocks
+ *       Read/write addresses advance and are not reloaded, the transfer count is reloaded on
+ *       every trigger, as on the RP2040.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "sim.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    bool claimed;
+    dma_channel_config cfg;
+    uintptr_t read_addr;
+    uintptr_t write_addr;
+    uint32_t trans_count;       // Reloaded into remaining on trigger
+    uint32_t remaining;
+    bool busy;
+    uint64_t start_ns;
+    uint64_t paced;             // Transfers done since start (timer / force pacing)
+    bool intr;
+    bool inte[2];
+    uint32_t transfers;         // Total transfers, for tests
+} sim_dma_chan_t;
+
+typedef struct {
+    sim_dreq_ready_t ready;
+    void *ctx;
+} sim_dreq_t;
+
+typedef struct {
+    bool claimed;
+    uint16_t num;
+    uint16_t den;
+} sim_dma_timer_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void sim_dma_init(void);
+static uint64_t sim_dma_next(void);
+static void sim_dma_service(void);
+static uint64_t sim_dma_due(const sim_dma_chan_t *c);
+static void sim_dma_trigger(uint channel);
+static void sim_dma_xfer(sim_dma_chan_t *c);
+static void sim_dma_complete(uint channel);
+static bool sim_dma_irq0_level(void);
+static bool sim_dma_irq1_level(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static sim_dma_chan_t chans[NUM_DMA_CHANNELS];
+static sim_dma_timer_t timers[NUM_DMA_TIMERS];
+static sim_dreq_t dreqs[64];
+static sim_model_t dma_model = { "dma", sim_dma_next, sim_dma_service, NULL };
+static bool initialized = false;
+static bool pumping = false;
+static bool repump = false;
+static uint32_t fill_transfers = 0;     // Transfers from a fixed read address (fills), for tests
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void sim_dreq_register(uint dreq, sim_dreq_ready_t ready, void *ctx)
+{
+    dreqs[dreq] = (sim_dreq_t){ ready, ctx };
+}
+
+/**
+ * @brief Run every transfer that peripheral DREQs currently allow
+ * @note Called by peripheral models whenever FIFO state changes
+ */
+void sim_dma_pump(void)
+{
+    if (pumping) {
+        repump = true;
+        return;
+    }
+    pumping = true;
+    do {
+        repump = false;
+        bool progress;
+        do {
+            progress = false;
+            for (uint i = 0; i < NUM_DMA_CHANNELS; i++) {
+                sim_dma_chan_t *c = &chans[i];
+                if (!c->busy || c->cfg.dreq >= DREQ_DMA_TIMER0) {
+                    continue;
+                }
+                const sim_dreq_t *d = &dreqs[c->cfg.dreq];
+                if (d->ready == NULL || !d->ready(d->ctx)) {
+                    continue;
+                }
+                sim_dma_xfer(c);
+                progress = true;
+                if (c->remaining == 0) {
+                    sim_dma_complete(i);
+                }
+            }
+        } while (progress);
+    } while (repump);
+    pumping = false;
+}
+
+int dma_claim_unused_channel(bool required)
+{
+    sim_dma_init();
+    for (uint i = 0; i < NUM_DMA_CHANNELS; i++) {
+        if (!chans[i].claimed) {
+            chans[i].claimed = true;
+            return (int)i;
+        }
+    }
+    if (required) {
+        sim_fatal("no free DMA channel");
+    }
+    return -1;
+}
+
+void dma_channel_claim(uint channel)
+{
+    sim_dma_init();
+    chans[channel].claimed = true;
+}
+
+void dma_channel_unclaim(uint channel)
+{
+    chans[channel].claimed = false;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel)
+{
+    return (dma_channel_config){
+        .enable = true,
+        .read_increment = true,
+        .write_increment = false,
+        .bswap = false,
+        .irq_quiet = false,
+        .high_priority = false,
+        .size = DMA_SIZE_32,
+        .chain_to = channel,
+        .dreq = DREQ_FORCE,
+    };
+}
+
+dma_channel_config dma_get_channel_config(uint channel)
+{
+    return chans[channel].cfg;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+    c->read_increment = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+    c->write_increment = incr;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq)
+{
+    c->dreq = dreq;
+}
+
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to)
+{
+    c->chain_to = chain_to;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size)
+{
+    c->size = size;
+}
+
+void channel_config_set_bswap(dma_channel_config *c, bool bswap)
+{
+    c->bswap = bswap;
+}
+
+void channel_config_set_irq_quiet(dma_channel_config *c, bool irq_quiet)
+{
+    c->irq_quiet = irq_quiet;
+}
+
+void channel_config_set_enable(dma_channel_config *c, bool enable)
+{
+    c->enable = enable;
+}
+
+void channel_config_set_high_priority(dma_channel_config *c, bool high_priority)
+{
+    c->high_priority = high_priority;
+}
+
+void dma_channel_set_config(uint channel, const dma_channel_config *config, bool trigger)
+{
+    chans[channel].cfg = *config;
+    if (trigger) {
+        sim_dma_trigger(channel);
+    }
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger)
+{
+    sim_dma_chan_t *c = &chans[channel];
+    c->cfg = *config;
+    c->write_addr = (uintptr_t)write_addr;
+    c->read_addr = (uintptr_t)read_addr;
+    c->trans_count = transfer_count;
+    if (trigger) {
+        sim_dma_trigger(channel);
+    }
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger)
+{
+    chans[channel].read_addr = (uintptr_t)read_addr;
+    if (trigger) {
+        sim_dma_trigger(channel);
+    }
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger)
+{
+    chans[channel].write_addr = (uintptr_t)write_addr;
+    if (trigger) {
+        sim_dma_trigger(channel);
+    }
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger)
+{
+    chans[channel].trans_count = trans_count;
+    if (trigger) {
+        sim_dma_trigger(channel);
+    }
+}
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count)
+{
+    chans[channel].read_addr = (uintptr_t)read_addr;
+    chans[channel].trans_count = transfer_count;
+    sim_dma_trigger(channel);
+}
+
+void dma_channel_transfer_to_buffer_now(uint channel, volatile void *write_addr, uint32_t transfer_count)
+{
+    chans[channel].write_addr = (uintptr_t)write_addr;
+    chans[channel].trans_count = transfer_count;
+    sim_dma_trigger(channel);
+}
+
+void dma_channel_start(uint channel)
+{
+    sim_dma_trigger(channel);
+}
+
+void dma_start_channel_mask(uint32_t chan_mask)
+{
+    for (uint i = 0; i < NUM_DMA_CHANNELS; i++) {
+        if (chan_mask & (1u << i)) {
+            sim_dma_trigger(i);
+        }
+    }
+}
+
+void dma_channel_abort(uint channel)
+{
+    chans[channel].busy = false;
+    chans[channel].remaining = 0;
+}
+
+bool dma_channel_is_busy(uint channel)
+{
+    return chans[channel].busy;
+}
+
+void dma_channel_wait_for_finish_blocking(uint channel)
+{
+    while (chans[channel].busy) {
+        sim_wait();
+    }
+}
+
+void dma_irqn_set_channel_enabled(uint irq_index, uint channel, bool enabled)
+{
+    chans[channel].inte[irq_index] = enabled;
+    sim_irq_dispatch();
+}
+
+bool dma_irqn_get_channel_status(uint irq_index, uint channel)
+{
+    return chans[channel].intr && chans[channel].inte[irq_index];
+}
+
+void dma_irqn_acknowledge_channel(uint irq_index, uint channel)
+{
+    (void)irq_index;
+    chans[channel].intr = false;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled)
+{
+    dma_irqn_set_channel_enabled(0, channel, enabled);
+}
+
+void dma_channel_set_irq1_enabled(uint channel, bool enabled)
+{
+    dma_irqn_set_channel_enabled(1, channel, enabled);
+}
+
+bool dma_channel_get_irq0_status(uint channel)
+{
+    return dma_irqn_get_channel_status(0, channel);
+}
+
+void dma_channel_acknowledge_irq0(uint channel)
+{
+    dma_irqn_acknowledge_channel(0, channel);
+}
+
+void dma_channel_acknowledge_irq1(uint channel)
+{
+    dma_irqn_acknowledge_channel(1, channel);
+}
+
+int dma_claim_unused_timer(bool required)
+{
+    for (uint i = 0; i < NUM_DMA_TIMERS; i++) {
+        if (!timers[i].claimed) {
+            timers[i].claimed = true;
+            return (int)i;
+        }
+    }
+    if (required) {
+        sim_fatal("no free DMA timer");
+    }
+    return -1;
+}
+
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator)
+{
+    timers[timer].num = numerator;
+    timers[timer].den = denominator;
+}
+
+uint32_t sim_dma_get_transfers(uint channel)
+{
+    return chans[channel].transfers;
+}
+
+uint32_t sim_dma_get_fill_transfers(void)
+{
+    return fill_transfers;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void sim_dma_init(void)
+{
+    if (initialized) {
+        return;
+    }
+    initialized = true;
+    sim_add_model(&dma_model);
+    sim_irq_set_level_fn(DMA_IRQ_0, sim_dma_irq0_level);
+    sim_irq_set_level_fn(DMA_IRQ_1, sim_dma_irq1_level);
+}
+
+/**
+ * @brief Time of the next self-paced transfer (force / timer DREQ), SIM_NEVER otherwise
+ */
+static uint64_t sim_dma_due(const sim_dma_chan_t *c)
+{
+    if (!c->busy) {
+        return SIM_NEVER;
+    }
+    if (c->cfg.dreq == DREQ_FORCE) {
+        return c->start_ns + (uint64_t)c->trans_count * SIM_CYCLE_NS;
+    }
+    if (c->cfg.dreq >= DREQ_DMA_TIMER0) {
+        const sim_dma_timer_t *t = &timers[c->cfg.dreq - DREQ_DMA_TIMER0];
+        if (t->num == 0) {
+            return SIM_NEVER;
+        }
+        return c->start_ns + (c->paced + 1) * t->den * SIM_CYCLE_NS / t->num;
+    }
+    return SIM_NEVER;
+}
+
+static uint64_t sim_dma_next(void)
+{
+    uint64_t next = SIM_NEVER;
+    for (uint i = 0; i < NUM_DMA_CHANNELS; i++) {
+        uint64_t t = sim_dma_due(&chans[i]);
+        if (t < next) {
+            next = t;
+        }
+    }
+    return next;
+}
+
+static void sim_dma_service(void)
+{
+    for (uint i = 0; i < NUM_DMA_CHANNELS; i++) {
+        sim_dma_chan_t *c = &chans[i];
+        if (sim_dma_due(c) > sim_now()) {
+            continue;
+        }
+        if (c->cfg.dreq == DREQ_FORCE) {
+            while (c->remaining > 0) {
+                sim_dma_xfer(c);
+            }
+        } else {
+            sim_dma_xfer(c);
+            c->paced++;
+        }
+        if (c->remaining == 0) {
+            sim_dma_complete(i);
+        }
+    }
+    sim_dma_pump();
+}
+
+static void sim_dma_trigger(uint channel)
+{
+    sim_dma_chan_t *c = &chans[channel];
+
+    sim_dma_init();
+    if (!c->cfg.enable) {
+        return;
+    }
+    if (c->cfg.dreq < DREQ_DMA_TIMER0 && dreqs[c->cfg.dreq].ready == NULL) {
+        sim_fatal("DMA channel %u paced by DREQ %u, which has no model", channel, c->cfg.dreq);
+    }
+
+    c->remaining = c->trans_count;
+    c->start_ns = sim_now();
+    c->paced = 0;
+    c->busy = true;
+    if (c->remaining == 0) {
+        sim_dma_complete(channel);
+        return;
+    }
+    sim_dma_pump();
+}
+
+/**
+ * @brief One transfer: read, optional byte swap, write, advance addresses
+ */
+static void sim_dma_xfer(sim_dma_chan_t *c)
+{
+    uint size = 1u << c->cfg.size;
+    uint32_t value = 0;
+    sim_mmio_write_t write;
+    sim_mmio_read_t read;
+    void *ctx;
+
+    if (sim_mmio_find((const volatile void *)c->read_addr, &write, &read, &ctx) != NULL && read != NULL) {
+        value = read(ctx);
+    } else {
+        memcpy(&value, (const void *)c->read_addr, size);
+    }
+
+    if (c->cfg.bswap && size == 2) {
+        value = ((value & 0xFF) << 8) | ((value >> 8) & 0xFF);
+    } else if (c->cfg.bswap && size == 4) {
+        value = __builtin_bswap32(value);
+    }
+
+    if (sim_mmio_find((const volatile void *)c->write_addr, &write, &read, &ctx) != NULL && write != NULL) {
+        write(value, size, ctx);
+    } else {
+        memcpy((void *)c->write_addr, &value, size);
+    }
+
+    if (c->cfg.read_increment) {
+        c->read_addr += size;
+    }
+    if (c->cfg.write_increment) {
+        c->write_addr += size;
+    }
+    c->remaining--;
+    c->transfers++;
+    if (!c->cfg.read_increment) {
+        fill_transfers++;
+    }
+}
+
+static void sim_dma_complete(uint channel)
+{
+    sim_dma_chan_t *c = &chans[channel];
+
+    c->busy = false;
+    if (!c->cfg.irq_quiet) {
+        c->intr = true;
+    }
+    if (c->cfg.chain_to != channel) {
+        sim_dma_trigger(c->cfg.chain_to);
+    }
+}
+
+static bool sim_dma_irq0_level(void)
+{
+    for (uint i = 0; i < NUM_DMA_CHANNELS; i++) {
+        if (chans[i].intr && chans[i].inte[0]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool sim_dma_irq1_level(void)
+{
+    for (uint i = 0; i < NUM_DMA_CHANNELS; i++) {
+        if (chans[i].intr && chans[i].inte[1]) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,461 @@
+/**
+ * @file sim_i2c.c
+ * @brief Host Simulation: I2C controller (DW_apb_i2c master)
+ * @note 16-entry command FIFO executed at the programmed rate: START/RESTART + address (10 bit
+ *       times), 9 per data byte, 1 for STOP. The addressed device model is called as each byte
+ *       completes. A NAK aborts like the hardware: TX_ABRT, FIFO flushed (and further pushes
+ *       dropped) until the abort is acknowledged, then STOP. An empty FIFO without STOP keeps the
+ *       bus, a device holding SCL (sim_i2c_hold) or pins taken off GPIO_FUNC_I2C stall it.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "sim.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/gpio.h"
+#include "hardware/clocks.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SIM_I2C_FIFO_DEPTH  16
+#define SIM_I2C_DEVICES     4
+#define SIM_I2C_LATCHED     (I2C_IC_INTR_STAT_R_STOP_DET_BITS | I2C_IC_INTR_STAT_R_TX_ABRT_BITS)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    SIM_I2C_IDLE,
+    SIM_I2C_ADDR,               // START / RESTART and address byte
+    SIM_I2C_DATA,
+    SIM_I2C_STOP,
+} sim_i2c_phase_t;
+
+typedef struct {
+    uint8_t addr;
+    const sim_i2c_device_t *ops;
+    void *ctx;
+} sim_i2c_target_t;
+
+typedef struct {
+    uint index;
+    i2c_hw_t *hw;
+    uint64_t bit_ns;
+    uint16_t tx[SIM_I2C_FIFO_DEPTH];
+    uint tx_head;
+    uint tx_count;
+    uint8_t rx[SIM_I2C_FIFO_DEPTH];
+    uint rx_head;
+    uint rx_count;
+    sim_i2c_phase_t phase;
+    uint64_t done_ns;
+    uint16_t cmd;               // Command being executed
+    bool active;                // Between START and STOP
+    bool reading;
+    bool stalled;               // Phase held by the device or disconnected pins
+    bool hold;                  // Device holds SCL low
+    bool abort;                 // TX_ABRT latched: FIFO flushed, pushes dropped
+    uint32_t raw;               // Latched STOP_DET / TX_ABRT
+    sim_i2c_target_t *target;
+    sim_i2c_target_t targets[SIM_I2C_DEVICES];
+    uint target_count;
+    bool registered;
+} sim_i2c_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint64_t sim_i2c_next(void);
+static void sim_i2c_service(void);
+static void sim_i2c_step(sim_i2c_t *s);
+static void sim_i2c_kick(sim_i2c_t *s);
+static void sim_i2c_abort(sim_i2c_t *s, uint32_t source);
+static bool sim_i2c_cpu_xfer(sim_i2c_t *s, uint32_t cmd);
+static void sim_i2c_sync(sim_i2c_t *s);
+static bool sim_i2c_connected(const sim_i2c_t *s);
+static void sim_i2c_data_write(uint32_t value, uint size, void *ctx);
+static uint32_t sim_i2c_data_read(void *ctx);
+static bool sim_i2c_tx_ready(void *ctx);
+static bool sim_i2c_rx_ready(void *ctx);
+static bool sim_i2c0_level(void);
+static bool sim_i2c1_level(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static sim_i2c_t i2cs[2] = { { .index = 0, .hw = &sim_i2c_hw[0] }, { .index = 1, .hw = &sim_i2c_hw[1] } };
+static sim_model_t i2c_model = { "i2c", sim_i2c_next, sim_i2c_service, NULL };
+static bool model_added = false;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+i2c_hw_t sim_i2c_hw[2];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void sim_i2c_attach(uint index, uint8_t addr, const sim_i2c_device_t *dev, void *ctx)
+{
+    sim_i2c_t *s = &i2cs[index];
+
+    if (s->target_count >= SIM_I2C_DEVICES) {
+        sim_fatal("too many devices on I2C%u", index);
+    }
+    s->targets[s->target_count++] = (sim_i2c_target_t){ addr, dev, ctx };
+}
+
+/**
+ * @brief Device holds (clock stretching, hung) or releases SCL
+ */
+void sim_i2c_hold(uint index, bool hold)
+{
+    sim_i2c_t *s = &i2cs[index];
+
+    s->hold = hold;
+    if (!hold && s->stalled) {
+        s->stalled = false;
+        s->done_ns = sim_now() + s->bit_ns;
+    }
+}
+
+/**
+ * @brief Reset the controller: FIFOs, bus state and latched interrupts, DMA handshake on
+ * @note A transaction cut off here ends for the device as with a STOP (the recovery sequence
+ *       before a re-init issues one)
+ */
+uint i2c_init(i2c_inst_t *i2c, uint baudrate)
+{
+    sim_i2c_t *s = &i2cs[i2c_hw_index(i2c)];
+    i2c_hw_t *hw = s->hw;
+
+    if (!model_added) {
+        model_added = true;
+        sim_add_model(&i2c_model);
+    }
+    if (!s->registered) {
+        s->registered = true;
+        sim_mmio_register(&hw->data_cmd, sim_i2c_data_write, sim_i2c_data_read, s);
+        sim_dreq_register(i2c_get_dreq(i2c, true), sim_i2c_tx_ready, s);
+        sim_dreq_register(i2c_get_dreq(i2c, false), sim_i2c_rx_ready, s);
+        sim_irq_set_level_fn(s->index ? I2C1_IRQ : I2C0_IRQ, s->index ? sim_i2c1_level : sim_i2c0_level);
+    }
+    if (s->active && s->target != NULL) {
+        s->target->ops->stop(s->target->ctx);
+    }
+
+    s->tx_head = s->tx_count = 0;
+    s->rx_head = s->rx_count = 0;
+    s->phase = SIM_I2C_IDLE;
+    s->active = false;
+    s->stalled = false;
+    s->abort = false;
+    s->raw = 0;
+    s->target = NULL;
+    hw->tar = 0x055;
+    hw->intr_mask = 0x8FF;
+    hw->rx_tl = 0;
+    hw->tx_tl = 0;
+    hw->tx_abrt_source = 0;
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS | I2C_IC_DMA_CR_RDMAE_BITS;
+    hw->dma_tdlr = 0;
+    hw->dma_rdlr = 0;
+    hw->enable = 1;
+
+    // Same SCL period rounding as the SDK
+    uint freq_in = clock_get_hz(clk_sys);
+    uint period = (freq_in + baudrate / 2) / baudrate;
+    uint baud = freq_in / period;
+    s->bit_ns = 1000000000u / baud;
+    sim_i2c_sync(s);
+    return baud;
+}
+
+void i2c_deinit(i2c_inst_t *i2c)
+{
+    i2c_get_hw(i2c)->enable = 0;
+}
+
+/**
+ * @brief SDK blocking write: one DATA_CMD push per byte, each waited out on the bus
+ * @return len, PICO_ERROR_GENERIC on a NAK
+ */
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop)
+{
+    sim_i2c_t *s = &i2cs[i2c_hw_index(i2c)];
+
+    s->hw->tar = addr;
+    for (size_t i = 0; i < len; i++) {
+        uint32_t cmd = src[i];
+        if (i + 1 == len && !nostop) {
+            cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+        }
+        if (!sim_i2c_cpu_xfer(s, cmd)) {
+            return PICO_ERROR_GENERIC;
+        }
+    }
+    return (int)len;
+}
+
+/**
+ * @brief SDK blocking read: one read command per byte, restarted from a preceding nostop write
+ * @return len, PICO_ERROR_GENERIC on a NAK
+ */
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop)
+{
+    sim_i2c_t *s = &i2cs[i2c_hw_index(i2c)];
+
+    s->hw->tar = addr;
+    for (size_t i = 0; i < len; i++) {
+        uint32_t cmd = I2C_IC_DATA_CMD_CMD_BITS;
+        if (i + 1 == len && !nostop) {
+            cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+        }
+        if (!sim_i2c_cpu_xfer(s, cmd)) {
+            return PICO_ERROR_GENERIC;
+        }
+        dst[i] = (uint8_t)sim_i2c_data_read(s);
+    }
+    return (int)len;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint64_t sim_i2c_next(void)
+{
+    uint64_t next = SIM_NEVER;
+    for (uint i = 0; i < 2; i++) {
+        if (i2cs[i].phase != SIM_I2C_IDLE && !i2cs[i].stalled && i2cs[i].done_ns < next) {
+            next = i2cs[i].done_ns;
+        }
+    }
+    return next;
+}
+
+static void sim_i2c_service(void)
+{
+    for (uint i = 0; i < 2; i++) {
+        sim_i2c_t *s = &i2cs[i];
+        if (s->phase == SIM_I2C_IDLE || s->stalled || s->done_ns > sim_now()) {
+            continue;
+        }
+        if (s->hold || !sim_i2c_connected(s)) {
+            s->stalled = true;
+            continue;
+        }
+        sim_i2c_step(s);
+        sim_i2c_sync(s);
+    }
+    sim_dma_pump();
+}
+
+/**
+ * @brief End of the current phase: hand the byte to the device, then the next phase
+ */
+static void sim_i2c_step(sim_i2c_t *s)
+{
+    switch (s->phase) {
+    case SIM_I2C_ADDR:
+        s->target = NULL;
+        for (uint i = 0; i < s->target_count; i++) {
+            if (s->targets[i].addr == (s->hw->tar & 0x7F)) {
+                s->target = &s->targets[i];
+            }
+        }
+        if (s->target == NULL || !s->target->ops->start(s->target->ctx, s->reading)) {
+            sim_i2c_abort(s, I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS);
+            return;
+        }
+        s->active = true;
+        s->phase = SIM_I2C_DATA;
+        s->done_ns = sim_now() + 9 * s->bit_ns;
+        return;
+
+    case SIM_I2C_DATA:
+        if (s->reading) {
+            if (s->rx_count >= SIM_I2C_FIFO_DEPTH) {
+                sim_fatal("I2C%u RX FIFO overflow", s->index);
+            }
+            s->rx[(s->rx_head + s->rx_count) % SIM_I2C_FIFO_DEPTH] = s->target->ops->read(s->target->ctx);
+            s->rx_count++;
+        } else if (!s->target->ops->write(s->target->ctx, s->cmd & I2C_IC_DATA_CMD_DAT_BITS)) {
+            sim_i2c_abort(s, I2C_IC_TX_ABRT_SOURCE_ABRT_TXDATA_NOACK_BITS);
+            return;
+        }
+        if (s->cmd & I2C_IC_DATA_CMD_STOP_BITS) {
+            s->phase = SIM_I2C_STOP;
+            s->done_ns = sim_now() + s->bit_ns;
+            return;
+        }
+        s->phase = SIM_I2C_IDLE;
+        sim_i2c_kick(s);
+        return;
+
+    case SIM_I2C_STOP:
+        if (s->active && s->target != NULL) {
+            s->target->ops->stop(s->target->ctx);
+        }
+        s->active = false;
+        s->raw |= I2C_IC_INTR_STAT_R_STOP_DET_BITS;
+        s->phase = SIM_I2C_IDLE;
+        sim_i2c_kick(s);
+        return;
+
+    default:
+        return;
+    }
+}
+
+/**
+ * @brief Start the next command if the bus is free for it
+ */
+static void sim_i2c_kick(sim_i2c_t *s)
+{
+    if (s->phase != SIM_I2C_IDLE || s->abort || s->tx_count == 0) {
+        return;
+    }
+    s->cmd = s->tx[s->tx_head];
+    s->tx_head = (s->tx_head + 1) % SIM_I2C_FIFO_DEPTH;
+    s->tx_count--;
+
+    bool reading = (s->cmd & I2C_IC_DATA_CMD_CMD_BITS) != 0;
+    if (!s->active || reading != s->reading || (s->cmd & I2C_IC_DATA_CMD_RESTART_BITS)) {
+        s->reading = reading;
+        s->phase = SIM_I2C_ADDR;
+        s->done_ns = sim_now() + 10 * s->bit_ns;
+    } else {
+        s->phase = SIM_I2C_DATA;
+        s->done_ns = sim_now() + 9 * s->bit_ns;
+    }
+}
+
+/**
+ * @brief NAK: flush, latch TX_ABRT, then STOP
+ */
+static void sim_i2c_abort(sim_i2c_t *s, uint32_t source)
+{
+    s->tx_head = s->tx_count = 0;
+    s->abort = true;
+    s->raw |= I2C_IC_INTR_STAT_R_TX_ABRT_BITS;
+    s->hw->tx_abrt_source = source;
+    s->phase = SIM_I2C_STOP;
+    s->done_ns = sim_now() + s->bit_ns;
+}
+
+/**
+ * @brief CPU push of one command, spinning until it (and its STOP) is done on the bus
+ * @return false on a NAK, after the STOP that follows it
+ */
+static bool sim_i2c_cpu_xfer(sim_i2c_t *s, uint32_t cmd)
+{
+    sim_i2c_data_write(cmd, 4, s);
+    while (s->tx_count > 0 || s->phase != SIM_I2C_IDLE) {
+        sim_wait();
+    }
+    bool ok = !(s->raw & I2C_IC_INTR_STAT_R_TX_ABRT_BITS);
+    s->raw &= ~SIM_I2C_LATCHED;
+    sim_i2c_sync(s);
+    return ok;
+}
+
+/**
+ * @brief Drop latched bits the handler has masked (it read their clear registers first), then
+ *        mirror the state into the register block
+ */
+static void sim_i2c_sync(sim_i2c_t *s)
+{
+    i2c_hw_t *hw = s->hw;
+
+    s->raw &= hw->intr_mask | ~SIM_I2C_LATCHED;
+    if (!(s->raw & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) && s->abort) {
+        s->abort = false;
+        hw->tx_abrt_source = 0;
+        sim_i2c_kick(s);
+    }
+    hw->raw_intr_stat = s->raw;
+    hw->intr_stat = s->raw & hw->intr_mask;
+    hw->txflr = s->tx_count;
+    hw->rxflr = s->rx_count;
+    hw->status = (s->active || s->phase != SIM_I2C_IDLE) ? I2C_IC_STATUS_ACTIVITY_BITS : 0;
+}
+
+/**
+ * @brief SDA and SCL of this instance on I2C function pins (SDA = 4n + 2i, SCL = SDA + 1)
+ */
+static bool sim_i2c_connected(const sim_i2c_t *s)
+{
+    bool sda = false;
+    bool scl = false;
+
+    for (uint pin = 0; pin < NUM_BANK0_GPIOS; pin++) {
+        if (sim_gpio_function(pin) == GPIO_FUNC_I2C && ((pin >> 1) & 1) == s->index) {
+            sda |= (pin & 1) == 0;
+            scl |= (pin & 1) == 1;
+        }
+    }
+    return sda && scl;
+}
+
+static void sim_i2c_data_write(uint32_t value, uint size, void *ctx)
+{
+    sim_i2c_t *s = (sim_i2c_t *)ctx;
+    (void)size;
+
+    sim_i2c_sync(s);
+    if (s->abort) {
+        return;
+    }
+    if (s->tx_count >= SIM_I2C_FIFO_DEPTH) {
+        sim_fatal("I2C%u TX FIFO overflow", s->index);
+    }
+    s->tx[(s->tx_head + s->tx_count) % SIM_I2C_FIFO_DEPTH] = (uint16_t)value;
+    s->tx_count++;
+    sim_i2c_kick(s);
+    sim_i2c_sync(s);
+}
+
+static uint32_t sim_i2c_data_read(void *ctx)
+{
+    sim_i2c_t *s = (sim_i2c_t *)ctx;
+    uint8_t byte = 0;
+
+    if (s->rx_count > 0) {
+        byte = s->rx[s->rx_head];
+        s->rx_head = (s->rx_head + 1) % SIM_I2C_FIFO_DEPTH;
+        s->rx_count--;
+    }
+    sim_i2c_sync(s);
+    return byte;
+}
+
+static bool sim_i2c_tx_ready(void *ctx)
+{
+    sim_i2c_t *s = (sim_i2c_t *)ctx;
+    return (s->hw->dma_cr & I2C_IC_DMA_CR_TDMAE_BITS) && (s->hw->enable & 1) && s->tx_count < SIM_I2C_FIFO_DEPTH;
+}
+
+static bool sim_i2c_rx_ready(void *ctx)
+{
+    sim_i2c_t *s = (sim_i2c_t *)ctx;
+    return (s->hw->dma_cr & I2C_IC_DMA_CR_RDMAE_BITS) && s->rx_count > 0;
+}
+
+static bool sim_i2c0_level(void)
+{
+    sim_i2c_sync(&i2cs[0]);
+    return i2cs[0].hw->intr_stat != 0;
+}
+
+static bool sim_i2c1_level(void)
+{
+    sim_i2c_sync(&i2cs[1]);
+    return i2cs[1].hw->intr_stat != 0;
+}
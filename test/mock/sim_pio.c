@@ -0,0 +1,1046 @@
+/**
+ * @file sim_pio.c
+ * @brief Host Simulation: PIO blocks (instruction-level emulator)
+ * @note Two blocks of four state machines with 32 instruction slots each. Every state machine runs
+ *       one instruction per divided clock cycle: side-set, delay, wrap, autopull/autopush, joined
+ *       FIFOs, IRQ flags and the FIFO interrupt sources behave as on the RP2040.
+ *       A stalled state machine sleeps until something it waits for changes (FIFO, pin, IRQ flag),
+ *       a program looping without effect (polling unchanged pins) sleeps the same way, so idle
+ *       programs cost no simulation time.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "sim.h"
+#include "hardware/pio.h"
+#include "hardware/irq.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define FIFO_MAX        8
+
+#define WAKE_TX         0x01u   // TX FIFO written
+#define WAKE_RX         0x02u   // RX FIFO read
+#define WAKE_GPIO       0x04u   // One of wake_pins changed
+#define WAKE_IRQ        0x08u   // IRQ flags changed
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t buf[FIFO_MAX];
+    uint head;
+    uint count;
+} sim_fifo_t;
+
+typedef struct {
+    pio_sm_config cfg;
+    bool claimed;
+    bool enabled;
+    uint8_t pc;
+    uint32_t x, y, isr, osr;
+    uint isr_count;
+    uint osr_count;
+    sim_fifo_t tx;
+    sim_fifo_t rx;
+    uint64_t tick_q8;           // Next cycle (ns, 8 fractional bits)
+    bool irq_wait;              // "irq wait" has set its flag, waiting for the clear
+    uint32_t sleep_on;          // WAKE_* reasons, 0 = running
+    uint32_t wake_pins;
+    uint32_t read_pins;         // Pins read since the last wrap
+    uint64_t effects;           // Outputs / FIFO / IRQ changes made
+    bool snap_valid;
+    uint32_t snap[10];
+    uint64_t snap_effects;
+    uint64_t cycles;
+} sim_sm_t;
+
+typedef struct {
+    uint16_t instr[PIO_INSTRUCTION_COUNT];
+    uint32_t used;
+    sim_sm_t sm[NUM_PIO_STATE_MACHINES];
+    uint32_t pins;
+    uint32_t pindirs;
+    uint8_t irq_flags;
+    uint32_t inte[2];
+} sim_pio_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void sim_pio_init(void);
+static uint64_t sim_pio_next(void);
+static void sim_pio_service(void);
+static void sim_pio_cycle(uint pio, uint sm);
+static uint64_t sim_pio_period_q8(const sim_sm_t *s);
+static void sim_pio_wake(uint pio, uint sm, uint32_t reason);
+static void sim_pio_sleep(sim_sm_t *s, uint32_t reason);
+static void sim_pio_gpio_changed(uint pin, bool level);
+static uint sim_pio_tx_depth(const sim_sm_t *s);
+static uint sim_pio_rx_depth(const sim_sm_t *s);
+static void sim_fifo_push(sim_fifo_t *f, uint32_t v);
+static uint32_t sim_fifo_pop(sim_fifo_t *f);
+static uint32_t sim_pio_read_pins(sim_pio_t *p, sim_sm_t *s, uint base, uint count);
+static void sim_pio_write_pins(uint pio, uint base, uint count, uint32_t value, bool dirs);
+static bool sim_pio_oe(uint pio, uint pin);
+static bool sim_pio_out(uint pio, uint pin);
+static void sim_pio_txf_write(uint32_t value, uint size, void *ctx);
+static uint32_t sim_pio_rxf_read(void *ctx);
+static bool sim_pio_tx_ready(void *ctx);
+static bool sim_pio_rx_ready(void *ctx);
+static uint32_t sim_pio_intr(uint pio);
+static bool sim_pio0_irq0_level(void);
+static bool sim_pio0_irq1_level(void);
+static bool sim_pio1_irq0_level(void);
+static bool sim_pio1_irq1_level(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static sim_pio_t pios[NUM_PIOS];
+static sim_model_t pio_model = { "pio", sim_pio_next, sim_pio_service, NULL };
+static bool initialized = false;
+static bool fifo_changed = false;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+pio_hw_t sim_pio_hw[NUM_PIOS];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+pio_sm_config pio_get_default_sm_config(void)
+{
+    return (pio_sm_config){
+        .clkdiv_q8 = 256,
+        .wrap_target = 0,
+        .wrap = PIO_INSTRUCTION_COUNT - 1,
+        .out_shift_right = true,
+        .pull_threshold = 32,
+        .in_shift_right = true,
+        .push_threshold = 32,
+        .out_count = 32,
+        .fifo_join = PIO_FIFO_JOIN_NONE,
+    };
+}
+
+void sm_config_set_wrap(pio_sm_config *c, uint wrap_target, uint wrap)
+{
+    c->wrap_target = wrap_target;
+    c->wrap = wrap;
+}
+
+void sm_config_set_sideset(pio_sm_config *c, uint bit_count, bool optional, bool pindirs)
+{
+    c->sideset_count = bit_count;
+    c->sideset_optional = optional;
+    c->sideset_pindirs = pindirs;
+}
+
+void sm_config_set_sideset_pins(pio_sm_config *c, uint sideset_base)
+{
+    c->sideset_base = sideset_base;
+}
+
+void sm_config_set_out_pins(pio_sm_config *c, uint out_base, uint out_count)
+{
+    c->out_base = out_base;
+    c->out_count = out_count;
+}
+
+void sm_config_set_set_pins(pio_sm_config *c, uint set_base, uint set_count)
+{
+    c->set_base = set_base;
+    c->set_count = set_count;
+}
+
+void sm_config_set_in_pins(pio_sm_config *c, uint in_base)
+{
+    c->in_base = in_base;
+}
+
+void sm_config_set_jmp_pin(pio_sm_config *c, uint pin)
+{
+    c->jmp_pin = pin;
+}
+
+void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull, uint pull_threshold)
+{
+    c->out_shift_right = shift_right;
+    c->autopull = autopull;
+    c->pull_threshold = pull_threshold ? pull_threshold : 32;
+}
+
+void sm_config_set_in_shift(pio_sm_config *c, bool shift_right, bool autopush, uint push_threshold)
+{
+    c->in_shift_right = shift_right;
+    c->autopush = autopush;
+    c->push_threshold = push_threshold ? push_threshold : 32;
+}
+
+void sm_config_set_fifo_join(pio_sm_config *c, enum pio_fifo_join join)
+{
+    c->fifo_join = join;
+}
+
+void sm_config_set_clkdiv(pio_sm_config *c, float div)
+{
+    uint16_t div_int = (uint16_t)div;
+    uint8_t div_frac = (uint8_t)((div - (float)div_int) * 256.0f);
+    sm_config_set_clkdiv_int_frac(c, div_int, div_frac);
+}
+
+void sm_config_set_clkdiv_int_frac(pio_sm_config *c, uint16_t div_int, uint8_t div_frac)
+{
+    // Integer part 0 means 65536
+    c->clkdiv_q8 = ((div_int ? (uint32_t)div_int : 65536u) << 8) | div_frac;
+}
+
+void sm_config_set_mov_status(pio_sm_config *c, enum pio_mov_status_type status_sel, uint status_n)
+{
+    c->status_sel = status_sel;
+    c->status_n = status_n;
+}
+
+/**
+ * @brief Load a program at the highest free offset (as the SDK does), JMP targets relocated
+ */
+uint pio_add_program(PIO pio, const struct pio_program *program)
+{
+    sim_pio_t *p = &pios[pio_get_index(pio)];
+    uint32_t mask = (program->length >= 32) ? 0xFFFFFFFFu : ((1u << program->length) - 1);
+    int offset = -1;
+
+    sim_pio_init();
+    if (program->origin >= 0) {
+        if (!(p->used & (mask << program->origin))) {
+            offset = program->origin;
+        }
+    } else {
+        for (int i = PIO_INSTRUCTION_COUNT - program->length; i >= 0; i--) {
+            if (!(p->used & (mask << i))) {
+                offset = i;
+                break;
+            }
+        }
+    }
+    if (offset < 0) {
+        sim_fatal("no space for a %u instruction PIO program", program->length);
+    }
+
+    for (uint i = 0; i < program->length; i++) {
+        uint16_t ins = program->instructions[i];
+        if ((ins >> 13) == 0) {
+            ins = (uint16_t)((ins & ~0x1Fu) | (((ins & 0x1Fu) + (uint)offset) & 0x1Fu));
+        }
+        p->instr[offset + i] = ins;
+    }
+    p->used |= mask << offset;
+    return (uint)offset;
+}
+
+void pio_remove_program(PIO pio, const struct pio_program *program, uint loaded_offset)
+{
+    uint32_t mask = (program->length >= 32) ? 0xFFFFFFFFu : ((1u << program->length) - 1);
+    pios[pio_get_index(pio)].used &= ~(mask << loaded_offset);
+}
+
+int pio_claim_unused_sm(PIO pio, bool required)
+{
+    sim_pio_t *p = &pios[pio_get_index(pio)];
+
+    sim_pio_init();
+    for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+        if (!p->sm[i].claimed) {
+            p->sm[i].claimed = true;
+            return (int)i;
+        }
+    }
+    if (required) {
+        sim_fatal("no free state machine on PIO%u", pio_get_index(pio));
+    }
+    return -1;
+}
+
+void pio_sm_claim(PIO pio, uint sm)
+{
+    sim_pio_init();
+    pios[pio_get_index(pio)].sm[sm].claimed = true;
+}
+
+void pio_gpio_init(PIO pio, uint pin)
+{
+    gpio_set_function(pin, (enum gpio_function)(GPIO_FUNC_PIO0 + pio_get_index(pio)));
+}
+
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config)
+{
+    sim_sm_t *s = &pios[pio_get_index(pio)].sm[sm];
+
+    sim_pio_init();
+    s->enabled = false;
+    if (config != NULL) {
+        s->cfg = *config;
+    }
+    pio_sm_clear_fifos(pio, sm);
+    pio_sm_restart(pio, sm);
+    s->pc = (uint8_t)initial_pc;
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled)
+{
+    sim_sm_t *s = &pios[pio_get_index(pio)].sm[sm];
+
+    if (enabled && !s->enabled) {
+        s->tick_q8 = sim_now() << 8;
+        s->sleep_on = 0;
+    }
+    s->enabled = enabled;
+}
+
+void pio_sm_set_pins_with_mask(PIO pio, uint sm, uint32_t pin_values, uint32_t pin_mask)
+{
+    (void)sm;
+    for (uint i = 0; i < 32; i++) {
+        if (pin_mask & (1u << i)) {
+            sim_pio_write_pins(pio_get_index(pio), i, 1, pin_values >> i, false);
+        }
+    }
+}
+
+void pio_sm_set_pindirs_with_mask(PIO pio, uint sm, uint32_t pin_dirs, uint32_t pin_mask)
+{
+    (void)sm;
+    for (uint i = 0; i < 32; i++) {
+        if (pin_mask & (1u << i)) {
+            sim_pio_write_pins(pio_get_index(pio), i, 1, pin_dirs >> i, true);
+        }
+    }
+}
+
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out)
+{
+    (void)sm;
+    sim_pio_write_pins(pio_get_index(pio), pin_base, pin_count, is_out ? 0xFFFFFFFFu : 0, true);
+}
+
+void pio_sm_clear_fifos(PIO pio, uint sm)
+{
+    sim_sm_t *s = &pios[pio_get_index(pio)].sm[sm];
+    s->tx.count = 0;
+    s->rx.count = 0;
+    fifo_changed = true;
+}
+
+void pio_sm_restart(PIO pio, uint sm)
+{
+    sim_sm_t *s = &pios[pio_get_index(pio)].sm[sm];
+    s->isr_count = 0;
+    s->osr_count = 32;      // OSR starts empty
+    s->isr = 0;
+    s->osr = 0;
+    s->irq_wait = false;
+    s->sleep_on = 0;
+    s->snap_valid = false;
+}
+
+void pio_sm_put(PIO pio, uint sm, uint32_t data)
+{
+    sim_pio_txf_write(data, 4, &pios[pio_get_index(pio)].sm[sm]);
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data)
+{
+    while (pio_sm_is_tx_fifo_full(pio, sm)) {
+        sim_wait();
+    }
+    pio_sm_put(pio, sm, data);
+}
+
+uint32_t pio_sm_get(PIO pio, uint sm)
+{
+    return sim_pio_rxf_read(&pios[pio_get_index(pio)].sm[sm]);
+}
+
+uint32_t pio_sm_get_blocking(PIO pio, uint sm)
+{
+    while (pio_sm_is_rx_fifo_empty(pio, sm)) {
+        sim_wait();
+    }
+    return pio_sm_get(pio, sm);
+}
+
+bool pio_sm_is_tx_fifo_empty(PIO pio, uint sm)
+{
+    return pios[pio_get_index(pio)].sm[sm].tx.count == 0;
+}
+
+bool pio_sm_is_tx_fifo_full(PIO pio, uint sm)
+{
+    const sim_sm_t *s = &pios[pio_get_index(pio)].sm[sm];
+    return s->tx.count >= sim_pio_tx_depth(s);
+}
+
+bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm)
+{
+    return pios[pio_get_index(pio)].sm[sm].rx.count == 0;
+}
+
+bool pio_sm_is_rx_fifo_full(PIO pio, uint sm)
+{
+    const sim_sm_t *s = &pios[pio_get_index(pio)].sm[sm];
+    return s->rx.count >= sim_pio_rx_depth(s);
+}
+
+uint pio_sm_get_tx_fifo_level(PIO pio, uint sm)
+{
+    return pios[pio_get_index(pio)].sm[sm].tx.count;
+}
+
+uint pio_sm_get_rx_fifo_level(PIO pio, uint sm)
+{
+    return pios[pio_get_index(pio)].sm[sm].rx.count;
+}
+
+uint8_t pio_sm_get_pc(PIO pio, uint sm)
+{
+    return pios[pio_get_index(pio)].sm[sm].pc;
+}
+
+void pio_set_irqn_source_enabled(PIO pio, uint irq_index, pio_interrupt_source_t source, bool enabled)
+{
+    sim_pio_t *p = &pios[pio_get_index(pio)];
+    if (enabled) {
+        p->inte[irq_index] |= 1u << source;
+    } else {
+        p->inte[irq_index] &= ~(1u << source);
+    }
+    sim_irq_dispatch();
+}
+
+void pio_set_irq0_source_enabled(PIO pio, pio_interrupt_source_t source, bool enabled)
+{
+    pio_set_irqn_source_enabled(pio, 0, source, enabled);
+}
+
+void pio_set_irq1_source_enabled(PIO pio, pio_interrupt_source_t source, bool enabled)
+{
+    pio_set_irqn_source_enabled(pio, 1, source, enabled);
+}
+
+bool pio_interrupt_get(PIO pio, uint pio_interrupt_num)
+{
+    return pios[pio_get_index(pio)].irq_flags & (1u << pio_interrupt_num);
+}
+
+void pio_interrupt_clear(PIO pio, uint pio_interrupt_num)
+{
+    uint idx = pio_get_index(pio);
+    pios[idx].irq_flags &= (uint8_t)~(1u << pio_interrupt_num);
+    for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+        sim_pio_wake(idx, i, WAKE_IRQ);
+    }
+}
+
+uint64_t sim_pio_get_cycles(PIO pio, uint sm)
+{
+    return pios[pio_get_index(pio)].sm[sm].cycles;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void sim_pio_init(void)
+{
+    if (initialized) {
+        return;
+    }
+    initialized = true;
+
+    sim_add_model(&pio_model);
+    sim_gpio_set_pio_source(sim_pio_oe, sim_pio_out);
+    sim_gpio_set_change_fn(sim_pio_gpio_changed);
+    for (uint p = 0; p < NUM_PIOS; p++) {
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+            sim_sm_t *s = &pios[p].sm[i];
+            sim_mmio_register(&sim_pio_hw[p].txf[i], sim_pio_txf_write, NULL, s);
+            sim_mmio_register(&sim_pio_hw[p].rxf[i], NULL, sim_pio_rxf_read, s);
+            sim_dreq_register(pio_get_dreq(&sim_pio_hw[p], i, true), sim_pio_tx_ready, s);
+            sim_dreq_register(pio_get_dreq(&sim_pio_hw[p], i, false), sim_pio_rx_ready, s);
+            s->cfg = pio_get_default_sm_config();
+            s->osr_count = 32;
+        }
+    }
+    sim_irq_set_level_fn(PIO0_IRQ_0, sim_pio0_irq0_level);
+    sim_irq_set_level_fn(PIO0_IRQ_1, sim_pio0_irq1_level);
+    sim_irq_set_level_fn(PIO1_IRQ_0, sim_pio1_irq0_level);
+    sim_irq_set_level_fn(PIO1_IRQ_1, sim_pio1_irq1_level);
+}
+
+static uint64_t sim_pio_period_q8(const sim_sm_t *s)
+{
+    return (uint64_t)s->cfg.clkdiv_q8 * SIM_CYCLE_NS;
+}
+
+static uint64_t sim_pio_next(void)
+{
+    uint64_t next = SIM_NEVER;
+    for (uint p = 0; p < NUM_PIOS; p++) {
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+            const sim_sm_t *s = &pios[p].sm[i];
+            if (s->enabled && s->sleep_on == 0) {
+                uint64_t t = (s->tick_q8 + 255) >> 8;
+                if (t < next) {
+                    next = t;
+                }
+            }
+        }
+    }
+    return next;
+}
+
+static void sim_pio_service(void)
+{
+    uint64_t now_q8 = sim_now() << 8;
+
+    for (uint p = 0; p < NUM_PIOS; p++) {
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+            sim_sm_t *s = &pios[p].sm[i];
+            if (s->enabled && s->sleep_on == 0 && s->tick_q8 <= now_q8) {
+                sim_pio_cycle(p, i);
+            }
+        }
+    }
+    if (fifo_changed) {
+        fifo_changed = false;
+        sim_dma_pump();
+    }
+}
+
+static uint sim_pio_tx_depth(const sim_sm_t *s)
+{
+    return s->cfg.fifo_join == PIO_FIFO_JOIN_TX ? 8 : (s->cfg.fifo_join == PIO_FIFO_JOIN_RX ? 0 : 4);
+}
+
+static uint sim_pio_rx_depth(const sim_sm_t *s)
+{
+    return s->cfg.fifo_join == PIO_FIFO_JOIN_RX ? 8 : (s->cfg.fifo_join == PIO_FIFO_JOIN_TX ? 0 : 4);
+}
+
+static void sim_fifo_push(sim_fifo_t *f, uint32_t v)
+{
+    f->buf[(f->head + f->count) % FIFO_MAX] = v;
+    f->count++;
+    fifo_changed = true;
+}
+
+static uint32_t sim_fifo_pop(sim_fifo_t *f)
+{
+    uint32_t v = f->buf[f->head];
+    f->head = (f->head + 1) % FIFO_MAX;
+    f->count--;
+    fifo_changed = true;
+    return v;
+}
+
+static void sim_pio_sleep(sim_sm_t *s, uint32_t reason)
+{
+    s->sleep_on = reason;
+}
+
+/**
+ * @brief Resume a sleeping state machine on the first cycle at or after now
+ */
+static void sim_pio_wake(uint pio, uint sm, uint32_t reason)
+{
+    sim_sm_t *s = &pios[pio].sm[sm];
+
+    if (!(s->sleep_on & reason)) {
+        return;
+    }
+    s->sleep_on = 0;
+    s->snap_valid = false;
+
+    uint64_t now_q8 = sim_now() << 8;
+    if (s->tick_q8 < now_q8) {
+        uint64_t period = sim_pio_period_q8(s);
+        s->tick_q8 += (now_q8 - s->tick_q8 + period - 1) / period * period;
+    }
+}
+
+static void sim_pio_gpio_changed(uint pin, bool level)
+{
+    (void)level;
+    for (uint p = 0; p < NUM_PIOS; p++) {
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+            if (pios[p].sm[i].wake_pins & (1u << pin)) {
+                sim_pio_wake(p, i, WAKE_GPIO);
+            }
+        }
+    }
+}
+
+static uint32_t sim_pio_read_pins(sim_pio_t *p, sim_sm_t *s, uint base, uint count)
+{
+    (void)p;
+    uint32_t v = 0;
+    for (uint i = 0; i < count; i++) {
+        uint pin = (base + i) % 32;
+        s->read_pins |= 1u << pin;
+        if (pin < NUM_BANK0_GPIOS && sim_gpio_level(pin)) {
+            v |= 1u << i;
+        }
+    }
+    return v;
+}
+
+static void sim_pio_write_pins(uint pio, uint base, uint count, uint32_t value, bool dirs)
+{
+    sim_pio_t *p = &pios[pio];
+    uint32_t *reg = dirs ? &p->pindirs : &p->pins;
+
+    for (uint i = 0; i < count && i < 32; i++) {
+        uint pin = (base + i) % 32;
+        uint32_t bit = 1u << pin;
+        uint32_t old = *reg;
+        *reg = ((value >> i) & 1) ? (old | bit) : (old & ~bit);
+        if (*reg != old && pin < NUM_BANK0_GPIOS) {
+            for (uint j = 0; j < NUM_PIO_STATE_MACHINES; j++) {
+                p->sm[j].effects++;
+            }
+            sim_gpio_update(pin);
+        }
+    }
+}
+
+static bool sim_pio_oe(uint pio, uint pin)
+{
+    return pios[pio].pindirs & (1u << pin);
+}
+
+static bool sim_pio_out(uint pio, uint pin)
+{
+    return pios[pio].pins & (1u << pin);
+}
+
+/**
+ * @brief Map an IRQ index field (with the REL bit) to a flag number
+ */
+static uint sim_pio_irq_flag(uint index, uint sm)
+{
+    if (index & 0x10) {
+        return (index & 4) | ((index + sm) & 3);
+    }
+    return index & 7;
+}
+
+static void sim_pio_set_flags(uint pio, uint8_t flags)
+{
+    sim_pio_t *p = &pios[pio];
+    if (p->irq_flags == flags) {
+        return;
+    }
+    p->irq_flags = flags;
+    for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+        p->sm[i].effects++;
+        sim_pio_wake(pio, i, WAKE_IRQ);
+    }
+}
+
+/**
+ * @brief Execute one clock cycle of a state machine
+ */
+static void sim_pio_cycle(uint pio, uint sm)
+{
+    sim_pio_t *p = &pios[pio];
+    sim_sm_t *s = &p->sm[sm];
+    const pio_sm_config *c = &s->cfg;
+    uint16_t ins = p->instr[s->pc];
+    uint field = (ins >> 8) & 0x1F;
+    uint delay_bits = 5 - c->sideset_count;
+    uint delay = field & ((1u << delay_bits) - 1);
+    bool stall = false;
+    bool jumped = false;
+    uint32_t stall_reason = 0;
+    uint n = ins & 0x1F;
+    uint bits = n ? n : 32;
+    uint32_t mask = (bits == 32) ? 0xFFFFFFFFu : ((1u << bits) - 1);
+
+    s->cycles++;
+
+    switch (ins >> 13) {
+        case 0: {   // JMP
+            bool take = false;
+            switch ((ins >> 5) & 7) {
+                case 0: take = true; break;
+                case 1: take = (s->x == 0); break;
+                case 2: take = (s->x != 0); s->x--; break;
+                case 3: take = (s->y == 0); break;
+                case 4: take = (s->y != 0); s->y--; break;
+                case 5: take = (s->x != s->y); break;
+                case 6: take = sim_pio_read_pins(p, s, c->jmp_pin, 1) != 0; break;
+                case 7: take = (s->osr_count < c->pull_threshold); break;
+            }
+            if (take) {
+                s->pc = (uint8_t)(ins & 0x1F);
+                jumped = true;
+            }
+            break;
+        }
+        case 1: {   // WAIT
+            bool polarity = (ins >> 7) & 1;
+            bool level;
+            switch ((ins >> 5) & 3) {
+                case 0:
+                    level = sim_pio_read_pins(p, s, n, 1) != 0;
+                    s->wake_pins = 1u << n;
+                    stall_reason = WAKE_GPIO;
+                    break;
+                case 1:
+                    level = sim_pio_read_pins(p, s, c->in_base + n, 1) != 0;
+                    s->wake_pins = 1u << ((c->in_base + n) % 32);
+                    stall_reason = WAKE_GPIO;
+                    break;
+                default: {
+                    uint flag = sim_pio_irq_flag(n, sm);
+                    level = (p->irq_flags >> flag) & 1;
+                    if (level && polarity) {
+                        sim_pio_set_flags(pio, (uint8_t)(p->irq_flags & ~(1u << flag)));
+                    }
+                    stall_reason = WAKE_IRQ;
+                    break;
+                }
+            }
+            stall = (level != polarity);
+            break;
+        }
+        case 2: {   // IN
+            if (c->autopush && s->isr_count + bits >= c->push_threshold &&
+                s->rx.count >= sim_pio_rx_depth(s)) {
+                stall = true;
+                stall_reason = WAKE_RX;
+                break;
+            }
+            uint32_t data;
+            switch ((ins >> 5) & 7) {
+                case 0: data = sim_pio_read_pins(p, s, c->in_base, bits); break;
+                case 1: data = s->x; break;
+                case 2: data = s->y; break;
+                case 6: data = s->isr; break;
+                case 7: data = s->osr; break;
+                default: data = 0; break;
+            }
+            data &= mask;
+            if (bits == 32) {
+                s->isr = data;
+            } else if (c->in_shift_right) {
+                s->isr = (s->isr >> bits) | (data << (32 - bits));
+            } else {
+                s->isr = (s->isr << bits) | data;
+            }
+            s->isr_count = (s->isr_count + bits > 32) ? 32 : s->isr_count + bits;
+            if (c->autopush && s->isr_count >= c->push_threshold) {
+                sim_fifo_push(&s->rx, s->isr);
+                s->isr = 0;
+                s->isr_count = 0;
+                s->effects++;
+            }
+            break;
+        }
+        case 3: {   // OUT
+            if (c->autopull && s->osr_count >= c->pull_threshold) {
+                if (s->tx.count == 0) {
+                    stall = true;
+                    stall_reason = WAKE_TX;
+                    break;
+                }
+                s->osr = sim_fifo_pop(&s->tx);
+                s->osr_count = 0;
+                s->effects++;
+            }
+            uint32_t data;
+            if (bits == 32) {
+                data = s->osr;
+                s->osr = 0;
+            } else if (c->out_shift_right) {
+                data = s->osr & mask;
+                s->osr >>= bits;
+            } else {
+                data = s->osr >> (32 - bits);
+                s->osr <<= bits;
+            }
+            s->osr_count = (s->osr_count + bits > 32) ? 32 : s->osr_count + bits;
+            switch ((ins >> 5) & 7) {
+                case 0: sim_pio_write_pins(pio, c->out_base, bits < c->out_count ? bits : c->out_count, data, false); break;
+                case 1: s->x = data; break;
+                case 2: s->y = data; break;
+                case 4: sim_pio_write_pins(pio, c->out_base, bits < c->out_count ? bits : c->out_count, data, true); break;
+                case 5: s->pc = (uint8_t)(data & 0x1F); jumped = true; break;
+                case 6: s->isr = data; s->isr_count = bits; break;
+                case 7: sim_fatal("PIO OUT EXEC is not modelled");
+                default: break;
+            }
+            // Autopull refills in the background once the OSR is used up
+            if (c->autopull && s->osr_count >= c->pull_threshold && s->tx.count > 0) {
+                s->osr = sim_fifo_pop(&s->tx);
+                s->osr_count = 0;
+                s->effects++;
+            }
+            break;
+        }
+        case 4: {   // PUSH / PULL
+            bool cond = (ins >> 6) & 1;
+            bool block = (ins >> 5) & 1;
+            if (ins & 0x80) {
+                if (cond && s->osr_count < c->pull_threshold) {
+                    break;
+                }
+                if (s->tx.count == 0) {
+                    if (block) {
+                        stall = true;
+                        stall_reason = WAKE_TX;
+                    } else {
+                        s->osr = s->x;
+                        s->osr_count = 0;
+                    }
+                    break;
+                }
+                s->osr = sim_fifo_pop(&s->tx);
+                s->osr_count = 0;
+                s->effects++;
+            } else {
+                if (cond && s->isr_count < c->push_threshold) {
+                    break;
+                }
+                if (s->rx.count >= sim_pio_rx_depth(s)) {
+                    if (block) {
+                        stall = true;
+                        stall_reason = WAKE_RX;
+                        break;
+                    }
+                } else {
+                    sim_fifo_push(&s->rx, s->isr);
+                    s->effects++;
+                }
+                s->isr = 0;
+                s->isr_count = 0;
+            }
+            break;
+        }
+        case 5: {   // MOV
+            uint32_t v;
+            switch (ins & 7) {
+                case 0: v = sim_pio_read_pins(p, s, c->in_base, 32); break;
+                case 1: v = s->x; break;
+                case 2: v = s->y; break;
+                case 5:
+                    if (c->status_sel == STATUS_TX_LESSTHAN) {
+                        v = (s->tx.count < c->status_n) ? 0xFFFFFFFFu : 0;
+                    } else {
+                        v = (s->rx.count < c->status_n) ? 0xFFFFFFFFu : 0;
+                    }
+                    break;
+                case 6: v = s->isr; break;
+                case 7: v = s->osr; break;
+                default: v = 0; break;
+            }
+            switch ((ins >> 3) & 3) {
+                case 1: v = ~v; break;
+                case 2: {
+                    uint32_t r = 0;
+                    for (uint i = 0; i < 32; i++) {
+                        r |= ((v >> i) & 1) << (31 - i);
+                    }
+                    v = r;
+                    break;
+                }
+                default: break;
+            }
+            switch ((ins >> 5) & 7) {
+                case 0: sim_pio_write_pins(pio, c->out_base, c->out_count, v, false); break;
+                case 1: s->x = v; break;
+                case 2: s->y = v; break;
+                case 4: sim_fatal("PIO MOV EXEC is not modelled");
+                case 5: s->pc = (uint8_t)(v & 0x1F); jumped = true; break;
+                case 6: s->isr = v; s->isr_count = 0; break;
+                case 7: s->osr = v; s->osr_count = 0; break;
+                default: break;
+            }
+            break;
+        }
+        case 6: {   // IRQ
+            uint flag = sim_pio_irq_flag(n, sm);
+            if (ins & 0x40) {
+                sim_pio_set_flags(pio, (uint8_t)(p->irq_flags & ~(1u << flag)));
+            } else if (ins & 0x20) {
+                if (!s->irq_wait) {
+                    sim_pio_set_flags(pio, (uint8_t)(p->irq_flags | (1u << flag)));
+                    s->irq_wait = true;
+                }
+                if (p->irq_flags & (1u << flag)) {
+                    stall = true;
+                    stall_reason = WAKE_IRQ;
+                } else {
+                    s->irq_wait = false;
+                }
+            } else {
+                sim_pio_set_flags(pio, (uint8_t)(p->irq_flags | (1u << flag)));
+            }
+            break;
+        }
+        case 7: {   // SET
+            switch ((ins >> 5) & 7) {
+                case 0: sim_pio_write_pins(pio, c->set_base, c->set_count, n, false); break;
+                case 1: s->x = n; break;
+                case 2: s->y = n; break;
+                case 4: sim_pio_write_pins(pio, c->set_base, c->set_count, n, true); break;
+                default: break;
+            }
+            break;
+        }
+    }
+
+    // Side-set is applied even while the instruction stalls
+    if (c->sideset_count > 0) {
+        uint ss = field >> delay_bits;
+        uint ss_bits = c->sideset_count;
+        bool enabled = true;
+        if (c->sideset_optional) {
+            enabled = (ss >> (ss_bits - 1)) & 1;
+            ss_bits--;
+            ss &= (1u << ss_bits) - 1;
+        }
+        if (enabled && ss_bits > 0) {
+            sim_pio_write_pins(pio, c->sideset_base, ss_bits, ss, c->sideset_pindirs);
+        }
+    }
+
+    uint64_t period = sim_pio_period_q8(s);
+    if (stall) {
+        s->tick_q8 += period;
+        sim_pio_sleep(s, stall_reason);
+        return;
+    }
+    s->tick_q8 += period * (1 + delay);
+
+    if (jumped) {
+        return;
+    }
+    if (s->pc != c->wrap) {
+        s->pc = (s->pc + 1) & 0x1F;
+        return;
+    }
+    s->pc = (uint8_t)c->wrap_target;
+
+    // A pass through the loop that changed nothing will repeat until an input changes
+    uint32_t snap[10] = { s->x, s->y, s->isr, s->isr_count, s->osr, s->osr_count,
+                          s->tx.count, s->rx.count, p->irq_flags, s->pc };
+    if (s->snap_valid && s->snap_effects == s->effects && memcmp(snap, s->snap, sizeof(snap)) == 0) {
+        s->wake_pins = s->read_pins;
+        sim_pio_sleep(s, WAKE_GPIO | WAKE_TX | WAKE_RX | WAKE_IRQ);
+    }
+    memcpy(s->snap, snap, sizeof(snap));
+    s->snap_valid = true;
+    s->snap_effects = s->effects;
+    s->read_pins = 0;
+}
+
+static void sim_pio_txf_write(uint32_t value, uint size, void *ctx)
+{
+    sim_sm_t *s = ctx;
+
+    // Narrow bus writes are replicated across the byte lanes
+    if (size == 1) {
+        value = (value & 0xFF) * 0x01010101u;
+    } else if (size == 2) {
+        value = (value & 0xFFFF) * 0x00010001u;
+    }
+    if (s->tx.count >= sim_pio_tx_depth(s)) {
+        return;     // Dropped, as the hardware does (TXOVER)
+    }
+    sim_fifo_push(&s->tx, value);
+
+    for (uint p = 0; p < NUM_PIOS; p++) {
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+            if (&pios[p].sm[i] == s) {
+                sim_pio_wake(p, i, WAKE_TX);
+            }
+        }
+    }
+    sim_irq_dispatch();
+}
+
+static uint32_t sim_pio_rxf_read(void *ctx)
+{
+    sim_sm_t *s = ctx;
+
+    if (s->rx.count == 0) {
+        return 0;
+    }
+    uint32_t v = sim_fifo_pop(&s->rx);
+    for (uint p = 0; p < NUM_PIOS; p++) {
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+            if (&pios[p].sm[i] == s) {
+                sim_pio_wake(p, i, WAKE_RX);
+            }
+        }
+    }
+    return v;
+}
+
+static bool sim_pio_tx_ready(void *ctx)
+{
+    const sim_sm_t *s = ctx;
+    return s->tx.count < sim_pio_tx_depth(s);
+}
+
+static bool sim_pio_rx_ready(void *ctx)
+{
+    const sim_sm_t *s = ctx;
+    return s->rx.count > 0;
+}
+
+static uint32_t sim_pio_intr(uint pio)
+{
+    const sim_pio_t *p = &pios[pio];
+    uint32_t intr = (uint32_t)(p->irq_flags & 0x0F) << 8;
+
+    for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+        const sim_sm_t *s = &p->sm[i];
+        if (s->rx.count > 0) {
+            intr |= 1u << i;
+        }
+        if (s->tx.count < sim_pio_tx_depth(s)) {
+            intr |= 1u << (4 + i);
+        }
+    }
+    return intr;
+}
+
+static bool sim_pio0_irq0_level(void)
+{
+    return (sim_pio_intr(0) & pios[0].inte[0]) != 0;
+}
+
+static bool sim_pio0_irq1_level(void)
+{
+    return (sim_pio_intr(0) & pios[0].inte[1]) != 0;
+}
+
+static bool sim_pio1_irq0_level(void)
+{
+    return (sim_pio_intr(1) & pios[1].inte[0]) != 0;
+}
+
+static bool sim_pio1_irq1_level(void)
+{
+    return (sim_pio_intr(1) & pios[1].inte[1]) != 0;
+}
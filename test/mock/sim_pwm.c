@@ -0,0 +1,129 @@
+/**
+ * @file sim_pwm.c
+ * @brief Host Simulation: PWM (compare levels)
+ * @note The CC registers are DMA targets: a write of size 2 is replicated into both channels, as
+ *       the bus does for narrow writes to APB registers. Each write, by DMA or through the API,
+ *       goes to the sink with the slice and the new register value, at sim_now().
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "sim.h"
+#include "hardware/pwm.h"
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void sim_pwm_set_cc(uint slice, uint32_t cc);
+static void sim_pwm_cc_write(uint32_t value, uint size, void *ctx);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static bool registered = false;
+static sim_pwm_sink_t sink = NULL;
+static void *sink_ctx = NULL;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+pwm_hw_t sim_pwm_hw;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void sim_pwm_set_sink(sim_pwm_sink_t fn, void *ctx)
+{
+    sink = fn;
+    sink_ctx = ctx;
+}
+
+pwm_config pwm_get_default_config(void)
+{
+    return (pwm_config){ .csr = 0, .div = 1u << 4, .top = 0xFFFF };
+}
+
+void pwm_config_set_clkdiv(pwm_config *c, float div)
+{
+    c->div = (uint32_t)(div * 16.0f);
+}
+
+void pwm_config_set_wrap(pwm_config *c, uint16_t wrap)
+{
+    c->top = wrap;
+}
+
+void pwm_init(uint slice_num, pwm_config *c, bool start)
+{
+    if (slice_num >= NUM_PWM_SLICES) {
+        sim_fatal("PWM slice %u", slice_num);
+    }
+    if (!registered) {
+        registered = true;
+        for (uintptr_t i = 0; i < NUM_PWM_SLICES; i++) {
+            sim_mmio_register(&pwm_hw->slice[i].cc, sim_pwm_cc_write, NULL, (void *)i);
+        }
+    }
+    pwm_hw->slice[slice_num].csr = c->csr;
+    pwm_hw->slice[slice_num].div = c->div;
+    pwm_hw->slice[slice_num].top = c->top;
+    pwm_hw->slice[slice_num].ctr = 0;
+    sim_pwm_set_cc(slice_num, 0);
+    pwm_set_enabled(slice_num, start);
+}
+
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level)
+{
+    uint32_t cc = pwm_hw->slice[slice_num].cc;
+
+    if (chan == PWM_CHAN_B) {
+        cc = (cc & 0x0000FFFFu) | ((uint32_t)level << 16);
+    } else {
+        cc = (cc & 0xFFFF0000u) | level;
+    }
+    sim_pwm_set_cc(slice_num, cc);
+}
+
+void pwm_set_gpio_level(uint gpio, uint16_t level)
+{
+    pwm_set_chan_level(pwm_gpio_to_slice_num(gpio), pwm_gpio_to_channel(gpio), level);
+}
+
+void pwm_set_enabled(uint slice_num, bool enabled)
+{
+    if (enabled) {
+        pwm_hw->slice[slice_num].csr |= 1u;
+        pwm_hw->en |= 1u << slice_num;
+    } else {
+        pwm_hw->slice[slice_num].csr &= ~1u;
+        pwm_hw->en &= ~(1u << slice_num);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void sim_pwm_set_cc(uint slice, uint32_t cc)
+{
+    pwm_hw->slice[slice].cc = cc;
+    if (sink != NULL) {
+        sink(slice, cc, sink_ctx);
+    }
+}
+
+static void sim_pwm_cc_write(uint32_t value, uint size, void *ctx)
+{
+    uint slice = (uint)(uintptr_t)ctx;
+
+    if (size == 1) {
+        value = (value & 0xFFu) * 0x01010101u;
+    } else if (size == 2) {
+        value = (value & 0xFFFFu) * 0x00010001u;
+    }
+    sim_pwm_set_cc(slice, value);
+}
@@ -0,0 +1,711 @@
+/**
+ * @file sim_rtos.c
+ * @brief FreeRTOS SMP model: coroutine tasks on two simulated cores
+ * @note The test's main() runs the scheduler with sim_rtos_run_until(). Each core runs its highest
+ *       priority ready task (round-robin between equals every tick). Task code runs in zero
+ *       simulated time until it blocks or busy-waits; a busy wait occupies its core while the
+ *       peripheral models and interrupts go on. Interrupt handlers wake tasks, the scheduler
+ *       switches as soon as the handler returns to it.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "sim.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "timers.h"
+#include <stdlib.h>
+#include <ucontext.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define RTOS_MAX_TASKS      16
+#define RTOS_MAX_SEMS       32
+#define RTOS_MAX_TIMERS     16
+#define RTOS_STACK_BYTES    (256 * 1024)
+#define RTOS_CORES          configNUM_CORES
+#define RTOS_TICK_NS        (1000000000ull / configTICK_RATE_HZ)
+#define RTOS_LIVELOCK       1000000u    // Task switches at one instant before giving up
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    TASK_READY,
+    TASK_BLOCKED,
+    TASK_DELETED,
+} task_state_t;
+
+struct tskTaskControlBlock {
+    const char *name;
+    TaskFunction_t fn;
+    void *param;
+    UBaseType_t prio;
+    UBaseType_t affinity;
+    task_state_t state;
+    ucontext_t ctx;
+    void *stack;
+    uint64_t cpu_ns;            // Busy-wait time still to run
+    uint64_t wake_ns;           // Timeout of the current block, SIM_NEVER if none
+    const void *wait_obj;       // Object blocked on
+    bool timed_out;
+    uint32_t notify;
+    uint64_t seq;               // Order within a priority (round-robin)
+    int core;                   // Core it last ran on
+};
+
+struct sim_rtos_sem {
+    bool mutex;
+    UBaseType_t count;
+    UBaseType_t max;
+    TaskHandle_t holder;
+};
+
+struct sim_rtos_timer {
+    const char *name;
+    TickType_t period;
+    bool reload;
+    void *id;
+    TimerCallbackFunction_t cb;
+    bool active;
+    uint64_t expiry_ns;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void rtos_start(void);
+static void rtos_entry(int index);
+static void rtos_assign(void);
+static void rtos_timeouts(void);
+static void rtos_switch(TaskHandle_t task, uint core);
+static void rtos_yield(void);
+static bool rtos_block(const void *obj, TickType_t ticks);
+static void rtos_wake(TaskHandle_t task);
+static bool rtos_wake_waiter(const void *obj);
+static bool rtos_notify(TaskHandle_t task);
+static void rtos_preempt(void);
+static void rtos_cpu(uint64_t ns);
+static bool rtos_in_task(void);
+static uint rtos_core(void);
+static void rtos_timer_task(void *param);
+static void rtos_timer_kick(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static struct tskTaskControlBlock tasks[RTOS_MAX_TASKS];
+static uint task_count = 0;
+static struct sim_rtos_sem sems[RTOS_MAX_SEMS];
+static uint sem_count = 0;
+static struct sim_rtos_timer timers[RTOS_MAX_TIMERS];
+static uint timer_count = 0;
+static TaskHandle_t timer_task = NULL;
+static const char timer_cmd = 0;            // Timer task waits on its address for commands
+
+static TaskHandle_t running[RTOS_CORES];    // Assigned by the last rtos_assign()
+static TaskHandle_t current = NULL;         // Task executing code, NULL in the scheduler
+static ucontext_t sched_ctx;
+static uint64_t seq_counter = 0;
+static uint64_t next_tick_ns = RTOS_TICK_NS;
+static uint64_t busy_ns[RTOS_CORES];
+static bool started = false;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+__attribute__((weak)) void vApplicationTickHook(void)
+{
+}
+
+/*---------------------
+ * Scheduler
+ *--------------------*/
+
+/**
+ * @brief Run tasks, interrupts and models until simulated time t_ns
+ * @note Returns with every task suspended where it was, the test may inspect state and continue
+ */
+void sim_rtos_run_until(uint64_t t_ns)
+{
+    uint32_t spins = 0;
+    uint64_t spin_ns = SIM_NEVER;
+
+    if (current != NULL) {
+        sim_fatal("sim_rtos_run_until() called from task %s", current->name);
+    }
+    rtos_start();
+
+    for (;;) {
+        rtos_timeouts();
+        rtos_assign();
+
+        // 1. Run task code due now, lowest core first
+        bool ran = false;
+        for (uint c = 0; c < RTOS_CORES && !ran; c++) {
+            if (running[c] != NULL && running[c]->cpu_ns == 0) {
+                if (sim_now() != spin_ns) {
+                    spin_ns = sim_now();
+                    spins = 0;
+                } else if (++spins > RTOS_LIVELOCK) {
+                    sim_fatal("task %s keeps running without blocking at t=%llu ns",
+                              running[c]->name, (unsigned long long)spin_ns);
+                }
+                rtos_switch(running[c], c);
+                ran = true;
+            }
+        }
+        if (ran) {
+            continue;
+        }
+        if (sim_now() >= t_ns) {
+            break;
+        }
+
+        // 2. Advance to whatever happens next: tick, timeout, end of a busy wait, model event
+        uint64_t now = sim_now();
+        uint64_t next = t_ns < next_tick_ns ? t_ns : next_tick_ns;
+        for (uint i = 0; i < task_count; i++) {
+            if (tasks[i].state == TASK_BLOCKED && tasks[i].wake_ns < next) {
+                next = tasks[i].wake_ns;
+            }
+        }
+        for (uint c = 0; c < RTOS_CORES; c++) {
+            if (running[c] != NULL && now + running[c]->cpu_ns < next) {
+                next = now + running[c]->cpu_ns;
+            }
+        }
+        uint64_t ev = sim_next_event();
+        if (ev < next) {
+            next = ev > now ? ev : now;
+        }
+        sim_run_until(next);
+
+        // 3. Charge the elapsed time to the busy-waiting tasks
+        uint64_t elapsed = sim_now() - now;
+        for (uint c = 0; c < RTOS_CORES; c++) {
+            if (running[c] != NULL) {
+                uint64_t d = running[c]->cpu_ns < elapsed ? running[c]->cpu_ns : elapsed;
+                running[c]->cpu_ns -= d;
+                busy_ns[c] += d;
+            }
+        }
+
+        // 4. Tick: hook, then equal priorities take turns
+        while (sim_now() >= next_tick_ns) {
+            next_tick_ns += RTOS_TICK_NS;
+            vApplicationTickHook();
+            for (uint c = 0; c < RTOS_CORES; c++) {
+                if (running[c] != NULL) {
+                    running[c]->seq = ++seq_counter;
+                }
+            }
+        }
+    }
+}
+
+void sim_rtos_run_for(uint64_t ns)
+{
+    sim_rtos_run_until(sim_now() + ns);
+}
+
+/**
+ * @brief Busy-wait time a core spent in tasks
+ */
+uint64_t sim_rtos_get_busy_ns(uint core)
+{
+    return busy_ns[core];
+}
+
+/*---------------------
+ * Tasks
+ *--------------------*/
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, configSTACK_DEPTH_TYPE stack_depth,
+                       void *param, UBaseType_t priority, TaskHandle_t *handle)
+{
+    (void)stack_depth;
+
+    if (task_count >= RTOS_MAX_TASKS) {
+        sim_fatal("too many tasks");
+    }
+    TaskHandle_t t = &tasks[task_count];
+    t->name = name;
+    t->fn = fn;
+    t->param = param;
+    t->prio = priority;
+    t->affinity = (1u << RTOS_CORES) - 1;
+    t->state = TASK_READY;
+    t->wake_ns = SIM_NEVER;
+    t->seq = ++seq_counter;
+    t->core = -1;
+    t->stack = malloc(RTOS_STACK_BYTES);
+    getcontext(&t->ctx);
+    t->ctx.uc_stack.ss_sp = t->stack;
+    t->ctx.uc_stack.ss_size = RTOS_STACK_BYTES;
+    t->ctx.uc_link = NULL;
+    makecontext(&t->ctx, (void (*)(void))rtos_entry, 1, (int)task_count);
+    task_count++;
+
+    if (handle != NULL) {
+        *handle = t;
+    }
+    rtos_preempt();
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == NULL) {
+        task = current;
+    }
+    task->state = TASK_DELETED;
+    if (task == current) {
+        rtos_yield();
+    }
+}
+
+void vTaskCoreAffinitySet(TaskHandle_t task, UBaseType_t mask)
+{
+    if (task == NULL) {
+        task = current;
+    }
+    task->affinity = mask;
+    rtos_preempt();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return current;
+}
+
+void vTaskStartScheduler(void)
+{
+    sim_rtos_run_until(SIM_NEVER);
+}
+
+BaseType_t xTaskGetSchedulerState(void)
+{
+    return started ? taskSCHEDULER_RUNNING : taskSCHEDULER_NOT_STARTED;
+}
+
+void vTaskYield(void)
+{
+    current->seq = ++seq_counter;
+    rtos_yield();
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    static const char delay_obj = 0;
+
+    if (ticks == 0) {
+        vTaskYield();
+        return;
+    }
+    rtos_block(&delay_obj, ticks);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(sim_now() / RTOS_TICK_NS);
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return xTaskGetTickCount();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+    TaskHandle_t self = current;
+
+    if (self->notify == 0) {
+        rtos_block(&self->notify, ticks);
+    }
+    uint32_t value = self->notify;
+    if (value != 0) {
+        self->notify = clear_on_exit ? 0 : value - 1;
+    }
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    if (rtos_notify(task)) {
+        rtos_preempt();
+    }
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken)
+{
+    if (rtos_notify(task) && woken != NULL) {
+        *woken = pdTRUE;
+    }
+}
+
+/*---------------------
+ * Semaphores
+ *--------------------*/
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial)
+{
+    if (sem_count >= RTOS_MAX_SEMS) {
+        sim_fatal("too many semaphores");
+    }
+    SemaphoreHandle_t s = &sems[sem_count++];
+    s->max = max;
+    s->count = initial;
+    return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return xSemaphoreCreateCounting(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t s = xSemaphoreCreateCounting(1, 1);
+    s->mutex = true;
+    return s;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    uint64_t deadline = (ticks == portMAX_DELAY) ? SIM_NEVER : (xTaskGetTickCount() + (uint64_t)ticks);
+
+    for (;;) {
+        if (sem->count > 0) {
+            sem->count--;
+            if (sem->mutex) {
+                sem->holder = current;
+            }
+            return pdTRUE;
+        }
+        uint64_t tick = xTaskGetTickCount();
+        if (tick >= deadline) {
+            return pdFALSE;
+        }
+        if (current == NULL) {
+            sim_fatal("xSemaphoreTake() would block outside a task");
+        }
+        TickType_t left = (deadline == SIM_NEVER) ? portMAX_DELAY : (TickType_t)(deadline - tick);
+        if (!rtos_block(sem, left)) {
+            return pdFALSE;
+        }
+    }
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    if ((sem->mutex && sem->holder != current) || sem->count >= sem->max) {
+        return pdFALSE;
+    }
+    sem->count++;
+    sem->holder = NULL;
+    if (rtos_wake_waiter(sem)) {
+        rtos_preempt();
+    }
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken)
+{
+    if (sem->count >= sem->max) {
+        return pdFALSE;
+    }
+    sem->count++;
+    if (rtos_wake_waiter(sem) && woken != NULL) {
+        *woken = pdTRUE;
+    }
+    return pdTRUE;
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem)
+{
+    return sem->count;
+}
+
+/*---------------------
+ * Software timers
+ *--------------------*/
+
+TimerHandle_t xTimerCreate(const char *name, TickType_t period, UBaseType_t auto_reload,
+                           void *id, TimerCallbackFunction_t callback)
+{
+    if (timer_count >= RTOS_MAX_TIMERS) {
+        sim_fatal("too many timers");
+    }
+    if (timer_task == NULL) {
+        xTaskCreate(rtos_timer_task, "Tmr Svc", configTIMER_TASK_STACK_DEPTH, NULL,
+                    configTIMER_TASK_PRIORITY, &timer_task);
+    }
+    TimerHandle_t t = &timers[timer_count++];
+    t->name = name;
+    t->period = period;
+    t->reload = auto_reload != pdFALSE;
+    t->id = id;
+    t->cb = callback;
+    return t;
+}
+
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t ticks)
+{
+    (void)ticks;
+    timer->active = true;
+    timer->expiry_ns = (xTaskGetTickCount() + (uint64_t)timer->period) * RTOS_TICK_NS;
+    rtos_timer_kick();
+    return pdPASS;
+}
+
+BaseType_t xTimerReset(TimerHandle_t timer, TickType_t ticks)
+{
+    return xTimerStart(timer, ticks);
+}
+
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t ticks)
+{
+    (void)ticks;
+    timer->active = false;
+    rtos_timer_kick();
+    return pdPASS;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t ticks)
+{
+    timer->period = period;
+    return xTimerStart(timer, ticks);
+}
+
+BaseType_t xTimerIsTimerActive(TimerHandle_t timer)
+{
+    return timer->active ? pdTRUE : pdFALSE;
+}
+
+void *pvTimerGetTimerID(TimerHandle_t timer)
+{
+    return timer->id;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void rtos_start(void)
+{
+    if (started) {
+        return;
+    }
+    started = true;
+    sim_rtos_cpu_hook = rtos_cpu;
+    sim_rtos_in_task_hook = rtos_in_task;
+    sim_rtos_core_hook = rtos_core;
+    next_tick_ns = (sim_now() / RTOS_TICK_NS + 1) * RTOS_TICK_NS;
+}
+
+/**
+ * @brief Task entry: FreeRTOS tasks never return, a returning one is deleted
+ */
+static void rtos_entry(int index)
+{
+    TaskHandle_t t = &tasks[index];
+    t->fn(t->param);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Pick the task each core runs: highest priority, then longest waiting
+ */
+static void rtos_assign(void)
+{
+    for (uint c = 0; c < RTOS_CORES; c++) {
+        running[c] = NULL;
+    }
+    for (uint c = 0; c < RTOS_CORES; c++) {
+        TaskHandle_t best = NULL;
+        for (uint i = 0; i < task_count; i++) {
+            TaskHandle_t t = &tasks[i];
+            if (t->state != TASK_READY || !(t->affinity & (1u << c))) {
+                continue;
+            }
+            bool taken = false;
+            for (uint o = 0; o < c; o++) {
+                taken |= running[o] == t;
+            }
+            if (!taken && (best == NULL || t->prio > best->prio ||
+                           (t->prio == best->prio && t->seq < best->seq))) {
+                best = t;
+            }
+        }
+        running[c] = best;
+    }
+}
+
+static void rtos_timeouts(void)
+{
+    for (uint i = 0; i < task_count; i++) {
+        TaskHandle_t t = &tasks[i];
+        if (t->state == TASK_BLOCKED && t->wake_ns <= sim_now()) {
+            rtos_wake(t);
+            t->timed_out = true;
+        }
+    }
+}
+
+static void rtos_switch(TaskHandle_t task, uint core)
+{
+    current = task;
+    task->core = (int)core;
+    swapcontext(&sched_ctx, &task->ctx);
+    current = NULL;
+}
+
+/**
+ * @brief Give control back to the scheduler, the task continues once it's picked again
+ */
+static void rtos_yield(void)
+{
+    TaskHandle_t self = current;
+    if (self == NULL) {
+        return;
+    }
+    swapcontext(&self->ctx, &sched_ctx);
+}
+
+/**
+ * @brief Block the calling task on obj for at most ticks
+ * @return false on timeout
+ */
+static bool rtos_block(const void *obj, TickType_t ticks)
+{
+    TaskHandle_t self = current;
+
+    if (self == NULL) {
+        sim_fatal("blocking call outside a task");
+    }
+    if (sim_irq_active() >= 0) {
+        sim_fatal("blocking call in interrupt %d", sim_irq_active());
+    }
+    if (ticks == 0) {
+        return false;
+    }
+    self->state = TASK_BLOCKED;
+    self->wait_obj = obj;
+    self->timed_out = false;
+    self->wake_ns = (ticks == portMAX_DELAY) ? SIM_NEVER :
+                    (xTaskGetTickCount() + (uint64_t)ticks) * RTOS_TICK_NS;
+    rtos_yield();
+    return !self->timed_out;
+}
+
+static void rtos_wake(TaskHandle_t task)
+{
+    task->state = TASK_READY;
+    task->wait_obj = NULL;
+    task->wake_ns = SIM_NEVER;
+    task->timed_out = false;
+    task->seq = ++seq_counter;
+}
+
+/**
+ * @brief Wake the highest priority task blocked on obj
+ */
+static bool rtos_wake_waiter(const void *obj)
+{
+    TaskHandle_t best = NULL;
+    for (uint i = 0; i < task_count; i++) {
+        TaskHandle_t t = &tasks[i];
+        if (t->state == TASK_BLOCKED && t->wait_obj == obj &&
+            (best == NULL || t->prio > best->prio || (t->prio == best->prio && t->seq < best->seq))) {
+            best = t;
+        }
+    }
+    if (best != NULL) {
+        rtos_wake(best);
+    }
+    return best != NULL;
+}
+
+static bool rtos_notify(TaskHandle_t task)
+{
+    task->notify++;
+    if (task->state == TASK_BLOCKED && task->wait_obj == &task->notify) {
+        rtos_wake(task);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Let the scheduler re-pick after a task woke another one
+ */
+static void rtos_preempt(void)
+{
+    if (current != NULL && sim_irq_active() < 0 && !sim_irq_masked()) {
+        rtos_yield();
+    }
+}
+
+static void rtos_cpu(uint64_t ns)
+{
+    current->cpu_ns += ns;
+    rtos_yield();
+}
+
+static bool rtos_in_task(void)
+{
+    return current != NULL;
+}
+
+static uint rtos_core(void)
+{
+    return (current != NULL && current->core >= 0) ? (uint)current->core : 0u;
+}
+
+/**
+ * @brief Timer service task: runs expired timer callbacks in expiry order
+ */
+static void rtos_timer_task(void *param)
+{
+    (void)param;
+
+    for (;;) {
+        TimerHandle_t next = NULL;
+        for (uint i = 0; i < timer_count; i++) {
+            if (timers[i].active && (next == NULL || timers[i].expiry_ns < next->expiry_ns)) {
+                next = &timers[i];
+            }
+        }
+
+        if (next != NULL && next->expiry_ns <= sim_now()) {
+            if (next->reload) {
+                next->expiry_ns += (uint64_t)next->period * RTOS_TICK_NS;
+            } else {
+                next->active = false;
+            }
+            next->cb(next);
+            continue;
+        }
+
+        TickType_t ticks = portMAX_DELAY;
+        if (next != NULL) {
+            ticks = (TickType_t)(next->expiry_ns / RTOS_TICK_NS - xTaskGetTickCount());
+        }
+        rtos_block(&timer_cmd, ticks);
+    }
+}
+
+static void rtos_timer_kick(void)
+{
+    if (current != timer_task && rtos_wake_waiter(&timer_cmd)) {
+        rtos_preempt();
+    }
+}
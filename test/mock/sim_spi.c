@@ -0,0 +1,251 @@
+/**
+ * @file sim_spi.c
+ * @brief Host Simulation: SPI controller (TX path)
+ * @note 8-entry TX FIFO feeding a shifter at the programmed baud rate. Each frame is handed to
+ *       the sink (the device model) when its last bit has been clocked out, so the sink sees
+ *       CS/DC as they are at that moment. The RX path is not modelled (always empty).
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "sim.h"
+#include "hardware/spi.h"
+#include "hardware/clocks.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SIM_SPI_FIFO_DEPTH  8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t value;
+    uint8_t bits;
+} sim_spi_frame_t;
+
+typedef struct {
+    uint index;
+    uint baud;
+    uint bits;
+    sim_spi_frame_t fifo[SIM_SPI_FIFO_DEPTH];
+    uint head;
+    uint count;
+    bool shifting;
+    sim_spi_frame_t shift;
+    uint64_t done_ns;
+    sim_spi_sink_t sink;
+    void *sink_ctx;
+    bool registered;
+} sim_spi_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint64_t sim_spi_next(void);
+static void sim_spi_service(void);
+static void sim_spi_push(sim_spi_t *s, uint32_t value);
+static void sim_spi_start(sim_spi_t *s);
+static void sim_spi_dr_write(uint32_t value, uint size, void *ctx);
+static bool sim_spi_tx_ready(void *ctx);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static sim_spi_t spis[2] = { { .index = 0, .bits = 8 }, { .index = 1, .bits = 8 } };
+static sim_model_t spi_model = { "spi", sim_spi_next, sim_spi_service, NULL };
+static bool model_added = false;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+spi_hw_t sim_spi_hw[2];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void sim_spi_set_sink(uint index, sim_spi_sink_t sink, void *ctx)
+{
+    spis[index].sink = sink;
+    spis[index].sink_ctx = ctx;
+}
+
+uint spi_init(spi_inst_t *spi, uint baudrate)
+{
+    sim_spi_t *s = &spis[spi_get_index(spi)];
+
+    if (!model_added) {
+        model_added = true;
+        sim_add_model(&spi_model);
+    }
+    if (!s->registered) {
+        s->registered = true;
+        sim_mmio_register(&spi_get_hw(spi)->dr, sim_spi_dr_write, NULL, s);
+        sim_dreq_register(spi_get_dreq(spi, true), sim_spi_tx_ready, s);
+    }
+    s->bits = 8;
+    return spi_set_baudrate(spi, baudrate);
+}
+
+void spi_deinit(spi_inst_t *spi)
+{
+    (void)spi;
+}
+
+/**
+ * @brief Same prescaler search as the SDK, so the achieved rate matches the hardware
+ */
+uint spi_set_baudrate(spi_inst_t *spi, uint baudrate)
+{
+    uint freq_in = clock_get_hz(clk_peri);
+    uint prescale, postdiv;
+
+    for (prescale = 2; prescale <= 254; prescale += 2) {
+        if (freq_in < (uint64_t)(prescale + 2) * 256 * baudrate) {
+            break;
+        }
+    }
+    for (postdiv = 256; postdiv > 1; --postdiv) {
+        if (freq_in / (prescale * (postdiv - 1)) > baudrate) {
+            break;
+        }
+    }
+
+    sim_spi_t *s = &spis[spi_get_index(spi)];
+    s->baud = freq_in / (prescale * postdiv);
+    return s->baud;
+}
+
+uint spi_get_baudrate(const spi_inst_t *spi)
+{
+    return spis[spi_get_index(spi)].baud;
+}
+
+void spi_set_format(spi_inst_t *spi, uint data_bits, spi_cpol_t cpol, spi_cpha_t cpha, spi_order_t order)
+{
+    (void)cpol;
+    (void)cpha;
+    (void)order;
+    spis[spi_get_index(spi)].bits = data_bits;
+}
+
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len)
+{
+    sim_spi_t *s = &spis[spi_get_index(spi)];
+
+    for (size_t i = 0; i < len; i++) {
+        while (s->count >= SIM_SPI_FIFO_DEPTH) {
+            sim_wait();
+        }
+        sim_spi_push(s, src[i]);
+    }
+    while (spi_is_busy(spi)) {
+        sim_wait();
+    }
+    return (int)len;
+}
+
+int spi_write16_blocking(spi_inst_t *spi, const uint16_t *src, size_t len)
+{
+    sim_spi_t *s = &spis[spi_get_index(spi)];
+
+    for (size_t i = 0; i < len; i++) {
+        while (s->count >= SIM_SPI_FIFO_DEPTH) {
+            sim_wait();
+        }
+        sim_spi_push(s, src[i]);
+    }
+    while (spi_is_busy(spi)) {
+        sim_wait();
+    }
+    return (int)len;
+}
+
+bool spi_is_writable(const spi_inst_t *spi)
+{
+    return spis[spi_get_index(spi)].count < SIM_SPI_FIFO_DEPTH;
+}
+
+bool spi_is_readable(const spi_inst_t *spi)
+{
+    (void)spi;
+    return false;
+}
+
+bool spi_is_busy(const spi_inst_t *spi)
+{
+    const sim_spi_t *s = &spis[spi_get_index(spi)];
+    return s->shifting || s->count > 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint64_t sim_spi_next(void)
+{
+    uint64_t next = SIM_NEVER;
+    for (uint i = 0; i < 2; i++) {
+        if (spis[i].shifting && spis[i].done_ns < next) {
+            next = spis[i].done_ns;
+        }
+    }
+    return next;
+}
+
+static void sim_spi_service(void)
+{
+    for (uint i = 0; i < 2; i++) {
+        sim_spi_t *s = &spis[i];
+        if (!s->shifting || s->done_ns > sim_now()) {
+            continue;
+        }
+        s->shifting = false;
+        if (s->sink != NULL) {
+            s->sink(s->shift.value, s->shift.bits, s->sink_ctx);
+        }
+        sim_spi_start(s);
+    }
+    sim_dma_pump();
+}
+
+static void sim_spi_push(sim_spi_t *s, uint32_t value)
+{
+    if (s->count >= SIM_SPI_FIFO_DEPTH) {
+        sim_fatal("SPI%u TX FIFO overflow", s->index);
+    }
+    uint32_t mask = (s->bits >= 32) ? 0xFFFFFFFFu : ((1u << s->bits) - 1);
+    s->fifo[(s->head + s->count) % SIM_SPI_FIFO_DEPTH] = (sim_spi_frame_t){ value & mask, (uint8_t)s->bits };
+    s->count++;
+    if (!s->shifting) {
+        sim_spi_start(s);
+    }
+}
+
+static void sim_spi_start(sim_spi_t *s)
+{
+    if (s->count == 0) {
+        return;
+    }
+    s->shift = s->fifo[s->head];
+    s->head = (s->head + 1) % SIM_SPI_FIFO_DEPTH;
+    s->count--;
+    s->shifting = true;
+    s->done_ns = sim_now() + (uint64_t)s->shift.bits * 1000000000u / s->baud;
+}
+
+static void sim_spi_dr_write(uint32_t value, uint size, void *ctx)
+{
+    (void)size;
+    sim_spi_push((sim_spi_t *)ctx, value);
+}
+
+static bool sim_spi_tx_ready(void *ctx)
+{
+    return ((sim_spi_t *)ctx)->count < SIM_SPI_FIFO_DEPTH;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file lv_draw_sw.h
+ * @brief Host mock of the LVGL v8.3 software renderer interface (model in lv_mock.c)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef LV_DRAW_SW_H
+#define LV_DRAW_SW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const lv_area_t *blend_area;    // Area of dst_buf to blend (absolute coordinates)
+    const lv_color_t *src_buf;      // Pixels of blend_area, NULL to fill with color
+    lv_color_t color;               // Fill color if src_buf is NULL
+    lv_opa_t *mask_buf;             // Per-pixel opacity of mask_area, NULL if none
+    lv_draw_mask_res_t mask_res;    // FULL_COVER: mask_buf can be ignored
+    const lv_area_t *mask_area;     // Area of mask_buf
+    lv_opa_t opa;
+    lv_blend_mode_t blend_mode;
+} lv_draw_sw_blend_dsc_t;
+
+typedef struct {
+    lv_draw_ctx_t base_draw;
+    /** Fill an area of the destination buffer with a color or blend a source buffer onto it */
+    void (*blend)(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc);
+} lv_draw_sw_ctx_t;
+
+typedef struct {
+    lv_draw_layer_ctx_t base_draw;
+    uint32_t buf_size_bytes;
+    uint32_t has_alpha : 1;
+} lv_draw_sw_layer_ctx_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_draw_sw_init_ctx(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx);
+void lv_draw_sw_deinit_ctx(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx);
+void lv_draw_sw_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc);
+void lv_draw_sw_blend_basic(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc);
+void lv_draw_sw_img_decoded(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+                            const lv_area_t *coords, const uint8_t *src_buf, lv_img_cf_t cf);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /* LV_DRAW_SW_H */
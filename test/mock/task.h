@@ -0,0 +1,37 @@
+/**
+ * @file task.h
+ * @brief Host mock of FreeRTOS task.h (model in sim_rtos.c)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef struct tskTaskControlBlock *TaskHandle_t;
+
+#define taskYIELD()             vTaskYield()
+
+#define taskSCHEDULER_SUSPENDED     ((BaseType_t)0)
+#define taskSCHEDULER_NOT_STARTED   ((BaseType_t)1)
+#define taskSCHEDULER_RUNNING       ((BaseType_t)2)
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, configSTACK_DEPTH_TYPE stack_depth,
+                       void *param, UBaseType_t priority, TaskHandle_t *handle);
+void vTaskDelete(TaskHandle_t task);
+void vTaskCoreAffinitySet(TaskHandle_t task, UBaseType_t mask);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+void vTaskStartScheduler(void);
+BaseType_t xTaskGetSchedulerState(void);
+void vTaskYield(void);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken);
+
+#endif /* INC_TASK_H */
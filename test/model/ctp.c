@@ -0,0 +1,277 @@
+/**
+ * @file ctp.c
+ * @brief Host Model: GT911 Capacitive Touch Panel (I2C register map)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "ctp.h"
+#include "sim.h"
+#include "hardware/i2c.h"
+#include <string.h>
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool ctp_start(void *ctx, bool read);
+static bool ctp_write(void *ctx, uint8_t byte);
+static uint8_t ctp_read(void *ctx);
+static void ctp_stop(void *ctx);
+static void ctp_scl_hook(uint pin, bool level, void *ctx);
+static uint64_t ctp_next(void);
+static void ctp_service(void);
+static bool ctp_int_rising(void);
+static void ctp_config_apply(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const sim_i2c_device_t ctp_dev = { ctp_start, ctp_write, ctp_read, ctp_stop };
+
+static uint8_t regs[0x10000];
+static uint16_t ptr = 0;
+static uint32_t ptr_bytes = 0;          // Pointer bytes received in this write
+static ctp_fault_t fault = CTP_FAULT_NONE;
+static bool hung = false;
+static uint32_t hang_clocks = 0;
+static ctp_stats_t stats;
+static bool config_write = false;       // This write started at the config block
+static bool config_fresh = false;       // This write set the fresh flag
+static uint8_t config_prev[GT911_CONFIG_LEN + 1];
+
+static sim_model_t ctp_model = { "ctp", ctp_next, ctp_service, NULL };
+static uint64_t pulse_end_ns = SIM_NEVER;
+static const gt911_touch_t *play_frames = NULL;
+static size_t play_count = 0;
+static size_t play_pos = 0;
+static uint64_t play_period_ns = 0;
+static uint64_t play_next_ns = SIM_NEVER;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void ctp_attach(void)
+{
+    sim_i2c_attach(i2c_hw_index(GT911_I2C_PORT), GT911_I2C_ADDR, &ctp_dev, NULL);
+    sim_gpio_add_hook(GT911_PIN_SCL, ctp_scl_hook, NULL);
+    sim_add_model(&ctp_model);
+}
+
+uint8_t *ctp_regs(void)
+{
+    return regs;
+}
+
+void ctp_load(const ctp_fixture_t *fixture, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        memcpy(&regs[fixture[i].reg], fixture[i].data, fixture[i].len);
+    }
+}
+
+void ctp_fault(ctp_fault_t f)
+{
+    fault = f;
+}
+
+/**
+ * @brief New touch frame now: status and points, INT pulse
+ */
+void ctp_report(const gt911_touch_t *frame)
+{
+    stats.frames++;
+    if (regs[GT911_REG_STATUS] & GT911_STATUS_BUF_READY) {
+        stats.frames_lost++;
+        return;
+    }
+
+    uint8_t *p = &regs[GT911_REG_TRACK_ID1];
+    for (uint8_t i = 0; i < frame->count; i++, p += GT911_POINT_SIZE) {
+        const gt911_point_t *pt = &frame->points[i];
+        p[0] = pt->id;
+        p[1] = pt->x & 0xFF;
+        p[2] = pt->x >> 8;
+        p[3] = pt->y & 0xFF;
+        p[4] = pt->y >> 8;
+        p[5] = pt->size & 0xFF;
+        p[6] = pt->size >> 8;
+        p[7] = 0;
+    }
+    regs[GT911_REG_STATUS] = GT911_STATUS_BUF_READY | frame->count;
+
+    // Idle level first (the other edge), then the pulse
+    bool rising = ctp_int_rising();
+    sim_gpio_drive(GT911_PIN_INT, !rising);
+    sim_gpio_drive(GT911_PIN_INT, rising);
+    pulse_end_ns = sim_now() + SIM_US(CTP_INT_PULSE_US);
+}
+
+/**
+ * @brief Report frames[0] now, then one every period_us (the GT911 report rate)
+ */
+void ctp_play(const gt911_touch_t *frames, size_t count, uint32_t period_us)
+{
+    play_frames = frames;
+    play_count = count;
+    play_pos = 0;
+    play_period_ns = SIM_US(period_us);
+    play_next_ns = sim_now();
+    ctp_service();
+}
+
+bool ctp_playing(void)
+{
+    return play_pos < play_count;
+}
+
+void ctp_get_stats(ctp_stats_t *s)
+{
+    *s = stats;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool ctp_start(void *ctx, bool read)
+{
+    (void)ctx;
+
+    if (fault == CTP_FAULT_NAK_ADDR) {
+        fault = CTP_FAULT_NONE;
+        stats.naks++;
+        return false;
+    }
+    if (read) {
+        stats.reads++;
+    } else {
+        stats.writes++;
+        ptr_bytes = 0;
+        config_write = false;
+        config_fresh = false;
+    }
+    return true;
+}
+
+static bool ctp_write(void *ctx, uint8_t byte)
+{
+    (void)ctx;
+
+    if (fault == CTP_FAULT_NAK_DATA) {
+        fault = CTP_FAULT_NONE;
+        stats.naks++;
+        return false;
+    }
+    if (ptr_bytes < 2) {
+        ptr = (uint16_t)((ptr << 8) | byte);
+        ptr_bytes++;
+        return true;
+    }
+    if (ptr == GT911_REG_STATUS && byte == 0) {
+        stats.status_clears++;
+    }
+    if (ptr == GT911_REG_CONFIG_VERSION && !config_write) {
+        memcpy(config_prev, &regs[GT911_REG_CONFIG_VERSION], sizeof(config_prev));
+        config_write = true;
+    }
+    if (ptr == GT911_REG_CONFIG_FRESH && byte == 1) {
+        config_fresh = true;
+    }
+    regs[ptr++] = byte;
+    return true;
+}
+
+static uint8_t ctp_read(void *ctx)
+{
+    (void)ctx;
+
+    if (fault == CTP_FAULT_HANG) {
+        fault = CTP_FAULT_NONE;
+        stats.hangs++;
+        hung = true;
+        hang_clocks = 0;
+        sim_i2c_hold(i2c_hw_index(GT911_I2C_PORT), true);
+        sim_gpio_drive(GT911_PIN_SDA, 0);
+    }
+    stats.bytes_read++;
+    return regs[ptr++];
+}
+
+static void ctp_stop(void *ctx)
+{
+    (void)ctx;
+
+    if (config_fresh) {
+        ctp_config_apply();
+        config_fresh = false;
+    }
+}
+
+/**
+ * @brief Fresh flag set: take the block if its checksum and version hold, else put the old one back
+ */
+static void ctp_config_apply(void)
+{
+    uint8_t sum = 0;
+
+    for (uint32_t reg = GT911_REG_CONFIG_VERSION; reg <= GT911_REG_CONFIG_CHKSUM; reg++) {
+        sum += regs[reg];
+    }
+    if (sum == 0 && (!config_write || regs[GT911_REG_CONFIG_VERSION] >= config_prev[0])) {
+        stats.configs_applied++;
+        return;
+    }
+    stats.configs_rejected++;
+    if (config_write) {
+        memcpy(&regs[GT911_REG_CONFIG_VERSION], config_prev, sizeof(config_prev));
+    }
+}
+
+/**
+ * @brief Recovery clocks: a hung GT911 lets go after CTP_HANG_CLOCKS rising edges
+ */
+static void ctp_scl_hook(uint pin, bool level, void *ctx)
+{
+    (void)pin;
+    (void)ctx;
+
+    if (!hung || !level) {
+        return;
+    }
+    stats.recover_clocks++;
+    if (++hang_clocks >= CTP_HANG_CLOCKS) {
+        hung = false;
+        sim_gpio_drive(GT911_PIN_SDA, -1);
+        sim_i2c_hold(i2c_hw_index(GT911_I2C_PORT), false);
+    }
+}
+
+static uint64_t ctp_next(void)
+{
+    return pulse_end_ns < play_next_ns ? pulse_end_ns : play_next_ns;
+}
+
+static void ctp_service(void)
+{
+    if (pulse_end_ns <= sim_now()) {
+        pulse_end_ns = SIM_NEVER;
+        sim_gpio_drive(GT911_PIN_INT, !ctp_int_rising());
+    }
+    if (play_next_ns <= sim_now()) {
+        ctp_report(&play_frames[play_pos++]);
+        play_next_ns = play_pos < play_count ? play_next_ns + play_period_ns : SIM_NEVER;
+    }
+}
+
+/**
+ * @brief INT trigger of the config block: rising pulses for 0 / 3, falling for 1 / 2
+ */
+static bool ctp_int_rising(void)
+{
+    uint8_t trigger = regs[GT911_REG_MODULE_SWITCH1] & 0x03;
+    return trigger == 0 || trigger == 3;
+}
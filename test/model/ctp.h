@@ -0,0 +1,82 @@
+/**
+ * @file ctp.h
+ * @brief Host Model: GT911 Capacitive Touch Panel (I2C register map)
+ * @note Target at GT911_I2C_ADDR on the I2C model: a 16-bit register pointer written first,
+ *       then writes store and reads auto-increment over a 64 KB register map. Faults are armed
+ *       for the next transaction: an address or data NAK, or a hang that stalls the transfer
+ *       and keeps SDA low until a bus recovery clocks SCL. Touch frames are reported like the
+ *       GT911 does: status and points loaded, then an INT pulse of the configured trigger
+ *       (0x804D). A frame arriving before the host cleared the status of the last one is lost.
+ *       A write setting the fresh flag (0x8100) applies the config block written with it: taken
+ *       if its checksum is right and the version didn't go backwards, otherwise the old block
+ *       is put back.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef CTP_H
+#define CTP_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "gt911.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* SCL clocks a hung GT911 needs to let go of SDA */
+#define CTP_HANG_CLOCKS     3
+
+/* INT pulse width (us) */
+#define CTP_INT_PULSE_US    100
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    CTP_FAULT_NONE,
+    CTP_FAULT_NAK_ADDR,         // Next START is not acknowledged
+    CTP_FAULT_NAK_DATA,         // Next written byte is not acknowledged
+    CTP_FAULT_HANG,             // Next read byte stalls the bus with SDA low
+} ctp_fault_t;
+
+/**
+ * @brief Register map fixture: bytes stored from reg on
+ */
+typedef struct {
+    uint16_t reg;
+    uint16_t len;
+    const uint8_t *data;
+} ctp_fixture_t;
+
+typedef struct {
+    uint32_t writes;            // Write transactions (pointer set)
+    uint32_t reads;             // Read transactions
+    uint32_t bytes_read;
+    uint32_t naks;              // Injected NAKs
+    uint32_t hangs;             // Injected hangs
+    uint32_t recover_clocks;    // SCL clocks seen while hung
+    uint32_t frames;            // Touch frames reported
+    uint32_t frames_lost;       // Frames the host didn't clear the status for in time
+    uint32_t status_clears;     // Status register cleared by the host
+    uint32_t configs_applied;   // Config blocks taken by a fresh flag write
+    uint32_t configs_rejected;  // Config blocks refused: bad checksum or lower version
+} ctp_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void ctp_attach(void);
+uint8_t *ctp_regs(void);
+void ctp_load(const ctp_fixture_t *fixture, size_t count);
+void ctp_fault(ctp_fault_t fault);
+void ctp_report(const gt911_touch_t *frame);
+void ctp_play(const gt911_touch_t *frames, size_t count, uint32_t period_us);
+bool ctp_playing(void);
+void ctp_get_stats(ctp_stats_t *stats);
+
+#endif /* CTP_H */
@@ -0,0 +1,186 @@
+/**
+ * @file leds.c
+ * @brief Host Model: WS2812 LED Chains (data line decoder)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "leds.h"
+#include "sim.h"
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    bool used;
+    unsigned pin;
+    uint64_t rise_ns;
+    uint64_t fall_ns;
+    leds_frame_t rx;            // Frame being received
+    leds_frame_t last;          // Last latched frame
+    leds_stats_t stats;
+} leds_lane_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint64_t leds_next(void);
+static void leds_service(void);
+static void leds_hook(uint pin, bool level, void *ctx);
+static leds_lane_t *leds_lane(unsigned pin);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static sim_model_t leds_model = { "leds", leds_next, leds_service, NULL };
+static leds_lane_t lanes[LEDS_LANES];
+static leds_frame_fn_t frame_fn = NULL;
+static bool model_added = false;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void leds_attach(unsigned pin)
+{
+    for (unsigned i = 0; i < LEDS_LANES; i++) {
+        if (!lanes[i].used) {
+            lanes[i] = (leds_lane_t){ .used = true, .pin = pin };
+            lanes[i].stats.idle_min_ns = UINT64_MAX;
+            sim_gpio_add_hook(pin, leds_hook, &lanes[i]);
+            if (!model_added) {
+                sim_add_model(&leds_model);
+                model_added = true;
+            }
+            return;
+        }
+    }
+    sim_fatal("too many LED chains");
+}
+
+void leds_set_frame_fn(leds_frame_fn_t fn)
+{
+    frame_fn = fn;
+}
+
+/**
+ * @brief Last frame latched on pin (bits 0 before the first)
+ */
+const leds_frame_t *leds_frame(unsigned pin)
+{
+    return &leds_lane(pin)->last;
+}
+
+/**
+ * @brief Pixel word index of a frame with bits per pixel, right aligned
+ */
+uint32_t leds_word(const leds_frame_t *frame, unsigned index, unsigned bits)
+{
+    uint32_t word = 0;
+
+    for (unsigned i = index * bits; i < (index + 1) * bits; i++) {
+        bool bit = i < frame->bits && (frame->data[i / 8] & (0x80u >> (i % 8)));
+        word = (word << 1) | bit;
+    }
+    return word;
+}
+
+void leds_get_stats(unsigned pin, leds_stats_t *stats)
+{
+    *stats = leds_lane(pin)->stats;
+}
+
+void leds_reset_stats(unsigned pin)
+{
+    leds_lane_t *lane = leds_lane(pin);
+
+    lane->stats = (leds_stats_t){ .idle_min_ns = UINT64_MAX };
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static leds_lane_t *leds_lane(unsigned pin)
+{
+    for (unsigned i = 0; i < LEDS_LANES; i++) {
+        if (lanes[i].used && lanes[i].pin == pin) {
+            return &lanes[i];
+        }
+    }
+    sim_fatal("no LED chain on GPIO %u", pin);
+}
+
+/**
+ * @brief Latch time after the last bit of a frame being received
+ */
+static uint64_t leds_next(void)
+{
+    uint64_t next = SIM_NEVER;
+
+    for (unsigned i = 0; i < LEDS_LANES; i++) {
+        if (lanes[i].used && lanes[i].rx.bits > 0) {
+            uint64_t t = lanes[i].fall_ns + SIM_US(LEDS_LATCH_US);
+            next = t < next ? t : next;
+        }
+    }
+    return next;
+}
+
+static void leds_service(void)
+{
+    for (unsigned i = 0; i < LEDS_LANES; i++) {
+        leds_lane_t *lane = &lanes[i];
+
+        if (!lane->used || lane->rx.bits == 0 || sim_now() < lane->fall_ns + SIM_US(LEDS_LATCH_US)) {
+            continue;
+        }
+        lane->last = lane->rx;
+        lane->rx.bits = 0;
+        lane->stats.frames++;
+        if (frame_fn != NULL) {
+            frame_fn(lane->pin, &lane->last);
+        }
+    }
+}
+
+static void leds_hook(uint pin, bool level, void *ctx)
+{
+    leds_lane_t *lane = ctx;
+    uint64_t now = sim_now();
+    (void)pin;
+
+    if (level) {
+        if (lane->rx.bits == 0) {
+            // Start of a frame: the line was low since the last one latched
+            if (lane->stats.frames > 0 && now - lane->last.end_ns < lane->stats.idle_min_ns) {
+                lane->stats.idle_min_ns = now - lane->last.end_ns;
+            }
+            memset(lane->rx.data, 0, sizeof(lane->rx.data));
+            lane->rx.start_ns = now;
+        } else if (now - lane->fall_ns > lane->stats.gap_max_ns) {
+            lane->stats.gap_max_ns = now - lane->fall_ns;
+        }
+        lane->rise_ns = now;
+        return;
+    }
+
+    uint64_t high = now - lane->rise_ns;
+    bool one = high >= LEDS_T1H_MIN_NS;
+    if (high < LEDS_T0H_MIN_NS || (high > LEDS_T0H_MAX_NS && high < LEDS_T1H_MIN_NS) || high > LEDS_T1H_MAX_NS) {
+        lane->stats.timing_errors++;
+    }
+    if (lane->rx.bits < LEDS_BITS_MAX) {
+        if (one) {
+            lane->rx.data[lane->rx.bits / 8] |= (uint8_t)(0x80u >> (lane->rx.bits % 8));
+        }
+        lane->rx.bits++;
+    }
+    lane->stats.bits++;
+    lane->fall_ns = now;
+    lane->rx.end_ns = now;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file leds.h
+ * @brief Host Model: WS2812 LED Chains (data line decoder)
+ * @note Watches the data pin of up to LEDS_LANES chains through the GPIO model. Every high
+ *       pulse is one bit, decoded by its width as the WS2812 does (long = 1), pulses outside
+ *       the datasheet windows are counted as timing errors. A low time of LEDS_LATCH_US ends
+ *       the frame: the bits received are latched and handed to the frame callback.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef LEDS_H
+#define LEDS_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LEDS_LANES          8
+#define LEDS_BITS_MAX       (64 * 32)
+
+/* Low time that latches a frame (us), the original WS2812 */
+#define LEDS_LATCH_US       50
+
+/* High time windows (ns): WS2812B T0H 220..380, T1H 580..1000, with margin */
+#define LEDS_T0H_MIN_NS     150
+#define LEDS_T0H_MAX_NS     500
+#define LEDS_T1H_MIN_NS     550
+#define LEDS_T1H_MAX_NS     1500
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief One latched frame, bits MSB first in the order they were sent
+ */
+typedef struct {
+    uint64_t start_ns;          // First rising edge
+    uint64_t end_ns;            // Last falling edge
+    uint32_t bits;
+    uint8_t data[LEDS_BITS_MAX / 8];
+} leds_frame_t;
+
+typedef struct {
+    uint32_t frames;            // Frames latched
+    uint32_t bits;              // Bits received
+    uint32_t timing_errors;     // High pulses outside the T0H / T1H windows
+    uint64_t gap_max_ns;        // Longest low time between two bits of a frame
+    uint64_t idle_min_ns;       // Shortest low time between two frames, UINT64_MAX if none
+} leds_stats_t;
+
+typedef void (*leds_frame_fn_t)(unsigned pin, const leds_frame_t *frame);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void leds_attach(unsigned pin);
+void leds_set_frame_fn(leds_frame_fn_t fn);
+const leds_frame_t *leds_frame(unsigned pin);
+uint32_t leds_word(const leds_frame_t *frame, unsigned index, unsigned bits);
+void leds_get_stats(unsigned pin, leds_stats_t *stats);
+void leds_reset_stats(unsigned pin);
+
+#endif /* LEDS_H */
@@ -0,0 +1,286 @@
+/**
+ * @file panel.c
+ * @brief Host Model: ST7796 Panel (command decoder + GRAM)
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "panel.h"
+#include "sim.h"
+#include "st7796.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MADCTL_MY   0x80
+#define MADCTL_MX   0x40
+#define MADCTL_MV   0x20
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void panel_spi_sink(uint32_t frame, uint bits, void *ctx);
+static void panel_clk_hook(uint pin, bool level, void *ctx);
+static void panel_cs_hook(uint pin, bool level, void *ctx);
+static void panel_byte(uint8_t byte, bool dc, bool cs);
+static void panel_log(panel_event_kind_t kind, uint16_t value);
+static void panel_map(unsigned x, unsigned y, unsigned *px, unsigned *py);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint16_t gram[PANEL_GRAM_H][PANEL_GRAM_W];
+static uint8_t madctl = 0;
+
+static uint8_t cur_cmd = 0;
+static uint32_t param_idx = 0;
+static uint8_t params[4];
+static uint16_t xs = 0, xe = PANEL_GRAM_W - 1;
+static uint16_t ys = 0, ye = PANEL_GRAM_H - 1;
+static uint16_t wx = 0, wy = 0;             // RAMWR write position (logical)
+static uint8_t pixel_hi = 0;
+static bool pixel_half = false;
+
+static uint8_t pio_shift = 0;               // PIO transport: bits of the byte so far
+static uint8_t pio_bits = 0;
+
+static panel_event_t *log_buf = NULL;
+static size_t log_len = 0;
+static size_t log_cap = 0;
+static bool log_pixels = true;
+
+static panel_stats_t stats;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void panel_attach_spi(unsigned spi_index)
+{
+    sim_spi_set_sink(spi_index, panel_spi_sink, NULL);
+}
+
+/**
+ * @brief Sample MOSI on rising CLK edges (mode 0), as the controller does
+ */
+void panel_attach_pio(void)
+{
+    sim_gpio_add_hook(ST7796_PIN_CLK, panel_clk_hook, NULL);
+    sim_gpio_add_hook(ST7796_PIN_CS, panel_cs_hook, NULL);
+}
+
+/**
+ * @brief Pixel at logical coordinates under the current MADCTL
+ */
+uint16_t panel_pixel(unsigned x, unsigned y)
+{
+    unsigned px, py;
+    panel_map(x, y, &px, &py);
+    return gram[py][px];
+}
+
+/**
+ * @brief Pixel at physical GRAM coordinates
+ */
+uint16_t panel_gram(unsigned x, unsigned y)
+{
+    return gram[y][x];
+}
+
+void panel_fill(uint16_t value)
+{
+    for (unsigned y = 0; y < PANEL_GRAM_H; y++) {
+        for (unsigned x = 0; x < PANEL_GRAM_W; x++) {
+            gram[y][x] = value;
+        }
+    }
+}
+
+uint8_t panel_madctl(void)
+{
+    return madctl;
+}
+
+void panel_logical_size(unsigned *w, unsigned *h)
+{
+    bool mv = madctl & MADCTL_MV;
+    *w = mv ? PANEL_GRAM_H : PANEL_GRAM_W;
+    *h = mv ? PANEL_GRAM_W : PANEL_GRAM_H;
+}
+
+void panel_log_pixels(bool enable)
+{
+    log_pixels = enable;
+}
+
+const panel_event_t *panel_events(size_t *count)
+{
+    *count = log_len;
+    return log_buf;
+}
+
+void panel_clear_log(void)
+{
+    log_len = 0;
+}
+
+void panel_get_stats(panel_stats_t *out)
+{
+    *out = stats;
+}
+
+void panel_reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void panel_spi_sink(uint32_t frame, uint bits, void *ctx)
+{
+    (void)ctx;
+    bool dc = sim_gpio_level(ST7796_PIN_DC);
+    bool cs = sim_gpio_level(ST7796_PIN_CS);
+
+    if (bits > 8) {
+        panel_byte((uint8_t)(frame >> 8), dc, cs);
+    }
+    panel_byte((uint8_t)frame, dc, cs);
+}
+
+static void panel_clk_hook(uint pin, bool level, void *ctx)
+{
+    (void)pin;
+    (void)ctx;
+    if (!level) {
+        return;
+    }
+    pio_shift = (uint8_t)((pio_shift << 1) | sim_gpio_level(ST7796_PIN_MOSI));
+    if (++pio_bits == 8) {
+        panel_byte(pio_shift, sim_gpio_level(ST7796_PIN_DC), sim_gpio_level(ST7796_PIN_CS));
+        pio_bits = 0;
+    }
+}
+
+static void panel_cs_hook(uint pin, bool level, void *ctx)
+{
+    (void)pin;
+    (void)ctx;
+    if (level) {
+        pio_bits = 0;   // Deselect aborts a partial byte
+    }
+}
+
+/**
+ * @brief Decode one byte received with the given DC / CS levels
+ */
+static void panel_byte(uint8_t byte, bool dc, bool cs)
+{
+    if (cs) {
+        stats.bytes_cs_high++;
+        return;
+    }
+
+    if (!dc) {
+        cur_cmd = byte;
+        param_idx = 0;
+        pixel_half = false;
+        stats.cmds++;
+        stats.cmd_count[byte]++;
+        panel_log(PANEL_EV_CMD, byte);
+        if (byte == ST7796_CMD_RAMWR) {
+            wx = xs;
+            wy = ys;
+        }
+        return;
+    }
+
+    if (cur_cmd != ST7796_CMD_RAMWR) {
+        stats.params++;
+        panel_log(PANEL_EV_PARAM, byte);
+        if (param_idx < sizeof(params)) {
+            params[param_idx] = byte;
+        }
+        param_idx++;
+        if (cur_cmd == ST7796_CMD_CASET && param_idx == 4) {
+            xs = (uint16_t)((params[0] << 8) | params[1]);
+            xe = (uint16_t)((params[2] << 8) | params[3]);
+        } else if (cur_cmd == ST7796_CMD_RASET && param_idx == 4) {
+            ys = (uint16_t)((params[0] << 8) | params[1]);
+            ye = (uint16_t)((params[2] << 8) | params[3]);
+        } else if (cur_cmd == ST7796_CMD_MADCTL && param_idx == 1) {
+            madctl = byte;
+        }
+        return;
+    }
+
+    if (!pixel_half) {
+        pixel_hi = byte;
+        pixel_half = true;
+        return;
+    }
+    pixel_half = false;
+
+    uint16_t pixel = (uint16_t)((pixel_hi << 8) | byte);
+    unsigned w, h;
+    panel_logical_size(&w, &h);
+    if (wx < w && wy < h) {
+        unsigned px, py;
+        panel_map(wx, wy, &px, &py);
+        gram[py][px] = pixel;
+    }
+    stats.pixels++;
+    stats.last_pixel_ns = sim_now();
+    if (log_pixels) {
+        panel_log(PANEL_EV_PIXEL, pixel);
+    }
+
+    // Walk the window row by row, wrap to its start after the last pixel
+    if (wx < xe) {
+        wx++;
+    } else {
+        wx = xs;
+        wy = (wy < ye) ? wy + 1 : ys;
+    }
+}
+
+static void panel_log(panel_event_kind_t kind, uint16_t value)
+{
+    if (log_len == log_cap) {
+        log_cap = log_cap ? log_cap * 2 : 4096;
+        log_buf = realloc(log_buf, log_cap * sizeof(*log_buf));
+        if (log_buf == NULL) {
+            sim_fatal("panel log out of memory");
+        }
+    }
+    log_buf[log_len++] = (panel_event_t){ sim_now(), kind, cur_cmd, value };
+}
+
+/**
+ * @brief Logical (column, row) to physical GRAM position: MX/MY mirror, then MV exchanges
+ */
+static void panel_map(unsigned x, unsigned y, unsigned *px, unsigned *py)
+{
+    unsigned w, h;
+    panel_logical_size(&w, &h);
+    if (madctl & MADCTL_MX) {
+        x = w - 1 - x;
+    }
+    if (madctl & MADCTL_MY) {
+        y = h - 1 - y;
+    }
+    if (madctl & MADCTL_MV) {
+        *px = y;
+        *py = x;
+    } else {
+        *px = x;
+        *py = y;
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file panel.h
+ * @brief Host Model: ST7796 Panel (command decoder + GRAM)
+ * @note Listens to the SPI frames (SPI transport) or samples the CLK/MOSI pins (PIO transport),
+ *       using CS/DC from the GPIO model. Decodes CASET/RASET/RAMWR/MADCTL into a 320x480 GRAM,
+ *       everything else is logged and ignored.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef PANEL_H
+#define PANEL_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define PANEL_GRAM_W    320
+#define PANEL_GRAM_H    480
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    PANEL_EV_CMD,
+    PANEL_EV_PARAM,
+    PANEL_EV_PIXEL,
+} panel_event_kind_t;
+
+/**
+ * @brief One decoded byte (command / parameter) or pixel
+ */
+typedef struct {
+    uint64_t t_ns;              // Time the last bit was received
+    panel_event_kind_t kind;
+    uint8_t cmd;                // Command this belongs to
+    uint16_t value;             // Command, parameter byte or RGB565 pixel
+} panel_event_t;
+
+typedef struct {
+    uint32_t cmds;              // Command bytes
+    uint32_t params;            // Parameter bytes (other than pixel data)
+    uint32_t pixels;            // Pixels written to GRAM
+    uint32_t cmd_count[256];    // Per command
+    uint32_t bytes_cs_high;     // Bytes clocked while not selected (bus protocol errors)
+    uint64_t last_pixel_ns;     // Time of the last pixel
+} panel_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void panel_attach_spi(unsigned spi_index);
+void panel_attach_pio(void);
+
+uint16_t panel_pixel(unsigned x, unsigned y);
+uint16_t panel_gram(unsigned x, unsigned y);
+void panel_fill(uint16_t value);
+uint8_t panel_madctl(void);
+void panel_logical_size(unsigned *w, unsigned *h);
+
+void panel_log_pixels(bool enable);
+const panel_event_t *panel_events(size_t *count);
+void panel_clear_log(void);
+void panel_get_stats(panel_stats_t *stats);
+void panel_reset_stats(void);
+
+#endif /* PANEL_H */
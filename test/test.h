@@ -0,0 +1,91 @@
+/**
+ * @file test.h
+ * @brief Host Test Helpers
+ * @note Each test is its own executable (fresh firmware statics), registered with CTest.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef TEST_H
+#define TEST_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_CHECK(cond)                                                            \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            test_fail(__FILE__, __LINE__, #cond);                                   \
+        }                                                                           \
+    } while (0)
+
+#define TEST_CHECK_EQ(actual, expected)                                             \
+    do {                                                                            \
+        long long test_a_ = (long long)(actual);                                    \
+        long long test_e_ = (long long)(expected);                                  \
+        if (test_a_ != test_e_) {                                                   \
+            test_fail_eq(__FILE__, __LINE__, #actual, test_a_, test_e_);            \
+        }                                                                           \
+    } while (0)
+
+#define TEST_CHECK_RANGE(actual, lo, hi)                                            \
+    do {                                                                            \
+        long long test_a_ = (long long)(actual);                                    \
+        if (test_a_ < (long long)(lo) || test_a_ > (long long)(hi)) {               \
+            test_fail_range(__FILE__, __LINE__, #actual, test_a_, (lo), (hi));      \
+        }                                                                           \
+    } while (0)
+
+#define TEST_RUN(fn)                                                                \
+    do {                                                                            \
+        printf("-- %s\n", #fn);                                                     \
+        fn();                                                                       \
+    } while (0)
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static int test_failures = 0;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static inline void test_fail(const char *file, int line, const char *expr)
+{
+    printf("%s:%d: FAILED: %s\n", file, line, expr);
+    test_failures++;
+}
+
+static inline void test_fail_eq(const char *file, int line, const char *expr, long long a, long long e)
+{
+    printf("%s:%d: FAILED: %s == %lld, expected %lld\n", file, line, expr, a, e);
+    test_failures++;
+}
+
+static inline void test_fail_range(const char *file, int line, const char *expr, long long a,
+                                   long long lo, long long hi)
+{
+    printf("%s:%d: FAILED: %s == %lld, expected %lld..%lld\n", file, line, expr, a, lo, hi);
+    test_failures++;
+}
+
+/**
+ * @brief Exit status for main()
+ */
+static inline int test_report(void)
+{
+    if (test_failures != 0) {
+        printf("%d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+    printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
+
+#endif /* TEST_H */
@@ -0,0 +1,364 @@
+/**
+ * @file test_audio.c
+ * @brief PWM audio: mixer output, idle ramps at start and stop, release of stopped voices
+ * @note The DMA model writes the mixed blocks into the PWM compare register at the DMA timer's
+ *       rate, the PWM model hands every write to the sink: the log holds the PCM the buzzer
+ *       plays, one level per sample. A step of more than POP_LEVELS that doesn't cross the
+ *       mid level (a square wave edge) is a pop.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "audio.h"
+#include "hardware/pwm.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define AUDIO_PIN       13
+#define MID             128
+#define POP_LEVELS      24
+#define LOG_MAX         (AUDIO_SAMPLE_HZ * 4)
+#define PCM_LEN         (AUDIO_SAMPLE_HZ / 2)
+#define SAMPLE_NS       (1000000000ull / AUDIO_SAMPLE_HZ)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint64_t t_ns;
+    uint16_t level;
+} sample_log_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static sample_log_t sample_log[LOG_MAX];
+static size_t sample_count = 0;
+static int8_t pcm[PCM_LEN];
+
+/* Melody of the determinism test, with a rest */
+static const audio_note_t notes[] = {
+    { 523, 40 },
+    { 0, 15 },
+    { 659, 35 },
+    { 784, 60 },
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void on_cc(uint slice, uint32_t cc, void *ctx)
+{
+    (void)ctx;
+    if (slice != pwm_gpio_to_slice_num(AUDIO_PIN)) {
+        return;
+    }
+    if (sample_count < LOG_MAX) {
+        sample_log[sample_count].t_ns = sim_now();
+        sample_log[sample_count].level = pwm_gpio_to_channel(AUDIO_PIN) ? (uint16_t)(cc >> 16) : (uint16_t)cc;
+    }
+    sample_count++;
+}
+
+static void log_reset(void)
+{
+    sample_count = 0;
+}
+
+static int level(size_t i)
+{
+    return sample_log[i].level;
+}
+
+/**
+ * @brief Last mid-scale sample of the first n: where the ramp down to idle starts
+ */
+static size_t fall_start(size_t n)
+{
+    size_t fall = n;
+
+    while (fall > 0 && level(fall - 1) != MID) {
+        fall--;
+    }
+    return fall > 0 ? fall - 1 : 0;
+}
+
+/**
+ * @brief Samples from the last one at full amplitude (at least amp from mid) before the ramp down
+ *        to idle, up to the first one at mid-scale: length of the release
+ */
+static size_t release_len(size_t n, int amp)
+{
+    size_t fall = fall_start(n);
+    size_t full = fall;
+
+    while (full > 0 && abs(level(full) - MID) < amp) {
+        full--;
+    }
+    size_t mid = full;
+    while (mid < fall && level(mid) != MID) {
+        mid++;
+    }
+    TEST_CHECK(full > 0);
+    return mid - full;
+}
+
+/**
+ * @brief Steps bigger than POP_LEVELS that don't cross the mid level, in samples [from, to)
+ */
+static uint32_t count_pops(size_t from, size_t to)
+{
+    uint32_t pops = 0;
+
+    for (size_t i = from + 1; i < to && i < LOG_MAX; i++) {
+        int a = level(i - 1) - MID;
+        int b = level(i) - MID;
+        if (abs(b - a) > POP_LEVELS && !((a < 0 && b > 0) || (a > 0 && b < 0))) {
+            if (pops++ < 4) {
+                printf("pop at sample %u: %d -> %d\n", (unsigned)i, level(i - 1), level(i));
+            }
+        }
+    }
+    return pops;
+}
+
+/**
+ * @brief Samples [from, to) go from one level to the next by at most one step in direction dir
+ */
+static bool is_ramp(size_t from, size_t to, int dir)
+{
+    for (size_t i = from + 1; i < to; i++) {
+        int d = (level(i) - level(i - 1)) * dir;
+        if (d < 0 || d > 1) {
+            printf("ramp broken at sample %u: %d -> %d\n", (unsigned)i, level(i - 1), level(i));
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief The output stopped: nothing was written for a while and it sits at idle (low)
+ */
+static void check_idle(void)
+{
+    size_t n = sample_count;
+
+    sim_run_for(SIM_MS(50));
+    TEST_CHECK_EQ(sample_count, n);
+    TEST_CHECK(n > 0 && n <= LOG_MAX);
+    if (n > 0 && n <= LOG_MAX) {
+        TEST_CHECK_EQ(level(n - 1), 0);
+    }
+    TEST_CHECK_EQ(pwm_hw->slice[pwm_gpio_to_slice_num(AUDIO_PIN)].cc, 0);
+}
+
+/**
+ * @brief After init: low, nothing written, not started
+ */
+static void test_idle(void)
+{
+    audio_stats_t s;
+
+    log_reset();
+    sim_run_for(SIM_MS(100));
+    audio_get_stats(&s);
+    TEST_CHECK_EQ(sample_count, 0);
+    TEST_CHECK_EQ(s.starts, 0);
+    TEST_CHECK_EQ(s.blocks, 0);
+    TEST_CHECK_EQ(pwm_hw->slice[pwm_gpio_to_slice_num(AUDIO_PIN)].cc, 0);
+}
+
+/**
+ * @brief A 100 ms tone: ramp from low to mid-scale one level per step, the tone at its exact
+ *        levels and frequency, ramp back down to low, then the output stops by itself
+ */
+static void test_start_stop(void)
+{
+    audio_stats_t s0, s1;
+
+    audio_get_stats(&s0);
+    log_reset();
+    TEST_CHECK(audio_tone(1000, 100, 128) >= 0);
+    sim_run_for(SIM_MS(300));
+    audio_get_stats(&s1);
+    size_t n = sample_count;
+    TEST_CHECK(n > 0 && n < LOG_MAX);
+
+    // 1. Rise: from low to the first mid-scale sample
+    size_t rise = 0;
+    while (rise < n && level(rise) != MID) {
+        rise++;
+    }
+    TEST_CHECK(level(0) <= 1);
+    TEST_CHECK(rise >= AUDIO_IDLE_RAMP - 1);
+    TEST_CHECK(is_ramp(0, rise + 1, 1));
+
+    // 2. Tone: vol 128 is mid +/- 64, 1 kHz for 100 ms
+    size_t fall = fall_start(n);
+    uint32_t cycles = 0;
+    int hi = 0, lo = 255;
+    for (size_t i = rise + 1; i < fall; i++) {
+        cycles += level(i) > MID && level(i - 1) <= MID;
+        hi = level(i) > hi ? level(i) : hi;
+        lo = level(i) < lo ? level(i) : lo;
+    }
+    TEST_CHECK_EQ(hi, MID + 64);
+    TEST_CHECK_EQ(lo, MID - 65);
+    TEST_CHECK_RANGE(cycles, 99, 101);
+
+    // 3. Fall: from the last mid-scale sample down to low, nothing after it
+    TEST_CHECK(is_ramp(fall, n, -1));
+    TEST_CHECK(n - fall >= AUDIO_IDLE_RAMP);
+    TEST_CHECK_EQ(count_pops(0, n), 0);
+    check_idle();
+
+    printf("tone 100 ms: %u samples, rise %u, tone %u, fall and idle %u, %u blocks\n", (unsigned)n,
+           (unsigned)rise, (unsigned)(fall - rise), (unsigned)(n - fall), (unsigned)(s1.blocks - s0.blocks));
+    TEST_CHECK_EQ(s1.starts - s0.starts, 1);
+    TEST_CHECK_EQ(n, (s1.blocks - s0.blocks - 2) * AUDIO_BLOCK);   // Stopped on two idle blocks
+}
+
+/**
+ * @brief audio_stop() on an endless tone and on a PCM voice: the amplitude falls to silence over
+ *        AUDIO_RAMP samples, no pop at the stop nor when the output goes idle
+ */
+static void test_release(void)
+{
+    // 1. Tone, 100 Hz so that the release mostly falls inside one half period
+    log_reset();
+    int voice = audio_tone(100, 0, 255);
+    TEST_CHECK(voice >= 0);
+    sim_run_for(SIM_MS(57));
+    audio_stop(voice);
+    audio_stop(voice);                  // Twice: doesn't restart the release
+    sim_run_for(SIM_MS(200));
+
+    size_t n = sample_count;
+    size_t len = release_len(n, MID - 1);
+    printf("tone release: %u samples from full amplitude to silence\n", (unsigned)len);
+    TEST_CHECK_RANGE(len, AUDIO_RAMP - 1, AUDIO_RAMP + 1);
+    TEST_CHECK_EQ(count_pops(0, n), 0);
+    check_idle();
+
+    // 2. PCM rising slowly to full scale, then flat
+    for (uint32_t i = 0; i < PCM_LEN; i++) {
+        pcm[i] = (int8_t)(i < 127 ? i : 127);
+    }
+    log_reset();
+    voice = audio_play(pcm, PCM_LEN, 255);
+    TEST_CHECK(voice >= 0);
+    sim_run_for(SIM_MS(100));
+    audio_stop(voice);
+    sim_run_for(SIM_MS(200));
+
+    n = sample_count;
+    len = release_len(n, MID - 2);
+    printf("PCM release: %u samples from full amplitude to silence\n", (unsigned)len);
+    TEST_CHECK_RANGE(len, AUDIO_RAMP - 1, AUDIO_RAMP + 1);
+    TEST_CHECK_EQ(count_pops(0, n), 0);
+    check_idle();
+}
+
+/**
+ * @brief Two in-phase full-scale tones clamp at the ends of the range, a voice too many is refused
+ */
+static void test_mix(void)
+{
+    int voices[AUDIO_VOICES];
+
+    log_reset();
+    for (int i = 0; i < AUDIO_VOICES; i++) {
+        voices[i] = audio_tone(i < 2 ? 250 : 0, 0, i < 2 ? 255 : 0);
+        TEST_CHECK(voices[i] >= 0);
+    }
+    TEST_CHECK_EQ(audio_tone(440, 10, 255), -1);
+    sim_run_for(SIM_MS(60));
+
+    uint32_t clamped = 0, other = 0;
+    for (size_t i = AUDIO_IDLE_RAMP + 2 * AUDIO_BLOCK; i < sample_count && i < LOG_MAX; i++) {
+        if (level(i) == 0 || level(i) == 255) {
+            clamped++;
+        } else {
+            other++;
+        }
+    }
+    printf("mix: %u samples clamped, %u not\n", (unsigned)clamped, (unsigned)other);
+    TEST_CHECK(clamped > 0);
+    TEST_CHECK_EQ(other, 0);
+
+    for (int i = 0; i < AUDIO_VOICES; i++) {
+        audio_stop(voices[i]);
+    }
+    sim_run_for(SIM_MS(100));
+    TEST_CHECK_EQ(count_pops(0, sample_count), 0);
+    check_idle();
+}
+
+/**
+ * @brief The same script of voices, started at the same offsets from the first sample, twice: the
+ *        same samples at the same times, at the sample rate (the click is a transient by design,
+ *        no pop check here)
+ */
+static void test_deterministic(void)
+{
+    static sample_log_t first[LOG_MAX];
+    size_t count[2];
+
+    for (int run = 0; run < 2; run++) {
+        sim_run_for(SIM_US(100 + 1234 * run));  // Another DMA timer phase the second time
+        log_reset();
+        audio_melody(notes, sizeof(notes) / sizeof(notes[0]), 200);
+        sim_run_for(SIM_MS(30));
+        audio_click();
+        int voice = audio_tone(1500, 0, 90);
+        sim_run_for(SIM_MS(45));
+        audio_play(pcm, 800, 120);
+        sim_run_for(SIM_MS(20));
+        audio_stop(voice);
+        sim_run_for(SIM_MS(400));
+        count[run] = sample_count;
+        if (run == 0) {
+            memcpy(first, sample_log, sizeof(first));
+        }
+    }
+
+    printf("script: %u and %u samples\n", (unsigned)count[0], (unsigned)count[1]);
+    TEST_CHECK_EQ(count[0], count[1]);
+    TEST_CHECK(count[0] > 0 && count[0] <= LOG_MAX);
+    uint32_t diffs = 0;
+    for (size_t i = 0; i < count[0] && i < count[1] && i < LOG_MAX; i++) {
+        diffs += first[i].level != sample_log[i].level;
+        diffs += first[i].t_ns - first[0].t_ns != sample_log[i].t_ns - sample_log[0].t_ns;
+    }
+    TEST_CHECK_EQ(diffs, 0);
+    if (count[1] > 1 && count[1] <= LOG_MAX) {
+        uint64_t span = sample_log[count[1] - 1].t_ns - sample_log[0].t_ns;
+        TEST_CHECK_RANGE(span / (count[1] - 1), SAMPLE_NS - 1, SAMPLE_NS + 1);
+    }
+    check_idle();
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    sim_pwm_set_sink(on_cc, NULL);
+    audio_init(AUDIO_PIN);
+
+    TEST_RUN(test_idle);
+    TEST_RUN(test_start_stop);
+    TEST_RUN(test_release);
+    TEST_RUN(test_mix);
+    TEST_RUN(test_deterministic);
+    return test_report();
+}
@@ -0,0 +1,272 @@
+/**
+ * @file test_buttons.c
+ * @brief Button debouncing in PIO against bouncing contact traces
+ * @note buttons.pio runs on the PIO emulator at the driver's clock divider. A trace model drives
+ *       the pins: presses and releases that bounce for up to 3 ms, glitches shorter than the
+ *       debounce time, two buttons at once, a pin of the window that is no button. Every physical
+ *       press must give exactly one press and one release event, never before the contact settled
+ *       and at most twice the debounce time after it.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "buttons.h"
+#include "pico/stdlib.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BTN_A           14
+#define BTN_B           15
+#define BTN_C           22
+#define NOT_BUTTON      16          // In the window, not watched
+#define TRACE_MAX       512
+#define BOUNCE_MAX_US   3000        // Shorter than BUTTONS_DEBOUNCE_US
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint64_t t_ns;
+    uint8_t pin;
+    uint8_t level;
+} edge_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint64_t trace_next(void);
+static void trace_service(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static sim_model_t trace_model = { "trace", trace_next, trace_service, NULL };
+static edge_t trace[TRACE_MAX];
+static size_t trace_len = 0;
+static size_t trace_pos = 0;
+
+static uint32_t rng = 0x2545F491u;
+static uint32_t callbacks = 0;
+static uint64_t callback_ns = 0;    // Time of the last callback
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint64_t trace_next(void)
+{
+    return trace_pos < trace_len ? trace[trace_pos].t_ns : SIM_NEVER;
+}
+
+static void trace_service(void)
+{
+    while (trace_pos < trace_len && trace[trace_pos].t_ns <= sim_now()) {
+        sim_gpio_drive(trace[trace_pos].pin, trace[trace_pos].level);
+        trace_pos++;
+    }
+}
+
+static void trace_add(uint64_t t_ns, uint pin, bool level)
+{
+    size_t i = trace_len++;
+
+    // Keep the trace sorted: edges of two pins interleave
+    while (i > trace_pos && trace[i - 1].t_ns > t_ns) {
+        trace[i] = trace[i - 1];
+        i--;
+    }
+    trace[i] = (edge_t){ t_ns, (uint8_t)pin, level };
+}
+
+/**
+ * @brief A contact closing or opening from t_ns on: bounces, then the level
+ * @return Time the contact settled
+ */
+static uint64_t trace_bounce(uint64_t t_ns, uint pin, bool level, uint32_t bounces)
+{
+    uint64_t t = t_ns;
+
+    for (uint32_t i = 0; i < bounces; i++) {
+        trace_add(t, pin, level);
+        t += SIM_US(20 + rand_u32() % (BOUNCE_MAX_US / (2 * bounces)));
+        trace_add(t, pin, !level);
+        t += SIM_US(20 + rand_u32() % (BOUNCE_MAX_US / (2 * bounces)));
+    }
+    trace_add(t, pin, level);
+    return t;
+}
+
+static void run_trace(uint64_t ns)
+{
+    sim_run_for(ns);
+    trace_len = 0;
+    trace_pos = 0;
+}
+
+static void buttons_changed(void)
+{
+    callbacks++;
+    callback_ns = sim_now();
+}
+
+/**
+ * @brief Bouncy presses of one button: exactly one press and one release each, in order, reported
+ *        the debounce time after the first edge but not before the contact settled, stamped
+ *        with the edge
+ */
+static void test_bounce(void)
+{
+    button_event_t ev;
+    uint32_t worst_us = 0;
+
+    for (uint32_t i = 0; i < 50; i++) {
+        uint32_t bounces = 1 + i % 10;
+        uint64_t t0 = sim_now() + SIM_MS(1);
+        uint64_t down = trace_bounce(t0, BTN_B, true, bounces);
+        uint64_t up = trace_bounce(down + SIM_MS(80), BTN_B, false, bounces);
+        uint64_t reports[2] = { 0, 0 };
+
+        uint32_t cb = callbacks;
+        sim_run_until(down + SIM_MS(40));
+        reports[0] = callback_ns;
+        TEST_CHECK_EQ(callbacks, cb + 1);
+        run_trace(up + SIM_MS(40) - sim_now());
+        reports[1] = callback_ns;
+        TEST_CHECK_EQ(callbacks, cb + 2);
+
+        const uint64_t first[2] = { t0, down + SIM_MS(80) };
+        const uint64_t settled[2] = { down, up };
+        for (int k = 0; k < 2; k++) {
+            TEST_CHECK(buttons_get(&ev));
+            TEST_CHECK_EQ(ev.gpio, BTN_B);
+            TEST_CHECK_EQ(ev.pressed, k == 0);
+            uint32_t delay_us = (uint32_t)((reports[k] - settled[k]) / 1000);
+            worst_us = delay_us > worst_us ? delay_us : worst_us;
+            TEST_CHECK(reports[k] >= settled[k]);
+            TEST_CHECK(reports[k] >= first[k] + SIM_US(BUTTONS_DEBOUNCE_US));
+            TEST_CHECK(reports[k] <= settled[k] + 2 * SIM_US(BUTTONS_DEBOUNCE_US) + SIM_US(100));
+            // Stamped at the edge, not the debounce time later
+            TEST_CHECK_RANGE(ev.time_us, (uint32_t)(first[k] / 1000),
+                             (uint32_t)(settled[k] / 1000) + BUTTONS_DEBOUNCE_US + 100);
+        }
+        TEST_CHECK(!buttons_get(&ev));
+    }
+    printf("bounce: 50 presses, worst report %u us after the contact settled\n", (unsigned)worst_us);
+}
+
+/**
+ * @brief Glitches shorter than the debounce time, and a non-button pin of the window toggling:
+ *        no event, no callback
+ */
+static void test_glitch(void)
+{
+    button_event_t ev;
+    uint32_t cb = callbacks;
+    uint64_t t = sim_now() + SIM_MS(1);
+
+    for (uint32_t i = 0; i < 20; i++) {
+        uint32_t width_us = 10 + rand_u32() % (BUTTONS_DEBOUNCE_US - 500);
+        trace_add(t, BTN_A, true);
+        trace_add(t + SIM_US(width_us), BTN_A, false);
+        trace_add(t + SIM_US(width_us / 2), NOT_BUTTON, i & 1);
+        t += SIM_US(width_us) + SIM_MS(3 * BUTTONS_DEBOUNCE_US / 1000);
+    }
+    run_trace(t + SIM_MS(20) - sim_now());
+
+    TEST_CHECK_EQ(callbacks, cb);
+    TEST_CHECK(!buttons_get(&ev));
+    sim_gpio_drive(NOT_BUTTON, 0);
+}
+
+/**
+ * @brief Two buttons bouncing at the same time: both reported, each once
+ */
+static void test_two_buttons(void)
+{
+    button_event_t ev;
+    uint32_t seen[2] = { 0, 0 };
+    uint64_t t = sim_now() + SIM_MS(1);
+
+    uint64_t a = trace_bounce(t, BTN_A, true, 5);
+    uint64_t c = trace_bounce(t + SIM_US(700), BTN_C, true, 7);
+    uint64_t last = a > c ? a : c;
+    trace_bounce(last + SIM_MS(50), BTN_A, false, 4);
+    trace_bounce(last + SIM_MS(50), BTN_C, false, 6);
+    run_trace(last + SIM_MS(120) - sim_now());
+
+    while (buttons_get(&ev)) {
+        TEST_CHECK(ev.gpio == BTN_A || ev.gpio == BTN_C);
+        seen[ev.gpio == BTN_C] += ev.pressed ? 1 : 0x100;
+    }
+    TEST_CHECK_EQ(seen[0], 0x101);
+    TEST_CHECK_EQ(seen[1], 0x101);
+}
+
+/**
+ * @brief Nobody draining the queue: BUTTONS_QUEUE events kept, the rest counted as dropped
+ */
+static void test_overflow(void)
+{
+    buttons_stats_t s0, s1;
+    button_event_t ev;
+    uint64_t t = sim_now() + SIM_MS(1);
+
+    buttons_get_stats(&s0);
+    for (uint32_t i = 0; i < BUTTONS_QUEUE; i++) {
+        t = trace_bounce(t, BTN_A, true, 3) + SIM_MS(20);
+        t = trace_bounce(t, BTN_A, false, 3) + SIM_MS(20);
+    }
+    run_trace(t + SIM_MS(20) - sim_now());
+    buttons_get_stats(&s1);
+
+    TEST_CHECK_EQ(s1.events - s0.events, BUTTONS_QUEUE);
+    TEST_CHECK_EQ(s1.dropped - s0.dropped, BUTTONS_QUEUE);
+    for (uint32_t i = 0; i < BUTTONS_QUEUE; i++) {
+        TEST_CHECK(buttons_get(&ev));
+        TEST_CHECK_EQ(ev.pressed, (i & 1) == 0);
+    }
+    TEST_CHECK(!buttons_get(&ev));
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    button_event_t ev;
+
+    sim_add_model(&trace_model);
+    for (uint pin = BUTTONS_PIN_BASE; pin < BUTTONS_PIN_BASE + 9; pin++) {
+        sim_gpio_drive(pin, 0);
+    }
+    // Held at start: only its release is reported
+    sim_gpio_drive(BTN_C, 1);
+    buttons_init((1u << BTN_A) | (1u << BTN_B) | (1u << BTN_C), buttons_changed);
+    sim_run_for(SIM_MS(20));
+    TEST_CHECK(!buttons_get(&ev));
+    trace_bounce(sim_now(), BTN_C, false, 3);
+    run_trace(SIM_MS(30));
+    TEST_CHECK(buttons_get(&ev));
+    TEST_CHECK_EQ(ev.gpio, BTN_C);
+    TEST_CHECK(!ev.pressed);
+    TEST_CHECK(!buttons_get(&ev));
+
+    TEST_RUN(test_bounce);
+    TEST_RUN(test_glitch);
+    TEST_RUN(test_two_buttons);
+    TEST_RUN(test_overflow);
+    return test_report();
+}
@@ -0,0 +1,290 @@
+/**
+ * @file test_disp_perf.c
+ * @brief Flush pipeline profiling: histograms against the panel model's bus times, and the dump record
+ * @note Built for the SPI and the PIO bus, the transfer times must match what the panel saw on both.
+ *       The dump goes to disp_perf_dump.bin (with console noise and a corrupted copy) for the
+ *       test_disp_perf_decode run of disp_perf_decode.py.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "lv_port_disp.h"
+#include "disp_perf.h"
+#include "st7796.h"
+#include "hardware/uart.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         320
+#define VER_RES         480
+#define DUMP_PATH       "disp_perf_dump.bin"
+#define DUMP_MAX        4096
+#define HIST_SIZE       (24 + DISP_PERF_BINS * 4)
+#define REC_SIZE        (12 + DISP_PERF_HIST_NUM * HIST_SIZE + 2)
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t rng = 0x85EBCA6Bu;
+static uint8_t dump[DUMP_MAX];
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static void settle(void)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    disp_engine_stats_t stats;
+
+    do {
+        lv_timer_handler();
+        vTaskDelay(1);
+    } while (disp->inv_p != 0);
+
+    do {
+        vTaskDelay(1);
+        disp_get_engine_stats(&stats);
+    } while (stats.depth != 0 || st7796_is_busy());
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = 0xFFFF;
+
+    while (len--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Request a dump the way the host does and collect it
+ * @return Record length
+ */
+static size_t take_dump(uint8_t *dst)
+{
+    sim_uart_feed((const uint8_t *)"P", 1);
+    disp_perf_poll();
+    return sim_uart_take(dst, REC_SIZE + 1);
+}
+
+/**
+ * @brief Stripes in the panel log: count and summed first-to-last pixel time
+ */
+static void panel_stripes(uint32_t *stripes, uint64_t *bus_ns, uint32_t *pixels)
+{
+    size_t count;
+    const panel_event_t *ev = panel_events(&count);
+    uint64_t first = 0;
+    uint64_t last = 0;
+    bool open = false;
+
+    *stripes = 0;
+    *bus_ns = 0;
+    *pixels = 0;
+    for (size_t i = 0; i <= count; i++) {
+        if (i == count || ev[i].kind == PANEL_EV_CMD) {
+            if (open) {
+                *bus_ns += last - first;
+            }
+            open = i < count && ev[i].value == ST7796_CMD_RAMWR;
+            *stripes += open;
+            first = 0;
+        } else if (open && ev[i].kind == PANEL_EV_PIXEL) {
+            first = first != 0 ? first : ev[i].t_ns;
+            last = ev[i].t_ns;
+            (*pixels)++;
+        }
+    }
+}
+
+/**
+ * @brief Transfer histogram vs the bus: one sample per stripe, each as long as the panel saw it
+ * @note The sample also covers the window commands ahead of the pixels and one pixel time
+ */
+static void test_xfer_vs_panel(void)
+{
+    disp_perf_hist_t xfer, bytes, flushes;
+    uint32_t stripes, pixels;
+    uint64_t bus_ns;
+    uint32_t refreshes = 0;
+
+    panel_clear_log();
+    disp_perf_reset();
+
+    // 1. Full screen, then random boxes
+    lv_obj_invalidate(lv_scr_act());
+    settle();
+    refreshes++;
+    for (uint32_t i = 0; i < 12; i++) {
+        lv_obj_t *box = lv_obj_create(lv_scr_act());
+        lv_obj_set_pos(box, (lv_coord_t)(rand_u32() % (HOR_RES - 40)), (lv_coord_t)(rand_u32() % (VER_RES - 40)));
+        lv_obj_set_size(box, (lv_coord_t)(8 + rand_u32() % 32), (lv_coord_t)(8 + rand_u32() % 32));
+        lv_obj_set_style_bg_color(box, lv_color_hex(rand_u32() & 0xFFFFFF), 0);
+        settle();
+        refreshes++;
+    }
+
+    panel_stripes(&stripes, &bus_ns, &pixels);
+    disp_perf_get(DISP_PERF_XFER_US, &xfer);
+    disp_perf_get(DISP_PERF_FRAME_BYTES, &bytes);
+    disp_perf_get(DISP_PERF_FRAME_FLUSHES, &flushes);
+
+    TEST_CHECK_EQ(xfer.count, stripes);
+    TEST_CHECK_EQ(flushes.count, refreshes);
+    TEST_CHECK_EQ(flushes.sum, stripes);
+    TEST_CHECK_EQ(bytes.sum, (uint64_t)pixels * 2);
+
+    // 2. Per stripe the sample is the bus time plus the window and rounding, never less
+    int64_t diff_ns = (int64_t)xfer.sum * 1000 - (int64_t)bus_ns;
+    printf("%u stripes: panel %.1f us, histogram %.1f us (%+.2f us per stripe)\n", (unsigned)stripes,
+           bus_ns / 1e3, (double)xfer.sum, diff_ns / 1e3 / stripes);
+    TEST_CHECK(stripes > 12);
+    TEST_CHECK_RANGE(diff_ns, 0, (int64_t)stripes * 3000);
+}
+
+/**
+ * @brief The dump record: layout, CRC, and the same numbers as disp_perf_get()
+ */
+static void test_dump_record(void)
+{
+    uint8_t rec[REC_SIZE + 1];
+
+    size_t n = take_dump(rec);
+    TEST_CHECK_EQ(n, REC_SIZE);
+    if (n != REC_SIZE) {
+        return;
+    }
+    TEST_CHECK_EQ(get32(rec), DISP_PERF_MAGIC);
+    TEST_CHECK_EQ(rec[4], DISP_PERF_VERSION);
+    TEST_CHECK_EQ(rec[5], DISP_PERF_HIST_NUM);
+    TEST_CHECK_EQ(rec[6], DISP_PERF_BINS);
+    TEST_CHECK_EQ(crc16(rec, REC_SIZE - 2), rec[REC_SIZE - 2] | (rec[REC_SIZE - 1] << 8));
+
+    for (uint32_t id = 0; id < DISP_PERF_HIST_NUM; id++) {
+        const uint8_t *p = &rec[12 + id * HIST_SIZE];
+        disp_perf_hist_t h;
+        disp_perf_get(id, &h);
+
+        uint32_t binned = 0;
+        for (uint32_t i = 0; i < DISP_PERF_BINS; i++) {
+            binned += get32(&p[24 + i * 4]);
+            TEST_CHECK_EQ(get32(&p[24 + i * 4]), h.bins[i]);
+        }
+        TEST_CHECK_EQ(p[0], id);
+        TEST_CHECK_EQ(get32(&p[4]), h.count);
+        TEST_CHECK_EQ(get32(&p[8]), h.min);
+        TEST_CHECK_EQ(get32(&p[12]), h.max);
+        TEST_CHECK_EQ(get32(&p[16]) | ((uint64_t)get32(&p[20]) << 32), h.sum);
+        TEST_CHECK_EQ(binned, h.count);
+    }
+}
+
+/**
+ * @brief Capture for the decoder: boot noise, the live record, a known one, and a corrupted known one
+ * @note test_disp_perf_decode expects the window histogram of 1..100 and must not show the n=7 one
+ */
+static void test_decoder_capture(void)
+{
+    static const char noise[] = "boot: DPRF console text\r\n";
+    size_t len = 0;
+
+    memcpy(&dump[len], noise, sizeof(noise) - 1);
+    len += sizeof(noise) - 1;
+    len += take_dump(&dump[len]);
+
+    // 1. Window times 1..100 us: 64..95 is one bin of 32
+    disp_perf_reset();
+    for (uint32_t v = 1; v <= 100; v++) {
+        disp_perf_add(DISP_PERF_WINDOW_US, v);
+    }
+    len += take_dump(&dump[len]);
+
+    // 2. Seven samples, then a flipped bin byte: the CRC must reject it
+    disp_perf_reset();
+    for (uint32_t v = 1; v <= 7; v++) {
+        disp_perf_add(DISP_PERF_WINDOW_US, v);
+    }
+    size_t bad = len;
+    len += take_dump(&dump[len]);
+    dump[bad + 12 + DISP_PERF_WINDOW_US * HIST_SIZE + 24 + 4] ^= 0x10;
+
+    FILE *f = fopen(DUMP_PATH, "wb");
+    TEST_CHECK(f != NULL);
+    if (f != NULL) {
+        TEST_CHECK_EQ(fwrite(dump, 1, len, f), len);
+        fclose(f);
+    }
+}
+
+static void lvgl_task(void *param)
+{
+    (void)param;
+
+    lv_init();
+    lv_port_disp_init();
+    settle();
+
+    TEST_RUN(test_xfer_vs_panel);
+    TEST_RUN(test_dump_record);
+    TEST_RUN(test_decoder_capture);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void vApplicationTickHook(void)
+{
+    lv_tick_inc(1);
+}
+
+int main(void)
+{
+    TaskHandle_t task;
+
+#if ST7796_BUS_PIO
+    panel_attach_pio();
+#else
+    panel_attach_spi(0);
+#endif
+    xTaskCreate(lvgl_task, "LVGL", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 1);
+
+    for (uint32_t s = 0; s < 600 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
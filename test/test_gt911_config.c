@@ -0,0 +1,311 @@
+/**
+ * @file test_gt911_config.c
+ * @brief GT911 configuration block: decoding, encoding, checksum and the fresh flag write
+ * @note The config image loaded into the GT911 model has its checksum computed here, apart from
+ *       the driver's. The model takes a block only when the write sets the fresh flag, the
+ *       checksum holds and the version didn't go backwards, and counts what it took or refused.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "ctp.h"
+#include "gt911.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMAGE_LEN       (GT911_CONFIG_LEN + 1)      // Block and checksum, 0x8047-0x80FF
+#define IMG(reg)        ((reg) - GT911_REG_CONFIG_VERSION)
+
+#define IMAGE_VERSION   0x41
+#define IMAGE_REFRESH   (0x30 | 5)                  // 10 ms, upper bits set
+#define IMAGE_NOISE     (0xA0 | 3)
+#define IMAGE_TOUCH     80
+#define IMAGE_LEAVE     40
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t applied;
+    uint32_t rejected;
+} xfers_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* 0x8140-0x814A: product ID "911", firmware 0x1060, 320 x 480, vendor 2 */
+static const uint8_t info_block[GT911_INFO_LEN] = {
+    '9', '1', '1', 0, 0x60, 0x10, 0x40, 0x01, 0xE0, 0x01, 0x02,
+};
+
+static uint8_t image[IMAGE_LEN];
+static uint32_t rng = 0x2545F491u;
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+/**
+ * @brief A config image: random bytes, the tunables above, the checksum
+ * @param good false: checksum off by one
+ */
+static void load_image(bool good)
+{
+    const ctp_fixture_t fixture = { GT911_REG_CONFIG_VERSION, IMAGE_LEN, image };
+    uint8_t sum = 0;
+
+    rng = 0x2545F491u;
+    for (uint32_t i = 0; i < GT911_CONFIG_LEN; i++) {
+        image[i] = (uint8_t)rand_u32();
+    }
+    image[IMG(GT911_REG_CONFIG_VERSION)] = IMAGE_VERSION;
+    image[IMG(GT911_REG_REFRESH_RATE)] = IMAGE_REFRESH;
+    image[IMG(GT911_REG_NOISE_REDUCTION)] = IMAGE_NOISE;
+    image[IMG(GT911_REG_TOUCH_LEVEL)] = IMAGE_TOUCH;
+    image[IMG(GT911_REG_LEAVE_LEVEL)] = IMAGE_LEAVE;
+    for (uint32_t i = 0; i < GT911_CONFIG_LEN; i++) {
+        sum += image[i];
+    }
+    image[GT911_CONFIG_LEN] = (uint8_t)(0x100 - sum + (good ? 0 : 1));
+    ctp_load(&fixture, 1);
+    ctp_regs()[GT911_REG_CONFIG_FRESH] = 0;
+}
+
+static xfers_t xfers(void)
+{
+    ctp_stats_t s;
+
+    ctp_get_stats(&s);
+    return (xfers_t){ s.reads, s.writes, s.configs_applied, s.configs_rejected };
+}
+
+static xfers_t xfers_since(xfers_t before)
+{
+    xfers_t now = xfers();
+
+    return (xfers_t){ now.reads - before.reads, now.writes - before.writes,
+                      now.applied - before.applied, now.rejected - before.rejected };
+}
+
+/**
+ * @brief Byte sum of the block and its checksum in the register map
+ */
+static uint8_t regs_sum(void)
+{
+    const uint8_t *regs = ctp_regs();
+    uint8_t sum = 0;
+
+    for (uint32_t reg = GT911_REG_CONFIG_VERSION; reg <= GT911_REG_CONFIG_CHKSUM; reg++) {
+        sum += regs[reg];
+    }
+    return sum;
+}
+
+/**
+ * @brief The image decodes in one read
+ */
+static void test_get(void)
+{
+    gt911_config_t cfg;
+
+    load_image(true);
+    xfers_t before = xfers();
+    TEST_CHECK(gt911_config_get(&cfg));
+    xfers_t x = xfers_since(before);
+
+    TEST_CHECK_EQ(cfg.version, IMAGE_VERSION);
+    TEST_CHECK_EQ(cfg.report_ms, GT911_REPORT_MS_MIN + (IMAGE_REFRESH & 0x0F));
+    TEST_CHECK_EQ(cfg.touch_level, IMAGE_TOUCH);
+    TEST_CHECK_EQ(cfg.leave_level, IMAGE_LEAVE);
+    TEST_CHECK_EQ(cfg.noise_reduction, IMAGE_NOISE & 0x0F);
+    TEST_CHECK_EQ(x.reads, 1);
+    TEST_CHECK_EQ(x.writes, 1);
+}
+
+/**
+ * @brief A change is one write of the whole block with a good checksum and the fresh flag: the
+ *        tunables are encoded in place, every other bit of the image is kept, the version too
+ */
+static void test_set(void)
+{
+    const gt911_config_t cfg = { .report_ms = 8, .touch_level = 90, .leave_level = 50, .noise_reduction = 7 };
+    const uint8_t *regs = ctp_regs();
+    gt911_stats_t s0, s1;
+
+    load_image(true);
+    gt911_get_stats(&s0);
+    xfers_t before = xfers();
+    TEST_CHECK(gt911_config_set(&cfg));
+    xfers_t x = xfers_since(before);
+    gt911_get_stats(&s1);
+
+    // Read back for the patch, one write, taken by the GT911
+    TEST_CHECK_EQ(x.reads, 1);
+    TEST_CHECK_EQ(x.writes, 2);
+    TEST_CHECK_EQ(x.applied, 1);
+    TEST_CHECK_EQ(x.rejected, 0);
+    // The 188-byte write is well within its deadline
+    TEST_CHECK_EQ(s1.timeouts, s0.timeouts);
+    TEST_CHECK_EQ(s1.errors, s0.errors);
+
+    TEST_CHECK_EQ(regs[GT911_REG_REFRESH_RATE], (IMAGE_REFRESH & 0xF0) | (8 - GT911_REPORT_MS_MIN));
+    TEST_CHECK_EQ(regs[GT911_REG_NOISE_REDUCTION], (IMAGE_NOISE & 0xF0) | 7);
+    TEST_CHECK_EQ(regs[GT911_REG_TOUCH_LEVEL], 90);
+    TEST_CHECK_EQ(regs[GT911_REG_LEAVE_LEVEL], 50);
+    TEST_CHECK_EQ(regs[GT911_REG_CONFIG_VERSION], IMAGE_VERSION);
+    TEST_CHECK_EQ(regs_sum(), 0);
+    TEST_CHECK_EQ(regs[GT911_REG_CONFIG_FRESH], 1);
+
+    uint32_t diff = 0;
+    for (uint32_t i = 0; i < GT911_CONFIG_LEN; i++) {
+        uint16_t reg = (uint16_t)(GT911_REG_CONFIG_VERSION + i);
+        if (reg != GT911_REG_REFRESH_RATE && reg != GT911_REG_NOISE_REDUCTION &&
+            reg != GT911_REG_TOUCH_LEVEL && reg != GT911_REG_LEAVE_LEVEL && regs[reg] != image[i]) {
+            diff++;
+        }
+    }
+    TEST_CHECK_EQ(diff, 0);
+}
+
+/**
+ * @brief Every report period round-trips, each write taken
+ */
+static void test_report_periods(void)
+{
+    gt911_config_t cfg = { .touch_level = IMAGE_TOUCH, .leave_level = IMAGE_LEAVE, .noise_reduction = 3 };
+    gt911_config_t got;
+
+    load_image(true);
+    xfers_t before = xfers();
+    for (uint8_t ms = GT911_REPORT_MS_MIN; ms <= GT911_REPORT_MS_MAX; ms++) {
+        cfg.report_ms = ms;
+        TEST_CHECK(gt911_config_set(&cfg));
+        TEST_CHECK(gt911_config_get(&got));
+        TEST_CHECK_EQ(got.report_ms, ms);
+        TEST_CHECK_EQ(ctp_regs()[GT911_REG_REFRESH_RATE] & 0xF0, IMAGE_REFRESH & 0xF0);
+    }
+    xfers_t x = xfers_since(before);
+
+    TEST_CHECK_EQ(x.applied, GT911_REPORT_MS_MAX - GT911_REPORT_MS_MIN + 1);
+    TEST_CHECK_EQ(x.rejected, 0);
+}
+
+/**
+ * @brief The settings the GT911 already holds are not written again
+ */
+static void test_unchanged(void)
+{
+    gt911_config_t cfg;
+
+    load_image(true);
+    TEST_CHECK(gt911_config_get(&cfg));
+    xfers_t before = xfers();
+    TEST_CHECK(gt911_config_set(&cfg));
+    xfers_t x = xfers_since(before);
+
+    TEST_CHECK_EQ(x.reads, 1);
+    TEST_CHECK_EQ(x.writes, 1);
+    TEST_CHECK_EQ(x.applied, 0);
+    TEST_CHECK_EQ(ctp_regs()[GT911_REG_CONFIG_FRESH], 0);
+}
+
+/**
+ * @brief A block failing its checksum is neither decoded nor patched
+ */
+static void test_bad_checksum(void)
+{
+    const gt911_config_t cfg = { .report_ms = 8, .touch_level = 90, .leave_level = 50, .noise_reduction = 7 };
+    gt911_config_t got;
+
+    load_image(false);
+    xfers_t before = xfers();
+    TEST_CHECK(!gt911_config_get(&got));
+    TEST_CHECK(!gt911_config_set(&cfg));
+    xfers_t x = xfers_since(before);
+
+    TEST_CHECK_EQ(x.reads, 2);
+    TEST_CHECK_EQ(x.writes, 2);
+    TEST_CHECK_EQ(x.applied + x.rejected, 0);
+    TEST_CHECK_EQ(memcmp(&ctp_regs()[GT911_REG_CONFIG_VERSION], image, IMAGE_LEN), 0);
+}
+
+/**
+ * @brief Out of range settings are refused before any transaction
+ */
+static void test_invalid(void)
+{
+    static const gt911_config_t bad[] = {
+        { .report_ms = GT911_REPORT_MS_MIN - 1, .touch_level = 90, .leave_level = 50 },
+        { .report_ms = GT911_REPORT_MS_MAX + 1, .touch_level = 90, .leave_level = 50 },
+        { .report_ms = 10, .touch_level = 90, .leave_level = 50, .noise_reduction = 16 },
+        { .report_ms = 10, .touch_level = 50, .leave_level = 50 },
+        { .report_ms = 10, .touch_level = 40, .leave_level = 50 },
+    };
+
+    load_image(true);
+    xfers_t before = xfers();
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        TEST_CHECK(!gt911_config_set(&bad[i]));
+    }
+    xfers_t x = xfers_since(before);
+
+    TEST_CHECK_EQ(x.reads + x.writes, 0);
+}
+
+static void test_task(void *param)
+{
+    (void)param;
+
+    TEST_RUN(test_get);
+    TEST_RUN(test_set);
+    TEST_RUN(test_report_periods);
+    TEST_RUN(test_unchanged);
+    TEST_RUN(test_bad_checksum);
+    TEST_RUN(test_invalid);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    TaskHandle_t task;
+    const ctp_fixture_t info = { GT911_REG_PRODUCT_ID1, sizeof(info_block), info_block };
+
+    ctp_attach();
+    ctp_load(&info, 1);
+    gt911_init();
+
+    xTaskCreate(test_task, "touch", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 0);
+
+    for (uint32_t s = 0; s < 100 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
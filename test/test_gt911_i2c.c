@@ -0,0 +1,255 @@
+/**
+ * @file test_gt911_i2c.c
+ * @brief GT911 I2C engine: DMA-fed transactions, completion interrupt, NAK and hung bus handling
+ * @note gt911_init() and a hung bus run from main() before the scheduler like the firmware (spin
+ *       wait), the rest from a task that must sleep while the bus works: a low priority load task
+ *       on the same core keeps counting meanwhile.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "ctp.h"
+#include "gt911.h"
+#include "hardware/gpio.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LOAD_SLICE_US   20      // Busy slice of the load task
+
+/* Bus time at the SDK's 400 kHz (399361 Hz): START + address = 10 bits, 9 per byte, 1 for STOP */
+#define BIT_NS          2504
+#define READ_BITS(n)    (10 + 2 * 9 + 10 + (n) * 9 + 1)
+#define WRITE_BITS(n)   (10 + (2 + (n)) * 9 + 1)
+
+/* Timeout of the first frame read: address twice, register, status and one point at 9 clocks per
+ * byte of the nominal rate, plus the margin */
+#define HANG_BYTES      (2 + 2 + GT911_TOUCH_LEN)
+#define HANG_DEADLINE_US \
+    ((HANG_BYTES * 9 * 1000000 + GT911_I2C_BAUDRATE - 1) / GT911_I2C_BAUDRATE + GT911_I2C_TIMEOUT_US)
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static bool init_ok = false;
+static gt911_stats_t init_stats;
+static volatile uint32_t load_slices = 0;
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void load_task(void *param)
+{
+    (void)param;
+
+    for (;;) {
+        sim_cpu_ns(SIM_US(LOAD_SLICE_US));
+        load_slices++;
+    }
+}
+
+/**
+ * @brief One new single-point frame in the register map
+ */
+static void set_frame(uint16_t x, uint16_t y)
+{
+    uint8_t *regs = ctp_regs();
+
+    regs[GT911_REG_STATUS] = GT911_STATUS_BUF_READY | 1;
+    regs[GT911_REG_TRACK_ID1] = 0;
+    regs[GT911_REG_PT1_X_L] = x & 0xFF;
+    regs[GT911_REG_PT1_X_H] = x >> 8;
+    regs[GT911_REG_PT1_Y_L] = y & 0xFF;
+    regs[GT911_REG_PT1_Y_H] = y >> 8;
+}
+
+/**
+ * @brief Info block read before the scheduler started
+ */
+static void test_init(void)
+{
+    gt911_dev_t *dev = gt911_get_dev_info();
+
+    TEST_CHECK(init_ok);
+    TEST_CHECK_EQ(strcmp(dev->product_id, "911"), 0);
+    TEST_CHECK_EQ(dev->max_x, 320);
+    TEST_CHECK_EQ(dev->max_y, 480);
+    TEST_CHECK_EQ(init_stats.xfers, 1);
+    TEST_CHECK_EQ(init_stats.errors + init_stats.timeouts, 0);
+}
+
+/**
+ * @brief Hung bus before the scheduler: the spin wait gives up at the transaction's deadline
+ */
+static void test_hang_spin(void)
+{
+    gt911_touch_t touch;
+    gt911_stats_t before, after;
+    ctp_stats_t c0, c1;
+
+    gt911_get_stats(&before);
+    ctp_get_stats(&c0);
+    set_frame(50, 60);
+    ctp_fault(CTP_FAULT_HANG);
+    uint64_t t0 = sim_now();
+    TEST_CHECK(!gt911_read_points(&touch));
+    uint64_t ns = sim_now() - t0;
+    gt911_get_stats(&after);
+    ctp_get_stats(&c1);
+
+    printf("hang (spin): failed after %.1f us, deadline %u us\n", ns / 1e3, (unsigned)HANG_DEADLINE_US);
+    TEST_CHECK_RANGE(ns, SIM_US(HANG_DEADLINE_US), SIM_US(HANG_DEADLINE_US) + SIM_US(200));
+    TEST_CHECK_EQ(after.timeouts, before.timeouts + 1);
+    TEST_CHECK_EQ(after.recoveries, before.recoveries + 1);
+    TEST_CHECK_EQ(c1.recover_clocks - c0.recover_clocks, CTP_HANG_CLOCKS);
+    TEST_CHECK(gpio_get(GT911_PIN_SDA));
+
+    TEST_CHECK(gt911_read_points(&touch));
+    TEST_CHECK_EQ(touch.points[0].x, 50);
+    TEST_CHECK_EQ(touch.points[0].y, 60);
+}
+
+/**
+ * @brief A frame read and its status clear take bus time only, the caller sleeps through it
+ */
+static void test_read_sleeps(void)
+{
+    gt911_touch_t touch;
+
+    set_frame(123, 456);
+    uint32_t slices = load_slices;
+    uint64_t t0 = sim_now();
+    TEST_CHECK(gt911_read_points(&touch));
+    uint64_t ns = sim_now() - t0;
+    uint64_t bus_ns = (uint64_t)(READ_BITS(GT911_POINT_SIZE + 1 - 2) + 2 * 9 + WRITE_BITS(1)) * BIT_NS;
+
+    printf("read + clear: %.1f us (bus %.1f us), load ran %u slices\n", ns / 1e3, bus_ns / 1e3,
+           (unsigned)(load_slices - slices));
+    TEST_CHECK_EQ(touch.count, 1);
+    TEST_CHECK_EQ(touch.points[0].x, 123);
+    TEST_CHECK_EQ(touch.points[0].y, 456);
+    TEST_CHECK_EQ(ctp_regs()[GT911_REG_STATUS], 0);
+    TEST_CHECK_RANGE(ns, bus_ns, bus_ns + SIM_US(LOAD_SLICE_US) * 2);
+    TEST_CHECK(load_slices - slices >= bus_ns / SIM_US(LOAD_SLICE_US) - 2);
+}
+
+/**
+ * @brief Address and data NAKs fail fast, without recovery, and the next read works
+ */
+static void test_nak(void)
+{
+    static const ctp_fault_t faults[] = { CTP_FAULT_NAK_ADDR, CTP_FAULT_NAK_DATA };
+    gt911_touch_t touch;
+    gt911_stats_t before, after;
+
+    for (uint32_t i = 0; i < 2; i++) {
+        gt911_get_stats(&before);
+        set_frame(10, 20);
+        ctp_fault(faults[i]);
+        uint64_t t0 = sim_now();
+        TEST_CHECK(!gt911_read_points(&touch));
+        uint64_t ns = sim_now() - t0;
+        gt911_get_stats(&after);
+
+        printf("NAK %u: failed after %.1f us\n", (unsigned)i, ns / 1e3);
+        TEST_CHECK(ns < SIM_US(100));
+        TEST_CHECK_EQ(after.errors, before.errors + 1);
+        TEST_CHECK_EQ(after.timeouts, before.timeouts);
+        TEST_CHECK_EQ(after.recoveries, before.recoveries);
+
+        TEST_CHECK(gt911_read_points(&touch));
+        TEST_CHECK_EQ(touch.points[0].x, 10);
+        TEST_CHECK_EQ(touch.points[0].y, 20);
+    }
+}
+
+/**
+ * @brief Hung bus: timeout after the transaction's deadline asleep (rounded up to ticks), recovery
+ *        frees SDA, next read works
+ */
+static void test_hang(void)
+{
+    gt911_touch_t touch;
+    gt911_stats_t before, after;
+    ctp_stats_t c0, c1;
+
+    gt911_get_stats(&before);
+    ctp_get_stats(&c0);
+    set_frame(300, 400);
+    ctp_fault(CTP_FAULT_HANG);
+    uint32_t slices = load_slices;
+    uint64_t t0 = sim_now();
+    TEST_CHECK(!gt911_read_points(&touch));
+    uint64_t ns = sim_now() - t0;
+    gt911_get_stats(&after);
+    ctp_get_stats(&c1);
+
+    printf("hang: failed after %.1f us, load ran %u slices, %u recovery clocks\n", ns / 1e3,
+           (unsigned)(load_slices - slices), (unsigned)(c1.recover_clocks - c0.recover_clocks));
+    TEST_CHECK_RANGE(ns, SIM_US(HANG_DEADLINE_US), SIM_MS((HANG_DEADLINE_US + 999) / 1000 + 1) + SIM_US(200));
+    TEST_CHECK_EQ(after.timeouts, before.timeouts + 1);
+    TEST_CHECK_EQ(after.recoveries, before.recoveries + 1);
+    TEST_CHECK_EQ(c1.hangs - c0.hangs, 1);
+    TEST_CHECK_EQ(c1.recover_clocks - c0.recover_clocks, CTP_HANG_CLOCKS);
+    TEST_CHECK(gpio_get(GT911_PIN_SDA));
+    // Asleep for the timeout: the load task had the core (the recovery clocks are busy waits)
+    TEST_CHECK(load_slices - slices >= HANG_DEADLINE_US / LOAD_SLICE_US - 2);
+
+    TEST_CHECK(gt911_read_points(&touch));
+    TEST_CHECK_EQ(touch.points[0].x, 300);
+    TEST_CHECK_EQ(touch.points[0].y, 400);
+}
+
+static void test_task(void *param)
+{
+    (void)param;
+
+    TEST_RUN(test_init);
+    TEST_RUN(test_read_sleeps);
+    TEST_RUN(test_nak);
+    TEST_RUN(test_hang);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    TaskHandle_t task;
+    uint8_t *regs = ctp_regs();
+
+    ctp_attach();
+    memcpy(&regs[GT911_REG_PRODUCT_ID1], "911", 4);
+    regs[GT911_REG_X_RES_L] = 320 & 0xFF;
+    regs[GT911_REG_X_RES_H] = 320 >> 8;
+    regs[GT911_REG_Y_RES_L] = 480 & 0xFF;
+    regs[GT911_REG_Y_RES_H] = 480 >> 8;
+    init_ok = gt911_init();
+    gt911_get_stats(&init_stats);
+    TEST_RUN(test_hang_spin);
+
+    xTaskCreate(test_task, "touch", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 0);
+    xTaskCreate(load_task, "load", 1024, NULL, 1, &task);
+    vTaskCoreAffinitySet(task, 1 << 0);
+
+    for (uint32_t s = 0; s < 100 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
@@ -0,0 +1,281 @@
+/**
+ * @file test_gt911_parse.c
+ * @brief GT911 burst reads and their parser against register map fixtures
+ * @note Each fixture is a register image loaded into the GT911 model; the checks cover the
+ *       decoded values and the transactions it took (one burst per block, a clear per new frame).
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "ctp.h"
+#include "gt911.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define FIXTURE(reg, bytes)     { (reg), sizeof(bytes), (bytes) }
+
+/* Bus time at the SDK's 400 kHz (399361 Hz): START + address = 10 bits, 9 per byte, 1 for STOP */
+#define BIT_NS          2504
+#define READ_BITS(n)    (10 + 2 * 9 + 10 + (n) * 9 + 1)
+#define WRITE_BITS(n)   (10 + (2 + (n)) * 9 + 1)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t reads;
+    uint32_t writes;
+} xfers_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* 0x8140-0x814A: product ID "911", firmware 0x1060, 320 x 480, vendor 2 */
+static const uint8_t info_block[GT911_INFO_LEN] = {
+    '9', '1', '1', 0, 0x60, 0x10, 0x40, 0x01, 0xE0, 0x01, 0x02,
+};
+
+/* Point slots never reported: parsing them would show 0xEEEE */
+static const uint8_t junk_points[GT911_MAX_POINTS * GT911_POINT_SIZE] = {
+    [0 ... GT911_MAX_POINTS * GT911_POINT_SIZE - 1] = 0xEE,
+};
+
+/* 0x814E on: status, then per point track ID, X, Y, size (low byte first), reserved */
+static const uint8_t frame_one[] = {
+    0x81, 3, 0x2C, 0x01, 0xC8, 0x00, 0x20, 0x00, 0x00,
+};
+static const uint8_t frame_five[] = {
+    0x85,
+    0, 0x0A, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00,
+    1, 0x3F, 0x01, 0xDF, 0x01, 0x11, 0x00, 0x00,
+    2, 0x00, 0x01, 0x00, 0x01, 0x12, 0x00, 0x00,
+    7, 0xA0, 0x00, 0x40, 0x01, 0x13, 0x01, 0x00,
+    9, 0x01, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0x00,
+};
+static const uint8_t frame_large_key[] = {
+    0x80 | GT911_STATUS_LARGE | GT911_STATUS_HAVE_KEY | 2,
+    4, 0x64, 0x00, 0xC8, 0x00, 0x30, 0x00, 0x00,
+    5, 0x2C, 0x01, 0x90, 0x01, 0x31, 0x00, 0x00,
+};
+static const uint8_t frame_released[] = { 0x80 };
+static const uint8_t frame_stale[] = { 0x01, 6, 0x11, 0x00, 0x22, 0x00, 0x05, 0x00, 0x00 };
+static const uint8_t frame_bad_count[] = { 0x80 | 0x0F };
+
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static xfers_t xfers(void)
+{
+    ctp_stats_t s;
+
+    ctp_get_stats(&s);
+    return (xfers_t){ s.reads, s.writes };
+}
+
+/**
+ * @brief Load a touch frame over junk point slots, read it
+ * @return Transactions it took, the bus time in *ns
+ */
+static xfers_t read_frame(const uint8_t *frame, uint16_t len, gt911_touch_t *touch, uint64_t *ns)
+{
+    const ctp_fixture_t fixture[] = {
+        FIXTURE(GT911_REG_TRACK_ID1, junk_points),
+        { GT911_REG_STATUS, len, frame },
+    };
+
+    ctp_load(fixture, 2);
+    xfers_t before = xfers();
+    uint64_t t0 = sim_now();
+    TEST_CHECK(gt911_read_points(touch));
+    *ns = sim_now() - t0;
+    xfers_t after = xfers();
+    return (xfers_t){ after.reads - before.reads, after.writes - before.writes };
+}
+
+static void check_point(const gt911_point_t *p, uint8_t id, uint16_t x, uint16_t y, uint16_t size)
+{
+    TEST_CHECK_EQ(p->id, id);
+    TEST_CHECK_EQ(p->x, x);
+    TEST_CHECK_EQ(p->y, y);
+    TEST_CHECK_EQ(p->size, size);
+}
+
+/**
+ * @brief Info block in one transaction at init (from main())
+ */
+static void test_info(void)
+{
+    gt911_dev_t *dev = gt911_get_dev_info();
+    xfers_t x = xfers();
+
+    TEST_CHECK(dev->initialized);
+    TEST_CHECK_EQ(strcmp(dev->product_id, "911"), 0);
+    TEST_CHECK_EQ(dev->max_x, 320);
+    TEST_CHECK_EQ(dev->max_y, 480);
+    TEST_CHECK_EQ(x.reads, 1);
+    TEST_CHECK_EQ(x.writes, 1);
+}
+
+/**
+ * @brief One point: status and point in one burst, then the clear
+ */
+static void test_one_point(void)
+{
+    gt911_touch_t touch;
+    uint64_t ns;
+
+    xfers_t x = read_frame(frame_one, sizeof(frame_one), &touch, &ns);
+    uint64_t bus_ns = (uint64_t)(READ_BITS(GT911_TOUCH_LEN) + WRITE_BITS(1)) * BIT_NS;
+
+    printf("1 point: %.1f us\n", ns / 1e3);
+    TEST_CHECK_EQ(touch.count, 1);
+    check_point(&touch.points[0], 3, 300, 200, 32);
+    TEST_CHECK_EQ(x.reads, 1);
+    TEST_CHECK_EQ(x.writes, 2);
+    TEST_CHECK_EQ(ctp_regs()[GT911_REG_STATUS], 0);
+    TEST_CHECK_RANGE(ns, bus_ns, bus_ns + SIM_US(5));
+}
+
+/**
+ * @brief Five points: the other four in a second burst, all fields little-endian
+ */
+static void test_five_points(void)
+{
+    gt911_touch_t touch;
+    uint64_t ns;
+
+    xfers_t x = read_frame(frame_five, sizeof(frame_five), &touch, &ns);
+    uint64_t bus_ns = (uint64_t)(READ_BITS(GT911_TOUCH_LEN) + READ_BITS(4 * GT911_POINT_SIZE) +
+                                 WRITE_BITS(1)) * BIT_NS;
+
+    printf("5 points: %.1f us\n", ns / 1e3);
+    TEST_CHECK_EQ(touch.count, 5);
+    check_point(&touch.points[0], 0, 10, 20, 16);
+    check_point(&touch.points[1], 1, 319, 479, 17);
+    check_point(&touch.points[2], 2, 256, 256, 18);
+    check_point(&touch.points[3], 7, 160, 320, 275);
+    check_point(&touch.points[4], 9, 1, 2, 0xFFFF);
+    TEST_CHECK_EQ(x.reads, 2);
+    TEST_CHECK_EQ(x.writes, 3);
+    TEST_CHECK_RANGE(ns, bus_ns, bus_ns + SIM_US(5));
+}
+
+/**
+ * @brief Flag bits next to the count don't change it
+ */
+static void test_status_flags(void)
+{
+    gt911_touch_t touch;
+    uint64_t ns;
+
+    read_frame(frame_large_key, sizeof(frame_large_key), &touch, &ns);
+    TEST_CHECK_EQ(touch.count, 2);
+    check_point(&touch.points[0], 4, 100, 200, 48);
+    check_point(&touch.points[1], 5, 300, 400, 49);
+}
+
+/**
+ * @brief No new frame: one read, no clear, the previous frame again
+ */
+static void test_stale(void)
+{
+    gt911_touch_t prev, touch;
+    uint64_t ns;
+
+    read_frame(frame_one, sizeof(frame_one), &prev, &ns);
+    xfers_t x = read_frame(frame_stale, sizeof(frame_stale), &touch, &ns);
+
+    TEST_CHECK_EQ(x.reads, 1);
+    TEST_CHECK_EQ(x.writes, 1);
+    TEST_CHECK_EQ(touch.frame, prev.frame);
+    TEST_CHECK_EQ(touch.count, 1);
+    check_point(&touch.points[0], 3, 300, 200, 32);
+    TEST_CHECK_EQ(ctp_regs()[GT911_REG_STATUS], frame_stale[0]);
+}
+
+/**
+ * @brief Release and an impossible count: no points, the frame is still consumed
+ */
+static void test_release(void)
+{
+    gt911_touch_t touch;
+    uint16_t x, y;
+    bool pressed;
+    uint64_t ns;
+
+    read_frame(frame_one, sizeof(frame_one), &touch, &ns);
+    uint32_t frame = touch.frame;
+
+    xfers_t n = read_frame(frame_released, sizeof(frame_released), &touch, &ns);
+    TEST_CHECK_EQ(touch.count, 0);
+    TEST_CHECK_EQ(touch.frame, frame + 1);
+    TEST_CHECK_EQ(n.writes, 2);
+
+    n = read_frame(frame_bad_count, sizeof(frame_bad_count), &touch, &ns);
+    TEST_CHECK_EQ(touch.count, 0);
+    TEST_CHECK_EQ(touch.frame, frame + 2);
+    TEST_CHECK_EQ(n.reads, 1);
+    TEST_CHECK_EQ(ctp_regs()[GT911_REG_STATUS], 0);
+
+    // gt911_read_touch(): last coordinates kept after release
+    const ctp_fixture_t one = FIXTURE(GT911_REG_STATUS, frame_one);
+    ctp_load(&one, 1);
+    TEST_CHECK(gt911_read_touch(&x, &y, &pressed));
+    TEST_CHECK(pressed);
+    const ctp_fixture_t released = FIXTURE(GT911_REG_STATUS, frame_released);
+    ctp_load(&released, 1);
+    TEST_CHECK(gt911_read_touch(&x, &y, &pressed));
+    TEST_CHECK(!pressed);
+    TEST_CHECK_EQ(x, 300);
+    TEST_CHECK_EQ(y, 200);
+}
+
+static void test_task(void *param)
+{
+    (void)param;
+
+    TEST_RUN(test_info);
+    TEST_RUN(test_one_point);
+    TEST_RUN(test_five_points);
+    TEST_RUN(test_status_flags);
+    TEST_RUN(test_stale);
+    TEST_RUN(test_release);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    TaskHandle_t task;
+    const ctp_fixture_t info = FIXTURE(GT911_REG_PRODUCT_ID1, info_block);
+
+    ctp_attach();
+    ctp_load(&info, 1);
+    gt911_init();
+
+    xTaskCreate(test_task, "touch", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 0);
+
+    for (uint32_t s = 0; s < 100 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
@@ -0,0 +1,222 @@
+/**
+ * @file test_joystick.c
+ * @brief Joystick sampling: filter output and notification rate on synthetic ADC streams
+ * @note The ADC model converts X and Y in turn at JOYSTICK_SAMPLE_HZ, each result taken from a
+ *       scripted stick position (level plus slope) with triangular noise. The callback counts
+ *       notifications and the distance of the reported position to the stick at that moment.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "joystick.h"
+#include "hardware/adc.h"
+#include <math.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CENTER          2048
+#define BLOCK_NS        ((uint64_t)JOYSTICK_BLOCK * 1000000000u / JOYSTICK_SAMPLE_HZ)
+#define BLOCKS_PER_S    (JOYSTICK_SAMPLE_HZ / JOYSTICK_BLOCK)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Scripted position of one axis: level + slope * (t - t0), plus noise
+ */
+typedef struct {
+    double level;
+    double slope;               // LSB per second
+    uint64_t t0;
+    uint32_t noise;             // Peak noise (LSB)
+} axis_t;
+
+typedef struct {
+    uint32_t changes;
+    uint64_t first_ns;          // Time of the first notification, SIM_NEVER if none
+    uint64_t last_ns;
+    double max_err;             // Largest |reported - stick| at a notification
+} notify_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static axis_t axes[2];
+static notify_t notify;
+static uint32_t rng = 0x2545F491u;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static double stick(int axis)
+{
+    const axis_t *a = &axes[axis];
+
+    return a->level + a->slope * (double)(sim_now() - a->t0) / 1e9;
+}
+
+/**
+ * @brief ADC source: the stick plus triangular noise of +-noise LSB
+ */
+static uint16_t adc_source(uint input, void *ctx)
+{
+    (void)ctx;
+    int axis = input == JOYSTICK_ADC_X ? 0 : 1;
+    int32_t n = (int32_t)axes[axis].noise;
+    int32_t noise = n > 0 ? (int32_t)(rand_u32() % (n + 1) + rand_u32() % (n + 1)) - n : 0;
+    int32_t v = (int32_t)lround(stick(axis)) + noise;
+
+    return (uint16_t)(v < 0 ? 0 : v > 4095 ? 4095 : v);
+}
+
+static void joystick_changed(void)
+{
+    uint16_t x, y;
+
+    joystick_get(&x, &y);
+    double ex = fabs(x - stick(0));
+    double ey = fabs(y - stick(1));
+    double err = ex > ey ? ex : ey;
+
+    notify.changes++;
+    if (notify.first_ns == SIM_NEVER) {
+        notify.first_ns = sim_now();
+    }
+    notify.last_ns = sim_now();
+    notify.max_err = err > notify.max_err ? err : notify.max_err;
+}
+
+static void set_axis(int axis, double level, double slope, uint32_t noise)
+{
+    axes[axis] = (axis_t){ level, slope, sim_now(), noise };
+}
+
+static void notify_reset(void)
+{
+    notify = (notify_t){ .first_ns = SIM_NEVER };
+}
+
+/**
+ * @brief Centered stick with a few LSB of noise: one notification (the first position), the
+ *        output on the center, one filter step per block and no ADC result lost
+ */
+static void test_rest(void)
+{
+    joystick_stats_t s;
+    uint16_t x, y;
+
+    set_axis(0, CENTER, 0, 8);
+    set_axis(1, CENTER, 0, 8);
+    notify_reset();
+    joystick_init(joystick_changed);
+    sim_run_for(SIM_MS(1000));
+    joystick_get_stats(&s);
+    joystick_get(&x, &y);
+
+    printf("rest: %u blocks, %u changes, at (%u, %u)\n", (unsigned)s.blocks, (unsigned)s.changes, x, y);
+    TEST_CHECK_RANGE(s.blocks, BLOCKS_PER_S - 1, BLOCKS_PER_S);
+    TEST_CHECK_EQ(s.changes, 1);
+    TEST_CHECK_EQ(notify.changes, 1);
+    TEST_CHECK_RANGE(x, CENTER - 2, CENTER + 2);
+    TEST_CHECK_RANGE(y, CENTER - 2, CENTER + 2);
+    TEST_CHECK_EQ(sim_adc_get_overruns(), 0);
+}
+
+/**
+ * @brief Noise well past the hysteresis on the raw samples of the resting stick: averaged and
+ *        smoothed away, no notification in two seconds
+ */
+static void test_noise(void)
+{
+    uint16_t x, y;
+
+    set_axis(0, CENTER, 0, 60);
+    set_axis(1, CENTER, 0, 60);
+    notify_reset();
+    sim_run_for(SIM_MS(2000));
+    joystick_get(&x, &y);
+
+    printf("noise +-60: %u changes, at (%u, %u)\n", (unsigned)notify.changes, x, y);
+    TEST_CHECK_EQ(notify.changes, 0);
+    TEST_CHECK_RANGE(x, CENTER - 2, CENTER + 2);
+    TEST_CHECK_RANGE(y, CENTER - 2, CENTER + 2);
+}
+
+/**
+ * @brief A flick on X: noticed within two blocks, settled on the new position with a bounded
+ *        number of notifications, Y (converted in between) untouched
+ */
+static void test_step(void)
+{
+    uint16_t x, y;
+
+    set_axis(0, CENTER, 0, 8);
+    set_axis(1, CENTER, 0, 8);
+    sim_run_for(SIM_MS(300));
+    notify_reset();
+    uint64_t t0 = sim_now();
+    set_axis(0, 3500, 0, 8);
+    sim_run_for(SIM_MS(1000));
+    joystick_get(&x, &y);
+
+    printf("step: first change after %.1f ms, %u changes, settled %.0f ms after the step, at (%u, %u)\n",
+           (notify.first_ns - t0) / 1e6, (unsigned)notify.changes, (notify.last_ns - t0) / 1e6, x, y);
+    TEST_CHECK(notify.first_ns - t0 <= 2 * BLOCK_NS);
+    TEST_CHECK(notify.changes <= 20);
+    TEST_CHECK(notify.last_ns - t0 <= SIM_MS(300));
+    TEST_CHECK_RANGE(x, 3500 - JOYSTICK_HYSTERESIS, 3500 + JOYSTICK_HYSTERESIS);
+    TEST_CHECK_RANGE(y, CENTER - 2, CENTER + 2);
+}
+
+/**
+ * @brief A steady sweep: the reported position trails the stick by a bounded distance, notified
+ *        about once per hysteresis step and never more than every other block
+ */
+static void test_sweep(void)
+{
+    const double speed = 1000.0;    // LSB per second, 3 s from 500 to 3500
+
+    set_axis(0, 500, 0, 8);
+    sim_run_for(SIM_MS(300));
+    notify_reset();
+    set_axis(0, 500, speed, 8);
+    sim_run_for(SIM_MS(3000));
+    set_axis(0, 3500, 0, 8);
+
+    double per_s = notify.changes / 3.0;
+    printf("sweep %.0f LSB/s: %u changes (%.1f/s), max error %.1f LSB\n", speed, (unsigned)notify.changes,
+           per_s, notify.max_err);
+    TEST_CHECK(per_s >= speed / (2 * JOYSTICK_HYSTERESIS));
+    TEST_CHECK(per_s <= speed / JOYSTICK_HYSTERESIS);
+    TEST_CHECK(per_s <= BLOCKS_PER_S / 2.0 + 1);
+    TEST_CHECK(notify.max_err < 60);
+    TEST_CHECK_EQ(sim_adc_get_overruns(), 0);
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    sim_adc_set_source(adc_source, NULL);
+
+    TEST_RUN(test_rest);
+    TEST_RUN(test_noise);
+    TEST_RUN(test_step);
+    TEST_RUN(test_sweep);
+    return test_report();
+}
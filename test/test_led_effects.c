@@ -0,0 +1,253 @@
+/**
+ * @file test_led_effects.c
+ * @brief LED effects: frames on the strip, settling on the nearest level, timer under request storms
+ * @note led_effects runs on the FreeRTOS timer task model and drives ws2812_strip, whose data line
+ *       the LED chain model decodes: every frame logged is what the LEDs latched. Built with
+ *       4 pixels and a strip frame period below LED_EFFECTS_PERIOD_MS, so no frame is coalesced.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "leds.h"
+#include "led_effects.h"
+#include "ws2812_strip.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <math.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define STRIP_PIN       12
+#define LOG_MAX         512
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint64_t t_ns;
+    uint32_t words[WS2812_STRIP_LEN];   // GRBW as latched
+} frame_log_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static frame_log_t frame_log[LOG_MAX];
+static size_t frame_count = 0;
+static volatile bool done = false;
+
+/* Sequence of the determinism test: fades through sub-step levels, dithered */
+static const led_keyframe_t keys[] = {
+    { 40, 3, 0, 300, 50 },
+    { 1, 90, 17, 250, 0 },
+    { 255, 128, 64, 400, 100 },
+    { 0, 0, 2, 200, 0 },
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void on_frame(unsigned pin, const leds_frame_t *frame)
+{
+    (void)pin;
+    if (frame_count < LOG_MAX) {
+        frame_log[frame_count].t_ns = frame->end_ns;
+        for (uint32_t i = 0; i < WS2812_STRIP_LEN; i++) {
+            frame_log[frame_count].words[i] = leds_word(frame, i, 32);
+        }
+    }
+    frame_count++;
+}
+
+static void log_reset(void)
+{
+    frame_count = 0;
+}
+
+/**
+ * @brief Output of one 8-bit colour value once settled: gamma, brightness, nearest level
+ */
+static uint8_t settled(uint8_t v, uint8_t brightness)
+{
+    uint32_t lin = (uint16_t)(powf(v / 255.0f, LED_EFFECTS_GAMMA) * 65535.0f + 0.5f);
+
+    lin = (lin * brightness + 127) / 255;
+    return (lin + 128) >> 8 > 255 ? 255 : (uint8_t)((lin + 128) >> 8);
+}
+
+static uint32_t line_word(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((uint32_t)g << 24) | ((uint32_t)r << 16) | ((uint32_t)b << 8);
+}
+
+static void check_last(uint8_t r, uint8_t g, uint8_t b, uint8_t brightness)
+{
+    uint32_t want = line_word(settled(r, brightness), settled(g, brightness), settled(b, brightness));
+
+    TEST_CHECK(frame_count > 0 && frame_count <= LOG_MAX);
+    if (frame_count == 0 || frame_count > LOG_MAX) {
+        return;
+    }
+    for (uint32_t i = 0; i < WS2812_STRIP_LEN; i++) {
+        if (frame_log[frame_count - 1].words[i] != want) {
+            printf("pixel %u: 0x%08x, expected 0x%08x\n", (unsigned)i,
+                   (unsigned)frame_log[frame_count - 1].words[i], (unsigned)want);
+        }
+        TEST_CHECK_EQ(frame_log[frame_count - 1].words[i], want);
+    }
+}
+
+/**
+ * @brief Nothing requested: no frame, the timer doesn't run
+ */
+static void test_idle(void)
+{
+    log_reset();
+    vTaskDelay(pdMS_TO_TICKS(1000));
+    TEST_CHECK_EQ(frame_count, 0);
+}
+
+/**
+ * @brief A fade: one frame per period, then the target on the nearest level (not the truncated
+ *        one, no dither left running) and no frame after that
+ */
+static void test_fade_settles(void)
+{
+    log_reset();
+    led_effects_fade(200, 90, 3, 300);
+    vTaskDelay(pdMS_TO_TICKS(400));
+    size_t frames = frame_count;
+    vTaskDelay(pdMS_TO_TICKS(1000));
+
+    printf("fade 300 ms: %u frames, settled on %08x\n", (unsigned)frames,
+           (unsigned)frame_log[frames - 1].words[0]);
+    TEST_CHECK_RANGE(frames, 300 / LED_EFFECTS_PERIOD_MS, 300 / LED_EFFECTS_PERIOD_MS + 2);
+    TEST_CHECK_EQ(frame_count, frames);
+    check_last(200, 90, 3, 255);
+    for (size_t i = 1; i < frames; i++) {
+        TEST_CHECK_RANGE(frame_log[i].t_ns - frame_log[i - 1].t_ns,
+                         SIM_MS(LED_EFFECTS_PERIOD_MS) - SIM_US(100), SIM_MS(LED_EFFECTS_PERIOD_MS) + SIM_US(100));
+    }
+}
+
+/**
+ * @brief A request every millisecond for half a second (a colour wheel being dragged): frames keep
+ *        their period instead of waiting for the storm to end, the last request is shown
+ */
+static void test_storm(void)
+{
+    const uint32_t storm_ms = 500;
+
+    log_reset();
+    for (uint32_t i = 0; i < storm_ms; i++) {
+        led_effects_fade((uint8_t)(i / 2), 255, (uint8_t)(255 - i / 2), 150);
+        vTaskDelay(1);
+    }
+    size_t during = frame_count;
+    vTaskDelay(pdMS_TO_TICKS(300));
+    size_t frames = frame_count;
+    vTaskDelay(pdMS_TO_TICKS(500));
+
+    printf("storm: %u requests in %u ms, %u frames meanwhile, %u in all\n", (unsigned)storm_ms,
+           (unsigned)storm_ms, (unsigned)during, (unsigned)frames);
+    TEST_CHECK(during >= storm_ms / LED_EFFECTS_PERIOD_MS - 1);
+    TEST_CHECK_EQ(frame_count, frames);
+    check_last((uint8_t)((storm_ms - 1) / 2), 255, (uint8_t)(255 - (storm_ms - 1) / 2), 255);
+}
+
+/**
+ * @brief Brightness of a settled colour: one frame on the new nearest levels, then idle again
+ */
+static void test_brightness(void)
+{
+    led_effects_fade(180, 60, 250, 0);
+    vTaskDelay(pdMS_TO_TICKS(100));
+    log_reset();
+    led_effects_set_brightness(64);
+    vTaskDelay(pdMS_TO_TICKS(500));
+
+    TEST_CHECK_EQ(frame_count, 1);
+    check_last(180, 60, 250, 64);
+    led_effects_set_brightness(255);
+    vTaskDelay(pdMS_TO_TICKS(100));
+}
+
+/**
+ * @brief The same sequence started twice from black gives the same frames: no dither residue or
+ *        other state carried over from before
+ */
+static void test_deterministic(void)
+{
+    static frame_log_t first[LOG_MAX];
+    size_t count[2];
+    uint64_t t0[2];
+
+    for (int run = 0; run < 2; run++) {
+        led_effects_fade(0, 0, 0, 0);
+        vTaskDelay(pdMS_TO_TICKS(100 + 7 * run));    // Another tick phase the second time
+        log_reset();
+        t0[run] = sim_now();
+        led_effects_sequence(keys, sizeof(keys) / sizeof(keys[0]), false);
+        vTaskDelay(pdMS_TO_TICKS(2000));
+        count[run] = frame_count;
+        if (run == 0) {
+            memcpy(first, frame_log, sizeof(first));
+        }
+    }
+
+    printf("sequence: %u and %u frames\n", (unsigned)count[0], (unsigned)count[1]);
+    TEST_CHECK_EQ(count[0], count[1]);
+    TEST_CHECK(count[0] <= LOG_MAX);
+    uint32_t diffs = 0;
+    for (size_t i = 0; i < count[0] && i < count[1] && i < LOG_MAX; i++) {
+        diffs += memcmp(first[i].words, frame_log[i].words, sizeof(first[i].words)) != 0;
+        TEST_CHECK_EQ(first[i].t_ns - t0[0], frame_log[i].t_ns - t0[1]);
+    }
+    TEST_CHECK_EQ(diffs, 0);
+    check_last(0, 0, 2, 255);
+}
+
+static void script_task(void *param)
+{
+    (void)param;
+
+    TEST_RUN(test_idle);
+    TEST_RUN(test_fade_settles);
+    TEST_RUN(test_storm);
+    TEST_RUN(test_brightness);
+    TEST_RUN(test_deterministic);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    ws2812_strip_stats_t s;
+
+    leds_attach(STRIP_PIN);
+    ws2812_strip_init(STRIP_PIN, true);
+    sim_run_for(SIM_MS(20));
+    leds_set_frame_fn(on_frame);
+    led_effects_init();
+    xTaskCreate(script_task, "script", 1024, NULL, 1, NULL);
+
+    for (uint32_t n = 0; n < 100 && !done; n++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    ws2812_strip_get_stats(&s);
+    TEST_CHECK_EQ(s.coalesced, 0);
+    return test_report();
+}
@@ -0,0 +1,272 @@
+/**
+ * @file test_lv_port_disp_engine.c
+ * @brief Display engine: stripe ordering on the panel and render/transfer overlap across the two cores
+ * @note Built with the engine task (LVGL on core 1, engine on core 0) and with the blocking flush as the
+ *       serial baseline. Drawing is charged per pixel with lv_mock_set_render_cost(), so a refresh
+ *       takes max(render, transfer) with the engine and render + transfer without it.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "lv_port_disp.h"
+#include "st7796.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         320
+#define VER_RES         480
+#define IMG_W           HOR_RES
+#define IMG_H           VER_RES
+
+/* Same defaults as lv_port_disp.c, CMake overrides them */
+#ifndef DISP_USE_ENGINE_TASK
+#define DISP_USE_ENGINE_TASK    1
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t rng = 0x68E31DA4u;
+static lv_color_t img_px[IMG_W * IMG_H];
+static lv_img_dsc_t img = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.w = IMG_W,
+    .header.h = IMG_H,
+    .data_size = sizeof(img_px),
+    .data = (const uint8_t *)img_px,
+};
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static uint64_t xfer_ns = 0;        // Full-screen refresh with free drawing: the bus alone
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static void drain(void)
+{
+    disp_engine_stats_t stats;
+
+    do {
+        vTaskDelay(1);
+        disp_get_engine_stats(&stats);
+    } while (stats.depth != 0 || st7796_is_busy());
+}
+
+static void settle(void)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+
+    do {
+        lv_timer_handler();
+        vTaskDelay(1);
+    } while (disp->inv_p != 0);
+    drain();
+}
+
+static uint32_t gram_mismatches(void)
+{
+    uint32_t bad = 0;
+
+    lv_mock_render_reference(ref_fb);
+    for (uint32_t y = 0; y < VER_RES; y++) {
+        for (uint32_t x = 0; x < HOR_RES; x++) {
+            uint16_t want = ref_fb[y * HOR_RES + x].full;
+#if LV_COLOR_16_SWAP
+            want = (uint16_t)((want >> 8) | (want << 8));
+#endif
+            bad += panel_pixel(x, y) != want;
+        }
+    }
+    return bad;
+}
+
+/**
+ * @brief Redraw the whole screen now, from the LVGL task
+ * @return Time from the start of rendering to the last pixel on the panel (ns)
+ */
+static uint64_t refresh_ns(void)
+{
+    panel_stats_t ps;
+
+    lv_obj_invalidate(lv_scr_act());
+    uint64_t t0 = sim_now();
+    lv_refr_now(NULL);
+    drain();
+    panel_get_stats(&ps);
+    return ps.last_pixel_ns - t0;
+}
+
+/**
+ * @brief Row windows of the memory writes logged since event `from` must tile [y1, y2] top to bottom
+ * @note Unchanged windows are not resent, so the window is tracked over the whole log
+ */
+static void check_row_windows(size_t from, lv_coord_t y1, lv_coord_t y2, uint32_t max_rows)
+{
+    size_t count;
+    const panel_event_t *ev = panel_events(&count);
+    uint8_t raset[4] = {0};
+    uint32_t nparam = 0;
+    uint32_t stripes = 0;
+    int32_t next = y1;
+
+    for (size_t i = 0; i < count; i++) {
+        if (ev[i].kind == PANEL_EV_CMD) {
+            nparam = 0;
+            if (i < from || ev[i].value != ST7796_CMD_RAMWR) {
+                continue;
+            }
+            int32_t ys = (raset[0] << 8) | raset[1];
+            int32_t ye = (raset[2] << 8) | raset[3];
+            TEST_CHECK_EQ(ys, next);
+            TEST_CHECK(ye >= ys && (uint32_t)(ye - ys) < max_rows);
+            next = ye + 1;
+            stripes++;
+        } else if (ev[i].kind == PANEL_EV_PARAM && ev[i].cmd == ST7796_CMD_RASET && nparam < 4) {
+            raset[nparam++] = (uint8_t)ev[i].value;
+        }
+    }
+    TEST_CHECK_EQ(next, y2 + 1);
+    TEST_CHECK_EQ(stripes, (uint32_t)(y2 - y1 + max_rows) / max_rows);
+}
+
+/**
+ * @brief Stripes reach the panel in rendering order, across ring wrap-arounds and partial areas
+ */
+static void test_stripe_order(void)
+{
+    disp_engine_stats_t stats;
+    disp_get_engine_stats(&stats);
+    uint32_t rows = DISP_USE_ENGINE_TASK ? stats.rows : 10;
+
+    panel_log_pixels(false);
+    panel_clear_log();
+    for (uint32_t i = 0; i < 8; i++) {
+        lv_coord_t y1 = (lv_coord_t)(rand_u32() % (VER_RES - 1));
+        lv_coord_t y2 = (lv_coord_t)(y1 + rand_u32() % (VER_RES - y1));
+        lv_obj_t *bar = lv_obj_create(lv_scr_act());
+        lv_obj_set_pos(bar, 0, y1);
+        lv_obj_set_size(bar, HOR_RES, (lv_coord_t)(y2 - y1 + 1));
+        lv_obj_set_style_bg_opa(bar, LV_OPA_50, 0);
+        lv_obj_set_style_bg_color(bar, lv_color_hex(rand_u32() & 0xFFFFFF), 0);
+        settle();
+
+        size_t from;
+        panel_events(&from);
+        lv_obj_invalidate(bar);
+        settle();
+        check_row_windows(from, y1, y2, rows);
+        TEST_CHECK_EQ(gram_mismatches(), 0);
+        lv_obj_del(bar);
+        settle();
+    }
+    panel_log_pixels(true);
+}
+
+/**
+ * @brief Refresh time vs render cost: overlapped with the engine, added up without it
+ */
+static void test_throughput(void)
+{
+    disp_engine_stats_t before, after;
+
+    // 1. Bus alone
+    lv_mock_set_render_cost(0, 0);
+    xfer_ns = refresh_ns();
+    TEST_CHECK(xfer_ns > SIM_MS(5));
+    TEST_CHECK_EQ(gram_mismatches(), 0);
+
+    // 2. Rendering as slow as, half and twice the bus
+    static const uint32_t pct[] = {100, 50, 200};
+    for (uint32_t i = 0; i < 3; i++) {
+        uint64_t render_ns = xfer_ns * pct[i] / 100;
+        lv_mock_set_render_cost(0, (uint32_t)(render_ns / (HOR_RES * VER_RES)));
+
+        disp_get_engine_stats(&before);
+        uint64_t frame_ns = refresh_ns();
+        disp_get_engine_stats(&after);
+        printf("render %3u%% of bus: %6.2f ms (bus %.2f ms, render %.2f ms)\n", (unsigned)pct[i],
+               frame_ns / 1e6, xfer_ns / 1e6, render_ns / 1e6);
+        TEST_CHECK_EQ(gram_mismatches(), 0);
+
+#if DISP_USE_ENGINE_TASK
+        // The slower side sets the pace, the other one hides behind it
+        uint64_t slow = render_ns > xfer_ns ? render_ns : xfer_ns;
+        TEST_CHECK(frame_ns < slow + slow / 8);
+        if (pct[i] < 100) {
+            TEST_CHECK(after.render_stalls > before.render_stalls);
+            TEST_CHECK_EQ(after.max_depth, after.bufs);
+        } else if (pct[i] > 100) {
+            // The engine waits for nearly every stripe
+            TEST_CHECK(after.engine_idle - before.engine_idle >= VER_RES / after.rows - 2);
+        }
+        TEST_CHECK_EQ(after.submitted - before.submitted, (VER_RES + after.rows - 1) / after.rows);
+#else
+        TEST_CHECK(frame_ns >= (render_ns + xfer_ns) * 95 / 100);
+#endif
+    }
+    lv_mock_set_render_cost(0, 0);
+}
+
+static void lvgl_task(void *param)
+{
+    (void)param;
+
+    lv_init();
+    lv_port_disp_init();
+    settle();
+
+    for (uint32_t i = 0; i < IMG_W * IMG_H; i++) {
+        img_px[i] = lv_color_hex(rand_u32() & 0xFFFFFF);
+    }
+    lv_obj_t *obj = lv_img_create(lv_scr_act());
+    lv_img_set_src(obj, &img);
+    settle();
+
+    TEST_RUN(test_stripe_order);
+    TEST_RUN(test_throughput);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void vApplicationTickHook(void)
+{
+    lv_tick_inc(1);
+}
+
+int main(void)
+{
+    TaskHandle_t task;
+
+    panel_attach_spi(0);
+    xTaskCreate(lvgl_task, "LVGL", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 1);
+
+    for (uint32_t s = 0; s < 600 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
@@ -0,0 +1,363 @@
+/**
+ * @file test_lv_port_disp_fill.c
+ * @brief Display port fill fast paths: panel GRAM after randomized scenes equals a software render
+ * @note Built with and without DISP_USE_DMA_FILL. Scenes mix the cases the fast paths take
+ *       (full-stripe and full-width opaque fills) with the ones they must hand back to the
+ *       software blender (partial, translucent, rounded, layered and image content).
+ *       Also built for swapped pixels (LV_COLOR_16_SWAP) and the PIO bus: every build must leave
+ *       the same panel pixels as the native SPI one, which logs them to GRAM_LOG.
+ *       With LV_COLOR_SCREEN_TRANSP the layers get alpha, which no fill fast path may touch.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "lv_port_disp.h"
+#include "st7796.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         320
+#define VER_RES         480
+#ifndef SCENES
+#define SCENES          24      // The PIO builds run a prefix of the logged scenes
+#endif
+#define SCENE_OBJS      8
+#define IMG_W           40
+#define IMG_H           30
+
+/* Same default as lv_port_disp.c, CMake overrides both */
+#ifndef DISP_USE_DMA_FILL
+#define DISP_USE_DMA_FILL   1
+#endif
+
+/* Per-scene GRAM hashes: 1 = this build writes the reference, 0 = compares against it */
+#define GRAM_LOG            "disp_scene_gram.txt"
+#ifndef GRAM_LOG_WRITE
+#define GRAM_LOG_WRITE      0
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t rng = 0x2545F491u;
+static lv_obj_t *scene_objs[SCENE_OBJS];
+static uint32_t scene_count = 0;
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static lv_color_t img_px[IMG_W * IMG_H];
+static lv_img_dsc_t img = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.w = IMG_W,
+    .header.h = IMG_H,
+    .data_size = sizeof(img_px),
+    .data = (const uint8_t *)img_px,
+};
+static uint32_t gram_hashes[SCENES * 2];
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static int32_t rand_range(int32_t lo, int32_t hi)
+{
+    return lo + (int32_t)(rand_u32() % (uint32_t)(hi - lo + 1));
+}
+
+static lv_color_t rand_color(void)
+{
+    return lv_color_hex(rand_u32() & 0xFFFFFF);
+}
+
+/**
+ * @brief Panel pixel of an lv_color_t (the bus sends native RGB565 MSB first)
+ */
+static uint16_t color_native(lv_color_t c)
+{
+#if LV_COLOR_16_SWAP
+    return (uint16_t)((c.full >> 8) | (c.full << 8));
+#else
+    return c.full;
+#endif
+}
+
+static lv_obj_t *add_rect(lv_obj_t *parent, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h)
+{
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_color(obj, rand_color(), 0);
+    return obj;
+}
+
+/**
+ * @brief One random object of each kind the port treats differently
+ */
+static lv_obj_t *add_random_obj(lv_obj_t *scr)
+{
+    lv_coord_t y = (lv_coord_t)rand_range(0, VER_RES - 20);
+    lv_coord_t h = (lv_coord_t)rand_range(1, VER_RES - y);
+    lv_coord_t x = (lv_coord_t)rand_range(0, HOR_RES - 20);
+    lv_coord_t w = (lv_coord_t)rand_range(1, HOR_RES - x);
+    lv_obj_t *obj;
+
+    switch (rand_u32() % 7) {
+    case 0:         // Full screen, opaque
+        return add_rect(scr, 0, 0, HOR_RES, VER_RES);
+    case 1:         // Full width, opaque
+        return add_rect(scr, 0, y, HOR_RES, h);
+    case 2:         // Partial, opaque
+        return add_rect(scr, x, y, w, h);
+    case 3:         // Translucent background
+        obj = add_rect(scr, x, y, w, h);
+        lv_obj_set_style_bg_opa(obj, (lv_opa_t)rand_range(LV_OPA_MIN + 1, LV_OPA_MAX - 1), 0);
+        return obj;
+    case 4:         // Rounded corners
+        obj = add_rect(scr, 0, y, HOR_RES, h);
+        lv_obj_set_style_radius(obj, (lv_coord_t)rand_range(1, 40), 0);
+        return obj;
+    case 5:         // Layer: translucent object without background, the layer starts from the content underneath
+        obj = add_rect(scr, 0, y, HOR_RES, h);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_TRANSP, 0);
+        lv_obj_set_style_opa(obj, (lv_opa_t)rand_range(LV_OPA_MIN + 1, LV_OPA_MAX - 1), 0);
+        add_rect(obj, x, 0, w, (lv_coord_t)rand_range(1, h));
+        return obj;
+    default:        // True color image in RAM
+        obj = lv_img_create(scr);
+        lv_img_set_src(obj, &img);
+        lv_obj_set_pos(obj, x, y);
+        return obj;
+    }
+}
+
+static void build_scene(void)
+{
+    lv_obj_t *scr = lv_scr_act();
+
+    while (scene_count > 0) {
+        lv_obj_del(scene_objs[--scene_count]);
+    }
+    lv_obj_set_style_bg_color(scr, rand_color(), 0);
+
+    uint32_t n = (uint32_t)rand_range(1, SCENE_OBJS);
+    while (scene_count < n) {
+        scene_objs[scene_count++] = add_random_obj(scr);
+    }
+}
+
+/**
+ * @brief Run LVGL until the invalid areas are drawn and the engine has sent every stripe
+ */
+static void settle(void)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    disp_engine_stats_t stats;
+
+    do {
+        lv_timer_handler();
+        vTaskDelay(1);
+    } while (disp->inv_p != 0);
+
+    do {
+        vTaskDelay(1);
+        disp_get_engine_stats(&stats);
+    } while (stats.depth != 0 || st7796_is_busy());
+}
+
+static uint32_t gram_mismatches(void)
+{
+    uint32_t bad = 0;
+
+    lv_mock_render_reference(ref_fb);
+    for (uint32_t y = 0; y < VER_RES; y++) {
+        for (uint32_t x = 0; x < HOR_RES; x++) {
+            uint16_t want = color_native(ref_fb[y * HOR_RES + x]);
+            uint16_t got = panel_pixel(x, y);
+            if (got != want) {
+                if (bad == 0) {
+                    printf("first mismatch at (%u, %u): 0x%04x, expected 0x%04x\n",
+                           (unsigned)x, (unsigned)y, got, want);
+                }
+                bad++;
+            }
+        }
+    }
+    return bad;
+}
+
+/**
+ * @brief FNV-1a over the panel pixels in RGB565, the same whatever the buffer byte order
+ */
+static uint32_t gram_hash(void)
+{
+    uint32_t h = 2166136261u;
+
+    for (uint32_t y = 0; y < VER_RES; y++) {
+        for (uint32_t x = 0; x < HOR_RES; x++) {
+            uint16_t px = panel_pixel(x, y);
+            h = (h ^ (px & 0xFF)) * 16777619u;
+            h = (h ^ (px >> 8)) * 16777619u;
+        }
+    }
+    return h;
+}
+
+/**
+ * @brief Full redraws of random scenes, then partial redraws after moving one object
+ */
+static void test_random_scenes(void)
+{
+    for (uint32_t s = 0; s < SCENES; s++) {
+        build_scene();
+        settle();
+        TEST_CHECK_EQ(gram_mismatches(), 0);
+        gram_hashes[s * 2] = gram_hash();
+
+        lv_obj_t *obj = scene_objs[rand_u32() % scene_count];
+        lv_obj_set_pos(obj, (lv_coord_t)rand_range(-40, HOR_RES - 40), (lv_coord_t)rand_range(-40, VER_RES - 40));
+        settle();
+        TEST_CHECK_EQ(gram_mismatches(), 0);
+        gram_hashes[s * 2 + 1] = gram_hash();
+    }
+}
+
+/**
+ * @brief Which path the pixels took: DMA fills only when DISP_USE_DMA_FILL is on
+ */
+static void test_fill_path(void)
+{
+    uint32_t fills = sim_dma_get_fill_transfers();
+    lv_obj_t *scr = lv_scr_act();
+
+    while (scene_count > 0) {
+        lv_obj_del(scene_objs[--scene_count]);
+    }
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x336699), 0);
+    settle();
+    TEST_CHECK_EQ(gram_mismatches(), 0);
+
+    fills = sim_dma_get_fill_transfers() - fills;
+#if DISP_USE_DMA_FILL && ST7796_BUS_PIO
+    // Every stripe of a plain screen is one panel-side fill: a repeated pixel pair per two pixels
+    TEST_CHECK(fills >= HOR_RES * VER_RES / 2);
+#elif DISP_USE_DMA_FILL
+    // Every stripe of a plain screen is one panel-side fill: a repeated pixel per pixel
+    TEST_CHECK(fills >= HOR_RES * VER_RES);
+#else
+    TEST_CHECK_EQ(fills, 0);
+#endif
+}
+
+#if LV_COLOR_SCREEN_TRANSP
+/**
+ * @brief Full-width opaque fill in a layer with alpha: its pixels are not RGB565 rows
+ */
+static void test_alpha_layer(void)
+{
+    lv_obj_t *scr = lv_scr_act();
+
+    while (scene_count > 0) {
+        lv_obj_del(scene_objs[--scene_count]);
+    }
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x336699), 0);
+
+    lv_obj_t *obj = add_rect(scr, 0, 100, HOR_RES, 200);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_opa(obj, LV_OPA_50, 0);
+    add_rect(obj, 0, 50, HOR_RES, 100);
+    scene_objs[scene_count++] = obj;
+    settle();
+    TEST_CHECK_EQ(gram_mismatches(), 0);
+}
+#endif
+
+/**
+ * @brief Same scenes, same panel pixels as the native SPI build
+ */
+static void test_gram_log(void)
+{
+    FILE *f = fopen(GRAM_LOG, GRAM_LOG_WRITE ? "w" : "r");
+
+    if (f == NULL) {
+        TEST_CHECK(!GRAM_LOG_WRITE);
+        printf("no " GRAM_LOG ", comparison skipped\n");
+        return;
+    }
+    for (uint32_t i = 0; i < SCENES * 2; i++) {
+#if GRAM_LOG_WRITE
+        fprintf(f, "%08x\n", (unsigned)gram_hashes[i]);
+#else
+        unsigned want = 0;
+        TEST_CHECK_EQ(fscanf(f, "%x", &want), 1);
+        TEST_CHECK_EQ(gram_hashes[i], want);
+#endif
+    }
+    fclose(f);
+}
+
+static void lvgl_task(void *param)
+{
+    (void)param;
+
+    lv_init();
+    lv_port_disp_init();
+    settle();
+
+    for (uint32_t i = 0; i < IMG_W * IMG_H; i++) {
+        img_px[i] = rand_color();
+    }
+
+    TEST_RUN(test_random_scenes);
+    TEST_RUN(test_gram_log);
+#if LV_COLOR_SCREEN_TRANSP
+    TEST_RUN(test_alpha_layer);
+#endif
+    TEST_RUN(test_fill_path);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void vApplicationTickHook(void)
+{
+    lv_tick_inc(1);
+}
+
+int main(void)
+{
+    TaskHandle_t task;
+
+#if ST7796_BUS_PIO
+    panel_attach_pio();
+#else
+    panel_attach_spi(0);
+#endif
+    xTaskCreate(lvgl_task, "LVGL", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 1);
+
+    for (uint32_t s = 0; s < 600 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
@@ -0,0 +1,357 @@
+/**
+ * @file test_lv_port_disp_sweep.c
+ * @brief Draw buffer benchmark: scripted UI scenes timed for fixed stripe layouts and the adaptive sizing
+ * @note Built once per fixed layout (DISP_ENGINE_BUFS x DISP_BUF_ROWS within DISP_BUF_BUDGET), each
+ *       run leaves its time in disp_sweep_<bufs>x<rows>.txt. The adaptive build runs last, tunes
+ *       itself over the same script and must come close to the best fixed layout.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "lv_port_disp.h"
+#include "st7796.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         320
+#define VER_RES         480
+
+#define PROFILES        2
+#define WARMUP_RUNS     4       // Script runs for the adaptive sizing to settle (> DISP_TUNE_FRAMES refreshes)
+#define ADAPTIVE_SLACK  10      // Percent the adaptive layout may trail the best fixed one
+
+/* Same defaults as lv_port_disp.c, CMake overrides them */
+#ifndef DISP_USE_ADAPTIVE_BUF
+#define DISP_USE_ADAPTIVE_BUF   1
+#endif
+#ifndef DISP_ENGINE_BUFS
+#define DISP_ENGINE_BUFS        3
+#endif
+#ifndef DISP_BUF_ROWS
+#define DISP_BUF_ROWS           10
+#endif
+#ifndef DISP_BUF_BUDGET
+#define DISP_BUF_BUDGET         (HOR_RES * 30 * 2)
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if DISP_USE_ADAPTIVE_BUF
+/* The fixed layouts of test/CMakeLists.txt */
+static const struct {
+    uint32_t bufs;
+    uint32_t rows;
+} sweep[] = {
+    {3, 4}, {3, 6}, {3, 10}, {2, 10}, {2, 15}, {1, 30},
+};
+#endif
+
+/* Simulated LVGL cost: an object tree walk per stripe and the blending per pixel. Light screens
+ * overlap best with two buffers, on widget-heavy ones the per-stripe walk favours fewer, taller stripes */
+static const struct {
+    const char *name;
+    uint32_t stripe_ns;
+    uint32_t px_ns;
+} profile[PROFILES] = {
+    {"light", 1000000, 100},
+    {"heavy", 5000000, 0},
+};
+
+static uint32_t rng = 0x1B873593u;
+static lv_color_t img_px[HOR_RES * VER_RES];
+static lv_img_dsc_t img = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.w = HOR_RES,
+    .header.h = VER_RES,
+    .data_size = sizeof(img_px),
+    .data = (const uint8_t *)img_px,
+};
+static lv_obj_t *square;
+static lv_obj_t *bar;
+static lv_obj_t *btn;
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static void drain(void)
+{
+    disp_engine_stats_t stats;
+
+    do {
+        vTaskDelay(1);
+        disp_get_engine_stats(&stats);
+    } while (stats.depth != 0 || st7796_is_busy());
+}
+
+static void settle(void)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+
+    do {
+        lv_timer_handler();
+        vTaskDelay(1);
+    } while (disp->inv_p != 0);
+    drain();
+}
+
+static uint32_t gram_mismatches(void)
+{
+    uint32_t bad = 0;
+
+    lv_mock_render_reference(ref_fb);
+    for (uint32_t y = 0; y < VER_RES; y++) {
+        for (uint32_t x = 0; x < HOR_RES; x++) {
+            uint16_t want = ref_fb[y * HOR_RES + x].full;
+#if LV_COLOR_16_SWAP
+            want = (uint16_t)((want >> 8) | (want << 8));
+#endif
+            bad += panel_pixel(x, y) != want;
+        }
+    }
+    return bad;
+}
+
+/**
+ * @brief Draw what's invalid now
+ * @return Time from the start of rendering to the last pixel on the panel (ns)
+ */
+static uint64_t refresh_ns(void)
+{
+    panel_stats_t ps;
+
+    uint64_t t0 = sim_now();
+    lv_refr_now(NULL);
+    drain();
+    panel_get_stats(&ps);
+    return ps.last_pixel_ns - t0;
+}
+
+/**
+ * @brief The scripted scenes: screen change, a dragged square, a fading banner, a pressed button
+ * @return Total refresh time (ns)
+ */
+static uint64_t run_script(void)
+{
+    uint64_t total = 0;
+
+    // 1. Full screen
+    lv_obj_invalidate(lv_scr_act());
+    total += refresh_ns();
+
+    // 2. Square dragged diagonally: two partial areas per step
+    for (lv_coord_t i = 0; i < 20; i++) {
+        lv_obj_set_pos(square, (lv_coord_t)(10 + i * 9), (lv_coord_t)(40 + i * 17));
+        total += refresh_ns();
+    }
+
+    // 3. Full-width translucent banner fading in
+    lv_obj_clear_flag(bar, LV_OBJ_FLAG_HIDDEN);
+    for (uint32_t i = 1; i <= 10; i++) {
+        lv_obj_set_style_bg_opa(bar, (lv_opa_t)(i * 25), 0);
+        total += refresh_ns();
+    }
+    lv_obj_add_flag(bar, LV_OBJ_FLAG_HIDDEN);
+    total += refresh_ns();
+
+    // 4. Button pressed and released
+    for (uint32_t i = 0; i < 10; i++) {
+        lv_obj_set_style_bg_color(btn, lv_color_hex(i & 1 ? 0x2196F3 : 0x0D47A1), 0);
+        total += refresh_ns();
+    }
+
+    lv_obj_set_pos(square, 10, 40);
+    total += refresh_ns();
+    return total;
+}
+
+static void build_ui(void)
+{
+    for (uint32_t i = 0; i < HOR_RES * VER_RES; i++) {
+        img_px[i] = lv_color_hex(rand_u32() & 0xFFFFFF);
+    }
+    lv_obj_t *bg = lv_img_create(lv_scr_act());
+    lv_img_set_src(bg, &img);
+
+    square = lv_obj_create(lv_scr_act());
+    lv_obj_set_pos(square, 10, 40);
+    lv_obj_set_size(square, 100, 100);
+    lv_obj_set_style_bg_color(square, lv_color_hex(0xFF5722), 0);
+
+    bar = lv_obj_create(lv_scr_act());
+    lv_obj_set_pos(bar, 0, 200);
+    lv_obj_set_size(bar, HOR_RES, 60);
+    lv_obj_set_style_bg_color(bar, lv_color_hex(0x000000), 0);
+    lv_obj_add_flag(bar, LV_OBJ_FLAG_HIDDEN);
+
+    btn = lv_btn_create(lv_scr_act());
+    lv_obj_set_pos(btn, 100, 400);
+    lv_obj_set_size(btn, 120, 50);
+}
+
+static void sweep_path(char *path, size_t size, uint32_t bufs, uint32_t rows)
+{
+    snprintf(path, size, "disp_sweep_%ux%u.txt", (unsigned)bufs, (unsigned)rows);
+}
+
+#if DISP_USE_ADAPTIVE_BUF
+/**
+ * @brief Best script time of the fixed layouts that ran before, per profile
+ * @return false if none ran
+ */
+static bool best_fixed(uint64_t best[PROFILES])
+{
+    bool found = false;
+
+    for (uint32_t p = 0; p < PROFILES; p++) {
+        best[p] = UINT64_MAX;
+    }
+    for (uint32_t i = 0; i < sizeof(sweep) / sizeof(sweep[0]); i++) {
+        char path[64];
+        sweep_path(path, sizeof(path), sweep[i].bufs, sweep[i].rows);
+        FILE *f = fopen(path, "r");
+        if (f == NULL) {
+            continue;
+        }
+        for (uint32_t p = 0; p < PROFILES; p++) {
+            unsigned long long ns;
+            if (fscanf(f, "%llu", &ns) == 1 && ns < best[p]) {
+                best[p] = ns;
+            }
+        }
+        fclose(f);
+        found = true;
+    }
+    return found;
+}
+
+/**
+ * @brief Tune over the script for each profile, then compare with the fixed layouts
+ */
+static void test_adaptive(void)
+{
+    disp_engine_stats_t stats;
+    uint64_t ns[PROFILES];
+    uint64_t best[PROFILES];
+
+    for (uint32_t p = 0; p < PROFILES; p++) {
+        lv_mock_set_render_cost(profile[p].stripe_ns, profile[p].px_ns);
+        for (uint32_t i = 0; i < WARMUP_RUNS; i++) {
+            run_script();
+        }
+        ns[p] = run_script();
+        TEST_CHECK_EQ(gram_mismatches(), 0);
+
+        disp_get_engine_stats(&stats);
+        printf("%s: adaptive %ux%u %.2f ms, %u relayouts\n", profile[p].name, (unsigned)stats.bufs,
+               (unsigned)stats.rows, ns[p] / 1e6, (unsigned)stats.relayouts);
+        TEST_CHECK(stats.bufs * stats.rows * HOR_RES * sizeof(lv_color_t) <= DISP_BUF_BUDGET);
+
+        // The model's full-screen estimate must be close to the measured one
+        lv_obj_invalidate(lv_scr_act());
+        uint64_t frame_ns = refresh_ns();
+        printf("%s: full screen %.2f ms, estimated %.2f ms\n", profile[p].name, frame_ns / 1e6,
+               stats.frame_est_us / 1e3);
+        TEST_CHECK_RANGE(stats.frame_est_us * 1000ull, frame_ns * 80 / 100, frame_ns * 120 / 100);
+    }
+    // Going heavy must have moved the layout at runtime
+    TEST_CHECK(stats.relayouts > 0);
+
+    if (!best_fixed(best)) {
+        printf("no fixed layout results, comparison skipped\n");
+        return;
+    }
+    for (uint32_t p = 0; p < PROFILES; p++) {
+        printf("%s: best fixed %.2f ms\n", profile[p].name, best[p] / 1e6);
+        TEST_CHECK(ns[p] * 100 <= best[p] * (100 + ADAPTIVE_SLACK));
+    }
+}
+#else
+/**
+ * @brief Time the script on this build's fixed layout and leave the results for the adaptive build
+ */
+static void test_fixed(void)
+{
+    char path[64];
+    sweep_path(path, sizeof(path), DISP_ENGINE_BUFS, DISP_BUF_ROWS);
+    FILE *f = fopen(path, "w");
+    TEST_CHECK(f != NULL);
+
+    for (uint32_t p = 0; p < PROFILES; p++) {
+        lv_mock_set_render_cost(profile[p].stripe_ns, profile[p].px_ns);
+        uint64_t ns = run_script();
+        TEST_CHECK_EQ(gram_mismatches(), 0);
+        printf("%s: fixed %ux%u %.2f ms\n", profile[p].name, (unsigned)DISP_ENGINE_BUFS,
+               (unsigned)DISP_BUF_ROWS, ns / 1e6);
+        if (f != NULL) {
+            fprintf(f, "%llu\n", (unsigned long long)ns);
+        }
+    }
+    if (f != NULL) {
+        fclose(f);
+    }
+}
+#endif
+
+static void lvgl_task(void *param)
+{
+    (void)param;
+
+    lv_init();
+    lv_port_disp_init();
+    build_ui();
+    settle();
+
+#if DISP_USE_ADAPTIVE_BUF
+    TEST_RUN(test_adaptive);
+#else
+    TEST_RUN(test_fixed);
+#endif
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void vApplicationTickHook(void)
+{
+    lv_tick_inc(1);
+}
+
+int main(void)
+{
+    TaskHandle_t task;
+
+    panel_attach_spi(0);
+    xTaskCreate(lvgl_task, "LVGL", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 1);
+
+    for (uint32_t s = 0; s < 600 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
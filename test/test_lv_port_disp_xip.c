@@ -0,0 +1,226 @@
+/**
+ * @file test_lv_port_disp_xip.c
+ * @brief Display port XIP streaming: a flash-image file mapped at XIP_BASE streamed straight to the panel
+ * @note The image file is mapped at XIP_BASE and again at its uncached alias, as the RP2040 sees
+ *       flash. Skipped (exit 77) where the host refuses a mapping at those addresses.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#define _GNU_SOURCE
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "lv_port_disp.h"
+#include "st7796.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hardware/regs/addressmap.h"
+#include <stdint.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         320
+#define VER_RES         480
+#define IMG_BYTES       (HOR_RES * VER_RES * 2)
+#define BTN_Y           100
+#define BTN_H           50
+#define TEST_SKIP       77
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+extern const uint8_t sea_map[];
+
+static lv_img_dsc_t flash_img = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.w = HOR_RES,
+    .header.h = VER_RES,
+    .data_size = IMG_BYTES,
+    .data = (const uint8_t *)XIP_BASE,
+};
+static lv_img_dsc_t ram_img;
+static lv_obj_t *img_obj;
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Write sea_map to an image file and map it at XIP_BASE and XIP_NOCACHE_NOALLOC_BASE
+ */
+static bool flash_map(void)
+{
+    char path[] = "/tmp/xip_imageXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        return false;
+    }
+    unlink(path);
+    if (write(fd, sea_map, IMG_BYTES) != IMG_BYTES) {
+        close(fd);
+        return false;
+    }
+
+    const uintptr_t bases[] = {XIP_BASE, XIP_NOCACHE_NOALLOC_BASE};
+    for (unsigned i = 0; i < 2; i++) {
+        void *p = mmap((void *)bases[i], IMG_BYTES, PROT_READ, MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+        if (p != (void *)bases[i]) {
+            close(fd);
+            return false;
+        }
+    }
+    close(fd);
+    return true;
+}
+
+static void settle(void)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    disp_engine_stats_t stats;
+
+    do {
+        lv_timer_handler();
+        vTaskDelay(1);
+    } while (disp->inv_p != 0);
+
+    do {
+        vTaskDelay(1);
+        disp_get_engine_stats(&stats);
+    } while (stats.depth != 0 || st7796_is_busy());
+}
+
+static uint32_t gram_mismatches(void)
+{
+    uint32_t bad = 0;
+
+    lv_mock_render_reference(ref_fb);
+    for (uint32_t y = 0; y < VER_RES; y++) {
+        for (uint32_t x = 0; x < HOR_RES; x++) {
+            uint16_t want = ref_fb[y * HOR_RES + x].full;
+#if LV_COLOR_16_SWAP
+            want = (uint16_t)((want >> 8) | (want << 8));
+#endif
+            bad += panel_pixel(x, y) != want;
+        }
+    }
+    return bad;
+}
+
+/**
+ * @brief Full-screen flash image with nothing over it: every stripe is streamed
+ */
+static void test_full_screen(void)
+{
+    uint32_t bytes = disp_get_xip_stream_bytes();
+
+    img_obj = lv_img_create(lv_scr_act());
+    lv_img_set_src(img_obj, &flash_img);
+    settle();
+
+    TEST_CHECK_EQ(disp_get_xip_stream_bytes() - bytes, IMG_BYTES);
+    TEST_CHECK_EQ(gram_mismatches(), 0);
+}
+
+/**
+ * @brief A button over the image: its stripes are blended in the draw buffer, the others streamed
+ */
+static void test_covered_stripes(void)
+{
+    disp_engine_stats_t stats;
+
+    lv_obj_t *btn = lv_btn_create(lv_scr_act());
+    lv_obj_set_pos(btn, 40, BTN_Y);
+    lv_obj_set_size(btn, 120, BTN_H);
+    settle();
+    TEST_CHECK_EQ(gram_mismatches(), 0);
+
+    // 1. Redrawing the button area only: nothing there may be streamed
+    uint32_t bytes = disp_get_xip_stream_bytes();
+    lv_obj_invalidate(btn);
+    settle();
+    TEST_CHECK_EQ(disp_get_xip_stream_bytes() - bytes, 0);
+    TEST_CHECK_EQ(gram_mismatches(), 0);
+
+    // 2. Full redraw: all but the stripes touching the button rows
+    disp_get_engine_stats(&stats);
+    bytes = disp_get_xip_stream_bytes();
+    lv_obj_invalidate(lv_scr_act());
+    settle();
+    uint32_t streamed = disp_get_xip_stream_bytes() - bytes;
+    TEST_CHECK_RANGE(streamed, IMG_BYTES - (BTN_H + 2 * stats.rows) * HOR_RES * 2,
+                     IMG_BYTES - BTN_H * HOR_RES * 2);
+    TEST_CHECK_EQ(gram_mismatches(), 0);
+
+    lv_obj_del(btn);
+    settle();
+}
+
+/**
+ * @brief The same pixels from RAM go through the draw buffer
+ */
+static void test_ram_image(void)
+{
+    ram_img = flash_img;
+    ram_img.data = sea_map;
+
+    uint32_t bytes = disp_get_xip_stream_bytes();
+    lv_img_set_src(img_obj, &ram_img);
+    settle();
+    TEST_CHECK_EQ(disp_get_xip_stream_bytes() - bytes, 0);
+    TEST_CHECK_EQ(gram_mismatches(), 0);
+}
+
+static void lvgl_task(void *param)
+{
+    (void)param;
+
+    lv_init();
+    lv_port_disp_init();
+    settle();
+
+    TEST_RUN(test_full_screen);
+    TEST_RUN(test_covered_stripes);
+    TEST_RUN(test_ram_image);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void vApplicationTickHook(void)
+{
+    lv_tick_inc(1);
+}
+
+int main(void)
+{
+    TaskHandle_t task;
+
+    if (!flash_map()) {
+        printf("can't map the flash image at XIP_BASE, skipped\n");
+        return TEST_SKIP;
+    }
+
+    panel_attach_spi(0);
+    xTaskCreate(lvgl_task, "LVGL", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 1);
+
+    for (uint32_t s = 0; s < 600 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
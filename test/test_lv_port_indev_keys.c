@@ -0,0 +1,354 @@
+/**
+ * @file test_lv_port_indev_keys.c
+ * @brief Keypad focus navigation through lv_port_indev: scripted keys and joystick, latency,
+ *        read timer paused while no key is held
+ * @note lv_port_indev registers the GT911 pointer and the keypad, LVGL runs the task1 loop of
+ *       main.c. A script task presses keys the way main.c's button dispatch and joystick task do
+ *       (lv_port_indev_key(), lv_port_indev_joystick(), lv_port_indev_joystick_release()).
+ *       A spy counts the keypad reads.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "ctp.h"
+#include "gt911.h"
+#include "lvgl.h"
+#include "lv_port_indev.h"
+#include "lv_port_os.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         320
+#define VER_RES         480
+#define BTNS            5
+#define TAP_MS          50
+#define JOY_CENTER      2048
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Scripted input: a key tap, or a joystick position held for hold_ms
+ */
+typedef struct {
+    uint32_t key;               // 0: joystick step
+    uint16_t x;
+    uint16_t y;
+    uint32_t hold_ms;
+    int32_t focus;              // Focused button afterwards
+} step_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+extern lv_indev_t *indev_touchpad;
+extern lv_indev_t *indev_keypad;
+
+static SemaphoreHandle_t lvgl_mutex;
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_color_t buf[HOR_RES * 20];
+static lv_obj_t *btns[BTNS];
+
+static void (*keypad_read_cb)(lv_indev_drv_t *drv, lv_indev_data_t *data);
+static volatile uint32_t keypad_reads = 0;
+static volatile uint32_t focus_changes = 0;
+static volatile uint64_t focus_ns = 0;      // Time of the last focus change
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    (void)area;
+    (void)color_p;
+    lv_disp_flush_ready(drv);
+}
+
+static void keypad_read_spy(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+    keypad_read_cb(drv, data);
+    keypad_reads++;
+}
+
+static void focus_cb(lv_event_t *e)
+{
+    (void)e;
+    focus_changes++;
+    focus_ns = sim_now();
+}
+
+/**
+ * @brief The task1 loop of main.c
+ */
+static void lvgl_task(void *param)
+{
+    (void)param;
+
+    lv_port_os_init();
+    for (;;) {
+        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+        uint32_t next_ms = lv_port_os_timer_handler();
+        xSemaphoreGive(lvgl_mutex);
+        lv_port_os_wait(next_ms);
+    }
+}
+
+static int32_t focused(void)
+{
+    int32_t r = -1;
+
+    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    lv_obj_t *obj = lv_group_get_focused(lv_group_get_default());
+    for (int32_t i = 0; i < BTNS; i++) {
+        if (btns[i] == obj) {
+            r = i;
+        }
+    }
+    xSemaphoreGive(lvgl_mutex);
+    return r;
+}
+
+static bool read_timers_paused(void)
+{
+    bool paused;
+
+    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    paused = indev_keypad->driver->read_timer->paused && indev_touchpad->driver->read_timer->paused;
+    xSemaphoreGive(lvgl_mutex);
+    return paused;
+}
+
+/**
+ * @brief Released and idle: no keypad read, both read timers paused
+ */
+static void test_idle(void)
+{
+    uint32_t reads = keypad_reads;
+
+    vTaskDelay(pdMS_TO_TICKS(2000));
+    printf("idle: %u keypad reads in 2 s\n", (unsigned)(keypad_reads - reads));
+    TEST_CHECK_EQ(keypad_reads, reads);
+    TEST_CHECK(read_timers_paused());
+}
+
+/**
+ * @brief Taps and joystick deflections walk the focus. Each press moves it within a fraction
+ *        of a tick (the wakeup reads the keypad), the keypad is only read on events and while
+ *        pressed, the read timers are paused again afterwards.
+ */
+static void test_navigation(void)
+{
+    static const step_t script[] = {
+        { LV_KEY_NEXT, 0, 0, TAP_MS, 1 },
+        { LV_KEY_NEXT, 0, 0, TAP_MS, 2 },
+        { LV_KEY_PREV, 0, 0, TAP_MS, 1 },
+        { 0, 4000, JOY_CENTER, TAP_MS, 2 },         // Right
+        { 0, JOY_CENTER, JOY_CENTER, TAP_MS, 2 },
+        { 0, JOY_CENTER, 100, TAP_MS, 3 },          // Down
+        { 0, JOY_CENTER, JOY_CENTER, TAP_MS, 3 },
+        { 0, JOY_CENTER, 4000, TAP_MS, 2 },         // Up
+        { 0, JOY_CENTER, JOY_CENTER, TAP_MS, 2 },
+        { 0, 100, JOY_CENTER, TAP_MS, 1 },          // Left
+        { 0, JOY_CENTER, JOY_CENTER, TAP_MS, 1 },
+        { LV_KEY_PREV, 0, 0, TAP_MS, 0 },
+        { LV_KEY_PREV, 0, 0, TAP_MS, BTNS - 1 },    // Wraps
+    };
+    lv_port_key_stats_t k0, k1;
+    uint64_t worst_ns = 0;
+    uint32_t presses = 0;
+    uint32_t reads = keypad_reads;
+
+    lv_port_indev_get_key_stats(&k0);
+    for (size_t i = 0; i < sizeof(script) / sizeof(script[0]); i++) {
+        const step_t *s = &script[i];
+        uint32_t changes = focus_changes;
+        uint64_t t0 = sim_now();
+
+        if (s->key != 0) {
+            lv_port_indev_key(s->key, true);
+            vTaskDelay(pdMS_TO_TICKS(s->hold_ms));
+            lv_port_indev_key(s->key, false);
+        } else {
+            lv_port_indev_joystick(s->x, s->y);
+            vTaskDelay(pdMS_TO_TICKS(s->hold_ms));
+        }
+        vTaskDelay(pdMS_TO_TICKS(TAP_MS));
+
+        int32_t f = focused();
+        if (f != s->focus) {
+            printf("step %u: focus on %d, expected %d\n", (unsigned)i, (int)f, (int)s->focus);
+        }
+        TEST_CHECK_EQ(f, s->focus);
+        if (focus_changes != changes) {
+            presses++;
+            worst_ns = focus_ns - t0 > worst_ns ? focus_ns - t0 : worst_ns;
+        }
+    }
+    lv_port_indev_get_key_stats(&k1);
+
+    uint32_t events = k1.events - k0.events;
+    printf("navigation: %u presses, %u key events, %u keypad reads, worst latency %.1f us "
+           "(queue %u us max)\n", (unsigned)presses, (unsigned)events, (unsigned)(keypad_reads - reads),
+           worst_ns / 1e3, (unsigned)k1.latency_max_us);
+    TEST_CHECK_EQ(presses, 9);
+    TEST_CHECK_EQ(events, 2 * presses);
+    TEST_CHECK_EQ(k1.dropped, k0.dropped);
+    TEST_CHECK(worst_ns < SIM_US(200));
+    TEST_CHECK(k1.latency_max_us < 200);
+    // One read per event, plus read timer polls while a key is held
+    TEST_CHECK(keypad_reads - reads <= events + presses * (TAP_MS / LV_INDEV_DEF_READ_PERIOD + 1));
+
+    vTaskDelay(pdMS_TO_TICKS(100));
+    TEST_CHECK(read_timers_paused());
+}
+
+/**
+ * @brief The joystick held over: one press, long press repeat moves on, and the release
+ *        hysteresis keeps a stick drifting back to INDEV_JOY_RELEASE from pressing again
+ */
+static void test_joystick_hold(void)
+{
+    uint32_t changes = focus_changes;
+    uint32_t hold_ms = LV_INDEV_DEF_LONG_PRESS_TIME + 6 * LV_INDEV_DEF_LONG_PRESS_REP_TIME;
+    lv_port_key_stats_t k0, k1;
+
+    lv_port_indev_get_key_stats(&k0);
+    lv_port_indev_joystick(JOY_CENTER + 1300, JOY_CENTER);
+    vTaskDelay(pdMS_TO_TICKS(hold_ms));
+    TEST_CHECK(!read_timers_paused());
+
+    // Drifting back, still past the release threshold: held
+    lv_port_indev_joystick(JOY_CENTER + 700, JOY_CENTER);
+    lv_port_indev_joystick(JOY_CENTER + 1300, JOY_CENTER);
+    lv_port_indev_joystick(JOY_CENTER + 500, JOY_CENTER);
+    vTaskDelay(pdMS_TO_TICKS(100));
+    lv_port_indev_get_key_stats(&k1);
+
+    printf("joystick held %u ms: %u focus changes\n", (unsigned)hold_ms, (unsigned)(focus_changes - changes));
+    TEST_CHECK(focus_changes - changes >= 1 + 6 / 2);
+    TEST_CHECK_EQ(k1.events - k0.events, 2);
+    TEST_CHECK(read_timers_paused());
+}
+
+/**
+ * @brief The joystick task of main.c: keys, or the hardware demo ball
+ */
+static void joystick_sample(bool ball, uint16_t x, uint16_t y)
+{
+    if (!ball) {
+        lv_port_indev_joystick(x, y);
+    } else {
+        lv_port_indev_joystick_release();
+    }
+}
+
+/**
+ * @brief The hardware demo takes the joystick over while it is deflected: the key it held is
+ *        released, no long press repeat, read timers paused
+ */
+static void test_joystick_mode_switch(void)
+{
+    uint32_t changes = focus_changes;
+    lv_port_key_stats_t k0, k1;
+
+    lv_port_indev_get_key_stats(&k0);
+    joystick_sample(false, JOY_CENTER + 1300, JOY_CENTER);
+    vTaskDelay(pdMS_TO_TICKS(TAP_MS));
+    joystick_sample(true, JOY_CENTER + 1300, JOY_CENTER);
+    vTaskDelay(pdMS_TO_TICKS(LV_INDEV_DEF_LONG_PRESS_TIME + 4 * LV_INDEV_DEF_LONG_PRESS_REP_TIME));
+    joystick_sample(true, JOY_CENTER, JOY_CENTER);
+    lv_port_indev_get_key_stats(&k1);
+
+    printf("mode switch while deflected: %u focus changes\n", (unsigned)(focus_changes - changes));
+    TEST_CHECK_EQ(focus_changes - changes, 1);
+    TEST_CHECK_EQ(k1.events - k0.events, 2);
+    TEST_CHECK(read_timers_paused());
+
+    // Back to keys: the stick drives the focus again
+    changes = focus_changes;
+    joystick_sample(false, JOY_CENTER - 1300, JOY_CENTER);
+    vTaskDelay(pdMS_TO_TICKS(TAP_MS));
+    joystick_sample(false, JOY_CENTER, JOY_CENTER);
+    vTaskDelay(pdMS_TO_TICKS(TAP_MS));
+    TEST_CHECK_EQ(focus_changes - changes, 1);
+    TEST_CHECK(read_timers_paused());
+}
+
+static void script_task(void *param)
+{
+    (void)param;
+
+    // Let start-up settle: first refresh, paused timers
+    vTaskDelay(pdMS_TO_TICKS(500));
+
+    TEST_RUN(test_idle);
+    TEST_RUN(test_navigation);
+    TEST_RUN(test_joystick_hold);
+    TEST_RUN(test_joystick_mode_switch);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void vApplicationTickHook(void)
+{
+    lv_tick_inc(1);
+}
+
+int main(void)
+{
+    static const uint8_t info[] = { '9', '1', '1', 0, 0x60, 0x10, HOR_RES & 0xFF, HOR_RES >> 8,
+                                    VER_RES & 0xFF, VER_RES >> 8, 0 };
+    TaskHandle_t task;
+
+    ctp_attach();
+    memcpy(&ctp_regs()[GT911_REG_PRODUCT_ID1], info, sizeof(info));
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HOR_RES * 20);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+    lv_port_indev_init();
+
+    // Created after lv_port_indev_init(): they join the keypad's default group
+    for (uint32_t i = 0; i < BTNS; i++) {
+        btns[i] = lv_btn_create(lv_scr_act());
+        lv_obj_set_pos(btns[i], 20, (lv_coord_t)(60 + i * 70));
+        lv_obj_add_event_cb(btns[i], focus_cb, LV_EVENT_FOCUSED, NULL);
+    }
+    keypad_read_cb = indev_keypad->driver->read_cb;
+    indev_keypad->driver->read_cb = keypad_read_spy;
+
+    lvgl_mutex = xSemaphoreCreateMutex();
+    xTaskCreate(lvgl_task, "task1", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 1);
+    xTaskCreate(script_task, "script", 1024, NULL, 1, &task);
+    vTaskCoreAffinitySet(task, 1 << 0);
+
+    for (uint32_t s = 0; s < 600 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
@@ -0,0 +1,295 @@
+/**
+ * @file test_lv_port_indev_touch.c
+ * @brief Touch path from the GT911 INT pin to LVGL: every reported frame reaches the pointer
+ * @note The touch model reports frames at 200 Hz with INT pulses, the touch task reads them over
+ *       the I2C model and LVGL runs the task1 loop of main.c. A script task stalls the LVGL task
+ *       by holding its mutex. Built with INT_TRIGGER 0 (rising pulses) and 1 (falling), and with
+ *       NO_CTP (nothing answering at 0x5D) for the init failure.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "ctp.h"
+#include "gt911.h"
+#include "lvgl.h"
+#include "lv_port_indev.h"
+#include "lv_port_os.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef INT_TRIGGER
+#define INT_TRIGGER     0
+#endif
+#ifndef NO_CTP
+#define NO_CTP          0
+#endif
+
+#define HOR_RES         320
+#define VER_RES         480
+#define REPORT_US       5000
+#define FRAMES_MAX      128
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+extern lv_indev_t *indev_touchpad;
+extern lv_indev_t *indev_keypad;
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_color_t buf[HOR_RES * 20];
+
+#if !NO_CTP
+static SemaphoreHandle_t lvgl_mutex;
+static gt911_touch_t frames[FRAMES_MAX];
+
+/* What LVGL read from the touchpad */
+static void (*touchpad_read_cb)(lv_indev_drv_t *drv, lv_indev_data_t *data);
+static uint32_t lvgl_reads = 0;
+static lv_indev_data_t lvgl_last;
+static volatile bool done = false;
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    (void)area;
+    (void)color_p;
+    lv_disp_flush_ready(drv);
+}
+
+#if NO_CTP
+/**
+ * @brief Nothing answers at 0x5D: no pointer device, the keypad is still there
+ */
+static void test_init_failed(void)
+{
+    lv_port_touch_stats_t s;
+
+    lv_port_indev_get_touch_stats(&s);
+    TEST_CHECK(s.init_failed);
+    TEST_CHECK(indev_touchpad == NULL);
+    TEST_CHECK(indev_keypad != NULL);
+}
+
+#else
+
+static void touchpad_read_spy(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+    touchpad_read_cb(drv, data);
+    lvgl_reads++;
+    lvgl_last = *data;
+}
+
+/**
+ * @brief The task1 loop of main.c
+ */
+static void lvgl_task(void *param)
+{
+    (void)param;
+
+    lv_port_os_init();
+    for (;;) {
+        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+        uint32_t next_ms = lv_port_os_timer_handler();
+        xSemaphoreGive(lvgl_mutex);
+        lv_port_os_wait(next_ms);
+    }
+}
+
+/**
+ * @brief A drag of count - 1 moving frames and the release
+ */
+static size_t make_drag(size_t count, uint16_t x0)
+{
+    for (size_t i = 0; i < count - 1; i++) {
+        frames[i] = (gt911_touch_t){ .count = 1 };
+        frames[i].points[0] = (gt911_point_t){ .id = 0, .x = (uint16_t)(x0 + 2 * i), .y = (uint16_t)(20 + 3 * i), .size = 20 };
+    }
+    frames[count - 1] = (gt911_touch_t){ .count = 0 };
+    return count;
+}
+
+/**
+ * @brief Play a drag, with the LVGL task stalled for stall_ms from the first frame
+ * @param delta Output: touch statistics gained
+ * @param bus Output: touch model statistics gained
+ */
+static void play_drag(size_t count, uint32_t stall_ms, lv_port_touch_stats_t *delta, ctp_stats_t *bus)
+{
+    lv_port_touch_stats_t s0, s1;
+    ctp_stats_t c0, c1;
+
+    lv_port_indev_get_touch_stats(&s0);
+    ctp_get_stats(&c0);
+
+    size_t n = make_drag(count, 40);
+    if (stall_ms > 0) {
+        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    }
+    ctp_play(frames, n, REPORT_US);
+    if (stall_ms > 0) {
+        vTaskDelay(pdMS_TO_TICKS(stall_ms));
+        xSemaphoreGive(lvgl_mutex);
+    }
+    while (ctp_playing()) {
+        vTaskDelay(1);
+    }
+    vTaskDelay(pdMS_TO_TICKS(50));
+
+    lv_port_indev_get_touch_stats(&s1);
+    ctp_get_stats(&c1);
+    delta->samples = s1.samples - s0.samples;
+    delta->coalesced = s1.coalesced - s0.coalesced;
+    delta->dropped = s1.dropped - s0.dropped;
+    delta->unchanged = s1.unchanged - s0.unchanged;
+    bus->frames = c1.frames - c0.frames;
+    bus->frames_lost = c1.frames_lost - c0.frames_lost;
+    bus->status_clears = c1.status_clears - c0.status_clears;
+    bus->reads = c1.reads - c0.reads;
+}
+
+/**
+ * @brief A 200 Hz drag: one INT edge and one read per frame, every frame reaches LVGL (but the
+ *        few the filter smoothed into the same pointer position, at the start of the drag)
+ */
+static void test_drag(void)
+{
+    lv_port_touch_stats_t d;
+    ctp_stats_t bus;
+    uint32_t reads = lvgl_reads;
+
+    play_drag(100, 0, &d, &bus);
+    printf("drag: %u frames, %u reads, %u samples (%u unchanged), %u LVGL reads\n", (unsigned)bus.frames,
+           (unsigned)bus.reads, (unsigned)d.samples, (unsigned)d.unchanged, (unsigned)(lvgl_reads - reads));
+    TEST_CHECK_EQ(bus.frames, 100);
+    TEST_CHECK_EQ(bus.frames_lost, 0);
+    TEST_CHECK_EQ(bus.status_clears, 100);
+    TEST_CHECK_EQ(bus.reads, 100);
+    TEST_CHECK_EQ(d.samples + d.unchanged, 100);
+    TEST_CHECK(d.unchanged <= 2);
+    TEST_CHECK_EQ(d.coalesced, 0);
+    TEST_CHECK_EQ(d.dropped, 0);
+    TEST_CHECK(lvgl_last.state == LV_INDEV_STATE_REL);
+}
+
+/**
+ * @brief The LVGL task stalled for INDEV_TOUCH_STALL_MS: the queue holds every frame
+ */
+static void test_stall(void)
+{
+    lv_port_touch_stats_t d;
+    ctp_stats_t bus;
+
+    play_drag(60, 120, &d, &bus);
+    printf("120 ms stall: %u frames, %u samples (%u unchanged), %u coalesced\n", (unsigned)bus.frames,
+           (unsigned)d.samples, (unsigned)d.unchanged, (unsigned)d.coalesced);
+    TEST_CHECK_EQ(bus.frames_lost, 0);
+    TEST_CHECK_EQ(bus.reads, 60);
+    TEST_CHECK_EQ(d.samples + d.unchanged, 60);
+    TEST_CHECK(d.unchanged <= 2);
+    TEST_CHECK_EQ(d.coalesced, 0);
+    TEST_CHECK_EQ(d.dropped, 0);
+    TEST_CHECK(lvgl_last.state == LV_INDEV_STATE_REL);
+}
+
+/**
+ * @brief A longer stall: the GT911 is still read every frame, moves past the queue are coalesced
+ *        into the newest one and counted, the release isn't lost
+ */
+static void test_long_stall(void)
+{
+    lv_port_touch_stats_t d;
+    ctp_stats_t bus;
+
+    play_drag(120, 400, &d, &bus);
+    printf("400 ms stall: %u frames, %u samples, %u coalesced\n", (unsigned)bus.frames,
+           (unsigned)d.samples, (unsigned)d.coalesced);
+    TEST_CHECK_EQ(bus.frames_lost, 0);
+    TEST_CHECK_EQ(bus.reads, 120);
+    TEST_CHECK(d.coalesced > 0);
+    TEST_CHECK_EQ(d.samples + d.coalesced + d.unchanged, 120);
+    TEST_CHECK_EQ(d.dropped, 0);
+    TEST_CHECK(lvgl_last.state == LV_INDEV_STATE_REL);
+}
+
+static void script_task(void *param)
+{
+    (void)param;
+
+    // Let start-up settle: touch task waiting on INT, first refresh
+    vTaskDelay(pdMS_TO_TICKS(500));
+
+    TEST_RUN(test_drag);
+    TEST_RUN(test_stall);
+    TEST_RUN(test_long_stall);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void vApplicationTickHook(void)
+{
+    lv_tick_inc(1);
+}
+
+int main(void)
+{
+#if !NO_CTP
+    static const uint8_t info[] = { '9', '1', '1', 0, 0x60, 0x10, HOR_RES & 0xFF, HOR_RES >> 8,
+                                    VER_RES & 0xFF, VER_RES >> 8, 0 };
+    ctp_attach();
+    memcpy(&ctp_regs()[GT911_REG_PRODUCT_ID1], info, sizeof(info));
+    ctp_regs()[GT911_REG_MODULE_SWITCH1] = INT_TRIGGER;
+#endif
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HOR_RES * 20);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+    lv_port_indev_init();
+
+#if NO_CTP
+    TEST_RUN(test_init_failed);
+    return test_report();
+#else
+    touchpad_read_cb = indev_touchpad->driver->read_cb;
+    indev_touchpad->driver->read_cb = touchpad_read_spy;
+
+    TaskHandle_t task;
+    lvgl_mutex = xSemaphoreCreateMutex();
+    xTaskCreate(lvgl_task, "task1", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 1);
+    xTaskCreate(script_task, "script", 1024, NULL, 1, &task);
+    vTaskCoreAffinitySet(task, 1 << 0);
+
+    for (uint32_t s = 0; s < 600 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+#endif
+}
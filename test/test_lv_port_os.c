@@ -0,0 +1,285 @@
+/**
+ * @file test_lv_port_os.c
+ * @brief LVGL service task: wakeups while idle, animating and navigating with keys
+ * @note The service task runs the task1 loop of main.c on the FreeRTOS model. A script task
+ *       plays the other side: starts an animation, presses keys the way the button driver does
+ *       (queue, then lv_port_os_wake()).
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "lvgl.h"
+#include "lv_port_os.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         320
+#define VER_RES         480
+#define KEY_QUEUE       16
+#define BTNS            4
+#define ANIM_MS         1000
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static SemaphoreHandle_t lvgl_mutex;
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_color_t buf[HOR_RES * 20];
+static lv_indev_drv_t keypad_drv;
+static lv_obj_t *btns[BTNS];
+static lv_obj_t *box;
+
+static struct {
+    uint32_t key;
+    bool pressed;
+} key_queue[KEY_QUEUE];
+static volatile uint32_t key_head = 0;
+static volatile uint32_t key_tail = 0;
+static uint32_t key_state_key = LV_KEY_NEXT;
+static bool key_state_pressed = false;
+
+static uint32_t flushes = 0;
+static uint32_t focus_changes = 0;
+static uint64_t focus_ns = 0;       // Time of the last focus change
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    (void)area;
+    (void)color_p;
+    flushes++;
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * @brief Keypad read: one queued event per read, LVGL reads again while more are queued
+ */
+static void keypad_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+    (void)drv;
+
+    if (key_tail != key_head) {
+        key_state_key = key_queue[key_tail % KEY_QUEUE].key;
+        key_state_pressed = key_queue[key_tail % KEY_QUEUE].pressed;
+        key_tail++;
+    }
+    data->key = key_state_key;
+    data->state = key_state_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->continue_reading = key_tail != key_head;
+}
+
+static void key_event(uint32_t key, bool pressed)
+{
+    key_queue[key_head % KEY_QUEUE].key = key;
+    key_queue[key_head % KEY_QUEUE].pressed = pressed;
+    key_head++;
+    lv_port_os_wake();
+}
+
+static void focus_cb(lv_event_t *e)
+{
+    (void)e;
+    focus_changes++;
+    focus_ns = sim_now();
+}
+
+static void box_x(void *var, int32_t v)
+{
+    lv_obj_set_x(var, (lv_coord_t)v);
+}
+
+/**
+ * @brief The task1 loop of main.c
+ */
+static void lvgl_task(void *param)
+{
+    (void)param;
+
+    lv_port_os_init();
+    for (;;) {
+        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+        uint32_t next_ms = lv_port_os_timer_handler();
+        xSemaphoreGive(lvgl_mutex);
+        lv_port_os_wait(next_ms);
+    }
+}
+
+static uint32_t wakeups_during(uint32_t ms)
+{
+    lv_port_os_stats_t before, after;
+
+    lv_port_os_get_stats(&before);
+    vTaskDelay(pdMS_TO_TICKS(ms));
+    lv_port_os_get_stats(&after);
+    return after.wakeups - before.wakeups;
+}
+
+/**
+ * @brief Nothing to do: only the LV_PORT_OS_MAX_SLEEP_MS timeout, no input polling, no refresh
+ */
+static void test_idle(void)
+{
+    uint32_t f = flushes;
+    uint32_t n = wakeups_during(10000);
+
+    printf("idle: %u wakeups in 10 s\n", (unsigned)n);
+    TEST_CHECK(n <= 10000 / LV_PORT_OS_MAX_SLEEP_MS + 1);
+    TEST_CHECK_EQ(flushes, f);
+}
+
+/**
+ * @brief An animation: one wakeup per refresh period while it runs, idle again after
+ */
+static void test_animating(void)
+{
+    lv_anim_t a;
+    uint32_t f = flushes;
+
+    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, box);
+    lv_anim_set_exec_cb(&a, box_x);
+    lv_anim_set_values(&a, 0, HOR_RES - 50);
+    lv_anim_set_time(&a, ANIM_MS);
+    lv_anim_start(&a);
+    xSemaphoreGive(lvgl_mutex);
+    lv_port_os_wake();
+
+    uint32_t n = wakeups_during(ANIM_MS + 100);
+    uint32_t frames = ANIM_MS / LV_DEF_REFR_PERIOD;
+    printf("animating: %u wakeups, %u flushes in %u ms\n", (unsigned)n, (unsigned)(flushes - f),
+           (unsigned)(ANIM_MS + 100));
+    TEST_CHECK_RANGE(n, frames - 2, frames + 4);
+    TEST_CHECK(flushes - f >= frames - 2);
+    TEST_CHECK_EQ(lv_anim_count_running(), 0);
+
+    f = flushes;
+    n = wakeups_during(5000);
+    printf("after: %u wakeups in 5 s\n", (unsigned)n);
+    TEST_CHECK(n <= 5000 / LV_PORT_OS_MAX_SLEEP_MS + 1);
+    TEST_CHECK_EQ(flushes, f);
+}
+
+/**
+ * @brief Key taps move the focus right away, without a polling read timer
+ */
+static void test_key_latency(void)
+{
+    for (uint32_t i = 0; i < 5; i++) {
+        uint32_t changes = focus_changes;
+        uint64_t t0 = sim_now();
+        key_event(LV_KEY_NEXT, true);
+        vTaskDelay(pdMS_TO_TICKS(50));
+        TEST_CHECK_EQ(focus_changes, changes + 1);
+        TEST_CHECK(focus_ns - t0 < SIM_US(200));
+        key_event(LV_KEY_NEXT, false);
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    TEST_CHECK(lv_group_get_focused(lv_group_get_default()) == btns[5 % BTNS]);
+    xSemaphoreGive(lvgl_mutex);
+
+    // Released: the read timer is paused again
+    TEST_CHECK(wakeups_during(5000) <= 5000 / LV_PORT_OS_MAX_SLEEP_MS + 1);
+}
+
+/**
+ * @brief A held key is polled for long press repeat, then polling stops on release
+ */
+static void test_key_hold(void)
+{
+    uint32_t changes = focus_changes;
+    uint32_t hold_ms = LV_INDEV_DEF_LONG_PRESS_TIME + 10 * LV_INDEV_DEF_LONG_PRESS_REP_TIME;
+
+    key_event(LV_KEY_PREV, true);
+    uint32_t n = wakeups_during(hold_ms);
+    key_event(LV_KEY_PREV, false);
+    vTaskDelay(pdMS_TO_TICKS(50));
+
+    printf("held %u ms: %u focus changes, %u wakeups\n", (unsigned)hold_ms,
+           (unsigned)(focus_changes - changes), (unsigned)n);
+    // The press, then a repeat per repeat period (read timer granularity loses a few)
+    TEST_CHECK(focus_changes - changes >= 1 + 10 / 2);
+    TEST_CHECK(n >= hold_ms / LV_INDEV_DEF_READ_PERIOD / 2);
+
+    TEST_CHECK(wakeups_during(5000) <= 5000 / LV_PORT_OS_MAX_SLEEP_MS + 1);
+}
+
+static void script_task(void *param)
+{
+    (void)param;
+
+    // Let start-up settle: first refresh, paused timers
+    vTaskDelay(pdMS_TO_TICKS(1000));
+
+    TEST_RUN(test_idle);
+    TEST_RUN(test_animating);
+    TEST_RUN(test_key_latency);
+    TEST_RUN(test_key_hold);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void vApplicationTickHook(void)
+{
+    lv_tick_inc(1);
+}
+
+int main(void)
+{
+    TaskHandle_t task;
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HOR_RES * 20);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+
+    lv_group_set_default(lv_group_create());
+    for (uint32_t i = 0; i < BTNS; i++) {
+        btns[i] = lv_btn_create(lv_scr_act());
+        lv_obj_set_pos(btns[i], 20, (lv_coord_t)(100 + i * 60));
+        lv_obj_add_event_cb(btns[i], focus_cb, LV_EVENT_FOCUSED, NULL);
+    }
+    box = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(box, 50, 50);
+
+    lv_indev_drv_init(&keypad_drv);
+    keypad_drv.type = LV_INDEV_TYPE_KEYPAD;
+    keypad_drv.read_cb = keypad_read;
+    lv_indev_set_group(lv_indev_drv_register(&keypad_drv), lv_group_get_default());
+
+    lvgl_mutex = xSemaphoreCreateMutex();
+    xTaskCreate(lvgl_task, "task1", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 1);
+    xTaskCreate(script_task, "script", 1024, NULL, 1, &task);
+    vTaskCoreAffinitySet(task, 1 << 0);
+
+    for (uint32_t s = 0; s < 600 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
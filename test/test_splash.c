@@ -0,0 +1,213 @@
+/**
+ * @file test_splash.c
+ * @brief Compressed splash: splash_show() GRAM and the LVGL image decoder against sea_map
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "splash.h"
+#include "st7796.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_W           320
+#define IMG_H           480
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+extern const uint8_t sea_map[];
+extern const lv_img_dsc_t sea;
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_color_t buf_1[IMG_W * 24];
+static lv_color_t buf_2[IMG_W * 24];
+static lv_color_t fb[IMG_W * IMG_H];
+static uint32_t rng = 0x9E3779B9u;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+/**
+ * @brief Reference pixel: sea_map stores lv_color_t in memory order, byte swapped with LV_COLOR_16_SWAP
+ */
+static uint16_t sea_pixel(uint32_t x, uint32_t y)
+{
+    const uint8_t *p = &sea_map[(y * IMG_W + x) * 2];
+#if LV_COLOR_16_SWAP
+    return (uint16_t)((p[0] << 8) | p[1]);
+#else
+    return (uint16_t)(p[0] | (p[1] << 8));
+#endif
+}
+
+static uint16_t color_native(lv_color_t c)
+{
+#if LV_COLOR_16_SWAP
+    return (uint16_t)((c.full >> 8) | (c.full << 8));
+#else
+    return c.full;
+#endif
+}
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    (void)area;
+    (void)color_p;
+    lv_disp_flush_ready(drv);
+}
+
+static uint32_t gram_mismatches(void)
+{
+    uint32_t bad = 0;
+    for (uint32_t y = 0; y < IMG_H; y++) {
+        for (uint32_t x = 0; x < IMG_W; x++) {
+            if (panel_pixel(x, y) != sea_pixel(x, y)) {
+                if (bad++ == 0) {
+                    printf("first mismatch at (%u, %u): 0x%04x, expected 0x%04x\n",
+                           (unsigned)x, (unsigned)y, panel_pixel(x, y), sea_pixel(x, y));
+                }
+            }
+        }
+    }
+    return bad;
+}
+
+/**
+ * @brief splash_show() with a given draw buffer layout
+ */
+static void show_with(lv_color_t *b1, lv_color_t *b2, uint32_t rows)
+{
+    draw_buf.buf1 = b1;
+    draw_buf.buf2 = b2;
+    draw_buf.buf_act = b1;
+    draw_buf.size = IMG_W * rows;
+
+    panel_fill(0x0000);
+    panel_reset_stats();
+    splash_show();
+    TEST_CHECK(!st7796_is_busy());
+
+    panel_stats_t ps;
+    panel_get_stats(&ps);
+    TEST_CHECK_EQ(ps.pixels, IMG_W * IMG_H);
+    TEST_CHECK_EQ(ps.cmd_count[ST7796_CMD_RAMWR], (IMG_H + rows - 1) / rows);
+    TEST_CHECK_EQ(gram_mismatches(), 0);
+}
+
+/**
+ * @brief Boot splash: double buffer, single buffer, stripe heights that don't divide the image
+ */
+static void test_show(void)
+{
+    show_with(buf_1, buf_2, 10);
+    show_with(buf_1, NULL, 10);
+    show_with(buf_1, buf_2, 7);
+    show_with(buf_1, NULL, 24);
+}
+
+/**
+ * @brief Decoder reads: whole rows in order, then random partial rows in random order
+ */
+static void test_decoder_read_line(void)
+{
+    lv_img_decoder_dsc_t dsc;
+    lv_img_header_t header;
+    lv_color_t line[IMG_W];
+
+    TEST_CHECK_EQ(lv_img_decoder_get_info(&splash_img, &header), LV_RES_OK);
+    TEST_CHECK_EQ(header.cf, LV_IMG_CF_TRUE_COLOR);
+    TEST_CHECK_EQ(header.w, IMG_W);
+    TEST_CHECK_EQ(header.h, IMG_H);
+
+    TEST_CHECK_EQ(lv_img_decoder_open(&dsc, &splash_img, lv_color_black(), 0), LV_RES_OK);
+    TEST_CHECK(dsc.img_data == NULL);
+
+    uint32_t bad = 0;
+    for (uint32_t y = 0; y < IMG_H; y++) {
+        TEST_CHECK_EQ(lv_img_decoder_read_line(&dsc, 0, (lv_coord_t)y, IMG_W, (uint8_t *)line), LV_RES_OK);
+        for (uint32_t x = 0; x < IMG_W; x++) {
+            bad += color_native(line[x]) != sea_pixel(x, y);
+        }
+    }
+    TEST_CHECK_EQ(bad, 0);
+
+    for (uint32_t i = 0; i < 2000; i++) {
+        lv_coord_t y = (lv_coord_t)(rand_u32() % IMG_H);
+        lv_coord_t x = (lv_coord_t)(rand_u32() % IMG_W);
+        lv_coord_t len = (lv_coord_t)(1 + rand_u32() % (IMG_W - x));
+        TEST_CHECK_EQ(lv_img_decoder_read_line(&dsc, x, y, len, (uint8_t *)line), LV_RES_OK);
+        for (lv_coord_t k = 0; k < len; k++) {
+            bad += color_native(line[k]) != sea_pixel(x + k, y);
+        }
+    }
+    TEST_CHECK_EQ(bad, 0);
+
+    lv_img_decoder_close(&dsc);
+
+    // Other images still go to the built-in decoder
+    TEST_CHECK_EQ(lv_img_decoder_open(&dsc, &sea, lv_color_black(), 0), LV_RES_OK);
+    TEST_CHECK(dsc.img_data == sea_map);
+    lv_img_decoder_close(&dsc);
+}
+
+/**
+ * @brief The splash as an LVGL image object renders the same pixels as the uncompressed one
+ */
+static void test_decoder_render(void)
+{
+    lv_obj_t *img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, &splash_img);
+    TEST_CHECK_EQ(lv_area_get_width(&img->coords), IMG_W);
+    TEST_CHECK_EQ(lv_area_get_height(&img->coords), IMG_H);
+
+    lv_mock_render_reference(fb);
+    uint32_t bad = 0;
+    for (uint32_t y = 0; y < IMG_H; y++) {
+        for (uint32_t x = 0; x < IMG_W; x++) {
+            bad += color_native(fb[y * IMG_W + x]) != sea_pixel(x, y);
+        }
+    }
+    TEST_CHECK_EQ(bad, 0);
+    lv_obj_del(img);
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    panel_attach_spi(0);
+    st7796_init();
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf_1, buf_2, IMG_W * 10);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = IMG_W;
+    disp_drv.ver_res = IMG_H;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+    splash_init();
+
+    TEST_RUN(test_show);
+    TEST_RUN(test_decoder_read_line);
+    TEST_RUN(test_decoder_render);
+    return test_report();
+}
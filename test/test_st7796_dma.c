@@ -0,0 +1,205 @@
+/**
+ * @file test_st7796_dma.c
+ * @brief ST7796 DMA transfers against the panel model: window setup, pixel bytes, completion order
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "st7796.h"
+#include "pico/stdlib.h"
+#include "hardware/irq.h"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    int calls;
+    uint64_t t_ns;
+    int irq;
+    bool cs;
+    uint32_t pixels;
+} done_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint16_t src[32 * 16];
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void on_done(void *user_data)
+{
+    done_t *d = user_data;
+    panel_stats_t ps;
+
+    panel_get_stats(&ps);
+    d->calls++;
+    d->t_ns = sim_now();
+    d->irq = sim_irq_active();
+    d->cs = sim_gpio_level(ST7796_PIN_CS);
+    d->pixels = ps.pixels;
+}
+
+/**
+ * @brief Let the bus finish
+ * @note PIO: DMA completion means the last word is in the TX FIFO, the engine still shifts it out
+ */
+static void drain(void)
+{
+#if ST7796_BUS_PIO
+    sim_run_for(SIM_US(20));
+#endif
+}
+
+/**
+ * @brief Check CASET/RASET/RAMWR (with parameters) come first and pixels only after RAMWR
+ */
+static void check_window_log(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint32_t pixels)
+{
+    static const uint8_t expect_cmd[3] = { ST7796_CMD_CASET, ST7796_CMD_RASET, ST7796_CMD_RAMWR };
+    const uint8_t expect_param[2][4] = {
+        { x1 >> 8, x1 & 0xFF, x2 >> 8, x2 & 0xFF },
+        { y1 >> 8, y1 & 0xFF, y2 >> 8, y2 & 0xFF },
+    };
+    size_t n;
+    const panel_event_t *ev = panel_events(&n);
+
+    TEST_CHECK_EQ(n, 3 + 8 + pixels);
+    if (n != 3 + 8 + pixels) {
+        return;
+    }
+
+    size_t i = 0;
+    for (int c = 0; c < 3; c++) {
+        TEST_CHECK_EQ(ev[i].kind, PANEL_EV_CMD);
+        TEST_CHECK_EQ(ev[i].value, expect_cmd[c]);
+        i++;
+        for (int p = 0; c < 2 && p < 4; p++, i++) {
+            TEST_CHECK_EQ(ev[i].kind, PANEL_EV_PARAM);
+            TEST_CHECK_EQ(ev[i].value, expect_param[c][p]);
+        }
+    }
+    for (; i < n; i++) {
+        TEST_CHECK_EQ(ev[i].kind, PANEL_EV_PIXEL);
+    }
+}
+
+static void test_init_sequence(void)
+{
+    panel_stats_t ps;
+
+    panel_get_stats(&ps);
+    TEST_CHECK_EQ(panel_madctl(), 0x48);
+    TEST_CHECK_EQ(ps.cmd_count[ST7796_CMD_SLPOUT], 1);
+    TEST_CHECK_EQ(ps.cmd_count[ST7796_CMD_DISPON], 1);
+    TEST_CHECK_EQ(ps.cmd_count[ST7796_CMD_INVON], 1);
+    TEST_CHECK_EQ(ps.bytes_cs_high, 0);
+}
+
+/**
+ * @brief Strided rectangle: window first, every pixel in GRAM before the completion callback
+ */
+static void test_rect_ordering(void)
+{
+    done_t done = { 0 };
+    st7796_timing_t timing;
+    panel_stats_t ps;
+    const uint16_t w = 20, h = 12, stride = 32;
+
+    panel_clear_log();
+    panel_reset_stats();
+    st7796_set_window(10, 20, 10 + w - 1, 20 + h - 1);
+    st7796_write_rect_async(src + 3, w, h, stride, on_done, &done);
+    TEST_CHECK(st7796_is_busy());
+    st7796_wait_idle();
+    drain();
+
+    TEST_CHECK_EQ(done.calls, 1);
+    TEST_CHECK_EQ(done.irq, DMA_IRQ_0);
+    TEST_CHECK_EQ(done.pixels, w * h);
+#if !ST7796_BUS_PIO
+    TEST_CHECK(done.cs);
+#endif
+
+    panel_get_stats(&ps);
+    TEST_CHECK(ps.last_pixel_ns <= done.t_ns);
+    TEST_CHECK_EQ(ps.bytes_cs_high, 0);
+    check_window_log(10, 20, 10 + w - 1, 20 + h - 1, w * h);
+
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++) {
+            TEST_CHECK_EQ(panel_pixel(10 + x, 20 + y), src[3 + y * stride + x]);
+        }
+    }
+
+    // 16 bits per pixel at 62.5 MHz; end_us is the last pixel on the wire on both buses
+    st7796_get_timing(&timing);
+    TEST_CHECK_EQ(timing.bytes, w * h * 2);
+    TEST_CHECK(timing.end_us >= timing.start_us);
+    TEST_CHECK(timing.end_us - timing.start_us >= (uint32_t)(w * h * 256 / 1000) - 1);
+    TEST_CHECK_RANGE((uint64_t)timing.end_us * 1000, ps.last_pixel_ns - 1000, ps.last_pixel_ns + 2000);
+}
+
+static void test_fill(void)
+{
+    done_t done = { 0 };
+    const uint16_t color = 0xF81F;
+
+    panel_log_pixels(false);
+    panel_reset_stats();
+    st7796_set_window(100, 200, 199, 249);
+    st7796_fill_color_async(color, 100 * 50 - 1, on_done, &done);
+    st7796_wait_idle();
+    drain();
+    panel_log_pixels(true);
+
+    panel_stats_t ps;
+    panel_get_stats(&ps);
+    TEST_CHECK_EQ(done.calls, 1);
+    TEST_CHECK_EQ(done.pixels, 100 * 50 - 1);
+    TEST_CHECK_EQ(ps.pixels, 100 * 50 - 1);
+    TEST_CHECK_EQ(panel_pixel(100, 200), color);
+    TEST_CHECK_EQ(panel_pixel(197, 249), color);
+}
+
+static void test_blocking_write(void)
+{
+    st7796_set_window(0, 0, 7, 7);
+    st7796_write_color(src, 64);
+    TEST_CHECK(!st7796_is_busy());
+    drain();
+    for (uint16_t i = 0; i < 64; i++) {
+        TEST_CHECK_EQ(panel_pixel(i % 8, i / 8), src[i]);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    for (uint32_t i = 0; i < count_of(src); i++) {
+        src[i] = (uint16_t)((i * 2654435761u) >> 16);
+    }
+
+#if ST7796_BUS_PIO
+    panel_attach_pio();
+#else
+    panel_attach_spi(0);
+#endif
+    st7796_init();
+    drain();
+
+    TEST_RUN(test_init_sequence);
+    TEST_RUN(test_rect_ordering);
+    TEST_RUN(test_fill);
+    TEST_RUN(test_blocking_write);
+    return test_report();
+}
@@ -0,0 +1,194 @@
+/**
+ * @file test_st7796_pio.c
+ * @brief ST7796 PIO stream encoder: randomized windows, rectangles and fills decoded by the panel model
+ * @note The unit stream (headers, inline bytes, runs) is only checked through what the panel
+ *       receives on the pins, against a shadow copy of the expected GRAM.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "st7796.h"
+#include "pico/stdlib.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ROUNDS          60
+#define MAX_W           48
+#define MAX_H           24
+
+#if ST7796_PIXEL_SWAPPED
+#define TO_NATIVE(c)    ((uint16_t)(((c) >> 8) | ((c) << 8)))
+#else
+#define TO_NATIVE(c)    ((uint16_t)(c))
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint16_t shadow[ST7796_HEIGHT][ST7796_WIDTH];
+static uint16_t src[MAX_H * (MAX_W + 8) + 2];
+static uint32_t rng = 0x12345678u;
+static uint32_t expected_pixels = 0;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rnd(uint32_t n)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng % n;
+}
+
+static void drain(void)
+{
+    st7796_wait_idle();
+    sim_run_for(SIM_US(20));
+}
+
+/**
+ * @brief Shadow of the panel's window walk for count pixels
+ */
+static void shadow_write(uint16_t x1, uint16_t y1, uint16_t x2, const uint16_t *px, uint32_t count,
+                         uint32_t w, uint32_t stride)
+{
+    uint16_t x = x1, y = y1;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t sx = i % w, sy = i / w;
+        shadow[y][x] = TO_NATIVE(px[sy * stride + sx]);
+        if (x < x2) {
+            x++;
+        } else {
+            x = x1;
+            y++;
+        }
+    }
+    expected_pixels += count;
+}
+
+static void check_gram(void)
+{
+    uint32_t bad = 0;
+    for (uint16_t y = 0; y < ST7796_HEIGHT; y++) {
+        for (uint16_t x = 0; x < ST7796_WIDTH; x++) {
+            bad += panel_pixel(x, y) != shadow[y][x];
+        }
+    }
+    TEST_CHECK_EQ(bad, 0);
+}
+
+/**
+ * @brief Random rectangles (any width, alignment and stride) and fills (odd and even lengths)
+ */
+static void test_random_windows(void)
+{
+    uint16_t x1 = 0, x2 = 0;
+
+    for (int round = 0; round < ROUNDS; round++) {
+        // Keep the columns now and then so CASET gets elided
+        if (round == 0 || rnd(3) != 0) {
+            uint16_t w = (uint16_t)(1 + rnd(MAX_W));
+            x1 = (uint16_t)rnd(ST7796_WIDTH - w + 1);
+            x2 = (uint16_t)(x1 + w - 1);
+        }
+        uint16_t w = x2 - x1 + 1;
+        uint16_t h = (uint16_t)(1 + rnd(MAX_H));
+        uint16_t y1 = (uint16_t)rnd(ST7796_HEIGHT - h + 1);
+        uint16_t y2 = (uint16_t)(y1 + h - 1);
+
+        st7796_set_window(x1, y1, x2, y2);
+        if (rnd(2) == 0) {
+            uint32_t stride = w + rnd(8);
+            const uint16_t *px = &src[rnd(2)];      // Odd start forces one pixel per word
+            st7796_write_rect_async(px, w, h, stride, NULL, NULL);
+            shadow_write(x1, y1, x2, px, (uint32_t)w * h, w, stride);
+        } else {
+            uint16_t color = (uint16_t)rnd(0x10000);
+            uint32_t len = 1 + rnd((uint32_t)w * h);
+            st7796_fill_color_async(color, len, NULL, NULL);
+            shadow_write(x1, y1, x2, &color, len, 1, 0);
+        }
+        drain();
+    }
+
+    panel_stats_t ps;
+    panel_get_stats(&ps);
+    TEST_CHECK_EQ(ps.pixels, expected_pixels);
+    TEST_CHECK_EQ(ps.bytes_cs_high, 0);
+    check_gram();
+}
+
+/**
+ * @brief Commands sent by the driver match what the panel decoded, elided ones never reach it
+ */
+static void test_command_count(void)
+{
+    st7796_stats_t ds;
+    panel_stats_t ps;
+
+    st7796_get_stats(&ds);
+    panel_get_stats(&ps);
+    TEST_CHECK_EQ(ps.cmd_count[ST7796_CMD_CASET] + ps.cmd_count[ST7796_CMD_RASET] +
+                  ps.cmd_count[ST7796_CMD_RAMWR], ds.cmds_sent);
+    TEST_CHECK_EQ(ps.cmd_count[ST7796_CMD_RAMWR], ds.windows);
+    TEST_CHECK(ds.cmds_elided > 0);
+}
+
+/**
+ * @brief A window that is never filled still reaches the panel ahead of the next command
+ */
+static void test_window_then_command(void)
+{
+    size_t n;
+
+    panel_clear_log();
+    st7796_set_window(0, 0, 9, 9);
+    st7796_set_orientation(ST7796_PORTRAIT);
+    sim_run_for(SIM_US(20));
+
+    const panel_event_t *ev = panel_events(&n);
+    uint8_t cmds[4];
+    size_t nc = 0;
+    for (size_t i = 0; i < n && nc < 4; i++) {
+        if (ev[i].kind == PANEL_EV_CMD) {
+            cmds[nc++] = (uint8_t)ev[i].value;
+        }
+    }
+    TEST_CHECK_EQ(nc, 4);
+    TEST_CHECK_EQ(cmds[0], ST7796_CMD_CASET);
+    TEST_CHECK_EQ(cmds[1], ST7796_CMD_RASET);
+    TEST_CHECK_EQ(cmds[2], ST7796_CMD_RAMWR);
+    TEST_CHECK_EQ(cmds[3], ST7796_CMD_MADCTL);
+    TEST_CHECK_EQ(panel_madctl(), 0x48);
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    for (uint32_t i = 0; i < count_of(src); i++) {
+        src[i] = (uint16_t)((i * 2654435761u) >> 16);
+    }
+
+    panel_attach_pio();
+    st7796_init();
+    drain();
+    panel_fill(0);
+    panel_log_pixels(false);
+    panel_reset_stats();
+    st7796_reset_stats();
+
+    TEST_RUN(test_random_windows);
+    TEST_RUN(test_command_count);
+    TEST_RUN(test_window_then_command);
+    return test_report();
+}
@@ -0,0 +1,155 @@
+/**
+ * @file test_st7796_window.c
+ * @brief ST7796 window-address cache: elided CASET/RASET over a scripted refresh, one CS per window
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "st7796.h"
+#include "pico/stdlib.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define STRIPE_H        40
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t cs_asserts = 0;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void cs_hook(uint pin, bool level, void *ctx)
+{
+    (void)pin;
+    (void)ctx;
+    if (!level) {
+        cs_asserts++;
+    }
+}
+
+static void reset_counters(void)
+{
+    st7796_reset_stats();
+    panel_reset_stats();
+    cs_asserts = 0;
+}
+
+/**
+ * @brief Driver counters agree with what the panel decoded
+ */
+static void check_against_panel(void)
+{
+    st7796_stats_t ds;
+    panel_stats_t ps;
+
+    st7796_get_stats(&ds);
+    panel_get_stats(&ps);
+    TEST_CHECK_EQ(ps.cmd_count[ST7796_CMD_CASET] + ps.cmd_count[ST7796_CMD_RASET] +
+                  ps.cmd_count[ST7796_CMD_RAMWR], ds.cmds_sent);
+    TEST_CHECK_EQ(ps.cmd_count[ST7796_CMD_RAMWR], ds.windows);
+    TEST_CHECK_EQ(ps.bytes_cs_high, 0);
+}
+
+/**
+ * @brief Full-screen refresh in full-width stripes, as the LVGL flush produces it
+ * @note Columns never change: CASET goes out once, RASET and RAMWR once per stripe
+ */
+static void test_full_refresh(void)
+{
+    const uint32_t stripes = ST7796_HEIGHT / STRIPE_H;
+    st7796_stats_t ds;
+
+    reset_counters();
+    panel_log_pixels(false);
+    for (uint32_t i = 0; i < stripes; i++) {
+        uint16_t y = (uint16_t)(i * STRIPE_H);
+        st7796_set_window(0, y, ST7796_WIDTH - 1, y + STRIPE_H - 1);
+        st7796_fill_color_async((uint16_t)(0x1000 + i), ST7796_WIDTH * STRIPE_H, NULL, NULL);
+    }
+    st7796_wait_idle();
+
+    st7796_get_stats(&ds);
+    TEST_CHECK_EQ(ds.windows, stripes);
+    TEST_CHECK_EQ(ds.cmds_sent, 1 + 2 * stripes);
+    TEST_CHECK_EQ(ds.cmds_elided, stripes - 1);
+    check_against_panel();
+
+    // One CS assertion per window setup plus one per pixel transfer
+    TEST_CHECK_EQ(cs_asserts, 2 * stripes);
+
+    // Elided CASET still lands every stripe where it belongs
+    for (uint32_t i = 0; i < stripes; i++) {
+        TEST_CHECK_EQ(panel_pixel(0, i * STRIPE_H), 0x1000 + i);
+        TEST_CHECK_EQ(panel_pixel(ST7796_WIDTH - 1, i * STRIPE_H + STRIPE_H - 1), 0x1000 + i);
+    }
+}
+
+/**
+ * @brief Partial refreshes: repeated areas elide both, different areas elide nothing
+ */
+static void test_partial_areas(void)
+{
+    st7796_stats_t ds;
+
+    reset_counters();
+    st7796_set_window(10, 10, 59, 29);
+    st7796_fill_color(0xAAAA, 50 * 20);
+    st7796_set_window(100, 300, 139, 339);
+    st7796_fill_color(0x5555, 40 * 40);
+    st7796_set_window(100, 300, 139, 339);
+    st7796_fill_color(0x7777, 40 * 40);
+    st7796_set_window(100, 10, 139, 29);
+    st7796_fill_color(0x1111, 40 * 20);
+
+    st7796_get_stats(&ds);
+    TEST_CHECK_EQ(ds.windows, 4);
+    TEST_CHECK_EQ(ds.cmds_elided, 0 + 0 + 2 + 1);
+    TEST_CHECK_EQ(ds.cmds_sent, 3 + 3 + 1 + 2);
+    check_against_panel();
+
+    TEST_CHECK_EQ(panel_pixel(10, 10), 0xAAAA);
+    TEST_CHECK_EQ(panel_pixel(139, 339), 0x7777);
+    TEST_CHECK_EQ(panel_pixel(100, 29), 0x1111);
+}
+
+/**
+ * @brief Orientation changes the meaning of the window, the cache must not survive it
+ */
+static void test_orientation_invalidates(void)
+{
+    st7796_stats_t ds;
+
+    st7796_set_window(0, 0, 9, 9);
+    st7796_set_orientation(ST7796_PORTRAIT);
+    reset_counters();
+    st7796_set_window(0, 0, 9, 9);
+
+    st7796_get_stats(&ds);
+    TEST_CHECK_EQ(ds.cmds_elided, 0);
+    TEST_CHECK_EQ(ds.cmds_sent, 3);
+    check_against_panel();
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    panel_attach_spi(0);
+    sim_gpio_add_hook(ST7796_PIN_CS, cs_hook, NULL);
+    st7796_init();
+
+    TEST_RUN(test_full_refresh);
+    TEST_RUN(test_partial_areas);
+    TEST_RUN(test_orientation_invalidates);
+    return test_report();
+}
@@ -0,0 +1,242 @@
+/**
+ * @file test_touch_calib.c
+ * @brief Touch to display mapping in all four orientations, checked against the panel model
+ * @note The touch glass is fixed to the panel, so a touch lands on a GRAM position whatever the
+ *       orientation. Each expected point is found by writing a marker pixel at display (x, y)
+ *       through st7796.c and locating it in the portrait frame the raw coordinates are in.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "panel.h"
+#include "st7796.h"
+#include "touch_calib.h"
+#include "pico/stdlib.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MARKER          0xF81F
+
+/* Raw GT911 range twice the panel's */
+#define RAW_W           640
+#define RAW_H           960
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const char *const names[] = { "portrait", "landscape", "portrait inv", "landscape inv" };
+
+/* Display points per orientation: corners, center and an off-center one */
+static const touch_calib_point_t portrait_pts[] = {
+    { 0, 0 }, { 319, 0 }, { 0, 479 }, { 319, 479 }, { 160, 240 }, { 37, 401 },
+};
+static const touch_calib_point_t landscape_pts[] = {
+    { 0, 0 }, { 479, 0 }, { 0, 319 }, { 479, 319 }, { 240, 160 }, { 401, 37 },
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static bool is_landscape(st7796_orientation_t o)
+{
+    return o == ST7796_LANDSCAPE || o == ST7796_LANDSCAPE_INV;
+}
+
+/**
+ * @brief Where display (x, y) of an orientation is in the portrait frame, found on the panel
+ */
+static touch_calib_point_t portrait_of(st7796_orientation_t o, touch_calib_point_t p)
+{
+    touch_calib_point_t r = { -1, -1 };
+    uint16_t marker = MARKER;
+
+    panel_fill(0);
+    st7796_set_orientation(o);
+    st7796_set_window(p.x, p.y, p.x, p.y);
+    st7796_write_color(&marker, 1);
+    st7796_wait_idle();
+
+    st7796_set_orientation(ST7796_PORTRAIT);
+    for (int16_t v = 0; v < PANEL_GRAM_H; v++) {
+        for (int16_t u = 0; u < PANEL_GRAM_W; u++) {
+            if (panel_pixel(u, v) == MARKER) {
+                r = (touch_calib_point_t){ u, v };
+            }
+        }
+    }
+    st7796_set_orientation(o);
+    return r;
+}
+
+/**
+ * @brief A touch panel mounted skewed and offset: raw from portrait pixels
+ */
+static touch_calib_point_t skewed_raw(touch_calib_point_t p)
+{
+    return (touch_calib_point_t){
+        (int16_t)((190 * p.x + 5 * p.y) / 100 + 30),
+        (int16_t)((-4 * p.x + 185 * p.y) / 100 + 40),
+    };
+}
+
+/**
+ * @brief Resolution scaling: every point lands exactly on the pixel under it, in each orientation
+ */
+static void test_scaling(void)
+{
+    touch_calib_init(RAW_W, RAW_H);
+
+    for (st7796_orientation_t o = ST7796_PORTRAIT; o <= ST7796_LANDSCAPE_INV; o++) {
+        const touch_calib_point_t *pts = is_landscape(o) ? landscape_pts : portrait_pts;
+        for (size_t i = 0; i < sizeof(portrait_pts) / sizeof(portrait_pts[0]); i++) {
+            touch_calib_point_t g = portrait_of(o, pts[i]);
+            uint16_t x = (uint16_t)(g.x * RAW_W / PANEL_GRAM_W);
+            uint16_t y = (uint16_t)(g.y * RAW_H / PANEL_GRAM_H);
+            touch_calib_apply(&x, &y);
+            if (x != pts[i].x || y != pts[i].y) {
+                printf("%s: (%d, %d) mapped to (%u, %u)\n", names[o], pts[i].x, pts[i].y, x, y);
+            }
+            TEST_CHECK_EQ(x, pts[i].x);
+            TEST_CHECK_EQ(y, pts[i].y);
+        }
+    }
+}
+
+/**
+ * @brief A 3-point calibration taken in landscape holds in every orientation
+ */
+static void test_calibration(void)
+{
+    static const touch_calib_point_t targets[3] = { { 30, 30 }, { 449, 160 }, { 240, 289 } };
+    touch_calib_point_t raw[3];
+
+    touch_calib_init(RAW_W, RAW_H);
+    for (int i = 0; i < 3; i++) {
+        raw[i] = skewed_raw(portrait_of(ST7796_LANDSCAPE, targets[i]));
+    }
+    TEST_CHECK(touch_calib_set_points(raw, targets));
+
+    for (st7796_orientation_t o = ST7796_PORTRAIT; o <= ST7796_LANDSCAPE_INV; o++) {
+        const touch_calib_point_t *pts = is_landscape(o) ? landscape_pts : portrait_pts;
+        int32_t worst = 0;
+        for (size_t i = 0; i < sizeof(portrait_pts) / sizeof(portrait_pts[0]); i++) {
+            touch_calib_point_t r = skewed_raw(portrait_of(o, pts[i]));
+            uint16_t x = (uint16_t)r.x;
+            uint16_t y = (uint16_t)r.y;
+            touch_calib_apply(&x, &y);
+            int32_t ex = abs((int32_t)x - pts[i].x);
+            int32_t ey = abs((int32_t)y - pts[i].y);
+            worst = ex > worst ? ex : worst;
+            worst = ey > worst ? ey : worst;
+        }
+        printf("%s: worst error %d px\n", names[o], (int)worst);
+        TEST_CHECK(worst <= 1);
+    }
+
+    // Back to scaling: the skewed panel is off again
+    touch_calib_clear();
+    st7796_set_orientation(ST7796_PORTRAIT);
+    touch_calib_point_t r = skewed_raw((touch_calib_point_t){ 160, 240 });
+    uint16_t x = (uint16_t)r.x;
+    uint16_t y = (uint16_t)r.y;
+    touch_calib_apply(&x, &y);
+    TEST_CHECK(x != 160 || y != 240);
+}
+
+/**
+ * @brief Collinear touches are refused and leave the mapping alone
+ */
+static void test_collinear(void)
+{
+    static const touch_calib_point_t raw[3] = { { 100, 100 }, { 200, 200 }, { 300, 300 } };
+    static const touch_calib_point_t disp[3] = { { 10, 10 }, { 100, 300 }, { 300, 20 } };
+    touch_calib_matrix_t before, after;
+
+    touch_calib_init(RAW_W, RAW_H);
+    st7796_set_orientation(ST7796_LANDSCAPE);
+    touch_calib_get_matrix(&before);
+    TEST_CHECK(!touch_calib_set_points(raw, disp));
+    touch_calib_get_matrix(&after);
+    TEST_CHECK_EQ(after.a, before.a);
+    TEST_CHECK_EQ(after.b, before.b);
+    TEST_CHECK_EQ(after.c, before.c);
+    TEST_CHECK_EQ(after.d, before.d);
+    TEST_CHECK_EQ(after.e, before.e);
+    TEST_CHECK_EQ(after.f, before.f);
+}
+
+/**
+ * @brief Raw values far outside the GT911 range clamp to the edge the matrix points them at
+ */
+static void check_out_of_range(const char *what)
+{
+    static const touch_calib_point_t raws[] = {
+        { 0x7FFF, 0x7FFF }, { (int16_t)0xFFFF, 0 }, { 0, (int16_t)0xFFFF }, { (int16_t)0xFFFF, (int16_t)0xFFFF },
+    };
+
+    for (st7796_orientation_t o = ST7796_PORTRAIT; o <= ST7796_LANDSCAPE_INV; o++) {
+        touch_calib_matrix_t m;
+        int64_t w = is_landscape(o) ? ST7796_HEIGHT : ST7796_WIDTH;
+        int64_t h = is_landscape(o) ? ST7796_WIDTH : ST7796_HEIGHT;
+
+        st7796_set_orientation(o);
+        touch_calib_get_matrix(&m);
+        for (size_t i = 0; i < sizeof(raws) / sizeof(raws[0]); i++) {
+            int64_t rx = (uint16_t)raws[i].x;
+            int64_t ry = (uint16_t)raws[i].y;
+            int64_t ex = (m.a * rx + m.b * ry + m.c + TOUCH_CALIB_ONE / 2) >> TOUCH_CALIB_SHIFT;
+            int64_t ey = (m.d * rx + m.e * ry + m.f + TOUCH_CALIB_ONE / 2) >> TOUCH_CALIB_SHIFT;
+            ex = ex < 0 ? 0 : (ex >= w ? w - 1 : ex);
+            ey = ey < 0 ? 0 : (ey >= h ? h - 1 : ey);
+
+            uint16_t x = (uint16_t)rx;
+            uint16_t y = (uint16_t)ry;
+            touch_calib_apply(&x, &y);
+            if (x != ex || y != ey) {
+                printf("%s %s: raw (%u, %u) mapped to (%u, %u)\n", what, names[o],
+                       (unsigned)rx, (unsigned)ry, x, y);
+            }
+            TEST_CHECK_EQ(x, ex);
+            TEST_CHECK_EQ(y, ey);
+        }
+    }
+}
+
+/**
+ * @brief Glitched raw coordinates up to 0xFFFF, with the default scaling and a calibration
+ */
+static void test_out_of_range(void)
+{
+    static const touch_calib_point_t targets[3] = { { 30, 30 }, { 449, 160 }, { 240, 289 } };
+    touch_calib_point_t raw[3];
+
+    touch_calib_init(RAW_W, RAW_H);
+    check_out_of_range("scaling");
+
+    for (int i = 0; i < 3; i++) {
+        raw[i] = skewed_raw(portrait_of(ST7796_LANDSCAPE, targets[i]));
+    }
+    TEST_CHECK(touch_calib_set_points(raw, targets));
+    check_out_of_range("calibrated");
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    panel_attach_spi(0);
+    st7796_init();
+
+    TEST_RUN(test_scaling);
+    TEST_RUN(test_calibration);
+    TEST_RUN(test_collinear);
+    TEST_RUN(test_out_of_range);
+    return test_report();
+}
@@ -0,0 +1,231 @@
+/**
+ * @file test_touch_filter.c
+ * @brief Pointer filter lag and jitter on touch traces: rest, drags of three speeds, a circle, a stop
+ * @note The traces are 200 Hz reports of a known finger path with +-1 px controller noise and
+ *       4-6 ms sample intervals (tick granularity). Lag is the time the output is behind the
+ *       finger along its direction of travel (negative = ahead, the extrapolation), jitter the RMS
+ *       of the sample to sample output steps the finger didn't make. Raw samples are reported
+ *       next to it.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "touch_filter.h"
+#include <math.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define REPORT_MS       5
+#define TRACE_MS        1500
+#define SETTLE_MS       150         // Left out of the statistics: the filter starting up
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Finger path: position at t (ms)
+ */
+typedef void (*path_fn_t)(uint32_t t_ms, double *x, double *y);
+
+typedef struct {
+    double lag_ms;              // Mean lag along the direction of travel
+    double lag_px;              // The same in pixels
+    double jitter_px;           // RMS of the steps the finger didn't make
+} trace_stats_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t rng = 0x2545F491u;
+static double drag_speed;       // px/s of path_drag()
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static void path_rest(uint32_t t_ms, double *x, double *y)
+{
+    (void)t_ms;
+    *x = 160.0;
+    *y = 240.0;
+}
+
+/* Diagonal drag at drag_speed */
+static void path_drag(uint32_t t_ms, double *x, double *y)
+{
+    double d = drag_speed * t_ms / 1000.0 / sqrt(2.0);
+    *x = 20.0 + d;
+    *y = 30.0 + d;
+}
+
+/* Circle of 100 px radius, one turn per second (628 px/s) */
+static void path_circle(uint32_t t_ms, double *x, double *y)
+{
+    double a = 2.0 * M_PI * t_ms / 1000.0;
+    *x = 160.0 + 100.0 * cos(a);
+    *y = 240.0 + 100.0 * sin(a);
+}
+
+/* 400 px/s to the right for 500 ms, then held */
+static void path_stop(uint32_t t_ms, double *x, double *y)
+{
+    *x = 40.0 + 400.0 * (t_ms < 500 ? t_ms : 500) / 1000.0;
+    *y = 240.0;
+}
+
+/**
+ * @brief Run a trace through the filter (or not) and measure lag and jitter after SETTLE_MS
+ * @param filtered false: statistics of the raw samples
+ */
+static trace_stats_t run_trace(path_fn_t path, bool filtered)
+{
+    touch_filter_t f;
+    double along = 0;
+    double speed_sum = 0;
+    double step_sq = 0;
+    double last_ex = 0;
+    double last_ey = 0;
+    uint32_t n = 0;
+
+    rng = 0x2545F491u;
+    touch_filter_reset(&f);
+    for (uint32_t t = 0; t <= TRACE_MS; t += REPORT_MS - 1 + rand_u32() % 3) {
+        double px, py, nx, ny;
+        path(t, &px, &py);
+        path(t + 1, &nx, &ny);
+
+        uint16_t x = (uint16_t)lround(px + (int)(rand_u32() % 3) - 1);
+        uint16_t y = (uint16_t)lround(py + (int)(rand_u32() % 3) - 1);
+        if (filtered) {
+            touch_filter_update(&f, &x, &y, t);
+        }
+        if (t < SETTLE_MS) {
+            continue;
+        }
+
+        // Error along the direction of travel, and its change since the previous sample
+        double vx = (nx - px) * 1000.0;
+        double vy = (ny - py) * 1000.0;
+        double speed = sqrt(vx * vx + vy * vy);
+        double ex = px - x;
+        double ey = py - y;
+        if (speed > 0) {
+            along += (ex * vx + ey * vy) / speed;
+        }
+        if (n > 0) {
+            step_sq += (ex - last_ex) * (ex - last_ex) + (ey - last_ey) * (ey - last_ey);
+        }
+        last_ex = ex;
+        last_ey = ey;
+        speed_sum += speed;
+        n++;
+    }
+
+    double speed = speed_sum / n;
+    along /= n;
+    return (trace_stats_t){
+        .lag_ms = speed > 0 ? along / speed * 1000.0 : 0,
+        .lag_px = along,
+        .jitter_px = sqrt(step_sq / (n - 1)),
+    };
+}
+
+static void report(const char *name, path_fn_t path, trace_stats_t *raw, trace_stats_t *out)
+{
+    *raw = run_trace(path, false);
+    *out = run_trace(path, true);
+    printf("%-12s raw: lag %6.1f ms jitter %.2f px | filtered: lag %6.1f ms (%4.1f px) jitter %.2f px\n",
+           name, raw->lag_ms, raw->jitter_px, out->lag_ms, out->lag_px, out->jitter_px);
+}
+
+/**
+ * @brief At rest the noise is smoothed away, the extrapolation adds none
+ */
+static void test_rest(void)
+{
+    trace_stats_t raw, out;
+
+    report("rest", path_rest, &raw, &out);
+    TEST_CHECK(out.jitter_px < raw.jitter_px / 2);
+}
+
+/**
+ * @brief Drags: from 300 px/s the extrapolation makes up for the smoothing, the output is never
+ *        a frame behind the finger and no more than TOUCH_FILTER_PREDICT_MS ahead. Slow drags
+ *        are smoothed for steadiness, they lag by a few pixels.
+ */
+static void test_drags(void)
+{
+    static const double speeds[] = { 60, 300, 1000 };
+    trace_stats_t raw, out;
+    char name[16];
+
+    for (size_t i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++) {
+        drag_speed = speeds[i];
+        snprintf(name, sizeof(name), "%.0f px/s", speeds[i]);
+        report(name, path_drag, &raw, &out);
+        TEST_CHECK(out.lag_px < 5.0);
+        TEST_CHECK(speeds[i] < 300 || out.lag_ms < REPORT_MS);
+        TEST_CHECK(out.lag_ms > -TOUCH_FILTER_PREDICT_MS - 1);
+        TEST_CHECK(out.jitter_px < raw.jitter_px + 0.5);
+    }
+
+    report("circle", path_circle, &raw, &out);
+    TEST_CHECK(out.lag_ms < REPORT_MS);
+    TEST_CHECK(out.lag_ms > -TOUCH_FILTER_PREDICT_MS - 1);
+    TEST_CHECK(out.jitter_px < raw.jitter_px + 0.5);
+}
+
+/**
+ * @brief A drag stopping: the overshoot is bounded and the pointer settles on the finger
+ */
+static void test_stop(void)
+{
+    touch_filter_t f;
+    int32_t overshoot = 0;
+    int32_t settled_ms = -1;
+
+    rng = 0x2545F491u;
+    touch_filter_reset(&f);
+    for (uint32_t t = 0; t <= 1000; t += REPORT_MS) {
+        double px, py;
+        path_stop(t, &px, &py);
+        uint16_t x = (uint16_t)lround(px + (int)(rand_u32() % 3) - 1);
+        uint16_t y = (uint16_t)lround(py);
+        touch_filter_update(&f, &x, &y, t);
+
+        int32_t past = (int32_t)x - 240;
+        overshoot = past > overshoot ? past : overshoot;
+        if (t > 500 && abs(past) <= 1 && settled_ms < 0) {
+            settled_ms = (int32_t)(t - 500);
+        } else if (abs(past) > 1) {
+            settled_ms = -1;
+        }
+    }
+    printf("stop: overshoot %d px, settled after %d ms\n", (int)overshoot, (int)settled_ms);
+    TEST_CHECK(overshoot <= TOUCH_FILTER_PREDICT_MAX);
+    TEST_CHECK_RANGE(settled_ms, 0, 200);
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    TEST_RUN(test_rest);
+    TEST_RUN(test_drags);
+    TEST_RUN(test_stop);
+    return test_report();
+}
@@ -0,0 +1,316 @@
+/**
+ * @file test_touch_gesture.c
+ * @brief Gesture recognition replayed from recorded multi-point register dumps
+ * @note Each dump row is the 0x814E block (status, then 8 bytes per point) of one GT911 frame.
+ *       The rows are loaded into the GT911 model one frame period apart and go through
+ *       gt911_read_points() into the recognizer, the way the touch task does it.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "ctp.h"
+#include "gt911.h"
+#include "touch_gesture.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/* One point slot: track ID, X, Y, size (low byte first), reserved */
+#define PT(id, x, y, size)  (id), (x) & 0xFF, (x) >> 8, (y) & 0xFF, (y) >> 8, (size) & 0xFF, (size) >> 8, 0
+
+#define FRAME_MS        5           // 200 Hz report rate
+#define LOG_MAX         256
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef uint8_t dump_row_t[1 + GT911_MAX_POINTS * GT911_POINT_SIZE];
+
+/**
+ * @brief Event with the frame that produced it
+ */
+typedef struct {
+    uint32_t frame;
+    gesture_event_t ev;
+} logged_event_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* 0x8140-0x814A: product ID "911", firmware 0x1060, 320 x 480, vendor 2 */
+static const uint8_t info_block[GT911_INFO_LEN] = {
+    '9', '1', '1', 0, 0x60, 0x10, 0x40, 0x01, 0xE0, 0x01, 0x02,
+};
+
+/* Two fingers spreading from 120 to 200 apart around (160, 240) */
+static const dump_row_t dump_pinch[] = {
+    { 0x82, PT(0, 100, 240, 24), PT(1, 220, 240, 24) },
+    { 0x82, PT(0, 95, 240, 24), PT(1, 225, 240, 24) },
+    { 0x82, PT(0, 90, 240, 24), PT(1, 230, 240, 24) },
+    { 0x82, PT(0, 85, 240, 24), PT(1, 235, 240, 24) },
+    { 0x82, PT(0, 80, 240, 24), PT(1, 240, 240, 24) },
+    { 0x82, PT(0, 75, 240, 24), PT(1, 245, 240, 24) },
+    { 0x82, PT(0, 70, 240, 24), PT(1, 250, 240, 24) },
+    { 0x82, PT(0, 65, 240, 24), PT(1, 255, 240, 24) },
+    { 0x82, PT(0, 60, 240, 24), PT(1, 260, 240, 24) },
+    { 0x81, PT(1, 260, 240, 24) },
+    { 0x80 },
+};
+
+/* Two fingers 160 apart turning 90 degrees clockwise around (160, 240), 10 degrees a frame */
+static const dump_row_t dump_rotate[] = {
+    { 0x82, PT(4, 80, 240, 24), PT(6, 240, 240, 24) },
+    { 0x82, PT(4, 81, 226, 24), PT(6, 239, 254, 24) },
+    { 0x82, PT(4, 85, 213, 24), PT(6, 235, 267, 24) },
+    { 0x82, PT(4, 91, 200, 24), PT(6, 229, 280, 24) },
+    { 0x82, PT(4, 99, 189, 24), PT(6, 221, 291, 24) },
+    { 0x82, PT(4, 109, 179, 24), PT(6, 211, 301, 24) },
+    { 0x82, PT(4, 120, 171, 24), PT(6, 200, 309, 24) },
+    { 0x82, PT(4, 133, 165, 24), PT(6, 187, 315, 24) },
+    { 0x82, PT(4, 146, 161, 24), PT(6, 174, 319, 24) },
+    { 0x82, PT(4, 160, 160, 24), PT(6, 160, 320, 24) },
+    { 0x80 },
+};
+
+/* Two fingers panning 8 a frame, a third one lands in slot 0 and the slots reorder, then the
+ * first finger of the pair lifts (new pair of 7 and 5) and finger 7 too */
+static const dump_row_t dump_pan[] = {
+    { 0x82, PT(2, 100, 200, 30), PT(5, 200, 200, 28) },
+    { 0x82, PT(2, 108, 208, 30), PT(5, 208, 208, 28) },
+    { 0x82, PT(2, 116, 216, 30), PT(5, 216, 216, 28) },
+    { 0x83, PT(7, 50, 400, 20), PT(2, 124, 224, 30), PT(5, 224, 224, 28) },
+    { 0x83, PT(7, 50, 400, 20), PT(5, 232, 232, 28), PT(2, 132, 232, 30) },
+    { 0x83, PT(7, 50, 400, 20), PT(2, 140, 240, 30), PT(5, 240, 240, 28) },
+    { 0x82, PT(7, 50, 400, 20), PT(5, 240, 240, 28) },
+    { 0x81, PT(5, 240, 240, 28) },
+};
+
+/* One finger shaking within the slop (long-press), the same finger dragging (none) */
+static const dump_row_t dump_hold[] = {
+    { 0x81, PT(3, 150, 300, 26) },
+    { 0x81, PT(3, 152, 299, 26) },
+    { 0x81, PT(3, 149, 302, 27) },
+    { 0x81, PT(3, 151, 301, 26) },
+};
+static const dump_row_t dump_release = { 0x80 };
+
+/* All five slots in use: the longest read */
+static const dump_row_t dump_five = {
+    0x85, PT(0, 40, 60, 22), PT(1, 120, 70, 25), PT(2, 200, 80, 24), PT(3, 280, 90, 23), PT(4, 160, 400, 30),
+};
+
+static logged_event_t event_log[LOG_MAX];
+static uint32_t events = 0;
+static uint32_t frames = 0;
+static gesture_state_t state;
+static uint64_t slowest_ns = 0;
+static volatile bool done = false;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+/**
+ * @brief Replay one dump row as the next frame: read it and feed the recognizer
+ */
+static void replay_row(const dump_row_t row)
+{
+    const ctp_fixture_t fixture = { GT911_REG_STATUS, sizeof(dump_row_t), row };
+    gesture_event_t ev[GESTURE_MAX_EVENTS];
+    gt911_touch_t touch;
+
+    ctp_load(&fixture, 1);
+    uint64_t t0 = sim_now();
+    TEST_CHECK(gt911_read_points(&touch));
+    uint32_t n = touch_gesture_update(&state, &touch, frames * FRAME_MS, ev);
+    uint64_t ns = sim_now() - t0;
+    slowest_ns = ns > slowest_ns ? ns : slowest_ns;
+
+    for (uint32_t i = 0; i < n && events < LOG_MAX; i++) {
+        event_log[events++] = (logged_event_t){ frames, ev[i] };
+    }
+    frames++;
+    vTaskDelay(pdMS_TO_TICKS(FRAME_MS));
+}
+
+static void replay(const dump_row_t *rows, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        replay_row(rows[i]);
+    }
+}
+
+static void log_reset(void)
+{
+    events = 0;
+    frames = 0;
+    touch_gesture_init(&state);
+}
+
+static uint32_t count_type(uint8_t type)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < events; i++) {
+        n += event_log[i].ev.type == type;
+    }
+    return n;
+}
+
+/**
+ * @brief Pinch: once past the slop, every frame reports distance / start distance
+ */
+static void test_pinch(void)
+{
+    log_reset();
+    replay(dump_pinch, sizeof(dump_pinch) / sizeof(dump_pinch[0]));
+
+    // Frames 2-8 are 140..200 apart (frame 1: 130, within the slop), then frame 9 lifts one
+    TEST_CHECK_EQ(events, 7 + 1);
+    for (uint32_t i = 0; i < 7; i++) {
+        const gesture_event_t *ev = &event_log[i].ev;
+        TEST_CHECK_EQ(event_log[i].frame, 2 + i);
+        TEST_CHECK_EQ(ev->type, GESTURE_PINCH);
+        TEST_CHECK_EQ(ev->value, (140 + 10 * i) * GESTURE_SCALE_ONE / 120);
+        TEST_CHECK_EQ(ev->x, 160);
+        TEST_CHECK_EQ(ev->y, 240);
+    }
+    TEST_CHECK_EQ(event_log[7].frame, 9);
+    TEST_CHECK_EQ(event_log[7].ev.type, GESTURE_END);
+}
+
+/**
+ * @brief Rotate: clockwise turn up to 90 degrees, distance and midpoint stay put
+ */
+static void test_rotate(void)
+{
+    log_reset();
+    replay(dump_rotate, sizeof(dump_rotate) / sizeof(dump_rotate[0]));
+
+    int16_t last = 0;
+    uint32_t n = count_type(GESTURE_ROTATE);
+    for (uint32_t i = 0; i < events; i++) {
+        if (event_log[i].ev.type == GESTURE_ROTATE) {
+            TEST_CHECK(event_log[i].ev.value > last);
+            last = event_log[i].ev.value;
+        }
+    }
+    printf("rotate: %u events, last %d (0.1 degree)\n", (unsigned)n, last);
+    TEST_CHECK_RANGE(n, 8, 9);
+    TEST_CHECK_RANGE(last, 900 - 3, 900 + 3);
+    TEST_CHECK_EQ(count_type(GESTURE_PINCH), 0);
+    TEST_CHECK_EQ(count_type(GESTURE_PAN), 0);
+    TEST_CHECK_EQ(count_type(GESTURE_END), 1);
+    TEST_CHECK_EQ(event_log[events - 1].ev.type, GESTURE_END);
+}
+
+/**
+ * @brief Pan: the pair is followed by track ID through a third finger and reordered slots
+ */
+static void test_pan(void)
+{
+    log_reset();
+    replay(dump_pan, sizeof(dump_pan) / sizeof(dump_pan[0]));
+    for (uint32_t i = 0; i < 1000 / FRAME_MS; i++) {
+        replay_row(dump_pan[7]);
+    }
+    replay_row(dump_release);
+
+    // Frames 2-5 pan 16..40, frame 6 ends it (new pair), nothing after: the last finger was
+    // part of a two-finger gesture and doesn't long-press
+    TEST_CHECK_EQ(events, 4 + 1);
+    for (uint32_t i = 0; i < 4; i++) {
+        const gesture_event_t *ev = &event_log[i].ev;
+        TEST_CHECK_EQ(event_log[i].frame, 2 + i);
+        TEST_CHECK_EQ(ev->type, GESTURE_PAN);
+        TEST_CHECK_EQ(ev->dx, 16 + 8 * i);
+        TEST_CHECK_EQ(ev->dy, 16 + 8 * i);
+        TEST_CHECK_EQ(ev->x, 166 + 8 * i);
+    }
+    TEST_CHECK_EQ(event_log[4].frame, 6);
+    TEST_CHECK_EQ(event_log[4].ev.type, GESTURE_END);
+}
+
+/**
+ * @brief Long-press: once, at GESTURE_LONG_PRESS_MS of holding within the slop. A drag never is one.
+ */
+static void test_long_press(void)
+{
+    log_reset();
+    for (uint32_t i = 0; i < 1000 / FRAME_MS; i++) {
+        replay_row(dump_hold[i % 4]);
+    }
+    replay_row(dump_release);
+
+    TEST_CHECK_EQ(events, 1);
+    TEST_CHECK_EQ(event_log[0].ev.type, GESTURE_LONG_PRESS);
+    TEST_CHECK_EQ(event_log[0].frame, GESTURE_LONG_PRESS_MS / FRAME_MS);
+    TEST_CHECK_EQ(event_log[0].ev.x, 150);
+    TEST_CHECK_EQ(event_log[0].ev.y, 300);
+
+    log_reset();
+    for (uint32_t i = 0; i < 1000 / FRAME_MS; i++) {
+        dump_row_t row = { 0x81, PT(3, 150 + (i < 30 ? i : 30), 300, 26) };
+        replay_row(row);
+    }
+    replay_row(dump_release);
+    TEST_CHECK_EQ(events, 0);
+}
+
+/**
+ * @brief Read, parse and recognize of the largest frame fit the fastest report period
+ */
+static void test_report_rate(void)
+{
+    log_reset();
+    replay_row(dump_five);
+    replay_row(dump_five);
+    replay_row(dump_release);
+
+    printf("slowest frame: %.1f us\n", slowest_ns / 1e3);
+    TEST_CHECK(slowest_ns < SIM_MS(GT911_REPORT_MS_MIN));
+}
+
+static void test_task(void *param)
+{
+    (void)param;
+
+    TEST_RUN(test_pinch);
+    TEST_RUN(test_rotate);
+    TEST_RUN(test_pan);
+    TEST_RUN(test_long_press);
+    TEST_RUN(test_report_rate);
+
+    done = true;
+    for (;;) {
+        vTaskDelay(1000);
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    TaskHandle_t task;
+    const ctp_fixture_t info = { GT911_REG_PRODUCT_ID1, sizeof(info_block), info_block };
+
+    ctp_attach();
+    ctp_load(&info, 1);
+    gt911_init();
+
+    xTaskCreate(test_task, "touch", 1024, NULL, 2, &task);
+    vTaskCoreAffinitySet(task, 1 << 0);
+
+    for (uint32_t s = 0; s < 100 && !done; s++) {
+        sim_rtos_run_for(SIM_MS(100));
+    }
+    TEST_CHECK(done);
+    return test_report();
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_ws2812_parallel.c
+ * @brief Parallel WS2812 strips: bit-plane transpose against a bit-by-bit reference, and its cost
+ * @note The ws2812_parallel program runs on the PIO emulator, fed with bytes by the DMA model. A
+ *       LED chain model decodes every data pin. The reference builds the bit planes one bit at a
+ *       time, the bits each strip received must be the reference planes' bit of that strip.
+ *       Built with 8 strips, and with 3 (the pins above stay low).
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "leds.h"
+#include "ws2812_parallel.h"
+#include "pico/stdlib.h"
+#include <string.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef PAR_STRIPS
+#define PAR_STRIPS      WS2812_PARALLEL_MAX_STRIPS
+#endif
+
+#define PIN_BASE        18
+#define PLANES          (WS2812_PARALLEL_LEN * 24)
+#define BENCH_FRAMES    100
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* What the application drew, [strip][pixel][R, G, B] */
+static uint8_t drawn[WS2812_PARALLEL_MAX_STRIPS][WS2812_PARALLEL_LEN][3];
+static uint8_t ref[PLANES];
+static uint32_t rng = 0x2545F491u;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint64_t host_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Reference bit planes, one bit at a time: G, R, B of each pixel MSB first, strip n in bit n
+ */
+static void ref_planes(uint8_t *planes)
+{
+    static const int order[3] = { 1, 0, 2 };    // G, R, B from drawn's R, G, B
+
+    memset(planes, 0, PLANES);
+    for (uint32_t i = 0; i < WS2812_PARALLEL_LEN; i++) {
+        for (uint32_t c = 0; c < 3; c++) {
+            for (uint32_t b = 0; b < 8; b++) {
+                uint8_t *plane = &planes[(i * 3 + c) * 8 + b];
+                for (uint32_t s = 0; s < PAR_STRIPS; s++) {
+                    if (drawn[s][i][order[c]] & (0x80u >> b)) {
+                        *plane |= (uint8_t)(1u << s);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void draw_random(void)
+{
+    for (uint32_t s = 0; s < PAR_STRIPS; s++) {
+        for (uint32_t i = 0; i < WS2812_PARALLEL_LEN; i++) {
+            uint32_t c = rand_u32();
+            drawn[s][i][0] = (uint8_t)c;
+            drawn[s][i][1] = (uint8_t)(c >> 8);
+            drawn[s][i][2] = (uint8_t)(c >> 16);
+            ws2812_parallel_set(s, i, drawn[s][i][0], drawn[s][i][1], drawn[s][i][2]);
+        }
+    }
+}
+
+static void run_frame(void)
+{
+    sim_run_for(SIM_US(WS2812_PARALLEL_LEN * 24 * 10 / 8 + WS2812_PARALLEL_RESET_US) + SIM_MS(1));
+}
+
+/**
+ * @brief Random frames, with single bits and whole bytes set on one strip at a time: every strip
+ *        receives its reference bits, in spec, all strips in the same bit times
+ */
+static void test_transpose(void)
+{
+    uint32_t mismatches = 0;
+
+    for (uint32_t round = 0; round < 40; round++) {
+        if (round < 24) {
+            // One bit of one colour on one strip, the rest dark: catches swapped rows / columns
+            memset(drawn, 0, sizeof(drawn));
+            uint32_t s = round % PAR_STRIPS;
+            uint32_t i = round % WS2812_PARALLEL_LEN;
+            drawn[s][i][round % 3] = (uint8_t)(0x80u >> (round % 8));
+            for (uint32_t k = 0; k < PAR_STRIPS; k++) {
+                ws2812_parallel_fill(k, 0, 0, 0);
+            }
+            ws2812_parallel_set(s, i, drawn[s][i][0], drawn[s][i][1], drawn[s][i][2]);
+        } else {
+            draw_random();
+        }
+        ref_planes(ref);
+        ws2812_parallel_show();
+        run_frame();
+
+        for (uint32_t s = 0; s < WS2812_PARALLEL_MAX_STRIPS; s++) {
+            const leds_frame_t *f = leds_frame(PIN_BASE + s);
+            if (s >= PAR_STRIPS) {
+                continue;
+            }
+            TEST_CHECK_EQ(f->bits, PLANES);
+            for (uint32_t k = 0; k < PLANES && k < f->bits; k++) {
+                bool got = f->data[k / 8] & (0x80u >> (k % 8));
+                bool want = (ref[k] >> s) & 1u;
+                if (got != want && mismatches++ < 8) {
+                    printf("round %u strip %u bit %u: %d, reference %d\n", (unsigned)round, (unsigned)s,
+                           (unsigned)k, got, want);
+                }
+            }
+            TEST_CHECK_EQ(f->start_ns, leds_frame(PIN_BASE)->start_ns);
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+
+    for (uint32_t s = 0; s < WS2812_PARALLEL_MAX_STRIPS; s++) {
+        leds_stats_t ls;
+        leds_get_stats(PIN_BASE + s, &ls);
+        if (s < PAR_STRIPS) {
+            TEST_CHECK_EQ(ls.frames, 41);   // With the all-off frame of init
+            TEST_CHECK_EQ(ls.timing_errors, 0);
+            TEST_CHECK(ls.gap_max_ns < 1250);
+            TEST_CHECK(ls.idle_min_ns >= SIM_US(WS2812_PARALLEL_RESET_US));
+        } else {
+            TEST_CHECK_EQ(ls.bits, 0);      // Not driven
+        }
+    }
+}
+
+/**
+ * @brief Host time of a show (the conversion of the whole frame) against the bit-by-bit
+ *        reference on the same frame buffer
+ */
+static void test_bench(void)
+{
+    uint64_t show_ns = 0;
+    uint64_t ref_ns = 0;
+    volatile uint8_t sink = 0;
+
+    draw_random();
+    for (uint32_t n = 0; n < BENCH_FRAMES; n++) {
+        uint64_t t0 = host_ns();
+        ws2812_parallel_show();
+        show_ns += host_ns() - t0;
+        run_frame();
+
+        t0 = host_ns();
+        ref_planes(ref);
+        ref_ns += host_ns() - t0;
+        sink ^= ref[n % PLANES];
+    }
+    (void)sink;
+
+    printf("bench: %u pixels x %u strips, show %.2f us per frame, bit-by-bit reference %.2f us (%.1fx)\n",
+           (unsigned)WS2812_PARALLEL_LEN, (unsigned)PAR_STRIPS, show_ns / 1e3 / BENCH_FRAMES,
+           ref_ns / 1e3 / BENCH_FRAMES, (double)ref_ns / (double)show_ns);
+    TEST_CHECK(show_ns < ref_ns);
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    for (uint32_t s = 0; s < WS2812_PARALLEL_MAX_STRIPS; s++) {
+        leds_attach(PIN_BASE + s);
+    }
+    ws2812_parallel_init(PIN_BASE, PAR_STRIPS);
+    run_frame();
+
+    TEST_RUN(test_transpose);
+    TEST_RUN(test_bench);
+    return test_report();
+}
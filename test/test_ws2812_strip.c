@@ -0,0 +1,219 @@
+/**
+ * @file test_ws2812_strip.c
+ * @brief WS2812 strip: GRB(W) encoding on the data line and coalescing of show storms
+ * @note The ws2812 program runs on the PIO emulator, fed by the DMA model through its TX FIFO.
+ *       The LED chain model decodes the data pin: the frames latched must carry the frame
+ *       buffer's pixels in G, R, B (, W) order MSB first, with the bit timing and latch time
+ *       of the datasheet. Built with WS2812_STRIP_LEN 8, for RGBW (as main.c) and RGB pixels.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "test.h"
+#include "sim.h"
+#include "leds.h"
+#include "ws2812_strip.h"
+#include "pico/stdlib.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef STRIP_RGBW
+#define STRIP_RGBW      1
+#endif
+
+#define STRIP_PIN       12
+#define BPP             (STRIP_RGBW ? 32u : 24u)
+#define BIT_NS          (1000000000u / WS2812_STRIP_FREQ)
+#define LOG_MAX         64
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint64_t start_ns;
+    uint32_t first;             // Word of pixel 0
+} frame_log_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static frame_log_t frame_log[LOG_MAX];
+static size_t frame_count = 0;
+static uint32_t rng = 0x2545F491u;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint32_t rand_u32(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static void on_frame(unsigned pin, const leds_frame_t *frame)
+{
+    (void)pin;
+    if (frame_count < LOG_MAX) {
+        frame_log[frame_count] = (frame_log_t){ frame->start_ns, leds_word(frame, 0, BPP) };
+    }
+    frame_count++;
+}
+
+/**
+ * @brief Pixel as it must appear on the line: G, R, B from the first bit, then W (zero)
+ */
+static uint32_t line_word(uint8_t r, uint8_t g, uint8_t b)
+{
+    uint32_t grb = ((uint32_t)g << 16) | ((uint32_t)r << 8) | b;
+
+    return STRIP_RGBW ? grb << 8 : grb;
+}
+
+/**
+ * @brief The all-off frame of ws2812_strip_init(): every bit of every pixel zero, in spec
+ */
+static void test_init(void)
+{
+    const leds_frame_t *f = leds_frame(STRIP_PIN);
+    leds_stats_t ls;
+    ws2812_strip_stats_t s;
+
+    leds_get_stats(STRIP_PIN, &ls);
+    ws2812_strip_get_stats(&s);
+    TEST_CHECK_EQ(ls.frames, 1);
+    TEST_CHECK_EQ(s.frames, 1);
+    TEST_CHECK_EQ(f->bits, WS2812_STRIP_LEN * BPP);
+    for (uint32_t i = 0; i < WS2812_STRIP_LEN; i++) {
+        TEST_CHECK_EQ(leds_word(f, i, BPP), 0);
+    }
+    TEST_CHECK_EQ(ls.timing_errors, 0);
+    TEST_CHECK(!ws2812_strip_busy());
+}
+
+/**
+ * @brief Random pixels: each one on the line in GRB(W) order, bit for bit, no gap between the
+ *        words (DMA keeps the FIFO fed), frame length of the bit count
+ */
+static void test_encoding(void)
+{
+    uint32_t want[WS2812_STRIP_LEN];
+    leds_stats_t ls;
+
+    for (uint32_t round = 0; round < 20; round++) {
+        for (uint32_t i = 0; i < WS2812_STRIP_LEN; i++) {
+            uint32_t c = rand_u32();
+            ws2812_strip_set(i, (uint8_t)c, (uint8_t)(c >> 8), (uint8_t)(c >> 16));
+            want[i] = line_word((uint8_t)c, (uint8_t)(c >> 8), (uint8_t)(c >> 16));
+        }
+        ws2812_strip_set(WS2812_STRIP_LEN, 0xFF, 0xFF, 0xFF);  // Ignored
+        leds_reset_stats(STRIP_PIN);
+        ws2812_strip_show();
+        sim_run_for(SIM_US(WS2812_STRIP_FRAME_US) + SIM_MS(1));
+
+        const leds_frame_t *f = leds_frame(STRIP_PIN);
+        leds_get_stats(STRIP_PIN, &ls);
+        TEST_CHECK_EQ(ls.frames, 1);
+        TEST_CHECK_EQ(f->bits, WS2812_STRIP_LEN * BPP);
+        for (uint32_t i = 0; i < WS2812_STRIP_LEN; i++) {
+            if (leds_word(f, i, BPP) != want[i]) {
+                printf("round %u pixel %u: 0x%08x on the line, expected 0x%08x\n", (unsigned)round,
+                       (unsigned)i, (unsigned)leds_word(f, i, BPP), (unsigned)want[i]);
+            }
+            TEST_CHECK_EQ(leds_word(f, i, BPP), want[i]);
+        }
+        TEST_CHECK_EQ(ls.timing_errors, 0);
+        TEST_CHECK(ls.gap_max_ns < BIT_NS);
+        TEST_CHECK_RANGE(f->end_ns - f->start_ns, (uint64_t)(f->bits - 1) * BIT_NS, (uint64_t)f->bits * BIT_NS);
+    }
+    printf("encoding: %u-bit pixels, %u bits per frame, %.1f us\n", (unsigned)BPP,
+           (unsigned)(WS2812_STRIP_LEN * BPP), (leds_frame(STRIP_PIN)->end_ns - leds_frame(STRIP_PIN)->start_ns) / 1e3);
+}
+
+/**
+ * @brief Drawing right after a show doesn't reach the frame going out, the next show sends it
+ */
+static void test_copy(void)
+{
+    ws2812_strip_fill(0x12, 0x34, 0x56);
+    ws2812_strip_show();
+    ws2812_strip_fill(0xAB, 0xCD, 0xEF);
+    sim_run_for(SIM_US(WS2812_STRIP_FRAME_US) + SIM_MS(1));
+    TEST_CHECK_EQ(leds_word(leds_frame(STRIP_PIN), WS2812_STRIP_LEN - 1, BPP), line_word(0x12, 0x34, 0x56));
+
+    ws2812_strip_show();
+    sim_run_for(SIM_US(WS2812_STRIP_FRAME_US) + SIM_MS(1));
+    TEST_CHECK_EQ(leds_word(leds_frame(STRIP_PIN), WS2812_STRIP_LEN - 1, BPP), line_word(0xAB, 0xCD, 0xEF));
+}
+
+/**
+ * @brief A show every 250 us (a colour wheel being dragged): one frame per WS2812_STRIP_FRAME_US,
+ *        every other show coalesced and counted, the latest colour shown within a frame period,
+ *        the latch time kept between frames
+ */
+static void test_coalesce(void)
+{
+    const uint32_t shows = 200;
+    ws2812_strip_stats_t s0, s1;
+    leds_stats_t ls;
+    uint64_t last_show = 0;
+
+    sim_run_for(SIM_US(WS2812_STRIP_FRAME_US));
+    ws2812_strip_get_stats(&s0);
+    leds_reset_stats(STRIP_PIN);
+    frame_count = 0;
+    uint64_t t0 = sim_now();
+    for (uint32_t i = 0; i < shows; i++) {
+        ws2812_strip_fill((uint8_t)i, (uint8_t)(255 - i), 0x40);
+        ws2812_strip_show();
+        last_show = sim_now();
+        sim_run_for(SIM_US(250));
+    }
+    sim_run_for(SIM_US(WS2812_STRIP_FRAME_US) + SIM_MS(1));
+    ws2812_strip_get_stats(&s1);
+    leds_get_stats(STRIP_PIN, &ls);
+
+    uint32_t frames = s1.frames - s0.frames;
+    uint64_t elapsed = last_show - t0;
+    printf("coalesce: %u shows in %.0f ms, %u frames, %u coalesced, idle %.0f us min between frames\n",
+           (unsigned)shows, elapsed / 1e6, (unsigned)frames, (unsigned)(s1.coalesced - s0.coalesced),
+           ls.idle_min_ns / 1e3);
+    TEST_CHECK_EQ(s1.shows - s0.shows, shows);
+    TEST_CHECK_EQ(frames, ls.frames);
+    TEST_CHECK_EQ(frames, (s1.shows - s0.shows) - (s1.coalesced - s0.coalesced));
+    TEST_CHECK(frames <= elapsed / SIM_US(WS2812_STRIP_FRAME_US) + 2);
+    TEST_CHECK(frames >= elapsed / SIM_US(WS2812_STRIP_FRAME_US));
+    TEST_CHECK(ls.idle_min_ns >= SIM_US(WS2812_STRIP_RESET_US));
+    TEST_CHECK_EQ(ls.timing_errors, 0);
+
+    // Frame period, and the last show's colour out within one period
+    for (size_t i = 1; i < frame_count && i < LOG_MAX; i++) {
+        TEST_CHECK(frame_log[i].start_ns - frame_log[i - 1].start_ns >= SIM_US(WS2812_STRIP_FRAME_US));
+    }
+    size_t last = (frame_count < LOG_MAX ? frame_count : LOG_MAX) - 1;
+    TEST_CHECK_EQ(frame_log[last].first, line_word((uint8_t)(shows - 1), (uint8_t)(255 - (shows - 1)), 0x40));
+    TEST_CHECK(frame_log[last].start_ns - last_show <= SIM_US(WS2812_STRIP_FRAME_US));
+    TEST_CHECK(!ws2812_strip_busy());
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    leds_attach(STRIP_PIN);
+    leds_set_frame_fn(on_frame);
+    ws2812_strip_init(STRIP_PIN, STRIP_RGBW);
+    sim_run_for(SIM_US(WS2812_STRIP_FRAME_US) + SIM_MS(1));
+
+    TEST_RUN(test_init);
+    TEST_RUN(test_encoding);
+    TEST_RUN(test_copy);
+    TEST_RUN(test_coalesce);
+    return test_report();
+}
@@ -0,0 +1,240 @@
+/**
+ * @file touch_calib.c
+ * @brief Touch Calibration and Orientation Transform Implementation
+ * @note Two stages kept apart: the calibration maps raw coordinates to portrait pixels, the
+ *       orientation is a rotation/flip of those (coefficients 0 or +-1). Both are combined into
+ *       one Q16 matrix whenever either changes, so a point costs four multiplies.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "touch_calib.h"
+#include "hardware/sync.h"
+#include <stdlib.h>
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void touch_calib_rebuild(st7796_orientation_t orientation);
+static touch_calib_point_t touch_calib_to_portrait(st7796_orientation_t orientation, touch_calib_point_t p);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static spin_lock_t *calib_lock = NULL;
+
+/* Raw to portrait pixels (default scaling or 3-point calibration), guarded by calib_lock */
+static touch_calib_matrix_t calib_portrait;
+static uint32_t calib_version = 0;              // Bumped on every change of calib_portrait
+static uint16_t calib_raw_w = ST7796_WIDTH;
+static uint16_t calib_raw_h = ST7796_HEIGHT;
+
+/* Raw to display for calib_orientation, owned by the touch_calib_apply() caller */
+static touch_calib_matrix_t calib_matrix;
+static st7796_orientation_t calib_orientation;
+static uint32_t calib_matrix_version = UINT32_MAX;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Initialize with the GT911 resolution
+ */
+void touch_calib_init(uint16_t raw_w, uint16_t raw_h)
+{
+    if (calib_lock == NULL) {
+        calib_lock = spin_lock_init(spin_lock_claim_unused(true));
+    }
+
+    calib_raw_w = raw_w ? raw_w : ST7796_WIDTH;
+    calib_raw_h = raw_h ? raw_h : ST7796_HEIGHT;
+    touch_calib_clear();
+}
+
+/**
+ * @brief Calibrate from three touches
+ * @note Solves X = a * x + b * y + c (and the same for Y) through the three points with
+ *       Cramer's rule relative to the third point, in 64-bit integers.
+ */
+bool touch_calib_set_points(const touch_calib_point_t raw[3], const touch_calib_point_t disp[3])
+{
+    st7796_orientation_t orientation = st7796_get_orientation();
+    touch_calib_point_t p[3];
+    touch_calib_matrix_t m;
+
+    // 1. Targets into the portrait frame the calibration lives in
+    for (int i = 0; i < 3; i++) {
+        p[i] = touch_calib_to_portrait(orientation, disp[i]);
+    }
+
+    // 2. Collinear (or nearly) points don't define a mapping
+    int32_t dx0 = raw[0].x - raw[2].x, dy0 = raw[0].y - raw[2].y;
+    int32_t dx1 = raw[1].x - raw[2].x, dy1 = raw[1].y - raw[2].y;
+    int64_t det = (int64_t)dx0 * dy1 - (int64_t)dx1 * dy0;
+    if (llabs(det) < 16) {
+        return false;
+    }
+
+    // 3. Coefficients in Q16
+    int32_t du0 = p[0].x - p[2].x, du1 = p[1].x - p[2].x;
+    int32_t dv0 = p[0].y - p[2].y, dv1 = p[1].y - p[2].y;
+    int64_t a = (((int64_t)du0 * dy1 - (int64_t)du1 * dy0) << TOUCH_CALIB_SHIFT) / det;
+    int64_t b = (((int64_t)dx0 * du1 - (int64_t)dx1 * du0) << TOUCH_CALIB_SHIFT) / det;
+    int64_t d = (((int64_t)dv0 * dy1 - (int64_t)dv1 * dy0) << TOUCH_CALIB_SHIFT) / det;
+    int64_t e = (((int64_t)dx0 * dv1 - (int64_t)dx1 * dv0) << TOUCH_CALIB_SHIFT) / det;
+    int64_t c = ((int64_t)p[2].x << TOUCH_CALIB_SHIFT) - a * raw[2].x - b * raw[2].y;
+    int64_t f = ((int64_t)p[2].y << TOUCH_CALIB_SHIFT) - d * raw[2].x - e * raw[2].y;
+
+    // 4. Out of range means the touches were bogus (or on the wrong targets)
+    if (llabs(a) > TOUCH_CALIB_MAX_COEF || llabs(b) > TOUCH_CALIB_MAX_COEF ||
+        llabs(d) > TOUCH_CALIB_MAX_COEF || llabs(e) > TOUCH_CALIB_MAX_COEF ||
+        llabs(c) > TOUCH_CALIB_MAX_OFFSET || llabs(f) > TOUCH_CALIB_MAX_OFFSET) {
+        return false;
+    }
+    m.a = (int32_t)a;
+    m.b = (int32_t)b;
+    m.c = (int32_t)c;
+    m.d = (int32_t)d;
+    m.e = (int32_t)e;
+    m.f = (int32_t)f;
+
+    uint32_t irq = spin_lock_blocking(calib_lock);
+    calib_portrait = m;
+    calib_version++;
+    spin_unlock(calib_lock, irq);
+
+    return true;
+}
+
+/**
+ * @brief Drop the 3-point calibration, back to resolution scaling
+ */
+void touch_calib_clear(void)
+{
+    touch_calib_matrix_t m = {
+        .a = (ST7796_WIDTH << TOUCH_CALIB_SHIFT) / calib_raw_w,
+        .e = (ST7796_HEIGHT << TOUCH_CALIB_SHIFT) / calib_raw_h,
+    };
+
+    uint32_t irq = spin_lock_blocking(calib_lock);
+    calib_portrait = m;
+    calib_version++;
+    spin_unlock(calib_lock, irq);
+}
+
+/**
+ * @brief Map a raw coordinate to the display
+ */
+void touch_calib_apply(uint16_t *x, uint16_t *y)
+{
+    // 1. Orientation or calibration changed: combine them again
+    st7796_orientation_t orientation = st7796_get_orientation();
+    if (orientation != calib_orientation || calib_version != calib_matrix_version) {
+        touch_calib_rebuild(orientation);
+    }
+
+    // 2. Transform, rounded to the nearest pixel. 64-bit: a coefficient of up to
+    //    TOUCH_CALIB_MAX_COEF times a glitched raw value near 0xFFFF overflows int32_t
+    const touch_calib_matrix_t *m = &calib_matrix;
+    int64_t rx = *x;
+    int64_t ry = *y;
+    int64_t dx = (m->a * rx + m->b * ry + m->c + (TOUCH_CALIB_ONE / 2)) >> TOUCH_CALIB_SHIFT;
+    int64_t dy = (m->d * rx + m->e * ry + m->f + (TOUCH_CALIB_ONE / 2)) >> TOUCH_CALIB_SHIFT;
+
+    // 3. Clamp to the display
+    bool swap = (orientation == ST7796_LANDSCAPE || orientation == ST7796_LANDSCAPE_INV);
+    int32_t w = swap ? ST7796_HEIGHT : ST7796_WIDTH;
+    int32_t h = swap ? ST7796_WIDTH : ST7796_HEIGHT;
+    *x = (uint16_t)(dx < 0 ? 0 : (dx >= w ? w - 1 : dx));
+    *y = (uint16_t)(dy < 0 ? 0 : (dy >= h ? h - 1 : dy));
+}
+
+/**
+ * @brief Get the raw to display matrix for the current orientation
+ */
+void touch_calib_get_matrix(touch_calib_matrix_t *m)
+{
+    st7796_orientation_t orientation = st7796_get_orientation();
+    if (orientation != calib_orientation || calib_version != calib_matrix_version) {
+        touch_calib_rebuild(orientation);
+    }
+    *m = calib_matrix;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Combine the portrait calibration with an orientation
+ * @param orientation Display orientation
+ * @note Portrait pixels (u, v) to the display, matching the MADCTL values of st7796.c:
+ *       landscape (v, W-1-u), portrait inverted (W-1-u, H-1-v), landscape inverted (H-1-v, u)
+ */
+static void touch_calib_rebuild(st7796_orientation_t orientation)
+{
+    touch_calib_matrix_t p;
+
+    uint32_t irq = spin_lock_blocking(calib_lock);
+    p = calib_portrait;
+    uint32_t version = calib_version;
+    spin_unlock(calib_lock, irq);
+
+    const int32_t w1 = (ST7796_WIDTH - 1) << TOUCH_CALIB_SHIFT;
+    const int32_t h1 = (ST7796_HEIGHT - 1) << TOUCH_CALIB_SHIFT;
+    touch_calib_matrix_t *m = &calib_matrix;
+
+    switch (orientation) {
+        case ST7796_LANDSCAPE:
+            *m = (touch_calib_matrix_t){ p.d, p.e, p.f, -p.a, -p.b, w1 - p.c };
+            break;
+        case ST7796_PORTRAIT_INV:
+            *m = (touch_calib_matrix_t){ -p.a, -p.b, w1 - p.c, -p.d, -p.e, h1 - p.f };
+            break;
+        case ST7796_LANDSCAPE_INV:
+            *m = (touch_calib_matrix_t){ -p.d, -p.e, h1 - p.f, p.a, p.b, p.c };
+            break;
+        case ST7796_PORTRAIT:
+        default:
+            *m = p;
+            break;
+    }
+
+    calib_orientation = orientation;
+    calib_matrix_version = version;
+}
+
+/**
+ * @brief Display coordinates of an orientation back to portrait pixels
+ * @param orientation Display orientation
+ * @param p Point in display coordinates
+ * @return Point in portrait pixels
+ */
+static touch_calib_point_t touch_calib_to_portrait(st7796_orientation_t orientation, touch_calib_point_t p)
+{
+    touch_calib_point_t r;
+
+    switch (orientation) {
+        case ST7796_LANDSCAPE:
+            r.x = (ST7796_WIDTH - 1) - p.y;
+            r.y = p.x;
+            break;
+        case ST7796_PORTRAIT_INV:
+            r.x = (ST7796_WIDTH - 1) - p.x;
+            r.y = (ST7796_HEIGHT - 1) - p.y;
+            break;
+        case ST7796_LANDSCAPE_INV:
+            r.x = p.y;
+            r.y = (ST7796_HEIGHT - 1) - p.x;
+            break;
+        case ST7796_PORTRAIT:
+        default:
+            r = p;
+            break;
+    }
+    return r;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file touch_calib.h
+ * @brief Touch Calibration and Orientation Transform Header
+ * @note Maps raw GT911 coordinates to display coordinates with an integer affine matrix:
+ *       scaling from the GT911 resolution (or a 3-point calibration), then the current
+ *       ST7796 orientation. No floating point.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef TOUCH_CALIB_H
+#define TOUCH_CALIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "st7796.h"
+
+/**********************
+ *      DEFINES
+ **********************/
+/* Matrix coefficients are Q16 fixed point */
+#define TOUCH_CALIB_SHIFT       16
+#define TOUCH_CALIB_ONE         (1 << TOUCH_CALIB_SHIFT)
+
+/* Largest accepted coefficients of a 3-point calibration, keep a * x + b * y + c within
+ * 32 bits for raw coordinates below 4096 */
+#define TOUCH_CALIB_MAX_COEF    (2 * TOUCH_CALIB_ONE)
+#define TOUCH_CALIB_MAX_OFFSET  (1 << 29)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Affine matrix, Q16: X = a * x + b * y + c, Y = d * x + e * y + f
+ */
+typedef struct {
+    int32_t a, b, c;
+    int32_t d, e, f;
+} touch_calib_matrix_t;
+
+/**
+ * @brief Calibration point
+ */
+typedef struct {
+    int16_t x;
+    int16_t y;
+} touch_calib_point_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Initialize with the GT911 resolution
+ * @param raw_w Raw X range (gt911_dev_t.max_x), 0 = same as the panel
+ * @param raw_h Raw Y range (gt911_dev_t.max_y), 0 = same as the panel
+ * @note The raw frame is taken to be the panel's portrait frame
+ */
+void touch_calib_init(uint16_t raw_w, uint16_t raw_h);
+
+/**
+ * @brief Calibrate from three touches
+ * @param raw Raw GT911 coordinates of the three touches
+ * @param disp Where they should land, in the current orientation's display coordinates
+ * @return false if the points are (nearly) collinear or the result is out of range
+ * @note Stored in the portrait frame, so it stays valid when the orientation changes
+ */
+bool touch_calib_set_points(const touch_calib_point_t raw[3], const touch_calib_point_t disp[3]);
+
+/**
+ * @brief Drop the 3-point calibration, back to resolution scaling
+ */
+void touch_calib_clear(void);
+
+/**
+ * @brief Map a raw coordinate to the display
+ * @param x In: raw X, out: display X
+ * @param y In: raw Y, out: display Y
+ * @note Follows st7796_set_orientation() on its own, the result is clamped to the display
+ */
+void touch_calib_apply(uint16_t *x, uint16_t *y);
+
+/**
+ * @brief Get the raw to display matrix for the current orientation
+ * @param m Output
+ */
+void touch_calib_get_matrix(touch_calib_matrix_t *m);
+
+#endif /* TOUCH_CALIB_H */
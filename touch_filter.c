@@ -0,0 +1,164 @@
+/**
+ * @file touch_filter.c
+ * @brief Touch Pointer Filter Implementation
+ * @note One-euro filter (Casiez et al.): an exponential smoother whose cutoff rises with the
+ *       smoothed speed. Smoothing factors are Q16, the low pass is done in 64 bits so fast
+ *       drags at short sample intervals can't overflow. Both axes share the cutoff of the pointer
+ *       speed: per axis, a diagonal drag would be smoothed (and lag) as a slower one.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "touch_filter.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Positions are kept in 1/16 pixel */
+#define TOUCH_FILTER_FRAC       4
+
+/* 1 / (2 pi) in us * mHz: tau (us) = TOUCH_FILTER_TAU_K / cutoff (mHz) */
+#define TOUCH_FILTER_TAU_K      159154943u
+
+/* Longest sample interval used for the velocity (ms), an idle re-read is not a slow drag */
+#define TOUCH_FILTER_MAX_DT_MS  100
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void touch_filter_velocity(touch_filter_axis_t *a, int32_t raw, uint32_t dt_ms);
+static int32_t touch_filter_position(touch_filter_axis_t *a, int32_t raw, uint32_t alpha, uint32_t speed);
+static uint32_t touch_filter_speed(const touch_filter_t *f);
+static uint32_t touch_filter_alpha(uint32_t cutoff_mhz, uint32_t dt_ms);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Reset the filter
+ */
+void touch_filter_reset(touch_filter_t *f)
+{
+    memset(f, 0, sizeof(*f));
+}
+
+/**
+ * @brief Filter one pointer sample
+ */
+void touch_filter_update(touch_filter_t *f, uint16_t *x, uint16_t *y, uint32_t time_ms)
+{
+    int32_t raw_x = (int32_t)*x << TOUCH_FILTER_FRAC;
+    int32_t raw_y = (int32_t)*y << TOUCH_FILTER_FRAC;
+
+    // 1. First sample of a press: nothing to smooth against
+    if (!f->valid) {
+        f->valid = true;
+        f->time_ms = time_ms;
+        f->x = (touch_filter_axis_t){ .raw = raw_x, .pos = raw_x, .vel = 0 };
+        f->y = (touch_filter_axis_t){ .raw = raw_y, .pos = raw_y, .vel = 0 };
+        return;
+    }
+
+    // 2. Interval since the previous sample, two frames can land in the same tick
+    uint32_t dt_ms = time_ms - f->time_ms;
+    if (dt_ms == 0) {
+        dt_ms = 1;
+    } else if (dt_ms > TOUCH_FILTER_MAX_DT_MS) {
+        dt_ms = TOUCH_FILTER_MAX_DT_MS;
+    }
+    f->time_ms = time_ms;
+
+    // 3. Velocities, then the position cutoff rises with the pointer speed
+    touch_filter_velocity(&f->x, raw_x, dt_ms);
+    touch_filter_velocity(&f->y, raw_y, dt_ms);
+    uint32_t speed = touch_filter_speed(f);
+    uint32_t alpha = touch_filter_alpha(TOUCH_FILTER_MIN_CUTOFF_MHZ + TOUCH_FILTER_BETA * speed, dt_ms);
+    
+    // 4. Filter and extrapolate, rounded back to whole pixels
+    int32_t out_x = touch_filter_position(&f->x, raw_x, alpha, speed);
+    int32_t out_y = touch_filter_position(&f->y, raw_y, alpha, speed);
+    *x = (out_x < 0) ? 0 : (uint16_t)((out_x + (1 << (TOUCH_FILTER_FRAC - 1))) >> TOUCH_FILTER_FRAC);
+    *y = (out_y < 0) ? 0 : (uint16_t)((out_y + (1 << (TOUCH_FILTER_FRAC - 1))) >> TOUCH_FILTER_FRAC);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Smoothed velocity of one axis
+ * @param a Axis state
+ * @param raw Measured position (1/16 px)
+ * @param dt_ms Interval since the previous sample
+ * @note Between measured samples: against the smoothed position (as in the paper) it would
+ *       include the filter lag and overshoot the extrapolation
+ */
+static void touch_filter_velocity(touch_filter_axis_t *a, int32_t raw, uint32_t dt_ms)
+{
+    int32_t vel = (raw - a->raw) * 1000 / (int32_t)dt_ms;
+    a->raw = raw;
+    uint32_t alpha = touch_filter_alpha(TOUCH_FILTER_D_CUTOFF_MHZ, dt_ms);
+    a->vel += (int32_t)(((int64_t)(vel - a->vel) * alpha) >> 16);
+}
+
+/**
+ * @brief Smooth one axis and extrapolate it
+ * @param a Axis state, velocity already updated
+ * @param raw Measured position (1/16 px)
+ * @param alpha Smoothing factor of the pointer speed (Q16)
+ * @param speed Pointer speed (px/s)
+ * @return Smoothed position plus the extrapolation (1/16 px)
+ */
+static int32_t touch_filter_position(touch_filter_axis_t *a, int32_t raw, uint32_t alpha, uint32_t speed)
+{
+    a->pos += (int32_t)(((int64_t)(raw - a->pos) * alpha) >> 16);
+
+    // Extrapolation fades in between the noise floor and twice it: none at rest (no added jitter)
+    if (speed <= TOUCH_FILTER_PREDICT_MIN_SPEED) {
+        return a->pos;
+    }
+    int64_t ahead = (int64_t)a->vel * TOUCH_FILTER_PREDICT_MS / 1000;
+    if (speed < 2 * TOUCH_FILTER_PREDICT_MIN_SPEED) {
+        ahead = ahead * (speed - TOUCH_FILTER_PREDICT_MIN_SPEED) / TOUCH_FILTER_PREDICT_MIN_SPEED;
+    }
+    const int32_t limit = TOUCH_FILTER_PREDICT_MAX << TOUCH_FILTER_FRAC;
+    if (ahead > limit) {
+        ahead = limit;
+    } else if (ahead < -limit) {
+        ahead = -limit;
+    }
+    return a->pos + (int32_t)ahead;
+}
+
+/**
+ * @brief Pointer speed from the smoothed velocities
+ * @return px/s, max + 3/8 min (within 7% of the length)
+ */
+static uint32_t touch_filter_speed(const touch_filter_t *f)
+{
+    uint32_t vx = (uint32_t)(f->x.vel < 0 ? -f->x.vel : f->x.vel);
+    uint32_t vy = (uint32_t)(f->y.vel < 0 ? -f->y.vel : f->y.vel);
+    uint32_t hi = vx > vy ? vx : vy;
+    uint32_t lo = vx > vy ? vy : vx;
+
+    return (hi + (lo * 3) / 8) >> TOUCH_FILTER_FRAC;
+}
+
+/**
+ * @brief Smoothing factor of a first order low pass
+ * @param cutoff_mhz Cutoff frequency (mHz)
+ * @param dt_ms Sample interval
+ * @return alpha = dt / (dt + tau) in Q16
+ */
+static uint32_t touch_filter_alpha(uint32_t cutoff_mhz, uint32_t dt_ms)
+{
+    uint32_t tau_us = TOUCH_FILTER_TAU_K / (cutoff_mhz ? cutoff_mhz : 1);
+    uint32_t te_us = dt_ms * 1000;
+
+    return (uint32_t)(((uint64_t)te_us << 16) / (te_us + tau_us));
+}
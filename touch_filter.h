@@ -0,0 +1,91 @@
+/**
+ * @file touch_filter.h
+ * @brief Touch Pointer Filter Header
+ * @note 1-euro adaptive smoothing (little smoothing while moving fast, a lot at rest) plus a short
+ *       velocity extrapolation to make up for the touch controller and display latency.
+ *       Fixed point, positions in 1/16 pixel.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef TOUCH_FILTER_H
+#define TOUCH_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ *      DEFINES
+ **********************/
+/* Cutoff at rest (mHz): lower = steadier, but slow drags lag more */
+#ifndef TOUCH_FILTER_MIN_CUTOFF_MHZ
+#define TOUCH_FILTER_MIN_CUTOFF_MHZ     1000
+#endif
+
+/* Cutoff increase with the pointer speed (mHz per px/s): higher = less lag on fast drags */
+#ifndef TOUCH_FILTER_BETA
+#define TOUCH_FILTER_BETA               20
+#endif
+
+/* Cutoff of the velocity estimate (mHz) */
+#ifndef TOUCH_FILTER_D_CUTOFF_MHZ
+#define TOUCH_FILTER_D_CUTOFF_MHZ       5000
+#endif
+
+/* Extrapolate the position this far ahead (ms), 0 = smoothing only */
+#ifndef TOUCH_FILTER_PREDICT_MS
+#define TOUCH_FILTER_PREDICT_MS         20
+#endif
+
+/* Speed the controller noise reaches in the velocity estimate (px/s): no extrapolation up to it,
+ * full extrapolation from twice it, so a finger at rest gets none */
+#ifndef TOUCH_FILTER_PREDICT_MIN_SPEED
+#define TOUCH_FILTER_PREDICT_MIN_SPEED  120
+#endif
+
+/* Largest extrapolation (px), bounds the overshoot when a drag stops */
+#ifndef TOUCH_FILTER_PREDICT_MAX
+#define TOUCH_FILTER_PREDICT_MAX        32
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Filter state of one axis
+ */
+typedef struct {
+    int32_t raw;                // Previous measured position (1/16 px)
+    int32_t pos;                // Smoothed position (1/16 px)
+    int32_t vel;                // Smoothed velocity (1/16 px per second)
+} touch_filter_axis_t;
+
+/**
+ * @brief Filter state of one pointer
+ */
+typedef struct {
+    bool valid;                 // false until the first sample of a press
+    uint32_t time_ms;           // Time of the previous sample
+    touch_filter_axis_t x;
+    touch_filter_axis_t y;
+} touch_filter_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Reset the filter, call on release so the next press starts where it lands
+ * @param f Filter state
+ */
+void touch_filter_reset(touch_filter_t *f);
+
+/**
+ * @brief Filter one pointer sample
+ * @param f Filter state
+ * @param x In: measured X, out: filtered and extrapolated X
+ * @param y In: measured Y, out: filtered and extrapolated Y
+ * @param time_ms Time of the sample
+ */
+void touch_filter_update(touch_filter_t *f, uint16_t *x, uint16_t *y, uint32_t time_ms);
+
+#endif /* TOUCH_FILTER_H */
@@ -0,0 +1,253 @@
+/**
+ * @file touch_gesture.c
+ * @brief Touch Gesture Recognition Implementation
+ * @note Two-finger gestures follow the track IDs of the first two fingers down, measured against
+ *       the midpoint, distance and angle when the second finger landed. Each kind starts once
+ *       past its slop and then reports every new frame until a finger lifts.
+ *       Distance is an integer square root, angle a polynomial atan2 (within 0.3 degree).
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "touch_gesture.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define GESTURE_BIT(type)       (1u << (type))
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void gesture_two_finger(const gt911_point_t *a, const gt911_point_t *b,
+                               int16_t *x, int16_t *y, uint16_t *dist, int16_t *angle);
+static const gt911_point_t *gesture_find(const gt911_touch_t *touch, uint8_t id);
+static uint16_t gesture_isqrt(uint32_t value);
+static int16_t gesture_atan2(int32_t y, int32_t x);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Reset the recognizer
+ */
+void touch_gesture_init(gesture_state_t *g)
+{
+    memset(g, 0, sizeof(*g));
+}
+
+/**
+ * @brief Feed one touch frame
+ */
+uint32_t touch_gesture_update(gesture_state_t *g, const gt911_touch_t *touch, uint32_t now_ms,
+                              gesture_event_t *events)
+{
+    uint32_t n = 0;
+    bool fresh = (touch->frame != g->frame);
+    g->frame = touch->frame;
+
+    // 1. Two or more fingers: follow the gesture's two track IDs
+    if (touch->count >= 2) {
+        const gt911_point_t *a = NULL;
+        const gt911_point_t *b = NULL;
+        if (g->fingers == 2) {
+            a = gesture_find(touch, g->id[0]);
+            b = gesture_find(touch, g->id[1]);
+        }
+
+        int16_t x, y, angle;
+        uint16_t dist;
+
+        // New pair (second finger down, or one of the pair replaced): start over
+        if (a == NULL || b == NULL) {
+            if (g->fingers == 2 && g->active) {
+                events[n++] = (gesture_event_t){ .type = GESTURE_END, .x = g->start_x, .y = g->start_y };
+            }
+            a = &touch->points[0];
+            b = &touch->points[1];
+            gesture_two_finger(a, b, &x, &y, &dist, &angle);
+            g->fingers = 2;
+            g->id[0] = a->id;
+            g->id[1] = b->id;
+            g->active = 0;
+            g->start_x = x;
+            g->start_y = y;
+            g->start_dist = dist > 0 ? dist : 1;
+            g->start_angle = angle;
+            g->start_ms = now_ms;
+            return n;
+        }
+
+        if (!fresh) {
+            return n;
+        }
+        gesture_two_finger(a, b, &x, &y, &dist, &angle);
+
+        // Pinch: distance relative to the start
+        if ((g->active & GESTURE_BIT(GESTURE_PINCH)) || abs(dist - g->start_dist) > GESTURE_PINCH_SLOP) {
+            uint32_t scale = ((uint32_t)dist * GESTURE_SCALE_ONE) / g->start_dist;
+            g->active |= GESTURE_BIT(GESTURE_PINCH);
+            events[n++] = (gesture_event_t){
+                .type = GESTURE_PINCH, .x = x, .y = y,
+                .value = (int16_t)(scale < INT16_MAX ? scale : INT16_MAX),
+            };
+        }
+
+        // Pan: midpoint movement
+        int16_t dx = x - g->start_x;
+        int16_t dy = y - g->start_y;
+        if ((g->active & GESTURE_BIT(GESTURE_PAN)) || abs(dx) > GESTURE_SLOP || abs(dy) > GESTURE_SLOP) {
+            g->active |= GESTURE_BIT(GESTURE_PAN);
+            events[n++] = (gesture_event_t){ .type = GESTURE_PAN, .x = x, .y = y, .dx = dx, .dy = dy };
+        }
+
+        // Rotate: angle change, wrapped to -180..180 degrees
+        int32_t turn = angle - g->start_angle;
+        if (turn > 1800) {
+            turn -= 3600;
+        } else if (turn <= -1800) {
+            turn += 3600;
+        }
+        if ((g->active & GESTURE_BIT(GESTURE_ROTATE)) || abs(turn) > GESTURE_ROTATE_SLOP) {
+            g->active |= GESTURE_BIT(GESTURE_ROTATE);
+            events[n++] = (gesture_event_t){ .type = GESTURE_ROTATE, .x = x, .y = y, .value = (int16_t)turn };
+        }
+        return n;
+    }
+
+    // 2. Back to one finger or none: a two-finger gesture is over
+    if (g->fingers == 2) {
+        if (g->active) {
+            events[n++] = (gesture_event_t){ .type = GESTURE_END, .x = g->start_x, .y = g->start_y };
+        }
+        g->fingers = 0;
+        if (touch->count == 1) {
+            // The remaining finger doesn't start a long-press of its own
+            g->fingers = 1;
+            g->id[0] = touch->points[0].id;
+            g->active = GESTURE_BIT(GESTURE_LONG_PRESS);
+            return n;
+        }
+    }
+
+    if (touch->count == 0) {
+        g->fingers = 0;
+        return n;
+    }
+
+    // 3. One finger: long-press when it stays within the slop long enough
+    const gt911_point_t *p = &touch->points[0];
+    if (g->fingers != 1 || p->id != g->id[0]) {
+        g->fingers = 1;
+        g->id[0] = p->id;
+        g->active = 0;
+        g->start_x = p->x;
+        g->start_y = p->y;
+        g->start_ms = now_ms;
+        return n;
+    }
+
+    if (g->active & GESTURE_BIT(GESTURE_LONG_PRESS)) {
+        return n;  // Reported or moved away
+    }
+    if (abs(p->x - g->start_x) > GESTURE_SLOP || abs(p->y - g->start_y) > GESTURE_SLOP) {
+        g->active |= GESTURE_BIT(GESTURE_LONG_PRESS);  // A drag, not a long-press
+        return n;
+    }
+    if (now_ms - g->start_ms >= GESTURE_LONG_PRESS_MS) {
+        g->active |= GESTURE_BIT(GESTURE_LONG_PRESS);
+        events[n++] = (gesture_event_t){ .type = GESTURE_LONG_PRESS, .x = p->x, .y = p->y };
+    }
+    return n;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Midpoint, distance and angle of two fingers
+ */
+static void gesture_two_finger(const gt911_point_t *a, const gt911_point_t *b,
+                               int16_t *x, int16_t *y, uint16_t *dist, int16_t *angle)
+{
+    int32_t dx = (int32_t)b->x - a->x;
+    int32_t dy = (int32_t)b->y - a->y;
+
+    *x = (a->x + b->x) / 2;
+    *y = (a->y + b->y) / 2;
+    *dist = gesture_isqrt((uint32_t)(dx * dx) + (uint32_t)(dy * dy));
+    *angle = gesture_atan2(dy, dx);
+}
+
+/**
+ * @brief Find a point by track ID
+ * @return The point, NULL if that finger is no longer down
+ */
+static const gt911_point_t *gesture_find(const gt911_touch_t *touch, uint8_t id)
+{
+    for (uint8_t i = 0; i < touch->count; i++) {
+        if (touch->points[i].id == id) {
+            return &touch->points[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Integer square root (floor), one result bit per iteration
+ */
+static uint16_t gesture_isqrt(uint32_t value)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)root;
+}
+
+/**
+ * @brief atan2 in 0.1 degree, -1800..1800
+ * @note First octant atan(t) ~ 45 t + 15.6 t (1 - t) degrees, folded out by symmetry.
+ *       Clockwise on screen is positive (Y grows downwards).
+ */
+static int16_t gesture_atan2(int32_t y, int32_t x)
+{
+    uint32_t ax = abs(x);
+    uint32_t ay = abs(y);
+
+    if (ax == 0 && ay == 0) {
+        return 0;
+    }
+
+    // 1. Smaller over larger in Q15, coordinates are 16-bit so this can't overflow
+    uint32_t t = (ax >= ay) ? (ay << 15) / ax : (ax << 15) / ay;
+    uint32_t u = (t * (32768 - t)) >> 15;
+    int32_t a = (int32_t)((450 * t + 156 * u + (1u << 14)) >> 15);
+
+    // 2. Fold out to the full circle
+    if (ay > ax) {
+        a = 900 - a;
+    }
+    if (x < 0) {
+        a = 1800 - a;
+    }
+    return (int16_t)(y < 0 ? -a : a);
+}
@@ -0,0 +1,109 @@
+/**
+ * @file touch_gesture.h
+ * @brief Touch Gesture Recognition Header
+ * @note Turns GT911 multi-point frames into compact gesture events: long-press (one finger),
+ *       pinch, two-finger pan and rotate. Integer only, no allocation.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef TOUCH_GESTURE_H
+#define TOUCH_GESTURE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gt911.h"
+
+/**********************
+ *      DEFINES
+ **********************/
+/* One finger held this long without moving is a long-press (ms) */
+#ifndef GESTURE_LONG_PRESS_MS
+#define GESTURE_LONG_PRESS_MS       600
+#endif
+
+/* Movement that still counts as holding still / starts a pan (touch units) */
+#ifndef GESTURE_SLOP
+#define GESTURE_SLOP                12
+#endif
+
+/* Distance change that starts a pinch (touch units) */
+#ifndef GESTURE_PINCH_SLOP
+#define GESTURE_PINCH_SLOP          16
+#endif
+
+/* Angle change that starts a rotation (0.1 degree) */
+#ifndef GESTURE_ROTATE_SLOP
+#define GESTURE_ROTATE_SLOP         100
+#endif
+
+/* Most events one frame can produce (pinch + pan + rotate) */
+#define GESTURE_MAX_EVENTS          3
+
+/* Scale of a pinch at the start distance */
+#define GESTURE_SCALE_ONE           256
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Gesture event type
+ */
+typedef enum {
+    GESTURE_NONE = 0,
+    GESTURE_LONG_PRESS,         // value unused, once per press
+    GESTURE_PINCH,              // value = distance / start distance (GESTURE_SCALE_ONE = 1.0)
+    GESTURE_PAN,                // dx, dy = midpoint movement since the start
+    GESTURE_ROTATE,             // value = angle since the start (0.1 degree, clockwise on screen)
+    GESTURE_END,                // Two-finger gesture over (a finger lifted)
+} gesture_type_t;
+
+/**
+ * @brief Gesture event
+ * @note x, y are the finger (long-press) or the midpoint of the two fingers, in touch units
+ */
+typedef struct {
+    uint8_t type;               // gesture_type_t
+    int16_t x;
+    int16_t y;
+    int16_t dx;
+    int16_t dy;
+    int16_t value;
+} gesture_event_t;
+
+/**
+ * @brief Recognizer state, one per touch panel
+ */
+typedef struct {
+    uint8_t fingers;            // Fingers in the current gesture: 0, 1 or 2
+    uint8_t id[2];              // Track IDs of the gesture's fingers
+    uint8_t active;             // Bit per gesture_type_t reported since the start
+    int16_t start_x;            // Start position (one finger) or midpoint (two)
+    int16_t start_y;
+    uint16_t start_dist;        // Two fingers: start distance
+    int16_t start_angle;        // Two fingers: start angle (0.1 degree)
+    uint32_t start_ms;          // When the gesture's fingers went down
+    uint32_t frame;             // Last gt911_touch_t.frame seen
+} gesture_state_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Reset the recognizer
+ * @param g Recognizer state
+ */
+void touch_gesture_init(gesture_state_t *g);
+
+/**
+ * @brief Feed one touch frame
+ * @param g Recognizer state
+ * @param touch Frame from gt911_read_points()
+ * @param now_ms Time of the frame (ms), also call without new frames while held for long-press
+ * @param events Output, room for GESTURE_MAX_EVENTS
+ * @return Number of events written
+ */
+uint32_t touch_gesture_update(gesture_state_t *g, const gt911_touch_t *touch, uint32_t now_ms,
+                              gesture_event_t *events);
+
+#endif /* TOUCH_GESTURE_H */
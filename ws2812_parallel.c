@@ -0,0 +1,246 @@
+/**
+ * @file ws2812_parallel.c
+ * @brief Parallel WS2812 Strips Driver Implementation
+ * @note ws2812_parallel shifts one FIFO word per bit time, bit n of the word going to strip n.
+ *       The frame buffer keeps the 8 strips' bytes of each colour next to each other, so a
+ *       bit-plane conversion is an 8x8 bit matrix transpose done on two 32-bit words.
+ *       DMA writes the planes to the FIFO as bytes, which the bus replicates across the
+ *       word: the program's `mov pins, x` only looks at the low bits.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "ws2812_parallel.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+#include <string.h>
+
+#include "ws2812.pio.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define WS2812_PARALLEL_PIO     pio0
+#define WS2812_PARALLEL_FREQ    800000
+
+/* Bytes of 8 strips for one colour of one pixel, also the planes of one colour */
+#define WS2812_PARALLEL_GROUP   8
+
+/* Planes of a frame: 24 bits per pixel, one byte per bit */
+#define WS2812_PARALLEL_PLANES  (WS2812_PARALLEL_LEN * 24)
+
+/* Frame plus latch time (us): 1.25 us per plane, two planes of margin for the FIFO tail */
+#define WS2812_PARALLEL_FRAME_US    ((WS2812_PARALLEL_PLANES + 2) * 10 / 8 + WS2812_PARALLEL_RESET_US)
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void ws2812_parallel_start(void);
+static int64_t ws2812_parallel_alarm(alarm_id_t id, void *user_data);
+static void ws2812_parallel_transpose(const uint8_t *in, uint8_t *out);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* Frame buffer, [pixel][G, R, B][strip] */
+static uint8_t par_pixels[WS2812_PARALLEL_LEN][3][WS2812_PARALLEL_GROUP] __attribute__((aligned(4)));
+/* Bit planes going out, MSB of G first */
+static uint8_t par_planes[WS2812_PARALLEL_PLANES] __attribute__((aligned(4)));
+static uint32_t par_strips = 0;
+static uint par_sm = 0;
+static int par_chan = -1;
+
+/* Frame state, guarded by par_lock. The conversion runs outside of it: busy owns par_planes. */
+static spin_lock_t *par_lock = NULL;
+static volatile bool par_busy = false;
+static bool par_pending = false;
+static ws2812_parallel_stats_t par_stats;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Initialize the outputs and send an all-off frame
+ */
+void ws2812_parallel_init(uint32_t pin_base, uint32_t strips)
+{
+    if (par_chan >= 0) {
+        return;  // Already running
+    }
+    par_strips = (strips > WS2812_PARALLEL_MAX_STRIPS) ? WS2812_PARALLEL_MAX_STRIPS : strips;
+
+    // 1. State machine: one 32-bit word per bit time, the low par_strips bits drive the pins
+    par_sm = pio_claim_unused_sm(WS2812_PARALLEL_PIO, true);
+    uint offset = pio_add_program(WS2812_PARALLEL_PIO, &ws2812_parallel_program);
+    ws2812_parallel_program_init(WS2812_PARALLEL_PIO, par_sm, offset, pin_base, par_strips, WS2812_PARALLEL_FREQ);
+
+    // 2. DMA: byte writes into the TX FIFO, one plane per DREQ
+    par_chan = dma_claim_unused_channel(true);
+    dma_channel_config cfg = dma_channel_get_default_config(par_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, pio_get_dreq(WS2812_PARALLEL_PIO, par_sm, true));
+    dma_channel_configure(par_chan, &cfg, &WS2812_PARALLEL_PIO->txf[par_sm], par_planes, WS2812_PARALLEL_PLANES, false);
+
+    // 3. All off
+    par_lock = spin_lock_init(spin_lock_claim_unused(true));
+    memset(par_pixels, 0, sizeof(par_pixels));
+    ws2812_parallel_show();
+}
+
+/**
+ * @brief Set one pixel of the frame buffer
+ */
+void ws2812_parallel_set(uint32_t strip, uint32_t index, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (strip >= par_strips || index >= WS2812_PARALLEL_LEN) {
+        return;
+    }
+    par_pixels[index][0][strip] = g;
+    par_pixels[index][1][strip] = r;
+    par_pixels[index][2][strip] = b;
+}
+
+/**
+ * @brief Set all pixels of one strip
+ */
+void ws2812_parallel_fill(uint32_t strip, uint8_t r, uint8_t g, uint8_t b)
+{
+    for (uint32_t i = 0; i < WS2812_PARALLEL_LEN; i++) {
+        ws2812_parallel_set(strip, i, r, g, b);
+    }
+}
+
+/**
+ * @brief Send the frame buffer to all strips
+ */
+void ws2812_parallel_show(void)
+{
+    uint32_t irq = spin_lock_blocking(par_lock);
+    bool start = !par_busy;
+    if (start) {
+        par_busy = true;
+    } else {
+        par_pending = true;  // Sent by the alarm when the current frame has latched
+    }
+    spin_unlock(par_lock, irq);
+
+    if (start) {
+        ws2812_parallel_start();
+        if (add_alarm_in_us(WS2812_PARALLEL_FRAME_US, ws2812_parallel_alarm, NULL, true) < 0) {
+            par_busy = false;  // No alarm slot: never block later frames
+        }
+    }
+}
+
+/**
+ * @brief Check whether a frame is going out or latching
+ */
+bool ws2812_parallel_busy(void)
+{
+    return par_busy;
+}
+
+/**
+ * @brief Get output statistics
+ */
+void ws2812_parallel_get_stats(ws2812_parallel_stats_t *stats)
+{
+    *stats = par_stats;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Convert the frame buffer to bit planes and start the DMA, par_busy owned
+ */
+static void ws2812_parallel_start(void)
+{
+    uint32_t t0 = time_us_32();
+
+    const uint8_t *in = &par_pixels[0][0][0];
+    uint8_t *out = par_planes;
+    for (uint32_t i = 0; i < WS2812_PARALLEL_LEN * 3; i++) {
+        ws2812_parallel_transpose(in, out);
+        in += WS2812_PARALLEL_GROUP;
+        out += WS2812_PARALLEL_GROUP;
+    }
+
+    par_stats.transpose_us = time_us_32() - t0;
+    if (par_stats.transpose_us > par_stats.transpose_max_us) {
+        par_stats.transpose_max_us = par_stats.transpose_us;
+    }
+    par_stats.frames++;
+
+    dma_channel_transfer_from_buffer_now(par_chan, par_planes, WS2812_PARALLEL_PLANES);
+}
+
+/**
+ * @brief Frame has latched: start the pending one, if any
+ * @return >0 reschedules the alarm for the new frame, 0 = idle
+ */
+static int64_t ws2812_parallel_alarm(alarm_id_t id, void *user_data)
+{
+    (void)id;
+    (void)user_data;
+
+    // Late DREQs (bus contention): give the tail of the frame another latch time
+    if (dma_channel_is_busy(par_chan) || !pio_sm_is_tx_fifo_empty(WS2812_PARALLEL_PIO, par_sm)) {
+        return WS2812_PARALLEL_RESET_US;
+    }
+
+    uint32_t irq = spin_lock_blocking(par_lock);
+    bool start = par_pending;
+    par_pending = false;
+    par_busy = start;
+    spin_unlock(par_lock, irq);
+
+    if (!start) {
+        return 0;
+    }
+    ws2812_parallel_start();
+    return WS2812_PARALLEL_FRAME_US;
+}
+
+/**
+ * @brief Transpose one colour of one pixel into its 8 bit planes
+ * @param in 8 bytes, strip 0 first
+ * @param out 8 bytes, MSB plane first, strip n in bit n
+ * @note 8x8 bit matrix transpose on two words (Hacker's Delight, transpose8rS32). Rows are
+ *       loaded strip 7 first so row r lands in bit 7 - r, i.e. strip n in bit n.
+ */
+static void ws2812_parallel_transpose(const uint8_t *in, uint8_t *out)
+{
+    const uint32_t *w = (const uint32_t *)in;
+    uint32_t x = w[1];  // Strips 7..4, strip 7 in the top byte (little endian)
+    uint32_t y = w[0];  // Strips 3..0
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AAu;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AAu;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCCu;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCCu;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0u) | ((y >> 4) & 0x0F0F0F0Fu);
+    y = ((x << 4) & 0xF0F0F0F0u) | (y & 0x0F0F0F0Fu);
+    x = t;
+
+    // Plane 0 (MSB) was the top byte of x: byte swap to store it first
+    uint32_t *o = (uint32_t *)out;
+    o[0] = __builtin_bswap32(x);
+    o[1] = __builtin_bswap32(y);
+}
@@ -0,0 +1,90 @@
+/**
+ * @file ws2812_parallel.h
+ * @brief Parallel WS2812 Strips Driver Header
+ * @note Up to 8 strips on consecutive GPIOs driven at once by the ws2812_parallel PIO program:
+ *       a frame takes as long as one strip, whatever the strip count. Same non-blocking
+ *       show/latch scheme as ws2812_strip. Opt-in: built and started by main.c only when
+ *       WS2812_PARALLEL_STRIPS is set (CMake cache).
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef WS2812_PARALLEL_H
+#define WS2812_PARALLEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ *      DEFINES
+ **********************/
+/* Strips one state machine can drive (one bit-plane byte per bit) */
+#define WS2812_PARALLEL_MAX_STRIPS  8
+
+/* Pixels per strip, shorter strips just ignore the tail */
+#ifndef WS2812_PARALLEL_LEN
+#define WS2812_PARALLEL_LEN         64
+#endif
+
+/* Low time that latches a frame (us) */
+#ifndef WS2812_PARALLEL_RESET_US
+#define WS2812_PARALLEL_RESET_US    300
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Output statistics
+ */
+typedef struct {
+    uint32_t frames;            // Frames sent
+    uint32_t transpose_us;      // Bit-plane conversion time of the last frame
+    uint32_t transpose_max_us;  // Longest conversion time
+} ws2812_parallel_stats_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Initialize the outputs and send an all-off frame
+ * @param pin_base GPIO of strip 0, strip n is on pin_base + n
+ * @param strips Strip count (1..WS2812_PARALLEL_MAX_STRIPS)
+ * @note Claims a state machine on pio0 and a DMA channel, 24-bit (RGB) pixels
+ */
+void ws2812_parallel_init(uint32_t pin_base, uint32_t strips);
+
+/**
+ * @brief Set one pixel of the frame buffer
+ * @param strip Strip
+ * @param index Pixel on that strip, out of range is ignored
+ * @param r Red
+ * @param g Green
+ * @param b Blue
+ */
+void ws2812_parallel_set(uint32_t strip, uint32_t index, uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * @brief Set all pixels of one strip
+ */
+void ws2812_parallel_fill(uint32_t strip, uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * @brief Send the frame buffer to all strips
+ * @note Returns immediately. While a frame is still going out the show is remembered and
+ *       sent when it ends.
+ */
+void ws2812_parallel_show(void);
+
+/**
+ * @brief Check whether a frame is going out or latching
+ */
+bool ws2812_parallel_busy(void);
+
+/**
+ * @brief Get output statistics
+ * @param stats Output: counters since ws2812_parallel_init()
+ */
+void ws2812_parallel_get_stats(ws2812_parallel_stats_t *stats);
+
+#endif /* WS2812_PARALLEL_H */
@@ -0,0 +1,217 @@
+/**
+ * @file ws2812_strip.c
+ * @brief WS2812 LED Strip Driver Implementation
+ * @note The ws2812 PIO program shifts one pixel word per FIFO entry, a DMA channel paced by
+ *       its DREQ feeds a copy of the frame buffer. No interrupt while a frame goes out: the
+ *       frame time is known, one alarm fires after the last bit plus the latch time.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "ws2812_strip.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+#include <string.h>
+
+#include "ws2812.pio.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define WS2812_STRIP_PIO        pio0
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t ws2812_strip_start(void);
+static void ws2812_strip_arm(uint32_t wait_us);
+static int64_t ws2812_strip_alarm(alarm_id_t id, void *user_data);
+static uint32_t ws2812_strip_word(uint8_t r, uint8_t g, uint8_t b);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t strip_pixels[WS2812_STRIP_LEN];     // Frame buffer, written by the application
+static uint32_t strip_tx[WS2812_STRIP_LEN];         // Frame going out, read by DMA
+static uint strip_sm = 0;
+static int strip_chan = -1;
+static uint32_t strip_bits = 24;                    // Bits per pixel on the line
+
+/* Frame state, guarded by strip_lock (show from tasks, the alarm on core 0) */
+static spin_lock_t *strip_lock = NULL;
+static bool strip_busy = false;                     // Frame going out or latching
+static bool strip_pending = false;                  // Show requested while busy
+static ws2812_strip_stats_t strip_stats;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * @brief Initialize the strip and send an all-off frame
+ */
+void ws2812_strip_init(uint32_t pin, bool rgbw)
+{
+    if (strip_chan >= 0) {
+        return;  // Already running
+    }
+
+    // 1. State machine: autopull after one pixel
+    strip_bits = rgbw ? 32 : 24;
+    strip_sm = pio_claim_unused_sm(WS2812_STRIP_PIO, true);
+    uint offset = pio_add_program(WS2812_STRIP_PIO, &ws2812_program);
+    ws2812_program_init(WS2812_STRIP_PIO, strip_sm, offset, pin, WS2812_STRIP_FREQ, rgbw);
+
+    // 2. DMA: frame copy into the TX FIFO, one word per DREQ
+    strip_chan = dma_claim_unused_channel(true);
+    dma_channel_config cfg = dma_channel_get_default_config(strip_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, pio_get_dreq(WS2812_STRIP_PIO, strip_sm, true));
+    dma_channel_configure(strip_chan, &cfg, &WS2812_STRIP_PIO->txf[strip_sm], strip_tx, WS2812_STRIP_LEN, false);
+
+    // 3. All off
+    strip_lock = spin_lock_init(spin_lock_claim_unused(true));
+    ws2812_strip_fill(0, 0, 0);
+    ws2812_strip_show();
+}
+
+/**
+ * @brief Set one pixel of the frame buffer
+ */
+void ws2812_strip_set(uint32_t index, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (index < WS2812_STRIP_LEN) {
+        strip_pixels[index] = ws2812_strip_word(r, g, b);
+    }
+}
+
+/**
+ * @brief Set all pixels of the frame buffer
+ */
+void ws2812_strip_fill(uint8_t r, uint8_t g, uint8_t b)
+{
+    uint32_t word = ws2812_strip_word(r, g, b);
+
+    for (uint32_t i = 0; i < WS2812_STRIP_LEN; i++) {
+        strip_pixels[i] = word;
+    }
+}
+
+/**
+ * @brief Send the frame buffer
+ */
+void ws2812_strip_show(void)
+{
+    uint32_t wait_us = 0;
+
+    uint32_t irq = spin_lock_blocking(strip_lock);
+    strip_stats.shows++;
+    if (strip_busy) {
+        if (strip_pending) {
+            strip_stats.coalesced++;
+        }
+        strip_pending = true;  // Sent by the alarm when the current frame has latched
+    } else {
+        wait_us = ws2812_strip_start();
+    }
+    spin_unlock(strip_lock, irq);
+
+    ws2812_strip_arm(wait_us);
+}
+
+/**
+ * @brief Check whether a frame is going out or latching
+ */
+bool ws2812_strip_busy(void)
+{
+    return strip_busy;
+}
+
+/**
+ * @brief Get strip statistics
+ */
+void ws2812_strip_get_stats(ws2812_strip_stats_t *stats)
+{
+    *stats = strip_stats;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Start a frame, strip_lock held and not busy
+ * @return Time until the next frame may start (us)
+ */
+static uint32_t ws2812_strip_start(void)
+{
+    strip_pending = false;
+
+    // 1. Send a copy, the application can draw the next frame meanwhile
+    memcpy(strip_tx, strip_pixels, sizeof(strip_tx));
+    dma_channel_transfer_from_buffer_now(strip_chan, strip_tx, WS2812_STRIP_LEN);
+    strip_busy = true;
+    strip_stats.frames++;
+
+    // 2. Last bit out (one word of margin), latch, and not faster than the frame period
+    uint32_t wait_us = (uint32_t)(((uint64_t)(WS2812_STRIP_LEN + 1) * strip_bits * 1000000u) / WS2812_STRIP_FREQ) +
+                       WS2812_STRIP_RESET_US;
+    return (wait_us < WS2812_STRIP_FRAME_US) ? WS2812_STRIP_FRAME_US : wait_us;
+}
+
+/**
+ * @brief Schedule the end of the frame just started
+ * @param wait_us Return value of ws2812_strip_start(), 0 = no frame started
+ * @note Outside strip_lock: the alarm pool takes its own lock
+ */
+static void ws2812_strip_arm(uint32_t wait_us)
+{
+    if (wait_us == 0) {
+        return;
+    }
+
+    if (add_alarm_in_us(wait_us, ws2812_strip_alarm, NULL, true) < 0) {
+        strip_busy = false;  // No alarm slot: never block later frames
+    }
+}
+
+/**
+ * @brief Frame has latched: start the pending one, if any
+ * @return >0 reschedules the alarm for the new frame, 0 = idle
+ */
+static int64_t ws2812_strip_alarm(alarm_id_t id, void *user_data)
+{
+    (void)id;
+    (void)user_data;
+
+    // Late DREQs (bus contention): give the tail of the frame another latch time
+    if (dma_channel_is_busy(strip_chan) || !pio_sm_is_tx_fifo_empty(WS2812_STRIP_PIO, strip_sm)) {
+        return WS2812_STRIP_RESET_US;
+    }
+
+    uint32_t wait_us = 0;
+
+    uint32_t irq = spin_lock_blocking(strip_lock);
+    strip_busy = false;
+    if (strip_pending) {
+        wait_us = ws2812_strip_start();
+    }
+    spin_unlock(strip_lock, irq);
+
+    return wait_us;
+}
+
+/**
+ * @brief Pixel in the FIFO word layout: G, R, B from the MSB, white (RGBW) zero
+ */
+static uint32_t ws2812_strip_word(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((uint32_t)g << 24) | ((uint32_t)r << 16) | ((uint32_t)b << 8);
+}
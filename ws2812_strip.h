@@ -0,0 +1,97 @@
+/**
+ * @file ws2812_strip.h
+ * @brief WS2812 LED Strip Driver Header
+ * @note Pixels are drawn into a frame buffer, ws2812_strip_show() hands a copy to DMA and
+ *       returns at once. A timer alarm ends the frame after the reset (latch) time and starts
+ *       the next one if another show is pending, so callers never wait.
+ * @author NIGHT
+ * @date 2025-10-27
+ */
+
+#ifndef WS2812_STRIP_H
+#define WS2812_STRIP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ *      DEFINES
+ **********************/
+/* Pixels on the data pin (1 = the on-board LED, raise for an external strip) */
+#ifndef WS2812_STRIP_LEN
+#define WS2812_STRIP_LEN        1
+#endif
+
+/* Low time that latches a frame (us). 50 for the original WS2812, newer parts need 280. */
+#ifndef WS2812_STRIP_RESET_US
+#define WS2812_STRIP_RESET_US   300
+#endif
+
+/* Shortest frame period (us), caps the refresh rate: shows in between become one frame */
+#ifndef WS2812_STRIP_FRAME_US
+#define WS2812_STRIP_FRAME_US   10000
+#endif
+
+/* Bit rate of the data line */
+#define WS2812_STRIP_FREQ       800000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * @brief Strip statistics
+ */
+typedef struct {
+    uint32_t frames;            // Frames sent
+    uint32_t shows;             // ws2812_strip_show() calls
+    uint32_t coalesced;         // Shows merged into a frame already pending
+} ws2812_strip_stats_t;
+
+/**********************
+ * FUNCTION PROTOTYPES
+ **********************/
+/**
+ * @brief Initialize the strip and send an all-off frame
+ * @param pin Data GPIO
+ * @param rgbw true for 32-bit (RGBW) pixels, false for 24-bit (RGB)
+ * @note Claims a state machine on pio0 and a DMA channel. The frame alarm runs on the
+ *       default alarm pool (core 0).
+ */
+void ws2812_strip_init(uint32_t pin, bool rgbw);
+
+/**
+ * @brief Set one pixel of the frame buffer
+ * @param index Pixel (0 = first on the data line), out of range is ignored
+ * @param r Red
+ * @param g Green
+ * @param b Blue
+ * @note Takes effect with the next ws2812_strip_show()
+ */
+void ws2812_strip_set(uint32_t index, uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * @brief Set all pixels of the frame buffer
+ */
+void ws2812_strip_fill(uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * @brief Send the frame buffer
+ * @note Returns immediately. While a frame is still going out or latching the show is
+ *       remembered and sent when it ends, several shows in that time become one frame with
+ *       the latest pixels, at most one frame per WS2812_STRIP_FRAME_US. Safe from any task or
+ *       interrupt.
+ */
+void ws2812_strip_show(void);
+
+/**
+ * @brief Check whether a frame is going out or latching
+ */
+bool ws2812_strip_busy(void);
+
+/**
+ * @brief Get strip statistics
+ * @param stats Output: counters since ws2812_strip_init()
+ */
+void ws2812_strip_get_stats(ws2812_strip_stats_t *stats);
+
+#endif /* WS2812_STRIP_H */